@@ -0,0 +1,78 @@
+-include $(XEN_ROOT)/config/Paths.mk
+
+CONFIG_RUMP         := 
+ifeq ($(CONFIG_RUMP),y)
+XEN_OS              := NetBSDRump
+endif
+
+# Tools path
+BISON               := 
+FLEX                := 
+PYTHON := /root/.pyenv/versions/2.7.18/bin/python
+PYTHON_PATH         := 
+PY_NOOPT_CFLAGS     := 
+PERL := /usr/bin/perl
+BASH := /bin/bash
+XGETTTEXT           := 
+AS86                := 
+LD86                := 
+BCC                 := 
+IASL                := 
+AWK := /usr/bin/awk
+FETCHER             := 
+SEABIOS_PATH        := 
+OVMF_PATH           := 
+
+# Extra folder for libs/includes
+PREPEND_INCLUDES    := 
+PREPEND_LIB         := 
+APPEND_INCLUDES     := 
+APPEND_LIB          := 
+
+PTHREAD_CFLAGS      := 
+PTHREAD_LDFLAGS     := 
+PTHREAD_LIBS        := 
+
+PTYFUNCS_LIBS       := 
+
+LIBNL3_LIBS         := 
+LIBNL3_CFLAGS       := 
+XEN_TOOLS_RPATH     := 
+
+# Download GIT repositories via HTTP or GIT's own protocol?
+# GIT's protocol is faster and more robust, when it works at all (firewalls
+# may block it). We make it the default, but if your GIT repository downloads
+# fail or hang, please specify GIT_HTTP=y in your environment.
+GIT_HTTP            := 
+
+# Optional components
+XENSTAT_XENTOP      := 
+OCAML_TOOLS         := 
+FLASK_POLICY        := 
+CONFIG_OVMF         := 
+CONFIG_ROMBIOS      := 
+CONFIG_SEABIOS      := 
+CONFIG_QEMU_TRAD    := 
+CONFIG_QEMU_XEN     := 
+CONFIG_BLKTAP2      := 
+CONFIG_QEMUU_EXTRA_ARGS:= 
+CONFIG_LIBNL        := 
+
+CONFIG_SYSTEMD      := 
+SYSTEMD_CFLAGS      := 
+SYSTEMD_LIBS        := 
+XEN_SYSTEMD_DIR     := 
+XEN_SYSTEMD_MODULES_LOAD := 
+
+LINUX_BACKEND_MODULES := 
+
+#System options
+ZLIB                := 
+CONFIG_LIBICONV     := 
+CONFIG_GCRYPT       := 
+EXTFS_LIBS          := 
+CURSES_LIBS         := 
+TINFO_LIBS          := 
+ARGP_LDFLAGS        := 
+
+FILE_OFFSET_BITS    := 
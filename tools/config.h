@@ -0,0 +1,7 @@
+#define HAVE_YAJL_YAJL_VERSION_H 1
+#define HAVE_LIBYAJL 1
+#define HAVE_UTMP_H 1
+#define INCLUDE_LIBUTIL_H <pty.h>
+#define QEMU_XEN_PATH "/bin/true"
+#define HAVE_SYS_EVENTFD_H 1
+#define _FILE_OFFSET_BITS 64
@@ -0,0 +1,18 @@
+/* This file is automatically generated.  Do not edit. */
+static char *initial_sid_to_string[] =
+{
+    "null",
+    "xen",
+    "dom0",
+    "domio",
+    "domxen",
+    "unlabeled",
+    "security",
+    "ioport",
+    "iomem",
+    "irq",
+    "device",
+    "domU",
+    "domDM",
+};
+
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/public/arch-x86_64.h
\ No newline at end of file
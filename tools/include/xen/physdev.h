@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/public/physdev.h
\ No newline at end of file
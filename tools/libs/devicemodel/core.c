@@ -611,6 +611,42 @@ int xendevicemodel_pin_memory_cacheattr(
     return xendevicemodel_op(dmod, domid, 1, &op, sizeof(op));
 }
 
+int xendevicemodel_set_ioreq_server_batch(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int nr_pages)
+{
+    struct xen_dm_op op;
+    struct xen_dm_op_set_ioreq_server_batch *data;
+
+    memset(&op, 0, sizeof(op));
+
+    op.op = XEN_DMOP_set_ioreq_server_batch;
+    data = &op.u.set_ioreq_server_batch;
+
+    data->id = id;
+    data->nr_pages = nr_pages;
+
+    return xendevicemodel_op(dmod, domid, 1, &op, sizeof(op));
+}
+
+int xendevicemodel_set_ioreq_server_bufioreq(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int nr_pages)
+{
+    struct xen_dm_op op;
+    struct xen_dm_op_set_ioreq_server_bufioreq *data;
+
+    memset(&op, 0, sizeof(op));
+
+    op.op = XEN_DMOP_set_ioreq_server_bufioreq;
+    data = &op.u.set_ioreq_server_bufioreq;
+
+    data->id = id;
+    data->nr_pages = nr_pages;
+
+    return xendevicemodel_op(dmod, domid, 1, &op, sizeof(op));
+}
+
 int xendevicemodel_restrict(xendevicemodel_handle *dmod, domid_t domid)
 {
     return osdep_xendevicemodel_restrict(dmod, domid);
@@ -353,6 +353,39 @@ int xendevicemodel_pin_memory_cacheattr(
     xendevicemodel_handle *dmod, domid_t domid, uint64_t start, uint64_t end,
     uint32_t type);
 
+/**
+ * This function allows Xen to batch repeated string I/O forwarded to an
+ * IOREQ Server: a single ioreq with data_is_ptr set may then reference a
+ * data buffer spanning up to @nr_pages pages of guest RAM, all of whose
+ * @count repetitions must be completed before responding.
+ *
+ * @parm dmod a handle to an open devicemodel interface.
+ * @parm domid the domain id to be serviced
+ * @parm id the IOREQ Server id.
+ * @parm nr_pages 1 (the default) to XEN_DMOP_IOREQ_BATCH_MAX_PAGES
+ * @return 0 on success, -1 on failure.
+ */
+int xendevicemodel_set_ioreq_server_batch(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int nr_pages);
+
+/**
+ * This function selects a buffered ioreq ring of @nr_pages pages, using
+ * the buffered_ioring layout with batched notifications, for an IOREQ
+ * Server created with buffered ioreq handling. It must be called before
+ * the server's pages are mapped and before it is enabled; the ring can
+ * then only be mapped using xenforeignmemory_map_resource().
+ *
+ * @parm dmod a handle to an open devicemodel interface.
+ * @parm domid the domain id to be serviced
+ * @parm id the IOREQ Server id.
+ * @parm nr_pages 1 to XEN_DMOP_BUFIOREQ_MAX_PAGES
+ * @return 0 on success, -1 on failure.
+ */
+int xendevicemodel_set_ioreq_server_bufioreq(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int nr_pages);
+
 /**
  * This function restricts the use of this handle to the specified
  * domain.
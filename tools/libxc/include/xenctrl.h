@@ -1098,6 +1098,27 @@ int xc_domain_set_gnttab_limits(xc_interface *xch, uint32_t domid,
                                 uint32_t grant_frames,
                                 uint32_t maptrack_frames);
 
+/**
+ * Working set estimation, from the accessed bits of a HAP domain's p2m.
+ *
+ * xc_domain_wss_enable() starts scanning the first nr_gfns gfns (0: all
+ * currently mapped) every interval_ms.  xc_domain_wss_get() retrieves the
+ * number of completed scans and the age histogram as of the last one (see
+ * XEN_DOMCTL_wss_op), and, if ages isn't NULL, the ages of *nr gfns from
+ * gfn, updating *nr to the number retrieved.
+ */
+typedef struct xc_wss_info {
+    uint64_t nr_gfns;
+    uint64_t scans;
+    uint64_t hist[XEN_DOMCTL_WSS_BUCKETS];
+} xc_wss_info_t;
+
+int xc_domain_wss_enable(xc_interface *xch, uint32_t domid,
+                         uint32_t interval_ms, uint64_t nr_gfns);
+int xc_domain_wss_disable(xc_interface *xch, uint32_t domid);
+int xc_domain_wss_get(xc_interface *xch, uint32_t domid, xc_wss_info_t *info,
+                      uint64_t gfn, uint64_t *nr, uint8_t *ages);
+
 /*
  * CPUPOOL MANAGEMENT FUNCTIONS
  */
@@ -1460,6 +1481,16 @@ int xc_domain_get_pod_target(xc_interface *xch,
                              uint64_t *pod_cache_pages,
                              uint64_t *pod_entries);
 
+/**
+ * Populate-on-demand statistics of an HVM domain, see
+ * XEN_DOMCTL_get_pod_stats.
+ */
+typedef struct xen_domctl_pod_stats xc_pod_stats_t;
+
+int xc_domain_get_pod_stats(xc_interface *xch,
+                            uint32_t domid,
+                            xc_pod_stats_t *stats);
+
 int xc_domain_ioport_permission(xc_interface *xch,
                                 uint32_t domid,
                                 uint32_t first_port,
@@ -1499,6 +1530,19 @@ int xc_lockprof_query(xc_interface *xch,
                       uint64_t *time,
                       xc_hypercall_buffer_t *data);
 
+typedef struct xen_sysctl_sched_stats xc_sched_stats_t;
+/*
+ * Enable, disable or reset (cmd is XEN_SYSCTL_SCHED_STATS_*) the scheduler
+ * overhead accounting. enabled (if not NULL) returns the resulting state.
+ */
+int xc_sched_stats_control(xc_interface *xch, uint32_t cmd, bool *enabled);
+/*
+ * Get the scheduler overhead statistics of each pCPU. Passing a NULL stats
+ * makes *max_cpus be set to the size of the array that is needed.
+ */
+int xc_sched_stats_query(xc_interface *xch, unsigned *max_cpus,
+                         xc_sched_stats_t *stats, bool *enabled);
+
 void *xc_memalign(xc_interface *xch, size_t alignment, size_t size);
 
 /**
@@ -2237,6 +2281,28 @@ int xc_memshr_range_share(xc_interface *xch,
                           uint64_t first_gfn,
                           uint64_t last_gfn);
 
+/* Turn a domain into a copy-on-write clone (a fork) of a parent domain.
+ *
+ * The fork must be a freshly created and paused HVM domain, with as many
+ * vCPUs as the paused parent.  Sharing gets enabled on both domains, and the
+ * fork inherits the parent's memory limit, paging pool size and HVM
+ * parameters, except those belonging to the parent's default ioreq server
+ * or vm_event rings.  See XENMEM_sharing_op_fork for the rest.
+ *
+ * The parent stays paused for as long as the fork exists.
+ *
+ * May fail with EINVAL if either domain isn't suitable, and ENOMEM.
+ */
+int xc_memshr_fork(xc_interface *xch,
+                   uint32_t parent_domain,
+                   uint32_t domid);
+
+/* Reset a paused fork to its parent's state, dropping the memory it got
+ * populated privately.  Much cheaper than creating a new fork.
+ */
+int xc_memshr_fork_reset(xc_interface *xch,
+                         uint32_t domid);
+
 /* Debug calls: return the number of pages referencing the shared frame backing
  * the input argument. Should be one or greater. 
  *
@@ -1315,6 +1315,23 @@ int xc_domain_get_pod_target(xc_interface *xch,
 }
 #endif
 
+int xc_domain_get_pod_stats(xc_interface *xch,
+                            uint32_t domid,
+                            xc_pod_stats_t *stats)
+{
+    int rc;
+    DECLARE_DOMCTL;
+
+    domctl.cmd = XEN_DOMCTL_get_pod_stats;
+    domctl.domain = domid;
+
+    rc = do_domctl(xch, &domctl);
+    if ( !rc )
+        *stats = domctl.u.pod_stats;
+
+    return rc;
+}
+
 int xc_domain_max_vcpus(xc_interface *xch, uint32_t domid, unsigned int max)
 {
     DECLARE_DOMCTL;
@@ -2303,6 +2320,66 @@ int xc_domain_set_gnttab_limits(xc_interface *xch, uint32_t domid,
     return do_domctl(xch, &domctl);
 }
 
+int xc_domain_wss_enable(xc_interface *xch, uint32_t domid,
+                         uint32_t interval_ms, uint64_t nr_gfns)
+{
+    DECLARE_DOMCTL;
+
+    domctl.cmd = XEN_DOMCTL_wss_op;
+    domctl.domain = domid;
+    domctl.u.wss_op.op = XEN_DOMCTL_WSS_OP_ENABLE;
+    domctl.u.wss_op.interval_ms = interval_ms;
+    domctl.u.wss_op.nr = nr_gfns;
+    return do_domctl(xch, &domctl);
+}
+
+int xc_domain_wss_disable(xc_interface *xch, uint32_t domid)
+{
+    DECLARE_DOMCTL;
+
+    domctl.cmd = XEN_DOMCTL_wss_op;
+    domctl.domain = domid;
+    domctl.u.wss_op.op = XEN_DOMCTL_WSS_OP_DISABLE;
+    return do_domctl(xch, &domctl);
+}
+
+int xc_domain_wss_get(xc_interface *xch, uint32_t domid, xc_wss_info_t *info,
+                      uint64_t gfn, uint64_t *nr, uint8_t *ages)
+{
+    int rc;
+    DECLARE_DOMCTL;
+    DECLARE_HYPERCALL_BOUNCE(ages, ages ? *nr : 0,
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, ages) )
+        return -1;
+
+    domctl.cmd = XEN_DOMCTL_wss_op;
+    domctl.domain = domid;
+    domctl.u.wss_op.op = XEN_DOMCTL_WSS_OP_GET;
+    domctl.u.wss_op.gfn = gfn;
+    domctl.u.wss_op.nr = ages ? *nr : 0;
+    set_xen_guest_handle(domctl.u.wss_op.ages, ages);
+
+    rc = do_domctl(xch, &domctl);
+
+    xc_hypercall_bounce_post(xch, ages);
+
+    if ( rc )
+        return rc;
+
+    if ( info )
+    {
+        info->nr_gfns = domctl.u.wss_op.nr_gfns;
+        info->scans = domctl.u.wss_op.scans;
+        memcpy(info->hist, domctl.u.wss_op.hist, sizeof(info->hist));
+    }
+    if ( ages )
+        *nr = domctl.u.wss_op.nr;
+
+    return 0;
+}
+
 /* Plumbing Xen with vNUMA topology */
 int xc_domain_setvnuma(xc_interface *xch,
                        uint32_t domid,
@@ -23,6 +23,7 @@
 #include "xc_private.h"
 #include <xen/memory.h>
 #include <xen/grant_table.h>
+#include <xen/hvm/params.h>
 
 int xc_memshr_control(xc_interface *xch,
                       uint32_t domid,
@@ -200,6 +201,97 @@ int xc_memshr_range_share(xc_interface *xch,
     return xc_memshr_memop(xch, source_domain, &mso);
 }
 
+/* Parameters of the parent's default ioreq server and vm_event rings. */
+static bool fork_skip_param(unsigned int param)
+{
+    switch ( param )
+    {
+    case HVM_PARAM_IOREQ_PFN:
+    case HVM_PARAM_BUFIOREQ_PFN:
+    case HVM_PARAM_BUFIOREQ_EVTCHN:
+    case HVM_PARAM_PAGING_RING_PFN:
+    case HVM_PARAM_MONITOR_RING_PFN:
+    case HVM_PARAM_SHARING_RING_PFN:
+    case HVM_PARAM_ACPI_S_STATE:
+        return true;
+    }
+
+    return false;
+}
+
+int xc_memshr_fork(xc_interface *xch,
+                   uint32_t parent_domain,
+                   uint32_t domid)
+{
+    xen_mem_sharing_op_t mso;
+    xc_dominfo_t info;
+    unsigned long mb = 0;
+    unsigned int i;
+
+    if ( xc_domain_getinfo(xch, parent_domain, 1, &info) != 1 ||
+         info.domid != parent_domain )
+    {
+        ERROR("Could not get info for parent domain %u", parent_domain);
+        errno = EINVAL;
+        return -1;
+    }
+
+    if ( xc_domain_setmaxmem(xch, domid, info.max_memkb) ||
+         xc_shadow_control(xch, parent_domain,
+                           XEN_DOMCTL_SHADOW_OP_GET_ALLOCATION,
+                           NULL, 0, &mb, 0, NULL) ||
+         xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_SET_ALLOCATION,
+                           NULL, 0, &mb, 0, NULL) )
+    {
+        PERROR("Could not size domain %u like its parent", domid);
+        return -1;
+    }
+
+    for ( i = 0; i < HVM_NR_PARAMS; i++ )
+    {
+        uint64_t value;
+
+        if ( fork_skip_param(i) )
+            continue;
+
+        if ( xc_hvm_param_get(xch, parent_domain, i, &value) )
+        {
+            PERROR("Could not get HVM param %u of domain %u", i,
+                   parent_domain);
+            return -1;
+        }
+
+        if ( value && xc_hvm_param_set(xch, domid, i, value) )
+        {
+            PERROR("Could not set HVM param %u of domain %u", i, domid);
+            return -1;
+        }
+    }
+
+    if ( xc_memshr_control(xch, parent_domain, 1) ||
+         xc_memshr_control(xch, domid, 1) )
+        return -1;
+
+    memset(&mso, 0, sizeof(mso));
+
+    mso.op = XENMEM_sharing_op_fork;
+    mso.u.fork.parent_domain = parent_domain;
+
+    return xc_memshr_memop(xch, domid, &mso);
+}
+
+int xc_memshr_fork_reset(xc_interface *xch,
+                         uint32_t domid)
+{
+    xen_mem_sharing_op_t mso;
+
+    memset(&mso, 0, sizeof(mso));
+
+    mso.op = XENMEM_sharing_op_fork_reset;
+
+    return xc_memshr_memop(xch, domid, &mso);
+}
+
 int xc_memshr_domain_resume(xc_interface *xch,
                             uint32_t domid)
 {
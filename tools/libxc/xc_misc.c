@@ -514,6 +514,58 @@ int xc_lockprof_query(xc_interface *xch,
     return rc;
 }
 
+int xc_sched_stats_control(xc_interface *xch, uint32_t cmd, bool *enabled)
+{
+    int rc;
+    DECLARE_SYSCTL;
+
+    if ( cmd == XEN_SYSCTL_SCHED_STATS_query )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    sysctl.cmd = XEN_SYSCTL_sched_stats_op;
+    sysctl.u.sched_stats_op.cmd = cmd;
+    set_xen_guest_handle(sysctl.u.sched_stats_op.stats, HYPERCALL_BUFFER_NULL);
+
+    rc = do_sysctl(xch, &sysctl);
+
+    if ( !rc && enabled )
+        *enabled = sysctl.u.sched_stats_op.enabled;
+
+    return rc;
+}
+
+int xc_sched_stats_query(xc_interface *xch, unsigned *max_cpus,
+                         xc_sched_stats_t *stats, bool *enabled)
+{
+    int rc;
+    DECLARE_SYSCTL;
+    DECLARE_HYPERCALL_BOUNCE(stats, *max_cpus * sizeof(*stats),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( (rc = xc_hypercall_bounce_pre(xch, stats)) )
+        goto out;
+
+    sysctl.cmd = XEN_SYSCTL_sched_stats_op;
+    sysctl.u.sched_stats_op.cmd = XEN_SYSCTL_SCHED_STATS_query;
+    sysctl.u.sched_stats_op.num_cpus = *max_cpus;
+    set_xen_guest_handle(sysctl.u.sched_stats_op.stats, stats);
+
+    if ( (rc = do_sysctl(xch, &sysctl)) != 0 )
+        goto out;
+
+    *max_cpus = sysctl.u.sched_stats_op.num_cpus;
+    if ( enabled )
+        *enabled = sysctl.u.sched_stats_op.enabled;
+
+out:
+    xc_hypercall_bounce_post(xch, stats);
+
+    return rc;
+}
+
 int xc_getcpuinfo(xc_interface *xch, int max_cpus,
                   xc_cpuinfo_t *info, int *nr_cpus)
 {
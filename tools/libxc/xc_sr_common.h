@@ -207,6 +207,26 @@ struct xc_sr_context
             unsigned long *deferred_pages;
             unsigned long nr_deferred_pages;
             xc_hypercall_buffer_t dirty_bitmap_hbuf;
+
+            /* Per-vCPU dirty rings, if Xen provides them. */
+            unsigned int nr_dirty_rings;
+            struct xen_dirty_ring **dirty_rings;
+            xenforeignmemory_resource_handle **dirty_ring_res;
+            /*
+             * Pages collected from the dirty rings.  While valid, these are
+             * the only ones set in the dirty bitmap.
+             */
+            xen_pfn_t *dirty_pfns;
+            unsigned long nr_dirty_pfns;
+            bool dirty_pfns_valid;
+
+            /*
+             * Log-dirty bitmap shared with Xen, if dirty rings aren't
+             * available, mapped in chunks of SHARED_BITMAP_CHUNK frames.
+             */
+            unsigned int nr_shared_chunks;
+            unsigned long **shared_bitmap;
+            xenforeignmemory_resource_handle **shared_bitmap_res;
         } save;
 
         struct /* Restore data. */
@@ -3,6 +3,11 @@
 
 #include "xc_sr_common.h"
 
+/* Size of the per-vCPU dirty rings, in frames of 512 entries each. */
+#define DIRTY_RING_FRAMES 4
+/* Frames per XENMEM_acquire_resource of the shared log-dirty bitmap. */
+#define SHARED_BITMAP_CHUNK 8
+
 /*
  * Writes an Image header and Domain header into the stream.
  */
@@ -398,6 +403,42 @@ static int send_dirty_pages(struct xc_sr_context *ctx,
     return ctx->save.ops.check_vm_state(ctx);
 }
 
+/*
+ * Send the pages collected from the dirty rings, clearing them from the dirty
+ * bitmap as we go.
+ */
+static int send_dirty_pfns(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned long i, nr = ctx->save.nr_dirty_pfns;
+    int rc;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+
+    for ( i = 0; i < nr; ++i )
+    {
+        xen_pfn_t p = ctx->save.dirty_pfns[i];
+
+        clear_bit(p, dirty_bitmap);
+
+        rc = add_to_batch(ctx, p);
+        if ( rc )
+            return rc;
+
+        /* Update progress every 4MB worth of memory sent. */
+        if ( (i & ((1U << (22 - 12)) - 1)) == 0 )
+            xc_report_progress_step(xch, i, nr);
+    }
+
+    rc = flush_batch(ctx);
+    if ( rc )
+        return rc;
+
+    xc_report_progress_step(xch, nr, nr);
+
+    return ctx->save.ops.check_vm_state(ctx);
+}
+
 /*
  * Send all pages in the guests p2m.  Used as the first iteration of the live
  * migration loop, and for a non-live save.
@@ -446,6 +487,246 @@ static int enable_logdirty(struct xc_sr_context *ctx)
     return 0;
 }
 
+/*
+ * Have Xen record dirtied pages in per-vCPU rings as well, so that each
+ * iteration only needs to look at the pages actually dirtied, rather than at
+ * the whole log-dirty bitmap.  Not all guests support this, in which case
+ * the bitmap gets used as before.
+ */
+static void enable_dirty_rings(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int i, nr = ctx->dominfo.max_vcpu_id + 1;
+    unsigned long entries = 0;
+
+    if ( xc_shadow_control(xch, ctx->domid,
+                           XEN_DOMCTL_SHADOW_OP_ENABLE_DIRTY_RINGS,
+                           NULL, DIRTY_RING_FRAMES, NULL, 0, NULL) < 0 )
+    {
+        DPRINTF("Dirty rings unavailable: %d", errno);
+        return;
+    }
+
+    ctx->save.dirty_rings = calloc(nr, sizeof(*ctx->save.dirty_rings));
+    ctx->save.dirty_ring_res = calloc(nr, sizeof(*ctx->save.dirty_ring_res));
+    if ( !ctx->save.dirty_rings || !ctx->save.dirty_ring_res )
+        goto err;
+
+    for ( i = 0; i < nr; ++i )
+    {
+        void *addr = NULL;
+
+        ctx->save.dirty_ring_res[i] = xenforeignmemory_map_resource(
+            xch->fmem, ctx->domid, XENMEM_resource_dirty_ring, i, 0,
+            DIRTY_RING_FRAMES, &addr, PROT_READ | PROT_WRITE, 0);
+        if ( !ctx->save.dirty_ring_res[i] )
+        {
+            PERROR("Failed to map dirty ring of vcpu%u", i);
+            goto err;
+        }
+
+        ctx->save.dirty_rings[i] = addr;
+        ctx->save.nr_dirty_rings = i + 1;
+        entries += ctx->save.dirty_rings[i]->nr_entries;
+    }
+
+    ctx->save.dirty_pfns = malloc(entries * sizeof(*ctx->save.dirty_pfns));
+    if ( !ctx->save.dirty_pfns )
+        goto err;
+
+    return;
+
+ err:
+    /* The rings overflowing doesn't harm, so needn't be turned off. */
+    for ( i = 0; i < ctx->save.nr_dirty_rings; ++i )
+        xenforeignmemory_unmap_resource(xch->fmem,
+                                        ctx->save.dirty_ring_res[i]);
+    ctx->save.nr_dirty_rings = 0;
+    free(ctx->save.dirty_rings);
+    ctx->save.dirty_rings = NULL;
+    free(ctx->save.dirty_ring_res);
+    ctx->save.dirty_ring_res = NULL;
+}
+
+/*
+ * Without dirty rings, have Xen log dirty pages straight into memory mapped
+ * here, rather than copying its bitmap out on every iteration.  Failing to
+ * enable this leaves the copying in place, while failing to map the bitmap
+ * once shared is fatal, as it can't be retrieved any other way anymore.
+ */
+static int enable_shared_bitmap(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned long frames = NRPAGES(bitmap_size(ctx->save.p2m_size));
+    unsigned long i, nr = (frames + SHARED_BITMAP_CHUNK - 1) /
+                          SHARED_BITMAP_CHUNK;
+
+    if ( ctx->save.nr_dirty_rings )
+        return 0;
+
+    if ( xc_shadow_control(xch, ctx->domid,
+                           XEN_DOMCTL_SHADOW_OP_SHARE_BITMAP,
+                           NULL, ctx->save.p2m_size, NULL, 0, NULL) < 0 )
+    {
+        DPRINTF("Shared logdirty bitmap unavailable: %d", errno);
+        return 0;
+    }
+
+    ctx->save.shared_bitmap = calloc(nr, sizeof(*ctx->save.shared_bitmap));
+    ctx->save.shared_bitmap_res =
+        calloc(nr, sizeof(*ctx->save.shared_bitmap_res));
+    if ( !ctx->save.shared_bitmap || !ctx->save.shared_bitmap_res )
+    {
+        ERROR("Unable to allocate memory for shared logdirty bitmap");
+        return -1;
+    }
+
+    for ( i = 0; i < nr; ++i )
+    {
+        void *addr = NULL;
+        unsigned long n = min_t(unsigned long, frames - i * SHARED_BITMAP_CHUNK,
+                                SHARED_BITMAP_CHUNK);
+
+        ctx->save.shared_bitmap_res[i] = xenforeignmemory_map_resource(
+            xch->fmem, ctx->domid, XENMEM_resource_log_dirty_bitmap, 0,
+            i * SHARED_BITMAP_CHUNK, n, &addr, PROT_READ | PROT_WRITE, 0);
+        if ( !ctx->save.shared_bitmap_res[i] )
+        {
+            PERROR("Failed to map logdirty bitmap frames %lu-%lu",
+                   i * SHARED_BITMAP_CHUNK, i * SHARED_BITMAP_CHUNK + n - 1);
+            return -1;
+        }
+
+        ctx->save.shared_bitmap[i] = addr;
+        ctx->save.nr_shared_chunks = i + 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Move the bits set in the shared bitmap into the dirty bitmap.  Xen keeps
+ * setting bits meanwhile, so words are only cleared by atomic exchange.
+ */
+static void harvest_shared_bitmap(struct xc_sr_context *ctx)
+{
+    unsigned long i, words = bitmap_size(ctx->save.p2m_size) /
+                             sizeof(unsigned long);
+    unsigned long chunk_words = SHARED_BITMAP_CHUNK * PAGE_SIZE /
+                                sizeof(unsigned long);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+
+    for ( i = 0; i < words; ++i )
+    {
+        unsigned long *word = &ctx->save.shared_bitmap[i / chunk_words]
+                                                      [i % chunk_words];
+
+        dirty_bitmap[i] = *word ? __atomic_exchange_n(word, 0,
+                                                      __ATOMIC_SEQ_CST)
+                                : 0;
+    }
+}
+
+/*
+ * Collect the pages dirtied since the previous call.  Consumed dirty ring
+ * entries have their pages re-armed for dirty logging by Xen before they get
+ * sent, so that nothing written afterwards goes unnoticed.  Once any ring has
+ * overflowed, the log-dirty bitmap gets retrieved instead, which covers all
+ * pages in the rings as well.
+ */
+static int collect_dirty_pages(struct xc_sr_context *ctx,
+                               xc_shadow_op_stats_t *stats)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int i;
+    bool overflow = false;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+
+    for ( i = 0; i < ctx->save.nr_dirty_rings; ++i )
+        overflow |= ctx->save.dirty_rings[i]->overflow;
+
+    if ( ctx->save.nr_dirty_rings && !overflow )
+    {
+        unsigned long nr = 0;
+
+        if ( !ctx->save.dirty_pfns_valid )
+            bitmap_clear(dirty_bitmap, ctx->save.p2m_size);
+
+        for ( i = 0; i < ctx->save.nr_dirty_rings; ++i )
+        {
+            struct xen_dirty_ring *ring = ctx->save.dirty_rings[i];
+            uint32_t cons = ring->cons, prod = ring->prod;
+
+            xen_rmb();
+
+            for ( ; cons != prod;
+                  cons = cons + 1 < ring->nr_entries ? cons + 1 : 0 )
+            {
+                xen_pfn_t p = ring->gfn[cons];
+
+                if ( p < ctx->save.p2m_size &&
+                     !test_and_set_bit(p, dirty_bitmap) )
+                    ctx->save.dirty_pfns[nr++] = p;
+            }
+
+            xen_mb();
+            ring->cons = cons;
+        }
+
+        if ( xc_shadow_control(xch, ctx->domid,
+                               XEN_DOMCTL_SHADOW_OP_RESET_DIRTY_RINGS,
+                               NULL, 0, NULL, 0, NULL) < 0 )
+        {
+            PERROR("Failed to reset dirty rings");
+            return -1;
+        }
+
+        ctx->save.nr_dirty_pfns = nr;
+        ctx->save.dirty_pfns_valid = true;
+        stats->dirty_count = nr;
+
+        return 0;
+    }
+
+    /*
+     * A shared bitmap gets harvested before dirty logging is re-armed, and
+     * the pages found dirty get sent only afterwards, for writes in between
+     * not to go unnoticed.
+     */
+    if ( ctx->save.nr_shared_chunks )
+    {
+        harvest_shared_bitmap(ctx);
+
+        if ( xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                               NULL, 0, NULL, 0, stats) < 0 )
+        {
+            PERROR("Failed to re-arm logdirty");
+            return -1;
+        }
+
+        return 0;
+    }
+
+    /* All pages in the rings are in the bitmap, too. */
+    for ( i = 0; i < ctx->save.nr_dirty_rings; ++i )
+        ctx->save.dirty_rings[i]->cons = ctx->save.dirty_rings[i]->prod;
+
+    ctx->save.dirty_pfns_valid = false;
+
+    if ( xc_shadow_control(
+             xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+             &ctx->save.dirty_bitmap_hbuf, ctx->save.p2m_size,
+             NULL, 0, stats) != ctx->save.p2m_size )
+    {
+        PERROR("Failed to retrieve logdirty bitmap");
+        return -1;
+    }
+
+    return 0;
+}
+
 static int update_progress_string(struct xc_sr_context *ctx, char **str)
 {
     xc_interface *xch = ctx->xch;
@@ -531,7 +812,9 @@ static int send_memory_live(struct xc_sr_context *ctx)
             if ( rc )
                 goto out;
 
-            rc = send_dirty_pages(ctx, stats.dirty_count);
+            rc = ctx->save.dirty_pfns_valid
+                 ? send_dirty_pfns(ctx)
+                 : send_dirty_pages(ctx, stats.dirty_count);
             if ( rc )
                 goto out;
         }
@@ -548,15 +831,9 @@ static int send_memory_live(struct xc_sr_context *ctx)
         if ( policy_decision != XGS_POLICY_CONTINUE_PRECOPY )
            break;
 
-        if ( xc_shadow_control(
-                 xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
-                 &ctx->save.dirty_bitmap_hbuf, ctx->save.p2m_size,
-                 NULL, 0, &stats) != ctx->save.p2m_size )
-        {
-            PERROR("Failed to retrieve logdirty bitmap");
-            rc = -1;
+        rc = collect_dirty_pages(ctx, &stats);
+        if ( rc )
             goto out;
-        }
 
         policy_stats->dirty_count = stats.dirty_count;
 
@@ -638,11 +915,25 @@ static int suspend_and_send_dirty(struct xc_sr_context *ctx)
     if ( rc )
         goto out;
 
-    if ( xc_shadow_control(
-             xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
-             HYPERCALL_BUFFER(dirty_bitmap), ctx->save.p2m_size,
-             NULL, XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats) !=
-         ctx->save.p2m_size )
+    if ( ctx->save.nr_shared_chunks )
+    {
+        /* Have everything still cached by Xen make it into the bitmap. */
+        if ( xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                               NULL, 0, NULL,
+                               XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats) < 0 )
+        {
+            PERROR("Failed to flush logdirty bitmap");
+            rc = -1;
+            goto out;
+        }
+
+        harvest_shared_bitmap(ctx);
+    }
+    else if ( xc_shadow_control(
+                  xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                  HYPERCALL_BUFFER(dirty_bitmap), ctx->save.p2m_size,
+                  NULL, XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats) !=
+              ctx->save.p2m_size )
     {
         PERROR("Failed to retrieve logdirty bitmap");
         rc = -1;
@@ -733,6 +1024,12 @@ static int send_domain_memory_live(struct xc_sr_context *ctx)
     if ( rc )
         goto out;
 
+    enable_dirty_rings(ctx);
+
+    rc = enable_shared_bitmap(ctx);
+    if ( rc )
+        goto out;
+
     rc = send_memory_live(ctx);
     if ( rc )
         goto out;
@@ -818,9 +1115,21 @@ static int setup(struct xc_sr_context *ctx)
 static void cleanup(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
+    unsigned int i;
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
 
+    for ( i = 0; i < ctx->save.nr_dirty_rings; ++i )
+        xenforeignmemory_unmap_resource(xch->fmem,
+                                        ctx->save.dirty_ring_res[i]);
+    free(ctx->save.dirty_rings);
+    free(ctx->save.dirty_ring_res);
+    free(ctx->save.dirty_pfns);
+    for ( i = 0; i < ctx->save.nr_shared_chunks; ++i )
+        xenforeignmemory_unmap_resource(xch->fmem,
+                                        ctx->save.shared_bitmap_res[i]);
+    free(ctx->save.shared_bitmap);
+    free(ctx->save.shared_bitmap_res);
 
     xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_OFF,
                       NULL, 0, NULL, 0, NULL);
@@ -443,6 +443,85 @@ libxl_cputopology *libxl_get_cpu_topology(libxl_ctx *ctx, int *nb_cpu_out)
     return ret;
 }
 
+libxl_sched_stats *libxl_get_sched_stats(libxl_ctx *ctx, int *nb_cpu_out,
+                                         bool *enabled)
+{
+    GC_INIT(ctx);
+    xc_sched_stats_t *stats;
+    libxl_sched_stats *ret = NULL;
+    int i;
+    unsigned num_cpus = 0;
+
+    /* Setting buffer to NULL makes the call return number of CPUs */
+    if (xc_sched_stats_query(ctx->xch, &num_cpus, NULL, NULL)) {
+        LOGE(ERROR, "Unable to determine number of CPUS");
+        goto out;
+    }
+
+    stats = libxl__zalloc(gc, sizeof(*stats) * num_cpus);
+
+    if (xc_sched_stats_query(ctx->xch, &num_cpus, stats, enabled)) {
+        LOGE(ERROR, "Scheduler statistics hypercall failed");
+        goto out;
+    }
+
+    ret = libxl__zalloc(NOGC, sizeof(libxl_sched_stats) * num_cpus);
+
+    for (i = 0; i < num_cpus; i++) {
+        ret[i].cpupool = stats[i].cpupool;
+        ret[i].schedule_count = stats[i].schedule_count;
+        ret[i].schedule_time = stats[i].schedule_time;
+        ret[i].ctxsw_count = stats[i].ctxsw_count;
+        ret[i].ctxsw_time = stats[i].ctxsw_time;
+        ret[i].lock_count = stats[i].lock_count;
+        ret[i].lock_wait_time = stats[i].lock_wait_time;
+        ret[i].lock_wait_max = stats[i].lock_wait_max;
+        ret[i].wake_count = stats[i].wake_count;
+        ret[i].wake_time = stats[i].wake_time;
+        ret[i].sleep_count = stats[i].sleep_count;
+        ret[i].sleep_time = stats[i].sleep_time;
+    }
+
+    *nb_cpu_out = num_cpus;
+
+ out:
+    GC_FREE;
+    return ret;
+}
+
+int libxl_sched_stats_enable(libxl_ctx *ctx, bool enable)
+{
+    GC_INIT(ctx);
+    int rc = 0;
+
+    if (xc_sched_stats_control(ctx->xch,
+                               enable ? XEN_SYSCTL_SCHED_STATS_enable :
+                                        XEN_SYSCTL_SCHED_STATS_disable,
+                               NULL)) {
+        LOGE(ERROR, "%s scheduler statistics",
+             enable ? "enabling" : "disabling");
+        rc = ERROR_FAIL;
+    }
+
+    GC_FREE;
+    return rc;
+}
+
+int libxl_sched_stats_reset(libxl_ctx *ctx)
+{
+    GC_INIT(ctx);
+    int rc = 0;
+
+    if (xc_sched_stats_control(ctx->xch, XEN_SYSCTL_SCHED_STATS_reset,
+                               NULL)) {
+        LOGE(ERROR, "resetting scheduler statistics");
+        rc = ERROR_FAIL;
+    }
+
+    GC_FREE;
+    return rc;
+}
+
 libxl_pcitopology *libxl_get_pci_topology(libxl_ctx *ctx, int *num_devs)
 {
     GC_INIT(ctx);
@@ -312,6 +312,18 @@
  */
 #define LIBXL_HAVE_VIRIDIAN_CRASH_CTL 1
 
+/*
+ * LIBXL_HAVE_VIRIDIAN_SYNIC indicates that the 'synic' value
+ * is present in the viridian enlightenment enumeration.
+ */
+#define LIBXL_HAVE_VIRIDIAN_SYNIC 1
+
+/*
+ * LIBXL_HAVE_VIRIDIAN_STIMER indicates that the 'stimer' value
+ * is present in the viridian enlightenment enumeration.
+ */
+#define LIBXL_HAVE_VIRIDIAN_STIMER 1
+
 /*
  * LIBXL_HAVE_BUILDINFO_HVM_ACPI_LAPTOP_SLATE indicates that
  * libxl_domain_build_info has the u.hvm.acpi_laptop_slate field.
@@ -1142,6 +1154,15 @@ void libxl_mac_copy(libxl_ctx *ctx, libxl_mac *dst, const libxl_mac *src);
  */
 #define LIBXL_HAVE_PVCALLS 1
 
+/*
+ * LIBXL_HAVE_SCHED_STATS
+ *
+ * If this is defined, libxl_get_sched_stats, libxl_sched_stats_list_free,
+ * libxl_sched_stats_enable and libxl_sched_stats_reset exist, to query and
+ * control the hypervisor's per-pCPU scheduler overhead accounting.
+ */
+#define LIBXL_HAVE_SCHED_STATS 1
+
 typedef char **libxl_string_list;
 void libxl_string_list_dispose(libxl_string_list *sl);
 int libxl_string_list_length(const libxl_string_list *sl);
@@ -1681,6 +1702,14 @@ void libxl_vminfo_list_free(libxl_vminfo *list, int nb_vm);
 libxl_cputopology *libxl_get_cpu_topology(libxl_ctx *ctx, int *nb_cpu_out);
 void libxl_cputopology_list_free(libxl_cputopology *, int nb_cpu);
 
+/* Times are in nanoseconds. *enabled tells whether accounting is active. */
+#define LIBXL_SCHED_STATS_NO_CPUPOOL (~(uint32_t)0)
+libxl_sched_stats *libxl_get_sched_stats(libxl_ctx *ctx, int *nb_cpu_out,
+                                         bool *enabled);
+void libxl_sched_stats_list_free(libxl_sched_stats *, int nb_cpu);
+int libxl_sched_stats_enable(libxl_ctx *ctx, bool enable);
+int libxl_sched_stats_reset(libxl_ctx *ctx);
+
 #define LIBXL_PCITOPOLOGY_INVALID_ENTRY (~(uint32_t)0)
 libxl_pcitopology *libxl_get_pci_topology(libxl_ctx *ctx, int *num_devs);
 void libxl_pcitopology_list_free(libxl_pcitopology *, int num_devs);
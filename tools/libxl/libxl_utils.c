@@ -1036,6 +1036,14 @@ void libxl_cputopology_list_free(libxl_cputopology *list, int nr)
     free(list);
 }
 
+void libxl_sched_stats_list_free(libxl_sched_stats *list, int nr)
+{
+    int i;
+    for (i = 0; i < nr; i++)
+        libxl_sched_stats_dispose(&list[i]);
+    free(list);
+}
+
 void libxl_pcitopology_list_free(libxl_pcitopology *list, int nr)
 {
     int i;
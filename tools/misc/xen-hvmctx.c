@@ -378,10 +378,22 @@ static void dump_viridian_domain(void)
 static void dump_viridian_vcpu(void)
 {
     HVM_SAVE_TYPE(VIRIDIAN_VCPU) p;
+    int i;
     READ(p);
     printf("    VIRIDIAN_VCPU: vp_assist_msr 0x%llx, vp_assist_pending %s\n",
 	   (unsigned long long) p.vp_assist_msr,
 	   p.vp_assist_pending ? "true" : "false");
+    printf("                   scontrol 0x%llx, siefp 0x%llx, simp 0x%llx\n",
+           (unsigned long long) p.scontrol_msr,
+           (unsigned long long) p.siefp_msr,
+           (unsigned long long) p.simp_msr);
+    for ( i = 0 ; i < 16 ; i++ )
+        printf("                   sint%-2i 0x%llx\n", i,
+               (unsigned long long) p.sint_msr[i]);
+    for ( i = 0 ; i < 4 ; i++ )
+        printf("                   stimer%i config 0x%llx, count 0x%llx\n", i,
+               (unsigned long long) p.stimer_config_msr[i],
+               (unsigned long long) p.stimer_count_msr[i]);
 }
 
 static void dump_vmce_vcpu(void)
@@ -0,0 +1,681 @@
+/*
+ * xen-memshrd: deduplicate identical pages of HVM guests through memory
+ * sharing.
+ *
+ * Guest memory gets scanned in passes, read through foreign mappings at a
+ * limited rate.  Every page gets hashed, and pages whose hashes match one
+ * seen earlier in the same pass get nominated, compared byte by byte (their
+ * contents can't change any more once nominated), and shared.  A guest write
+ * to a shared page transparently unshares it again.
+ *
+ * Sharing a page between domains whose memory lives on different NUMA nodes
+ * makes at least one of them access it remotely.  Unless told otherwise,
+ * pages therefore only get shared between domains with the same home node
+ * (the single node their memory is affine to), or among domains spanning
+ * several nodes anyway.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <xenctrl.h>
+#include <xenforeignmemory.h>
+
+#define ERROR(a, b...) fprintf(stderr, a "\n", ## b)
+#define PERROR(a, b...) fprintf(stderr, a ": %s\n", ## b, strerror(errno))
+
+/* Pages mapped (and hashed) at a time. */
+#define BATCH           256
+#define MAX_DOMAINS     256
+#define NO_NODE         (-1)
+
+#define PAGE_WORDS      (XC_PAGE_SIZE / sizeof(uint64_t))
+/* Words accumulated between two scrambles of the hash lanes. */
+#define STRIPE_WORDS    64
+
+struct domain {
+    uint32_t domid;
+    int node;
+    xen_pfn_t max_gpfn;
+};
+
+struct entry {
+    uint64_t hash;
+    uint32_t domid;          /* DOMID_INVALID: unused */
+    int node;
+    xen_pfn_t gfn;
+};
+
+struct candidate {
+    struct entry src;
+    uint32_t domid;
+    xen_pfn_t gfn;
+};
+
+struct stats {
+    uint64_t scanned;        /* pages hashed */
+    uint64_t candidates;     /* pages with a matching hash */
+    uint64_t shared;         /* pages newly shared */
+    uint64_t already;        /* pages found shared already */
+    uint64_t mismatch;       /* hash collisions, or changed contents */
+    uint64_t failed;         /* pages which couldn't be nominated/shared */
+};
+
+static xc_interface *xch;
+static xenforeignmemory_handle *fmem;
+
+static struct entry *table;
+static size_t table_size, table_used;
+
+static struct stats total, pass;
+
+static unsigned long rate = 25600;        /* pages per second */
+static bool numa_aware = true;
+
+static volatile sig_atomic_t interrupted, dump_stats;
+
+static void signal_handler(int sig)
+{
+    if ( sig == SIGUSR1 )
+        dump_stats = 1;
+    else
+        interrupted = sig;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t cpu_ns(void)
+{
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF, &ru);
+
+    return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000000ULL +
+           (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1000ULL;
+}
+
+/*
+ * Page hash, along the lines of XXH3's inner loop: four 64-bit lanes each
+ * accumulate the product of the low and high halves of every word xor-ed
+ * with a per lane key, plus the word itself, and get scrambled once per
+ * stripe to make the hash depend on the position of words.  With SSE2, two
+ * lanes get processed per instruction.  It only needs to be fast and good
+ * enough to make collisions rare: matching pages get compared in full
+ * anyway.
+ */
+static const uint64_t hash_key[4] = {
+    0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL,
+    0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+};
+
+#define HASH_PRIME      0x9e3779b1U
+
+static uint64_t hash_page(const uint64_t *p)
+{
+    uint64_t acc[4] = { 0, 0, 0, 0 }, h;
+    unsigned int i, j;
+
+#ifdef __SSE2__
+    const __m128i prime = _mm_set1_epi32(HASH_PRIME);
+    const __m128i k0 = _mm_loadu_si128((const __m128i *)&hash_key[0]);
+    const __m128i k1 = _mm_loadu_si128((const __m128i *)&hash_key[2]);
+    __m128i a0 = _mm_setzero_si128(), a1 = _mm_setzero_si128();
+
+    for ( i = 0; i < PAGE_WORDS; i += STRIPE_WORDS )
+    {
+        for ( j = i; j < i + STRIPE_WORDS; j += 4 )
+        {
+            __m128i v0 = _mm_load_si128((const __m128i *)&p[j]);
+            __m128i v1 = _mm_load_si128((const __m128i *)&p[j + 2]);
+            __m128i x0 = _mm_xor_si128(v0, k0);
+            __m128i x1 = _mm_xor_si128(v1, k1);
+
+            a0 = _mm_add_epi64(a0, _mm_add_epi64(v0,
+                     _mm_mul_epu32(x0, _mm_srli_epi64(x0, 32))));
+            a1 = _mm_add_epi64(a1, _mm_add_epi64(v1,
+                     _mm_mul_epu32(x1, _mm_srli_epi64(x1, 32))));
+        }
+
+        /* acc = (acc ^ (acc >> 47) ^ key) * prime */
+        a0 = _mm_xor_si128(_mm_xor_si128(a0, _mm_srli_epi64(a0, 47)), k0);
+        a1 = _mm_xor_si128(_mm_xor_si128(a1, _mm_srli_epi64(a1, 47)), k1);
+        a0 = _mm_add_epi64(_mm_mul_epu32(a0, prime),
+                           _mm_slli_epi64(_mm_mul_epu32(
+                               _mm_srli_epi64(a0, 32), prime), 32));
+        a1 = _mm_add_epi64(_mm_mul_epu32(a1, prime),
+                           _mm_slli_epi64(_mm_mul_epu32(
+                               _mm_srli_epi64(a1, 32), prime), 32));
+    }
+
+    _mm_storeu_si128((__m128i *)&acc[0], a0);
+    _mm_storeu_si128((__m128i *)&acc[2], a1);
+#else
+    for ( i = 0; i < PAGE_WORDS; i += STRIPE_WORDS )
+    {
+        unsigned int l;
+
+        for ( j = i; j < i + STRIPE_WORDS; j += 4 )
+            for ( l = 0; l < 4; l++ )
+            {
+                uint64_t x = p[j + l] ^ hash_key[l];
+
+                acc[l] += p[j + l] + (x & 0xffffffffU) * (x >> 32);
+            }
+
+        for ( l = 0; l < 4; l++ )
+            acc[l] = (acc[l] ^ (acc[l] >> 47) ^ hash_key[l]) * HASH_PRIME;
+    }
+#endif
+
+    /* Fold the lanes, and finish off with MurmurHash3's fmix64. */
+    h = acc[0] ^ (acc[1] * 31) ^ (acc[2] * 37) ^ (acc[3] * 41);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+static void table_clear(void)
+{
+    size_t i;
+
+    for ( i = 0; i < table_size; i++ )
+        table[i].domid = DOMID_INVALID;
+    table_used = 0;
+}
+
+static int table_init(size_t size)
+{
+    free(table);
+    table = malloc(size * sizeof(*table));
+    if ( !table )
+        return -1;
+
+    table_size = size;
+    table_clear();
+
+    return 0;
+}
+
+static struct entry *table_slot(struct entry *t, size_t size, uint64_t hash,
+                                int node)
+{
+    size_t i = (hash ^ (unsigned int)node) & (size - 1);
+
+    while ( t[i].domid != DOMID_INVALID &&
+            (t[i].hash != hash || t[i].node != node) )
+        i = (i + 1) & (size - 1);
+
+    return &t[i];
+}
+
+static int table_grow(void)
+{
+    struct entry *old = table;
+    size_t i, old_size = table_size;
+
+    table = NULL;
+    if ( table_init(old_size * 2) )
+    {
+        table = old;
+        table_size = old_size;
+        return -1;
+    }
+
+    for ( i = 0; i < old_size; i++ )
+        if ( old[i].domid != DOMID_INVALID )
+        {
+            *table_slot(table, table_size, old[i].hash, old[i].node) = old[i];
+            table_used++;
+        }
+
+    free(old);
+
+    return 0;
+}
+
+/* Find the page a hash was first seen with, or remember this one. */
+static bool table_lookup(const struct domain *d, xen_pfn_t gfn, uint64_t hash,
+                         struct entry *found)
+{
+    struct entry *e;
+
+    if ( table_used * 2 >= table_size && table_grow() )
+        return false;
+
+    e = table_slot(table, table_size, hash, d->node);
+    if ( e->domid != DOMID_INVALID )
+    {
+        *found = *e;
+        return true;
+    }
+
+    e->hash = hash;
+    e->domid = d->domid;
+    e->node = d->node;
+    e->gfn = gfn;
+    table_used++;
+
+    return false;
+}
+
+static void table_replace(const struct entry *src, uint32_t domid,
+                          xen_pfn_t gfn)
+{
+    struct entry *e = table_slot(table, table_size, src->hash, src->node);
+
+    e->domid = domid;
+    e->gfn = gfn;
+}
+
+static bool same_contents(const struct candidate *c)
+{
+    xen_pfn_t spfn = c->src.gfn, cpfn = c->gfn;
+    void *s, *p;
+    bool same;
+
+    s = xenforeignmemory_map(fmem, c->src.domid, PROT_READ, 1, &spfn, NULL);
+    if ( !s )
+        return false;
+
+    p = xenforeignmemory_map(fmem, c->domid, PROT_READ, 1, &cpfn, NULL);
+    if ( !p )
+    {
+        xenforeignmemory_unmap(fmem, s, 1);
+        return false;
+    }
+
+    same = !memcmp(s, p, XC_PAGE_SIZE);
+
+    xenforeignmemory_unmap(fmem, p, 1);
+    xenforeignmemory_unmap(fmem, s, 1);
+
+    return same;
+}
+
+static void share(const struct candidate *c)
+{
+    uint64_t sh, ch;
+
+    pass.candidates++;
+
+    /*
+     * If the first page seen with this hash can't be shared (any more),
+     * let the next match use this one instead.
+     */
+    if ( xc_memshr_nominate_gfn(xch, c->src.domid, c->src.gfn, &sh) )
+    {
+        table_replace(&c->src, c->domid, c->gfn);
+        pass.failed++;
+        return;
+    }
+
+    if ( xc_memshr_nominate_gfn(xch, c->domid, c->gfn, &ch) )
+    {
+        pass.failed++;
+        return;
+    }
+
+    if ( sh == ch )
+    {
+        pass.already++;
+        return;
+    }
+
+    /*
+     * Both pages are read-only now.  Should either get written to before
+     * being shared, its handle becomes stale and sharing fails.
+     */
+    if ( !same_contents(c) )
+    {
+        pass.mismatch++;
+        return;
+    }
+
+    if ( xc_memshr_share_gfns(xch, c->src.domid, c->src.gfn, sh,
+                              c->domid, c->gfn, ch) )
+        pass.failed++;
+    else
+        pass.shared++;
+}
+
+/* Keep the scan at the configured rate, given 'pages' since 'start'. */
+static void throttle(uint64_t start, uint64_t pages)
+{
+    uint64_t due, now;
+    struct timespec ts;
+
+    if ( !rate )
+        return;
+
+    due = start + pages * 1000000000ULL / rate;
+    now = now_ns();
+    if ( due <= now )
+        return;
+
+    ts.tv_sec = (due - now) / 1000000000ULL;
+    ts.tv_nsec = (due - now) % 1000000000ULL;
+    nanosleep(&ts, NULL);
+}
+
+static int scan_domain(const struct domain *d, uint64_t start)
+{
+    xen_pfn_t gfn, pfns[BATCH];
+    struct candidate cands[BATCH];
+    int err[BATCH];
+
+    for ( gfn = 0; gfn <= d->max_gpfn && !interrupted; )
+    {
+        unsigned int i, nr = d->max_gpfn + 1 - gfn < BATCH ?
+                               d->max_gpfn + 1 - gfn : BATCH;
+        unsigned int nr_cands = 0;
+        uint8_t *va;
+
+        for ( i = 0; i < nr; i++ )
+            pfns[i] = gfn + i;
+
+        va = xenforeignmemory_map(fmem, d->domid, PROT_READ, nr, pfns, err);
+        if ( !va )
+        {
+            PERROR("Failed to map d%u gfns %#"PRI_xen_pfn"-%#"PRI_xen_pfn,
+                   d->domid, gfn, gfn + nr - 1);
+            return -1;
+        }
+
+        for ( i = 0; i < nr; i++ )
+        {
+            struct candidate *c = &cands[nr_cands];
+
+            if ( err[i] )
+                continue;
+
+            pass.scanned++;
+            if ( table_lookup(d, pfns[i],
+                              hash_page((void *)va + i * XC_PAGE_SIZE),
+                              &c->src) &&
+                 (c->src.domid != d->domid || c->src.gfn != pfns[i]) )
+            {
+                c->domid = d->domid;
+                c->gfn = pfns[i];
+                nr_cands++;
+            }
+        }
+
+        /* Nominating pages fails while they are mapped here. */
+        xenforeignmemory_unmap(fmem, va, nr);
+
+        for ( i = 0; i < nr_cands; i++ )
+            share(&cands[i]);
+
+        gfn += nr;
+        throttle(start, pass.scanned);
+    }
+
+    return 0;
+}
+
+/* The only node the domain's memory is affine to, if any. */
+static int home_node(uint32_t domid)
+{
+    xc_nodemap_t nodemap = xc_nodemap_alloc(xch);
+    int i, nr_nodes = xc_get_max_nodes(xch), node = NO_NODE;
+
+    if ( !nodemap || nr_nodes <= 0 ||
+         xc_domain_node_getaffinity(xch, domid, nodemap) )
+        goto out;
+
+    for ( i = 0; i < nr_nodes; i++ )
+    {
+        if ( !(nodemap[i / 8] & (1 << (i % 8))) )
+            continue;
+        if ( node != NO_NODE )
+        {
+            node = NO_NODE;
+            break;
+        }
+        node = i;
+    }
+
+ out:
+    free(nodemap);
+
+    return node;
+}
+
+static bool setup_domain(struct domain *d, const xc_dominfo_t *info)
+{
+    if ( !info->hvm || !info->hap || info->dying || info->shutdown ||
+         !info->domid )
+        return false;
+
+    if ( xc_memshr_control(xch, info->domid, 1) ||
+         xc_domain_maximum_gpfn(xch, info->domid, &d->max_gpfn) )
+    {
+        PERROR("Failed to set up d%u", info->domid);
+        return false;
+    }
+
+    d->domid = info->domid;
+    d->node = numa_aware ? home_node(info->domid) : NO_NODE;
+
+    return true;
+}
+
+/*
+ * Collect the domains to scan: those named on the command line, or all HVM
+ * guests but dom0.
+ */
+static unsigned int get_domains(struct domain *doms, int nr_ids, char **ids)
+{
+    xc_dominfo_t info[MAX_DOMAINS];
+    unsigned int nr = 0;
+    int i, n;
+
+    if ( nr_ids )
+    {
+        for ( i = 0; i < nr_ids && nr < MAX_DOMAINS; i++ )
+        {
+            uint32_t domid = strtoul(ids[i], NULL, 0);
+
+            if ( xc_domain_getinfo(xch, domid, 1, info) == 1 &&
+                 info[0].domid == domid && setup_domain(&doms[nr], info) )
+                nr++;
+        }
+
+        return nr;
+    }
+
+    n = xc_domain_getinfo(xch, 0, MAX_DOMAINS, info);
+    for ( i = 0; i < n; i++ )
+        if ( setup_domain(&doms[nr], &info[i]) )
+            nr++;
+
+    return nr;
+}
+
+static void print_stats(const char *what, const struct stats *s,
+                        uint64_t wall, uint64_t cpu)
+{
+    long freed = xc_sharing_freed_pages(xch);
+    long used = xc_sharing_used_frames(xch);
+
+    printf("%s: scanned %"PRIu64" candidates %"PRIu64" shared %"PRIu64
+           " already %"PRIu64" mismatch %"PRIu64" failed %"PRIu64"\n",
+           what, s->scanned, s->candidates, s->shared, s->already,
+           s->mismatch, s->failed);
+    printf("%s: host saves %ld pages (%ld MiB) in %ld shared frames,"
+           " cpu %.3fs over %.3fs (%.1f%%), %.0f ns/page\n",
+           what, freed, freed >> (20 - XC_PAGE_SHIFT), used,
+           cpu / 1e9, wall / 1e9, wall ? cpu * 100.0 / wall : 0,
+           s->scanned ? (double)cpu / s->scanned : 0);
+    fflush(stdout);
+}
+
+static void add_stats(struct stats *t, const struct stats *s)
+{
+    t->scanned += s->scanned;
+    t->candidates += s->candidates;
+    t->shared += s->shared;
+    t->already += s->already;
+    t->mismatch += s->mismatch;
+    t->failed += s->failed;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-1] [-N] [-i <secs>] [-r <pages/s>] [domid...]\n"
+            "\n"
+            "Deduplicate the memory of the given HVM guests (default: all),\n"
+            "enabling memory sharing for them.  SIGUSR1 prints statistics.\n"
+            "\n"
+            "  -1  do a single pass, and exit\n"
+            "  -N  share pages regardless of the NUMA nodes of domains\n"
+            "  -i  delay between the start of passes (default 60)\n"
+            "  -r  pages to scan per second, 0 for unlimited (default %lu)\n",
+            prog, rate);
+}
+
+int main(int argc, char *argv[])
+{
+    struct sigaction act = { .sa_handler = signal_handler };
+    struct domain doms[MAX_DOMAINS];
+    unsigned int interval = 60, nr, i;
+    uint64_t start_wall, start_cpu;
+    bool once = false;
+    int c, rc = 1;
+
+    while ( (c = getopt(argc, argv, "1Ni:r:")) != -1 )
+    {
+        switch ( c )
+        {
+        case '1':
+            once = true;
+            break;
+
+        case 'N':
+            numa_aware = false;
+            break;
+
+        case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            rate = strtoul(optarg, NULL, 0);
+            break;
+
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    fmem = xenforeignmemory_open(NULL, 0);
+    if ( !xch || !fmem )
+    {
+        PERROR("Failed to open interfaces");
+        goto out;
+    }
+
+    if ( table_init(1 << 16) )
+    {
+        PERROR("Failed to allocate hash table");
+        goto out;
+    }
+
+    sigaction(SIGINT, &act, NULL);
+    sigaction(SIGTERM, &act, NULL);
+    sigaction(SIGUSR1, &act, NULL);
+
+    start_wall = now_ns();
+    start_cpu = cpu_ns();
+
+    while ( !interrupted )
+    {
+        uint64_t wall = now_ns(), cpu = cpu_ns();
+
+        memset(&pass, 0, sizeof(pass));
+        /* Reuse the (possibly grown) table rather than reallocating it. */
+        table_clear();
+
+        nr = get_domains(doms, argc - optind, argv + optind);
+        for ( i = 0; i < nr && !interrupted; i++ )
+            scan_domain(&doms[i], wall);
+
+        add_stats(&total, &pass);
+        print_stats("pass", &pass, now_ns() - wall, cpu_ns() - cpu);
+
+        if ( once )
+            break;
+
+        while ( !interrupted && now_ns() - wall < interval * 1000000000ULL )
+        {
+            if ( dump_stats )
+            {
+                dump_stats = 0;
+                print_stats("total", &total, now_ns() - start_wall,
+                            cpu_ns() - start_cpu);
+            }
+            sleep(1);
+        }
+    }
+
+    print_stats("total", &total, now_ns() - start_wall,
+                cpu_ns() - start_cpu);
+    rc = 0;
+
+ out:
+    free(table);
+    if ( fmem )
+        xenforeignmemory_close(fmem);
+    if ( xch )
+        xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,380 @@
+/*
+ * ioreq-bench.c
+ *
+ * Stand-in device model measuring the cost of forwarding repeated string
+ * I/O to an ioreq server.
+ *
+ * It claims a range of I/O ports of an HVM guest, completes reads with a
+ * fixed pattern, discards writes, and reports request and byte rates once
+ * a second. Drive the ports from within the guest with rep ins/outs (e.g.
+ * "rep insl" in a loop from a small iopl(3) program), and compare runs
+ * with and without batching (-b).
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <xenctrl.h>
+#include <xenevtchn.h>
+#include <xenforeignmemory.h>
+#include <xendevicemodel.h>
+#include <xen/hvm/ioreq.h>
+
+#define ERROR(a, b...) fprintf(stderr, a "\n", ## b)
+#define PERROR(a, b...) fprintf(stderr, a ": %s\n", ## b, strerror(errno))
+
+#define PATTERN 0xa5
+
+struct stats {
+    uint64_t reqs, reps, bytes;
+};
+
+struct bench {
+    domid_t domid;
+    xc_interface *xch;
+    xendevicemodel_handle *dmod;
+    xenforeignmemory_handle *fmem;
+    xenevtchn_handle *xce;
+    xenforeignmemory_resource_handle *fres;
+    shared_iopage_t *iopage;
+    ioservid_t id;
+    unsigned int nr_vcpus;
+    evtchn_port_t *port;
+    struct stats stats;
+};
+
+static volatile sig_atomic_t interrupted;
+
+static void close_handler(int sig)
+{
+    interrupted = sig;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Complete all repetitions of a request referencing a guest buffer in one
+ * go, rather than element by element.
+ */
+static int handle_buffer(struct bench *b, ioreq_t *req)
+{
+    uint64_t bytes = (uint64_t)req->count * req->size;
+    uint64_t start = req->df ? req->data - bytes + req->size : req->data;
+    unsigned int off = start & (XC_PAGE_SIZE - 1);
+    size_t nr = (off + bytes + XC_PAGE_SIZE - 1) >> XC_PAGE_SHIFT;
+    xen_pfn_t pfn[nr];
+    int err[nr];
+    uint8_t *va;
+    unsigned int i;
+
+    for ( i = 0; i < nr; i++ )
+        pfn[i] = (start >> XC_PAGE_SHIFT) + i;
+
+    va = xenforeignmemory_map(b->fmem, b->domid, PROT_READ | PROT_WRITE,
+                              nr, pfn, err);
+    if ( !va )
+    {
+        PERROR("Failed to map %zu guest pages at %#"PRIx64, nr, start);
+        return -1;
+    }
+
+    if ( req->dir == IOREQ_READ )
+        memset(va + off, PATTERN, bytes);
+    else
+    {
+        volatile uint8_t sink = 0;
+        uint64_t j;
+
+        for ( j = 0; j < bytes; j++ )
+            sink ^= va[off + j];
+    }
+
+    xenforeignmemory_unmap(b->fmem, va, nr);
+
+    b->stats.bytes += bytes;
+
+    return 0;
+}
+
+static int handle_ioreq(struct bench *b, ioreq_t *req)
+{
+    if ( req->type != IOREQ_TYPE_PIO )
+        return 0;
+
+    b->stats.reqs++;
+    b->stats.reps += req->count;
+
+    if ( req->data_is_ptr )
+        return handle_buffer(b, req);
+
+    if ( req->dir == IOREQ_READ )
+        memset(&req->data, PATTERN, req->size);
+    b->stats.bytes += req->size;
+
+    return 0;
+}
+
+static int serve(struct bench *b)
+{
+    struct stats last = { 0 };
+    uint64_t t0 = now_ns();
+
+    printf("%10s %12s %12s %12s %10s\n",
+           "seconds", "requests/s", "reps/req", "bytes/req", "MB/s");
+
+    while ( !interrupted )
+    {
+        struct pollfd pfd = { .fd = xenevtchn_fd(b->xce), .events = POLLIN };
+        xenevtchn_port_or_error_t port;
+        uint64_t t1 = now_ns();
+        unsigned int i;
+        ioreq_t *req;
+        int rc;
+
+        if ( t1 - t0 >= 1000000000ULL )
+        {
+            uint64_t reqs = b->stats.reqs - last.reqs;
+            double secs = (t1 - t0) / 1e9;
+
+            printf("%10.2f %12.0f %12.1f %12.1f %10.1f\n", secs,
+                   reqs / secs,
+                   reqs ? (double)(b->stats.reps - last.reps) / reqs : 0,
+                   reqs ? (double)(b->stats.bytes - last.bytes) / reqs : 0,
+                   (b->stats.bytes - last.bytes) / secs / 1e6);
+
+            last = b->stats;
+            t0 = t1;
+        }
+
+        rc = poll(&pfd, 1, 100);
+        if ( rc < 0 && errno != EINTR )
+        {
+            PERROR("poll");
+            return -1;
+        }
+        if ( rc <= 0 )
+            continue;
+
+        port = xenevtchn_pending(b->xce);
+        if ( port < 0 )
+        {
+            PERROR("Failed to read event channel");
+            return -1;
+        }
+        xenevtchn_unmask(b->xce, port);
+
+        for ( i = 0; i < b->nr_vcpus; i++ )
+            if ( b->port[i] == port )
+                break;
+        if ( i == b->nr_vcpus )
+            continue;
+
+        req = &b->iopage->vcpu_ioreq[i];
+        if ( req->state != STATE_IOREQ_READY )
+            continue;
+
+        xen_rmb();
+        req->state = STATE_IOREQ_INPROCESS;
+
+        if ( handle_ioreq(b, req) )
+            return -1;
+
+        xen_wmb();
+        req->state = STATE_IORESP_READY;
+        xenevtchn_notify(b->xce, port);
+    }
+
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-b <pages>] [-n <ports>] <domid> <port>\n"
+            "\n"
+            "  -b  let a single request reference up to <pages> guest pages\n"
+            "      (1 to %u, default 1)\n"
+            "  -n  number of ports to claim (default 4)\n",
+            prog, XEN_DMOP_IOREQ_BATCH_MAX_PAGES);
+}
+
+int main(int argc, char *argv[])
+{
+    struct bench b = { 0 };
+    struct sigaction act = { .sa_handler = close_handler };
+    unsigned int pages = 1, nr_ports = 4, port, i;
+    xc_dominfo_t info;
+    void *addr = NULL;
+    int c, rc = 1;
+
+    while ( (c = getopt(argc, argv, "b:n:")) != -1 )
+    {
+        switch ( c )
+        {
+        case 'b':
+            pages = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'n':
+            nr_ports = strtoul(optarg, NULL, 0);
+            break;
+
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ( argc - optind != 2 || !pages ||
+         pages > XEN_DMOP_IOREQ_BATCH_MAX_PAGES ||
+         !nr_ports || nr_ports > 0x10000 )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    b.domid = strtoul(argv[optind], NULL, 0);
+    port = strtoul(argv[optind + 1], NULL, 0);
+    if ( port + nr_ports > 0x10000 )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    b.xch = xc_interface_open(NULL, NULL, 0);
+    b.dmod = xendevicemodel_open(NULL, 0);
+    b.fmem = xenforeignmemory_open(NULL, 0);
+    b.xce = xenevtchn_open(NULL, 0);
+    if ( !b.xch || !b.dmod || !b.fmem || !b.xce )
+    {
+        PERROR("Failed to open interfaces");
+        goto out;
+    }
+
+    if ( xc_domain_getinfo(b.xch, b.domid, 1, &info) != 1 ||
+         info.domid != b.domid )
+    {
+        ERROR("No such domain %u", b.domid);
+        goto out;
+    }
+    b.nr_vcpus = info.max_vcpu_id + 1;
+
+    b.port = calloc(b.nr_vcpus, sizeof(*b.port));
+    if ( !b.port )
+        goto out;
+
+    if ( xendevicemodel_create_ioreq_server(b.dmod, b.domid,
+                                            HVM_IOREQSRV_BUFIOREQ_OFF,
+                                            &b.id) )
+    {
+        PERROR("Failed to create ioreq server");
+        goto out;
+    }
+
+    b.fres = xenforeignmemory_map_resource(
+        b.fmem, b.domid, XENMEM_resource_ioreq_server, b.id,
+        XENMEM_resource_ioreq_server_frame_ioreq(0), 1, &addr,
+        PROT_READ | PROT_WRITE, 0);
+    if ( !b.fres )
+    {
+        PERROR("Failed to map ioreq page");
+        goto destroy;
+    }
+    b.iopage = addr;
+
+    if ( xendevicemodel_map_io_range_to_ioreq_server(
+             b.dmod, b.domid, b.id, 0, port, port + nr_ports - 1) )
+    {
+        PERROR("Failed to claim ports %#x-%#x", port, port + nr_ports - 1);
+        goto destroy;
+    }
+
+    if ( xendevicemodel_set_ioreq_server_batch(b.dmod, b.domid, b.id,
+                                               pages) )
+    {
+        PERROR("Failed to set batch size");
+        goto destroy;
+    }
+
+    if ( xendevicemodel_set_ioreq_server_state(b.dmod, b.domid, b.id, 1) )
+    {
+        PERROR("Failed to enable ioreq server");
+        goto destroy;
+    }
+
+    for ( i = 0; i < b.nr_vcpus; i++ )
+    {
+        xenevtchn_port_or_error_t p =
+            xenevtchn_bind_interdomain(b.xce, b.domid,
+                                       b.iopage->vcpu_ioreq[i].vp_eport);
+
+        if ( p < 0 )
+        {
+            PERROR("Failed to bind event channel of vCPU%u", i);
+            goto destroy;
+        }
+        b.port[i] = p;
+    }
+
+    sigaction(SIGINT, &act, NULL);
+    sigaction(SIGTERM, &act, NULL);
+
+    printf("Serving ports %#x-%#x of d%u, up to %u page(s) per request\n",
+           port, port + nr_ports - 1, b.domid, pages);
+
+    rc = serve(&b) ? 1 : 0;
+
+ destroy:
+    xendevicemodel_destroy_ioreq_server(b.dmod, b.domid, b.id);
+    if ( b.fres )
+        xenforeignmemory_unmap_resource(b.fmem, b.fres);
+
+ out:
+    free(b.port);
+    if ( b.xce )
+        xenevtchn_close(b.xce);
+    if ( b.fmem )
+        xenforeignmemory_close(b.fmem);
+    if ( b.dmod )
+        xendevicemodel_close(b.dmod);
+    if ( b.xch )
+        xc_interface_close(b.xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
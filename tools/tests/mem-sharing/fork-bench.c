@@ -0,0 +1,229 @@
+/*
+ * fork-bench.c
+ *
+ * Measure how long it takes to fork an HVM guest, and to reset a fork to
+ * its parent's state.
+ *
+ * The parent gets paused, and forked the given number of times.  Each fork
+ * gets created, reset the given number of times (optionally after running
+ * for a while, to have it populate memory privately), and destroyed again.
+ * Latencies get reported as minimum, average and maximum.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+
+#define PERROR(a, b...) fprintf(stderr, a ": %s\n", ## b, strerror(errno))
+
+struct latency {
+    uint64_t min, max, total, nr;
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void account(struct latency *l, uint64_t ns)
+{
+    if ( !l->nr || ns < l->min )
+        l->min = ns;
+    if ( ns > l->max )
+        l->max = ns;
+    l->total += ns;
+    l->nr++;
+}
+
+static void report(const char *what, const struct latency *l)
+{
+    if ( !l->nr )
+        return;
+
+    printf("%-8s %8"PRIu64" runs  min %10.1fus  avg %10.1fus  max %10.1fus\n",
+           what, l->nr, l->min / 1e3, l->total / 1e3 / l->nr, l->max / 1e3);
+}
+
+static int create_fork(xc_interface *xch, const xc_dominfo_t *info,
+                       uint32_t *domid)
+{
+    xc_domain_configuration_t config = info->arch_config;
+    uint32_t flags = XEN_DOMCTL_CDF_hvm_guest | XEN_DOMCTL_CDF_hap;
+    xen_domain_handle_t handle;
+
+    memcpy(handle, info->handle, sizeof(handle));
+    *domid = 0;
+
+    if ( xc_domain_create(xch, info->ssidref, handle, flags, domid,
+                          &config) )
+    {
+        PERROR("Failed to create domain");
+        return -1;
+    }
+
+    if ( xc_domain_max_vcpus(xch, *domid, info->max_vcpu_id + 1) ||
+         xc_domain_pause(xch, *domid) ||
+         xc_memshr_fork(xch, info->domid, *domid) )
+    {
+        PERROR("Failed to fork d%u into d%u", info->domid, *domid);
+        xc_domain_destroy(xch, *domid);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-n <forks>] [-r <resets>] [-t <ms>] <parent domid>\n"
+            "\n"
+            "  -n  number of forks to create (default 100)\n"
+            "  -r  number of resets per fork (default 10)\n"
+            "  -t  let forks run for <ms> milliseconds before each reset\n"
+            "      (default 0)\n",
+            prog);
+}
+
+int main(int argc, char *argv[])
+{
+    struct latency fork = { 0 }, reset = { 0 }, destroy = { 0 };
+    unsigned int nr_forks = 100, nr_resets = 10, run_ms = 0, i, j;
+    xc_interface *xch;
+    xc_dominfo_t info;
+    uint32_t parent;
+    int c, rc = 1;
+
+    while ( (c = getopt(argc, argv, "n:r:t:")) != -1 )
+    {
+        switch ( c )
+        {
+        case 'n':
+            nr_forks = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            nr_resets = strtoul(optarg, NULL, 0);
+            break;
+
+        case 't':
+            run_ms = strtoul(optarg, NULL, 0);
+            break;
+
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ( argc - optind != 1 )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    parent = strtoul(argv[optind], NULL, 0);
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    if ( !xch )
+    {
+        PERROR("Failed to open xc interface");
+        return 1;
+    }
+
+    if ( xc_domain_getinfo(xch, parent, 1, &info) != 1 ||
+         info.domid != parent || !info.hvm || !info.hap )
+    {
+        fprintf(stderr, "d%u is not an HAP guest\n", parent);
+        goto out;
+    }
+
+    if ( xc_domain_pause(xch, parent) )
+    {
+        PERROR("Failed to pause d%u", parent);
+        goto out;
+    }
+
+    for ( i = 0; i < nr_forks; i++ )
+    {
+        uint32_t domid;
+        uint64_t t = now_ns();
+
+        if ( create_fork(xch, &info, &domid) )
+            goto unpause;
+
+        account(&fork, now_ns() - t);
+
+        for ( j = 0; j < nr_resets; j++ )
+        {
+            if ( run_ms )
+            {
+                xc_domain_unpause(xch, domid);
+                usleep(run_ms * 1000);
+                xc_domain_pause(xch, domid);
+            }
+
+            t = now_ns();
+            if ( xc_memshr_fork_reset(xch, domid) )
+            {
+                PERROR("Failed to reset d%u", domid);
+                xc_domain_destroy(xch, domid);
+                goto unpause;
+            }
+            account(&reset, now_ns() - t);
+        }
+
+        t = now_ns();
+        if ( xc_domain_destroy(xch, domid) )
+        {
+            PERROR("Failed to destroy d%u", domid);
+            goto unpause;
+        }
+        account(&destroy, now_ns() - t);
+    }
+
+    rc = 0;
+
+ unpause:
+    report("fork", &fork);
+    report("reset", &reset);
+    report("destroy", &destroy);
+
+    xc_domain_unpause(xch, parent);
+
+ out:
+    xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
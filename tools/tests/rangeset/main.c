@@ -0,0 +1,266 @@
+/*
+ * Unit tests and micro-benchmark for the rangeset code.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <time.h>
+#include <unistd.h>
+
+#include "emul.h"
+
+/* Reference model: one flag per number of a small universe. */
+#define UNIVERSE 1024
+static bool model[UNIVERSE];
+
+static struct domain d;
+
+#define RANGESET_ADD(r, s, e) assert(!rangeset_add_range(r, s, e))
+#define RANGESET_REMOVE(r, s, e) assert(!rangeset_remove_range(r, s, e))
+
+struct check_ctxt {
+    unsigned long next;
+    unsigned long prev_e;
+    unsigned int nr;
+};
+
+/* Reported ranges must be maximal, ascending runs of set numbers. */
+static int check_range(unsigned long s, unsigned long e, void *data)
+{
+    struct check_ctxt *ctxt = data;
+    unsigned long i;
+
+    assert(s <= e && e < UNIVERSE);
+    assert(!ctxt->nr || s > ctxt->prev_e + 1);
+    for ( i = ctxt->next; i < s; i++ )
+        assert(!model[i]);
+    for ( i = s; i <= e; i++ )
+        assert(model[i]);
+
+    ctxt->next = e + 1;
+    ctxt->prev_e = e;
+    ctxt->nr++;
+
+    return 0;
+}
+
+static void check_model(struct rangeset *r)
+{
+    struct check_ctxt ctxt = { };
+    unsigned long i;
+
+    assert(!rangeset_report_ranges(r, 0, ~0UL, check_range, &ctxt));
+    for ( i = ctxt.next; i < UNIVERSE; i++ )
+        assert(!model[i]);
+    assert(rangeset_is_empty(r) == !ctxt.nr);
+}
+
+static bool model_contains(unsigned long s, unsigned long e)
+{
+    for ( ; s <= e; s++ )
+        if ( !model[s] )
+            return false;
+    return true;
+}
+
+static bool model_overlaps(unsigned long s, unsigned long e)
+{
+    for ( ; s <= e; s++ )
+        if ( model[s] )
+            return true;
+    return false;
+}
+
+static void random_range(unsigned long *s, unsigned long *e)
+{
+    unsigned long a = rand() % UNIVERSE, b = rand() % 16;
+
+    *s = a;
+    *e = min(a + b, (unsigned long)UNIVERSE - 1);
+}
+
+static void test_random(void)
+{
+    struct rangeset *r = rangeset_new(&d, "random", 0);
+    unsigned int i;
+
+    assert(r);
+    memset(model, 0, sizeof(model));
+
+    for ( i = 0; i < 200000; i++ )
+    {
+        unsigned long s, e, j;
+
+        random_range(&s, &e);
+        switch ( rand() % 4 )
+        {
+        case 0:
+            RANGESET_ADD(r, s, e);
+            for ( j = s; j <= e; j++ )
+                model[j] = true;
+            break;
+
+        case 1:
+            RANGESET_REMOVE(r, s, e);
+            for ( j = s; j <= e; j++ )
+                model[j] = false;
+            break;
+
+        case 2:
+            assert(rangeset_contains_range(r, s, e) == model_contains(s, e));
+            break;
+
+        case 3:
+            assert(rangeset_overlaps_range(r, s, e) == model_overlaps(s, e));
+            break;
+        }
+
+        if ( !(i % 64) )
+            check_model(r);
+    }
+
+    check_model(r);
+    rangeset_destroy(r);
+}
+
+static int consume_one(unsigned long s, unsigned long e, void *data,
+                       unsigned long *c)
+{
+    unsigned long *total = data;
+
+    *c = 1;
+    ++*total;
+
+    return 0;
+}
+
+static void test_misc(void)
+{
+    struct rangeset *a = rangeset_new(&d, "a", RANGESETF_prettyprint_hex);
+    struct rangeset *b = rangeset_new(&d, "b", 0);
+    unsigned long s, total = 0;
+
+    assert(a && b);
+
+    /* Merging of adjacent ranges, and splitting on removal. */
+    RANGESET_ADD(a, 10, 19);
+    RANGESET_ADD(a, 30, 39);
+    RANGESET_ADD(a, 20, 29);
+    assert(rangeset_contains_range(a, 10, 39));
+    RANGESET_REMOVE(a, 15, 34);
+    assert(rangeset_contains_range(a, 10, 14));
+    assert(!rangeset_overlaps_range(a, 15, 34));
+    assert(rangeset_contains_range(a, 35, 39));
+
+    /* Extremes of the number space. */
+    RANGESET_ADD(b, ~0UL - 1, ~0UL);
+    assert(rangeset_contains_singleton(b, ~0UL));
+    RANGESET_ADD(b, 0, 0);
+    assert(rangeset_contains_singleton(b, 0));
+
+    /* Claims fill the first gap large enough. */
+    assert(!rangeset_claim_range(b, 5, &s) && s == 1);
+    assert(rangeset_contains_range(b, 0, 5));
+
+    rangeset_swap(a, b);
+    assert(rangeset_contains_range(a, 0, 5));
+    assert(rangeset_contains_range(b, 35, 39));
+
+    assert(!rangeset_consume_ranges(b, consume_one, &total));
+    assert(total == 10 && rangeset_is_empty(b));
+
+    /* Range limit. */
+    rangeset_limit(b, 2);
+    RANGESET_ADD(b, 0, 0);
+    RANGESET_ADD(b, 2, 2);
+    assert(rangeset_add_range(b, 4, 4) == -ENOMEM);
+    RANGESET_ADD(b, 1, 1);
+    RANGESET_ADD(b, 4, 4);
+
+    rangeset_domain_destroy(&d);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Lookup cost for sets of disjoint, equally spaced, ranges. */
+static void bench(void)
+{
+    unsigned int nr, i;
+
+    printf("%10s %16s %16s\n", "ranges", "contains (ns)", "add+remove (ns)");
+
+    for ( nr = 16; nr <= 65536; nr *= 4 )
+    {
+        struct rangeset *r = rangeset_new(NULL, "bench", 0);
+        unsigned int lookups = 1 << 22, hits = 0;
+        uint64_t start, lookup_ns, update_ns;
+
+        assert(r);
+        for ( i = 0; i < nr; i++ )
+            RANGESET_ADD(r, i * 16UL, i * 16UL + 7);
+
+        start = now_ns();
+        for ( i = 0; i < lookups; i++ )
+            hits += rangeset_contains_singleton(r, (i * 2654435761U) %
+                                                   (nr * 16UL));
+        lookup_ns = now_ns() - start;
+
+        start = now_ns();
+        for ( i = 0; i < lookups / 16; i++ )
+        {
+            unsigned long s = ((i * 2654435761U) % nr) * 16UL + 10;
+
+            RANGESET_ADD(r, s, s + 1);
+            RANGESET_REMOVE(r, s, s + 1);
+        }
+        update_ns = now_ns() - start;
+
+        printf("%10u %16.1f %16.1f\n", nr, (double)lookup_ns / lookups,
+               (double)update_ns / (lookups / 16));
+        assert(hits);
+        rangeset_destroy(r);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    int c;
+
+    rangeset_domain_initialise(&d);
+
+    test_misc();
+    test_random();
+
+    while ( (c = getopt(argc, argv, "b")) != -1 )
+        if ( c == 'b' )
+            bench();
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
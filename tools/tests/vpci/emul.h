@@ -80,6 +80,8 @@ typedef union {
     };
 } pci_sbdf_t;
 
+#define PCI_CFG_SPACE_SIZE 256
+#define PCI_CFG_SPACE_EXP_SIZE 4096
 #define CONFIG_HAS_VPCI
 #include "vpci.h"
 
@@ -101,7 +103,7 @@ typedef union {
 #define pci_conf_write16(...)
 #define pci_conf_write32(...)
 
-#define PCI_CFG_SPACE_EXP_SIZE 4096
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
 
 #define BUG() assert(0)
 #define ASSERT_UNREACHABLE() assert(0)
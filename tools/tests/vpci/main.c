@@ -16,6 +16,9 @@
  * License along with this program; If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+#include <time.h>
+
 #include "emul.h"
 
 /* Single vcpu (current), and single domain with a single PCI device. */
@@ -141,6 +144,54 @@ void multiwrite4_check(unsigned int reg)
     multiread4_check(reg, val);
 }
 
+/*
+ * Config space access throughput, using a register layout resembling a
+ * device with the header, an MSI and an MSI-X capability trapped.
+ */
+static void bench(void)
+{
+    static const struct {
+        unsigned int offset, size;
+    } layout[] = {
+        /* Command register, BARs and expansion ROM BAR. */
+        { 0x04, 2 },
+        { 0x10, 4 }, { 0x14, 4 }, { 0x18, 4 }, { 0x1c, 4 }, { 0x20, 4 },
+        { 0x24, 4 }, { 0x30, 4 },
+        /* MSI capability at 0x50. */
+        { 0x52, 2 }, { 0x54, 4 }, { 0x58, 4 }, { 0x5c, 2 }, { 0x60, 4 },
+        /* MSI-X capability at 0x70. */
+        { 0x72, 2 },
+    };
+    static uint32_t regs[ARRAY_SIZE(layout)];
+    const unsigned int loops = 20000;
+    struct timespec start, end;
+    unsigned int i, j, size;
+    uint32_t sum = 0;
+
+    for ( i = 0; i < ARRAY_SIZE(layout); i++ )
+        assert(!vpci_add_register(test_pdev.vpci,
+                                  layout[i].size == 2 ? vpci_read16
+                                                      : vpci_read32,
+                                  layout[i].size == 2 ? vpci_write16
+                                                      : vpci_write32,
+                                  layout[i].offset, layout[i].size, &regs[i]));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for ( i = 0; i < loops; i++ )
+        for ( size = 1; size <= 4; size <<= 1 )
+            for ( j = 0; j < PCI_CFG_SPACE_SIZE; j += size )
+            {
+                VPCI_READ(j, size, sum);
+                VPCI_WRITE(j, size, sum);
+            }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("%.1f ns per access\n",
+           ((end.tv_sec - start.tv_sec) * 1e9 + end.tv_nsec - start.tv_nsec) /
+           (loops * 2.0 * (PCI_CFG_SPACE_SIZE / 4 + PCI_CFG_SPACE_SIZE / 2 +
+                           PCI_CFG_SPACE_SIZE)));
+}
+
 int
 main(int argc, char **argv)
 {
@@ -160,6 +211,12 @@ main(int argc, char **argv)
     INIT_LIST_HEAD(&vpci.handlers);
     spin_lock_init(&vpci.lock);
 
+    if ( argc > 1 && !strcmp(argv[1], "-b") )
+    {
+        bench();
+        return 0;
+    }
+
     VPCI_ADD_REG(vpci_read32, vpci_write32, 0, 4, r0);
     VPCI_READ_CHECK(0, 4, r0);
     VPCI_WRITE_CHECK(0, 4, 0xbcbcbcbc);
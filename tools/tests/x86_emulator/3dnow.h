@@ -0,0 +1,329 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_32_D_8f4[] = {
+0x44e800eb, 0x81000007, 0x000769c1, 0xe5895500,
+0xe4ec8153, 0xc7000000, 0x0000f445, 0x0ff3bf80,
+0xffe09910, 0x0ff3ffff, 0xffe48110, 0x0ff3ffff,
+0xf3e05d11, 0xe845110f, 0x5d110ff3, 0x110ff3f0,
+0x0ff3e445, 0x0fec5d11, 0x0fe07512, 0xf3c87513,
+0xc84d100f, 0x0ff3d231, 0xb8cc5510, 0x00000000,
+0xe04d2e0f, 0x0fc29b0f, 0xdaf7d045, 0xff209589,
+0xd231ffff, 0xe4552e0f, 0xb5100ff3, 0xffffff20,
+0x0fc29b0f, 0xdaf7d045, 0xff1c9589, 0x60baffff,
+0xf3000002, 0x1cbd100f, 0x0fffffff, 0x130ff714,
+0xffff20b5, 0x9d6f0fff, 0xffffff20, 0x81dbd70f,
+0x0000fffb, 0x85850f00, 0xf3000006, 0xe065100f,
+0x6d100ff3, 0x580ff3e4, 0x580ff3e1, 0xe5140fea,
+0xd065130f, 0x65100ff3, 0xf3d231e0, 0x0fe4580f,
+0xf3d0652e, 0xe465100f, 0x0fc29b0f, 0xdaf7d045,
+0xff209589, 0x0ff3ffff, 0xd231e458, 0xbd100ff3,
+0xffffff20, 0xd4652e0f, 0x0fc29b0f, 0xdaf7d045,
+0xff1c9589, 0x66baffff, 0xf3000002, 0x1cb5100f,
+0x0fffffff, 0x130ffe14, 0xffff20bd, 0xa56f0fff,
+0xffffff20, 0x81dcd70f, 0x0000fffb, 0xfd850f00,
+0xf3000005, 0xd065100f, 0x6d100ff3, 0x5c0ff3d4,
+0x0ff3e065, 0x0fe46d5c, 0x130fe514, 0xd231d865,
+0xd84d2e0f, 0x0fc29b0f, 0xdaf7d045, 0xff209589,
+0xd231ffff, 0xdc552e0f, 0xb5100ff3, 0xffffff20,
+0x0fc29b0f, 0xdaf7d045, 0xff1c9589, 0x6bbaffff,
+0xf3000002, 0x1cbd100f, 0x0fffffff, 0x130ff714,
+0xffff20b5, 0xad6f0fff, 0xffffff20, 0x81ddd70f,
+0x0000fffb, 0x85850f00, 0xf3000005, 0xe04d590f,
+0x55590ff3, 0x590ff3e4, 0xca140fc0, 0x0fc3140f,
+0x0fc84d13, 0xf3d04513, 0xe04d100f, 0x55100ff3,
+0x100ff3e8, 0x0ff3e445, 0xf3ec5d10, 0xf3d1580f,
+0x0fd8580f, 0x130fd314, 0x280fd855, 0xf3d231d9,
+0xe85d5c0f, 0x65100ff3, 0x590ff3c8, 0x0ff3d85d,
+0x0fd0655c, 0x0ff3d028, 0x0fec555c, 0x0ff3e32e,
+0x0fcc5d10, 0x0ff3c29b, 0x0fdc5559, 0x0ff3d045,
+0xf7d45d5c, 0x209589da, 0x31ffffff, 0x100ff3d2,
+0xffff20bd, 0xda2e0fff, 0x0fc29b0f, 0xdaf7d045,
+0xff1c9589, 0x82baffff, 0xf3000002, 0x1cad100f,
+0x0fffffff, 0x130ffd14, 0xffff20bd, 0xb56f0fff,
+0xffffff20, 0x81ded70f, 0x0000fffb, 0xbd850f00,
+0xf3000004, 0xf45d100f, 0xf3d1280f, 0x0fd8590f,
+0x130fd314, 0xd231c855, 0x4d5e0ff3, 0x5e0ff3f0,
+0x2e0ff445, 0x9b0fc84d, 0xd0450fc2, 0x9589daf7,
+0xffffff20, 0x2e0fd231, 0x0ff3cc45, 0xff20ad10,
+0x9b0fffff, 0xd0450fc2, 0x9589daf7, 0xffffff1c,
+0x00028bba, 0x100ff300, 0xffff1cb5, 0xee140fff,
+0x20ad130f, 0x0fffffff, 0xff20bd6f, 0xd70fffff,
+0xfffb81df, 0x0f000000, 0x00044385, 0x100ff300,
+0xd231f045, 0x89100ff3, 0xfffffff0, 0x55100ff3,
+0xd8280fe0, 0xf3d9570f, 0xc85d590f, 0x0fd1570f,
+0x0ff3da2e, 0x0ff45510, 0x0ff3c29b, 0x0fe45d10,
+0xdaf7d045, 0x89e2280f, 0xffff2095, 0xe1570fff,
+0x65590ff3, 0xcb570fcc, 0xb5100ff3, 0xffffff20,
+0x2e0fd231, 0xc29b0fe1, 0xf7d0450f, 0x1c9589da,
+0xbaffffff, 0x0000028e, 0xbd100ff3, 0xffffff1c,
+0x0ff7140f, 0xff20b513, 0x6f0fffff, 0xffff209d,
+0xcbd70fff, 0x00fff981, 0x850f0000, 0x000003b0,
+0xe04d0f0f, 0x450f0f96, 0x0f0fbbe0, 0x7f0f96c0,
+0x7f0fb84d, 0x0ff3c045, 0xf3c04d10, 0xbc4d110f,
+0xb8456f0f, 0xe0450f0f, 0x450f0fa6, 0x7f0fb6b8,
+0x0f0fc845, 0x0f96c84d, 0xbbc8450f, 0x96c00f0f,
+0xa84d7f0f, 0xb0457f0f, 0x4d100ff3, 0x110ff3b0,
+0x6f0fac4d, 0x0f0fa845, 0x31a6c845, 0x100ff3d2,
+0x0f0fe04d, 0x0fb6a845, 0x0f1dc00f, 0x0f0dc00f,
+0xf3a0457f, 0xa065100f, 0x98457f0f, 0x5d100ff3,
+0xe12e0fe4, 0x65100ff3, 0xc29b0f9c, 0xf7d0450f,
+0x209589da, 0x31ffffff, 0xe32e0fd2, 0xbd100ff3,
+0xffffff20, 0x0fc29b0f, 0xdaf7d045, 0xff1c9589,
+0x96baffff, 0xf3000002, 0x1cad100f, 0x0fffffff,
+0x130ffd14, 0xffff20bd, 0xa56f0fff, 0xffffff20,
+0x81ccd70f, 0x0000fff9, 0xd1850f00, 0xf3000002,
+0xf3db590f, 0x0fc9590f, 0x130fcb14, 0x0f0fc84d,
+0x0f97c84d, 0xbbc8450f, 0x97c00f0f, 0x884d7f0f,
+0x90457f0f, 0x4d100ff3, 0x110ff390, 0x6f0f8c4d,
+0x6f0f884d, 0xc10f0fc1, 0x450f0fb4, 0x0f0fa7c8,
+0x7f0fb6c1, 0x0f0fd045, 0x0f96d04d, 0xbbd0450f,
+0x96c00f0f, 0x788d7f0f, 0x0fffffff, 0xf380457f,
+0x804d100f, 0x8d110ff3, 0xffffff7c, 0x78856f0f,
+0x0fffffff, 0xa6d0450f, 0x0f0fd231, 0xffff7885,
+0x0f0fb6ff, 0x0f0f1dc0, 0x7f0f0dc0, 0xffff7085,
+0x100ff3ff, 0xffff708d, 0x857f0fff, 0xffffff68,
+0xe04d2e0f, 0x8d100ff3, 0xffffff6c, 0x0fc29b0f,
+0xdaf7d045, 0xff209589, 0xd231ffff, 0xe44d2e0f,
+0xad100ff3, 0xffffff20, 0x0fc29b0f, 0xdaf7d045,
+0xff1c9589, 0x9dbaffff, 0xf3000002, 0x1cb5100f,
+0x0fffffff, 0x130fee14, 0xffff20ad, 0xad6f0fff,
+0xffffff20, 0x81cdd70f, 0x0000fff9, 0xcd850f00,
+0x0f000001, 0x1dd0550f, 0xe04d0f0f, 0xd20f0f96,
+0x450f0f0d, 0x0f0fbbe0, 0x7f0f96c0, 0xffff588d,
+0x857f0fff, 0xffffff60, 0x8d100ff3, 0xffffff60,
+0x8d110ff3, 0xffffff5c, 0xe04d6f0f, 0x58856f0f,
+0x0fffffff, 0xff50957f, 0x0f0fffff, 0xd231a6c1,
+0x40957f0f, 0xf3ffffff, 0x508d100f, 0x0fffffff,
+0xff58850f, 0x0fb6ffff, 0x0f1dc00f, 0x0f0dc00f,
+0xff48857f, 0x2e0fffff, 0xffff488d, 0x857f0fff,
+0xffffff38, 0x8d100ff3, 0xffffff44, 0x0fc29b0f,
+0xdaf7d045, 0xff209589, 0xd231ffff, 0x3c8d2e0f,
+0xf3ffffff, 0x20b5100f, 0x0fffffff, 0x450fc29b,
+0x89daf7d0, 0xffff1c95, 0x029fbaff, 0x0ff30000,
+0xff1cbd10, 0x140fffff, 0xb5130ff7, 0xffffff20,
+0x20b56f0f, 0x0fffffff, 0xf981ced7, 0x000000ff,
+0x00ea850f, 0x7f0f0000, 0xffff308d, 0x100ff3ff,
+0xffff308d, 0x8d7f0fff, 0xffffff28, 0x9d100ff3,
+0xffffff2c, 0xc8590ff3, 0xda590ff3, 0x45590ff3,
+0x590ff3e8, 0x280fec55, 0xfb140ff9, 0x0fc2140f,
+0xff20bd13, 0x6f0fffff, 0xffff2085, 0x45130fff,
+0xc86f0fd0, 0xd04d0f0f, 0x4d7f0fa4, 0x450f0fd8,
+0x7f0f94d0, 0x0ff3d045, 0x31d04510, 0x100ff3d2,
+0x0ff3e04d, 0xf3d84558, 0xe84d580f, 0x45590ff3,
+0xc12e0ff0, 0x45100ff3, 0xc29b0fd4, 0x4d100ff3,
+0xd0450fe4, 0x45580ff3, 0xf3daf7dc, 0xec4d580f,
+0x45590ff3, 0x209589f4, 0x31ffffff, 0x100ff3d2,
+0xffff20ad, 0xc12e0fff, 0x0fc29b0f, 0xdaf7d045,
+0xff1c9589, 0x0ff3ffff, 0xff1cb510, 0x140fffff,
+0xad130fee, 0xffffff20, 0x20bd6f0f, 0x0fffffff,
+0xfa81d7d7, 0x000000ff, 0x000348ba, 0xd0440f00,
+0x00e4c481, 0xd0890000, 0x8bc35d5b, 0x00c3240c,
+0x3f800000, 0x40000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003574,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_32_D_f4[] = {
+0x895520eb, 0x558d52e5, 0xfc4589fc, 0x3c80c031,
+0x0a75ff10, 0x04f88340, 0x01b0f475, 0xc03102eb,
+0x8955c3c9, 0xfde853e5, 0x81000003, 0x000425c3,
+0xd4ec8100, 0xf3000000, 0xe083100f, 0xf3ffffff,
+0x4c85110f, 0xf3ffffff, 0x5085110f, 0xf3ffffff,
+0x5485110f, 0x8bffffff, 0xffff4c85, 0x408589ff,
+0xf3ffffff, 0x4085100f, 0x31ffffff, 0x0000b9c0,
+0x2e0f0000, 0xffff4c85, 0xc09b0fff, 0xf7c1450f,
+0xff7ce8d8, 0xc288ffff, 0x000260b8, 0x0fd28400,
+0x00038a84, 0x100ff300, 0xffff4085, 0x580ff3ff,
+0xffff4c85, 0x110ff3ff, 0xffff4485, 0x100ff3ff,
+0xffff4c85, 0xf3c031ff, 0x0fc0580f, 0xff44852e,
+0x9b0fffff, 0xc1450fc0, 0x33e8d8f7, 0x88ffffff,
+0x0266b8c2, 0xd2840000, 0x0341840f, 0x0ff30000,
+0xff448510, 0x0ff3ffff, 0xff4c855c, 0x0ff3ffff,
+0xff288511, 0x858bffff, 0xffffff28, 0xff7c8589,
+0x8589ffff, 0xffffff44, 0xff488589, 0x0ff3ffff,
+0xff408510, 0xc031ffff, 0x48852e0f, 0x0fffffff,
+0x450fc09b, 0xe8d8f7c1, 0xfffffed6, 0x6bb8c288,
+0x84000002, 0xe4840fd2, 0xf3000002, 0x4085100f,
+0xf3ffffff, 0x4c85590f, 0xf3ffffff, 0x4085110f,
+0xf3ffffff, 0x5085100f, 0xf3ffffff, 0xf3c0590f,
+0x4485110f, 0xf3ffffff, 0x4c85100f, 0xf3ffffff,
+0x5085580f, 0xf3ffffff, 0x4885110f, 0xf3ffffff,
+0x4c85100f, 0x31ffffff, 0x100ff3c0, 0xffff4095,
+0xc8280fff, 0x8d5c0ff3, 0xffffff50, 0x955c0ff3,
+0xffffff44, 0x8d590ff3, 0xffffff48, 0x8d110ff3,
+0xffffff48, 0x0fd12e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffe3e, 0x82b8c288, 0x84000002, 0x4c840fd2,
+0xf3000002, 0x5485590f, 0xf3ffffff, 0x4085110f,
+0xf3ffffff, 0x4c85100f, 0x31ffffff, 0x5e0ff3c0,
+0xffff5485, 0x852e0fff, 0xffffff40, 0x85110ff3,
+0xffffff44, 0x0fc09b0f, 0xd8f7c145, 0xfffdf1e8,
+0xb8c288ff, 0x0000028b, 0x840fd284, 0x000001ff,
+0x93100ff3, 0xfffffff0, 0x0ff3c031, 0xff548510,
+0x0ff3ffff, 0xff4c8d10, 0x570fffff, 0x590ff3c2,
+0xffff4085, 0xca570fff, 0x0fc12e0f, 0x450fc09b,
+0xe8d8f7c1, 0xfffffdaa, 0x8eb8c288, 0x84000002,
+0xb8840fd2, 0xf3000001, 0x4c85530f, 0xf3ffffff,
+0x4085110f, 0xf3ffffff, 0x408d530f, 0xf3ffffff,
+0xf3c12c0f, 0x4c85100f, 0xf3ffffff, 0x31c82a0f,
+0xc82e0fc0, 0x0fc09b0f, 0xd8f7c145, 0xfffd61e8,
+0xb8c288ff, 0x00000296, 0x840fd284, 0x0000016f,
+0xc0590ff3, 0x85110ff3, 0xffffff40, 0x85520ff3,
+0xffffff40, 0x85110ff3, 0xffffff44, 0x85530ff3,
+0xffffff44, 0xc02c0ff3, 0xc02a0ff3, 0x2e0fc031,
+0xffff4c85, 0xc09b0fff, 0xf7c1450f, 0xfd10e8d8,
+0xc288ffff, 0x00029db8, 0x0fd28400, 0x00011e84,
+0x2c0ff300, 0xffff4485, 0x530ff3ff, 0xffff4c85,
+0x2a0ff3ff, 0x2c0ff3c8, 0x2a0ff3c0, 0x0fc031c0,
+0x9b0fc82e, 0xc1450fc0, 0xd3e8d8f7, 0x88fffffc,
+0x029fb8c2, 0xd2840000, 0x00e1840f, 0x0ff30000,
+0xff4c8510, 0x0ff3ffff, 0x0ff3c059, 0xff408511,
+0x0ff3ffff, 0xff4c8d10, 0xc031ffff, 0x85510ff3,
+0xffffff40, 0x0fc12e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffc8e, 0xa7b8c288, 0x84000002, 0x9c840fd2,
+0xf3000000, 0x5485100f, 0xf3ffffff, 0xf3c8590f,
+0x5085590f, 0xf3ffffff, 0x408d110f, 0xf3ffffff,
+0x4485110f, 0xf3ffffff, 0x4085100f, 0xf3ffffff,
+0x44855f0f, 0xf3ffffff, 0x4885110f, 0xf3ffffff,
+0x4085100f, 0xf3ffffff, 0x44855d0f, 0xf3ffffff,
+0x4485110f, 0xf3ffffff, 0x4485100f, 0x31ffffff,
+0x100ff3c0, 0xffff4c8d, 0x0000baff, 0x0ff30000,
+0xff488558, 0x0ff3ffff, 0xff508d58, 0x0ff3ffff,
+0xff548559, 0x2e0fffff, 0xc09b0fc1, 0xf7c2450f,
+0xfbece8d8, 0x013cffff, 0x4825c019, 0x81000003,
+0x0000d4c4, 0xc35d5b00, 0xc3241c8b, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002134,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_64_D_8f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xe8458948, 0x000001b8, 0xe0c148fe, 0x4589481e,
+0x00b848f0, 0x003f8000, 0x48bf8000, 0xf3f84589,
+0xe84d7e0f, 0xd04d130f, 0x457e0ff3, 0x0260b8d0,
+0xc20f0000, 0x0f6600c8, 0xb60fd1d7, 0xfffa81d2,
+0x0f000000, 0x00032785, 0x7e0ff300, 0x580fe84d,
+0x4d130fc8, 0x7e0ff3d8, 0x0ff3e84d, 0xb8d8557e,
+0x00000266, 0x0fc9580f, 0x6600cac2, 0x0fd1d70f,
+0xfa81d2b6, 0x000000ff, 0x02f2850f, 0x0ff30000,
+0x0fe84d7e, 0x130fd15c, 0x0ff3e055, 0xb8e04d7e,
+0x0000026b, 0x00c8c20f, 0xd1d70f66, 0x81d2b60f,
+0x0000fffa, 0xc5850f00, 0xf3000002, 0xf0557e0f,
+0x4d7e0ff3, 0xc8590fe8, 0x0fea280f, 0x0ff3ea59,
+0x0fe8457e, 0x0ff3d058, 0x0ff05d7e, 0x5c0fe028,
+0x0282b8cd, 0x5c0f0000, 0xd4590fe3, 0x00cac20f,
+0xd1d70f66, 0x81d2b60f, 0x0000fffa, 0x7d850f00,
+0xf3000002, 0xf84d7e0f, 0xf3c8590f, 0xf8557e0f,
+0x00028bb8, 0x15160f00, 0x0000026c, 0x0fc25e0f,
+0x6600c1c2, 0x0fd0d70f, 0xfa81d2b6, 0x000000ff,
+0x024a850f, 0x0ff30000, 0xb8f8657e, 0x0000028e,
+0x157e0ff3, 0x00000248, 0x0fc4280f, 0x590fc257,
+0x7e0ff3c1, 0x570fe84d, 0xc1c20fca, 0xd70f6600,
+0xd2b60fd0, 0x00fffa81, 0x850f0000, 0x00000210,
+0xe8450f0f, 0x7e0ff396, 0x0ff3e845, 0x280fe8d6,
+0xc0c60ff5, 0x45130fe1, 0x4d0f0fc8, 0x0ff396c8,
+0x140ff9d6, 0xd60ff2f7, 0xc86f0fc6, 0xe84d0f0f,
+0xc80f0fa6, 0x4d7f0fb6, 0x450f0fd0, 0x0ff396d0,
+0xf3d0457e, 0x0fe8d60f, 0x0fe1c0c6, 0x0fc84513,
+0x96c84d0f, 0xf9d60ff3, 0x0fcf280f, 0x140ffd28,
+0xd60ff2f9, 0xc86f0fc7, 0xd04d0f0f, 0x7e0ff3a6,
+0x96b8e84d, 0x0f000002, 0x0fb6c80f, 0xf3c84d7f,
+0xc8757e0f, 0xc65b0ff3, 0x0fc05b0f, 0x6600c1c2,
+0x0fd0d70f, 0xfa81d2b6, 0x000000ff, 0x016e850f,
+0x280f0000, 0xc1590fc1, 0xd045130f, 0xd0450f0f,
+0x7e0ff397, 0x0ff3d045, 0xc60fe8d6, 0x130fe1c0,
+0x280fc845, 0x4d0f0fc5, 0x0ff397c8, 0x140ff9d6,
+0xf0280fc7, 0xe8d60ff2, 0xf2f0590f, 0x0fc6d60f,
+0xa7d0450f, 0xb6c50f0f, 0xd8457f0f, 0xd8450f0f,
+0x7e0ff396, 0x0ff3d845, 0xc60ff8d6, 0x130fe1c0,
+0x0f0fc845, 0xf396c84d, 0x0ff1d60f, 0x280fd628,
+0xf2140ff7, 0xc6d60ff2, 0x0fc86f0f, 0xa6d84d0f,
+0x00029db8, 0xc80f0f00, 0x4d7f0fb6, 0x7e0ff3c8,
+0x0ff3c86d, 0x5b0fc55b, 0xc8c20fc0, 0xd70f6600,
+0xd2b60fd1, 0x00fffa81, 0x850f0000, 0x000000c0,
+0x457e0ff3, 0x450f0fd8, 0x0ff396e8, 0x5b0fc05b,
+0x7e0ff3c0, 0x0ff3e84d, 0xc60ff8d6, 0x130fe1c9,
+0x0f0fc84d, 0xf396c84d, 0x0ff1d60f, 0x0ff2fe14,
+0x0ff3c7d6, 0x0fe84d7e, 0x9fb8c86f, 0xf2000002,
+0x0fd1d60f, 0x0fa6ca0f, 0x0fb6c80f, 0xf3c84d7f,
+0xc86d7e0f, 0xd55b0ff3, 0x0fd25b0f, 0x6600c2c2,
+0x0fd0d70f, 0xfa81d2b6, 0x000000ff, 0x280f5275,
+0xc1280fd3, 0x0fd4590f, 0x130fc459, 0x0ff3d855,
+0x0fd86d7e, 0x5f0fd028, 0x7e0ff3d5, 0x5d0fd86d,
+0x45130fc5, 0x7e0ff3d8, 0x580fd845, 0x0348bacb,
+0x580f0000, 0xc4590fc2, 0x00c1c20f, 0xc0d70f66,
+0x3dc0b60f, 0x000000ff, 0x000000b8, 0xc2450f00,
+0x0000c35d, 0x00000000, 0x3f800000, 0x3f800000,
+0x80000000, 0x80000000,
+0001630,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8148e589, 0x0000d0ec,
+0x100ff300, 0x0003f705, 0x110ff300, 0xffff5485,
+0x110ff3ff, 0xffff5885, 0x110ff3ff, 0xffff5c85,
+0x54858bff, 0x89ffffff, 0xffff4885, 0xf3ff31ff,
+0x4885100f, 0xb9ffffff, 0x00000000, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xffff81e8,
+0xb8c289ff, 0x00000260, 0x840fd284, 0x00000391,
+0x85100ff3, 0xffffff48, 0x85580ff3, 0xffffff54,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff54,
+0x0ff3ff31, 0x2e0fc058, 0xffff4c85, 0x9b0f40ff,
+0xf9450fc7, 0x37e8dff7, 0x89ffffff, 0x0266b8c2,
+0xd2840000, 0x0347840f, 0x0ff30000, 0xff4c8510,
+0x0ff3ffff, 0xff54855c, 0x0ff3ffff, 0xff308511,
+0x858bffff, 0xffffff30, 0x89844589, 0xffff4c85,
+0x508589ff, 0x31ffffff, 0x100ff3ff, 0xffff4885,
+0x852e0fff, 0xffffff50, 0xc79b0f40, 0xf7f9450f,
+0xfedce8df, 0xc289ffff, 0x00026bb8, 0x0fd28400,
+0x0002ec84, 0x100ff300, 0xffff4885, 0x590ff3ff,
+0xffff5485, 0x110ff3ff, 0xffff4885, 0x100ff3ff,
+0xffff5885, 0x590ff3ff, 0x110ff3c0, 0xffff4c85,
+0x100ff3ff, 0xffff5485, 0x580ff3ff, 0xffff5885,
+0x110ff3ff, 0xffff5085, 0x100ff3ff, 0xffff5485,
+0x100ff3ff, 0xffff4895, 0xf3ff31ff, 0x4c955c0f,
+0x0fffffff, 0x0ff3c828, 0xff588d5c, 0x0ff3ffff,
+0xff508d59, 0x2e0fffff, 0x110ff3d1, 0xffff508d,
+0x9b0f40ff, 0xf9450fc7, 0x43e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x0253840f, 0x0ff30000,
+0xff5c8559, 0x0ff3ffff, 0xff488511, 0xff31ffff,
+0x85100ff3, 0xffffff54, 0x855e0ff3, 0xffffff5c,
+0x48852e0f, 0xf3ffffff, 0x4c85110f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffdf5e8, 0xb8c289ff,
+0x0000028b, 0x840fd284, 0x00000205, 0x85100ff3,
+0xffffff5c, 0x15100ff3, 0x00000214, 0x8d100ff3,
+0xffffff54, 0x570fff31, 0xca570fc2, 0x85590ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffdade8, 0xb8c289ff, 0x0000028e, 0x840fd284,
+0x000001bd, 0x85530ff3, 0xffffff54, 0x85110ff3,
+0xffffff48, 0x8d530ff3, 0xffffff48, 0xc12c0ff3,
+0x85100ff3, 0xffffff54, 0x0ff3ff31, 0x2e0fc82a,
+0x9b0f40c8, 0xf9450fc7, 0x63e8dff7, 0x89fffffd,
+0x0296b8c2, 0xd2840000, 0x0173840f, 0x0ff30000,
+0x0ff3c059, 0xff488511, 0x0ff3ffff, 0xff488552,
+0x0ff3ffff, 0xff4c8511, 0x0ff3ffff, 0xff4c8553,
+0x0ff3ffff, 0xff31c02c, 0xc02a0ff3, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000029d, 0x840fd284, 0x00000121,
+0x852c0ff3, 0xffffff4c, 0x0ff3ff31, 0xff548553,
+0x0ff3ffff, 0x0ff3c82a, 0x0ff3c02c, 0x2e0fc02a,
+0x9b0f40c8, 0xf9450fc7, 0xd3e8dff7, 0x89fffffc,
+0x029fb8c2, 0xd2840000, 0x00e3840f, 0x0ff30000,
+0xff548510, 0x0ff3ffff, 0x0ff3c059, 0xff488511,
+0x0ff3ffff, 0xff548d10, 0xff31ffff, 0x85510ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffc8de8, 0xb8c289ff, 0x000002a7, 0x840fd284,
+0x0000009d, 0x85100ff3, 0xffffff5c, 0xc8590ff3,
+0x85590ff3, 0xffffff58, 0x8d110ff3, 0xffffff48,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff48,
+0x855f0ff3, 0xffffff4c, 0x85110ff3, 0xffffff50,
+0x85100ff3, 0xffffff48, 0x855d0ff3, 0xffffff4c,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff4c,
+0x85580ff3, 0xffffff50, 0x00b8ff31, 0xf3000000,
+0x5c85590f, 0xf3ffffff, 0x548d100f, 0xf3ffffff,
+0x588d580f, 0x0fffffff, 0x0f40c12e, 0x450fc79b,
+0xe8dff7f8, 0xfffffbea, 0xc019013c, 0x00034825,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002120,
+};
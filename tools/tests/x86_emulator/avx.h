@@ -0,0 +1,1092 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0499e8c3,
+0xc2810000, 0x0000052e, 0x8955e8d9, 0x88ec81e5,
+0xd9000000, 0x82d9c855, 0xffffff70, 0xd9d855d9,
+0xe855d9c9, 0xffc082d9, 0x55d9ffff, 0x7482d9cc,
+0xd9ffffff, 0xe8d9dc55, 0x55d9e0d9, 0xd9c9d9ec,
+0xc9d9d05d, 0xd9e05dd9, 0xf055d9c9, 0x5dd9cad9,
+0xd9c9d9d4, 0x5dd9e45d, 0x28f8c5f4, 0xf8c5c87d,
+0xc5987d29, 0x985528f8, 0xc976f1c5, 0x000260b8,
+0xc2e8c500, 0xe2c400df, 0x0fd90e79, 0x00041883,
+0x58e8c500, 0xf8c5c85d, 0xc5a85d29, 0xc87d28f8,
+0x000266b8, 0x58c0c500, 0xc2e0c5df, 0xc400a85d,
+0xd90e79e2, 0x03ef830f, 0xf8c50000, 0xc5a87d28,
+0xc85d5cc0, 0x5d29f8c5, 0xc2e8c5b8, 0xb800b85d,
+0x0000026b, 0x0e79e2c4, 0xca830fd9, 0xc5000003,
+0xd86528f8, 0x5559e8c5, 0x59d8c5c8, 0x28f8c5e4,
+0xe0c5c85d, 0xc5d87558, 0xd86d5ce0, 0x000282b8,
+0x5ce8c500, 0x59d0c5d4, 0xc2e8c5ee, 0xe2c400d5,
+0x0fd10e79, 0x00039083, 0x59e0c500, 0xf8c5e855,
+0xc5985529, 0xe85d5ee0, 0x00028bb8, 0xc2e8c500,
+0xe2c400d3, 0x0fd10e79, 0x00036c83, 0x28f8c500,
+0xffff809a, 0x028eb8ff, 0xf8c50000, 0xc5e86528,
+0xc5d357d8, 0x985559e8, 0x5d57e0c5, 0xc2e8c5c8,
+0xe2c400d3, 0x0fd10e79, 0x00033c83, 0x53f8c500,
+0xf8c5c855, 0xc5985529, 0x985553f8, 0x000296b8,
+0x28f8c500, 0xf9c5c85d, 0xf8c5d25b, 0xe8c5d25b,
+0xc400d3c2, 0xd10e79e2, 0x030b830f, 0xe0c50000,
+0xf8c5d359, 0xc5985529, 0x985552f8, 0x5529f8c5,
+0x28f8c5a8, 0x9db8a855, 0xc5000002, 0xc5ea53f8,
+0xc5ed5bf9, 0xc5ed5bf8, 0x00ddc2e0, 0x0e79e2c4,
+0xd2830fd9, 0xc5000002, 0xc5da5bf9, 0xc85528f8,
+0x00029fb8, 0x5bf8c500, 0x53f8c5db, 0x5bf9c5ea,
+0x5bf8c5ed, 0xc2e0c5ed, 0xe2c400dd, 0x0fd90e79,
+0x0002a483, 0x59e8c500, 0x29f8c5da, 0xf8c5985d,
+0xb8985d51, 0x000002a7, 0xdac2e0c5, 0x79e2c400,
+0x830fd90e, 0x00000281, 0xaa28f8c5, 0xffffff90,
+0xda5ed0c5, 0x5d29f8c5, 0x79e3c498, 0x0b985d08,
+0x9ac2e0c5, 0xffffffa0, 0x02afb800, 0xe2c40000,
+0x0fd90e79, 0x00025083, 0x59d8c500, 0xd8c5d85d,
+0xf8c5f259, 0xc5a85d29, 0xa85d5fc8, 0x755dc8c5,
+0x29f8c5a8, 0xe0c5a875, 0xb8a85d58, 0x00000348,
+0x5558e8c5, 0x59e0c5d8, 0xc2e0c5dc, 0xe2c400d2,
+0x0fd10e79, 0x00021083, 0x79e3c400, 0x1bc85504,
+0x000359b8, 0xc2e8c500, 0xc400d855, 0xd10e79e2,
+0x01f3830f, 0xf8c50000, 0xb8d85528, 0x0000035e,
+0xda5bf9c5, 0x9afae1c5, 0xffffffb0, 0x7528f8c5,
+0x49e2c4c8, 0xe8c5db0c, 0xc400dbc2, 0xd90e79e2,
+0x01c3830f, 0xc8c50000, 0x62b8f258, 0xc4000003,
+0x9a1879e2, 0xffffff78, 0xf3c2c8c5, 0x79e2c400,
+0x830ff10e, 0x000001a1, 0x5d14e8c5, 0x15e8c5c8,
+0xe0c5c875, 0x70b8de5c, 0xc5000003, 0xc5dc59e0,
+0xc09ac2e0, 0x00ffffff, 0x0e79e2c4, 0x76830fd9,
+0xc5000001, 0xc85d12fa, 0xb228f8c5, 0xffffffd0,
+0x0003b1b8, 0x58c8c500, 0x28f8c5f4, 0xffffe0ba,
+0x59c8c5ff, 0x5ce0c5f7, 0xe0c5c85d, 0xc400dec2,
+0xd90e79e2, 0x013f830f, 0xfac50000, 0xc5c85d16,
+0xb8ed58d8, 0x000003b8, 0x7528f8c5, 0x59d0c5c8,
+0x5ce0c5ef, 0xc2e0c5de, 0xe2c400dd, 0x0fd90e79,
+0x00011483, 0x11fac500, 0xe0c5a875, 0xe3c4db57,
+0xac551779, 0x79e3c401, 0x03b45517, 0x1779e3c4,
+0xb802b075, 0x000003c4, 0xdcc2e0c5, 0x69e3c401,
+0xc530d64a, 0xa85d28f8, 0xd2c2e0c5, 0x79e2c400,
+0x830fd10e, 0x000000d1, 0x7d28f8c5, 0x03d4b8c8,
+0xe3c40000, 0xd8550c41, 0xc2e0c50a, 0xe2c400da,
+0x0fd90e79, 0x0000b083, 0x28f8c500, 0xdbc5c865,
+0xc5d84dd0, 0xc87d28f8, 0xdb76e1c5, 0x0003ddb8,
+0xd0c3c500, 0xf0c5d855, 0xc400cac2, 0xcb0e79e2,
+0x0083830f, 0xf8c50000, 0xb8c85528, 0x000003ec,
+0x4069e3c4, 0xc5f1d84d, 0xf08ac2f0, 0x00ffffff,
+0x0e79e2c4, 0xc56273cb, 0x985529f8, 0xd257e8c5,
+0x4d7cebc5, 0x29f8c598, 0xebc5984d, 0xd9984d7c,
+0xffff7c82, 0x79e3c4ff, 0x03844d17, 0xdf8445d9,
+0x7ad8dde9, 0xc52d752f, 0xc86528f8, 0xdbc5c031,
+0xc5d84d7d, 0xc5ca7cf3, 0xc5ca7cf3, 0x00cac2f0,
+0x0e79e2c4, 0xc0920fcb, 0x1901f883, 0x040125c0,
+0x05eb0000, 0x0003f8b8, 0x8bc3c900, 0x00c32414,
+0x40800000, 0x40400000, 0x40a00000, 0x41200000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002514,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x042de8c3,
+0xc2810000, 0x000004be, 0xc031e8d9, 0x83e58955,
+0x55dd78ec, 0xf04589c8, 0x00f445c7, 0xd9bff000,
+0xffff8082, 0xd855ddff, 0x55ddc9d9, 0xddc9d9e8,
+0x5dddd05d, 0x28f9c5e0, 0xf9c5c87d, 0xc5987d29,
+0xc5c976f1, 0x985528f9, 0x000260b8, 0xc2e9c500,
+0xe2c400df, 0x0fd90f79, 0x0003d083, 0x58e9c500,
+0xf9c5c85d, 0xb8a85d29, 0x00000266, 0x7d28f9c5,
+0x58c1c5c8, 0xc2e1c5df, 0xc400a85d, 0xd90f79e2,
+0x03a7830f, 0xf9c50000, 0xc5a87d28, 0xc85d5cc1,
+0x5d29f9c5, 0x026bb8b8, 0xe9c50000, 0x00b85dc2,
+0x0f79e2c4, 0x82830fd9, 0xc5000003, 0xd87d28f9,
+0x5559e9c5, 0x59c1c5c8, 0x28f9c5e7, 0xe1c5c85d,
+0x82b8f758, 0xc5000002, 0xd86d5ce1, 0xd45ce9c5,
+0xee59d1c5, 0xd5c2e9c5, 0x79e2c400, 0x830fd10f,
+0x00000349, 0x5559e1c5, 0x29f9c5e8, 0x8bb89855,
+0xc5000002, 0xe85d5ee1, 0xd3c2e9c5, 0x79e2c400,
+0x830fd10f, 0x00000325, 0x00028eb8, 0x28f9c500,
+0xffff90a2, 0x28f9c5ff, 0xe1c5e85d, 0xd9c5d457,
+0xc5c86557, 0x985559e9, 0xd4c2e9c5, 0x79e2c400,
+0x830fd10f, 0x000002f5, 0x555af9c5, 0x53f8c5c8,
+0x5af8c5d2, 0x29f9c5d2, 0xf9c59855, 0xc598555a,
+0xc5d253f8, 0xc86528f9, 0x000296b8, 0x5af8c500,
+0xe6fbc5d2, 0xe6fac5d2, 0xc2e9c5d2, 0xe2c400d4,
+0x0fd10f79, 0x0002b483, 0x59d9c500, 0x29f9c5d4,
+0xf9c59855, 0xc598555a, 0xc5d252f8, 0xc5d25af8,
+0xa85529f9, 0x6d28f9c5, 0x5af9c5a8, 0x029db8d5,
+0xf8c50000, 0xf8c5d253, 0xfbc5d25a, 0xfac5d2e6,
+0xd9c5d2e6, 0xc400e2c2, 0xe10f79e2, 0x026b830f,
+0xf9c50000, 0xc5c86528, 0xc5d45af9, 0xb8ede6fb,
+0x0000029f, 0xede6fac5, 0xd253f8c5, 0xd25af8c5,
+0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5, 0x79e2c400,
+0x830fe90f, 0x00000235, 0xd459d9c5, 0x5529f9c5,
+0x02a7b898, 0xf9c50000, 0xc5985551, 0x00d4c2e9,
+0x0f79e2c4, 0x12830fd1, 0xc5000002, 0xa0aa28f9,
+0xc5ffffff, 0xc5d45ed1, 0x985529f9, 0x0002afb8,
+0x79e3c400, 0x0b985509, 0x92c2e9c5, 0xffffffb0,
+0x79e2c400, 0x830fd10f, 0x000001e1, 0x5559e1c5,
+0x59e1c5d8, 0x29f9c5f4, 0xc9c5a855, 0xc5a8555f,
+0xa8755dc9, 0x7529f9c5, 0x0348b8a8, 0xe9c50000,
+0xc5a85558, 0xd86558d9, 0xd359e9c5, 0xd4c2e9c5,
+0x79e2c400, 0x830fd10f, 0x000001a1, 0x000359b8,
+0x79e3c400, 0x01c85505, 0x55c2e9c5, 0xe2c400d8,
+0x0fd10f79, 0x00018483, 0x28f9c500, 0xfbc5d855,
+0xd9c5e2e6, 0xffc0a2fa, 0xf9c5ffff, 0xb8c87d28,
+0x0000035e, 0x2579e2c4, 0x73d9c5e4, 0xe2c401f4,
+0xc5e40d41, 0x00e4c2e9, 0x0f79e2c4, 0x4a830fe1,
+0xc5000001, 0xc86516e9, 0x7d28f9c5, 0x15e9c5c8,
+0x0370b8f7, 0xd9c50000, 0xd9c5e65c, 0xd9c5e359,
+0xc400e5c2, 0xe10f79e2, 0x011f830f, 0x0ff20000,
+0xb8c86512, 0x000003b1, 0x6d28f9c5, 0x58e1c5c8,
+0xffffd0b2, 0x5cd9c5ff, 0x59c9c5e5, 0xffffe0b2,
+0xc2d9c5ff, 0xe2c400e6, 0x0fe10f79, 0x0000ec83,
+0x17f9c500, 0xf9c5b055, 0xc5a86d13, 0xb8e457d9,
+0x000003c4, 0xdbc2d9c5, 0x69e3c401, 0xc530d54b,
+0xa85d28f9, 0xd2c2e1c5, 0x79e2c400, 0x830fd10f,
+0x000000b9, 0x0003d4b8, 0x28f9c500, 0xe3c4c87d,
+0xd8550d41, 0xc2e1c502, 0xe2c400da, 0x0fd90f79,
+0x00009883, 0x28f9c500, 0xc9c5c875, 0xb8d855d0,
+0x000003dd, 0x7d28f9c5, 0xd0c1c5c8, 0xe9c5d85d,
+0xc400d3c2, 0xd10f79e2, 0xecb87373, 0xc5000003,
+0xc85d28f9, 0x4161e3c4, 0xc531d855, 0xf092c2e9,
+0x00ffffff, 0x0f79e2c4, 0xc55273d1, 0x985d29f9,
+0x4d7cd9c5, 0x17f9c598, 0x82d9904d, 0xffffff84,
+0xdf9045dd, 0x7ad8dde9, 0x312d752f, 0x28f9c5c0,
+0xe9c5c875, 0xc9c5d276, 0xc5d84d7d, 0xc5cc7cf1,
+0x00ccc2f1, 0x0f79e2c4, 0xc0920fca, 0x1901f883,
+0x040125c0, 0x05eb0000, 0x0003f8b8, 0x8bc3c900,
+0x00c32414, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002334,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_32f4[] = {
+0xb3e800eb, 0x81000006, 0x0007b1c1, 0x55c03100,
+0x5356e589, 0x000009bb, 0xe0e48300, 0x0100ec81,
+0xc2890000, 0x24448940, 0xdbde891c, 0x291c2444,
+0x01c2f6c6, 0x1c247489, 0x7c845cd9, 0x1c2444db,
+0x9c849cd9, 0xd9000000, 0xd9e0d9e8, 0xddc9dbe8,
+0x08f883d9, 0xbc849cd9, 0x75000000, 0x28fcc5c5,
+0x008024bc, 0xfcc50000, 0x20247c29, 0x4c28fcc5,
+0xf4c52024, 0xc500d7c2, 0x81d250fc, 0x0000fffa,
+0x0260b800, 0x850f0000, 0x00000627, 0x9458f4c5,
+0x00008024, 0x29fcc500, 0xc5402454, 0x24bc28fc,
+0x00000080, 0xd758c4c5, 0x54c2ecc5, 0xc5004024,
+0x81d250fc, 0x0000fffa, 0x0266b800, 0x850f0000,
+0x000005ef, 0x7c28fcc5, 0xc4c54024, 0x8024945c,
+0xc5000000, 0x245429fc, 0xc2f4c560, 0x00602454,
+0xd250fcc5, 0x00fffa81, 0x6bb80000, 0x0f000002,
+0x0005be85, 0x28fcc500, 0x00a024b4, 0xf4c50000,
+0x80248c59, 0xc5000000, 0xc5de59cc, 0x249428fc,
+0x00000080, 0xee58ecc5, 0xa45cecc5, 0x0000a024,
+0x5cf4c500, 0x59dcc5cb, 0xc2f4c5e5, 0xfcc500cc,
+0xfa81d150, 0x000000ff, 0x000282b8, 0x70850f00,
+0xc5000005, 0x248c59ec, 0x000000c0, 0x4c29fcc5,
+0xecc52024, 0xc024945e, 0xc5000000, 0x00cac2f4,
+0xd150fcc5, 0x00fffa81, 0x8bb80000, 0x0f000002,
+0x00053e85, 0x28fcc500, 0xffff0891, 0x28fcc5ff,
+0x00c024ac, 0xd4c50000, 0xecc5ca57, 0x80249457,
+0xc5000000, 0x244c59f4, 0xc2f4c520, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x00028eb8, 0x00850f00,
+0xc5000005, 0x248c53fc, 0x00000080, 0x4c29fcc5,
+0xfcc52024, 0x20244c53, 0x9428fcc5, 0x00008024,
+0x5bfdc500, 0x5bfcc5c9, 0xc2f4c5c9, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x000296b8, 0xc0850f00,
+0xc5000004, 0xc5ca59ec, 0x244c29fc, 0x52fcc520,
+0xc520244c, 0x244c29fc, 0x28fcc540, 0xc540244c,
+0xc5d953fc, 0xc5db5bfd, 0xc5db5bfc, 0x00d3c2ec,
+0xd250fcc5, 0x00fffa81, 0x9db80000, 0x0f000002,
+0x00047e85, 0x5bfdc500, 0x28fcc5c9, 0x00802494,
+0xfcc50000, 0xfcc5c95b, 0xfdc5da53, 0xfcc5db5b,
+0xf4c5db5b, 0xc500cbc2, 0x81d150fc, 0x0000fffa,
+0x029fb800, 0x850f0000, 0x00000447, 0xca59ecc5,
+0x4c29fcc5, 0xfcc52024, 0x20244c51, 0xcac2f4c5,
+0x50fcc500, 0xfffa81d1, 0xb8000000, 0x000002a7,
+0x041d850f, 0xfcc50000, 0xff289928, 0xe4c5ffff,
+0xfcc5ca5e, 0x20244c29, 0x087de3c4, 0x0b20244c,
+0x89c2f4c5, 0xffffff48, 0x50fcc500, 0xfffa81d1,
+0xb8000000, 0x000002af, 0x03e5850f, 0xd4c50000,
+0xa0248c59, 0xc5000000, 0xc5e259d4, 0x244c29fc,
+0x5fdcc540, 0xc540244c, 0x244c29fc, 0x5ddcc560,
+0xc5402464, 0x246429fc, 0x58f4c540, 0xc540244c,
+0x249458ec, 0x000000a0, 0xcd59f4c5, 0xcac2f4c5,
+0x50fcc500, 0xfffa81d1, 0xb8000000, 0x00000348,
+0x038d850f, 0xe3c40000, 0x248c047d, 0x00000080,
+0x28fcc51b, 0x00a02494, 0xe3c40000, 0x01c90675,
+0xc9c2ecc5, 0x50fcc500, 0xfffa81d1, 0xb8000000,
+0x00000359, 0x0359850f, 0xfdc50000, 0xf9c5e25b,
+0xffe8b16f, 0xd9c5ffff, 0xe3c4cefa, 0x01e4197d,
+0xe6fad9c5, 0x00035eb8, 0x75e3c400, 0xc501cc18,
+0x24a428fc, 0x00000080, 0x0c5de2c4, 0x75e3c4c9,
+0xc501c906, 0x00c9c2ec, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x0000030b, 0xe258dcc5, 0x187de2c4,
+0xfffff889, 0xc2dcc5ff, 0xfcc500e1, 0xfa81d450,
+0x000000ff, 0x000362b8, 0xe4850f00, 0xc5000002,
+0x248c12fe, 0x00000080, 0x8c5cf4c5, 0x00008024,
+0x28fcc500, 0xffff68a1, 0x28fcc5ff, 0xffff88b1,
+0x58dcc5ff, 0x59dcc5e5, 0xc2f4c5e6, 0xfcc500cc,
+0xfa81d150, 0x000000ff, 0x0003b1b8, 0xa0850f00,
+0xc5000002, 0x248c16fe, 0x00000080, 0x4c29fcc5,
+0xfcc52024, 0x8024a428, 0xc5000000, 0xc5db58d4,
+0xc5cc5cf4, 0xc5de59e4, 0x00cbc2f4, 0xd150fcc5,
+0x00fffa81, 0xb8b80000, 0x0f000003, 0x00026285,
+0xa8c03100, 0x28fcc501, 0xc50475ca, 0xc5cc28fc,
+0x248c29fc, 0x000000e0, 0xe08484d9, 0xd9000000,
+0x4040845c, 0x7508f883, 0x57f0c5da, 0x28fcc5c9,
+0xc540245c, 0x01cdc2f4, 0x4a6de3c4, 0xe4c510e4,
+0xc500e4c2, 0x81d450fc, 0x0000fffa, 0x03c4b800,
+0x850f0000, 0x0000020b, 0x2c75e2c4, 0x008024a4,
+0xf4c50000, 0xffa88955, 0xfcc5ffff, 0x60246429,
+0x2e75e2c4, 0xc5602454, 0x247c28fc, 0xc2c4c560,
+0xfcc500cb, 0xfa81d150, 0x000000ff, 0x0003cdb8,
+0xcc850f00, 0xc5000001, 0x24ac28fc, 0x00000080,
+0x0c55e3c4, 0x00a0248c, 0xc5aa0000, 0x00d9c2e4,
+0xd350fcc5, 0x00fffa81, 0xd4b80000, 0x0f000003,
+0x00019e85, 0x28fcc500, 0x008024b4, 0xcfc50000,
+0xa0248cd0, 0xc5000000, 0x24bc28fc, 0x00000080,
+0x94d0c7c5, 0x0000a024, 0xc2f4c500, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x0003ddb8, 0x60850f00,
+0xc5000001, 0x249c28fc, 0x00000080, 0x4065e3c4,
+0x00a02494, 0xc5f10000, 0x245411fa, 0x7de3c41c,
+0xb801d219, 0x000003ec, 0x1c2444d9, 0x5411fac5,
+0x44d91c24, 0xc1de1c24, 0x1c245cd9, 0x4c10fac5,
+0xf4c51c24, 0xffc889c2, 0xc500ffff, 0x81d150fc,
+0x0000fffa, 0x08850f00, 0xba000001, 0x00000003,
+0x5c29fcc5, 0xf0c52024, 0xf7c5c957, 0x2024547c,
+0xe212d8c5, 0x197de3c4, 0xd8c501d3, 0xc4e4e3c6,
+0x5c1779e3, 0xc5031c24, 0x4ad316e8, 0x186de3c4,
+0xfcc501d4, 0x20245429, 0x81d9d075, 0xfffffffc,
+0x1c2444d9, 0xd8dde9df, 0x00b08a0f, 0x850f0000,
+0x000000aa, 0xac28fcc5, 0x00008024, 0x7dd7c500,
+0x00a0249c, 0xf8c50000, 0xd8c5d328, 0xe3c4e212,
+0x01db197d, 0xe3c6d8c5, 0x16e8c5e4, 0x6de3c4d3,
+0xc501d418, 0xc5d97cef, 0xc5d328f8, 0xc4e212d8,
+0xdb197de3, 0xc6d8c501, 0xe8c5e4e3, 0xe3c4d316,
+0x01d4186d, 0xd97cefc5, 0xd328f8c5, 0xe212d8c5,
+0x197de3c4, 0xd8c501db, 0xc5e4e3c6, 0xc4d316e8,
+0xd4186de3, 0x7cefc501, 0x28f8c5d1, 0x12d8c5da,
+0x7de3c4e3, 0xc501d219, 0xe4e2c6d8, 0xda16e0c5,
+0x1865e3c4, 0xe4c501dc, 0xc500d9c2, 0x3dc350fc,
+0x000000ff, 0x000401b8, 0xc2440f00, 0xf8b805eb,
+0x8d000003, 0x5e5bf865, 0x0c8bc35d, 0x0000c324,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x41100000, 0x42100000, 0x00000000, 0x00000000,
+0x00000000,
+0003704,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_32f8[] = {
+0xeae800eb, 0x81000005, 0x0006d9c2, 0x55e8d900,
+0xe483e589, 0x00ec81e0, 0xdd000001, 0x00802494,
+0x82d90000, 0xffffff20, 0xa02494dd, 0xd9000000,
+0x2494ddc9, 0x000000c0, 0xff2482d9, 0x94ddffff,
+0x00008824, 0x2882d900, 0xddffffff, 0x00a82494,
+0xe8d90000, 0x94dde0d9, 0x0000c824, 0xddc9d900,
+0x0090249c, 0xc9d90000, 0xb0249cdd, 0xd9000000,
+0x2494ddc9, 0x000000d0, 0x9cddcad9, 0x00009824,
+0xddc9d900, 0x00b8249c, 0x9cdd0000, 0x0000d824,
+0x28fdc500, 0x008024b4, 0xfdc50000, 0x20247429,
+0x4c28fdc5, 0xf5c52024, 0xc500d6c2, 0x83ca50fd,
+0x60b80ff9, 0x0f000002, 0x00053285, 0x58f5c500,
+0x00802494, 0xfdc50000, 0x40245429, 0xbc28fdc5,
+0x00008024, 0x58c5c500, 0xc2edc5d7, 0x00402454,
+0xca50fdc5, 0xb80ff983, 0x00000266, 0x04fd850f,
+0xfdc50000, 0x40247428, 0x945ccdc5, 0x00008024,
+0x29fdc500, 0xc5602454, 0x2454c2f5, 0xfdc50060,
+0xf983ca50, 0x026bb80f, 0x850f0000, 0x000004cf,
+0xbc28fdc5, 0x0000a024, 0x59f5c500, 0x0080248c,
+0xc5c50000, 0xfdc5df59, 0x80249428, 0xc5000000,
+0xc5ef58ed, 0x24a45ced, 0x000000a0, 0xcb5cf5c5,
+0xe559ddc5, 0xccc2f5c5, 0x50fdc500, 0x0ff983c9,
+0x000282b8, 0x84850f00, 0xc5000004, 0x248c59ed,
+0x000000c0, 0x4c29fdc5, 0xedc52024, 0xc024945e,
+0xc5000000, 0x00cac2f5, 0xc950fdc5, 0xb80ff983,
+0x0000028b, 0x0455850f, 0xfdc50000, 0xff409a28,
+0xfdc5ffff, 0xc0249428, 0xc5000000, 0xc5cb57ed,
+0x249c57e5, 0x00000080, 0x4c59f5c5, 0xf5c52024,
+0xc500cbc2, 0x83c950fd, 0x8eb80ff9, 0x0f000002,
+0x00041a85, 0x5afdc500, 0x0080248c, 0xe3c40000,
+0x01c91875, 0xc953fcc5, 0xc95afcc5, 0x4c29fdc5,
+0xfdc52024, 0x20244c5a, 0x9c28fdc5, 0x00008024,
+0x29f8c500, 0x00e0248c, 0xe3c40000, 0x01c91875,
+0xc953fcc5, 0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5,
+0xcbc2f5c5, 0x50fdc500, 0x0ff983c9, 0x000296b8,
+0xb8850f00, 0xc5000003, 0xc5cb59e5, 0x244c29fd,
+0x5afdc520, 0xc420244c, 0xc91875e3, 0x52fcc501,
+0x5afcc5c9, 0x29fdc5c9, 0xc540244c, 0x246428fd,
+0x5afdc540, 0x029db8cc, 0xf8c50000, 0xe0248c29,
+0xc4000000, 0xc91875e3, 0x53fcc501, 0x5afcc5c9,
+0xe6ffc5c9, 0xe6fec5c9, 0xc2e5c5c9, 0xfdc500d9,
+0xf983cb50, 0x54850f0f, 0xc5000003, 0x249c28fd,
+0x00000080, 0xcb5afdc5, 0xe4e6ffc5, 0xe4e6fec5,
+0x00029fb8, 0x29f8c500, 0x00e0248c, 0xe3c40000,
+0x01c91875, 0xc953fcc5, 0xc95afcc5, 0xc9e6ffc5,
+0xc9e6fec5, 0xe1c2ddc5, 0x50fdc500, 0x0ff983cc,
+0x0309850f, 0xe5c50000, 0xfdc5cb59, 0x20244c29,
+0x4c51fdc5, 0xf5c52024, 0xc500cbc2, 0x83c950fd,
+0xa7b80ff9, 0x0f000002, 0x0002e285, 0x28fdc500,
+0xffff608a, 0x5ef5c5ff, 0x29fdc5cb, 0xc420244c,
+0x4c097de3, 0xc50b2024, 0x808ac2f5, 0x00ffffff,
+0xc950fdc5, 0xb80ff983, 0x000002af, 0x02ad850f,
+0xedc50000, 0xa0248c59, 0xc5000000, 0xc5e359ed,
+0x244c29fd, 0x5fddc540, 0xc540244c, 0x244c29fd,
+0x5dddc560, 0xc5402464, 0x246429fd, 0x58f5c540,
+0xc540244c, 0x249c58e5, 0x000000a0, 0xca59f5c5,
+0xcbc2f5c5, 0x50fdc500, 0x0ff983c9, 0x000348b8,
+0x58850f00, 0xc5000002, 0x248c28fd, 0x00000080,
+0xa428fdc5, 0x0000a024, 0x7de3c400, 0xc405d905,
+0xdb0665e3, 0xc2ddc501, 0xfdc500db, 0xf983cb50,
+0x0359b80f, 0x850f0000, 0x00000223, 0xff2c82d9,
+0xf5c5ffff, 0x62b8cc58, 0xdd000003, 0x00e0249c,
+0xe2c40000, 0x249c197d, 0x000000e0, 0xcbc2f5c5,
+0x50fdc500, 0x0ff983c9, 0x01f1850f, 0xffc50000,
+0x80248c12, 0xc5000000, 0x244c29fd, 0x28fdc520,
+0x0080249c, 0xedc50000, 0xffa0aa58, 0xf5c5ffff,
+0xd5c5cb5c, 0xffc0aa59, 0xf5c5ffff, 0xc500cdc2,
+0x83c950fd, 0xb1b80ff9, 0x0f000003, 0x0001ae85,
+0xa8c03100, 0x28fdc501, 0xc50475cc, 0xc5cb28fd,
+0x248c29fd, 0x000000e0, 0xb410fbc5, 0x0000e0c4,
+0x11fbc500, 0x4040c474, 0x7504f883, 0x57f1c5d6,
+0x28fdc5c9, 0xc540246c, 0x01d2c2f5, 0x4b5de3c4,
+0xd5c520db, 0xc500dbc2, 0x83cb50fd, 0xc4b80ff9,
+0x0f000003, 0x00015685, 0x6de2c400, 0x80249c2d,
+0xc5000000, 0xe09255ec, 0xc5ffffff, 0x245c29fd,
+0x6de2c460, 0x6024642f, 0x7c28fdc5, 0xc5c56024,
+0xc500d5c2, 0x83ca50fd, 0xcdb80ff9, 0x0f000003,
+0x00011a85, 0x28fdc500, 0x008024b4, 0xe3c40000,
+0x24940d4d, 0x000000a0, 0xc2d5c50a, 0xfdc500ea,
+0xf983cd50, 0x03d4b80f, 0x850f0000, 0x000000ef,
+0xbc28fdc5, 0x00008024, 0xd0c5c500, 0x00a02494,
+0xfdc50000, 0x80249c28, 0xc5000000, 0x24a4d0e5,
+0x000000a0, 0xd4c2edc5, 0x50fdc500, 0x0ff983ca,
+0x0003ddb8, 0xb4850f00, 0xc5000000, 0x245c29fd,
+0x7cf5c520, 0xc4202454, 0xda186de3, 0x6de3c401,
+0xc531d206, 0x0cd2c6e5, 0x5429fdc5, 0xf5c52024,
+0x2024547c, 0x197de3c4, 0xf9c501d2, 0x18245417,
+0xff3082d9, 0x44ddffff, 0xe9df1824, 0x6a7ad8dd,
+0x00ba6875, 0xc5000000, 0x24b428fd, 0x00000080,
+0x947dcdc5, 0x0000a024, 0x6de3c400, 0xc401da18,
+0xd2066de3, 0xc6e5c531, 0xe5c50cda, 0xe3c4d97c,
+0x01d31865, 0x0665e3c4, 0xedc531db, 0xc50cd3c6,
+0xc4d17ced, 0xda186de3, 0x6de3c401, 0xc531d206,
+0x0cd2c6e5, 0xc9c2edc5, 0x50fdc500, 0x0ff883c1,
+0x000401b8, 0xc2440f00, 0xf8b805eb, 0xc9000003,
+0x24148bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x00000000, 0x00000000, 0x00000000,
+0003354,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xc2e853e5, 0x81000004,
+0x0004f1c3, 0xec815100, 0x00000100, 0x8b10fac5,
+0xffffffe0, 0x8d11fac5, 0xffffff34, 0x8d11fac5,
+0xffffff38, 0x8d11fac5, 0xffffff3c, 0xff34858b,
+0x8589ffff, 0xffffff28, 0x9510fac5, 0xffffff28,
+0x00bac031, 0xc5000000, 0x34952ef8, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0x73e82404, 0x83ffffff,
+0xc18810c4, 0x000260b8, 0x0fc98400, 0x00044684,
+0x10fac500, 0xffff2895, 0x58eac5ff, 0xffff3495,
+0x11fac5ff, 0xffff2c95, 0x10fac5ff, 0xffff3495,
+0x10ec83ff, 0xeac5c031, 0xf8c5d258, 0xff2c952e,
+0x9b0fffff, 0xc2450fc0, 0x0489d8f7, 0xff20e824,
+0xc483ffff, 0xb8c18810, 0x00000266, 0x840fc984,
+0x000003f3, 0x9510fac5, 0xffffff2c, 0x955ceac5,
+0xffffff34, 0x9511fac5, 0xffffff08, 0xff08858b,
+0x8589ffff, 0xffffff64, 0xff2c8589, 0x8589ffff,
+0xffffff30, 0x9510fac5, 0xffffff28, 0x3110ec83,
+0x2ef8c5c0, 0xffff3095, 0xc09b0fff, 0xf7c2450f,
+0x240489d8, 0xfffeb9e8, 0x10c483ff, 0x6bb8c188,
+0x84000002, 0x8c840fc9, 0xc5000003, 0x289510fa,
+0xc5ffffff, 0x349559ea, 0xc5ffffff, 0x289511fa,
+0xc5ffffff, 0x389510fa, 0xc5ffffff, 0xc5d259ea,
+0x2c9511fa, 0xc5ffffff, 0x349510fa, 0xc5ffffff,
+0x389558ea, 0xc5ffffff, 0x309511fa, 0xc5ffffff,
+0x349510fa, 0x83ffffff, 0xfac510ec, 0xff28a510,
+0xc031ffff, 0x9d5ceac5, 0xffffff38, 0xa55cdac5,
+0xffffff2c, 0x9d59e2c5, 0xffffff30, 0x9d11fac5,
+0xffffff30, 0xe32ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffe1a, 0x8810c483, 0x0282b8c1,
+0xc9840000, 0x02ed840f, 0xeac50000, 0xff3c9559,
+0xfac5ffff, 0xff289511, 0xfac5ffff, 0xff349510,
+0xec83ffff, 0xc5c03110, 0x3c955eea, 0xc5ffffff,
+0x28952ef8, 0xc5ffffff, 0x2c9511fa, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0xc3e82404, 0x83fffffd,
+0xc18810c4, 0x00028bb8, 0x0fc98400, 0x00029684,
+0x10fac500, 0xfffff0a3, 0x10ec83ff, 0x9510fac5,
+0xffffff3c, 0xfac5c031, 0xff349d10, 0xe8c5ffff,
+0xeac5d457, 0xff289559, 0xe0c5ffff, 0xf8c5dc57,
+0x9b0fd32e, 0xc2450fc0, 0x0489d8f7, 0xfd70e824,
+0xc483ffff, 0xb8c18810, 0x0000028e, 0x840fc984,
+0x00000243, 0x95530ff3, 0xffffff34, 0x9511fac5,
+0xffffff28, 0x9d530ff3, 0xffffff28, 0xc32cfac5,
+0xc510ec83, 0x349510fa, 0xc5ffffff, 0x31d82ae2,
+0x2ef8c5c0, 0xc09b0fda, 0xf7c2450f, 0x240489d8,
+0xfffd1de8, 0x10c483ff, 0x96b8c188, 0x84000002,
+0xf0840fc9, 0xc5000001, 0xc5d259ea, 0x289511fa,
+0xf3ffffff, 0x2895520f, 0xc5ffffff, 0x2c9511fa,
+0xf3ffffff, 0x2c95530f, 0xc5ffffff, 0x83c22cfa,
+0xeac510ec, 0xc031d02a, 0x952ef8c5, 0xffffff34,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffcc2,
+0x8810c483, 0x029db8c1, 0xc9840000, 0x0195840f,
+0xfac50000, 0xff2c852c, 0xec83ffff, 0x530ff310,
+0xffff3495, 0x2ae2c5ff, 0x2cfac5d8, 0x2aeac5c2,
+0xc5c031d0, 0x0fda2ef8, 0x450fc09b, 0x89d8f7c2,
+0x7be82404, 0x83fffffc, 0xc18810c4, 0x00029fb8,
+0x0fc98400, 0x00014e84, 0x10fac500, 0xffff3495,
+0x59eac5ff, 0x11fac5d2, 0xffff2895, 0x10fac5ff,
+0xffff3495, 0x10ec83ff, 0x0ff3c031, 0xff289d51,
+0xf8c5ffff, 0x9b0fda2e, 0xc2450fc0, 0x0489d8f7,
+0xfc2ce824, 0xc483ffff, 0xb8c28810, 0x000002a7,
+0x840fd284, 0x000000ff, 0xd25ef2c5, 0x8d11fac5,
+0xffffff2c, 0x9511fac5, 0xffffff28, 0xec83c031,
+0x3a0f6610, 0xff288d0a, 0xc50bffff, 0x2c8d2ef8,
+0xbaffffff, 0x00000000, 0x8d11fac5, 0xffffff30,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffbd2,
+0x8810c483, 0x02afb8c1, 0xc9840000, 0x00a5840f,
+0xfac50000, 0xff3c8d10, 0xf2c5ffff, 0xff349559,
+0xf2c5ffff, 0xff388d59, 0xfac5ffff, 0xff289511,
+0xfac5ffff, 0xff2c8d11, 0xfac5ffff, 0xff288d10,
+0xf2c5ffff, 0xff2c8d5f, 0xfac5ffff, 0xff308d11,
+0xfac5ffff, 0xff288d10, 0xf2c5ffff, 0xff2c8d5d,
+0xfac5ffff, 0xff2c8d11, 0xfac5ffff, 0xff2c8d10,
+0xec83ffff, 0x10fac510, 0xffff3495, 0xc5c031ff,
+0x308d58f2, 0xc5ffffff, 0x389558ea, 0xc5ffffff,
+0x3c8d59f2, 0xc5ffffff, 0x0fca2ef8, 0x450fc09b,
+0x89d8f7c2, 0x27e82404, 0x83fffffb, 0x013c10c4,
+0x4825c019, 0x8d000003, 0x5b59f865, 0xfc618d5d,
+0x241c8bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002454,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_f8[] = {
+0x17e800eb, 0x81000005, 0x000549c1, 0xe5895500,
+0x81e0e483, 0x0001c0ec, 0x10fbc500, 0xffffe089,
+0x11fbc5ff, 0xc558244c, 0x244c11fb, 0x11fbc560,
+0x8b68244c, 0x89582444, 0x8b402444, 0x895c2444,
+0xc5442444, 0x246c10fb, 0x2ef9c540, 0x7a58246c,
+0x0001b80c, 0x00ba0000, 0x74000000, 0x31c03104,
+0x89d8f7d2, 0x83182444, 0x60b800d2, 0xf7000002,
+0x245489da, 0x446f0f1c, 0xd70f1824, 0xfffa81d0,
+0x0f000000, 0x00049385, 0x10fbc500, 0xc5402474,
+0x245458cb, 0x11fbc558, 0x31482454, 0x10fbc5d2,
+0xb8582454, 0x00000001, 0xd258ebc5, 0x542ef9c5,
+0x027a4824, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000266, 0x5489daf7, 0x6f0f1c24,
+0x0f18244c, 0xfa81d1d7, 0x000000ff, 0x043a850f,
+0xfbc50000, 0x48247c10, 0x545cc3c5, 0xfbc55824,
+0x20245411, 0x2024548b, 0x2424448b, 0xb8249489,
+0x89000000, 0x00bc2484, 0x54890000, 0x44894824,
+0x54894c24, 0x44895024, 0xd2315424, 0x6410fbc5,
+0x01b84024, 0xc5000000, 0x24642ef9, 0x74027a50,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x6bb800d2,
+0xf7000002, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x0003bf85, 0x10fbc500,
+0xc540246c, 0x245459d3, 0x11fbc558, 0xc5402454,
+0x245410fb, 0x59ebc560, 0x11fbc5d2, 0xc5482454,
+0x247410fb, 0x58cbc558, 0xc5602454, 0x245411fb,
+0xc5d23150, 0x245410fb, 0x10fbc558, 0xc540247c,
+0x245c5ceb, 0x5cc3c560, 0xc5482464, 0x245c59e3,
+0x0001b850, 0xfbc50000, 0x50245c11, 0xe32ef9c5,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0282b800, 0xdaf70000, 0x1c245489, 0x245c6f0f,
+0xd3d70f18, 0x00fffa81, 0x850f0000, 0x0000032c,
+0x5459ebc5, 0xfbc56824, 0x40245411, 0xfbc5d231,
+0x58246410, 0x000001b8, 0x5edbc500, 0xc5682454,
+0x245411fb, 0x2ef9c548, 0x7a402454, 0x31047402,
+0xf7d231c0, 0x244489d8, 0x00d28318, 0x00028bb8,
+0x89daf700, 0x0f1c2454, 0x1824646f, 0x81d4d70f,
+0x0000fffa, 0xd1850f00, 0x31000002, 0x7efac5d2,
+0xfffff099, 0x10fbc5ff, 0xc568246c, 0x247410fb,
+0x57d1c558, 0x0001b8d3, 0xebc50000, 0x40245459,
+0xdb57c9c5, 0xd32ef9c5, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x028eb800, 0xdaf70000,
+0x1c245489, 0x246c6f0f, 0xd5d70f18, 0x00fffa81,
+0x850f0000, 0x00000274, 0x545a0ff2, 0x0ff35824,
+0x0ff3d253, 0xf9c5d25a, 0x40245413, 0x5c5a0ff2,
+0x0ff34024, 0x0ff3db53, 0xfbc5db5a, 0xd231c32c,
+0x5410fbc5, 0xe3c55824, 0x01b8d82a, 0xc5000000,
+0x7ada2ef9, 0x31047402, 0xf7d231c0, 0x244489d8,
+0x00d28318, 0x000296b8, 0x89daf700, 0x0f1c2454,
+0x1824746f, 0x81d6d70f, 0x0000fffa, 0x09850f00,
+0xc5000002, 0xc5d259eb, 0x245411fb, 0x5a0ff240,
+0xf3402454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff248, 0xf3482454, 0xf3d2530f, 0xc5d25a0f,
+0x31c22cfb, 0x2aebc5d2, 0x0001b8d0, 0xf9c50000,
+0x5824542e, 0x0474027a, 0xd231c031, 0x4489d8f7,
+0xd2831824, 0x029db800, 0xdaf70000, 0x1c245489,
+0x247c6f0f, 0xd7d70f18, 0x00fffa81, 0x850f0000,
+0x00000198, 0x545a0ff2, 0x0ff35824, 0x0ff3d253,
+0xfbc5d25a, 0xfbc5c22c, 0x4824542c, 0x940fc239,
+0x0fd231c0, 0xd8f7c0b6, 0x18244489, 0xb800d283,
+0x0000029f, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x014e850f, 0xfbc50000,
+0x58245410, 0xd259ebc5, 0x5411fbc5, 0xd2314024,
+0x5410fbc5, 0x01b85824, 0xf2000000, 0x245c510f,
+0x2ef9c540, 0x74027ada, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0xa7b800d2, 0xf7000002, 0x245489da,
+0x4c6f0f1c, 0xd70f1824, 0xfffa81d1, 0x0f000000,
+0x0000f785, 0x5ef3c500, 0x11fbc5d2, 0xc548244c,
+0x245411fb, 0xb8d23140, 0x00000001, 0x0b3a0f66,
+0x0b40244c, 0x4c11fbc5, 0xf9c55024, 0x48244c2e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x02afb800, 0xdaf70000, 0x1c245489, 0x24546f0f,
+0xd2d70f18, 0x00fffa81, 0x850f0000, 0x0000009c,
+0x4c10fbc5, 0xf3c56824, 0x58245459, 0x4c59f3c5,
+0xfbc56024, 0x40245411, 0x4c11fbc5, 0xfbc54824,
+0x40247c10, 0x4c5fc3c5, 0xfbc54824, 0x50244c11,
+0x6410fbc5, 0xdbc54024, 0x48244c5d, 0x4c11fbc5,
+0xd2314824, 0x6c10fbc5, 0xfbc54824, 0x58247410,
+0x4c58d3c5, 0xcbc55024, 0x60245458, 0x4c59f3c5,
+0x01b86824, 0xc5000000, 0x7aca2ef9, 0x31047402,
+0xf7d231c0, 0x244489d8, 0x00d28318, 0x5489daf7,
+0x48ba1c24, 0x0f000003, 0x18245c6f, 0x3dc3d70f,
+0x000000ff, 0x000000b8, 0xc2450f00, 0x0c8bc3c9,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002534,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x60b8c976, 0xc5000002, 0x00dfc2e8, 0x0e79e2c4,
+0x17830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x66b8d05d, 0xc5000002, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x000003ee,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x026bb800, 0xe2c40000, 0x0fd90e79,
+0x0003c983, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x82b8d45c, 0xc5000002, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x8f830fd1, 0xc5000003,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x0000028b, 0x0e79e2c4, 0x6b830fd1,
+0xc4000003, 0x1d1879e2, 0x00000364, 0x6528f8c5,
+0x028eb8f0, 0xd8c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x0000033a, 0x5553f8c5, 0x29f8c5d0, 0xf8c5a055,
+0xc5a05553, 0xd05d28f8, 0x000296b8, 0x5bf9c500,
+0x5bf8c5d2, 0xc2e8c5d2, 0xe2c400d3, 0x0fd10e79,
+0x00030983, 0x59e0c500, 0x29f8c5d3, 0xf8c5a055,
+0xc5a05552, 0xb05529f8, 0x5528f8c5, 0x029db8b0,
+0xf8c50000, 0xf9c5ea53, 0xf8c5ed5b, 0xe0c5ed5b,
+0xc400ddc2, 0xd90e79e2, 0x02d0830f, 0xf9c50000,
+0xf8c5da5b, 0xc5d05528, 0xb8db5bf8, 0x0000029f,
+0xea53f8c5, 0xed5bf9c5, 0xed5bf8c5, 0xddc2e0c5,
+0x79e2c400, 0x830fd90e, 0x000002a2, 0xda59e8c5,
+0x5d29f8c5, 0x51f8c5a0, 0xa7b8a05d, 0xc5000002,
+0x00dac2e0, 0x0e79e2c4, 0x7f830fd9, 0xc4000002,
+0x2d1879e2, 0x00000298, 0xda5ed0c5, 0x5d29f8c5,
+0x79e3c4a0, 0x0ba05d08, 0x0002afb8, 0xc2e0c500,
+0x00027a1d, 0xe2c40000, 0x0fd90e79, 0x00024d83,
+0x59d8c500, 0xd8c5e05d, 0xf8c5f259, 0xc5b05d29,
+0xb05d5fc8, 0x755dc8c5, 0x29f8c5b0, 0xe0c5b075,
+0xc5b05d58, 0xe05558e8, 0x000348b8, 0x59e0c500,
+0xc2e0c5dc, 0xe2c400d2, 0x0fd10e79, 0x00020d83,
+0x79e3c400, 0x1bd05504, 0x000359b8, 0xc2e8c500,
+0xc400e055, 0xd10e79e2, 0x01f0830f, 0x01b80000,
+0xc5000000, 0xe05528f8, 0xf86ef9c5, 0x00035eb8,
+0x70f9c500, 0xf9c500f7, 0xe1c5da5b, 0xf8c5defa,
+0xc4d07528, 0xdb0c49e2, 0xdbc2e8c5, 0x79e2c400,
+0x830fd90e, 0x000001b6, 0xf258c8c5, 0x000362b8,
+0xc2c8c500, 0x0001e635, 0xe2c40000, 0x0ff10e79,
+0x00019983, 0x14e8c500, 0xe8c5d05d, 0xc5d07515,
+0xb8de5ce0, 0x00000370, 0x1879e2c4, 0x00018335,
+0x59e0c500, 0xc2e0c5dc, 0xe2c400de, 0x0fd90e79,
+0x00016983, 0x12fac500, 0xe2c4d05d, 0x65351879,
+0xc5000001, 0xd05d5ce0, 0x0003b1b8, 0x79e2c400,
+0x01563d18, 0xc8c50000, 0xc8c5f458, 0xe0c5f759,
+0xc400dec2, 0xd90e79e2, 0x0130830f, 0xfac50000,
+0xc5d05d16, 0xc5ed58d8, 0xd07528f8, 0x0003b8b8,
+0x5ce0c500, 0x59d0c5de, 0xc2e0c5ef, 0xe2c400dd,
+0x0fd90e79, 0x00010583, 0x57e0c500, 0x11fac5db,
+0xe3c4b075, 0xb4551779, 0x79e3c401, 0x03bc5517,
+0xdcc2e0c5, 0x79e3c401, 0x02b87517, 0x0003c4b8,
+0x69e3c400, 0xc530d64a, 0xb05d28f8, 0xd2c2e0c5,
+0x79e2c400, 0x830fd10e, 0x000000c2, 0x6528f8c5,
+0x03d4b8d0, 0xe3c40000, 0xe0550c59, 0xc2e0c50a,
+0xe2c400da, 0x0fd90e79, 0x0000a183, 0x28f8c500,
+0xc3c5d07d, 0xc5e055d0, 0xd06528f8, 0x5dd0dbc5,
+0x03ddb8e0, 0xe8c50000, 0xc400d3c2, 0xd10e79e2,
+0xf8c57c73, 0xc4d05d28, 0x554061e3, 0xecb8f1e0,
+0xc5000003, 0x9415c2e8, 0x00000000, 0x0e79e2c4,
+0xc55b73d1, 0xa05d29f8, 0xdb57e0c5, 0x557ce3c5,
+0x29f8c5a0, 0xe3c5a055, 0xc5a0557c, 0xffd2c6e8,
+0x152ef8c5, 0x00000048, 0x2d752f7a, 0x7d28f8c5,
+0x7dc3c5d0, 0xc031e055, 0xd37cebc5, 0xd37cebc5,
+0xd3c2e8c5, 0x79e2c400, 0x920fd10e, 0x01f883c0,
+0x0125c019, 0xeb000004, 0x03f8b805, 0xc35d0000,
+0x80000000, 0x40000000, 0xbf800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0002340,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x04620d10, 0xfbc50000,
+0x042a1510, 0x8b480000, 0x00042b05, 0x11fbc500,
+0x8948d04d, 0xfbc5f845, 0xc5e05511, 0xf04d11fb,
+0x5511fbc5, 0x11fbc5d8, 0xf9c5e84d, 0xc5d07d28,
+0xa07d29f9, 0x5528f9c5, 0x76f1c5a0, 0x0260b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x03d9830f,
+0xe9c50000, 0xc5d05d58, 0xb05d29f9, 0x5d28f9c5,
+0x0266b8d0, 0xe1c50000, 0xe1c5db58, 0x00b05dc2,
+0x0f79e2c4, 0xb0830fd9, 0xc5000003, 0xb07d28f9,
+0x5d5cc1c5, 0x29f9c5d0, 0xe9c5c05d, 0x00c05dc2,
+0x00026bb8, 0x79e2c400, 0x830fd90f, 0x0000038b,
+0x5d28f9c5, 0x59e9c5e0, 0xe1c5d055, 0xf9c5e359,
+0xc5d05d28, 0xe07558e1, 0x6d5ce1c5, 0x5ce9c5e0,
+0x0282b8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x0351830f, 0xe1c50000, 0xc5f05559,
+0xa05529f9, 0x5d5ee1c5, 0xc2e9c5f0, 0x8bb800d3,
+0xc4000002, 0xd10f79e2, 0x032d830f, 0xf9c50000,
+0xc5f05d28, 0x352512fb, 0xb8000003, 0x0000028e,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5d0, 0xe9c5a055,
+0xc400d4c2, 0xd10f79e2, 0x02fd830f, 0xf9c50000,
+0xc5d0555a, 0xc5d253f8, 0xc5d25af8, 0xa05529f9,
+0x555af9c5, 0x53f8c5a0, 0x28f9c5d2, 0x96b8d06d,
+0xc5000002, 0xc5d25af8, 0xc5d2e6fb, 0xc5d2e6fa,
+0x00d5c2e9, 0x0f79e2c4, 0xbc830fd1, 0xc5000002,
+0xc5d559d1, 0xa05529f9, 0x555af9c5, 0x52f8c5a0,
+0x5af8c5d2, 0x29f9c5d2, 0xf9c5b055, 0xb8b06528,
+0x0000029d, 0xd45af9c5, 0xd253f8c5, 0xd25af8c5,
+0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5, 0x79e2c400,
+0x830fe90f, 0x00000273, 0xe4e6fbc5, 0xece6fac5,
+0x6528f9c5, 0x029fb8d0, 0xf9c50000, 0xf8c5d45a,
+0xf8c5d253, 0xfbc5d25a, 0xfac5d2e6, 0xd1c5d2e6,
+0xc400d2c2, 0xd10f79e2, 0x023d830f, 0xd9c50000,
+0xf9c5d459, 0xc5a05529, 0xa05551f9, 0xd4c2e9c5,
+0x02a7b800, 0xe2c40000, 0x0fd10f79, 0x00021a83,
+0x12fbc500, 0x0002472d, 0x5ed1c500, 0x29f9c5d4,
+0xe3c4a055, 0xa0550979, 0x02afb80b, 0xe9c50000,
+0x022915c2, 0xc4000000, 0xd10f79e2, 0x01e9830f,
+0xe1c50000, 0xc5e05559, 0xc5f459e1, 0xb05529f9,
+0x555fc9c5, 0x5dc9c5b0, 0xf9c5b075, 0xc5b07529,
+0xb05558e9, 0x6558d9c5, 0x0348b8e0, 0xe9c50000,
+0xe9c5d359, 0xc400d4c2, 0xd10f79e2, 0x01a9830f,
+0xe3c40000, 0xd0550579, 0x0359b801, 0xe9c50000,
+0x00e055c2, 0x0f79e2c4, 0x8c830fd1, 0xb8000001,
+0x00000001, 0x5528f9c5, 0x6ef9c5e0, 0x035eb8f8,
+0xf9c50000, 0xc500f770, 0xc5e2e6fb, 0xd07d28f9,
+0xe6fad9c5, 0x2579e2c4, 0x73d9c5e4, 0xe2c401f4,
+0xc5e40d41, 0x00e4c2e9, 0x0f79e2c4, 0x48830fe1,
+0xc5000001, 0xd06516e9, 0x7d28f9c5, 0x15e9c5d0,
+0x5cd9c5f7, 0x0370b8e6, 0xd9c50000, 0xd9c5e359,
+0xc400e5c2, 0xe10f79e2, 0x011d830f, 0x0ff20000,
+0xc5d06512, 0x1d2d12fb, 0xc5000001, 0xc5ed58e1,
+0xd07528f9, 0x3d12fbc5, 0x0000011c, 0x0003b1b8,
+0x5cd9c500, 0x59d1c5e6, 0xc2d9c5ef, 0xe2c400e5,
+0x0fe10f79, 0x0000e283, 0x57d9c500, 0x17f9c5e4,
+0xc4b8b855, 0xc5000003, 0x01dbc2d9, 0x7513f9c5,
+0x69e3c4b0, 0xc530d64b, 0xb05d28f9, 0xd2c2e1c5,
+0x79e2c400, 0x830fd10f, 0x000000af, 0x7d28f9c5,
+0x03d4b8d0, 0xe3c40000, 0xe0550d41, 0xc2e1c502,
+0xe2c400da, 0x0fd90f79, 0x00008e83, 0x28f9c500,
+0xc1c5d07d, 0xc5e055d0, 0xd07528f9, 0x5dd0c9c5,
+0x03ddb8e0, 0xe9c50000, 0xc400d3c2, 0xd10f79e2,
+0xf9c56973, 0xc4d05d28, 0x554161e3, 0xecb831e0,
+0xc5000003, 0x9415c2e9, 0x00000000, 0x0f79e2c4,
+0xc54873d1, 0xa05d29f9, 0x557cd9c5, 0x15e9c5a0,
+0x2ef9c5d2, 0x00005715, 0x752b7a00, 0x28f9c529,
+0xc1c5d07d, 0x31e0557d, 0x7ce9c5c0, 0xc2e9c5d4,
+0xe2c400d4, 0x0fd10f79, 0xf883c092, 0x25c01901,
+0x00000401, 0xf8b805eb, 0x5d000003, 0x000000c3,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002220,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8148e0, 0x00000088, 0xc501488d, 0x89c92af2,
+0xc5c129d1, 0x844c11fa, 0x2af2c508, 0x11fac5c9,
+0xc528844c, 0x050d10fa, 0xa8000006, 0xc5087501,
+0x190d10fa, 0xc5000006, 0x844c11fa, 0xc0ff4848,
+0x08f88348, 0xfcc5c275, 0x08247c28, 0x7c29fcc5,
+0xfcc5a824, 0xa8244c28, 0x000260b8, 0xc2f4c500,
+0xfcc500d7, 0xfa81d250, 0x000000ff, 0x05bc850f,
+0xf4c50000, 0x08245458, 0x5429fcc5, 0xfcc5c824,
+0x08247c28, 0x000266b8, 0x58c4c500, 0xc2ecc5d7,
+0x00c82454, 0xd250fcc5, 0x00fffa81, 0x850f0000,
+0x0000058a, 0x7c28fcc5, 0xc4c5c824, 0x0824545c,
+0x5429fcc5, 0xf4c5e824, 0xe82454c2, 0x026bb800,
+0xfcc50000, 0xfa81d250, 0x000000ff, 0x055c850f,
+0xfcc50000, 0x28247428, 0x4c59f4c5, 0xccc50824,
+0xfcc5de59, 0x08245428, 0xee58ecc5, 0x645cecc5,
+0xf4c52824, 0x82b8cb5c, 0xc5000002, 0xc5e559dc,
+0x00ccc2f4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x0000051a, 0x4c59ecc5, 0xfcc54824, 0xa8244c29,
+0x545eecc5, 0xf4c54824, 0xb800cac2, 0x0000028b,
+0xd150fcc5, 0x00fffa81, 0x850f0000, 0x000004ee,
+0x187de2c4, 0x0004eb15, 0x28fcc500, 0xb848245c,
+0x0000028e, 0xca57e4c5, 0x5457ecc5, 0xf4c50824,
+0xa8244c59, 0xcac2f4c5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x0004b585, 0x53fcc500, 0xc508244c,
+0x244c29fc, 0x53fcc5a8, 0xc5a8244c, 0x245428fc,
+0x0296b808, 0xfdc50000, 0xfcc5c95b, 0xf4c5c95b,
+0xc500cac2, 0x81d150fc, 0x0000fffa, 0x7b850f00,
+0xc5000004, 0xc5ca59ec, 0x244c29fc, 0x52fcc5a8,
+0xc5a8244c, 0x244c29fc, 0x28fcc5c8, 0xb8c8244c,
+0x0000029d, 0xe153fcc5, 0xe45bfdc5, 0xe45bfcc5,
+0xd4c2ecc5, 0x50fcc500, 0xfffa81d2, 0x0f000000,
+0x00043985, 0x28fcc500, 0xc5082454, 0xc5c95bfd,
+0xb8c95bfc, 0x0000029f, 0xe253fcc5, 0xe45bfdc5,
+0xe45bfcc5, 0xccc2f4c5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x00040585, 0x59ecc500, 0x29fcc5ca,
+0xc5a8244c, 0x244c51fc, 0x02a7b8a8, 0xf4c50000,
+0xc500cac2, 0x81d150fc, 0x0000fffa, 0xdb850f00,
+0xc4000003, 0x25187de2, 0x000003f4, 0xca5edcc5,
+0x4c29fcc5, 0xe3c4a824, 0x244c087d, 0xafb80ba8,
+0xc5000002, 0xd40dc2f4, 0x00000003, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x000003a2, 0x4c59e4c5,
+0xe4c52824, 0xfcc5ea59, 0xc8244c29, 0x4c5fd4c5,
+0xfcc5c824, 0xe8244c29, 0x6c5dd4c5, 0xfcc5c824,
+0xc8246c29, 0x4c58f4c5, 0xecc5c824, 0x28245458,
+0x000348b8, 0x59f4c500, 0xc2f4c5cb, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x0350850f, 0xe3c40000,
+0x244c047d, 0xfcc51b08, 0x28246c28, 0x000359b8,
+0x75e3c400, 0xc501c906, 0x00c9c2d4, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x00000322, 0x000001b8,
+0x5bfdc500, 0x6ef9c5d5, 0x035eb8f8, 0xf9c50000,
+0xc500f770, 0xc4cefae9, 0xd2197de3, 0xfae9c501,
+0x75e3c4d6, 0xc501ca18, 0x245428fc, 0x6de2c408,
+0xe3c4c90c, 0x01c90675, 0xc9c2d4c5, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x0002d185, 0x58ecc500,
+0x0362b8d5, 0xe2c40000, 0xc90d187d, 0xc5000002,
+0x00d1c2ec, 0xd250fcc5, 0x00fffa81, 0x850f0000,
+0x000002aa, 0x4c12fec5, 0xe2c40824, 0x9d15187d,
+0xc5000002, 0x244c5cf4, 0x03b1b808, 0xe2c40000,
+0x9535187d, 0xc5000002, 0xc5d358ec, 0xc5d659ec,
+0x00cac2f4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x0000026a, 0x4c16fec5, 0xfcc50824, 0xa8244c29,
+0xe458e4c5, 0x5428fcc5, 0xb8b80824, 0xc5000003,
+0xc5ca5cf4, 0xc5e659dc, 0x00ccc2f4, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x00000232, 0xfcc5c031,
+0x01a8cd28, 0xfcc50475, 0xfcc5ca28, 0x68244c29,
+0x4c10fac5, 0xfac56884, 0xc8844c11, 0x48c0ff48,
+0x7508f883, 0x57f0c5d9, 0x03c4b8c9, 0xf4c50000,
+0xc501cbc2, 0x245c28fc, 0x55e3c4c8, 0xc510d24a,
+0x00d2c2e4, 0xd250fcc5, 0x00fffa81, 0x850f0000,
+0x000001da, 0xc4ffc883, 0x542c75e2, 0xfcc50824,
+0xe8245429, 0xa4244489, 0x187de2c4, 0xb8a42454,
+0x000003cd, 0xca55f4c5, 0x2e75e2c4, 0xc5e8246c,
+0x247428fc, 0xc2ccc5e8, 0xfcc500cb, 0xfa81d150,
+0x000000ff, 0x0194850f, 0xfcc50000, 0x08247c28,
+0x0003d4b8, 0x45e3c400, 0x28244c0c, 0xc2e4c5aa,
+0xfcc500d9, 0xfa81d350, 0x000000ff, 0x016c850f,
+0xfcc50000, 0x08247428, 0x4cd0cfc5, 0xfcc52824,
+0x08247c28, 0x54d0c7c5, 0xddb82824, 0xc5000003,
+0x00cac2f4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x0000013a, 0x5c28fcc5, 0xe3c40824, 0x24544065,
+0xecb8f128, 0xc5000003, 0xc4ca28f8, 0xd2197de3,
+0x58f2c501, 0x71e3c4ca, 0xc50ec921, 0x4c0dc2f4,
+0x00000001, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x000000fa, 0x5c29fcc5, 0x03baa824, 0xc5000000,
+0xc5c957f0, 0x24547cf7, 0x7de3c4a8, 0xc501d319,
+0xc5e212d8, 0xc5d316e8, 0xe4e3c6d8, 0xebc6e0c5,
+0x6de3c4ff, 0xc501d418, 0x245429fc, 0x75caffa8,
+0x2ef8c5d2, 0x0000c72d, 0xaa8a0f00, 0x0f000000,
+0x0000a485, 0x28fcc500, 0xc5082474, 0x245c7dcf,
+0x28f8c528, 0x7de3c4d3, 0xc501db19, 0xc5e212d8,
+0xc5d316e8, 0xe4e3c6d8, 0x186de3c4, 0xefc501d4,
+0xf8c5d97c, 0xe3c4d328, 0x01db197d, 0xe212d8c5,
+0xd316e8c5, 0xe3c6d8c5, 0x6de3c4e4, 0xc501d418,
+0xc5d97cef, 0xc4d328f8, 0xdb197de3, 0x12d8c501,
+0x16e8c5e2, 0xc6d8c5d3, 0xe3c4e4e3, 0x01d4186d,
+0xd17cefc5, 0xda28f8c5, 0x197de3c4, 0xd8c501d2,
+0xe0c5e312, 0xd8c5da16, 0xc4e4e2c6, 0xdc1865e3,
+0xc2e4c501, 0xfcc500d9, 0xff3dc350, 0xb8000000,
+0x00000401, 0xebc2440f, 0x03f8b805, 0xc3c90000,
+0xbf800000, 0x80000000, 0x41100000, 0x3f000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003240,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x05aa0d10, 0xfbc50000, 0x05621d10, 0xfbc50000,
+0x05622510, 0xfbc50000, 0x05622d10, 0xfbc50000,
+0x05621510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0x000260b8, 0xc2f5c500, 0xfdc500d7, 0xfa83d250,
+0xc4850f0f, 0xc5000004, 0x245458f5, 0x29fdc508,
+0xc5c82454, 0x247428fd, 0x0266b808, 0xcdc50000,
+0xedc5d658, 0xc82454c2, 0x50fdc500, 0x0ffa83d2,
+0x0495850f, 0xfdc50000, 0xc8247c28, 0x545cc5c5,
+0xfdc50824, 0xe8245429, 0x54c2f5c5, 0xb800e824,
+0x0000026b, 0xd250fdc5, 0x0f0ffa83, 0x00046a85,
+0x28fdc500, 0xc5282474, 0x244c59f5, 0x59cdc508,
+0x28fdc5de, 0xc5082454, 0xc5ee58ed, 0x24645ced,
+0x5cf5c528, 0x0282b8cb, 0xddc50000, 0xf5c5e559,
+0xc500ccc2, 0x83d150fd, 0x850f0ffa, 0x0000042b,
+0x4c59edc5, 0xfdc54824, 0xa8244c29, 0x545eedc5,
+0xf5c54824, 0xb800cac2, 0x0000028b, 0xd150fdc5,
+0x0f0ffa83, 0x00040285, 0x7de2c400, 0x042e1d19,
+0xfdc50000, 0x48245428, 0x00028eb8, 0x57edc500,
+0x57e5c5cb, 0xc508245c, 0x244c59f5, 0xc2f5c5a8,
+0xfdc500cb, 0xfa83d150, 0xcc850f0f, 0xc5000003,
+0x244c5afd, 0x75e3c408, 0xc501c918, 0xc5c953fc,
+0xc5c95afc, 0x244c29fd, 0x5afdc5a8, 0xc5a8244c,
+0x244c29f8, 0x75e3c498, 0xc501c918, 0x246428fd,
+0x53fcc508, 0x0296b8c9, 0xfcc50000, 0xffc5c95a,
+0xfec5c9e6, 0xf5c5c9e6, 0xc500ccc2, 0x83d150fd,
+0x850f0ffa, 0x00000373, 0xcc59ddc5, 0x4c29fdc5,
+0xfdc5a824, 0xa8244c5a, 0x1875e3c4, 0xfcc501c9,
+0xfcc5c952, 0xfdc5c95a, 0xc8244c29, 0x5c28fdc5,
+0x9db8c824, 0xc5000002, 0xc5cb5afd, 0x244c29f8,
+0x75e3c498, 0xc501c918, 0xc5c953fc, 0xc5c95afc,
+0xc5c9e6ff, 0xc5c9e6fe, 0x00c9c2dd, 0xd150fdc5,
+0x0f0ffa83, 0x00031285, 0xe6ffc500, 0xe6fec5db,
+0x28fdc5e3, 0xb808245c, 0x0000029f, 0xcb5afdc5,
+0x4c29f8c5, 0xe3c49824, 0x01c91875, 0xc953fcc5,
+0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5, 0xc9c2ddc5,
+0x50fdc500, 0x0ffa83d1, 0x02cd850f, 0xe5c50000,
+0xfdc5cb59, 0xa8244c29, 0x4c51fdc5, 0xa7b8a824,
+0xc5000002, 0x00cbc2f5, 0xd150fdc5, 0x0f0ffa83,
+0x0002a685, 0x7de2c400, 0x02f20d19, 0xf5c50000,
+0xfdc5cb5e, 0xa8244c29, 0x097de3c4, 0x0ba8244c,
+0x0002afb8, 0xc2f5c500, 0x0002d20d, 0xfdc50000,
+0xfa83d150, 0x70850f0f, 0xc5000002, 0x244c59ed,
+0x59edc528, 0x29fdc5e3, 0xc5c8244c, 0x244c5fdd,
+0x5dddc5c8, 0xc5c82464, 0x246429fd, 0x58f5c5c8,
+0xc5c8244c, 0x245c58e5, 0x0348b828, 0xf5c50000,
+0xf5c5ca59, 0xc500cbc2, 0x83d150fd, 0x850f0ffa,
+0x00000227, 0x4c28fdc5, 0xfdc50824, 0x28246428,
+0x000359b8, 0x7de3c400, 0xc405d905, 0xdb0665e3,
+0xc2ddc501, 0xfdc500db, 0xfa83d350, 0xf8850f0f,
+0xc5000001, 0xb8cc58f5, 0x00000362, 0x197de2c4,
+0x0002231d, 0xc2f5c500, 0xfdc500cb, 0xfa83d150,
+0xd4850f0f, 0xc5000001, 0x244c12ff, 0x7de2c408,
+0x01f22d19, 0xfdc50000, 0x08245c28, 0x0003b1b8,
+0x7de2c400, 0x01f63519, 0xedc50000, 0xf5c5ed58,
+0xd5c5cb5c, 0xf5c5ee59, 0xc500cdc2, 0x83d150fd,
+0x850f0ffa, 0x00000193, 0x197de3c4, 0xf9c501d9,
+0xc8245c13, 0x0003c4b8, 0x13f9c500, 0xc4d8244c,
+0xe1197de3, 0x17f9c501, 0xc5e0244c, 0xc5c957f1,
+0x01d2c2f5, 0x6417f9c5, 0xfdc5d024, 0xc8246c28,
+0x4b5de3c4, 0xd5c520db, 0xc500dbc2, 0x83d350fd,
+0x850f0ffa, 0x00000143, 0xffc88348, 0x2d6de2c4,
+0xc508245c, 0x245c29fd, 0x448948e8, 0xe2c49024,
+0x245c197d, 0x03cdb890, 0xecc50000, 0xe2c4d355,
+0x24642f6d, 0x28fdc5e8, 0xc5e8247c, 0x00d5c2c5,
+0xd250fdc5, 0x0f0ffa83, 0x0000fe85, 0x28fdc500,
+0xb8082474, 0x000003d4, 0x0d4de3c4, 0x0a282454,
+0xeac2d5c5, 0x50fdc500, 0x0ffa83d5, 0x00d9850f,
+0xfdc50000, 0x08247c28, 0x54d0c5c5, 0xfdc52824,
+0x08245c28, 0x64d0e5c5, 0xddb82824, 0xc5000003,
+0x00d4c2ed, 0xd250fdc5, 0x0f0ffa83, 0x0000aa85,
+0x29fdc500, 0xc5a8245c, 0x24547cf5, 0x6de3c4a8,
+0xc401da18, 0xd2066de3, 0xc6e5c531, 0xfdc50cd2,
+0xa8245429, 0x4c7cf5c5, 0xe3c4a824, 0x01c9197d,
+0xc915f1c5, 0x0d2ef9c5, 0x000000bc, 0x6675687a,
+0x7428fdc5, 0xcdc50824, 0x28244c7d, 0xdb57e1c5,
+0x000000ba, 0x75e3c400, 0xc401d118, 0xc90675e3,
+0xc6edc531, 0xedc50cd1, 0xe3c4d37c, 0x01ca186d,
+0x066de3c4, 0xf5c531d2, 0xc50ccac6, 0xc4cb7cf5,
+0xd11875e3, 0x75e3c401, 0xc531c906, 0x0cc9c6ed,
+0xcbc2f5c5, 0x50fdc500, 0x0ff883c1, 0x000401b8,
+0xc2440f00, 0xf8b805eb, 0xc9000003, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x40140000,
+0x00000000, 0x3fe00000, 0x00000000, 0x40240000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0002740,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8348e589, 0x8148e0e4,
+0x0000e0ec, 0x10fac500, 0x0003a30d, 0x11fac500,
+0xc52c244c, 0x244c11fa, 0x11fac530, 0x8b34244c,
+0x892c2444, 0x31202444, 0x10fac5ff, 0xc5202454,
+0x24542ef8, 0x0000b92c, 0x0f400000, 0x450fc79b,
+0xe8dff7f9, 0xffffff8a, 0x60b8c289, 0x84000002,
+0x51840fd2, 0xc5000003, 0x245410fa, 0x58eac520,
+0xc52c2454, 0x245411fa, 0x10fac524, 0x312c2454,
+0x58eac5ff, 0x2ef8c5d2, 0x40242454, 0x0fc79b0f,
+0xdff7f945, 0xffff49e8, 0xb8c289ff, 0x00000266,
+0x840fd284, 0x00000310, 0x5410fac5, 0xeac52424,
+0x2c24545c, 0x1411fac5, 0x24048b24, 0x5c244489,
+0x24244489, 0x28244489, 0xfac5ff31, 0x20245410,
+0x542ef8c5, 0x0f402824, 0x450fc79b, 0xe8dff7f9,
+0xfffffefe, 0x6bb8c289, 0x84000002, 0xc5840fd2,
+0xc5000002, 0x245410fa, 0x59eac520, 0xc52c2454,
+0x245411fa, 0x10fac520, 0xc5302454, 0xc5d259ea,
+0x245411fa, 0x10fac524, 0xc52c2454, 0x245458ea,
+0x11fac530, 0xc5282454, 0x245410fa, 0x5ceac52c,
+0x3130245c, 0x59e2c5ff, 0xc528245c, 0x246410fa,
+0x5cdac520, 0xc5242464, 0xc5e32ef8, 0x245c11fa,
+0x9b0f4028, 0xf9450fc7, 0x83e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x024a840f, 0xeac50000,
+0x34245459, 0x5411fac5, 0xff312024, 0x5410fac5,
+0xeac52c24, 0x3424545e, 0x542ef8c5, 0xfac52024,
+0x24245411, 0xc79b0f40, 0xf7f9450f, 0xfe40e8df,
+0xc289ffff, 0x00028bb8, 0x0fd28400, 0x00020784,
+0x10fac500, 0xc5342454, 0x112510fa, 0xc5000002,
+0x245c10fa, 0xc5ff312c, 0xc5d457e8, 0xc5dc57e0,
+0x245459ea, 0x2ef8c520, 0x9b0f40d3, 0xf9450fc7,
+0xfbe8dff7, 0x89fffffd, 0x028eb8c2, 0xd2840000,
+0x01c2840f, 0x0ff30000, 0x2c245453, 0x5411fac5,
+0x0ff32024, 0x20245c53, 0xc32cfac5, 0x5410fac5,
+0xff312c24, 0xd82ae2c5, 0xda2ef8c5, 0xc79b0f40,
+0xf7f9450f, 0xfdb8e8df, 0xc289ffff, 0x000296b8,
+0x0fd28400, 0x00017f84, 0x59eac500, 0x11fac5d2,
+0xf3202454, 0x2454520f, 0x11fac520, 0xf3242454,
+0x2454530f, 0x2cfac524, 0xc5ff31c2, 0xc5d02aea,
+0x24542ef8, 0x9b0f402c, 0xf9450fc7, 0x6fe8dff7,
+0x89fffffd, 0x029db8c2, 0xd2840000, 0x0136840f,
+0xfac50000, 0x2424442c, 0x0ff3ff31, 0x2c245453,
+0xd82ae2c5, 0xc22cfac5, 0xd02aeac5, 0xda2ef8c5,
+0xc79b0f40, 0xf7f9450f, 0xfd34e8df, 0xc289ffff,
+0x00029fb8, 0x0fd28400, 0x0000fb84, 0x10fac500,
+0xc52c2454, 0xc5d259ea, 0x245411fa, 0x10fac520,
+0x312c2454, 0x510ff3ff, 0xc520245c, 0x40da2ef8,
+0x0fc79b0f, 0xdff7f945, 0xfffcf5e8, 0xb8c289ff,
+0x000002a7, 0x840fd284, 0x000000bc, 0xd25ef2c5,
+0x4c11fac5, 0xfac52424, 0x20245411, 0x0f66ff31,
+0x244c0a3a, 0xf8c50b20, 0x24244c2e, 0x4c11fac5,
+0x0f402824, 0x450fc79b, 0xe8dff7f9, 0xfffffcb2,
+0xafb8c289, 0x84000002, 0xc57d74d2, 0x244c10fa,
+0x59f2c534, 0xc52c2454, 0x244c59f2, 0x11fac530,
+0xc5202454, 0x244c11fa, 0x10fac524, 0xc520244c,
+0x244c5ff2, 0x11fac524, 0xc528244c, 0x244c10fa,
+0x5df2c520, 0xc524244c, 0x244c11fa, 0x10fac524,
+0xc524244c, 0x244c58f2, 0xc5ff3128, 0x244c59f2,
+0x10fac534, 0xc52c2454, 0x245458ea, 0x2ef8c530,
+0x9b0f40ca, 0xf9450fc7, 0x33e8dff7, 0x3cfffffc,
+0x25c01901, 0x00000348, 0x0000c3c9, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002000,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000128ec,
+0x10fbc500, 0x0004570d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5a8,
+0xbac02454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000260, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0xf0850f00, 0xc5000003,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x66b8f06e, 0xc5000002, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x03a5850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482024, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x026bb8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x00034a85, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x82b8e86e, 0xc5000002, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x02c5850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x0000028b, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x78850f00, 0xc5000002, 0x91257efa, 0xc5000002,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x8eb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0229850f, 0x0ff20000, 0xc024545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff2a824, 0xa8245c5a,
+0xdb530ff3, 0xdb5a0ff3, 0xc32cfbc5, 0x5410fbc5,
+0xe3c5c024, 0xc031d82a, 0xda2ef9c5, 0x48c09b0f,
+0x48c2450f, 0xe1c4d8f7, 0xb8e86ef9, 0x00000296,
+0xcdd7f9c5, 0x81c9b60f, 0x0000fff9, 0xcc850f00,
+0xc5000001, 0xc5d259eb, 0x245411fb, 0x5a0ff2a8,
+0xf3a82454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff2b0, 0xf3b02454, 0xf3d2530f, 0xc5d25a0f,
+0xc5c22cfb, 0x31d02aeb, 0x2ef9c5c0, 0x0fc02454,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x9db8f06e,
+0xc5000002, 0x0fced7f9, 0xf981c9b6, 0x000000ff,
+0x0169850f, 0xfbc50000, 0xb0244c2c, 0x545a0ff2,
+0x0ff3c024, 0x0ff3d253, 0xfbc5d25a, 0xc139c22c,
+0x0fc0940f, 0xf748c0b6, 0xf9e1c4d8, 0x9fb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0129850f, 0xfbc50000, 0xc0245410, 0xd259ebc5,
+0x5411fbc5, 0xfbc5a824, 0xc0245410, 0x0ff2c031,
+0xa8245c51, 0xda2ef9c5, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x000002a7, 0xd5d7f9c5,
+0x81d2b60f, 0x0000fffa, 0xe0850f00, 0xc5000000,
+0xc5d25ef3, 0x244c11fb, 0x11fbc5b0, 0x31a82454,
+0x0000bac0, 0x0f660000, 0x244c0b3a, 0xf9c50ba8,
+0xb0244c2e, 0x4c11fbc5, 0x9b0fb824, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x02afb8f0, 0xf9c50000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x00008e85,
+0x10fbc500, 0xc5d0244c, 0x245459f3, 0x59f3c5c0,
+0xc5c8244c, 0x245411fb, 0x11fbc5a8, 0xc5b0244c,
+0x244c10fb, 0x5ff3c5a8, 0xc5b0244c, 0x244c11fb,
+0x10fbc5b8, 0xc5a8244c, 0x244c5df3, 0x11fbc5b0,
+0xc5b0244c, 0x244c10fb, 0x58f3c5b0, 0x31b8244c,
+0x59f3c5c0, 0xc5d0244c, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x0fca2ef9, 0x0f48c09b, 0x48bac245,
+0x48000003, 0xe1c4d8f7, 0xc5f86ef9, 0x0fc7d7f9,
+0xff3dc0b6, 0xb8000000, 0x00000000, 0xc9c2450f,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002220,
+};
@@ -0,0 +1,1985 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0xe8535657, 0x00000207, 0x02b8c681, 0xec830000,
+0xb845c75c, 0x00000001, 0x04c845c7, 0xc7000000,
+0x0002bc45, 0x45c70000, 0x000003cc, 0xc045c700,
+0x00000003, 0x02d045c7, 0xc7000000, 0x0004c445,
+0x45c70000, 0x000001d4, 0x708e8d00, 0x31ffffff,
+0x76f1c5c0, 0x985d8dc9, 0xdbefe1c5, 0xf96ff9c5,
+0x9041e2c4, 0xf9c51914, 0x8398557f, 0x0f01833c,
+0x00017885, 0xf8834000, 0xc5f07504, 0xb8556ff9,
+0xf16ff9c5, 0x9049e2c4, 0xf9c5911c, 0xfa83da7e,
+0x009ab802, 0x850f0000, 0x0000016b, 0x1679e3c4,
+0xfa8301da, 0x5c850f03, 0xc4000001, 0xda1679e3,
+0x04fa8302, 0x014d850f, 0xe3c40000, 0x03da1679,
+0x0f05fa83, 0x00013e85, 0x72d9c500, 0xf9c502f2,
+0xa2b8f96f, 0xc4000000, 0x1c9041e2, 0x7ef9c561,
+0x03fa83da, 0x011d850f, 0xe3c40000, 0x01da1679,
+0x0f05fa83, 0x00010e85, 0x79e3c400, 0x8302da16,
+0x850f07fa, 0x000000ff, 0x1679e3c4, 0xfa8303da,
+0xf0850f09, 0x8d000000, 0xc031c855, 0x5d6ff9c5,
+0x6ff9c5c8, 0x49e2c4f1, 0xc5992490, 0x98657ff9,
+0x47823c8b, 0x0f833c39, 0x0000b785, 0xf8834000,
+0xc5ed7504, 0xf0a6fad9, 0xc5ffffff, 0xc5edefd1,
+0x8deafad1, 0xffff80be, 0x6ff9c5ff, 0x00b2b8f9,
+0xe2c40000, 0xaf349041, 0xed76d1c5, 0xe676d9c5,
+0x1779e2c4, 0x8c830fe5, 0xc5000000, 0x01f372d1,
+0xe2c4c031, 0x6f649071, 0x7ff9c5f0, 0x348b9865,
+0x34394682, 0x40647583, 0x7504f883, 0xefd1c5f1,
+0xdbe9c5ed, 0xc5c031cb, 0xc5cd76f1, 0xc4cd76f1,
+0x249071e2, 0x0005b991, 0xf9c50000, 0x8ba8657f,
+0x89a8855c, 0xc22940ca, 0xca6ff9c5, 0x0475c285,
+0xcb6ff9c5, 0x4d7ff9c5, 0x857c8bd8, 0x01578dd4,
+0x1e75d339, 0x7504f883, 0xebc031d6, 0x0092b81a,
+0x13eb0000, 0x0000aab8, 0xb80ceb00, 0x000000c0,
+0xc9b805eb, 0x83000000, 0x5e5b5cc4, 0x8bc35d5f,
+0x00c32434, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x00000000, 0x00000000,
+0001334,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x0001dde8, 0xfbc18100, 0x89000002, 0x535657e5,
+0xc74cec83, 0x0001c845, 0x45c70000, 0x000002d8,
+0xcc45c700, 0x00000002, 0x01dc45c7, 0xc7000000,
+0x0003d045, 0x45890000, 0xd445c7e0, 0x00000004,
+0xffe445c7, 0x8dffffff, 0xfffef081, 0x76f1c5ff,
+0xefe1c5c9, 0x6ff9c5db, 0xc9e2c4f1, 0xc5181490,
+0xc055d6f9, 0xbbc0758b, 0x00000092, 0x0b01f683,
+0x850fc475, 0x00000160, 0x5517f8c5, 0xc0758bc0,
+0x0b01f683, 0x850fc475, 0x0000014c, 0x6d6ff9c5,
+0x6ff9c5c8, 0xc1e2c4f9, 0xc5e81490, 0xc055d6f9,
+0xbbc0758b, 0x0000009a, 0x0b02f683, 0x850fc475,
+0x00000124, 0x5517f8c5, 0xc0758bc0, 0x0b03f683,
+0x850fc475, 0x00000110, 0xf572e1c5, 0x6ff9c503,
+0x00a2bbf1, 0xe2c40000, 0x581490c9, 0x55d6f9c5,
+0xc0758bc0, 0x0b03f683, 0x850fc475, 0x000000e8,
+0x5517f8c5, 0xc0758bc0, 0x0b05f683, 0x850fc475,
+0x000000d4, 0x5d6ff9c5, 0x6ff9c5d8, 0xc1e2c4f9,
+0x8bd81490, 0xe3c4d845, 0x01d21679, 0x8901788d,
+0xf889c07d, 0x891ff8c1, 0xf9c5c445, 0x5539d07e,
+0x95850fc4, 0x39000000, 0x8d850fc7, 0x8b000000,
+0xf8c5dc45, 0x8bb05517, 0x708db455, 0xb8758901,
+0xf8c1f089, 0xbc45891f, 0x39b0458b, 0x6c75bc55,
+0x6875c639, 0x91fbe9c5, 0xfffffff0, 0xe4efd9c5,
+0xe5fad9c5, 0xff00818d, 0xf9c5ffff, 0xb2bbf16f,
+0xc4000000, 0x2c90c9e2, 0x69e2c4e0, 0xe2c4d529,
+0x73d11779, 0x72e1c543, 0xe2c401f3, 0x985490f1,
+0x79e3c4f0, 0x3901d216, 0xf9c5c455, 0x2375d07e,
+0x1f75c739, 0x5517f8c5, 0xc4558bc0, 0x8bbc5539,
+0x0f75c045, 0xc639db31, 0x0ceb0975, 0x0000aabb,
+0xbb05eb00, 0x000000c0, 0x894cc483, 0x5f5e5bd8,
+0x0c8bc35d, 0x0000c324, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0001434,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xede855c3,
+0x05000002, 0x000003bd, 0x5657e589, 0x6cec8353,
+0x01b845c7, 0xc7000000, 0x0004c845, 0x45c70000,
+0x000002bc, 0xcc45c700, 0x00000003, 0x03c045c7,
+0xc7000000, 0x0002d045, 0x45c70000, 0x000004c4,
+0xd445c700, 0x00000001, 0xc976f1c5, 0xff50908d,
+0xe1c5ffff, 0x4d8ddbef, 0xc5db3198, 0xc4f928f8,
+0x149241e2, 0x29f8c51a, 0xe8d99855, 0xdf9904d9,
+0x0fd8dde9, 0x0002278a, 0x21850f00, 0x43000002,
+0x7504fb83, 0x28f8c5e5, 0x6ff9c5f1, 0xe2c4b855,
+0x921c9249, 0x5d11fac5, 0xd080d994, 0xd9ffffff,
+0xe9df9445, 0x8a0fd8dd, 0x00000215, 0x020f850f,
+0xe3c40000, 0x01df1779, 0xffd480d9, 0x7d89ffff,
+0x9445d994, 0x8a0fe9df, 0x000001db, 0x01d9850f,
+0xe3c40000, 0x02df1779, 0xffd880d9, 0x7d89ffff,
+0x9445d994, 0xd8dde9df, 0x01c18a0f, 0x850f0000,
+0x000001bf, 0xffdc80d9, 0xe3c4ffff, 0x945d1779,
+0x9445d903, 0x8a0fe9df, 0x000001ab, 0x01ab850f,
+0xf8c50000, 0xd9c5f928, 0xc402f272, 0x1c9241e2,
+0x11fac562, 0x45d9945d, 0xddeadf94, 0x958a0fd9,
+0x0f000001, 0x00019385, 0x79e3c400, 0x01945d17,
+0xdf9445d9, 0x0fd8dde9, 0x0001818a, 0x7b850f00,
+0xc4000001, 0xdf1779e3, 0xe080d902, 0x89ffffff,
+0x45d9947d, 0xdde9df94, 0x5f8a0fd8, 0x0f000001,
+0x00015985, 0xe480d900, 0xc4ffffff, 0x5d1779e3,
+0x45d90394, 0xdde9df94, 0x3f8a0fd8, 0x0f000001,
+0x00013985, 0x28f8c500, 0x6ff9c5f1, 0xf631c85d,
+0x9249e2c4, 0xf8c59a24, 0x8d986529, 0x3c8bc85d,
+0x7d8947b3, 0x9445db94, 0xdfb104d9, 0x0fd8dde9,
+0x0001108a, 0x0a850f00, 0x46000001, 0x7504fe83,
+0x58d8c5dd, 0xfffff0a0, 0x60b08dff, 0xc5ffffff,
+0xc5edefd1, 0xc5f928f8, 0xc4eafad1, 0x349241e2,
+0x00b2b8ae, 0xd1c50000, 0xd8c5ed76, 0xc400e6c2,
+0xe51779e2, 0x00de830f, 0xd1c50000, 0x3101f372,
+0x71e2c4c0, 0xf06e6492, 0x6529f8c5, 0x83348b98,
+0x94758946, 0xd99445db, 0xe9df8104, 0x8a0fd8dd,
+0x000000a8, 0x00a2850f, 0x83400000, 0xdd7504f8,
+0xedefd1c5, 0xcbdbe9c5, 0xcd76f1c5, 0xf576f1c5,
+0xfe28f8c5, 0xe2c4c031, 0x92249241, 0x6529f8c5,
+0x0005b9a8, 0x44d90000, 0xca89a885, 0xc5c22940,
+0x85ca6ff9, 0xc50475c2, 0xc5cb6ff9, 0xd84d7ff9,
+0xd4855c8b, 0x8901538d, 0x45db9455, 0xdfc9d994,
+0x7ad8dde9, 0x834c754e, 0xca7504f8, 0x48ebc031,
+0x000092b8, 0xdd41eb00, 0xdd16ebd8, 0xdd12ebd8,
+0xdd0eebd8, 0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04,
+0x009ab8d8, 0x20eb0000, 0x02ebd8dd, 0xa2b8d8dd,
+0xeb000000, 0x00aab813, 0x0ceb0000, 0x0000c0b8,
+0xb805eb00, 0x000000c9, 0x5b6cc483, 0xc35d5f5e,
+0xc324048b, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0x00000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x00000000, 0x00000000, 0x00000000,
+0001734,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xd23155c3,
+0x00021ee8, 0x034b0500, 0xe5890000, 0xc738ec83,
+0x0001d845, 0x45c70000, 0x000002e8, 0xdc45c700,
+0x00000002, 0x01ec45c7, 0xc7000000, 0x0003e045,
+0x55890000, 0xe445c7f0, 0x00000004, 0xfff445c7,
+0x8dffffff, 0xfffee090, 0x76f1c5ff, 0xefe1c5c9,
+0x28f9c5db, 0xc9e2c4f1, 0xc51a1492, 0xd05513f9,
+0x45dde8d9, 0x0fe9dfd0, 0x0001698a, 0x67850f00,
+0xc5000001, 0xd05517f9, 0xdfd045dd, 0x0fd8dde9,
+0x0001578a, 0x51850f00, 0xc5000001, 0xd86d6ff9,
+0xf928f9c5, 0x92c1e2c4, 0xf9c5ea14, 0xd9d05513,
+0xffffe080, 0xd045ddff, 0xd8dde9df, 0x01378a0f,
+0x850f0000, 0x00000131, 0x5517f9c5, 0xe480d9d0,
+0xddffffff, 0xe9dfd045, 0x01158a0f, 0x850f0000,
+0x00000113, 0xf572e1c5, 0x28f9c503, 0xc9e2c4f1,
+0xc55a1492, 0xd05513f9, 0xdfd045dd, 0x0fd8dde9,
+0x0000fb8a, 0xf5850f00, 0xc5000000, 0xd05517f9,
+0xffe880d9, 0x45ddffff, 0xdde9dfd0, 0xdd8a0fd8,
+0x0f000000, 0x0000d785, 0xe84d8b00, 0x5d6ff9c5,
+0x28f9c5e8, 0xc1e2c4f9, 0x41da1492, 0xdbd04d89,
+0xf9c5d045, 0xddd05513, 0xc9d9d045, 0xd9dde9db,
+0x00b18a0f, 0x850f0000, 0x000000af, 0x41ec4d8b,
+0xdbd04d89, 0xf9c5d045, 0xddd05517, 0xc9d9d045,
+0xd9dde9db, 0x00958a0f, 0x850f0000, 0x00000095,
+0xe4efd9c5, 0xe5fad9c5, 0x9058e9c5, 0xfffffff0,
+0xf128f9c5, 0x0000b2b8, 0xc9e2c400, 0x10e26c92,
+0xe476d9c5, 0xd5c2e9c5, 0x79e2c400, 0x7d73d417,
+0xf372e1c5, 0xf1e2c401, 0xc59a1492, 0xd05513f9,
+0xd9d045dd, 0xddeadfca, 0x75557ad9, 0x17f9c557,
+0x45ddd055, 0xdfc9d9d0, 0x7ad8dde9, 0x0000b849,
+0x4d740000, 0xd8dd40eb, 0xd8dd02eb, 0x000092b8,
+0xdd3eeb00, 0xdd02ebd8, 0x009ab8d8, 0x31eb0000,
+0x0000a2b8, 0xdd2aeb00, 0xdd0eebd8, 0xdd0aebd8,
+0xebd8ddd8, 0xddd8dd04, 0x00aab8d8, 0x11eb0000,
+0x02ebd8dd, 0xc0b8d8dd, 0xeb000000, 0xddd8dd04,
+0x8bc3c9d8, 0x00c32404, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x00000000, 0x00000000,
+0001554,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x56c93157, 0xe853f631, 0x00000248,
+0x02e0c381, 0xec830000, 0xc845c73c, 0x00000001,
+0xc7cc4589, 0x0002d845, 0x55890000, 0xd045c7dc,
+0x00000002, 0xc7d44d89, 0x0001e045, 0x75890000,
+0x808b8de4, 0xc5ffffff, 0xc5c976f1, 0xc5dbefe1,
+0xc4f16ff9, 0x149149e2, 0x7ef9c519, 0x92b84ad2,
+0x0f000000, 0x0001e785, 0x79e3c400, 0x4a01d216,
+0x01da850f, 0xe3c40000, 0x02d61679, 0x1679e3c4,
+0xd60903d2, 0x000095b8, 0xc1850f00, 0xc5000001,
+0xc86d6ff9, 0xf96ff9c5, 0x9141e2c4, 0xf9c5a914,
+0xfa83d27e, 0x009ab802, 0x850f0000, 0x000001a0,
+0x1679e3c4, 0xfa8301d2, 0x91850f03, 0xc4000001,
+0xd61679e3, 0x79e3c402, 0x0903d216, 0x009db8d6,
+0x850f0000, 0x00000178, 0xf573e1c5, 0x6ff9c502,
+0x00a2b8f1, 0xe2c40000, 0x59149149, 0xd27ef9c5,
+0x0f03fa83, 0x00015785, 0x79e3c400, 0x8301d216,
+0x850f05fa, 0x00000148, 0x1679e3c4, 0xe3c402d6,
+0x03d21679, 0xa5b8d609, 0x0f000000, 0x00012f85,
+0xd8458b00, 0x556ff9c5, 0x6ff9c5d8, 0xdc558bf9,
+0x9141e2c4, 0xf9c5911c, 0xc083d97e, 0xc0458901,
+0x8900d283, 0xc45589c8, 0xc47d8b99, 0x850ffa39,
+0x000000f0, 0x39c0458b, 0xe5850fc1, 0x8b000000,
+0xe3c4e075, 0x01da1679, 0x83e47d8b, 0x758901c6,
+0x00d783b8, 0x89bc7d89, 0xbc458bd7, 0x391fffc1,
+0xbd850fc7, 0x8b000000, 0xc239b845, 0x00b2850f,
+0xe3c40000, 0x03df1679, 0x1679e3c4, 0xfe0902de,
+0x0000adb8, 0xa5850f00, 0x8d000000, 0xffff889b,
+0xd9c549ff, 0xd9c5e4ef, 0xf9c5e5fb, 0xb6b8e96f,
+0xc4000000, 0x1c9151e2, 0x7ef9c5a3, 0x75f139de,
+0xe3c44a7f, 0x01d91679, 0x7475ca39, 0x1679e3c4,
+0xe3c403d9, 0x02da1679, 0xb9b8ca09, 0x75000000,
+0x73e9c55f, 0xf9c501f2, 0xe2c4e16f, 0x534c9159,
+0xc45d8bf8, 0xc97ef9c5, 0x3999c889, 0x8b3c75da,
+0xc139c045, 0x7d8b3575, 0x79e3c4bc, 0x8901c916,
+0xfa3999c8, 0x458b2575, 0x75c139b8, 0x79e3c41e,
+0xc403c816, 0xca1679e3, 0x74d00902, 0x00c3b813,
+0x0ceb0000, 0x0000aab8, 0xb805eb00, 0x000000c0,
+0x5b3cc483, 0xc35d5f5e, 0xc3241c8b, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000000, 0x00000000, 0x00000000,
+0001414,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x00024ee8, 0x7bc18100, 0x89000003, 0x57d231e5,
+0x53f63156, 0xec83db31, 0xc845c73c, 0x00000001,
+0xc7cc4589, 0x0002d845, 0x55890000, 0xd045c7dc,
+0x00000002, 0xc7d45d89, 0x0001e045, 0x75890000,
+0xf0818de4, 0xc5fffffe, 0xc5d276e9, 0xc5dbefe1,
+0xc4fa6ff9, 0x0c91c1e2, 0xd6f9c518, 0x758bc04d,
+0x0092bbc0, 0xf6830000, 0xc4750b01, 0x01d7850f,
+0xf8c50000, 0x8bc04d17, 0xf683c075, 0xc4750b01,
+0x01c3850f, 0xf9c50000, 0xc5c85d6f, 0xc4ea6ff9,
+0x0c91d1e2, 0xd6f9c5d8, 0x758bc04d, 0x009abbc0,
+0xf6830000, 0xc4750b02, 0x019b850f, 0xf8c50000,
+0x8bc04d17, 0xf683c075, 0xc4750b03, 0x0187850f,
+0xd9c50000, 0xc503f373, 0xbbf26ff9, 0x000000a2,
+0x91c9e2c4, 0xf9c5600c, 0x8bc04dd6, 0xf683c075,
+0xc4750b03, 0x015f850f, 0xf8c50000, 0x8bc04d17,
+0xf683c075, 0xc4750b05, 0x014b850f, 0x758b0000,
+0x6ff9c5d8, 0xf9c5d84d, 0x7d8bfa6f, 0xc1e2c4dc,
+0xc4c81491, 0xd21679e3, 0x7ef9c501, 0x01c683d0,
+0x3900d783, 0x0b850fd7, 0x39000001, 0x03850fc6,
+0x8b000001, 0xf8c5e045, 0x8bb85517, 0xc083e455,
+0xc0458901, 0x8b00d283, 0x5589b845, 0xbc558bc4,
+0x0fc45539, 0x0000dd85, 0xc0453900, 0x00d4850f,
+0xe9c50000, 0xfff091fb, 0xc9c5ffff, 0xc9c5f6ef,
+0x818df3fb, 0xffffff00, 0xe476d9c5, 0x0000b2bb,
+0x6ff9c500, 0xd1e2c4ec, 0xc4f03c91, 0xd72969e2,
+0x1779e2c4, 0xae830fd4, 0x8d000000, 0xc9c5f048,
+0xc401f173, 0x1491d9e2, 0x79e3c4b1, 0x3901d216,
+0x7ef9c5d7, 0x82850fd0, 0x39000000, 0xc57e75c6,
+0xb85517f8, 0x39bc558b, 0x458bc455, 0x396e75b8,
+0x6975c045, 0xc87ef9c5, 0xc401c083, 0xca1679e3,
+0x00d28301, 0xedefd1c5, 0xe1dbe1c5, 0x2959e2c4,
+0x59e2c4e5, 0xe2c4e529, 0xd91491d9, 0x1679e3c4,
+0xfa3901d7, 0xd67ef9c5, 0xf0393a75, 0xf8c53675,
+0x8bc04d17, 0x7d8bc075, 0x17f8c5c4, 0x558bc055,
+0xc0458bc4, 0x8301c683, 0xd73900d7, 0xdb311675,
+0x1075c639, 0xaabb13eb, 0xeb000000, 0x00c0bb0c,
+0x05eb0000, 0x0000c9bb, 0x3cc48300, 0x5e5bd889,
+0x8bc35d5f, 0x00c3240c, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0001634,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x00049be8, 0x37c18100, 0x89000005, 0x38ec83e5,
+0x31dc4589, 0x89d231c0, 0xc031e445, 0x01d845c7,
+0xc7000000, 0x0002e845, 0x55890000, 0xe045c7ec,
+0x00000002, 0x01f045c7, 0x89000000, 0xf1c5f445,
+0x818dc976, 0xffffff74, 0xdbefe1c5, 0xf128f8c5,
+0x9349e2c4, 0xfac51814, 0xd9d05511, 0xd045d9e8,
+0x8a0fe9df, 0x000002e7, 0x02e5850f, 0xe3c40000,
+0xd0551779, 0xd045d901, 0xd8dde9df, 0x02d38a0f,
+0x850f0000, 0x000002cd, 0xe3c4eed9, 0xd0551779,
+0xd045d902, 0x8a0fe9df, 0x000002c3, 0x02c1850f,
+0xe3c40000, 0xd0551779, 0xd045d903, 0x8a0fe9df,
+0x000002b3, 0x02b1850f, 0xf8c50000, 0xf9c5f928,
+0xc4d86d6f, 0x149341e2, 0x11fac5a8, 0x81d9d055,
+0xfffffff4, 0xdfd045d9, 0x0fd8dde9, 0x0002968a,
+0x94850f00, 0xc4000002, 0xd21779e3, 0xf881d901,
+0x89ffffff, 0x45d9d055, 0x0fe9dfd0, 0x00027e8a,
+0x7e850f00, 0xc4000002, 0x551779e3, 0x45d902d0,
+0x0feadfd0, 0x00027a8a, 0x7a850f00, 0xc4000002,
+0x551779e3, 0x45d903d0, 0x0feadfd0, 0x00026e8a,
+0x6e850f00, 0xc5000002, 0xc5f128f8, 0x02f573e1,
+0x9349e2c4, 0xfac55814, 0xd9d05511, 0xe9dfd045,
+0x8a0fd8dd, 0x0000025b, 0x0259850f, 0xe3c40000,
+0x01d21779, 0xfffc81d9, 0x5589ffff, 0xd045d9d0,
+0xd8dde9df, 0x02418a0f, 0x850f0000, 0x0000023f,
+0x1779e3c4, 0xd902d055, 0xe9dfd045, 0x02398a0f,
+0x850f0000, 0x00000237, 0x1779e3c4, 0xd903d055,
+0xe9dfd045, 0x02298a0f, 0x850f0000, 0x00000227,
+0x556ff9c5, 0x71e2c4e8, 0x8b901c93, 0xfac5e845,
+0x8bd05d11, 0x45d9ec55, 0x01c083d0, 0x83d04589,
+0x558900d2, 0xd06ddfd4, 0xe9dbc9d9, 0x02018a0f,
+0x850f0000, 0x00000203, 0xc4f0458b, 0x5d1779e3,
+0x558b01d0, 0x01c083f4, 0x83c84589, 0x558900d2,
+0xc86ddfcc, 0xdfd045d9, 0xe48a0fe9, 0x0f000001,
+0x0001e885, 0x79e3c400, 0x02c85d17, 0xdfc845d9,
+0xe88a0fec, 0x0f000001, 0x0001ec85, 0x79e3c400,
+0x03c85d17, 0xdfc845d9, 0xe48a0fec, 0x0f000001,
+0x0001e885, 0x76e1c500, 0xefd9c5db, 0xfbd9c5e4,
+0x28f8c5e5, 0x41e2c4fb, 0x7ca18c93, 0xc5ffffff,
+0xc84d11fa, 0xd9c845d9, 0xd9ebdce8, 0xddebdfc9,
+0xc58a0fda, 0x0f000001, 0x0001c985, 0xd045d900,
+0x1779e3c4, 0xe2de01c8, 0xd9d04589, 0xeadfd045,
+0x8a0fd9dd, 0x000001b8, 0x01ba850f, 0xe3c40000,
+0xd04d1779, 0xd045d902, 0x8a0febdf, 0x000001b5,
+0x01b7850f, 0xe3c40000, 0xd04d1779, 0xd045d903,
+0xdaddebdf, 0x01ab8a0f, 0x850f0000, 0x000001ab,
+0xf273e9c5, 0x61e2c401, 0x74518c93, 0xc5ffffff,
+0xd04d11fa, 0xdfd045d9, 0x0fd8dde9, 0x0001958a,
+0x93850f00, 0xc4000001, 0x4d1779e3, 0x45d901d0,
+0xdde9dfd0, 0x818a0fd8, 0x0f000001, 0x00017b85,
+0xc4eed900, 0x4d1779e3, 0x45d902d0, 0x0fe9dfd0,
+0x00016e8a, 0x6c850f00, 0xc4000001, 0x4d1779e3,
+0x45d903d0, 0xdde9dfd0, 0x5a8a0fd8, 0xb8000001,
+0x00000000, 0x0154840f, 0x4ae90000, 0xdd000001,
+0xdd02ebd8, 0x0092b8d8, 0x3fe90000, 0xdd000001,
+0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8, 0x0095b8d8,
+0x27e90000, 0xdd000001, 0xdd0eebd8, 0xdd0aebd8,
+0xebd8ddd8, 0xddd8dd04, 0x009ab8d8, 0x0be90000,
+0xdd000001, 0xebd8ddd8, 0xddd8dd10, 0xdd0aebd8,
+0xebd8ddd8, 0xddd8dd04, 0x009db8d8, 0xebe90000,
+0xdd000000, 0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8,
+0x00a2b8d8, 0xd3e90000, 0xdd000000, 0xdd0aebd8,
+0xdd06ebd8, 0xdd02ebd8, 0x00a5b8d8, 0xbbe90000,
+0xdd000000, 0xddd8ddd8, 0xdd1aebd8, 0xddd8ddd8,
+0xdd12ebd8, 0xddd8ddd8, 0xebd8ddd8, 0xddd8dd08,
+0xddd8ddd8, 0x00aab8d8, 0x8fe90000, 0xdd000000,
+0xddd8ddd8, 0xebd8ddd8, 0xddd8dd1c, 0xddd8ddd8,
+0xdd12ebd8, 0xddd8ddd8, 0xebd8ddd8, 0xddd8dd08,
+0xddd8ddd8, 0x00adb8d8, 0x62eb0000, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8dd18eb, 0xd8ddd8dd, 0x0eebd8dd,
+0xd8ddd8dd, 0x06ebd8dd, 0xd8ddd8dd, 0xb6b8d8dd,
+0xeb000000, 0xddd8dd39, 0xebd8ddd8, 0xddd8dd12,
+0xebd8ddd8, 0xddd8dd0a, 0xdd04ebd8, 0xb8d8ddd8,
+0x000000b9, 0xd8dd18eb, 0xd8dd02eb, 0x0000c0b8,
+0xdd0beb00, 0xdd02ebd8, 0x00c3b8d8, 0xc3c90000,
+0xc3240c8b, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0x00000000,
+0002530,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0xe8c93153, 0x000002bf, 0x03e4c381,
+0xec830000, 0xdc458934, 0x45c7c031, 0x000001d8,
+0xe845c700, 0x00000002, 0xc7ec5589, 0x0002e045,
+0x4d890000, 0xf045c7e4, 0x00000001, 0x8df44589,
+0xfffee08b, 0x76e9c5ff, 0xefe1c5d2, 0x28f9c5db,
+0xc1e2c4fa, 0xc5190c93, 0xd04d13f9, 0x45dde8d9,
+0x0fe9dfd0, 0x00020a8a, 0x08850f00, 0xc5000002,
+0xd04d17f9, 0xdfd045dd, 0x0fd8dde9, 0x0001f88a,
+0xf2850f00, 0xc5000001, 0xd8656ff9, 0xf228f9c5,
+0x93c9e2c4, 0xf9c5e10c, 0xd9d04d13, 0xffffe083,
+0xd045ddff, 0xd8dde9df, 0x01d88a0f, 0x850f0000,
+0x000001d2, 0x4d17f9c5, 0xe483d9d0, 0xddffffff,
+0xe9dfd045, 0x01b68a0f, 0x850f0000, 0x000001b4,
+0xf473e1c5, 0x28f9c503, 0xc1e2c4fa, 0xc5590c93,
+0xd04d13f9, 0xdfd045dd, 0x0fd8dde9, 0x00019c8a,
+0x96850f00, 0xc5000001, 0xd04d17f9, 0xffe883d9,
+0x45ddffff, 0xdde9dfd0, 0x7e8a0fd8, 0x0f000001,
+0x00017885, 0xe8458b00, 0x4d6ff9c5, 0x28f9c5e8,
+0xec558bf2, 0x93c9e2c4, 0xc083c91c, 0xd0458901,
+0x8900d283, 0x6ddfd455, 0x13f9c5d0, 0x45ddd05d,
+0xdbc9d9d0, 0x0fd9dde9, 0x0001478a, 0x45850f00,
+0x8b000001, 0x558bf045, 0x01c083f4, 0x83d04589,
+0x558900d2, 0xd06ddfd4, 0x5d17f9c5, 0xd045ddd0,
+0xe9dbc9d9, 0x8a0fd9dd, 0x00000120, 0x0120850f,
+0xd1c50000, 0xd1c5edef, 0xf9c5ecfb, 0xe1c5fa28,
+0xfff09b58, 0xe2c4ffff, 0xe97493c1, 0x00b2b810,
+0xe1c50000, 0xc500dec2, 0xc4ed76d1, 0xdd1779e2,
+0x010b830f, 0xe1c50000, 0xc501f173, 0xc4f228f9,
+0x1493c9e2, 0x13f9c599, 0x45ddd055, 0xdfcad9d0,
+0x0fd9ddea, 0x0000d48a, 0xd2850f00, 0xc5000000,
+0xd05517f9, 0xd9d045dd, 0xdde9dfc9, 0xc08a0fd8,
+0x0f000000, 0x0000ba85, 0x7ef9c500, 0x01c083c8,
+0x1679e3c4, 0xd28301ca, 0xefd1c500, 0xdbd9c5ed,
+0x61e2c4d9, 0xe2c4dd29, 0xc5fd2961, 0xc4f728f9,
+0x1493c9e2, 0xd04589e1, 0xdfd45589, 0xf9c5d06d,
+0xddd05513, 0xc9d9d045, 0xd8dde9df, 0x7a757c7a,
+0x4d17f8c5, 0xd0458bd0, 0x83d4558b, 0x458901c0,
+0x00d283d0, 0xdfd45589, 0xf9c5d06d, 0xddd05517,
+0xc9d9d045, 0xd8dde9df, 0x00b8507a, 0x74000000,
+0xdd47eb54, 0xdd02ebd8, 0x0092b8d8, 0x45eb0000,
+0x02ebd8dd, 0x9ab8d8dd, 0xeb000000, 0x00a2b838,
+0x31eb0000, 0x0eebd8dd, 0x0aebd8dd, 0xd8ddd8dd,
+0xd8dd04eb, 0xaab8d8dd, 0xeb000000, 0xebd8dd18,
+0xb8d8dd02, 0x000000c0, 0xc9b80beb, 0xeb000000,
+0xddd8dd04, 0x34c483d8, 0x8bc35d5b, 0x00c3241c,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x00000000, 0x00000000,
+0002014,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4i4[] = {
+0x315500eb, 0x57e589c0, 0x01b8e856, 0xc6810000,
+0x000002f2, 0xe0e48353, 0x00a0ec81, 0x5c8d0000,
+0xba406024, 0x00000009, 0x3c844489, 0xf883c229,
+0x83548908, 0x31eb75fc, 0xc5e189c0, 0x8dc976f5,
+0xfffee096, 0xefe1c5ff, 0x6ffdc5db, 0x45e2c4f9,
+0xc51a1490, 0x24147ffd, 0x01813c83, 0x0134850f,
+0x83400000, 0xf07508f8, 0x000002b8, 0x6ffdc500,
+0xc5402454, 0xc4f16ffd, 0x1c904de2, 0x7ffdc592,
+0x4439241c, 0x850ff881, 0x00000111, 0x0af88340,
+0xddc5f075, 0xb802f272, 0x00000003, 0xf96ffdc5,
+0x9045e2c4, 0xfdc5621c, 0x39241c7f, 0x0ffa4144,
+0x0000ef85, 0x02c08300, 0x7513f883, 0xc5c031ee,
+0x245c6ffd, 0x6ffdc560, 0x4de2c4f1, 0xc59a2490,
+0x24247ffd, 0x47833c8b, 0x0f813c39, 0x0000ca85,
+0xf8834000, 0xc5ed7508, 0xe0a6fadd, 0xc5ffffff,
+0xc5edefd1, 0x8deafad5, 0xffff00be, 0x6ffdc5ff,
+0x00b2b8f9, 0xe2c40000, 0xaf349045, 0xed76d5c5,
+0xe676ddc5, 0x177de2c4, 0x9f830fe5, 0xc5000000,
+0x01f372d5, 0xe2c4c031, 0x6f649075, 0x7ffdc5e0,
+0x348b2424, 0x34394683, 0x40777581, 0x7508f883,
+0xb9c031f1, 0x00000009, 0xedefd1c5, 0xcbdbedc5,
+0xcd76f5c5, 0xcd76f5c5, 0x9075e2c4, 0xfdc59224,
+0x2024647f, 0x20845c8b, 0x2940ca89, 0x6ffdc5c2,
+0x75c285ca, 0x6ffdc504, 0x7ffdc5cb, 0x0080248c,
+0x7c8b0000, 0x578d7c84, 0x75d33901, 0x08f8832c,
+0xc031d275, 0x92b828eb, 0xeb000000, 0x009ab821,
+0x1aeb0000, 0x0000a2b8, 0xb813eb00, 0x000000aa,
+0xc0b80ceb, 0xeb000000, 0x00c9b805, 0x658d0000,
+0x5f5e5bf4, 0x348bc35d, 0x0000c324, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x00000000, 0x00000000,
+0001414,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4i8[] = {
+0x895500eb, 0x535657e5, 0x000220e8, 0x53c68100,
+0x83000004, 0xec83e0e4, 0x2444c760, 0x00000120,
+0x2444c700, 0x00000430, 0x2444c700, 0x00000224,
+0x2444c700, 0x00000334, 0x2444c700, 0x00000328,
+0x2444c700, 0x00000238, 0x2444c700, 0x0000042c,
+0x2444c700, 0x0000013c, 0xe0968d00, 0x31fffffd,
+0x76f5c5c9, 0x24448dc9, 0xefe1c540, 0x6ffdc5db,
+0xcde2c4f1, 0xc51a1490, 0x24547ffd, 0xc81c8b40,
+0x0b01f383, 0x0f04c85c, 0x00016e85, 0xf9834100,
+0xb9ea7504, 0x00000002, 0xf9c5db31, 0x20246c6f,
+0xf96ffdc5, 0x90c5e2c4, 0xfdc5ea14, 0x4024547f,
+0x00cd3c8d, 0x01000000, 0xf45f39c7, 0x0143850f,
+0x4f3b0000, 0x3a850ff0, 0x83000001, 0xcf8901c1,
+0x8300d383, 0xdf0906f7, 0xe1c5d675, 0xc503f572,
+0xc4f16ffd, 0x1490cde2, 0x7ef9c55a, 0x79e3c4d1,
+0xc701d316, 0xa21c2444, 0x89000000, 0x03f783cf,
+0x850fdf09, 0x00000119, 0x5417f8c5, 0x5c8b1024,
+0xf3831024, 0x245c0b05, 0x02850f14, 0xc4000001,
+0xd2397de3, 0x7ef9c501, 0x83cf89d1, 0xe3c407f7,
+0x01d31679, 0x850fdf09, 0x000000e5, 0x5417f8c5,
+0x5c8b1024, 0xf3831024, 0x245c0b09, 0xce850f14,
+0xc5000000, 0x245c6ff9, 0x6ffdc530, 0xc5e2c4f9,
+0x31da1490, 0x7ffdc5d2, 0x8b402454, 0x8d30945c,
+0xfb89017b, 0x391ffbc1, 0x0f04d05c, 0x00008e85,
+0xd03c3900, 0x0085850f, 0x83420000, 0xdb7504fa,
+0x96fbedc5, 0xffffffe0, 0xe4efd9c5, 0xe5fad9c5,
+0xfe00968d, 0xfdc5ffff, 0xe2c4f16f, 0xe22c90cd,
+0x1c2444c7, 0x000000b2, 0x296de2c4, 0x7de2c4d5,
+0x5d73d117, 0xf372e1c5, 0xf5e2c401, 0xe09a5490,
+0xfdc5d231, 0x4024547f, 0x3094748b, 0xc1f38946,
+0x5c391ffb, 0x317504d0, 0x75d03439, 0xfa83422c,
+0x31e57504, 0x244489c0, 0xc726eb1c, 0x921c2444,
+0xeb000000, 0x2444c71c, 0x00009a1c, 0xc712eb00,
+0xaa1c2444, 0xeb000000, 0x2444c708, 0x0000c01c,
+0x24448b00, 0xf4658d1c, 0x5d5f5e5b, 0x24348bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002154,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4f4[] = {
+0x315500eb, 0x57e589c0, 0x0236e856, 0xc6810000,
+0x00000372, 0xe0e48353, 0x00c0ec81, 0x9c8d0000,
+0x00008024, 0x09ba4000, 0x89000000, 0x295c8444,
+0x08f883c2, 0xfc835489, 0x968deb75, 0xfffffee0,
+0xf5c5c031, 0x4c8dc976, 0xe1c52024, 0xfcc5dbef,
+0xe2c4f928, 0x1a149245, 0x5429fcc5, 0xe8d92024,
+0xdf8104d9, 0x0fd8dde9, 0x0001a78a, 0xa1850f00,
+0x40000001, 0x7508f883, 0x0002b8e5, 0xfdc50000,
+0x6024546f, 0xf128fcc5, 0x924de2c4, 0xfcc5921c,
+0x20245c29, 0x1c244489, 0xf88144d9, 0x1c2444db,
+0xe9dfc9d9, 0x8a0fd8dd, 0x0000016f, 0x0169850f,
+0x83400000, 0xdc750af8, 0xf272ddc5, 0x0003b802,
+0xfcc50000, 0xe2c4f928, 0x621c9245, 0x5c29fcc5,
+0x44892024, 0x44d91c24, 0x44dbfa41, 0xc9d91c24,
+0xd8dde9df, 0x01388a0f, 0x850f0000, 0x00000132,
+0x8302c083, 0xda7513f8, 0xfdc5c031, 0x80249c6f,
+0xc5000000, 0xc4f128fc, 0x24924de2, 0x29fcc59a,
+0x8b202464, 0x8947833c, 0xdb1c247c, 0xd91c2444,
+0xe9df8104, 0x8a0fd8dd, 0x000000fd, 0x00f7850f,
+0x83400000, 0xdb7508f8, 0xff00be8d, 0xd1c5ffff,
+0xd5c5edef, 0xfcc5eafa, 0xdcc5f928, 0xffe0a658,
+0xe2c4ffff, 0xaf349245, 0x0000b2b8, 0xc2dcc500,
+0xd5c500e6, 0xe2c4ed76, 0x0fe5177d, 0x0000cb83,
+0x72d5c500, 0xc03101f3, 0x9275e2c4, 0xc5e06f64,
+0x246429fc, 0x83348b20, 0x24748946, 0x2444db1c,
+0x8104d91c, 0xd8dde9df, 0x00928a0f, 0x850f0000,
+0x0000008c, 0x08f88340, 0xc031db75, 0x000009b9,
+0xefd1c500, 0xdbedc5ed, 0x76f5c5cb, 0x76f5c5cd,
+0x28fcc5f5, 0x45e2c4fe, 0xc5922492, 0x246429fc,
+0x8444d940, 0x40ca8940, 0xfdc5c229, 0xc285ca6f,
+0xfdc50475, 0xfdc5cb6f, 0xa0248c7f, 0x8b000000,
+0x009c849c, 0x538d0000, 0x24548901, 0x2444db1c,
+0xdfc9d91c, 0x7ad8dde9, 0x832c752e, 0xc17508f8,
+0x28ebc031, 0x000092b8, 0xb821eb00, 0x0000009a,
+0xa2b81aeb, 0xeb000000, 0x00aab813, 0x0ceb0000,
+0x0000c0b8, 0xb805eb00, 0x000000c9, 0x5bf4658d,
+0xc35d5f5e, 0xc324348b, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x00000000, 0x00000000, 0x00000000,
+0001614,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4f8[] = {
+0xe85500eb, 0x000002a4, 0x0004f805, 0x56e58900,
+0xe0e48353, 0xc760ec83, 0x01202444, 0xc7000000,
+0x04302444, 0xc7000000, 0x02242444, 0xc7000000,
+0x03342444, 0xc7000000, 0x03282444, 0xc7000000,
+0x02382444, 0xc7000000, 0x042c2444, 0xc7000000,
+0x013c2444, 0x8d000000, 0xfffdc090, 0xc5db31ff,
+0x8dd276ed, 0xc540244c, 0xc5dbefe1, 0xc4f228fd,
+0x0c92cde2, 0x29fdc51a, 0xd940244c, 0xd904dde8,
+0xd8dde9df, 0x01da8a0f, 0x850f0000, 0x000001d4,
+0x04fb8343, 0xf9c5e575, 0x20245c6f, 0xfa28fdc5,
+0x92c5e2c4, 0xf9c5da0c, 0x18244c13, 0xffc080d9,
+0x44ddffff, 0xe9df1824, 0x8a0fd8dd, 0x000001c5,
+0x01bf850f, 0xf9c50000, 0x18244c17, 0xffc480d9,
+0x44ddffff, 0xe9df1824, 0x018d8a0f, 0x850f0000,
+0x0000018b, 0x197de3c4, 0xf9c501c9, 0x18244c13,
+0xffc880d9, 0x44ddffff, 0xe9df1824, 0x8a0fd8dd,
+0x0000016f, 0x016d850f, 0xf9c50000, 0x18244c17,
+0x182444dd, 0xffcc80d9, 0xc0d9ffff, 0xeadfcad9,
+0x8a0fd9dd, 0x00000153, 0x0153850f, 0xd9c50000,
+0xc503f372, 0xc4f228fd, 0x0c92cde2, 0x13f9c562,
+0xdd18244c, 0xdf182444, 0x0fd9ddea, 0x00013b8a,
+0x39850f00, 0xc5000001, 0x244c17f9, 0x2444dd18,
+0xdde9df18, 0x278a0fd8, 0x0f000001, 0x00012185,
+0x7de3c400, 0xc501c919, 0x244c13f9, 0xd080d918,
+0xddffffff, 0xdf182444, 0x0fd8dde9, 0x0001018a,
+0xfb850f00, 0xc5000000, 0x244c17f9, 0xd480d918,
+0xddffffff, 0xdf182444, 0x0fd8dde9, 0x0000e18a,
+0xdb850f00, 0xc5000000, 0x24646ff9, 0x28fdc530,
+0x245c8dfa, 0xc5e2c430, 0x31e20c92, 0x29fdc5d2,
+0x8b40244c, 0x89469334, 0xdb182474, 0xdd182444,
+0xe9dfd104, 0x8a0fd8dd, 0x000000ad, 0x00a7850f,
+0x83420000, 0xdb7504fa, 0xfde0908d, 0xd1c5ffff,
+0xd1c5edef, 0xf5c5dbfa, 0xffe08858, 0xfdc5ffff,
+0xb2b8f228, 0xc4000000, 0x2c92cde2, 0x76e5c5da,
+0xc2f5c5db, 0xe2c400cd, 0x73cb177d, 0x72d9c578,
+0xc03101f4, 0x92ede2c4, 0xc5e0a24c, 0x244c29fd,
+0x83348b40, 0x8901568d, 0xdb182454, 0xdd182444,
+0xe9dfc104, 0x487ad8dd, 0x83404675, 0xe17504f8,
+0x41ebc031, 0x000092b8, 0xdd3aeb00, 0xdd16ebd8,
+0xdd12ebd8, 0xdd0eebd8, 0xdd0aebd8, 0xebd8ddd8,
+0xddd8dd04, 0x009ab8d8, 0x19eb0000, 0x02ebd8dd,
+0xa2b8d8dd, 0xeb000000, 0x00aab80c, 0x05eb0000,
+0x0000c0b8, 0xf8658d00, 0xc35d5e5b, 0xc324048b,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x00000000, 0x00000000,
+0002414,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b855c3,
+0x89000000, 0x57d231e5, 0x0001f0e8, 0x13c78100,
+0x56000003, 0xe0e48353, 0x8960ec83, 0xb91cc454,
+0x00000005, 0x4489db31, 0xc12918c4, 0x38c44c89,
+0x5c89d319, 0xc0833cc4, 0x83c68901, 0xf68300d2,
+0x75d60905, 0xf08f8dd6, 0x31fffffe, 0x76f1c5c0,
+0x24548dc9, 0xefe1c510, 0x6ff9c5db, 0x4de2c4f1,
+0xf01f9491, 0xc5fffffe, 0x24547ff9, 0x823c8310,
+0x6b850f01, 0x40000001, 0x7504f883, 0x6ffdc5f0,
+0xc520246c, 0xc4f96ff9, 0x149145e2, 0x7ef9c5a9,
+0x02fa83d2, 0x00009ab8, 0x56850f00, 0xc4000001,
+0xd21679e3, 0x03fa8301, 0x0147850f, 0xe3c40000,
+0x02d21679, 0x0f04fa83, 0x00013885, 0x79e3c400,
+0x8303d216, 0x850f05fa, 0x00000129, 0xf573e5c5,
+0x6ff9c502, 0x00a2b8f1, 0xe2c40000, 0x5914914d,
+0xd27ef9c5, 0x0f03fa83, 0x00010885, 0x79e3c400,
+0x8301d216, 0x850f05fa, 0x000000f9, 0x1679e3c4,
+0xfa8302d2, 0xea850f07, 0xc4000000, 0xd21679e3,
+0x09fa8303, 0x00db850f, 0xc0310000, 0x5c6ffdc5,
+0xf9c54024, 0xe2c4f96f, 0x99149145, 0x547ff9c5,
+0x548b1024, 0x4c8b1084, 0x5c8b40c4, 0x548944c4,
+0xd6890824, 0x831ffec1, 0x748901c1, 0xd3830c24,
+0x245c3900, 0x8e850f0c, 0x39000000, 0x86850fca,
+0x40000000, 0x7504f883, 0xfae9c5c9, 0xfffff097,
+0xefd9c5ff, 0xfbddc5e4, 0x6ff9c5e5, 0x00b2b8f1,
+0xe2c40000, 0xa7ac914d, 0xffffff00, 0xe476d9c5,
+0xd576e9c5, 0x1779e2c4, 0x8d5a73d4, 0xffff0087,
+0x73e5c5ff, 0xf9c501f3, 0xe2c4e16f, 0x5854915d,
+0xc5c031f0, 0x24547ff9, 0x84548b10, 0xc44c8b10,
+0xc45c8b40, 0xc1d78944, 0xc1831fff, 0x00d38301,
+0x1c75df39, 0x1875ca39, 0x04f88340, 0xc031db75,
+0x92b813eb, 0xeb000000, 0x00aab80c, 0x05eb0000,
+0x0000c0b8, 0xf4658d00, 0x5d5f5e5b, 0x243c8bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x00000000, 0x00000000,
+0001474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8i8[] = {
+0x315500eb, 0x02b2e8d2, 0xd6050000, 0x89000004,
+0x535657e5, 0x81e0e483, 0x0000c0ec, 0x24448900,
+0x24bc8d18, 0x00000080, 0x000001b8, 0xc4548900,
+0x0005b95c, 0xdb310000, 0x58c44489, 0x4c89c129,
+0xd319f8c7, 0xfcc75c89, 0x8901c083, 0x00d283c1,
+0x0905f183, 0x8bd675d1, 0x31182444, 0x76f5c5c9,
+0xefe1c5c9, 0x6ffdc5db, 0xe0908df9, 0x8dfffffd,
+0xc4202444, 0x1491c5e2, 0x7ffdc51a, 0x8b202454,
+0xf383c81c, 0xc85c0b01, 0xf1850f04, 0x41000001,
+0x7504f983, 0x0002b9ea, 0xdb310000, 0x546ffdc5,
+0xfdc56024, 0xe2c4f16f, 0xd21c91cd, 0x5c7ffdc5,
+0x348d2024, 0x000000cd, 0x39c60100, 0x850ff45e,
+0x000001c6, 0x0ff04e39, 0x0001bd85, 0x01c18300,
+0xd383ce89, 0x06f68300, 0xd675de09, 0xf273ddc5,
+0x6ffdc503, 0xc5e2c4f9, 0xc5621c91, 0xc4d97ef9,
+0xdb1679e3, 0x2444c701, 0x0000a21c, 0x83ce8900,
+0xde0903f6, 0x01a6850f, 0xf8c50000, 0x10245c17,
+0x10245c8b, 0x0b05f383, 0x0f14245c, 0x00018f85,
+0x7de3c400, 0xc501db39, 0x89d97ef9, 0x07f683ce,
+0x1679e3c4, 0xde0901db, 0x0172850f, 0xf8c50000,
+0x10245c17, 0x10245c8b, 0x0b09f383, 0x0f14245c,
+0x00015b85, 0xc5f63100, 0x249c6ffd, 0x00000080,
+0xf16ffdc5, 0x91cde2c4, 0xfdc5da24, 0x2024647f,
+0x8bf70c8b, 0x8304f75c, 0xd38301c1, 0xf05c3900,
+0x0d850f04, 0x39000001, 0x850ff00c, 0x00000104,
+0x04fe8346, 0x748bda75, 0xd1c51824, 0xd5c5edef,
+0x5c8beafb, 0xfdc51824, 0xddc5f96f, 0xffe0a6fb,
+0x9b8dffff, 0xfffffe00, 0x91c5e2c4, 0x44c7eb34,
+0x00b21c24, 0xe2c40000, 0xc4e6295d, 0xe1177de2,
+0x00da830f, 0xd5c50000, 0x3101f373, 0xf5e2c4f6,
+0xe0ab6491, 0x647ffdc5, 0x0c8b2024, 0xf75c8bf7,
+0x01c18304, 0x3900d383, 0x0f04f05c, 0x00009d85,
+0xf00c3900, 0x0094850f, 0x83460000, 0xda7504fe,
+0xedefd1c5, 0xcbdbedc5, 0xe2c4c031, 0xc4cd2975,
+0xcd2975e2, 0x91f5e2c4, 0x05bad224, 0xc5000000,
+0x24647ffd, 0xc4748b40, 0xc5d18940, 0x8bca6ffd,
+0x4044c47c, 0xc185c129, 0xfdc50475, 0xfdc5cb6f,
+0xa0248c7f, 0x8b000000, 0x0098c48c, 0x9c8b0000,
+0x00009cc4, 0x01c18300, 0x3900d383, 0x393975df,
+0x833575ce, 0xbd7504f8, 0x4489c031, 0x30eb1c24,
+0x1c2444c7, 0x00000092, 0x44c726eb, 0x009a1c24,
+0x1ceb0000, 0x1c2444c7, 0x000000aa, 0x44c712eb,
+0x00c01c24, 0x08eb0000, 0x1c2444c7, 0x000000c9,
+0x1c24448b, 0x5bf4658d, 0xc35d5f5e, 0xc324048b,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002354,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x0002d9e8, 0x1bc18100, 0x89000004, 0x535657e5,
+0x83e0e483, 0x44c760ec, 0x00010824, 0x5c8d0000,
+0x44894024, 0x05be0c24, 0x31000000, 0x24448bff,
+0x24742b08, 0x7efac508, 0x1b08246c, 0x830c247c,
+0x01082444, 0x6cd6f9c5, 0x748918c4, 0x7c89f8c3,
+0x748bfcc3, 0x54830824, 0x83000c24, 0x740b05f6,
+0xc2750c24, 0xc976f1c5, 0xdbefe1c5, 0xfed0918d,
+0x748dffff, 0xc0311024, 0xf128f8c5, 0x934de2c4,
+0xfed01994, 0xf8c5ffff, 0x10245429, 0x04d9e8d9,
+0xdde9df86, 0xfa8a0fd8, 0x0f000001, 0x0001f485,
+0xf8834000, 0xc5e57504, 0xc5f928f8, 0x246c6ffd,
+0x45e2c420, 0xc5aa1493, 0x245411fa, 0xd081d908,
+0xd9ffffff, 0xdf082444, 0x0fd8dde9, 0x0001e58a,
+0xdf850f00, 0xc4000001, 0xd01779e3, 0xd481d901,
+0x89ffffff, 0xd9082444, 0xdf082444, 0xa98a0fe9,
+0x0f000001, 0x0001a785, 0x79e3c400, 0xd902d017,
+0xffffd881, 0x244489ff, 0x2444d908, 0xdde9df08,
+0x8d8a0fd8, 0x0f000001, 0x00018b85, 0xdc81d900,
+0xc4ffffff, 0x541779e3, 0xd9030824, 0xdf082444,
+0x758a0fe9, 0x0f000001, 0x00017585, 0x28f8c500,
+0x73e5c5f1, 0xe2c402f5, 0x5a14934d, 0x5411fac5,
+0x44d90824, 0xeadf0824, 0x8a0fd9dd, 0x0000015d,
+0x015b850f, 0xe3c40000, 0x24541779, 0x44d90108,
+0xe9df0824, 0x8a0fd8dd, 0x00000147, 0x0141850f,
+0xe3c40000, 0x02d01779, 0xffe081d9, 0x4489ffff,
+0x44d90824, 0xe9df0824, 0x8a0fd8dd, 0x00000123,
+0x011d850f, 0x81d90000, 0xffffffe4, 0x1779e3c4,
+0x03082454, 0x082444d9, 0xd8dde9df, 0x01018a0f,
+0x850f0000, 0x000000fb, 0xf928f8c5, 0x5c6ffdc5,
+0xff314024, 0x9345e2c4, 0xf8c59a14, 0x10245429,
+0x8bfb048b, 0x8304fb54, 0x448901c0, 0xd2830824,
+0x24548900, 0x246cdf0c, 0xbe04d908, 0xd8dde9df,
+0x00c48a0f, 0x850f0000, 0x000000be, 0x04ff8347,
+0xe8c5ce75, 0xfff09158, 0xd9c5ffff, 0xddc5e4ef,
+0xf8c5e5fb, 0xe2c4f128, 0xa1ac934d, 0xfffffee0,
+0x0000b2b8, 0x76d9c500, 0xc2e8c5e4, 0xe2c400d5,
+0x0fd41779, 0x00008d83, 0xe0818d00, 0xc5fffffe,
+0x01f373e5, 0xe128f8c5, 0xe2c4c931, 0x5854935d,
+0x29f8c5f0, 0x8b102454, 0x548bcb04, 0xc08304cb,
+0x24448901, 0x00d28308, 0x0c245489, 0x08246cdf,
+0xdf8e04d9, 0x7ad8dde9, 0x41467548, 0x7504f983,
+0xebc031d6, 0x0092b841, 0x3aeb0000, 0x16ebd8dd,
+0x12ebd8dd, 0x0eebd8dd, 0x0aebd8dd, 0xd8ddd8dd,
+0xd8dd04eb, 0x9ab8d8dd, 0xeb000000, 0xebd8dd19,
+0xb8d8dd02, 0x000000a2, 0xaab80ceb, 0xeb000000,
+0x00c0b805, 0x658d0000, 0x5f5e5bf4, 0x0c8bc35d,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0x00000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x00000000, 0x00000000, 0x00000000,
+0002074,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8f8[] = {
+0x315500eb, 0x036ae8d2, 0xb6050000, 0x89000005,
+0x535657e5, 0x81e0e483, 0x0000c0ec, 0x2444c700,
+0x00000118, 0x249c8d00, 0x00000080, 0x1c245489,
+0x14245c89, 0x000005be, 0x8bff3100, 0x2b182454,
+0xc5182474, 0x24747efa, 0x245c8b18, 0x247c1b14,
+0x2444831c, 0xf9c50118, 0x58d474d6, 0xf8d37489,
+0xfcd37c89, 0x1824548b, 0x1c245483, 0x05f28300,
+0x1c24540b, 0x888dbe75, 0xfffffdc0, 0xedc5d231,
+0x5c8dd276, 0xe1c52024, 0xfdc5dbef, 0xe2c4fa28,
+0x190c93c5, 0x4c29fdc5, 0xe8d92024, 0xdfd304dd,
+0x0fd8dde9, 0x00027b8a, 0x75850f00, 0x42000002,
+0x7504fa83, 0x6ffdc5e5, 0xc560245c, 0xc4f228fd,
+0x0c93cde2, 0x13f9c5d9, 0xd918244c, 0xffffc080,
+0x2444ddff, 0xdde9df18, 0x668a0fd8, 0x0f000002,
+0x00026085, 0x17f9c500, 0xd918244c, 0xffffc480,
+0x2444ddff, 0x0fe9df18, 0x00022e8a, 0x2c850f00,
+0xc4000002, 0xc9197de3, 0x13f9c501, 0xd918244c,
+0xffffc880, 0x2444ddff, 0xdde9df18, 0x108a0fd8,
+0x0f000002, 0x00020e85, 0x17f9c500, 0xdd18244c,
+0xd9182444, 0xffffcc80, 0xd9c0d9ff, 0xddeadfca,
+0xf48a0fd9, 0x0f000001, 0x0001f485, 0x73ddc500,
+0xfdc503f3, 0xe2c4fa28, 0x610c93c5, 0x4c13f9c5,
+0x44dd1824, 0xeadf1824, 0x8a0fd9dd, 0x000001dc,
+0x01da850f, 0xf9c50000, 0x18244c17, 0x182444dd,
+0xd8dde9df, 0x01c88a0f, 0x850f0000, 0x000001c2,
+0x197de3c4, 0xf9c501c9, 0x18244c13, 0xffd080d9,
+0x44ddffff, 0xe9df1824, 0x8a0fd8dd, 0x000001a2,
+0x019c850f, 0xf9c50000, 0x18244c17, 0xffd480d9,
+0x44ddffff, 0xe9df1824, 0x8a0fd8dd, 0x00000182,
+0x017c850f, 0xd2310000, 0xa46ffdc5, 0x00008024,
+0x28fdc500, 0xcde2c4f2, 0xc5e10c93, 0x244c29fd,
+0x247c8b20, 0xd7348b14, 0x04d77c8b, 0x8901c683,
+0x83182474, 0x7c8900d7, 0x6cdf1c24, 0x04dd1824,
+0xdde9dfd3, 0x3e8a0fd8, 0x0f000001, 0x00013885,
+0xfa834200, 0x8dca7504, 0xfffde090, 0xefd1c5ff,
+0xfbd5c5ed, 0x58f5c5eb, 0xffffe088, 0x28fdc5ff,
+0x00b2b8fa, 0xe2c40000, 0xea3493c5, 0xed76d5c5,
+0xcec2f5c5, 0x7de2c400, 0x830fcd17, 0x0000010c,
+0xf473f5c5, 0xc4ff3101, 0x6c93ede2, 0xfdc5e08a,
+0x20246c29, 0x1424448b, 0x04f8548b, 0x83f8048b,
+0x448901c0, 0xd2831824, 0x24548900, 0x246cdf1c,
+0xfb04dd18, 0xd8dde9df, 0x00c28a0f, 0x850f0000,
+0x000000bc, 0x04ff8347, 0xe9c5ca75, 0xe5c5d2ef,
+0x05bbccdb, 0xc4000000, 0xca2975e2, 0x2975e2c4,
+0x28fdc5f2, 0xc5e2c4fe, 0x31d92c93, 0x29fdc5c9,
+0xdd40246c, 0x8940cc44, 0xc82941d8, 0xcb6ffdc5,
+0x0475c885, 0xcc6ffdc5, 0x8c7ffdc5, 0x0000a024,
+0xcc848b00, 0x00000098, 0x9ccc948b, 0x83000000,
+0x448901c0, 0xd2831824, 0x24548900, 0x246cdf1c,
+0xdfc9d918, 0x7ad8dde9, 0x834c754e, 0xb37504f9,
+0x48ebc031, 0x000092b8, 0xdd41eb00, 0xdd16ebd8,
+0xdd12ebd8, 0xdd0eebd8, 0xdd0aebd8, 0xebd8ddd8,
+0xddd8dd04, 0x009ab8d8, 0x20eb0000, 0x02ebd8dd,
+0xa2b8d8dd, 0xeb000000, 0x00aab813, 0x0ceb0000,
+0x0000c0b8, 0xb805eb00, 0x000000c9, 0x5bf4658d,
+0xc35d5f5e, 0xc324048b, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x00000000, 0x00000000,
+0002714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4i4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xd0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8d845, 0x48c00000, 0x4802e0c1, 0xb8e04589,
+0x80000001, 0x48c00148, 0xc5e84589, 0xc5c976f1,
+0x48dbefe1, 0x31b0758d, 0x158d48c0, 0x000001d0,
+0xf96ff9c5, 0x9041e2c4, 0xf9c51a14, 0x83b0557f,
+0x0f01863c, 0x00019685, 0xc0ff4800, 0x04f88348,
+0xf9c5ed75, 0xc5d0556f, 0xb8f16ff9, 0x0000009a,
+0x9049e2c4, 0xf9c5921c, 0xf983d97e, 0x86850f02,
+0xc4000001, 0xd91679e3, 0x03f98301, 0x0177850f,
+0xe3c40000, 0x02d91679, 0x0f04f983, 0x00016885,
+0x79e3c400, 0x8303d916, 0x850f05f9, 0x00000159,
+0xf272d9c5, 0x6ff9c502, 0x00a2b8f9, 0xe2c40000,
+0x621c9041, 0xd97ef9c5, 0x0f03f983, 0x00013885,
+0x79e3c400, 0x8301d916, 0x850f05f9, 0x00000129,
+0x1679e3c4, 0xf98302d9, 0x1a850f07, 0xc4000001,
+0xd91679e3, 0x09f98303, 0x010b850f, 0xf9c50000,
+0xc5e0656f, 0x31f16ff9, 0x7d8d48c0, 0x49e2c4e0,
+0xc5a21c90, 0xb05d7ff9, 0xff380c8b, 0x060c39c1,
+0x00d0850f, 0x83480000, 0x834804c0, 0xe87510f8,
+0xedefd1c5, 0xe5058d48, 0xc5000000, 0xc5f96ff9,
+0xc4eafad1, 0x349041e2, 0x0001b8a8, 0xf9c50000,
+0xb2b8f86e, 0xc5000000, 0x00ef70f9, 0xddfae1c5,
+0xed76d1c5, 0xde76e1c5, 0x1779e2c4, 0x96830fdd,
+0xc5000000, 0x01f472d1, 0xe2c4c031, 0x6a1c9071,
+0x5d7ff9c5, 0x070c8bb0, 0x0c39c1ff, 0x486e7506,
+0x4804c083, 0x7510f883, 0xefd1c5ec, 0xdbe9c5ed,
+0x0001b8cc, 0x05b90000, 0xc5000000, 0xc5cd76f1,
+0xc4cd76f1, 0x1c9071e2, 0x7ff9c592, 0xca89c05d,
+0xbc85748b, 0xca6ff9c5, 0xc285c229, 0xf9c50475,
+0xf9c5cc6f, 0x8bf04d7f, 0x48ec857c, 0x578dc0ff,
+0x75d63901, 0xf883481f, 0x31d37505, 0xb81aebc0,
+0x00000092, 0xaab813eb, 0xeb000000, 0x00c0b80c,
+0x05eb0000, 0x0000c9b8, 0x00c35d00, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0001240,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0x48c976f1,
+0x013a3d8d, 0xe1c50000, 0x92b8dbef, 0xc5000000,
+0xc4f16ff9, 0x1490c9e2, 0xf9e1c41f, 0xff48d27e,
+0x16850fca, 0xc4000001, 0xd216f9e3, 0xfa834801,
+0x06850f01, 0xc5000001, 0xe06d6ff9, 0xf96ff9c5,
+0x00009ab8, 0xc1e2c400, 0xc4ef1490, 0xd17ef9e1,
+0x02f98348, 0x00e3850f, 0xe3c40000, 0x01d116f9,
+0x03f98348, 0x00d3850f, 0xd9c50000, 0xc503f572,
+0xb8f16ff9, 0x000000a2, 0x90c9e2c4, 0xe1c46714,
+0x48d17ef9, 0x0f03f983, 0x0000b085, 0xf9e3c400,
+0x4801d116, 0x0f05f983, 0x0000a085, 0xf0458b00,
+0x656ff9c5, 0x6ff9c5f0, 0xc1e2c4f9, 0x8de71490,
+0xaab80170, 0x48000000, 0xe1c4f663, 0x48d17ef9,
+0x7975ce39, 0xc4f4458b, 0xd016f9c3, 0x01488d01,
+0x0000aab8, 0xc9634800, 0x75c1394c, 0xfae1c560,
+0x478d48dd, 0x6ff9c510, 0xc9e2c4f1, 0xc4d82c90,
+0xfa6ef9e1, 0x0000b2b8, 0x6cc1c500, 0xfbe9c5df,
+0x69e2c4d3, 0xe2c4d529, 0x73d11779, 0x72d9c530,
+0xc0b801f4, 0xc4000000, 0x1490f1e2, 0xf9e1c4a7,
+0x3948d27e, 0xc41675d6, 0xd016f9e3, 0x00c0ba01,
+0x39480000, 0x0000b8c1, 0x450f0000, 0x00c35dc2,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0001200,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4f4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xd0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8d845, 0x48c00000, 0x4802e0c1, 0xb8e04589,
+0x80000001, 0x48c00148, 0xc5e84589, 0xc5e476d9,
+0x48d2efe9, 0x31b07d8d, 0x158d48c0, 0x00000250,
+0xfc28f8c5, 0x9241e2c4, 0xf8c5120c, 0xc5b04d29,
+0xb90d10fa, 0xc5000002, 0x870c2ef8, 0x02008a0f,
+0x850f0000, 0x000001fa, 0x48c0ff48, 0x7504f883,
+0x6ff9c5e6, 0xf8c5d04d, 0xe2c4f428, 0x8a149249,
+0x152ef8c5, 0x0000028c, 0x01db8a0f, 0x850f0000,
+0x000001d5, 0xdac6e8c5, 0x2ef8c555, 0x0002771d,
+0xc28a0f00, 0x0f000001, 0x0001bc85, 0x15e8c500,
+0x2ef8c5da, 0x0002631d, 0xaa8a0f00, 0x0f000001,
+0x0001a485, 0xc6e8c500, 0xf8c5ffd2, 0x024e152e,
+0x8a0f0000, 0x00000191, 0x018b850f, 0xe1c50000,
+0xc502f172, 0xc4fc28f8, 0x149241e2, 0x2ef8c55a,
+0x00022315, 0x758a0f00, 0x0f000001, 0x00016f85,
+0xc6e8c500, 0xf8c555da, 0x02121d2e, 0x8a0f0000,
+0x0000015c, 0x0156850f, 0xe8c50000, 0xf8c5da15,
+0x01fe1d2e, 0x8a0f0000, 0x00000144, 0x013e850f,
+0xe8c50000, 0xc5ffd2c6, 0xe9152ef8, 0x0f000001,
+0x00012b8a, 0x25850f00, 0xc5000001, 0xe06d6ff9,
+0xf428f8c5, 0x8d48c031, 0xe2c4e075, 0xaa149249,
+0x5529f8c5, 0x300c8bb0, 0xe2c5c1ff, 0xf8c5d92a,
+0x0f071c2e, 0x0000fe8a, 0xf8850f00, 0x48000000,
+0x4804c083, 0x7510f883, 0xefe1c5dc, 0x058d48db,
+0x0000010c, 0xfc28f8c5, 0xd9fae1c5, 0x9241e2c4,
+0xb2b89834, 0xc4000000, 0x1d1879e2, 0x0000017c,
+0xd358e8c5, 0xdb76e1c5, 0xd6c2e8c5, 0x79e2c400,
+0x830fd317, 0x000000c2, 0xf572e9c5, 0xc4c03101,
+0x1c9259e2, 0x29f8c552, 0x0c8bb05d, 0xc5c1ff06,
+0xc5d12aea, 0x07142ef8, 0x00908a0f, 0x850f0000,
+0x0000008a, 0x04c08348, 0x10f88348, 0xd9c5dc75,
+0xf1c5e4ef, 0x01b8d5db, 0xb9000000, 0x00000005,
+0xd476e9c5, 0xf476e9c5, 0xfe28f8c5, 0x9241e2c4,
+0xf8c58a1c, 0x89c05d29, 0x10fac5ca, 0xc5bc855c,
+0x29d16ff9, 0x75c285c2, 0x6ff9c504, 0x7ff9c5d5,
+0x748bf055, 0xff48ec85, 0x01568dc0, 0xd22aeac5,
+0xda2ef8c5, 0x2d752f7a, 0x05f88348, 0xc031c975,
+0x92b828eb, 0xeb000000, 0x009ab821, 0x1aeb0000,
+0x0000a2b8, 0xb813eb00, 0x000000aa, 0xc0b80ceb,
+0xeb000000, 0x00c9b805, 0xc35d0000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0001500,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0xc5c976f1,
+0x48dbefe1, 0x0176158d, 0xf9c50000, 0xe2c4f128,
+0x1a1492c9, 0x1d10fbc5, 0x00000264, 0xd32ef9c5,
+0x012a8a0f, 0x850f0000, 0x00000124, 0xd215e9c5,
+0xd32ef9c5, 0x01168a0f, 0x850f0000, 0x00000110,
+0x6d6ff9c5, 0x28f9c5e0, 0xc1e2c4f9, 0xc5ea1492,
+0x31152ef9, 0x0f000002, 0x0000fa8a, 0xf4850f00,
+0xc5000000, 0x251d10fb, 0xc5000002, 0xc5d215e9,
+0x0fd32ef9, 0x0000de8a, 0xd8850f00, 0xc5000000,
+0x03f572d9, 0xf128f9c5, 0x92c9e2c4, 0xf9c56214,
+0x8a0fd32e, 0x000000c6, 0x00c0850f, 0xe9c50000,
+0xf9c5d215, 0x01ee152e, 0x8a0f0000, 0x000000ae,
+0x00a8850f, 0x458b0000, 0x6ff9c5f0, 0xf9c5f05d,
+0xe2c4f928, 0xda1492c1, 0xc3c5c0ff, 0xf9c5f82a,
+0x8a0ffa2e, 0x0000008d, 0x0087850f, 0x458b0000,
+0x15e9c5f4, 0xc5c0ffe2, 0xc5f02acb, 0x7af42ef9,
+0xc5727574, 0x48e4efd9, 0xc510428d, 0xc5c12879,
+0xc4e5fad9, 0x2c92b9e2, 0x00b2b8e0, 0xfbc50000,
+0x018a2512, 0xe9c50000, 0xd9c5d458, 0xe9c5e476,
+0xc400d5c2, 0xd41779e2, 0xe1c54773, 0xc401f372,
+0x1492f1e2, 0x2ef9c59a, 0x75317afa, 0x15e9c52f,
+0x2ef9c5d2, 0xb8257af2, 0x00000000, 0x1ceb2374,
+0x000092b8, 0xb81aeb00, 0x0000009a, 0xa2b813eb,
+0xeb000000, 0x00aab80c, 0x05eb0000, 0x0000c0b8,
+0x00c35d00, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000,
+0001350,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8i4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xf1c50000, 0x8d48c976, 0x0001cf15,
+0xefe1c500, 0x0092b8db, 0xf9c50000, 0xe2c4f16f,
+0x1a149149, 0xd17ef9c5, 0x850fc9ff, 0x000001aa,
+0x1679e3c4, 0xc9ff01d1, 0x019c850f, 0xe3c40000,
+0x02d61679, 0x1679e3c4, 0x95b803d1, 0x09000000,
+0x83850fce, 0xc5000001, 0xe06d6ff9, 0xf96ff9c5,
+0x00009ab8, 0x41e2c400, 0xc5aa1491, 0x83d17ef9,
+0x850f02f9, 0x00000162, 0x1679e3c4, 0xf98301d1,
+0x53850f03, 0xc4000001, 0xd61679e3, 0x79e3c402,
+0xb803d116, 0x0000009d, 0x850fce09, 0x0000013a,
+0xf573e1c5, 0x6ff9c502, 0x00a2b8f1, 0xe2c40000,
+0x5a149149, 0xd17ef9c5, 0x0f03f983, 0x00011985,
+0x79e3c400, 0x8301d116, 0x850f05f9, 0x0000010a,
+0x1679e3c4, 0xe3c402d6, 0x03d11679, 0x0000a5b8,
+0x0fce0900, 0x0000f185, 0x6ff9c500, 0xf9c5f05d,
+0x8b48f96f, 0xe2c4f045, 0x9a149141, 0x01708d48,
+0x0000aab8, 0x79c1c400, 0x6349d07e, 0xf13948c8,
+0x00c4850f, 0x8b480000, 0xe3c4f845, 0x01d71679,
+0x48cf634c, 0xb801488d, 0x000000aa, 0x0fc93949,
+0x0000a585, 0x79c3c400, 0xc403d216, 0xd11679e3,
+0x00adb802, 0x09410000, 0x8b850fca, 0xc5000000,
+0x48e4efd9, 0x4108428d, 0xd9c5c8ff, 0xf9c5e5fb,
+0xe2c4e96f, 0xa0149151, 0x0000b6b8, 0x7ef9c500,
+0xc83941d1, 0xcfff6475, 0x1679e3c4, 0xcf3901d1,
+0xe3c45875, 0x03d71679, 0x1679e3c4, 0xb9b802d1,
+0x09000000, 0xc54375cf, 0x01f373e1, 0xe16ff9c5,
+0x0000c0b8, 0x59e2c400, 0xc55a0c91, 0x48ca7ef9,
+0x3948d263, 0xc42375f2, 0xca1679e3, 0xd2634801,
+0x75ca394c, 0x79e3c415, 0xc403c816, 0xca1679e3,
+0x74d00902, 0x00c3b805, 0xc35d0000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0001200,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8i8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0x8d48d276, 0x00018f15,
+0xefd9c500, 0x0092b8e4, 0xf9c50000, 0xe2c4fa6f,
+0x220c91c1, 0x7ef9e1c4, 0xc9ff48c9, 0x0163850f,
+0xe3c40000, 0x01c916f9, 0x01f98348, 0x0153850f,
+0xf9c50000, 0xc5e06d6f, 0xb8f26ff9, 0x0000009a,
+0x91c9e2c4, 0xe1c4ea0c, 0x48ce7ef9, 0x0f02fe83,
+0x00013085, 0xf9e3c400, 0x4801ce16, 0x0f03fe83,
+0x00012085, 0x73e1c500, 0xf9c503f5, 0xa2b8fa6f,
+0xc4000000, 0x0c91c1e2, 0xf9e1c45a, 0x8348ce7e,
+0x850f03fe, 0x000000fd, 0x16f9e3c4, 0x834801ce,
+0x850f05fe, 0x000000ed, 0x4d6ff9c5, 0x458b48f0,
+0x6ff9c5f0, 0xc9e2c4f2, 0x48ca1c91, 0xb801788d,
+0x000000aa, 0x7ef9e1c4, 0xf73948de, 0x00c3850f,
+0x8b480000, 0xc3c4f845, 0x01d816f9, 0x01708d48,
+0x0000aab8, 0xc6394c00, 0x00a7850f, 0xd9c50000,
+0x8d48e5fb, 0xf9c51042, 0xe2c4fa6f, 0xe03491c1,
+0x6ef9e1c4, 0x00b2b8f9, 0xc1c50000, 0xe1c5e76c,
+0xe2c4dcfb, 0xc4de2961, 0xda1779e2, 0xe1c57773,
+0xc501f173, 0xb8f26ff9, 0x000000c0, 0x91c9e2c4,
+0xe1c49a14, 0x48d17ef9, 0x5975cf39, 0x16f9e3c4,
+0x394801d1, 0xc54e75ce, 0xc5e4efd9, 0xb8d9dbd1,
+0x000000c9, 0x2961e2c4, 0x61e2c4dc, 0xe2c4dc29,
+0xea1491e1, 0x7ef9e1c4, 0xc2ff48ca, 0x7ef9e1c4,
+0xca3948d1, 0xe3c41f75, 0x01c816f9, 0x16f9e3c4,
+0xff4801d2, 0xd03948c0, 0x000000b8, 0x00c9ba00,
+0x450f0000, 0x00c35dc2, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0001300,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8f4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0xe1c5d276, 0x8d48dbef,
+0x0002cb05, 0x28f8c500, 0x41e2c4fa, 0xc5180c93,
+0x391d10fa, 0xc5000003, 0x0fcb2ef8, 0x0002538a,
+0x4d850f00, 0xc5000002, 0x55e1c6f0, 0xe32ef8c5,
+0x023e8a0f, 0x850f0000, 0x00000238, 0xe115f0c5,
+0xdb57e0c5, 0xe32ef8c5, 0x022d8a0f, 0x850f0000,
+0x00000227, 0xc9c6f0c5, 0x2ef8c5ff, 0x188a0fcb,
+0x0f000002, 0x00021285, 0x6ff9c500, 0xf8c5e06d,
+0xe2c4fa28, 0xa80c9341, 0x0d2ef8c5, 0x000002d4,
+0x01fc8a0f, 0x850f0000, 0x000001f6, 0xd9c6f0c5,
+0x2ef8c555, 0x0002bf1d, 0xe38a0f00, 0x0f000001,
+0x0001dd85, 0x15f0c500, 0x57e0c5e1, 0x2ef8c5db,
+0xd28a0fe3, 0x0f000001, 0x0001cc85, 0xc6f0c500,
+0xf8c5ffc9, 0x8a0fcb2e, 0x000001bd, 0x01b7850f,
+0xe1c50000, 0xc502f573, 0xc4fa28f8, 0x0c9341e2,
+0x2ef8c558, 0x00026f0d, 0xa18a0f00, 0x0f000001,
+0x00019b85, 0xc6f0c500, 0xf8c555d9, 0x025a1d2e,
+0x8a0f0000, 0x00000188, 0x0182850f, 0xf0c50000,
+0xc8c5d915, 0xf8c5f657, 0x8a0fde2e, 0x00000177,
+0x0171850f, 0xf0c50000, 0xc5ffc9c6, 0x0fce2ef8,
+0x0001628a, 0x5c850f00, 0xc5000001, 0xf05d6ff9,
+0x9369e2c4, 0x8b48980c, 0xf8c5f045, 0xff48e128,
+0xba61c4c0, 0xc1c4c02a, 0x0fc82e78, 0x00013d8a,
+0x37850f00, 0x48000001, 0xc5f8458b, 0x55d1c6f0,
+0xc4c0ff48, 0xf82ac2e1, 0xd72ef8c5, 0x011c8a0f,
+0x850f0000, 0x00000116, 0xc91570c5, 0xce2e78c5,
+0x010f8a0f, 0x850f0000, 0x00000109, 0xc9c6f0c5,
+0x2ef8c5ff, 0xfa8a0fce, 0x0f000000, 0x0000f485,
+0x3141c400, 0x8d48c9ef, 0x00011b05, 0xfb31c500,
+0x76d1c5cd, 0x2878c5ed, 0x21a2c4dd, 0xc5880c93,
+0x790d107a, 0xc4000001, 0xe15c5ac1, 0xcc2ef8c5,
+0x00c68a0f, 0x850f0000, 0x000000c0, 0x5c6ac1c4,
+0xc6f0c5d1, 0xf8c555e1, 0x8a0fe22e, 0x000000ac,
+0x00a6850f, 0xf0c50000, 0xf8c5d115, 0x8a0fd62e,
+0x0000009f, 0x0099850f, 0xf0c50000, 0xc5ffc9c6,
+0x0fce2ef8, 0x00008a8a, 0x84850f00, 0x48000000,
+0xc508e883, 0x01f373e1, 0x9351e2c4, 0xc1c4580c,
+0x7ac82e78, 0xc5737575, 0x55d1c6f0, 0xd72ef8c5,
+0x6675687a, 0xd915f0c5, 0xde2ef8c5, 0x6175637a,
+0xc9c6f0c5, 0x2ef8c5ff, 0xb8567ace, 0x00000000,
+0x4deb5474, 0x000092b8, 0xb84beb00, 0x00000095,
+0x9ab844eb, 0xeb000000, 0x009db83d, 0x36eb0000,
+0x0000a2b8, 0xb82feb00, 0x000000a5, 0xaab828eb,
+0xeb000000, 0x00adb821, 0x1aeb0000, 0x0000b6b8,
+0xb813eb00, 0x000000b9, 0xc0b80ceb, 0xeb000000,
+0x00c3b805, 0xc35d0000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40a00000,
+0001620,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8f8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0xe1c5d276, 0x8d48dbef,
+0x0001eb15, 0x28f9c500, 0xc9e2c4f2, 0xc51a0c93,
+0xd91d10fb, 0xc5000002, 0x0fcb2ef9, 0x00018c8a,
+0x86850f00, 0xc5000001, 0xc5c915f1, 0x0fcb2ef9,
+0x0001788a, 0x72850f00, 0xc5000001, 0xe0656ff9,
+0xfa28f9c5, 0x93c1e2c4, 0xf9c5e20c, 0x02a60d2e,
+0x8a0f0000, 0x0000015c, 0x0156850f, 0xfbc50000,
+0x029a1d10, 0xf1c50000, 0xf9c5c915, 0x8a0fcb2e,
+0x00000140, 0x013a850f, 0xd1c50000, 0xc503f473,
+0xc4f228f9, 0x0c93c9e2, 0x2ef9c56a, 0x288a0fcb,
+0x0f000001, 0x00012285, 0x15f1c500, 0x2ef9c5c9,
+0x0002630d, 0x108a0f00, 0x0f000001, 0x00010a85,
+0x458b4800, 0x6ff9c5f0, 0xf9c5f04d, 0xe2c4fa28,
+0xca1c93c1, 0xc4c0ff48, 0xf82ac3e1, 0xfb2ef9c5,
+0x00ec8a0f, 0x850f0000, 0x000000e6, 0xf8458b48,
+0xeb15e1c5, 0xc4c0ff48, 0xf02acbe1, 0xf52ef9c5,
+0x00cc8a0f, 0x850f0000, 0x000000c6, 0xedefd1c5,
+0x10428d48, 0xca2879c5, 0xecfbd1c5, 0x93b162c4,
+0xb2b8e804, 0xc5000000, 0xf12d12fb, 0xc5000001,
+0xc5dd58e1, 0xc4ed76d1, 0xd8c261c1, 0x79e2c400,
+0x830fdd17, 0x0000009d, 0xf173e1c5, 0x28f9c501,
+0xd1e2c4ea, 0xc59a1493, 0x7afa2ef9, 0xc57a757c,
+0xc5da15e9, 0x7af32ef9, 0xc56e7570, 0xc5d9dbd9,
+0xc4edefd1, 0xc87ef9e1, 0x2961e2c4, 0xc0ff48dd,
+0x2961e2c4, 0x28f9c5f5, 0xc1e2c4fe, 0xc4e21493,
+0xe02adbe1, 0xe22ef9c5, 0x4475467a, 0x16f9e3c4,
+0xe9c501c8, 0xff48d215, 0xf3e1c4c0, 0xf9c5c82a,
+0x2c7aca2e, 0x000000b8, 0xeb2a7400, 0x0092b823,
+0x21eb0000, 0x00009ab8, 0xb81aeb00, 0x000000a2,
+0xaab813eb, 0xeb000000, 0x00c0b80c, 0x05eb0000,
+0x0000c9b8, 0x00c35d00, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000,
+0001510,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4i4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x24748d48, 0x89ca89e8,
+0x29c48444, 0x865489c2, 0xc0ff48fc, 0x09f88348,
+0xf5c5eb75, 0xe1c5c976, 0x8d48dbef, 0x3188247c,
+0x158d48c0, 0x000001b8, 0xf96ffdc5, 0x9045e2c4,
+0xfdc51a14, 0x8824547f, 0x01873c83, 0x0159850f,
+0xff480000, 0xf88348c0, 0xc5ed7508, 0x24546ffd,
+0x6ffdc5c8, 0xc4c031f1, 0x1c904de2, 0x7ffdc592,
+0x8d88245c, 0x0c390248, 0x33850f87, 0x48000001,
+0x8348c0ff, 0xeb7508f8, 0xf272ddc5, 0x6ffdc502,
+0xf98948f9, 0x000003b8, 0x45e2c400, 0xc5621c90,
+0x245c7ffd, 0x0f013988, 0x00010c85, 0x02c08300,
+0x04c18348, 0x7513f883, 0x6ffdc5ec, 0xc5e82464,
+0x31f16ffd, 0x4de2c4c0, 0xc5a21c90, 0x245c7ffd,
+0x060c8b88, 0x0c39c1ff, 0xe1850f07, 0x48000000,
+0x4804c083, 0x7520f883, 0xefd1c5e8, 0x058d48ed,
+0x0000011c, 0xf96ffdc5, 0xeafad5c5, 0x9045e2c4,
+0x01b8a834, 0xc5000000, 0xb8e86ef9, 0x000000b2,
+0x587de2c4, 0xfae5c5ed, 0x76d5c5dd, 0x76e5c5ed,
+0x7de2c4de, 0x830fdd17, 0x000000a7, 0xf472d5c5,
+0xc4c03101, 0x1c9075e2, 0x7ffdc56a, 0x8b88245c,
+0xc1ff060c, 0x75070c39, 0xc083487e, 0xf8834804,
+0xc5ec7520, 0xc5edefd1, 0xb8ccdbed, 0x00000001,
+0x000009b9, 0x76f5c500, 0x76f5c5cd, 0x75e2c4cd,
+0xc5921c90, 0x245c7ffd, 0x8bca89a8, 0xc5a48474,
+0x29ca6ffd, 0x75c285c2, 0x6ffdc504, 0x7ffdc5cc,
+0x8b08244c, 0x4804847c, 0x578dc0ff, 0x75d63901,
+0xf883482d, 0x31d27509, 0xb828ebc0, 0x00000092,
+0x9ab821eb, 0xeb000000, 0x00a2b81a, 0x13eb0000,
+0x0000aab8, 0xb80ceb00, 0x000000c0, 0xc9b805eb,
+0xc9000000, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0001400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0xc5c976f5, 0x48dbefe1, 0xe024748d,
+0x8d48c031, 0x0001a715, 0x6ffdc500, 0xcde2c4f1,
+0xc51a1490, 0x24547ffd, 0x3c8348e0, 0x850f01c6,
+0x00000159, 0x48c0ff48, 0x7504f883, 0x6ff9c5ec,
+0xc5c0246c, 0xb8f96ffd, 0x0000009a, 0x90c5e2c4,
+0xe1c4ea14, 0x48d17ef9, 0x0f02f983, 0x00013f85,
+0xf9e3c400, 0x4801d116, 0x0f03f983, 0x00012f85,
+0x7de3c400, 0xc401d239, 0xd17ef9e1, 0x04f98348,
+0x011a850f, 0xe3c40000, 0x01d116f9, 0x05f98348,
+0x010a850f, 0xe1c50000, 0xc503f572, 0xb8f16ffd,
+0x000000a2, 0x90cde2c4, 0xe1c45a14, 0x48d17ef9,
+0x0f03f983, 0x0000e785, 0xf9e3c400, 0x4801d116,
+0x0f05f983, 0x0000d785, 0x7de3c400, 0xc401d239,
+0xd17ef9e1, 0x07f98348, 0x00c2850f, 0xe3c40000,
+0x01d116f9, 0x09f98348, 0x00b2850f, 0xf9c50000,
+0xd0245c6f, 0xf96ffdc5, 0x8d48c031, 0xc4d0247c,
+0x1490c5e2, 0x7ffdc5da, 0x8be02454, 0xc1ff870c,
+0x48c96348, 0x75c60c39, 0xc0ff487b, 0x04f88348,
+0xd9c5e975, 0x8d48e4ef, 0x0000b305, 0x6ffdc500,
+0xfad9c5f1, 0xcde2c4e5, 0xb8e02c90, 0x00000001,
+0x6ef9e1c4, 0x00b2b8f8, 0xe2c40000, 0xc5e7597d,
+0xc4d4fbed, 0xd5296de2, 0x177de2c4, 0xc54173d1,
+0x01f372e1, 0xe2c4c031, 0x9a1490f5, 0x547ffdc5,
+0x148be024, 0x48c2ff87, 0x3948d263, 0x1b75c614,
+0x48c0ff48, 0x7504f883, 0xebc031e9, 0x0092b813,
+0x0ceb0000, 0x0000aab8, 0xb805eb00, 0x000000c0,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0002000,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x247c8d48, 0x89ca89e8,
+0x29c48444, 0x875489c2, 0xc0ff48fc, 0x09f88348,
+0xf5c5eb75, 0xe1c5c976, 0x8d48dbef, 0x31882474,
+0x158d48c0, 0x000001f8, 0xf928fcc5, 0x9245e2c4,
+0xfcc51a14, 0x88245429, 0x1510fac5, 0x000002e0,
+0x142ef8c5, 0x9d8a0f86, 0x0f000001, 0x00019785,
+0xc0ff4800, 0x08f88348, 0xfdc5e675, 0xc824546f,
+0xf128fcc5, 0xe2c4c031, 0x921c924d, 0x5c29fcc5,
+0x488d8824, 0x2ae2c502, 0x2ef8c5d9, 0x8a0f861c,
+0x0000016b, 0x0165850f, 0xff480000, 0xf88348c0,
+0xc5df7508, 0x02f272dd, 0xf928fcc5, 0xb8f18948,
+0x00000003, 0x9245e2c4, 0xfcc5621c, 0x88245c29,
+0xd82ae2c5, 0x192ef8c5, 0x01388a0f, 0x850f0000,
+0x00000132, 0x4802c083, 0x8304c183, 0xe07513f8,
+0x646ffdc5, 0xfcc5e824, 0xc031f128, 0x924de2c4,
+0xfcc5a21c, 0x88245c29, 0xff070c8b, 0x2ad2c5c1,
+0x2ef8c5e9, 0x8a0f062c, 0x00000101, 0x00fb850f,
+0x83480000, 0x834804c0, 0xdc7520f8, 0xedefd1c5,
+0x29058d48, 0xc5000001, 0xc5f928fc, 0xc4eafad5,
+0x349245e2, 0x00b2b8a8, 0xe2c40000, 0xf12d187d,
+0xc5000001, 0xc5dd58e4, 0xc5ed76d5, 0x00dec2e4,
+0x177de2c4, 0xc5830fdd, 0xc5000000, 0x01f472d5,
+0xe2c4c031, 0x6a1c9275, 0x5c29fcc5, 0x0c8b8824,
+0xc5c1ff07, 0xc5c92af2, 0x060c2ef8, 0x00928a0f,
+0x850f0000, 0x0000008c, 0x04c08348, 0x20f88348,
+0xd1c5dc75, 0xedc5edef, 0x01b8ccdb, 0xb9000000,
+0x00000009, 0xcd76f5c5, 0xf576f5c5, 0xfe28fcc5,
+0x9245e2c4, 0xfcc5921c, 0xa8245c29, 0xfac5ca89,
+0xa4845c10, 0xca6ffdc5, 0xc285c229, 0xfdc50475,
+0xfdc5cc6f, 0x08244c7f, 0x04847c8b, 0x8dc0ff48,
+0xf2c50157, 0xf8c5ca2a, 0x2f7ad92e, 0x83482d75,
+0xc87509f8, 0x28ebc031, 0x000092b8, 0xb821eb00,
+0x0000009a, 0xa2b81aeb, 0xeb000000, 0x00aab813,
+0x0ceb0000, 0x0000c0b8, 0xb805eb00, 0x000000c9,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0xbf800000,
+0001510,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0xc5c976f5, 0x48dbefe1, 0xe0247c8d,
+0x8d48c031, 0x0001e715, 0x28fdc500, 0xc5e2c4f9,
+0xc51a1492, 0x245429fd, 0x10fbc5e0, 0x0003cf15,
+0x2ef9c500, 0x8a0fc714, 0x00000198, 0x0192850f,
+0xff480000, 0xf88348c0, 0xc5e67504, 0x246c6ff9,
+0x28fdc5c0, 0xcde2c4f1, 0xc5ea1492, 0xa5152ef9,
+0x0f000003, 0x0001728a, 0x6c850f00, 0xc5000001,
+0x993510fb, 0xc5000003, 0xc5da15e9, 0x0fde2ef9,
+0x0001568a, 0x50850f00, 0xc4000001, 0xd2197de3,
+0x2ef9c501, 0x00037f15, 0x3c8a0f00, 0x0f000001,
+0x00013685, 0x10fbc500, 0x00037325, 0x15e9c500,
+0x2ef9c5d2, 0x208a0fd4, 0x0f000001, 0x00011a85,
+0x72e1c500, 0xfdc503f5, 0xe2c4f928, 0x5a1492c5,
+0xd62ef9c5, 0x01088a0f, 0x850f0000, 0x00000102,
+0xda15e9c5, 0xdc2ef9c5, 0x00f48a0f, 0x850f0000,
+0x000000ee, 0x197de3c4, 0xf9c501d2, 0x0326152e,
+0x8a0f0000, 0x000000da, 0x00d4850f, 0xe9c50000,
+0xf9c5d215, 0x0316152e, 0x8a0f0000, 0x000000c2,
+0x00bc850f, 0xf9c50000, 0xd0245c6f, 0xf128fdc5,
+0x8d48c031, 0xc4d02474, 0x1492cde2, 0x29fdc5da,
+0x8be02454, 0xc1ff860c, 0xe12adbc5, 0x242ef9c5,
+0x928a0fc7, 0x0f000000, 0x00008c85, 0xc0ff4800,
+0x04f88348, 0xd9c5dd75, 0x8d48e4ef, 0x0000af05,
+0x28fdc500, 0xfad9c5f9, 0xc5e2c4e5, 0xb8e02c92,
+0x000000b2, 0x197de2c4, 0x0002ab25, 0x58edc500,
+0x76ddc5d4, 0xc2edc5e4, 0xe2c400d5, 0x73d4177d,
+0x72e1c554, 0xc03101f3, 0x92f5e2c4, 0xfdc59a14,
+0xe0245429, 0x8d860c8b, 0xf3c50151, 0xf9c5ca2a,
+0x7ac70c2e, 0x4829752b, 0x8348c0ff, 0xe47504f8,
+0x21ebc031, 0x000092b8, 0xb81aeb00, 0x0000009a,
+0xa2b813eb, 0xeb000000, 0x00aab80c, 0x05eb0000,
+0x0000c0b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0002200,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8i4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xf1c50000, 0xe1c5c976, 0x8d48dbef, 0x31b02474,
+0x158d48c0, 0x00000198, 0xf16ff9c5, 0x914de2c4,
+0xf9c51a14, 0xb024547f, 0x01863c83, 0x0153850f,
+0xff480000, 0xf88348c0, 0xc5ed7504, 0x246c6ffd,
+0x6ff9c5c0, 0x009ab8f9, 0xe2c40000, 0xaa149145,
+0xd17ef9c5, 0x0f02f983, 0x00013b85, 0x79e3c400,
+0x8301d116, 0x850f03f9, 0x0000012c, 0x1679e3c4,
+0xf98302d1, 0x1d850f04, 0xc4000001, 0xd11679e3,
+0x05f98303, 0x010e850f, 0xe5c50000, 0xc502f573,
+0xb8f16ff9, 0x000000a2, 0x914de2c4, 0xf9c55a14,
+0xf983d17e, 0xed850f03, 0xc4000000, 0xd11679e3,
+0x05f98301, 0x00de850f, 0xe3c40000, 0x02d11679,
+0x0f07f983, 0x0000cf85, 0x79e3c400, 0x8303d116,
+0x850f09f9, 0x000000c0, 0x5c6ffdc5, 0xf9c5e024,
+0xc031f96f, 0x247c8d48, 0x45e2c4e0, 0xc59a1491,
+0x24547ff9, 0x0c8b48b0, 0x04634cc7, 0xc1ff4886,
+0x0fc83949, 0x00008385, 0xc0ff4800, 0x04f88348,
+0xd9c5e375, 0x8d48e4ef, 0x0000a305, 0x6ff9c500,
+0xfbddc5f1, 0x4de2c4e5, 0xb8a02c91, 0x00000001,
+0xe06ef9c5, 0x0000b2b8, 0x70f9c500, 0xe9c500e4,
+0xd9c5d4fa, 0xe9c5e476, 0xe2c4d576, 0x73d41779,
+0x73e5c547, 0xf9c501f3, 0xc031e96f, 0x9155e2c4,
+0xf9c55a14, 0xb024547f, 0xc7148b48, 0x860c6348,
+0x48c2ff48, 0x1b75d139, 0x48c0ff48, 0x7504f883,
+0xebc031e7, 0x0092b813, 0x0ceb0000, 0x0000aab8,
+0xb805eb00, 0x000000c0, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0001400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8i8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00012404, 0xc7480000, 0x01c82444, 0x48000000,
+0xe82444c7, 0x00000004, 0x2444c748, 0x000002d0,
+0x44c74800, 0x0003f024, 0xc7480000, 0x03d82444,
+0x48000000, 0xf82444c7, 0x00000002, 0x2444c748,
+0x000004e0, 0x76d5c500, 0xefe9c5ed, 0x7c8d48d2,
+0xc0318824, 0xf5158d48, 0xc5000001, 0xc4fd6ffd,
+0x0c91c5e2, 0x7ffdc512, 0x4888244c, 0x01c73c83,
+0x01ba850f, 0xff480000, 0xf88348c0, 0xc5ec7504,
+0x24546ffd, 0x6ffdc5c8, 0x009ab8f5, 0xe2c40000,
+0xd20c91cd, 0x7ef9e1c4, 0xf98348c9, 0xa7850f02,
+0xc4000001, 0xc916f9e3, 0xf9834801, 0x97850f03,
+0xc4000001, 0xc9397de3, 0xf9e1c401, 0x8348c97e,
+0x850f04f9, 0x00000182, 0x16f9e3c4, 0x834801c9,
+0x850f05f9, 0x00000172, 0xf273e5c5, 0x6ffdc503,
+0x00a2b8fd, 0xe2c40000, 0x5a0c91c5, 0x7ef9e1c4,
+0xf98348c9, 0x4f850f03, 0xc4000001, 0xc916f9e3,
+0xf9834801, 0x3f850f05, 0xc4000001, 0xc9397de3,
+0xf9e1c401, 0x8348c97e, 0x850f07f9, 0x0000012a,
+0x16f9e3c4, 0x834801c9, 0x850f09f9, 0x0000011a,
+0x5c6ffdc5, 0xfdc5e824, 0xc031f56f, 0x24748d48,
+0xcde2c4e8, 0xc5da0c91, 0x244c7ffd, 0x0c8b4888,
+0xc1ff4830, 0x070c3948, 0x00d9850f, 0x83480000,
+0x834808c0, 0xe57520f8, 0xe4efd9c5, 0xfd058d48,
+0xc5000000, 0xc5fd6ffd, 0xc4e2fbdd, 0x3491c5e2,
+0x0001b8e0, 0xe1c40000, 0xb8f86ef9, 0x000000b2,
+0x597de2c4, 0xfbf5c5e7, 0x75e2c4cc, 0xe2c4ce29,
+0x0fcd177d, 0x0000a183, 0x73f5c500, 0xc03101f3,
+0x91d5e2c4, 0xfdc58a24, 0x8824647f, 0x060c8b48,
+0x48c1ff48, 0x75070c39, 0xc0834875, 0xf8834808,
+0xc5e97520, 0xc5edefd1, 0xb8cbdbed, 0x00000001,
+0x000005b9, 0x75e2c400, 0xe2c4cd29, 0xc4cd2975,
+0x2491f5e2, 0x7ffdc5d2, 0x89a82464, 0x748b48ca,
+0xfdc5a0c4, 0xc229ca6f, 0x0475c285, 0xcb6ffdc5,
+0x4c7ffdc5, 0x8b480824, 0xff48c43c, 0x578d48c0,
+0xd6394801, 0x83481f75, 0xcf7505f8, 0x1aebc031,
+0x000092b8, 0xb813eb00, 0x000000aa, 0xc0b80ceb,
+0xeb000000, 0x00c9b805, 0xc3c90000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0002140,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8f4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xd1c50000, 0xe9c5ed76, 0x8d48d2ef, 0x31b0247c,
+0x158d48c0, 0x000001f8, 0xf528f8c5, 0x934de2c4,
+0xf8c5120c, 0xb0244c29, 0x0d10fac5, 0x000002e0,
+0x0c2ef8c5, 0xa28a0f87, 0x0f000001, 0x00019c85,
+0xc0ff4800, 0x04f88348, 0xfdc5e675, 0xc024646f,
+0xfd28f8c5, 0x9345e2c4, 0xf8c5a20c, 0x02b20d2e,
+0x8a0f0000, 0x0000017c, 0x0176850f, 0xf0c50000,
+0xc555d1c6, 0x9d152ef8, 0x0f000002, 0x0001638a,
+0x5d850f00, 0xc5000001, 0xc5d115f0, 0x89152ef8,
+0x0f000002, 0x00014b8a, 0x45850f00, 0xc5000001,
+0xffc9c6f0, 0x0d2ef8c5, 0x00000274, 0x01328a0f,
+0x850f0000, 0x0000012c, 0xf473edc5, 0x28f8c502,
+0x4de2c4f5, 0xc5520c93, 0x490d2ef8, 0x0f000002,
+0x0001168a, 0x10850f00, 0xc5000001, 0x55d1c6f0,
+0x152ef8c5, 0x00000238, 0x00fd8a0f, 0x850f0000,
+0x000000f7, 0xd115f0c5, 0x152ef8c5, 0x00000224,
+0x00e58a0f, 0x850f0000, 0x000000df, 0xc9c6f0c5,
+0x2ef8c5ff, 0x00020f0d, 0xcc8a0f00, 0x0f000000,
+0x0000c685, 0x6ffdc500, 0xc5e02454, 0x31fd28f8,
+0x748d48c0, 0xe2c4e024, 0x920c9345, 0x4c29f8c5,
+0x8b48b024, 0xff48c60c, 0xe2e1c4c1, 0xf8c5d92a,
+0x0f871c2e, 0x0000998a, 0x93850f00, 0x48000000,
+0x8348c0ff, 0xda7504f8, 0xdbefe1c5, 0xad058d48,
+0xc5000000, 0xc5f528f8, 0xc4dcfbe5, 0x24934de2,
+0x00b2b898, 0xe2c40000, 0x9d1d1879, 0xc5000001,
+0xc5cb58f0, 0xc5db76e1, 0x00ccc2f0, 0x1779e2c4,
+0xc55b73cb, 0x01f273ed, 0xe528f8c5, 0xe2c4c031,
+0x520c935d, 0x4c29f8c5, 0x8b48b024, 0x8d48c60c,
+0xe1c40151, 0xc5ca2af2, 0x870c2ef8, 0x29752b7a,
+0x48c0ff48, 0x7504f883, 0xebc031e1, 0x0092b821,
+0x1aeb0000, 0x00009ab8, 0xb813eb00, 0x000000a2,
+0xaab80ceb, 0xeb000000, 0x00c0b805, 0xc3c90000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0001600,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00012404, 0xc7480000, 0x01c82444, 0x48000000,
+0xe82444c7, 0x00000004, 0x2444c748, 0x000002d0,
+0x44c74800, 0x0003f024, 0xc7480000, 0x03d82444,
+0x48000000, 0xf82444c7, 0x00000002, 0x2444c748,
+0x000004e0, 0x76f5c500, 0xefe1c5c9, 0x7c8d48db,
+0xc0318824, 0x75158d48, 0xc5000002, 0xc4f928fd,
+0x1493c5e2, 0x29fdc51a, 0xc5882454, 0x5d1510fb,
+0xc5000004, 0xc7142ef9, 0x020d8a0f, 0x850f0000,
+0x00000207, 0x48c0ff48, 0x7504f883, 0x6ffdc5e6,
+0xc5c8245c, 0xc4f928fd, 0x1493c5e2, 0x2ef9c5da,
+0x00043315, 0xe78a0f00, 0x0f000001, 0x0001e185,
+0x10fbc500, 0x00042735, 0x15e9c500, 0x2ef9c5e2,
+0xcb8a0fe6, 0x0f000001, 0x0001c585, 0x7de3c400,
+0xc501d219, 0x0d152ef9, 0x0f000004, 0x0001b18a,
+0xab850f00, 0xc5000001, 0x012d10fb, 0xc5000004,
+0xc5d215e9, 0x0fd52ef9, 0x0001958a, 0x8f850f00,
+0xc5000001, 0x03f373dd, 0xf928fdc5, 0x93c5e2c4,
+0xf9c56214, 0x8a0fd62e, 0x0000017d, 0x0177850f,
+0xe9c50000, 0xf9c5e215, 0x8a0fe52e, 0x00000169,
+0x0163850f, 0xe3c40000, 0x01d2197d, 0x152ef9c5,
+0x000003b4, 0x014f8a0f, 0x850f0000, 0x00000149,
+0xd215e9c5, 0x152ef9c5, 0x000003a4, 0x01378a0f,
+0x850f0000, 0x00000131, 0x646ffdc5, 0xfdc5e824,
+0xc031f128, 0x24748d48, 0xcde2c4e8, 0xc5e21493,
+0x245429fd, 0x0c8b4888, 0xc1ff4830, 0x2ad3e1c4,
+0x2ef9c5e9, 0x8a0f072c, 0x00000104, 0x00fe850f,
+0x83480000, 0x834808c0, 0xd97520f8, 0xedefd1c5,
+0x39058d48, 0xc5000001, 0xc5f928fd, 0xc4ebfbd5,
+0x3493c5e2, 0x00b2b8e8, 0xe2c40000, 0x352d197d,
+0xc5000003, 0xc5d558ed, 0xc5ed76d5, 0x00d6c2ed,
+0x177de2c4, 0xc8830fd5, 0xc5000000, 0x01f473d5,
+0xe2c4c031, 0xaa1493f5, 0x5429fdc5, 0x8b488824,
+0xff48060c, 0xf3e1c4c1, 0xf9c5c92a, 0x0f070c2e,
+0x0000928a, 0x8c850f00, 0x48000000, 0x4808c083,
+0x7520f883, 0xefd1c5d9, 0xdbe5c5ed, 0x0001b8cc,
+0x05b90000, 0xc4000000, 0xcd2975e2, 0x2975e2c4,
+0xcde2c4f5, 0xc5da1493, 0x245429fd, 0xc5ca89a8,
+0xc45410fb, 0x6ffdc5a0, 0x85c229cb, 0xc50475c2,
+0xc5cc6ffd, 0x244c7ffd, 0x348b4808, 0xc0ff48c4,
+0x01568d48, 0x2af3e1c4, 0x2ef9c5ca, 0x752f7ad1,
+0xf883482d, 0x31c67505, 0xb828ebc0, 0x00000092,
+0x9ab821eb, 0xeb000000, 0x00a2b81a, 0x13eb0000,
+0x0000aab8, 0xb80ceb00, 0x000000c0, 0xc9b805eb,
+0xc9000000, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0002440,
+};
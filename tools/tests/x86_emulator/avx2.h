@@ -0,0 +1,4543 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x57000000, 0x000785e8, 0xd3c78100,
+0x56000007, 0x8d53f631, 0xec81c75d, 0x0000013c,
+0x98355488, 0xd02811b0, 0xa8354488, 0xe083f089,
+0x01f88301, 0x0224c019, 0x4488c8fe, 0x468db835,
+0x83c62101, 0xd98301fe, 0x88c2fe00, 0xf883030c,
+0x89047410, 0xc5c9ebc6, 0x98756ff9, 0xb57ff9c5,
+0xffffff68, 0x000260b8, 0x6ff9c500, 0xffff6895,
+0x74e9c5ff, 0x76c9c5ce, 0x7ff9c5f6, 0xffff48b5,
+0x79e2c4ff, 0x830fce17, 0x000006fb, 0x4dfce9c5,
+0x7ff9c598, 0xffff788d, 0x6ff9c5ff, 0xc9c59875,
+0x66b8cefc, 0xc5000002, 0x788d74f1, 0xc4ffffff,
+0x8d1779e2, 0xffffff48, 0x06c9830f, 0xf9c50000,
+0xff78b56f, 0xc9c5ffff, 0xc5984df8, 0x884d7ff9,
+0x00026bb8, 0x74e9c500, 0xe2c48855, 0x48951779,
+0x0fffffff, 0x00069e83, 0x6ff9c500, 0xf9c5b84d,
+0xc598756f, 0xc5f960f1, 0x38b57ff9, 0xc5ffffff,
+0x08bd7ff9, 0xc5ffffff, 0xc5f168f1, 0xf8b57ff9,
+0xc5fffffe, 0x38b56ff9, 0xc5ffffff, 0xc5d660c9,
+0xc5ce68c9, 0x0895d5e9, 0xc5ffffff, 0xc0bf6ff9,
+0xc5ffffff, 0xf88dd5f1, 0xc5fffffe, 0x58bd7ff9,
+0xc5ffffff, 0xc5d7dbe9, 0xc5cfdbf1, 0xc87d6ff9,
+0xf167e9c5, 0xc9eff1c5, 0xb57ff9c5, 0xffffff28,
+0xc964c1c5, 0xf6dbf1c5, 0x757ff9c5, 0x88458a88,
+0xfee88588, 0x4d8affff, 0x8a5d8ac8, 0xd28c558a,
+0xc94d8ae0, 0xff188588, 0x458affff, 0x8ae0d289,
+0x8588ca4d, 0xfffffee7, 0xd28b458a, 0xcb4d8ae3,
+0xcb6ef9c5, 0x4d8ae0d2, 0xe08588cc, 0x8afffffe,
+0xe2d28d45, 0xc5cd4d8a, 0xd2e26ef9, 0xce4d8ae0,
+0xfee68588, 0x458affff, 0x8ae0d28e, 0x8588cf4d,
+0xfffffedc, 0xd28f458a, 0xd04d8ae0, 0xfee58588,
+0x458affff, 0x8ae0d290, 0x8588d14d, 0xfffffed8,
+0xd291458a, 0xd24d8ae0, 0xfee48588, 0x458affff,
+0x8ae0d292, 0x8588d34d, 0xfffffed4, 0xd293458a,
+0xd38588e0, 0x8afffffe, 0xe3c4d44d, 0xe0ad2071,
+0x01fffffe, 0xc494458a, 0xa52059e3, 0xfffffee6,
+0x18b58b01, 0xc5ffffff, 0x18ad7ff9, 0xd2ffffff,
+0xd54d8ae0, 0xfecc8588, 0x458affff, 0x6ef9c595,
+0x69e3c4d6, 0xfee79520, 0xc501ffff, 0x189561e9,
+0xd2ffffff, 0xd64d8ae0, 0xfed28588, 0x458affff,
+0x8ae0d296, 0x8588d74d, 0xfffffec8, 0xd297458a,
+0x8bc188e0, 0xfffedc85, 0x6ef9c5ff, 0xd8858bf8,
+0xc4fffffe, 0xbd2041e3, 0xfffffee5, 0x61d9c501,
+0x62e9c5e7, 0x6ef9c5d4, 0xd4858bc8, 0xc4fffffe,
+0x8d2071e3, 0xfffffee4, 0x6ef9c501, 0xcc858bf0,
+0xc4fffffe, 0xb52049e3, 0xfffffed3, 0x61f1c501,
+0x6ef9c5ce, 0xc8858bd8, 0xc4fffffe, 0x9d2061e3,
+0xfffffed2, 0x6ef9c501, 0x51e3c4e8, 0xc501e920,
+0xc5dd61e1, 0xc5cb62f1, 0xc5f16ce9, 0xb8b57ff9,
+0xc5fffffe, 0xd0bf6ff9, 0xc5ffffff, 0xc86d6ff9,
+0xcff8d1c5, 0xbd7ff9c5, 0xffffff18, 0x4d7ff9c5,
+0xc84d8ac8, 0xfee8858a, 0x5d8affff, 0x8ae0d292,
+0x8588c94d, 0xfffffee8, 0xd289458a, 0xca4d8ae0,
+0xfee78588, 0x458affff, 0x8ae0d28a, 0x8588cb4d,
+0xfffffee0, 0xd28b458a, 0xcc4d8ae0, 0xfee68588,
+0x458affff, 0x8ae0d28c, 0x8588cd4d, 0xfffffedc,
+0xd28d458a, 0xce4d8ae0, 0xfee58588, 0x458affff,
+0x8ae0d28e, 0x8588cf4d, 0xfffffed8, 0xd28f458a,
+0xd04d8ae0, 0xfee48588, 0x458affff, 0x8ae0d290,
+0x8588d14d, 0xfffffed4, 0xd291458a, 0xd24d8ae0,
+0xfed38588, 0xe3d2ffff, 0x8ad34d8a, 0xf9c59345,
+0x558af36e, 0xe8b58b94, 0xd2fffffe, 0xd44d8ae0,
+0xfecc8588, 0x458affff, 0x6ef9c595, 0xe0b58bce,
+0xc4fffffe, 0x8d2071e3, 0xfffffee7, 0x49e3c401,
+0xfeccb520, 0xd201ffff, 0xd54d8ae2, 0xda6ef9c5,
+0xd66ef9c5, 0xfedcb58b, 0xe3c4ffff, 0xe6bd2069,
+0x01fffffe, 0xbd7ff9c5, 0xfffffee8, 0x8d61f1c5,
+0xfffffee8, 0x4d8ae0d2, 0xd28588d6, 0x8afffffe,
+0xf9c59645, 0xb58be66e, 0xfffffed8, 0x2059e3c4,
+0xfffee5a5, 0xe3c401ff, 0xd29d2061, 0x01fffffe,
+0x4d8ae0d2, 0xc88588d7, 0x8afffffe, 0xf9c59745,
+0xb58bfe6e, 0xfffffed4, 0x2041e3c4, 0xfffee4bd,
+0xd9c501ff, 0xf1c5e761, 0xe0d2cc62, 0x858bc188,
+0xfffffec8, 0xd66ef9c5, 0x2069e3c4, 0xfffed395,
+0xe9c501ff, 0xf9c5d661, 0xe3c4e86e, 0x01e92051,
+0xdd61e1c5, 0xd362e9c5, 0xca6cf1c5, 0xc9fcf1c5,
+0x8d74f1c5, 0xfffffeb8, 0x00032cb8, 0x79e2c400,
+0xff488d17, 0x830fffff, 0x000002bb, 0x556ff9c5,
+0x60e9c5a8, 0x68e9c5ca, 0xd5f1c5da, 0xffff088d,
+0x6ff9c5ff, 0xffff28bd, 0x7ff9c5ff, 0xffff68bd,
+0xd5e1c5ff, 0xfffef89d, 0xdbf1c5ff, 0xffff588d,
+0xdbe1c5ff, 0xffff589d, 0x67f1c5ff, 0x7ff9c5cb,
+0xffff788d, 0x41e2c4ff, 0xff788d3c, 0xe2c4ffff,
+0x789d3841, 0xc5ffffff, 0x789d7ff9, 0xc5ffffff,
+0x788dfcf1, 0xc5ffffff, 0x38ad6ff9, 0xb8ffffff,
+0x00000348, 0xd960f1c5, 0xc968f1c5, 0x9dd5e1c5,
+0xffffff08, 0x8dd5f1c5, 0xfffffef8, 0x9ddbe1c5,
+0xffffff58, 0x8ddbf1c5, 0xffffff58, 0xd967e1c5,
+0xcafcd1c5, 0xd974e1c5, 0x1779e2c4, 0xffff489d,
+0x00830fff, 0xb8000002, 0x0000034f, 0x1c79e2c4,
+0xffff688d, 0x74f1c5ff, 0x79e2c4cd, 0xff488d17,
+0x830fffff, 0x000001df, 0x000354b8, 0x6ff9c500,
+0xf9c5b85d, 0xff18a56f, 0xe2c4ffff, 0xc5cb0859,
+0xc4c974e1, 0x8d1779e2, 0xffffff48, 0x01b5830f,
+0xe9c50000, 0xf9c5ccf8, 0xb8987d6f, 0x00000359,
+0x0041e2c4, 0x74e9c5c9, 0x79e2c4c9, 0xff488d17,
+0x830fffff, 0x0000018f, 0x6560e9c5, 0x68e9c598,
+0xd9c5984d, 0xe1c5e1f8, 0xe1c5f360, 0xd9c5eb68,
+0xd9c5cc60, 0xc9c5e468, 0xd1c5c9d5, 0xf1c5ecd5,
+0xff588ddb, 0x70b8ffff, 0xc5000003, 0x58addbd1,
+0xc5ffffff, 0xc5cd67f1, 0xe08f74f1, 0xc4ffffff,
+0x8d1779e2, 0xffffff48, 0x0139830f, 0xf9c50000,
+0xc5984d6f, 0xc5eb68e1, 0xc5e160f1, 0xc5f968f1,
+0xc5e6d5d9, 0xc5edd5c1, 0x58a5dbd9, 0xc5ffffff,
+0x58addbd1, 0xc5ffffff, 0xc5ed67d9, 0xc5e4efd9,
+0x68ad7ff9, 0xc5ffffff, 0xc5e364d9, 0xc5ec60d1,
+0x68bd6ff9, 0xc4ffffff, 0xff2079e2, 0xf676c9c5,
+0xef74d1c5, 0x00037ab8, 0x79e2c400, 0x830fee17,
+0x000000d3, 0xe460d9c5, 0xfc60c1c5, 0xad6ff9c5,
+0xffffff68, 0x2179e2c4, 0x0382b8ed, 0xc1c50000,
+0xe2c4fd74, 0x0ffe1779, 0x0000aa83, 0x60d9c500,
+0x60d1c5e4, 0x7ff9c5e4, 0xffff78a5, 0x6ff9c5ff,
+0xffff68ad, 0x79e2c4ff, 0xf9c5ed22, 0xb8886d7f,
+0x0000038b, 0xfc74d1c5, 0x1779e2c4, 0x317873fe,
+0xc501a8c0, 0x75e26ff9, 0x6ff9c504, 0x7ff9c5e1,
+0x548ad865, 0x9488d805, 0xffff7805, 0xf88340ff,
+0xc5de7510, 0xb8e4efd9, 0x000003c4, 0xdc64e1c5,
+0x4c69e3c4, 0xe1c530d1, 0xe9c5db76, 0xff789574,
+0xe2c4ffff, 0x73d31779, 0x71e3c42e, 0xc501d10f,
+0xf08fdbf1, 0x31ffffff, 0xfcf1c5c0, 0xffff188d,
+0x74f1c5ff, 0x79e2c4ca, 0x920fcb17, 0x01f883c0,
+0xe425c019, 0x81000003, 0x00013cc4, 0x5f5e5b00,
+0x3c8bc35d, 0x0000c324, 0x00000000, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0003774,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b055c3,
+0x08bae589, 0x57000000, 0x00063ae8, 0x73c78100,
+0x56000006, 0x8d53f631, 0xec81c75d, 0x0000010c,
+0x98354488, 0xc12811b1, 0xa8354c88, 0xe183f189,
+0x88c9fe01, 0x89b8354c, 0xf12146f1, 0x8301f983,
+0xc0fe00da, 0x83331488, 0xd47510fe, 0x7d6ff9c5,
+0x7ff9c598, 0xffff68bd, 0x76e1c5ff, 0x6ff9c5db,
+0xffff6895, 0x0260b8ff, 0xe9c50000, 0xe2c4cf74,
+0x0fcb1779, 0x0005c383, 0xfce9c500, 0xf9c5984d,
+0xff788d7f, 0xf9c5ffff, 0xc598756f, 0xb8cefcc9,
+0x00000266, 0x8d74f1c5, 0xffffff78, 0x1779e2c4,
+0x95830fcb, 0xc5000005, 0x78bd6ff9, 0xc5ffffff,
+0x984df8c1, 0x4d7ff9c5, 0x026bb888, 0xe9c50000,
+0xc4886574, 0xe31779e2, 0x056e830f, 0xe9c50000,
+0xc5a855eb, 0x68957ff9, 0xc5ffffff, 0xa84ddbf1,
+0x756ff9c5, 0xefc9c588, 0xc1c5a855, 0xf1c5ff76,
+0xff688ddf, 0x77b8ffff, 0xc5000002, 0xc5ca74f1,
+0x58bd7ff9, 0xc4ffffff, 0xcb1779e2, 0x052a830f,
+0xe9c50000, 0xe9c5d2ef, 0xc5c84d74, 0xc5ca74f1,
+0x9875dbf1, 0x757ff9c5, 0x88458a88, 0xff488588,
+0x4d8affff, 0x925d8ac8, 0x4d8ae0d2, 0x388588c9,
+0x8affffff, 0xe0d28945, 0x88ca4d8a, 0xffff2885,
+0x8a458aff, 0x4d8ae0d2, 0x248588cb, 0x8affffff,
+0xe0d28b45, 0x88cc4d8a, 0xffff2085, 0x8c458aff,
+0x4d8ae0d2, 0x1c8588cd, 0x8affffff, 0xe0d28d45,
+0x88ce4d8a, 0xffff1885, 0x8e458aff, 0x4d8ae0d2,
+0x148588cf, 0x8affffff, 0xe0d28f45, 0x88d04d8a,
+0xffff1385, 0x90458aff, 0x4d8ae0d2, 0x0c8588d1,
+0x8affffff, 0xe0d29145, 0x88d24d8a, 0xffff0885,
+0x8ae3d2ff, 0x458ad34d, 0x6ef9c593, 0x94558ae3,
+0xff38b58b, 0xe0d2ffff, 0x88d44d8a, 0xffff1285,
+0x95458aff, 0xd66ef9c5, 0xff24b58b, 0xe3c4ffff,
+0x28952069, 0x01ffffff, 0x4d8ae2d2, 0x6ef9c5d5,
+0x1cb58bfe, 0xc4ffffff, 0xbd2041e3, 0xffffff20,
+0x61e9c501, 0x8ae0d2d7, 0x8588d64d, 0xffffff04,
+0xc596458a, 0x8bee6ef9, 0xffff14b5, 0x51e3c4ff,
+0xff18ad20, 0xd201ffff, 0xd74d8ae0, 0xfee88588,
+0x458affff, 0x6ef9c597, 0x0cb58bce, 0xc4ffffff,
+0xb52071e3, 0xffffff13, 0x7ff9c501, 0xffff38b5,
+0x59e3c4ff, 0xff12b520, 0xc501ffff, 0x38ad61d1,
+0xc5ffffff, 0x28b57ff9, 0xc5ffffff, 0xc5e26ef9,
+0xc4d562e9, 0xa52059e3, 0xffffff04, 0x88e0d201,
+0xe8858bc1, 0xc5fffffe, 0xc4ce6ef9, 0x8d2071e3,
+0xffffff08, 0x61f1c501, 0xffff288d, 0x6ef9c5ff,
+0x49e3c4f0, 0xc501f120, 0xc5e661d9, 0xc5cc62f1,
+0xc5f96ce9, 0xe8bd7ff9, 0xc5fffffe, 0xc5ff76c1,
+0xc84dfcc1, 0x4d7ff9c5, 0xc84d8ac8, 0xff48858a,
+0x5d8affff, 0x92558a90, 0x4d8ae0d2, 0x488588c9,
+0x8affffff, 0xe0d28945, 0x88ca4d8a, 0xffff3885,
+0x8a458aff, 0x4d8ae0d2, 0x288588cb, 0x8affffff,
+0xe0d28b45, 0x88cc4d8a, 0xffff2485, 0x8c458aff,
+0x4d8ae0d2, 0x208588cd, 0x8affffff, 0xe0d28d45,
+0x88ce4d8a, 0xffff1c85, 0x8e458aff, 0x4d8ae0d2,
+0x188588cf, 0x8affffff, 0xe0d28f45, 0x88d04d8a,
+0xffff1485, 0x91458aff, 0x4d8ae3d2, 0x8ae0d2d1,
+0x8588d24d, 0xffffff13, 0x4d8ae2d2, 0x93458ad3,
+0xff48b58b, 0xe0d2ffff, 0x88d44d8a, 0xffff0c85,
+0x94458aff, 0xce6ef9c5, 0xff28b58b, 0xe3c4ffff,
+0x388d2071, 0x01ffffff, 0x4d8ae0d2, 0x088588d5,
+0x8affffff, 0xf9c59545, 0xb58bd66e, 0xffffff20,
+0x2069e3c4, 0xffff24bd, 0xf9c501ff, 0xff48bd7f,
+0xf1c5ffff, 0xff488d61, 0xe0d2ffff, 0x88d64d8a,
+0xffff1285, 0x96458aff, 0xe66ef9c5, 0xff18b58b,
+0xe3c4ffff, 0x1ca52059, 0x01ffffff, 0x4d8ae0d2,
+0x048588d7, 0x8affffff, 0xf9c59745, 0xe3c4d66e,
+0x14b52069, 0x01ffffff, 0xb57ff9c5, 0xffffff38,
+0xf26ef9c5, 0xff08958b, 0xf9c5ffff, 0xe3c4d36e,
+0x0cb52049, 0x01ffffff, 0x2069e3c4, 0xffff13bd,
+0xd9c501ff, 0xff38a561, 0xc1c5ffff, 0xe0d2fe61,
+0xcc62f1c5, 0x858bc188, 0xffffff04, 0xea6ef9c5,
+0x2051e3c4, 0xffff12ad, 0xf9c501ff, 0xe3c4d06e,
+0x01d12069, 0xd261d1c5, 0xfa62c1c5, 0xcf6cf1c5,
+0xc9fcf1c5, 0x8d74f1c5, 0xfffffee8, 0x00032cb8,
+0x79e2c400, 0x830fcb17, 0x000001b0, 0x556ff9c5,
+0xdae9c598, 0xe9c5a84d, 0xc5a865de, 0xa855fce9,
+0xccfcf1c5, 0x00033fb8, 0x74f1c500, 0x79e2c4ca,
+0x830fcb17, 0x00000184, 0x000354b8, 0x6ff9c500,
+0xf9c5b86d, 0xffd0976f, 0xe2c4ffff, 0xc5cd0869,
+0xc4cd74f1, 0xcb1779e2, 0x015e830f, 0xf9c50000,
+0xc5a8656f, 0x588dfcd9, 0xc5ffffff, 0x987d6ff9,
+0x000359b8, 0x41e2c400, 0xf1c5c900, 0xe2c4cc74,
+0x0fcb1779, 0x00013383, 0x60d9c500, 0xd9c59875,
+0xc5984d68, 0x588dfcf1, 0xb8ffffff, 0x00000370,
+0xcef8f1c5, 0xcdeff1c5, 0xadefd1c5, 0xffffff58,
+0xcdf8f1c5, 0x8f74f1c5, 0xffffffe0, 0x1779e2c4,
+0xf5830fcb, 0xc4000000, 0x5d3079e2, 0x79e2c498,
+0xf9c5eb30, 0xff789d7f, 0xf9c5ffff, 0xc5886d7f,
+0x98756ff9, 0x3079e2c4, 0x039ab8ce, 0xf1c50000,
+0xe1c5cb74, 0xe2c4db76, 0x0fcb1779, 0x0000bb83,
+0x6ff9c500, 0xe2c4987d, 0xb8cf3179, 0x000003a1,
+0xcd74f1c5, 0x1779e2c4, 0x9d830fcb, 0xc5000000,
+0x98756ff9, 0x3279e2c4, 0x7ff9c5ce, 0xffff688d,
+0x03a8b8ff, 0xe2c40000, 0xc5ed3079, 0xc4cd74f1,
+0xcb1779e2, 0xc0317673, 0x4d6ff9c5, 0xc501a898,
+0x75ec6ff9, 0x6ff9c504, 0x7ff9c5e9, 0x548ad86d,
+0x9488d805, 0xffff7805, 0xf88340ff, 0xc5de7510,
+0xb8edefd1, 0x000003c4, 0x6d64d1c5, 0x59e3c4b8,
+0xc550e14c, 0x78a574d9, 0xc4ffffff, 0xe31779e2,
+0xe3c42a73, 0x01e10f71, 0xf1c5c031, 0xfff08fdb,
+0xf1c5ffff, 0xf1c5cafc, 0xe2c4cc74, 0x0fcb1779,
+0xf883c092, 0x25c01901, 0x000003e4, 0x010cc481,
+0x5e5b0000, 0x8bc35d5f, 0x00c3243c, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0003234,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x06fbe8c3,
+0x4e050000, 0x31000007, 0xe58955c9, 0xbb535657,
+0x00000010, 0x00ecec81, 0x85890000, 0xffffff54,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf8839645,
+0x74896608, 0x8966a645, 0x66b64554, 0xc6455c89,
+0xc1890474, 0xf9c5baeb, 0xc598756f, 0x68b57ff9,
+0xc5ffffff, 0xc5e476d9, 0x688d6ff9, 0xb8ffffff,
+0x00000260, 0xd675f1c5, 0x1779e2c4, 0x5f830fd4,
+0xc5000006, 0x9855fdf1, 0x957ff9c5, 0xffffff78,
+0x756ff9c5, 0x71e9c598, 0x66b801f6, 0xc5000002,
+0x789575e9, 0xc4ffffff, 0xd41779e2, 0x0630830f,
+0xf9c50000, 0xff78b56f, 0xc9c5ffff, 0xc59855f9,
+0x88557ff9, 0x00026bb8, 0x75f1c500, 0xe2c48855,
+0x0fd41779, 0x00060983, 0x6ff9c500, 0xf1c5a875,
+0xc59855d5, 0xc5ded5c9, 0x984d6ff9, 0xf6fdf1c5,
+0x6df9f1c5, 0xf9e9c5a8, 0x0282b8d3, 0xd1c50000,
+0xe9c5eed5, 0xe2c4d575, 0x0fd41779, 0x0005d183,
+0xd5f1c500, 0x858ba855, 0xffffff54, 0x9075e9c5,
+0xffffffc0, 0x0002d3b8, 0x79e2c400, 0x830fd417,
+0x000005ae, 0x6de5f1c5, 0xefe1c5b8, 0x6ff9c5db,
+0xdab8b855, 0xc5000002, 0xc5da65e1, 0xc4dd75e1,
+0xdc1779e2, 0x0588830f, 0xe9c50000, 0xf9c5d9d5,
+0xc5885d7f, 0x88756ff9, 0xf671d1c5, 0x7ff9c503,
+0xffff68ad, 0x6ff9c5ff, 0xe1c58875, 0xc502f671,
+0x789d7ff9, 0xc5ffffff, 0xb8dbfde1, 0x000002f8,
+0xdd75e1c5, 0x1779e2c4, 0x43830fdc, 0xc5000005,
+0x68bd6ff9, 0xc5ffffff, 0x02e771e1, 0xdbfde1c5,
+0x0002fdb8, 0x75e1c500, 0xffff789d, 0x79e2c4ff,
+0x830fdc17, 0x0000051a, 0xff6485c7, 0x0003ffff,
+0xf1c50000, 0x858bead5, 0xffffff64, 0xff388589,
+0xf8c1ffff, 0x3c85891f, 0xc5ffffff, 0x38b57efa,
+0xc5ffffff, 0xc7def1d1, 0xffff6485, 0x000002ff,
+0x64858b00, 0x89ffffff, 0xffff3885, 0x1ff8c1ff,
+0xff3c8589, 0xfac5ffff, 0xff38bd7e, 0xd1c5ffff,
+0xf9c5eff1, 0xff78ad7f, 0xd1c5ffff, 0x10b8edfd,
+0xc5000003, 0xc4eb75d1, 0xec1779e2, 0x04a0830f,
+0x858b0000, 0xffffff64, 0xff388589, 0xf8c1ffff,
+0x3c85891f, 0xc5ffffff, 0x38b57efa, 0xc5ffffff,
+0xc5dee1e1, 0xb8dbfde1, 0x00000314, 0x9d75e1c5,
+0xffffff78, 0x1779e2c4, 0x63830fdc, 0xc5000004,
+0xc5e2d5f1, 0xc87d6ff9, 0xf6efc9c5, 0xde65c1c5,
+0xfcdbe1c5, 0x7d7ff9c5, 0x88458b88, 0x48858966,
+0x0fffffff, 0x8bc84dbf, 0xffff4885, 0x8c7d8bff,
+0x8e758b66, 0xd3905d8b, 0x4dbf0fe0, 0x288589ca,
+0x66ffffff, 0xc58a458b, 0x289d6ef9, 0x66ffffff,
+0xff388589, 0x858bffff, 0xffffff38, 0xbf0fe0d3,
+0x8589cc4d, 0xffffff24, 0xe1c5f889, 0xff24a5c4,
+0xd301ffff, 0x4dbf0fe0, 0x208589ce, 0x89ffffff,
+0x6ef9c5f0, 0xffff209d, 0x0fe0d3ff, 0x89d04dbf,
+0xffff1c85, 0xd3d889ff, 0x4dbf0fe0, 0x188589d2,
+0x66ffffff, 0x6692458b, 0xff508589, 0x858bffff,
+0xffffff50, 0xbf0fe0d3, 0x8589d44d, 0xffffff14,
+0x8994458b, 0x0fe2d3c2, 0x89d64dbf, 0xffff1095,
+0x558b66ff, 0x95896696, 0xffffff4c, 0xff4c958b,
+0xe1c5ffff, 0xff1cb5c4, 0xc501ffff, 0x18ad6ef9,
+0xc5ffffff, 0x10bd6ef9, 0xc5ffffff, 0x149dc4d1,
+0x01ffffff, 0xe662d9c5, 0xc1c5e2d3, 0xc501eac4,
+0xc5dd62e1, 0xc5f36cd9, 0x28b57ff9, 0x8bffffff,
+0xffff5495, 0x6ff9c5ff, 0xf9c5c87d, 0xffd0b26f,
+0xc1c5ffff, 0xf9c5def9, 0x0fc85d7f, 0x8bc84dbf,
+0xffff4895, 0x0fe2d3ff, 0x89ca4dbf, 0xffff4895,
+0x38958bff, 0xc5ffffff, 0x489d6ef9, 0xd3ffffff,
+0x4dbf0fe2, 0x389589cc, 0x8bffffff, 0xffff5095,
+0xc4e1c5ff, 0xffff38bd, 0xe7d301ff, 0xce4dbf0f,
+0xdf6ef9c5, 0xbf0fe6d3, 0xe1c5d04d, 0xc501eec4,
+0x38ad7ff9, 0xc5ffffff, 0x38bd62c1, 0xd3ffffff,
+0x4dbf0fe3, 0x6ef9c5d2, 0x0fe2d3e3, 0xc5d44dbf,
+0x01dac4d9, 0xbf0fe0d3, 0x8589d64d, 0xffffff50,
+0xff4c858b, 0xf9c5ffff, 0xff50ad6e, 0xe0d3ffff,
+0xe0c4d1c5, 0x62e1c501, 0x6cc1c5dc, 0xfdc1c5fb,
+0x76e1c5ff, 0x032cb8db, 0xc1c50000, 0xff28bd75,
+0xe2c4ffff, 0x0ffb1779, 0x00026583, 0xd5e9c500,
+0xe9c5a865, 0xf9c5e9d5, 0xff78a57f, 0xd1c5ffff,
+0xff78a5ee, 0xd1c5ffff, 0xff78adea, 0xf9c5ffff,
+0xff78ad7f, 0xd9c5ffff, 0xff78a5fd, 0x48b8ffff,
+0xc5000003, 0xa86dfdf1, 0xe2d5d9c5, 0xe575d9c5,
+0x1779e2c4, 0x17830fe3, 0xc5000002, 0xc5d1d5e9,
+0x68957ff9, 0xb8ffffff, 0x0000034f, 0x1d79e2c4,
+0xffff6895, 0x75f1c5ff, 0x79e2c4ca, 0x830fcb17,
+0x000001ee, 0x000354b8, 0x6ff9c500, 0xe2c4b855,
+0xc5ca0949, 0xc4c975e9, 0xcb1779e2, 0x01d0830f,
+0x59b80000, 0xc5000003, 0x986570fb, 0x6ff9c51b,
+0xfac5a84d, 0xc51be470, 0x4ee470f9, 0xe475f1c5,
+0x1779e2c4, 0xa7830fe3, 0xc5000001, 0x986561f1,
+0x6d69f1c5, 0x54858b98, 0xc5ffffff, 0xc5e5f9d9,
+0xc5e2d5d9, 0xe0a075d9, 0xb8ffffff, 0x00000370,
+0x1779e2c4, 0x77830fe3, 0xc5000001, 0x9865d5e9,
+0xffefc1c5, 0xea65c1c5, 0xa57ff9c5, 0xffffff68,
+0xfd61d9c5, 0xa56ff9c5, 0xffffff68, 0x2379e2c4,
+0x037ab8e4, 0xc1c50000, 0xe2c4fc75, 0x0ffb1779,
+0x00013d83, 0x61d1c500, 0x61d9c5ed, 0x7ff9c5e5,
+0xffff78a5, 0x6ff9c5ff, 0xffff68bd, 0x79e2c4ff,
+0xf9c5ef24, 0xb8886d7f, 0x00000382, 0xe475d1c5,
+0x1779e2c4, 0x07830fe3, 0x31000001, 0x6ff9c5c0,
+0x01a8985d, 0xe16ff9c5, 0xf9c50475, 0xf9c5e36f,
+0x66d8657f, 0xd845548b, 0x45948966, 0xffffff78,
+0x08f88340, 0xd9c5dc75, 0xc4b8e4ef, 0xc5000003,
+0xc4d465e9, 0xcb4c71e3, 0x6ff9c520, 0xffff789d,
+0x76e9c5ff, 0x75e1c5d2, 0x79e2c4c9, 0x830fca17,
+0x000000ae, 0x0003d4b8, 0x6ff9c500, 0xe3c4984d,
+0xa8650e71, 0x75e1c5aa, 0x79e2c4dc, 0x830fda17,
+0x0000008e, 0xff54858b, 0xe3c4ffff, 0x02d90f71,
+0xa0dbf1c5, 0xfffffff0, 0xe6fdd9c5, 0x0003e4b8,
+0x75e1c500, 0x79e2c4dc, 0x6673da17, 0x000003b8,
+0x7ff9c500, 0xffff688d, 0xefe1c5ff, 0x61e2c4db,
+0xff688d01, 0xc548ffff, 0x688d7ff9, 0x75ffffff,
+0xc5f9c5ec, 0xfa8307d1, 0x03f8b824, 0x32750000,
+0x756ff9c5, 0x49e2c498, 0x31a84d05, 0x71e2c4c0,
+0xe2c4cb01, 0xc4cb0171, 0xcb0171e2, 0xcb75f1c5,
+0x1779e2c4, 0xc0920fca, 0x1901f883, 0x040125c0,
+0xc4810000, 0x000000ec, 0x5d5f5e5b, 0x24048bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0003554,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0x000650e8, 0xa3c78100,
+0x56000006, 0xecec8153, 0x89000000, 0xffff4885,
+0xd0b70fff, 0x000008bb, 0x01728d00, 0xc289d329,
+0x01e28340, 0x4af6b70f, 0x85dbb70f, 0xffff4885,
+0xd2b70fff, 0x66490175, 0x96457489, 0x6608f883,
+0xa6455c89, 0x45548966, 0x4c8966b6, 0xbb75c645,
+0x7d6ff9c5, 0x7ff9c598, 0xffff68bd, 0x76f1c5ff,
+0x6ff9c5c9, 0xffff689d, 0x0260b8ff, 0xe1c50000,
+0xe2c4d775, 0x0fd11779, 0x0005c583, 0xfde1c500,
+0xf9c59855, 0xff78957f, 0xf9c5ffff, 0xc598756f,
+0x01f671e9, 0x000266b8, 0x75e9c500, 0xffff7895,
+0x79e2c4ff, 0x830fd117, 0x00000596, 0xbd6ff9c5,
+0xffffff78, 0x55f9c1c5, 0x7ff9c598, 0x6bb88855,
+0xc5000002, 0x886575e1, 0x1779e2c4, 0x6f830fe1,
+0xc5000005, 0xa85debe1, 0x9d7ff9c5, 0xffffff68,
+0x55dbe9c5, 0x6ff9c5a8, 0xc9c58875, 0xc5a85def,
+0xc5ff76c1, 0x6895dfe9, 0xb8ffffff, 0x00000277,
+0xd375e9c5, 0xbd7ff9c5, 0xffffff48, 0x1779e2c4,
+0x2b830fd1, 0xc5000005, 0x98556ff9, 0x5dd5e9c5,
+0x02d3b8a8, 0xe1c50000, 0xffc09f75, 0xe2c4ffff,
+0x0fd91779, 0x00050983, 0xe4e9c500, 0xe9c5b865,
+0xc5b85ddb, 0xb85dfde1, 0x0002dcb8, 0x75e1c500,
+0x79e2c4dc, 0x830fd917, 0x000004e6, 0x557ff9c5,
+0x6ff9c588, 0xd9c58875, 0xc503f671, 0x68a57ff9,
+0xc5ffffff, 0x887d6ff9, 0xf771e1c5, 0x7ff9c502,
+0xffff789d, 0xfde1c5ff, 0x02f8b8db, 0xe1c50000,
+0xe2c4dc75, 0x0fd91779, 0x0004a583, 0x6ff9c500,
+0xffff68b5, 0x71e1c5ff, 0xe1c502d6, 0xfdb8dbfd,
+0xc5000002, 0x789d75e1, 0xc4ffffff, 0xd91779e2,
+0x047c830f, 0x85c70000, 0xffffff64, 0x00000003,
+0x9d6ef9c5, 0xffffff64, 0xdbf1e9c5, 0xff6485c7,
+0x0002ffff, 0xf9c50000, 0xff64a56e, 0xe9c5ffff,
+0xf9c5e4f1, 0xff78a57f, 0xd9c5ffff, 0x10b8e4fd,
+0xc5000003, 0xc4e375d9, 0xe11779e2, 0x0430830f,
+0xf9c50000, 0xff64a56e, 0xe1c5ffff, 0xe1c5dcd1,
+0x14b8dbfd, 0xc5000003, 0x789d75e1, 0xc4ffffff,
+0xd91779e2, 0x0408830f, 0xd9c50000, 0xd9c5e4ef,
+0xc5c85d75, 0xc5dc75e1, 0xc5fadbe1, 0x887d7ff9,
+0x6688458b, 0xff348589, 0xb70fffff, 0x858bc84d,
+0xffffff34, 0x92558b66, 0xb70fe0d3, 0x8589ca4d,
+0xffffff30, 0x8a458b66, 0x3c958966, 0xc5ffffff,
+0x309d6ef9, 0x8bffffff, 0xffff3c95, 0x858966ff,
+0xffffff44, 0xff44858b, 0xe0d3ffff, 0xcc4db70f,
+0xff188589, 0x458bffff, 0xd3c6898c, 0x4db70fe6,
+0x2cb589ce, 0x66ffffff, 0x668e758b, 0xff40b589,
+0x758bffff, 0x409d8b90, 0xd3ffffff, 0x4db70fe3,
+0x289d89d0, 0x89ffffff, 0x0fe3d3f3, 0x89d24db7,
+0xffff149d, 0x0fe2d3ff, 0x89d44db7, 0xffff1095,
+0x94558bff, 0xe3d3d389, 0xd64db70f, 0xff0c9d89,
+0x8b66ffff, 0x8966965d, 0xffff389d, 0x389d8bff,
+0xc5ffffff, 0x18a5c4e1, 0x01ffffff, 0x9d6ef9c5,
+0xffffff2c, 0xad6ef9c5, 0xffffff14, 0xb5c4e1c5,
+0xffffff28, 0x6ef9c501, 0xffff0cbd, 0xc4d1c5ff,
+0xffff109d, 0xd9c501ff, 0xe3d3e662, 0xebc4c1c5,
+0x62e1c501, 0x6cd9c5dd, 0x7ff9c5f3, 0xffff18b5,
+0x76c1c5ff, 0xfdc1c5ff, 0xf9c5c85d, 0x0fc85d7f,
+0x8bc84db7, 0xffff349d, 0x0fe3d3ff, 0x89ca4db7,
+0xffff349d, 0x449d8bff, 0xc5ffffff, 0x34a56ef9,
+0xd3ffffff, 0x4db70fe3, 0x449d89cc, 0x8bffffff,
+0xffff409d, 0xc4d9c5ff, 0xffff449d, 0xe0d301ff,
+0xce4db70f, 0xff308589, 0x858bffff, 0xffffff38,
+0xa56ef9c5, 0xffffff30, 0xb70fe3d3, 0x9d89d04d,
+0xffffff40, 0xff3c9d8b, 0xd9c5ffff, 0xff40bdc4,
+0xc501ffff, 0xd3df62e1, 0x4db70fe6, 0x6ef9c5d2,
+0x0fe3d3ee, 0xc5d44db7, 0x01e3c4d1, 0xb70fe2d3,
+0xf9c5d64d, 0xe0d3f26e, 0xe8c4c9c5, 0x62d9c501,
+0x6ce1c5e5, 0xfde1c5dc, 0x032cb8db, 0xe1c50000,
+0xff189d75, 0xe2c4ffff, 0x0fd91779, 0x00021183,
+0x69e2c400, 0xc4a85d3a, 0x653e69e2, 0xfde9c5a8,
+0xe1c5a855, 0x3fb8dcfd, 0xc5000003, 0xc4d275e1,
+0xd11779e2, 0x01e8830f, 0x54b80000, 0xc5000003,
+0xb86d6ff9, 0xa76ff9c5, 0xffffffd0, 0x0959e2c4,
+0x75e9c5d5, 0x79e2c4d5, 0x830fd117, 0x000001c2,
+0x000359b8, 0x70fbc500, 0xc51b9855, 0xa85d6ff9,
+0xd270fac5, 0x70f9c51b, 0xe1c54ed2, 0xe2c4d275,
+0x0fd11779, 0x00019983, 0x61e1c500, 0xe1c59875,
+0xc5985569, 0x4895fde9, 0xb8ffffff, 0x00000370,
+0xd6f9e9c5, 0xd5efe9c5, 0xadefd1c5, 0xffffff48,
+0xd5f9e9c5, 0x9775e9c5, 0xffffffe0, 0x1779e2c4,
+0x5b830fd1, 0xc4000001, 0x6d3379e2, 0x79e2c498,
+0xf9c5d533, 0xff78ad7f, 0xf9c5ffff, 0xc588557f,
+0x987d6ff9, 0x3379e2c4, 0x039ab8d7, 0xe9c50000,
+0xe2c4d575, 0x0fd11779, 0x00012583, 0x6ff9c500,
+0xe2c49875, 0xc5d63479, 0x68957ff9, 0xb8ffffff,
+0x000003a1, 0x5575e9c5, 0x79e2c488, 0x830fd117,
+0x000000fe, 0xf9c5c031, 0xa8986d6f, 0x6ff9c501,
+0xc50475d3, 0xc5d56ff9, 0xd8557ff9, 0x45548b66,
+0x948966d8, 0xffff7845, 0xf88340ff, 0xc5dc7508,
+0xb8d2efe9, 0x000003c4, 0x5564e9c5, 0x61e3c4b8,
+0xc520dd4c, 0x78ad6ff9, 0xc5ffffff, 0xc4db75d1,
+0xd91779e2, 0x00a8830f, 0xd4b80000, 0xc5000003,
+0x98556ff9, 0x0e69e3c4, 0xc5aaa85d, 0xc4eb75d1,
+0xe91779e2, 0x0088830f, 0xe3c40000, 0x02da0f69,
+0xafdbe9c5, 0xfffffff0, 0xe4fdd1c5, 0xdc75e1c5,
+0x0003e4b8, 0x79e2c400, 0x6673d917, 0x000003b8,
+0x7ff9c500, 0xffff6895, 0xefe1c5ff, 0x61e2c4db,
+0xff689501, 0xc548ffff, 0x68957ff9, 0x75ffffff,
+0xc5f9c5ec, 0xfa8307d2, 0x03f8b824, 0x32750000,
+0x7d6ff9c5, 0x41e2c498, 0x31a85505, 0x69e2c4c0,
+0xe2c4d301, 0xc4d30169, 0xd30169e2, 0xd375e9c5,
+0x1779e2c4, 0xc0920fd1, 0x1901f883, 0x040125c0,
+0xc4810000, 0x000000ec, 0x5d5f5e5b, 0x243c8bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0003314,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x04fde8c3,
+0xc1810000, 0x0000054e, 0x8955c031, 0x05bf57e5,
+0x56000000, 0x0020bb53, 0xec810000, 0x0000009c,
+0xfa89c689, 0x89c22940, 0xffff6095, 0x83f289ff,
+0xfa8301e2, 0x83d21901, 0x854a02e2, 0x4b0175f0,
+0xa4854489, 0xff60b58b, 0xf883ffff, 0x85548904,
+0x855c89c4, 0x857489d4, 0xc5c575b4, 0xa86d6ff9,
+0xad7ff9c5, 0xffffff78, 0xc976f1c5, 0x956ff9c5,
+0xffffff78, 0x000260b8, 0x76e9c500, 0x79e2c4dd,
+0x830fd917, 0x0000046c, 0x5dfee9c5, 0x7ff9c5a8,
+0xf9c5885d, 0xc5a86d6f, 0x01f572e1, 0x000266b8,
+0x76e1c500, 0xe2c4885d, 0x0fd91779, 0x00044383,
+0x6ff9c500, 0xc1c5887d, 0xc5a85dfa, 0x985d7ff9,
+0x00026bb8, 0x76e9c500, 0xe2c4985d, 0x0fd91779,
+0x00041f83, 0x6ff9c500, 0xe2c4b86d, 0xa8554069,
+0x4051e2c4, 0x6ff9c5e5, 0xe1c5a85d, 0xe1c5f5fe,
+0xc5b86dfa, 0xb8d4fae9, 0x00000282, 0x4051e2c4,
+0x76e9c5ee, 0x79e2c4d5, 0x830fd117, 0x000003e4,
+0x4061e2c4, 0xd3b8b855, 0xc5000002, 0xc09176e9,
+0xc4ffffff, 0xd11779e2, 0x03c6830f, 0xe1c50000,
+0xc5c855ef, 0xc5d07ef9, 0x78957ff9, 0xc4ffffff,
+0x552869e2, 0xb86df7b8, 0x8b984589, 0x5589c045,
+0x806df79c, 0xb8a04589, 0x000002ec, 0xc5a45589,
+0x985576e9, 0x1779e2c4, 0x85830fd1, 0xc4000003,
+0x654061e2, 0x7ff9c5c8, 0xf9c59865, 0xc5987d6f,
+0x03f772d1, 0xad7ff9c5, 0xffffff78, 0x7d6ff9c5,
+0x72e9c598, 0xf9c502f7, 0xc588557f, 0xb8d2fee9,
+0x000002f8, 0xd576e9c5, 0x1779e2c4, 0x41830fd1,
+0xc5000003, 0x78ad6ff9, 0xc5ffffff, 0x02e572e9,
+0xd2fee9c5, 0x0002fdb8, 0x76e9c500, 0xe2c48855,
+0x0fd11779, 0x00031b83, 0x7485c700, 0x03ffffff,
+0x8b000000, 0xffff7485, 0x608589ff, 0xc1ffffff,
+0x85891ff8, 0xffffff64, 0xad7efac5, 0xffffff60,
+0xd5f2d9c5, 0xff7485c7, 0x0002ffff, 0x858b0000,
+0xffffff74, 0xff608589, 0xf8c1ffff, 0x6485891f,
+0xc5ffffff, 0x60bd7efa, 0xc5ffffff, 0xc5e7f2d9,
+0x88657ff9, 0xe4fed9c5, 0x000310b8, 0x76d9c500,
+0x79e2c4e2, 0x830fe117, 0x000002a8, 0xff74858b,
+0x8589ffff, 0xffffff60, 0x891ff8c1, 0xffff6485,
+0x7efac5ff, 0xffff60a5, 0xe2e9c5ff, 0xfee9c5d4,
+0x0314b8d2, 0xe9c50000, 0xc4885576, 0xd11779e2,
+0x026e830f, 0xe2c40000, 0xc8654061, 0xedefd1c5,
+0x7d6ff9c5, 0x66c1c5d8, 0xdbe9c5d5, 0x7ff9c5d4,
+0xe2c49855, 0xd87d4769, 0x756ff9c5, 0x6ff9c5d8,
+0xffffd0a1, 0xfac9c5ff, 0x7ff9c5f4, 0xe2c4d875,
+0xd8554769, 0x00032cb8, 0xfee9c500, 0x76c9c5f2,
+0x79e2c4f7, 0x830ff117, 0x00000218, 0x4669e2c4,
+0x31b8d855, 0xc5000003, 0x985576e9, 0x1779e2c4,
+0xfd830fd1, 0xc5000001, 0xc8756ff9, 0x4049e2c4,
+0xe2c4b855, 0xc5fb4049, 0x88557ff9, 0x3d41e2c4,
+0xe2c48855, 0x887d3941, 0x7d7ff9c5, 0xfee9c588,
+0x48b88855, 0xc5000003, 0xb87dfee1, 0x4069e2c4,
+0x76e9c5d6, 0x79e2c4d7, 0x830fd117, 0x000001b4,
+0x4049e2c4, 0x7ff9c5f3, 0xffff78b5, 0x034fb8ff,
+0xe2c40000, 0x78951e79, 0xc5ffffff, 0xc4da76e1,
+0xd91779e2, 0x018a830f, 0x54b80000, 0xc5000003,
+0xc85d6ff9, 0x0a59e2c4, 0x76e1c5d3, 0x79e2c4d2,
+0x830fd117, 0x0000016c, 0x000359b8, 0x70f9c500,
+0xc51ba875, 0xb8556ff9, 0xf676e9c5, 0x1779e2c4,
+0x4d830ff1, 0xc5000001, 0xa87562e9, 0x7d6ae9c5,
+0xfac9c5a8, 0x0370b8f7, 0xe2c40000, 0xc5f34049,
+0xe0b176c9, 0xc4ffffff, 0xf11779e2, 0x0122830f,
+0xe2c40000, 0xa8754061, 0xfb66d1c5, 0xb57ff9c5,
+0xffffff78, 0xff62c9c5, 0xb56ff9c5, 0xffffff78,
+0x2579e2c4, 0x037ab8f6, 0xc9c50000, 0xe2c4f776,
+0x0ff11779, 0x0000eb83, 0x6ff9c500, 0xe3c4a875,
+0x8c551679, 0x79e3c401, 0x03945516, 0xdd66e1c5,
+0x757ef9c5, 0x69e3c488, 0xc430d64c, 0x751679e3,
+0xc4b80290, 0xc5000003, 0x885d6ff9, 0xd276e1c5,
+0x1779e2c4, 0xa9830fd1, 0xb8000000, 0x000003d4,
+0x556ff9c5, 0x69e3c4a8, 0xccb86d0e, 0xdd76e1c5,
+0x1779e2c4, 0x89830fd9, 0xc4000000, 0xca0f69e3,
+0xdbe9c504, 0xfffff099, 0xfee1c5ff, 0x76f1c5dc,
+0x03e4b8cb, 0xe1c50000, 0xe2c4db76, 0x73cb1779,
+0x7ff9c563, 0xffff7895, 0xefe9c5ff, 0x69e2c4d2,
+0xff788d02, 0xf9c5ffff, 0xff788d7f, 0xe2c4ffff,
+0x788d0269, 0xb8ffffff, 0x000003f8, 0x1679e3c4,
+0xfa8303ca, 0xc52d750a, 0xa8656ff9, 0x0659e2c4,
+0xc031b84d, 0x0271e2c4, 0x71e2c4ca, 0xf1c5ca02,
+0xe2c4ca76, 0x0fcb1779, 0xf883c092, 0x25c01901,
+0x00000401, 0x009cc481, 0x5e5b0000, 0x8bc35d5f,
+0x00c3240c, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0002554,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0454e8c3,
+0xc1810000, 0x0000049e, 0x000020ba, 0x55c03100,
+0xbf57e589, 0x00000005, 0xec815356, 0x0000009c,
+0xfb89c689, 0x89c32940, 0xffff649d, 0x83f389ff,
+0x854b01e3, 0x4a0175f0, 0xa4854489, 0xff64b58b,
+0xf883ffff, 0x855c8904, 0x855489c4, 0x857489d4,
+0xc5cd75b4, 0xa8756ff9, 0xb57ff9c5, 0xffffff78,
+0xc976f1c5, 0x9d6ff9c5, 0xffffff78, 0x000260b8,
+0x76e1c500, 0x79e2c4d6, 0x830fd117, 0x000003cb,
+0x55fee1c5, 0x7ff9c5a8, 0xf9c58855, 0xc5a87d6f,
+0x01f772e9, 0x000266b8, 0x76e9c500, 0xe2c48855,
+0x0fd11779, 0x0003a283, 0x6ff9c500, 0xc9c58875,
+0xc5a855fa, 0x98557ff9, 0x00026bb8, 0x76e1c500,
+0xe2c49865, 0x0fe11779, 0x00037e83, 0xebe1c500,
+0xf9c5b85d, 0xff789d7f, 0xe9c5ffff, 0xc5b855db,
+0x987d6ff9, 0x5defc1c5, 0x0277b8b8, 0xe9c50000,
+0xff7895df, 0xc9c5ffff, 0xe9c5f676, 0xe2c4d376,
+0x0fd11779, 0x00034283, 0x6ff9c500, 0xe2c4a855,
+0xb85d4069, 0x0002d3b8, 0x76e1c500, 0xffffc099,
+0x79e2c4ff, 0x830fd917, 0x0000031f, 0x5defe9c5,
+0x7ef9c5c8, 0x7ff9c5d8, 0xffff789d, 0xf4e1c5ff,
+0x65f7b85d, 0x984589b8, 0x89c0458b, 0x65f79c55,
+0xa0458980, 0x0002ecb8, 0xa4558900, 0x5d76e1c5,
+0x79e2c498, 0x830fd917, 0x000002df, 0x557ff9c5,
+0x6ff9c598, 0xd9c5987d, 0xc503f772, 0x78a57ff9,
+0xc5ffffff, 0x987d6ff9, 0xf772e1c5, 0x7ff9c502,
+0xe1c5885d, 0xf8b8dbfe, 0xc5000002, 0xc4dc76e1,
+0xd91779e2, 0x02a1830f, 0xf9c50000, 0xff78bd6f,
+0xe1c5ffff, 0xc502d772, 0xb8dbfee1, 0x000002fd,
+0x5d76e1c5, 0x79e2c488, 0x830fd917, 0x0000027b,
+0xff7485c7, 0x0003ffff, 0xf9c50000, 0xff749d6e,
+0xe9c5ffff, 0x85c7dbf2, 0xffffff74, 0x00000002,
+0xa56ef9c5, 0xffffff74, 0xe4f2e9c5, 0x657ff9c5,
+0xfed9c588, 0x0310b8e4, 0xd9c50000, 0xe2c4e376,
+0x0fe11779, 0x00023283, 0x6ef9c500, 0xffff74a5,
+0xd2e1c5ff, 0xfee1c5dc, 0x0314b8db, 0xe1c50000,
+0xc4885d76, 0xd91779e2, 0x020d830f, 0xd9c50000,
+0xd9c5e4ef, 0xc5d85d76, 0xc5dc76e1, 0xc4dadbe1,
+0x7d4761e2, 0xfec9c5d8, 0xf9c5d865, 0xc4d8657f,
+0x654761e2, 0x032cb8d8, 0xd9c50000, 0xd1c5ecfe,
+0xe2c4ef76, 0x0fe91779, 0x0001ce83, 0x59e2c400,
+0xb8d86545, 0x00000331, 0xdc76e1c5, 0x1779e2c4,
+0xb4830fd9, 0xc4000001, 0x5d3b69e2, 0x69e2c4b8,
+0xc5b8653f, 0xb855fee9, 0xdcfee1c5, 0x00033fb8,
+0x76e1c500, 0x79e2c4d2, 0x830fd117, 0x0000018b,
+0x000354b8, 0x6ff9c500, 0xf9c5c86d, 0xffd0a16f,
+0xe2c4ffff, 0xc5d50a59, 0xc4d576e9, 0xd11779e2,
+0x0165830f, 0x59b80000, 0xc5000003, 0xa85570f9,
+0x6ff9c51b, 0xe1c5b85d, 0xe2c4d276, 0x0fd11779,
+0x00014683, 0x62e1c500, 0xe1c5a87d, 0xc5a8556a,
+0xb8d2fec9, 0x00000370, 0xd7fae9c5, 0xd5efe9c5,
+0xeeefd1c5, 0xd5fae9c5, 0x9176e9c5, 0xffffffe0,
+0x1779e2c4, 0x10830fd1, 0xc4000001, 0x6d3579e2,
+0x6ff9c5a8, 0xe2c4a875, 0xb8d63579, 0x0000039a,
+0xd576e9c5, 0x1779e2c4, 0xec830fd1, 0xc5000000,
+0xa8556ff9, 0x1679e3c4, 0xc4018c5d, 0x5d1679e3,
+0xf9c50394, 0xc488557e, 0x551679e3, 0xd1c50290,
+0xc4b8edef, 0xc5000003, 0xc86d64d1, 0x4c61e3c4,
+0xf9c550da, 0xc588556f, 0xc4db76e9, 0xd91779e2,
+0x00a5830f, 0xd4b80000, 0xc5000003, 0xa85d6ff9,
+0x0e61e3c4, 0xc5ccb86d, 0xc4d576e9, 0xd11779e2,
+0x0085830f, 0xe3c40000, 0x04d30f61, 0xa9dbe1c5,
+0xfffffff0, 0xe4fed1c5, 0xd476e9c5, 0x0003e4b8,
+0x79e2c400, 0x6373d117, 0x9d7ff9c5, 0xffffff78,
+0xdbefe1c5, 0x0261e2c4, 0xffff7895, 0x7ff9c5ff,
+0xffff7895, 0x61e2c4ff, 0xff789502, 0xf8b8ffff,
+0xc4000003, 0xd21679e3, 0x0afa8303, 0xf9c52d75,
+0xc4a8756f, 0x550649e2, 0xc4c031b8, 0xd30269e2,
+0x0269e2c4, 0x76e9c5d3, 0x79e2c4d3, 0x920fd117,
+0x01f883c0, 0x0125c019, 0x81000004, 0x00009cc4,
+0x5f5e5b00, 0x0c8bc35d, 0x0000c324, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0002274,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x0004fce8, 0x3bc28100, 0x89000005, 0xa8ec81e5,
+0x89000000, 0xc031dc45, 0x4589c931, 0x89c031ec,
+0xc031d445, 0x31e44589, 0xc845c7c0, 0x00000001,
+0xc7cc4d89, 0x0002d845, 0x45c70000, 0x00003fe8,
+0xd045c700, 0x00000002, 0x01e045c7, 0xc7000000,
+0x003ef045, 0x45890000, 0x6ff9c5f4, 0xf9c5c85d,
+0xc5985d7f, 0xc5c976f1, 0x98656ff9, 0x000260b8,
+0x59e2c400, 0xe2c4d329, 0x0fd11779, 0x00047e83,
+0xd4d9c500, 0xf9c5c855, 0xc5a8557f, 0xc85d6ff9,
+0xf373e9c5, 0x0266b801, 0xe2c40000, 0xa8552969,
+0x1779e2c4, 0x54830fd1, 0xc5000004, 0xa86d6ff9,
+0x55fbd1c5, 0x7ff9c5c8, 0x6bb8b855, 0xc4000002,
+0x552959e2, 0x79e2c4b8, 0x830fd117, 0x0000042f,
+0x7d6ff9c5, 0x73e9c5c8, 0xd1c520d4, 0xc520d773,
+0xc855f4e9, 0x5df4d9c5, 0xf4d1c5c8, 0xd4e9c5e4,
+0x6ff9c5d4, 0xd9c5d865, 0xe9c5ecf4, 0xc520f273,
+0xc5dad4e1, 0x20d473e9, 0xd4f4e9c5, 0xd2d4e9c5,
+0xf273e9c5, 0xd4d1c520, 0x7ff9c5ea, 0xffff78ad,
+0x6ff9c5ff, 0xe9c5c855, 0xe9c5fcd4, 0xc5d875fb,
+0x20d773d1, 0x9dfbe1c5, 0xffffff78, 0x000282b8,
+0xf4c9c500, 0xf4d1c5e7, 0x7ff9c5ee, 0xffff68a5,
+0x73d9c5ff, 0xd9c520d6, 0xd9c5e7f4, 0xd9c5e5d4,
+0xc520f473, 0x68a5d4d9, 0xc4ffffff, 0xdc2961e2,
+0x1779e2c4, 0x84830fd9, 0xc5000003, 0xd85d6ff9,
+0xd273d9c5, 0x73c9c520, 0xd9c520d3, 0xc5d85df4,
+0xc5f2f4c9, 0xd86df4e9, 0xded4e1c5, 0xf373e1c5,
+0xd4d1c520, 0x02d3b8db, 0xe2c40000, 0xd09a2961,
+0xc4ffffff, 0xd91779e2, 0x0341830f, 0x85c70000,
+0xffffff78, 0xffffffff, 0x85c7c031, 0xffffff7c,
+0xffffffff, 0xff6885c7, 0x0001ffff, 0x85890000,
+0xffffff6c, 0x9d7efac5, 0xffffff68, 0x9d16e0c5,
+0xffffff78, 0xd373c1c5, 0xf4e9c520, 0xf4d9c5eb,
+0xf4c1c5f3, 0xd4c9c5d2, 0x73c9c5f2, 0xd1c520f6,
+0xf9c5f6d4, 0xc5b8757f, 0xb87d6ff9, 0xf773c1c5,
+0x7ff9c503, 0xf9c5987d, 0xc5b8756f, 0x02f673c9,
+0x757ff9c5, 0xd4c9c5a8, 0x02f8b8f6, 0xe2c40000,
+0xc5f72949, 0xc4fbf4d9, 0xf11779e2, 0xbd7ff9c5,
+0xffffff78, 0x02a5830f, 0xf9c50000, 0xc5987d6f,
+0x02d773c9, 0x7d6ff9c5, 0x72c1c598, 0xe3c402e7,
+0xccf70e49, 0xf6d4c9c5, 0x0002fdb8, 0x49e2c400,
+0xc4a87529, 0xf11779e2, 0x0271830f, 0xe9c50000,
+0xff78bdd4, 0x45c7ffff, 0x00000394, 0x73c1c500,
+0xd1c520f7, 0x458bffd4, 0x68858994, 0xc1ffffff,
+0x85891ff8, 0xffffff6c, 0xb57efac5, 0xffffff68,
+0xf6f3c1c5, 0x029445c7, 0x8b000000, 0x85899445,
+0xffffff68, 0x891ff8c1, 0xffff6c85, 0x7efac5ff,
+0xffff68a5, 0xf3c1c5ff, 0x7ff9c5fc, 0xc1c5a87d,
+0x10b8ffd4, 0xc4000003, 0xfe2941e2, 0x1779e2c4,
+0xf8830ff9, 0x8b000001, 0xc1c5944d, 0xe2c4ffef,
+0xc5e63741, 0x58a57ff9, 0x89ffffff, 0xffff688d,
+0xc1c889ff, 0x85891ff8, 0xffffff6c, 0x000040b8,
+0x7efac500, 0xffff68a5, 0xc5c829ff, 0xc5e4d3c9,
+0x68a57ff9, 0xc5ffffff, 0xc5f06ef9, 0x58a56ff9,
+0xc5ffffff, 0xc5f6f3d9, 0x68b5ebc9, 0xc5ffffff,
+0xb8f6d4c9, 0x00000314, 0x2949e2c4, 0xe2c4a875,
+0x0ff11779, 0x00018683, 0xd4e9c500, 0xffff7895,
+0x73e9c5ff, 0xd1c520f2, 0xf9c5d2d4, 0xc4e86d6f,
+0xef3751e2, 0xeadbd1c5, 0x6d7ff9c5, 0xd1e2c4b8,
+0xc5e85547, 0xe87d6ff9, 0xb26ff9c5, 0xffffffe0,
+0xe6fbc1c5, 0x657ff9c5, 0xd1e2c4e8, 0xb8e86d47,
+0x0000032c, 0x6d7ff9c5, 0xd4d1c5a8, 0x51e2c4ed,
+0xe2c4ea29, 0x0fe91779, 0x00012283, 0x6ff9c500,
+0xf9c5a84d, 0xfff0926f, 0xe2c4ffff, 0xe84d45f1,
+0x45e9e2c4, 0xd9c5e855, 0x31b8e476, 0xc5000003,
+0xc5caeff1, 0xc4cafbf1, 0x4d2971e2, 0x79e2c4b8,
+0x830fcc17, 0x000000e7, 0x000359b8, 0x70f9c500,
+0xc54ec855, 0xd84d6ff9, 0x2971e2c4, 0x79e2c4d2,
+0x830fd417, 0x000000c7, 0x7d6cf1c5, 0x6df1c5c8,
+0xc1c5c855, 0x70b8fafb, 0xc5000003, 0xc5ebf4c1,
+0x20d773e9, 0xad7ff9c5, 0xffffff78, 0xd373d1c5,
+0xf4e9c520, 0xf4d1c5d3, 0xd4e9c5ef, 0x73e9c5d5,
+0xe9c520f2, 0xff7895d4, 0xe2c4ffff, 0xc4d62969,
+0xd41779e2, 0xf8c57973, 0xc5b04d17, 0xc5d2efe9,
+0xc86d7efa, 0x3761e2c4, 0xd6f9c5da, 0xe3c4a86d,
+0xc84d4c71, 0x6ff9c530, 0xc4b8a855, 0xc4000003,
+0xc92969e2, 0x1779e2c4, 0xb84473cc, 0x000003d4,
+0x4d6ff9c5, 0x71e3c4c8, 0xf0d85d0e, 0x2969e2c4,
+0x79e2c4d3, 0x2773d417, 0x0f71e3c4, 0xc03108d1,
+0xcedbf1c5, 0xced4f1c5, 0x2971e2c4, 0x79e2c4ca,
+0x920fcc17, 0x01f883c0, 0xe425c019, 0xc9000003,
+0x24148bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0002534,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x000359e8, 0x8bc28100, 0x89000003, 0x88ec81e5,
+0x89000000, 0xc031cc45, 0x4589c931, 0x89c031ec,
+0xc031d445, 0x31e44589, 0xc845c7c0, 0x00000001,
+0x02d845c7, 0x89000000, 0x45c7dc4d, 0x00003fe8,
+0xd045c700, 0x00000002, 0x01e045c7, 0xc7000000,
+0x003ef045, 0x45890000, 0x6ff9c5f4, 0xf9c5c875,
+0xc598757f, 0xc5c976f1, 0x985d6ff9, 0x000260b8,
+0x61e2c400, 0xe2c4d629, 0x0fd11779, 0x0002db83,
+0xd4e1c500, 0xf9c5c855, 0xc5a8557f, 0xc87d6ff9,
+0xf773e9c5, 0x0266b801, 0xe2c40000, 0xa8552969,
+0x1779e2c4, 0xb1830fd1, 0xc5000002, 0xa8756ff9,
+0x55fbc9c5, 0x7ff9c5c8, 0x6bb8b855, 0xc4000002,
+0x652961e2, 0x79e2c4b8, 0x830fe117, 0x0000028c,
+0x5debe1c5, 0x7ff9c5d8, 0xe9c5985d, 0xc5d855db,
+0xb87d6ff9, 0x5defc1c5, 0x0277b8d8, 0xe9c50000,
+0xe9c5d1ef, 0xc49855db, 0xd32969e2, 0x1779e2c4,
+0x55830fd1, 0xc5000002, 0xc8556ff9, 0x756ff9c5,
+0x73e1c5d8, 0xe1c520d2, 0xc5d85df4, 0x20d673d1,
+0x65f4e9c5, 0xf4d1c5d8, 0xd4e1c5ea, 0x73e1c5dd,
+0xd9c520f3, 0xd3b8dbd4, 0xc4000002, 0x9a2961e2,
+0xffffffe0, 0x1779e2c4, 0x0d830fd9, 0xc5000002,
+0xb8557ff9, 0x7d6ff9c5, 0x73d9c5b8, 0xf9c503f7,
+0xc598657f, 0xb8756ff9, 0xf673e1c5, 0x7ff9c502,
+0xe1c5a85d, 0xf8b8dbd4, 0xc4000002, 0xdc2961e2,
+0x1779e2c4, 0xd1830fd9, 0xc5000001, 0x987d6ff9,
+0xd773e1c5, 0xd4e1c502, 0x02fdb8db, 0xe2c40000,
+0xa85d2961, 0x1779e2c4, 0xad830fd9, 0xc7000001,
+0x00039445, 0xf9c50000, 0xc5945d6e, 0xc7dbf3e9,
+0x00029445, 0xf9c50000, 0xc594656e, 0xc5d4f3e9,
+0xa8557ff9, 0xd2d4e9c5, 0x000310b8, 0x69e2c400,
+0xe2c4d329, 0x0fd11779, 0x00016f83, 0x6ef9c500,
+0xe1c59455, 0xe9c5d2d3, 0x14b8d2d4, 0xc4000003,
+0x552969e2, 0x79e2c4a8, 0x830fd117, 0x0000014c,
+0xdbefe1c5, 0x2961e2c4, 0xe2c4e855, 0xc5d32969,
+0xc855dbe9, 0x557ff9c5, 0xe9e2c4b8, 0xc5e85d47,
+0xe865d4f1, 0x657ff9c5, 0xe9e2c4e8, 0xb8e85547,
+0x0000032c, 0x557ff9c5, 0xd4e9c5a8, 0x69e2c4d2,
+0xe2c4d329, 0x0fd11779, 0x0000ff83, 0x6ff9c500,
+0xe2c4a875, 0xe85545c9, 0x000331b8, 0x69e2c400,
+0xc4b85529, 0xd11779e2, 0x00de830f, 0x59b80000,
+0xc5000003, 0xc85570f9, 0x6ff9c54e, 0xe2c4d85d,
+0xc4d22961, 0xd11779e2, 0x00be830f, 0x45c70000,
+0xffffff80, 0x8445c7ff, 0xffffffff, 0x657efac5,
+0x7efac580, 0x6ce1c5e4, 0xe1c5c86d, 0xc5c8556d,
+0xb8d2d4f1, 0x00000370, 0xd5fbe9c5, 0xe9efd9c5,
+0xd4efe9c5, 0xd5fbe9c5, 0xaa6ff9c5, 0xfffffff0,
+0x2969e2c4, 0x79e2c4d5, 0x7073d117, 0x5d17f8c5,
+0x7efac5b0, 0xe3c4c87d, 0xc85d4c61, 0xd6f9c540,
+0xc4b8a87d, 0xc5000003, 0xa8656ff9, 0x2959e2c4,
+0x79e2c4db, 0x4473d917, 0x0003d4b8, 0x6ff9c500,
+0xe3c4c855, 0xd85d0e69, 0x59e2c4f0, 0xe2c4e329,
+0x73e11779, 0x69e3c427, 0x3108da0f, 0xdbe9c5c0,
+0xd4e9c5d5, 0x69e2c4d5, 0xe2c4d329, 0x0fd11779,
+0xf883c092, 0x25c01901, 0x000003e4, 0x148bc3c9,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0001654,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x049ae8c3,
+0xc2810000, 0x0000053e, 0x8955e8d9, 0x78ec83e5,
+0xd9c855d9, 0xffff6082, 0xd855d9ff, 0x55d9c9d9,
+0xc082d9e8, 0xd9ffffff, 0x82d9cc55, 0xffffff64,
+0xd9dc55d9, 0xd9e0d9e8, 0xc9d9ec55, 0xd9d05dd9,
+0xe05dd9c9, 0x55d9c9d9, 0xd9cad9f0, 0xc9d9d45d,
+0xd9e45dd9, 0xf8c5f45d, 0xc5c87d28, 0x987d29f8,
+0x5528f8c5, 0x76f1c598, 0x0260b8c9, 0xe8c50000,
+0xc400dfc2, 0xd90e79e2, 0x041c830f, 0xe8c50000,
+0xc5c85d58, 0xa85d29f8, 0x7d28f8c5, 0x0266b8c8,
+0xc0c50000, 0xe0c5df58, 0x00a85dc2, 0x0e79e2c4,
+0xf3830fd9, 0xc5000003, 0xa87d28f8, 0x5d5cc0c5,
+0x29f8c5c8, 0xe8c5b85d, 0x00b85dc2, 0x00026bb8,
+0x79e2c400, 0x830fd90e, 0x000003ce, 0x6528f8c5,
+0x59e8c5d8, 0xd8c5c855, 0xf8c5e459, 0xc5c85d28,
+0xd87558e0, 0x6d5ce0c5, 0x0282b8d8, 0xe8c50000,
+0xd0c5d45c, 0xe8c5ee59, 0xc400d5c2, 0xd10e79e2,
+0x0394830f, 0xe0c50000, 0xc5e85559, 0x985529f8,
+0x5d5ee0c5, 0x028bb8e8, 0xe8c50000, 0xc400d3c2,
+0xd10e79e2, 0x0370830f, 0xf8c50000, 0xff709a28,
+0x8eb8ffff, 0xc5000002, 0xe86528f8, 0xd357d8c5,
+0x5559e8c5, 0x57e0c598, 0xe8c5c85d, 0xc400d3c2,
+0xd10e79e2, 0x0340830f, 0xf8c50000, 0xc5c85553,
+0x985529f8, 0x5553f8c5, 0x0296b898, 0xf8c50000,
+0xc5c85d28, 0xc5d25bf9, 0xc5d25bf8, 0x00d3c2e8,
+0x0e79e2c4, 0x0f830fd1, 0xc5000003, 0xc5d359e0,
+0x985529f8, 0x5552f8c5, 0x29f8c598, 0xf8c5a855,
+0xb8a85528, 0x0000029d, 0xea53f8c5, 0xed5bf9c5,
+0xed5bf8c5, 0xddc2e0c5, 0x79e2c400, 0x830fd90e,
+0x000002d6, 0xda5bf9c5, 0x5528f8c5, 0x029fb8c8,
+0xf8c50000, 0xf8c5db5b, 0xf9c5ea53, 0xf8c5ed5b,
+0xe0c5ed5b, 0xc400ddc2, 0xd90e79e2, 0x02a8830f,
+0xe8c50000, 0xf8c5da59, 0xc5985d29, 0x985d51f8,
+0x0002a7b8, 0xc2e0c500, 0xe2c400da, 0x0fd90e79,
+0x00028583, 0x28f8c500, 0xffff80aa, 0x5ed0c5ff,
+0x29f8c5da, 0xe3c4985d, 0x985d0879, 0xc2e0c50b,
+0xffff909a, 0xafb800ff, 0xc4000002, 0xd90e79e2,
+0x0254830f, 0xd8c50000, 0xc5d85d59, 0xc5f259d8,
+0xa85d29f8, 0x5d5fc8c5, 0x5dc8c5a8, 0xf8c5a875,
+0xc5a87529, 0xa85d58e0, 0x000348b8, 0x58e8c500,
+0xe0c5d855, 0xe0c5dc59, 0xc400d2c2, 0xd10e79e2,
+0x0214830f, 0xe3c40000, 0xc8550479, 0x0359b81b,
+0xe8c50000, 0x00d855c2, 0x0e79e2c4, 0xf7830fd1,
+0xc5000001, 0xd85528f8, 0x00035eb8, 0x5bf9c500,
+0xfae1c5da, 0xffffa09a, 0x28f8c5ff, 0xe2c4c875,
+0xc5db0c49, 0x00dbc2e8, 0x0e79e2c4, 0xc7830fd9,
+0xc5000001, 0xb09a10fa, 0xb8ffffff, 0x00000362,
+0xf658e8c5, 0x1879e2c4, 0xc2c8c5db, 0xe2c400f3,
+0x0ff10e79, 0x0001a183, 0x14e8c500, 0xe8c5c85d,
+0xc5c87515, 0xb8de5ce0, 0x00000370, 0xdc59e0c5,
+0x9ac2e0c5, 0xffffffc0, 0x79e2c400, 0x830fd90e,
+0x00000176, 0x5d12fac5, 0x28f8c5c8, 0xffffd0b2,
+0x03b1b8ff, 0xc8c50000, 0xf8c5f458, 0xffe0ba28,
+0xc8c5ffff, 0xe0c5f759, 0xc5c85d5c, 0x00dec2e0,
+0x0e79e2c4, 0x3f830fd9, 0xc5000001, 0xc85d16fa,
+0xed58d8c5, 0x0003b8b8, 0x28f8c500, 0xd0c5c875,
+0xe0c5ef59, 0xe0c5de5c, 0xc400ddc2, 0xd90e79e2,
+0x0114830f, 0xfac50000, 0xc5a87511, 0xc4db57e0,
+0x551779e3, 0xe3c401ac, 0xb4551779, 0x79e3c403,
+0x02b07517, 0x0003c4b8, 0xc2e0c500, 0xe3c401dc,
+0x30d64a69, 0x5d28f8c5, 0xc2e0c5a8, 0xe2c400d2,
+0x0fd10e79, 0x0000d183, 0x28f8c500, 0xd4b8c87d,
+0xc4000003, 0x550c41e3, 0xe0c50ad8, 0xc400dac2,
+0xd90e79e2, 0x00b0830f, 0xf8c50000, 0xc5c86528,
+0xd84dd0db, 0x7d28f8c5, 0x76e1c5c8, 0x03ddb8db,
+0xc3c50000, 0xc5d855d0, 0x00cac2f0, 0x0e79e2c4,
+0x83830fcb, 0xc5000000, 0xc85528f8, 0x0003ecb8,
+0x69e3c400, 0xf1d84d40, 0x8ac2f0c5, 0xfffffff0,
+0x79e2c400, 0x6273cb0e, 0x5529f8c5, 0x57e8c598,
+0x7cebc5d2, 0xf8c5984d, 0xc5984d29, 0x984d7ceb,
+0xff6882d9, 0xe3c4ffff, 0x944d1779, 0x9445d903,
+0xd8dde9df, 0x2d752f7a, 0x6528f8c5, 0xc5c031c8,
+0xd84d7ddb, 0xca7cf3c5, 0xca7cf3c5, 0xcac2f0c5,
+0x79e2c400, 0x920fcb0e, 0x01f883c0, 0x0125c019,
+0xeb000004, 0x03f8b805, 0xc3c90000, 0xc324148b,
+0x40800000, 0x40400000, 0x41200000, 0x00000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x40a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002534,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x042de8c3,
+0xc2810000, 0x000004be, 0xc031e8d9, 0x83e58955,
+0x55dd78ec, 0xf04589c8, 0x00f445c7, 0xd9bff000,
+0xffff8082, 0xd855ddff, 0x55ddc9d9, 0xddc9d9e8,
+0x5dddd05d, 0x28f9c5e0, 0xf9c5c87d, 0xc5987d29,
+0xc5c976f1, 0x985528f9, 0x000260b8, 0xc2e9c500,
+0xe2c400df, 0x0fd90f79, 0x0003d083, 0x58e9c500,
+0xf9c5c85d, 0xb8a85d29, 0x00000266, 0x7d28f9c5,
+0x58c1c5c8, 0xc2e1c5df, 0xc400a85d, 0xd90f79e2,
+0x03a7830f, 0xf9c50000, 0xc5a87d28, 0xc85d5cc1,
+0x5d29f9c5, 0x026bb8b8, 0xe9c50000, 0x00b85dc2,
+0x0f79e2c4, 0x82830fd9, 0xc5000003, 0xd87d28f9,
+0x5559e9c5, 0x59c1c5c8, 0x28f9c5e7, 0xe1c5c85d,
+0x82b8f758, 0xc5000002, 0xd86d5ce1, 0xd45ce9c5,
+0xee59d1c5, 0xd5c2e9c5, 0x79e2c400, 0x830fd10f,
+0x00000349, 0x5559e1c5, 0x29f9c5e8, 0x8bb89855,
+0xc5000002, 0xe85d5ee1, 0xd3c2e9c5, 0x79e2c400,
+0x830fd10f, 0x00000325, 0x00028eb8, 0x28f9c500,
+0xffff90a2, 0x28f9c5ff, 0xe1c5e85d, 0xd9c5d457,
+0xc5c86557, 0x985559e9, 0xd4c2e9c5, 0x79e2c400,
+0x830fd10f, 0x000002f5, 0x555af9c5, 0x53f8c5c8,
+0x5af8c5d2, 0x29f9c5d2, 0xf9c59855, 0xc598555a,
+0xc5d253f8, 0xc86528f9, 0x000296b8, 0x5af8c500,
+0xe6fbc5d2, 0xe6fac5d2, 0xc2e9c5d2, 0xe2c400d4,
+0x0fd10f79, 0x0002b483, 0x59d9c500, 0x29f9c5d4,
+0xf9c59855, 0xc598555a, 0xc5d252f8, 0xc5d25af8,
+0xa85529f9, 0x6d28f9c5, 0x5af9c5a8, 0x029db8d5,
+0xf8c50000, 0xf8c5d253, 0xfbc5d25a, 0xfac5d2e6,
+0xd9c5d2e6, 0xc400e2c2, 0xe10f79e2, 0x026b830f,
+0xf9c50000, 0xc5c86528, 0xc5d45af9, 0xb8ede6fb,
+0x0000029f, 0xede6fac5, 0xd253f8c5, 0xd25af8c5,
+0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5, 0x79e2c400,
+0x830fe90f, 0x00000235, 0xd459d9c5, 0x5529f9c5,
+0x02a7b898, 0xf9c50000, 0xc5985551, 0x00d4c2e9,
+0x0f79e2c4, 0x12830fd1, 0xc5000002, 0xa0aa28f9,
+0xc5ffffff, 0xc5d45ed1, 0x985529f9, 0x0002afb8,
+0x79e3c400, 0x0b985509, 0x92c2e9c5, 0xffffffb0,
+0x79e2c400, 0x830fd10f, 0x000001e1, 0x5559e1c5,
+0x59e1c5d8, 0x29f9c5f4, 0xc9c5a855, 0xc5a8555f,
+0xa8755dc9, 0x7529f9c5, 0x0348b8a8, 0xe9c50000,
+0xc5a85558, 0xd86558d9, 0xd359e9c5, 0xd4c2e9c5,
+0x79e2c400, 0x830fd10f, 0x000001a1, 0x000359b8,
+0x79e3c400, 0x01c85505, 0x55c2e9c5, 0xe2c400d8,
+0x0fd10f79, 0x00018483, 0x28f9c500, 0xfbc5d855,
+0xd9c5e2e6, 0xffc0a2fa, 0xf9c5ffff, 0xb8c87d28,
+0x0000035e, 0x2579e2c4, 0x73d9c5e4, 0xe2c401f4,
+0xc5e40d41, 0x00e4c2e9, 0x0f79e2c4, 0x4a830fe1,
+0xc5000001, 0xc86516e9, 0x7d28f9c5, 0x15e9c5c8,
+0x0370b8f7, 0xd9c50000, 0xd9c5e65c, 0xd9c5e359,
+0xc400e5c2, 0xe10f79e2, 0x011f830f, 0x0ff20000,
+0xb8c86512, 0x000003b1, 0x6d28f9c5, 0x58e1c5c8,
+0xffffd0b2, 0x5cd9c5ff, 0x59c9c5e5, 0xffffe0b2,
+0xc2d9c5ff, 0xe2c400e6, 0x0fe10f79, 0x0000ec83,
+0x17f9c500, 0xf9c5b055, 0xc5a86d13, 0xb8e457d9,
+0x000003c4, 0xdbc2d9c5, 0x69e3c401, 0xc530d54b,
+0xa85d28f9, 0xd2c2e1c5, 0x79e2c400, 0x830fd10f,
+0x000000b9, 0x0003d4b8, 0x28f9c500, 0xe3c4c87d,
+0xd8550d41, 0xc2e1c502, 0xe2c400da, 0x0fd90f79,
+0x00009883, 0x28f9c500, 0xc9c5c875, 0xb8d855d0,
+0x000003dd, 0x7d28f9c5, 0xd0c1c5c8, 0xe9c5d85d,
+0xc400d3c2, 0xd10f79e2, 0xecb87373, 0xc5000003,
+0xc85d28f9, 0x4161e3c4, 0xc531d855, 0xf092c2e9,
+0x00ffffff, 0x0f79e2c4, 0xc55273d1, 0x985d29f9,
+0x4d7cd9c5, 0x17f9c598, 0x82d9904d, 0xffffff84,
+0xdf9045dd, 0x7ad8dde9, 0x312d752f, 0x28f9c5c0,
+0xe9c5c875, 0xc9c5d276, 0xc5d84d7d, 0xc5cc7cf1,
+0x00ccc2f1, 0x0f79e2c4, 0xc0920fca, 0x1901f883,
+0x040125c0, 0x05eb0000, 0x0003f8b8, 0x8bc3c900,
+0x00c32414, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002334,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x0b67e857,
+0xc7810000, 0x00000bee, 0x53f63156, 0x81e0e483,
+0x0002a0ec, 0x249c8d00, 0x0000027f, 0x20349488,
+0xb0000002, 0x88d02821, 0x02403484, 0xf0890000,
+0x8301e083, 0xc01901f8, 0xc8fe0224, 0x60348488,
+0x8d000002, 0xc6210146, 0x8301fe83, 0xc2fe00d9,
+0x83030c88, 0x047420f8, 0xc0ebc689, 0xac6ffdc5,
+0x00022024, 0x7ffdc500, 0x01c024ac, 0xcdc50000,
+0xfdc5f676, 0xc024946f, 0xb8000001, 0x00000260,
+0xcd74edc5, 0xb47ffdc5, 0x00016024, 0x7de2c400,
+0x830fce17, 0x00000ac9, 0x8cfcedc5, 0x00022024,
+0x7ffdc500, 0x01e0248c, 0xfdc50000, 0x2024ac6f,
+0xc5000002, 0xb8cdfcd5, 0x00000266, 0x8c74f5c5,
+0x0001e024, 0x7de2c400, 0x830fce17, 0x00000a91,
+0xbc6ffdc5, 0x0001e024, 0xf8c5c500, 0x0220248c,
+0xfdc50000, 0x00248c7f, 0xb8000002, 0x0000026b,
+0x9474edc5, 0x00020024, 0x7de2c400, 0x830fd617,
+0x00000a5d, 0xac6ffdc5, 0x00026024, 0x6ffdc500,
+0x022024b4, 0xd5c50000, 0xfdc5fd60, 0x8024b47f,
+0xc5000001, 0x24bc7ffd, 0x00000120, 0xa46ffdc5,
+0x00018024, 0x68d5c500, 0x60ddc5f5, 0x7ffdc5cc,
+0x010024b4, 0xf5c50000, 0x20248cd5, 0xc5000001,
+0xc5d468dd, 0x80af6ffd, 0xc5ffffff, 0x2494d5ed,
+0x00000100, 0xbf6ffdc5, 0xffffffa0, 0xac7ffdc5,
+0x0000e024, 0x7ffdc500, 0x00c024bc, 0xe2c40000,
+0xc5cd0075, 0x24ac6ffd, 0x00000280, 0x006de2c4,
+0x75e3c4d7, 0xc5cce202, 0xc5c9eff1, 0x24a47ffd,
+0x00000140, 0xc964d5c5, 0xb4dbf5c5, 0x00014024,
+0x7ffdc500, 0x020024b4, 0x848a0000, 0x00020024,
+0x24848800, 0x000001a0, 0x80248c8a, 0x8a000002,
+0x0202249c, 0x948a0000, 0x00020424, 0x8ae0d200,
+0x0281248c, 0x84880000, 0x0000a024, 0x24848a00,
+0x00000201, 0x8c8ae0d2, 0x00028224, 0x24848800,
+0x00000080, 0x0324848a, 0xd2000002, 0x248c8ae3,
+0x00000283, 0xcb6ef9c5, 0x8c8ae0d2, 0x00028424,
+0x24448800, 0x24848a70, 0x00000205, 0x8c8ae2d2,
+0x00028524, 0x6ef9c500, 0x8ae0d2e2, 0x0286248c,
+0x44880000, 0x848a6c24, 0x00020624, 0x8ae0d200,
+0x0287248c, 0x44880000, 0x848a6824, 0x00020724,
+0x8ae0d200, 0x0288248c, 0x44880000, 0x848a6424,
+0x00020824, 0x8ae0d200, 0x0289248c, 0x44880000,
+0x848a6024, 0x00020924, 0x8ae0d200, 0x028a248c,
+0x44880000, 0x848a5c24, 0x00020a24, 0x8ae0d200,
+0x028b248c, 0x44880000, 0x848a5824, 0x00020b24,
+0x88e0d200, 0x8a542444, 0x028c248c, 0x848a0000,
+0x00020c24, 0x8ae0d200, 0x028d248c, 0x44880000,
+0x848a5024, 0x00020d24, 0x8ae0d200, 0x028e248c,
+0x44880000, 0x848a4c24, 0x00020e24, 0x8ae0d200,
+0x028f248c, 0x44880000, 0x848a4824, 0x00020f24,
+0x8ae0d200, 0x0290248c, 0x44880000, 0x848a4424,
+0x00021024, 0x8ae0d200, 0x0291248c, 0x44880000,
+0x848a4024, 0x00021124, 0x8ae0d200, 0x0292248c,
+0x44880000, 0x848a3f24, 0x00021224, 0x8ae0d200,
+0x0293248c, 0x44880000, 0x848a3824, 0x00021324,
+0x8ae0d200, 0x0294248c, 0x44880000, 0x848a3424,
+0x00021424, 0x8ae0d200, 0x0295248c, 0x44880000,
+0x848a3024, 0x00021524, 0x8ae0d200, 0x0296248c,
+0x44880000, 0x848a2c24, 0x00021624, 0x88e0d200,
+0x8a282444, 0x0297248c, 0xe3c40000, 0x247c2071,
+0x848a0170, 0x00021724, 0x59e3c400, 0x6c246420,
+0x24b48b01, 0x000000a0, 0xbc7ff9c5, 0x0000a024,
+0x8ae0d200, 0x0298248c, 0x44880000, 0x848a2424,
+0x00021824, 0x6ef9c500, 0x69e3c4d6, 0x80249420,
+0x01000000, 0x8c8ae0d2, 0x00029924, 0x24448800,
+0x24848a20, 0x00000219, 0x8c8ae0d2, 0x00029a24,
+0x24448800, 0x24848a1c, 0x0000021a, 0x8c8ae0d2,
+0x00029b24, 0x24448800, 0x24848a18, 0x0000021b,
+0x8c8ae0d2, 0x00029c24, 0x24448800, 0x24848a14,
+0x0000021c, 0x8c8ae0d2, 0x00029d24, 0x24448800,
+0x24848a10, 0x0000021d, 0x8c8ae0d2, 0x00029e24,
+0x24448800, 0x24848a0c, 0x0000021e, 0x8c8ae0d2,
+0x00029f24, 0x24448800, 0x24848a08, 0x0000021f,
+0xc188e0d2, 0x6824448b, 0xf86ef9c5, 0x2041e3c4,
+0x0164247c, 0x6024448b, 0x9461e9c5, 0x0000a024,
+0x61d9c500, 0x62e9c5e7, 0x6ef9c5d4, 0x24448bc8,
+0x71e3c458, 0x5c244c20, 0x6ef9c501, 0x24448bf0,
+0x49e3c450, 0x54247420, 0x61f1c501, 0x6ef9c5ce,
+0x24448bd8, 0x61e3c448, 0x4c245c20, 0x6ef9c501,
+0x24448be8, 0x51e3c440, 0x44246c20, 0x61e1c501,
+0x62f1c5dd, 0x6ce9c5cb, 0x7ff9c5d9, 0x00a0249c,
+0xf9c50000, 0x448bc86e, 0xe3c43824, 0x244c2071,
+0xf9c5013f, 0x448bd06e, 0xe3c43024, 0x24642069,
+0xf9c50134, 0x8024a47f, 0xc5000000, 0x248c61f1,
+0x00000080, 0xe06ef9c5, 0x2824448b, 0x2059e3c4,
+0x012c2464, 0xf86ef9c5, 0x2024448b, 0x2041e3c4,
+0x0124247c, 0xe761d9c5, 0xcc62f1c5, 0xd06ef9c5,
+0x1824448b, 0x2069e3c4, 0x011c2454, 0xf06ef9c5,
+0x1024448b, 0x2049e3c4, 0x01142474, 0xd661e9c5,
+0xb46ff9c5, 0x0000a024, 0x6ef9c500, 0x24448bd8,
+0x61e3c408, 0x0c245c20, 0x6ef9c501, 0x51e3c4e8,
+0xc501e920, 0xc5dd61e1, 0xc5d362e9, 0xc4ca6cf1,
+0xe9384de3, 0x7ffdc501, 0x008024ac, 0xfdc50000,
+0xffc0bf6f, 0xfdc5ffff, 0x80249c6f, 0xc5000002,
+0xc5cff8e5, 0x24bc7ffd, 0x000000a0, 0x8c7ffdc5,
+0x00028024, 0x248c8a00, 0x00000280, 0xa024848a,
+0xd2000001, 0x248c8ae0, 0x00000281, 0xa0248488,
+0x8a000001, 0x02012484, 0xe0d20000, 0x82248c8a,
+0x88000002, 0x8a702444, 0x02022484, 0xe0d20000,
+0x83248c8a, 0x88000002, 0x8a6c2444, 0x02032484,
+0xe0d20000, 0x84248c8a, 0x88000002, 0x8a682444,
+0x02042484, 0xe0d20000, 0x85248c8a, 0x88000002,
+0x8a642444, 0x02052484, 0xe0d20000, 0x86248c8a,
+0x88000002, 0x8a602444, 0x02062484, 0xe0d20000,
+0x87248c8a, 0x88000002, 0x8a5c2444, 0x02072484,
+0xe0d20000, 0x88248c8a, 0x88000002, 0x8a582444,
+0x02082484, 0xe0d20000, 0x89248c8a, 0x88000002,
+0x8a542444, 0x02092484, 0xe0d20000, 0x8a248c8a,
+0x88000002, 0x8a502444, 0x020a2484, 0xe0d20000,
+0x4c244488, 0x8b248c8a, 0x8a000002, 0x020b2484,
+0x9c8a0000, 0x00020e24, 0x24948a00, 0x00000210,
+0x8c8ae0d2, 0x00028c24, 0x24448800, 0x24848a48,
+0x0000020c, 0x8c8ae0d2, 0x00028d24, 0x24448800,
+0x24848a44, 0x0000020d, 0x8c8ae0d2, 0x00028e24,
+0x24448800, 0x24848a40, 0x0000020f, 0x8c8ae3d2,
+0x00028f24, 0x8ae0d200, 0x0290248c, 0x44880000,
+0x848a3f24, 0x00021124, 0x8ae2d200, 0x0291248c,
+0xe0d20000, 0x92248c8a, 0x88000002, 0x8a382444,
+0x02122484, 0xe0d20000, 0x93248c8a, 0x88000002,
+0x8a342444, 0x02132484, 0xe0d20000, 0x94248c8a,
+0x88000002, 0x8a302444, 0x02142484, 0xe0d20000,
+0x95248c8a, 0x88000002, 0x8a2c2444, 0x02152484,
+0xe0d20000, 0x96248c8a, 0x88000002, 0x8a282444,
+0x02162484, 0xb48b0000, 0x0001a024, 0x8ae0d200,
+0x0297248c, 0x44880000, 0x848a2424, 0x00021724,
+0x6ef9c500, 0x24748bd6, 0x69e3c46c, 0x70245420,
+0x8ae0d201, 0x0298248c, 0x44880000, 0x848a2024,
+0x00021824, 0x6ef9c500, 0x71e3c4ce, 0x68246c20,
+0x8ae0d201, 0x0299248c, 0x44880000, 0x848a1c24,
+0x00021924, 0x8ae0d200, 0x029a248c, 0x44880000,
+0x848a1824, 0x00021a24, 0x8ae0d200, 0x029b248c,
+0x44880000, 0x848a1424, 0x00021b24, 0x8ae0d200,
+0x029c248c, 0x44880000, 0x848a1024, 0x00021c24,
+0x8ae0d200, 0x029d248c, 0x44880000, 0x848a0c24,
+0x00021d24, 0x8ae0d200, 0x029e248c, 0x44880000,
+0x848a0824, 0x00021e24, 0x8ae0d200, 0x029f248c,
+0x44880000, 0x848a0424, 0x00021f24, 0x7ff9c500,
+0x01a024ac, 0x748b0000, 0xe9c56424, 0xa0249461,
+0xc5000001, 0xc4eb6ef9, 0x6c2051e3, 0xd2013f24,
+0x6ef9c5e0, 0x24748be6, 0x59e3c45c, 0x60246420,
+0x8bc18801, 0xc5042444, 0x8bfe6ef9, 0xc4542474,
+0x7c2041e3, 0xc5015824, 0xc5e761d9, 0xc5d462e9,
+0x8bce6ef9, 0xc44c2474, 0x4c2071e3, 0xc5015024,
+0x8bf66ef9, 0xc4442474, 0x742049e3, 0xc5014824,
+0xc5ce61f1, 0xc4de6ef9, 0x5c2061e3, 0xc5014024,
+0xc5dd61e1, 0xc5cb62f1, 0xc5f16ce9, 0x8bca6ef9,
+0xc5342454, 0x24b47ff9, 0x000001a0, 0xe86ef9c5,
+0x2071e3c4, 0x0138244c, 0x2051e3c4, 0x2cb801e9,
+0xc5000003, 0x8bd26ef9, 0xc42c2454, 0x7c2069e3,
+0xc5013024, 0x247c7ff9, 0x61f1c570, 0xc570244c,
+0x8be26ef9, 0xc4242454, 0x642059e3, 0xc5012824,
+0x8bfa6ef9, 0xc41c2454, 0x7c2041e3, 0xc5012024,
+0xc5e761d9, 0xc5cc62f1, 0x8bd26ef9, 0xc4142454,
+0x542069e3, 0xc5011824, 0x8bf26ef9, 0xc40c2454,
+0x742049e3, 0xc5011024, 0xc5d661e9, 0xc4da6ef9,
+0x5c2061e3, 0xc5010824, 0xc5dd61e1, 0xc5d362e9,
+0x249c6ff9, 0x000001a0, 0xca6cf1c5, 0x3865e3c4,
+0xf5c501c9, 0xf5c5c9fc, 0x80248c74, 0xc4000000,
+0x8c177de2, 0x00016024, 0x92830f00, 0xc5000001,
+0x24bc6ffd, 0x00000240, 0xd760c5c5, 0xcf68c5c5,
+0x94d5edc5, 0x00012024, 0x6ffdc500, 0x014024b4,
+0xfdc50000, 0xc024b47f, 0xc5000001, 0x248cd5f5,
+0x00000100, 0x006de2c4, 0x00e02494, 0xe2c40000,
+0x248c0075, 0x000000c0, 0x026de3c4, 0xfdc5ccd1,
+0xe024947f, 0xc4000001, 0x8c3c4de2, 0x0001e024,
+0x4de2c400, 0xe0249438, 0xc5000001, 0x24947ffd,
+0x000001e0, 0x8cfcf5c5, 0x0001e024, 0x6ffdc500,
+0x018024ac, 0x48b80000, 0xc5000003, 0xc5d160f5,
+0xc5c968f5, 0x2494d5ed, 0x00000120, 0x8cd5f5c5,
+0x00010024, 0x6de2c400, 0xe0249400, 0xc4000000,
+0x8c0075e2, 0x0000c024, 0x6de3c400, 0xc5ccd102,
+0xc5cffcd5, 0xc4d174ed, 0x94177de2, 0x00016024,
+0xba830f00, 0xb8000000, 0x0000034f, 0x1c7de2c4,
+0x01c02494, 0xedc50000, 0xe2c4d574, 0x2494177d,
+0x00000160, 0x0097830f, 0x54b80000, 0xc5000003,
+0x24a46ffd, 0x000000a0, 0x085de2c4, 0x02602494,
+0xedc50000, 0x60249474, 0xc4000002, 0x94177de2,
+0x00016024, 0xc66a7300, 0x01bf2484, 0xb8210000,
+0x00000362, 0x787de2c4, 0x01bf2494, 0xf5c50000,
+0xe2c4ca74, 0x248c177d, 0x00000160, 0xfdc54373,
+0x8024bc6f, 0xc4000001, 0xd74645e3, 0x6de3c401,
+0x8024940f, 0x01000001, 0xd5c5c031, 0xffe08fdb,
+0xf5c5ffff, 0xf5c5ccfc, 0xe2c4ca74, 0x248c177d,
+0x00000160, 0x83c0920f, 0xc01901f8, 0x0003e425,
+0xf4658d00, 0x5d5f5e5b, 0x243c8bc3, 0x000000c3,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f,
+0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f,
+0x00000000, 0x00000000, 0x00000000,
+0006014,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u1[] = {
+0xb05500eb, 0xbae58901, 0x00000008, 0x0a1ce857,
+0xc7810000, 0x00000a6e, 0x53f63156, 0x81e0e483,
+0x0001a0ec, 0x249c8d00, 0x0000017f, 0x20348488,
+0xb1000001, 0x88c12821, 0x0140348c, 0xf1890000,
+0xfe01e183, 0x348c88c9, 0x00000160, 0x2146f189,
+0x01f983f1, 0xfe00da83, 0x331488c0, 0x7520fe83,
+0x6ffdc5cb, 0x012024bc, 0xfdc50000, 0xc024bc7f,
+0xb8000000, 0x00000260, 0x946ffdc5, 0x0000c024,
+0x74edc500, 0x76c5c5cf, 0x7ffdc5ff, 0x008024bc,
+0xe2c40000, 0x0fcf177d, 0x00098983, 0xfcedc500,
+0x0120248c, 0xfdc50000, 0xe0248c7f, 0xc5000000,
+0x24bc6ffd, 0x00000120, 0xcffcc5c5, 0x000266b8,
+0x74f5c500, 0x00e0248c, 0xe2c40000, 0x248c177d,
+0x00000080, 0x094c830f, 0xfdc50000, 0xe024b46f,
+0xc5000000, 0x248cf8cd, 0x00000120, 0x8c7ffdc5,
+0x00010024, 0x026bb800, 0xedc50000, 0x00249c74,
+0xc4000001, 0x9c177de2, 0x00008024, 0x13830f00,
+0xc5000009, 0x2494ebed, 0x00000140, 0x947ffdc5,
+0x0000c024, 0xdbf5c500, 0x0140248c, 0xfdc50000,
+0x0024ac6f, 0xc5000001, 0x2494efd5, 0x00000140,
+0x000277b8, 0xdff5c500, 0x00c0248c, 0xf5c50000,
+0xe2c4ca74, 0x248c177d, 0x00000080, 0x08c4830f,
+0xe9c50000, 0xedc5d2ef, 0x80248c74, 0xc5000001,
+0xc5ca74f5, 0x24bcdbf5, 0x00000120, 0xbc7ffdc5,
+0x00010024, 0x24848a00, 0x00000100, 0xa0248488,
+0x8a000000, 0x0180248c, 0x9c8a0000, 0x00010a24,
+0x8ae0d200, 0x0181248c, 0x44880000, 0x848a6024,
+0x00010124, 0x8ae0d200, 0x0182248c, 0x44880000,
+0x848a5024, 0x00010224, 0x8ae0d200, 0x0183248c,
+0x44880000, 0x848a4c24, 0x00010324, 0x8ae0d200,
+0x0184248c, 0x44880000, 0x848a4b24, 0x00010424,
+0x8ae0d200, 0x0185248c, 0x44880000, 0x848a4424,
+0x00010524, 0x8ae0d200, 0x0186248c, 0x44880000,
+0x848a4024, 0x00010624, 0x8ae0d200, 0x0187248c,
+0x44880000, 0x848a3c24, 0x00010724, 0x8ae0d200,
+0x0188248c, 0x44880000, 0x848a3824, 0x00010824,
+0x8ae0d200, 0x0189248c, 0x44880000, 0x848a3424,
+0x00010924, 0x8ae0d200, 0x018a248c, 0x44880000,
+0xe3d24a24, 0x8b248c8a, 0x8a000001, 0x010b2484,
+0xf9c50000, 0x948adb6e, 0x00010c24, 0x8ae0d200,
+0x018c248c, 0x44880000, 0x848a3024, 0x00010d24,
+0x8ae2d200, 0x018d248c, 0xe0d20000, 0x8e248c8a,
+0x88000001, 0x8a492444, 0x010e2484, 0xe0d20000,
+0x8f248c8a, 0x88000001, 0x8a2c2444, 0x010f2484,
+0xe0d20000, 0x90248c8a, 0x88000001, 0x8a482444,
+0x01102484, 0xe0d20000, 0x91248c8a, 0x88000001,
+0x8a282444, 0x01112484, 0xe0d20000, 0x92248c8a,
+0x88000001, 0x8a272444, 0x01122484, 0xe0d20000,
+0x93248c8a, 0x88000001, 0x8a202444, 0x01132484,
+0xe0d20000, 0x94248c8a, 0x88000001, 0x8a262444,
+0x01142484, 0xe0d20000, 0x95248c8a, 0x88000001,
+0x8a1c2444, 0x01152484, 0xe0d20000, 0x96248c8a,
+0x88000001, 0x8a252444, 0x01162484, 0x748b0000,
+0xe0d26024, 0x97248c8a, 0x88000001, 0x8a182444,
+0x01172484, 0xf9c50000, 0x748bce6e, 0xe3c44c24,
+0x244c2071, 0xe0d20150, 0x98248c8a, 0x88000001,
+0x8a242444, 0x01182484, 0xf9c50000, 0xe3c4fe6e,
+0x247c2041, 0xf1c5014b, 0xe0d2cf61, 0x99248c8a,
+0x88000001, 0x8a142444, 0x01192484, 0xe0d20000,
+0x9a248c8a, 0x88000001, 0x8a132444, 0x011a2484,
+0xe0d20000, 0x9b248c8a, 0x88000001, 0x8a0c2444,
+0x011b2484, 0xe0d20000, 0x9c248c8a, 0x88000001,
+0x8a122444, 0x011c2484, 0xe0d20000, 0x9d248c8a,
+0x88000001, 0x8a082444, 0x011d2484, 0xe0d20000,
+0x9e248c8a, 0x88000001, 0x8a112444, 0x011e2484,
+0xe0d20000, 0x9f248c8a, 0x88000001, 0x8a042444,
+0x011f2484, 0x748b0000, 0xe3c44424, 0x246c2061,
+0xf9c50130, 0x60246c7f, 0xda6ef9c5, 0x2061e3c4,
+0x0149245c, 0xc188e0d2, 0x2c24448b, 0xf66ef9c5,
+0x3c24748b, 0x2049e3c4, 0x01402474, 0xe86ef9c5,
+0x2824448b, 0x2051e3c4, 0x0148246c, 0xdd61e1c5,
+0xe66ef9c5, 0x3424748b, 0x2059e3c4, 0x01382464,
+0xe461c9c5, 0xcc62f1c5, 0xe86ef9c5, 0x2024448b,
+0x2051e3c4, 0x0127246c, 0xd66ef9c5, 0x2069e3c4,
+0x014a2454, 0x5461e9c5, 0xe9c56024, 0xf1c5d362,
+0xf9c5ca6c, 0x448be06e, 0xe3c41c24, 0x24642059,
+0xd1c50126, 0xf9c5ec61, 0x448bd86e, 0xe3c41824,
+0x245c2061, 0xf9c50125, 0x448bd06e, 0xe3c41424,
+0x24742069, 0xf9c50124, 0x6024747f, 0x5c61e1c5,
+0xd1c56024, 0xf9c5eb62, 0x448bf06e, 0xe3c40c24,
+0x24742049, 0xf9c50113, 0x448bd06e, 0xe3c40824,
+0x247c2069, 0xf9c50112, 0x50247c7f, 0x7461c9c5,
+0xf9c55024, 0x448bf86e, 0xe3c40424, 0x247c2041,
+0xf9c50111, 0xe3c4d06e, 0x01d12069, 0xfa61c1c5,
+0xf762c9c5, 0xee6cd1c5, 0x3875e3c4, 0xfdc501e5,
+0x6024647f, 0xc976f5c5, 0x8cfcf5c5, 0x00018024,
+0x7ffdc500, 0x0180248c, 0x8c8a0000, 0x00018024,
+0x24848a00, 0x000000a0, 0x04249c8a, 0x8a000001,
+0x010a2494, 0xe0d20000, 0x81248c8a, 0x88000001,
+0x00a02484, 0x848a0000, 0x00010124, 0x8ae0d200,
+0x0182248c, 0x44880000, 0x848a5024, 0x00010224,
+0x8ae0d200, 0x0183248c, 0x44880000, 0x848a4c24,
+0x00010324, 0x8ae0d200, 0x0184248c, 0x44880000,
+0x848a4b24, 0x00010524, 0x8ae3d200, 0x0185248c,
+0xf9c50000, 0xe0d2e36e, 0x86248c8a, 0x88000001,
+0x8a442444, 0x01062484, 0xe0d20000, 0x87248c8a,
+0x88000001, 0x8a402444, 0x01072484, 0xe0d20000,
+0x88248c8a, 0x88000001, 0x8a3c2444, 0x01082484,
+0xe0d20000, 0x89248c8a, 0x88000001, 0x8a382444,
+0x01092484, 0xe0d20000, 0x8a248c8a, 0x88000001,
+0xd2342444, 0x248c8ae2, 0x0000018b, 0x0b24848a,
+0xc5000001, 0xd2da6ef9, 0x248c8ae0, 0x0000018c,
+0x4a244488, 0x0c24848a, 0xd2000001, 0x248c8ae0,
+0x0000018d, 0x30244488, 0x0d24848a, 0xd2000001,
+0x248c8ae0, 0x0000018e, 0x49244488, 0x0e24848a,
+0xd2000001, 0x248c8ae0, 0x0000018f, 0x2c244488,
+0x0f24848a, 0xd2000001, 0x248c8ae0, 0x00000190,
+0x48244488, 0x1024848a, 0xd2000001, 0x248c8ae0,
+0x00000191, 0x28244488, 0x1124848a, 0xd2000001,
+0x248c8ae0, 0x00000192, 0x27244488, 0x1224848a,
+0xd2000001, 0x248c8ae0, 0x00000193, 0x20244488,
+0x1324848a, 0xd2000001, 0x248c8ae0, 0x00000194,
+0x26244488, 0x1424848a, 0xd2000001, 0x248c8ae0,
+0x00000195, 0x1c244488, 0x1524848a, 0xd2000001,
+0x244488e0, 0x248c8a25, 0x00000196, 0x1624848a,
+0x8b000001, 0x00a024b4, 0xe0d20000, 0x97248c8a,
+0x88000001, 0x8a182444, 0x01172484, 0xf9c50000,
+0x748bd66e, 0xe3c44c24, 0x24542069, 0xe0d20150,
+0x98248c8a, 0x88000001, 0x8a242444, 0x01182484,
+0xf9c50000, 0xe0d2fe6e, 0x99248c8a, 0x88000001,
+0x8a142444, 0x01192484, 0xe0d20000, 0x9a248c8a,
+0x88000001, 0x8a132444, 0x011a2484, 0xe0d20000,
+0x9b248c8a, 0x88000001, 0x8a0c2444, 0x011b2484,
+0xe0d20000, 0x9c248c8a, 0x88000001, 0x8a122444,
+0x011c2484, 0xe0d20000, 0x9d248c8a, 0x88000001,
+0x8a082444, 0x011d2484, 0xe0d20000, 0x9e248c8a,
+0x88000001, 0x8a112444, 0x011e2484, 0xe0d20000,
+0x9f248c8a, 0x88000001, 0x8a042444, 0x011f2484,
+0xe3c40000, 0x247c2041, 0xe3c4014b, 0x246c2061,
+0x5c8b014a, 0xf9c54024, 0xa024ac7f, 0xc4000000,
+0x642059e3, 0xc5014424, 0xd2d761e9, 0x8bc188e0,
+0xc5302444, 0x8bf36ef9, 0xc438245c, 0x742049e3,
+0xc5013c24, 0xc5e661d9, 0xc5d462e9, 0x8bd86ef9,
+0xc42c2444, 0x5c2061e3, 0xc5014924, 0xc4cb6ef9,
+0x4c2071e3, 0xc5013424, 0x248c61f1, 0x000000a0,
+0xe86ef9c5, 0x2824448b, 0x2051e3c4, 0x0148246c,
+0xdd61e1c5, 0xcb62f1c5, 0xf96ce9c5, 0xc86ef9c5,
+0x2024448b, 0x2071e3c4, 0x0127244c, 0xd06ef9c5,
+0x1c24448b, 0x2069e3c4, 0x01262464, 0xa47ff9c5,
+0x0000a024, 0x61f1c500, 0x00a0248c, 0xf9c50000,
+0x448be06e, 0xe3c41824, 0x24642059, 0xf9c50125,
+0x448bd06e, 0xe3c41424, 0x24742069, 0xf9c50124,
+0x5024747f, 0x6461d9c5, 0xf1c55024, 0xf9c5cc62,
+0x448bd06e, 0xe3c40c24, 0x24542069, 0xf9c50113,
+0x448bf06e, 0xe3c40824, 0x24742049, 0xe9c50112,
+0xf9c5d661, 0x448be86e, 0xe3c40424, 0x246c2051,
+0xf9c50111, 0xe3c4d86e, 0x01d92061, 0xdb61d1c5,
+0xd362e9c5, 0xca6cf1c5, 0x3845e3c4, 0xf5c501c9,
+0x2cb8c9fc, 0xc5000003, 0x244c74f5, 0x7de2c460,
+0x80248c17, 0x0f000000, 0x0000c983, 0x6ffdc500,
+0x0120248c, 0xf5c50000, 0x402494da, 0xc5000001,
+0x249cdef5, 0x00000140, 0xd3fcedc5, 0x00033fb8,
+0xfcf5c500, 0x0140249c, 0xedc50000, 0xe2c4d374,
+0x2494177d, 0x00000080, 0x0088830f, 0x54b80000,
+0xc5000003, 0xc0a76ffd, 0xc4ffffff, 0x94085de2,
+0x00016024, 0x74edc500, 0x01602494, 0xe2c40000,
+0x2494177d, 0x00000080, 0x84c65c73, 0x0000bf24,
+0x62b82100, 0xc4000003, 0x94787de2, 0x0000bf24,
+0x74e5c500, 0x7de2c4da, 0x80249c17, 0x73000000,
+0xc4c03135, 0xd14675e3, 0x6de3c401, 0xc501d10f,
+0xe08fdbf5, 0xc5ffffff, 0xc5ccfcf5, 0xc4ca74f5,
+0x8c177de2, 0x00008024, 0xc0920f00, 0x1901f883,
+0x03e425c0, 0x658d0000, 0x5f5e5bf4, 0x3c8bc35d,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f,
+0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f, 0x1f1f1f1f,
+0x00000000, 0x00000000, 0x00000000,
+0005214,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i2[] = {
+0x315500eb, 0x0ad0e8c9, 0x16050000, 0x8900000b,
+0xbe5657e5, 0x00000010, 0x83db3153, 0xec81e0e4,
+0x00000220, 0x0c248489, 0xc7000001, 0x011c2484,
+0x00100000, 0xb70f0000, 0x01508dc1, 0x89fabf0f,
+0x00e024bc, 0x10bf0000, 0x29000000, 0x83c889c7,
+0xbf0f01e0, 0x01f883ff, 0x1901418d, 0x02e283d2,
+0x75c8854a, 0x01b34e03, 0x44bc8966, 0x0000019e,
+0xe0248c8b, 0x83000000, 0x896610f8, 0x01be4494,
+0x89660000, 0x01de44b4, 0x89660000, 0x017e448c,
+0x04740000, 0x9eebc189, 0x0774db84, 0x1c24b489,
+0xc5000001, 0x24b46ffd, 0x00000180, 0xb47ffdc5,
+0x00012024, 0x76f5c500, 0x6ffdc5c9, 0x01202494,
+0x60ba0000, 0xc5000002, 0xc4de75ed, 0xd9177de2,
+0x09fa830f, 0xedc50000, 0x80249cfd, 0xc5000001,
+0x249c7ffd, 0x00000140, 0xb46ffdc5, 0x00018024,
+0x71e5c500, 0x66ba01f6, 0xc5000002, 0x249c75e5,
+0x00000140, 0x177de2c4, 0xc1830fd9, 0xc5000009,
+0x24bc6ffd, 0x00000140, 0x9cf9c5c5, 0x00018024,
+0x7ffdc500, 0x0160249c, 0x6bba0000, 0xc5000002,
+0x249c75ed, 0x00000160, 0x177de2c4, 0x8d830fd9,
+0xc5000009, 0x24b46ffd, 0x000001a0, 0x94d5edc5,
+0x00018024, 0xd5cdc500, 0x7ffdc5de, 0x0140249c,
+0xfdc50000, 0x8024bc6f, 0xc5000001, 0xc5eefdc5,
+0x24a4f9c5, 0x000001a0, 0xd3f9edc5, 0x000282ba,
+0xd5ddc500, 0x75edc5e5, 0x7ffdc5d4, 0x016024a4,
+0xe2c40000, 0x0fd1177d, 0x00093383, 0xd5c5c500,
+0x01a02494, 0xfdc50000, 0x2024947f, 0x66000001,
+0x402484c7, 0x10000001, 0x248c8d00, 0x00000140,
+0x2484c766, 0x0000015e, 0x9c8d0010, 0x00014e24,
+0x118b6600, 0x8302e883, 0x016602c1, 0xd2bf0fc2,
+0x83118966, 0x896602f8, 0xe5750314, 0x24948966,
+0x00000150, 0xb46ffdc5, 0x00012024, 0x02d3ba00,
+0xcdc50000, 0x40249475, 0xc4000001, 0xd1177de2,
+0x08ba830f, 0xc5c50000, 0xc0249ce5, 0xc5000001,
+0xc5edefd1, 0x24b46ffd, 0x000001c0, 0x0002daba,
+0x65d5c500, 0x7ffdc5d6, 0x00e024b4, 0xedc50000,
+0xe2c4d375, 0x0fd1177d, 0x00088383, 0xd5cdc500,
+0x018024b4, 0xfdc50000, 0xc024b47f, 0xc5000000,
+0x24b47ffd, 0x00000160, 0xb46ffdc5, 0x00016024,
+0x71e5c500, 0xfdc503f6, 0x20249c7f, 0xc5000001,
+0x24b46ffd, 0x00000160, 0xf671edc5, 0x7ffdc502,
+0x01402494, 0xedc50000, 0xf8bad2fd, 0xc5000002,
+0xc4d375ed, 0xd1177de2, 0x0822830f, 0xfdc50000,
+0x2024b46f, 0xc5000001, 0x02e671ed, 0xd2fdedc5,
+0x0002fdba, 0x75edc500, 0x01402494, 0xe2c40000,
+0x0fd1177d, 0x0007f783, 0xd5c5c500, 0x01c024a4,
+0x84c70000, 0x00011c24, 0x00000300, 0x24848b00,
+0x0000011c, 0xa0248489, 0xc1000000, 0x84891ff8,
+0x0000a424, 0x7efac500, 0x00a024b4, 0xddc50000,
+0x84c7d6f1, 0x00011c24, 0x00000200, 0x24848b00,
+0x0000011c, 0xa0248489, 0xc1000000, 0x84891ff8,
+0x0000a424, 0x7efac500, 0x00a024b4, 0xddc50000,
+0xfdc5def1, 0x40249c7f, 0xc5000001, 0xbadbfde5,
+0x00000310, 0xda75e5c5, 0x177de2c4, 0x6d830fd9,
+0x8b000007, 0x011c2484, 0x84890000, 0x0000a024,
+0x1ff8c100, 0xa4248489, 0xc5000000, 0x24b47efa,
+0x000000a0, 0xd6e1edc5, 0xd2fdedc5, 0x000314ba,
+0x75edc500, 0x01402494, 0xe2c40000, 0x0fd1177d,
+0x00072b83, 0x6ffdc500, 0x01e024b4, 0xcdc50000,
+0xedc5d565, 0xfdc5ecdb, 0x6024ac7f, 0x8b000001,
+0x016024bc, 0xbf0f0000, 0x01e0248c, 0xf8890000,
+0x24b48b66, 0x00000162, 0x64249c8b, 0xd3000001,
+0x8cbf0fe0, 0x0001e224, 0x24848900, 0x000000a0,
+0xe0d3f089, 0x248cbf0f, 0x000001e4, 0x40244489,
+0xe0d3d889, 0x248cbf0f, 0x000001e6, 0x6c244489,
+0x24848b66, 0x00000166, 0x24848966, 0x00000090,
+0x9024848b, 0xd3000000, 0x8cbf0fe0, 0x0001e824,
+0x24448900, 0x24848b68, 0x00000168, 0xe2d3c289,
+0x248cbf0f, 0x000001ea, 0x64245489, 0x24948b66,
+0x0000016a, 0x24948966, 0x00000108, 0x0824948b,
+0xd3000001, 0x8cbf0fe2, 0x0001ec24, 0x24548900,
+0x24948b60, 0x0000016c, 0x24948966, 0x00000104,
+0x0424948b, 0xd3000001, 0x8cbf0fe2, 0x0001ee24,
+0x24548900, 0x948b663c, 0x00016e24, 0x94896600,
+0x00010024, 0x24948b00, 0x00000100, 0x8c8be2d3,
+0x00017024, 0x24548900, 0x8c896638, 0x00008c24,
+0x8cbf0f00, 0x0001f024, 0x24948b00, 0x0000008c,
+0xbf0fe2d3, 0x01f2248c, 0x54890000, 0x8b663424,
+0x01722494, 0x89660000, 0x00882494, 0x948b0000,
+0x00008824, 0x8be2d300, 0x0174248c, 0x54890000,
+0x89663024, 0x0084248c, 0xbf0f0000, 0x01f4248c,
+0x948b0000, 0x00008424, 0x0fe2d300, 0xf6248cbf,
+0x89000001, 0x662c2454, 0x7624948b, 0x66000001,
+0x80249489, 0x8b000000, 0x00802494, 0xe2d30000,
+0x78248c8b, 0x89000001, 0x66282454, 0x7c244c89,
+0x248cbf0f, 0x000001f8, 0x7c24548b, 0xbf0fe2d3,
+0x01fa248c, 0x54890000, 0x8b662424, 0x017a2494,
+0x89660000, 0x8b782454, 0xd3782454, 0x248c8be2,
+0x0000017c, 0x20245489, 0x244c8966, 0x8cbf0f74,
+0x0001fc24, 0x24548b00, 0x89e2d374, 0x661c2454,
+0x7e24948b, 0xc5000001, 0x24946ef9, 0x000000a0,
+0x248cbf0f, 0x000001fe, 0x6cc4e9c5, 0xc5014024,
+0x24646ef9, 0x6ef9c564, 0xc56c2454, 0x24746ef9,
+0xc4e9c53c, 0x0168245c, 0x54c4d9c5, 0xc5016024,
+0xc5db62d1, 0x2464c4c9, 0x89660138, 0xc5702454,
+0xc5d462e9, 0x246c6ef9, 0x24548b24, 0x6ce1c570,
+0x6ef9c5da, 0xc5342464, 0x2454c4d9, 0xf9c50130,
+0x2c24646e, 0x74c4d9c5, 0xc5012824, 0x2464c4d1,
+0xe9c50120, 0xf9c5d662, 0x1c246c6e, 0xd1c5e2d3,
+0xc501eac4, 0xc5e562d9, 0xc4d46ce9, 0xea3865e3,
+0x7ffdc501, 0x8b40246c, 0x010c248c, 0xfdc50000,
+0xffc0a96f, 0xfdc5ffff, 0xa024ac7f, 0xc5000000,
+0x24ac6ffd, 0x000001e0, 0x94f9d5c5, 0x0000a024,
+0x7ffdc500, 0x01e02494, 0xbf0f0000, 0x01e0248c,
+0x948b0000, 0x00009024, 0x0fe7d300, 0xe2248cbf,
+0xc5000001, 0xd3df6ef9, 0x8cbf0fe6, 0x0001e424,
+0xc4e1c500, 0xe3d301d6, 0x248cbf0f, 0x000001e6,
+0xe36ef9c5, 0xbf0fe2d3, 0x01e8248c, 0xd9c50000,
+0xc501dac4, 0xbad362e9, 0x0000032c, 0xbf0fe0d3,
+0x01ea248c, 0x84890000, 0x00009024, 0x24848b00,
+0x00000108, 0xbf0fe0d3, 0x01ec248c, 0x84890000,
+0x00010824, 0x24848b00, 0x00000104, 0xbf0fe0d3,
+0x01ee248c, 0x84890000, 0x00010424, 0x24848b00,
+0x00000100, 0xbf0fe0d3, 0x01f0248c, 0x84890000,
+0x00010024, 0x24848b00, 0x0000008c, 0xbf0fe0d3,
+0x01f2248c, 0x84890000, 0x00008c24, 0x24848b00,
+0x00000088, 0xbf0fe0d3, 0x01f4248c, 0x84890000,
+0x00008824, 0x24848b00, 0x00000084, 0xbf0fe0d3,
+0x01f6248c, 0x84890000, 0x00008424, 0x24848b00,
+0x00000080, 0xbf0fe0d3, 0x01f8248c, 0x84890000,
+0x00008024, 0x24448b00, 0x0fe0d37c, 0xfa248cbf,
+0x89000001, 0x8b7c2444, 0xc5782444, 0x24ac6ef9,
+0x00000090, 0xb46ef9c5, 0x00010424, 0xc4d1c500,
+0x010824a4, 0xc5010000, 0x24acc4c9, 0x00000100,
+0x62d9c501, 0x6ce9c5e5, 0x6ef9c5d4, 0x008c24a4,
+0xd9c50000, 0x88249cc4, 0x01000000, 0xa46ef9c5,
+0x00008424, 0xc4d9c500, 0x008024ac, 0xd3010000,
+0x8cbf0fe0, 0x0001fc24, 0x7ff9c500, 0x009024ac,
+0x44890000, 0x448b7824, 0xf9c57424, 0x7c24646e,
+0x9c62e1c5, 0x00009024, 0xc4d9c500, 0x0178246c,
+0xbf0fe0d3, 0x01fe248c, 0x44890000, 0x448b7424,
+0xf9c57024, 0x7424746e, 0xc9c5e0d3, 0xc501e0c4,
+0xc5ec62d1, 0xc4dd6ce1, 0xd3386de3, 0xfdedc501,
+0x75edc5d2, 0xc4402454, 0xd1177de2, 0x026e830f,
+0xfdc50000, 0xe024ac6f, 0xc5000000, 0x2494d5d5,
+0x000001a0, 0x947ffdc5, 0x00014024, 0x6ffdc500,
+0x00c024ac, 0xd5c50000, 0x402494ee, 0xc5000001,
+0x24947ffd, 0x00000160, 0x9cead5c5, 0x00014024,
+0x7ffdc500, 0x0140249c, 0xedc50000, 0x402494fd,
+0xba000001, 0x00000348, 0x9cfdc5c5, 0x0001a024,
+0xd5edc500, 0x00e02494, 0xedc50000, 0xe2c4d375,
+0x0fd1177d, 0x0001f783, 0xd5c5c500, 0x00e02494,
+0xfdc50000, 0x2024947f, 0xba000001, 0x0000034f,
+0x1d7de2c4, 0x01202494, 0xc5c50000, 0xe2c4d275,
+0x0fd1177d, 0x0001c783, 0x76e5c500, 0x6ffdc5db,
+0x00a024ac, 0x54ba0000, 0xc4000003, 0x8c0955e2,
+0x0001c024, 0x75f5c500, 0x01c0248c, 0xe2c40000,
+0x0fcb177d, 0x00019783, 0x6ffdc500, 0x01a02494,
+0xc7660000, 0x02002484, 0x00110000, 0xcafdc5c5,
+0x797de2c4, 0x020024a4, 0x62ba0000, 0xc5000003,
+0xc4cc75f5, 0xcb177de2, 0x0162830f, 0xc0310000,
+0xfdc501a8, 0x0475ca6f, 0xcf6ffdc5, 0x8c7ffdc5,
+0x00020024, 0x948b6600, 0x00020044, 0x94896600,
+0x00014044, 0xf8834000, 0xc5d57510, 0xc5d276ed,
+0x248c6ffd, 0x00000180, 0x0003d4ba, 0x75e3c400,
+0xa0249c0e, 0xaa000001, 0x9c75e5c5, 0x00014024,
+0x7de2c400, 0x830fda17, 0x00000104, 0x0c24848b,
+0xc4000001, 0xd94675e3, 0x65e3c401, 0xba02d90f,
+0x000003e4, 0xa0dbf5c5, 0xffffffe0, 0xa4fdddc5,
+0x0000a024, 0x75e5c500, 0x7de2c4dc, 0x830fda17,
+0x000000cc, 0x000004b8, 0x7ffdc500, 0x0120248c,
+0xd9c50000, 0xd1c5e4ef, 0xf9c5edef, 0x20248c6f,
+0xc5000001, 0x24bc6ffd, 0x00000120, 0x3855e3c4,
+0xe3c401c9, 0x00dc3845, 0x75e2c448, 0xfdc5cb01,
+0x20248c7f, 0x75000001, 0x7de3c4d1, 0xc501c939,
+0x07c1c5f9, 0x0000883d, 0x03f8ba00, 0x70750000,
+0x000004b8, 0x6ffdc500, 0x018024bc, 0xf9c50000,
+0xa0248c6f, 0xc4000001, 0xfb397de3, 0x45e3c401,
+0xc501c938, 0x24bc6ffd, 0x000001a0, 0x3845e3c4,
+0xe2c400db, 0xc5cb0575, 0x48e4efd9, 0x3875e3c4,
+0xe3c401dc, 0x01c9397d, 0xc96ff9c5, 0x0165e2c4,
+0x31e875c9, 0xefe1c5c0, 0x75f5c5db, 0x7de2c4cb,
+0x920fca17, 0x01f883c0, 0xe281d219, 0x00000401,
+0x89f4658d, 0x5f5e5bd0, 0x048bc35d, 0x0000c324,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x000f000f, 0x000f000f, 0x000f000f, 0x000f000f,
+0x000f000f, 0x000f000f, 0x000f000f, 0x000f000f,
+0x00000000, 0x00000000, 0x00000000,
+0005454,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u2[] = {
+0xb95500eb, 0x00000010, 0x0009e3e8, 0x0a330500,
+0xe5890000, 0x31535657, 0xe0e483db, 0x01c0ec81,
+0x84890000, 0x0000ac24, 0xc7c03100, 0x00bc2484,
+0x00100000, 0x84890000, 0x00009024, 0xd0b70f00,
+0x0f01728d, 0x10befeb7, 0x29000000, 0x83c289d6,
+0x4a4001e2, 0x85f6b70f, 0x00902484, 0xb70f0000,
+0x490375d2, 0x896601b3, 0x011e44bc, 0xf8830000,
+0xb4896610, 0x00013e44, 0x94896600, 0x00015e44,
+0x8c896600, 0x00017e44, 0x84ab7500, 0x890774db,
+0x00bc248c, 0xfdc50000, 0x2024b46f, 0xc5000001,
+0x24b47ffd, 0x000000c0, 0xc976f5c5, 0x9c6ffdc5,
+0x0000c024, 0x0260ba00, 0xe5c50000, 0xe2c4d675,
+0x0fd1177d, 0x00091d83, 0xfde5c500, 0x01202494,
+0xfdc50000, 0xe024947f, 0xc5000000, 0x24bc6ffd,
+0x00000120, 0xf771edc5, 0x0266ba01, 0xedc50000,
+0xe0249475, 0xc4000000, 0xd1177de2, 0x08e4830f,
+0xfdc50000, 0xe024b46f, 0xc5000000, 0x2494f9cd,
+0x00000120, 0x947ffdc5, 0x00010024, 0x026bba00,
+0xe5c50000, 0x0024a475, 0xc4000001, 0xe1177de2,
+0x08b0830f, 0xe5c50000, 0x40249ceb, 0xc5000001,
+0x249c7ffd, 0x000000c0, 0x94dbedc5, 0x00014024,
+0x7ffdc500, 0x00e02494, 0xfdc50000, 0x0024bc6f,
+0xc5000001, 0x249cefc5, 0x00000140, 0x9c7ffdc5,
+0x00010024, 0x0277ba00, 0xedc50000, 0xc02494df,
+0xc5000000, 0xc4d375ed, 0xd1177de2, 0x0854830f,
+0xfdc50000, 0x2024946f, 0xc5000001, 0x249cd5ed,
+0x00000140, 0x9c7ffdc5, 0x0000c024, 0x84c76600,
+0x0000e024, 0x8d001000, 0x00e0248c, 0xc7660000,
+0x00fe2484, 0x00100000, 0xee249c8d, 0x66000000,
+0xe883118b, 0x02c18302, 0x0fc20166, 0x8966d2b7,
+0x02f88311, 0x03148966, 0x8966e575, 0x00f02494,
+0xfdc50000, 0xc024b46f, 0xba000000, 0x000002d3,
+0x9c75cdc5, 0x0000e024, 0x7de2c400, 0x830fd917,
+0x000007d2, 0xa4e4edc5, 0x00016024, 0xdbedc500,
+0x0160249c, 0xe5c50000, 0x60249cfd, 0xba000001,
+0x000002dc, 0xdc75e5c5, 0x177de2c4, 0xa3830fd9,
+0xc5000007, 0x24947ffd, 0x00000100, 0xbc6ffdc5,
+0x00010024, 0x71ddc500, 0xfdc503f7, 0xc024a47f,
+0xc5000000, 0x24b46ffd, 0x00000100, 0xf671e5c5,
+0x7ffdc502, 0x00e0249c, 0xe5c50000, 0xf8badbfd,
+0xc5000002, 0xc4dc75e5, 0xd9177de2, 0x0754830f,
+0xfdc50000, 0xc024bc6f, 0xc5000000, 0x02d771e5,
+0xdbfde5c5, 0x0002fdba, 0x75e5c500, 0x00e0249c,
+0xe2c40000, 0x0fd9177d, 0x00072983, 0x2484c700,
+0x000000bc, 0x00000003, 0x9c6ef9c5, 0x0000bc24,
+0xf1edc500, 0x2484c7db, 0x000000bc, 0x00000002,
+0xa46ef9c5, 0x0000bc24, 0xf1edc500, 0x7ffdc5e4,
+0x00e024a4, 0xddc50000, 0x10bae4fd, 0xc5000003,
+0xc4e375dd, 0xe1177de2, 0x06d8830f, 0xf9c50000,
+0xbc24a46e, 0xc5000000, 0xc5dcd1e5, 0xbadbfde5,
+0x00000314, 0x9c75e5c5, 0x0000e024, 0x7de2c400,
+0x830fd917, 0x000006ae, 0xe4efd9c5, 0x9c75ddc5,
+0x00018024, 0x75e5c500, 0xdbe5c5dc, 0x012024b4,
+0xfdc50000, 0x0024b47f, 0x8b000001, 0x01002484,
+0x89660000, 0x0f702444, 0x80248cb7, 0x8b000001,
+0x66702444, 0x0a24bc8b, 0x8b000001, 0x010c24b4,
+0x8b660000, 0x010e249c, 0xe0d30000, 0x248cb70f,
+0x00000182, 0x40244489, 0x24848b66, 0x00000102,
+0x24848966, 0x00000090, 0x9024848b, 0xd3000000,
+0x8cb70fe0, 0x00018424, 0x24448900, 0x24848b6c,
+0x00000104, 0x24848966, 0x000000a8, 0xa824848b,
+0xd3000000, 0x8cb70fe0, 0x00018624, 0x24448900,
+0x848b6668, 0x00010624, 0x84896600, 0x0000a424,
+0x24848b00, 0x000000a4, 0xb70fe0d3, 0x0188248c,
+0x44890000, 0x848b6424, 0x00010824, 0x84896600,
+0x0000a024, 0x24848b00, 0x000000a0, 0xb70fe0d3,
+0x018a248c, 0x44890000, 0xf8896024, 0xb70fe0d3,
+0x018c248c, 0x44890000, 0xf0893c24, 0xb70fe0d3,
+0x018e248c, 0x44890000, 0xd8893824, 0x4489e0d3,
+0x848b3424, 0x00011024, 0x8cb70f00, 0x00019024,
+0x84896600, 0x00008c24, 0x24848b00, 0x0000008c,
+0xb70fe0d3, 0x0192248c, 0x44890000, 0x8b663024,
+0x01122484, 0x89660000, 0x00882484, 0x848b0000,
+0x00008824, 0x0fe0d300, 0x94248cb7, 0x89000001,
+0x8b2c2444, 0x01142484, 0x89660000, 0x00842484,
+0x848b0000, 0x00008424, 0x0fe0d300, 0x96248cb7,
+0x89000001, 0x66282444, 0x1624848b, 0x66000001,
+0x80248489, 0x8b000000, 0x00802484, 0xe0d30000,
+0x248cb70f, 0x00000198, 0x24244489, 0x1824848b,
+0x66000001, 0x7c244489, 0x7c24448b, 0xb70fe0d3,
+0x019a248c, 0x44890000, 0x8b662024, 0x011a2484,
+0x89660000, 0x8b782444, 0xd3782444, 0x8cb70fe0,
+0x00019c24, 0x24448900, 0x24848b1c, 0x0000011c,
+0xe2d3c289, 0x18245489, 0x248c8b66, 0x0000011e,
+0x5c6ef9c5, 0xf9c54024, 0x60246c6e, 0x64c4e1c5,
+0xc5016c24, 0x245c6ef9, 0xc4e1c568, 0x0164247c,
+0x5cc4d1c5, 0xc5013c24, 0xc5e762d9, 0x246c6ef9,
+0x6ef9c538, 0xc520247c, 0x2474c4d1, 0x89660134,
+0x0f74244c, 0x9e248cb7, 0xc5000001, 0x8bde62e1,
+0xc5742454, 0xc5e36cd9, 0x246c6ef9, 0xc4d1c530,
+0x012c245c, 0x6c6ef9c5, 0xd1c52824, 0x242474c4,
+0xc4c1c501, 0x011c246c, 0xde62e1c5, 0x7c6ef9c5,
+0xe2d31824, 0xfac4c1c5, 0x62d1c501, 0x6ce1c5ef,
+0x5de3c4dd, 0xc501f338, 0x24747ffd, 0x76e5c540,
+0xfde5c5db, 0x0180249c, 0xfdc50000, 0x80249c7f,
+0x0f000001, 0x80248cb7, 0x8b000001, 0xd3702454,
+0x8cb70fe2, 0x00018224, 0x24548900, 0x24948b70,
+0x00000090, 0xb70fe2d3, 0x0184248c, 0x94890000,
+0x00009024, 0x24948b00, 0x000000a8, 0xb70fe2d3,
+0x0186248c, 0x94890000, 0x0000a824, 0x24948b00,
+0x000000a4, 0xb70fe2d3, 0x0188248c, 0x94890000,
+0x0000a424, 0x24948b00, 0x000000a0, 0xb70fe2d3,
+0x018a248c, 0x94890000, 0x0000a024, 0x24948b00,
+0x0000008c, 0xb70fe7d3, 0x018c248c, 0xe6d30000,
+0x248cb70f, 0x0000018e, 0xf66ef9c5, 0xb70fe3d3,
+0x0190248c, 0xe2d30000, 0x248cb70f, 0x00000192,
+0x8c249489, 0x8b000000, 0x00882494, 0xe2d30000,
+0x248cb70f, 0x00000194, 0x88249489, 0x8b000000,
+0x00842494, 0xe2d30000, 0x248cb70f, 0x00000196,
+0x84249489, 0x8b000000, 0x00802494, 0xe2d30000,
+0x248cb70f, 0x00000198, 0x80249489, 0x8b000000,
+0xd37c2454, 0x245489e2, 0x8cb70f7c, 0x00019a24,
+0x6ef9c500, 0x8b702464, 0xc5782454, 0x249cc4d9,
+0x00000090, 0x6ef9c501, 0x00a024ac, 0xf9c50000,
+0xa824a46e, 0xc5000000, 0x24bcc4d9, 0x000000a4,
+0xc4d1c501, 0xe1c501e7, 0xc9c5df62, 0xc501ebc4,
+0x24746ef9, 0x62d9c57c, 0x6ce1c5e5, 0x6ef9c5dc,
+0x008c24a4, 0xe2d30000, 0x248cb70f, 0x0000019c,
+0xacc4d9c5, 0x00008824, 0xf9c50100, 0x8424a46e,
+0xc5000000, 0x24bcc4d9, 0x00000080, 0xc4c9c501,
+0xf9c501e2, 0x9024bc7f, 0xc5000000, 0x24ac62d1,
+0x00000090, 0x00032cba, 0x0fe0d300, 0x9e248cb7,
+0x89000001, 0x8b782444, 0xc5742444, 0x247c6ef9,
+0xc5e0d378, 0x01f0c4c1, 0xe662d9c5, 0xec6cd1c5,
+0x3865e3c4, 0xe5c501dd, 0xe5c5dbfd, 0x40245c75,
+0x177de2c4, 0x0b830fd9, 0xc4000002, 0x9c3a6de2,
+0x00014024, 0x7ffdc500, 0x00c0249c, 0xe2c40000,
+0x24a43e6d, 0x00000140, 0xa47ffdc5, 0x0000e024,
+0xfde5c500, 0x033fbadc, 0xedc50000, 0x4024a4fd,
+0xc5000001, 0xc4dc75e5, 0xd9177de2, 0x01c4830f,
+0x848b0000, 0x0000ac24, 0x0354ba00, 0xfdc50000,
+0xffc0a86f, 0xe2c4ffff, 0x249c0955, 0x00000160,
+0x9c75e5c5, 0x00016024, 0x7de2c400, 0x830fd917,
+0x00000192, 0xa46ffdc5, 0x00014024, 0x84c76600,
+0x0001a024, 0xc5001100, 0xc4ccfded, 0x9c797de2,
+0x0001a024, 0x0362ba00, 0xf5c50000, 0xe5c5cb75,
+0xe2c4db76, 0x0fcb177d, 0x00015983, 0xa8c03100,
+0x6ffdc501, 0xc50475cc, 0xc5ca6ffd, 0x248c7ffd,
+0x000001a0, 0x44948b66, 0x000001a0, 0x44948966,
+0x000000e0, 0x10f88340, 0xd4bad575, 0xc5000003,
+0x248c6ffd, 0x00000120, 0x0e75e3c4, 0x01402494,
+0xc5aa0000, 0x249475ed, 0x000000e0, 0x177de2c4,
+0xff830fd3, 0x8b000000, 0x00ac2484, 0xe3c40000,
+0x01d14675, 0x0f6de3c4, 0xe4ba02d1, 0xc5000003,
+0xe0a0dbf5, 0xc5ffffff, 0xc5e5fddd, 0xc4d475ed,
+0xd3177de2, 0x00cc830f, 0x04b80000, 0xc5000000,
+0x248c7ffd, 0x000000c0, 0xe4efd9c5, 0xedefd1c5,
+0x8c6ff9c5, 0x0000c024, 0x6ffdc500, 0x00c024bc,
+0xe3c40000, 0x01c93855, 0x3845e3c4, 0xc44800d4,
+0xca0175e2, 0x8c7ffdc5, 0x0000c024, 0xc4d17500,
+0xc9397de3, 0xc5f9c501, 0x883d07c1, 0xba000000,
+0x000003f8, 0x04b87075, 0xc5000000, 0x24b46ffd,
+0x00000120, 0x8c6ff9c5, 0x00014024, 0x7de3c400,
+0xc401f239, 0xc9384de3, 0x6ffdc501, 0x014024b4,
+0xe3c40000, 0x00d2384d, 0x0575e2c4, 0xefd9c5ca,
+0xe3c448e4, 0x01d43875, 0x397de3c4, 0xf9c501c9,
+0xe2c4c96f, 0x75c9016d, 0xc5c031e8, 0xc5d2efe9,
+0xc4ca75f5, 0xcb177de2, 0x83c0920f, 0xd21901f8,
+0x0401e281, 0x658d0000, 0x5bd089f4, 0xc35d5f5e,
+0xc324048b, 0x00000000, 0x00000000, 0x00000000,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x000f000f, 0x000f000f, 0x000f000f, 0x000f000f,
+0x000f000f, 0x000f000f, 0x000f000f, 0x000f000f,
+0x00000000, 0x00000000, 0x00000000,
+0005114,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i4[] = {
+0x315500eb, 0x0576e8c0, 0xc1810000, 0x000005f6,
+0xbf57e589, 0x00000009, 0x20bb5356, 0x83000000,
+0xec81e0e4, 0x00000120, 0xfa89c689, 0x89c22940,
+0x89082454, 0x01e283f2, 0x1901fa83, 0x02e283d2,
+0x75f0854a, 0x44894b01, 0x748b7c84, 0xf8830824,
+0x84948908, 0x000000bc, 0xdc849c89, 0x89000000,
+0x009c84b4, 0xc0750000, 0xbc6ffdc5, 0x00008024,
+0x7ffdc500, 0xc520247c, 0xc5c976f5, 0x24546ffd,
+0x0260b820, 0xedc50000, 0xe2c4df76, 0x0fd9177d,
+0x0004e383, 0xfeedc500, 0x0080249c, 0xfdc50000,
+0x40245c7f, 0xbc6ffdc5, 0x00008024, 0x72e5c500,
+0x66b801f7, 0xc5000002, 0x245c76e5, 0x7de2c440,
+0x830fd917, 0x000004b0, 0x7c6ffdc5, 0xc5c54024,
+0x80249cfa, 0xc5000000, 0x245c7ffd, 0x026bb860,
+0xedc50000, 0x60245c76, 0x177de2c4, 0x85830fd9,
+0xc5000004, 0x24bc6ffd, 0x000000a0, 0x406de2c4,
+0x00802494, 0xe2c40000, 0xc5e74045, 0x249c6ffd,
+0x00000080, 0xf7fee5c5, 0xacfae5c5, 0x0000a024,
+0xfaedc500, 0x0282b8d4, 0xe2c40000, 0xc5ee4055,
+0xc4d576ed, 0xd1177de2, 0x043a830f, 0xe2c40000,
+0x24944065, 0x000000a0, 0x0002d3b8, 0x76edc500,
+0xffffa091, 0x7de2c4ff, 0x830fd117, 0x00000418,
+0x4065e2c4, 0x00c024a4, 0xfdc50000, 0x6024647f,
+0x7c6ffdc5, 0xd5c56024, 0xc503f772, 0x246c7ffd,
+0x6ffdc520, 0xc560247c, 0x02f772ed, 0x547ffdc5,
+0xedc54024, 0xf8b8d2fe, 0xc5000002, 0xc4d576ed,
+0xd1177de2, 0x03ce830f, 0xfdc50000, 0x20247c6f,
+0xe772edc5, 0xfeedc502, 0x02fdb8d2, 0xedc50000,
+0x40245476, 0x177de2c4, 0xa9830fd1, 0xc7000003,
+0x031c2444, 0x8b000000, 0x891c2444, 0xc1082444,
+0x44891ff8, 0xfac50c24, 0x08247c7e, 0xd7f2ddc5,
+0x1c2444c7, 0x00000002, 0x1c24448b, 0x08244489,
+0x891ff8c1, 0xc50c2444, 0x24747efa, 0xf2ddc508,
+0x7ffdc5ee, 0xc540246c, 0xb8edfed5, 0x00000310,
+0xea76d5c5, 0x177de2c4, 0x49830fe9, 0x8b000003,
+0x891c2444, 0xc1082444, 0x44891ff8, 0xfac50c24,
+0x08247c7e, 0xd7e2edc5, 0xd2feedc5, 0x000314b8,
+0x76edc500, 0xc4402454, 0xd1177de2, 0x0316830f,
+0xfdc50000, 0xe024b46f, 0xc5000000, 0xc5d2efe9,
+0xc5d266cd, 0xc5d4dbed, 0x24547ffd, 0x6de2c460,
+0xe024ac47, 0xc5000000, 0x24bc6ffd, 0x000000e0,
+0xa16ffdc5, 0xffffffc0, 0xf4fac5c5, 0xb47ffdc5,
+0x0000e024, 0x6de2c400, 0xe0249447, 0xb8000000,
+0x0000032c, 0x547ffdc5, 0xedc54024, 0xedc5d2fe,
+0xe2c4d576, 0x0fd1177d, 0x0002ab83, 0x6ffdc500,
+0xc4402474, 0x94464de2, 0x0000e024, 0x0331b800,
+0xedc50000, 0x60245476, 0x177de2c4, 0x85830fd1,
+0xc5000002, 0x24ac6ffd, 0x000000c0, 0x4055e2c4,
+0x00a02494, 0xe2c40000, 0xc5f34055, 0x24547ffd,
+0x4de2c440, 0x4024543d, 0x547ffdc5, 0xe2c46024,
+0x2474394d, 0x7ffdc540, 0xc5402474, 0x2454feed,
+0x0348b840, 0xe5c50000, 0xa024b4fe, 0xc4000000,
+0xd5406de2, 0xd676edc5, 0x177de2c4, 0x25830fd1,
+0xc4000002, 0xeb4055e2, 0x6c7ffdc5, 0x4fb82024,
+0xc4000003, 0x541e7de2, 0xe5c52024, 0xe2c4da76,
+0x0fd9177d, 0x0001ff83, 0x0354b800, 0xfdc50000,
+0xc024946f, 0xc4000000, 0xda0a5de2, 0xdb76edc5,
+0x177de2c4, 0xdd830fd9, 0xc5000001, 0x249c6ffd,
+0x000000a0, 0xecfae5c5, 0xb46ffdc5, 0x00008024,
+0x0359b800, 0xe2c40000, 0xc5ee3655, 0xc4ed76e5,
+0xe9177de2, 0x01ae830f, 0x84c70000, 0x00010024,
+0x00000900, 0xfee5c500, 0x0362b8ee, 0xe2c40000,
+0x24bc587d, 0x00000100, 0xef76d5c5, 0x177de2c4,
+0x81830fe9, 0x31000001, 0xc501a8c0, 0x75eb6ffd,
+0x6ffdc504, 0x7ffdc5ee, 0x010024ac, 0x948b0000,
+0x00010084, 0x84548900, 0xf8834040, 0xc5da7508,
+0xb8f6efc9, 0x000003c4, 0xd666edc5, 0x8c6de2c4,
+0x008024ac, 0xfdc50000, 0x60246c7f, 0xed76d5c5,
+0x4c55e3c4, 0xe2c420d6, 0x245c8e6d, 0x6ffdc560,
+0xc560247c, 0x245476c5, 0x7de2c440, 0x830fd117,
+0x00000114, 0x0003d4b8, 0x6ffdc500, 0x00802494,
+0xe3c40000, 0x249c026d, 0x000000a0, 0x76e5c5aa,
+0xc440245c, 0xd9177de2, 0x00ea830f, 0xe3c40000,
+0x01da466d, 0xa9dbedc5, 0xffffffe0, 0x0f65e3c4,
+0xd5c504da, 0xe4b8e4fe, 0xc5000003, 0xc4dc76e5,
+0xd9177de2, 0x00be830f, 0x03b80000, 0xc5000000,
+0x24547ffd, 0xefd9c520, 0xefd1c5e4, 0x6ff9c5ed,
+0xc5202454, 0x24746ffd, 0x55e3c420, 0xc401d238,
+0xdc384de3, 0xe2c44800, 0xc5d3026d, 0x24547ffd,
+0xc4da7520, 0xd2397de3, 0x79e3c401, 0x8303d216,
+0xf8b824fa, 0x75000003, 0x0003b86f, 0xfdc50000,
+0x8024a46f, 0xc5000000, 0x24946ff9, 0x000000a0,
+0x397de3c4, 0xe3c401e3, 0x01d2385d, 0xa46ffdc5,
+0x0000a024, 0x5de3c400, 0xc400db38, 0xd3066de2,
+0xe4efd9c5, 0x6de3c448, 0xc401dc38, 0xd2397de3,
+0x6ff9c501, 0x65e2c4d2, 0xe875d202, 0xe1c5c031,
+0xedc5dbef, 0xe2c4d376, 0x0fd1177d, 0xf883c092,
+0x25c01901, 0x00000401, 0x5bf4658d, 0xc35d5f5e,
+0xc3240c8b, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000007, 0x00000007, 0x00000007, 0x00000007,
+0x00000007, 0x00000007, 0x00000007, 0x00000007,
+0x00000000, 0x00000000, 0x00000000,
+0003014,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u4[] = {
+0xba5500eb, 0x00000020, 0x00056ee8, 0xd3c18100,
+0x89000005, 0x57c031e5, 0xe4835356, 0x40ec81e0,
+0x8d000001, 0x00c0249c, 0xc7890000, 0x000009be,
+0xc6294000, 0x89243489, 0x01e683fe, 0x75f8854e,
+0x84894a01, 0x00009c84, 0x243c8b00, 0x8908f883,
+0x00dc84b4, 0x94890000, 0x0000fc84, 0x837c8900,
+0xc5c775fc, 0x24bc6ffd, 0x000000a0, 0x7c7ffdc5,
+0xf5c54024, 0xfdc5c976, 0x40245c6f, 0x000260b8,
+0x76e5c500, 0x7de2c4d7, 0x830fd117, 0x000004e3,
+0x94fee5c5, 0x0000a024, 0x7ffdc500, 0xc5602454,
+0x24bc6ffd, 0x000000a0, 0xf772edc5, 0x0266b801,
+0xedc50000, 0x60245476, 0x177de2c4, 0xb0830fd1,
+0xc5000004, 0x247c6ffd, 0xfac5c560, 0x00a02494,
+0xfdc50000, 0x8024947f, 0xb8000000, 0x0000026b,
+0xa476e5c5, 0x00008024, 0x7de2c400, 0x830fe117,
+0x0000047f, 0x9cebe5c5, 0x0000c024, 0x7ffdc500,
+0xc540245c, 0x2494dbed, 0x000000c0, 0xbc6ffdc5,
+0x00008024, 0xefc5c500, 0x00c0249c, 0xfdc50000,
+0x80249c7f, 0xb8000000, 0x00000277, 0x54dfedc5,
+0xc5c54024, 0xedc5ff76, 0xe2c4d376, 0x0fd1177d,
+0x00042e83, 0x6ffdc500, 0x00a02494, 0xe2c40000,
+0x249c406d, 0x000000c0, 0x9976e5c5, 0xffffffa0,
+0x3c2444c7, 0x00000002, 0x0002d3b8, 0x7de2c400,
+0x830fd917, 0x000003fb, 0x9cefedc5, 0x0000e024,
+0x7ffdc500, 0xc540245c, 0x249cf4e5, 0x000000c0,
+0x5c7ffdc5, 0x7c8d6024, 0xf6314024, 0xf7b3048b,
+0x8489b724, 0x000080b4, 0xb4948900, 0x00000084,
+0x8302c683, 0xe47508fe, 0x6c6ffdc5, 0xecb86024,
+0xc5000002, 0x249c76d5, 0x00000080, 0x177de2c4,
+0x9c830fd9, 0xc5000003, 0x24947ffd, 0x00000080,
+0xb46ffdc5, 0x00008024, 0x72ddc500, 0xfdc503f6,
+0x4024647f, 0xac6ffdc5, 0x00008024, 0x72e5c500,
+0xfdc502f5, 0x60245c7f, 0xdbfee5c5, 0x0002f8b8,
+0x76e5c500, 0x7de2c4dc, 0x830fd917, 0x00000353,
+0x746ffdc5, 0xe5c54024, 0xc502d672, 0xb8dbfee5,
+0x000002fd, 0x5c76e5c5, 0xe2c46024, 0x0fd9177d,
+0x00032e83, 0x2444c700, 0x0000033c, 0x6ef9c500,
+0xc53c245c, 0xc7dbf2ed, 0x023c2444, 0xc5000000,
+0x24646ef9, 0xf2edc53c, 0x7ffdc5e4, 0xc5602464,
+0xb8e4fedd, 0x00000310, 0xe376ddc5, 0x177de2c4,
+0xec830fe1, 0xc5000002, 0x24646ef9, 0xd2e5c53c,
+0xfee5c5dc, 0x0314b8db, 0xe5c50000, 0x60245c76,
+0x177de2c4, 0xc8830fd9, 0xc5000002, 0xc5e4efd9,
+0x249c76dd, 0x00000100, 0xdc76e5c5, 0x9cdbe5c5,
+0x0000a024, 0x7ffdc500, 0x0080249c, 0xe2c40000,
+0x24b44765, 0x00000100, 0xa4fec5c5, 0x00010024,
+0x7ffdc500, 0x010024a4, 0xe2c40000, 0x24a44765,
+0x00000100, 0x00032cb8, 0xfeddc500, 0x76d5c5ec,
+0x7de2c4ee, 0x830fe917, 0x00000267, 0x455de2c4,
+0x010024a4, 0x31b80000, 0xc5000003, 0xc4dc76e5,
+0xd9177de2, 0x0249830f, 0xe2c40000, 0x249c3b6d,
+0x000000c0, 0x5c7ffdc5, 0xe2c44024, 0x24a43f6d,
+0x000000c0, 0x647ffdc5, 0xedc56024, 0xc02494fe,
+0xc5000000, 0xb8dcfee5, 0x0000033f, 0xda76e5c5,
+0x177de2c4, 0x08830fd9, 0xb8000002, 0x00000354,
+0x946ffdc5, 0x0000e024, 0x6ffdc500, 0xffffc0a1,
+0x5de2c4ff, 0xe5c5da0a, 0xe2c4da76, 0x0fd9177d,
+0x0001de83, 0x6ffdc500, 0x00c0249c, 0xe5c50000,
+0xfdc5f4fa, 0xa024ac6f, 0xb8000000, 0x00000359,
+0x364de2c4, 0x76cdc5f5, 0x7de2c4f3, 0x830ff117,
+0x000001af, 0x202484c7, 0x09000001, 0xb8000000,
+0x00000362, 0x587de2c4, 0x012024b4, 0xfdc50000,
+0xc524347f, 0xc5f5fee5, 0x243476cd, 0x177de2c4,
+0x7c830ff1, 0x31000001, 0xc501a8c0, 0x75f36ffd,
+0x6ffdc504, 0x7ffdc5f5, 0x012024b4, 0x948b0000,
+0x00012084, 0x84548900, 0xf8834060, 0xc4da7508,
+0xac8c6de2, 0x0000a024, 0x03c4b800, 0xedc50000,
+0xfdc5d7ef, 0x8024ac7f, 0xc4000000, 0x9c8e6de2,
+0x00008024, 0x6ffdc500, 0x008024bc, 0xc5c50000,
+0x60245476, 0x177de2c4, 0x14830fd1, 0xb8000001,
+0x000003d4, 0x946ffdc5, 0x0000a024, 0x6de3c400,
+0xc0249c02, 0xaa000000, 0x5c76e5c5, 0xe2c46024,
+0x0fd9177d, 0x0000ea83, 0x6de3c400, 0xc501da46,
+0xe0a9dbed, 0xc4ffffff, 0xda0f65e3, 0xfed5c504,
+0x03e4b8e4, 0xe5c50000, 0xe2c4dc76, 0x0fd9177d,
+0x0000be83, 0x0003b800, 0xfdc50000, 0x4024547f,
+0xe4efd9c5, 0xedefd1c5, 0x546ff9c5, 0xfdc54024,
+0x40247c6f, 0x3855e3c4, 0xe3c401d2, 0x00dc3845,
+0x6de2c448, 0xfdc5d302, 0x4024547f, 0xe3c4da75,
+0x01d2397d, 0x1679e3c4, 0xfa8303d2, 0x03f8b824,
+0x6f750000, 0x000003b8, 0x6ffdc500, 0x00a024bc,
+0xf9c50000, 0xc024946f, 0xc4000000, 0xfb397de3,
+0x45e3c401, 0xc501d238, 0x24ac6ffd, 0x000000c0,
+0x3855e3c4, 0xe2c400db, 0xc5d3066d, 0x48e4efd9,
+0x386de3c4, 0xe3c401dc, 0x01d2397d, 0xd26ff9c5,
+0x0265e2c4, 0x31e875d2, 0xefe1c5c0, 0x76edc5db,
+0x7de2c4d3, 0x920fd117, 0x01f883c0, 0x0125c019,
+0x8d000004, 0x5e5bf465, 0x8bc35d5f, 0x00c3240c,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000007, 0x00000007, 0x00000007, 0x00000007,
+0x00000007, 0x00000007, 0x00000007, 0x00000007,
+0x00000000, 0x00000000, 0x00000000,
+0002754,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xe8535657,
+0x00000631, 0x06ccc381, 0xe4830000, 0x80ec81e0,
+0xc7000001, 0x40402444, 0x8d000000, 0x05beff78,
+0x89000000, 0xff31243c, 0x7489c629, 0xd7192024,
+0x89ffce83, 0xa824247c, 0x89c18901, 0xbe0774f7,
+0x00000001, 0x0c85ff31, 0xff047524, 0xc540244c,
+0x246c7efa, 0xd6f9c520, 0x00f8ccac, 0xbc890000,
+0x00011ccc, 0x247c8b00, 0xcc848940, 0x000000d8,
+0x18ccb489, 0x31000001, 0x01c083f6, 0xdccc9489,
+0x83000000, 0xbc8900d2, 0x000138cc, 0xccb48900,
+0x0000013c, 0xf183c189, 0x0fd10905, 0xffff7a85,
+0x6ffdc5ff, 0x00e024ac, 0xfdc50000, 0x8024ac7f,
+0xc5000000, 0xc5c976f5, 0x24a46ffd, 0x00000080,
+0x000260b8, 0x5de2c400, 0xe2c4d529, 0x0fd1177d,
+0x00055883, 0xd4ddc500, 0x00e02494, 0xfdc50000,
+0xa024947f, 0xc5000000, 0x24ac6ffd, 0x000000e0,
+0xf573edc5, 0x0266b801, 0xe2c40000, 0x2494296d,
+0x000000a0, 0x177de2c4, 0x1e830fd1, 0xc5000005,
+0x24bc6ffd, 0x000000a0, 0x94fbc5c5, 0x0000e024,
+0x7ffdc500, 0x00c02494, 0x6bb80000, 0xc4000002,
+0x94295de2, 0x0000c024, 0x7de2c400, 0x830fd117,
+0x000004e9, 0xac6ffdc5, 0x0000e024, 0x73edc500,
+0xd5c520d4, 0xc520d573, 0x2494f4ed, 0x000000e0,
+0xbc6ffdc5, 0x00010024, 0xf4ddc500, 0x00e0249c,
+0xd5c50000, 0xfdc5e4f4, 0x0024ac6f, 0xc5000001,
+0xc5d4d4ed, 0xc5e7f4c5, 0x20f273ed, 0xdad4e5c5,
+0xd573edc5, 0xf4edc520, 0xd4edc5d7, 0x73edc5d2,
+0xddc520f2, 0xfdc5fad4, 0x40247c7f, 0x946ffdc5,
+0x0000e024, 0xd4edc500, 0xfbedc5fd, 0x010024b4,
+0x82b80000, 0xc5000002, 0x245cfbe5, 0xf4cdc540,
+0x73ddc5ef, 0xfdc520d6, 0x20246c7f, 0xd773d5c5,
+0xf4ddc520, 0xf4d5c5e7, 0xd4ddc5ee, 0x73ddc5e5,
+0xddc520f4, 0x202464d4, 0x2965e2c4, 0x7de2c4dc,
+0x830fd917, 0x00000425, 0x9c6ffdc5, 0x00010024,
+0x73c5c500, 0xd5c520d2, 0xc520d373, 0x249cf4c5,
+0x00000100, 0xeaf4d5c5, 0xa4f4edc5, 0x00010024,
+0xd4e5c500, 0x73e5c5dd, 0xddc520f3, 0xd3b8dbd4,
+0xc4000002, 0x9b2965e2, 0xffffff80, 0x177de2c4,
+0xd6830fd9, 0xc5000003, 0x249c6ffd, 0x00000120,
+0xd373d5c5, 0xf4c5c520, 0xf4d5c5f3, 0xf4edc5ea,
+0xd4cdc5e3, 0x73cdc5f5, 0xddc520f6, 0xfdc5f6d4,
+0xc024b47f, 0xc5000000, 0x24b46ffd, 0x000000c0,
+0xf673edc5, 0x7ffdc503, 0x00802494, 0xfdc50000,
+0xc024b46f, 0xc5000000, 0x02f673cd, 0xb47ffdc5,
+0x0000a024, 0xd4cdc500, 0xf4c5c5f6, 0x4de2c4fb,
+0xf8b8f229, 0xc4000002, 0xf1177de2, 0x7c7ffdc5,
+0x830f4024, 0x00000355, 0xbc6ffdc5, 0x00008024,
+0x73cdc500, 0xfdc502d7, 0x8024bc6f, 0xc5000000,
+0x02e772c5, 0x024de3c4, 0xcdc5aaf7, 0xfdb8f6d4,
+0xc4000002, 0xb4294de2, 0x0000a024, 0x7de2c400,
+0x830ff117, 0x00000315, 0x7cd4d5c5, 0x44c74024,
+0x00037424, 0xc5c50000, 0xc520f773, 0x8bffd4dd,
+0x89742444, 0x99202444, 0x24245489, 0x747efac5,
+0xc5c52024, 0x44c7f6f3, 0x00027424, 0x448b0000,
+0x44897424, 0x89992024, 0xc5242454, 0x24547efa,
+0xf3c5c520, 0x7ffdc5fa, 0x00a024bc, 0xc5c50000,
+0x10b8ffd4, 0xc4000003, 0xfe2945e2, 0x177de2c4,
+0xa6830ff9, 0x8b000002, 0xc5742454, 0xc4ffefc1,
+0xd63745e2, 0x147ffdc5, 0x24548924, 0xc1d08920,
+0x44891ff8, 0x40b82424, 0xc5000000, 0x24547efa,
+0xc5d02920, 0xc5d2d3cd, 0x24547ffd, 0x6ef9c520,
+0x6ffdc5f0, 0xedc52414, 0xcdc5f6f3, 0x202474eb,
+0xf6d4cdc5, 0x000314b8, 0x4de2c400, 0xa024b429,
+0xc4000000, 0xf1177de2, 0x023f830f, 0xd5c50000,
+0x402454d4, 0xac6ffdc5, 0x00014024, 0x73edc500,
+0xddc520f2, 0xe2c4d2d4, 0xc5e73755, 0xc5e2dbdd,
+0x24a47ffd, 0x000000c0, 0x47dde2c4, 0x014024ac,
+0xfdc50000, 0x4024bc6f, 0xc5000001, 0xa0936ffd,
+0xc5ffffff, 0xc5f2fbc5, 0x24b47ffd, 0x00000140,
+0x47dde2c4, 0x014024a4, 0x2cb80000, 0xc5000003,
+0x24a47ffd, 0x000000a0, 0xe4d4ddc5, 0x295de2c4,
+0x7de2c4e5, 0x830fe117, 0x000001c1, 0xac6ffdc5,
+0x0000a024, 0x6ffdc500, 0xffffc0a3, 0xd5e2c4ff,
+0x40248c45, 0xc4000001, 0xa445dde2, 0x00014024,
+0x0331b800, 0xf5c50000, 0xf5c5ccef, 0xddc5ccfb,
+0xfdc5e476, 0x80248c7f, 0xc4000000, 0x8c2975e2,
+0x0000c024, 0x7de2c400, 0x830fcc17, 0x0000016d,
+0x000359b8, 0xfde3c400, 0xe0248c00, 0x1b000000,
+0xac6ffdc5, 0x00010024, 0x55e2c400, 0xe2c4c929,
+0x0fcc177d, 0x00014483, 0x035eb800, 0xfdc50000,
+0xe024b46f, 0xc4000000, 0xce00fde3, 0x75e3c4b1,
+0xc401c946, 0xc92955e2, 0x177de2c4, 0x1a830fcc,
+0xc7000001, 0x05782444, 0x31000000, 0x244489c0,
+0x0362b87c, 0xe2c40000, 0x244c5979, 0x7ff9c578,
+0x0160248c, 0xcdc50000, 0xe2c4cdd4, 0x24bc5a7d,
+0x00000160, 0x2975e2c4, 0x7de2c4cf, 0x830fcc17,
+0x000000d9, 0x01a8c031, 0xcd6ffdc5, 0xfdc50475,
+0xfdc5ce6f, 0x60248c7f, 0xc5000001, 0xc48c7efa,
+0x00000160, 0x8cd6f9c5, 0x0000a0c4, 0xf8834000,
+0xc5d37504, 0xb8c9eff1, 0x000003c4, 0x3765e2c4,
+0xe5e2c4d9, 0xe024a48c, 0xc5000000, 0x24a47ffd,
+0x000000c0, 0xe476ddc5, 0x4c5de3c4, 0xe2c430c9,
+0x24ac8ef5, 0x000000c0, 0x9c6ffdc5, 0x0000c024,
+0x65e2c400, 0xa0248c29, 0xc4000000, 0xcc177de2,
+0xd4b85b73, 0xc5000003, 0x248c6ffd, 0x000000e0,
+0x0275e3c4, 0x0100249c, 0xc4cc0000, 0x9c2965e2,
+0x0000a024, 0x7de2c400, 0x3173dc17, 0xe3c4c031,
+0x01d94675, 0x0f65e3c4, 0xf5c508d9, 0xffe08bdb,
+0xf5c5ffff, 0xe2c4cad4, 0xc4cb2975, 0xcc177de2,
+0x83c0920f, 0xc01901f8, 0x0003e425, 0xf4658d00,
+0x5d5f5e5b, 0x241c8bc3, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003354,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u8[] = {
+0xe85500eb, 0x00000482, 0x04f8c281, 0xe5890000,
+0x56ff3157, 0x000001be, 0xe4835300, 0x20ec81e0,
+0xc7000001, 0x400c2444, 0x8d000000, 0x05b9ff5e,
+0x89000000, 0x3108245c, 0x89f129db, 0x4c8b240c,
+0xfb190824, 0x04245c89, 0xe183f089, 0xcb894901,
+0x851ffbc1, 0x75082474, 0x244cff04, 0x7efac50c,
+0xf9c52434, 0x98c4b4d6, 0x89000000, 0x00bcc49c,
+0x5c8b0000, 0x74890c24, 0x8c8978c4, 0x0000b8c4,
+0x83c93100, 0x7c8901c6, 0xd7837cc4, 0xc49c8900,
+0x000000d8, 0xdcc48c89, 0x89000000, 0x05f083f0,
+0x8775f809, 0xbc6ffdc5, 0x00008024, 0x7ffdc500,
+0xc520247c, 0xc5c976f5, 0x245c6ffd, 0x0260b820,
+0xe2c40000, 0xc4d72965, 0xd1177de2, 0x03b0830f,
+0xe5c50000, 0x802494d4, 0xc5000000, 0x24547ffd,
+0x6ffdc540, 0x008024b4, 0xedc50000, 0xb801f673,
+0x00000266, 0x296de2c4, 0xc4402454, 0xd1177de2,
+0x037c830f, 0xfdc50000, 0x40247c6f, 0x94fbc5c5,
+0x00008024, 0x7ffdc500, 0xb8602454, 0x0000026b,
+0x2965e2c4, 0xc4602464, 0xe1177de2, 0x0350830f,
+0xe5c50000, 0xa0249ceb, 0xc5000000, 0x245c7ffd,
+0xdbedc520, 0x00a02494, 0xfdc50000, 0x6024746f,
+0x9cefcdc5, 0x0000a024, 0x0277b800, 0xedc50000,
+0xedc5d1ef, 0x202454db, 0x296de2c4, 0x7de2c4d3,
+0x830fd117, 0x0000030a, 0x946ffdc5, 0x00008024,
+0x6ffdc500, 0x00a024bc, 0xe5c50000, 0xc520d273,
+0x249cf4e5, 0x000000a0, 0xd773d5c5, 0xf4edc520,
+0x00a024a4, 0xd5c50000, 0xe5c5eaf4, 0xe5c5ddd4,
+0xc520f373, 0xb8dbd4dd, 0x000002d3, 0x2965e2c4,
+0xffffa09a, 0x7de2c4ff, 0x830fd917, 0x000002b2,
+0x547ffdc5, 0xfdc56024, 0x60246c6f, 0xf573ddc5,
+0x7ffdc503, 0xc5202464, 0x24746ffd, 0x73e5c560,
+0xfdc502f6, 0x40245c7f, 0xdbd4e5c5, 0x0002f8b8,
+0x65e2c400, 0xe2c4dc29, 0x0fd9177d, 0x00027183,
+0x6ffdc500, 0xc520247c, 0x02d773e5, 0xdbd4e5c5,
+0x0002fdb8, 0x65e2c400, 0x40245c29, 0x177de2c4,
+0x4b830fd9, 0xc7000002, 0x031c2444, 0xc5000000,
+0x245c6ef9, 0xf3edc51c, 0x2444c7db, 0x0000021c,
+0x6ef9c500, 0xc51c2464, 0xc5d4f3ed, 0x24547ffd,
+0xd4edc540, 0x0310b8d2, 0xe2c40000, 0xc4d3296d,
+0xd1177de2, 0x0208830f, 0xf9c50000, 0x1c24546e,
+0xd2d3e5c5, 0xd2d4edc5, 0x000314b8, 0x6de2c400,
+0x40245429, 0x177de2c4, 0xe3830fd1, 0xc5000001,
+0xc4dbefe1, 0x942965e2, 0x0000e024, 0x6de2c400,
+0xedc5d329, 0x802494db, 0xc5000000, 0x24547ffd,
+0xede2c460, 0xe0249c47, 0xc5000000, 0x24a4d4f5,
+0x000000e0, 0xa47ffdc5, 0x0000e024, 0xede2c400,
+0xe0249447, 0xb8000000, 0x0000032c, 0x547ffdc5,
+0xedc54024, 0xe2c4d2d4, 0xc4d3296d, 0xd1177de2,
+0x017c830f, 0xfdc50000, 0x40246c6f, 0x45d5e2c4,
+0x00e02494, 0x31b80000, 0xc5000003, 0x24547ffd,
+0x6de2c420, 0x60245429, 0x177de2c4, 0x4f830fd1,
+0xb8000001, 0x00000359, 0x00fde3c4, 0x00802494,
+0xc51b0000, 0x249c6ffd, 0x000000a0, 0x2965e2c4,
+0x7de2c4d2, 0x830fd117, 0x00000126, 0x00035eb8,
+0x6ffdc500, 0x008024a4, 0xe3c40000, 0xb1d400fd,
+0x466de3c4, 0xe2c401d2, 0xc4d3296d, 0xd1177de2,
+0x00fc830f, 0x84c70000, 0x00010024, 0x00000500,
+0xc5c03100, 0x89d3d4dd, 0x01042484, 0x62b80000,
+0xc4000003, 0xac597de2, 0x00010024, 0x6de2c400,
+0xe2c4d529, 0x0fd1177d, 0x0000c583, 0xa8c03100,
+0x6ffdc501, 0xc50475d3, 0xc5d46ffd, 0x24947ffd,
+0x00000100, 0x947efac5, 0x000100c4, 0xd6f9c500,
+0x4040c454, 0x7504f883, 0x6ffdc5d6, 0x00c024b4,
+0xc4b80000, 0xc4000003, 0x948ccde2, 0x00008024,
+0x7ffdc500, 0xc5602454, 0xc4d6eff5, 0x5c8eede2,
+0xfdc56024, 0x60247c6f, 0x2945e2c4, 0xc4402454,
+0xd1177de2, 0xd4b85c73, 0xc5000003, 0x24946ffd,
+0x00000080, 0x026de3c4, 0x00a0249c, 0xc4cc0000,
+0x5c2965e2, 0xe2c44024, 0x73d9177d, 0x6de3c435,
+0xc401da46, 0xda0f65e3, 0xdbedc508, 0xffffc092,
+0xd4edc5ff, 0xffffe092, 0xc4c031ff, 0xd3296de2,
+0x177de2c4, 0xc0920fd1, 0x1901f883, 0x03e425c0,
+0x658d0000, 0x5f5e5bf4, 0x148bc35d, 0x0000c324,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002414,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32f4[] = {
+0xd2e800eb, 0x81000005, 0x0006edc2, 0x55c03100,
+0x5356e589, 0x000009bb, 0xe0e48300, 0x0100ec81,
+0xc1890000, 0x24448940, 0xdbde891c, 0x291c2444,
+0x01c1f6c6, 0x1c247489, 0x7c845cd9, 0x1c2444db,
+0x9c849cd9, 0xd9000000, 0xd9e0d9e8, 0xddc9dbe8,
+0x08f883d9, 0xbc849cd9, 0x75000000, 0x28fcc5c5,
+0x008024bc, 0xfcc50000, 0x20247c29, 0xc976f5c5,
+0x5428fcc5, 0x60b82024, 0xc5000002, 0x00dfc2ec,
+0x177de2c4, 0x47830fd9, 0xc5000005, 0x249c58ec,
+0x00000080, 0x5c29fcc5, 0x66b84024, 0xc5000002,
+0x24bc28fc, 0x00000080, 0xdf58c4c5, 0x5cc2e4c5,
+0xc4004024, 0xd9177de2, 0x0514830f, 0xfcc50000,
+0x40247c28, 0x9c5cc4c5, 0x00008024, 0x29fcc500,
+0xb860245c, 0x0000026b, 0x5cc2ecc5, 0xc4006024,
+0xd9177de2, 0x04e8830f, 0xfcc50000, 0xa024bc28,
+0xc5000000, 0x249459ec, 0x00000080, 0xe759c4c5,
+0x9c28fcc5, 0x00008024, 0x58e4c500, 0x0282b8f7,
+0xe4c50000, 0xa024ac5c, 0xc5000000, 0xc5d45cec,
+0xc5ee59d4, 0x00d5c2ec, 0x177de2c4, 0x9f830fd1,
+0xc5000004, 0x249459e4, 0x000000c0, 0x5429fcc5,
+0x8bb82024, 0xc5000002, 0x249c5ee4, 0x000000c0,
+0xd3c2ecc5, 0x7de2c400, 0x830fd117, 0x00000472,
+0x00028eb8, 0x28fcc500, 0xfffeec9a, 0x28fcc5ff,
+0x00c024b4, 0xccc50000, 0xe4c5d357, 0x80249c57,
+0xc5000000, 0x245459ec, 0xc2ecc520, 0xe2c400d3,
+0x0fd1177d, 0x00043983, 0x53fcc500, 0x00802494,
+0xfcc50000, 0x20245429, 0x000296b8, 0x53fcc500,
+0xc5202454, 0x249c28fc, 0x00000080, 0xd25bfdc5,
+0xd25bfcc5, 0xd3c2ecc5, 0x7de2c400, 0x830fd117,
+0x000003fe, 0xd359e4c5, 0x5429fcc5, 0xfcc52024,
+0x20245452, 0x5429fcc5, 0x9db84024, 0xc5000002,
+0x245428fc, 0x53fcc540, 0x5bfdc5e2, 0x5bfcc5e4,
+0xc2e4c5e4, 0xe2c400dc, 0x0fd9177d, 0x0003c183,
+0x029fb800, 0xfdc50000, 0xfcc5d25b, 0x80249c28,
+0xc5000000, 0xc5d25bfc, 0xc5e353fc, 0xc5e45bfd,
+0xc5e45bfc, 0x00d4c2ec, 0x177de2c4, 0x8f830fd1,
+0xc5000003, 0xc5d359e4, 0x245429fc, 0x02a7b820,
+0xfcc50000, 0x20245451, 0xd3c2ecc5, 0x7de2c400,
+0x830fd117, 0x0000036a, 0xa228fcc5, 0xffffff0c,
+0xd35edcc5, 0x5429fcc5, 0xafb82024, 0xc4000002,
+0x54087de3, 0xc50b2024, 0x2c92c2ec, 0x00ffffff,
+0x177de2c4, 0x37830fd1, 0xc5000003, 0x249459cc,
+0x000000a0, 0xeb59ccc5, 0x5429fcc5, 0xd4c54024,
+0x4024545f, 0x5429fcc5, 0xd4c56024, 0x40246c5d,
+0x6c29fcc5, 0x48b84024, 0xc5000003, 0x245458ec,
+0x58e4c540, 0x00a0249c, 0xecc50000, 0xecc5d659,
+0xc400d3c2, 0xd1177de2, 0x02e4830f, 0x59b80000,
+0xc4000003, 0x94047de3, 0x00008024, 0xfcc51b00,
+0xa0249c28, 0xc4000000, 0xd2066de3, 0xc2e4c501,
+0xe2c400d2, 0x0fd1177d, 0x0002b583, 0x5bfdc500,
+0xfaedc5d3, 0xffff4c92, 0x28fcc5ff, 0x008024ac,
+0x5eb80000, 0xc4000003, 0xd5166de2, 0xd2c2e4c5,
+0x7de2c400, 0x830fd117, 0x00000286, 0x9210fac5,
+0xffffffec, 0xed58e4c5, 0x000362b8, 0x7de2c400,
+0xd4c5d218, 0xc400eac2, 0xe9177de2, 0x0260830f,
+0xfec50000, 0x80249412, 0xb8000000, 0x000003b1,
+0x945cecc5, 0x00008024, 0x28fcc500, 0xffff6caa,
+0x28fcc5ff, 0xffff8cba, 0x58d4c5ff, 0x59d4c5ee,
+0xc2ecc5ef, 0xe2c400d5, 0x0fd1177d, 0x00022183,
+0x16fec500, 0x008024ac, 0xfcc50000, 0x20246c29,
+0x0003b8b8, 0x28fcc500, 0x00802494, 0xccc50000,
+0xd4c5e458, 0xdcc5ea5c, 0xd4c5e759, 0xc400ecc2,
+0xe9177de2, 0x01e8830f, 0xc0310000, 0xfcc501a8,
+0x0475cb28, 0xca28fcc5, 0x8c29fcc5, 0x0000e024,
+0x8484d900, 0x000000e0, 0x40845cd9, 0x08f88340,
+0xd8c5da75, 0xfcc5e457, 0x40246c28, 0xe6c2dcc5,
+0x03c4b801, 0xe3c40000, 0x40d24a65, 0xcac2d4c5,
+0x76edc500, 0x7de2c4d2, 0x830fca17, 0x00000192,
+0x2c5de2c4, 0x0080248c, 0xc9c50000, 0xfcc5f6ef,
+0x60244c29, 0x0003cdb8, 0x76f5c500, 0x75e3c4c9,
+0xc440ce4c, 0x5c2e75e2, 0xfcc56024, 0x60247428,
+0xcdc2ccc5, 0x7de2c400, 0x830fca17, 0x00000152,
+0x0003d4b8, 0x28fcc500, 0x008024bc, 0xe3c40000,
+0x248c0c45, 0x000000a0, 0xc2d4c5aa, 0xe2c400e9,
+0x0fea177d, 0x00012983, 0x28fcc500, 0x008024b4,
+0xcfc50000, 0xa0248cd0, 0xb8000000, 0x000003dd,
+0xbc28fcc5, 0x00008024, 0xd0c7c500, 0x00a0249c,
+0xf4c50000, 0xc400cbc2, 0xca177de2, 0x00f0830f,
+0xfcc50000, 0x8024a428, 0xc4000000, 0x9c405de3,
+0x0000a024, 0xfac5f100, 0x1c245c11, 0x197de3c4,
+0xecb801db, 0xd9000003, 0xc51c2444, 0x245c11fa,
+0x2444d91c, 0xd9c1de1c, 0xc51c245c, 0x244c10fa,
+0xc2f4c51c, 0xffffac8a, 0xe2c400ff, 0x0fca177d,
+0x00009d83, 0x0003b800, 0xfcc50000, 0x20246429,
+0xdb57e0c5, 0xa26ffdc5, 0xffffffcc, 0x7ce7c548,
+0xc420244c, 0xc9165de2, 0x4c29fcc5, 0xec752024,
+0xfffc82d9, 0xe3c4ffff, 0x01c9197d, 0x1779e3c4,
+0x031c244c, 0x1c2444d9, 0xd8dde9df, 0x4d754f7a,
+0xfcc5c031, 0x8024b428, 0xc5000000, 0x248c7dcf,
+0x000000a0, 0x165de2c4, 0x7cf7c5c9, 0x5de2c4cb,
+0xf7c5c916, 0xe2c4cb7c, 0xc5c9165d, 0xc4cb7cf7,
+0xc9165de2, 0xcbc2f4c5, 0x7de2c400, 0x920fca17,
+0x01f883c0, 0x0125c019, 0xeb000004, 0x03f8b805,
+0x658d0000, 0x5d5e5bf8, 0x24148bc3, 0x000000c3,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0x41100000, 0x00000000, 0x00000000, 0x00000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0003400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32f8[] = {
+0xbee800eb, 0x81000005, 0x0006a9c2, 0x55e8d900,
+0xe483e589, 0x00ec81e0, 0xdd000001, 0x00802494,
+0x82d90000, 0xffffff30, 0xa02494dd, 0xd9000000,
+0x2494ddc9, 0x000000c0, 0xff3482d9, 0x94ddffff,
+0x00008824, 0x3882d900, 0xddffffff, 0x00a82494,
+0xe8d90000, 0x94dde0d9, 0x0000c824, 0xddc9d900,
+0x0090249c, 0xc9d90000, 0xb0249cdd, 0xd9000000,
+0x2494ddc9, 0x000000d0, 0x9cddcad9, 0x00009824,
+0xddc9d900, 0x00b8249c, 0x9cdd0000, 0x0000d824,
+0x28fdc500, 0x008024bc, 0xfdc50000, 0x20247c29,
+0xc976f5c5, 0x5428fdc5, 0x60b82024, 0xc5000002,
+0x00dfc2ed, 0x177de2c4, 0x04830fd9, 0xc5000005,
+0x249c58ed, 0x00000080, 0x5c29fdc5, 0x66b84024,
+0xc5000002, 0x24bc28fd, 0x00000080, 0xdf58c5c5,
+0x5cc2e5c5, 0xc4004024, 0xd9177de2, 0x04d1830f,
+0xfdc50000, 0x40247c28, 0x9c5cc5c5, 0x00008024,
+0x29fdc500, 0xb860245c, 0x0000026b, 0x5cc2edc5,
+0xc4006024, 0xd9177de2, 0x04a5830f, 0xfdc50000,
+0xa024bc28, 0xc5000000, 0x249459ed, 0x00000080,
+0xe759c5c5, 0x9c28fdc5, 0x00008024, 0x58e5c500,
+0x0282b8f7, 0xe5c50000, 0xa024ac5c, 0xc5000000,
+0xc5d45ced, 0xc5ee59d5, 0x00d5c2ed, 0x177de2c4,
+0x5c830fd1, 0xc5000004, 0x249459e5, 0x000000c0,
+0x5429fdc5, 0x8bb82024, 0xc5000002, 0x249c5ee5,
+0x000000c0, 0xd3c2edc5, 0x7de2c400, 0x830fd117,
+0x0000042f, 0x00028eb8, 0x28fdc500, 0xffff509a,
+0x28fdc5ff, 0x00c024a4, 0xddc50000, 0xe5c5d357,
+0x80249c57, 0xc5000000, 0x245459ed, 0xc2edc520,
+0xe2c400d3, 0x0fd1177d, 0x0003f683, 0x5afdc500,
+0x00802494, 0xe3c40000, 0x01d2186d, 0xd253fcc5,
+0xd25afcc5, 0x5429fdc5, 0x96b82024, 0xc5000002,
+0x24545afd, 0x28fdc520, 0x0080249c, 0xf8c50000,
+0xe0249429, 0xc4000000, 0xd2186de3, 0x53fcc501,
+0x5afcc5d2, 0xe6ffc5d2, 0xe6fec5d2, 0xc2edc5d2,
+0xe2c400d3, 0x0fd1177d, 0x00039683, 0x59e5c500,
+0x29fdc5d3, 0xc5202454, 0x24545afd, 0x6de3c420,
+0xc501d218, 0xc5d252fc, 0xc5d25afc, 0x245429fd,
+0x28fdc540, 0xc540246c, 0xb8d55afd, 0x0000029d,
+0x9429f8c5, 0x0000e024, 0x6de3c400, 0xc501d218,
+0xc5d253fc, 0xc5d25afc, 0xc5d2e6ff, 0xc5d2e6fe,
+0x00dac2e5, 0x177de2c4, 0x34830fd9, 0xc5000003,
+0x249c28fd, 0x00000080, 0xd35afdc5, 0xede6ffc5,
+0x00029fb8, 0xe6fec500, 0x29f8c5ed, 0x00e02494,
+0xe3c40000, 0x01d2186d, 0xd253fcc5, 0xd25afcc5,
+0xd2e6ffc5, 0xd2e6fec5, 0xeac2d5c5, 0x7de2c400,
+0x830fe917, 0x000002eb, 0xd359e5c5, 0x5429fdc5,
+0xa7b82024, 0xc5000002, 0x245451fd, 0xc2edc520,
+0xe2c400d3, 0x0fd1177d, 0x0002c683, 0x28fdc500,
+0xffff7092, 0x5eedc5ff, 0x29fdc5d3, 0xb8202454,
+0x000002af, 0x097de3c4, 0x0b202454, 0x92c2edc5,
+0xffffff90, 0x7de2c400, 0x830fd117, 0x00000293,
+0x9459ddc5, 0x0000a024, 0x59ddc500, 0x29fdc5eb,
+0xc5402454, 0x24545fd5, 0x29fdc540, 0xc5602454,
+0x246c5dd5, 0x29fdc540, 0xb840246c, 0x00000348,
+0x5458edc5, 0xe5c54024, 0xa0249c58, 0xc5000000,
+0xc5d459ed, 0x00d3c2ed, 0x177de2c4, 0x40830fd1,
+0xb8000002, 0x00000359, 0x057de3c4, 0x00802494,
+0xc5050000, 0x24ac28fd, 0x000000a0, 0x066de3c4,
+0xd5c501d2, 0xc400d2c2, 0xd1177de2, 0x0211830f,
+0x5eb80000, 0xc5000003, 0x249428fd, 0x00000080,
+0x01fde3c4, 0xe5c51bda, 0xc400ddc2, 0xd9177de2,
+0x01ed830f, 0xedc50000, 0xfac5d558, 0xfff09a7e,
+0x62b8ffff, 0xc4000003, 0xdb197de2, 0xd3c2edc5,
+0x7de2c400, 0x830fd117, 0x000001c7, 0x9c12ffc5,
+0x00008024, 0x29fdc500, 0xb820245c, 0x000003b1,
+0x9428fdc5, 0x00008024, 0x58ddc500, 0xffffb0b2,
+0x5ce5c5ff, 0x59cdc5da, 0xffffd0b2, 0xc2e5c5ff,
+0xe2c400de, 0x0fd9177d, 0x00018683, 0xa8c03100,
+0x28fdc501, 0xc50475cd, 0xc5ca28fd, 0x248c29fd,
+0x000000e0, 0xbc10fbc5, 0x0000e0c4, 0x11fbc500,
+0x4040c47c, 0x7504f883, 0x57e1c5d6, 0x28fdc5db,
+0xc5402474, 0x01e4c2e5, 0x0003c4b8, 0x55e3c400,
+0xc540d24b, 0x00cac2cd, 0xd276edc5, 0x177de2c4,
+0x2c830fca, 0xc4000001, 0x8c2d5de2, 0x00008024,
+0x03cdb800, 0xfdc50000, 0x60244c29, 0xc9eff1c5,
+0x4c6de3c4, 0xe2c440c9, 0x246c2f75, 0x28fdc560,
+0xc560247c, 0x00cec2c5, 0x177de2c4, 0xf0830fca,
+0xb8000000, 0x000003d4, 0xbc28fdc5, 0x00008024,
+0x45e3c400, 0xa0248c0d, 0x0a000000, 0xf1c2cdc5,
+0x7de2c400, 0x830ff217, 0x000000c7, 0xb428fdc5,
+0x00008024, 0xd0cdc500, 0x00a0248c, 0xddb80000,
+0xc5000003, 0x24a428fd, 0x00000080, 0xacd0ddc5,
+0x0000a024, 0xc2f5c500, 0xe2c400cd, 0x0fca177d,
+0x00008e83, 0x29fdc500, 0xc5202464, 0x244c7ce5,
+0xfde3c420, 0xc5d8c901, 0x244c29fd, 0x7ce5c520,
+0xc420244c, 0xc901fde3, 0x7de3c4d8, 0xc501c919,
+0x244c17f9, 0x3c82d918, 0xddffffff, 0xdf182444,
+0x7ad8dde9, 0x31477549, 0x28fdc5c0, 0x008024b4,
+0xcdc50000, 0xa0248c7d, 0xc4000000, 0xc901fde3,
+0x7cf5c5d8, 0xfde3c4cb, 0xc5d8c901, 0xc4cb7cf5,
+0xc901fde3, 0xc2f5c5d8, 0xe2c400cb, 0x0fca177d,
+0xf883c092, 0x25c01901, 0x00000401, 0xf8b805eb,
+0xc9000003, 0x24148bc3, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x41200000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40140000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003274,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xc2e853e5, 0x81000004,
+0x0004f1c3, 0xec815100, 0x00000100, 0x8b10fac5,
+0xffffffe0, 0x8d11fac5, 0xffffff34, 0x8d11fac5,
+0xffffff38, 0x8d11fac5, 0xffffff3c, 0xff34858b,
+0x8589ffff, 0xffffff28, 0x9510fac5, 0xffffff28,
+0x00bac031, 0xc5000000, 0x34952ef8, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0x73e82404, 0x83ffffff,
+0xc18810c4, 0x000260b8, 0x0fc98400, 0x00044684,
+0x10fac500, 0xffff2895, 0x58eac5ff, 0xffff3495,
+0x11fac5ff, 0xffff2c95, 0x10fac5ff, 0xffff3495,
+0x10ec83ff, 0xeac5c031, 0xf8c5d258, 0xff2c952e,
+0x9b0fffff, 0xc2450fc0, 0x0489d8f7, 0xff20e824,
+0xc483ffff, 0xb8c18810, 0x00000266, 0x840fc984,
+0x000003f3, 0x9510fac5, 0xffffff2c, 0x955ceac5,
+0xffffff34, 0x9511fac5, 0xffffff08, 0xff08858b,
+0x8589ffff, 0xffffff64, 0xff2c8589, 0x8589ffff,
+0xffffff30, 0x9510fac5, 0xffffff28, 0x3110ec83,
+0x2ef8c5c0, 0xffff3095, 0xc09b0fff, 0xf7c2450f,
+0x240489d8, 0xfffeb9e8, 0x10c483ff, 0x6bb8c188,
+0x84000002, 0x8c840fc9, 0xc5000003, 0x289510fa,
+0xc5ffffff, 0x349559ea, 0xc5ffffff, 0x289511fa,
+0xc5ffffff, 0x389510fa, 0xc5ffffff, 0xc5d259ea,
+0x2c9511fa, 0xc5ffffff, 0x349510fa, 0xc5ffffff,
+0x389558ea, 0xc5ffffff, 0x309511fa, 0xc5ffffff,
+0x349510fa, 0x83ffffff, 0xfac510ec, 0xff28a510,
+0xc031ffff, 0x9d5ceac5, 0xffffff38, 0xa55cdac5,
+0xffffff2c, 0x9d59e2c5, 0xffffff30, 0x9d11fac5,
+0xffffff30, 0xe32ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffe1a, 0x8810c483, 0x0282b8c1,
+0xc9840000, 0x02ed840f, 0xeac50000, 0xff3c9559,
+0xfac5ffff, 0xff289511, 0xfac5ffff, 0xff349510,
+0xec83ffff, 0xc5c03110, 0x3c955eea, 0xc5ffffff,
+0x28952ef8, 0xc5ffffff, 0x2c9511fa, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0xc3e82404, 0x83fffffd,
+0xc18810c4, 0x00028bb8, 0x0fc98400, 0x00029684,
+0x10fac500, 0xfffff0a3, 0x10ec83ff, 0x9510fac5,
+0xffffff3c, 0xfac5c031, 0xff349d10, 0xe8c5ffff,
+0xeac5d457, 0xff289559, 0xe0c5ffff, 0xf8c5dc57,
+0x9b0fd32e, 0xc2450fc0, 0x0489d8f7, 0xfd70e824,
+0xc483ffff, 0xb8c18810, 0x0000028e, 0x840fc984,
+0x00000243, 0x95530ff3, 0xffffff34, 0x9511fac5,
+0xffffff28, 0x9d530ff3, 0xffffff28, 0xc32cfac5,
+0xc510ec83, 0x349510fa, 0xc5ffffff, 0x31d82ae2,
+0x2ef8c5c0, 0xc09b0fda, 0xf7c2450f, 0x240489d8,
+0xfffd1de8, 0x10c483ff, 0x96b8c188, 0x84000002,
+0xf0840fc9, 0xc5000001, 0xc5d259ea, 0x289511fa,
+0xf3ffffff, 0x2895520f, 0xc5ffffff, 0x2c9511fa,
+0xf3ffffff, 0x2c95530f, 0xc5ffffff, 0x83c22cfa,
+0xeac510ec, 0xc031d02a, 0x952ef8c5, 0xffffff34,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffcc2,
+0x8810c483, 0x029db8c1, 0xc9840000, 0x0195840f,
+0xfac50000, 0xff2c852c, 0xec83ffff, 0x530ff310,
+0xffff3495, 0x2ae2c5ff, 0x2cfac5d8, 0x2aeac5c2,
+0xc5c031d0, 0x0fda2ef8, 0x450fc09b, 0x89d8f7c2,
+0x7be82404, 0x83fffffc, 0xc18810c4, 0x00029fb8,
+0x0fc98400, 0x00014e84, 0x10fac500, 0xffff3495,
+0x59eac5ff, 0x11fac5d2, 0xffff2895, 0x10fac5ff,
+0xffff3495, 0x10ec83ff, 0x0ff3c031, 0xff289d51,
+0xf8c5ffff, 0x9b0fda2e, 0xc2450fc0, 0x0489d8f7,
+0xfc2ce824, 0xc483ffff, 0xb8c28810, 0x000002a7,
+0x840fd284, 0x000000ff, 0xd25ef2c5, 0x8d11fac5,
+0xffffff2c, 0x9511fac5, 0xffffff28, 0xec83c031,
+0x3a0f6610, 0xff288d0a, 0xc50bffff, 0x2c8d2ef8,
+0xbaffffff, 0x00000000, 0x8d11fac5, 0xffffff30,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffbd2,
+0x8810c483, 0x02afb8c1, 0xc9840000, 0x00a5840f,
+0xfac50000, 0xff3c8d10, 0xf2c5ffff, 0xff349559,
+0xf2c5ffff, 0xff388d59, 0xfac5ffff, 0xff289511,
+0xfac5ffff, 0xff2c8d11, 0xfac5ffff, 0xff288d10,
+0xf2c5ffff, 0xff2c8d5f, 0xfac5ffff, 0xff308d11,
+0xfac5ffff, 0xff288d10, 0xf2c5ffff, 0xff2c8d5d,
+0xfac5ffff, 0xff2c8d11, 0xfac5ffff, 0xff2c8d10,
+0xec83ffff, 0x10fac510, 0xffff3495, 0xc5c031ff,
+0x308d58f2, 0xc5ffffff, 0x389558ea, 0xc5ffffff,
+0x3c8d59f2, 0xc5ffffff, 0x0fca2ef8, 0x450fc09b,
+0x89d8f7c2, 0x27e82404, 0x83fffffb, 0x013c10c4,
+0x4825c019, 0x8d000003, 0x5b59f865, 0xfc618d5d,
+0x241c8bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002454,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_f8[] = {
+0x17e800eb, 0x81000005, 0x000549c1, 0xe5895500,
+0x81e0e483, 0x0001c0ec, 0x10fbc500, 0xffffe089,
+0x11fbc5ff, 0xc558244c, 0x244c11fb, 0x11fbc560,
+0x8b68244c, 0x89582444, 0x8b402444, 0x895c2444,
+0xc5442444, 0x246c10fb, 0x2ef9c540, 0x7a58246c,
+0x0001b80c, 0x00ba0000, 0x74000000, 0x31c03104,
+0x89d8f7d2, 0x83182444, 0x60b800d2, 0xf7000002,
+0x245489da, 0x446f0f1c, 0xd70f1824, 0xfffa81d0,
+0x0f000000, 0x00049385, 0x10fbc500, 0xc5402474,
+0x245458cb, 0x11fbc558, 0x31482454, 0x10fbc5d2,
+0xb8582454, 0x00000001, 0xd258ebc5, 0x542ef9c5,
+0x027a4824, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000266, 0x5489daf7, 0x6f0f1c24,
+0x0f18244c, 0xfa81d1d7, 0x000000ff, 0x043a850f,
+0xfbc50000, 0x48247c10, 0x545cc3c5, 0xfbc55824,
+0x20245411, 0x2024548b, 0x2424448b, 0xb8249489,
+0x89000000, 0x00bc2484, 0x54890000, 0x44894824,
+0x54894c24, 0x44895024, 0xd2315424, 0x6410fbc5,
+0x01b84024, 0xc5000000, 0x24642ef9, 0x74027a50,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x6bb800d2,
+0xf7000002, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x0003bf85, 0x10fbc500,
+0xc540246c, 0x245459d3, 0x11fbc558, 0xc5402454,
+0x245410fb, 0x59ebc560, 0x11fbc5d2, 0xc5482454,
+0x247410fb, 0x58cbc558, 0xc5602454, 0x245411fb,
+0xc5d23150, 0x245410fb, 0x10fbc558, 0xc540247c,
+0x245c5ceb, 0x5cc3c560, 0xc5482464, 0x245c59e3,
+0x0001b850, 0xfbc50000, 0x50245c11, 0xe32ef9c5,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0282b800, 0xdaf70000, 0x1c245489, 0x245c6f0f,
+0xd3d70f18, 0x00fffa81, 0x850f0000, 0x0000032c,
+0x5459ebc5, 0xfbc56824, 0x40245411, 0xfbc5d231,
+0x58246410, 0x000001b8, 0x5edbc500, 0xc5682454,
+0x245411fb, 0x2ef9c548, 0x7a402454, 0x31047402,
+0xf7d231c0, 0x244489d8, 0x00d28318, 0x00028bb8,
+0x89daf700, 0x0f1c2454, 0x1824646f, 0x81d4d70f,
+0x0000fffa, 0xd1850f00, 0x31000002, 0x7efac5d2,
+0xfffff099, 0x10fbc5ff, 0xc568246c, 0x247410fb,
+0x57d1c558, 0x0001b8d3, 0xebc50000, 0x40245459,
+0xdb57c9c5, 0xd32ef9c5, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x028eb800, 0xdaf70000,
+0x1c245489, 0x246c6f0f, 0xd5d70f18, 0x00fffa81,
+0x850f0000, 0x00000274, 0x545a0ff2, 0x0ff35824,
+0x0ff3d253, 0xf9c5d25a, 0x40245413, 0x5c5a0ff2,
+0x0ff34024, 0x0ff3db53, 0xfbc5db5a, 0xd231c32c,
+0x5410fbc5, 0xe3c55824, 0x01b8d82a, 0xc5000000,
+0x7ada2ef9, 0x31047402, 0xf7d231c0, 0x244489d8,
+0x00d28318, 0x000296b8, 0x89daf700, 0x0f1c2454,
+0x1824746f, 0x81d6d70f, 0x0000fffa, 0x09850f00,
+0xc5000002, 0xc5d259eb, 0x245411fb, 0x5a0ff240,
+0xf3402454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff248, 0xf3482454, 0xf3d2530f, 0xc5d25a0f,
+0x31c22cfb, 0x2aebc5d2, 0x0001b8d0, 0xf9c50000,
+0x5824542e, 0x0474027a, 0xd231c031, 0x4489d8f7,
+0xd2831824, 0x029db800, 0xdaf70000, 0x1c245489,
+0x247c6f0f, 0xd7d70f18, 0x00fffa81, 0x850f0000,
+0x00000198, 0x545a0ff2, 0x0ff35824, 0x0ff3d253,
+0xfbc5d25a, 0xfbc5c22c, 0x4824542c, 0x940fc239,
+0x0fd231c0, 0xd8f7c0b6, 0x18244489, 0xb800d283,
+0x0000029f, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x014e850f, 0xfbc50000,
+0x58245410, 0xd259ebc5, 0x5411fbc5, 0xd2314024,
+0x5410fbc5, 0x01b85824, 0xf2000000, 0x245c510f,
+0x2ef9c540, 0x74027ada, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0xa7b800d2, 0xf7000002, 0x245489da,
+0x4c6f0f1c, 0xd70f1824, 0xfffa81d1, 0x0f000000,
+0x0000f785, 0x5ef3c500, 0x11fbc5d2, 0xc548244c,
+0x245411fb, 0xb8d23140, 0x00000001, 0x0b3a0f66,
+0x0b40244c, 0x4c11fbc5, 0xf9c55024, 0x48244c2e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x02afb800, 0xdaf70000, 0x1c245489, 0x24546f0f,
+0xd2d70f18, 0x00fffa81, 0x850f0000, 0x0000009c,
+0x4c10fbc5, 0xf3c56824, 0x58245459, 0x4c59f3c5,
+0xfbc56024, 0x40245411, 0x4c11fbc5, 0xfbc54824,
+0x40247c10, 0x4c5fc3c5, 0xfbc54824, 0x50244c11,
+0x6410fbc5, 0xdbc54024, 0x48244c5d, 0x4c11fbc5,
+0xd2314824, 0x6c10fbc5, 0xfbc54824, 0x58247410,
+0x4c58d3c5, 0xcbc55024, 0x60245458, 0x4c59f3c5,
+0x01b86824, 0xc5000000, 0x7aca2ef9, 0x31047402,
+0xf7d231c0, 0x244489d8, 0x00d28318, 0x5489daf7,
+0x48ba1c24, 0x0f000003, 0x18245c6f, 0x3dc3d70f,
+0x000000ff, 0x000000b8, 0xc2450f00, 0x0c8bc3c9,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002534,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b24100,
+0x41e58948, 0x4c564157, 0xff7f9d8d, 0x8d4cffff,
+0x55418f4d, 0x9f458d4c, 0xaf7d8d48, 0x48535441,
+0x4430ec83, 0x488dd289, 0x048841ff, 0x41c22903,
+0x89011488, 0x01e283ca, 0x1901fa83, 0x83c121d2,
+0xcaff02e2, 0x8301f983, 0x884100de, 0x88400014,
+0xff480734, 0xf88348c0, 0xc5c87511, 0x807d6ff9,
+0xbd7ff9c5, 0xffffff50, 0x956ff9c5, 0xffffff50,
+0x000260b8, 0x74e9c500, 0x76c1c5cf, 0x79e2c4ff,
+0x830fcf17, 0x00000625, 0x4dfce9c5, 0x7ff9c580,
+0xffff608d, 0x6ff9c5ff, 0x66b8804d, 0xc5000002,
+0xc5c9fcf1, 0x608d74f1, 0xc4ffffff, 0xcf1779e2,
+0x05f7830f, 0xf9c50000, 0xff60a56f, 0xd9c5ffff,
+0xc5804df8, 0x708d7ff9, 0xc5ffffff, 0x709574e9,
+0xb8ffffff, 0x0000026b, 0x1779e2c4, 0xca830fd7,
+0xc5000005, 0x80456f79, 0x4d6f79c5, 0x00ffb8a0,
+0xf9c50000, 0xf9c5d06e, 0xc4b06d6f, 0xf9603141,
+0x6039c1c4, 0x3141c4d8, 0xc1c4c968, 0xc5c86839,
+0xc4dbd581, 0xd27979e2, 0xc9d5b1c5, 0xdbdbe9c5,
+0xc9dbe9c5, 0xd967e1c5, 0xc9eff1c5, 0xc964d1c5,
+0xf3dbf1c5, 0xb57ff9c5, 0xffffff70, 0xff70958a,
+0x4d8affff, 0x44d089b0, 0xff71bd8a, 0x8a44ffff,
+0xffff7295, 0xb58a44ff, 0xffffff73, 0x4d8ae0d3,
+0xbd8a40b1, 0xffffff74, 0x75ad8a44, 0x88ffffff,
+0xffff4c85, 0xe7d341ff, 0x8ab24d8a, 0xffff7685,
+0xa58a44ff, 0xffffff79, 0x7a8d8a44, 0x41ffffff,
+0x4d8ae2d3, 0x7b9d8ab3, 0x40ffffff, 0xff7cb58a,
+0x8a44ffff, 0xffff7d9d, 0x79c1c4ff, 0xd341ea6e,
+0xb44d8ae6, 0x2051c3c4, 0xe7d301ee, 0xc5b54d8a,
+0x41ef6e79, 0x4d8ae5d3, 0x1143c4b6, 0xd301ed20,
+0xb74d8ae0, 0xff488588, 0x858affff, 0xffffff77,
+0x4d8ae0d3, 0x448588b8, 0x8affffff, 0xffff7885,
+0x8ae0d3ff, 0x8588b94d, 0xffffff30, 0x8ae4d341,
+0xd341ba4d, 0xbb4d8ae1, 0x6e7941c4, 0x8ae3d3e1,
+0x63c4bc4d, 0x01e32019, 0x4d8ae6d3, 0x6e79c5bd,
+0xe3d341d6, 0x44be4d8a, 0xff7e858a, 0xf9c5ffff,
+0xff308d6e, 0x858affff, 0xffffff7f, 0xb56ef9c5,
+0xffffff4c, 0xa56ef9c5, 0xffffff48, 0x2059e3c4,
+0xffff44a5, 0xd34101ff, 0xbf4d8ae0, 0x2049c3c4,
+0xc3c401f7, 0x01cc2071, 0x6e7941c4, 0x2943c4d8,
+0xc501d320, 0xd3f561c9, 0x6191c5e0, 0x71c1c4ec,
+0x63c4cc61, 0x01d82021, 0xf562c9c5, 0x6129c1c4,
+0x62f1c5e3, 0x6cc9c5cc, 0x7ff9c5e1, 0xffff30a5,
+0xc501b0ff, 0xb06d6ff9, 0xe86e79c5, 0x787942c4,
+0x51c1c4ed, 0xf9c5cdf8, 0x8ab04d7f, 0x858ab04d,
+0xffffff71, 0x728d8a44, 0x44ffffff, 0xff73bd8a,
+0xe2d3ffff, 0x44b14d8a, 0xff74858a, 0x8a44ffff,
+0xffff75b5, 0xbd8a40ff, 0xffffff76, 0xff4c9588,
+0xe0d3ffff, 0x44b24d8a, 0xff77ad8a, 0x8a40ffff,
+0xffff78b5, 0xa58a44ff, 0xffffff79, 0xff488588,
+0xd341ffff, 0xb34d8ae1, 0xff7a958a, 0x9d8affff,
+0xffffff7b, 0xff7c858a, 0xc1c4ffff, 0x41c96e79,
+0x4d8ae7d3, 0x9d8a44b4, 0xffffff7d, 0x7e958a44,
+0xc4ffffff, 0xcf2071c3, 0xe0d34101, 0xc4b54d8a,
+0xe06e7941, 0x8ae6d341, 0x43c4b64d, 0x01e62019,
+0x4d8ae7d3, 0x6ef9c5b7, 0xe5d341f7, 0xc4b84d8a,
+0xf52049c3, 0x8ae6d301, 0x99c5b94d, 0xf9c5f661,
+0xd341e66e, 0xba4d8ae4, 0x2059c3c4, 0xe2d301e4,
+0xc5bb4d8a, 0xd3da6e79, 0xbc4d8ae3, 0x202163c4,
+0xe0d301db, 0xc4bd4d8a, 0xe36159c1, 0xff448588,
+0xd341ffff, 0xbe4d8ae3, 0x8ae2d341, 0x858abf4d,
+0xffffff7f, 0xb56e79c5, 0xffffff4c, 0xad6ef9c5,
+0xffffff44, 0x6e7941c4, 0x0963c4d2, 0xff48b520,
+0xd301ffff, 0x51c3c4e0, 0xc401eb20, 0xd0202963,
+0x6189c501, 0x032cb8c9, 0xc1c40000, 0xc5ea6151,
+0xc5ce62f1, 0xc5e562d9, 0xc5cc6cf1, 0xc5c9fcf1,
+0x308d74f1, 0xc4ffffff, 0xcf1779e2, 0x028b830f,
+0xf9c50000, 0xc590656f, 0x509d7ff9, 0xc5ffffff,
+0xc5cc60d9, 0xc4ec68d9, 0xcfd571c1, 0xd551c1c4,
+0xdbe9c5e9, 0xdbe9c5c9, 0x67f1c5ed, 0x7ff9c5cd,
+0xffff608d, 0x61e2c4ff, 0xff608d3c, 0xe2c4ffff,
+0x609d3861, 0xc5ffffff, 0x609d7ff9, 0xc5ffffff,
+0x608dfcf1, 0xb8ffffff, 0x00000348, 0xd960f1c5,
+0xc968f1c5, 0xd561c1c4, 0x71c1c4df, 0xe9c5c9d5,
+0xe9c5dbdb, 0xe1c5c9db, 0xb9c5c967, 0xf1c5dcfc,
+0xe2c4cb74, 0x0fcf1779, 0x00020083, 0x79e2c400,
+0xff508d1c, 0x39c5ffff, 0x4fb8c174, 0xc4000003,
+0xc7177962, 0x01e3830f, 0xf9c50000, 0xb8a06d6f,
+0x00000354, 0x0811e2c4, 0x74d1c5cd, 0x79e2c4c9,
+0x830fcf17, 0x000001c5, 0x756ff9c5, 0x5941c480,
+0x59b8edf8, 0xc4000003, 0xed004942, 0x745941c4,
+0x7962c4ed, 0x830fef17, 0x000001a1, 0x4d60d9c5,
+0x68d9c580, 0xf1c5805d, 0x51c5cbf8, 0xd1c5c560,
+0x08b0f568, 0xd960f1c5, 0xc968f1c5, 0xc9d5c9c5,
+0xdbd5b9c5, 0xdbdbe9c5, 0xd1dbe9c5, 0xca67e1c5,
+0xd06ef9c5, 0x000370b8, 0x79e2c400, 0xf1c5d278,
+0xe2c4ca74, 0x0fcf1779, 0x00015083, 0x6ff9c500,
+0xffb8804d, 0xc5000000, 0xc5d968f1, 0xc5d160f1,
+0xc4f6d5e1, 0xd0d569c1, 0xd86ef9c5, 0x7979e2c4,
+0xdbe1c5db, 0xdbe1c5d2, 0x67e9c5de, 0xefe1c5d3,
+0x64e1c5db, 0x7ff9c5dd, 0xffff5095, 0x60e9c5ff,
+0x6ff9c5d3, 0xffff50bd, 0x79e2c4ff, 0xe9c5f720,
+0xc1c5d674, 0x7ab8ff76, 0xc4000003, 0xd71779e2,
+0x00e7830f, 0xe1c50000, 0xc9c5d360, 0xf9c5f260,
+0xff509d6f, 0xe2c4ffff, 0xc5db2179, 0xb8f374c9,
+0x00000382, 0x1779e2c4, 0xbe830ff7, 0xc5000000,
+0xc5d260e9, 0xc5d260e1, 0x60957ff9, 0xc5ffffff,
+0x50b56ff9, 0xc4ffffff, 0xde2279e2, 0x9d7ff9c5,
+0xffffff70, 0xd274e1c5, 0x00038bb8, 0x79e2c400,
+0x830fd717, 0x00000085, 0xf9c5c031, 0x01a8d46f,
+0xf9c50475, 0xf9c5d16f, 0x8ac0557f, 0x88c00554,
+0xff600594, 0xff48ffff, 0xf88348c0, 0xc5db7510,
+0xb8d2efe9, 0x000003c4, 0xea64d1c5, 0x4c59e3c4,
+0xd9c550e1, 0xff60a574, 0xe2c4ffff, 0x73e71779,
+0xc40fb03c, 0xd90f71e3, 0x6ef9c501, 0xc401b0d0,
+0xd27879e2, 0xcadbf1c5, 0xd06ef9c5, 0xe2c4c031,
+0xc5d27879, 0xc5cafcf1, 0xc4cb74f1, 0xcf1779e2,
+0x83c0920f, 0xc01901f8, 0x0003e425, 0xc4834800,
+0x5c415b30, 0x5e415d41, 0xc35d5f41,
+0003314,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b24100,
+0x41e58948, 0x4c564157, 0xff7f9d8d, 0x8d4cffff,
+0x55418f4d, 0x9f458d4c, 0xaf7d8d48, 0x48535441,
+0x4420ec83, 0x508dd689, 0x048841ff, 0x41c62903,
+0x89013488, 0x83c221d6, 0xceff01e6, 0x8301fa83,
+0x884100d9, 0x0c880034, 0xc0ff4807, 0x11f88348,
+0xf9c5d175, 0xc5807d6f, 0x50bd7ff9, 0xc5ffffff,
+0x509d6ff9, 0xc5ffffff, 0xb8d276e9, 0x00000260,
+0xcf74e1c5, 0x1779e2c4, 0x47830fca, 0xc5000005,
+0x804dfce1, 0x8d7ff9c5, 0xffffff60, 0x4d6ff9c5,
+0x0266b880, 0xf1c50000, 0xf1c5c9fc, 0xff608d74,
+0xe2c4ffff, 0x0fca1779, 0x00051983, 0x6ff9c500,
+0xffff60bd, 0xf8c1c5ff, 0xf9c5804d, 0xff708d7f,
+0xe1c5ffff, 0xff70a574, 0x6bb8ffff, 0xc4000002,
+0xe21779e2, 0x04ec830f, 0xe1c50000, 0xc5905deb,
+0x509d7ff9, 0xc5ffffff, 0x904ddbf1, 0xbd6ff9c5,
+0xffffff70, 0x5defc1c5, 0xdff1c590, 0xffff508d,
+0x76d9c5ff, 0x0277b8e4, 0xf1c50000, 0xe2c4cb74,
+0x0fca1779, 0x0004ad83, 0xefe1c500, 0x74e1c5db,
+0xf1c5b04d, 0xf1c5cb74, 0xc58075db, 0x70b57ff9,
+0x8affffff, 0xffff7085, 0xb04d8aff, 0x8a44c389,
+0xffff71bd, 0x958a44ff, 0xffffff72, 0x73b58a44,
+0xd3ffffff, 0xb14d8ae3, 0x74bd8a40, 0x44ffffff,
+0xff75ad8a, 0x9d88ffff, 0xffffff4c, 0x8ae7d341,
+0x9d8ab24d, 0xffffff76, 0xff78958a, 0x8a44ffff,
+0xffff79a5, 0xe2d341ff, 0x44b34d8a, 0xff7a8d8a,
+0x8a40ffff, 0xffff7cb5, 0x9d8a44ff, 0xffffff7d,
+0x6e7941c4, 0xe6d341d2, 0xc4b44d8a, 0xd6202943,
+0x8ae7d301, 0xf9c5b54d, 0xd341f76e, 0xb64d8ae5,
+0x2049c3c4, 0xe3d301f5, 0x88b74d8a, 0xffff489d,
+0x779d8aff, 0xd3ffffff, 0xb84d8ae3, 0xff449d88,
+0x9d8affff, 0xffffff7b, 0x4d8ae2d3, 0x409588b9,
+0x41ffffff, 0x4d8ae4d3, 0xe1d341ba, 0xc4bb4d8a,
+0xc16e7941, 0x4d8ae3d3, 0x3963c4bc, 0xd301c320,
+0xbd4d8ae6, 0xee6ef9c5, 0x8ae3d341, 0x8a44be4d,
+0xffff7e85, 0x6ef9c5ff, 0xffff4c9d, 0x7f958aff,
+0xc5ffffff, 0x488d6e79, 0xc5ffffff, 0x408d6ef9,
+0xc4ffffff, 0x8d203163, 0xffffff44, 0xe0d34101,
+0xc4bf4d8a, 0xdf2061c3, 0x71c3c401, 0xc401cc20,
+0xf86e79c1, 0x2051c3c4, 0xc1c401eb, 0xd3da6161,
+0x49c1c4e2, 0xc1c4f161, 0xc4c86171, 0xfa2041e3,
+0x62e1c501, 0x61d1c5de, 0x62f1c5ef, 0x6ce1c5cd,
+0xfcd9c5d9, 0xf9c5b04d, 0x8ab04d7f, 0x8a44b04d,
+0xffff7295, 0xbd8a44ff, 0xffffff73, 0x74b58a40,
+0xd3ffffff, 0xb14d8ae0, 0x75b58a44, 0x88ffffff,
+0xffff4c85, 0x71858aff, 0x44ffffff, 0xff768d8a,
+0x8a44ffff, 0xffff77ad, 0x8ae0d3ff, 0x8a44b24d,
+0xffff79a5, 0x488588ff, 0x8affffff, 0xffff7885,
+0xe2d341ff, 0x44b34d8a, 0xff7a858a, 0x9d8affff,
+0xffffff7b, 0xff7c958a, 0x41c4ffff, 0x41d26e79,
+0x4d8ae7d3, 0x9d8a44b4, 0xffffff7d, 0x7ebd8a40,
+0xc4ffffff, 0xd7202943, 0x8ae6d301, 0x79c5b54d,
+0xd341ce6e, 0xb64d8ae6, 0x203143c4, 0xd34101de,
+0xb74d8ae1, 0x6e7941c4, 0xe5d341c9, 0xc4b84d8a,
+0xcd203143, 0x8ae0d301, 0x41c4b94d, 0x88c96121,
+0xffff4485, 0xe4d341ff, 0x41ba4d8a, 0x4d8ae0d3,
+0x7941c4bb, 0xe3d3c06e, 0xc4bc4d8a, 0xc3203963,
+0x8ae2d301, 0xf9c5bd4d, 0xd341ea6e, 0xbe4d8ae3,
+0x2051c3c4, 0xe7d301eb, 0x8abf4d8a, 0xffff7f85,
+0x6ef9c5ff, 0xffff4c8d, 0x6ef9c5ff, 0xffff44b5,
+0x6ef9c5ff, 0x71e3c4ff, 0xff488d20, 0xd301ffff,
+0x49c3c4e0, 0xc401f420, 0xf82041e3, 0x71c1c401,
+0xc1c4ca61, 0xb8f06149, 0x0000032c, 0xef61d1c5,
+0x6271c1c4, 0x62c9c5c9, 0x6cf1c5ed, 0xfcf1c5cd,
+0x74f1c5c9, 0x79e2c4cb, 0x830fca17, 0x000001c6,
+0x5d6ff9c5, 0xdae1c580, 0xe1c5904d, 0xc5906dde,
+0x905dfce1, 0xcdfcf1c5, 0x00033fb8, 0x74f1c500,
+0x79e2c4cb, 0x830fca17, 0x0000019a, 0xf9c501b0,
+0xc5a06d6f, 0xb8c86ef9, 0x00000354, 0x7879e2c4,
+0x71e2c4c9, 0xf1c5cd08, 0xe2c4cd74, 0x0fca1779,
+0x00017183, 0x6ff9c500, 0xf9c5905d, 0xb8807d6f,
+0x00000359, 0xccfce1c5, 0x0041e2c4, 0x74f1c5c9,
+0x79e2c4cb, 0x830fca17, 0x0000014a, 0x7560e1c5,
+0x68e1c580, 0xd9c5804d, 0x08b0c9fc, 0xcef8f1c5,
+0xcdeff1c5, 0xecefd1c5, 0xe06ef9c5, 0x000370b8,
+0xf8f1c500, 0x79e2c4cd, 0xf1c5e478, 0xe2c4cc74,
+0x0fca1779, 0x00010d83, 0x79e2c400, 0xc4806d30,
+0xe53079e2, 0xad7ff9c5, 0xffffff60, 0xa57ff9c5,
+0xffffff70, 0x756ff9c5, 0x79e2c480, 0xf1c5ce30,
+0x9ab8cd74, 0xc4000003, 0xca1779e2, 0x00d4830f,
+0xf9c50000, 0xc4807d6f, 0xcf3179e2, 0xcc74f1c5,
+0x0003a1b8, 0x79e2c400, 0x830fca17, 0x000000b6,
+0x756ff9c5, 0x79e2c480, 0xf9c5ce32, 0xff508d7f,
+0xe2c4ffff, 0xb8e43079, 0x000003a8, 0xcc74f1c5,
+0x1779e2c4, 0x8b830fca, 0xc5000000, 0x804d6ff9,
+0xf9c5c031, 0x01a8e36f, 0xf9c50475, 0xf9c5e16f,
+0x8ac0657f, 0x88c00554, 0xff600594, 0xff48ffff,
+0xf88348c0, 0xc5db7510, 0xb8e4efd9, 0x000003c4,
+0x6564d9c5, 0x61e3c4a0, 0xc540d94c, 0x609d74e1,
+0xc4ffffff, 0xda1779e2, 0x0fb03c73, 0x0f71e3c4,
+0xf9c501e1, 0x01b0d86e, 0x7879e2c4, 0xdbf1c5db,
+0x6ef9c5cb, 0xc4c031d8, 0xdb7879e2, 0xcbfcf1c5,
+0xcc74f1c5, 0x1779e2c4, 0xc0920fca, 0x1901f883,
+0x03e425c0, 0x83480000, 0x415b20c4, 0x415d415c,
+0x5d5f415e, 0x000000c3,
+0002745,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5741e589, 0x55415641, 0x48535441,
+0x8d20ec83, 0x8944ff70, 0x848966cf, 0xffff7e45,
+0x29f289ff, 0x01e283c7, 0x457c8966, 0x01fa838e,
+0xe283d219, 0x85caff02, 0x940f40c6, 0x548966c6,
+0x0f409e45, 0xf129f6b6, 0x454c8966, 0xc0ff48ae,
+0x09f88348, 0xf9c5bd75, 0xc5807d6f, 0x50bd7ff9,
+0xc5ffffff, 0x50956ff9, 0xc5ffffff, 0xb8c976f1,
+0x00000260, 0xdf75e9c5, 0x1779e2c4, 0xc4830fd9,
+0xc5000005, 0x805dfde9, 0x9d7ff9c5, 0xffffff60,
+0x7d6ff9c5, 0x0266b880, 0xe1c50000, 0xc501f771,
+0x609d75e1, 0xc4ffffff, 0xd91779e2, 0x0595830f,
+0xf9c50000, 0xff60bd6f, 0xc1c5ffff, 0xc5805df9,
+0x709d7ff9, 0xc5ffffff, 0x709d75e9, 0xb8ffffff,
+0x0000026b, 0x1779e2c4, 0x68830fd9, 0xc5000005,
+0x905d6ff9, 0x55d5e9c5, 0xd5e1c580, 0x6ff9c5e3,
+0xe1c5805d, 0xc59075fd, 0x906df9e1, 0xd4f9e9c5,
+0x000282b8, 0xd5d1c500, 0x75e9c5ee, 0x79e2c4d5,
+0x830fd117, 0x0000052f, 0x55d5e1c5, 0x75e9c590,
+0x00053b15, 0x02d3b800, 0xe2c40000, 0x0fd11779,
+0x00051283, 0xe5e1c500, 0xf9c5a065, 0xc5a06d6f,
+0xb8d2efe9, 0x000002da, 0xd565e9c5, 0xd475e9c5,
+0x1779e2c4, 0xec830fd1, 0xc5000004, 0xc5d3d5d1,
+0x70957ff9, 0xc5ffffff, 0x70bd6ff9, 0xc5ffffff,
+0x03f771d9, 0xa57ff9c5, 0xffffff50, 0xb56ff9c5,
+0xffffff70, 0xf671e9c5, 0x7ff9c502, 0xffff6095,
+0xfde9c5ff, 0x02f8b8d2, 0xe9c50000, 0xe2c4d475,
+0x0fd11779, 0x00049e83, 0x6ff9c500, 0xffff50bd,
+0x71e9c5ff, 0xe9c502e7, 0xfdb8d2fd, 0xc5000002,
+0x609575e9, 0xc4ffffff, 0xd11779e2, 0x0475830f,
+0x85c70000, 0xffffff4c, 0x00000003, 0xe5d5e1c5,
+0x4c856348, 0xc4ffffff, 0xd06ef9e1, 0xd2f1d9c5,
+0xff4c85c7, 0x0002ffff, 0x63480000, 0xffff4c85,
+0xf9e1c4ff, 0xd9c5f06e, 0xf9c5e6f1, 0xff60a57f,
+0xd9c5ffff, 0x10b8e4fd, 0xc5000003, 0xc4e275d9,
+0xe11779e2, 0x041d830f, 0x63480000, 0xffff4c85,
+0xf9e1c4ff, 0xe9c5f86e, 0xe9c5d7e1, 0x14b8d2fd,
+0xc5000003, 0x609575e9, 0xc4ffffff, 0xd11779e2,
+0x03f1830f, 0xe1c50000, 0xf9c5f5d5, 0xc5b07d6f,
+0xc5e4efd9, 0xc5d465c1, 0xc5f6dbe9, 0x70b57ff9,
+0x44ffffff, 0xff70958b, 0x4d8bffff, 0xd78945b0,
+0x72b58b66, 0x44ffffff, 0xff748d8b, 0x8b66ffff,
+0xffff76bd, 0xe7d341ff, 0xb24d8b66, 0x78858b44,
+0x45ffffff, 0xfb89ce89, 0x7a958b66, 0xc4ffffff,
+0xd76e79c1, 0x4d8be6d3, 0xc58945b4, 0x7ca58b44,
+0x41ffffff, 0x8b66d389, 0xffff7e85, 0xc469c5ff,
+0xd34101c6, 0x4d8b66e6, 0x79c1c4b6, 0xe3d3d66e,
+0xc5b84d8b, 0x01fbc4e9, 0x66e5d341, 0xc5ba4d8b,
+0xc4c76239, 0xf56e79c1, 0x8be3d341, 0xc1c4bc4d,
+0x01d3c449, 0x66e4d341, 0xc4be4d8b, 0xcc6e7941,
+0xb1c5e0d3, 0xc501f0c4, 0xc5d662e9, 0xb9c26c39,
+0x00000001, 0x7d6ff9c5, 0x6ef9c5b0, 0x79e2c4f1,
+0xc1c5f679, 0xf9c5d6f9, 0x8bb0557f, 0x8b66b04d,
+0xffff7285, 0x7cb58bff, 0x66ffffff, 0xff7e9d8b,
+0xd341ffff, 0x4d8b66e2, 0x79c1c4b2, 0xe0d3fa6e,
+0xc5b44d8b, 0x01d0c4c1, 0x00032cb8, 0xe1d34100,
+0xb64d8b66, 0x6e79c1c4, 0x8be7d3f9, 0x41c5b84d,
+0x4101d7c4, 0x8b66e0d3, 0xc1c4ba4d, 0xc4d26269,
+0xc86e7941, 0x4d8be2d3, 0xc4b1c5bc, 0xe6d301fa,
+0xbe4d8b66, 0xde6e79c5, 0x21c5e3d3, 0xc401cbc4,
+0xf96241c1, 0xd76ce9c5, 0xd2fde9c5, 0x7569c1c4,
+0x79e2c4d0, 0x830fd117, 0x0000027b, 0x55d5d1c5,
+0xd5d1c590, 0x7ff9c5fb, 0xffff6095, 0xeec1c5ff,
+0xffff6095, 0xeac1c5ff, 0xffff60bd, 0x7ff9c5ff,
+0xffff60bd, 0xfde9c5ff, 0xffff6095, 0xfde1c5ff,
+0x48b8907d, 0xc5000003, 0xc5d5d5e9, 0xc4d775e9,
+0xd11779e2, 0x022d830f, 0xd1c50000, 0xf9c5ebd5,
+0xff50ad7f, 0xe2c4ffff, 0x50951d79, 0xc5ffffff,
+0xb8da75e1, 0x0000034f, 0x1779e2c4, 0x04830fd9,
+0xc5000002, 0xa05d6ff9, 0x000354b8, 0x49e2c400,
+0xe1c5f309, 0xe2c4f675, 0x0ff11779, 0x0001e683,
+0x70fbc500, 0xc51b806d, 0x90556ff9, 0x000359b8,
+0x70fac500, 0xf9c51bed, 0xc54eed70, 0xc4ed75e9,
+0xe91779e2, 0x01bd830f, 0xe9c50000, 0xc5806d61,
+0x807569e9, 0xeef9d1c5, 0x000004b8, 0xd5d1c500,
+0x6ef9c5eb, 0x0370b8f0, 0xe2c40000, 0xc5f67979,
+0xc4ee75d1, 0xe91779e2, 0x0189830f, 0xd9c50000,
+0xe1c5e365, 0xc5806dd5, 0x50ad7ff9, 0xc5ffffff,
+0xc5f461d1, 0x50bd6ff9, 0xc4ffffff, 0xef2379e2,
+0xf575c9c5, 0x00037ab8, 0x79e2c400, 0x830ff117,
+0x00000153, 0xe461d9c5, 0xe461d1c5, 0xa57ff9c5,
+0xffffff60, 0xb56ff9c5, 0xffffff50, 0x2479e2c4,
+0x7ff9c5ee, 0xffff70ad, 0x75d1c5ff, 0x0382b8e4,
+0xe2c40000, 0x0fe11779, 0x00011a83, 0x6ff9c500,
+0xc0318065, 0xea6ff9c5, 0x047501a8, 0xec6ff9c5,
+0x6d7ff9c5, 0x548b66c0, 0x8966c045, 0xff604594,
+0xff48ffff, 0xf88348c0, 0xc5d97508, 0xb8edefd1,
+0x000003c4, 0xdd65e1c5, 0x4c69e3c4, 0xf9c530d4,
+0xff60a56f, 0xd9c5ffff, 0xe2c4d275, 0x0fd11779,
+0x0000c283, 0x6ff9c500, 0xd4b8805d, 0xc4000003,
+0x550e61e3, 0xd9c5aa90, 0xe2c4e275, 0x0fe11779,
+0x0000a283, 0x0007b800, 0xe3c40000, 0x02e30f61,
+0xd06ef9c5, 0x000001b8, 0x6ef9c500, 0x79e2c4e8,
+0xe4b8d279, 0xc5000003, 0xc4d2dbe1, 0xed7979e2,
+0xd5fde9c5, 0xd275d9c5, 0x1779e2c4, 0xc56873d1,
+0x509d7ff9, 0xb8ffffff, 0x00000003, 0xdbefe1c5,
+0x0161e2c4, 0xffff5095, 0x7ff9c5ff, 0xffff5095,
+0x75c8ffff, 0xc5f9c5eb, 0xf8b807d2, 0x66000003,
+0x7524fa83, 0x6ff9c532, 0xe2c48075, 0x90550549,
+0xe2c4c031, 0xc4d30169, 0xd30169e2, 0x0169e2c4,
+0x75e9c5d3, 0x79e2c4d3, 0x920fd117, 0x01f883c0,
+0x0125c019, 0x48000004, 0x5b20c483, 0x5d415c41,
+0x5f415e41, 0x0000c35d, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0003200,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5741e589, 0x55415641, 0x48535441,
+0x8d20ec83, 0x8944ff70, 0x848966cf, 0xffff7e45,
+0x29f189ff, 0x01e183c7, 0x457c8966, 0x85c9ff8e,
+0x940f40c6, 0x4c8966c6, 0x0f409e45, 0xf229f6b6,
+0x45548966, 0xc0ff48ae, 0x09f88348, 0xf9c5c575,
+0xc5807d6f, 0x50bd7ff9, 0xc5ffffff, 0x509d6ff9,
+0xc5ffffff, 0xb8c976f1, 0x00000260, 0xd775e1c5,
+0x1779e2c4, 0x64830fd1, 0xc5000005, 0x8055fde1,
+0x957ff9c5, 0xffffff60, 0x7d6ff9c5, 0x0266b880,
+0xe9c50000, 0xc501f771, 0x609575e9, 0xc4ffffff,
+0xd11779e2, 0x0535830f, 0xf9c50000, 0xff60b56f,
+0xc9c5ffff, 0xc58055f9, 0x70957ff9, 0xc5ffffff,
+0x70a575e1, 0xb8ffffff, 0x0000026b, 0x1779e2c4,
+0x08830fe1, 0xc5000005, 0x905debe1, 0x9d7ff9c5,
+0xffffff50, 0x55dbe9c5, 0x6ff9c590, 0xffff70bd,
+0xefc1c5ff, 0xe9c5905d, 0xff5095df, 0xd9c5ffff,
+0x77b8e476, 0xc5000002, 0xc4d375e9, 0xd11779e2,
+0x04c9830f, 0xf9c50000, 0xc5805d6f, 0x9055d5e1,
+0x1575e9c5, 0x000004c8, 0x0002d3b8, 0x79e2c400,
+0x830fd117, 0x000004a7, 0x75e4e1c5, 0x6ff9c5a0,
+0xdcb8a06d, 0xc5000002, 0xc5d5dbe1, 0xc5d5fde9,
+0xc4d675e9, 0xd11779e2, 0x0481830f, 0xf9c50000,
+0xff709d7f, 0xf9c5ffff, 0xff70b56f, 0xd1c5ffff,
+0xc503f671, 0x50ad7ff9, 0xc5ffffff, 0x70bd6ff9,
+0xc5ffffff, 0x02f771e9, 0x957ff9c5, 0xffffff60,
+0xd2fde9c5, 0x0002f8b8, 0x75e9c500, 0x79e2c4d5,
+0x830fd117, 0x00000437, 0xb56ff9c5, 0xffffff50,
+0xd671e9c5, 0xfde9c502, 0x02fdb8d2, 0xe9c50000,
+0xff609575, 0xe2c4ffff, 0x0fd11779, 0x00040e83,
+0x4c85c700, 0x03ffffff, 0xc5000000, 0x4c956ef9,
+0xc5ffffff, 0xc7d2f1e1, 0xffff4c85, 0x000002ff,
+0x6ef9c500, 0xffff4cad, 0xf1e1c5ff, 0x7ff9c5ed,
+0xffff60ad, 0xfdd1c5ff, 0x0310b8ed, 0xd1c50000,
+0xe2c4ea75, 0x0fe91779, 0x0003c283, 0x6ef9c500,
+0xffff4cad, 0xd1e9c5ff, 0xfde9c5d5, 0x0314b8d2,
+0xe9c50000, 0xff609575, 0xe2c4ffff, 0x0fd11779,
+0x00039a83, 0xefd1c500, 0x75d1c5ed, 0xe9c5b055,
+0xe9c5d575, 0xf9c5fbdb, 0xff70bd7f, 0x8b44ffff,
+0xffff7095, 0xb04d8bff, 0x66d78945, 0xff72b58b,
+0x8b44ffff, 0xffff748d, 0xbd8b66ff, 0xffffff76,
+0x66e7d341, 0x44b24d8b, 0xff78858b, 0x8945ffff,
+0x66fb89ce, 0xff7a958b, 0xc1c4ffff, 0xd3d76e79,
+0xb44d8be6, 0x44c58945, 0xff7ca58b, 0x8941ffff,
+0x858b66d3, 0xffffff7e, 0xf6c4e9c5, 0xe6d34101,
+0xb64d8b66, 0x6e79c1c4, 0x8be3d3d6, 0xe9c5b84d,
+0x4101fbc4, 0x8b66e5d3, 0xc9c5ba4d, 0xc1c4f762,
+0x41ed6e79, 0x4d8be3d3, 0x51c1c4bc, 0x4101d3c4,
+0x8b66e4d3, 0x41c4be4d, 0xd3c46e79, 0xc4b9c5e0,
+0xe9c501e8, 0xc9c5d562, 0xd9c5f26c, 0xc5b055fd,
+0xb0557ff9, 0x66b04d8b, 0xff72858b, 0xb58bffff,
+0xffffff7c, 0x7e9d8b66, 0x41ffffff, 0x8b66e2d3,
+0xc1c4b24d, 0xd3ea6e79, 0xb44d8be0, 0xd0c4d1c5,
+0x032cb801, 0xd3410000, 0x4d8b66e1, 0x79c1c4b6,
+0xe7d3e96e, 0xc5b84d8b, 0x01c7c451, 0x66e0d341,
+0xc4ba4d8b, 0xd06269c1, 0x6e79c1c4, 0x8be2d3f8,
+0xc1c5bc4d, 0xd301eac4, 0x4d8b66e6, 0x6e79c5be,
+0xc5e3d3ce, 0x01fbc4b1, 0xef62d1c5, 0xd56ce9c5,
+0xd2fde9c5, 0xd675e9c5, 0x1779e2c4, 0x3c830fd1,
+0xc4000002, 0x553a61e2, 0x61e2c490, 0xc5906d3e,
+0x905dfde1, 0xd5fde9c5, 0x00033fb8, 0x75e9c500,
+0x79e2c4d3, 0x830fd117, 0x00000213, 0x000001b8,
+0x6ff9c500, 0xf9c5a06d, 0x54b8d06e, 0xc4000003,
+0xd27979e2, 0x0969e2c4, 0x75e9c5d5, 0x79e2c4d5,
+0x830fd117, 0x000001e7, 0x5570fbc5, 0xf9c51b80,
+0xb8905d6f, 0x00000359, 0xd270fac5, 0x70f9c51b,
+0xe1c54ed2, 0xe2c4d275, 0x0fd11779, 0x0001be83,
+0x61e1c500, 0xe1c58075, 0xc5805569, 0xb8d2fdd9,
+0x00000004, 0xd6f9e9c5, 0xd5efe9c5, 0xecefd1c5,
+0xe06ef9c5, 0x000370b8, 0xf9e9c500, 0x79e2c4d5,
+0xe9c5e479, 0xe2c4d475, 0x0fd11779, 0x00017e83,
+0x79e2c400, 0xc4806533, 0xd43379e2, 0xa57ff9c5,
+0xffffff60, 0x957ff9c5, 0xffffff70, 0x756ff9c5,
+0x79e2c480, 0xe9c5d633, 0x9ab8d475, 0xc4000003,
+0xd11779e2, 0x0145830f, 0xf9c50000, 0xc4807d6f,
+0xd73479e2, 0x957ff9c5, 0xffffff50, 0x9575e9c5,
+0xffffff70, 0x0003a1b8, 0x79e2c400, 0x830fd117,
+0x0000011b, 0x656ff9c5, 0xc5c03180, 0xa8d36ff9,
+0xc5047501, 0xc5d46ff9, 0xc0557ff9, 0x45548b66,
+0x948966c0, 0xffff6045, 0xc0ff48ff, 0x08f88348,
+0xe9c5d975, 0xc4b8d2ef, 0xc5000003, 0xa05564e9,
+0x4c61e3c4, 0xf9c520dc, 0xff60956f, 0xe9c5ffff,
+0xe2c4db75, 0x0fd91779, 0x0000c283, 0x6ff9c500,
+0xd4b8805d, 0xc4000003, 0x650e61e3, 0xe9c5aa90,
+0xe2c4d475, 0x0fd11779, 0x0000a283, 0x0007b800,
+0xe3c40000, 0x02e30f61, 0xd06ef9c5, 0x000001b8,
+0x6ef9c500, 0x79e2c4e8, 0xe4b8d279, 0xc5000003,
+0xc4d2dbe1, 0xed7979e2, 0xd5fde9c5, 0xd275d9c5,
+0x1779e2c4, 0xc56873d1, 0x509d7ff9, 0xb8ffffff,
+0x00000003, 0xdbefe1c5, 0x0161e2c4, 0xffff5095,
+0x7ff9c5ff, 0xffff5095, 0x75c8ffff, 0xc5f9c5eb,
+0xf8b807d2, 0x66000003, 0x7524fa83, 0x6ff9c532,
+0xe2c48075, 0x90550549, 0xe2c4c031, 0xc4d30169,
+0xd30169e2, 0x0169e2c4, 0x75e9c5d3, 0x79e2c4d3,
+0x920fd117, 0x01f883c0, 0x0125c019, 0x48000004,
+0x5b20c483, 0x5d415c41, 0x5f415e41, 0x0000c35d,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0003020,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d08ec, 0xc88945ff,
+0xbc854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83cc, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40dc, 0x89f929ff, 0x48ec854c,
+0x8348c0ff, 0xc27505f8, 0x7d6ff9c5, 0x7ff9c5c0,
+0xf9c5907d, 0xc590556f, 0xb8c976f1, 0x00000260,
+0xdf76e9c5, 0x1779e2c4, 0x37830fd9, 0xc5000004,
+0xc05dfee9, 0x5d7ff9c5, 0x6ff9c5a0, 0x66b8c07d,
+0xc5000002, 0x01f772e1, 0x5d76e1c5, 0x79e2c4a0,
+0x830fd917, 0x0000040e, 0x6d6ff9c5, 0xfad1c5a0,
+0xf9c5c05d, 0xc5b05d7f, 0xb05d76e9, 0x00026bb8,
+0x79e2c400, 0x830fd917, 0x000003ea, 0x5d6ff9c5,
+0x69e2c4d0, 0xc4c05540, 0xe34061e2, 0x5d6ff9c5,
+0xfee1c5c0, 0xe1c5d075, 0xc5d06dfa, 0xb8d4fae9,
+0x00000282, 0x4051e2c4, 0x76e9c5ee, 0x79e2c4d5,
+0x830fd117, 0x000003ae, 0x4061e2c4, 0xe9c5d055,
+0x03aa1576, 0xd3b80000, 0xc4000002, 0xd11779e2,
+0x0390830f, 0xe1c50000, 0xc5e055ef, 0xc5d07ef9,
+0x90557ff9, 0x2869e2c4, 0x6348d055, 0x9848d055,
+0xc2af0f48, 0xd8556348, 0xb0458948, 0x98456348,
+0xc2af0f48, 0xb8458948, 0x0002ecb8, 0x76e9c500,
+0xe2c4b055, 0x0fd11779, 0x00034983, 0x61e2c400,
+0xc5e06540, 0xb0657ff9, 0x7d6ff9c5, 0x72d1c5b0,
+0xf9c503f7, 0xc5906d7f, 0xb07d6ff9, 0xf772e9c5,
+0x7ff9c502, 0xe9c5a055, 0xf8b8d2fe, 0xc5000002,
+0xc4d576e9, 0xd11779e2, 0x0308830f, 0xf9c50000,
+0xc5906d6f, 0x02e572e9, 0xd2fee9c5, 0x0002fdb8,
+0x76e9c500, 0xe2c4a055, 0x0fd11779, 0x0002e583,
+0x8c45c700, 0x00000003, 0x8c456348, 0x6ef9e1c4,
+0xf2d9c5d0, 0x8c45c7d2, 0x00000002, 0x8c456348,
+0x6ef9e1c4, 0xf2d9c5e8, 0x7ff9c5e5, 0xd9c5a065,
+0x10b8e4fe, 0xc5000003, 0xc4e276d9, 0xe11779e2,
+0x02a0830f, 0x63480000, 0xe1c48c45, 0xc5f86ef9,
+0xc5d7e2e9, 0xb8d2fee9, 0x00000314, 0x5576e9c5,
+0x79e2c4a0, 0x830fd117, 0x0000027a, 0x7d6ff9c5,
+0xefd1c5f0, 0x61e2c4ed, 0xc5e06540, 0xc5d566c1,
+0xc5d4dbe9, 0xb0557ff9, 0x4769e2c4, 0x01b8f07d,
+0xc5000000, 0xc5f06ef9, 0x00e670f9, 0x756ff9c5,
+0xfac9c5f0, 0x7ff9c5f4, 0xe2c4f075, 0xf0554769,
+0x00032cb8, 0xfee9c500, 0x76c9c5f2, 0x79e2c4f7,
+0x830ff117, 0x0000021e, 0x4669e2c4, 0x31b8f055,
+0xc5000003, 0xb05576e9, 0x1779e2c4, 0x03830fd1,
+0xc5000002, 0xe0756ff9, 0x4049e2c4, 0xf9c5d055,
+0xc4a0557f, 0xfb4049e2, 0x3d41e2c4, 0xe2c4a055,
+0xa07d3941, 0x7d7ff9c5, 0xfee9c5a0, 0xe1c5a055,
+0xb8d07dfe, 0x00000348, 0x4069e2c4, 0x76e9c5d6,
+0x79e2c4d7, 0x830fd117, 0x000001ba, 0x4049e2c4,
+0x7ff9c5f3, 0xe2c49075, 0x90551e79, 0xda76e1c5,
+0x00034fb8, 0x79e2c400, 0x830fd917, 0x00000196,
+0x5d6ff9c5, 0x0354b8e0, 0xe2c40000, 0xc5e30a59,
+0xc4e476e1, 0xe11779e2, 0x0178830f, 0xf9c50000,
+0xc5d0556f, 0xc06570f9, 0x0359b81b, 0xe9c50000,
+0xe2c4e476, 0x0fe11779, 0x00015983, 0x62e9c500,
+0xe9c5c065, 0xc5c0756a, 0xb8e6fad9, 0x00000002,
+0x4059e2c4, 0x6ef9c5e3, 0x0370b8f8, 0xf9c50000,
+0xc500f770, 0xc4e676d9, 0xe11779e2, 0x0124830f,
+0xd1c50000, 0xe2c4f366, 0xc0654061, 0x657ff9c5,
+0x62d9c590, 0x6ff9c5f6, 0xe2c4907d, 0xc5e72579,
+0xb8e676d9, 0x0000037a, 0x1779e2c4, 0xf3830fe1,
+0xc5000000, 0xc5dd66e1, 0xc0656ff9, 0x1679e3c4,
+0xc401a455, 0x551679e3, 0xc4b803ac, 0xc5000003,
+0xa0657ef9, 0x1679e3c4, 0xc402a865, 0xd44c69e3,
+0x6ff9c530, 0xd9c5a065, 0xe2c4d276, 0x0fd11779,
+0x0000b183, 0x6ff9c500, 0xd4b8c05d, 0xc4000003,
+0x550e61e3, 0xd9c5ccd0, 0xe2c4e276, 0x0fe11779,
+0x00009183, 0x0003b800, 0xe3c40000, 0x04e30f61,
+0xe86ef9c5, 0x000001b8, 0x70f9c500, 0xf9c500d5,
+0xe4b8e86e, 0xc5000003, 0xc5d2dbe1, 0x00ed70f9,
+0xd5fee9c5, 0xd276d9c5, 0x1779e2c4, 0xc55773d1,
+0x905d7ff9, 0xdbefe1c5, 0x0261e2c4, 0xf9c59055,
+0xc490557f, 0x550261e2, 0x03f8b890, 0xe3c40000,
+0x03d21679, 0x750afa83, 0x6ff9c52d, 0xe2c4c06d,
+0xd0550651, 0xe2c4c031, 0xc4d30269, 0xd30269e2,
+0xd376e9c5, 0x1779e2c4, 0xc0920fd1, 0x1901f883,
+0x040125c0, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002320,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0xc5cc7504, 0xc07d6ff9,
+0x7d7ff9c5, 0x6ff9c590, 0xf1c5905d, 0x60b8c976,
+0xc5000002, 0xc4d776e1, 0xd11779e2, 0x03bf830f,
+0xe1c50000, 0xc5c055fe, 0xa0557ff9, 0x7d6ff9c5,
+0x0266b8c0, 0xe9c50000, 0xc501f772, 0xa05576e9,
+0x1779e2c4, 0x96830fd1, 0xc5000003, 0xa0756ff9,
+0x55fac9c5, 0x7ff9c5c0, 0xe1c5b055, 0xb8b06576,
+0x0000026b, 0x1779e2c4, 0x72830fe1, 0xc5000003,
+0xd05debe1, 0x5d7ff9c5, 0xdbe9c590, 0xf9c5d055,
+0xc5b07d6f, 0xd05defc1, 0x55dfe9c5, 0x76d9c590,
+0x0277b8e4, 0xe9c50000, 0xe2c4d376, 0x0fd11779,
+0x00033c83, 0x6ff9c500, 0xe2c4c05d, 0xd0554061,
+0x1576e9c5, 0x00000338, 0x0002d3b8, 0x79e2c400,
+0x830fd117, 0x00000319, 0x55efe1c5, 0x7ef9c5e0,
+0x7ff9c5d0, 0xe9c59055, 0x8bd055f4, 0x0f48d055,
+0x558bc2af, 0x458948d8, 0x98458bb0, 0xc2af0f48,
+0xb8458948, 0x0002ecb8, 0x76e9c500, 0xe2c4b055,
+0x0fd11779, 0x0002d883, 0x7ff9c500, 0xf9c5b05d,
+0xc5b0756f, 0x03f672d1, 0x6d7ff9c5, 0x6ff9c590,
+0xe9c5b07d, 0xc502f772, 0xa0557ff9, 0xd2fee9c5,
+0x0002f8b8, 0x76e9c500, 0x79e2c4d5, 0x830fd117,
+0x0000029d, 0x756ff9c5, 0x72e9c590, 0xe9c502d6,
+0xfdb8d2fe, 0xc5000002, 0xa05576e9, 0x1779e2c4,
+0x7a830fd1, 0xc7000002, 0x00038c45, 0xf9c50000,
+0xc58c556e, 0xc7d2f2e1, 0x00028c45, 0xf9c50000,
+0xc58c6d6e, 0xc5edf2e1, 0xa06d7ff9, 0xedfed1c5,
+0x000310b8, 0x76d1c500, 0x79e2c4ea, 0x830fe917,
+0x0000023d, 0x6d6ef9c5, 0xd2e9c58c, 0xfee9c5d5,
+0x0314b8d2, 0xe9c50000, 0xc4a05576, 0xd11779e2,
+0x021b830f, 0xd1c50000, 0xd1c5edef, 0xc5f05576,
+0xc5d576e9, 0xc4d3dbe9, 0x7d4769e2, 0xfed9c5f0,
+0xf9c5f06d, 0xc4f06d7f, 0x6d4769e2, 0x032cb8f0,
+0xd1c50000, 0xc9c5f5fe, 0xe2c4f776, 0x0ff11779,
+0x0001dc83, 0x51e2c400, 0xb8f06d45, 0x00000331,
+0xd576e9c5, 0x1779e2c4, 0xc2830fd1, 0xc4000001,
+0x553b61e2, 0x61e2c4d0, 0xc5d06d3f, 0xd05dfee1,
+0xd5fee9c5, 0x00033fb8, 0x76e9c500, 0x79e2c4d3,
+0x830fd117, 0x00000199, 0x000001b8, 0x6ff9c500,
+0xf9c5e06d, 0x54b8f86e, 0xc5000003, 0x00f770f9,
+0x0a49e2c4, 0x76e9c5d5, 0x79e2c4d5, 0x830fd117,
+0x0000016d, 0x5d6ff9c5, 0x70f9c5d0, 0xb81bc055,
+0x00000359, 0xd276e1c5, 0x1779e2c4, 0x4e830fd1,
+0xc5000001, 0xc07d62e1, 0x556ae1c5, 0xfed9c5c0,
+0x0002b8d2, 0xe9c50000, 0xf9c5d7fa, 0x70b8f86e,
+0xc5000003, 0xc5d5efe9, 0xc5ecefd1, 0x00e770f9,
+0xd5fae9c5, 0xd476e9c5, 0x1779e2c4, 0x0e830fd1,
+0xc4000001, 0x653579e2, 0x6ff9c5c0, 0xe2c4c07d,
+0xc5d73579, 0xb8d476e9, 0x0000039a, 0x1779e2c4,
+0xea830fd1, 0xc5000000, 0xc5e4efd9, 0xc0556ff9,
+0x1679e3c4, 0xc401a45d, 0x5d1679e3, 0xd9c503ac,
+0xb8e06564, 0x000003c4, 0x557ef9c5, 0x79e3c4a0,
+0x02a85516, 0x4c61e3c4, 0xf9c540da, 0xc5a0556f,
+0xc4db76e9, 0xd91779e2, 0x00a3830f, 0xf9c50000,
+0xb8c05d6f, 0x000003d4, 0x0e61e3c4, 0xc5ccd065,
+0xc4d476e9, 0xd11779e2, 0x0083830f, 0x03b80000,
+0xc4000000, 0xe30f61e3, 0x6ef9c504, 0x03e4b8f8,
+0xf9c50000, 0xc500d770, 0xc5d2dbe1, 0xc5d6fee9,
+0xc4d276d9, 0xd11779e2, 0xf9c55773, 0xc5905d7f,
+0xc4dbefe1, 0x550261e2, 0x7ff9c590, 0xe2c49055,
+0x90550261, 0x0003f8b8, 0x79e3c400, 0x8303d216,
+0x2d750afa, 0x756ff9c5, 0x49e2c4c0, 0x31d05506,
+0x69e2c4c0, 0xe2c4d302, 0xc5d30269, 0xc4d376e9,
+0xd11779e2, 0x83c0920f, 0xc01901f8, 0x00040125,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002120,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d04d6f, 0xa04d7ff9,
+0x5d6ff9c5, 0x0260b8a0, 0xe2c40000, 0xc5d12961,
+0xc4c976f1, 0xd11779e2, 0x03e6830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x0266b8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x000003bc, 0x7d6ff9c5, 0xfbc1c5b0,
+0xf9c5d055, 0xc4c0557f, 0x552961e2, 0x026bb8c0,
+0xe2c40000, 0x0fd11779, 0x00039783, 0x6ff9c500,
+0xe9c5d075, 0xc520d373, 0x20d673d1, 0xd6f4e9c5,
+0xebf4d1c5, 0xe6f4e1c5, 0x5d6ff9c5, 0xf4e1c5e0,
+0xd4e9c5f3, 0x73e9c5d5, 0xd9c520f2, 0xe9c5e2d4,
+0xc520d373, 0xc5d3f4e9, 0xc5d2d4e9, 0x20f273e9,
+0xf2d4c9c5, 0x556ff9c5, 0xd469c5d0, 0xfb69c5cb,
+0xc1c4e045, 0x20d17341, 0x000282b8, 0x61c1c400,
+0xc420d073, 0xf8f441c1, 0xf461c1c4, 0x39c1c4d9,
+0xe1c5e9f4, 0xe1c5dfd4, 0xc520f373, 0xc5ebd4d1,
+0xc4defbd9, 0xdd2961e2, 0x1779e2c4, 0x01830fd9,
+0xc5000003, 0xe05d6ff9, 0xd273c1c5, 0x73d1c520,
+0xe9c520d3, 0xd1c5e3f4, 0xc1c5eaf4, 0xe1c5dbf4,
+0xe1c5ddd4, 0xc520f373, 0xb8dbd4d9, 0x00000002,
+0x6ef9e1c4, 0x02d3b8e0, 0xd9c50000, 0xe2c4e46c,
+0xc4dc2961, 0xd91779e2, 0x02b6830f, 0x01b80000,
+0xc4000000, 0xc86ef961, 0xffc88348, 0x22b1e3c4,
+0xd1c501e0, 0xc520d473, 0xc5c4f469, 0xc5dcf4c1,
+0xc5d2f4d1, 0xc5dad4e1, 0x20f373e1, 0xdbd4b9c5,
+0x5d7ff9c5, 0x6ff9c5c0, 0xc9c5c075, 0xc503f673,
+0xa0757ff9, 0x5d6ff9c5, 0x73e1c5c0, 0xf9c502f3,
+0xc5b05d7f, 0xc5dbd4e1, 0xb8fcf4c1, 0x000002f8,
+0x2961e2c4, 0x79e2c4de, 0x830fd917, 0x00000244,
+0x756ff9c5, 0x73e1c5a0, 0xc9c502d6, 0xc402e672,
+0xde0e61e3, 0xd4e1c5cc, 0x02fdb8db, 0xe2c40000,
+0xb05d2961, 0x1779e2c4, 0x15830fd9, 0xc5000002,
+0xc7f2d4c1, 0x00039c45, 0xc9c50000, 0xc520f673,
+0x48f6d4b9, 0xc49c4563, 0xd86ef9e1, 0xdbf3c9c5,
+0x029c45c7, 0x48000000, 0xc49c4563, 0xd86ef961,
+0xf349c1c4, 0x7ff9c5f3, 0xc9c5b075, 0x10b8f6d4,
+0xc4000003, 0xf32949e2, 0x1779e2c4, 0xc1830ff1,
+0x48000001, 0xc59c5563, 0xb8f6efc9, 0x00000040,
+0x374962c4, 0xd02948d3, 0x6ef961c4, 0xf961c4e2,
+0xc1c4e86e, 0xc4dcd361, 0xd5f32941, 0xeb61c1c4,
+0xd4e1c5da, 0x0314b8db, 0xe2c40000, 0xb05d2961,
+0x1779e2c4, 0x79830fd9, 0xc5000001, 0xc5d7d4e9,
+0xf07d6ff9, 0xf273e9c5, 0xd439c520, 0x41e2c4c2,
+0xc1c4d637, 0xc5d0db69, 0xc0557ff9, 0x47e9e2c4,
+0xf9c5f075, 0xc4f07d6f, 0xc96c3141, 0xfb41c1c4,
+0x7ff9c5d9, 0xe2c4f05d, 0xf05547e9, 0x00032cb8,
+0x7ff9c500, 0xe9c5b055, 0xe2c4d2d4, 0xc4d62969,
+0xd11779e2, 0x011a830f, 0x01b80000, 0xc5000000,
+0xb07d6ff9, 0x45c1e2c4, 0xc148f055, 0xe1c43fe0,
+0xb8d86ef9, 0x00000331, 0xdb6ce1c5, 0x45e1e2c4,
+0xe9c5f05d, 0xe9c5d3ef, 0xe2c4d3fb, 0xc0552969,
+0x1779e2c4, 0xd9830fd1, 0xc5000000, 0xe0556ff9,
+0x5d70f9c5, 0x59b84ed0, 0xc4000003, 0xdb2969e2,
+0x1779e2c4, 0xb9830fd9, 0xc5000000, 0xd07d6ce9,
+0x5d6de9c5, 0xfbc1c5d0, 0x0370b8fb, 0xe1c50000,
+0xc520d773, 0xc5eff4d1, 0xc5dcf4e1, 0xc5f4f4c1,
+0xc5ddd4e1, 0x20f373e1, 0xebd4c9c5, 0x2951c2c4,
+0x79e2c4e9, 0x7c73e917, 0xf6efc9c5, 0x6d6ff9c5,
+0x03c4b8d0, 0xe3c40000, 0xb85516f9, 0x59e2c401,
+0xf9c5e637, 0xc4b06dd6, 0xd54c69e3, 0x6ff9c540,
+0xe2c4b065, 0xc4d22959, 0xd11779e2, 0xf9c54673,
+0xb8d0556f, 0x000003d4, 0x0e69e3c4, 0xc4f0e06d,
+0xe52959e2, 0x1779e2c4, 0xc42973e1, 0xe20f69e3,
+0x69c1c408, 0xc031d1db, 0xd469c1c4, 0x69e2c4d1,
+0xe2c4d429, 0x0fd11779, 0xf883c092, 0x25c01901,
+0x000003e4, 0x0000c35d,
+0002106,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d07d6f, 0xa07d7ff9,
+0x5d6ff9c5, 0x76f1c5a0, 0x0260b8c9, 0xe2c40000,
+0xc4d72961, 0xd11779e2, 0x02dc830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x0266b8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x000002b2, 0x756ff9c5, 0xfbc9c5b0,
+0xf9c5d055, 0xc4c0557f, 0x652961e2, 0x026bb8c0,
+0xe2c40000, 0x0fe11779, 0x00028d83, 0xebe1c500,
+0xf9c5e05d, 0xc5a05d7f, 0xe055dbe9, 0x7d6ff9c5,
+0xefc1c5c0, 0xe9c5e05d, 0xe9c5d1ef, 0xb8a055db,
+0x00000277, 0x2969e2c4, 0x79e2c4d3, 0x830fd117,
+0x00000256, 0x556ff9c5, 0x6ff9c5d0, 0xe1c5e075,
+0xc520d273, 0x20d673d1, 0xdef4e1c5, 0xeaf4d1c5,
+0xe6f4e9c5, 0xddd4e1c5, 0xf373e1c5, 0xd4d9c520,
+0x0002b8db, 0xe1c40000, 0xb8e06ef9, 0x000002d3,
+0xe46cd9c5, 0x2961e2c4, 0x79e2c4dc, 0x830fd917,
+0x00000206, 0x557ff9c5, 0x6ff9c5c0, 0xd9c5c075,
+0xc503f673, 0xa0657ff9, 0x7d6ff9c5, 0x73e1c5c0,
+0xf9c502f7, 0xc5b05d7f, 0xb8dbd4e1, 0x000002f8,
+0x2961e2c4, 0x79e2c4dc, 0x830fd917, 0x000001ca,
+0x756ff9c5, 0x73e1c5a0, 0xe1c502d6, 0xfdb8dbd4,
+0xc4000002, 0x5d2961e2, 0x79e2c4b0, 0x830fd917,
+0x000001a6, 0x039c45c7, 0xc5000000, 0x9c5d6ef9,
+0xdbf3e9c5, 0x029c45c7, 0xc5000000, 0x9c656ef9,
+0xd4f3e9c5, 0x557ff9c5, 0xd4e9c5b0, 0x0310b8d2,
+0xe2c40000, 0xc4d32969, 0xd11779e2, 0x0168830f,
+0xf9c50000, 0xc59c556e, 0xc5d2d3e1, 0xb8d2d4e9,
+0x00000314, 0x2969e2c4, 0xe2c4b055, 0x0fd11779,
+0x00014583, 0xefe1c500, 0x61e2c4db, 0xc4f05529,
+0xd32969e2, 0x55dbe9c5, 0x7ff9c5d0, 0xe2c4c055,
+0xf05d47e9, 0x65d4f1c5, 0x7ff9c5f0, 0xe2c4f065,
+0xf05547e9, 0x00032cb8, 0x7ff9c500, 0xe9c5b055,
+0xe2c4d2d4, 0xc4d32969, 0xd11779e2, 0x00f8830f,
+0xf9c50000, 0xc4b07d6f, 0x5545c1e2, 0x0331b8f0,
+0xe2c40000, 0xc0552969, 0x1779e2c4, 0xd7830fd1,
+0xc5000000, 0xe05d6ff9, 0x5570f9c5, 0x59b84ed0,
+0xc4000003, 0xd22961e2, 0x1779e2c4, 0xb7830fd1,
+0x48000000, 0xc4ffc883, 0xe86ef9e1, 0x656ce1c5,
+0x6de1c5d0, 0xf1c5d055, 0x01b8d2d4, 0xc5000000,
+0xc5d4fbe9, 0xc5e1efd1, 0xc5d5efe9, 0xc4d4fbe9,
+0xe06ef9e1, 0x000370b8, 0x6cd9c500, 0x69e2c4e4,
+0xe2c4d429, 0x73d11779, 0x6ff9c571, 0xe3c4d055,
+0xb85d16f9, 0x03c4b801, 0xe3c40000, 0x50da4c61,
+0x55d6f9c5, 0x6ff9c5b0, 0xe2c4b06d, 0xc4db2951,
+0xd91779e2, 0xf9c54473, 0xb8d0556f, 0x000003d4,
+0x0e69e3c4, 0xc4f0e05d, 0xeb2951e2, 0x1779e2c4,
+0xc42773e9, 0xda0f69e3, 0xdbe9c508, 0xc5c031d4,
+0xc4d4d4e9, 0xd32969e2, 0x1779e2c4, 0xc0920fd1,
+0x1901f883, 0x03e425c0, 0xc35d0000,
+0001474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x60b8c976, 0xc5000002, 0x00dfc2e8, 0x0e79e2c4,
+0x17830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x66b8d05d, 0xc5000002, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x000003ee,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x026bb800, 0xe2c40000, 0x0fd90e79,
+0x0003c983, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x82b8d45c, 0xc5000002, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x8f830fd1, 0xc5000003,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x0000028b, 0x0e79e2c4, 0x6b830fd1,
+0xc4000003, 0x1d1879e2, 0x00000364, 0x6528f8c5,
+0x028eb8f0, 0xd8c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x0000033a, 0x5553f8c5, 0x29f8c5d0, 0xf8c5a055,
+0xc5a05553, 0xd05d28f8, 0x000296b8, 0x5bf9c500,
+0x5bf8c5d2, 0xc2e8c5d2, 0xe2c400d3, 0x0fd10e79,
+0x00030983, 0x59e0c500, 0x29f8c5d3, 0xf8c5a055,
+0xc5a05552, 0xb05529f8, 0x5528f8c5, 0x029db8b0,
+0xf8c50000, 0xf9c5ea53, 0xf8c5ed5b, 0xe0c5ed5b,
+0xc400ddc2, 0xd90e79e2, 0x02d0830f, 0xf9c50000,
+0xf8c5da5b, 0xc5d05528, 0xb8db5bf8, 0x0000029f,
+0xea53f8c5, 0xed5bf9c5, 0xed5bf8c5, 0xddc2e0c5,
+0x79e2c400, 0x830fd90e, 0x000002a2, 0xda59e8c5,
+0x5d29f8c5, 0x51f8c5a0, 0xa7b8a05d, 0xc5000002,
+0x00dac2e0, 0x0e79e2c4, 0x7f830fd9, 0xc4000002,
+0x2d1879e2, 0x00000298, 0xda5ed0c5, 0x5d29f8c5,
+0x79e3c4a0, 0x0ba05d08, 0x0002afb8, 0xc2e0c500,
+0x00027a1d, 0xe2c40000, 0x0fd90e79, 0x00024d83,
+0x59d8c500, 0xd8c5e05d, 0xf8c5f259, 0xc5b05d29,
+0xb05d5fc8, 0x755dc8c5, 0x29f8c5b0, 0xe0c5b075,
+0xc5b05d58, 0xe05558e8, 0x000348b8, 0x59e0c500,
+0xc2e0c5dc, 0xe2c400d2, 0x0fd10e79, 0x00020d83,
+0x79e3c400, 0x1bd05504, 0x000359b8, 0xc2e8c500,
+0xc400e055, 0xd10e79e2, 0x01f0830f, 0x01b80000,
+0xc5000000, 0xe05528f8, 0x7528f8c5, 0x6ef9c5d0,
+0x035eb8f8, 0xf9c50000, 0xc500ff70, 0xc5da5bf9,
+0xc4dffae1, 0xdb0c49e2, 0xdbc2e8c5, 0x79e2c400,
+0x830fd90e, 0x000001b6, 0xf658e8c5, 0x000362b8,
+0xc2c8c500, 0x0001e635, 0xe2c40000, 0x0ff10e79,
+0x00019983, 0x14e8c500, 0xe8c5d05d, 0xc5d07515,
+0xb8de5ce0, 0x00000370, 0x1879e2c4, 0x00018335,
+0x59e0c500, 0xc2e0c5dc, 0xe2c400de, 0x0fd90e79,
+0x00016983, 0x12fac500, 0xe2c4d05d, 0x65351879,
+0xc5000001, 0xd05d5ce0, 0x0003b1b8, 0x79e2c400,
+0x01563d18, 0xc8c50000, 0xc8c5f458, 0xe0c5f759,
+0xc400dec2, 0xd90e79e2, 0x0130830f, 0xfac50000,
+0xc5d05d16, 0xc5ed58d8, 0xd07528f8, 0x0003b8b8,
+0x5ce0c500, 0x59d0c5de, 0xc2e0c5ef, 0xe2c400dd,
+0x0fd90e79, 0x00010583, 0x57e0c500, 0x11fac5db,
+0xe3c4b075, 0xb4551779, 0x79e3c401, 0x03bc5517,
+0xdcc2e0c5, 0x79e3c401, 0x02b87517, 0x0003c4b8,
+0x69e3c400, 0xc530d64a, 0xb05d28f8, 0xd2c2e0c5,
+0x79e2c400, 0x830fd10e, 0x000000c2, 0x6528f8c5,
+0x03d4b8d0, 0xe3c40000, 0xe0550c59, 0xc2e0c50a,
+0xe2c400da, 0x0fd90e79, 0x0000a183, 0x28f8c500,
+0xdbc5d065, 0xc5e055d0, 0xd07d28f8, 0x5dd0c3c5,
+0x03ddb8e0, 0xe8c50000, 0xc400d3c2, 0xd10e79e2,
+0xf8c57c73, 0xc4d05d28, 0x554061e3, 0xecb8f1e0,
+0xc5000003, 0x9415c2e8, 0x00000000, 0x0e79e2c4,
+0xc55b73d1, 0xa05d29f8, 0xdb57e0c5, 0x557ce3c5,
+0x29f8c5a0, 0xe3c5a055, 0xc5a0557c, 0xffd2c6e8,
+0x152ef8c5, 0x00000048, 0x2d752f7a, 0x6528f8c5,
+0x7ddbc5d0, 0xc031e055, 0xd37cebc5, 0xd37cebc5,
+0xd3c2e8c5, 0x79e2c400, 0x920fd10e, 0x01f883c0,
+0x0125c019, 0xeb000004, 0x03f8b805, 0xc35d0000,
+0x80000000, 0x40000000, 0xbf800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0002340,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x04620d10, 0xfbc50000,
+0x042a1510, 0x8b480000, 0x00042b05, 0x11fbc500,
+0x8948d04d, 0xfbc5f845, 0xc5e05511, 0xf04d11fb,
+0x5511fbc5, 0x11fbc5d8, 0xf9c5e84d, 0xc5d07d28,
+0xa07d29f9, 0x5528f9c5, 0x76f1c5a0, 0x0260b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x03d9830f,
+0xe9c50000, 0xc5d05d58, 0xb05d29f9, 0x5d28f9c5,
+0x0266b8d0, 0xe1c50000, 0xe1c5db58, 0x00b05dc2,
+0x0f79e2c4, 0xb0830fd9, 0xc5000003, 0xb07d28f9,
+0x5d5cc1c5, 0x29f9c5d0, 0xe9c5c05d, 0x00c05dc2,
+0x00026bb8, 0x79e2c400, 0x830fd90f, 0x0000038b,
+0x5d28f9c5, 0x59e9c5e0, 0xe1c5d055, 0xf9c5e359,
+0xc5d05d28, 0xe07558e1, 0x6d5ce1c5, 0x5ce9c5e0,
+0x0282b8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x0351830f, 0xe1c50000, 0xc5f05559,
+0xa05529f9, 0x5d5ee1c5, 0xc2e9c5f0, 0x8bb800d3,
+0xc4000002, 0xd10f79e2, 0x032d830f, 0xf9c50000,
+0xc5f05d28, 0x352512fb, 0xb8000003, 0x0000028e,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5d0, 0xe9c5a055,
+0xc400d4c2, 0xd10f79e2, 0x02fd830f, 0xf9c50000,
+0xc5d0555a, 0xc5d253f8, 0xc5d25af8, 0xa05529f9,
+0x555af9c5, 0x53f8c5a0, 0x28f9c5d2, 0x96b8d06d,
+0xc5000002, 0xc5d25af8, 0xc5d2e6fb, 0xc5d2e6fa,
+0x00d5c2e9, 0x0f79e2c4, 0xbc830fd1, 0xc5000002,
+0xc5d559d1, 0xa05529f9, 0x555af9c5, 0x52f8c5a0,
+0x5af8c5d2, 0x29f9c5d2, 0xf9c5b055, 0xb8b06528,
+0x0000029d, 0xd45af9c5, 0xd253f8c5, 0xd25af8c5,
+0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5, 0x79e2c400,
+0x830fe90f, 0x00000273, 0xe4e6fbc5, 0xece6fac5,
+0x6528f9c5, 0x029fb8d0, 0xf9c50000, 0xf8c5d45a,
+0xf8c5d253, 0xfbc5d25a, 0xfac5d2e6, 0xd1c5d2e6,
+0xc400d2c2, 0xd10f79e2, 0x023d830f, 0xd9c50000,
+0xf9c5d459, 0xc5a05529, 0xa05551f9, 0xd4c2e9c5,
+0x02a7b800, 0xe2c40000, 0x0fd10f79, 0x00021a83,
+0x12fbc500, 0x0002472d, 0x5ed1c500, 0x29f9c5d4,
+0xe3c4a055, 0xa0550979, 0x02afb80b, 0xe9c50000,
+0x022915c2, 0xc4000000, 0xd10f79e2, 0x01e9830f,
+0xe1c50000, 0xc5e05559, 0xc5f459e1, 0xb05529f9,
+0x555fc9c5, 0x5dc9c5b0, 0xf9c5b075, 0xc5b07529,
+0xb05558e9, 0x6558d9c5, 0x0348b8e0, 0xe9c50000,
+0xe9c5d359, 0xc400d4c2, 0xd10f79e2, 0x01a9830f,
+0xe3c40000, 0xd0550579, 0x0359b801, 0xe9c50000,
+0x00e055c2, 0x0f79e2c4, 0x8c830fd1, 0xb8000001,
+0x00000001, 0x5528f9c5, 0x6ef9c5e0, 0x035eb8f8,
+0xf9c50000, 0xc500f770, 0xc5e2e6fb, 0xd07d28f9,
+0xe6fad9c5, 0x2579e2c4, 0x73d9c5e4, 0xe2c401f4,
+0xc5e40d41, 0x00e4c2e9, 0x0f79e2c4, 0x48830fe1,
+0xc5000001, 0xd06516e9, 0x7d28f9c5, 0x15e9c5d0,
+0x5cd9c5f7, 0x0370b8e6, 0xd9c50000, 0xd9c5e359,
+0xc400e5c2, 0xe10f79e2, 0x011d830f, 0x0ff20000,
+0xc5d06512, 0x1d2d12fb, 0xc5000001, 0xc5ed58e1,
+0xd07528f9, 0x3d12fbc5, 0x0000011c, 0x0003b1b8,
+0x5cd9c500, 0x59d1c5e6, 0xc2d9c5ef, 0xe2c400e5,
+0x0fe10f79, 0x0000e283, 0x57d9c500, 0x17f9c5e4,
+0xc4b8b855, 0xc5000003, 0x01dbc2d9, 0x7513f9c5,
+0x69e3c4b0, 0xc530d64b, 0xb05d28f9, 0xd2c2e1c5,
+0x79e2c400, 0x830fd10f, 0x000000af, 0x7d28f9c5,
+0x03d4b8d0, 0xe3c40000, 0xe0550d41, 0xc2e1c502,
+0xe2c400da, 0x0fd90f79, 0x00008e83, 0x28f9c500,
+0xc1c5d07d, 0xc5e055d0, 0xd07528f9, 0x5dd0c9c5,
+0x03ddb8e0, 0xe9c50000, 0xc400d3c2, 0xd10f79e2,
+0xf9c56973, 0xc4d05d28, 0x554161e3, 0xecb831e0,
+0xc5000003, 0x9415c2e9, 0x00000000, 0x0f79e2c4,
+0xc54873d1, 0xa05d29f9, 0x557cd9c5, 0x15e9c5a0,
+0x2ef9c5d2, 0x00005715, 0x752b7a00, 0x28f9c529,
+0xc1c5d07d, 0x31e0557d, 0x7ce9c5c0, 0xc2e9c5d4,
+0xe2c400d4, 0x0fd10f79, 0xf883c092, 0x25c01901,
+0x00000401, 0xf8b805eb, 0x5d000003, 0x000000c3,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002220,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x21b24100,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0xe8ec8148, 0x4c000000, 0x67245c8d, 0x248c8d4c,
+0x00000087, 0x24848d4c, 0x000000a7, 0x24bc8d48,
+0x000000c7, 0x8dd28944, 0x8841ff48, 0xc2290304,
+0x01148841, 0xe283ca89, 0x01fa8301, 0xc121d219,
+0xff02e283, 0x01f983ca, 0x4100de83, 0x40001488,
+0x48073488, 0x8348c0ff, 0xc87521f8, 0x7c6ffdc5,
+0xfdc56824, 0x08247c7f, 0x546ffdc5, 0xd5c50824,
+0x60b8ed76, 0xc5000002, 0xc4cf74ed, 0xcd177de2,
+0x0861830f, 0xedc50000, 0x68244cfc, 0x4c7ffdc5,
+0xfdc52824, 0x68247c6f, 0x000266b8, 0xfcc5c500,
+0x74f5c5cf, 0xc428244c, 0xcd177de2, 0x0835830f,
+0xfdc50000, 0x28247c6f, 0x4cf8c5c5, 0xfdc56824,
+0x48244c7f, 0x5474edc5, 0x6bb84824, 0xc4000002,
+0xd5177de2, 0x080d830f, 0xfdc50000, 0xa824bc6f,
+0xc5000000, 0x24546ffd, 0x6ffdc568, 0x00c824b4,
+0x45c50000, 0xedc5ff60, 0xc5c5da60, 0xedc5ff68,
+0x85c5ca68, 0xc5c5dbd5, 0xe2c4c9d5, 0xed1d0065,
+0xc4000007, 0x0d0075e2, 0x00000804, 0x0265e3c4,
+0xf1c5ccd9, 0xcdc5c9ef, 0xf5c5c964, 0xfdc5f3db,
+0x4824747f, 0x4824548a, 0xc8248c8a, 0x89000000,
+0x8ae0d3d0, 0x00c9248c, 0x44880000, 0x448ac824,
+0xe0d34924, 0xca248c8a, 0x88000000, 0x8af42444,
+0xd34a2444, 0x248c8ae0, 0x000000cb, 0xf0244488,
+0x4b24448a, 0x8c8ae0d3, 0x0000cc24, 0x24448800,
+0x24448aec, 0x8ae0d34c, 0x00cd248c, 0x44880000,
+0x448ae824, 0xe0d34d24, 0xce248c8a, 0x88000000,
+0x8ac42444, 0xd34e2444, 0x248c8ae0, 0x000000cf,
+0xc0244488, 0x4f24448a, 0x8c8ae0d3, 0x0000d024,
+0x24448800, 0x24448abf, 0x8ae0d350, 0x00d1248c,
+0x44880000, 0x448ab824, 0xe0d35124, 0xd2248c8a,
+0x88000000, 0x8abe2444, 0xd3522444, 0x244488e0,
+0x248c8ab4, 0x000000d3, 0x5324448a, 0x247c8a44,
+0x748a4457, 0x8a445b24, 0xd35c2444, 0x248c8ae0,
+0x000000d4, 0x246c8a44, 0x2444885d, 0x24448abd,
+0x7c8a4054, 0xe0d35e24, 0xd5248c8a, 0x88000000,
+0x8ab02444, 0xd3552444, 0x248c8ae0, 0x000000d6,
+0xbc244488, 0x5624448a, 0x8c8ae0d3, 0x0000d724,
+0x24448800, 0x24448aac, 0xe7d34158, 0xd8248c8a,
+0xd3000000, 0x248c8ae0, 0x000000d9, 0xa8244488,
+0x5924448a, 0x8c8ae0d3, 0x0000da24, 0x24448800,
+0x24448aa4, 0x8ae0d35a, 0x00db248c, 0x44880000,
+0xd341a024, 0x248c8ae6, 0x000000dc, 0x8ae0d341,
+0x00dd248c, 0xd3410000, 0x248c8ae5, 0x000000de,
+0x8c8ae7d3, 0x0000df24, 0x648a4400, 0xf9c55f24,
+0xc824646e, 0x24748a40, 0x245c8a60, 0x6ef9c561,
+0xc5f02474, 0x244c6e79, 0xe4d341e8, 0xe0248c8a,
+0x8a000000, 0xc5622444, 0x24646e79, 0x5c8a44c0,
+0x8a446324, 0xc5652454, 0x244c6ef9, 0x6e79c5b8,
+0xd3b4245c, 0x248c8ae6, 0x000000e1, 0x244c8a44,
+0x6e79c566, 0xc4b02444, 0x742049e3, 0xc401ec24,
+0x64201963, 0xd301bf24, 0x248c8ae3, 0x000000e2,
+0x202163c4, 0x01bd245c, 0x2059e3c4, 0x01f42464,
+0x203163c4, 0x01c4244c, 0x8c8ae0d3, 0x0000e324,
+0x71e3c400, 0xbe244c20, 0x24448801, 0x24448a9c,
+0x3141c464, 0xd9c5cc61, 0xc1c4e661, 0x41cb6171,
+0xc1c4e3d3, 0xc4e16259, 0xe06e7941, 0xe4248c8a,
+0xc5000000, 0xc5cf6e79, 0xc4f66ef9, 0xe5201943,
+0x3143c401, 0xc401cc20, 0xf32049e3, 0x8ae0d301,
+0x00e5248c, 0x41c40000, 0x88c96119, 0x8a982444,
+0x41672444, 0x8c8ae2d3, 0x0000e624, 0xe1d34100,
+0xe7248c8a, 0xc4000000, 0x44203963, 0xc501bc24,
+0x24546e79, 0x2943c4ac, 0xc501d720, 0x246c6e79,
+0x6e79c5a8, 0xc49c245c, 0xc2613941, 0x201163c4,
+0x01a4246c, 0x41c4e0d3, 0xc4d16e79, 0xc86271c1,
+0x446e79c5, 0x43c49824, 0x01db2021, 0xe16cd9c5,
+0x4c6ef9c5, 0x43c4a024, 0x01c22039, 0x2071c3c4,
+0x63c401ce, 0x01d02029, 0x6149c1c4, 0x6191c5f3,
+0x3941c4c9, 0xc1c4c261, 0xc4f06249, 0xc96271c1,
+0xce6cf1c5, 0x385de3c4, 0xfdc501f1, 0xc824747f,
+0xb46ffdc5, 0x0000c824, 0xc501b000, 0xc4d86e79,
+0xdb787d42, 0xf84dc1c4, 0x7ffdc5cb, 0x00c8248c,
+0x8c8a0000, 0x0000c824, 0x24448a00, 0x7c8a4049,
+0x8a444c24, 0xd34d247c, 0x248c8ae2, 0x000000c9,
+0x24748a40, 0x748a444e, 0x8a444f24, 0x8851246c,
+0xd3f42454, 0x248c8ae0, 0x000000ca, 0x5024548a,
+0x24648a44, 0x245c8a53, 0x24448854, 0x24448af0,
+0x5c8a444a, 0xe0d35524, 0xcb248c8a, 0x88000000,
+0x8aec2444, 0xd34b2444, 0x248c8ae0, 0x000000cc,
+0xe8244488, 0x5224448a, 0x8c8ae7d3, 0x0000cd24,
+0x6e79c500, 0xe7d341e7, 0xce248c8a, 0xc4000000,
+0xe7201943, 0x8ae6d301, 0x00cf248c, 0x79c50000,
+0xd341c66e, 0x248c8ae6, 0x000000d0, 0x203943c4,
+0xe2d301c6, 0xd1248c8a, 0xc4000000, 0xc0611941,
+0xd26e79c5, 0x8ae5d341, 0x00d2248c, 0x43c40000,
+0x01d52029, 0x8c8ae0d3, 0x0000d324, 0x24448800,
+0xe4d341c4, 0xd4248c8a, 0xd3000000, 0x248c8ae3,
+0x000000d5, 0xf36ef9c5, 0x8ae3d341, 0x00d6248c,
+0x8a440000, 0x44562454, 0x57244c8a, 0x24448a44,
+0x49c3c458, 0x4101f320, 0x8c8ae2d3, 0x0000d724,
+0x7941c400, 0xd341ca6e, 0x248c8ae1, 0x000000d8,
+0x203143c4, 0xd34101c9, 0x248c8ae0, 0x000000d9,
+0x6149c1c4, 0x448844f1, 0x8a44c024, 0x41592444,
+0x8c8ae0d3, 0x0000da24, 0x44884400, 0x8a44bf24,
+0x415a2444, 0x8c8ae0d3, 0x0000db24, 0x44884400,
+0x8a44b824, 0x415b2444, 0x8c8ae0d3, 0x0000dc24,
+0x44884400, 0x8a44be24, 0x415c2444, 0x8c8ae0d3,
+0x0000dd24, 0x44884400, 0x8a44b424, 0x415d2444,
+0x8c8ae0d3, 0x0000de24, 0x44884400, 0x8a44bd24,
+0x415e2444, 0x8c8ae0d3, 0x0000df24, 0x44884400,
+0x8a44b024, 0x415f2444, 0x8c8ae0d3, 0x0000e024,
+0x44884400, 0x8a44bc24, 0x41602444, 0x8c8ae0d3,
+0x0000e124, 0x44884400, 0x8a44ac24, 0xc5612444,
+0x244c6ef9, 0x6e79c5f4, 0xc5ec246c, 0x24646ef9,
+0x1163c4c4, 0xe8246c20, 0x24448a01, 0x6e79c567,
+0x41b82474, 0x8c8ae0d3, 0x0000e224, 0x71e3c400,
+0xf0244c20, 0x59c3c401, 0x4401e420, 0xa8244488,
+0x24448a44, 0x61a9c562, 0x6e79c5e4, 0xc4ac2464,
+0xcd6171c1, 0xe662d9c5, 0x200963c4, 0x01be2474,
+0xc4e0d341, 0xc86271c1, 0xe3248c8a, 0xc5000000,
+0x24546e79, 0x448844b4, 0x8a44a424, 0xc5632444,
+0xc5cc6cf1, 0x246c6e79, 0x2963c4b0, 0xbd245420,
+0x1163c401, 0xbc246c20, 0x6ef9c501, 0x41c02464,
+0x8c8ae0d3, 0x0000e424, 0x59e3c400, 0xbf246420,
+0x44884401, 0x8a44a024, 0xc4642444, 0xd5612941,
+0x6159c1c4, 0xe0d341e6, 0xe5248c8a, 0xc4000000,
+0xe26259c1, 0x24448844, 0x448a449c, 0xd3416524,
+0x248c8ae0, 0x000000e6, 0x24448844, 0x448a4498,
+0xd3416624, 0x248c8ae0, 0x000000e7, 0x201963c4,
+0x01a82464, 0x746ef9c5, 0x79c5a424, 0x9c244c6e,
+0x2049e3c4, 0x01a02474, 0x203163c4, 0x0198244c,
+0x41c4e0d3, 0xc4c06e79, 0xc0203963, 0x6199c501,
+0x032cb8f6, 0x41c40000, 0xc4c86131, 0xf16249c1,
+0xe66cd9c5, 0x3875e3c4, 0xf5c501cc, 0xf5c5c9fc,
+0xc8244c74, 0x177de2c4, 0x28830fcd, 0xc5000001,
+0x248c6ffd, 0x00000088, 0x5c7ffdc5, 0xf5c50824,
+0xf5c5e160, 0xc1c4c968, 0xc5e7d55d, 0xc4cfd5f5,
+0x25005de2, 0x00000118, 0x0075e2c4, 0x00012f0d,
+0x5de3c400, 0xc5ccc902, 0x244c7ffd, 0x65e2c428,
+0x28244c3c, 0x3865e2c4, 0xc528245c, 0x245c7ffd,
+0xfcf5c528, 0xb828244c, 0x00000348, 0xd960f5c5,
+0xc968f5c5, 0xd565c1c4, 0xd5f5c5df, 0x65e2c4cf,
+0x00ca1d00, 0xe2c40000, 0xe10d0075, 0xc4000000,
+0xc90265e3, 0xfcedc5cc, 0x0088249c, 0xf5c50000,
+0xe2c4cb74, 0x0fcd177d, 0x00008a83, 0x7de2c400,
+0x08244c1c, 0xc974edc5, 0x00034fb8, 0x7de2c400,
+0x7373cd17, 0x0825e2c4, 0x00a8248c, 0x54b80000,
+0xc5000003, 0x248c74f5, 0x000000a8, 0x177de2c4,
+0xc65473cd, 0x21072444, 0x000362b8, 0x7de2c400,
+0x07244c78, 0xd974e5c5, 0x177de2c4, 0xb03873dd,
+0x6de3c41f, 0xc501ca46, 0xc4d86ef9, 0xca0f75e3,
+0xc4c03101, 0xdb787de2, 0xd3dbedc5, 0xfc6dc1c4,
+0x74edc5d3, 0x7de2c4d1, 0x920fd517, 0x01f883c0,
+0xe425c019, 0x48000003, 0x5bd8658d, 0x5d415c41,
+0x5f415e41, 0x0000c35d, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0004540,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x21b24100,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0xc8ec8148, 0x4c000000, 0x47245c8d, 0x244c8d4c,
+0x848d4c67, 0x00008724, 0xbc8d4800, 0x0000a724,
+0xd6894400, 0x41ff508d, 0x29030488, 0x348841c6,
+0x21d68901, 0x01e683c2, 0xfa83ceff, 0x00d98301,
+0x00348841, 0x48070c88, 0x8348c0ff, 0xd17521f8,
+0x546ffdc5, 0xfdc54824, 0xe824547f, 0x5c6ffdc5,
+0x60b8e824, 0xc5000002, 0xc5ca74e5, 0xc4d276ed,
+0xca177de2, 0x07a9830f, 0xe5c50000, 0x48244cfc,
+0x4c7ffdc5, 0xfdc50824, 0x48247c6f, 0x000266b8,
+0xfcc5c500, 0x74f5c5cf, 0xc408244c, 0xca177de2,
+0x077d830f, 0xfdc50000, 0x08247c6f, 0x4cf8c5c5,
+0xfdc54824, 0x28244c7f, 0x6474e5c5, 0x6bb82824,
+0xc4000002, 0xe2177de2, 0x0755830f, 0xe5c50000,
+0x68245ceb, 0x5c7ffdc5, 0xf5c5e824, 0x68244cdb,
+0x7c6ffdc5, 0xc5c52824, 0x68245cef, 0x4cdff5c5,
+0x77b8e824, 0xc5000002, 0xc4cb74f5, 0xca177de2,
+0x071d830f, 0xe1c50000, 0xe5c5dbef, 0xa8248c74,
+0xc5000000, 0xc5cb74f5, 0x2474dbf5, 0x7ffdc548,
+0x8a282474, 0x8a282444, 0x00a8248c, 0xc3890000,
+0x247c8a40, 0x24548a29, 0x8ae3d32b, 0x00a9248c,
+0x5c880000, 0x5c8ad424, 0xe7d32a24, 0xaa248c8a,
+0x40000000, 0xd3247c88, 0x247c8a40, 0x8ae3d32c,
+0x00ab248c, 0x5c880000, 0x5c8acc24, 0xe2d32d24,
+0xac248c8a, 0x88000000, 0x8ad22454, 0xd32e2454,
+0x248c8ae7, 0x000000ad, 0x247c8840, 0x7c8a40c8,
+0xe3d32f24, 0xae248c8a, 0x88000000, 0x8ad1245c,
+0xd330245c, 0x248c8ae2, 0x000000af, 0xc4245488,
+0x3124548a, 0x8c8ae7d3, 0x0000b024, 0x7c884000,
+0x8a40d024, 0xd332247c, 0x248c8ae3, 0x000000b1,
+0xc0245c88, 0x8c8ae2d3, 0x0000b224, 0x24548800,
+0x40e7d3bf, 0xb8247c88, 0xb3248c8a, 0x40000000,
+0x3324748a, 0x34245c8a, 0x3524548a, 0x247c8a40,
+0x44e6d336, 0x37247c8a, 0x24748a44, 0x6c8a443b,
+0x8a443d24, 0x403e244c, 0xbe247488, 0xb4248c8a,
+0x40000000, 0x3824748a, 0x8c8ae3d3, 0x0000b524,
+0x245c8800, 0x245c8ab4, 0x8ae2d339, 0x00b6248c,
+0x54880000, 0x548abd24, 0xe7d33a24, 0xb7248c8a,
+0x40000000, 0xb0247c88, 0x8ae7d341, 0x00b8248c,
+0xe6d30000, 0xb9248c8a, 0x40000000, 0xac247488,
+0x24748a40, 0x8ae3d33c, 0x00ba248c, 0x5c880000,
+0xe2d3a824, 0xbb248c8a, 0x88000000, 0x41a42454,
+0x8c8ae6d3, 0x0000bc24, 0x8ae6d300, 0x00bd248c,
+0xd3410000, 0x248c8ae5, 0x000000be, 0x8ae1d341,
+0x00bf248c, 0x8a440000, 0xc53f2464, 0x245c6ef9,
+0x7c8a40d4, 0x5c8a4024, 0x79c54124, 0xcc244c6e,
+0x6c6ef9c5, 0xd341c824, 0x248c8ae4, 0x000000c0,
+0x24448a44, 0x6e79c542, 0x44c42444, 0x43245c8a,
+0x4424548a, 0x4c6ef9c5, 0xf9c5c024, 0xb8247c6e,
+0x8c8ae7d3, 0x0000c124, 0x548a4400, 0xf9c54524,
+0xb424646e, 0x247c8840, 0x7c8a40a0, 0xe3d34624,
+0xc2248c8a, 0xc4000000, 0x4c203163, 0xc401d224,
+0x44203963, 0xc401d024, 0x7c2041e3, 0x4101be24,
+0x8c8ae0d3, 0x0000c324, 0x61e3c400, 0xd3245c20,
+0x51e3c401, 0xd1246c20, 0x71e3c401, 0xbf244c20,
+0xe3d34101, 0xc4248c8a, 0xc4000000, 0xd96161c1,
+0x6e7941c4, 0x51c1c4c9, 0xf1c5e861, 0x41c4cf61,
+0xd3c06e79, 0x62e1c5e2, 0x248c8add, 0x000000c5,
+0x203143c4, 0x548801cc, 0x548a9c24, 0x43c44724,
+0x01c32039, 0x8ae2d341, 0x00c6248c, 0xe7d30000,
+0xc7248c8a, 0xc4000000, 0x642059e3, 0xc501bd24,
+0x24746ef9, 0x49c3c4b0, 0xc501f720, 0x24546e79,
+0x6ef9c5a4, 0xc59c246c, 0xd3e661d9, 0x6ef9c5e2,
+0x6ef9c5f6, 0x62f1c5ff, 0x6ef9c5cc, 0xc4ac2464,
+0x642059e3, 0xc501a824, 0xc5d96ce1, 0x244c6ef9,
+0x2943c4a0, 0xc401d620, 0xf52049c3, 0x71e3c401,
+0xc401cb20, 0xea2051c3, 0x41e3c401, 0xc401fa20,
+0xe26159c1, 0x6149c1c4, 0x71c1c4f1, 0xd1c5c861,
+0xd9c5ef61, 0xf1c5e662, 0xd9c5cd62, 0xe3c4c96c,
+0x01d93865, 0xc976f5c5, 0x8cfcf5c5, 0x0000a824,
+0x7ffdc500, 0x00a8248c, 0x8c8a0000, 0x0000a824,
+0x8ae0d300, 0x00a9248c, 0x44880000, 0x448ad424,
+0xe0d32924, 0xaa248c8a, 0x88000000, 0x8ad32444,
+0xd32a2444, 0x248c8ae0, 0x000000ab, 0xcc244488,
+0x2b24448a, 0x8c8ae0d3, 0x0000ac24, 0x24448800,
+0x24448ad2, 0x8ae0d32c, 0x00ad248c, 0x44880000,
+0x448ac824, 0xe0d32d24, 0xae248c8a, 0x88000000,
+0x8ad12444, 0xd32e2444, 0x248c8ae0, 0x000000af,
+0xc4244488, 0x2f24448a, 0x8c8ae0d3, 0x0000b024,
+0x24448800, 0x24448ad0, 0x8ae0d330, 0x00b1248c,
+0x44880000, 0x448ac024, 0xe0d33124, 0xb2248c8a,
+0x88000000, 0x8abf2444, 0xd3322444, 0x244488e0,
+0x248c8ab8, 0x000000b3, 0x3324448a, 0x24548a44,
+0x7c8a4436, 0x8a403724, 0xd33c2474, 0x248c8ae0,
+0x000000b4, 0x24748a44, 0x2444883d, 0x24448abe,
+0x4c8a4434, 0xe0d33e24, 0xb5248c8a, 0x88000000,
+0x8ab42444, 0xd3352444, 0x248c8ae0, 0x000000b6,
+0xbd244488, 0x3824448a, 0x8ae2d341, 0x00b7248c,
+0xc1c40000, 0x41fa6e79, 0x8c8ae7d3, 0x0000b824,
+0x41c3c400, 0xd301ff20, 0x248c8ae0, 0x000000b9,
+0xb0244488, 0x3924448a, 0x8c8ae0d3, 0x0000ba24,
+0x24448800, 0x24448aac, 0x8ae0d33a, 0x00bb248c,
+0x44880000, 0x448aa824, 0xe0d33b24, 0xbc248c8a,
+0x88000000, 0xd3a42444, 0x248c8ae6, 0x000000bd,
+0x8ae6d341, 0x00be248c, 0xd3410000, 0x248c8ae1,
+0x000000bf, 0x246c8a44, 0x6ef9c53f, 0x8ad4246c,
+0x44402444, 0x4124648a, 0x546e79c5, 0xf9c5cc24,
+0xc824746e, 0x8ae5d341, 0x00c0248c, 0x8a440000,
+0xc5422444, 0x244c6e79, 0x245c8ac4, 0x24548a43,
+0x6ef9c544, 0xc5c0244c, 0x24446e79, 0x8ae0d3b8,
+0x00c1248c, 0x8a440000, 0xc545245c, 0x24646ef9,
+0x2963c4b4, 0xd2245420, 0x7c8a4001, 0x44884624,
+0xd341a024, 0x248c8ae4, 0x000000c2, 0x203163c4,
+0x01d0244c, 0x203963c4, 0x01be2444, 0x2051e3c4,
+0x01d3246c, 0x8ae0d341, 0x00c3248c, 0xe3c40000,
+0x24742049, 0xe3c401d1, 0x244c2071, 0xe3c401bf,
+0x24642059, 0xc1c401bd, 0xd3ea6151, 0x248c8ae3,
+0x000000c4, 0x6149c1c4, 0x24448af1, 0x61d9c547,
+0x71c1c4e7, 0xd1c5c861, 0xf1c5ee62, 0xe2d3cc62,
+0xce6e79c5, 0x6e7941c4, 0x6cd1c5c0, 0x3143c4c9,
+0xc501de20, 0x8aea6ef9, 0x00c5248c, 0x41c40000,
+0xc4c96e79, 0xc3203963, 0xe3d34101, 0xc6248c8a,
+0xc4000000, 0xcd203143, 0x51c3c401, 0xc401eb20,
+0xc9612141, 0x8c8ae7d3, 0x0000c724, 0x6ef9c500,
+0xc5b02464, 0x24546e79, 0x59e3c4a8, 0xac246420,
+0x2963c401, 0xa4245420, 0x6ef9c501, 0xc5e0d3ff,
+0x24746ef9, 0x41e3c4a0, 0xc401f820, 0xf42049c3,
+0x59c1c401, 0x2cb8e261, 0xc4000003, 0xf06149c1,
+0xef61d1c5, 0x6259c1c4, 0x62c9c5e1, 0x6cd9c5ed,
+0x75e3c4e5, 0xc501cc38, 0xc5c9fcf5, 0xc4cb74f5,
+0xca177de2, 0x00a9830f, 0xfdc50000, 0x48244c6f,
+0x5cdaf5c5, 0xf5c56824, 0x682464de, 0xdcfce5c5,
+0x64fcf5c5, 0x3fb86824, 0xc5000003, 0xc4dc74e5,
+0xda177de2, 0x01b07d73, 0xd86ef9c5, 0x000354b8,
+0x7de2c400, 0xe2c4db78, 0x24ac0865, 0x00000088,
+0xac74d5c5, 0x00008824, 0x7de2c400, 0x5373ea17,
+0xe72444c6, 0x0362b821, 0xe2c40000, 0x246c787d,
+0x74ddc5e7, 0x7de2c4e5, 0x3773e217, 0xe3c41fb0,
+0x01e14675, 0xe86ef9c5, 0x0f5de3c4, 0xc03101e1,
+0x787de2c4, 0xdbf5c5ed, 0xfcf5c5cd, 0x74f5c5cb,
+0x7de2c4cc, 0x920fca17, 0x01f883c0, 0xe425c019,
+0x48000003, 0x5bd8658d, 0x5d415c41, 0x5f415e41,
+0x0000c35d,
+0004122,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i2[] = {
+0xb85500eb, 0x00000001, 0x10b9f631, 0x41000000,
+0x000011ba, 0xe5894800, 0x56415741, 0x54415541,
+0xe4834853, 0xec8148e0, 0x000000a8, 0xa42444c7,
+0x00000010, 0x45ff788d, 0x8941d089, 0x41fa89c1,
+0xe283c029, 0x01fa8301, 0xe283d219, 0x85caff02,
+0xff0575c7, 0x01b640c9, 0x4c894466, 0x44660644,
+0x26444489, 0x44548966, 0x4c896646, 0xff486644,
+0xf88348c0, 0x40bd7511, 0x0474f684, 0xa4244c89,
+0x746ffdc5, 0xfdc50824, 0xa824747f, 0x546ffdc5,
+0xf5c5a824, 0x60b8c976, 0xc5000002, 0xc4de75ed,
+0xd9177de2, 0x071f830f, 0xedc50000, 0x08245cfd,
+0x5c7ffdc5, 0xfdc5c824, 0x0824746f, 0x000266b8,
+0x71e5c500, 0xe5c501f6, 0xc8245c75, 0x177de2c4,
+0xf2830fd9, 0xc5000006, 0x24746ffd, 0xf9cdc5c8,
+0xc508245c, 0x245c7ffd, 0x75edc5e8, 0xb8e8245c,
+0x0000026b, 0x177de2c4, 0xca830fd9, 0xc5000006,
+0x24746ffd, 0xd5edc528, 0xc5082454, 0xc5e6d5cd,
+0x24647ffd, 0x6ffdc5c8, 0xc508245c, 0xc5f6fde5,
+0x246cf9e5, 0xf9edc528, 0x0282b8d4, 0xd5c50000,
+0xedc5eed5, 0xfdc5d575, 0xe8246c7f, 0x177de2c4,
+0x82830fd1, 0xc5000006, 0x2454d5e5, 0x7ffdc528,
+0x66a82454, 0xc82444c7, 0xc0310010, 0x247c8d48,
+0x0eb841ca, 0x66000000, 0xe62444c7, 0x8d480010,
+0x44e42474, 0x8948c289, 0x66c229f1, 0xc8045403,
+0x66c12948, 0x48071489, 0x6602c083, 0x83481189,
+0xdf750ef8, 0x24548966, 0x6ffdc5d8, 0xb8a82474,
+0x000002d3, 0x5475cdc5, 0xe2c4c824, 0x0fd1177d,
+0x00061483, 0xe5e5c500, 0xc5482464, 0x246c6ffd,
+0xefc1c548, 0x02dab8ff, 0xc5c50000, 0xedc5d565,
+0xe2c4d475, 0x0fd1177d, 0x0005ec83, 0xd5d5c500,
+0xc5082474, 0x24747ffd, 0x6ffdc5e8, 0xc5e82464,
+0x03f471dd, 0x647ffdc5, 0xfdc5a824, 0xe824546f,
+0xf271edc5, 0x7ffdc502, 0xc5c82454, 0xb8d2fded,
+0x000002f8, 0xd475edc5, 0x177de2c4, 0xa6830fd1,
+0xc5000005, 0x24646ffd, 0x71edc5a8, 0xedc502e4,
+0xfdb8d2fd, 0xc5000002, 0x245475ed, 0x7de2c4c8,
+0x830fd117, 0x00000581, 0xc5d565c5, 0xa42444c7,
+0x00000003, 0x24446348, 0xf9e1c4a4, 0xbdc5d06e,
+0x44c7d2f1, 0x0002a424, 0x63480000, 0xc4a42444,
+0xe06ef9e1, 0xe4f1bdc5, 0x647ffdc5, 0xddc5c824,
+0x10b8e4fd, 0xc5000003, 0xc4e275dd, 0xe1177de2,
+0x0533830f, 0x63480000, 0xc4a42444, 0xe06ef9e1,
+0xd4e1edc5, 0xd2fdedc5, 0x000314b8, 0x75edc500,
+0xc4c82454, 0xd1177de2, 0x050b830f, 0xfdc50000,
+0x6824646f, 0xd765ddc5, 0xdb6dc1c4, 0x7ffdc5f8,
+0x8be8247c, 0x8be82454, 0x4168244c, 0x8b66d789,
+0x44ea2444, 0xec24748b, 0x648b4466, 0xd341ee24,
+0x4c8b66e7, 0x8b446a24, 0x66f0246c, 0xf2247c8b,
+0xf4245c8b, 0x6e79c1c4, 0x8be0d3d7, 0x8b6c244c,
+0x44f82474, 0xfc245c8b, 0x448b4466, 0x8966fe24,
+0x41942444, 0x8b66e6d3, 0x446e244c, 0x4124148b,
+0x4c8be4d3, 0xd3417024, 0x4c8b66e5, 0xc1c47224,
+0xd3fd6e79, 0x244c8be7, 0x66e3d374, 0x76244c8b,
+0x245c8966, 0x5c8b6690, 0xe3d3f624, 0x78244c8b,
+0x8b66e6d3, 0x667a244c, 0x8c247489, 0x24748b66,
+0x8be6d3fa, 0x667c244c, 0x8a247489, 0x24748b66,
+0xe3d34102, 0x244c8b66, 0xe0d3417e, 0x80248c8b,
+0x41000000, 0x8b66e2d3, 0x0082248c, 0xe6d30000,
+0x84248c8b, 0x44000000, 0x04244c8b, 0x4c6e79c5,
+0xe9c59024, 0x942464c4, 0x79c1c401, 0x8b66d66e,
+0xc4062444, 0xc4c46941, 0xe1d34101, 0xd7c4c1c5,
+0x8c8b6601, 0x00008624, 0xc4b1c500, 0xc1c401fb,
+0xc4e06259, 0xd16e7941, 0xd762e9c5, 0x6e7941c4,
+0x6ef9c5c2, 0xd38c247c, 0x6cd9c5e0, 0xc4c1c5e2,
+0x018a2454, 0x6e79c1c4, 0x4141c4fb, 0xc501c8c4,
+0x01fec4b9, 0xc0c429c5, 0x69c1c401, 0xc1c4d162,
+0xc5f86241, 0xc4d76ce9, 0xe2385de3, 0x0001b801,
+0xfdc50000, 0x68247c6f, 0xd06ef9c5, 0x797de2c4,
+0xf9c5c5d2, 0x7ffdc5d2, 0x8b682454, 0x6668244c,
+0xea24448b, 0x247c8b44, 0x8b4466ec, 0xd3ee2464,
+0x4c8b66e2, 0x8b446a24, 0x66f02474, 0xf224748b,
+0x246c8b44, 0x548966f4, 0xe0d39424, 0x6c244c8b,
+0x245c8b66, 0x5c8b44f6, 0x8b44f824, 0x66fc2454,
+0x90244489, 0x66e7d341, 0x6e244c8b, 0x24448b66,
+0x7c8b66fa, 0x8b44fe24, 0xd341240c, 0x244c8be4,
+0x548b6670, 0x8b440224, 0x41042444, 0x8b66e6d3,
+0xc472244c, 0xc66e7941, 0x4c8be6d3, 0xd3417424,
+0x4c8b66e5, 0x41c47624, 0xd3d56e79, 0x244c8be3,
+0xe3d34178, 0x244c8b66, 0x8be0d37a, 0x667c244c,
+0x8c244489, 0x66e2d341, 0x7e244c8b, 0x8c8be7d3,
+0x00008024, 0xe1d34100, 0x248c8b66, 0x00000082,
+0x8c8be2d3, 0x00008424, 0xe0d34100, 0x248c8b66,
+0x00000086, 0x24448b66, 0x6ef9c506, 0xc594247c,
+0x2454c4c1, 0xc1c40190, 0xc4ff6e79, 0xd86e7941,
+0xc44141c4, 0xb9c501cc, 0xd301fec4, 0xc429c5e0,
+0xc1c401c3, 0xc4f86241, 0xd16269c1, 0x6e7941c4,
+0x6ce9c5c3, 0xc4b9c5d7, 0x018c247c, 0x6e7941c4,
+0xc439c5c2, 0x41c401d7, 0xc5c16e79, 0x01cac439,
+0xc0c421c5, 0x41c1c401, 0x2cb8fa62, 0xc4000003,
+0xc0623141, 0x6c41c1c4, 0x6de3c4f8, 0xc501d738,
+0xc5d2fded, 0xc4d475ed, 0xd1177de2, 0x0217830f,
+0xd5c50000, 0x282454d5, 0x547ffdc5, 0xcdc5c824,
+0xc82454ee, 0x547ffdc5, 0xcdc5e824, 0xc82474ea,
+0x747ffdc5, 0xedc5c824, 0xc82454fd, 0x64fde5c5,
+0x48b82824, 0xc5000003, 0xc5d5d5ed, 0xc4d475ed,
+0xd1177de2, 0x01cf830f, 0xd5c50000, 0xfdc5ebd5,
+0xa8246c7f, 0x1d7de2c4, 0xc5a82454, 0xb8d275e5,
+0x0000034f, 0x177de2c4, 0xaa830fd1, 0xb8000001,
+0x00000001, 0xd06ef9c5, 0x000354b8, 0x7de2c400,
+0xe2c4d279, 0x2454096d, 0x75edc548, 0xc4482454,
+0xd1177de2, 0x017f830f, 0xfdc50000, 0x2824646f,
+0x000362b8, 0x84c76600, 0x00008824, 0xc4001100,
+0xac797de2, 0x00008824, 0xfde5c500, 0x75edc5d4,
+0x7de2c4d5, 0x830fd117, 0x0000014d, 0xfdc5c031,
+0x01a8d46f, 0xfdc50475, 0xfdc5d36f, 0x8824947f,
+0x66000000, 0x8844948b, 0x66000000, 0xc8445489,
+0x48c0ff48, 0x7510f883, 0x6ffdc5d5, 0xb808245c,
+0x000003d4, 0x0e65e3c4, 0xaa282454, 0x5475edc5,
+0xe2c4c824, 0x0fd1177d, 0x0000fc83, 0x65e3c400,
+0xb801d346, 0x0000000f, 0x0f6de3c4, 0xf9c502e3,
+0x01b8d06e, 0xc5000000, 0xc4e86ef9, 0xd2797de2,
+0x0003e4b8, 0xdbe5c500, 0x7de2c4d2, 0xedc5ed79,
+0xddc5d5fd, 0xe2c4d275, 0x0fd1177d, 0x0000b883,
+0x7ffdc500, 0xc5a8245c, 0xb8e4efd9, 0x00000004,
+0xedefd1c5, 0x546ff9c5, 0xfdc5a824, 0xa824746f,
+0x3855e3c4, 0xe3c401d2, 0x00dc384d, 0x016de2c4,
+0x7ffdc5d3, 0xffa82454, 0xc4d975c8, 0xd2397de3,
+0x03f8b801, 0xf9c50000, 0x6607d2c5, 0x0088fa81,
+0xfdc56775, 0x08246c6f, 0x546ff9c5, 0xd9c52824,
+0x04b8e4ef, 0xc4000000, 0xd23855e3, 0x7de3c401,
+0xc501eb39, 0x246c6ffd, 0x55e3c428, 0xc400db38,
+0xd3056de2, 0x386de3c4, 0xe3c401dc, 0x01d2397d,
+0xd26ff9c5, 0x0165e2c4, 0x75c8ffd2, 0xefe1c5e7,
+0xc5c031db, 0xc4d375ed, 0xd1177de2, 0x83c0920f,
+0xc01901f8, 0x00040125, 0x658d4800, 0x5c415bd8,
+0x5e415d41, 0xc35d5f41,
+0003730,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u2[] = {
+0xb85500eb, 0x00000001, 0x10baf631, 0x41000000,
+0x000011ba, 0xe5894800, 0x56415741, 0x54415541,
+0xe4834853, 0xec8148e0, 0x000000a8, 0xa42444c7,
+0x00000010, 0x45ff788d, 0x8941d089, 0x41f989c1,
+0xe183c029, 0x85c9ff01, 0xff0575c7, 0x01b640ca,
+0x4c894466, 0x44660644, 0x26444489, 0x444c8966,
+0x54896646, 0xff486644, 0xf88348c0, 0x40c57511,
+0x0474f684, 0xa4245489, 0x7c6ffdc5, 0xfdc50824,
+0xa8247c7f, 0x5c6ffdc5, 0xf5c5a824, 0x60b8c976,
+0xc5000002, 0xc4d775e5, 0xd1177de2, 0x06c4830f,
+0xe5c50000, 0x082454fd, 0x547ffdc5, 0xfdc5c824,
+0x08247c6f, 0x000266b8, 0x71edc500, 0xedc501f7,
+0xc8245475, 0x177de2c4, 0x97830fd1, 0xc5000006,
+0x247c6ffd, 0xf9c5c5c8, 0xc5082454, 0x24547ffd,
+0x75e5c5e8, 0xb8e82464, 0x0000026b, 0x177de2c4,
+0x6f830fe1, 0xc5000006, 0x245cebe5, 0x7ffdc528,
+0xc5a8245c, 0x2454dbed, 0x7ffdc528, 0xc5c82454,
+0x247c6ffd, 0xefc5c5e8, 0xc528245c, 0x245c7ffd,
+0xdfedc5e8, 0xb8a82454, 0x00000277, 0xd375edc5,
+0x177de2c4, 0x2b830fd1, 0xc5000006, 0x245c6ffd,
+0xd5e5c508, 0xc5282454, 0x24547ffd, 0x44c766a8,
+0x0010c824, 0x8d48c031, 0x41ca247c, 0x00000eb8,
+0x44c76600, 0x0010e624, 0x24748d48, 0xc28944e4,
+0x29f18948, 0x540366c2, 0x2948c804, 0x148966c1,
+0xc0834807, 0x11896602, 0x0ef88348, 0x8966df75,
+0xc5d82454, 0x247c6ffd, 0x02d3b8a8, 0xc5c50000,
+0xc8245475, 0x177de2c4, 0xb7830fd1, 0xc5000005,
+0x2464e4e5, 0xdbe5c548, 0xc5482454, 0x2454fded,
+0x02dcb848, 0xedc50000, 0xe2c4d475, 0x0fd1177d,
+0x00059183, 0x7ffdc500, 0xc5e8245c, 0x247c6ffd,
+0x71ddc5e8, 0xfdc503f7, 0xa824647f, 0x746ffdc5,
+0xedc5e824, 0xc502f671, 0x24547ffd, 0xfdedc5c8,
+0x02f8b8d2, 0xedc50000, 0xe2c4d475, 0x0fd1177d,
+0x00055183, 0x6ffdc500, 0xc5a8247c, 0x02d771ed,
+0xd2fdedc5, 0x0002fdb8, 0x75edc500, 0xc4c82454,
+0xd1177de2, 0x052c830f, 0x44c70000, 0x0003a424,
+0xf9c50000, 0xa424546e, 0xd2f1e5c5, 0xa42444c7,
+0x00000002, 0x646ef9c5, 0xe5c5a424, 0xfdc5e4f1,
+0xc824647f, 0xe4fdddc5, 0x000310b8, 0x75ddc500,
+0x7de2c4e2, 0x830fe117, 0x000004ea, 0x646ef9c5,
+0xedc5a424, 0xedc5d4d1, 0x14b8d2fd, 0xc5000003,
+0x245475ed, 0x7de2c4c8, 0x830fd117, 0x000004c6,
+0xe4efd9c5, 0x5475ddc5, 0xedc56824, 0xedc5d475,
+0x082474db, 0x747ffdc5, 0x448be824, 0x4c8be824,
+0x89416824, 0x5c8b66c7, 0x8b44ea24, 0x66ec2474,
+0x24648b44, 0xe7d341ee, 0x244c8b66, 0x6c8b446a,
+0x8b66f024, 0x8bf2247c, 0xc4f82474, 0xd76e79c1,
+0x4c8be3d3, 0x8b446c24, 0x8b662414, 0x44fa2454,
+0xfc245c8b, 0x245c8966, 0xe6d34194, 0x244c8b66,
+0x245c8b6e, 0x8b4466f4, 0x41fe2444, 0x4c8be4d3,
+0xd3417024, 0x4c8b66e5, 0xc1c47224, 0xd3ed6e79,
+0x244c8be7, 0x66e3d374, 0x76244c8b, 0x245c8966,
+0x5c8b6690, 0xe3d3f624, 0x78244c8b, 0x8b66e6d3,
+0x667a244c, 0x8c247489, 0x24748b66, 0x8be2d302,
+0x667c244c, 0x8a245489, 0x66e3d341, 0x7e244c8b,
+0x8be0d341, 0x0080248c, 0xd3410000, 0x8c8b66e2,
+0x00008224, 0x8be6d300, 0x0084248c, 0x8b440000,
+0xc504244c, 0x247c6ef9, 0xc4e9c590, 0x01942464,
+0x6e79c1c4, 0x548b66d6, 0xc1c40624, 0x01f4c469,
+0xc5e1d341, 0x01d7c4d1, 0x248c8b66, 0x00000086,
+0xebc4c1c5, 0x62d9c501, 0x7941c4e6, 0xe9c5c16e,
+0xc1c4d562, 0xc5f26e79, 0x246c6ef9, 0xc5e2d38c,
+0xc5e26cd9, 0x2454c4d1, 0xc1c4018a, 0xc4eb6e79,
+0xf8c451c1, 0xc4c9c501, 0xb9c501ee, 0xc501f2c4,
+0xc5d762e9, 0xc5ee62d1, 0xc4d56ce9, 0xe2385de3,
+0x76edc501, 0xfdedc5d2, 0xc5682454, 0x24547ffd,
+0x244c8b68, 0x7c8b4468, 0x4466ec24, 0xee24648b,
+0x24748b44, 0x66e0d3f0, 0x6a244c8b, 0x24748b66,
+0x6c8b44f2, 0x8b66f424, 0x66f6245c, 0x94244489,
+0x24448b66, 0x5c8b44ea, 0x8b44f824, 0x66fc2454,
+0xfe247c8b, 0x4c8be0d3, 0x8b446c24, 0x8b66240c,
+0x44022454, 0x0424448b, 0x24448966, 0xe7d34190,
+0x244c8b66, 0x448b666e, 0xd341fa24, 0x244c8be4,
+0xe6d34170, 0x244c8b66, 0x79c1c472, 0xe6d3f66e,
+0x74244c8b, 0x66e5d341, 0x76244c8b, 0x6e7941c4,
+0x8be3d3c5, 0x4178244c, 0x8b66e3d3, 0xd37a244c,
+0x244c8be0, 0x4489667c, 0xd3418c24, 0x4c8b66e2,
+0xe7d37e24, 0x80248c8b, 0x41000000, 0x8b66e1d3,
+0x0082248c, 0xe2d30000, 0x84248c8b, 0x41000000,
+0x8b66e0d3, 0x0086248c, 0x8b660000, 0xc5062444,
+0x246c6ef9, 0xc4d1c594, 0x01902454, 0x6e79c1c4,
+0x7941c4ef, 0xc1c4c86e, 0x01fcc451, 0xeec4c9c5,
+0xc5e0d301, 0x01f3c4b9, 0xee62d1c5, 0xd762e9c5,
+0x6e79c1c4, 0x6ce9c5f3, 0xc4c9c5d5, 0x018c246c,
+0x6e79c1c4, 0xc449c5f2, 0xc1c401c7, 0xc5f16e79,
+0x01fac4c9, 0xf0c4b1c5, 0x51c1c401, 0x2cb8e862,
+0xc5000003, 0xc5f662c1, 0xc4ee6cd1, 0xd5386de3,
+0xfdedc501, 0x75edc5d2, 0x7de2c4d4, 0x830fd117,
+0x000001e2, 0x3a65e2c4, 0xc5282454, 0x24547ffd,
+0x65e2c4a8, 0x2824643e, 0x647ffdc5, 0xedc5c824,
+0xe5c5d4fd, 0x282464fd, 0x00033fb8, 0x75edc500,
+0x7de2c4d4, 0x830fd117, 0x000001aa, 0x000001b8,
+0x6ef9c500, 0x0354b8d0, 0xe2c40000, 0xc4d2797d,
+0x54096de2, 0xedc54824, 0x48245475, 0x177de2c4,
+0x7f830fd1, 0xc5000001, 0x24646ffd, 0x0362b828,
+0xc7660000, 0x00882484, 0x00110000, 0x797de2c4,
+0x008824ac, 0xe5c50000, 0xedc5d4fd, 0xe2c4d575,
+0x0fd1177d, 0x00014d83, 0xc5c03100, 0xa8d46ffd,
+0xc5047501, 0xc5d36ffd, 0x24947ffd, 0x00000088,
+0x44948b66, 0x00000088, 0x44548966, 0xc0ff48c8,
+0x10f88348, 0xfdc5d575, 0x08245c6f, 0x0003d4b8,
+0x65e3c400, 0x2824540e, 0x75edc5aa, 0xc4c82454,
+0xd1177de2, 0x00fc830f, 0xe3c40000, 0x01d34665,
+0x00000fb8, 0x6de3c400, 0xc502e30f, 0xb8d06ef9,
+0x00000001, 0xe86ef9c5, 0x797de2c4, 0x03e4b8d2,
+0xe5c50000, 0xe2c4d2db, 0xc5ed797d, 0xc5d5fded,
+0xc4d275dd, 0xd1177de2, 0x00b8830f, 0xfdc50000,
+0xa8245c7f, 0xe4efd9c5, 0x000004b8, 0xefd1c500,
+0x6ff9c5ed, 0xc5a82454, 0x247c6ffd, 0x55e3c4a8,
+0xc401d238, 0xdc3845e3, 0x6de2c400, 0xfdc5d301,
+0xa824547f, 0xd975c8ff, 0x397de3c4, 0xf8b801d2,
+0xc5000003, 0x07d2c5f9, 0x88fa8166, 0xc5677500,
+0x24746ffd, 0x6ff9c508, 0xc5282454, 0xb8e4efd9,
+0x00000004, 0x384de3c4, 0xe3c401d2, 0x01f3397d,
+0x746ffdc5, 0xe3c42824, 0x00db384d, 0x056de2c4,
+0x6de3c4d3, 0xc401dc38, 0xd2397de3, 0x6ff9c501,
+0x65e2c4d2, 0xc8ffd201, 0xe1c5e775, 0xc031dbef,
+0xd375edc5, 0x177de2c4, 0xc0920fd1, 0x1901f883,
+0x040125c0, 0x8d480000, 0x415bd865, 0x415d415c,
+0x5d5f415e, 0x000000c3,
+0003565,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x09b94100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000a8ec,
+0xff788d00, 0x89c88945, 0x89048444, 0xc02941fa,
+0x4401e283, 0x24844489, 0x1901fa83, 0x02e283d2,
+0xc785caff, 0xc7940f40, 0x44845489, 0xffb60f40,
+0x4c89f929, 0xff486484, 0xf88348c0, 0xc5c27509,
+0x247c6ffd, 0x7ffdc508, 0xc5a8247c, 0x24546ffd,
+0x76f5c5a8, 0x0260b8c9, 0xedc50000, 0xe2c4df76,
+0x0fd9177d, 0x0004a283, 0xfeedc500, 0xc508245c,
+0x245c7ffd, 0x6ffdc5c8, 0xb808247c, 0x00000266,
+0xf772e5c5, 0x76e5c501, 0xc4c8245c, 0xd9177de2,
+0x0475830f, 0xfdc50000, 0xc824746f, 0x5cfacdc5,
+0xfdc50824, 0xe8245c7f, 0x5c76edc5, 0x6bb8e824,
+0xc4000002, 0xd9177de2, 0x044d830f, 0xfdc50000,
+0x28247c6f, 0x406de2c4, 0xc4082454, 0xe74045e2,
+0x5c6ffdc5, 0xe5c50824, 0xe5c5f7fe, 0x28246cfa,
+0xd4faedc5, 0x000282b8, 0x55e2c400, 0xedc5ee40,
+0xe2c4d576, 0x0fd1177d, 0x00040e83, 0x65e2c400,
+0x28245440, 0x1576edc5, 0x00000414, 0x0002d3b8,
+0x7de2c400, 0x830fd117, 0x000003ef, 0x4065e2c4,
+0xc548246c, 0x246c7ffd, 0x6ffdc5e8, 0xc5e82474,
+0x03f672dd, 0x647ffdc5, 0xfdc5a824, 0xe8247c6f,
+0xf772edc5, 0x7ffdc502, 0xc5c82454, 0xb8d2feed,
+0x000002f8, 0xd476edc5, 0x177de2c4, 0xa8830fd1,
+0xc5000003, 0x24746ffd, 0x72edc5a8, 0xedc502e6,
+0xfdb8d2fe, 0xc5000002, 0x245476ed, 0x7de2c4c8,
+0x830fd117, 0x00000383, 0xa42444c7, 0x00000003,
+0x24446348, 0xf9e1c4a4, 0xd5c5d06e, 0x44c7d2f2,
+0x0002a424, 0x63480000, 0xc4a42444, 0xe06ef9e1,
+0xe4f2d5c5, 0x647ffdc5, 0xddc5c824, 0x10b8e4fe,
+0xc5000003, 0xc4e276dd, 0xe1177de2, 0x0339830f,
+0x63480000, 0xc4a42444, 0xf86ef9e1, 0xd7e2edc5,
+0xd2feedc5, 0x000314b8, 0x76edc500, 0xc4c82454,
+0xd1177de2, 0x0311830f, 0xfdc50000, 0x6824746f,
+0xd2efe9c5, 0xd266cdc5, 0xd5dbedc5, 0x547ffdc5,
+0xe2c4e824, 0x246c476d, 0x0001b868, 0xfdc50000,
+0x68247c6f, 0xe06ef9c5, 0x587de2c4, 0xfac5c5e4,
+0x7ffdc5e4, 0xc4682464, 0x54476de2, 0x2cb86824,
+0xc5000003, 0x24547ffd, 0xfeedc5c8, 0x76edc5d2,
+0x7de2c4d5, 0x830fd117, 0x000002af, 0x746ffdc5,
+0xe2c4c824, 0x2454464d, 0x0331b868, 0xedc50000,
+0xe8245476, 0x177de2c4, 0x8c830fd1, 0xc5000002,
+0x24646ffd, 0x5de2c448, 0x28245440, 0x547ffdc5,
+0xe2c4c824, 0xc4eb405d, 0x543d55e2, 0xfdc5c824,
+0xe824547f, 0x3955e2c4, 0xc5c8246c, 0x246c7ffd,
+0xfeedc5c8, 0xc5c82454, 0x246cfee5, 0x0348b828,
+0xe2c40000, 0xc5d4406d, 0xc4d576ed, 0xd1177de2,
+0x0235830f, 0xe2c40000, 0xc5e3405d, 0x24647ffd,
+0x7de2c4a8, 0xa824541e, 0xda76e5c5, 0x00034fb8,
+0x7de2c400, 0x830fd917, 0x0000020f, 0x000001b8,
+0x6ffdc500, 0xc548245c, 0xb8d06ef9, 0x00000354,
+0x587de2c4, 0x6de2c4d2, 0xe5c5e30a, 0xe2c4e476,
+0x0fe1177d, 0x0001e283, 0x6ffdc500, 0xc5282464,
+0x246c6ffd, 0x0359b808, 0xddc50000, 0xe2c4d2fa,
+0xc5d5366d, 0xc4d276dd, 0xd1177de2, 0x01b9830f,
+0xddc50000, 0x62b8d5fe, 0xc7000003, 0x00882484,
+0x00090000, 0xe2c40000, 0x24b4587d, 0x00000088,
+0xd676edc5, 0x177de2c4, 0x8c830fd1, 0x31000001,
+0x6ffdc5c0, 0x7501a8d4, 0x6ffdc504, 0x7ffdc5d5,
+0x00882494, 0x948b0000, 0x00008884, 0x84548900,
+0xc0ff48c8, 0x08f88348, 0xd1c5d775, 0xc4b8edef,
+0xc5000003, 0xc4dd66e5, 0x548c65e2, 0xfdc50824,
+0xe824547f, 0xd276edc5, 0x4c6de3c4, 0xe2c430d5,
+0x24648e6d, 0x6ffdc5e8, 0xc5e8247c, 0x245476c5,
+0x7de2c4c8, 0x830fd117, 0x0000011f, 0x5c6ffdc5,
+0xd4b80824, 0xc4000003, 0x540265e3, 0xc5aa2824,
+0x245476ed, 0x7de2c4c8, 0x830fd117, 0x000000fb,
+0x4665e3c4, 0x07b801d3, 0xc4000000, 0xe30f6de3,
+0x6ef9c504, 0x0001b8d0, 0xf9c50000, 0xe2c4e86e,
+0xb8d2587d, 0x000003e4, 0xd2dbe5c5, 0x587de2c4,
+0xfeedc5ed, 0x76ddc5d5, 0x7de2c4d2, 0x830fd117,
+0x000000b7, 0x5c7ffdc5, 0xd9c5a824, 0x03b8e4ef,
+0xc5000000, 0xc5edefd1, 0x24546ff9, 0x6ffdc5a8,
+0xc4a82474, 0xd23855e3, 0x4de3c401, 0xc400dc38,
+0xd3026de2, 0x547ffdc5, 0xc8ffa824, 0xe3c4d975,
+0x01d2397d, 0x0003f8b8, 0x79e3c400, 0x8303d216,
+0x677524fa, 0x7c6ffdc5, 0xf9c50824, 0x2824546f,
+0xe4efd9c5, 0x000003b8, 0x45e3c400, 0xc401d238,
+0xfb397de3, 0x6ffdc501, 0xc428247c, 0xdb3845e3,
+0x6de2c400, 0xe3c4d306, 0x01dc386d, 0x397de3c4,
+0xf9c501d2, 0xe2c4d26f, 0xffd20265, 0xc5e775c8,
+0x31dbefe1, 0x76edc5c0, 0x7de2c4d3, 0x920fd117,
+0x01f883c0, 0x0125c019, 0xc9000004, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002540,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bac0, 0xba410000, 0x00000008,
+0x48e58948, 0x48e0e483, 0x00a8ec81, 0x8d480000,
+0x89282474, 0x01788dc1, 0x45d08945, 0xe183c931,
+0xc0294101, 0x08847c89, 0xc785c9ff, 0x86048944,
+0xc1940f41, 0x48844c89, 0x89ca2944, 0x48688454,
+0x8348c0ff, 0xcb7508f8, 0x7c6ffdc5, 0xfdc50824,
+0xa8247c7f, 0x5c6ffdc5, 0xf5c5a824, 0x60b8c976,
+0xc5000002, 0xc4d776e5, 0xd1177de2, 0x049d830f,
+0xe5c50000, 0x082454fe, 0x547ffdc5, 0xfdc5c824,
+0x08247c6f, 0x000266b8, 0x72edc500, 0xedc501f7,
+0xc8245476, 0x177de2c4, 0x70830fd1, 0xc5000004,
+0x24746ffd, 0xfacdc5c8, 0xc5082454, 0x24547ffd,
+0x76e5c5e8, 0xb8e82464, 0x0000026b, 0x177de2c4,
+0x48830fe1, 0xc5000004, 0x245cebe5, 0x7ffdc528,
+0xc5a8245c, 0x2454dbed, 0x6ffdc528, 0xc5e8247c,
+0x245cefc5, 0x7ffdc528, 0xc5e8245c, 0x2454dfed,
+0x76ddc5a8, 0x0277b8e4, 0xedc50000, 0xe2c4d376,
+0x0fd1177d, 0x00040683, 0x6ffdc500, 0xc408245c,
+0x544065e2, 0xedc52824, 0x04121576, 0x44c70000,
+0x0002a424, 0xd3b80000, 0xc4000002, 0xd1177de2,
+0x03d9830f, 0xe5c50000, 0x482454ef, 0x547ffdc5,
+0xedc5a824, 0x282454f4, 0x547ffdc5, 0xc031c824,
+0x24448d4c, 0x4c8d48a8, 0x8b42ec24, 0x3c8b0014,
+0xaf0f4806, 0x045489d7, 0xeac148e8, 0x01148920,
+0x08c08348, 0x20f88348, 0xfdc5e075, 0xc824746f,
+0x0002ecb8, 0x76cdc500, 0xc4e82454, 0xd1177de2,
+0x0379830f, 0xfdc50000, 0xe8245c7f, 0x7c6ffdc5,
+0xd5c5e824, 0xc503f772, 0x246c7ffd, 0x6ffdc5a8,
+0xc5e82474, 0x02f672ed, 0x547ffdc5, 0xedc5c824,
+0xf8b8d2fe, 0xc5000002, 0xc4d576ed, 0xd1177de2,
+0x0339830f, 0xfdc50000, 0xa8247c6f, 0xd772edc5,
+0xfeedc502, 0x02fdb8d2, 0xedc50000, 0xc8245476,
+0x177de2c4, 0x14830fd1, 0xc7000003, 0x03a42444,
+0xc5000000, 0x24546ef9, 0xf2e5c5a4, 0x2444c7d2,
+0x000002a4, 0x6ef9c500, 0xc5a4246c, 0xc5edf2e5,
+0x246c7ffd, 0xfed5c5c8, 0x0310b8ed, 0xd5c50000,
+0xe2c4ea76, 0x0fe9177d, 0x0002d283, 0x6ef9c500,
+0xc5a4246c, 0xc5d5d2ed, 0xb8d2feed, 0x00000314,
+0x5476edc5, 0xe2c4c824, 0x0fd1177d, 0x0002ae83,
+0xefd1c500, 0x76d5c5ed, 0xc5682454, 0xc5d576ed,
+0x2454dbed, 0x7ffdc508, 0xc4e82454, 0x7c476de2,
+0xddc56824, 0x68246cfe, 0x6c7ffdc5, 0xe2c46824,
+0x246c476d, 0x032cb868, 0xd5c50000, 0xcdc5f5fe,
+0xe2c4f776, 0x0ff1177d, 0x00026283, 0x55e2c400,
+0x68246c45, 0x000331b8, 0x76edc500, 0x7de2c4d5,
+0x830fd117, 0x00000247, 0x3b65e2c4, 0xc5282454,
+0x24547ffd, 0x65e2c4a8, 0x28246c3f, 0x6c7ffdc5,
+0xe5c5c824, 0x28245cfe, 0xd5feedc5, 0x00033fb8,
+0x76edc500, 0x7de2c4d3, 0x830fd117, 0x0000020f,
+0x000001b8, 0x6ffdc500, 0xc548245c, 0xb8d06ef9,
+0x00000354, 0x587de2c4, 0x6de2c4d2, 0xedc5d30a,
+0xe2c4d376, 0x0fd1177d, 0x0001e283, 0x0001b800,
+0xfdc50000, 0x28246c6f, 0x746ffdc5, 0xf9c50824,
+0x59b8d06e, 0xc4000003, 0xd2587de2, 0xd2fad5c5,
+0x366de2c4, 0x76edc5d6, 0x7de2c4d5, 0x830fd117,
+0x000001ab, 0xd6fed5c5, 0x000362b8, 0x2484c700,
+0x00000088, 0x00000009, 0x587de2c4, 0x008824bc,
+0xedc50000, 0xe2c4d776, 0x0fd1177d, 0x00017e83,
+0xc5c03100, 0xa8d56ffd, 0xc5047501, 0xc5d66ffd,
+0x24947ffd, 0x00000088, 0x8884948b, 0x89000000,
+0x48c88454, 0x8348c0ff, 0xd77508f8, 0x8c65e2c4,
+0xc5082454, 0xc5dcefe5, 0x24547ffd, 0x03c4b8e8,
+0xe2c40000, 0x246c8e65, 0x6ffdc5e8, 0xc5e82464,
+0x245476dd, 0x7de2c4c8, 0x830fd117, 0x0000011f,
+0x5c6ffdc5, 0xd4b80824, 0xc4000003, 0x540265e3,
+0xc5aa2824, 0x245476ed, 0x7de2c4c8, 0x830fd117,
+0x000000fb, 0x4665e3c4, 0x07b801d3, 0xc4000000,
+0xe30f6de3, 0x6ef9c504, 0x0001b8d0, 0xf9c50000,
+0xe2c4e86e, 0xb8d2587d, 0x000003e4, 0xd2dbe5c5,
+0x587de2c4, 0xfeedc5ed, 0x76ddc5d5, 0x7de2c4d2,
+0x830fd117, 0x000000b7, 0x5c7ffdc5, 0xd9c5a824,
+0x03b8e4ef, 0xc5000000, 0xc5edefd1, 0x24546ff9,
+0x6ffdc5a8, 0xc4a82474, 0xd23855e3, 0x4de3c401,
+0xc400dc38, 0xd3026de2, 0x547ffdc5, 0xc8ffa824,
+0xe3c4d975, 0x01d2397d, 0x0003f8b8, 0x79e3c400,
+0x8303d216, 0x677524fa, 0x646ffdc5, 0xf9c50824,
+0x2824546f, 0x000003b8, 0x5de3c400, 0xc401d238,
+0xe3397de3, 0x6ffdc501, 0xc4282464, 0xdb385de3,
+0xefd9c500, 0x6de2c4e4, 0xe3c4d306, 0x01dc386d,
+0x397de3c4, 0xf9c501d2, 0xe2c4d26f, 0xffd20265,
+0xc5e775c8, 0x31dbefe1, 0x76edc5c0, 0x7de2c4d3,
+0x920fd117, 0x01f883c0, 0x0125c019, 0xc9000004,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002540,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0x4801fa83, 0xe283d219,
+0xcaff4802, 0x0f40c685, 0x8948c694, 0x4040c454,
+0x29f6b60f, 0x48ce89f1, 0x60c47489, 0x48c0ff48,
+0x7505f883, 0x6ffdc5bc, 0xc508247c, 0x247c7ffd,
+0x6ffdc5a8, 0xc5a8245c, 0xb8c976f5, 0x00000260,
+0x2965e2c4, 0x7de2c4d7, 0x830fd117, 0x00000480,
+0x54d4e5c5, 0xfdc50824, 0xc824547f, 0x7c6ffdc5,
+0x66b80824, 0xc5000002, 0x01f773ed, 0x296de2c4,
+0xc4c82454, 0xd1177de2, 0x0452830f, 0xfdc50000,
+0xc8247c6f, 0x54fbc5c5, 0xfdc50824, 0xe824547f,
+0x2965e2c4, 0xb8e82454, 0x0000026b, 0x177de2c4,
+0x29830fd1, 0xc5000004, 0x24746ffd, 0xf4e5c508,
+0xc5082464, 0x20d373ed, 0x54f4edc5, 0xd5c50824,
+0xc520d673, 0xc5dbf4d5, 0xc5d3d4ed, 0x245c6ffd,
+0x73edc528, 0xddc520f2, 0xedc5e2d4, 0xc520d373,
+0xc5d3f4ed, 0xc5f3f4e5, 0xc5d2d4ed, 0x20f273ed,
+0xf2d4cdc5, 0x5c6ffdc5, 0x65c50824, 0x28244cd4,
+0x44fb65c5, 0xc1c42824, 0x20d17345, 0x000282b8,
+0x6dc1c400, 0xc420d073, 0xf8f445c1, 0xf46dc1c4,
+0x3dc1c4d1, 0xedc5e9f4, 0xedc5d7d4, 0xc520f273,
+0xc5ead4d5, 0xc4d6fbdd, 0xd5296de2, 0x177de2c4,
+0x89830fd1, 0xc5000003, 0x247c6ffd, 0x73d5c528,
+0xd5c520d3, 0x282454f4, 0x64f4e5c5, 0xcdc52824,
+0xc520d773, 0xc5f3f4cd, 0xc5d6d4ed, 0x20f273ed,
+0xd2d4ddc5, 0x296de2c4, 0x00036315, 0x02d3b800,
+0xe2c40000, 0x0fd1177d, 0x00034383, 0x6ffdc500,
+0xc5482464, 0x20d473c5, 0xd4f4d5c5, 0xfbf4c5c5,
+0xf4f4e5c5, 0xd7d4edc5, 0xf273edc5, 0xd4cdc520,
+0x7ffdc5d2, 0xc5e82454, 0x245c6ffd, 0x73e5c5e8,
+0xfdc503f3, 0xa8245c7f, 0x546ffdc5, 0xedc5e824,
+0xc502f273, 0x24547ffd, 0xd4edc5c8, 0xf4d5c5d2,
+0x02f8b8ec, 0xe2c40000, 0xc4d3296d, 0xd1177de2,
+0x02da830f, 0xfdc50000, 0xa8245c6f, 0xd373edc5,
+0x6ffdc502, 0xc5a8245c, 0x02e372e5, 0x026de3c4,
+0xedc5aad3, 0xfdb8d2d4, 0xc4000002, 0x54296de2,
+0xe2c4c824, 0x0fd1177d, 0x0002a383, 0xd4d5c500,
+0x2444c7df, 0x0000038c, 0x73e5c500, 0xcdc520f3,
+0x6348dbd4, 0xc48c2444, 0xd06ef9e1, 0xd2f3e5c5,
+0x8c2444c7, 0x00000002, 0x24446348, 0xf961c48c,
+0xc1c4d06e, 0xc5daf365, 0x245c7ffd, 0xd4e5c5c8,
+0x0310b8db, 0xe2c40000, 0xc4da2965, 0xd9177de2,
+0x024a830f, 0x63480000, 0xc48c2454, 0xc0ef3941,
+0x000040b8, 0x3de2c400, 0x2948da37, 0xf961c4d0,
+0x61c4da6e, 0xc4e06ef9, 0xd3d36dc1, 0xf365c1c4,
+0xebedc5dc, 0xd4edc5d3, 0x0314b8d2, 0xe2c40000,
+0x2454296d, 0x7de2c4c8, 0x830fd117, 0x00000200,
+0xefd4d5c5, 0x7c6ffdc5, 0xd5c56824, 0xc420f573,
+0xd03745c2, 0xf5d4cdc5, 0xd6dbedc5, 0x547ffdc5,
+0xe2c4e824, 0x246c47ed, 0x0001b868, 0xe1c40000,
+0xc4f06ef9, 0xde597de2, 0x746ffdc5, 0xcdc56824,
+0xfdc5dbfb, 0x68245c7f, 0x47ede2c4, 0xb8682454,
+0x0000032c, 0x547ffdc5, 0xedc5c824, 0xe2c4d2d4,
+0xc4d5296d, 0xd1177de2, 0x0192830f, 0x01b80000,
+0xc5000000, 0x247c6ffd, 0xc5e2c4c8, 0x68245445,
+0x3fe0c148, 0x6ef9e1c4, 0x0331b8f0, 0xe2c40000,
+0xc4de597d, 0x5c45e5e2, 0xedc56824, 0xedc5d3ef,
+0xe2c4d3fb, 0x2454296d, 0x7de2c4e8, 0x830fd117,
+0x0000014c, 0x00fde3c4, 0x1b08245c, 0x546ffdc5,
+0x59b82824, 0xc4000003, 0xdb296de2, 0x177de2c4,
+0x29830fd9, 0xc5000001, 0x245c6ffd, 0x035eb808,
+0xe3c40000, 0xb1eb00fd, 0x4655e3c4, 0xe2c401ed,
+0xc4ed296d, 0xe9177de2, 0x0102830f, 0xc7480000,
+0x05902444, 0xb8000000, 0x00000362, 0x5979e2c4,
+0xc590246c, 0x246c7ff9, 0xd4e5c598, 0x7de2c4ea,
+0x9824745a, 0x2955e2c4, 0x7de2c4ee, 0x830fe917,
+0x000000cc, 0x375dc2c4, 0xd6f9c5e0, 0xc4c8245c,
+0xdb397de3, 0xdde2c401, 0x08246c8c, 0x5cd6f9c5,
+0xe3c4d824, 0x01d3397d, 0x0003c4b8, 0xf9e3c400,
+0xd0245416, 0x7ffdc501, 0xc4e8246c, 0x5c16f9e3,
+0xc401e024, 0xd84c75c3, 0xe5e2c440, 0xe824548e,
+0x646ffdc5, 0xe2c4e824, 0x2454295d, 0x7de2c4c8,
+0x6c73d117, 0x546ffdc5, 0xd4b80824, 0xc4000003,
+0x5c026de3, 0xc4cc2824, 0x5c2965e2, 0xe2c4c824,
+0x73d9177d, 0x0003b84b, 0xe3c40000, 0x01da466d,
+0x6ef9e1c4, 0x65e3c4e0, 0xb808da0f, 0x00000001,
+0x597de2c4, 0xf9e1c4e4, 0xc031f86e, 0xd4dbedc5,
+0x597de2c4, 0xd4edc5e7, 0x6de2c4d4, 0xe2c4d329,
+0x0fd1177d, 0xf883c092, 0x25c01901, 0x000003e4,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0002500,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0xc685caff, 0xc6940f40,
+0x40d26348, 0x48f6b60f, 0x40c45489, 0xce89f129,
+0xc4748948, 0xc0ff4860, 0x05f88348, 0xfdc5c375,
+0x0824746f, 0x747ffdc5, 0xfdc5a824, 0xa8245c6f,
+0xc976f5c5, 0x000260b8, 0x65e2c400, 0xe2c4d629,
+0x0fd1177d, 0x00036683, 0xd4e5c500, 0xc5082454,
+0x24547ffd, 0x6ffdc5c8, 0xb808247c, 0x00000266,
+0xf773edc5, 0x6de2c401, 0xc8245429, 0x177de2c4,
+0x38830fd1, 0xc5000003, 0x24746ffd, 0xfbcdc5c8,
+0xc5082454, 0x24547ffd, 0x65e2c4e8, 0xe8246429,
+0x00026bb8, 0x7de2c400, 0x830fe117, 0x0000030f,
+0x5cebe5c5, 0xfdc52824, 0xa8245c7f, 0x54dbedc5,
+0xfdc52824, 0xe8247c6f, 0x5cefc5c5, 0xedc52824,
+0xedc5d1ef, 0xa82454db, 0x000277b8, 0x6de2c400,
+0xe2c4d329, 0x0fd1177d, 0x0002d283, 0x6ffdc500,
+0xc5282474, 0x24546ffd, 0xf4edc508, 0xc5282464,
+0x20d673d5, 0xd273e5c5, 0xf4e5c520, 0xc528245c,
+0xc5eaf4d5, 0xc5ddd4e5, 0x20f373e5, 0xdbd4ddc5,
+0x2965e2c4, 0x0002a71d, 0x02d3b800, 0xe2c40000,
+0x0fd9177d, 0x00028683, 0x7ffdc500, 0xc5e82454,
+0x247c6ffd, 0x73ddc5e8, 0xfdc503f7, 0xa824647f,
+0x6c6ffdc5, 0xe5c5e824, 0xc502f573, 0x245c7ffd,
+0xd4e5c5c8, 0x02f8b8db, 0xe2c40000, 0xc4dc2965,
+0xd9177de2, 0x0245830f, 0xfdc50000, 0xa824746f,
+0xd673e5c5, 0xd4e5c502, 0x02fdb8db, 0xe2c40000,
+0x245c2965, 0x7de2c4c8, 0x830fd917, 0x0000021f,
+0x9c2444c7, 0x00000003, 0x5c6ef9c5, 0xedc59c24,
+0x44c7dbf3, 0x00029c24, 0xf9c50000, 0x9c24646e,
+0xd4f3edc5, 0x547ffdc5, 0xedc5c824, 0x10b8d2d4,
+0xc4000003, 0xd3296de2, 0x177de2c4, 0xdc830fd1,
+0xc5000001, 0x24546ef9, 0xd3e5c59c, 0xd4edc5d2,
+0x0314b8d2, 0xe2c40000, 0x2454296d, 0x7de2c4c8,
+0x830fd117, 0x000001b7, 0xdbefe1c5, 0x2965e2c4,
+0xc4682454, 0xd3296de2, 0x54dbedc5, 0xfdc50824,
+0xe824547f, 0x47ede2c4, 0xc568245c, 0x2464d4f5,
+0x7ffdc568, 0xc4682464, 0x5447ede2, 0x2cb86824,
+0xc5000003, 0x24547ffd, 0xd4edc5c8, 0x6de2c4d2,
+0xe2c4d329, 0x0fd1177d, 0x00016283, 0x6ffdc500,
+0xc4c8247c, 0x5445c5e2, 0x31b86824, 0xc4000003,
+0x54296de2, 0xe2c4e824, 0x0fd1177d, 0x00013e83,
+0xfde3c400, 0x08245c00, 0x6ffdc51b, 0xb8282454,
+0x00000359, 0x296de2c4, 0x7de2c4db, 0x830fd917,
+0x0000011b, 0x5c6ffdc5, 0x5eb80824, 0xc4000003,
+0xe300fde3, 0x5de3c4b1, 0xc401e446, 0xe2295de2,
+0x177de2c4, 0xf4830fe1, 0xc5000000, 0xb8e2d4e5,
+0x00000362, 0x2444c748, 0x000005a0, 0x7de2c400,
+0xa0246c59, 0x295de2c4, 0x7de2c4e5, 0x830fe117,
+0x000000cb, 0x6c6ffdc5, 0xf9c54824, 0xc8245cd6,
+0x397de3c4, 0xe3c401db, 0x245416f9, 0xf9c501d0,
+0xd8245cd6, 0x397de3c4, 0xc4b801d3, 0xc4000003,
+0x5c16f9e3, 0xc401e024, 0x5c8cd5e2, 0xfdc50824,
+0xe8245c7f, 0xddeff5c5, 0x8ee5e2c4, 0xc5e82454,
+0x24746ffd, 0x4de2c4e8, 0xc8245429, 0x177de2c4,
+0xc56c73d1, 0x24546ffd, 0x03d4b808, 0xe3c40000,
+0x245c026d, 0xe2c4cc28, 0x245c2965, 0x7de2c4c8,
+0x4b73d917, 0x000003b8, 0x6de3c400, 0xc401da46,
+0xf86ef9e1, 0x0f65e3c4, 0x01b808da, 0xc4000000,
+0xe7597de2, 0x6ef9e1c4, 0xc5c031e8, 0xc4d4dbed,
+0xe5597de2, 0xd4d4edc5, 0x296de2c4, 0x7de2c4d3,
+0x920fd117, 0x01f883c0, 0xe425c019, 0xc9000003,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0002040,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8348e0, 0x01488d68, 0xc92af2c5, 0xc129d189,
+0x4c11fac5, 0xf2c5e884, 0xfac5c92a, 0x08844c11,
+0x0d10fac5, 0x00000528, 0x087501a8, 0x0d10fac5,
+0x0000053c, 0x4c11fac5, 0xff482884, 0xf88348c0,
+0xc5c27508, 0x247c28fc, 0x29fcc5e8, 0xc588247c,
+0x244c28fc, 0x76e5c588, 0x0260b8db, 0xf4c50000,
+0xc400d7c2, 0xd3177de2, 0x04d2830f, 0xf4c50000,
+0xe8245458, 0x5429fcc5, 0xfcc5a824, 0xe8247c28,
+0x000266b8, 0x58c4c500, 0xc2ecc5d7, 0x00a82454,
+0x177de2c4, 0xa5830fd3, 0xc5000004, 0x247c28fc,
+0x5cc4c5a8, 0xc5e82454, 0x245429fc, 0xc2f4c5c8,
+0x00c82454, 0x00026bb8, 0x7de2c400, 0x830fd317,
+0x0000047c, 0x7c28fcc5, 0xf4c50824, 0xe8244c59,
+0xe759c4c5, 0x5428fcc5, 0xecc5e824, 0xecc5f758,
+0x08246c5c, 0xcc5cf4c5, 0x000282b8, 0x59d4c500,
+0xc2f4c5ee, 0xe2c400cd, 0x0fcb177d, 0x00043f83,
+0x59ecc500, 0xc528244c, 0x244c29fc, 0x5eecc588,
+0xc5282454, 0x00cac2f4, 0x00028bb8, 0x7de2c400,
+0x830fcb17, 0x00000418, 0x187de2c4, 0x00042315,
+0x28fcc500, 0xb8282464, 0x0000028e, 0xca57dcc5,
+0x5457ecc5, 0xf4c5e824, 0x88244c59, 0xcac2f4c5,
+0x7de2c400, 0x830fcb17, 0x000003e4, 0x4c53fcc5,
+0xfcc5e824, 0x88244c29, 0x4c53fcc5, 0xfcc58824,
+0xe8245428, 0x000296b8, 0x5bfdc500, 0x5bfcc5c9,
+0xc2f4c5c9, 0xe2c400ca, 0x0fcb177d, 0x0003af83,
+0x59ecc500, 0x29fcc5ca, 0xc588244c, 0x244c52fc,
+0x29fcc588, 0xc5a8244c, 0x244c28fc, 0x029db8a8,
+0xfcc50000, 0xfdc5e953, 0xfcc5ed5b, 0xecc5ed5b,
+0xc400d5c2, 0xd3177de2, 0x0372830f, 0xfcc50000,
+0xe8245428, 0xc95bfdc5, 0xc95bfcc5, 0x00029fb8,
+0x53fcc500, 0x5bfdc5ea, 0x5bfcc5ed, 0xc2f4c5ed,
+0xe2c400cd, 0x0fcb177d, 0x00034383, 0x59ecc500,
+0x29fcc5ca, 0xc588244c, 0x244c51fc, 0x02a7b888,
+0xf4c50000, 0xc400cac2, 0xcb177de2, 0x031e830f,
+0xe2c40000, 0x452d187d, 0xc5000003, 0xc5ca5ed4,
+0x244c29fc, 0x7de3c488, 0x88244c08, 0x02afb80b,
+0xf4c50000, 0x03250dc2, 0xc4000000, 0xcb177de2,
+0x02ea830f, 0xdcc50000, 0x08244c59, 0xf259dcc5,
+0x4c29fcc5, 0xccc5a824, 0xa8244c5f, 0x4c29fcc5,
+0xccc5c824, 0xa824745d, 0x7429fcc5, 0xf4c5a824,
+0xa8244c58, 0x5458ecc5, 0x48b80824, 0xc5000003,
+0xc5cc59f4, 0x00cac2f4, 0x177de2c4, 0x9d830fcb,
+0xc4000002, 0x4c047de3, 0xc51be824, 0x245428fc,
+0x0359b808, 0xe3c40000, 0x01c90675, 0xc9c2ecc5,
+0x7de2c400, 0x830fcb17, 0x00000274, 0x000001b8,
+0x28fcc500, 0xc5e82474, 0xc5ca5bfd, 0xb8f86ef9,
+0x0000035e, 0x587de2c4, 0xfaf5c5ff, 0x75e2c4cf,
+0xecc5ce16, 0xc400c9c2, 0xcb177de2, 0x023e830f,
+0xecc50000, 0xfac5f658, 0x02c20d10, 0x62b80000,
+0xc4000003, 0xc9187de2, 0xf1c2ccc5, 0x7de2c400,
+0x830ff317, 0x00000218, 0x4c12fec5, 0xe2c4e824,
+0x1935187d, 0xc5000002, 0x244c5cf4, 0x03b1b8e8,
+0xe2c40000, 0x0d3d187d, 0xc5000002, 0xc5f458cc,
+0xc5f759cc, 0x00cec2f4, 0x177de2c4, 0xdd830fcb,
+0xc5000001, 0x247416fe, 0x29fcc5e8, 0xc5882474,
+0xc5ed58dc, 0x244c28fc, 0x03b8b8e8, 0xccc50000,
+0xd4c5f15c, 0xccc5ef59, 0xc400f5c2, 0xf3177de2,
+0x01aa830f, 0xc0310000, 0xea28fcc5, 0x047501a8,
+0xe928fcc5, 0x6c29fcc5, 0xfac54824, 0x48846c10,
+0x6c11fac5, 0xff48a884, 0xf88348c0, 0xc5d97508,
+0xb8ed57d0, 0x000003c4, 0xe4c2d4c5, 0x28fcc501,
+0xc4a8246c, 0xc94a6de3, 0xc2d4c540, 0xe2c400c9,
+0x0fcb177d, 0x00015783, 0x5de2c400, 0xe8244c2c,
+0xf6efc9c5, 0x4c29fcc5, 0xf5c5c824, 0xe3c4c976,
+0x40ce4c75, 0x0003cdb8, 0x75e2c400, 0xc824542e,
+0x7c28fcc5, 0xc4c5c824, 0xc400cdc2, 0xcb177de2,
+0x011a830f, 0xfcc50000, 0xe8247c28, 0x0003d4b8,
+0x45e3c400, 0x08244c0c, 0xc2d4c5aa, 0xe2c400e9,
+0x0feb177d, 0x0000f783, 0x28fcc500, 0xc5e8247c,
+0x244cd0c7, 0x28fcc508, 0xc5e8247c, 0x2454d0c7,
+0x03ddb808, 0xf4c50000, 0xc400cac2, 0xcb177de2,
+0x00ca830f, 0xfcc50000, 0xe8246428, 0x405de3c4,
+0xf1082454, 0x0003ecb8, 0x28f8c500, 0x7de3c4ca,
+0xc501d219, 0xc4ca58f2, 0xc92171e3, 0xc2f4c50e,
+0x0000ea0d, 0xe2c40000, 0x0fcb177d, 0x00008f83,
+0x29fcc500, 0xb8882464, 0x00000003, 0xd257e8c5,
+0x256ffdc5, 0x000000e8, 0x4c7cefc5, 0xe2c48824,
+0xc5c9165d, 0x244c29fc, 0x75c8ff88, 0x7de3c4eb,
+0xc501c919, 0xffc9c6f0, 0x0d2ef8c5, 0x0000006c,
+0x4775497a, 0x7c28fcc5, 0xc7c5e824, 0x08244c7d,
+0xe2c4c031, 0xc5c9165d, 0xc4ca7cf7, 0xc9165de2,
+0xca7cf7c5, 0x165de2c4, 0x7cf7c5c9, 0x5de2c4ca,
+0xf4c5c916, 0xc400cac2, 0xcb177de2, 0x83c0920f,
+0xc01901f8, 0x00040125, 0xb805eb00, 0x000003f8,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x3f000000, 0x42100000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0x41100000, 0x00000000, 0x00000000, 0x00000000,
+0002760,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x056a0d10, 0xfbc50000, 0x05221d10, 0xfbc50000,
+0x05222510, 0xfbc50000, 0x05222d10, 0xfbc50000,
+0x05221510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0xd276edc5, 0x000260b8, 0xc2f5c500, 0xe2c400df,
+0x0fda177d, 0x00049183, 0x58f5c500, 0xc508245c,
+0x245c29fd, 0x28fdc5c8, 0xb808247c, 0x00000266,
+0xdf58c5c5, 0x5cc2e5c5, 0xc400c824, 0xda177de2,
+0x0464830f, 0xfdc50000, 0xc8247c28, 0x5c5cc5c5,
+0xfdc50824, 0xe8245c29, 0x5cc2f5c5, 0xb800e824,
+0x0000026b, 0x177de2c4, 0x3b830fda, 0xc5000004,
+0x247428fd, 0x59f5c528, 0xc508244c, 0xc5e659cd,
+0x245c28fd, 0x58e5c508, 0x5ce5c5f6, 0xc528246c,
+0xb8cc5cf5, 0x00000282, 0xee59d5c5, 0xcdc2f5c5,
+0x7de2c400, 0x830fca17, 0x000003fe, 0x4c59e5c5,
+0xfdc54824, 0xa8244c29, 0x5c5ee5c5, 0xf5c54824,
+0xb800cbc2, 0x0000028b, 0x177de2c4, 0xd7830fca,
+0xc4000003, 0x25197de2, 0x000003f4, 0x5c28fdc5,
+0x8eb84824, 0xc5000002, 0xc5cc57e5, 0x246457dd,
+0x59f5c508, 0xc5a8244c, 0x00ccc2f5, 0x177de2c4,
+0xa3830fca, 0xc5000003, 0x244c5afd, 0x75e3c408,
+0xc501c918, 0xc5c953fc, 0xc5c95afc, 0x244c29fd,
+0x5afdc5a8, 0xc5a8244c, 0x244c29f8, 0x75e3c498,
+0xc501c918, 0x246c28fd, 0x53fcc508, 0x0296b8c9,
+0xfcc50000, 0xffc5c95a, 0xfec5c9e6, 0xf5c5c9e6,
+0xc400cdc2, 0xca177de2, 0x034c830f, 0xd5c50000,
+0xfdc5cd59, 0xa8244c29, 0x4c5afdc5, 0xe3c4a824,
+0x01c91875, 0xc952fcc5, 0xc95afcc5, 0x4c29fdc5,
+0xfdc5c824, 0xc8246428, 0x00029db8, 0x5afdc500,
+0x29f8c5cc, 0xc498244c, 0xc91875e3, 0x53fcc501,
+0x5afcc5c9, 0xe6ffc5c9, 0xe6fec5c9, 0xc2d5c5c9,
+0xe2c400e9, 0x0fea177d, 0x0002ed83, 0xe6ffc500,
+0xe6fec5e4, 0x28fdc5ec, 0xb8082464, 0x0000029f,
+0xcc5afdc5, 0x4c29f8c5, 0xe3c49824, 0x01c91875,
+0xc953fcc5, 0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5,
+0xc9c2d5c5, 0x7de2c400, 0x830fca17, 0x000002aa,
+0xcc59ddc5, 0x4c29fdc5, 0xfdc5a824, 0xa8244c51,
+0x0002a7b8, 0xc2f5c500, 0xe2c400cc, 0x0fca177d,
+0x00028583, 0x7de2c400, 0x02c20d19, 0xf5c50000,
+0xfdc5cc5e, 0xa8244c29, 0x097de3c4, 0x0ba8244c,
+0x0002afb8, 0xc2f5c500, 0x0002a20d, 0xe2c40000,
+0x0fca177d, 0x00025183, 0x59e5c500, 0xc528244c,
+0xc5ec59e5, 0x244c29fd, 0x5fd5c5c8, 0xc5c8244c,
+0x246c5dd5, 0x29fdc5c8, 0xc5c8246c, 0x244c58f5,
+0x58ddc5c8, 0xb8282464, 0x00000348, 0xcb59f5c5,
+0xccc2f5c5, 0x7de2c400, 0x830fca17, 0x0000020a,
+0x057de3c4, 0x0508244c, 0x6428fdc5, 0x59b82824,
+0xc4000003, 0xc90675e3, 0xc2ddc501, 0xe2c400c9,
+0x0fca177d, 0x0001e183, 0x28fdc500, 0xb808244c,
+0x0000035e, 0x01fde3c4, 0xd5c51be9, 0xc400ecc2,
+0xea177de2, 0x01c0830f, 0xf5c50000, 0xfac5cc58,
+0x021a2d7e, 0x62b80000, 0xc4000003, 0xed197de2,
+0xcdc2f5c5, 0x7de2c400, 0x830fca17, 0x0000019a,
+0x6c12ffc5, 0xe2c40824, 0xa935197d, 0xc5000001,
+0x244c28fd, 0x03b1b808, 0xe2c40000, 0xa53d197d,
+0xc5000001, 0xc5f658e5, 0xc5e95cd5, 0xc5f759cd,
+0x00eec2d5, 0x177de2c4, 0x5b830fea, 0xc4000001,
+0xcd197de3, 0x13f9c501, 0xb8c8244c, 0x000003c4,
+0x6c13f9c5, 0xe3c4d824, 0x01e5197d, 0x6c17f9c5,
+0xd1c5e024, 0xd5c5ed57, 0xc501dbc2, 0x246417f9,
+0x28fdc5d0, 0xc4c8246c, 0xc94b5de3, 0xc2d5c530,
+0xe2c400c9, 0x0fca177d, 0x00010d83, 0x65e2c400,
+0x08244c2d, 0x4c29fdc5, 0xf1c5e824, 0xcdb8c9ef,
+0xc4000003, 0xc94c6de3, 0x75e2c430, 0xe824642f,
+0x7c28fdc5, 0xc5c5e824, 0xc400cdc2, 0xca177de2,
+0x00d4830f, 0xfdc50000, 0x08247428, 0x0003d4b8,
+0x4de3c400, 0x28244c0d, 0xc2d5c50a, 0xe2c400e9,
+0x0fea177d, 0x0000b183, 0x28fdc500, 0xc508247c,
+0x244cd0c5, 0x28fdc528, 0xc508245c, 0x2464d0e5,
+0x03ddb828, 0xf5c50000, 0xc400ccc2, 0xca177de2,
+0x0084830f, 0xfdc50000, 0xa8245c29, 0xdb57e1c5,
+0x4c7ce5c5, 0xe3c4a824, 0xd8c901fd, 0x4c29fdc5,
+0xe5c5a824, 0xa8244c7c, 0x01fde3c4, 0xe3c4d8c9,
+0x01c9197d, 0xc915f1c5, 0x0d2ef9c5, 0x00000080,
+0x4175437a, 0x7428fdc5, 0xcdc50824, 0x28244c7d,
+0xe3c4c031, 0xd8c901fd, 0xcb7cf5c5, 0x01fde3c4,
+0xf5c5d8c9, 0xe3c4cb7c, 0xd8c901fd, 0xcbc2f5c5,
+0x7de2c400, 0x920fca17, 0x01f883c0, 0x0125c019,
+0xeb000004, 0x03f8b805, 0xc3c90000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40240000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40140000, 0x00000000, 0x00000000,
+0002660,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8348e589, 0x8148e0e4,
+0x0000e0ec, 0x10fac500, 0x0003a30d, 0x11fac500,
+0xc52c244c, 0x244c11fa, 0x11fac530, 0x8b34244c,
+0x892c2444, 0x31202444, 0x10fac5ff, 0xc5202454,
+0x24542ef8, 0x0000b92c, 0x0f400000, 0x450fc79b,
+0xe8dff7f9, 0xffffff8a, 0x60b8c289, 0x84000002,
+0x51840fd2, 0xc5000003, 0x245410fa, 0x58eac520,
+0xc52c2454, 0x245411fa, 0x10fac524, 0x312c2454,
+0x58eac5ff, 0x2ef8c5d2, 0x40242454, 0x0fc79b0f,
+0xdff7f945, 0xffff49e8, 0xb8c289ff, 0x00000266,
+0x840fd284, 0x00000310, 0x5410fac5, 0xeac52424,
+0x2c24545c, 0x1411fac5, 0x24048b24, 0x5c244489,
+0x24244489, 0x28244489, 0xfac5ff31, 0x20245410,
+0x542ef8c5, 0x0f402824, 0x450fc79b, 0xe8dff7f9,
+0xfffffefe, 0x6bb8c289, 0x84000002, 0xc5840fd2,
+0xc5000002, 0x245410fa, 0x59eac520, 0xc52c2454,
+0x245411fa, 0x10fac520, 0xc5302454, 0xc5d259ea,
+0x245411fa, 0x10fac524, 0xc52c2454, 0x245458ea,
+0x11fac530, 0xc5282454, 0x245410fa, 0x5ceac52c,
+0x3130245c, 0x59e2c5ff, 0xc528245c, 0x246410fa,
+0x5cdac520, 0xc5242464, 0xc5e32ef8, 0x245c11fa,
+0x9b0f4028, 0xf9450fc7, 0x83e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x024a840f, 0xeac50000,
+0x34245459, 0x5411fac5, 0xff312024, 0x5410fac5,
+0xeac52c24, 0x3424545e, 0x542ef8c5, 0xfac52024,
+0x24245411, 0xc79b0f40, 0xf7f9450f, 0xfe40e8df,
+0xc289ffff, 0x00028bb8, 0x0fd28400, 0x00020784,
+0x10fac500, 0xc5342454, 0x112510fa, 0xc5000002,
+0x245c10fa, 0xc5ff312c, 0xc5d457e8, 0xc5dc57e0,
+0x245459ea, 0x2ef8c520, 0x9b0f40d3, 0xf9450fc7,
+0xfbe8dff7, 0x89fffffd, 0x028eb8c2, 0xd2840000,
+0x01c2840f, 0x0ff30000, 0x2c245453, 0x5411fac5,
+0x0ff32024, 0x20245c53, 0xc32cfac5, 0x5410fac5,
+0xff312c24, 0xd82ae2c5, 0xda2ef8c5, 0xc79b0f40,
+0xf7f9450f, 0xfdb8e8df, 0xc289ffff, 0x000296b8,
+0x0fd28400, 0x00017f84, 0x59eac500, 0x11fac5d2,
+0xf3202454, 0x2454520f, 0x11fac520, 0xf3242454,
+0x2454530f, 0x2cfac524, 0xc5ff31c2, 0xc5d02aea,
+0x24542ef8, 0x9b0f402c, 0xf9450fc7, 0x6fe8dff7,
+0x89fffffd, 0x029db8c2, 0xd2840000, 0x0136840f,
+0xfac50000, 0x2424442c, 0x0ff3ff31, 0x2c245453,
+0xd82ae2c5, 0xc22cfac5, 0xd02aeac5, 0xda2ef8c5,
+0xc79b0f40, 0xf7f9450f, 0xfd34e8df, 0xc289ffff,
+0x00029fb8, 0x0fd28400, 0x0000fb84, 0x10fac500,
+0xc52c2454, 0xc5d259ea, 0x245411fa, 0x10fac520,
+0x312c2454, 0x510ff3ff, 0xc520245c, 0x40da2ef8,
+0x0fc79b0f, 0xdff7f945, 0xfffcf5e8, 0xb8c289ff,
+0x000002a7, 0x840fd284, 0x000000bc, 0xd25ef2c5,
+0x4c11fac5, 0xfac52424, 0x20245411, 0x0f66ff31,
+0x244c0a3a, 0xf8c50b20, 0x24244c2e, 0x4c11fac5,
+0x0f402824, 0x450fc79b, 0xe8dff7f9, 0xfffffcb2,
+0xafb8c289, 0x84000002, 0xc57d74d2, 0x244c10fa,
+0x59f2c534, 0xc52c2454, 0x244c59f2, 0x11fac530,
+0xc5202454, 0x244c11fa, 0x10fac524, 0xc520244c,
+0x244c5ff2, 0x11fac524, 0xc528244c, 0x244c10fa,
+0x5df2c520, 0xc524244c, 0x244c11fa, 0x10fac524,
+0xc524244c, 0x244c58f2, 0xc5ff3128, 0x244c59f2,
+0x10fac534, 0xc52c2454, 0x245458ea, 0x2ef8c530,
+0x9b0f40ca, 0xf9450fc7, 0x33e8dff7, 0x3cfffffc,
+0x25c01901, 0x00000348, 0x0000c3c9, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002000,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000128ec,
+0x10fbc500, 0x0004570d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5a8,
+0xbac02454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000260, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0xf0850f00, 0xc5000003,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x66b8f06e, 0xc5000002, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x03a5850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482024, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x026bb8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x00034a85, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x82b8e86e, 0xc5000002, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x02c5850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x0000028b, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x78850f00, 0xc5000002, 0x91257efa, 0xc5000002,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x8eb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0229850f, 0x0ff20000, 0xc024545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff2a824, 0xa8245c5a,
+0xdb530ff3, 0xdb5a0ff3, 0xc32cfbc5, 0x5410fbc5,
+0xe3c5c024, 0xc031d82a, 0xda2ef9c5, 0x48c09b0f,
+0x48c2450f, 0xe1c4d8f7, 0xb8e86ef9, 0x00000296,
+0xcdd7f9c5, 0x81c9b60f, 0x0000fff9, 0xcc850f00,
+0xc5000001, 0xc5d259eb, 0x245411fb, 0x5a0ff2a8,
+0xf3a82454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff2b0, 0xf3b02454, 0xf3d2530f, 0xc5d25a0f,
+0xc5c22cfb, 0x31d02aeb, 0x2ef9c5c0, 0x0fc02454,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x9db8f06e,
+0xc5000002, 0x0fced7f9, 0xf981c9b6, 0x000000ff,
+0x0169850f, 0xfbc50000, 0xb0244c2c, 0x545a0ff2,
+0x0ff3c024, 0x0ff3d253, 0xfbc5d25a, 0xc139c22c,
+0x0fc0940f, 0xf748c0b6, 0xf9e1c4d8, 0x9fb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0129850f, 0xfbc50000, 0xc0245410, 0xd259ebc5,
+0x5411fbc5, 0xfbc5a824, 0xc0245410, 0x0ff2c031,
+0xa8245c51, 0xda2ef9c5, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x000002a7, 0xd5d7f9c5,
+0x81d2b60f, 0x0000fffa, 0xe0850f00, 0xc5000000,
+0xc5d25ef3, 0x244c11fb, 0x11fbc5b0, 0x31a82454,
+0x0000bac0, 0x0f660000, 0x244c0b3a, 0xf9c50ba8,
+0xb0244c2e, 0x4c11fbc5, 0x9b0fb824, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x02afb8f0, 0xf9c50000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x00008e85,
+0x10fbc500, 0xc5d0244c, 0x245459f3, 0x59f3c5c0,
+0xc5c8244c, 0x245411fb, 0x11fbc5a8, 0xc5b0244c,
+0x244c10fb, 0x5ff3c5a8, 0xc5b0244c, 0x244c11fb,
+0x10fbc5b8, 0xc5a8244c, 0x244c5df3, 0x11fbc5b0,
+0xc5b0244c, 0x244c10fb, 0x58f3c5b0, 0x31b8244c,
+0x59f3c5c0, 0xc5d0244c, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x0fca2ef9, 0x0f48c09b, 0x48bac245,
+0x48000003, 0xe1c4d8f7, 0xc5f86ef9, 0x0fc7d7f9,
+0xff3dc0b6, 0xb8000000, 0x00000000, 0xc9c2450f,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002220,
+};
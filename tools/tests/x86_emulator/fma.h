@@ -0,0 +1,481 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0221e8c3,
+0xc2810000, 0x0000028e, 0x8955e8d9, 0x38ec83e5,
+0xd9c855d9, 0xffffd882, 0xd855d9ff, 0x55d9c9d9,
+0xa082d9e8, 0xd9ffffff, 0x82d9cc55, 0xffffffd4,
+0xd9dc55d9, 0xec55d9ca, 0x5dd9cad9, 0xe05dd9d0,
+0xd9f055d9, 0xd45dd9c9, 0xd9e455d9, 0xf8c5f45d,
+0xc5d84d28, 0xb8db76e1, 0x00000041, 0xd128f8c5,
+0x9871e2c4, 0xe8c5c855, 0xffb092c2, 0xc400ffff,
+0xd30e79e2, 0x01a7830f, 0xf8c50000, 0x45b8d128,
+0xc4000000, 0x559e71e2, 0xc2e8c5c8, 0xffffc092,
+0xe2c400ff, 0x0fd30e79, 0x00018483, 0x28f8c500,
+0x0049b8d1, 0xe2c40000, 0xc8559a71, 0x92c2e8c5,
+0xffffffd0, 0x79e2c400, 0x830fd30e, 0x00000161,
+0xd128f8c5, 0x00004db8, 0x71e2c400, 0xc5c8559c,
+0xe092c2e8, 0x00ffffff, 0x0e79e2c4, 0x3e830fd3,
+0xc5000001, 0xc85528f8, 0xe958e8c5, 0x7d28f8c5,
+0x0054b8d8, 0xf8c50000, 0xe2c4e228, 0xe8659841,
+0xe4c2d0c5, 0x79e2c400, 0x830fe30e, 0x00000111,
+0xa228f8c5, 0xfffffff0, 0x000058b8, 0x28f8c500,
+0x28f8c5f2, 0xd0c5d87d, 0xe2c4ec57, 0xe8759e41,
+0xeec2d0c5, 0x79e2c400, 0x830feb0e, 0x000000e1,
+0xc95ce8c5, 0x7d28f8c5, 0x005cb8d8, 0xf8c50000,
+0xe2c4ea28, 0xe86d9a41, 0xedc2f0c5, 0x79e2c400,
+0x830feb0e, 0x000000b9, 0x7d28f8c5, 0x57f0c5d8,
+0x0060b8cc, 0xf8c50000, 0xe2c4ea28, 0xe86d9c41,
+0xcdc2f0c5, 0x79e2c400, 0x830fcb0e, 0x00000091,
+0x4d59e8c5, 0x57d8c5d8, 0xf3c5e865, 0xc5e86dd0,
+0xc5ccd0f3, 0xd86528f8, 0x000068b8, 0x28f8c500,
+0x59e2c4f2, 0xc5e875a6, 0x00eec2d0, 0x0e79e2c4,
+0xc45e73eb, 0x65a769e2, 0xc2f0c5e8, 0x6cb800e4,
+0xc4000000, 0xe30e79e2, 0xe8c54773, 0xc5d85d59,
+0xe85dd0e3, 0x6d28f8c5, 0x0072b8e8, 0xf8c50000,
+0xe2c4e228, 0xd8659651, 0xdcc2e0c5, 0x76d9c500,
+0x79e2c4e4, 0x1973dc0e, 0x9751e2c4, 0xf0c5d855,
+0xb800cac2, 0x00000076, 0x0e79e2c4, 0x310273cc,
+0x8bc3c9c0, 0x00c32414, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001254,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01ffe8c3,
+0xc2810000, 0x0000026e, 0x8955e8d9, 0x38ec83e5,
+0xd9c855dd, 0xffffa082, 0xd855ddff, 0x55ddc9d9,
+0xddc9d9e8, 0x55ddd05d, 0xf05ddde0, 0xdb76e1c5,
+0x4d28f9c5, 0x0041b8d8, 0xf9c50000, 0xe2c4d128,
+0xc85598f1, 0x92c2e9c5, 0xffffffb0, 0x79e2c400,
+0x830fd30f, 0x000001a7, 0x000045b8, 0x28f9c500,
+0xf1e2c4d1, 0xc5c8559e, 0xc092c2e9, 0x00ffffff,
+0x0f79e2c4, 0x84830fd3, 0xb8000001, 0x00000049,
+0xd128f9c5, 0x9af1e2c4, 0xe9c5c855, 0xffd092c2,
+0xc400ffff, 0xd30f79e2, 0x0161830f, 0x4db80000,
+0xc5000000, 0xc4d128f9, 0x559cf1e2, 0xc2e9c5c8,
+0xffffe092, 0xe2c400ff, 0x0fd30f79, 0x00013e83,
+0x28f9c500, 0xe9c5c855, 0x54b8e958, 0xc5000000,
+0xc5e228f9, 0xd87d28f9, 0x98c1e2c4, 0xd1c5e865,
+0xc400e4c2, 0xe30f79e2, 0x0111830f, 0x58b80000,
+0xc5000000, 0xc5f228f9, 0xd87d28f9, 0xa228f9c5,
+0xfffffff0, 0x9ec1e2c4, 0xd1c5e875, 0xd1c5ec57,
+0xc400eec2, 0xeb0f79e2, 0x00e1830f, 0xe9c50000,
+0x5cb8c95c, 0xc5000000, 0xc5ea28f9, 0xd87d28f9,
+0x9ac1e2c4, 0xf1c5e86d, 0xc400edc2, 0xeb0f79e2,
+0x00b9830f, 0x60b80000, 0xc5000000, 0xc5ea28f9,
+0xd87d28f9, 0xcc57f1c5, 0x9cc1e2c4, 0xf1c5e86d,
+0xc400cdc2, 0xcb0f79e2, 0x0091830f, 0xe9c50000,
+0xc5d84d59, 0xe86557d9, 0x6dd0f1c5, 0xd0f1c5e8,
+0x0068b8cc, 0xf9c50000, 0xc5d86528, 0xc4f228f9,
+0x75a6d9e2, 0xc2d1c5e8, 0xe2c400ee, 0x73eb0f79,
+0x006cb85e, 0xe2c40000, 0xe865a7e9, 0xe4c2f1c5,
+0x79e2c400, 0x4773e30f, 0x5d59e9c5, 0xd0e1c5d8,
+0x72b8e85d, 0xc5000000, 0xe86d28f9, 0xe228f9c5,
+0x96d1e2c4, 0xe1c5d865, 0xc500dcc2, 0xc4e476d9,
+0xdc0f79e2, 0x76b81973, 0xc4000000, 0x5597d1e2,
+0xc2f1c5d8, 0xe2c400ca, 0x73cc0f79, 0xc9c03102,
+0x24148bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001214,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_32f4[] = {
+0x3de800eb, 0x81000002, 0x000299c2, 0x55c03100,
+0xbb53e589, 0x00000009, 0x83e0e483, 0x894080c4,
+0x240489d9, 0xf883c129, 0x8444c708, 0x8000005c,
+0x2404db3f, 0xd9240c89, 0xdb1c845c, 0x5cd92404,
+0xda753c84, 0x5c28fcc5, 0xfcc52024, 0x60246428,
+0x4c28fcc5, 0xe4c54024, 0xccc5f458, 0x41b8f159,
+0xc5000000, 0xc5e928fc, 0xc09228fc, 0xc4ffffff,
+0x6c9875e2, 0xccc52024, 0xc400edc2, 0xea0e7de2,
+0x01b9830f, 0x45b80000, 0xc5000000, 0xc5f928fc,
+0xe0aa28fc, 0xc4ffffff, 0x7c9e75e2, 0xccc52024,
+0xccc5f557, 0xc400f7c2, 0xf20e7de2, 0x018d830f,
+0xe4c50000, 0xe4c5dc5c, 0x49b8d959, 0xc5000000,
+0xc4f128fc, 0x749a75e2, 0xe4c52024, 0xc400f6c2,
+0xf20e7de2, 0x0165830f, 0x4db80000, 0xc5000000,
+0xc5f128fc, 0xc4dd57e4, 0x749c75e2, 0xe4c52024,
+0xc400dec2, 0xda0e7de2, 0x0141830f, 0xfcc50000,
+0x20245c28, 0xf958e4c5, 0x3c29fcc5, 0x0054b824,
+0xfcc50000, 0xfcc5fb28, 0x40247428, 0x984de2c4,
+0xc2c4c5fc, 0xc400243c, 0xfa0e7de2, 0x010d830f,
+0x58b80000, 0xc5000000, 0x247428fc, 0x28fcc540,
+0x4de2c4fb, 0xd4c5fc9e, 0xc5243457, 0x00f7c2cc,
+0x0e7de2c4, 0xe4830ff2, 0xc5000000, 0xb8c95ce4,
+0x0000005c, 0xf328fcc5, 0x7c28fcc5, 0xe2c44024,
+0xc5f49a45, 0x00f6c2f4, 0x0e7de2c4, 0xbc830ff2,
+0xb8000000, 0x00000060, 0xf328fcc5, 0x7c28fcc5,
+0xf4c54024, 0xe2c4cd57, 0xc5f49c45, 0x00cec2f4,
+0x0e7de2c4, 0x94830fca, 0xc5000000, 0x244c59e4,
+0xd0f7c540, 0x57dcc5f4, 0xd0f7c5e5, 0x0068b8cc,
+0xfcc50000, 0x40246428, 0xeb28fcc5, 0xa65de2c4,
+0xc560246c, 0x00f5c2cc, 0x0e7de2c4, 0xb86073f2,
+0x0000006c, 0xa765e2c4, 0xc5602464, 0x00e4c2f4,
+0x0e7de2c4, 0xc54873e2, 0x246459e4, 0xd0dfc540,
+0xb8602464, 0x00000072, 0x6c28fcc5, 0xfcc56024,
+0xe2c4f328, 0x24749655, 0xc2dcc540, 0xe2c400e6,
+0x73e20e7d, 0x0076b81a, 0xe2c40000, 0x245c9755,
+0xc2f4c540, 0xe2c400cb, 0x73ca0e7d, 0x8bc03102,
+0xc3c9fc5d, 0xc324148b, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001254,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_32f8[] = {
+0x43e800eb, 0x81000002, 0x000299c2, 0x55c03100,
+0xbb53e589, 0x00000005, 0x83e0e483, 0x894080c4,
+0x240489d9, 0x44c7c129, 0x00005cc4, 0x04db3ff0,
+0x240c8924, 0xf883c931, 0xc44c8904, 0xc45cdd58,
+0x2404db18, 0x38c45cdd, 0xfdc5d475, 0x20245c28,
+0x6428fdc5, 0xfdc56024, 0x40244c28, 0xf458e5c5,
+0xf159cdc5, 0x000041b8, 0x28fdc500, 0x28fdc5e9,
+0xffffc092, 0xf5e2c4ff, 0x20246c98, 0xedc2cdc5,
+0x7de2c400, 0x830fea0f, 0x000001b9, 0x000045b8,
+0x28fdc500, 0x28fdc5f9, 0xffffe0aa, 0xf5e2c4ff,
+0x20247c9e, 0xf557cdc5, 0xf7c2cdc5, 0x7de2c400,
+0x830ff20f, 0x0000018d, 0xdc5ce5c5, 0xd959e5c5,
+0x000049b8, 0x28fdc500, 0xf5e2c4f1, 0x2024749a,
+0xf6c2e5c5, 0x7de2c400, 0x830ff20f, 0x00000165,
+0x00004db8, 0x28fdc500, 0x57e5c5f1, 0xf5e2c4dd,
+0x2024749c, 0xdec2e5c5, 0x7de2c400, 0x830fda0f,
+0x00000141, 0x5c28fdc5, 0xe5c52024, 0xfdc5f958,
+0xb8243c29, 0x00000054, 0xfb28fdc5, 0x7428fdc5,
+0xe2c44024, 0xc5fc98cd, 0x243cc2c5, 0x7de2c400,
+0x830ffa0f, 0x0000010d, 0x000058b8, 0x28fdc500,
+0xc5402474, 0xc4fb28fd, 0xfc9ecde2, 0x3457d5c5,
+0xc2cdc524, 0xe2c400f7, 0x0ff20f7d, 0x0000e483,
+0x5ce5c500, 0x005cb8c9, 0xfdc50000, 0xfdc5f328,
+0x40247c28, 0x9ac5e2c4, 0xc2f5c5f4, 0xe2c400f6,
+0x0ff20f7d, 0x0000bc83, 0x0060b800, 0xfdc50000,
+0xfdc5f328, 0x40247c28, 0xcd57f5c5, 0x9cc5e2c4,
+0xc2f5c5f4, 0xe2c400ce, 0x0fca0f7d, 0x00009483,
+0x59e5c500, 0xc540244c, 0xc5f4d0f5, 0xc5e557dd,
+0xb8ccd0f5, 0x00000068, 0x6428fdc5, 0xfdc54024,
+0xe2c4eb28, 0x246ca6dd, 0xc2cdc560, 0xe2c400f5,
+0x73f20f7d, 0x006cb860, 0xe2c40000, 0x2464a7e5,
+0xc2f5c560, 0xe2c400e4, 0x73e20f7d, 0x59e5c548,
+0xc5402464, 0x2464d0dd, 0x0072b860, 0xfdc50000,
+0x60246c28, 0xf328fdc5, 0x96d5e2c4, 0xc5402474,
+0x00e6c2dd, 0x0f7de2c4, 0xb81a73e2, 0x00000076,
+0x97d5e2c4, 0xc540245c, 0x00cbc2f5, 0x0f7de2c4,
+0x310273ca, 0xfc5d8bc0, 0x148bc3c9, 0x0000c324,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001254,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_f4[] = {
+0x58e800eb, 0x05000001, 0x00000189, 0x83e58955,
+0xfac570ec, 0xffe08810, 0xfac5ffff, 0xc59c4d11,
+0xa04d11fa, 0x4d11fac5, 0x10fac5a4, 0xe2c4a04d,
+0x9c4d9971, 0x882ef8c5, 0xffffffe4, 0x00e58a0f,
+0x850f0000, 0x000000df, 0x4d10fac5, 0x71e2c4a0,
+0xc59c4d9f, 0xe8882ef8, 0x0fffffff, 0x0000cd8a,
+0xc7850f00, 0xc5000000, 0xa04d10fa, 0xd257e8c5,
+0x9b71e2c4, 0xf8c59c4d, 0x8a0fca2e, 0x000000b5,
+0x00af850f, 0xfac50000, 0xc4a04d10, 0x4d9d71e2,
+0x2ef8c59c, 0xa18a0fca, 0x0f000000, 0x00009b85,
+0x10fac500, 0xfac59c4d, 0xc5a06510, 0xc5d458f2,
+0x9c5d10fa, 0x7510fac5, 0x49e2c4a0, 0xc5a45d99,
+0x7ad32ef8, 0xc57c757e, 0xf09810fa, 0xc5ffffff,
+0x9c6d10fa, 0x7d10fac5, 0x57e8c5a0, 0x41e2c4d3,
+0xc5a46d9f, 0x7aea2ef8, 0xc55f7561, 0xc5cc5cf2,
+0x9c5510fa, 0x7510fac5, 0x49e2c4a0, 0xc5a4559b,
+0x7aca2ef8, 0xc54a754c, 0x9c5510fa, 0xcb57f0c5,
+0x7d10fac5, 0x41e2c4a0, 0xc5a4559d, 0x7ad12ef8,
+0x31357537, 0xb836ebc0, 0x00000041, 0x45b82feb,
+0xeb000000, 0x0049b828, 0x21eb0000, 0x00004db8,
+0xb81aeb00, 0x00000054, 0x58b813eb, 0xeb000000,
+0x005cb80c, 0x05eb0000, 0x000060b8, 0x8bc3c900,
+0x00c32404, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0000634,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_f8[] = {
+0xaee800eb, 0x05000001, 0x000001e9, 0x81e58955,
+0x0000d0ec, 0x10fbc500, 0xffffd088, 0x11fbc5ff,
+0xffff388d, 0x11fbc5ff, 0xffff408d, 0x11fbc5ff,
+0xffff488d, 0x10fbc5ff, 0xffff408d, 0xf1e2c4ff,
+0xff388d99, 0xf9c5ffff, 0xffd8882e, 0x8a0fffff,
+0x00000129, 0x0123850f, 0xfbc50000, 0xff408d10,
+0xe2c4ffff, 0x388d9ff1, 0xc5ffffff, 0xe0882ef9,
+0x0fffffff, 0x00010b8a, 0x05850f00, 0xc5000001,
+0xc5d257e9, 0x408d10fb, 0xc4ffffff, 0x8d9bf1e2,
+0xffffff38, 0xca2ef9c5, 0x00ed8a0f, 0x850f0000,
+0x000000e7, 0x8d10fbc5, 0xffffff40, 0x9df1e2c4,
+0xffff388d, 0x2ef9c5ff, 0xd38a0fca, 0x0f000000,
+0x0000cd85, 0x10fbc500, 0xffff388d, 0x10fbc5ff,
+0xffff40a5, 0x58f3c5ff, 0x10fbc5d4, 0xffff389d,
+0x10fbc5ff, 0xffff40b5, 0xc9e2c4ff, 0xff489d99,
+0xf9c5ffff, 0x8a0fd32e, 0x0000009d, 0x0097850f,
+0xfbc50000, 0xff38ad10, 0xfbc5ffff, 0xff40bd10,
+0xfac5ffff, 0xfff0987e, 0xe2c4ffff, 0x48ad9fc1,
+0xc5ffffff, 0xc5d357e9, 0x7aea2ef9, 0xc5717573,
+0xc5cc5cf3, 0x389510fb, 0xc5ffffff, 0x40b510fb,
+0xc4ffffff, 0x959bc9e2, 0xffffff48, 0xca2ef9c5,
+0x5375557a, 0x9510fbc5, 0xffffff38, 0xbd10fbc5,
+0xffffff40, 0xcb57f1c5, 0x9dc1e2c4, 0xffff4895,
+0x2ef9c5ff, 0x75377ad1, 0xebc03135, 0x0041b836,
+0x2feb0000, 0x000045b8, 0xb828eb00, 0x00000049,
+0x4db821eb, 0xeb000000, 0x0054b81a, 0x13eb0000,
+0x000058b8, 0xb80ceb00, 0x0000005c, 0x60b805eb,
+0xc9000000, 0x24048bc3, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0000774,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x002d48e8,
+0x48008000, 0x48f04589, 0xc5f84589, 0xe04d28f8,
+0xd276e9c5, 0x000041b8, 0x28f8c500, 0x71e2c4d9,
+0xc5d05d98, 0xb41dc2e0, 0x00000001, 0x0e79e2c4,
+0xa4830fda, 0xc5000001, 0xc4d928f8, 0x5d9e71e2,
+0x0045b8d0, 0xe0c50000, 0x01a11dc2, 0xc4000000,
+0xda0e79e2, 0x0181830f, 0xf8c50000, 0xe2c4d928,
+0xd05d9a71, 0x000049b8, 0xc2e0c500, 0x00018e1d,
+0xe2c40000, 0x0fda0e79, 0x00015e83, 0x28f8c500,
+0x71e2c4d9, 0xb8d05d9c, 0x0000004d, 0x1dc2e0c5,
+0x0000017b, 0x79e2c400, 0x830fda0e, 0x0000013b,
+0x5d28f8c5, 0x58e0c5d0, 0x28f8c5e1, 0xf8c5e07d,
+0xe2c4eb28, 0xf06d9841, 0x000054b8, 0xc2d8c500,
+0xe2c400ed, 0x0fea0e79, 0x00010e83, 0x28f8c500,
+0xf8c5e07d, 0xe2c4eb28, 0xf06d9e41, 0x000058b8,
+0x79e2c400, 0x01263518, 0xd8c50000, 0xd8c5e657,
+0xc400e5c2, 0xe20e79e2, 0x00dd830f, 0xe0c50000,
+0xf8c5c95c, 0xc5e07d28, 0xc4e328f8, 0x659a41e2,
+0x005cb8f0, 0xf0c50000, 0xc400e4c2, 0xe20e79e2,
+0x00b5830f, 0xf8c50000, 0xc5e07d28, 0xc4e328f8,
+0x659c41e2, 0x57f0c5f0, 0x0060b8ce, 0xf0c50000,
+0xc400ccc2, 0xca0e79e2, 0x008d830f, 0xe0c50000,
+0xc5e04d59, 0xf06557c8, 0x6dd0f3c5, 0xd0f3c5f0,
+0x28f8c5cc, 0xf8c5e065, 0xe2c4f328, 0xf075a659,
+0x000068b8, 0xc2d0c500, 0xe2c400ee, 0x73ea0e79,
+0x61e2c45a, 0xb8f065a7, 0x0000006c, 0xe4c2f0c5,
+0x79e2c400, 0x4373e20e, 0x6559e0c5, 0xd0dbc5e0,
+0xf8c5f065, 0xc5f06d28, 0xc4f328f8, 0x759651e2,
+0x0072b8e0, 0xd8c50000, 0xc400e6c2, 0xe20e79e2,
+0xe2c41973, 0xe05d9751, 0x000076b8, 0xc2f0c500,
+0xe2c400cb, 0x73ca0e79, 0x5dc03102, 0x000000c3,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001140,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x023a0d10, 0xfbc50000,
+0x01fa1510, 0xfbc50000, 0xc5d04d11, 0xe05511fb,
+0x4d11fbc5, 0x11fbc5f0, 0xfbc5d855, 0xc5e84d11,
+0xf84d11fb, 0x4d28f9c5, 0x76e9c5e0, 0x0041b8d2,
+0xf9c50000, 0xe2c4d928, 0xd05d98f1, 0x1dc2e1c5,
+0x000001cb, 0x79e2c400, 0x830fda0f, 0x000001a3,
+0xd928f9c5, 0x9ef1e2c4, 0x45b8d05d, 0xc5000000,
+0xb81dc2e1, 0x00000001, 0x0f79e2c4, 0x80830fda,
+0xc5000001, 0xc4d928f9, 0x5d9af1e2, 0x0049b8d0,
+0xe1c50000, 0x01a51dc2, 0xc4000000, 0xda0f79e2,
+0x015d830f, 0xf9c50000, 0xe2c4d928, 0xd05d9cf1,
+0x00004db8, 0xc2e1c500, 0x0001921d, 0xe2c40000,
+0x0fda0f79, 0x00013a83, 0x28f9c500, 0xe1c5d05d,
+0xf9c5e158, 0xc5e07d28, 0xc4eb28f9, 0x6d98c1e2,
+0x0054b8f0, 0xd9c50000, 0xc400edc2, 0xea0f79e2,
+0x010d830f, 0xf9c50000, 0xc5e07d28, 0xc4eb28f9,
+0x6d9ec1e2, 0x12fbc5f0, 0x00014335, 0x57d9c500,
+0x0058b8e6, 0xd9c50000, 0xc400e5c2, 0xe20f79e2,
+0x00dd830f, 0xe1c50000, 0xf9c5c95c, 0xc5e07d28,
+0xc4e328f9, 0x659ac1e2, 0x005cb8f0, 0xf1c50000,
+0xc400e4c2, 0xe20f79e2, 0x00b5830f, 0xf9c50000,
+0xc5e07d28, 0xc4e328f9, 0x659cc1e2, 0x57f1c5f0,
+0x0060b8ce, 0xf1c50000, 0xc400ccc2, 0xca0f79e2,
+0x008d830f, 0xe1c50000, 0xc5e04d59, 0xf06557c9,
+0x6dd0f1c5, 0xd0f1c5f0, 0x28f9c5cc, 0xf9c5e065,
+0xe2c4f328, 0xf075a6d9, 0x000068b8, 0xc2d1c500,
+0xe2c400ee, 0x73ea0f79, 0xe1e2c45a, 0xb8f065a7,
+0x0000006c, 0xe4c2f1c5, 0x79e2c400, 0x4373e20f,
+0x6559e1c5, 0xd0d9c5e0, 0xf9c5f065, 0xc5f06d28,
+0xc4f328f9, 0x7596d1e2, 0x0072b8e0, 0xd9c50000,
+0xc400e6c2, 0xe20f79e2, 0xe2c41973, 0xe05d97d1,
+0x000076b8, 0xc2f1c500, 0xe2c400cb, 0x73ca0f79,
+0x5dc03102, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001140,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_32f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x0d10fac5, 0x00000220, 0xd02aeac5,
+0xfac5ca89, 0xdc844c11, 0xfac5c229, 0x9c845411,
+0xd22aeac5, 0x5411fac5, 0xff48bc84, 0xf88348c0,
+0xc5d97509, 0x245c28fc, 0x28fcc5a0, 0xc5e02464,
+0x244c28fc, 0x58e4c5c0, 0x59d4c5ec, 0x28fcc5e9,
+0x75e2c4f1, 0xa0247498, 0x000041b8, 0x7de2c400,
+0x01ca1518, 0xd4c50000, 0xc400f6c2, 0xf20e7de2,
+0x01b3830f, 0xfcc50000, 0xe2c4f928, 0x247c9e75,
+0x0045b8a0, 0xe2c40000, 0xa535187d, 0xc5000001,
+0xc5ee57d4, 0x00efc2d4, 0x0e7de2c4, 0x86830fea,
+0xc5000001, 0xc5dc5ce4, 0xc5d959e4, 0xc4e928fc,
+0x6c9a75e2, 0x49b8a024, 0xc5000000, 0x00edc2e4,
+0x0e7de2c4, 0x5e830fea, 0xc5000001, 0xc4e928fc,
+0x6c9c75e2, 0xe4c5a024, 0x4db8de57, 0xc5000000,
+0x00ddc2e4, 0x0e7de2c4, 0x3a830fda, 0xc5000001,
+0x245c28fc, 0x58e4c5a0, 0x287cc5e9, 0xc5c02444,
+0xb8fb28fc, 0x00000054, 0x983de2c4, 0xc2d4c5fc,
+0xe2c400ff, 0x0ffa0e7d, 0x00010c83, 0x287cc500,
+0xc5c0244c, 0xc5fb28fc, 0xb8ee57d4, 0x00000058,
+0x9e35e2c4, 0xc2d4c5fc, 0xe2c400ef, 0x0fea0e7d,
+0x0000e483, 0x5ce4c500, 0x28fcc5c9, 0xc5c0247c,
+0xb8eb28fc, 0x0000005c, 0x9a45e2c4, 0xc2f4c5ec,
+0xe2c400ed, 0x0fea0e7d, 0x0000bc83, 0x28fcc500,
+0xc5c0247c, 0xc5eb28fc, 0xb8ce57f4, 0x00000060,
+0x9c45e2c4, 0xc2f4c5ec, 0xe2c400cd, 0x0fca0e7d,
+0x00009483, 0x59e4c500, 0xc5c0244c, 0xc5ecd0f7,
+0xc5e657dc, 0xc5ccd0f7, 0x246428fc, 0x28fcc5c0,
+0x0068b8f3, 0xe2c40000, 0x2474a65d, 0xc2d4c5e0,
+0xe2c400ee, 0x73ea0e7d, 0x65e2c460, 0xe02464a7,
+0x00006cb8, 0xc2f4c500, 0xe2c400e4, 0x73e20e7d,
+0x59e4c548, 0xc5c02464, 0x2464d0df, 0x28fcc5e0,
+0xc5e0246c, 0xb8f328fc, 0x00000072, 0x9655e2c4,
+0xc5c02474, 0x00e6c2dc, 0x0e7de2c4, 0xc41a73e2,
+0x5c9755e2, 0x76b8c024, 0xc5000000, 0x00cbc2f4,
+0x0e7de2c4, 0x310273ca, 0x00c3c9c0, 0x3f800000,
+0xffffffff, 0x80000000,
+0001110,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0xfbc5e0e4, 0x026e0d10,
+0xfbc50000, 0x02d61510, 0xfbc50000, 0x02661d10,
+0xfbc50000, 0x02be2510, 0xfbc50000, 0xa0244c11,
+0x5411fbc5, 0xfbc5c024, 0xe0244c11, 0x5c11fbc5,
+0xfbc5a824, 0xc8246411, 0x4c11fbc5, 0xfbc5e824,
+0xb0246411, 0x5c11fbc5, 0xfbc5d024, 0xf0244c11,
+0x5411fbc5, 0xfbc5b824, 0xd8244c11, 0x4c11fbc5,
+0xfdc5f824, 0xc0244c28, 0x000041b8, 0x7de2c400,
+0x020a1519, 0xfdc50000, 0xe2c4d928, 0x245c98f5,
+0xc2e5c5a0, 0x0002061d, 0xe2c40000, 0x0fda0f7d,
+0x0001bb83, 0x28fdc500, 0xf5e2c4d9, 0xa0245c9e,
+0x000045b8, 0xc2e5c500, 0x0002021d, 0xe2c40000,
+0x0fda0f7d, 0x00019783, 0x28fdc500, 0xf5e2c4d9,
+0xa0245c9a, 0x000049b8, 0xc2e5c500, 0x0001fe1d,
+0xe2c40000, 0x0fda0f7d, 0x00017383, 0x28fdc500,
+0xf5e2c4d9, 0xa0245c9c, 0x00004db8, 0xc2e5c500,
+0x0001fa1d, 0xe2c40000, 0x0fda0f7d, 0x00014f83,
+0x28fdc500, 0xc5a0245c, 0xc5e158e5, 0x247c28fd,
+0x28fdc5c0, 0x0054b8eb, 0xe2c40000, 0x246c98c5,
+0xc2ddc5e0, 0xe2c400ed, 0x0fea0f7d, 0x00011f83,
+0x28fdc500, 0xc5c0247c, 0xc4eb28fd, 0x6c9ec5e2,
+0x58b8e024, 0xc4000000, 0x35197de2, 0x000001a0,
+0xe657ddc5, 0xe5c2ddc5, 0x7de2c400, 0x830fe20f,
+0x000000ec, 0xc95ce5c5, 0x7c28fdc5, 0xfdc5c024,
+0x5cb8e328, 0xc4000000, 0x649ac5e2, 0xf5c5e024,
+0xc400e4c2, 0xe20f7de2, 0x00c2830f, 0xfdc50000,
+0xc0247c28, 0xe328fdc5, 0xce57f5c5, 0x000060b8,
+0xc5e2c400, 0xe024649c, 0xccc2f5c5, 0x7de2c400,
+0x830fca0f, 0x00000098, 0x4c59e5c5, 0xcdc5c024,
+0xe0246457, 0x6cd0f5c5, 0xf5c5e024, 0xfdc5ccd0,
+0xc0246428, 0xf328fdc5, 0x000068b8, 0xdde2c400,
+0xe02474a6, 0xeec2d5c5, 0x7de2c400, 0x6073ea0f,
+0xa7e5e2c4, 0xb8e02464, 0x0000006c, 0xe4c2f5c5,
+0x7de2c400, 0x4873e20f, 0x6459e5c5, 0xddc5c024,
+0xe02464d0, 0x6c28fdc5, 0xfdc5e024, 0x72b8f328,
+0xc4000000, 0x7496d5e2, 0xddc5c024, 0xc400e6c2,
+0xe20f7de2, 0xe2c41a73, 0x245c97d5, 0x0076b8c0,
+0xf5c50000, 0xc400cbc2, 0xca0f7de2, 0xc0310273,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0001440,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_f4[] = {
+0x485500eb, 0xfac5e589, 0x01520d10, 0xfac50000,
+0xc59c4d11, 0xa04d11fa, 0x4d11fac5, 0x10fac5a4,
+0xe2c4a04d, 0x9c4d9971, 0x0d2ef8c5, 0x00000134,
+0x00e58a0f, 0x850f0000, 0x000000df, 0x4d10fac5,
+0x71e2c4a0, 0xc59c4d9f, 0x190d2ef8, 0x0f000001,
+0x0000cd8a, 0xc7850f00, 0xc5000000, 0xa04d10fa,
+0x9b71e2c4, 0xe8c59c4d, 0xf8c5d257, 0x8a0fca2e,
+0x000000b5, 0x00af850f, 0xfac50000, 0xc4a04d10,
+0x4d9d71e2, 0x2ef8c59c, 0xa18a0fca, 0x0f000000,
+0x00009b85, 0x10fac500, 0xfac59c4d, 0xc5a06510,
+0xc5d458f2, 0x9c5d10fa, 0x7510fac5, 0x49e2c4a0,
+0xc5a45d99, 0x7ad32ef8, 0xc57c757e, 0x9c6d10fa,
+0x7d10fac5, 0x10fac5a0, 0x0000a31d, 0x41e2c400,
+0xc5a46d9f, 0xc5d357e8, 0x7aea2ef8, 0xc55f7561,
+0xc5cc5cf2, 0x9c5510fa, 0x7510fac5, 0x49e2c4a0,
+0xc5a4559b, 0x7aca2ef8, 0xc54a754c, 0x9c5510fa,
+0x7d10fac5, 0x57f0c5a0, 0x41e2c4cb, 0xc5a4559d,
+0x7ad12ef8, 0x31357537, 0xb836ebc0, 0x00000041,
+0x45b82feb, 0xeb000000, 0x0049b828, 0x21eb0000,
+0x00004db8, 0xb81aeb00, 0x00000054, 0x58b813eb,
+0xeb000000, 0x005cb80c, 0x05eb0000, 0x000060b8,
+0x00c35d00, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000600,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0xfbc558ec, 0x019e0d10,
+0xfbc50000, 0xff388d11, 0xfbc5ffff, 0xff408d11,
+0xfbc5ffff, 0xff488d11, 0xfbc5ffff, 0xff408d10,
+0xe2c4ffff, 0x388d99f1, 0xc5ffffff, 0x750d2ef9,
+0x0f000001, 0x0001298a, 0x23850f00, 0xc5000001,
+0x408d10fb, 0xc4ffffff, 0x8d9ff1e2, 0xffffff38,
+0x0d2ef9c5, 0x00000158, 0x010b8a0f, 0x850f0000,
+0x00000105, 0x8d10fbc5, 0xffffff40, 0xd257e9c5,
+0x9bf1e2c4, 0xffff388d, 0x2ef9c5ff, 0xed8a0fca,
+0x0f000000, 0x0000e785, 0x10fbc500, 0xffff408d,
+0xf1e2c4ff, 0xff388d9d, 0xf9c5ffff, 0x8a0fca2e,
+0x000000d3, 0x00cd850f, 0xfbc50000, 0xff388d10,
+0xfbc5ffff, 0xff40a510, 0xf3c5ffff, 0xfbc5d458,
+0xff389d10, 0xfbc5ffff, 0xff40b510, 0xe2c4ffff,
+0x489d99c9, 0xc5ffffff, 0x0fd32ef9, 0x00009d8a,
+0x97850f00, 0xc5000000, 0x38ad10fb, 0xc5ffffff,
+0x40bd10fb, 0xc4ffffff, 0xad9fc1e2, 0xffffff48,
+0x1d7efac5, 0x000000b8, 0xd357e9c5, 0xea2ef9c5,
+0x7175737a, 0xcc5cf3c5, 0x9510fbc5, 0xffffff38,
+0xb510fbc5, 0xffffff40, 0x9bc9e2c4, 0xffff4895,
+0x2ef9c5ff, 0x75557aca, 0x10fbc553, 0xffff3895,
+0x10fbc5ff, 0xffff40bd, 0x57f1c5ff, 0xc1e2c4cb,
+0xff48959d, 0xf9c5ffff, 0x377ad12e, 0xc0313575,
+0x41b836eb, 0xeb000000, 0x0045b82f, 0x28eb0000,
+0x000049b8, 0xb821eb00, 0x0000004d, 0x54b81aeb,
+0xeb000000, 0x0058b813, 0x0ceb0000, 0x00005cb8,
+0xb805eb00, 0x00000060, 0x0000c3c9, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000740,
+};
@@ -0,0 +1,459 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01f9e8c3,
+0xc2810000, 0x0000025e, 0x8955e8d9, 0x38ec83e5,
+0xd9c855d9, 0xffffd882, 0xd855d9ff, 0x55d9c9d9,
+0xa082d9e8, 0xd9ffffff, 0x82d9cc55, 0xffffffd4,
+0xd9dc55d9, 0xec55d9ca, 0x5dd9cad9, 0xe05dd9d0,
+0xd9f055d9, 0xd45dd9c9, 0xd9e455d9, 0xf8c5f45d,
+0xc5d84d28, 0xb8db76e1, 0x00000041, 0x6871e3c4,
+0xc510c855, 0xb092c2e8, 0x00ffffff, 0x0e79e2c4,
+0x82830fd3, 0xc4000001, 0x557c71e3, 0xe8c510c8,
+0xffc092c2, 0xb800ffff, 0x00000045, 0x0e79e2c4,
+0x62830fd3, 0xc4000001, 0x556c71e3, 0xe8c510c8,
+0xffd092c2, 0xb800ffff, 0x00000049, 0x0e79e2c4,
+0x42830fd3, 0xc4000001, 0x557871e3, 0xe8c510c8,
+0xffe092c2, 0xb800ffff, 0x0000004d, 0x0e79e2c4,
+0x22830fd3, 0xc5000001, 0xc85528f8, 0xe958e8c5,
+0x7528f8c5, 0x0054b8e8, 0xe3c40000, 0xd86568e9,
+0xc2d0c560, 0xe2c400e4, 0x0fe30e79, 0x0000f883,
+0x28f8c500, 0xfffff0a2, 0xe9e3c4ff, 0x60d8757c,
+0x000058b8, 0x57d0c500, 0xc2d0c5ec, 0xe2c400ee,
+0x0feb0e79, 0x0000d083, 0x5ce8c500, 0x28f8c5c9,
+0x5cb8e875, 0xc4000000, 0x6d6ce9e3, 0xf0c560d8,
+0xc400edc2, 0xeb0e79e2, 0x00ab830f, 0xf0c50000,
+0xe3c4cc57, 0xd86d78e9, 0x0060b860, 0xf0c50000,
+0xc400cdc2, 0xcb0e79e2, 0x008b830f, 0xe8c50000,
+0xc5d84d59, 0xc5e457c8, 0xc5eed0f3, 0xc5ccd0f3,
+0xd86528f8, 0x000068b8, 0xe9e3c400, 0x40e8755c,
+0xeec2d0c5, 0x79e2c400, 0x5d73eb0e, 0x5ee9e3c4,
+0xc540e865, 0x00e4c2f0, 0x00006cb8, 0x79e2c400,
+0x4573e30e, 0x5d59e8c5, 0xd0e3c5d8, 0xf8c5e85d,
+0xb8e86d28, 0x00000072, 0x5c69e3c4, 0xc550d865,
+0x00dcc2e0, 0xe476d9c5, 0x0e79e2c4, 0xc41a73dc,
+0x555e69e3, 0xf0c550d8, 0xb800cac2, 0x00000076,
+0x0e79e2c4, 0x310273cc, 0x8bc3c9c0, 0x00c32414,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001174,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01d7e8c3,
+0xc2810000, 0x0000023e, 0x8955e8d9, 0x38ec83e5,
+0xd9c855dd, 0xffffa082, 0xd855ddff, 0x55ddc9d9,
+0xddc9d9e8, 0x55ddd05d, 0xf05ddde0, 0xdb76e1c5,
+0x4d28f9c5, 0x0041b8d8, 0xe3c40000, 0xc8556971,
+0xc2e9c510, 0xffffb092, 0xe2c400ff, 0x0fd30f79,
+0x00018283, 0x0045b800, 0xe3c40000, 0xc8557d71,
+0xc2e9c510, 0xffffc092, 0xe2c400ff, 0x0fd30f79,
+0x00016283, 0x0049b800, 0xe3c40000, 0xc8556d71,
+0xc2e9c510, 0xffffd092, 0xe2c400ff, 0x0fd30f79,
+0x00014283, 0x004db800, 0xe3c40000, 0xc8557971,
+0xc2e9c510, 0xffffe092, 0xe2c400ff, 0x0fd30f79,
+0x00012283, 0x28f9c500, 0xe9c5c855, 0x54b8e958,
+0xc5000000, 0xe87528f9, 0x69e9e3c4, 0xc560d865,
+0x00e4c2d1, 0x0f79e2c4, 0xf8830fe3, 0xb8000000,
+0x00000058, 0x7de9e3c4, 0xc560d875, 0xf0a228f9,
+0xc5ffffff, 0xc5ec57d1, 0x00eec2d1, 0x0f79e2c4,
+0xd0830feb, 0xc5000000, 0xb8c95ce9, 0x0000005c,
+0x7528f9c5, 0xe9e3c4e8, 0x60d86d6d, 0xedc2f1c5,
+0x79e2c400, 0x830feb0f, 0x000000ab, 0x000060b8,
+0xe9e3c400, 0x60d86d79, 0xcc57f1c5, 0xcdc2f1c5,
+0x79e2c400, 0x830fcb0f, 0x0000008b, 0x4d59e9c5,
+0x57c9c5d8, 0xd0f1c5e4, 0xd0f1c5ee, 0x0068b8cc,
+0xf9c50000, 0xc4d86528, 0x755de9e3, 0xd1c540e8,
+0xc400eec2, 0xeb0f79e2, 0x6cb85d73, 0xc4000000,
+0x655fe9e3, 0xf1c540e8, 0xc400e4c2, 0xe30f79e2,
+0xe9c54573, 0xc5d85d59, 0xe85dd0e1, 0x000072b8,
+0x28f9c500, 0xe3c4e86d, 0xd8655d69, 0xc2e1c550,
+0xd9c500dc, 0xe2c4e476, 0x73dc0f79, 0x0076b81a,
+0xe3c40000, 0xd8555f69, 0xc2f1c550, 0xe2c400ca,
+0x73cc0f79, 0xc9c03102, 0x24148bc3, 0x000000c3,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001134,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_32f4[] = {
+0x11e800eb, 0x81000002, 0x000259c2, 0x55c03100,
+0xbb53e589, 0x00000009, 0x83e0e483, 0x894080c4,
+0x240489d9, 0xf883c129, 0x8444c708, 0x8000005c,
+0x2404db3f, 0xd9240c89, 0xdb1c845c, 0x5cd92404,
+0xda753c84, 0x5c28fcc5, 0xfcc52024, 0x60246428,
+0x4c28fcc5, 0xe4c54024, 0xccc5f458, 0x41b8f159,
+0xc4000000, 0x6c6875e3, 0xc5102024, 0xc09228fc,
+0xc5ffffff, 0x00edc2cc, 0x0e7de2c4, 0x90830fea,
+0xb8000001, 0x00000045, 0x7c75e3c4, 0x1020247c,
+0xaa28fcc5, 0xffffffe0, 0xf557ccc5, 0xf7c2ccc5,
+0x7de2c400, 0x830ff20e, 0x00000167, 0xdc5ce4c5,
+0xd959e4c5, 0x000049b8, 0x75e3c400, 0x2024746c,
+0xc2e4c510, 0xe2c400f6, 0x0ff20e7d, 0x00014283,
+0x004db800, 0xe3c40000, 0x24747875, 0xe4c51020,
+0xe4c5dd57, 0xc400dec2, 0xda0e7de2, 0x0121830f,
+0xfcc50000, 0x20245c28, 0xf958e4c5, 0x3c29fcc5,
+0x0054b824, 0xe3c40000, 0x247c68e5, 0xc4c54040,
+0x00243cc2, 0x0e7de2c4, 0xf4830ffa, 0xb8000000,
+0x00000058, 0x7ce5e3c4, 0x4040247c, 0x3457d4c5,
+0xc2ccc524, 0xe2c400f7, 0x0ff20e7d, 0x0000d283,
+0x5ce4c500, 0x005cb8c9, 0xe3c40000, 0x24746ce5,
+0xf4c54040, 0xc400f6c2, 0xf20e7de2, 0x00b1830f,
+0x60b80000, 0xc4000000, 0x7478e5e3, 0xc5404024,
+0xc5cd57f4, 0x00cec2f4, 0x0e7de2c4, 0x90830fca,
+0xc5000000, 0x244c59e4, 0xd0f7c540, 0x57dcc5f4,
+0xd0f7c5e5, 0x0068b8cc, 0xfcc50000, 0x40246428,
+0x5ce5e3c4, 0x4060246c, 0xf5c2ccc5, 0x7de2c400,
+0x5f73f20e, 0x00006cb8, 0xe5e3c400, 0x6024645e,
+0xc2f4c540, 0xe2c400e4, 0x73e20e7d, 0x59e4c546,
+0xc5402464, 0x2464d0df, 0x0072b860, 0xfcc50000,
+0x60246c28, 0x5c65e3c4, 0x50402474, 0xe6c2dcc5,
+0x7de2c400, 0x1b73e20e, 0x000076b8, 0x65e3c400,
+0x40245c5e, 0xc2f4c550, 0xe2c400cb, 0x73ca0e7d,
+0x8bc03102, 0xc3c9fc5d, 0xc324148b, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001154,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_32f8[] = {
+0x17e800eb, 0x81000002, 0x000279c2, 0x55c03100,
+0xbb53e589, 0x00000005, 0x83e0e483, 0x894080c4,
+0x240489d9, 0x44c7c129, 0x00005cc4, 0x04db3ff0,
+0x240c8924, 0xf883c931, 0xc44c8904, 0xc45cdd58,
+0x2404db18, 0x38c45cdd, 0xfdc5d475, 0x20245c28,
+0x6428fdc5, 0xfdc56024, 0x40244c28, 0xf458e5c5,
+0xf159cdc5, 0x000041b8, 0x75e3c400, 0x20246c69,
+0x28fdc510, 0xffffc092, 0xc2cdc5ff, 0xe2c400ed,
+0x0fea0f7d, 0x00019083, 0x0045b800, 0xe3c40000,
+0x247c7d75, 0xfdc51020, 0xffe0aa28, 0xcdc5ffff,
+0xcdc5f557, 0xc400f7c2, 0xf20f7de2, 0x0167830f,
+0xe5c50000, 0xe5c5dc5c, 0x49b8d959, 0xc4000000,
+0x746d75e3, 0xc5102024, 0x00f6c2e5, 0x0f7de2c4,
+0x42830ff2, 0xb8000001, 0x0000004d, 0x7975e3c4,
+0x10202474, 0xdd57e5c5, 0xdec2e5c5, 0x7de2c400,
+0x830fda0f, 0x00000121, 0x5c28fdc5, 0xe5c52024,
+0xfdc5f958, 0xb8243c29, 0x00000054, 0x69e5e3c4,
+0x4040247c, 0x3cc2c5c5, 0xe2c40024, 0x0ffa0f7d,
+0x0000f483, 0x0058b800, 0xe3c40000, 0x247c7de5,
+0xd5c54040, 0xc5243457, 0x00f7c2cd, 0x0f7de2c4,
+0xd2830ff2, 0xc5000000, 0xb8c95ce5, 0x0000005c,
+0x6de5e3c4, 0x40402474, 0xf6c2f5c5, 0x7de2c400,
+0x830ff20f, 0x000000b1, 0x000060b8, 0xe5e3c400,
+0x40247479, 0x57f5c540, 0xc2f5c5cd, 0xe2c400ce,
+0x0fca0f7d, 0x00009083, 0x59e5c500, 0xc540244c,
+0xc5f4d0f5, 0xc5e557dd, 0xb8ccd0f5, 0x00000068,
+0x6428fdc5, 0xe3c44024, 0x246c5de5, 0xcdc54060,
+0xc400f5c2, 0xf20f7de2, 0x6cb85f73, 0xc4000000,
+0x645fe5e3, 0xc5406024, 0x00e4c2f5, 0x0f7de2c4,
+0xc54673e2, 0x246459e5, 0xd0ddc540, 0xb8602464,
+0x00000072, 0x6c28fdc5, 0xe3c46024, 0x24745d65,
+0xddc55040, 0xc400e6c2, 0xe20f7de2, 0x76b81b73,
+0xc4000000, 0x5c5f65e3, 0xc5504024, 0x00cbc2f5,
+0x0f7de2c4, 0x310273ca, 0xfc5d8bc0, 0x148bc3c9,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x00000000, 0x00000000,
+0001214,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_f4[] = {
+0x64e800eb, 0x05000001, 0x00000189, 0x83e58955,
+0xfac570ec, 0xffe08810, 0xfac5ffff, 0xc59c4d11,
+0xa04d11fa, 0x4d11fac5, 0x10fac5a4, 0xe3c4a04d,
+0x9c4d6a71, 0x2ef8c510, 0xffffe488, 0xf08a0fff,
+0x0f000000, 0x0000ea85, 0x10fac500, 0xe3c4a04d,
+0x9c4d7e71, 0x2ef8c510, 0xffffe888, 0xd78a0fff,
+0x0f000000, 0x0000d185, 0x10fac500, 0xe8c5a04d,
+0xe3c4d257, 0x9c4d6e71, 0x2ef8c510, 0xbe8a0fca,
+0x0f000000, 0x0000b885, 0x10fac500, 0xe3c4a04d,
+0x9c4d7a71, 0x2ef8c510, 0xa98a0fca, 0x0f000000,
+0x0000a385, 0x10fac500, 0xfac59c4d, 0xc5a06510,
+0xc5d458f2, 0x9c7510fa, 0x7d10fac5, 0xc9e3c4a4,
+0x70a05d6a, 0xd32ef8c5, 0x00818a0f, 0x7f750000,
+0x9810fac5, 0xfffffff0, 0x6d10fac5, 0x10fac59c,
+0xe8c5a475, 0xe3c4d357, 0xa06d7ed1, 0x2ef8c560,
+0x75637aea, 0x5cf2c561, 0x10fac5cc, 0xfac59c7d,
+0xc4a46510, 0x556ec1e3, 0xf8c540a0, 0x4d7aca2e,
+0xfac54b75, 0xc59c6d10, 0xc5cb57f0, 0xa47510fa,
+0x7ad1e3c4, 0xc560a055, 0x7ad12ef8, 0x31357537,
+0xb836ebc0, 0x00000041, 0x45b82feb, 0xeb000000,
+0x0049b828, 0x21eb0000, 0x00004db8, 0xb81aeb00,
+0x00000054, 0x58b813eb, 0xeb000000, 0x005cb80c,
+0x05eb0000, 0x000060b8, 0x8bc3c900, 0x00c32404,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0000634,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_f8[] = {
+0xb6e800eb, 0x05000001, 0x000001f9, 0x81e58955,
+0x0000d0ec, 0x10fbc500, 0xffffd088, 0x11fbc5ff,
+0xffff388d, 0x11fbc5ff, 0xffff408d, 0x11fbc5ff,
+0xffff488d, 0x10fbc5ff, 0xffff408d, 0x71e3c4ff,
+0xff388d6b, 0xc510ffff, 0xd8882ef9, 0x0fffffff,
+0x0001308a, 0x2a850f00, 0xc5000001, 0x408d10fb,
+0xc4ffffff, 0x8d7f71e3, 0xffffff38, 0x2ef9c510,
+0xffffe088, 0x118a0fff, 0x0f000001, 0x00010b85,
+0x57e9c500, 0x10fbc5d2, 0xffff408d, 0x71e3c4ff,
+0xff388d6f, 0xc510ffff, 0x0fca2ef9, 0x0000f28a,
+0xec850f00, 0xc5000000, 0x408d10fb, 0xc4ffffff,
+0x8d7b71e3, 0xffffff38, 0x2ef9c510, 0xd78a0fca,
+0x0f000000, 0x0000d185, 0x10fbc500, 0xffff388d,
+0x10fbc5ff, 0xffff40a5, 0x58f3c5ff, 0x10fbc5d4,
+0xffff38b5, 0x10fbc5ff, 0xffff48bd, 0xc9e3c4ff,
+0xff409d6b, 0xc570ffff, 0x0fd32ef9, 0x0000a08a,
+0x9a850f00, 0xc5000000, 0x38ad10fb, 0xc5ffffff,
+0x48b510fb, 0xc5ffffff, 0xf0987efa, 0xc4ffffff,
+0xad7fd1e3, 0xffffff40, 0x57e9c560, 0x2ef9c5d3,
+0x75757aea, 0x5cf3c573, 0x10fbc5cc, 0xffff38bd,
+0x10fbc5ff, 0xffff48a5, 0xc1e3c4ff, 0xff40956f,
+0xc540ffff, 0x7aca2ef9, 0xc5547556, 0x38ad10fb,
+0xc5ffffff, 0x48b510fb, 0xc5ffffff, 0xc4cb57f1,
+0x957bd1e3, 0xffffff40, 0x2ef9c560, 0x75377ad1,
+0xebc03135, 0x0041b836, 0x2feb0000, 0x000045b8,
+0xb828eb00, 0x00000049, 0x4db821eb, 0xeb000000,
+0x0054b81a, 0x13eb0000, 0x000058b8, 0xb80ceb00,
+0x0000005c, 0x60b805eb, 0xc9000000, 0x24048bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0001014,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x002d48e8,
+0x48008000, 0x48f04589, 0xc5f84589, 0xe04d28f8,
+0x6871e3c4, 0xc510d05d, 0xb8d276e9, 0x00000041,
+0x1dc2e0c5, 0x00000197, 0x79e2c400, 0x830fda0e,
+0x00000180, 0x7c71e3c4, 0xb810d05d, 0x00000045,
+0x1dc2e0c5, 0x00000187, 0x79e2c400, 0x830fda0e,
+0x00000160, 0x6c71e3c4, 0xb810d05d, 0x00000049,
+0x1dc2e0c5, 0x00000177, 0x79e2c400, 0x830fda0e,
+0x00000140, 0x7871e3c4, 0xb810d05d, 0x0000004d,
+0x1dc2e0c5, 0x00000167, 0x79e2c400, 0x830fda0e,
+0x00000120, 0x5d28f8c5, 0x58e0c5d0, 0x28f8c5e1,
+0xe3c4f075, 0xe06d68e1, 0x0054b860, 0xd8c50000,
+0xc400edc2, 0xea0e79e2, 0x00f6830f, 0xe3c40000,
+0xe06d7ce1, 0x0058b860, 0xe2c40000, 0x1d351879,
+0xc5000001, 0xc5e657d8, 0x00e5c2d8, 0x0e79e2c4,
+0xcd830fe2, 0xc5000000, 0xc5c95ce0, 0xf06d28f8,
+0x6ce1e3c4, 0xb850e065, 0x0000005c, 0xe4c2f0c5,
+0x79e2c400, 0x830fe20e, 0x000000a8, 0x78e1e3c4,
+0xc550e065, 0xb8ce57f0, 0x00000060, 0xccc2f0c5,
+0x79e2c400, 0x830fca0e, 0x00000088, 0x4d59e0c5,
+0x57c8c5e0, 0xf3c5f065, 0xf3c5edd0, 0xf8c5ccd0,
+0xc4e06528, 0x755ce1e3, 0x68b840f0, 0xc5000000,
+0x00eec2d0, 0x0e79e2c4, 0xc45973ea, 0x655ee1e3,
+0x6cb840f0, 0xc5000000, 0x00e4c2f0, 0x0e79e2c4,
+0xc54173e2, 0xe06559e0, 0x65d0dbc5, 0x28f8c5f0,
+0xe3c4f06d, 0xe0755c61, 0x0072b850, 0xd8c50000,
+0xc400e6c2, 0xe20e79e2, 0xe3c41a73, 0xe05d5e61,
+0x0076b850, 0xf0c50000, 0xc400cbc2, 0xca0e79e2,
+0xc0310273, 0x0000c35d, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001100,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x020a0d10, 0xfbc50000,
+0x01ca1510, 0xfbc50000, 0xc5d04d11, 0xe05511fb,
+0x4d11fbc5, 0x11fbc5f0, 0xfbc5d855, 0xc5e84d11,
+0xf84d11fb, 0x4d28f9c5, 0x71e3c4e0, 0x10d05d69,
+0xd276e9c5, 0x000041b8, 0xc2e1c500, 0x00019e1d,
+0xe2c40000, 0x0fda0f79, 0x00017f83, 0x71e3c400,
+0x10d05d7d, 0x000045b8, 0xc2e1c500, 0x00018e1d,
+0xe2c40000, 0x0fda0f79, 0x00015f83, 0x71e3c400,
+0x10d05d6d, 0x000049b8, 0xc2e1c500, 0x00017e1d,
+0xe2c40000, 0x0fda0f79, 0x00013f83, 0x71e3c400,
+0x10d05d79, 0x00004db8, 0xc2e1c500, 0x00016e1d,
+0xe2c40000, 0x0fda0f79, 0x00011f83, 0x28f9c500,
+0xe1c5d05d, 0xf9c5e158, 0xc4f07528, 0x6d69e1e3,
+0x54b860e0, 0xc5000000, 0x00edc2d9, 0x0f79e2c4,
+0xf5830fea, 0xc4000000, 0x6d7de1e3, 0xfbc560e0,
+0x012a3512, 0xd9c50000, 0x58b8e657, 0xc5000000,
+0x00e5c2d9, 0x0f79e2c4, 0xcd830fe2, 0xc5000000,
+0xc5c95ce1, 0xf06d28f9, 0x6de1e3c4, 0xb850e065,
+0x0000005c, 0xe4c2f1c5, 0x79e2c400, 0x830fe20f,
+0x000000a8, 0x79e1e3c4, 0xc550e065, 0xb8ce57f1,
+0x00000060, 0xccc2f1c5, 0x79e2c400, 0x830fca0f,
+0x00000088, 0x4d59e1c5, 0x57c9c5e0, 0xf1c5f065,
+0xf1c5edd0, 0xf9c5ccd0, 0xc4e06528, 0x755de1e3,
+0x68b840f0, 0xc5000000, 0x00eec2d1, 0x0f79e2c4,
+0xc45973ea, 0x655fe1e3, 0x6cb840f0, 0xc5000000,
+0x00e4c2f1, 0x0f79e2c4, 0xc54173e2, 0xe06559e1,
+0x65d0d9c5, 0x28f9c5f0, 0xe3c4f06d, 0xe0755d61,
+0x0072b850, 0xd9c50000, 0xc400e6c2, 0xe20f79e2,
+0xe3c41a73, 0xe05d5f61, 0x0076b850, 0xf1c50000,
+0xc400cbc2, 0xca0f79e2, 0xc0310273, 0x0000c35d,
+0x00000000, 0x40000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001060,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_32f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x0d10fac5, 0x000001f4, 0xd02aeac5,
+0xfac5ca89, 0xdc844c11, 0xfac5c229, 0x9c845411,
+0xd22aeac5, 0x5411fac5, 0xff48bc84, 0xf88348c0,
+0xc5d97509, 0x245c28fc, 0x28fcc5a0, 0xc5e02464,
+0x244c28fc, 0x58e4c5c0, 0x59d4c5ec, 0x75e3c4e9,
+0xa0247468, 0x0041b810, 0xe2c40000, 0xa115187d,
+0xc5000001, 0x00f6c2d4, 0x0e7de2c4, 0x8a830ff2,
+0xc4000001, 0x7c7c75e3, 0xb810a024, 0x00000045,
+0x187de2c4, 0x00017f35, 0x57d4c500, 0xc2d4c5ee,
+0xe2c400ef, 0x0fea0e7d, 0x00016083, 0x5ce4c500,
+0x59e4c5dc, 0x75e3c4d9, 0xa0246c6c, 0x0049b810,
+0xe4c50000, 0xc400edc2, 0xea0e7de2, 0x013b830f,
+0xe3c40000, 0x246c7875, 0xe4c510a0, 0x4db8de57,
+0xc5000000, 0x00ddc2e4, 0x0e7de2c4, 0x1a830fda,
+0xc5000001, 0x245c28fc, 0x58e4c5a0, 0xe5e3c4e9,
+0xc0247c68, 0x0054b840, 0xd4c50000, 0xc400ffc2,
+0xfa0e7de2, 0x00f3830f, 0xe3c40000, 0x247c7ce5,
+0xd4c540c0, 0x58b8ee57, 0xc5000000, 0x00efc2d4,
+0x0e7de2c4, 0xd2830fea, 0xc5000000, 0xc4c95ce4,
+0x6c6ce5e3, 0xb840c024, 0x0000005c, 0xedc2f4c5,
+0x7de2c400, 0x830fea0e, 0x000000b1, 0x78e5e3c4,
+0x40c0246c, 0xce57f4c5, 0x000060b8, 0xc2f4c500,
+0xe2c400cd, 0x0fca0e7d, 0x00009083, 0x59e4c500,
+0xc5c0244c, 0xc5ecd0f7, 0xc5e657dc, 0xc5ccd0f7,
+0x246428fc, 0xe5e3c4c0, 0xe024745c, 0x0068b840,
+0xd4c50000, 0xc400eec2, 0xea0e7de2, 0xe3c45f73,
+0x24645ee5, 0x6cb840e0, 0xc5000000, 0x00e4c2f4,
+0x0e7de2c4, 0xc54673e2, 0x246459e4, 0xd0dfc5c0,
+0xc5e02464, 0x246c28fc, 0x65e3c4e0, 0xc024745c,
+0x0072b850, 0xdcc50000, 0xc400e6c2, 0xe20e7de2,
+0xe3c41b73, 0x245c5e65, 0x76b850c0, 0xc5000000,
+0x00cbc2f4, 0x0e7de2c4, 0x310273ca, 0x00c3c9c0,
+0x3f800000, 0xffffffff, 0x80000000,
+0001034,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0xfbc5e0e4, 0x022e0d10,
+0xfbc50000, 0x02961510, 0xfbc50000, 0x02261d10,
+0xfbc50000, 0x027e2510, 0xfbc50000, 0xa0244c11,
+0x5411fbc5, 0xfbc5c024, 0xe0244c11, 0x5c11fbc5,
+0xfbc5a824, 0xc8246411, 0x4c11fbc5, 0xfbc5e824,
+0xb0246411, 0x5c11fbc5, 0xfbc5d024, 0xf0244c11,
+0x5411fbc5, 0xfbc5b824, 0xd8244c11, 0x4c11fbc5,
+0xfdc5f824, 0xc0244c28, 0x6975e3c4, 0x10a0245c,
+0x000041b8, 0x7de2c400, 0x01c21519, 0xe5c50000,
+0x01c91dc2, 0xc4000000, 0xda0f7de2, 0x0194830f,
+0xe3c40000, 0x245c7d75, 0x45b810a0, 0xc5000000,
+0xc81dc2e5, 0x00000001, 0x0f7de2c4, 0x73830fda,
+0xc4000001, 0x5c6d75e3, 0xb810a024, 0x00000049,
+0x1dc2e5c5, 0x000001c7, 0x7de2c400, 0x830fda0f,
+0x00000152, 0x7975e3c4, 0x10a0245c, 0x00004db8,
+0xc2e5c500, 0x0001c61d, 0xe2c40000, 0x0fda0f7d,
+0x00013183, 0x28fdc500, 0xc5a0245c, 0xc5e158e5,
+0x247428fd, 0xe5e3c4e0, 0xc0246c69, 0x0054b860,
+0xddc50000, 0xc400edc2, 0xea0f7de2, 0x0104830f,
+0xe3c40000, 0x246c7de5, 0x58b860c0, 0xc4000000,
+0x35197de2, 0x00000178, 0xe657ddc5, 0xe5c2ddc5,
+0x7de2c400, 0x830fe20f, 0x000000da, 0xc95ce5c5,
+0x6c28fdc5, 0xe3c4e024, 0x24646de5, 0x5cb850c0,
+0xc5000000, 0x00e4c2f5, 0x0f7de2c4, 0xb3830fe2,
+0xc4000000, 0x6479e5e3, 0xc550c024, 0xb8ce57f5,
+0x00000060, 0xccc2f5c5, 0x7de2c400, 0x830fca0f,
+0x00000092, 0x4c59e5c5, 0xcdc5c024, 0xe0246457,
+0xedd0f5c5, 0xccd0f5c5, 0x6428fdc5, 0xe3c4c024,
+0x24745de5, 0x68b840e0, 0xc5000000, 0x00eec2d5,
+0x0f7de2c4, 0xc45f73ea, 0x645fe5e3, 0xb840e024,
+0x0000006c, 0xe4c2f5c5, 0x7de2c400, 0x4673e20f,
+0x6459e5c5, 0xddc5c024, 0xe02464d0, 0x6c28fdc5,
+0xe3c4e024, 0x24745d65, 0x72b850c0, 0xc5000000,
+0x00e6c2dd, 0x0f7de2c4, 0xc41b73e2, 0x5c5f65e3,
+0xb850c024, 0x00000076, 0xcbc2f5c5, 0x7de2c400,
+0x0273ca0f, 0xc3c9c031, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0001340,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_f4[] = {
+0x485500eb, 0xfac5e589, 0x01520d10, 0xfac50000,
+0xc59c4d11, 0xa04d11fa, 0x4d11fac5, 0x10fac5a4,
+0xe3c4a04d, 0x9c4d6a71, 0x2ef8c510, 0x0001330d,
+0xf08a0f00, 0x0f000000, 0x0000ea85, 0x10fac500,
+0xe3c4a04d, 0x9c4d7e71, 0x2ef8c510, 0x0001170d,
+0xd78a0f00, 0x0f000000, 0x0000d185, 0x10fac500,
+0xe3c4a04d, 0x9c4d6e71, 0x57e8c510, 0x2ef8c5d2,
+0xbe8a0fca, 0x0f000000, 0x0000b885, 0x10fac500,
+0xe3c4a04d, 0x9c4d7a71, 0x2ef8c510, 0xa98a0fca,
+0x0f000000, 0x0000a385, 0x10fac500, 0xfac59c4d,
+0xc5a06510, 0xc5d458f2, 0x9c7510fa, 0x7d10fac5,
+0xc9e3c4a4, 0x70a05d6a, 0xd32ef8c5, 0x00818a0f,
+0x7f750000, 0x6d10fac5, 0x10fac59c, 0xfac5a475,
+0x009a1d10, 0xe3c40000, 0xa06d7ed1, 0x57e8c560,
+0x2ef8c5d3, 0x75637aea, 0x5cf2c561, 0x10fac5cc,
+0xfac59c7d, 0xc4a46510, 0x556ec1e3, 0xf8c540a0,
+0x4d7aca2e, 0xfac54b75, 0xc59c6d10, 0xa47510fa,
+0xcb57f0c5, 0x7ad1e3c4, 0xc560a055, 0x7ad12ef8,
+0x31357537, 0xb836ebc0, 0x00000041, 0x45b82feb,
+0xeb000000, 0x0049b828, 0x21eb0000, 0x00004db8,
+0xb81aeb00, 0x00000054, 0x58b813eb, 0xeb000000,
+0x005cb80c, 0x05eb0000, 0x000060b8, 0x00c35d00,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000600,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0xfbc558ec, 0x01ae0d10,
+0xfbc50000, 0xff388d11, 0xfbc5ffff, 0xff408d11,
+0xfbc5ffff, 0xff488d11, 0xfbc5ffff, 0xff408d10,
+0xe3c4ffff, 0x388d6b71, 0x10ffffff, 0x0d2ef9c5,
+0x00000184, 0x01308a0f, 0x850f0000, 0x0000012a,
+0x8d10fbc5, 0xffffff40, 0x7f71e3c4, 0xffff388d,
+0xf9c510ff, 0x01660d2e, 0x8a0f0000, 0x00000111,
+0x010b850f, 0xfbc50000, 0xff408d10, 0xe9c5ffff,
+0xe3c4d257, 0x388d6f71, 0x10ffffff, 0xca2ef9c5,
+0x00f28a0f, 0x850f0000, 0x000000ec, 0x8d10fbc5,
+0xffffff40, 0x7b71e3c4, 0xffff388d, 0xf9c510ff,
+0x8a0fca2e, 0x000000d7, 0x00d1850f, 0xfbc50000,
+0xff388d10, 0xfbc5ffff, 0xff40a510, 0xf3c5ffff,
+0xfbc5d458, 0xff38b510, 0xfbc5ffff, 0xff48bd10,
+0xe3c4ffff, 0x409d6bc9, 0x70ffffff, 0xd32ef9c5,
+0x00a08a0f, 0x850f0000, 0x0000009a, 0xad10fbc5,
+0xffffff38, 0xb510fbc5, 0xffffff48, 0x7fd1e3c4,
+0xffff40ad, 0xfac560ff, 0x00c21d7e, 0xe9c50000,
+0xf9c5d357, 0x757aea2e, 0xf3c57375, 0xfbc5cc5c,
+0xff38bd10, 0xfbc5ffff, 0xff48a510, 0xe3c4ffff,
+0x40956fc1, 0x40ffffff, 0xca2ef9c5, 0x5475567a,
+0xad10fbc5, 0xffffff38, 0xb510fbc5, 0xffffff48,
+0xcb57f1c5, 0x7bd1e3c4, 0xffff4095, 0xf9c560ff,
+0x377ad12e, 0xc0313575, 0x41b836eb, 0xeb000000,
+0x0045b82f, 0x28eb0000, 0x000049b8, 0xb821eb00,
+0x0000004d, 0x54b81aeb, 0xeb000000, 0x0058b813,
+0x0ceb0000, 0x00005cb8, 0xb805eb00, 0x00000060,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000760,
+};
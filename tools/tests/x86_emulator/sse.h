@@ -0,0 +1,237 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01fde8c3,
+0xc2810000, 0x0000023e, 0x8955e8d9, 0x68ec83e5,
+0xd9c855d9, 0xffffd082, 0xd855d9ff, 0x55d9c9d9,
+0xf082d9e8, 0xd9ffffff, 0x82d9cc55, 0xffffffd4,
+0xd9dc55d9, 0xd9e0d9e8, 0xc9d9ec55, 0xd9d05dd9,
+0xe05dd9c9, 0x55d9c9d9, 0xd9cad9f0, 0xc9d9d45d,
+0xd9e45dd9, 0x280ff45d, 0x290fc86d, 0x280f986d,
+0x60b89845, 0x0f000002, 0xc20fc828, 0x500f00cd,
+0x0ff983c9, 0x0183850f, 0x280f0000, 0x580fc84d,
+0x4d290fc8, 0x4d280fa8, 0x0266b8c8, 0x580f0000,
+0x4dc20fc9, 0x500f00a8, 0x0ff983c9, 0x015b850f,
+0x280f0000, 0x5c0fa84d, 0x290fc84d, 0x280fb84d,
+0x026bb8c8, 0xc20f0000, 0x0f00b84d, 0xf983c950,
+0x36850f0f, 0x0f000001, 0x0fd85528, 0x0fc84559,
+0x280fd259, 0x280fc84d, 0x580fd865, 0xd9280fe1,
+0x000282b8, 0x5d5c0f00, 0xc25c0fd8, 0x0fdc590f,
+0x0f00c3c2, 0xf983c850, 0xfe850f0f, 0x0f000000,
+0x0fe84528, 0x290fc159, 0x5e0f9845, 0x8bb8e84d,
+0x0f000002, 0x0f00c1c2, 0xf983c850, 0xda850f0f,
+0x0f000000, 0xb8e84d28, 0x0000028e, 0xe09a280f,
+0x0fffffff, 0x280fd128, 0x570fc845, 0x55590fd3,
+0xd8570f98, 0x00d3c20f, 0x83ca500f, 0x850f0ff9,
+0x000000a9, 0x0fd0280f, 0x290fd059, 0x510f9855,
+0xa7b89855, 0x0f000002, 0x0f00d0c2, 0xf983ca50,
+0x86850f0f, 0x0f000000, 0x590fd028, 0x4d590fd1,
+0x4d290fd8, 0xca280fa8, 0xa84d5f0f, 0xa8555d0f,
+0xa855290f, 0xa84d580f, 0x000348b8, 0x4d590f00,
+0x45580fe8, 0xc1c20fd8, 0xc8500f00, 0x750ff983,
+0x45280f4c, 0x0359b8c8, 0xc60f0000, 0xc20f1bc0,
+0x0f00d845, 0xf983c850, 0x0f32750f, 0x0fd84528,
+0x0fc84514, 0x0fd84d28, 0x0fc84d15, 0x590fc15c,
+0xc20fe845, 0xfffff082, 0x70ba00ff, 0x0f000003,
+0xf883c050, 0x0000b80f, 0x450f0000, 0x8bc3c9c2,
+0x00c32414, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40400000, 0x00000000, 0x00000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0x00000000, 0x00000000, 0x00000000,
+0001134,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_32_D_f4[] = {
+0x895520eb, 0x558d52e5, 0xfc4589fc, 0x3c80c031,
+0x0a75ff10, 0x04f88340, 0x01b0f475, 0xc03102eb,
+0x8955c3c9, 0xfde853e5, 0x81000003, 0x000425c3,
+0xd4ec8100, 0xf3000000, 0xe083100f, 0xf3ffffff,
+0x4c85110f, 0xf3ffffff, 0x5085110f, 0xf3ffffff,
+0x5485110f, 0x8bffffff, 0xffff4c85, 0x408589ff,
+0xf3ffffff, 0x4085100f, 0x31ffffff, 0x0000b9c0,
+0x2e0f0000, 0xffff4c85, 0xc09b0fff, 0xf7c1450f,
+0xff7ce8d8, 0xc288ffff, 0x000260b8, 0x0fd28400,
+0x00038a84, 0x100ff300, 0xffff4085, 0x580ff3ff,
+0xffff4c85, 0x110ff3ff, 0xffff4485, 0x100ff3ff,
+0xffff4c85, 0xf3c031ff, 0x0fc0580f, 0xff44852e,
+0x9b0fffff, 0xc1450fc0, 0x33e8d8f7, 0x88ffffff,
+0x0266b8c2, 0xd2840000, 0x0341840f, 0x0ff30000,
+0xff448510, 0x0ff3ffff, 0xff4c855c, 0x0ff3ffff,
+0xff288511, 0x858bffff, 0xffffff28, 0xff7c8589,
+0x8589ffff, 0xffffff44, 0xff488589, 0x0ff3ffff,
+0xff408510, 0xc031ffff, 0x48852e0f, 0x0fffffff,
+0x450fc09b, 0xe8d8f7c1, 0xfffffed6, 0x6bb8c288,
+0x84000002, 0xe4840fd2, 0xf3000002, 0x4085100f,
+0xf3ffffff, 0x4c85590f, 0xf3ffffff, 0x4085110f,
+0xf3ffffff, 0x5085100f, 0xf3ffffff, 0xf3c0590f,
+0x4485110f, 0xf3ffffff, 0x4c85100f, 0xf3ffffff,
+0x5085580f, 0xf3ffffff, 0x4885110f, 0xf3ffffff,
+0x4c85100f, 0x31ffffff, 0x100ff3c0, 0xffff4095,
+0xc8280fff, 0x8d5c0ff3, 0xffffff50, 0x955c0ff3,
+0xffffff44, 0x8d590ff3, 0xffffff48, 0x8d110ff3,
+0xffffff48, 0x0fd12e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffe3e, 0x82b8c288, 0x84000002, 0x4c840fd2,
+0xf3000002, 0x5485590f, 0xf3ffffff, 0x4085110f,
+0xf3ffffff, 0x4c85100f, 0x31ffffff, 0x5e0ff3c0,
+0xffff5485, 0x852e0fff, 0xffffff40, 0x85110ff3,
+0xffffff44, 0x0fc09b0f, 0xd8f7c145, 0xfffdf1e8,
+0xb8c288ff, 0x0000028b, 0x840fd284, 0x000001ff,
+0x93100ff3, 0xfffffff0, 0x0ff3c031, 0xff548510,
+0x0ff3ffff, 0xff4c8d10, 0x570fffff, 0x590ff3c2,
+0xffff4085, 0xca570fff, 0x0fc12e0f, 0x450fc09b,
+0xe8d8f7c1, 0xfffffdaa, 0x8eb8c288, 0x84000002,
+0xb8840fd2, 0xf3000001, 0x4c85530f, 0xf3ffffff,
+0x4085110f, 0xf3ffffff, 0x408d530f, 0xf3ffffff,
+0xf3c12c0f, 0x4c85100f, 0xf3ffffff, 0x31c82a0f,
+0xc82e0fc0, 0x0fc09b0f, 0xd8f7c145, 0xfffd61e8,
+0xb8c288ff, 0x00000296, 0x840fd284, 0x0000016f,
+0xc0590ff3, 0x85110ff3, 0xffffff40, 0x85520ff3,
+0xffffff40, 0x85110ff3, 0xffffff44, 0x85530ff3,
+0xffffff44, 0xc02c0ff3, 0xc02a0ff3, 0x2e0fc031,
+0xffff4c85, 0xc09b0fff, 0xf7c1450f, 0xfd10e8d8,
+0xc288ffff, 0x00029db8, 0x0fd28400, 0x00011e84,
+0x2c0ff300, 0xffff4485, 0x530ff3ff, 0xffff4c85,
+0x2a0ff3ff, 0x2c0ff3c8, 0x2a0ff3c0, 0x0fc031c0,
+0x9b0fc82e, 0xc1450fc0, 0xd3e8d8f7, 0x88fffffc,
+0x029fb8c2, 0xd2840000, 0x00e1840f, 0x0ff30000,
+0xff4c8510, 0x0ff3ffff, 0x0ff3c059, 0xff408511,
+0x0ff3ffff, 0xff4c8d10, 0xc031ffff, 0x85510ff3,
+0xffffff40, 0x0fc12e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffc8e, 0xa7b8c288, 0x84000002, 0x9c840fd2,
+0xf3000000, 0x5485100f, 0xf3ffffff, 0xf3c8590f,
+0x5085590f, 0xf3ffffff, 0x408d110f, 0xf3ffffff,
+0x4485110f, 0xf3ffffff, 0x4085100f, 0xf3ffffff,
+0x44855f0f, 0xf3ffffff, 0x4885110f, 0xf3ffffff,
+0x4085100f, 0xf3ffffff, 0x44855d0f, 0xf3ffffff,
+0x4485110f, 0xf3ffffff, 0x4485100f, 0x31ffffff,
+0x100ff3c0, 0xffff4c8d, 0x0000baff, 0x0ff30000,
+0xff488558, 0x0ff3ffff, 0xff508d58, 0x0ff3ffff,
+0xff548559, 0x2e0fffff, 0xc09b0fc1, 0xf7c2450f,
+0xfbece8d8, 0x013cffff, 0x4825c019, 0x81000003,
+0x0000d4c4, 0xc35d5b00, 0xc3241c8b, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002134,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd06d28, 0x0fa06d29, 0xb8a04528, 0x00000260,
+0x0fc8280f, 0x0f00cdc2, 0xfa83d150, 0x83850f0f,
+0x0f000002, 0x0fd04d28, 0x290fc858, 0x280fb04d,
+0x66b8d04d, 0x0f000002, 0xc20fc958, 0x0f00b04d,
+0xfa83d150, 0x5b850f0f, 0x0f000002, 0x0fb04d28,
+0x0fd04d5c, 0x0fc04d29, 0x6bb8c828, 0x0f000002,
+0x00c04dc2, 0x83d1500f, 0x850f0ffa, 0x00000236,
+0xe04d280f, 0xd045590f, 0x0fd1280f, 0x280fd159,
+0x280fd04d, 0x580fe065, 0xd9280fe1, 0xe05d5c0f,
+0xb8c25c0f, 0x00000282, 0x0fdc590f, 0x0f00c3c2,
+0xfa83d050, 0xfb850f0f, 0x0f000001, 0x0ff04528,
+0x290fc159, 0x5e0fa045, 0xc20ff04d, 0x8bb800c1,
+0x0f000002, 0xfa83d050, 0xd7850f0f, 0x0f000001,
+0xf3f05528, 0xcd0d100f, 0xb8000001, 0x0000028e,
+0x0fc2280f, 0x0f00c9c6, 0x570fc157, 0x590fd04d,
+0xc20fa045, 0x500f00c1, 0x0ffa83d0, 0x01a4850f,
+0x530f0000, 0x290fd045, 0x530fa045, 0x280fa045,
+0x96b8d04d, 0x66000002, 0x0fc05b0f, 0xc20fc05b,
+0x500f00c1, 0x0ffa83d0, 0x0178850f, 0x280f0000,
+0xc1590fc1, 0xa045290f, 0xa045520f, 0xb045290f,
+0xb045280f, 0x00029db8, 0xd8530f00, 0xdb5b0f66,
+0x0fdb5b0f, 0x0f00cbc2, 0xfa83d150, 0x43850f0f,
+0x66000001, 0x0fc85b0f, 0x0fd04528, 0x9fb8c95b,
+0x0f000002, 0x0f66d853, 0x5b0fdb5b, 0xcbc20fdb,
+0xd1500f00, 0x0f0ffa83, 0x00011985, 0xc8280f00,
+0x0fc8590f, 0x0fa04d29, 0xb8a04d51, 0x000002a7,
+0x00c8c20f, 0x83d1500f, 0x850f0ffa, 0x000000f6,
+0xe04d280f, 0x0fd8280f, 0x590fda59, 0x4d290fca,
+0xcb280fb0, 0xb04d5f0f, 0xb05d5d0f, 0xb05d290f,
+0xb04d580f, 0xe045580f, 0x000348b8, 0xca590f00,
+0x00c1c20f, 0x83d0500f, 0x850f0ffa, 0x000000b6,
+0xd045280f, 0x000359b8, 0xc0c60f00, 0x45c20f1b,
+0x500f00e0, 0x0ffa83d0, 0x0098850f, 0x280f0000,
+0x280fe04d, 0x45140fc1, 0x4d150fd0, 0xc15c0fd0,
+0x0d100ff3, 0x00000084, 0x000370b8, 0xc9c60f00,
+0xc2590f00, 0xc045290f, 0x00c1c20f, 0x83d0500f,
+0x62750ffa, 0xd04d280f, 0x45100ff3, 0x7d8d48e4,
+0x0000bac0, 0x0ff30000, 0x0fb44511, 0x150fc128,
+0x110ff3c1, 0x0ff3b04d, 0xf3b84511, 0xec45100f,
+0x45110ff3, 0xc0570fbc, 0x01c2c20f, 0xc8f70f66,
+0xc9760f66, 0xe075280f, 0x66c1570f, 0x0ff0f70f,
+0x0fc04528, 0x00b045c2, 0x83c0500f, 0xc4b80ff8,
+0x0f000003, 0xc35dc244, 0x80000000, 0x40000000,
+0001400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8148e589, 0x0000d0ec,
+0x100ff300, 0x0003f705, 0x110ff300, 0xffff5485,
+0x110ff3ff, 0xffff5885, 0x110ff3ff, 0xffff5c85,
+0x54858bff, 0x89ffffff, 0xffff4885, 0xf3ff31ff,
+0x4885100f, 0xb9ffffff, 0x00000000, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xffff81e8,
+0xb8c289ff, 0x00000260, 0x840fd284, 0x00000391,
+0x85100ff3, 0xffffff48, 0x85580ff3, 0xffffff54,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff54,
+0x0ff3ff31, 0x2e0fc058, 0xffff4c85, 0x9b0f40ff,
+0xf9450fc7, 0x37e8dff7, 0x89ffffff, 0x0266b8c2,
+0xd2840000, 0x0347840f, 0x0ff30000, 0xff4c8510,
+0x0ff3ffff, 0xff54855c, 0x0ff3ffff, 0xff308511,
+0x858bffff, 0xffffff30, 0x89844589, 0xffff4c85,
+0x508589ff, 0x31ffffff, 0x100ff3ff, 0xffff4885,
+0x852e0fff, 0xffffff50, 0xc79b0f40, 0xf7f9450f,
+0xfedce8df, 0xc289ffff, 0x00026bb8, 0x0fd28400,
+0x0002ec84, 0x100ff300, 0xffff4885, 0x590ff3ff,
+0xffff5485, 0x110ff3ff, 0xffff4885, 0x100ff3ff,
+0xffff5885, 0x590ff3ff, 0x110ff3c0, 0xffff4c85,
+0x100ff3ff, 0xffff5485, 0x580ff3ff, 0xffff5885,
+0x110ff3ff, 0xffff5085, 0x100ff3ff, 0xffff5485,
+0x100ff3ff, 0xffff4895, 0xf3ff31ff, 0x4c955c0f,
+0x0fffffff, 0x0ff3c828, 0xff588d5c, 0x0ff3ffff,
+0xff508d59, 0x2e0fffff, 0x110ff3d1, 0xffff508d,
+0x9b0f40ff, 0xf9450fc7, 0x43e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x0253840f, 0x0ff30000,
+0xff5c8559, 0x0ff3ffff, 0xff488511, 0xff31ffff,
+0x85100ff3, 0xffffff54, 0x855e0ff3, 0xffffff5c,
+0x48852e0f, 0xf3ffffff, 0x4c85110f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffdf5e8, 0xb8c289ff,
+0x0000028b, 0x840fd284, 0x00000205, 0x85100ff3,
+0xffffff5c, 0x15100ff3, 0x00000214, 0x8d100ff3,
+0xffffff54, 0x570fff31, 0xca570fc2, 0x85590ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffdade8, 0xb8c289ff, 0x0000028e, 0x840fd284,
+0x000001bd, 0x85530ff3, 0xffffff54, 0x85110ff3,
+0xffffff48, 0x8d530ff3, 0xffffff48, 0xc12c0ff3,
+0x85100ff3, 0xffffff54, 0x0ff3ff31, 0x2e0fc82a,
+0x9b0f40c8, 0xf9450fc7, 0x63e8dff7, 0x89fffffd,
+0x0296b8c2, 0xd2840000, 0x0173840f, 0x0ff30000,
+0x0ff3c059, 0xff488511, 0x0ff3ffff, 0xff488552,
+0x0ff3ffff, 0xff4c8511, 0x0ff3ffff, 0xff4c8553,
+0x0ff3ffff, 0xff31c02c, 0xc02a0ff3, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000029d, 0x840fd284, 0x00000121,
+0x852c0ff3, 0xffffff4c, 0x0ff3ff31, 0xff548553,
+0x0ff3ffff, 0x0ff3c82a, 0x0ff3c02c, 0x2e0fc02a,
+0x9b0f40c8, 0xf9450fc7, 0xd3e8dff7, 0x89fffffc,
+0x029fb8c2, 0xd2840000, 0x00e3840f, 0x0ff30000,
+0xff548510, 0x0ff3ffff, 0x0ff3c059, 0xff488511,
+0x0ff3ffff, 0xff548d10, 0xff31ffff, 0x85510ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffc8de8, 0xb8c289ff, 0x000002a7, 0x840fd284,
+0x0000009d, 0x85100ff3, 0xffffff5c, 0xc8590ff3,
+0x85590ff3, 0xffffff58, 0x8d110ff3, 0xffffff48,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff48,
+0x855f0ff3, 0xffffff4c, 0x85110ff3, 0xffffff50,
+0x85100ff3, 0xffffff48, 0x855d0ff3, 0xffffff4c,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff4c,
+0x85580ff3, 0xffffff50, 0x00b8ff31, 0xf3000000,
+0x5c85590f, 0xf3ffffff, 0x548d100f, 0xf3ffffff,
+0x588d580f, 0x0fffffff, 0x0f40c12e, 0x450fc79b,
+0xe8dff7f8, 0xfffffbea, 0xc019013c, 0x00034825,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002120,
+};
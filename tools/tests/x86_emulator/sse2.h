@@ -0,0 +1,1706 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0196e8c3,
+0xc1810000, 0x000001be, 0x895501b2, 0x315657e5,
+0x11b353f6, 0x887cec83, 0x88a83554, 0x88d028d8,
+0x89b83544, 0x01e083f0, 0x1901f883, 0x24c2fec0,
+0x88c8fe02, 0x46c83544, 0x7510fe83, 0x75280fda,
+0xb5290fa8, 0xffffff78, 0x788d280f, 0xb8ffffff,
+0x00000260, 0x66c1280f, 0x66c6740f, 0x81d0d70f,
+0x00fffffa, 0x25850f00, 0x0f000001, 0x66a84528,
+0x0fc1fc0f, 0x0f884529, 0xb8a84528, 0x00000266,
+0xc0fc0f66, 0x45740f66, 0xd70f6688, 0xfffa81d0,
+0x0f0000ff, 0x0000f785, 0x45280f00, 0xf80f6688,
+0x290fa845, 0x0f669845, 0x66984d74, 0x81d1d70f,
+0x00fffffa, 0x026bb800, 0x850f0000, 0x000000d0,
+0xb855280f, 0x66da280f, 0xa85d600f, 0x789d290f,
+0x0fffffff, 0x0f66ca28, 0x0fa84d68, 0x0f884d29,
+0x66c84528, 0xb8d9f80f, 0x00000370, 0x0feb280f,
+0x0f66e028, 0x0f66eb60, 0x280fdb68, 0x680f66c8,
+0xd50f66e0, 0x600f66e3, 0x99280fc8, 0xffffffe0,
+0xcdd50f66, 0x0fcb540f, 0x0f66dc54, 0x290fcb67,
+0x0f66984d, 0xfff08974, 0x0f66ffff, 0xfa81d1d7,
+0x0000ffff, 0x280f5a75, 0xc031a84d, 0xa8da280f,
+0x0f037501, 0x290fd928, 0x548ad85d, 0x5488d805,
+0x83408805, 0xe47510f8, 0x8ddb570f, 0x00ba987d,
+0x66000000, 0x66c3640f, 0x66c8f70f, 0x0fc9760f,
+0x0f66c155, 0x280fd0f7, 0x0f669845, 0x66884574,
+0x3dc0d70f, 0x0000ffff, 0x0003c4b8, 0xc2440f00,
+0x5b7cc483, 0xc35d5f5e, 0xc3240c8b, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x00000000, 0x00000000, 0x00000000,
+0000734,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01e5e8c3,
+0xc2810000, 0x000001fe, 0x895501b0, 0x315657e5,
+0x11b353f6, 0x887cec83, 0x88a83544, 0xfec128d9,
+0x354c88c0, 0x83f189b8, 0xc9fe01e1, 0xc8354c88,
+0x10fe8346, 0x280fe175, 0x290fa875, 0xffff78b5,
+0x8d280fff, 0xffffff78, 0x000260b8, 0xc1280f00,
+0xc6740f66, 0xc8d70f66, 0xfffff981, 0x850f0000,
+0x0000017b, 0xa845280f, 0xc1fc0f66, 0x8845290f,
+0xa845280f, 0x000266b8, 0xfc0f6600, 0x740f66c0,
+0x0f668845, 0xf981c8d7, 0x0000ffff, 0x014d850f,
+0x280f0000, 0x0f668845, 0x0fa845f8, 0x0f984529,
+0x6bb8d128, 0x66000002, 0x9855740f, 0xcad70f66,
+0xfffff981, 0x850f0000, 0x00000123, 0xb84d560f,
+0x788d290f, 0x0fffffff, 0x0fb84554, 0x0f984d28,
+0x0fb84d57, 0xff788555, 0x77b8ffff, 0x66000002,
+0x66db760f, 0x66c1740f, 0x81c8d70f, 0x00fffff9,
+0xe8850f00, 0x0f000000, 0x0fa84d28, 0x66b84528,
+0x0fc1da0f, 0x66b85528, 0x66d1de0f, 0xb84dfc0f,
+0xc2fc0f66, 0x00033fb8, 0x740f6600, 0xd70f66c1,
+0xfff981c8, 0x0f0000ff, 0x0000b285, 0x55280f00,
+0xe2280fb8, 0x65600f66, 0xa5290fa8, 0xffffff78,
+0x66c2280f, 0xa845680f, 0xc84d280f, 0xc3fc0f66,
+0x000370b8, 0xf80f6600, 0xe1280fc4, 0x0fc1570f,
+0x0f66e357, 0x0f66c4f8, 0xfff08274, 0x0f66ffff,
+0xfa81d0d7, 0x0000ffff, 0x280f6575, 0x570fa865,
+0x0fc031ed, 0x0f66c428, 0x290fc560, 0x0f668845,
+0x290fc560, 0x280f9845, 0x7501a8c2, 0xc4280f03,
+0xd845290f, 0xd805548a, 0x88055488, 0x10f88340,
+0x7d8de475, 0x0000ba98, 0x0f660000, 0x570fe1f7,
+0xf70f66cb, 0x45280fd1, 0x740f6698, 0x0f668845,
+0xff3dc0d7, 0xb80000ff, 0x000003c4, 0x83c2440f,
+0x5e5b7cc4, 0x8bc35d5f, 0x00c32414, 0x00000000,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x00000000, 0x00000000, 0x00000000,
+0001034,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x05ece8c3,
+0x2e050000, 0x31000006, 0xe58955c9, 0xbb535657,
+0x00000010, 0x00dcec81, 0x85890000, 0xffffff54,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf8839645,
+0x74896608, 0x8966a645, 0x66b64554, 0xc6455c89,
+0xc1890474, 0x280fbaeb, 0x290f987d, 0xffff68bd,
+0x85280fff, 0xffffff68, 0x000260b8, 0xc8280f00,
+0xcf750f66, 0xd1d70f66, 0xfffffa81, 0x850f0000,
+0x0000054f, 0x984d280f, 0xc8fd0f66, 0x788d290f,
+0x0fffffff, 0xb8984d28, 0x00000266, 0xf1710f66,
+0x750f6601, 0xffff788d, 0xd70f66ff, 0xfffa81d1,
+0x0f0000ff, 0x00051a85, 0x8d280f00, 0xffffff78,
+0x4df90f66, 0x4d290f98, 0xc8280f88, 0x00026bb8,
+0x750f6600, 0x0f66884d, 0xfa81d1d7, 0x0000ffff,
+0x04ed850f, 0x280f0000, 0x0f66a84d, 0x669845d5,
+0x0fc9d50f, 0x0f985528, 0x66a86528, 0x0fe2fd0f,
+0x0f66da28, 0x0f66c1f9, 0xb8a85df9, 0x00000282,
+0xdcd50f66, 0xc3750f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x000004ab, 0xa845280f, 0xc2d50f66,
+0xff54858b, 0x0f66ffff, 0xffd08075, 0x0f66ffff,
+0xfa81d0d7, 0x0000ffff, 0x0002d3b8, 0x80850f00,
+0x0f000004, 0x0f66da28, 0x0fb85de5, 0x0fb84d28,
+0xdab8c057, 0x66000002, 0x66c1650f, 0x66c3750f,
+0x81d0d70f, 0x00fffffa, 0x54850f00, 0x0f000004,
+0x0f66c128, 0x290fc2d5, 0x280f8845, 0x0f66885d,
+0x0f03f371, 0xff689d29, 0x280fffff, 0x0f668845,
+0x0f02f071, 0xff788529, 0x0f66ffff, 0xf8b8c0fd,
+0x66000002, 0x66c3750f, 0x81d0d70f, 0x00fffffa,
+0x0c850f00, 0x0f000004, 0xff688528, 0x0f66ffff,
+0x6602e071, 0xb8c0fd0f, 0x000002fd, 0x85750f66,
+0xffffff78, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x000003df, 0xc7c2280f, 0xffff6485, 0x000003ff,
+0xd50f6600, 0xd8280fc1, 0xff64858b, 0x8589ffff,
+0xffffff48, 0x891ff8c1, 0xffff4c85, 0x7e0ff3ff,
+0xffff48bd, 0xf10f66ff, 0x6485c7df, 0x02ffffff,
+0x8b000000, 0xffff6485, 0x488589ff, 0xc1ffffff,
+0x85891ff8, 0xffffff4c, 0xb57e0ff3, 0xffffff48,
+0xc6f10f66, 0x7885290f, 0x66ffffff, 0xb8c0fd0f,
+0x00000310, 0xc3750f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x0000035b, 0xff64858b, 0x8589ffff,
+0xffffff48, 0x891ff8c1, 0xffff4c85, 0x7e0ff3ff,
+0xffff48bd, 0xe10f66ff, 0xc3280fdf, 0xc3fd0f66,
+0x000314b8, 0x750f6600, 0xffff7885, 0xd70f66ff,
+0xfffa81d0, 0x0f0000ff, 0x00031685, 0x45280f00,
+0xe4570fc8, 0x66da280f, 0x66d9d50f, 0x0fc4650f,
+0x290fc354, 0x458b8845, 0x85896688, 0xffffff40,
+0xc84dbf0f, 0xff40858b, 0x5d8bffff, 0x7d8b668c,
+0x0fe0d38e, 0x89ca4dbf, 0xffff3c85, 0x458b66ff,
+0x6e0f668a, 0xffff3c9d, 0x858966ff, 0xffffff48,
+0xff48858b, 0xe0d3ffff, 0xcc4dbf0f, 0xff388589,
+0xd889ffff, 0x9dc40f66, 0xffffff38, 0x0fe0d301,
+0x89ce4dbf, 0xffff3485, 0x66f889ff, 0x34ad6e0f,
+0xd3ffffff, 0x4dbf0fe0, 0x308589d0, 0x8bffffff,
+0x89669045, 0xffff5085, 0x50b58bff, 0xd3ffffff,
+0x4dbf0fe6, 0x2cb589d2, 0x66ffffff, 0x8992758b,
+0x0fe2d3f2, 0x89d44dbf, 0xffff2895, 0x94558bff,
+0xe0d3d089, 0xd64dbf0f, 0xff248589, 0x8b66ffff,
+0x89669645, 0xffff4485, 0x44858bff, 0x66ffffff,
+0x30adc40f, 0x01ffffff, 0x856e0f66, 0xffffff2c,
+0xa56e0f66, 0xffffff24, 0x85c40f66, 0xffffff28,
+0x620f6601, 0x66e0d3dd, 0x01e0c40f, 0xc4620f66,
+0xd86c0f66, 0xff54858b, 0x280fffff, 0x0f66c845,
+0xffe080f9, 0x290fffff, 0xbf0fc845, 0x858bc84d,
+0xffffff40, 0xbf0fe0d3, 0x8589ca4d, 0xffffff40,
+0xff48858b, 0x0f66ffff, 0xff40856e, 0xe0d3ffff,
+0xcc4dbf0f, 0xff488589, 0x858bffff, 0xffffff50,
+0x85c40f66, 0xffffff48, 0x0fe3d301, 0x66ce4dbf,
+0xd3f36e0f, 0x4dbf0fe7, 0xc40f66d0, 0x0f6601f7,
+0xe0d3c662, 0xd24dbf0f, 0xff508589, 0x858bffff,
+0xffffff44, 0xa56e0f66, 0xffffff50, 0xbf0fe6d3,
+0x0f66d44d, 0xd301e6c4, 0x4dbf0fe2, 0x6e0f66d6,
+0x66e0d3ea, 0x01e8c40f, 0xe5620f66, 0xc46c0f66,
+0xc0fd0f66, 0x00032cb8, 0x750f6600, 0xd70f66c3,
+0xfffa81d0, 0x0f0000ff, 0x00013685, 0x45280f00,
+0xd9280fa8, 0xc1d50f66, 0x7885290f, 0x66ffffff,
+0x0fdad50f, 0xff788528, 0x0f66ffff, 0x0f66c3ee,
+0xff789dea, 0x290fffff, 0xffff789d, 0xfd0f66ff,
+0xffff7885, 0x0348b8ff, 0x0f660000, 0x66a855fd,
+0x66c1d50f, 0x66c2750f, 0x81d0d70f, 0x00fffffa,
+0xdc850f00, 0x0f000000, 0xf2a85528, 0x9845700f,
+0x700ff31b, 0x0f661bc0, 0xb84ec070, 0x00000359,
+0xc2750f66, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x000000af, 0x66c2280f, 0x9845610f, 0x6885290f,
+0x0fffffff, 0x0f66da28, 0x0f985d69, 0xff789d29,
+0x858bffff, 0xffffff54, 0xc3f90f66, 0xc1d50f66,
+0x8845290f, 0x80750f66, 0xfffffff0, 0xd0d70f66,
+0xfffffa81, 0x70b80000, 0x75000003, 0x45280f66,
+0x0fc03198, 0x01a8da28, 0x280f0375, 0x5d290fd8,
+0x548b66d8, 0x8966d845, 0xff784594, 0x8340ffff,
+0xdf7508f8, 0x8dd2570f, 0x00ba887d, 0x66000000,
+0x66ca650f, 0x0fc1f70f, 0x66a87528, 0x0fc0760f,
+0x0f66c157, 0x280ff0f7, 0x0f668845, 0xff788575,
+0x0f66ffff, 0xff3dc0d7, 0xb80000ff, 0x000003c4,
+0x81c2440f, 0x0000dcc4, 0x5f5e5b00, 0x048bc35d,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00000000, 0x00000000, 0x00000000,
+0003114,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x053ee8c3,
+0x6e050000, 0xb9000005, 0x00000010, 0x57e58955,
+0xec815356, 0x000000cc, 0xff548589, 0xc031ffff,
+0xbbd0b70f, 0x00000008, 0xc789d329, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fdbb7,
+0x490175d2, 0x45748966, 0x08f88396, 0x455c8966,
+0x548966a6, 0x8966b645, 0x75c6454c, 0x7d280fc3,
+0xbd290f98, 0xffffff68, 0x688d280f, 0xb8ffffff,
+0x00000260, 0x66c1280f, 0x66c7750f, 0x81d0d70f,
+0x00fffffa, 0xaa850f00, 0x0f000004, 0x66984528,
+0x0fc1fd0f, 0xff788529, 0x280fffff, 0x66b89845,
+0x66000002, 0x01f0710f, 0x85750f66, 0xffffff78,
+0xd0d70f66, 0xfffffa81, 0x850f0000, 0x00000475,
+0x7885280f, 0x66ffffff, 0x9845f90f, 0x8845290f,
+0xb8d1280f, 0x0000026b, 0x55750f66, 0xd70f6688,
+0xfffa81d2, 0x0f0000ff, 0x00044885, 0x4d560f00,
+0x8d290fa8, 0xffffff68, 0xa845540f, 0x884d280f,
+0xa84d570f, 0x6885550f, 0xb8ffffff, 0x00000277,
+0xd2760f66, 0xc1750f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x0000040d, 0x9845280f, 0xa84d280f,
+0xc8d50f66, 0xff54858b, 0x0f66ffff, 0xffe08875,
+0x0f66ffff, 0xfa81d1d7, 0x0000ffff, 0x0002d3b8,
+0xde850f00, 0x0f000003, 0x0f66e028, 0x0fb865e4,
+0xb8b84d28, 0x000002dc, 0x0fd8280f, 0x0f66d954,
+0x0f66d9fd, 0x0f66dc75, 0xfa81d3d7, 0x0000ffff,
+0x03af850f, 0x290f0000, 0x280f8845, 0x0f668865,
+0x0f03f471, 0xff68a529, 0x280fffff, 0x0f66885d,
+0x0f02f371, 0xff789d29, 0x0f66ffff, 0xf8b8dbfd,
+0x66000002, 0x66dc750f, 0x81d3d70f, 0x00fffffa,
+0x6e850f00, 0x0f000003, 0xff689d28, 0x0f66ffff,
+0x6602d371, 0xb8dbfd0f, 0x000002fd, 0x9d750f66,
+0xffffff78, 0xd3d70f66, 0xfffffa81, 0x850f0000,
+0x00000341, 0xff6485c7, 0x0003ffff, 0x280f0000,
+0x6e0f66d8, 0xffff64a5, 0xf10f66ff, 0x6485c7dc,
+0x02ffffff, 0x66000000, 0x64a56e0f, 0x66ffffff,
+0x0fc4f10f, 0xff788529, 0x0f66ffff, 0x10b8c0fd,
+0x66000003, 0x66c3750f, 0x81d0d70f, 0x00fffffa,
+0xee850f00, 0x66000002, 0x64a56e0f, 0x66ffffff,
+0x0fdcd10f, 0x0f66c328, 0x14b8c3fd, 0x66000003,
+0x7885750f, 0x66ffffff, 0x81d0d70f, 0x00fffffa,
+0xbe850f00, 0x0f000002, 0x280fe457, 0x750f66c4,
+0x0f66c845, 0x540fc475, 0x290f9845, 0x458b8845,
+0x85896688, 0xffffff44, 0xc84db70f, 0xff44858b,
+0x5d8bffff, 0x7d8b668c, 0x0fe0d38e, 0x89ca4db7,
+0xffff4085, 0x458b66ff, 0x6e0f668a, 0xffff409d,
+0x858966ff, 0xffffff50, 0xff50858b, 0xe0d3ffff,
+0xcc4db70f, 0xff3c8589, 0xd889ffff, 0x9dc40f66,
+0xffffff3c, 0x0fe0d301, 0x89ce4db7, 0xffff3885,
+0x66f889ff, 0x38b56e0f, 0xd3ffffff, 0x4db70fe0,
+0x348589d0, 0x8bffffff, 0x89669045, 0xffff4c85,
+0x4cb58bff, 0xd3ffffff, 0x4db70fe6, 0x30b589d2,
+0x66ffffff, 0x8992758b, 0x0fe2d3f2, 0x89d44db7,
+0xffff2c95, 0x94558bff, 0xe0d3d089, 0xd64db70f,
+0xff288589, 0x8b66ffff, 0x89669645, 0xffff4885,
+0x48858bff, 0x66ffffff, 0x34b5c40f, 0x01ffffff,
+0x856e0f66, 0xffffff30, 0xad6e0f66, 0xffffff28,
+0x85c40f66, 0xffffff2c, 0x620f6601, 0x66e0d3de,
+0x01e8c40f, 0xc5620f66, 0xd86c0f66, 0xc845280f,
+0xc2fd0f66, 0xc845290f, 0xc84db70f, 0xff44858b,
+0xe0d3ffff, 0xca4db70f, 0xff448589, 0x858bffff,
+0xffffff50, 0x856e0f66, 0xffffff44, 0xb70fe0d3,
+0x8589cc4d, 0xffffff50, 0xff4c858b, 0x0f66ffff,
+0xff5085c4, 0xd301ffff, 0x4db70fe3, 0x6e0f66ce,
+0x0fe7d3fb, 0x66d04db7, 0x01ffc40f, 0xc7620f66,
+0xb70fe0d3, 0x8589d24d, 0xffffff4c, 0xff48858b,
+0x0f66ffff, 0xff4cad6e, 0xe6d3ffff, 0xd44db70f,
+0xeec40f66, 0x0fe2d301, 0x66d64db7, 0xd3f26e0f,
+0xc40f66e0, 0x0f6601f0, 0x0f66ee62, 0x0f66c56c,
+0x2cb8c0fd, 0x66000003, 0x66c3750f, 0x81d0d70f,
+0x00fffffa, 0xea850f00, 0x0f000000, 0xf2a85d28,
+0x9845700f, 0x700ff31b, 0x0f661bc0, 0xb84ec070,
+0x00000359, 0xc3750f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x000000bd, 0x66eb280f, 0x986d610f,
+0x68ad290f, 0x0fffffff, 0x0f66c328, 0x66984569,
+0x8bc2fd0f, 0xffff5485, 0xd1570fff, 0xc5f90f66,
+0x66c1570f, 0x66c2f90f, 0xf080750f, 0x66ffffff,
+0x81d0d70f, 0x00fffffa, 0x0370b800, 0x75750000,
+0x9855280f, 0x280fc031, 0x610f66c2, 0x85290fc4,
+0xffffff78, 0xc4610f66, 0x8845290f, 0xa8c3280f,
+0x0f037501, 0x290fc228, 0x8b66d845, 0x66d84554,
+0x78459489, 0x40ffffff, 0x7508f883, 0x760f66df,
+0x887d8dc0, 0xd1f70f66, 0xa87d280f, 0x000000ba,
+0xc1570f00, 0xf8f70f66, 0x8845280f, 0x85750f66,
+0xffffff78, 0xc0d70f66, 0x00ffff3d, 0x03c4b800,
+0x440f0000, 0xccc481c2, 0x5b000000, 0xc35d5f5e,
+0xc324048b, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00000000, 0x00000000, 0x00000000,
+0002614,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xa3e855c3,
+0x81000003, 0x0003cdc2, 0x57e58900, 0xc774ec83,
+0x0001d845, 0x45c70000, 0x000004e8, 0xdc45c700,
+0x00000002, 0x03ec45c7, 0xc7000000, 0x0003e045,
+0x45c70000, 0x000002f0, 0xe445c700, 0x00000004,
+0x01f445c7, 0x0f000000, 0x0fd87528, 0x0fa87529,
+0xb8a84528, 0x00000260, 0x66c8280f, 0x0fce760f,
+0xf983c950, 0x35850f0f, 0x0f000003, 0x66d84d28,
+0x0fc8fe0f, 0x0fb84d29, 0xb8d84d28, 0x00000266,
+0xf1720f66, 0x760f6601, 0x500fb84d, 0x0ff983c9,
+0x030a850f, 0x280f0000, 0x0f66b84d, 0x0fd84dfa,
+0x0fc84d29, 0x6bb8c828, 0x66000002, 0xc84d760f,
+0x83c9500f, 0x850f0ff9, 0x000002e4, 0xa84d280f,
+0xd855280f, 0xd1730f66, 0xf40f6620, 0x0f66d845,
+0x0f20d273, 0x66e85d28, 0x66caf40f, 0x08c9700f,
+0xc0700f66, 0x620f6608, 0x4d280fc1, 0xf40f66e8,
+0x0f66e85d, 0x6620d173, 0x66c9f40f, 0x08c9700f,
+0xdb700f66, 0x620f6608, 0x4d280fd9, 0x65280fd8,
+0xfe0f66e8, 0xec280fe1, 0x66d1280f, 0x20d5730f,
+0x55fa0f66, 0xfa0f66e8, 0x0282b8c3, 0x0f660000,
+0x0f66e2f4, 0x6620d273, 0x66d5f40f, 0x08e4700f,
+0xd2700f66, 0x620f6608, 0x760f66e2, 0xc8500fc4,
+0x0f0ff983, 0x00024785, 0x55280f00, 0x45280fd8,
+0x730f66e8, 0x0f6620d2, 0x66e84df4, 0x20d0730f,
+0xc2f40f66, 0xc0700f66, 0x700f6608, 0x0f6608c9,
+0x0f66c862, 0xffe08a76, 0x500fffff, 0x02d3b8c9,
+0xf9830000, 0x05850f0f, 0xb8000002, 0x00000001,
+0x66ffcf83, 0x66cf6e0f, 0x66c06e0f, 0xe1c0700f,
+0xc1100ff3, 0xf86e0f66, 0xc0700f66, 0x700f66e1,
+0x0ff3c6c0, 0x0f66c710, 0x66c6c070, 0x27c0700f,
+0xc1100ff3, 0xc0700f66, 0xc8280f27, 0x4df40f66,
+0xd8280fd8, 0xd3730f66, 0xf40f6620, 0x700f66d3,
+0x0f6608c9, 0x6608d270, 0x0fca620f, 0x0fc84d29,
+0x66c86528, 0x03f4720f, 0xa865290f, 0xc855280f,
+0xf2720f66, 0x55290f02, 0xfe0f66b8, 0x02f8b8d2,
+0x0f660000, 0x500fd476, 0x0ff983ca, 0x016e850f,
+0x280f0000, 0x0f66a855, 0x6602e272, 0xb8d2fe0f,
+0x000002fd, 0x55760f66, 0xca500fb8, 0x0f0ff983,
+0x00014b85, 0xa445c700, 0x00000003, 0x8bd1280f,
+0x4589a445, 0x1ff8c190, 0xf3944589, 0x90757e0f,
+0xd6f20f66, 0x02a445c7, 0x8b000000, 0x4589a445,
+0x1ff8c190, 0xf3944589, 0x907d7e0f, 0xcff20f66,
+0xb84d290f, 0xc9fe0f66, 0x000310b8, 0x760f6600,
+0xc9500fca, 0x0f0ff983, 0x0000f385, 0xa4458b00,
+0xc1904589, 0x45891ff8, 0x7e0ff394, 0x0f66906d,
+0x280fd5e2, 0xfe0f66ca, 0x0314b8ca, 0x0f660000,
+0x0fb84d76, 0xf983c950, 0xc1850f0f, 0x0f000000,
+0x66e85528, 0xd84d700f, 0x0359b81b, 0x0f660000,
+0x500fca76, 0x0ff983c9, 0x00a2850f, 0x280f0000,
+0x620f66ca, 0x0f66d84d, 0x66d8556a, 0xb8cafa0f,
+0x00000370, 0x66d1280f, 0x20d1730f, 0xd0f40f66,
+0xcbf40f66, 0xd2700f66, 0x700f6608, 0x0f6608c9,
+0x290fd162, 0x0f66c855, 0xfff09276, 0x500fffff,
+0x0ffa83d2, 0x458b5a75, 0xc87d8dec, 0x000000ba,
+0x4d280f00, 0xd1280fd8, 0x4d7e0f66, 0xbc4589b8,
+0x66f4458b, 0x66d16a0f, 0xc0557e0f, 0x66d2570f,
+0x89c2660f, 0x0f66c445, 0x280fc8f7, 0x0f66e875,
+0x570fc976, 0xf70f66c1, 0x45280ff0, 0x760f66c8,
+0x500fb845, 0x0ff883c0, 0x0003c4b8, 0xc2440f00,
+0x5f74c483, 0x148bc35d, 0x0000c324, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x00000000,
+0001754,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x02e6e8c3,
+0xc1810000, 0x0000030e, 0x8955c031, 0xbe5657e5,
+0x00000005, 0x7cec8353, 0xf389c789, 0x8940fa89,
+0x83b48544, 0xc32901e2, 0xc4855c89, 0x04f8834a,
+0xd4855489, 0x280fe275, 0x290fb86d, 0x280f886d,
+0x60b8884d, 0x0f000002, 0x0f66c128, 0x500fc576,
+0x0ffa83d0, 0x0286850f, 0x280f0000, 0x0f66b845,
+0x290fc1fe, 0x280f9845, 0x66b8b845, 0x66000002,
+0x01f0720f, 0x45760f66, 0xd0500f98, 0x0f0ffa83,
+0x00025b85, 0x45280f00, 0xfa0f6698, 0x290fb845,
+0x280fa845, 0x026bb8d1, 0x0f660000, 0x0fa85576,
+0xfa83d250, 0x35850f0f, 0x0f000002, 0x0fc84d56,
+0x0f884d29, 0x0fc84554, 0x0fa85528, 0x0fc85557,
+0xb8884555, 0x00000277, 0xc9760f66, 0xc2760f66,
+0x83d0500f, 0x850f0ffa, 0x00000204, 0xb845280f,
+0xb85d280f, 0x0fd0280f, 0x66c86528, 0x20d3730f,
+0x55f40f66, 0x730f66c8, 0x0f6620d4, 0x0f66dcf4,
+0x6608db70, 0x08d2700f, 0xd3620f66, 0x91760f66,
+0xffffffe0, 0xb8d2500f, 0x000002d3, 0x0f0ffa83,
+0x0001bb85, 0x55280f00, 0xd0570fd8, 0x8855290f,
+0xd07e0f66, 0x55f40f66, 0xc865f7c8, 0x8ba84589,
+0x5589d045, 0x9065f7ac, 0xb8b04589, 0x000002ec,
+0x66b45589, 0xa855760f, 0x83d2500f, 0x850f0ffa,
+0x0000017c, 0xa845290f, 0xa85d280f, 0xf3720f66,
+0x5d290f03, 0x55280f88, 0x720f66a8, 0x290f02f2,
+0x0f669855, 0xf8b8d2fe, 0x66000002, 0x0fd3760f,
+0xfa83d250, 0x45850f0f, 0x0f000001, 0x66885528,
+0x02d2720f, 0xd2fe0f66, 0x0002fdb8, 0x760f6600,
+0x500f9855, 0x0ffa83d2, 0x0122850f, 0x45c70000,
+0x00000384, 0xd0280f00, 0x5d6e0f66, 0xf20f6684,
+0x8445c7d3, 0x00000002, 0x5d6e0f66, 0xf20f6684,
+0x45290fc3, 0xfe0f6698, 0x0310b8c0, 0x0f660000,
+0x500fc276, 0x0ffa83d0, 0x00e2850f, 0x0f660000,
+0x66845d6e, 0x0fd3d20f, 0x0f66c228, 0x14b8c2fe,
+0x66000003, 0x9845760f, 0x83d0500f, 0x850f0ffa,
+0x000000bc, 0xc845280f, 0x55700f66, 0x59b81bb8,
+0x66000003, 0x0fd0760f, 0xfa83d250, 0x9d850f0f,
+0x0f000000, 0x0f66d828, 0x66b85d62, 0xb8456a0f,
+0xd855280f, 0xc1fe0f66, 0x000370b8, 0xfa0f6600,
+0xc2570fc3, 0x66ca570f, 0x66c1fa0f, 0xf081760f,
+0x0fffffff, 0xfa83d050, 0x8b65750f, 0x570fcc45,
+0xa87d8ddb, 0xb845280f, 0x000000ba, 0xc8280f00,
+0x457e0f66, 0x9c458998, 0x66d4458b, 0x66cb620f,
+0x0fcb620f, 0x0fa84d29, 0x0f66c828, 0x0f66c86a,
+0x89a04d7e, 0x0f66a445, 0x280fc2f7, 0x0f66c875,
+0x570fc076, 0xf70f66c2, 0x45280ff0, 0x760f66a8,
+0x500f9845, 0x0ff883c0, 0x0003c4b8, 0xc2440f00,
+0x5b7cc483, 0xc35d5f5e, 0xc3240c8b, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x00000000,
+0001454,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xd23155c3,
+0x0007f5e8, 0x1bc18100, 0x89000008, 0x57c031e5,
+0x3156ff31, 0x70ec83f6, 0x01d845c7, 0x89000000,
+0x45c7dc55, 0x000002e8, 0xec758900, 0x02e045c7,
+0x89000000, 0x45c7e47d, 0x000001f0, 0xf4458900,
+0xd87d280f, 0xa87d290f, 0x4d7e0ff3, 0x7e0ff3a8,
+0x570fd845, 0x7e0ff3c1, 0x0f66b055, 0x0f66c27e,
+0x6620d073, 0x09c07e0f, 0x7e0ff3c2, 0x940fe045,
+0x0fd231c0, 0x570fc0b6, 0x89d8f7c2, 0xd2839045,
+0x89daf700, 0x0f669455, 0x0f66c27e, 0x6620d073,
+0x09c07e0f, 0x7e0ff3c2, 0x940f9045, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x60b800d2, 0xf7000002,
+0x945589da, 0x9045160f, 0xd0500f66, 0x0f03fa83,
+0x00072e85, 0x55280f00, 0x45280fa8, 0xd40f66d8,
+0x45290fc2, 0x45280fb8, 0x730f66d8, 0x0f6601f0,
+0x8b9045d6, 0x170f9045, 0x558b8845, 0xb8453394,
+0x09bc5533, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x88458b00, 0xf7c04533, 0x945589da,
+0x338c558b, 0x0ff3c455, 0x0990457e, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x0266b800,
+0xdaf70000, 0x0f945589, 0x66904516, 0x83d0500f,
+0x850f03fa, 0x000006ab, 0xb845280f, 0x45fb0f66,
+0x45290fd8, 0x7e0ff3c8, 0x570fc845, 0x7e0ff3c1,
+0x0f66b04d, 0x0f66c27e, 0x6620d073, 0x09c07e0f,
+0x7e0ff3c2, 0x940fd045, 0x0fd231c0, 0x570fc0b6,
+0x89d8f7c1, 0xd2839045, 0x89daf700, 0x0f669455,
+0x0f66c27e, 0x6620d073, 0x09c07e0f, 0x7e0ff3c2,
+0x940f9045, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x6bb800d2, 0xf7000002, 0x945589da, 0x9045160f,
+0xd0500f66, 0x0f03fa83, 0x00062685, 0xc2280f00,
+0xd85d280f, 0xd0730f66, 0xca280f20, 0x4df40f66,
+0xf40f66d8, 0x0f66d845, 0x6620d373, 0x0fdaf40f,
+0x280fd128, 0x0f66e84d, 0x0f66c3d4, 0x0f20f073,
+0x0f66e128, 0x280fd0d4, 0x730f66c1, 0x0f6620d0,
+0x0f66c1f4, 0x0f66e1f4, 0x0f66c0d4, 0x6620f073,
+0x0fe0d40f, 0x0fd84528, 0x0f66f828, 0x280ff9d4,
+0xfb0f66f0, 0xfb0f66d4, 0x280fe875, 0x730f66ef,
+0x280f20d5, 0xf40f66ce, 0x730f66ee, 0x280f20d1,
+0xf40f66de, 0xd40f66cf, 0x730f66cd, 0x0f6620f1,
+0x0f66dff4, 0x0f66d9d4, 0x8b905dd6, 0x170f9045,
+0x558b885d, 0xd60f6694, 0x45339055, 0x94553390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0x89daf788, 0x558b9455, 0x55170f8c,
+0x88453388, 0x4d7e0ff3, 0x8c553390, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x82b800d2,
+0xf7000002, 0x945589da, 0x904d160f, 0xd1500f66,
+0x0f03fa83, 0x00051a85, 0x4d280f00, 0xe0280fe8,
+0x0fd9280f, 0x0f66d028, 0x6620d473, 0x20d3730f,
+0xd1f40f66, 0xd8f40f66, 0xccf40f66, 0xcbd40f66,
+0xf1730f66, 0xd40f6620, 0xd60f66ca, 0x290f904d,
+0x458ba84d, 0x94558b90, 0x0902f083, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0xb0458b00,
+0x5589daf7, 0xb4558b94, 0x4d7e0ff3, 0x02f08390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0xd3b800d2, 0xf7000002, 0x945589da, 0x904d160f,
+0xd1500f66, 0x0f03fa83, 0x00048685, 0x9045c700,
+0xffffffff, 0x45c7c031, 0xffffff94, 0x8845c7ff,
+0x00000001, 0xf38c4589, 0x88557e0f, 0x9055160f,
+0x66da280f, 0x20d3730f, 0x0fec280f, 0x0f66c828,
+0x0f66eaf4, 0x0f66c3f4, 0x0f66caf4, 0x0f66e8d4,
+0x6620f573, 0x0fe9d40f, 0x0fc86d29, 0x66c86d28,
+0x03f5730f, 0x6dd60f66, 0x6d290f90, 0x90758ba8,
+0x0f947d8b, 0x66c86d28, 0x02f5730f, 0xb86d290f,
+0xedd40f66, 0xe2f40f66, 0x6dd60f66, 0x90458b90,
+0x886d170f, 0x3194558b, 0x09fa31f0, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x88458b00,
+0xf7b04533, 0x945589da, 0x338c558b, 0x0ff3b455,
+0x09906d7e, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x02f8b800, 0xdaf70000, 0x0f945589,
+0x66906d16, 0x83d5500f, 0x850f03fa, 0x000003a3,
+0xa86d280f, 0xa875280f, 0xd5730f66, 0x700f6602,
+0x0f6688ed, 0x6602e672, 0xddf6700f, 0xee620f66,
+0xedd40f66, 0x6dd60f66, 0x90458b90, 0x886d170f,
+0x3394558b, 0x5533b845, 0x0fd009bc, 0xd231c094,
+0xf7c0b60f, 0x904589d8, 0x8b00d283, 0x45338845,
+0x89daf7c0, 0x558b9455, 0xc455338c, 0x6d7e0ff3,
+0x0fd00990, 0xd231c094, 0xf7c0b60f, 0x904589d8,
+0xb800d283, 0x000002fd, 0x5589daf7, 0x6d160f94,
+0x500f6690, 0x03fa83d5, 0x0315850f, 0x45c70000,
+0x000003a4, 0xd40f6600, 0x730f66e0, 0x0f6620f4,
+0x280fccd4, 0xa4458bc1, 0xc1904589, 0x45891ff8,
+0x7e0ff394, 0x0f66907d, 0x45c7c7f3, 0x000002a4,
+0xa4458b00, 0xc1904589, 0x45891ff8, 0x7e0ff394,
+0x0f66907d, 0x290fcff3, 0x0f66b84d, 0x0f66c9d4,
+0x8b904dd6, 0x170f9045, 0x558b884d, 0xd60f6694,
+0x45339045, 0x94553390, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x458b00d2, 0x89daf788,
+0x558b9455, 0x45170f8c, 0x88453388, 0x4d7e0ff3,
+0x8c553390, 0x940fd009, 0x0fd231c0, 0xd8f7c0b6,
+0x83904589, 0x10b800d2, 0xf7000003, 0x945589da,
+0x904d160f, 0xd1500f66, 0x0f03fa83, 0x00025285,
+0xc8280f00, 0x66a4558b, 0x1fe1720f, 0xc9700f66,
+0x905589f5, 0xf8c1d089, 0x9445891f, 0x000040b8,
+0xf3d02900, 0x907d7e0f, 0xc7d30f66, 0xe06e0f66,
+0xccf30f66, 0x66c1560f, 0x66c0d40f, 0x9045d60f,
+0x0f90458b, 0x8b884517, 0x45339455, 0xbc5533b8,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0xc0453388, 0x5589daf7, 0x8c558b94,
+0xf3c45533, 0x90457e0f, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x14b800d2, 0xf7000003,
+0x945589da, 0x9045160f, 0xd0500f66, 0x0f03fa83,
+0x0001ae85, 0x700f6600, 0x664ed845, 0x9045d60f,
+0x8b90458b, 0x170f9455, 0x45338845, 0xec5533e8,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0xf0453388, 0x5589daf7, 0x8c558b94,
+0xf3f45533, 0x90457e0f, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x59b800d2, 0xf7000003,
+0x945589da, 0x9045160f, 0xd0500f66, 0x0f03fa83,
+0x00013e85, 0x65280f00, 0x6c0f66e8, 0x280fd865,
+0x0f66e845, 0x66d8456d, 0x0fe0fb0f, 0x0f66c428,
+0x0f66dcf4, 0x0f20d073, 0x0f66cc28, 0x0f66c2f4,
+0x0f66c3d4, 0x0f66caf4, 0x6620f073, 0x66c1d40f,
+0x9045d60f, 0x8845170f, 0xc845290f, 0x8b90458b,
+0xf0839455, 0x0fd00901, 0xd231c094, 0xf7c0b60f,
+0x904589d8, 0x8b00d283, 0xdaf78845, 0x8b945589,
+0x0ff38c55, 0x8390457e, 0xd00901f0, 0x31c0940f,
+0xc0b60fd2, 0x4589d8f7, 0x00d28390, 0x000370b8,
+0x89daf700, 0x160f9455, 0x0f669045, 0xfa83d050,
+0x9c850f03, 0x0f000000, 0xffe08128, 0x7d8dffff,
+0x7e0ff3c8, 0x0ff3d875, 0x66f04d7e, 0x9075d60f,
+0xd87d280f, 0xf8f70f66, 0xf081280f, 0x0fffffff,
+0x66e87528, 0x8bf0f70f, 0x0ff3c845, 0x8bd0457e,
+0x570fcc55, 0x904533c1, 0x09945533, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x89daf700,
+0x0f669455, 0x0f66c27e, 0x6620d073, 0x09c07e0f,
+0x7e0ff3c2, 0x940f9045, 0x0fd231c0, 0xd8f7c0b6,
+0x83904589, 0xdaf700d2, 0xba945589, 0x00000000,
+0x9045160f, 0xc0500f66, 0xb803f883, 0x000003c4,
+0x83c2440f, 0x5f5e70c4, 0x0c8bc35d, 0x0000c324,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+0x00000000, 0x00000000, 0x00000000,
+0004074,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x53c93157, 0xec83db31, 0xd845c770,
+0x00000001, 0xc7dc4589, 0x0002e845, 0x55890000,
+0xe045c7ec, 0x00000002, 0xc7e44d89, 0x0001f045,
+0x5d890000, 0x6d280ff4, 0x6d290fd8, 0x7e0ff3a8,
+0x0ff3a84d, 0x0fd8457e, 0x0ff3c157, 0x66e04d7e,
+0x66c27e0f, 0x20d0730f, 0xc07e0f66, 0x0ff3c209,
+0x0fb0457e, 0xd231c094, 0x0fc0b60f, 0xd8f7c157,
+0x83904589, 0xdaf700d2, 0x66945589, 0x66c27e0f,
+0x20d0730f, 0xc07e0f66, 0x0ff3c209, 0x0f90457e,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0xb800d283,
+0x00000260, 0x5589daf7, 0x45160f94, 0x500f6690,
+0x03fa83d0, 0x0607850f, 0x280f0000, 0x280fa855,
+0x0f66d845, 0x290fc2d4, 0x280fb845, 0x0f66d845,
+0x6601f073, 0x9045d60f, 0x0f90458b, 0x8b884517,
+0x45339455, 0xbc5533b8, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x458b00d2, 0xc0453388,
+0x5589daf7, 0x8c558b94, 0xf3c45533, 0x90457e0f,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x66b800d2, 0xf7000002, 0x945589da, 0x9045160f,
+0xd0500f66, 0x0f03fa83, 0x00058485, 0x45280f00,
+0xfb0f66b8, 0x290fd845, 0x0ff3c845, 0xf3c85d7e,
+0xa84d7e0f, 0xf3cb570f, 0xb05d7e0f, 0xca7e0f66,
+0xd1730f66, 0x7e0f6620, 0xf3c209c8, 0xd04d7e0f,
+0x31c0940f, 0xc0b60fd2, 0xf7cb570f, 0x904589d8,
+0xf700d283, 0x945589da, 0xca7e0f66, 0xd1730f66,
+0x7e0f6620, 0xf3c209c8, 0x904d7e0f, 0x31c0940f,
+0xc0b60fd2, 0x4589d8f7, 0x00d28390, 0x00026bb8,
+0x89daf700, 0x160f9455, 0x0f66904d, 0xfa83d150,
+0xfa850f03, 0x0f000004, 0x0fe85556, 0x0fa85529,
+0x0fe84554, 0x0fc84d28, 0x66e84d57, 0x904dd60f,
+0xc84d290f, 0x8b90458b, 0x550f9455, 0x0f66a845,
+0x0f66c976, 0x8b9045d6, 0x170f904d, 0x5d8b8845,
+0x31c13194, 0x09d331c0, 0xc0940fd9, 0xd8f7d231,
+0x83904589, 0x458b00d2, 0xd0453388, 0x5589daf7,
+0x8c558b94, 0xf3d45533, 0x90457e0f, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x77b800d2,
+0xf7000002, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00046885, 0x45280f00, 0xd0280fd8,
+0xe865280f, 0xd2730f66, 0xd8280f20, 0x55f40f66,
+0xf40f66e8, 0x0f66e85d, 0x6620d473, 0x66e0f40f,
+0x66d4d40f, 0x20f2730f, 0xd3d40f66, 0x55d60f66,
+0x55290f90, 0x90458ba8, 0x8394558b, 0xd00902f0,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28390,
+0xf7b0458b, 0x945589da, 0xf3b4558b, 0x90557e0f,
+0x0902f083, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x02d3b800, 0xdaf70000, 0x0f945589,
+0x66905516, 0x83d2500f, 0x850f03fa, 0x000003d1,
+0xc845290f, 0xc855280f, 0xf2730f66, 0xd60f6603,
+0x290f9055, 0x458ba855, 0x94558b90, 0xc855280f,
+0xf2730f66, 0x55290f02, 0xd40f66b8, 0xd60f66d2,
+0x4d8b9055, 0x55170f90, 0x945d8b88, 0xc031c131,
+0xd909d331, 0x31c0940f, 0x89d8f7d2, 0xd2839045,
+0x88458b00, 0xf7b04533, 0x945589da, 0x338c558b,
+0x0ff3b455, 0x0990557e, 0xc0940fd0, 0xb60fd231,
+0x89d8f7c0, 0xd2839045, 0x02f8b800, 0xdaf70000,
+0x0f945589, 0x66905516, 0x83d2500f, 0x850f03fa,
+0x0000033d, 0xa855280f, 0xd2730f66, 0xd40f6602,
+0xd60f66d2, 0x458b9055, 0x55170f90, 0x94558b88,
+0x33b84533, 0xd009bc55, 0x31c0940f, 0xc0b60fd2,
+0x4589d8f7, 0x00d28390, 0x3388458b, 0xdaf7c045,
+0x8b945589, 0x55338c55, 0x7e0ff3c4, 0xd0099055,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28390,
+0x0002fdb8, 0x89daf700, 0x160f9455, 0x0f669055,
+0xfa83d250, 0xc6850f03, 0xc7000002, 0x0003a445,
+0x280f0000, 0x6e0f66d0, 0x0f66a45d, 0x45c7d3f3,
+0x000002a4, 0x6e0f6600, 0x0f66a45d, 0x290fc3f3,
+0x0f66b845, 0x0f66c0d4, 0x8b9045d6, 0x170f9045,
+0x558b8845, 0xd60f6694, 0x45339055, 0x94553390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0x89daf788, 0x558b9455, 0x55170f8c,
+0x88453388, 0x457e0ff3, 0x8c553390, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x10b800d2,
+0xf7000003, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00022885, 0x6e0f6600, 0x0f66a445,
+0x0f66d0d3, 0x0f66d2d4, 0x8b9055d6, 0x170f9045,
+0x558b8855, 0xb8453394, 0x09bc5533, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x88458b00,
+0xf7c04533, 0x945589da, 0x338c558b, 0x0ff3c455,
+0x0990457e, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x0314b800, 0xdaf70000, 0x0f945589,
+0x66904516, 0x83d0500f, 0x850f03fa, 0x000001b1,
+0x45700f66, 0x0f664ed8, 0x8b9045d6, 0x558b9045,
+0x45170f94, 0xe8453388, 0x09ec5533, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x88458b00,
+0xf7f04533, 0x945589da, 0x338c558b, 0x0ff3f455,
+0x0990457e, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x0359b800, 0xdaf70000, 0x0f945589,
+0x66904516, 0x83d0500f, 0x850f03fa, 0x00000141,
+0xff9045c7, 0xc7ffffff, 0xffff9445, 0x0ff3ffff,
+0xf390557e, 0x0fd27e0f, 0x66e85d28, 0xd85d6c0f,
+0xe845280f, 0x456d0f66, 0xd40f66d8, 0xca570fc1,
+0xc3fb0f66, 0x66c2570f, 0x66c1fb0f, 0x9045d60f,
+0x0f90458b, 0x8b884517, 0xf0839455, 0x0fd00901,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0x8b00d283,
+0xdaf78845, 0x8b945589, 0x0ff38c55, 0x8390457e,
+0xd00901f0, 0x31c0940f, 0xc0b60fd2, 0x4589d8f7,
+0x00d28390, 0x000370b8, 0x89daf700, 0x160f9455,
+0x0f669045, 0xfa83d050, 0xa2850f03, 0xf3000000,
+0xd8457e0f, 0xc07e0ff3, 0xc845290f, 0xd87d280f,
+0xc0760f66, 0xf3c87d8d, 0xd8757e0f, 0x4d7e0ff3,
+0xd60f66f0, 0x570f9075, 0xf70f66c2, 0x6d280ffa,
+0xf70f66e8, 0xc8458be8, 0x457e0ff3, 0xcc558bd0,
+0x33c1570f, 0x55339045, 0x0fd00994, 0xd231c094,
+0xf7c0b60f, 0x904589d8, 0xf700d283, 0x945589da,
+0xc27e0f66, 0xd0730f66, 0x7e0f6620, 0xf3c209c0,
+0x90457e0f, 0x31c0940f, 0xc0b60fd2, 0x4589d8f7,
+0x00d28390, 0x5589daf7, 0x0000ba94, 0x160f0000,
+0x0f669045, 0xf883c050, 0x03c4b803, 0x440f0000,
+0x70c483c2, 0xc35d5f5b,
+0003330,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x02eae8c3,
+0xc2810000, 0x0000031e, 0x8955e8d9, 0xec8357e5,
+0xc855d964, 0xffd082d9, 0x55d9ffff, 0xd9c9d9d8,
+0x82d9e855, 0xfffffff0, 0xd9cc55d9, 0xffffd482,
+0xdc55d9ff, 0xe0d9e8d9, 0xd9ec55d9, 0xd05dd9c9,
+0x5dd9c9d9, 0xd9c9d9e0, 0xcad9f055, 0xd9d45dd9,
+0xe45dd9c9, 0x0ff45dd9, 0x0fc86d28, 0x0f986d29,
+0xb8984528, 0x00000260, 0x0fc8280f, 0x0f00cdc2,
+0xf983c950, 0x6b850f0f, 0x0f000002, 0x0fc84d28,
+0x290fc858, 0x280fa84d, 0x66b8c84d, 0x0f000002,
+0xc20fc958, 0x0f00a84d, 0xf983c950, 0x43850f0f,
+0x0f000002, 0x0fa84d28, 0x0fc84d5c, 0x0fb84d29,
+0x6bb8c828, 0x0f000002, 0x00b84dc2, 0x83c9500f,
+0x850f0ff9, 0x0000021e, 0xd855280f, 0xc845590f,
+0x0fd2590f, 0x0fc84d28, 0x0fd86528, 0x280fe158,
+0x0282b8d9, 0x5c0f0000, 0x5c0fd85d, 0xdc590fc2,
+0x00c3c20f, 0x83c8500f, 0x850f0ff9, 0x000001e6,
+0xe845280f, 0x0fc1590f, 0x0f984529, 0xb8e84d5e,
+0x0000028b, 0x00c1c20f, 0x83c8500f, 0x850f0ff9,
+0x000001c2, 0xe84d280f, 0x00028eb8, 0x92280f00,
+0xffffffe0, 0x0fc1280f, 0x590fc257, 0x570f9845,
+0xc20fc855, 0x500f00c2, 0x0ff983c8, 0x0194850f,
+0x530f0000, 0x290fc845, 0x530f9845, 0x96b89845,
+0x0f000002, 0x66c85528, 0x0fc05b0f, 0xc20fc05b,
+0x500f00c2, 0x0ff983c8, 0x0168850f, 0x280f0000,
+0xc2590fc2, 0x9845290f, 0x9845520f, 0xa845290f,
+0xa845280f, 0x00029db8, 0xd8530f00, 0xdb5b0f66,
+0x0fdb5b0f, 0x0f00d3c2, 0xf983ca50, 0x33850f0f,
+0x66000001, 0x0fd05b0f, 0xb8c84528, 0x0000029f,
+0x0fd25b0f, 0x0f66d853, 0x5b0fdb5b, 0xd3c20fdb,
+0xca500f00, 0x0f0ff983, 0x00010985, 0xd0280f00,
+0x0fd0590f, 0x0f985529, 0xb8985551, 0x000002a7,
+0x00d0c20f, 0x83ca500f, 0x850f0ff9, 0x000000e6,
+0xd855280f, 0x0fd8280f, 0x590fd159, 0x55290fd9,
+0xd3280fa8, 0xa8555f0f, 0xa85d5d0f, 0xa85d290f,
+0xa855580f, 0x000348b8, 0x45580f00, 0xd1590fd8,
+0x00c2c20f, 0x83c8500f, 0x850f0ff9, 0x000000a6,
+0xc845280f, 0x000359b8, 0xc0c60f00, 0x45c20f1b,
+0x500f00d8, 0x0ff983c8, 0x0088850f, 0x280f0000,
+0x140fd845, 0x280fc845, 0x150fd855, 0x5c0fc855,
+0x0370b8c2, 0x590f0000, 0x45290fc1, 0x82c20fb8,
+0xfffffff0, 0xd0500f00, 0x750ffa83, 0x55280f59,
+0xb87d8dc8, 0x000000ba, 0xc2280f00, 0xf3dc45d9,
+0xa855110f, 0xd9c2150f, 0x0ff3ac5d, 0x0fb04511,
+0x45d9c057, 0xc1c20fe4, 0xb45dd901, 0xc9760f66,
+0xd0f70f66, 0xd875280f, 0x66c1570f, 0x0ff0f70f,
+0x0fb84528, 0x00a845c2, 0x83c0500f, 0xc4b80ff8,
+0x0f000003, 0xc483c244, 0xc35d5f64, 0xc324148b,
+0x40800000, 0x40400000, 0x00000000, 0x00000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0x00000000, 0x00000000, 0x00000000,
+0001474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x031fe8c3,
+0xc2810000, 0x0000035e, 0xc031e8d9, 0x57e58955,
+0xdd64ec83, 0x82d9c855, 0xffffffd0, 0xd9d855dd,
+0xf04589c9, 0xd9e855dd, 0xf445c7c9, 0xbff00000,
+0xddd05ddd, 0x280fe05d, 0x290fc86d, 0x280f986d,
+0x60b89845, 0x0f000002, 0x0f66c828, 0x6600cdc2,
+0x83c9500f, 0x850f03f9, 0x000002bf, 0xc84d280f,
+0xc8580f66, 0xa84d290f, 0xc84d280f, 0x000266b8,
+0x580f6600, 0xc20f66c9, 0x6600a84d, 0x83c9500f,
+0x850f03f9, 0x00000293, 0xa84d280f, 0x4d5c0f66,
+0x4d290fc8, 0xc8280fb8, 0x00026bb8, 0xc20f6600,
+0x6600b84d, 0x83c9500f, 0x850f03f9, 0x0000026b,
+0xd855280f, 0x45590f66, 0x590f66c8, 0x4d280fd2,
+0x65280fc8, 0x580f66d8, 0xd9280fe1, 0xc25c0f66,
+0x000282b8, 0x5c0f6600, 0x0f66d85d, 0x0f66dc59,
+0x6600c3c2, 0x83c8500f, 0x850f03f9, 0x0000022b,
+0xe845280f, 0xc1590f66, 0x9845290f, 0x4d5e0f66,
+0xc20f66e8, 0x0f6600c1, 0xf983c850, 0x028bb803,
+0x850f0000, 0x00000203, 0xe84d280f, 0x00028eb8,
+0x92280f00, 0xffffffe0, 0x0fc1280f, 0x570fc257,
+0x0f66c855, 0x66984559, 0x00c2c20f, 0xc8500f66,
+0x0f03f983, 0x0001d285, 0x5a0f6600, 0x530fc845,
+0xc05a0fc0, 0x9845290f, 0x455a0f66, 0xc0530f98,
+0x000296b8, 0x55280f00, 0xc05a0fc8, 0xc0e60ff2,
+0xc0e60ff3, 0xc2c20f66, 0x500f6600, 0x03f983c8,
+0x0195850f, 0x280f0000, 0x590f66c2, 0x45290fc2,
+0x5a0f6698, 0x520f9845, 0xc05a0fc0, 0xa845290f,
+0xa85d280f, 0x00029db8, 0x5a0f6600, 0xc0530fc3,
+0xf2c05a0f, 0xf3c0e60f, 0x66c0e60f, 0x00d0c20f,
+0xca500f66, 0x0f03f983, 0x00014e85, 0x55280f00,
+0xe60ff2c8, 0xe60ff3db, 0x029fb8db, 0x0f660000,
+0x530fc25a, 0xc05a0fc0, 0xc0e60ff2, 0xc0e60ff3,
+0xd8c20f66, 0x500f6600, 0x03f983cb, 0x0119850f,
+0x280f0000, 0x590f66c2, 0x45290fc2, 0x510f6698,
+0x0f669845, 0x6600c2c2, 0x83c8500f, 0xa7b803f9,
+0x0f000002, 0x0000f285, 0x45280f00, 0xda280fd8,
+0xc1590f66, 0xd9590f66, 0xa845290f, 0x66c3280f,
+0xa8455f0f, 0x5d5d0f66, 0x5d290fa8, 0x580f66a8,
+0x0f66a845, 0x66d85558, 0x66c1590f, 0x00c2c20f,
+0xc8500f66, 0xb803f983, 0x00000348, 0x00a9850f,
+0x280f0000, 0x59b8c845, 0x66000003, 0x01c0c60f,
+0x45c20f66, 0x0f6600d8, 0xf983c850, 0x88850f03,
+0x0f000000, 0x66d84528, 0xc845160f, 0xc855280f,
+0x55120f66, 0x5c0f66e0, 0x590f66c2, 0x45290fc1,
+0xc20f66b8, 0xfffff082, 0x0f6600ff, 0xfa83d050,
+0x0370b803, 0x53750000, 0xc875280f, 0x8dc0570f,
+0x0ff2b87d, 0xf2e07d10, 0xb07d110f, 0x000000ba,
+0xc20f6600, 0x280f01c1, 0x0f66c86d, 0x0f66c976,
+0x66a87513, 0x0fe8f70f, 0x0fd87528, 0x0f66c157,
+0x280ff0f7, 0x0f66b845, 0x00a845c2, 0xc0500f66,
+0xb803f883, 0x000003c4, 0x83c2440f, 0x5d5f64c4,
+0x24148bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x00000000, 0x00000000,
+0001574,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x53e58955,
+0x000459e8, 0x8bc38100, 0x81000004, 0x0000e4ec,
+0x100ff300, 0xffffe083, 0x110ff3ff, 0xffff4c85,
+0x110ff3ff, 0xffff5085, 0x110ff3ff, 0xffff5485,
+0x4c858bff, 0x89ffffff, 0xffff4085, 0x100ff3ff,
+0xffff4085, 0xbac031ff, 0x00000000, 0x4c852e0f,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0x7fe82404,
+0x83ffffff, 0xc18810c4, 0x000260b8, 0x0fc98400,
+0x0003e484, 0x100ff300, 0xffff4085, 0x580ff3ff,
+0xffff4c85, 0x110ff3ff, 0xffff4485, 0x100ff3ff,
+0xffff4c85, 0x10ec83ff, 0x0ff3c031, 0x2e0fc058,
+0xffff4485, 0xc09b0fff, 0xf7c2450f, 0x240489d8,
+0xffff2de8, 0x10c483ff, 0x66b8c188, 0x84000002,
+0x92840fc9, 0xf3000003, 0x4485100f, 0xf3ffffff,
+0x4c855c0f, 0xf3ffffff, 0x2885110f, 0x8bffffff,
+0xffff2885, 0x7c8589ff, 0x89ffffff, 0xffff4485,
+0x488589ff, 0xf3ffffff, 0x4085100f, 0x83ffffff,
+0xc03110ec, 0x48852e0f, 0x0fffffff, 0x450fc09b,
+0x89d8f7c2, 0xc7e82404, 0x83fffffe, 0xc18810c4,
+0x00026bb8, 0x0fc98400, 0x00032c84, 0x100ff300,
+0xffff4085, 0x590ff3ff, 0xffff4c85, 0x110ff3ff,
+0xffff4085, 0x100ff3ff, 0xffff5085, 0x590ff3ff,
+0x110ff3c0, 0xffff4485, 0x100ff3ff, 0xffff4c85,
+0x580ff3ff, 0xffff5085, 0x110ff3ff, 0xffff4885,
+0x100ff3ff, 0xffff4c85, 0x10ec83ff, 0x95100ff3,
+0xffffff40, 0x280fc031, 0x5c0ff3c8, 0xffff508d,
+0x5c0ff3ff, 0xffff4495, 0x590ff3ff, 0xffff488d,
+0x110ff3ff, 0xffff488d, 0xd12e0fff, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffe26, 0x8810c483,
+0x0282b8c1, 0xc9840000, 0x028b840f, 0x0ff30000,
+0xff548559, 0x0ff3ffff, 0xff408511, 0x0ff3ffff,
+0xff4c8510, 0xec83ffff, 0xf3c03110, 0x54855e0f,
+0x0fffffff, 0xff40852e, 0x0ff3ffff, 0xff448511,
+0x9b0fffff, 0xc2450fc0, 0x0489d8f7, 0xfdd0e824,
+0xc483ffff, 0xb8c18810, 0x0000028b, 0x840fc984,
+0x00000235, 0x93100ff3, 0xfffffff0, 0xf310ec83,
+0x5485100f, 0x31ffffff, 0x100ff3c0, 0xffff4c8d,
+0xc2570fff, 0x85590ff3, 0xffffff40, 0x0fca570f,
+0x9b0fc12e, 0xc2450fc0, 0x0489d8f7, 0xfd80e824,
+0xc483ffff, 0xb8c18810, 0x0000028e, 0x840fc984,
+0x000001e5, 0x85530ff3, 0xffffff4c, 0x85110ff3,
+0xffffff40, 0x8d530ff3, 0xffffff40, 0xc12c0ff3,
+0xf310ec83, 0x4c85100f, 0xf3ffffff, 0x31c82a0f,
+0xc82e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffd2e, 0x8810c483, 0x0296b8c1, 0xc9840000,
+0x0193840f, 0x0ff30000, 0x0ff3c059, 0xff408511,
+0x0ff3ffff, 0xff408552, 0x0ff3ffff, 0xff448511,
+0x0ff3ffff, 0xff448553, 0x0ff3ffff, 0xec83c02c,
+0x2a0ff310, 0x0fc031c0, 0xff4c852e, 0x9b0fffff,
+0xc2450fc0, 0x0489d8f7, 0xfcd4e824, 0xc483ffff,
+0xb8c18810, 0x0000029d, 0x840fc984, 0x00000139,
+0x852c0ff3, 0xffffff44, 0xf310ec83, 0x4c85530f,
+0xf3ffffff, 0xf3c82a0f, 0xf3c02c0f, 0x31c02a0f,
+0xc82e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffc8e, 0x8810c483, 0x029fb8c1, 0xc9840000,
+0x00f3840f, 0x0ff30000, 0xff4c8510, 0x0ff3ffff,
+0x0ff3c059, 0xff408511, 0x0ff3ffff, 0xff4c8d10,
+0xec83ffff, 0xf3c03110, 0x4085510f, 0x0fffffff,
+0x9b0fc12e, 0xc2450fc0, 0x0489d8f7, 0xfc40e824,
+0xc483ffff, 0xb8c28810, 0x000002a7, 0x840fd284,
+0x000000a5, 0x85100ff3, 0xffffff54, 0xc8590ff3,
+0x85590ff3, 0xffffff50, 0x8d110ff3, 0xffffff40,
+0x85110ff3, 0xffffff44, 0x85100ff3, 0xffffff40,
+0x855f0ff3, 0xffffff44, 0x85110ff3, 0xffffff48,
+0x85100ff3, 0xffffff40, 0x855d0ff3, 0xffffff44,
+0x85110ff3, 0xffffff44, 0x85100ff3, 0xffffff44,
+0xf310ec83, 0x4c8d100f, 0x31ffffff, 0x580ff3c0,
+0xffff4885, 0x0000baff, 0x0ff30000, 0xff508d58,
+0x0ff3ffff, 0xff548559, 0x2e0fffff, 0xc09b0fc1,
+0xf7c2450f, 0x240489d8, 0xfffb95e8, 0x10c483ff,
+0xc019013c, 0x00034825, 0xfc5d8b00, 0x1c8bc3c9,
+0x0000c324, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002274,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_f8[] = {
+0x94e800eb, 0x81000005, 0x0005b9c1, 0xe5895500,
+0x0198ec81, 0x0ff20000, 0xffe08110, 0x0ff2ffff,
+0xfea08511, 0x0ff2ffff, 0xfea88511, 0x0ff2ffff,
+0xfeb08511, 0x858bffff, 0xfffffea0, 0xfe888589,
+0x858bffff, 0xfffffea4, 0xfe8c8589, 0x0ff2ffff,
+0xfe889d10, 0x0f66ffff, 0xfea09d2e, 0x0c7affff,
+0x000001b8, 0x0000ba00, 0x04740000, 0xd231c031,
+0x8589d8f7, 0xfffffe70, 0xb800d283, 0x00000260,
+0x9589daf7, 0xfffffe74, 0x70856f0f, 0x0ffffffe,
+0xfa81d0d7, 0x000000ff, 0x04fb850f, 0x0ff20000,
+0xfe888510, 0x0ff2ffff, 0xfea08558, 0x0ff2ffff,
+0xfe908511, 0xd231ffff, 0x85100ff2, 0xfffffea0,
+0x000001b8, 0x580ff200, 0x2e0f66c0, 0xfffe9085,
+0x74027aff, 0x31c03104, 0x89d8f7d2, 0xfffe7085,
+0x00d283ff, 0x000266b8, 0x89daf700, 0xfffe7495,
+0x8d6f0fff, 0xfffffe70, 0x81d1d70f, 0x0000fffa,
+0x92850f00, 0xf2000004, 0x9085100f, 0xf2fffffe,
+0xa0855c0f, 0xf2fffffe, 0x7885110f, 0x8bfffffe,
+0xfffe7895, 0x7c858bff, 0x89fffffe, 0xffff0095,
+0x048589ff, 0x89ffffff, 0xfffe9095, 0x948589ff,
+0x89fffffe, 0xfffe9895, 0x9c8589ff, 0x31fffffe,
+0x100ff2d2, 0xfffe88a5, 0x0001b8ff, 0x0f660000,
+0xfe98a52e, 0x027affff, 0xc0310474, 0xd8f7d231,
+0xfe708589, 0xd283ffff, 0x026bb800, 0xdaf70000,
+0xfe749589, 0x6f0fffff, 0xfffe7095, 0xd2d70fff,
+0x00fffa81, 0x850f0000, 0x000003fd, 0x85100ff2,
+0xfffffe88, 0x85590ff2, 0xfffffea0, 0x85110ff2,
+0xfffffe88, 0x85100ff2, 0xfffffea8, 0xc0590ff2,
+0x85110ff2, 0xfffffe90, 0x85100ff2, 0xfffffea0,
+0x85580ff2, 0xfffffea8, 0x85110ff2, 0xfffffe98,
+0x85100ff2, 0xfffffea0, 0x31c8280f, 0x5c0ff2d2,
+0xfffea88d, 0x100ff2ff, 0xfffe8895, 0x590ff2ff,
+0xfffe988d, 0x5c0ff2ff, 0xfffe9095, 0x0001b8ff,
+0x0ff20000, 0xfe988d11, 0x0f66ffff, 0x027ad12e,
+0xc0310474, 0xd8f7d231, 0xfe708589, 0xd283ffff,
+0x0282b800, 0xdaf70000, 0xfe749589, 0x6f0fffff,
+0xfffe709d, 0xd3d70fff, 0x00fffa81, 0x850f0000,
+0x00000345, 0x85590ff2, 0xfffffeb0, 0x85110ff2,
+0xfffffe88, 0x0ff2d231, 0xfea08510, 0x01b8ffff,
+0xf2000000, 0xb0855e0f, 0xf2fffffe, 0x9085110f,
+0x66fffffe, 0x88852e0f, 0x7afffffe, 0x31047402,
+0xf7d231c0, 0x708589d8, 0x83fffffe, 0x8bb800d2,
+0xf7000002, 0x749589da, 0x0ffffffe, 0xfe70a56f,
+0xd70fffff, 0xfffa81d4, 0x0f000000, 0x0002d885,
+0x7e0ff300, 0xfffff089, 0x100ff2ff, 0xfffeb085,
+0x100ff2ff, 0xfffea0ad, 0xc1570fff, 0x570fd231,
+0x590ff2cd, 0xfffe8885, 0x0001b8ff, 0x0f660000,
+0x027ac12e, 0xc0310474, 0xd8f7d231, 0xfe708589,
+0xd283ffff, 0x028eb800, 0xdaf70000, 0xfe749589,
+0x6f0fffff, 0xfffe70ad, 0xd5d70fff, 0x00fffa81,
+0x850f0000, 0x00000271, 0x855a0ff2, 0xfffffea0,
+0xc0530ff3, 0xc05a0ff3, 0x85130f66, 0xfffffe88,
+0x8d5a0ff2, 0xfffffe88, 0xc9530ff3, 0xc95a0ff3,
+0xc12c0ff2, 0x0ff2d231, 0xfea08510, 0x0ff2ffff,
+0x01b8c82a, 0x66000000, 0x7ac82e0f, 0x31047402,
+0xf7d231c0, 0x708589d8, 0x83fffffe, 0x96b800d2,
+0xf7000002, 0x749589da, 0x0ffffffe, 0xfe70b56f,
+0xd70fffff, 0xfffa81d6, 0x0f000000, 0x0001f885,
+0x590ff200, 0x110ff2c0, 0xfffe8885, 0x5a0ff2ff,
+0xfffe8885, 0x520ff3ff, 0x5a0ff3c0, 0x130f66c0,
+0xfffe9085, 0x5a0ff2ff, 0xfffe9085, 0x530ff3ff,
+0x5a0ff3c0, 0x2c0ff2c0, 0xf2d231c0, 0xb8c02a0f,
+0x00000001, 0x852e0f66, 0xfffffea0, 0x0474027a,
+0xd231c031, 0x8589d8f7, 0xfffffe70, 0xb800d283,
+0x0000029d, 0x9589daf7, 0xfffffe74, 0x70bd6f0f,
+0x0ffffffe, 0xfa81d7d7, 0x000000ff, 0x0177850f,
+0x0ff20000, 0xfea0855a, 0x0ff3ffff, 0x0ff3c053,
+0x0ff2c05a, 0x0ff2c02c, 0xfe90952c, 0xc239ffff,
+0x31c0940f, 0xc0b60fd2, 0x8589d8f7, 0xfffffe70,
+0xb800d283, 0x0000029f, 0x9589daf7, 0xfffffe74,
+0x70856f0f, 0x0ffffffe, 0xfa81d0d7, 0x000000ff,
+0x0123850f, 0x0ff20000, 0xfea08510, 0x0ff2ffff,
+0x0ff2c059, 0xfe888511, 0xd231ffff, 0x8d100ff2,
+0xfffffea0, 0x000001b8, 0x510ff200, 0xfffe8885,
+0x2e0f66ff, 0x74027ac1, 0x31c03104, 0x89d8f7d2,
+0xfffe7085, 0x00d283ff, 0x0002a7b8, 0x89daf700,
+0xfffe7495, 0x8d6f0fff, 0xfffffe70, 0x81d1d70f,
+0x0000fffa, 0xbe850f00, 0xf2000000, 0xb085100f,
+0xf2fffffe, 0xf2c8590f, 0xa885590f, 0xf2fffffe,
+0x888d110f, 0xf2fffffe, 0x9085110f, 0xf2fffffe,
+0x8885100f, 0xf2fffffe, 0x90855f0f, 0xf2fffffe,
+0x9885110f, 0xf2fffffe, 0x8885100f, 0xf2fffffe,
+0x90855d0f, 0xf2fffffe, 0x9085110f, 0x31fffffe,
+0x100ff2d2, 0xfffe9085, 0x100ff2ff, 0xfffea08d,
+0x580ff2ff, 0xfffe9885, 0x580ff2ff, 0xfffea88d,
+0x590ff2ff, 0xfffeb085, 0x0001b8ff, 0x0f660000,
+0x027ac12e, 0xc0310474, 0xd8f7d231, 0xfe708589,
+0xd283ffff, 0x89daf700, 0xfffe7495, 0x0348baff,
+0x6f0f0000, 0xfffe7095, 0xc2d70fff, 0x0000ff3d,
+0x0000b800, 0x450f0000, 0x8bc3c9c2, 0x00c3240c,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i1[] = {
+0x315500eb, 0x4810b1c0, 0x508de589, 0x05548801,
+0x29ca89c0, 0x055488c2, 0x83c289d0, 0xfa8301e2,
+0x83d21901, 0xcaff02e2, 0xe0055488, 0x48c0ff48,
+0x7510f883, 0x75280fd5, 0x75290fc0, 0x4d280f90,
+0x0260b890, 0x280f0000, 0x740f66c1, 0xd70f66c6,
+0xfffa81d0, 0x0f0000ff, 0x00012685, 0x45280f00,
+0xfc0f66c0, 0x45290fc1, 0x45280fa0, 0x0266b8c0,
+0x0f660000, 0x0f66c0fc, 0x66a04574, 0x81d0d70f,
+0x00fffffa, 0xf8850f00, 0x0f000000, 0x66a04528,
+0xc045f80f, 0xb045290f, 0x4d740f66, 0x026bb8b0,
+0x0f660000, 0xfa81d1d7, 0x0000ffff, 0x00d1850f,
+0x280f0000, 0x280fd05d, 0x600f66d3, 0x290fc055,
+0x280f9055, 0x680f66cb, 0x290fc04d, 0x280fa04d,
+0x0f66e045, 0x70b8d1f8, 0x0f000003, 0x280fea28,
+0xe0280fc8, 0xea600f66, 0xc8600f66, 0xd2680f66,
+0xe0680f66, 0xe2d50f66, 0xcdd50f66, 0x8d15280f,
+0x0f000000, 0x540fca54, 0x670f66d4, 0x4d290fca,
+0x740f66b0, 0x0000870d, 0xd70f6600, 0xfffa81d1,
+0x750000ff, 0x4d280f5e, 0x0fc031c0, 0x01a8d328,
+0x280f0375, 0x55290fd1, 0x05548af0, 0x055488f0,
+0xc0ff48a0, 0x10f88348, 0x570fe175, 0x7d8d48d2,
+0x0000bab0, 0x0f660000, 0x0f66c264, 0x0f66c8f7,
+0x550fc976, 0xf70f66c1, 0x45280fd8, 0x740f66b0,
+0x0f66a045, 0xff3dc0d7, 0xb80000ff, 0x000003c4,
+0x5dc2440f, 0x000000c3, 0x00000000, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000660,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u1[] = {
+0x315500eb, 0x4810b1c0, 0x508de589, 0x05548801,
+0x29ca89c0, 0x055488c2, 0x83c289d0, 0xcaff01e2,
+0xe0055488, 0x48c0ff48, 0x7510f883, 0x75280fdd,
+0x75290fc0, 0x4d280f90, 0x0260b890, 0x280f0000,
+0x740f66c1, 0xd70f66c6, 0xfffa81d0, 0x0f0000ff,
+0x00017685, 0x45280f00, 0xfc0f66c0, 0x45290fc1,
+0x45280fa0, 0x0266b8c0, 0x0f660000, 0x0f66c0fc,
+0x66a04574, 0x81d0d70f, 0x00fffffa, 0x48850f00,
+0x0f000001, 0x66a04528, 0xc045f80f, 0xb045290f,
+0xb8d1280f, 0x0000026b, 0x55740f66, 0xd70f66b0,
+0xfffa81d2, 0x0f0000ff, 0x00011e85, 0x4d560f00,
+0x4d290fd0, 0x45540f90, 0x4d280fd0, 0x4d570fb0,
+0x45550fd0, 0x760f6690, 0x0277b8d2, 0x0f660000,
+0x0f66c174, 0xfa81d0d7, 0x0000ffff, 0x00e9850f,
+0x280f0000, 0x280fc04d, 0x0f66d045, 0x280fc1da,
+0x0f66d05d, 0x0f66d9de, 0x66d04dfc, 0xb8c3fc0f,
+0x0000033f, 0xc1740f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x000000b3, 0xd05d280f, 0x66e3280f,
+0xc065600f, 0x9065290f, 0x66c3280f, 0xc045680f,
+0xe04d280f, 0xc2fc0f66, 0x000370b8, 0xf80f6600,
+0xe1280fc4, 0x0fc1570f, 0x0f66e257, 0x0f66c4f8,
+0x007a0574, 0x0f660000, 0xfa81d0d7, 0x0000ffff,
+0x280f6975, 0x570fc065, 0x0fc031ed, 0x0f66c428,
+0x290fc560, 0x0f66a045, 0x290fc560, 0x280fb045,
+0x7501a8c3, 0xc4280f03, 0xf045290f, 0xf005548a,
+0xa0055488, 0x48c0ff48, 0x7510f883, 0x7d8d48e1,
+0x0000bab0, 0x0f660000, 0x570fe1f7, 0xf70f66ca,
+0x45280fd9, 0x740f66b0, 0x0f66a045, 0xff3dc0d7,
+0xb80000ff, 0x000003c4, 0x5dc2440f, 0x000000c3,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000740,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d18, 0x66cf8944, 0x8e454489, 0xc729f289,
+0x6601e283, 0x9e457c89, 0x1901fa83, 0x02e283d2,
+0xc685caff, 0xc6940f40, 0x45548966, 0xb60f40ae,
+0x66f129f6, 0xbe454c89, 0x48c0ff48, 0x7509f883,
+0x7d280fc0, 0xbd290f90, 0xffffff60, 0x6085280f,
+0xb8ffffff, 0x00000260, 0x66c8280f, 0x66cf750f,
+0x81d1d70f, 0x00fffffa, 0x81850f00, 0x0f000004,
+0x66904d28, 0x0fc8fd0f, 0xff708d29, 0x280fffff,
+0x66b8904d, 0x66000002, 0x01f1710f, 0x8d750f66,
+0xffffff70, 0xd1d70f66, 0xfffffa81, 0x850f0000,
+0x0000044c, 0x708d280f, 0x66ffffff, 0x904df90f,
+0x804d290f, 0xb8c8280f, 0x0000026b, 0x4d750f66,
+0xd70f6680, 0xfffa81d1, 0x0f0000ff, 0x00041f85,
+0x4d280f00, 0xd50f66a0, 0x0f669045, 0x280fc9d5,
+0x280f9055, 0x0f66a065, 0x280fe2fd, 0xf90f66da,
+0x0f66a05d, 0x82b8c1f9, 0x66000002, 0x66dcd50f,
+0x66c3750f, 0x81d0d70f, 0x00fffffa, 0xdd850f00,
+0x0f000003, 0x66a04528, 0x66c2d50f, 0xdd05750f,
+0xb8000003, 0x000002d3, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x000003b8, 0x66ca280f, 0xb04de50f,
+0xb05d280f, 0xb8c0570f, 0x000002da, 0xc3650f66,
+0xc1750f66, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x0000038c, 0x66c3280f, 0x0fc2d50f, 0x0f804529,
+0x66804d28, 0x03f1710f, 0x608d290f, 0x0fffffff,
+0x66804528, 0x02f0710f, 0x7085290f, 0x66ffffff,
+0xb8c0fd0f, 0x000002f8, 0xc1750f66, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x00000344, 0x6085280f,
+0x66ffffff, 0x02e0710f, 0xc0fd0f66, 0x0002fdb8,
+0x750f6600, 0xffff7085, 0xd70f66ff, 0xfffa81d0,
+0x0f0000ff, 0x00031785, 0x5c85c700, 0x03ffffff,
+0x0f000000, 0x0f66c228, 0x6348c3d5, 0xffff5c85,
+0xc8280fff, 0x6e0f4866, 0xf10f66f8, 0x5c85c7cf,
+0x02ffffff, 0x48000000, 0xff5c8563, 0x4866ffff,
+0x66f06e0f, 0x0fc6f10f, 0xff708529, 0x0f66ffff,
+0x10b8c0fd, 0x66000003, 0x66c1750f, 0x81d0d70f,
+0x00fffffa, 0xb5850f00, 0x48000002, 0xff5c8563,
+0x4866ffff, 0x66f86e0f, 0x0fcfe10f, 0x0f66c128,
+0x14b8c1fd, 0x66000003, 0x7085750f, 0x66ffffff,
+0x81d0d70f, 0x00fffffa, 0x81850f00, 0x0f000002,
+0x280fca28, 0x570fc045, 0xd50f66e4, 0x650f66cb,
+0xc1540fc4, 0x8045290f, 0x8b80458b, 0xc689c04d,
+0x6d8b4466, 0x847d8b82, 0x658b4466, 0x66e6d386,
+0x8bc24d8b, 0x89418855, 0x8b4466fa, 0x8b448a5d,
+0x0f668c4d, 0xd341e66e, 0xc44d8be5, 0x66d08941,
+0x8e758b44, 0x66db8944, 0xe5c40f41, 0xe2d34101,
+0xc64d8b66, 0x6e0f4166, 0xe4d341ea, 0x66c84d8b,
+0xecc40f41, 0xe0d34101, 0xca4d8b66, 0xe5620f66,
+0x6e0f4166, 0x8be3d3c0, 0x0f66cc4d, 0x4101c3c4,
+0x8b66e1d3, 0x4166ce4d, 0x41c96e0f, 0x4166e6d3,
+0x01cec40f, 0xc1620f66, 0xe06c0f66, 0xc045280f,
+0x05f90f66, 0x000001e8, 0xc045290f, 0x66c04d8b,
+0x82458b44, 0x4d8b4466, 0x8c758b86, 0x8b66e0d3,
+0x8b66c24d, 0x0f668e5d, 0x2cb8c06e, 0x41000003,
+0x4d8be0d3, 0x0f4166c4, 0xd301c0c4, 0x4d8b66e7,
+0x6e0f66c6, 0xe1d341f7, 0x66c84d8b, 0xf1c40f41,
+0x66e2d301, 0x66ca4d8b, 0x66c6620f, 0x41ca6e0f,
+0x4d8be3d3, 0x0f4166cc, 0xd301cbc4, 0x4d8b66e6,
+0x6e0f66ce, 0x66e3d3ee, 0x01ebc40f, 0xcd620f66,
+0xc16c0f66, 0xc0fd0f66, 0xc4750f66, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x00000134, 0xa045280f,
+0x66cb280f, 0x66cad50f, 0x0fc3d50f, 0xff708529,
+0x280fffff, 0xffff7085, 0xee0f66ff, 0xea0f66c1,
+0xffff708d, 0x8d290fff, 0xffffff70, 0x85fd0f66,
+0xffffff70, 0x55fd0f66, 0x0348b8a0, 0x0f660000,
+0x0f66c3d5, 0x0f66c275, 0xfa81d0d7, 0x0000ffff,
+0x00da850f, 0x0ff20000, 0x1b904570, 0xa04d280f,
+0x000359b8, 0x700ff300, 0x0f661bc0, 0x664ec070,
+0x66c1750f, 0x81d0d70f, 0x00fffffa, 0xad850f00,
+0x0f000000, 0x0f66c128, 0x0f904561, 0xff608529,
+0x280fffff, 0x690f66d1, 0x290f9055, 0xffff7095,
+0xf90f66ff, 0x0370b8c2, 0x0f660000, 0x290fc3d5,
+0x0f668045, 0x00a60575, 0x0f660000, 0xfa81d0d7,
+0x0000ffff, 0x280f6a75, 0xc0319045, 0xa8d1280f,
+0x0f037501, 0x290fd028, 0x8b66d055, 0x66d04554,
+0x70459489, 0x48ffffff, 0x8348c0ff, 0xdc7508f8,
+0x48c9570f, 0xba807d8d, 0x00000000, 0xd9650f66,
+0xc3f70f66, 0xc0760f66, 0xa075280f, 0x66c3570f,
+0x0ff0f70f, 0x66804528, 0x7085750f, 0x66ffffff,
+0x3dc0d70f, 0x0000ffff, 0x0003c4b8, 0xc2440f00,
+0x18c48348, 0x415c415b, 0x5d5e415d, 0x000000c3,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002520,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d18, 0x66cf8944, 0x8e454489, 0xc729f189,
+0x6601e183, 0x9e457c89, 0xc685c9ff, 0xc6940f40,
+0x454c8966, 0xb60f40ae, 0x66f229f6, 0xbe455489,
+0x48c0ff48, 0x7509f883, 0x7d280fc8, 0xbd290f90,
+0xffffff60, 0x608d280f, 0xb8ffffff, 0x00000260,
+0x66c1280f, 0x66c7750f, 0x81d0d70f, 0x00fffffa,
+0x15850f00, 0x0f000004, 0x66904528, 0x0fc1fd0f,
+0xff708529, 0x280fffff, 0x66b89045, 0x66000002,
+0x01f0710f, 0x85750f66, 0xffffff70, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x000003e0, 0x7085280f,
+0x66ffffff, 0x9045f90f, 0x8045290f, 0xb8d1280f,
+0x0000026b, 0x55750f66, 0xd70f6680, 0xfffa81d2,
+0x0f0000ff, 0x0003b385, 0x4d560f00, 0x8d290fa0,
+0xffffff60, 0xa045540f, 0x804d280f, 0xa04d570f,
+0x6085550f, 0x66ffffff, 0xb8d2760f, 0x00000277,
+0xc1750f66, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x00000378, 0x9045280f, 0xa04d280f, 0xc8d50f66,
+0x0d750f66, 0x00000378, 0x0002d3b8, 0xd70f6600,
+0xfffa81d1, 0x0f0000ff, 0x00034f85, 0xe0280f00,
+0x65e40f66, 0x4d280fb0, 0xd8280fb0, 0x0002dcb8,
+0xd9540f00, 0xd9fd0f66, 0xdc750f66, 0xd3d70f66,
+0xfffffa81, 0x850f0000, 0x00000320, 0x8045290f,
+0x8065280f, 0xf4710f66, 0xa5290f03, 0xffffff60,
+0x805d280f, 0xf3710f66, 0x9d290f02, 0xffffff70,
+0xdbfd0f66, 0x0002f8b8, 0x750f6600, 0xd70f66dc,
+0xfffa81d3, 0x0f0000ff, 0x0002df85, 0x9d280f00,
+0xffffff60, 0xd3710f66, 0xfd0f6602, 0x02fdb8db,
+0x0f660000, 0xff709d75, 0x0f66ffff, 0xfa81d3d7,
+0x0000ffff, 0x02b2850f, 0x85c70000, 0xffffff5c,
+0x00000003, 0xa56e0f66, 0xffffff5c, 0x66d8280f,
+0xc7dcf10f, 0xffff5c85, 0x000002ff, 0x6e0f6600,
+0xffff5ca5, 0xf10f66ff, 0x85290fc4, 0xffffff70,
+0xc0fd0f66, 0x000310b8, 0x750f6600, 0xd70f66c3,
+0xfffa81d0, 0x0f0000ff, 0x00025f85, 0x6e0f6600,
+0xffff5ca5, 0xd10f66ff, 0xc3280fdc, 0xc3fd0f66,
+0x000314b8, 0x750f6600, 0xffff7085, 0xd70f66ff,
+0xfffa81d0, 0x0f0000ff, 0x00022f85, 0xe4570f00,
+0x66c4280f, 0xc045750f, 0xc4750f66, 0x9045540f,
+0x8045290f, 0x8b80458b, 0xc689c04d, 0x6d8b4466,
+0x847d8b82, 0x658b4466, 0x66e6d386, 0x8bc24d8b,
+0x89418855, 0x8b4466fa, 0x8b448a5d, 0x0f668c4d,
+0xd341ee6e, 0xc44d8be5, 0x66d08941, 0x8e758b44,
+0x66db8944, 0xedc40f41, 0xe2d34101, 0xc64d8b66,
+0x6e0f4166, 0xe4d341f2, 0x66c84d8b, 0xf4c40f41,
+0xe0d34101, 0xca4d8b66, 0xee620f66, 0x6e0f4166,
+0x8be3d3c0, 0x0f66cc4d, 0x4101c3c4, 0x8b66e1d3,
+0x4166ce4d, 0x41d96e0f, 0x4166e6d3, 0x01dec40f,
+0xc3620f66, 0xe86c0f66, 0xc045280f, 0xc2fd0f66,
+0xc045290f, 0x66c04d8b, 0x82458b44, 0x4d8b4466,
+0x8c758b86, 0x8b66e0d3, 0x8b66c24d, 0x0f668e5d,
+0x2cb8c06e, 0x41000003, 0x4d8be0d3, 0x0f4166c4,
+0xd301c0c4, 0x4d8b66e7, 0x6e0f66c6, 0xe1d341ff,
+0x66c84d8b, 0xf9c40f41, 0x66e2d301, 0x66ca4d8b,
+0x66c7620f, 0x41da6e0f, 0x4d8be3d3, 0x0f4166cc,
+0xd301dbc4, 0x4d8b66e6, 0x6e0f66ce, 0x66e3d3f6,
+0x01f3c40f, 0xde620f66, 0xc36c0f66, 0xc0fd0f66,
+0xc5750f66, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x000000e8, 0x45700ff2, 0x280f1b90, 0x59b8a05d,
+0xf3000003, 0x1bc0700f, 0xc0700f66, 0x750f664e,
+0xd70f66c3, 0xfffa81d0, 0x0f0000ff, 0x0000bb85,
+0xeb280f00, 0x6d610f66, 0xad290f90, 0xffffff60,
+0x66c3280f, 0x9045690f, 0xc2fd0f66, 0xb8d1570f,
+0x00000370, 0xc5f90f66, 0x66c1570f, 0x66c2f90f,
+0xa905750f, 0x66000000, 0x81d0d70f, 0x00fffffa,
+0x0f797500, 0x31905528, 0xc2280fc0, 0xc4610f66,
+0x7085290f, 0x66ffffff, 0x0fc4610f, 0x0f804529,
+0x01a8c328, 0x280f0375, 0x45290fc2, 0x548b66d0,
+0x8966d045, 0xff704594, 0xff48ffff, 0xf88348c0,
+0x48dc7508, 0x66807d8d, 0xbac0760f, 0x00000000,
+0xd1f70f66, 0xa07d280f, 0x66c1570f, 0x0ff8f70f,
+0x66804528, 0x7085750f, 0x66ffffff, 0x3dc0d70f,
+0x0000ffff, 0x0003c4b8, 0xc2440f00, 0x18c48348,
+0x415c415b, 0x5d5e415d, 0x000000c3, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002320,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0x0ff84589, 0x0fe07528,
+0x0fb07529, 0xb8b04528, 0x00000260, 0x66c8280f,
+0x0fce760f, 0xfa83d150, 0x1f850f0f, 0x0f000003,
+0x66e04d28, 0x0fc8fe0f, 0x0fc04d29, 0xb8e04d28,
+0x00000266, 0xf1720f66, 0x760f6601, 0x500fc04d,
+0x0ffa83d1, 0x02f4850f, 0x280f0000, 0x0f66c04d,
+0x0fe04dfa, 0x0fd04d29, 0x6bb8c828, 0x66000002,
+0xd04d760f, 0x83d1500f, 0x850f0ffa, 0x000002ce,
+0x45f40f66, 0x700f66e0, 0x280f08c0, 0x280fb04d,
+0x280fe055, 0x45280fd8, 0x730f66f0, 0x0f6620d2,
+0x0f20d173, 0x0f66e028, 0x0f66caf4, 0x0f66e0f4,
+0x6620d073, 0x66c0f40f, 0x08c9700f, 0xe4700f66,
+0x620f6608, 0x700f66d9, 0x0f6608c0, 0x280fe062,
+0x280fe045, 0x0f66f04d, 0x280fc8fe, 0xd0280fe9,
+0x55fa0f66, 0xfa0f66f0, 0x0282b8dc, 0x0f660000,
+0x6620d573, 0x66caf40f, 0x20d2730f, 0xd5f40f66,
+0xc9700f66, 0x700f6608, 0x0f6608d2, 0x0f66ca62,
+0x500fcb76, 0x0ffa83d1, 0x0230850f, 0x280f0000,
+0x280fe055, 0x0f66f04d, 0x66f045f4, 0x08c0700f,
+0xd2730f66, 0x730f6620, 0x0f6620d1, 0x0f66caf4,
+0x6608c970, 0x66c1620f, 0x0105760f, 0xb8000002,
+0x000002d3, 0x83d0500f, 0x850f0ffa, 0x000001ee,
+0x000001b8, 0xffc98300, 0xc06e0f66, 0xc96e0f66,
+0xf86e0f66, 0xc0700f66, 0x100ff3e1, 0x700f66c1,
+0x0f66e1c0, 0xf3c6c070, 0x66c7100f, 0xc6c0700f,
+0xc0700f66, 0x100ff327, 0x700f66c1, 0x280f27c0,
+0xc8280fd8, 0x4df40f66, 0x700f66e0, 0x0f6608c9,
+0x6620d373, 0x66d3f40f, 0x08d2700f, 0xca620f66,
+0xd04d290f, 0xd065280f, 0xf4720f66, 0x65290f03,
+0x55280fb0, 0x720f66d0, 0x290f02f2, 0x0f66c055,
+0xf8b8d2fe, 0x66000002, 0x0fd4760f, 0xfa83d250,
+0x57850f0f, 0x0f000001, 0x66b05528, 0x02e2720f,
+0xd2fe0f66, 0x0002fdb8, 0x760f6600, 0x500fc055,
+0x0ffa83d2, 0x0134850f, 0x45c70000, 0x000003ac,
+0x45634800, 0xd1280fac, 0x6e0f4866, 0xf20f66f0,
+0xac45c7d6, 0x00000002, 0xac456348, 0x6e0f4866,
+0xf20f66f8, 0x4d290fcf, 0xfe0f66c0, 0x0310b8c9,
+0x0f660000, 0x500fca76, 0x0ffa83d1, 0x00ec850f,
+0x63480000, 0x4866ac45, 0x66e86e0f, 0x0fd5e20f,
+0x0f66ca28, 0x14b8cafe, 0x66000003, 0xc04d760f,
+0x83d1500f, 0x850f0ffa, 0x000000c2, 0xf055280f,
+0x4d700f66, 0x59b81be0, 0x66000003, 0x0fca760f,
+0xfa83d150, 0xa3850f0f, 0x0f000000, 0x0f66ca28,
+0x66e04d62, 0xe0556a0f, 0xcafa0f66, 0x000370b8,
+0xd1280f00, 0xd1730f66, 0xf40f6620, 0xf40f66d0,
+0x700f66cb, 0x0f6608d2, 0x6608c970, 0x0fd1620f,
+0x66d05529, 0x7515760f, 0x0f000000, 0xfa83d250,
+0x0f5b750f, 0x8be04d28, 0x8d48f445, 0x00bad07d,
+0x0f000000, 0x4589d128, 0xfc458bc4, 0xd16a0f66,
+0x4d7e0f66, 0x7e0f66c0, 0x570fc855, 0xcc4589d2,
+0xc2660f66, 0xc8f70f66, 0xc9760f66, 0xf075280f,
+0x66c1570f, 0x0ff0f70f, 0x66d04528, 0xc045760f,
+0x83c0500f, 0xc4b80ff8, 0x0f000003, 0xc35dc244,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0001640,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u4[] = {
+0x315500eb, 0x0004bfc0, 0x89480000, 0x89c289e5,
+0x01488dfe, 0x2901e283, 0x854c89c6, 0x89caffd0,
+0x89e08574, 0x48f08554, 0x8348c0ff, 0xdd7504f8,
+0xd06d280f, 0xa06d290f, 0xa04d280f, 0x000260b8,
+0xc1280f00, 0xc5760f66, 0x83d0500f, 0x850f0ffa,
+0x0000028b, 0xd045280f, 0xc1fe0f66, 0xb045290f,
+0xd045280f, 0x000266b8, 0x720f6600, 0x0f6601f0,
+0x0fb04576, 0xfa83d050, 0x60850f0f, 0x0f000002,
+0x66b04528, 0xd045fa0f, 0xc045290f, 0xb8d1280f,
+0x0000026b, 0x55760f66, 0xd2500fc0, 0x0f0ffa83,
+0x00023a85, 0x4d560f00, 0x4d290fe0, 0x45540fa0,
+0x4d280fe0, 0x4d570fc0, 0x45550fe0, 0x760f66a0,
+0x0277b8d2, 0x0f660000, 0x500fc176, 0x0ffa83d0,
+0x0209850f, 0x280f0000, 0x280fd05d, 0x280fe065,
+0x0f66d045, 0x6620d473, 0x20d3730f, 0xdcf40f66,
+0x66c8280f, 0xe04df40f, 0xc9700f66, 0x700f6608,
+0x0f6608db, 0x0f66cb62, 0x01e20d76, 0xd3b80000,
+0x0f000002, 0xfa83d150, 0xc0850f0f, 0x0f000001,
+0x0ff04d28, 0x0f66c857, 0x290fc87e, 0x0f66a04d,
+0x8be04df4, 0x0f48e055, 0x558bc2af, 0x458948e8,
+0xa8458bc0, 0xc2af0f48, 0xc8458948, 0x0002ecb8,
+0x760f6600, 0x500fc04d, 0x0ffa83d1, 0x017d850f,
+0x290f0000, 0x280fc045, 0x0f66c05d, 0x0f03f372,
+0x0fa05d29, 0x66c04d28, 0x02f1720f, 0xb04d290f,
+0xc9fe0f66, 0x0002f8b8, 0x760f6600, 0xd1500fcb,
+0x0f0ffa83, 0x00014685, 0x4d280f00, 0x720f66a0,
+0x0f6602d1, 0xfdb8c9fe, 0x66000002, 0xb04d760f,
+0x83d1500f, 0x850f0ffa, 0x00000123, 0x039c45c7,
+0x66000000, 0x9c5d6e0f, 0x66c8280f, 0xc7cbf20f,
+0x00029c45, 0x0f660000, 0x669c5d6e, 0x0fc3f20f,
+0x66b04529, 0xb8c0fe0f, 0x00000310, 0xc1760f66,
+0x83d0500f, 0x850f0ffa, 0x000000e3, 0x5d6e0f66,
+0xd20f669c, 0xc1280fcb, 0xc1fe0f66, 0x000314b8,
+0x760f6600, 0x500fb045, 0x0ffa83d0, 0x00bd850f,
+0x280f0000, 0x0f66e045, 0x1bd04d70, 0x000359b8,
+0x760f6600, 0xd1500fc8, 0x0f0ffa83, 0x00009e85,
+0xd8280f00, 0x5d620f66, 0x6a0f66d0, 0x280fd045,
+0x0f66f04d, 0x70b8c2fe, 0x66000003, 0x0fc3fa0f,
+0x570fc157, 0xfa0f66d1, 0x760f66c2, 0x00008f05,
+0xd0500f00, 0x750ffa83, 0x45280f66, 0xe4458bd0,
+0x48db570f, 0xbac07d8d, 0x00000000, 0x89d0280f,
+0x458bb445, 0x620f66ec, 0x7e0f66d3, 0x0f66b045,
+0x4589d362, 0x55290fbc, 0xd0280fc0, 0xd06a0f66,
+0x557e0f66, 0xf70f66b8, 0x760f66c1, 0x75280fc0,
+0xc1570fe0, 0xf0f70f66, 0xc045280f, 0x45760f66,
+0xc0500fb0, 0xb80ff883, 0x000003c4, 0x5dc2440f,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0001420,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0x280f0000, 0x290fe07d, 0xc031b07d,
+0xb04d8b48, 0xe04d3b48, 0x48c0940f, 0x4866d8f7,
+0x48c06e0f, 0x48b8458b, 0x0fe84539, 0xb60fc094,
+0xd8f748c0, 0x6e0f4866, 0x0260b8f8, 0x0f660000,
+0x0f66c76c, 0xfa83d050, 0x64850f03, 0x0f000005,
+0x0fb05528, 0x66e04528, 0x0fc2d40f, 0x0fc04529,
+0x66e04528, 0x01f0730f, 0x7e0f4866, 0x453948c0,
+0xe8120fc0, 0x0fc0940f, 0xf748c0b6, 0xc28948d8,
+0x7e0f4866, 0x453948e8, 0xc0940fc8, 0x6e0f4866,
+0xc0b60fc2, 0x66d8f748, 0xf86e0f48, 0x000266b8,
+0x6c0f6600, 0x500f66c7, 0x03fa83d0, 0x0501850f,
+0x280f0000, 0x0f66c045, 0x0fe045fb, 0x31d04529,
+0x4d3b48c0, 0xc0940fd0, 0x66d8f748, 0xc06e0f48,
+0xb8458b48, 0xd8453948, 0x0fc0940f, 0xf748c0b6,
+0x0f4866d8, 0x6bb8e86e, 0x66000002, 0x66c56c0f,
+0x83d0500f, 0x850f03fa, 0x000004b7, 0xe065280f,
+0x0fca280f, 0x0f66c228, 0x6620d173, 0x66ccf40f,
+0x0fc4f40f, 0x0f66dc28, 0x6620d373, 0x66d3f40f,
+0x0fcad40f, 0x66f05528, 0x20f1730f, 0xc1d40f66,
+0x0fca280f, 0x0f66da28, 0x6620d173, 0x66daf40f,
+0x66caf40f, 0x66c9d40f, 0x20f1730f, 0xd9d40f66,
+0xe06d280f, 0x66fd280f, 0x0ffad40f, 0x0f66f528,
+0x0ff075fb, 0x0f66e728, 0x6620d473, 0x0fc3fb0f,
+0x0f66ce28, 0x280fe6f4, 0x730f66d6, 0x0f6620d1,
+0x4866d7f4, 0x66c07e0f, 0x0fcff40f, 0x0f66f012,
+0x0f66ccd4, 0x6620f173, 0x66cad40f, 0xca7e0f48,
+0x48f9120f, 0x4866c239, 0x0ffa7e0f, 0xb60fc094,
+0xd8f748c0, 0x66c18948, 0xf07e0f48, 0x66c23948,
+0xc16e0f48, 0x0fc0940f, 0xf748c0b6, 0x0f4866d8,
+0x82b8f86e, 0x66000002, 0x66c76c0f, 0x83d0500f,
+0x850f03fa, 0x000003cb, 0xf045280f, 0x0fe5280f,
+0x0f66cd28, 0x0f20d473, 0x0f66d028, 0x0f66c8f4,
+0x6620d273, 0x66c4f40f, 0x66d5f40f, 0x66c2d40f,
+0x20f0730f, 0xc1d40f66, 0x7e0f4866, 0x45290fc0,
+0xf88348b0, 0xc0940f02, 0x48c0b60f, 0x4866d8f7,
+0x31c06e0f, 0x7d8348c0, 0x940f02b8, 0xd8f748c0,
+0x6e0f4866, 0x02d3b8f0, 0x0f660000, 0x0f66c66c,
+0xfa83d050, 0x58850f03, 0x0f000003, 0x037e1528,
+0x280f0000, 0xcd280fc4, 0xc2f40f66, 0xcaf40f66,
+0x66da280f, 0x20d3730f, 0xebf40f66, 0xc5d40f66,
+0xf0730f66, 0xd40f6620, 0x45290fc1, 0x45280fd0,
+0x730f66d0, 0x486603f0, 0x0fc27e0f, 0x0fb04529,
+0x66d04528, 0x02f0730f, 0xc045290f, 0xc0d40f66,
+0xe2f40f66, 0x7e0f4866, 0xf8120fc0, 0x0fc23948,
+0xb60fc094, 0xd8f748c0, 0x66c28948, 0xf87e0f48,
+0xb8453948, 0x66c0940f, 0xc26e0f48, 0x48c0b60f,
+0x4866d8f7, 0xb8f06e0f, 0x000002f8, 0xc66c0f66,
+0xd0500f66, 0x0f03fa83, 0x0002b685, 0x75280f00,
+0xc6280fb0, 0xe6720f66, 0x730f6602, 0x0f6602d0,
+0x66ddf670, 0x88c0700f, 0xc6620f66, 0xc0d40f66,
+0x7e0f4866, 0x453948c0, 0xf8120fc0, 0x0fc0940f,
+0xf748c0b6, 0xc28948d8, 0x7e0f4866, 0x453948f8,
+0xc0940fc8, 0x6e0f4866, 0xc0b60fc2, 0x66d8f748,
+0xf06e0f48, 0x0002fdb8, 0x6c0f6600, 0x500f66c6,
+0x03fa83d0, 0x0249850f, 0x0f660000, 0x45c7e5d4,
+0x000003ac, 0xc4280f00, 0xf0730f66, 0xd40f6620,
+0x456348c8, 0xc1280fac, 0x6e0f4866, 0xf30f66e8,
+0xac45c7c5, 0x00000002, 0xac456348, 0x6e0f4866,
+0xf30f66e8, 0x4d290fcd, 0xd40f66c0, 0x0f4866c9,
+0x4866c07e, 0x0fca7e0f, 0x3948e912, 0xc0940fc2,
+0x48c0b60f, 0x8948d8f7, 0x0f4866c2, 0x120fe87e,
+0x0f4866e8, 0x4866e97e, 0x48ca6e0f, 0x940fc839,
+0xc0b60fc0, 0x66d8f748, 0xf86e0f48, 0x000310b8,
+0x6c0f6600, 0x500f66cf, 0x03fa83d1, 0x01b1850f,
+0x63480000, 0x280fac55, 0x0040b8c8, 0x0f660000,
+0x481fe172, 0x4866d029, 0x66f26e0f, 0xf5c9700f,
+0x6e0f4866, 0xd30f66e8, 0xf30f66c6, 0xc1560fcd,
+0xc0d40f66, 0x7e0f4866, 0x453948c0, 0xf8120fc0,
+0x0fc0940f, 0xf748c0b6, 0xc28948d8, 0x7e0f4866,
+0x453948f8, 0xc0940fc8, 0x6e0f4866, 0xc0b60fc2,
+0x66d8f748, 0xf06e0f48, 0x000314b8, 0x6c0f6600,
+0x500f66c6, 0x03fa83d0, 0x0135850f, 0x0f660000,
+0x4ee04d70, 0x7e0f4866, 0x453948c8, 0xe9120ff0,
+0x0fc0940f, 0xf748c0b6, 0x0f4866d8, 0x4866c06e,
+0x48e87e0f, 0x0ff84539, 0xb60fc094, 0xd8f748c0,
+0x6e0f4866, 0x0359b8f8, 0x0f660000, 0x0f66c76c,
+0xfa83d050, 0xe8850f03, 0x0f000000, 0x0ff04528,
+0x0f66e028, 0x66e0656c, 0xe0456d0f, 0xe0fb0f66,
+0x66cc280f, 0x0fdcf40f, 0x0f66c428, 0x6620d173,
+0x66c2f40f, 0x66caf40f, 0x66cbd40f, 0x20f1730f,
+0xc1d40f66, 0x7e0f4866, 0xd8120fc0, 0xd045290f,
+0x0fc8ff48, 0xb60fc094, 0xd8f748c0, 0x66c28948,
+0xd87e0f48, 0x66c8ff48, 0xc26e0f48, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x70b8d86e, 0x66000003,
+0x66c36c0f, 0x83d0500f, 0x677503fa, 0xe045280f,
+0x690d280f, 0x48000000, 0xbad07d8d, 0x00000000,
+0xc1f70f66, 0x7e0f4866, 0x5d280fc0, 0x05280ff0,
+0x0000005c, 0xd8f70f66, 0xd0453948, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x8b48c06e, 0x3948f845,
+0x940fd845, 0xc0b60fc0, 0x66d8f748, 0xf06e0f48,
+0xc66c0f66, 0xc0500f66, 0xb803f883, 0x000003c4,
+0x5dc2440f, 0x000000c3, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0003020,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0x280f0000, 0x290fe075, 0x8b48b075,
+0x3948b045, 0x940fe045, 0xc0b60fc0, 0x66d8f748,
+0xc06e0f48, 0xe8458b48, 0xb8453948, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x60b8f86e, 0x66000002,
+0x66c76c0f, 0x83d0500f, 0x850f03fa, 0x0000045b,
+0xb055280f, 0xe045280f, 0xc2d40f66, 0xc045290f,
+0xe045280f, 0xf0730f66, 0x0f486601, 0x3948c07e,
+0x120fc045, 0xc0940ff0, 0x48c0b60f, 0x8948d8f7,
+0x0f4866c2, 0x3948f07e, 0x940fc845, 0x0f4866c0,
+0xb60fc26e, 0xd8f748c0, 0x6e0f4866, 0x0266b8f8,
+0x0f660000, 0x0f66c76c, 0xfa83d050, 0xf8850f03,
+0x0f000003, 0x66c04528, 0xe045fb0f, 0xd045290f,
+0xd0458b48, 0xb0453948, 0x0fc0940f, 0xf748c0b6,
+0x0f4866d8, 0x8b48c86e, 0x3948b845, 0x940fd845,
+0xc0b60fc0, 0x66d8f748, 0xe86e0f48, 0x00026bb8,
+0x6c0f6600, 0x500f66cd, 0x03fa83d1, 0x03a9850f,
+0x560f0000, 0x290ff055, 0x540fb055, 0x280ff045,
+0x570fd04d, 0x4866f04d, 0x0fca7e0f, 0x0fd04d29,
+0x66b04555, 0x66d2760f, 0xc07e0f48, 0x48f0120f,
+0x940fc239, 0xc0b60fc0, 0x48d8f748, 0x4866c289,
+0x48f07e0f, 0x0fd84539, 0x4866c094, 0x0fc26e0f,
+0xf748c0b6, 0x0f4866d8, 0x77b8f86e, 0x66000002,
+0x66c76c0f, 0x83d0500f, 0x850f03fa, 0x0000033b,
+0xe045280f, 0xf06d280f, 0x0fc8280f, 0x280fe528,
+0x730f66d8, 0x0f6620d1, 0x6620d473, 0x66cdf40f,
+0x66e0f40f, 0x66ddf40f, 0x66ccd40f, 0x20f1730f,
+0xcbd40f66, 0x7e0f4866, 0x4d290fc8, 0xf88348b0,
+0xc0940f02, 0x48c0b60f, 0x4866d8f7, 0x31c86e0f,
+0x7d8348c0, 0x940f02b8, 0xd8f748c0, 0x6e0f4866,
+0x02d3b8e8, 0x0f660000, 0x0f66cd6c, 0xfa83d150,
+0xc4850f03, 0x0f000002, 0x0fd04529, 0x66d04d28,
+0x03f1730f, 0x7e0f4866, 0x4d290fca, 0x4d280fb0,
+0x730f66d0, 0x290f02f1, 0x0f66c04d, 0x4866c9d4,
+0x0fc87e0f, 0x3948f112, 0xc0940fc2, 0x48c0b60f,
+0x8948d8f7, 0x0f4866c2, 0x3948f07e, 0x940fb845,
+0x0f4866c0, 0xb60fca6e, 0xd8f748c0, 0x6e0f4866,
+0x02f8b8f8, 0x0f660000, 0x0f66cf6c, 0xfa83d150,
+0x54850f03, 0x0f000002, 0x66b04d28, 0x02d1730f,
+0xc9d40f66, 0x7e0f4866, 0x453948c8, 0xe1120fc0,
+0x0fc0940f, 0xf748c0b6, 0xc28948d8, 0x7e0f4866,
+0x453948e0, 0xc0940fc8, 0x6e0f4866, 0xc0b60fca,
+0x66d8f748, 0xe86e0f48, 0x0002fdb8, 0x6c0f6600,
+0x500f66cd, 0x03fa83d1, 0x01fd850f, 0x45c70000,
+0x000003ac, 0x6e0f6600, 0x280fac5d, 0xf30f66c8,
+0xac45c7cb, 0x00000002, 0x5d6e0f66, 0xf30f66ac,
+0x45290fc3, 0xd40f66c0, 0x0f4866c0, 0x120fc87e,
+0x0f4866f9, 0x120fc27e, 0x0f4866f0, 0x3948f97e,
+0xc0940fc2, 0x48c0b60f, 0x8948d8f7, 0x0f4866c2,
+0x3948f07e, 0x0f4866c8, 0x940fc26e, 0xc0b60fc0,
+0x66d8f748, 0xe06e0f48, 0x000310b8, 0x6c0f6600,
+0x500f66c4, 0x03fa83d0, 0x017d850f, 0x0f660000,
+0x66ac456e, 0x66c8d30f, 0x66c9d40f, 0xc87e0f48,
+0xc0453948, 0x0fe9120f, 0xb60fc094, 0xd8f748c0,
+0x6e0f4866, 0x0f4866c0, 0x3948e87e, 0x940fc845,
+0xc0b60fc0, 0x66d8f748, 0xf06e0f48, 0x000314b8,
+0x6c0f6600, 0x500f66c6, 0x03fa83d0, 0x0129850f,
+0x0f660000, 0x4ee04d70, 0x7e0f4866, 0x453948c8,
+0xf9120ff0, 0x0fc0940f, 0xf748c0b6, 0x0f4866d8,
+0x4866c06e, 0x48f87e0f, 0x0ff84539, 0xb60fc094,
+0xd8f748c0, 0x6e0f4866, 0x0359b8e0, 0x0f660000,
+0x0f66c46c, 0xfa83d050, 0xdc850f03, 0x48000000,
+0x66ffc883, 0xc86e0f48, 0xf045280f, 0x66d8280f,
+0xe05d6c0f, 0x456d0f66, 0xd40f66e0, 0xd1570fc2,
+0xc3fb0f66, 0x66c1570f, 0x66c2fb0f, 0xc07e0f48,
+0x48e8120f, 0x940fc8ff, 0xc0b60fc0, 0x48d8f748,
+0x4866c289, 0x48e87e0f, 0x4866c8ff, 0x0fc26e0f,
+0xb60fc094, 0xd8f748c0, 0x6e0f4866, 0x0370b8f0,
+0x0f660000, 0x0f66c66c, 0xfa83d050, 0x0f6c7503,
+0x48e04528, 0xbad07d8d, 0x00000000, 0xd07e0ff3,
+0x7e0f4866, 0x7e0ff3c0, 0x55290fd2, 0xf70f66d0,
+0x760f66c1, 0x7d280fc0, 0xc1570ff0, 0xf8f70f66,
+0xd0453948, 0x0fc0940f, 0xf748c0b6, 0x0f4866d8,
+0x8b48c06e, 0x3948f845, 0x940fd845, 0xc0b60fc0,
+0x66d8f748, 0xe06e0f48, 0xc46c0f66, 0xc0500f66,
+0xb803f883, 0x000003c4, 0x5dc2440f, 0x000000c3,
+0002315,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd06d28, 0x0fa06d29, 0xb8a04528, 0x00000260,
+0x0fc8280f, 0x0f00cdc2, 0xfa83d150, 0x83850f0f,
+0x0f000002, 0x0fd04d28, 0x290fc858, 0x280fb04d,
+0x66b8d04d, 0x0f000002, 0xc20fc958, 0x0f00b04d,
+0xfa83d150, 0x5b850f0f, 0x0f000002, 0x0fb04d28,
+0x0fd04d5c, 0x0fc04d29, 0x6bb8c828, 0x0f000002,
+0x00c04dc2, 0x83d1500f, 0x850f0ffa, 0x00000236,
+0xe04d280f, 0xd045590f, 0x0fd1280f, 0x280fd159,
+0x280fd04d, 0x580fe065, 0xd9280fe1, 0xe05d5c0f,
+0xb8c25c0f, 0x00000282, 0x0fdc590f, 0x0f00c3c2,
+0xfa83d050, 0xfb850f0f, 0x0f000001, 0x0ff04528,
+0x290fc159, 0x5e0fa045, 0xc20ff04d, 0x8bb800c1,
+0x0f000002, 0xfa83d050, 0xd7850f0f, 0x0f000001,
+0xf3f05528, 0xcd0d100f, 0xb8000001, 0x0000028e,
+0x0fc2280f, 0x0f00c9c6, 0x570fc157, 0x590fd04d,
+0xc20fa045, 0x500f00c1, 0x0ffa83d0, 0x01a4850f,
+0x530f0000, 0x290fd045, 0x530fa045, 0x280fa045,
+0x96b8d04d, 0x66000002, 0x0fc05b0f, 0xc20fc05b,
+0x500f00c1, 0x0ffa83d0, 0x0178850f, 0x280f0000,
+0xc1590fc1, 0xa045290f, 0xa045520f, 0xb045290f,
+0xb045280f, 0x00029db8, 0xd8530f00, 0xdb5b0f66,
+0x0fdb5b0f, 0x0f00cbc2, 0xfa83d150, 0x43850f0f,
+0x66000001, 0x0fc85b0f, 0x0fd04528, 0x9fb8c95b,
+0x0f000002, 0x0f66d853, 0x5b0fdb5b, 0xcbc20fdb,
+0xd1500f00, 0x0f0ffa83, 0x00011985, 0xc8280f00,
+0x0fc8590f, 0x0fa04d29, 0xb8a04d51, 0x000002a7,
+0x00c8c20f, 0x83d1500f, 0x850f0ffa, 0x000000f6,
+0xe04d280f, 0x0fd8280f, 0x590fda59, 0x4d290fca,
+0xcb280fb0, 0xb04d5f0f, 0xb05d5d0f, 0xb05d290f,
+0xb04d580f, 0xe045580f, 0x000348b8, 0xca590f00,
+0x00c1c20f, 0x83d0500f, 0x850f0ffa, 0x000000b6,
+0xd045280f, 0x000359b8, 0xc0c60f00, 0x45c20f1b,
+0x500f00e0, 0x0ffa83d0, 0x0098850f, 0x280f0000,
+0x280fe04d, 0x45140fc1, 0x4d150fd0, 0xc15c0fd0,
+0x0d100ff3, 0x00000084, 0x000370b8, 0xc9c60f00,
+0xc2590f00, 0xc045290f, 0x00c1c20f, 0x83d0500f,
+0x62750ffa, 0xd04d280f, 0x45100ff3, 0x7d8d48e4,
+0x0000bac0, 0x0ff30000, 0x0fb44511, 0x150fc128,
+0x110ff3c1, 0x0ff3b04d, 0xf3b84511, 0xec45100f,
+0x45110ff3, 0xc0570fbc, 0x01c2c20f, 0xc8f70f66,
+0xc9760f66, 0xe075280f, 0x66c1570f, 0x0ff0f70f,
+0x0fc04528, 0x00b045c2, 0x83c0500f, 0xc4b80ff8,
+0x0f000003, 0xc35dc244, 0x80000000, 0x40000000,
+0001400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16f8[] = {
+0x485500eb, 0x0ff2e589, 0x03220510, 0x0ff20000,
+0x03220d10, 0x8b480000, 0x00032305, 0x110ff200,
+0x8948d045, 0x0ff2f845, 0xf2e04d11, 0xf045110f,
+0x4d110ff2, 0x110ff2d8, 0x280fe845, 0x290fd06d,
+0x280fa06d, 0x60b8a045, 0x0f000002, 0x0f66c828,
+0x6600cdc2, 0x83d1500f, 0x850f03fa, 0x000002cc,
+0xd04d280f, 0xc8580f66, 0xb04d290f, 0xd04d280f,
+0x000266b8, 0x580f6600, 0xc20f66c9, 0x6600b04d,
+0x83d1500f, 0x850f03fa, 0x000002a0, 0xb04d280f,
+0x4d5c0f66, 0x4d290fd0, 0xc8280fc0, 0x00026bb8,
+0xc20f6600, 0x6600c04d, 0x83d1500f, 0x850f03fa,
+0x00000278, 0xe04d280f, 0x45590f66, 0xd1280fd0,
+0xd1590f66, 0xd04d280f, 0xe065280f, 0xe1580f66,
+0x66d9280f, 0xe05d5c0f, 0xc25c0f66, 0x000282b8,
+0x590f6600, 0xc20f66dc, 0x0f6600c3, 0xfa83d050,
+0x35850f03, 0x0f000002, 0x66f04528, 0x0fc1590f,
+0x66a04529, 0xf04d5e0f, 0xc1c20f66, 0x028bb800,
+0x0f660000, 0xfa83d050, 0x0d850f03, 0xf2000002,
+0x2115100f, 0x0f000002, 0xb8f04d28, 0x0000028e,
+0xd2140f66, 0x0fc1280f, 0x570fc257, 0x0f66d055,
+0x66a04559, 0x00c2c20f, 0xd0500f66, 0x0f03fa83,
+0x0001d785, 0x5a0f6600, 0x530fd045, 0xc05a0fc0,
+0xa045290f, 0x455a0f66, 0xc0530fa0, 0xd05d280f,
+0x000296b8, 0xc05a0f00, 0xc0e60ff2, 0xc0e60ff3,
+0xc3c20f66, 0x500f6600, 0x03fa83d0, 0x019a850f,
+0x280f0000, 0x590f66c3, 0x45290fc3, 0x5a0f66a0,
+0x520fa045, 0xc05a0fc0, 0xb045290f, 0xb055280f,
+0x00029db8, 0x5a0f6600, 0xc0530fc2, 0xf2c05a0f,
+0xf3c0e60f, 0x66c0e60f, 0x00d8c20f, 0xd3500f66,
+0x0f03fa83, 0x00015385, 0xe60ff200, 0xe60ff3d2,
+0x55280fda, 0x029fb8d0, 0x0f660000, 0x530fc25a,
+0xc05a0fc0, 0xc0e60ff2, 0xc0e60ff3, 0xc3c20f66,
+0x500f6600, 0x03fa83d0, 0x011e850f, 0x280f0000,
+0x590f66c2, 0x45290fc2, 0x510f66a0, 0x0f66a045,
+0xb800c2c2, 0x000002a7, 0xd0500f66, 0x0f03fa83,
+0x0000f785, 0x45280f00, 0xda280fe0, 0xd9590f66,
+0xc1590f66, 0xb045290f, 0x66c3280f, 0xb0455f0f,
+0x5d5d0f66, 0x5d290fb0, 0x580f66b0, 0x0f66b045,
+0xb8e05558, 0x00000348, 0xc1590f66, 0xc2c20f66,
+0x500f6600, 0x03fa83d0, 0x00ae850f, 0x280f0000,
+0x59b8d045, 0x66000003, 0x01c0c60f, 0x45c20f66,
+0x0f6600e0, 0xfa83d050, 0x8d850f03, 0x0f000000,
+0x66e04528, 0xd045160f, 0xd055280f, 0x55120f66,
+0x5c0f66e8, 0x100ff2c2, 0x00007315, 0x0370b800,
+0x0f660000, 0x0f66d214, 0x290fc159, 0x0f66c045,
+0x6600c2c2, 0x83d0500f, 0x507503fa, 0x45100ff2,
+0x55280fe8, 0x7d8d48d0, 0x0000bac0, 0x0ff20000,
+0x0fb84511, 0x0f66c057, 0x6601c1c2, 0xb055130f,
+0xc9760f66, 0xd0f70f66, 0xe075280f, 0x66c1570f,
+0x0ff0f70f, 0x66c04528, 0xb045c20f, 0x500f6600,
+0x03f883c0, 0x0003c4b8, 0xc2440f00, 0x0000c35d,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xbff00000, 0x00000000, 0x80000000,
+0001520,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8148e589, 0x0000d0ec,
+0x100ff300, 0x0003f705, 0x110ff300, 0xffff5485,
+0x110ff3ff, 0xffff5885, 0x110ff3ff, 0xffff5c85,
+0x54858bff, 0x89ffffff, 0xffff4885, 0xf3ff31ff,
+0x4885100f, 0xb9ffffff, 0x00000000, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xffff81e8,
+0xb8c289ff, 0x00000260, 0x840fd284, 0x00000391,
+0x85100ff3, 0xffffff48, 0x85580ff3, 0xffffff54,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff54,
+0x0ff3ff31, 0x2e0fc058, 0xffff4c85, 0x9b0f40ff,
+0xf9450fc7, 0x37e8dff7, 0x89ffffff, 0x0266b8c2,
+0xd2840000, 0x0347840f, 0x0ff30000, 0xff4c8510,
+0x0ff3ffff, 0xff54855c, 0x0ff3ffff, 0xff308511,
+0x858bffff, 0xffffff30, 0x89844589, 0xffff4c85,
+0x508589ff, 0x31ffffff, 0x100ff3ff, 0xffff4885,
+0x852e0fff, 0xffffff50, 0xc79b0f40, 0xf7f9450f,
+0xfedce8df, 0xc289ffff, 0x00026bb8, 0x0fd28400,
+0x0002ec84, 0x100ff300, 0xffff4885, 0x590ff3ff,
+0xffff5485, 0x110ff3ff, 0xffff4885, 0x100ff3ff,
+0xffff5885, 0x590ff3ff, 0x110ff3c0, 0xffff4c85,
+0x100ff3ff, 0xffff5485, 0x580ff3ff, 0xffff5885,
+0x110ff3ff, 0xffff5085, 0x100ff3ff, 0xffff5485,
+0x100ff3ff, 0xffff4895, 0xf3ff31ff, 0x4c955c0f,
+0x0fffffff, 0x0ff3c828, 0xff588d5c, 0x0ff3ffff,
+0xff508d59, 0x2e0fffff, 0x110ff3d1, 0xffff508d,
+0x9b0f40ff, 0xf9450fc7, 0x43e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x0253840f, 0x0ff30000,
+0xff5c8559, 0x0ff3ffff, 0xff488511, 0xff31ffff,
+0x85100ff3, 0xffffff54, 0x855e0ff3, 0xffffff5c,
+0x48852e0f, 0xf3ffffff, 0x4c85110f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffdf5e8, 0xb8c289ff,
+0x0000028b, 0x840fd284, 0x00000205, 0x85100ff3,
+0xffffff5c, 0x15100ff3, 0x00000214, 0x8d100ff3,
+0xffffff54, 0x570fff31, 0xca570fc2, 0x85590ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffdade8, 0xb8c289ff, 0x0000028e, 0x840fd284,
+0x000001bd, 0x85530ff3, 0xffffff54, 0x85110ff3,
+0xffffff48, 0x8d530ff3, 0xffffff48, 0xc12c0ff3,
+0x85100ff3, 0xffffff54, 0x0ff3ff31, 0x2e0fc82a,
+0x9b0f40c8, 0xf9450fc7, 0x63e8dff7, 0x89fffffd,
+0x0296b8c2, 0xd2840000, 0x0173840f, 0x0ff30000,
+0x0ff3c059, 0xff488511, 0x0ff3ffff, 0xff488552,
+0x0ff3ffff, 0xff4c8511, 0x0ff3ffff, 0xff4c8553,
+0x0ff3ffff, 0xff31c02c, 0xc02a0ff3, 0x54852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000029d, 0x840fd284, 0x00000121,
+0x852c0ff3, 0xffffff4c, 0x0ff3ff31, 0xff548553,
+0x0ff3ffff, 0x0ff3c82a, 0x0ff3c02c, 0x2e0fc02a,
+0x9b0f40c8, 0xf9450fc7, 0xd3e8dff7, 0x89fffffc,
+0x029fb8c2, 0xd2840000, 0x00e3840f, 0x0ff30000,
+0xff548510, 0x0ff3ffff, 0x0ff3c059, 0xff488511,
+0x0ff3ffff, 0xff548d10, 0xff31ffff, 0x85510ff3,
+0xffffff48, 0x40c12e0f, 0x0fc79b0f, 0xdff7f945,
+0xfffc8de8, 0xb8c289ff, 0x000002a7, 0x840fd284,
+0x0000009d, 0x85100ff3, 0xffffff5c, 0xc8590ff3,
+0x85590ff3, 0xffffff58, 0x8d110ff3, 0xffffff48,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff48,
+0x855f0ff3, 0xffffff4c, 0x85110ff3, 0xffffff50,
+0x85100ff3, 0xffffff48, 0x855d0ff3, 0xffffff4c,
+0x85110ff3, 0xffffff4c, 0x85100ff3, 0xffffff4c,
+0x85580ff3, 0xffffff50, 0x00b8ff31, 0xf3000000,
+0x5c85590f, 0xf3ffffff, 0x548d100f, 0xf3ffffff,
+0x588d580f, 0x0fffffff, 0x0f40c12e, 0x450fc79b,
+0xe8dff7f8, 0xfffffbea, 0xc019013c, 0x00034825,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002120,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_f8[] = {
+0x485500eb, 0x8148e589, 0x000108ec, 0x100ff200,
+0x00049b05, 0x110ff200, 0xfffea885, 0x110ff2ff,
+0xfffeb085, 0x110ff2ff, 0xfffeb885, 0x858b48ff,
+0xfffffea8, 0x90858948, 0x31fffffe, 0x100ff2c0,
+0xfffe9085, 0x0000baff, 0x0f660000, 0xfea8852e,
+0x9b0fffff, 0x450f48c0, 0xd8f748c2, 0x6e0f4866,
+0x0260b8d8, 0x0f660000, 0xb60fcbd7, 0xfff981c9,
+0x0f000000, 0x00042885, 0x100ff200, 0xfffe9085,
+0x580ff2ff, 0xfffea885, 0x110ff2ff, 0xfffe9885,
+0x100ff2ff, 0xfffea885, 0xf2c031ff, 0x66c0580f,
+0x98852e0f, 0x0ffffffe, 0x0f48c09b, 0xf748c245,
+0x0f4866d8, 0x66b8e06e, 0x66000002, 0x0fccd70f,
+0xf981c9b6, 0x000000ff, 0x03d3850f, 0x0ff20000,
+0xfe988510, 0x0ff2ffff, 0xfea8855c, 0x0ff2ffff,
+0xfe808511, 0x8b48ffff, 0xfffe8085, 0x858948ff,
+0xffffff08, 0x98858948, 0x48fffffe, 0xfea08589,
+0xc031ffff, 0x85100ff2, 0xfffffe90, 0x852e0f66,
+0xfffffea0, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8e86e0f, 0x0000026b, 0xcdd70f66, 0x81c9b60f,
+0x0000fff9, 0x66850f00, 0xf2000003, 0x9085100f,
+0xf2fffffe, 0xa885590f, 0xf2fffffe, 0x9085110f,
+0xf2fffffe, 0xb085100f, 0xf2fffffe, 0xf2c0590f,
+0x9885110f, 0xf2fffffe, 0xa885100f, 0xf2fffffe,
+0xb085580f, 0xf2fffffe, 0xa085110f, 0xf2fffffe,
+0xa885100f, 0xf2fffffe, 0x9095100f, 0x31fffffe,
+0x5c0ff2c0, 0xfffe9895, 0xc8280fff, 0x8d5c0ff2,
+0xfffffeb0, 0x8d590ff2, 0xfffffea0, 0xd12e0f66,
+0x8d110ff2, 0xfffffea0, 0x48c09b0f, 0x48c2450f,
+0x4866d8f7, 0xb8f06e0f, 0x00000282, 0xced70f66,
+0x81c9b60f, 0x0000fff9, 0xc2850f00, 0xf2000002,
+0xb885590f, 0xf2fffffe, 0x9085110f, 0x31fffffe,
+0x100ff2c0, 0xfffea885, 0x5e0ff2ff, 0xfffeb885,
+0x2e0f66ff, 0xfffe9085, 0x110ff2ff, 0xfffe9885,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xf86e0f48,
+0x00028bb8, 0xd70f6600, 0xc9b60fcf, 0x00fff981,
+0x850f0000, 0x00000269, 0x157e0ff3, 0x00000280,
+0x85100ff2, 0xfffffeb8, 0x0ff2c031, 0xfea88d10,
+0x570fffff, 0x590ff2c2, 0xfffe9085, 0xca570fff,
+0xc12e0f66, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8d86e0f, 0x0000028e, 0xcbd70f66, 0x81c9b60f,
+0x0000fff9, 0x16850f00, 0xf2000002, 0xa8855a0f,
+0xf3fffffe, 0xf3c0530f, 0x66c05a0f, 0x9085130f,
+0xf2fffffe, 0x908d5a0f, 0xf3fffffe, 0xf3c9530f,
+0xf2c95a0f, 0xf2c12c0f, 0xa885100f, 0xf2fffffe,
+0x31c82a0f, 0x2e0f66c0, 0xc09b0fc8, 0xc2450f48,
+0x66d8f748, 0xe06e0f48, 0x000296b8, 0xd70f6600,
+0xc9b60fcc, 0x00fff981, 0x850f0000, 0x000001b1,
+0xc0590ff2, 0x85110ff2, 0xfffffe90, 0x855a0ff2,
+0xfffffe90, 0xc0520ff3, 0xc05a0ff3, 0x85130f66,
+0xfffffe98, 0x855a0ff2, 0xfffffe98, 0xc0530ff3,
+0xc05a0ff3, 0xc02c0ff2, 0xc02a0ff2, 0x0f66c031,
+0xfea8852e, 0x9b0fffff, 0x450f48c0, 0xd8f748c2,
+0x6e0f4866, 0x029db8e8, 0x0f660000, 0xb60fcdd7,
+0xfff981c9, 0x0f000000, 0x00014485, 0x2c0ff200,
+0xfffe988d, 0x5a0ff2ff, 0xfffea885, 0x530ff3ff,
+0x5a0ff3c0, 0x2c0ff2c0, 0x0fc139c0, 0xb60fc094,
+0xd8f748c0, 0x6e0f4866, 0x029fb8f0, 0x0f660000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x00010085,
+0x100ff200, 0xfffea885, 0x590ff2ff, 0x110ff2c0,
+0xfffe9085, 0x100ff2ff, 0xfffea88d, 0xf2c031ff,
+0x9085510f, 0x66fffffe, 0x0fc12e0f, 0x0f48c09b,
+0xf748c245, 0x0f4866d8, 0xa7b8f86e, 0x66000002,
+0x0fd7d70f, 0xfa81d2b6, 0x000000ff, 0x00af850f,
+0x0ff20000, 0xfeb88510, 0x0ff2ffff, 0x0ff2c859,
+0xfeb08559, 0x0ff2ffff, 0xfe908d11, 0x0ff2ffff,
+0xfe988511, 0x0ff2ffff, 0xfe908510, 0x0ff2ffff,
+0xfe98855f, 0x0ff2ffff, 0xfea08511, 0x0ff2ffff,
+0xfe908510, 0x0ff2ffff, 0xfe98855d, 0x0ff2ffff,
+0xfe988511, 0x0ff2ffff, 0xfe988510, 0x0ff2ffff,
+0xfea08558, 0xc031ffff, 0x000000ba, 0x590ff200,
+0xfffeb885, 0x100ff2ff, 0xfffea88d, 0x580ff2ff,
+0xfffeb08d, 0x2e0f66ff, 0xc09b0fc1, 0xc2450f48,
+0x000348ba, 0xd8f74800, 0x6e0f4866, 0xd70f66d8,
+0xc0b60fc3, 0x0000ff3d, 0x0000b800, 0x450f0000,
+0x00c3c9c2, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002320,
+};
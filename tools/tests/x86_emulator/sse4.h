@@ -0,0 +1,2192 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x57000000, 0x000768e8, 0xb3c78100,
+0x56000007, 0x8d53f631, 0xec81c75d, 0x0000013c,
+0x98355488, 0xd02811b0, 0xa8354488, 0xe083f089,
+0x01f88301, 0x0224c019, 0x4488c8fe, 0x468db835,
+0x83c62101, 0xd98301fe, 0x88c2fe00, 0xf883030c,
+0x89047410, 0x0fc9ebc6, 0x0f987528, 0xff68b529,
+0x280fffff, 0xffff688d, 0x0260b8ff, 0x280f0000,
+0x740f66c1, 0x760f66c6, 0xb5290ff6, 0xffffff58,
+0x17380f66, 0xdf830fc6, 0x0f000006, 0x66984528,
+0x0fc1fc0f, 0xff788529, 0x280fffff, 0x66b89845,
+0x66000002, 0x66c0fc0f, 0x7885740f, 0x66ffffff,
+0xc617380f, 0x06b0830f, 0x280f0000, 0xffff7885,
+0xf80f66ff, 0x290f9845, 0x6bb88845, 0x66000002,
+0x884d740f, 0x17380f66, 0x8b830fce, 0x0f000006,
+0x0f987d28, 0x0fb84528, 0xff48bd29, 0x280fffff,
+0x600f66f8, 0x8d280ff8, 0xffffff48, 0xc0680f66,
+0x28bd290f, 0x66ffffff, 0x0fc9600f, 0xffc0b728,
+0x290fffff, 0xffff1885, 0x85280fff, 0xffffff48,
+0x8dd50f66, 0xffffff28, 0xc0680f66, 0x85d50f66,
+0xffffff18, 0x0fce540f, 0x280fc654, 0xc9570ff9,
+0xf8670f66, 0xc845280f, 0x38bd290f, 0x66ffffff,
+0x0fc1640f, 0x290fc754, 0x458a8845, 0x08858888,
+0x8affffff, 0x5d8ac84d, 0x8c558a8a, 0x4d8ae0d2,
+0xf88588c9, 0x8afffffe, 0xe0d28945, 0x88ca4d8a,
+0xfffef785, 0x8b458aff, 0x4d8ae3d2, 0x6e0f66cb,
+0x8ae0d2fb, 0x8588cc4d, 0xfffffef6, 0xd28d458a,
+0xcd4d8ae2, 0xda6e0f66, 0x4d8ae0d2, 0xf08588ce,
+0x8afffffe, 0xe0d28e45, 0x88cf4d8a, 0xfffeec85,
+0x8f458aff, 0x4d8ae0d2, 0xe88588d0, 0x8afffffe,
+0xe0d29045, 0x88d14d8a, 0xfffee485, 0x91458aff,
+0x4d8ae0d2, 0xe08588d2, 0x8afffffe, 0xe0d29245,
+0x88d34d8a, 0xfffedc85, 0x93458aff, 0x8588e0d2,
+0xfffffed8, 0x66d44d8a, 0xbd203a0f, 0xfffffef6,
+0x94458a01, 0x203a0f66, 0xfffef09d, 0xb58b01ff,
+0xfffffef8, 0x4d8ae0d2, 0xd48588d5, 0x8afffffe,
+0x0f669545, 0x0f66ce6e, 0xf78d203a, 0x01fffffe,
+0xcf610f66, 0x4d8ae0d2, 0xd08588d6, 0x8afffffe,
+0xe0d29645, 0x88d74d8a, 0xfffeb885, 0x97458aff,
+0xc188e0d2, 0xfeec858b, 0x0f66ffff, 0x280fc06e,
+0xe4858be8, 0x66fffffe, 0xad203a0f, 0xfffffee8,
+0xad290f01, 0xfffffef8, 0x9d610f66, 0xfffffef8,
+0xcb620f66, 0x66f9280f, 0x8bc06e0f, 0xfffedc85,
+0x3a0f66ff, 0xfee08520, 0x6601ffff, 0x8be86e0f,
+0xfffed485, 0x3a0f66ff, 0xfed8ad20, 0x6601ffff,
+0x66c5610f, 0x8bd06e0f, 0xfffeb885, 0x3a0f66ff,
+0xfed09520, 0x6601ffff, 0x66e06e0f, 0xe1203a0f,
+0x610f6601, 0x620f66d4, 0x6c0f66c2, 0xbd290ff8,
+0xfffffeb8, 0xc845280f, 0xd0bf280f, 0x66ffffff,
+0x0fc7f80f, 0x8ac84529, 0x858ac84d, 0xffffff08,
+0x8a8a5d8a, 0xe0d28c55, 0x88c94d8a, 0xffff0885,
+0x89458aff, 0x4d8ae0d2, 0xf88588ca, 0x8afffffe,
+0xe3d28b45, 0xd2cb4d8a, 0xcc4d8ae0, 0xfef78588,
+0x458affff, 0x8ae2d28d, 0x0f66cd4d, 0xe0d2da6e,
+0x88ce4d8a, 0xfffef685, 0x8e458aff, 0x4d8ae0d2,
+0xf08588cf, 0x8afffffe, 0xe0d28f45, 0x88d04d8a,
+0xfffeec85, 0x90458aff, 0x4d8ae0d2, 0xe88588d1,
+0x8afffffe, 0xe0d29145, 0x88d24d8a, 0xfffee485,
+0x92458aff, 0x4d8ae0d2, 0xe08588d3, 0x8afffffe,
+0x0f669345, 0xf69d203a, 0x01fffffe, 0xff08b58b,
+0xe0d2ffff, 0x88d44d8a, 0xfffedc85, 0x94458aff,
+0xc66e0f66, 0x66c8280f, 0x0fc36e0f, 0x0f66e828,
+0xf88d203a, 0x01fffffe, 0x203a0f66, 0xfffef7ad,
+0x290f01ff, 0xffff08ad, 0x8ae0d2ff, 0x8588d54d,
+0xfffffed8, 0x6695458a, 0x088d610f, 0xd2ffffff,
+0xd64d8ae0, 0xfed48588, 0x458affff, 0x8ae0d296,
+0x8588d74d, 0xfffffed0, 0xd297458a, 0x8bc188e0,
+0xfffef085, 0x6e0f66ff, 0xe8280fc0, 0xfee8858b,
+0x0f66ffff, 0xecad203a, 0x01fffffe, 0xf8ad290f,
+0x66fffffe, 0xf89d610f, 0x66fffffe, 0x66cb620f,
+0x8bc06e0f, 0xfffee085, 0x3a0f66ff, 0xfee48520,
+0x6601ffff, 0x8be86e0f, 0xfffed885, 0x3a0f66ff,
+0xfedcad20, 0x6601ffff, 0x66c5610f, 0x8bd06e0f,
+0xfffed085, 0x3a0f66ff, 0xfed49520, 0x6601ffff,
+0x66e06e0f, 0xe1203a0f, 0x610f6601, 0x620f66d4,
+0x6c0f66c2, 0xfc0f66c8, 0x740f66c9, 0xfffeb88d,
+0x032cb8ff, 0x0f660000, 0x588d1738, 0x0fffffff,
+0x0002a583, 0x4d280f00, 0xc1280fa8, 0x66d1280f,
+0x66c1600f, 0x66d1680f, 0x2885d50f, 0x66ffffff,
+0x1895d50f, 0x0fffffff, 0xff38a528, 0x540fffff,
+0xa5290fc6, 0xffffff68, 0x66d6540f, 0x0fc2670f,
+0xff788529, 0x280fffff, 0xffff7885, 0x380f66ff,
+0x280fc43c, 0xffff7895, 0x380f66ff, 0x290fd438,
+0xffff7895, 0xfc0f66ff, 0xffff7885, 0x0348b8ff,
+0x280f0000, 0x600f66d0, 0x680f66d0, 0xd50f66c0,
+0xffff2895, 0xd50f66ff, 0xffff1885, 0xd6540fff,
+0x66c6540f, 0x0fd0670f, 0xff488528, 0x0f66ffff,
+0x0f66c1fc, 0x0f66d074, 0x58951738, 0x0fffffff,
+0x0001f583, 0x034fb800, 0x0f660000, 0x68851c38,
+0x66ffffff, 0x4885740f, 0x66ffffff, 0x8517380f,
+0xffffff58, 0x01d0830f, 0x280f0000, 0x54b8b845,
+0x0f000003, 0x0f66d728, 0x66d00838, 0x66d0740f,
+0x9517380f, 0xffffff58, 0x01ac830f, 0x280f0000,
+0x59b89855, 0x0f000003, 0x0f66d928, 0x0f66dff8,
+0x66d30038, 0x66d1740f, 0x9517380f, 0xffffff58,
+0x0184830f, 0x280f0000, 0x600f66d9, 0x280f985d,
+0x680f66d1, 0x0f669855, 0x70b8daf8, 0x0f000003,
+0x280fd328, 0x600f66e8, 0x680f66d3, 0xe0280fdb,
+0xe8600f66, 0xe0680f66, 0xd5d50f66, 0xe3d50f66,
+0x0fd6540f, 0x0f66e654, 0x0f66d467, 0xffe09774,
+0x0f66ffff, 0x58951738, 0x0fffffff, 0x00012983,
+0x55280f00, 0xe2280f98, 0x66da280f, 0x66e2600f,
+0x66e5d50f, 0x0fda680f, 0x540fe828, 0x680f66e6,
+0xd50f66e8, 0xde540fdd, 0xe3670f66, 0x68a5290f,
+0x0fffffff, 0x0f66db57, 0x0f66d864, 0x280fe360,
+0xffff68b5, 0x380f66ff, 0x0f66ee20, 0x0f66f676,
+0x7ab8e574, 0x66000003, 0xe617380f, 0x00c8830f,
+0x0f660000, 0x0f66db60, 0x280feb60, 0xffff68a5,
+0x380f66ff, 0x82b8e421, 0x66000003, 0x66ec740f,
+0xee17380f, 0x00a0830f, 0x0f660000, 0x0f66db60,
+0x290fe360, 0xffff78a5, 0xad280fff, 0xffffff68,
+0x22380f66, 0x5d290fdd, 0x038bb888, 0x0f660000,
+0x0f66e374, 0x73e61738, 0x0fc03171, 0x01a8d928,
+0x280f0375, 0x5d290fda, 0x05548ad8, 0x059488d8,
+0xffffff78, 0x10f88340, 0x570fe175, 0x03c4b8db,
+0x0f660000, 0x0f66c364, 0x66ca1038, 0x66c0760f,
+0x788d740f, 0x66ffffff, 0xc817380f, 0x280f2c73,
+0x66c031ca, 0xca0f3a0f, 0x97540f01, 0xfffffff0,
+0xd7fc0f66, 0xd1740f66, 0x17380f66, 0xc0920fd0,
+0x1901f883, 0x03e425c0, 0xc4810000, 0x0000013c,
+0x5d5f5e5b, 0x243c8bc3, 0x000000c3, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0003734,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b055c3,
+0x08bae589, 0x57000000, 0x000626e8, 0x63c78100,
+0x56000006, 0x8d53f631, 0xec81c75d, 0x000000fc,
+0x98354488, 0xc12811b1, 0xa8354c88, 0xe183f189,
+0x88c9fe01, 0x89b8354c, 0xf12146f1, 0x8301f983,
+0xc0fe00da, 0x83331488, 0xd47510fe, 0x9875280f,
+0x68b5290f, 0x0fffffff, 0xff688d28, 0x0f66ffff,
+0x60b8d276, 0x0f000002, 0x0f66c128, 0x0f66c674,
+0x0fc21738, 0x0005af83, 0x45280f00, 0xfc0f6698,
+0x85290fc1, 0xffffff78, 0x9845280f, 0x000266b8,
+0xfc0f6600, 0x740f66c0, 0xffff7885, 0x380f66ff,
+0x830fc217, 0x00000580, 0x7885280f, 0x66ffffff,
+0x9845f80f, 0x8845290f, 0xb8d9280f, 0x0000026b,
+0x5d740f66, 0x380f6688, 0x830fda17, 0x00000558,
+0xa84d560f, 0x688d290f, 0x0fffffff, 0x0fa84554,
+0x0f884d28, 0x66a84d57, 0xb8f6760f, 0x00000277,
+0x6885550f, 0x0fffffff, 0xff58b529, 0x0f66ffff,
+0x0f66c174, 0x0fc21738, 0x00051b83, 0xc9570f00,
+0x66c1280f, 0xc845740f, 0xc1740f66, 0x9845540f,
+0x8845290f, 0x8888458a, 0xffff4885, 0xc84d8aff,
+0xd2925d8a, 0xc94d8ae0, 0xff388588, 0x458affff,
+0x8ae0d289, 0x8588ca4d, 0xffffff34, 0xd28a458a,
+0xcb4d8ae0, 0xff308588, 0x458affff, 0x8ae0d28b,
+0x8588cc4d, 0xffffff2c, 0xd28c458a, 0xcd4d8ae0,
+0xff288588, 0x458affff, 0x8ae0d28d, 0x8588ce4d,
+0xffffff24, 0xd28e458a, 0xcf4d8ae0, 0xff208588,
+0x458affff, 0x8ae0d28f, 0x8588d04d, 0xffffff1c,
+0xd290458a, 0xd14d8ae0, 0xff188588, 0x458affff,
+0x8ae0d291, 0x8588d24d, 0xffffff17, 0x4d8ae3d2,
+0x93458ad3, 0xdb6e0f66, 0x8aeb280f, 0xb58b9455,
+0xffffff38, 0x4d8ae0d2, 0x168588d4, 0x8affffff,
+0x0f669545, 0xb58bce6e, 0xffffff30, 0x203a0f66,
+0xffff16ad, 0x290f01ff, 0xffff38ad, 0x3a0f66ff,
+0xff348d20, 0xd201ffff, 0xd54d8ae2, 0xda6e0f66,
+0xfe6e0f66, 0xff28b58b, 0x0f66ffff, 0x2cbd203a,
+0x01ffffff, 0xcf610f66, 0x4d8ae0d2, 0x108588d6,
+0x8affffff, 0x0f669645, 0xb58be66e, 0xffffff20,
+0x203a0f66, 0xffff24a5, 0x0f6601ff, 0x109d203a,
+0x01ffffff, 0x4d8ae0d2, 0xf88588d7, 0x8afffffe,
+0x0f669745, 0xb58bf66e, 0xffffff18, 0x203a0f66,
+0xffff1cb5, 0x0f6601ff, 0x0f66e661, 0x280fcc62,
+0x88e0d2f9, 0xf8858bc1, 0x66fffffe, 0x66c66e0f,
+0x85203a0f, 0xffffff17, 0x610f6601, 0xffff3885,
+0x6e0f66ff, 0x3a0f66e8, 0x6601e920, 0x66dd610f,
+0x66c3620f, 0x0ff86c0f, 0xfef8bd29, 0x0f66ffff,
+0x0f66c076, 0x0fc845fc, 0x8ac84529, 0x858ac84d,
+0xffffff48, 0xd2925d8a, 0xc94d8ae0, 0xff488588,
+0x458affff, 0x8ae0d289, 0x8588ca4d, 0xffffff38,
+0xd28a458a, 0xcb4d8ae0, 0xff348588, 0x458affff,
+0x8ae0d28b, 0x8588cc4d, 0xffffff30, 0xd28c458a,
+0xcd4d8ae0, 0xff2c8588, 0x458affff, 0x8ae0d28d,
+0x8588ce4d, 0xffffff28, 0xd28e458a, 0xcf4d8ae0,
+0xff248588, 0x458affff, 0x8ae0d28f, 0x8588d04d,
+0xffffff20, 0xd290458a, 0xd14d8ae0, 0xff1c8588,
+0x458affff, 0x8ae0d291, 0x8588d24d, 0xffffff18,
+0x4d8ae3d2, 0x93458ad3, 0xdb6e0f66, 0x8aeb280f,
+0xb58b9455, 0xffffff48, 0x4d8ae0d2, 0x178588d4,
+0x8affffff, 0x0f669545, 0xb58bc66e, 0xffffff34,
+0x203a0f66, 0xffff17ad, 0x290f01ff, 0xffff48ad,
+0x3a0f66ff, 0xff388520, 0xd201ffff, 0xd54d8ae2,
+0xda6e0f66, 0xf66e0f66, 0xff2cb58b, 0x0f66ffff,
+0x30b5203a, 0x01ffffff, 0xc6610f66, 0x4d8ae0d2,
+0x168588d6, 0x8affffff, 0x0f669645, 0xb58be66e,
+0xffffff24, 0x203a0f66, 0xffff28a5, 0x0f6601ff,
+0x169d203a, 0x01ffffff, 0x4d8ae0d2, 0x108588d7,
+0x8affffff, 0x0f669745, 0x280fce6e, 0x1cb58bf9,
+0x66ffffff, 0xbd203a0f, 0xffffff20, 0x610f6601,
+0x620f66e7, 0x88e0d2c4, 0x10858bc1, 0x66ffffff,
+0x66ce6e0f, 0x8d203a0f, 0xffffff18, 0x610f6601,
+0xffff488d, 0x6e0f66ff, 0x3a0f66e8, 0x6601e920,
+0x66dd610f, 0x66cb620f, 0x66c16c0f, 0x66c0fc0f,
+0xf885740f, 0xb8fffffe, 0x0000032c, 0x17380f66,
+0xb1830fc2, 0x0f000001, 0x0f984d28, 0x66a84528,
+0x0fc1da0f, 0x66a85d28, 0x66d9de0f, 0xa84dfc0f,
+0xc3fc0f66, 0x00033fb8, 0x740f6600, 0x380f66c1,
+0x830fc217, 0x00000180, 0xd09f280f, 0xb8ffffff,
+0x00000354, 0xb84d280f, 0x66c3280f, 0xc108380f,
+0xc1740f66, 0x17380f66, 0x59830fc2, 0x0f000001,
+0x66a86528, 0xb8ed760f, 0x00000359, 0x9845280f,
+0xecfc0f66, 0x00380f66, 0x740f66c5, 0x380f66c4,
+0x830fc217, 0x00000130, 0x66ec280f, 0x986d600f,
+0x66c4280f, 0x9845680f, 0x85fc0f66, 0xffffff58,
+0x000370b8, 0xf80f6600, 0xc1570fc5, 0x588d570f,
+0x66ffffff, 0x66c1f80f, 0xe087740f, 0x66ffffff,
+0xc217380f, 0x00ee830f, 0x0f660000, 0x98553038,
+0x30380f66, 0x95290fca, 0xffffff78, 0x884d290f,
+0x987d280f, 0x30380f66, 0x740f66c7, 0x760f66c2,
+0x039ab8d2, 0x0f660000, 0x0fc21738, 0x0000b783,
+0x75280f00, 0x380f6698, 0xa1b8c631, 0x66000003,
+0x66c1740f, 0xc217380f, 0x009a830f, 0x280f0000,
+0x0f66987d, 0x0fc73238, 0xff688529, 0x280fffff,
+0x03a8b8e8, 0x0f660000, 0x66c93038, 0x66e9740f,
+0xea17380f, 0x280f7273, 0xc031984d, 0xa8c4280f,
+0x0f037501, 0x290fc128, 0x548ad845, 0x9488d805,
+0xffff7805, 0xf88340ff, 0x0fe17510, 0xc4b8c057,
+0x66000003, 0xb845640f, 0x10380f66, 0x740f66e1,
+0xffff78a5, 0x380f66ff, 0x2c73e217, 0x31c1280f,
+0x3a0f66c0, 0x0f01c10f, 0xfff08f54, 0x0f66ffff,
+0x0f66cbfc, 0x0f66c874, 0x0fca1738, 0xf883c092,
+0x25c01901, 0x000003e4, 0x00fcc481, 0x5e5b0000,
+0x8bc35d5f, 0x00c3243c, 0x00000000, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0003214,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x070fe8c3,
+0x5e050000, 0x31000007, 0xe58955c9, 0xbb535657,
+0x00000010, 0x00ecec81, 0x85890000, 0xffffff54,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf8839645,
+0x74896608, 0x8966a645, 0x66b64554, 0xc6455c89,
+0xc1890474, 0x280fbaeb, 0x290f9875, 0xffff68b5,
+0x85280fff, 0xffffff68, 0xc9760f66, 0x000260b8,
+0xd0280f00, 0xd6750f66, 0x17380f66, 0x73830fd1,
+0x0f000006, 0x66985528, 0x0fd0fd0f, 0xff789529,
+0x280fffff, 0x66b89855, 0x66000002, 0x01f2710f,
+0x95750f66, 0xffffff78, 0x17380f66, 0x43830fd1,
+0x0f000006, 0xff789528, 0x0f66ffff, 0x0f9855f9,
+0x0f885529, 0x6bb8d028, 0x66000002, 0x8855750f,
+0x17380f66, 0x1b830fd1, 0x0f000006, 0x66a85d28,
+0x9845d50f, 0xdbd50f66, 0x9855280f, 0xa86d280f,
+0xeafd0f66, 0x66e2280f, 0x66c3f90f, 0xa865f90f,
+0x000282b8, 0xd50f6600, 0x750f66e5, 0x380f66c4,
+0x830fc117, 0x000005de, 0xa845280f, 0xc2d50f66,
+0xff54858b, 0x0f66ffff, 0xffc08075, 0xd3b8ffff,
+0x66000002, 0xc117380f, 0x05b8830f, 0x280f0000,
+0xe50f66da, 0x280fb85d, 0x570fb86d, 0x02dab8c0,
+0x0f660000, 0x0f66c565, 0x0f66c375, 0x0fc11738,
+0x00059183, 0xc5280f00, 0xc2d50f66, 0x8845290f,
+0x885d280f, 0xf3710f66, 0x9d290f03, 0xffffff68,
+0x8845280f, 0xf0710f66, 0x85290f02, 0xffffff78,
+0xc0fd0f66, 0x0002f8b8, 0x750f6600, 0x380f66c3,
+0x830fc117, 0x0000054e, 0x6885280f, 0x66ffffff,
+0x02e0710f, 0xc0fd0f66, 0x0002fdb8, 0x750f6600,
+0xffff7885, 0x380f66ff, 0x830fc117, 0x00000526,
+0xc7c2280f, 0xffff6485, 0x000003ff, 0xd50f6600,
+0xd8280fc5, 0xff64858b, 0x8589ffff, 0xffffff38,
+0x891ff8c1, 0xffff3c85, 0x7e0ff3ff, 0xffff38bd,
+0xf10f66ff, 0x6485c7df, 0x02ffffff, 0x8b000000,
+0xffff6485, 0x388589ff, 0xc1ffffff, 0x85891ff8,
+0xffffff3c, 0xb57e0ff3, 0xffffff38, 0xc6f10f66,
+0x7885290f, 0x66ffffff, 0xb8c0fd0f, 0x00000310,
+0xc3750f66, 0x17380f66, 0xa7830fc1, 0x8b000004,
+0xffff6485, 0x388589ff, 0xc1ffffff, 0x85891ff8,
+0xffffff3c, 0xbd7e0ff3, 0xffffff38, 0xdfe10f66,
+0x66c3280f, 0xb8c3fd0f, 0x00000314, 0x85750f66,
+0xffffff78, 0x17380f66, 0x67830fc1, 0x0f000004,
+0x0fc84528, 0x280fe457, 0xd50f66da, 0x650f66dd,
+0xc3540fc4, 0x8845290f, 0x6688458b, 0xff488589,
+0xbf0fffff, 0x858bc84d, 0xffffff48, 0x8e7d8b66,
+0xd390758b, 0x4dbf0fe0, 0x288589ca, 0x66ffffff,
+0x898a458b, 0x6e0f66f2, 0xffff289d, 0x858966ff,
+0xffffff38, 0xff38858b, 0xe0d3ffff, 0xcc4dbf0f,
+0xff248589, 0x458bffff, 0xc40f668c, 0xffff249d,
+0x896601ff, 0xffff5085, 0x509d8bff, 0xd3ffffff,
+0x4dbf0fe3, 0x209d89ce, 0x89ffffff, 0x6e0f66fb,
+0xffff20bd, 0x0fe3d3ff, 0x89d04dbf, 0xffff1c9d,
+0x5d8b66ff, 0x0fe2d392, 0x89d24dbf, 0xffff1895,
+0xd3da89ff, 0x4dbf0fe2, 0x149589d4, 0x8bffffff,
+0xd0899455, 0xbf0fe0d3, 0x8589d64d, 0xffffff10,
+0x96458b66, 0x4c858966, 0x8bffffff, 0xffff4c85,
+0xc40f66ff, 0xffff1cbd, 0x0f6601ff, 0xff18856e,
+0x0f66ffff, 0xff10b56e, 0x0f66ffff, 0xff1485c4,
+0x6601ffff, 0xd3df620f, 0xc40f66e0, 0x0f6601f0,
+0x280fc662, 0x6c0f66f3, 0xb5290ff0, 0xffffff28,
+0xff54858b, 0x280fffff, 0x280fc845, 0xffffd0b0,
+0xf90f66ff, 0x45290fc6, 0x4dbf0fc8, 0x48858bc8,
+0xd3ffffff, 0x4dbf0fe0, 0x488589ca, 0x8bffffff,
+0xffff3885, 0x6e0f66ff, 0xffff4885, 0x0fe0d3ff,
+0x89cc4dbf, 0xffff3885, 0x50858bff, 0x66ffffff,
+0x3885c40f, 0x01ffffff, 0xbf0fe0d3, 0x8589ce4d,
+0xffffff50, 0xff4c858b, 0x0f66ffff, 0xff509d6e,
+0x280fffff, 0x0fe7d3fb, 0x66d04dbf, 0x01ffc40f,
+0x38bd290f, 0x66ffffff, 0x3885620f, 0xd3ffffff,
+0x4dbf0fe6, 0x6e0f66d2, 0x0fe3d3de, 0x66d44dbf,
+0x01dbc40f, 0xbf0fe2d3, 0x0f66d64d, 0xe0d3fa6e,
+0xf8c40f66, 0x620f6601, 0x6c0f66df, 0xfd0f66c3,
+0x032cb8c0, 0x0f660000, 0xff288575, 0x0f66ffff,
+0x0fc11738, 0x00026d83, 0x45280f00, 0xdd280fa8,
+0xc5d50f66, 0x7885290f, 0x66ffffff, 0x0fdad50f,
+0xff788528, 0x0f66ffff, 0x0f66c3ee, 0xff789dea,
+0x290fffff, 0xffff789d, 0xfd0f66ff, 0xffff7885,
+0x0348b8ff, 0x280f0000, 0x0f66a85d, 0x0f66c5d5,
+0x0f66dafd, 0x0f66c375, 0x0fc11738, 0x00021583,
+0xd50f6600, 0xad290fea, 0xffffff68, 0x00034fb8,
+0x380f6600, 0xff68851d, 0x0f66ffff, 0x0f66d075,
+0x0fd11738, 0x0001ed83, 0x45280f00, 0x0354b8b8,
+0x280f0000, 0x380f66d6, 0x0f66d009, 0x0f66d075,
+0x0fd11738, 0x0001cd83, 0x55280f00, 0x700ff2a8,
+0xb81b985d, 0x00000359, 0xdb700ff3, 0x700f661b,
+0x0f664edb, 0x0f66da75, 0x0fd91738, 0x0001a583,
+0xda280f00, 0x5d610f66, 0xea280f98, 0x6d690f66,
+0x54858b98, 0x66ffffff, 0x66ddf90f, 0x66d8d50f,
+0xe098750f, 0xb8ffffff, 0x00000370, 0x17380f66,
+0x6f830fd9, 0x0f000001, 0x66985d28, 0x66e0650f,
+0x0fd8d50f, 0xff689d29, 0x0f66ffff, 0x280fdc61,
+0xffff68bd, 0x380f66ff, 0x7ab8ef23, 0x66000003,
+0x66dd750f, 0xd917380f, 0x0138830f, 0x0f660000,
+0x0f66e461, 0x290fec61, 0xffff78ad, 0xdd280fff,
+0x68bd280f, 0x66ffffff, 0xe724380f, 0x8865290f,
+0x000382b8, 0x750f6600, 0x380f66dc, 0x830fd917,
+0x00000102, 0x985d280f, 0x280fc031, 0x7501a8e2,
+0xe3280f03, 0xd865290f, 0x45548b66, 0x948966d8,
+0xffff7845, 0xf88340ff, 0x0fdf7508, 0xc4b8e457,
+0x66000003, 0x66c4650f, 0xd310380f, 0x7885280f,
+0x66ffffff, 0x66d0750f, 0xd117380f, 0x00b4830f,
+0x280f0000, 0xd4b89855, 0x0f000003, 0x0f66da28,
+0xa85d0e3a, 0x750f66aa, 0x380f66c3, 0x830fc117,
+0x00000092, 0x8bc2280f, 0xffff5485, 0x3a0f66ff,
+0x0f02c20f, 0xfff09828, 0xe4b8ffff, 0x0f000003,
+0x0f66da54, 0x0f66defd, 0x0f66c375, 0x73c11738,
+0x95290f65, 0xffffff68, 0x000003b8, 0xd4280f00,
+0x48c2280f, 0x01380f66, 0xffff6885, 0x85290fff,
+0xffffff68, 0x0f66ea75, 0x8307d0c5, 0xf8b824fa,
+0x75000003, 0x45280f31, 0x66c03198, 0x4505380f,
+0x380f66a8, 0x0f66c201, 0x66c20138, 0xc201380f,
+0xc2750f66, 0x17380f66, 0xc0920fc1, 0x1901f883,
+0x040125c0, 0xc4810000, 0x000000ec, 0x5d5f5e5b,
+0x24048bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0003574,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0x00063be8, 0x83c78100,
+0x56000006, 0xccec8153, 0x89000000, 0xffff5485,
+0xd0b70fff, 0x000008bb, 0x01728d00, 0xc289d329,
+0x01e28340, 0x4af6b70f, 0x85dbb70f, 0xffff5485,
+0xd2b70fff, 0x66490175, 0x96457489, 0x6608f883,
+0xa6455c89, 0x45548966, 0x4c8966b6, 0xbb75c645,
+0x986d280f, 0x68ad290f, 0x0fffffff, 0xff689528,
+0x0f66ffff, 0x60b8c976, 0x0f000002, 0x0f66c228,
+0x0f66c575, 0x0fc11738, 0x0005b083, 0x45280f00,
+0xfd0f6698, 0x85290fc2, 0xffffff78, 0x9845280f,
+0x000266b8, 0x710f6600, 0x0f6601f0, 0xff788575,
+0x0f66ffff, 0x0fc11738, 0x00058083, 0x85280f00,
+0xffffff78, 0x45f90f66, 0x45290f98, 0xda280f88,
+0x00026bb8, 0x750f6600, 0x0f66885d, 0x0fd91738,
+0x00055883, 0x55560f00, 0x95290fa8, 0xffffff68,
+0xa845540f, 0x8855280f, 0xa855570f, 0x6885550f,
+0xb8ffffff, 0x00000277, 0xed760f66, 0xc2750f66,
+0x17380f66, 0x22830fc1, 0x0f000005, 0x0f984528,
+0x66a85528, 0xb8d0d50f, 0x000002d3, 0x97750f66,
+0xffffffc0, 0x17380f66, 0xfe830fd1, 0x0f000004,
+0x0f66d828, 0x0fb85de4, 0xb8b85528, 0x000002dc,
+0x66d0540f, 0xb855fd0f, 0xd3750f66, 0x17380f66,
+0xd6830fd1, 0x0f000004, 0x0f884529, 0x66885d28,
+0x03f3710f, 0x689d290f, 0x0fffffff, 0x66885528,
+0x02f2710f, 0x7895290f, 0x66ffffff, 0xb8d2fd0f,
+0x000002f8, 0xd3750f66, 0x17380f66, 0x9a830fd1,
+0x0f000004, 0xff689528, 0x0f66ffff, 0x6602d271,
+0xb8d2fd0f, 0x000002fd, 0x95750f66, 0xffffff78,
+0x17380f66, 0x72830fd1, 0xc7000004, 0xffff6485,
+0x000003ff, 0xd0280f00, 0x9d6e0f66, 0xffffff64,
+0xd3f10f66, 0xff6485c7, 0x0002ffff, 0x280f0000,
+0x6e0f66d8, 0xffff64a5, 0xf10f66ff, 0x9d290fdc,
+0xffffff78, 0xdbfd0f66, 0x000310b8, 0x750f6600,
+0x380f66da, 0x830fd917, 0x00000421, 0x9d6e0f66,
+0xffffff64, 0xd3d10f66, 0xd2fd0f66, 0x000314b8,
+0x750f6600, 0xffff7895, 0x380f66ff, 0x830fd117,
+0x000003f9, 0x0fdb570f, 0x0f66d328, 0x66c85575,
+0x0fd3750f, 0x290fd054, 0x458b8855, 0x85896688,
+0xffffff44, 0xc84db70f, 0xff44858b, 0x5d8bffff,
+0x0fe0d38c, 0x89ca4db7, 0xffff4085, 0x458b66ff,
+0x6e0f668a, 0xffff409d, 0x858966ff, 0xffffff54,
+0xff54858b, 0xe0d3ffff, 0xcc4db70f, 0xff3c8589,
+0xd889ffff, 0xb70fe0d3, 0x8589ce4d, 0xffffff38,
+0x8e458b66, 0x50858966, 0x8bffffff, 0xffff5085,
+0x0fe0d3ff, 0x89d04db7, 0xffff3485, 0x90458bff,
+0x4c858966, 0x8bffffff, 0xffff4cb5, 0x0fe6d3ff,
+0x89d24db7, 0xffff30b5, 0x758b66ff, 0xd3f28992,
+0x4db70fe2, 0x2c9589d4, 0x8bffffff, 0xd0899455,
+0xb70fe0d3, 0x8589d64d, 0xffffff28, 0x96458b66,
+0x48858966, 0x8bffffff, 0xffff4885, 0xc40f66ff,
+0xffff3c9d, 0x0f6601ff, 0xff38b56e, 0x0f66ffff,
+0xff30956e, 0x0f66ffff, 0xff34b5c4, 0x6601ffff,
+0x2c95c40f, 0x01ffffff, 0xa56e0f66, 0xffffff28,
+0xde620f66, 0x0f66e0d3, 0x6601e0c4, 0x66d4620f,
+0x0fda6c0f, 0x66c85528, 0x0fd5fd0f, 0x0fc85529,
+0x8bc84db7, 0xffff4485, 0x0fe0d3ff, 0x89ca4db7,
+0xffff4485, 0x54858bff, 0x66ffffff, 0x44956e0f,
+0xd3ffffff, 0x4db70fe0, 0x548589cc, 0x8bffffff,
+0xffff5085, 0xc40f66ff, 0xffff5495, 0xe3d301ff,
+0xce4db70f, 0xfb6e0f66, 0xb70fe0d3, 0x8589d04d,
+0xffffff50, 0xff4c858b, 0x0f66ffff, 0xff50bdc4,
+0x6601ffff, 0xd3d7620f, 0x4db70fe0, 0x4c8589d2,
+0x8bffffff, 0xffff4885, 0x6e0f66ff, 0xffff4ca5,
+0x0fe6d3ff, 0x66d44db7, 0x01e6c40f, 0xb70fe2d3,
+0x0f66d64d, 0xe0d3f26e, 0xf0c40f66, 0x620f6601,
+0x6c0f66e6, 0xfd0f66d4, 0x032cb8d2, 0x0f660000,
+0x0f66d375, 0x0fd11738, 0x00021083, 0x55280f00,
+0x380f66a8, 0x280fd03a, 0x0f66a85d, 0x66d83e38,
+0xa845fd0f, 0xd3fd0f66, 0x00033fb8, 0x750f6600,
+0x380f66c2, 0x830fc117, 0x000001e1, 0xd09f280f,
+0xb8ffffff, 0x00000354, 0xb865280f, 0x66c3280f,
+0xc409380f, 0xc4750f66, 0x17380f66, 0xba830fc1,
+0x0f000001, 0xf2a85528, 0x9845700f, 0x0359b81b,
+0x0ff30000, 0x661bc070, 0x4ec0700f, 0xc2750f66,
+0x17380f66, 0x92830fc1, 0x0f000001, 0x0f66f228,
+0x0f987561, 0x0f66c228, 0x66984569, 0xb8c5fd0f,
+0x00000370, 0xc6f90f66, 0x0fc4570f, 0x0f66e557,
+0x0f66c4f9, 0xffe08775, 0x0f66ffff, 0x0fc11738,
+0x00015883, 0x380f6600, 0x66986533, 0xc433380f,
+0x78a5290f, 0x0fffffff, 0x0f884529, 0x66987d28,
+0xc733380f, 0x00039ab8, 0x750f6600, 0x380f66c4,
+0x830fc117, 0x00000125, 0x986d280f, 0x34380f66,
+0x85290fc5, 0xffffff68, 0xb8e0280f, 0x000003a1,
+0x65750f66, 0x380f6688, 0x830fe117, 0x000000fd,
+0x9865280f, 0x280fc031, 0x7501a8c2, 0xc4280f03,
+0xd845290f, 0x45548b66, 0x948966d8, 0xffff7845,
+0xf88340ff, 0x0fdf7508, 0xc4b8c057, 0x66000003,
+0xb845640f, 0x10380f66, 0x85280fd4, 0xffffff78,
+0xd0750f66, 0x17380f66, 0xae830fd1, 0x0f000000,
+0xb8985528, 0x000003d4, 0x66e2280f, 0x650e3a0f,
+0x0f66aaa8, 0x0f66c475, 0x0fc11738, 0x00008c83,
+0x87280f00, 0xfffffff0, 0x0003e4b8, 0xc2540f00,
+0xd8fd0f66, 0x66c2280f, 0xc20f3a0f, 0x750f6602,
+0x380f66c3, 0x6573c117, 0x6895290f, 0x0fffffff,
+0x03b8d257, 0x0f000000, 0x6648c228, 0x8501380f,
+0xffffff68, 0x6885290f, 0x75ffffff, 0xc50f66ea,
+0xfa8307d0, 0x03f8b824, 0x31750000, 0x9845280f,
+0x0f66c031, 0xa8450538, 0x01380f66, 0x380f66c2,
+0x0f66c201, 0x66c20138, 0x66c2750f, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00040125, 0xccc48100,
+0x5b000000, 0xc35d5f5e, 0xc3243c8b, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0003254,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20b955c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0xe8535600,
+0x00000554, 0x059cc381, 0xec810000, 0x0000009c,
+0xfa89c689, 0x89c22940, 0xffff6095, 0x83f289ff,
+0xfa8301e2, 0x83d21901, 0x854a02e2, 0x490175f0,
+0xa4854489, 0xff60b58b, 0xf883ffff, 0x85548904,
+0x854c89c4, 0x857489d4, 0x0fc575b4, 0x0fa87d28,
+0xff78bd29, 0x280fffff, 0xffff7885, 0x760f66ff,
+0x0260b8c9, 0x280f0000, 0x760f66d0, 0x380f66d7,
+0x830fd117, 0x000004d5, 0xa855280f, 0xd0fe0f66,
+0x8855290f, 0xa855280f, 0x000266b8, 0x720f6600,
+0x0f6601f2, 0x66885576, 0xd117380f, 0x04ab830f,
+0x280f0000, 0x0f668855, 0x0fa855fa, 0x0f985529,
+0x6bb8d028, 0x66000002, 0x9855760f, 0x17380f66,
+0x86830fd1, 0x0f000004, 0x66b85d28, 0x4540380f,
+0x380f66a8, 0x280fdb40, 0x280fa855, 0x0f66b86d,
+0x280feafe, 0xfa0f66e2, 0xfa0f66c3, 0x82b8b865,
+0x66000002, 0xe540380f, 0xc4760f66, 0x17380f66,
+0x46830fc1, 0x0f000004, 0x66b84528, 0xc240380f,
+0x0002d3b8, 0x760f6600, 0xffffc083, 0x380f66ff,
+0x830fc117, 0x00000425, 0xc845280f, 0x0fc2570f,
+0xff788529, 0x0f66ffff, 0x0f66c07e, 0xb8452838,
+0x89b86df7, 0x458b9845, 0x9c5589c0, 0x89806df7,
+0xecb8a045, 0x89000002, 0x0f66a455, 0x66984576,
+0xc117380f, 0x03e3830f, 0x280f0000, 0x0f66c845,
+0x0fc24038, 0x0f984529, 0x66986528, 0x03f4720f,
+0x78a5290f, 0x0fffffff, 0x66985d28, 0x02f3720f,
+0x885d290f, 0xdbfe0f66, 0x0002f8b8, 0x760f6600,
+0x380f66dc, 0x830fd917, 0x000003a1, 0x789d280f,
+0x66ffffff, 0x02e3720f, 0xdbfe0f66, 0x0002fdb8,
+0x760f6600, 0x0f66885d, 0x0fd91738, 0x00037c83,
+0x7485c700, 0x03ffffff, 0x0f000000, 0x858bd828,
+0xffffff74, 0xff608589, 0xf8c1ffff, 0x6485891f,
+0xf3ffffff, 0x60bd7e0f, 0x66ffffff, 0xc7dff20f,
+0xffff7485, 0x000002ff, 0x74858b00, 0x89ffffff,
+0xffff6085, 0x1ff8c1ff, 0xff648589, 0x0ff3ffff,
+0xff60bd7e, 0x0f66ffff, 0x290fc7f2, 0x0f668845,
+0x10b8c0fe, 0x66000003, 0x66c3760f, 0xc117380f,
+0x0307830f, 0x858b0000, 0xffffff74, 0xff608589,
+0xf8c1ffff, 0x6485891f, 0xf3ffffff, 0x60bd7e0f,
+0x66ffffff, 0x0fdfe20f, 0x0f66c328, 0x14b8c3fe,
+0x66000003, 0x8845760f, 0x17380f66, 0xca830fc1,
+0x0f000002, 0x0fc85d28, 0x280fe457, 0x0f66d845,
+0x66da4038, 0x0fc4660f, 0x290fc354, 0x0f669845,
+0x4d8bc07e, 0x8bc789d8, 0xe7d3a055, 0x66dc4d8b,
+0x8bef6e0f, 0xd6899c7d, 0x4d8be7d3, 0x3a0f66e0,
+0xd301ef22, 0xe44d8be6, 0xc66e0f66, 0xd3a4758b,
+0x3a0f66e6, 0x6601c622, 0x0fe86c0f, 0x0fd84528,
+0xffd09b28, 0x0f66ffff, 0x290fc3fa, 0x4d8bd845,
+0x9c758bd8, 0x4d8be0d3, 0x6e0f66dc, 0xa4458bc0,
+0x4d8be6d3, 0x3a0f66e0, 0xd301c622, 0xe44d8be2,
+0xf26e0f66, 0x0f66e0d3, 0x01f0223a, 0xc66c0f66,
+0xc0fe0f66, 0xc5760f66, 0x00032cb8, 0x380f6600,
+0x830fc117, 0x00000215, 0xc86d280f, 0xb845280f,
+0x66f5280f, 0xc540380f, 0x8845290f, 0x40380f66,
+0x45280ff2, 0x380f6688, 0x0f66c63d, 0x88753938,
+0x8875290f, 0x45fe0f66, 0x0348b888, 0x280f0000,
+0x0f66b875, 0x66c54038, 0x66f2fe0f, 0x66c6760f,
+0xc117380f, 0x01c3830f, 0x0f660000, 0x0fea4038,
+0xff78ad29, 0x4fb8ffff, 0x66000003, 0x851e380f,
+0xffffff78, 0xd0760f66, 0x17380f66, 0x9a830fd1,
+0x0f000001, 0xb8c84528, 0x00000354, 0x66d3280f,
+0xd00a380f, 0xd0760f66, 0x17380f66, 0x7a830fd1,
+0x0f000001, 0x66b85528, 0xa86d700f, 0x0359b81b,
+0x0f660000, 0x0f66ea76, 0x0fe91738, 0x00015c83,
+0xea280f00, 0x6d620f66, 0xf2280fa8, 0x756a0f66,
+0xfa0f66a8, 0x0370b8ee, 0x0f660000, 0x66e84038,
+0xe0ab760f, 0x66ffffff, 0xe917380f, 0x012b830f,
+0x280f0000, 0x280fa86d, 0x380f66fc, 0x0f66e840,
+0x280ff866, 0xad290ff5, 0xffffff78, 0xf7620f66,
+0x78bd280f, 0x66ffffff, 0xef25380f, 0x00037ab8,
+0x760f6600, 0x380f66ee, 0x830fe917, 0x000000ed,
+0xa86d280f, 0x163a0f66, 0x66018c55, 0x55163a0f,
+0x0f660394, 0xc4b8c466, 0x66000003, 0x886d7e0f,
+0x163a0f66, 0x0f02906d, 0x66886528, 0xd510380f,
+0xd4760f66, 0x17380f66, 0xae830fd1, 0x0f000000,
+0xb8a84528, 0x000003d4, 0x66d0280f, 0x550e3a0f,
+0x0f66ccb8, 0x0f66e276, 0x0fe11738, 0x00008c83,
+0x93280f00, 0xfffffff0, 0x0003e4b8, 0xd0540f00,
+0xdafe0f66, 0x66d0280f, 0xd00f3a0f, 0x760f6604,
+0x380f66d3, 0x6573d117, 0x7885290f, 0x0fffffff,
+0x280fd257, 0x380f66c2, 0xff788502, 0x290fffff,
+0xffff7885, 0xc2280fff, 0x0003f8b8, 0x380f6600,
+0xff788502, 0x0f66ffff, 0x03c2163a, 0x750afa83,
+0x45280f2c, 0x66c031a8, 0x4506380f, 0x380f66b8,
+0x0f66c202, 0x66c20238, 0x66c2760f, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00040125, 0x9cc48100,
+0x5b000000, 0xc35d5f5e, 0xc3241c8b, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0002714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0xa5e85600,
+0x81000004, 0x0004edc6, 0xec815300, 0x0000009c,
+0xf989c389, 0x89c12940, 0xffff648d, 0x83d989ff,
+0x854901e1, 0x4a0175d8, 0xa4854489, 0xff649d8b,
+0xf883ffff, 0x854c8904, 0x855489c4, 0x855c89d4,
+0x0fcd75b4, 0x0fa87d28, 0xff78bd29, 0x280fffff,
+0xffff7895, 0x760f66ff, 0x0260b8c9, 0x280f0000,
+0x760f66c2, 0x380f66c7, 0x830fc117, 0x0000042d,
+0xa845280f, 0xc2fe0f66, 0x8845290f, 0xa845280f,
+0x000266b8, 0x720f6600, 0x0f6601f0, 0x66884576,
+0xc117380f, 0x0403830f, 0x280f0000, 0x0f668845,
+0x0fa845fa, 0x0f984529, 0x6bb8da28, 0x66000002,
+0x985d760f, 0x17380f66, 0xde830fd9, 0x0f000003,
+0x0fb85556, 0xff789529, 0x540fffff, 0x280fb845,
+0x570f9855, 0x550fb855, 0xffff7885, 0x0277b8ff,
+0x0f660000, 0x0f66e476, 0x0f66c276, 0x0fc11738,
+0x0003a883, 0x5d280f00, 0x45280fa8, 0x380f66b8,
+0xd3b8c340, 0x66000002, 0xc086760f, 0x66ffffff,
+0xc117380f, 0x0383830f, 0x280f0000, 0x570fc845,
+0x85290fc3, 0xffffff78, 0xc07e0f66, 0x45f40f66,
+0xb865f7b8, 0x8b984589, 0x5589c045, 0x8065f79c,
+0xb8a04589, 0x000002ec, 0x66a45589, 0x9845760f,
+0x17380f66, 0x42830fc1, 0x0f000003, 0x0f985d29,
+0x66985528, 0x03f2720f, 0x7895290f, 0x0fffffff,
+0x66984528, 0x02f0720f, 0x8845290f, 0xc0fe0f66,
+0x0002f8b8, 0x760f6600, 0x380f66c2, 0x830fc117,
+0x00000309, 0x7885280f, 0x66ffffff, 0x02d0720f,
+0xc0fe0f66, 0x0002fdb8, 0x760f6600, 0x0f668845,
+0x0fc11738, 0x0002e483, 0x7485c700, 0x03ffffff,
+0x0f000000, 0x0f66c328, 0xff74956e, 0x0f66ffff,
+0x85c7c2f2, 0xffffff74, 0x00000002, 0x66d3280f,
+0x74ad6e0f, 0x66ffffff, 0x0fd5f20f, 0x66885529,
+0xb8d2fe0f, 0x00000310, 0xd0760f66, 0x17380f66,
+0x96830fd1, 0x66000002, 0x74956e0f, 0x66ffffff,
+0x66c2d20f, 0xb8c0fe0f, 0x00000314, 0x45760f66,
+0x380f6688, 0x830fc117, 0x00000271, 0x0fd2570f,
+0x0f66c228, 0x66d84576, 0x0fc2760f, 0x290fc354,
+0x0f669845, 0x4d8bc07e, 0x8bc289d8, 0x7d8b9c5d,
+0x8be2d3a0, 0x0f66dc4d, 0xda89ea6e, 0x4d8be2d3,
+0x649589e0, 0x66ffffff, 0xad223a0f, 0xffffff64,
+0x8be7d301, 0x0f66e44d, 0x7d8bc76e, 0xd3fa89a4,
+0x3a0f66e2, 0x6601c222, 0x0fe86c0f, 0x66d84528,
+0x0fc4fe0f, 0x8bd84529, 0xe0d3d84d, 0x66dc4d8b,
+0x8bc06e0f, 0xe3d3a045, 0x66e04d8b, 0xc3223a0f,
+0x8be0d301, 0x0f66e44d, 0x2cb8f06e, 0xd3000003,
+0x3a0f66e7, 0x6601f722, 0x66c66c0f, 0x66c0fe0f,
+0x66c5760f, 0xc117380f, 0x01bf830f, 0x280f0000,
+0x0f66b845, 0x0fc33b38, 0x66b86d28, 0xeb3f380f,
+0x5dfe0f66, 0xfe0f66b8, 0x033fb8c5, 0x0f660000,
+0x0f66c376, 0x0fc11738, 0x00019083, 0xae280f00,
+0xffffffd0, 0x000354b8, 0x75280f00, 0xc5280fc8,
+0x0a380f66, 0x760f66c6, 0x380f66c6, 0x830fc117,
+0x00000169, 0xb85d280f, 0x45700f66, 0x59b81ba8,
+0x66000003, 0x66c3760f, 0xc117380f, 0x014b830f,
+0x280f0000, 0x620f66fb, 0x280fa87d, 0x6a0f66c3,
+0x0f66a845, 0x70b8c4fe, 0x66000003, 0x0fc7fa0f,
+0x570fc657, 0xfa0f66f4, 0x760f66c6, 0xffffe086,
+0x380f66ff, 0x830fc117, 0x00000111, 0x35380f66,
+0x280fa865, 0x0f66a87d, 0xb8c73538, 0x0000039a,
+0xc4760f66, 0x17380f66, 0xee830fc1, 0x0f000000,
+0x0fa86528, 0x0f66c057, 0x8c5d163a, 0x3a0f6601,
+0x03945d16, 0x0003c4b8, 0x7e0f6600, 0x0f668865,
+0x9065163a, 0x640f6602, 0x0f66c845, 0x0fdc1038,
+0x66886528, 0x66dc760f, 0xd917380f, 0x00ab830f,
+0x280f0000, 0xd4b8a845, 0x0f000003, 0x0f66d828,
+0xb85d0e3a, 0x760f66cc, 0x380f66e3, 0x830fe117,
+0x00000089, 0xf0a6280f, 0xb8ffffff, 0x000003e4,
+0x0fd8280f, 0x0f66e054, 0x04d80f3a, 0xe5fe0f66,
+0xdc760f66, 0x17380f66, 0x0f6273d9, 0xff788529,
+0x280fffff, 0x380f66c2, 0xff788502, 0x290fffff,
+0xffff7885, 0x380f66ff, 0xff789502, 0xf8b8ffff,
+0x66000003, 0xd2163a0f, 0x0afa8303, 0x280f2f75,
+0x570fa845, 0x66c031d2, 0x4506380f, 0x380f66b8,
+0x0f66c202, 0x66c20238, 0x66c2760f, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00040125, 0x9cc48100,
+0x5b000000, 0xc35d5f5e, 0xc324348b, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0002434,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x3157e589, 0xe85356ff, 0x00000575, 0x05a4c381,
+0xec810000, 0x0000009c, 0x31cc4589, 0xdc4589c0,
+0x4589c031, 0x89c031c4, 0xc031d445, 0x01b845c7,
+0x89000000, 0x45c7bc7d, 0x000002c8, 0xd845c700,
+0x0000003f, 0x02c045c7, 0xc7000000, 0x0001d045,
+0x45c70000, 0x00003ee0, 0xe4458900, 0xb84d280f,
+0x884d290f, 0x8855280f, 0x000260b8, 0xc2280f00,
+0x29380f66, 0x760f66c1, 0x380f66c9, 0x830fc117,
+0x000004f2, 0xb845280f, 0xc2d40f66, 0x9845290f,
+0xb845280f, 0x000266b8, 0x730f6600, 0x0f6601f0,
+0x98452938, 0x17380f66, 0xc7830fc1, 0x0f000004,
+0x66984528, 0xb845fb0f, 0xa845290f, 0xb8c2280f,
+0x0000026b, 0x29380f66, 0x0f66a845, 0x0fc11738,
+0x0004a183, 0xc2280f00, 0xb865280f, 0xd0730f66,
+0xda280f20, 0x45f40f66, 0xf40f66b8, 0x0f66b85d,
+0x6620d473, 0x66d4f40f, 0x0fc2d40f, 0x66c85528,
+0x20f0730f, 0xd8d40f66, 0x66c2280f, 0x20d0730f,
+0x66e2280f, 0x66c2f40f, 0x66c0d40f, 0x66e2f40f,
+0x20f0730f, 0xe0d40f66, 0x68a5290f, 0x0fffffff,
+0x0fb85528, 0x66c84528, 0x0fc2d40f, 0x82b8f228,
+0x66000002, 0xc875fb0f, 0x66e8280f, 0x20d5730f,
+0x66fe280f, 0x0feef40f, 0x0f66e628, 0x6620d773,
+0x689dfb0f, 0x66ffffff, 0x66e0f40f, 0x66c7f40f,
+0x66c5d40f, 0x20f0730f, 0xe0d40f66, 0x29380f66,
+0x380f66dc, 0x830fd917, 0x000003ea, 0xc845280f,
+0x0fda280f, 0x280fe828, 0x730f66e2, 0x0f6620d3,
+0x6620d573, 0x66e0f40f, 0x66eaf40f, 0x66c3f40f,
+0x66c5d40f, 0x20f0730f, 0xc4d40f66, 0x0002d3b8,
+0x380f6600, 0xffe08329, 0x0f66ffff, 0x0fc11738,
+0x0003a183, 0x6885c700, 0xffffffff, 0x31ffffff,
+0x6c85c7f6, 0xffffffff, 0xc7ffffff, 0xffff5885,
+0x000001ff, 0x5cb58900, 0xf3ffffff, 0x58857e0f,
+0x0fffffff, 0xff688516, 0x280fffff, 0x730f66f0,
+0x280f20d6, 0xe2280feb, 0xe8f40f66, 0xd6f40f66,
+0xe0f40f66, 0xead40f66, 0xf5730f66, 0xd40f6620,
+0x6d290fec, 0x75280fa8, 0x730f66a8, 0x290f03f6,
+0x280f8875, 0x0f66a86d, 0x0f02f573, 0x66986d29,
+0x66edd40f, 0x66d8f40f, 0xee29380f, 0x0002f8b8,
+0x380f6600, 0x830fe917, 0x0000030a, 0x886d280f,
+0x8875280f, 0xd5730f66, 0x720f6602, 0x0f6602e6,
+0xccee0e3a, 0xedd40f66, 0x0002fdb8, 0x380f6600,
+0x66986d29, 0xe917380f, 0x02d8830f, 0x280f0000,
+0x8445c7f3, 0x00000003, 0xf2d40f66, 0xf6730f66,
+0xd40f6620, 0xee280ff4, 0x8984458b, 0xffff6885,
+0x1ff8c1ff, 0xff6c8589, 0x0ff3ffff, 0xff68bd7e,
+0x0f66ffff, 0x45c7eff3, 0x00000284, 0x84458b00,
+0xff688589, 0xf8c1ffff, 0x6c85891f, 0xf3ffffff,
+0x68bd7e0f, 0x66ffffff, 0x0ff7f30f, 0x66987529,
+0xb8f6d40f, 0x00000310, 0x29380f66, 0x380f66f5,
+0x830ff117, 0x0000025e, 0x0f84558b, 0x280fff57,
+0x380f66f7, 0x290ff537, 0xffff58b5, 0x89d089ff,
+0xffff6895, 0x1ff8c1ff, 0xff6c8589, 0x40b8ffff,
+0xf3000000, 0x68b57e0f, 0x66ffffff, 0x29eed30f,
+0xad290fd0, 0xffffff68, 0xf06e0f66, 0x58ad280f,
+0x66ffffff, 0x0feef30f, 0x280ff528, 0xffff68ad,
+0xee560fff, 0xedd40f66, 0x000314b8, 0x380f6600,
+0x66986d29, 0xe917380f, 0x01e8830f, 0x0f660000,
+0x0f66d3d4, 0x6620f273, 0x0fe2d40f, 0x66d85528,
+0xd737380f, 0x0fe2540f, 0x66a86529, 0x68a5d60f,
+0x8affffff, 0xf631d84d, 0xe07e0f66, 0x163a0f66,
+0xa50f01e2, 0xf6e0d3c2, 0x4d8a20c1, 0xd0450fe0,
+0x89c6450f, 0xffff5885, 0xb0458bff, 0xff5c9589,
+0x558bffff, 0x89c689b4, 0xf7a50fd7, 0xc1f6e6d3,
+0x89047420, 0xf3f631f7, 0x58a57e0f, 0x89ffffff,
+0xffff58b5, 0x5cbd89ff, 0x0fffffff, 0xff58a516,
+0x280fffff, 0x280fd85d, 0xfffff093, 0xfb0f66ff,
+0x5d290fda, 0xd84d8ad8, 0xb58bdb31, 0xffffff68,
+0xff6cbd8b, 0xa50fffff, 0xf6e6d3f7, 0x4d8a20c1,
+0xfe450fe0, 0x31f3450f, 0x6e0f66db, 0x3a0f66de,
+0x0f01df22, 0xe0d3c2a5, 0x0f20c1f6, 0x450fd045,
+0x688589c3, 0xb8ffffff, 0x0000032c, 0xff6c9589,
+0x160fffff, 0xffff689d, 0xd40f66ff, 0x380f66db,
+0x0f66dc29, 0x0fd91738, 0x0000e983, 0x5d280f00,
+0x700f66c8, 0xb84eb865, 0x00000359, 0x29380f66,
+0x380f66e3, 0x830fe117, 0x000000ca, 0x66fb280f,
+0xb87d6c0f, 0x66e3280f, 0xb8656d0f, 0xfcfb0f66,
+0x000370b8, 0xe7280f00, 0x66f0280f, 0x20d4730f,
+0xd6730f66, 0xf40f6620, 0xef280fe0, 0xf7f40f66,
+0xe6d40f66, 0xe8f40f66, 0xf4730f66, 0xd40f6620,
+0x380f66e5, 0x0f66e229, 0x73e11738, 0xe4570f79,
+0xa05d170f, 0x7d7e0ff3, 0xd60f66b8, 0xc4b8987d,
+0x66000003, 0xc437380f, 0x9865280f, 0x10380f66,
+0x0f66b85d, 0x66dc2938, 0xd917380f, 0x280f4873,
+0xd4b8b845, 0x0f000003, 0x0f66d828, 0xc85d0e3a,
+0x380f66f0, 0x0f66e329, 0x73e11738, 0xd8280f29,
+0x0f66c031, 0x08d80f3a, 0x66c2540f, 0x66c2d40f,
+0xc329380f, 0x17380f66, 0xc0920fc1, 0x1901f883,
+0x03e425c0, 0xc4810000, 0x0000009c, 0x5d5f5e5b,
+0x241c8bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x56c93157, 0x3153ff31, 0x03e7e8f6,
+0xc3810000, 0x0000040e, 0x008cec81, 0x45890000,
+0xc7c031bc, 0x0001b845, 0x45c70000, 0x000002c8,
+0xcc558900, 0x3fd845c7, 0x89000000, 0x45c7dc4d,
+0x000002c0, 0xc4758900, 0x01d045c7, 0x89000000,
+0x45c7d47d, 0x00003ee0, 0xe4458900, 0xb86d280f,
+0x886d290f, 0x8855280f, 0xc9760f66, 0x000260b8,
+0xc2280f00, 0x29380f66, 0x380f66c5, 0x830fc117,
+0x0000036a, 0xb845280f, 0xc2d40f66, 0x9845290f,
+0xb845280f, 0x000266b8, 0x730f6600, 0x0f6601f0,
+0x98452938, 0x17380f66, 0x3f830fc1, 0x0f000003,
+0x66984528, 0xb845fb0f, 0xa845290f, 0xb8da280f,
+0x0000026b, 0x29380f66, 0x0f66a85d, 0x0fd91738,
+0x00031983, 0x55560f00, 0x55290fc8, 0x45540f88,
+0x55280fc8, 0x55570fa8, 0xc1570fc8, 0x000277b8,
+0x45540f00, 0x380f6688, 0x0f66c229, 0x0fc11738,
+0x0002e983, 0x45280f00, 0xd0280fb8, 0xc865280f,
+0xd2730f66, 0xd8280f20, 0x55f40f66, 0xf40f66c8,
+0x0f66c85d, 0x6620d473, 0x66e0f40f, 0x66d4d40f,
+0x20f2730f, 0xd3d40f66, 0x0002d3b8, 0x380f6600,
+0xffe09329, 0x0f66ffff, 0x0fd11738, 0x00029d83,
+0x45290f00, 0x5d280fa8, 0x730f66a8, 0x290f03f3,
+0x280f885d, 0x0f66a855, 0x0f02f273, 0x66985529,
+0xb8d2d40f, 0x000002f8, 0x29380f66, 0x380f66d3,
+0x830fd117, 0x00000266, 0x8855280f, 0xd2730f66,
+0xd40f6602, 0x02fdb8d2, 0x0f660000, 0x98552938,
+0x17380f66, 0x43830fd1, 0xc7000002, 0x00038445,
+0x280f0000, 0x6e0f66d0, 0x0f66845d, 0x45c7d3f3,
+0x00000284, 0x6e0f6600, 0x0f66845d, 0x290fc3f3,
+0x0f669845, 0x10b8c0d4, 0x66000003, 0xc229380f,
+0x17380f66, 0x03830fc1, 0x66000002, 0x845d6e0f,
+0xd3d30f66, 0x66c2280f, 0xb8c2d40f, 0x00000314,
+0x29380f66, 0x0f669845, 0x0fc11738, 0x0001dd83,
+0xd2570f00, 0x66c2280f, 0x4529380f, 0x380f66d8,
+0x540fc229, 0x290fb845, 0x0f66a845, 0xff7085d6,
+0x4d8affff, 0x66f631d8, 0x66c07e0f, 0xc2163a0f,
+0xc2a50f01, 0xc1f6e0d3, 0xe04d8a20, 0x0fd0450f,
+0x8589c645, 0xffffff68, 0x89b0458b, 0xffff6c95,
+0xb4558bff, 0xd789c689, 0xd3f7a50f, 0x20c1f6e6,
+0xf7890474, 0x0ff3f631, 0xff68957e, 0xb589ffff,
+0xffffff68, 0xff6cbd89, 0x160fffff, 0xffff6895,
+0x45280fff, 0xd40f66d8, 0x45290fc1, 0xd84d8ad8,
+0xff70b58b, 0xbd8bffff, 0xffffff74, 0xd3f7a50f,
+0x20c1f6e6, 0xf7890474, 0x4d8af631, 0xc2a50fe0,
+0xc1f6e0d3, 0x89047420, 0x89c031c2, 0xffff7085,
+0x6e0f66ff, 0x3a0f66c6, 0x8901c722, 0xffff7495,
+0x032cb8ff, 0x160f0000, 0xffff7085, 0xd40f66ff,
+0x380f66c0, 0x0f66c229, 0x0fc11738, 0x0000ed83,
+0x5d280f00, 0x700f66c8, 0xb84eb845, 0x00000359,
+0x29380f66, 0x380f66c3, 0x830fc117, 0x000000ce,
+0xff7085c7, 0xffffffff, 0x85c7ffff, 0xffffff74,
+0xffffffff, 0x857e0ff3, 0xffffff70, 0xc07e0ff3,
+0x66e3280f, 0xb8656c0f, 0x66d3280f, 0xb8556d0f,
+0xd1d40f66, 0x000370b8, 0xfb0f6600, 0xe0280fd4,
+0x0fd0570f, 0x0f66e157, 0x280fd4fb, 0xfffff0a3,
+0x380f66ff, 0x0f66d429, 0x73d11738, 0x5d170f71,
+0x7e0ff3a0, 0x0f66b875, 0x0f9875d6, 0x66985528,
+0x5d10380f, 0x03c4b8b8, 0x0f660000, 0x66da2938,
+0xd917380f, 0x280f4873, 0xd4b8b845, 0x0f000003,
+0x0f66d828, 0xc85d0e3a, 0x380f66f0, 0x0f66d329,
+0x73d11738, 0xd0280f29, 0x0f66c031, 0x08d00f3a,
+0x66c4540f, 0x66c4d40f, 0xc229380f, 0x17380f66,
+0xc0920fc1, 0x1901f883, 0x03e425c0, 0xc4810000,
+0x0000008c, 0x5d5f5e5b, 0x241c8bc3, 0x000000c3,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002074,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0414e8c3,
+0xc2810000, 0x0000049e, 0x8955e8d9, 0x78ec83e5,
+0xd9c855d9, 0xffff8082, 0xd855d9ff, 0x55d9c9d9,
+0xc082d9e8, 0xd9ffffff, 0x82d9cc55, 0xffffff84,
+0xd9dc55d9, 0xd9e0d9e8, 0xc9d9ec55, 0xd9d05dd9,
+0xe05dd9c9, 0x55d9c9d9, 0xd9cad9f0, 0xc9d9d45d,
+0xd9e45dd9, 0x280ff45d, 0x290fc87d, 0x280f987d,
+0x0f669845, 0x60b8c976, 0x0f000002, 0xc20fd028,
+0x0f6600d7, 0x0fd11738, 0x00039783, 0x55280f00,
+0xd0580fc8, 0xa855290f, 0xc855280f, 0x000266b8,
+0xd2580f00, 0xa855c20f, 0x380f6600, 0x830fd117,
+0x00000370, 0xa855280f, 0xc8555c0f, 0xb855290f,
+0xb8d0280f, 0x0000026b, 0xb855c20f, 0x380f6600,
+0x830fd117, 0x0000034c, 0xd85d280f, 0xc845590f,
+0x0fdb590f, 0x0fc85528, 0x0fd86d28, 0x280fea58,
+0x0282b8e2, 0x5c0f0000, 0x5c0fd865, 0xe5590fc3,
+0x00c4c20f, 0x17380f66, 0x15830fc1, 0x0f000003,
+0x0fe84528, 0x290fc259, 0x5e0f9845, 0x8bb8e855,
+0x0f000002, 0x6600c2c2, 0xc117380f, 0x02f2830f,
+0x280f0000, 0x8eb8e85d, 0x0f000002, 0xff909228,
+0x280fffff, 0xc2570fc3, 0x9845590f, 0xc855570f,
+0x00c2c20f, 0x17380f66, 0xc5830fc1, 0x0f000002,
+0x0fc84553, 0x0f984529, 0xb8984553, 0x00000296,
+0xc855280f, 0xc05b0f66, 0x0fc05b0f, 0x6600c2c2,
+0xc117380f, 0x029a830f, 0x280f0000, 0xc2590fc2,
+0x9845290f, 0x9845520f, 0xa845290f, 0xa845280f,
+0x00029db8, 0xe0530f00, 0xe45b0f66, 0x0fe45b0f,
+0x6600d4c2, 0xd117380f, 0x0266830f, 0x0f660000,
+0x280fd05b, 0x9fb8c845, 0x0f000002, 0x530fd25b,
+0x5b0f66e0, 0xe45b0fe4, 0x00d4c20f, 0x17380f66,
+0x3d830fd1, 0x0f000002, 0x590fd028, 0x55290fd0,
+0x55510f98, 0x02a7b898, 0xc20f0000, 0x0f6600d0,
+0x0fd11738, 0x00021b83, 0xa2280f00, 0xffffffa0,
+0x0fd4280f, 0x290fd05e, 0x0f669855, 0x9855083a,
+0x92c20f0b, 0xffffffb0, 0x02afb800, 0x0f660000,
+0x0fd11738, 0x0001eb83, 0x55280f00, 0xeb280fd8,
+0x0fd3590f, 0x290fe859, 0x280fa855, 0x555f0fd5,
+0x6d5d0fa8, 0x6d290fa8, 0x55580fa8, 0x0348b8a8,
+0x580f0000, 0x590fd845, 0xc2c20fd3, 0x380f6600,
+0x830fc117, 0x000001ac, 0xc845280f, 0x000359b8,
+0xc0c60f00, 0x45c20f1b, 0x0f6600d8, 0x0fc11738,
+0x00018f83, 0x55280f00, 0xc2280fd8, 0xc845140f,
+0x0fea280f, 0x0fc86d15, 0x70b8c55c, 0x0f000003,
+0xc20fc359, 0xffffc082, 0x0f6600ff, 0x0fc11738,
+0x00015f83, 0x120ff300, 0x280fc845, 0xffffd0aa,
+0x03b1b8ff, 0x580f0000, 0xb2280feb, 0xffffffe0,
+0x0fee590f, 0x0fc8455c, 0x6600c5c2, 0xc117380f,
+0x012e830f, 0x0ff30000, 0x0fc84516, 0xb8b8e358,
+0x0f000003, 0x0fc86d28, 0x5c0fe659, 0xc4c20fc5,
+0x380f6600, 0x830fc117, 0x00000108, 0x6d110ff3,
+0xc0570fa8, 0x173a0f66, 0x6601ac55, 0x55173a0f,
+0x0f6603b4, 0xb06d173a, 0x03c4b802, 0xc20f0000,
+0x0f6601c3, 0x0fd51438, 0x0fa84528, 0x6600d0c2,
+0xd117380f, 0x00ca830f, 0x280f0000, 0xd4b8c855,
+0x66000003, 0x550c3a0f, 0xc20f0ad8, 0x0f6600c2,
+0x0fc11738, 0x0000ab83, 0x45280f00, 0xd00ff2c8,
+0x280fd845, 0xddb8c855, 0xf2000003, 0xd855d00f,
+0x00c2c20f, 0x17380f66, 0x85830fc1, 0x0f000000,
+0xb8c85528, 0x000003ec, 0x66c2280f, 0x45403a0f,
+0xc20ff1d8, 0xfffff082, 0x0f6600ff, 0x73c11738,
+0x55290f63, 0xd2570f98, 0xf2c2280f, 0x98457c0f,
+0x9845290f, 0xd9c2280f, 0xffff8882, 0x7c0ff2ff,
+0x0f669845, 0x9445173a, 0x9445d903, 0xd8dde9df,
+0x2b752d7a, 0xc845280f, 0x0ff2c031, 0xf2d8457d,
+0xf2c27c0f, 0x0fc27c0f, 0x6600c2c2, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00040125, 0xb805eb00,
+0x000003f8, 0x148bc3c9, 0x0000c324, 0x00000000,
+0x40800000, 0x40400000, 0x41200000, 0x00000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002274,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0400e8c3,
+0xc2810000, 0x0000047e, 0xc031e8d9, 0x83e58955,
+0x55dd78ec, 0xf04589c8, 0x00f445c7, 0xd9bff000,
+0xffff9082, 0xd855ddff, 0x55ddc9d9, 0xddc9d9e8,
+0x5dddd05d, 0x75280fe0, 0x75290fc8, 0x45280f98,
+0x760f6698, 0x0260b8c9, 0x280f0000, 0xc20f66d0,
+0x0f6600d6, 0x0fd11738, 0x0003a383, 0x55280f00,
+0x580f66c8, 0x55290fd0, 0x55280fa8, 0x0266b8c8,
+0x0f660000, 0x0f66d258, 0x00a855c2, 0x17380f66,
+0x79830fd1, 0x0f000003, 0x66a85528, 0xc8555c0f,
+0xb855290f, 0xb8d0280f, 0x0000026b, 0x55c20f66,
+0x0f6600b8, 0x0fd11738, 0x00035383, 0x5d280f00,
+0x590f66d8, 0x0f66c845, 0x280fdb59, 0x280fc855,
+0x0f66d86d, 0x280fea58, 0x5c0f66e2, 0x0282b8c3,
+0x0f660000, 0x66d8655c, 0x66e5590f, 0x00c4c20f,
+0x17380f66, 0x15830fc1, 0x0f000003, 0x66e84528,
+0x0fc2590f, 0xb8984529, 0x0000028b, 0x555e0f66,
+0xc20f66e8, 0x0f6600c2, 0x0fc11738, 0x0002ef83,
+0x55280f00, 0x028eb8e8, 0x280f0000, 0xffffa09a,
+0xc2280fff, 0x0fc3570f, 0x66c85d57, 0x9845590f,
+0xc3c20f66, 0x380f6600, 0x830fc117, 0x000002c0,
+0x455a0f66, 0xc0530fc8, 0x0fc05a0f, 0x66984529,
+0x98455a0f, 0xb8c0530f, 0x00000296, 0xc85d280f,
+0xf2c05a0f, 0xf3c0e60f, 0x66c0e60f, 0x00c3c20f,
+0x17380f66, 0x85830fc1, 0x0f000002, 0x0f66c328,
+0x290fc359, 0x0f669845, 0x0f98455a, 0x5a0fc052,
+0x45290fc0, 0x65280fa8, 0x029db8a8, 0x0f660000,
+0x530fc45a, 0xc05a0fc0, 0xc0e60ff2, 0xc0e60ff3,
+0xd8c20f66, 0x380f6600, 0x830fd917, 0x00000240,
+0xc85d280f, 0xe4e60ff2, 0x00029fb8, 0xe60ff300,
+0x5a0f66e4, 0xc0530fc3, 0xf2c05a0f, 0xf3c0e60f,
+0x66c0e60f, 0x00e0c20f, 0x17380f66, 0x0d830fe1,
+0x0f000002, 0x0f66c328, 0x290fc359, 0xa7b89845,
+0x66000002, 0x9845510f, 0xc3c20f66, 0x380f6600,
+0x830fc117, 0x000001e8, 0xb0aa280f, 0x0fffffff,
+0x0f66c528, 0x290fc35e, 0xafb89845, 0x66000002,
+0x45093a0f, 0x0f660b98, 0xffc082c2, 0x6600ffff,
+0xc117380f, 0x01b6830f, 0x280f0000, 0x280fd845,
+0x590f66e2, 0x590f66c2, 0x45290fe3, 0xc4280fa8,
+0x455f0f66, 0x5d0f66a8, 0x290fa865, 0x48b8a865,
+0x66000003, 0xa845580f, 0x5d580f66, 0x590f66d8,
+0xc20f66c2, 0x0f6600c3, 0x0fc11738, 0x00016f83,
+0x45280f00, 0x0359b8c8, 0x0f660000, 0x08c00f3a,
+0x45c20f66, 0x0f6600d8, 0x0fc11738, 0x00014f83,
+0x65280f00, 0xc4280fd8, 0x45160f66, 0x5d280fc8,
+0x120f66c8, 0x70b8e05d, 0x66000003, 0x66c35c0f,
+0x66c2590f, 0x00c5c20f, 0x17380f66, 0x1d830fc1,
+0xf2000001, 0xc845120f, 0xc86d280f, 0x0003b1b8,
+0x9a280f00, 0xffffffd0, 0xc55c0f66, 0xda580f66,
+0x9a590f66, 0xffffffe0, 0xc3c20f66, 0x380f6600,
+0x830fc117, 0x000000e8, 0x66db570f, 0xb065170f,
+0x6d130f66, 0x03c4b8a8, 0x280f0000, 0xc20f66c3,
+0x0f6601c2, 0x0fe51538, 0x66a84528, 0x00e0c20f,
+0x17380f66, 0xb5830fe1, 0x0f000000, 0xb8c85528,
+0x000003d4, 0x0d3a0f66, 0x6602d855, 0x00c2c20f,
+0x17380f66, 0x95830fc1, 0x0f000000, 0x66c84528,
+0xd845d00f, 0xc855280f, 0x0003ddb8, 0xd00f6600,
+0x0f66d855, 0x6600c2c2, 0xc117380f, 0x280f7273,
+0xecb8c855, 0x0f000003, 0x0f66c228, 0xd845413a,
+0xc20f6631, 0xfffff082, 0x0f6600ff, 0x73c11738,
+0x55290f4f, 0x7c0f6698, 0x0f66985d, 0xd9905d17,
+0xffff9482, 0x9045ddff, 0xd8dde9df, 0x2b752d7a,
+0xc845280f, 0x31d2570f, 0x7d0f66c0, 0x0f66d845,
+0x0f66c27c, 0x6600c2c2, 0xc117380f, 0x83c0920f,
+0xc01901f8, 0x00040125, 0xb805eb00, 0x000003f8,
+0x148bc3c9, 0x0000c324, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002234,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x53e58955,
+0x0004b8e8, 0xebc38100, 0x81000004, 0x0000e4ec,
+0x100ff300, 0xffffe083, 0x110ff3ff, 0xffff4485,
+0x110ff3ff, 0xffff4885, 0x110ff3ff, 0xffff4c85,
+0x44858bff, 0x89ffffff, 0xffff3885, 0x100ff3ff,
+0xffff388d, 0xbac031ff, 0x00000000, 0x448d2e0f,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0x7fe82404,
+0x83ffffff, 0xc18810c4, 0x000260b8, 0x0fc98400,
+0x00044384, 0x100ff300, 0xffff388d, 0x580ff3ff,
+0xffff448d, 0x110ff3ff, 0xffff3c8d, 0x100ff3ff,
+0xffff448d, 0x10ec83ff, 0x0ff3c031, 0x2e0fc958,
+0xffff3c8d, 0xc09b0fff, 0xf7c2450f, 0x240489d8,
+0xffff2de8, 0x10c483ff, 0x66b8c188, 0x84000002,
+0xf1840fc9, 0xf3000003, 0x3c8d100f, 0xf3ffffff,
+0x448d5c0f, 0xf3ffffff, 0x288d110f, 0x8bffffff,
+0xffff2885, 0x748589ff, 0x89ffffff, 0xffff3c85,
+0x408589ff, 0xf3ffffff, 0x388d100f, 0x83ffffff,
+0xc03110ec, 0x408d2e0f, 0x0fffffff, 0x450fc09b,
+0x89d8f7c2, 0xc7e82404, 0x83fffffe, 0xc18810c4,
+0x00026bb8, 0x0fc98400, 0x00038b84, 0x100ff300,
+0xffff388d, 0x590ff3ff, 0xffff448d, 0x110ff3ff,
+0xffff388d, 0x100ff3ff, 0xffff488d, 0x590ff3ff,
+0x110ff3c9, 0xffff3c8d, 0x100ff3ff, 0xffff448d,
+0x580ff3ff, 0xffff488d, 0x110ff3ff, 0xffff408d,
+0x100ff3ff, 0xffff448d, 0x10ec83ff, 0x9d100ff3,
+0xffffff38, 0x280fc031, 0x5c0ff3d1, 0xffff4895,
+0x5c0ff3ff, 0xffff3c9d, 0x590ff3ff, 0xffff4095,
+0x110ff3ff, 0xffff4095, 0xda2e0fff, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffe26, 0x8810c483,
+0x0282b8c1, 0xc9840000, 0x02ea840f, 0x0ff30000,
+0xff4c8d59, 0x0ff3ffff, 0xff388d11, 0x0ff3ffff,
+0xff448d10, 0xec83ffff, 0xf3c03110, 0x4c8d5e0f,
+0x0fffffff, 0xff388d2e, 0x0ff3ffff, 0xff3c8d11,
+0x9b0fffff, 0xc2450fc0, 0x0489d8f7, 0xfdd0e824,
+0xc483ffff, 0xb8c18810, 0x0000028b, 0x840fc984,
+0x00000294, 0x9b100ff3, 0xfffffff0, 0xf310ec83,
+0x4c8d100f, 0x31ffffff, 0x100ff3c0, 0xffff4495,
+0xcb570fff, 0x8d590ff3, 0xffffff38, 0x0fd3570f,
+0x9b0fca2e, 0xc2450fc0, 0x0489d8f7, 0xfd80e824,
+0xc483ffff, 0xb8c18810, 0x0000028e, 0x840fc984,
+0x00000244, 0x8d530ff3, 0xffffff44, 0x8d110ff3,
+0xffffff38, 0x95530ff3, 0xffffff38, 0xc22c0ff3,
+0xf310ec83, 0x448d100f, 0xf3ffffff, 0x31d02a0f,
+0xd12e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffd2e, 0x8810c483, 0x0296b8c1, 0xc9840000,
+0x01f2840f, 0x0ff30000, 0x0ff3c959, 0xff388d11,
+0x0ff3ffff, 0xff388d52, 0x0ff3ffff, 0xff3c8d11,
+0x0ff3ffff, 0xff3c8d53, 0x0ff3ffff, 0xec83c12c,
+0x2a0ff310, 0x0fc031c8, 0xff448d2e, 0x9b0fffff,
+0xc2450fc0, 0x0489d8f7, 0xfcd4e824, 0xc483ffff,
+0xb8c18810, 0x0000029d, 0x840fc984, 0x00000198,
+0x852c0ff3, 0xffffff3c, 0xf310ec83, 0x448d530f,
+0xf3ffffff, 0xf3d02a0f, 0xf3c12c0f, 0x31c82a0f,
+0xd12e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffc8e, 0x8810c483, 0x029fb8c1, 0xc9840000,
+0x0152840f, 0x0ff30000, 0xff448d10, 0x0ff3ffff,
+0x0ff3c959, 0xff388d11, 0x0ff3ffff, 0xff449510,
+0xec83ffff, 0xf3c03110, 0x388d510f, 0x0fffffff,
+0x9b0fca2e, 0xc2450fc0, 0x0489d8f7, 0xfc40e824,
+0xc483ffff, 0xb8c28810, 0x000002a7, 0x840fd284,
+0x00000104, 0xf3c8280f, 0x3c85110f, 0xf3ffffff,
+0xf3ca5e0f, 0x388d110f, 0x31ffffff, 0x10ec83c0,
+0x0a3a0f66, 0xffff3885, 0x2e0f0bff, 0xffff3c85,
+0x0000baff, 0x0ff30000, 0xff408511, 0x9b0fffff,
+0xc2450fc0, 0x0489d8f7, 0xfbe4e824, 0xc483ffff,
+0xb8c18810, 0x000002af, 0x840fc984, 0x000000a8,
+0x85100ff3, 0xffffff4c, 0x8d100ff3, 0xffffff44,
+0xc8590ff3, 0x85590ff3, 0xffffff48, 0x8d110ff3,
+0xffffff38, 0x85110ff3, 0xffffff3c, 0x85100ff3,
+0xffffff38, 0x855f0ff3, 0xffffff3c, 0x85110ff3,
+0xffffff40, 0x85100ff3, 0xffffff38, 0x855d0ff3,
+0xffffff3c, 0x85110ff3, 0xffffff3c, 0x85100ff3,
+0xffffff3c, 0xf310ec83, 0x448d100f, 0x31ffffff,
+0x580ff3c0, 0xffff4085, 0x580ff3ff, 0xffff488d,
+0x590ff3ff, 0xffff4c85, 0xc12e0fff, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffb36, 0x3c10c483,
+0x25c01901, 0x00000348, 0xc9fc5d8b, 0x241c8bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002434,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_f8[] = {
+0x0ae800eb, 0x81000006, 0x000639c1, 0xe5895500,
+0x01a8ec81, 0x0ff20000, 0xffe08110, 0x0ff2ffff,
+0xfe908511, 0x0ff2ffff, 0xfe988511, 0x0ff2ffff,
+0xfea08511, 0x858bffff, 0xfffffe90, 0xfe788589,
+0x858bffff, 0xfffffe94, 0xfe7c8589, 0x0ff2ffff,
+0xfe78a510, 0x0f66ffff, 0xfe90a52e, 0x0c7affff,
+0x000001b8, 0x0000ba00, 0x04740000, 0xd231c031,
+0x8589d8f7, 0xfffffe60, 0xb800d283, 0x00000260,
+0x9589daf7, 0xfffffe64, 0x60856f0f, 0x0ffffffe,
+0xfa81d0d7, 0x000000ff, 0x0571850f, 0x0ff20000,
+0xfe788d10, 0x0ff2ffff, 0xfe908d58, 0x0ff2ffff,
+0xfe808d11, 0xd231ffff, 0x8d100ff2, 0xfffffe90,
+0x000001b8, 0x580ff200, 0x2e0f66c9, 0xfffe808d,
+0x74027aff, 0x31c03104, 0x89d8f7d2, 0xfffe6085,
+0x00d283ff, 0x000266b8, 0x89daf700, 0xfffe6495,
+0x8d6f0fff, 0xfffffe60, 0x81d1d70f, 0x0000fffa,
+0x08850f00, 0xf2000005, 0x808d100f, 0xf2fffffe,
+0x908d5c0f, 0xf2fffffe, 0x688d110f, 0x8bfffffe,
+0xfffe6895, 0x6c858bff, 0x89fffffe, 0xfffef095,
+0xf48589ff, 0x89fffffe, 0xfffe8095, 0x848589ff,
+0x89fffffe, 0xfffe8895, 0x8c8589ff, 0x31fffffe,
+0x100ff2d2, 0xfffe78ad, 0x0001b8ff, 0x0f660000,
+0xfe88ad2e, 0x027affff, 0xc0310474, 0xd8f7d231,
+0xfe608589, 0xd283ffff, 0x026bb800, 0xdaf70000,
+0xfe649589, 0x6f0fffff, 0xfffe6095, 0xd2d70fff,
+0x00fffa81, 0x850f0000, 0x00000473, 0x8d100ff2,
+0xfffffe78, 0x8d590ff2, 0xfffffe90, 0x8d110ff2,
+0xfffffe78, 0x8d100ff2, 0xfffffe98, 0xc9590ff2,
+0x8d110ff2, 0xfffffe80, 0x8d100ff2, 0xfffffe90,
+0x8d580ff2, 0xfffffe98, 0x8d110ff2, 0xfffffe88,
+0x8d100ff2, 0xfffffe90, 0x31d1280f, 0x5c0ff2d2,
+0xfffe9895, 0x100ff2ff, 0xfffe789d, 0x590ff2ff,
+0xfffe8895, 0x5c0ff2ff, 0xfffe809d, 0x0001b8ff,
+0x0ff20000, 0xfe889511, 0x0f66ffff, 0x027ada2e,
+0xc0310474, 0xd8f7d231, 0xfe608589, 0xd283ffff,
+0x0282b800, 0xdaf70000, 0xfe649589, 0x6f0fffff,
+0xfffe609d, 0xd3d70fff, 0x00fffa81, 0x850f0000,
+0x000003bb, 0x8d590ff2, 0xfffffea0, 0x8d110ff2,
+0xfffffe78, 0x0ff2d231, 0xfe908d10, 0x01b8ffff,
+0xf2000000, 0xa08d5e0f, 0xf2fffffe, 0x808d110f,
+0x66fffffe, 0x788d2e0f, 0x7afffffe, 0x31047402,
+0xf7d231c0, 0x608589d8, 0x83fffffe, 0x8bb800d2,
+0xf7000002, 0x649589da, 0x0ffffffe, 0xfe60a56f,
+0xd70fffff, 0xfffa81d4, 0x0f000000, 0x00034e85,
+0x7e0ff300, 0xfffff091, 0x100ff2ff, 0xfffea08d,
+0x100ff2ff, 0xfffe90b5, 0xca570fff, 0x570fd231,
+0x590ff2d6, 0xfffe788d, 0x0001b8ff, 0x0f660000,
+0x027aca2e, 0xc0310474, 0xd8f7d231, 0xfe608589,
+0xd283ffff, 0x028eb800, 0xdaf70000, 0xfe649589,
+0x6f0fffff, 0xfffe60ad, 0xd5d70fff, 0x00fffa81,
+0x850f0000, 0x000002e7, 0x8d5a0ff2, 0xfffffe90,
+0xc9530ff3, 0xc95a0ff3, 0x8d130f66, 0xfffffe78,
+0x955a0ff2, 0xfffffe78, 0xd2530ff3, 0xd25a0ff3,
+0xc22c0ff2, 0x0ff2d231, 0xfe908d10, 0x0ff2ffff,
+0x01b8d02a, 0x66000000, 0x7ad12e0f, 0x31047402,
+0xf7d231c0, 0x608589d8, 0x83fffffe, 0x96b800d2,
+0xf7000002, 0x649589da, 0x0ffffffe, 0xfe60b56f,
+0xd70fffff, 0xfffa81d6, 0x0f000000, 0x00026e85,
+0x590ff200, 0x110ff2c9, 0xfffe788d, 0x5a0ff2ff,
+0xfffe788d, 0x520ff3ff, 0x5a0ff3c9, 0x130f66c9,
+0xfffe808d, 0x5a0ff2ff, 0xfffe808d, 0x530ff3ff,
+0x5a0ff3c9, 0x2c0ff2c9, 0xf2d231c1, 0xb8c82a0f,
+0x00000001, 0x8d2e0f66, 0xfffffe90, 0x0474027a,
+0xd231c031, 0x8589d8f7, 0xfffffe60, 0xb800d283,
+0x0000029d, 0x9589daf7, 0xfffffe64, 0x60bd6f0f,
+0x0ffffffe, 0xfa81d7d7, 0x000000ff, 0x01ed850f,
+0x0ff20000, 0xfe908d5a, 0x0ff3ffff, 0x0ff3c953,
+0x0ff2c95a, 0x0ff2c12c, 0xfe80952c, 0xc239ffff,
+0x31c0940f, 0xc0b60fd2, 0x8589d8f7, 0xfffffe60,
+0xb800d283, 0x0000029f, 0x9589daf7, 0xfffffe64,
+0x60856f0f, 0x0ffffffe, 0xfa81d0d7, 0x000000ff,
+0x0199850f, 0x0ff20000, 0xfe908d10, 0x0ff2ffff,
+0x0ff2c959, 0xfe788d11, 0xd231ffff, 0x95100ff2,
+0xfffffe90, 0x000001b8, 0x510ff200, 0xfffe788d,
+0x2e0f66ff, 0x74027aca, 0x31c03104, 0x89d8f7d2,
+0xfffe6085, 0x00d283ff, 0x0002a7b8, 0x89daf700,
+0xfffe6495, 0x8d6f0fff, 0xfffffe60, 0x81d1d70f,
+0x0000fffa, 0x34850f00, 0x0f000001, 0x0ff2c828,
+0xfe808511, 0x0ff2ffff, 0x0ff2ca5e, 0xfe788d11,
+0xd231ffff, 0x000001b8, 0x3a0f6600, 0xfe78850b,
+0xf20bffff, 0x8885110f, 0x66fffffe, 0x80852e0f,
+0x7afffffe, 0x31047402, 0xf7d231c0, 0x608589d8,
+0x83fffffe, 0xafb800d2, 0xf7000002, 0x649589da,
+0x0ffffffe, 0xfe60956f, 0xd70fffff, 0xfffa81d2,
+0x0f000000, 0x0000c685, 0x100ff200, 0xfffea085,
+0x100ff2ff, 0xfffe908d, 0x590ff2ff, 0x590ff2c8,
+0xfffe9885, 0x110ff2ff, 0xfffe788d, 0x110ff2ff,
+0xfffe8085, 0x100ff2ff, 0xfffe7885, 0x5f0ff2ff,
+0xfffe8085, 0x110ff2ff, 0xfffe8885, 0x100ff2ff,
+0xfffe7885, 0x5d0ff2ff, 0xfffe8085, 0x110ff2ff,
+0xfffe8085, 0xf2d231ff, 0x8085100f, 0xf2fffffe,
+0x908d100f, 0xf2fffffe, 0x8885580f, 0xf2fffffe,
+0x988d580f, 0xf2fffffe, 0xa085590f, 0xb8fffffe,
+0x00000001, 0xc12e0f66, 0x0474027a, 0xd231c031,
+0x8589d8f7, 0xfffffe60, 0xf700d283, 0x649589da,
+0xbafffffe, 0x00000348, 0x609d6f0f, 0x0ffffffe,
+0xff3dc3d7, 0xb8000000, 0x00000000, 0xc9c2450f,
+0x240c8bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003114,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b24100,
+0x41e58948, 0x4c564157, 0xff7f9d8d, 0x8d4cffff,
+0x55418f4d, 0x9f458d4c, 0xaf7d8d48, 0x48535441,
+0x4420ec83, 0x488dd289, 0x048841ff, 0x41c22903,
+0x89011488, 0x01e283ca, 0x1901fa83, 0x83c121d2,
+0xcaff02e2, 0x8301f983, 0x884100de, 0x88400014,
+0xff480734, 0xf88348c0, 0x0fc87511, 0x0f807528,
+0xff50b529, 0x280fffff, 0xffff508d, 0x760f66ff,
+0x0260b8d2, 0x280f0000, 0x740f66c1, 0x380f66c6,
+0x830fc217, 0x00000618, 0x8045280f, 0xc1fc0f66,
+0x6085290f, 0x0fffffff, 0xb8804528, 0x00000266,
+0xc0fc0f66, 0x85740f66, 0xffffff60, 0x17380f66,
+0xe9830fc2, 0x0f000005, 0xff608528, 0x0f66ffff,
+0x0f8045f8, 0xff708529, 0x0f66ffff, 0xff708d74,
+0x6bb8ffff, 0x66000002, 0xca17380f, 0x05be830f,
+0x280f0000, 0x280f8065, 0x570fa07d, 0x2d280fdb,
+0x000005bc, 0xc7280f44, 0x0fcc280f, 0x4466c428,
+0x66c7600f, 0x66cc600f, 0x66ff680f, 0x66c4680f,
+0xc8d50f41, 0xc7d50f66, 0x0fcd540f, 0x0f66c554,
+0x280fc867, 0x0f66b045, 0x540fc364, 0x85290fc1,
+0xffffff70, 0xff70858a, 0x4d8affff, 0x44c389b0,
+0xff71bd8a, 0x8a44ffff, 0xffff7295, 0xb58a44ff,
+0xffffff73, 0x4d8ae3d3, 0xbd8a40b1, 0xffffff74,
+0x75ad8a44, 0x40ffffff, 0xff76b58a, 0x9d88ffff,
+0xffffff4c, 0x8ae7d341, 0x9d8ab24d, 0xffffff77,
+0xff78958a, 0x8a44ffff, 0xffff79a5, 0xe2d341ff,
+0x44b34d8a, 0xff7a8d8a, 0x8a44ffff, 0xffff7d9d,
+0x0f4566ff, 0xd341ea6e, 0xb44d8ae6, 0x3a0f4566,
+0xd301ee20, 0xb54d8ae7, 0x6e0f4466, 0xe5d341cf,
+0x66b64d8a, 0x203a0f45, 0xe6d301cd, 0x40b74d8a,
+0xff48b588, 0x8a40ffff, 0xffff7cb5, 0x8ae3d3ff,
+0x9d88b84d, 0xffffff44, 0xff7b9d8a, 0xe2d3ffff,
+0x88b94d8a, 0xffff4095, 0xe4d341ff, 0x41ba4d8a,
+0x4d8ae1d3, 0x0f4566bb, 0xe3d3d96e, 0x66bc4d8a,
+0x203a0f44, 0xe6d301db, 0x66bd4d8a, 0x41f66e0f,
+0x4d8ae3d3, 0x858a44be, 0xffffff7e, 0x9d6e0f66,
+0xffffff4c, 0xff7f958a, 0x4466ffff, 0x48a56e0f,
+0x66ffffff, 0x40856e0f, 0x66ffffff, 0x203a0f44,
+0xffff44a5, 0xd34101ff, 0xbf4d8ae0, 0x3a0f4166,
+0x6601df20, 0x203a0f41, 0x456601c4, 0x66d06e0f,
+0xdd610f41, 0x610f4566, 0x66e2d3cc, 0xc3610f41,
+0x620f4166, 0x0f4166d9, 0x01f3203a, 0x3a0f4466,
+0x6601d220, 0xf2610f41, 0xc6620f66, 0xd86c0f66,
+0x1935280f, 0x0f000004, 0x66b04528, 0x0fc6f80f,
+0x8ab04529, 0x8a44b04d, 0xffff7295, 0xbd8a44ff,
+0xffffff73, 0x74b58a40, 0xd3ffffff, 0xb14d8ae0,
+0x75b58a44, 0x88ffffff, 0xffff4c85, 0x71858aff,
+0x44ffffff, 0xff768d8a, 0x8a44ffff, 0xffff77ad,
+0x8ae0d3ff, 0x8a44b24d, 0xffff79a5, 0x488588ff,
+0x8affffff, 0xffff7885, 0xe2d341ff, 0x44b34d8a,
+0xff7a858a, 0x9d8affff, 0xffffff7b, 0xff7c958a,
+0x4566ffff, 0x41fa6e0f, 0x4d8ae7d3, 0x9d8a44b4,
+0xffffff7d, 0x7ebd8a40, 0x66ffffff, 0x203a0f45,
+0xe6d301ff, 0x66b54d8a, 0xde6e0f44, 0x8ae6d341,
+0x4566b64d, 0xde203a0f, 0xe1d34101, 0x66b74d8a,
+0xf16e0f45, 0x8ae5d341, 0x4566b84d, 0xf5203a0f,
+0x8ae0d301, 0x4566b94d, 0x88de610f, 0xffff4485,
+0xe4d341ff, 0x41ba4d8a, 0x4d8ae0d3, 0x0f4566bb,
+0xe3d3e86e, 0x66bc4d8a, 0x203a0f44, 0xe2d301eb,
+0x66bd4d8a, 0xd26e0f44, 0x8ae3d341, 0x4566be4d,
+0xd3203a0f, 0x8ae7d301, 0x858abf4d, 0xffffff7f,
+0x856e0f66, 0xffffff4c, 0x6e0f4466, 0xffff448d,
+0x0f4466ff, 0x0f66e76e, 0x4885203a, 0x01ffffff,
+0x4566e0d3, 0xcc203a0f, 0x0f446601, 0x01e0203a,
+0x610f4166, 0x0f4566c7, 0x2cb8cd61, 0x66000003,
+0xd4610f45, 0x620f4166, 0x0f4566c3, 0x4166ca62,
+0x66c16c0f, 0x66c0fc0f, 0x66c3740f, 0xc217380f,
+0x027a830f, 0x280f0000, 0x290f905d, 0xffff508d,
+0xc3280fff, 0xcb280f44, 0xc3600f66, 0x680f4466,
+0x0f4166cb, 0x4466c0d5, 0x0fcfd50f, 0x0f44c554,
+0x4166cd54, 0x0fc1670f, 0xff608529, 0x280fffff,
+0xffff6085, 0x380f66ff, 0x0f66c13c, 0x608d3838,
+0x0fffffff, 0xff608d29, 0x0f66ffff, 0xff6085fc,
+0x48b8ffff, 0x0f000003, 0x0f66c828, 0x0f66c860,
+0x4166c068, 0x66c8d50f, 0x0fc7d50f, 0x540fcd54,
+0x670f66c5, 0xc4280fc8, 0xc3fc0f66, 0xc1740f66,
+0x17380f66, 0xe5830fc2, 0x66000001, 0x851c380f,
+0xffffff50, 0xe0740f66, 0x00034fb8, 0x380f6600,
+0x830fe217, 0x000001c8, 0xa045280f, 0xb8ce280f,
+0x00000354, 0x08380f66, 0x740f66c8, 0x380f66c8,
+0x830fca17, 0x000001a8, 0x804d280f, 0xb8e3280f,
+0x00000359, 0xe6f80f66, 0x00380f66, 0x740f66cc,
+0x380f66cb, 0x830fca17, 0x00000184, 0x66cb280f,
+0x804d600f, 0x66e3280f, 0x8065680f, 0xccf80f66,
+0xc0280f44, 0xb8f8280f, 0x00000370, 0x66e1280f,
+0xc0600f44, 0xf8680f66, 0xe1600f66, 0xc9680f66,
+0xd50f4166, 0xd50f66e0, 0xe5540fcf, 0x66cd540f,
+0x66e1670f, 0x6525740f, 0x66000001, 0xe217380f,
+0x012a830f, 0x280f0000, 0x280f804d, 0x280f44e1,
+0x600f66c9, 0x0f4466e1, 0x4166c968, 0x66e0d50f,
+0xf9d50f41, 0x0fe5540f, 0x0f66ef54, 0x570fe567,
+0x640f66ed, 0xa5290fe8, 0xffffff50, 0xe5600f66,
+0x50bd280f, 0x66ffffff, 0xff20380f, 0xe7740f66,
+0x00037ab8, 0x380f6600, 0x830fe217, 0x000000d0,
+0xed600f66, 0x66e5280f, 0x0ffd600f, 0xff50ad28,
+0x0f66ffff, 0x66ed2138, 0xb8fd740f, 0x00000382,
+0x17380f66, 0xa5830ffa, 0x66000000, 0x66e4600f,
+0x0fec600f, 0xff60ad29, 0x280fffff, 0xffff50bd,
+0x380f66ff, 0x280fe722, 0xa5290ffc, 0xffffff70,
+0xfd740f66, 0x00038bb8, 0x380f6600, 0x7073fa17,
+0x280fc031, 0x7501a8e3, 0xe1280f03, 0xc065290f,
+0xc005548a, 0x60059488, 0x48ffffff, 0x8348c0ff,
+0xde7510f8, 0xb8e4570f, 0x000003c4, 0xc4640f66,
+0x10380f66, 0x740f66d9, 0xffff609d, 0x380f66ff,
+0x2c73da17, 0x31c1280f, 0x3a0f66c0, 0x0f01c10f,
+0x005a0d54, 0x0f660000, 0x0f66cefc, 0x0f66c874,
+0x0fca1738, 0xf883c092, 0x25c01901, 0x000003e4,
+0x20c48348, 0x415c415b, 0x415e415d, 0x00c35d5f,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0003400,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b24100,
+0x41e58948, 0x4c564157, 0xff7f9d8d, 0x8d4cffff,
+0x55418f4d, 0x9f458d4c, 0xaf7d8d48, 0x48535441,
+0x4420ec83, 0x508dd689, 0x048841ff, 0x41c62903,
+0x89013488, 0x83c221d6, 0xceff01e6, 0x8301fa83,
+0x884100d9, 0x0c880034, 0xc0ff4807, 0x11f88348,
+0x280fd175, 0x290f807d, 0xffff50bd, 0x95280fff,
+0xffffff50, 0xc9760f66, 0x000260b8, 0xc2280f00,
+0xc7740f66, 0x17380f66, 0x34830fc1, 0x0f000005,
+0x66804528, 0x0fc2fc0f, 0xff608529, 0x280fffff,
+0x66b88045, 0x66000002, 0x66c0fc0f, 0x6085740f,
+0x66ffffff, 0xc117380f, 0x0505830f, 0x280f0000,
+0xffff6085, 0xf80f66ff, 0x290f8045, 0xffff7085,
+0xda280fff, 0x00026bb8, 0x740f6600, 0xffff709d,
+0x380f66ff, 0x830fd917, 0x000004d7, 0x9055560f,
+0x5095290f, 0x0fffffff, 0x0f904554, 0xff709528,
+0x570fffff, 0x550f9055, 0xffff5085, 0x760f66ff,
+0x0277b8e4, 0x0f660000, 0x0f66c274, 0x0fc11738,
+0x00049e83, 0xd2570f00, 0x66c2280f, 0xb045740f,
+0xc2740f66, 0x8045540f, 0x7085290f, 0x8affffff,
+0xffff7085, 0xb04d8aff, 0x8a44c389, 0xffff71bd,
+0x958a44ff, 0xffffff72, 0x73b58a44, 0xd3ffffff,
+0xb14d8ae3, 0x74bd8a40, 0x44ffffff, 0xff75ad8a,
+0x9d88ffff, 0xffffff4c, 0x8ae7d341, 0x9d8ab24d,
+0xffffff76, 0xff78958a, 0x8a44ffff, 0xffff79a5,
+0xe2d341ff, 0x44b34d8a, 0xff7a8d8a, 0x8a40ffff,
+0xffff7cb5, 0x9d8a44ff, 0xffffff7d, 0x6e0f4566,
+0xe6d341ca, 0x66b44d8a, 0x203a0f45, 0xe7d301ce,
+0x66b54d8a, 0x41ef6e0f, 0x4d8ae5d3, 0x0f4166b6,
+0x01ed203a, 0x4d8ae3d3, 0x489d88b7, 0x8affffff,
+0xffff779d, 0x8ae3d3ff, 0x9d88b84d, 0xffffff44,
+0xff7b9d8a, 0xe2d3ffff, 0x88b94d8a, 0xffff4095,
+0xe4d341ff, 0x41ba4d8a, 0x4d8ae1d3, 0x0f4166bb,
+0xe3d3f96e, 0x66bc4d8a, 0xfb203a0f, 0x8ae6d301,
+0x0f66bd4d, 0xd341de6e, 0xbe4d8ae3, 0x7e858a44,
+0x66ffffff, 0x4c956e0f, 0x8affffff, 0xffff7f95,
+0x0f4466ff, 0xff48856e, 0x0f66ffff, 0xff40856e,
+0x4466ffff, 0x85203a0f, 0xffffff44, 0xe0d34101,
+0x66bf4d8a, 0x203a0f41, 0x416601d7, 0xc4203a0f,
+0x0f416601, 0x4166f06e, 0xdb203a0f, 0x0f416601,
+0xe2d3d161, 0x610f4166, 0x610f66e8, 0x3a0f66c7,
+0x6601f220, 0x66d5620f, 0x66de610f, 0x66c3620f,
+0x0fd06c0f, 0x66b04528, 0x0fc4fc0f, 0x8ab04529,
+0x8a44b04d, 0xffff7295, 0xbd8a44ff, 0xffffff73,
+0x74b58a40, 0xd3ffffff, 0xb14d8ae0, 0x75b58a44,
+0x88ffffff, 0xffff4c85, 0x71858aff, 0x44ffffff,
+0xff768d8a, 0x8a44ffff, 0xffff77ad, 0x8ae0d3ff,
+0x8a44b24d, 0xffff79a5, 0x488588ff, 0x8affffff,
+0xffff7885, 0xe2d341ff, 0x44b34d8a, 0xff7a858a,
+0x9d8affff, 0xffffff7b, 0xff7c958a, 0x4566ffff,
+0x41d26e0f, 0x4d8ae7d3, 0x9d8a44b4, 0xffffff7d,
+0x7ebd8a40, 0x66ffffff, 0x203a0f45, 0xe6d301d7,
+0x66b54d8a, 0xc66e0f44, 0x8ae6d341, 0x4566b64d,
+0xc6203a0f, 0xe1d34101, 0x66b74d8a, 0xc96e0f45,
+0x8ae5d341, 0x4566b84d, 0xcd203a0f, 0x8ae0d301,
+0x4566b94d, 0x88c1610f, 0xffff4485, 0xe4d341ff,
+0x41ba4d8a, 0x4d8ae0d3, 0x0f4166bb, 0xe3d3f86e,
+0x66bc4d8a, 0xfb203a0f, 0x8ae2d301, 0x0f66bd4d,
+0xd341ea6e, 0xbe4d8ae3, 0x3a0f4166, 0xd301eb20,
+0xbf4d8ae7, 0xff7f858a, 0x0f66ffff, 0xff4c856e,
+0x0f66ffff, 0xff449d6e, 0x0f66ffff, 0x0f66f76e,
+0x4885203a, 0x01ffffff, 0x4166e0d3, 0xdc203a0f,
+0x3a0f6601, 0x6601f020, 0xc2610f41, 0xdf610f66,
+0x00032cb8, 0x610f6600, 0x0f4166ee, 0x0f66c062,
+0x0f66dd62, 0x0f66c36c, 0x0f66c0fc, 0x0f66c274,
+0x0fc11738, 0x0001aa83, 0x55280f00, 0x45280f80,
+0xda0f6690, 0x5d280fc2, 0xde0f6690, 0xfc0f66da,
+0x0f669055, 0x3fb8c3fc, 0x66000003, 0x66c2740f,
+0xc117380f, 0x0179830f, 0x280f0000, 0x00018f2d,
+0x55280f00, 0x0354b8a0, 0x280f0000, 0x380f66c5,
+0x0f66c208, 0x0f66c274, 0x0fc11738, 0x00015283,
+0x5d280f00, 0x45280f90, 0x0359b880, 0x280f0000,
+0xfc0f66f3, 0x380f66f4, 0x0f66c600, 0x0f66c374,
+0x0fc11738, 0x00012a83, 0xf3280f00, 0x75600f66,
+0xc3280f80, 0x45680f66, 0xfc0f6680, 0x0370b8c4,
+0x0f660000, 0x570fc6f8, 0xd4570fc2, 0xc2f80f66,
+0x05740f66, 0x00000128, 0x17380f66, 0xf0830fc1,
+0x66000000, 0x6530380f, 0x380f6680, 0x290fd430,
+0xffff60a5, 0x95290fff, 0xffffff70, 0x807d280f,
+0x30380f66, 0x740f66c7, 0x039ab8c4, 0x0f660000,
+0x0fc11738, 0x0000ba83, 0x7d280f00, 0x380f6680,
+0x0f66c731, 0xa1b8c274, 0x66000003, 0xc117380f,
+0x009d830f, 0x280f0000, 0x0f668065, 0x0fc43238,
+0x290fe028, 0xffff5085, 0x380f66ff, 0xa8b8d230,
+0x66000003, 0x66e2740f, 0xe117380f, 0x280f7573,
+0xc0318055, 0xa8c3280f, 0x0f037501, 0x290fc228,
+0x548ac045, 0x9488c005, 0xffff6005, 0xc0ff48ff,
+0x10f88348, 0x570fde75, 0x03c4b8c0, 0x0f660000,
+0x66a04564, 0xda10380f, 0x9d740f66, 0xffffff60,
+0x17380f66, 0x0f2c73d9, 0xc031c228, 0x0f3a0f66,
+0x540f01c2, 0x00005715, 0xfc0f6600, 0x740f66d5,
+0x380f66d0, 0x920fd117, 0x01f883c0, 0xe425c019,
+0x48000003, 0x5b20c483, 0x5d415c41, 0x5f415e41,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0003020,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d18, 0x66cf8944, 0x8e454489, 0xc729f289,
+0x6601e283, 0x9e457c89, 0x1901fa83, 0x02e283d2,
+0xc685caff, 0xc6940f40, 0x45548966, 0xb60f40ae,
+0x66f129f6, 0xbe454c89, 0x48c0ff48, 0x7509f883,
+0x7d280fc0, 0xbd290f90, 0xffffff60, 0x6085280f,
+0x66ffffff, 0xb8c9760f, 0x00000260, 0x66d0280f,
+0x66d7750f, 0xd117380f, 0x058c830f, 0x280f0000,
+0x0f669055, 0x290fd0fd, 0xffff7095, 0x55280fff,
+0x0266b890, 0x0f660000, 0x6601f271, 0x7095750f,
+0x66ffffff, 0xd117380f, 0x055c830f, 0x280f0000,
+0xffff7095, 0xf90f66ff, 0x290f9055, 0x280f8055,
+0x026bb8d0, 0x0f660000, 0x66805575, 0xd117380f,
+0x0534830f, 0x280f0000, 0x0f66a055, 0x669045d5,
+0x0fd2d50f, 0x280fda28, 0x280f9055, 0x0f66a06d,
+0x280feafd, 0xf90f66e2, 0x0f66a065, 0x82b8c3f9,
+0x66000002, 0x66e5d50f, 0x66c4750f, 0xc117380f,
+0x04f4830f, 0x280f0000, 0x0f66a045, 0x0f66c2d5,
+0x04fa0575, 0xd3b80000, 0x66000002, 0xc117380f,
+0x04d4830f, 0x280f0000, 0xe50f66da, 0x280fb05d,
+0x570fb065, 0x02dab8c0, 0x0f660000, 0x0f66c465,
+0x0f66c375, 0x0fc11738, 0x0004ad83, 0xc4280f00,
+0xc2d50f66, 0x8045290f, 0x805d280f, 0xf3710f66,
+0x9d290f03, 0xffffff60, 0x8045280f, 0xf0710f66,
+0x85290f02, 0xffffff70, 0xc0fd0f66, 0x0002f8b8,
+0x750f6600, 0x380f66c3, 0x830fc117, 0x0000046a,
+0x6085280f, 0x66ffffff, 0x02e0710f, 0xc0fd0f66,
+0x0002fdb8, 0x750f6600, 0xffff7085, 0x380f66ff,
+0x830fc117, 0x00000442, 0xff5c85c7, 0x0003ffff,
+0x280f0000, 0xd50f66c2, 0x856348c4, 0xffffff5c,
+0x66d8280f, 0xf06e0f48, 0xdef10f66, 0xff5c85c7,
+0x0002ffff, 0x63480000, 0xffff5c85, 0x0f4866ff,
+0x0f66f86e, 0x290fc7f1, 0xffff7085, 0xfd0f66ff,
+0x0310b8c0, 0x0f660000, 0x0f66c375, 0x0fc11738,
+0x0003e583, 0x85634800, 0xffffff5c, 0x6e0f4866,
+0xe10f66f0, 0xc3280fde, 0xc3fd0f66, 0x000314b8,
+0x750f6600, 0xffff7085, 0x380f66ff, 0x830fc117,
+0x000003b6, 0x0fda280f, 0x0fc04528, 0x0f66f657,
+0x0f66dcd5, 0x540fc665, 0x45290fc3, 0x80458b80,
+0x89c04d8b, 0x8b4466c6, 0x7d8b826d, 0x8b446684,
+0xe6d38665, 0xc24d8b66, 0x4188558b, 0x4466fa89,
+0x448a5d8b, 0x668c4d8b, 0x41fe6e0f, 0x4d8be5d3,
+0xd08941c4, 0x758b4466, 0xdb89448e, 0xc40f4166,
+0xd34101fd, 0x4d8b66e2, 0x0f4166c6, 0xd341ea6e,
+0xc84d8be4, 0xc40f4166, 0xd34101ec, 0x4d8b66e0,
+0x620f66ca, 0x0f4166fd, 0xe3d3c06e, 0x66cc4d8b,
+0x01c3c40f, 0x66e1d341, 0x66ce4d8b, 0xd96e0f41,
+0x66e6d341, 0xdec40f41, 0x620f6601, 0x6c0f66c3,
+0x2d280ff8, 0x00000328, 0xc045280f, 0xc5f90f66,
+0xc045290f, 0x66c04d8b, 0x82458b44, 0x4d8b4466,
+0x8c758b86, 0x8b66e0d3, 0x8b66c24d, 0x0f668e5d,
+0x2cb8c06e, 0x41000003, 0x4d8be0d3, 0x0f4166c4,
+0xd301c0c4, 0x4d8b66e7, 0x0f4466c6, 0xd341cf6e,
+0xc84d8be1, 0xc40f4566, 0xe2d301c9, 0xca4d8b66,
+0x620f4166, 0x6e0f66c1, 0xe3d341da, 0x66cc4d8b,
+0xdbc40f41, 0x66e6d301, 0x66ce4d8b, 0xc66e0f44,
+0x4466e3d3, 0x01c3c40f, 0x620f4166, 0x6c0f66d8,
+0xfd0f66c3, 0x750f66c0, 0x380f66c7, 0x830fc117,
+0x00000266, 0xa045280f, 0x66dc280f, 0x66dad50f,
+0x0fc4d50f, 0xff708529, 0x280fffff, 0xffff7085,
+0xee0f66ff, 0xea0f66c3, 0xffff709d, 0x9d290fff,
+0xffffff70, 0x85fd0f66, 0xffffff70, 0xa05d280f,
+0x000348b8, 0xd50f6600, 0xfd0f66c4, 0x750f66da,
+0x380f66c3, 0x830fc117, 0x0000020e, 0xe2d50f66,
+0x60a5290f, 0x66ffffff, 0x851d380f, 0xffffff60,
+0xd0750f66, 0x00034fb8, 0x380f6600, 0x830fd117,
+0x000001e6, 0xb045280f, 0xb8d5280f, 0x00000354,
+0x09380f66, 0x750f66d0, 0x380f66d0, 0x830fd117,
+0x000001c6, 0x5d700ff2, 0x280f1b90, 0x59b8a055,
+0xf3000003, 0x1bdb700f, 0xdb700f66, 0x750f664e,
+0x380f66da, 0x830fd917, 0x0000019e, 0x66da280f,
+0x905d610f, 0x66e2280f, 0x9065690f, 0xdcf90f66,
+0x000370b8, 0xd50f6600, 0x750f66d8, 0x0001af1d,
+0x380f6600, 0x830fd917, 0x0000016e, 0x905d280f,
+0xf0650f66, 0xd8d50f66, 0x0fe3280f, 0xff609d29,
+0x0f66ffff, 0x280fe661, 0xffff60bd, 0x380f66ff,
+0x0f66df23, 0x7ab8e375, 0x66000003, 0xe117380f,
+0x0134830f, 0x0f660000, 0x0f66f661, 0x290fde61,
+0xffff709d, 0xb5280fff, 0xffffff60, 0x24380f66,
+0x65290fe6, 0x750f6680, 0x0382b8dc, 0x0f660000,
+0x0fd91738, 0x00010183, 0x5d280f00, 0x0fc03190,
+0x01a8e228, 0x280f0375, 0x65290fe3, 0x548b66d0,
+0x8966d045, 0xff704594, 0xff48ffff, 0xf88348c0,
+0x0fdc7508, 0xc4b8e457, 0x66000003, 0x66c4650f,
+0xd310380f, 0x709d280f, 0x66ffffff, 0x66d3750f,
+0xd117380f, 0x00b0830f, 0x280f0000, 0xd4b89045,
+0x0f000003, 0x0f66d028, 0xa0550e3a, 0x750f66aa,
+0x380f66da, 0x830fd917, 0x0000008e, 0xcd1d280f,
+0x0f000000, 0xe4b8d028, 0x66000003, 0xd00f3a0f,
+0xd8540f02, 0xddfd0f66, 0xd3750f66, 0x17380f66,
+0x0f6773d1, 0xff608529, 0x03b8ffff, 0x0f000000,
+0x280fd428, 0x380f66c2, 0xff608501, 0x290fffff,
+0xffff6085, 0x75c8ffff, 0xc50f66e9, 0xf8b807d0,
+0x66000003, 0x7524fa83, 0x45280f31, 0x380f6690,
+0x31a04505, 0x380f66c0, 0x0f66c201, 0x66c20138,
+0xc201380f, 0xc2750f66, 0x17380f66, 0xc0920fc1,
+0x1901f883, 0x040125c0, 0x83480000, 0x415b18c4,
+0x415d415c, 0x00c35d5e, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003160,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d18, 0x66cf8944, 0x8e454489, 0xc729f189,
+0x6601e183, 0x9e457c89, 0xc685c9ff, 0xc6940f40,
+0x454c8966, 0xb60f40ae, 0x66f229f6, 0xbe455489,
+0x48c0ff48, 0x7509f883, 0x7d280fc8, 0xbd290f90,
+0xffffff60, 0x6095280f, 0x66ffffff, 0xb8c9760f,
+0x00000260, 0x66c2280f, 0x66c7750f, 0xc117380f,
+0x050f830f, 0x280f0000, 0x0f669045, 0x290fc2fd,
+0xffff7085, 0x45280fff, 0x0266b890, 0x0f660000,
+0x6601f071, 0x7085750f, 0x66ffffff, 0xc117380f,
+0x04df830f, 0x280f0000, 0xffff7085, 0xf90f66ff,
+0x290f9045, 0x280f8045, 0x026bb8da, 0x0f660000,
+0x66805d75, 0xd917380f, 0x04b7830f, 0x560f0000,
+0x290fa055, 0xffff6095, 0x45540fff, 0x55280fa0,
+0x55570f80, 0x85550fa0, 0xffffff60, 0xe4760f66,
+0x000277b8, 0x750f6600, 0x380f66c2, 0x830fc117,
+0x00000481, 0x9055280f, 0xa045280f, 0xc2d50f66,
+0x05750f66, 0x00000488, 0x0002d3b8, 0x380f6600,
+0x830fc117, 0x0000045d, 0x66ea280f, 0xb06de40f,
+0xb05d280f, 0xb8c2280f, 0x000002dc, 0x66c3540f,
+0x66c3fd0f, 0x66c5750f, 0xc117380f, 0x0433830f,
+0x290f0000, 0x280f8055, 0x0f66805d, 0x0f03f371,
+0xff609d29, 0x280fffff, 0x0f668045, 0x0f02f071,
+0xff708529, 0x0f66ffff, 0xf8b8c0fd, 0x66000002,
+0x66c3750f, 0xc117380f, 0x03f7830f, 0x280f0000,
+0xffff6085, 0x710f66ff, 0x0f6602d0, 0xfdb8c0fd,
+0x66000002, 0x7085750f, 0x66ffffff, 0xc117380f,
+0x03cf830f, 0x85c70000, 0xffffff5c, 0x00000003,
+0x9d6e0f66, 0xffffff5c, 0x66c2280f, 0xc7c3f10f,
+0xffff5c85, 0x000002ff, 0x6e0f6600, 0xffff5cad,
+0xda280fff, 0xddf10f66, 0x709d290f, 0x66ffffff,
+0xb8dbfd0f, 0x00000310, 0xd8750f66, 0x17380f66,
+0x7e830fd9, 0x66000003, 0x5c9d6e0f, 0x66ffffff,
+0x66c3d10f, 0xb8c0fd0f, 0x00000314, 0x85750f66,
+0xffffff70, 0x17380f66, 0x56830fc1, 0x0f000003,
+0x280fdb57, 0x750f66c3, 0x0f66c045, 0x540fc375,
+0x45290fc2, 0x80458b80, 0x89c04d8b, 0x8b4466c6,
+0x7d8b826d, 0x8b446684, 0xe6d38665, 0xc24d8b66,
+0x4188558b, 0x4466fa89, 0x448a5d8b, 0x668c4d8b,
+0x41ee6e0f, 0x4d8be5d3, 0xd08941c4, 0x758b4466,
+0xdb89448e, 0xc40f4166, 0xd34101ed, 0x4d8b66e2,
+0x0f4166c6, 0xd341f26e, 0xc84d8be4, 0xc40f4166,
+0xd34101f4, 0x4d8b66e0, 0x620f66ca, 0x0f4166ee,
+0xe3d3c06e, 0x66cc4d8b, 0x01c3c40f, 0x66e1d341,
+0x66ce4d8b, 0xd96e0f41, 0x66e6d341, 0xdec40f41,
+0x620f6601, 0x6c0f66c3, 0x45280fe8, 0xfd0f66c0,
+0x45290fc4, 0xc04d8bc0, 0x458b4466, 0x8b446682,
+0x758b864d, 0x66e0d38c, 0x66c24d8b, 0x668e5d8b,
+0xb8c06e0f, 0x0000032c, 0x8be0d341, 0x4166c44d,
+0x01c0c40f, 0x8b66e7d3, 0x0f66c64d, 0xd341ff6e,
+0xc84d8be1, 0xc40f4166, 0xe2d301f9, 0xca4d8b66,
+0xc7620f66, 0xda6e0f66, 0x8be3d341, 0x4166cc4d,
+0x01dbc40f, 0x8b66e6d3, 0x0f66ce4d, 0xe3d3f66e,
+0xf3c40f66, 0x620f6601, 0x6c0f66de, 0xfd0f66c3,
+0x750f66c0, 0x380f66c5, 0x830fc117, 0x00000215,
+0xa045280f, 0x3a380f66, 0x5d280fc2, 0x380f66a0,
+0x0f66da3e, 0x66a055fd, 0xb8c3fd0f, 0x0000033f,
+0xc2750f66, 0x17380f66, 0xe6830fc1, 0x0f000001,
+0x020a1d28, 0x280f0000, 0x54b8b06d, 0x0f000003,
+0x0f66c328, 0x66c50938, 0x66c5750f, 0xc117380f,
+0x01bf830f, 0x0ff20000, 0x1b904570, 0xa055280f,
+0x000359b8, 0x700ff300, 0x0f661bc0, 0x664ec070,
+0x66c2750f, 0xc117380f, 0x0197830f, 0x280f0000,
+0x610f66f2, 0x280f9075, 0x690f66c2, 0x0f669045,
+0x70b8c4fd, 0x66000003, 0x0fc6f90f, 0x570fc557,
+0xf90f66ec, 0x750f66c5, 0x0001a305, 0x380f6600,
+0x830fc117, 0x0000015d, 0x33380f66, 0x0f669065,
+0x0fc43338, 0xff70a529, 0x290fffff, 0x280f8045,
+0x0f66907d, 0x66c73338, 0xb8c4750f, 0x0000039a,
+0x17380f66, 0x2a830fc1, 0x0f000001, 0x66907d28,
+0xc734380f, 0x0fe0280f, 0xff608529, 0x0f66ffff,
+0xb8806575, 0x000003a1, 0x17380f66, 0x02830fe1,
+0x0f000001, 0x31906528, 0xc2280fc0, 0x037501a8,
+0x0fc4280f, 0x66d04529, 0xd045548b, 0x45948966,
+0xffffff70, 0x48c0ff48, 0x7508f883, 0xc0570fdc,
+0x0003c4b8, 0x640f6600, 0x0f66b045, 0x0fd41038,
+0xff70a528, 0x0f66ffff, 0x0f66d475, 0x0fd11738,
+0x0000b083, 0x45280f00, 0x03d4b890, 0x280f0000,
+0x3a0f66d0, 0xaaa0550e, 0xe2750f66, 0x17380f66,
+0x8e830fe1, 0x0f000000, 0x00d21528, 0xe4b80000,
+0x0f000003, 0x0f66d054, 0x280fdafd, 0x3a0f66d0,
+0x6602d00f, 0x66d3750f, 0xd117380f, 0x290f6773,
+0xffff6085, 0x0003b8ff, 0x570f0000, 0xc2280fd2,
+0x01380f66, 0xffff6085, 0x85290fff, 0xffffff60,
+0xe975c8ff, 0xd0c50f66, 0x03f8b807, 0x83660000,
+0x317524fa, 0x9045280f, 0x05380f66, 0xc031a045,
+0x01380f66, 0x380f66c2, 0x0f66c201, 0x66c20138,
+0x66c2750f, 0xc117380f, 0x83c0920f, 0xc01901f8,
+0x00040125, 0xc4834800, 0x5c415b18, 0x5e415d41,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002760,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d08ec, 0xc88945ff,
+0xbc854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83cc, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40dc, 0x89f929ff, 0x48ec854c,
+0x8348c0ff, 0xc27505f8, 0xc07d280f, 0x907d290f,
+0x9045280f, 0xc9760f66, 0x000260b8, 0xd0280f00,
+0xd7760f66, 0x17380f66, 0x7e830fd1, 0x0f000004,
+0x66c05528, 0x0fd0fe0f, 0x0fa05529, 0xb8c05528,
+0x00000266, 0xf2720f66, 0x760f6601, 0x0f66a055,
+0x0fd11738, 0x00045483, 0x55280f00, 0xfa0f66a0,
+0x290fc055, 0x280fb055, 0x026bb8d0, 0x0f660000,
+0x66b05576, 0xd117380f, 0x042f830f, 0x280f0000,
+0x0f66d055, 0xc0454038, 0x66da280f, 0xda40380f,
+0xc055280f, 0xd06d280f, 0xeafe0f66, 0x66e2280f,
+0xd065fa0f, 0xc3fa0f66, 0x000282b8, 0x380f6600,
+0x0f66e540, 0x0f66c476, 0x0fc11738, 0x0003ec83,
+0x45280f00, 0x380f66d0, 0x0f66c240, 0x03de0576,
+0xd3b80000, 0x66000002, 0xc117380f, 0x03cb830f,
+0x280f0000, 0x570fe045, 0x7e0f66c2, 0x45290fc0,
+0x380f6690, 0x48d04528, 0x48d05563, 0xaf0f4898,
+0x556348c2, 0x458948d8, 0x456348b0, 0xaf0f4898,
+0x458948c2, 0x02ecb8b8, 0x0f660000, 0x66b04576,
+0xc117380f, 0x0383830f, 0x280f0000, 0x0f66e045,
+0x0fc24038, 0x0fb04529, 0x66b06528, 0x03f4720f,
+0x9065290f, 0xb05d280f, 0xf3720f66, 0x5d290f02,
+0xfe0f66a0, 0x02f8b8db, 0x0f660000, 0x0f66dc76,
+0x0fd91738, 0x00034483, 0x5d280f00, 0x720f6690,
+0x0f6602e3, 0xfdb8dbfe, 0x66000002, 0xa05d760f,
+0x17380f66, 0x22830fd9, 0xc7000003, 0x00038c45,
+0x63480000, 0x280f8c45, 0x0f4866d8, 0x0f66f86e,
+0x45c7dff2, 0x0000028c, 0x45634800, 0x0f48668c,
+0x0f66e86e, 0x290fc5f2, 0x0f66a045, 0x10b8c0fe,
+0x66000003, 0x66c3760f, 0xc117380f, 0x02db830f,
+0x63480000, 0x48668c45, 0x66f86e0f, 0x0fdfe20f,
+0x0f66c328, 0x14b8c3fe, 0x66000003, 0xa045760f,
+0x17380f66, 0xb2830fc1, 0x0f000002, 0x0fe05d28,
+0x0ff04528, 0x0f66ed57, 0x66da4038, 0x0fc5660f,
+0x0f66c354, 0x290fc07e, 0x4d8bb045, 0x8bc689f0,
+0x7d8bb855, 0x8be6d3bc, 0x8941f44d, 0x6e0f66d0,
+0xb4758bde, 0x41fa8941, 0xd341f189, 0xf84d8be1,
+0x3a0f4166, 0x4101d922, 0x4d8be0d3, 0x0f4166fc,
+0xd341c06e, 0x0f4166e2, 0x01c2223a, 0xd86c0f66,
+0x5925280f, 0x0f000002, 0x66f04528, 0x0fc4fa0f,
+0x8bf04529, 0xe0d3f04d, 0x66f44d8b, 0xb8c06e0f,
+0x0000032c, 0x4d8be6d3, 0x3a0f66f8, 0xd301c622,
+0xfc4d8be2, 0xf26e0f66, 0x0f66e7d3, 0x01f7223a,
+0xc66c0f66, 0xc0fe0f66, 0xc3760f66, 0x17380f66,
+0xf6830fc1, 0x0f000001, 0x0fe05d28, 0x66d04528,
+0xc340380f, 0x66f3280f, 0xf240380f, 0xa045290f,
+0xa045280f, 0x3d380f66, 0x380f66c6, 0x0fa07539,
+0x66a07529, 0xa045fe0f, 0xd075280f, 0x000348b8,
+0x380f6600, 0x0f66c340, 0x0f66f2fe, 0x0f66c676,
+0x0fc11738, 0x0001a483, 0x380f6600, 0x290fda40,
+0x0f66905d, 0x90451e38, 0xd0760f66, 0x00034fb8,
+0x380f6600, 0x830fd117, 0x00000181, 0xe045280f,
+0xb8d4280f, 0x00000354, 0x0a380f66, 0x760f66d0,
+0x380f66d0, 0x830fd117, 0x00000161, 0xd055280f,
+0x5d700f66, 0x59b81bc0, 0x66000003, 0x66da760f,
+0xd917380f, 0x0143830f, 0x280f0000, 0x620f66da,
+0x280fc05d, 0x6a0f66f2, 0x0f66c075, 0x70b8defa,
+0x66000003, 0xd840380f, 0x1d760f66, 0x00000140,
+0x17380f66, 0x12830fd9, 0x0f000001, 0x0fc05d28,
+0x0f66fd28, 0x0f66f866, 0x0fd84038, 0x290ff328,
+0x0f66905d, 0x280ff762, 0x0f66907d, 0x66df2538,
+0xb8de760f, 0x0000037a, 0x17380f66, 0xda830fd9,
+0x66000000, 0x0fc5660f, 0x66c05d28, 0x55163a0f,
+0x0f6601a4, 0xac55163a, 0x03c4b803, 0x0f660000,
+0x66a05d7e, 0x5d163a0f, 0x0f6602a8, 0x0fd31038,
+0x66a05d28, 0x66d3760f, 0xd117380f, 0x009b830f,
+0x280f0000, 0xd4b8c045, 0x0f000003, 0x0f66d028,
+0xd0550e3a, 0x760f66cc, 0x380f66da, 0x7d73d917,
+0xa91d280f, 0x0f000000, 0xe4b8d028, 0x66000003,
+0xd00f3a0f, 0xd8540f04, 0xdcfe0f66, 0xd3760f66,
+0x17380f66, 0x0f5673d1, 0x0f904529, 0x0f66c528,
+0x90450238, 0x9045290f, 0x66c5280f, 0x4502380f,
+0x03f8b890, 0x0f660000, 0x03c2163a, 0x750afa83,
+0x45280f2c, 0x380f66c0, 0x31d04506, 0x380f66c0,
+0x0f66c502, 0x66c50238, 0x66c5760f, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00040125, 0x00c3c900,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002500,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0x0fcc7504, 0x0fc07d28,
+0x0f907d29, 0x66905528, 0xb8c9760f, 0x00000260,
+0x66c2280f, 0x66c7760f, 0xc117380f, 0x0401830f,
+0x280f0000, 0x0f66c045, 0x290fc2fe, 0x280fa045,
+0x66b8c045, 0x66000002, 0x01f0720f, 0x45760f66,
+0x380f66a0, 0x830fc117, 0x000003d7, 0xa045280f,
+0x45fa0f66, 0x45290fc0, 0xda280fb0, 0x00026bb8,
+0x760f6600, 0x0f66b05d, 0x0fd91738, 0x0003b283,
+0x55560f00, 0x55290fd0, 0x45540f90, 0x55280fd0,
+0x55570fb0, 0x45550fd0, 0x760f6690, 0x0277b8e4,
+0x0f660000, 0x0f66c276, 0x0fc11738, 0x00038283,
+0x5d280f00, 0x45280fc0, 0x380f66d0, 0x0f66c340,
+0x037a0576, 0xd3b80000, 0x66000002, 0xc117380f,
+0x035d830f, 0x280f0000, 0x570fe045, 0x7e0f66c3,
+0x45290fc0, 0xf40f6690, 0x558bd045, 0xaf0f48d0,
+0xd8558bc2, 0xb0458948, 0x4898458b, 0x48c2af0f,
+0xb8b84589, 0x000002ec, 0x45760f66, 0x380f66b0,
+0x830fc117, 0x0000031b, 0xb05d290f, 0xb055280f,
+0xf2720f66, 0x55290f03, 0x45280f90, 0x720f66b0,
+0x290f02f0, 0x0f66a045, 0xf8b8c0fe, 0x66000002,
+0x66c2760f, 0xc117380f, 0x02e5830f, 0x280f0000,
+0x0f669045, 0x6602d072, 0xb8c0fe0f, 0x000002fd,
+0x45760f66, 0x380f66a0, 0x830fc117, 0x000002c3,
+0x038c45c7, 0x66000000, 0x8c556e0f, 0x66c3280f,
+0xc7c2f20f, 0x00028c45, 0x0f660000, 0x0f8c6d6e,
+0x0f66d328, 0x290fd5f2, 0x0f66a055, 0x10b8d2fe,
+0x66000003, 0x66d0760f, 0xd117380f, 0x0281830f,
+0x0f660000, 0x668c556e, 0x66c2d20f, 0xb8c0fe0f,
+0x00000314, 0x45760f66, 0x380f66a0, 0x830fc117,
+0x0000025f, 0x0fd2570f, 0x0f66c228, 0x66f04576,
+0x0fc2760f, 0x0f66c354, 0x290fc07e, 0x4d8bb045,
+0x8bc689f0, 0x7d8bb855, 0x8be6d3bc, 0x8941f44d,
+0x6e0f66d0, 0xb4758bee, 0x41fa8941, 0xd341f189,
+0xf84d8be1, 0x3a0f4166, 0x4101e922, 0x4d8be0d3,
+0x0f4166fc, 0xd341c06e, 0x0f4166e2, 0x01c2223a,
+0xe86c0f66, 0xf045280f, 0xc4fe0f66, 0xf045290f,
+0xd3f04d8b, 0xf44d8be0, 0xc06e0f66, 0x00032cb8,
+0x8be6d300, 0x0f66f84d, 0x01c6223a, 0x4d8be2d3,
+0x6e0f66fc, 0x66e7d3f2, 0xf7223a0f, 0x6c0f6601,
+0xfe0f66c6, 0x760f66c0, 0x380f66c5, 0x830fc117,
+0x000001af, 0xd045280f, 0x3b380f66, 0x6d280fc3,
+0x380f66d0, 0x0f66eb3f, 0x66d05dfe, 0xb8c5fe0f,
+0x0000033f, 0xc3760f66, 0x17380f66, 0x80830fc1,
+0x0f000001, 0x01963528, 0x280f0000, 0x54b8e06d,
+0x0f000003, 0x0f66c628, 0x66c50a38, 0x66c5760f,
+0xc117380f, 0x0159830f, 0x280f0000, 0x0f66d05d,
+0x1bc04570, 0x000359b8, 0x760f6600, 0x380f66c3,
+0x830fc117, 0x0000013b, 0x66fb280f, 0xc07d620f,
+0x66c3280f, 0xc0456a0f, 0xc4fe0f66, 0x000370b8,
+0xfa0f6600, 0xc5570fc7, 0x66ec570f, 0x66c5fa0f,
+0x3905760f, 0x66000001, 0xc117380f, 0x0101830f,
+0x0f660000, 0xc0653538, 0xc07d280f, 0x35380f66,
+0x760f66c7, 0x039ab8c4, 0x0f660000, 0x0fc11738,
+0x0000de83, 0xc0570f00, 0xc065280f, 0x163a0f66,
+0x6601a45d, 0x5d163a0f, 0x0f6603ac, 0xb8e04564,
+0x000003c4, 0x657e0f66, 0x3a0f66a0, 0x02a86516,
+0x10380f66, 0x65280fdc, 0x760f66a0, 0x380f66dc,
+0x830fd917, 0x0000009b, 0xc045280f, 0x0003d4b8,
+0xd8280f00, 0x0e3a0f66, 0x66ccd05d, 0x66e3760f,
+0xe117380f, 0x280f7d73, 0x0000b325, 0xd8280f00,
+0x0003e4b8, 0x3a0f6600, 0x0f04d80f, 0x0f66e054,
+0x0f66e6fe, 0x0f66dc76, 0x73d91738, 0x45290f56,
+0xc2280f90, 0x02380f66, 0x290f9045, 0x0f669045,
+0x90550238, 0x0003f8b8, 0x3a0f6600, 0x8303d216,
+0x2f750afa, 0xc045280f, 0x06380f66, 0x570fd045,
+0x66c031d2, 0xc202380f, 0x02380f66, 0x760f66c2,
+0x380f66c2, 0x920fc117, 0x01f883c0, 0x0125c019,
+0xc9000004, 0x000000c3, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002300,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0x280f0000, 0x290fd04d, 0x280fa04d,
+0x60b8a05d, 0x0f000002, 0x0f66c328, 0x66c12938,
+0x66c9760f, 0xc117380f, 0x03fe830f, 0x280f0000,
+0x0f66d045, 0x290fc3d4, 0x280fb045, 0x66b8d045,
+0x66000002, 0x01f0730f, 0x29380f66, 0x0f66b045,
+0x0fc11738, 0x0003d383, 0x45280f00, 0xfb0f66b0,
+0x290fd045, 0x280fc045, 0x026bb8c3, 0x0f660000,
+0xc0452938, 0x17380f66, 0xad830fc1, 0x0f000003,
+0x0fd06d28, 0x280fd328, 0x730f66c3, 0x0f6620d2,
+0x0f66d5f4, 0x280fc5f4, 0x730f66e5, 0x0f6620d4,
+0x0f66dcf4, 0x0f66d3d4, 0x6620f273, 0x0fc2d40f,
+0x0fe05528, 0x280fd828, 0xea280fc2, 0xd0730f66,
+0xf40f6620, 0xf40f66ea, 0xd40f66c2, 0x730f66c0,
+0x0f6620f0, 0x280fe8d4, 0x0f44d055, 0x66e04528,
+0xc2d40f44, 0x41fa280f, 0x66f0280f, 0xb8ddfb0f,
+0x00000282, 0x7dfb0f66, 0x730f66e0, 0x280f20d6,
+0xf40f66c7, 0xe7280ff7, 0xd0730f66, 0x0f416620,
+0x4166e0f4, 0x66c0f40f, 0x66c6d40f, 0x20f0730f,
+0xe0d40f66, 0x66c3280f, 0xc429380f, 0x17380f66,
+0xf5830fc1, 0x0f000002, 0x0fe04528, 0x280ffa28,
+0x730f66da, 0x280f20d7, 0xf40f66e0, 0x730f66d8,
+0x0f6620d4, 0x0f66c7f4, 0x0f66e2f4, 0x0f66c4d4,
+0x6620f073, 0x66c3d40f, 0x0529380f, 0x000002c0,
+0x0002d3b8, 0x380f6600, 0x830fc117, 0x000002ac,
+0xc905280f, 0x0f000002, 0x280fdf28, 0xf40f66f2,
+0xf40f66d8, 0xe8280ff0, 0xd5730f66, 0xf40f6620,
+0xd40f66d5, 0x730f66da, 0x0f6620f3, 0x290fded4,
+0x280fc05d, 0x0f66c065, 0x0f03f473, 0x0fa06529,
+0x66c05d28, 0x02f3730f, 0xb05d290f, 0xdbd40f66,
+0xf8f40f66, 0x0002f8b8, 0x380f6600, 0x0f66dc29,
+0x0fd91738, 0x00024383, 0x65280f00, 0xdc280fa0,
+0xe4720f66, 0x730f6602, 0x0f6602d3, 0xccdc0e3a,
+0xdbd40f66, 0x0002fdb8, 0x380f6600, 0x66b05d29,
+0xd917380f, 0x0212830f, 0x280f0000, 0x9c45c7df,
+0x00000003, 0xdad40f66, 0xf3730f66, 0xd40f6620,
+0x456348de, 0xe3280f9c, 0x6e0f4c66, 0x0f4166c8,
+0x45c7e1f3, 0x0000029c, 0x45634800, 0x0f4c669c,
+0x4166d06e, 0x0fdaf30f, 0x66b05d29, 0xb8dbd40f,
+0x00000310, 0x29380f66, 0x380f66dc, 0x830fd917,
+0x000001b8, 0xc0570f45, 0x9c556348, 0x000040b8,
+0x280f4100, 0x380f66d8, 0x2948dc37, 0x0f4c66d0,
+0x4c66da6e, 0x66e06e0f, 0xe3d30f41, 0xf30f4166,
+0xe3560fdc, 0xe4d40f66, 0x000314b8, 0x380f6600,
+0x66b06529, 0xe117380f, 0x016e830f, 0x0f660000,
+0x0f66d7d4, 0x6620f273, 0x0ff2d40f, 0x66f05528,
+0x37380f41, 0xf2540fd0, 0x7e0f4866, 0x75290ff0,
+0x4d8b48c0, 0x558b48f0, 0xc68948c8, 0x48e6d348,
+0x48f84d8b, 0x4866d789, 0x48de6e0f, 0x4866e7d3,
+0xdf223a0f, 0x25280f01, 0x00000134, 0xf055280f,
+0xd4fb0f66, 0xf055290f, 0xf04d8b48, 0x48e0d348,
+0x66f84d8b, 0xd06e0f48, 0x00032cb8, 0xe2d34800,
+0x3a0f4866, 0x6601d222, 0x66d2d40f, 0xd329380f,
+0x17380f66, 0xe1830fd1, 0x0f000000, 0x66e05528,
+0xd05d700f, 0x0359b84e, 0x0f660000, 0x66da2938,
+0xd917380f, 0x00c2830f, 0x280f0000, 0x6c0f66fa,
+0x280fd07d, 0x6d0f66da, 0x0f66d05d, 0x70b8fbfb,
+0x0f000003, 0x0f66df28, 0x280feff4, 0x730f66f7,
+0x0f6620d3, 0x0f66f0f4, 0x0f66d8f4, 0x0f66ddd4,
+0x6620f373, 0x66ded40f, 0xdc29380f, 0x17380f66,
+0x667973d9, 0x37380f41, 0x5d280fc0, 0x03c4b8d0,
+0x48660000, 0x55163a0f, 0x0f6601b8, 0x66b05dd6,
+0xd310380f, 0xb05d280f, 0x29380f66, 0x380f66d3,
+0x4873d117, 0xd045280f, 0x0003d4b8, 0xd0280f00,
+0x0e3a0f66, 0x66f0e055, 0xda29380f, 0x17380f66,
+0x0f2973d9, 0xc031d028, 0x0f3a0f66, 0x540f08d0,
+0xd40f66c4, 0x380f66c4, 0x0f66c229, 0x0fc11738,
+0xf883c092, 0x25c01901, 0x000003e4, 0x0000c35d,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0002220,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0x280f0000, 0x290fd075, 0x280fa075,
+0x0f66a055, 0x60b8c976, 0x0f000002, 0x0f66c228,
+0x66c62938, 0xc117380f, 0x02e7830f, 0x280f0000,
+0x0f66d045, 0x290fc2d4, 0x280fb045, 0x66b8d045,
+0x66000002, 0x01f0730f, 0x29380f66, 0x0f66b045,
+0x0fc11738, 0x0002bc83, 0x45280f00, 0xfb0f66b0,
+0x290fd045, 0x280fc045, 0x026bb8da, 0x0f660000,
+0xc05d2938, 0x17380f66, 0x96830fd9, 0x0f000002,
+0x0fe05556, 0x0fa05529, 0x0fe04554, 0x0fc05528,
+0x0fe05557, 0x540fc157, 0x77b8a045, 0x66000002,
+0xc229380f, 0x17380f66, 0x66830fc1, 0x0f000002,
+0x0fd04528, 0x0fe06d28, 0x280fd028, 0xd8280fe5,
+0xd2730f66, 0x730f6620, 0x0f6620d4, 0x0f66d5f4,
+0x0f66e0f4, 0x0f66ddf4, 0x0f66d4d4, 0x6620f273,
+0x66d3d40f, 0x1529380f, 0x00000234, 0x0002d3b8,
+0x380f6600, 0x830fd117, 0x00000219, 0xc045290f,
+0xc05d280f, 0xf3730f66, 0x5d290f03, 0x55280fa0,
+0x730f66c0, 0x290f02f2, 0x0f66b055, 0xf8b8d2d4,
+0x66000002, 0xd329380f, 0x17380f66, 0xe2830fd1,
+0x0f000001, 0x66a05528, 0x02d2730f, 0xd2d40f66,
+0x0002fdb8, 0x380f6600, 0x66b05529, 0xd117380f,
+0x01bf830f, 0x45c70000, 0x0000039c, 0x6e0f6600,
+0x280f9c5d, 0xf30f66d0, 0x9c45c7d3, 0x00000002,
+0x5d6e0f66, 0xf30f669c, 0x45290fc3, 0xd40f66b0,
+0x0310b8c0, 0x0f660000, 0x66c22938, 0xc117380f,
+0x017f830f, 0x0f660000, 0x669c5d6e, 0x0fd3d30f,
+0x0f66c228, 0x14b8c2d4, 0x66000003, 0x4529380f,
+0x380f66b0, 0x830fc117, 0x00000159, 0x0fd2570f,
+0x0f66c228, 0xf0452938, 0x29380f66, 0x45540fc2,
+0x0f4866d0, 0x290fc07e, 0x8b48c045, 0x8b48f04d,
+0x8948c855, 0xe6d348c6, 0xf84d8b48, 0x66d78948,
+0xd66e0f48, 0x66e7d348, 0x223a0f48, 0x280f01d7,
+0x0f66f045, 0x290fc1d4, 0x8b48f045, 0xd348f04d,
+0x4d8b48e0, 0x0f4866f8, 0x2cb8c06e, 0x48000003,
+0x4866e2d3, 0xc2223a0f, 0xd40f6601, 0x380f66c0,
+0x0f66c229, 0x0fc11738, 0x0000d883, 0x5d280f00,
+0x700f66e0, 0xb84ed045, 0x00000359, 0x29380f66,
+0x380f66c3, 0x830fc117, 0x000000b9, 0xffc88348,
+0x6e0f4866, 0xe3280fc0, 0x656c0f66, 0xd3280fd0,
+0x556d0f66, 0xd40f66d0, 0x0370b8d1, 0x0f660000,
+0x280fd4fb, 0xe1570fe0, 0x66d0570f, 0x0fd4fb0f,
+0x009a2528, 0x0f660000, 0x66d42938, 0xd117380f,
+0x280f7373, 0x4866d055, 0x5d163a0f, 0xc4b801b8,
+0x66000003, 0xda10380f, 0x55d60f66, 0x55280fb0,
+0x380f66b0, 0x0f66da29, 0x73d91738, 0x45280f48,
+0x03d4b8d0, 0x280f0000, 0x3a0f66d8, 0xf0e05d0e,
+0x29380f66, 0x380f66d3, 0x2973d117, 0x31d0280f,
+0x3a0f66c0, 0x0f08d00f, 0x0f66c454, 0x0f66c4d4,
+0x66c22938, 0xc117380f, 0x83c0920f, 0xc01901f8,
+0x0003e425, 0x00c35d00, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0001560,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd07d28, 0x0fa07d29, 0x66a04528, 0xb8c9760f,
+0x00000260, 0x0fd0280f, 0x6600d7c2, 0xd117380f,
+0x03a9830f, 0x280f0000, 0x580fd055, 0x55290fd0,
+0x55280fb0, 0x0266b8d0, 0x580f0000, 0x55c20fd2,
+0x0f6600b0, 0x0fd11738, 0x00038283, 0x55280f00,
+0x555c0fb0, 0x55290fd0, 0xd0280fc0, 0x00026bb8,
+0x55c20f00, 0x0f6600c0, 0x0fd11738, 0x00035e83,
+0x55280f00, 0x45590fe0, 0xda280fd0, 0x0fda590f,
+0x0fd05528, 0x0fe06d28, 0x280fea58, 0x655c0fe2,
+0xc35c0fe0, 0x000282b8, 0xe5590f00, 0x00c4c20f,
+0x17380f66, 0x24830fc1, 0x0f000003, 0x0ff04528,
+0x290fc259, 0x5e0fa045, 0xc20ff055, 0x8bb800c2,
+0x66000002, 0xc117380f, 0x0301830f, 0x280f0000,
+0x0ff3f05d, 0x03061510, 0x8eb80000, 0x0f000002,
+0xc60fc328, 0x570f00d2, 0x55570fc2, 0x45590fd0,
+0xc2c20fa0, 0x380f6600, 0x830fc117, 0x000002cf,
+0xd045530f, 0xa045290f, 0xa045530f, 0xd055280f,
+0x000296b8, 0x5b0f6600, 0xc05b0fc0, 0x00c2c20f,
+0x17380f66, 0xa4830fc1, 0x0f000002, 0x590fc228,
+0x45290fc2, 0x45520fa0, 0x45290fa0, 0x45280fb0,
+0x029db8b0, 0x530f0000, 0x5b0f66e0, 0xe45b0fe4,
+0x00d4c20f, 0x17380f66, 0x70830fd1, 0x66000002,
+0x0fd05b0f, 0x0fd04528, 0x9fb8d25b, 0x0f000002,
+0x0f66e053, 0x5b0fe45b, 0xd4c20fe4, 0x380f6600,
+0x830fd117, 0x00000247, 0x0fd0280f, 0x290fd059,
+0x510fa055, 0xa7b8a055, 0x0f000002, 0x6600d0c2,
+0xd117380f, 0x0225830f, 0x0ff30000, 0x024e2510,
+0xc60f0000, 0x280f00e4, 0xd05e0fd4, 0xa055290f,
+0x083a0f66, 0x0f0ba055, 0x023115c2, 0xb8000000,
+0x000002af, 0x17380f66, 0xf0830fd1, 0x0f000001,
+0x0fe05528, 0x590feb28, 0xd3590fe8, 0xb055290f,
+0x0fd5280f, 0x0fb0555f, 0x0fb06d5d, 0x0fb06d29,
+0x0fb05558, 0xb8e04558, 0x00000348, 0x0fd3590f,
+0x6600c2c2, 0xc117380f, 0x01b1830f, 0x280f0000,
+0x59b8d045, 0x0f000003, 0x0f1bc0c6, 0x00e045c2,
+0x17380f66, 0x94830fc1, 0x0f000001, 0x0fe05528,
+0x140fc228, 0x280fd045, 0x6d150fea, 0xc55c0fd0,
+0x2d100ff3, 0x0000018c, 0x000370b8, 0xedc60f00,
+0xc3590f00, 0x00c5c20f, 0x17380f66, 0x5c830fc1,
+0xf3000001, 0xd045120f, 0x2d100ff3, 0x00000168,
+0xd0455c0f, 0x0003b1b8, 0x100ff300, 0x00015b35,
+0xedc60f00, 0xeb580f00, 0x00f6c60f, 0x0fee590f,
+0x6600c5c2, 0xc117380f, 0x0121830f, 0x0ff30000,
+0x0fd04516, 0x280fe358, 0xb8b8d06d, 0x0f000003,
+0x590fc55c, 0xc4c20fe6, 0x380f6600, 0x830fc117,
+0x000000fb, 0xf3c0570f, 0xb06d110f, 0x173a0f66,
+0x6601b455, 0x55173a0f, 0xc20f03bc, 0x0f6601c3,
+0xb86d173a, 0x03c4b802, 0x0f660000, 0x0fd51438,
+0x0fb04528, 0x6600d0c2, 0xd117380f, 0x00bd830f,
+0x280f0000, 0xd4b8d055, 0x66000003, 0x550c3a0f,
+0xc20f0ae0, 0x0f6600c2, 0x0fc11738, 0x00009e83,
+0x45280f00, 0xd00ff2d0, 0x280fe045, 0x0ff2d055,
+0xb8e055d0, 0x000003dd, 0x00c2c20f, 0x17380f66,
+0x0f7c73c1, 0xb8d05528, 0x000003ec, 0x66c2280f,
+0x45403a0f, 0xc20ff1e0, 0x0000a205, 0x0f660000,
+0x73c11738, 0x55290f5a, 0xd2570fa0, 0xf2c2280f,
+0xa0457c0f, 0xa045290f, 0xf2c2280f, 0xa0457c0f,
+0xffc0c60f, 0x55052e0f, 0x7a000000, 0x0f2b752d,
+0xf2d04528, 0xe0457d0f, 0x0ff2c031, 0x0ff2c27c,
+0xc20fc27c, 0x0f6600c2, 0x0fc11738, 0xf883c092,
+0x25c01901, 0x00000401, 0xf8b805eb, 0x5d000003,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x40000000, 0xbf800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0002160,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16f8[] = {
+0x485500eb, 0x0ff2e589, 0x04320510, 0x0ff20000,
+0x03fa0d10, 0x8b480000, 0x0003fb05, 0x110ff200,
+0x8948d045, 0x0ff2f845, 0xf2e04d11, 0xf045110f,
+0x4d110ff2, 0x110ff2d8, 0x280fe845, 0x290fd07d,
+0x280fa07d, 0x0f66a045, 0x60b8c976, 0x0f000002,
+0x0f66d028, 0x6600d7c2, 0xd117380f, 0x03a7830f,
+0x280f0000, 0x0f66d055, 0x290fd058, 0x280fb055,
+0x66b8d055, 0x66000002, 0x66d2580f, 0xb055c20f,
+0x380f6600, 0x830fd117, 0x0000037d, 0xb055280f,
+0x555c0f66, 0x55290fd0, 0xd0280fc0, 0x00026bb8,
+0xc20f6600, 0x6600c055, 0xd117380f, 0x0357830f,
+0x280f0000, 0x0f66e055, 0x0fd04559, 0x0f66da28,
+0x280fda59, 0x280fd055, 0x0f66e06d, 0x280fea58,
+0x5c0f66e2, 0x0f66e065, 0x82b8c35c, 0x66000002,
+0x66e5590f, 0x00c4c20f, 0x17380f66, 0x16830fc1,
+0x0f000003, 0x66f04528, 0x0fc2590f, 0x66a04529,
+0xf0555e0f, 0xc2c20f66, 0x028bb800, 0x0f660000,
+0x0fc11738, 0x0002f083, 0x55280f00, 0x120ff2f0,
+0x0002fb1d, 0x028eb800, 0x280f0000, 0xc3570fc2,
+0xd05d570f, 0x45590f66, 0xc20f66a0, 0x0f6600c3,
+0x0fc11738, 0x0002c083, 0x5a0f6600, 0x530fd045,
+0xc05a0fc0, 0xa045290f, 0x455a0f66, 0xc0530fa0,
+0xd065280f, 0x000296b8, 0xc05a0f00, 0xc0e60ff2,
+0xc0e60ff3, 0xc4c20f66, 0x380f6600, 0x830fc117,
+0x00000285, 0x66c4280f, 0x0fc4590f, 0x66a04529,
+0xa0455a0f, 0x0fc0520f, 0x290fc05a, 0x280fb045,
+0x9db8b05d, 0x66000002, 0x0fc35a0f, 0x5a0fc053,
+0xe60ff2c0, 0xe60ff3c0, 0xc20f66c0, 0x0f6600e0,
+0x0fe11738, 0x00024083, 0xe60ff200, 0xe60ff3db,
+0x5d280fe3, 0x029fb8d0, 0x0f660000, 0x530fc35a,
+0xc05a0fc0, 0xc0e60ff2, 0xc0e60ff3, 0xc4c20f66,
+0x380f6600, 0x830fc117, 0x0000020d, 0x66c3280f,
+0x0fc3590f, 0x66a04529, 0xa045510f, 0xc3c20f66,
+0x02a7b800, 0x0f660000, 0x0fc11738, 0x0001e883,
+0x120ff200, 0x0002172d, 0xc5280f00, 0xc35e0f66,
+0xa045290f, 0x093a0f66, 0xb80ba045, 0x000002af,
+0x05c20f66, 0x000001f7, 0x380f6600, 0x830fc117,
+0x000001b5, 0xe045280f, 0x66e2280f, 0x66e3590f,
+0x0fc2590f, 0x0fb04529, 0x0f66c428, 0x66b0455f,
+0xb0655d0f, 0xb065290f, 0x45580f66, 0x580f66b0,
+0x48b8e05d, 0x66000003, 0x66c2590f, 0x00c3c20f,
+0x17380f66, 0x6e830fc1, 0x0f000001, 0xb8d04528,
+0x00000359, 0x0f3a0f66, 0x0f6608c0, 0x00e045c2,
+0x17380f66, 0x4e830fc1, 0x0f000001, 0x0fe06528,
+0x0f66c428, 0x0fd04516, 0x66d05d28, 0xe85d120f,
+0xc35c0f66, 0x000370b8, 0x590f6600, 0xc20f66c2,
+0x0f6600c5, 0x0fc11738, 0x00011c83, 0x120ff200,
+0x0ff2d045, 0x011e1d12, 0x0f660000, 0x280fda58,
+0x0ff2d06d, 0x011e3512, 0xb1b80000, 0x66000003,
+0x66c55c0f, 0x66de590f, 0x00c3c20f, 0x17380f66,
+0xe2830fc1, 0x0f000000, 0x0f66db57, 0xb8b86517,
+0x000003c4, 0x66c3280f, 0xb06d130f, 0xc2c20f66,
+0x380f6601, 0x280fe515, 0x0f66b045, 0x6600e0c2,
+0xe117380f, 0x00af830f, 0x280f0000, 0xd4b8d055,
+0x66000003, 0x550d3a0f, 0x0f6602e0, 0x6600c2c2,
+0xc117380f, 0x008f830f, 0x280f0000, 0x0f66d045,
+0x0fe045d0, 0x66d05528, 0xe055d00f, 0x0003ddb8,
+0xc20f6600, 0x0f6600c2, 0x73c11738, 0x55280f6c,
+0x03ecb8d0, 0x280f0000, 0x3a0f66c2, 0x31e04541,
+0x05c20f66, 0x00000097, 0x380f6600, 0x4973c117,
+0xa055290f, 0x5d7c0f66, 0x150f66a0, 0x2e0f66db,
+0x00005b1d, 0x752d7a00, 0x45280f2b, 0x7d0f66d0,
+0x570fe045, 0x66c031d2, 0x66c27c0f, 0x00c2c20f,
+0x17380f66, 0xc0920fc1, 0x1901f883, 0x040125c0,
+0x05eb0000, 0x0003f8b8, 0x00c35d00, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002140,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8148e589, 0x0000d0ec,
+0x100ff300, 0x00044705, 0x110ff300, 0xffff4c85,
+0x110ff3ff, 0xffff5085, 0x110ff3ff, 0xffff5485,
+0x4c858bff, 0x89ffffff, 0xffff4085, 0xf3ff31ff,
+0x408d100f, 0xb9ffffff, 0x00000000, 0x4c8d2e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xffff81e8,
+0xb8c289ff, 0x00000260, 0x840fd284, 0x000003e6,
+0x8d100ff3, 0xffffff40, 0x8d580ff3, 0xffffff4c,
+0x8d110ff3, 0xffffff44, 0x8d100ff3, 0xffffff4c,
+0x0ff3ff31, 0x2e0fc958, 0xffff448d, 0x9b0f40ff,
+0xf9450fc7, 0x37e8dff7, 0x89ffffff, 0x0266b8c2,
+0xd2840000, 0x039c840f, 0x0ff30000, 0xff448d10,
+0x0ff3ffff, 0xff4c8d5c, 0x0ff3ffff, 0xff308d11,
+0x858bffff, 0xffffff30, 0xff7c8589, 0x8589ffff,
+0xffffff44, 0xff488589, 0xff31ffff, 0x8d100ff3,
+0xffffff40, 0x488d2e0f, 0x40ffffff, 0x0fc79b0f,
+0xdff7f945, 0xfffed9e8, 0xb8c289ff, 0x0000026b,
+0x840fd284, 0x0000033e, 0x8d100ff3, 0xffffff40,
+0x8d590ff3, 0xffffff4c, 0x8d110ff3, 0xffffff40,
+0x8d100ff3, 0xffffff50, 0xc9590ff3, 0x8d110ff3,
+0xffffff44, 0x8d100ff3, 0xffffff4c, 0x8d580ff3,
+0xffffff50, 0x8d110ff3, 0xffffff48, 0x8d100ff3,
+0xffffff4c, 0x9d100ff3, 0xffffff40, 0x0ff3ff31,
+0xff449d5c, 0x280fffff, 0x5c0ff3d1, 0xffff5095,
+0x590ff3ff, 0xffff4895, 0xda2e0fff, 0x95110ff3,
+0xffffff48, 0xc79b0f40, 0xf7f9450f, 0xfe40e8df,
+0xc289ffff, 0x000282b8, 0x0fd28400, 0x0002a584,
+0x590ff300, 0xffff548d, 0x110ff3ff, 0xffff408d,
+0xf3ff31ff, 0x4c8d100f, 0xf3ffffff, 0x548d5e0f,
+0x0fffffff, 0xff408d2e, 0x0ff3ffff, 0xff448d11,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xfffffdf2,
+0x8bb8c289, 0x84000002, 0x57840fd2, 0xf3000002,
+0x548d100f, 0xf3ffffff, 0x611d100f, 0xf3000002,
+0x4c95100f, 0x31ffffff, 0xcb570fff, 0xf3d3570f,
+0x408d590f, 0x0fffffff, 0x0f40ca2e, 0x450fc79b,
+0xe8dff7f9, 0xfffffdaa, 0x8eb8c289, 0x84000002,
+0x0f840fd2, 0xf3000002, 0x4c8d530f, 0xf3ffffff,
+0x408d110f, 0xf3ffffff, 0x4095530f, 0xf3ffffff,
+0xf3c22c0f, 0x4c8d100f, 0x31ffffff, 0x2a0ff3ff,
+0xd12e0fd0, 0xc79b0f40, 0xf7f9450f, 0xfd60e8df,
+0xc289ffff, 0x000296b8, 0x0fd28400, 0x0001c584,
+0x590ff300, 0x110ff3c9, 0xffff408d, 0x520ff3ff,
+0xffff408d, 0x110ff3ff, 0xffff448d, 0x530ff3ff,
+0xffff448d, 0x2c0ff3ff, 0xf3ff31c1, 0x0fc82a0f,
+0xff4c8d2e, 0x0f40ffff, 0x450fc79b, 0xe8dff7f9,
+0xfffffd0e, 0x9db8c289, 0x84000002, 0x73840fd2,
+0xf3000001, 0x44852c0f, 0x31ffffff, 0x530ff3ff,
+0xffff4c8d, 0x2a0ff3ff, 0x2c0ff3d0, 0x2a0ff3c1,
+0xd12e0fc8, 0xc79b0f40, 0xf7f9450f, 0xfcd0e8df,
+0xc289ffff, 0x00029fb8, 0x0fd28400, 0x00013584,
+0x100ff300, 0xffff4c8d, 0x590ff3ff, 0x110ff3c9,
+0xffff408d, 0x100ff3ff, 0xffff4c95, 0xf3ff31ff,
+0x408d510f, 0x0fffffff, 0x0f40ca2e, 0x450fc79b,
+0xe8dff7f9, 0xfffffc8a, 0xa7b8c289, 0x84000002,
+0xef840fd2, 0x0f000000, 0x0ff3c828, 0xff448511,
+0x0ff3ffff, 0x0ff3ca5e, 0xff408d11, 0xff31ffff,
+0x0a3a0f66, 0xffff4085, 0x2e0f0bff, 0xffff4485,
+0x110ff3ff, 0xffff4885, 0x9b0f40ff, 0xf9450fc7,
+0x3be8dff7, 0x89fffffc, 0x02afb8c2, 0xd2840000,
+0x00a0840f, 0x0ff30000, 0xff548510, 0x0ff3ffff,
+0xff4c8d10, 0x0ff3ffff, 0x0ff3c859, 0xff508559,
+0x0ff3ffff, 0xff408d11, 0x0ff3ffff, 0xff448511,
+0x0ff3ffff, 0xff408510, 0x0ff3ffff, 0xff44855f,
+0x0ff3ffff, 0xff488511, 0x0ff3ffff, 0xff408510,
+0x0ff3ffff, 0xff44855d, 0x0ff3ffff, 0xff448511,
+0x0ff3ffff, 0xff448510, 0x0ff3ffff, 0xff488558,
+0xff31ffff, 0x85590ff3, 0xffffff54, 0x8d100ff3,
+0xffffff4c, 0x8d580ff3, 0xffffff50, 0x40c12e0f,
+0x0fc79b0f, 0xdff7f945, 0xfffb95e8, 0x19013cff,
+0x034825c0, 0xc3c90000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002240,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_f8[] = {
+0x485500eb, 0x8148e589, 0x000118ec, 0x100ff200,
+0x0004fb05, 0x110ff200, 0xfffe9885, 0x110ff2ff,
+0xfffea085, 0x110ff2ff, 0xfffea885, 0x858b48ff,
+0xfffffe98, 0x80858948, 0x31fffffe, 0x100ff2c0,
+0xfffe808d, 0x0000baff, 0x0f660000, 0xfe988d2e,
+0x9b0fffff, 0x450f48c0, 0xd8f748c2, 0x6e0f4866,
+0x0260b8e0, 0x0f660000, 0xb60fccd7, 0xfff981c9,
+0x0f000000, 0x00048a85, 0x100ff200, 0xfffe808d,
+0x580ff2ff, 0xfffe988d, 0x110ff2ff, 0xfffe888d,
+0x100ff2ff, 0xfffe988d, 0xf2c031ff, 0x66c9580f,
+0x888d2e0f, 0x0ffffffe, 0x0f48c09b, 0xf748c245,
+0x0f4866d8, 0x66b8e86e, 0x66000002, 0x0fcdd70f,
+0xf981c9b6, 0x000000ff, 0x0435850f, 0x0ff20000,
+0xfe888d10, 0x0ff2ffff, 0xfe988d5c, 0x0ff2ffff,
+0xfe708d11, 0x8b48ffff, 0xfffe7085, 0x858948ff,
+0xfffffef8, 0x88858948, 0x48fffffe, 0xfe908589,
+0xc031ffff, 0x8d100ff2, 0xfffffe80, 0x8d2e0f66,
+0xfffffe90, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8f06e0f, 0x0000026b, 0xced70f66, 0x81c9b60f,
+0x0000fff9, 0xc8850f00, 0xf2000003, 0x808d100f,
+0xf2fffffe, 0x988d590f, 0xf2fffffe, 0x808d110f,
+0xf2fffffe, 0xa08d100f, 0xf2fffffe, 0xf2c9590f,
+0x888d110f, 0xf2fffffe, 0x988d100f, 0xf2fffffe,
+0xa08d580f, 0xf2fffffe, 0x908d110f, 0xf2fffffe,
+0x988d100f, 0xf2fffffe, 0x809d100f, 0x31fffffe,
+0x5c0ff2c0, 0xfffe889d, 0xd1280fff, 0x955c0ff2,
+0xfffffea0, 0x95590ff2, 0xfffffe90, 0xda2e0f66,
+0x95110ff2, 0xfffffe90, 0x48c09b0f, 0x48c2450f,
+0x4866d8f7, 0xb8f86e0f, 0x00000282, 0xcfd70f66,
+0x81c9b60f, 0x0000fff9, 0x24850f00, 0xf2000003,
+0xa88d590f, 0xf2fffffe, 0x808d110f, 0x31fffffe,
+0x100ff2c0, 0xfffe988d, 0x5e0ff2ff, 0xfffea88d,
+0x2e0f66ff, 0xfffe808d, 0x110ff2ff, 0xfffe888d,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xe06e0f48,
+0x00028bb8, 0xd70f6600, 0xc9b60fcc, 0x00fff981,
+0x850f0000, 0x000002cb, 0x1d7e0ff3, 0x000002e0,
+0x8d100ff2, 0xfffffea8, 0x0ff2c031, 0xfe989510,
+0x570fffff, 0x590ff2cb, 0xfffe808d, 0xd3570fff,
+0xca2e0f66, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8e86e0f, 0x0000028e, 0xcdd70f66, 0x81c9b60f,
+0x0000fff9, 0x78850f00, 0xf2000002, 0x988d5a0f,
+0xf3fffffe, 0xf3c9530f, 0x66c95a0f, 0x808d130f,
+0xf2fffffe, 0x80955a0f, 0xf3fffffe, 0xf3d2530f,
+0xf2d25a0f, 0xf2c22c0f, 0x988d100f, 0xf2fffffe,
+0x31d02a0f, 0x2e0f66c0, 0xc09b0fd1, 0xc2450f48,
+0x66d8f748, 0xf06e0f48, 0x000296b8, 0xd70f6600,
+0xc9b60fce, 0x00fff981, 0x850f0000, 0x00000213,
+0xc9590ff2, 0x8d110ff2, 0xfffffe80, 0x8d5a0ff2,
+0xfffffe80, 0xc9520ff3, 0xc95a0ff3, 0x8d130f66,
+0xfffffe88, 0x8d5a0ff2, 0xfffffe88, 0xc9530ff3,
+0xc95a0ff3, 0xc12c0ff2, 0xc82a0ff2, 0x0f66c031,
+0xfe988d2e, 0x9b0fffff, 0x450f48c0, 0xd8f748c2,
+0x6e0f4866, 0x029db8f8, 0x0f660000, 0xb60fcfd7,
+0xfff981c9, 0x0f000000, 0x0001a685, 0x2c0ff200,
+0xfffe888d, 0x5a0ff2ff, 0xfffe988d, 0x530ff3ff,
+0x5a0ff3c9, 0x2c0ff2c9, 0x0fc139c1, 0xb60fc094,
+0xd8f748c0, 0x6e0f4866, 0x029fb8e0, 0x0f660000,
+0xb60fccd7, 0xfff981c9, 0x0f000000, 0x00016285,
+0x100ff200, 0xfffe988d, 0x590ff2ff, 0x110ff2c9,
+0xfffe808d, 0x100ff2ff, 0xfffe9895, 0xf2c031ff,
+0x808d510f, 0x66fffffe, 0x0fca2e0f, 0x0f48c09b,
+0xf748c245, 0x0f4866d8, 0xa7b8e86e, 0x66000002,
+0x0fd5d70f, 0xfa81d2b6, 0x000000ff, 0x0111850f,
+0x280f0000, 0x110ff2c8, 0xfffe8885, 0x5e0ff2ff,
+0x110ff2ca, 0xfffe808d, 0xbac031ff, 0x00000000,
+0x0b3a0f66, 0xfffe8085, 0x0f660bff, 0xfe88852e,
+0x0ff2ffff, 0xfe908511, 0x9b0fffff, 0x450f48c0,
+0xd8f748c2, 0x6e0f4866, 0x02afb8f0, 0x0f660000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x0000b285,
+0x100ff200, 0xfffea885, 0x100ff2ff, 0xfffe988d,
+0x590ff2ff, 0x590ff2c8, 0xfffea085, 0x110ff2ff,
+0xfffe808d, 0x110ff2ff, 0xfffe8885, 0x100ff2ff,
+0xfffe8085, 0x5f0ff2ff, 0xfffe8885, 0x110ff2ff,
+0xfffe9085, 0x100ff2ff, 0xfffe8085, 0x5d0ff2ff,
+0xfffe8885, 0x110ff2ff, 0xfffe8885, 0x100ff2ff,
+0xfffe8885, 0x580ff2ff, 0xfffe9085, 0xf2c031ff,
+0xa885590f, 0xf2fffffe, 0x988d100f, 0xf2fffffe,
+0xa08d580f, 0x66fffffe, 0x0fc12e0f, 0x0f48c09b,
+0x48bac245, 0x48000003, 0x4866d8f7, 0x66f86e0f,
+0x0fc7d70f, 0xff3dc0b6, 0xb8000000, 0x00000000,
+0xc9c2450f, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002460,
+};
@@ -1,6 +1,8 @@
 #include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
+#include <time.h>
 #include <sys/mman.h>
 
 #include "x86-emulate.h"
@@ -389,6 +391,351 @@ static struct x86_emulate_ops emulops = {
     .put_fpu    = emul_test_put_fpu,
 };
 
+/*
+ * Instructions to run through both x86_emulate_simple() and x86_emulate(),
+ * with the results expected to match.  Forms the fast path doesn't cover
+ * are expected to be left alone by it.  A non-zero @disp locates a disp32
+ * field to be pointed at scratch data (RIP-relative if @rel).
+ */
+static const struct simple_insn {
+    const char *name;
+    bool fast;
+    uint8_t disp;
+    bool rel;
+    unsigned int len;
+    uint8_t insn[12];
+} simple_insns[] = {
+    { "mov (%rax),%ecx",         1, 0, 0, 2, { 0x8b, 0x08 } },
+    { "mov %ecx,(%rbx,%rcx,4)",  1, 0, 0, 3, { 0x89, 0x0c, 0x8b } },
+    { "mov %dx,0x10(%rax)",      1, 0, 0, 4, { 0x66, 0x89, 0x50, 0x10 } },
+    { "mov %ah,5(%rax)",         1, 0, 0, 3, { 0x88, 0x60, 0x05 } },
+    { "mov -2(%rsi),%ch",        1, 0, 0, 3, { 0x8a, 0x6e, 0xfe } },
+    { "movb $0x5a,7(%rdi)",      1, 0, 0, 4, { 0xc6, 0x47, 0x07, 0x5a } },
+    { "movl $imm,0x100(%rbx)",   1, 0, 0, 10,
+      { 0xc7, 0x83, 0x00, 0x01, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12 } },
+    { "movw $0x1234,(%rax)",     1, 0, 0, 5, { 0x66, 0xc7, 0x00, 0x34, 0x12 } },
+    { "movzbl 3(%rax),%ecx",     1, 0, 0, 4, { 0x0f, 0xb6, 0x48, 0x03 } },
+    { "movzwl (%rbx,%rdx,2),%ecx", 1, 0, 0, 4, { 0x0f, 0xb7, 0x0c, 0x53 } },
+    { "movsbl 1(%rbp),%ecx",     1, 0, 0, 4, { 0x0f, 0xbe, 0x4d, 0x01 } },
+    { "movsbw (%rax),%cx",       1, 0, 0, 4, { 0x66, 0x0f, 0xbe, 0x08 } },
+    { "movswl (%rax),%ecx",      1, 0, 0, 3, { 0x0f, 0xbf, 0x08 } },
+    { "movnti %ecx,(%rax)",      1, 0, 0, 3, { 0x0f, 0xc3, 0x08 } },
+    { "stosb",                   1, 0, 0, 1, { 0xaa } },
+    { "stosw",                   1, 0, 0, 2, { 0x66, 0xab } },
+    { "stosl",                   1, 0, 0, 1, { 0xab } },
+    { "mov %fs:(%rax),%eax",     1, 0, 0, 3, { 0x64, 0x8b, 0x00 } },
+    { "mov %ds:(%rax),%eax",     1, 0, 0, 3, { 0x3e, 0x8b, 0x00 } },
+    { "mov (%rsp),%eax",         1, 0, 0, 3, { 0x8b, 0x04, 0x24 } },
+    { "mov 8(%rbp),%eax",        1, 0, 0, 3, { 0x8b, 0x45, 0x08 } },
+    { "mov disp32,%eax",         1, 2, 1, 6, { 0x8b, 0x05 } },
+    { "mov %eax,disp32(,%rcx,8)", 1, 3, 0, 7, { 0x89, 0x04, 0xcd } },
+#ifdef __x86_64__
+    { "mov (%rax),%rcx",         1, 0, 0, 3, { 0x48, 0x8b, 0x08 } },
+    { "movq $-1,(%rax)",         1, 0, 0, 7,
+      { 0x48, 0xc7, 0x00, 0xff, 0xff, 0xff, 0xff } },
+    { "mov %r8d,(%rax)",         1, 0, 0, 3, { 0x44, 0x89, 0x00 } },
+    { "mov (%r12),%ecx",         1, 0, 0, 4, { 0x41, 0x8b, 0x0c, 0x24 } },
+    { "mov 8(%r13),%eax",        1, 0, 0, 4, { 0x41, 0x8b, 0x45, 0x08 } },
+    { "mov (%rax,%r9,4),%eax",   1, 0, 0, 4, { 0x42, 0x8b, 0x04, 0x88 } },
+    { "mov %sil,(%rax)",         1, 0, 0, 3, { 0x40, 0x88, 0x30 } },
+    { "movsbq (%rax),%r9",       1, 0, 0, 4, { 0x4c, 0x0f, 0xbe, 0x08 } },
+    { "movnti %rcx,(%rax)",      1, 0, 0, 4, { 0x48, 0x0f, 0xc3, 0x08 } },
+    { "data16 mov %rcx,(%rax)",  1, 0, 0, 4, { 0x66, 0x48, 0x89, 0x08 } },
+    { "stosq",                   1, 0, 0, 2, { 0x48, 0xab } },
+    { "rex.w data16 mov",        0, 0, 0, 4, { 0x48, 0x66, 0x8b, 0x08 } },
+#endif
+    { "lock add %ecx,(%rax)",    0, 0, 0, 3, { 0xf0, 0x01, 0x08 } },
+    { "add %ecx,(%rax)",         0, 0, 0, 2, { 0x01, 0x08 } },
+    { "mov %ecx,%eax",           0, 0, 0, 2, { 0x89, 0xc8 } },
+    { "rep stosl",               0, 0, 0, 2, { 0xf3, 0xab } },
+    { "addr32 mov (%eax),%ecx",  0, 0, 0, 3, { 0x67, 0x8b, 0x08 } },
+    { "data16 movnti",           0, 0, 0, 4, { 0x66, 0x0f, 0xc3, 0x08 } },
+};
+
+static bool test_simple(struct x86_emulate_ctxt *ctxt, char *instr,
+                        unsigned int *res)
+{
+    struct cpu_user_regs *orig_regs = ctxt->regs, init, regs;
+    char *data = (char *)res + 0x1000;
+    static char mem[0x1000], simple_mem[0x1000];
+    unsigned int i, j, k;
+
+    for ( i = 0; i < sizeof(mem); i++ )
+        mem[i] = i * 7 + 0x83;
+
+    for ( i = 0; i < ARRAY_SIZE(simple_insns); i++ )
+    {
+        const struct simple_insn *t = &simple_insns[i];
+
+        memcpy(instr, t->insn, t->len);
+        if ( t->disp )
+        {
+            int32_t disp = (unsigned long)data + 0x80;
+
+            if ( t->rel && ctxt->addr_size == 64 )
+                disp -= (unsigned long)instr + t->len;
+            memcpy(instr + t->disp, &disp, sizeof(disp));
+        }
+
+        /* Run each instruction with EFLAGS.DF clear and set. */
+        for ( j = 0; j < 2; j++ )
+        {
+            int rc;
+
+            memset(&init, 0, sizeof(init));
+            for ( k = 0; k < X86_NR_GPRS; k++ )
+                *decode_gpr(&init, k) = (unsigned long)data + 0x100 + k * 0x40;
+            init.ecx = 3;
+            init.edx = 5;
+#ifdef __x86_64__
+            init.r9 = 2;
+#endif
+            init.eflags = X86_EFLAGS_IF | X86_EFLAGS_MBS |
+                          (j ? X86_EFLAGS_DF : 0);
+            init.eip = (unsigned long)instr;
+
+            regs = init;
+            ctxt->regs = &regs;
+            memcpy(data, mem, sizeof(mem));
+            rc = x86_emulate_simple(ctxt, &emulops);
+
+            if ( !t->fast )
+            {
+                if ( rc != X86EMUL_UNIMPLEMENTED ||
+                     memcmp(&regs, &init, sizeof(regs)) ||
+                     memcmp(data, mem, sizeof(mem)) )
+                    goto fail;
+                continue;
+            }
+
+            if ( rc != X86EMUL_OKAY )
+                goto fail;
+
+            init.eflags &= ~X86_EFLAGS_RF;
+            memcpy(simple_mem, data, sizeof(simple_mem));
+            memcpy(data, mem, sizeof(mem));
+            ctxt->regs = &init;
+            if ( x86_emulate(ctxt, &emulops) != X86EMUL_OKAY ||
+                 memcmp(&regs, &init, sizeof(regs)) ||
+                 memcmp(data, simple_mem, sizeof(simple_mem)) )
+                goto fail;
+        }
+    }
+
+    ctxt->regs = orig_regs;
+    return true;
+
+ fail:
+    printf("%s: ", simple_insns[i].name);
+    ctxt->regs = orig_regs;
+    return false;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t rdtsc(void)
+{
+    uint32_t lo, hi;
+
+    asm volatile ( "rdtsc" : "=a" (lo), "=d" (hi) );
+
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/*
+ * Instruction mixes for the benchmark mode, each instruction emulated over
+ * and over (as happens e.g. for a guest polling an emulated device
+ * register).  Memory operands are (%rAX), (%rSI), or (%rDI), all pointing
+ * into the scratch area.
+ */
+enum bench_req {
+    BENCH_ANY,
+    BENCH_SSE2,
+    BENCH_AVX,
+};
+
+static const struct bench_insn {
+    const char *class;
+    const char *name;
+    enum bench_req req;
+    unsigned int len;
+    uint8_t insn[8];
+    uint32_t ecx; /* If zero, 1 (i.e. the repeat count). */
+} bench_insns[] = {
+    { "mmio", "load",          BENCH_ANY,  2, { 0x8b, 0x08 } },
+    { "mmio", "store",         BENCH_ANY,  2, { 0x89, 0x08 } },
+    { "mmio", "load-movzx",    BENCH_ANY,  3, { 0x0f, 0xb7, 0x08 } },
+    { "mmio", "store-imm",     BENCH_ANY,  7,
+      { 0xc7, 0x40, 0x04, 0x78, 0x56, 0x34, 0x12 } },
+    { "mmio", "load-disp32",   BENCH_ANY,  6,
+      { 0x8b, 0x88, 0x00, 0x01, 0x00, 0x00 } },
+    { "string", "movsl",       BENCH_ANY,  1, { 0xa5 } },
+    { "string", "stosl",       BENCH_ANY,  1, { 0xab } },
+    { "string", "lodsl",       BENCH_ANY,  1, { 0xad } },
+    { "string", "rep-movsb",   BENCH_ANY,  2, { 0xf3, 0xa4 } },
+    { "string", "rep-stosl",   BENCH_ANY,  2, { 0xf3, 0xab } },
+    { "simd", "movdqu-load",   BENCH_SSE2, 4, { 0xf3, 0x0f, 0x6f, 0x00 } },
+    { "simd", "movdqu-store",  BENCH_SSE2, 4, { 0xf3, 0x0f, 0x7f, 0x00 } },
+    { "simd", "movaps-load",   BENCH_SSE2, 3, { 0x0f, 0x28, 0x00 } },
+    { "simd", "vmovdqu-load",  BENCH_AVX,  4, { 0xc5, 0xfe, 0x6f, 0x00 } },
+    { "simd", "vmovdqu-store", BENCH_AVX,  4, { 0xc5, 0xfe, 0x7f, 0x00 } },
+    { "priv", "mov-from-cr0",  BENCH_ANY,  3, { 0x0f, 0x20, 0xc0 } },
+    { "priv", "mov-from-cr4",  BENCH_ANY,  3, { 0x0f, 0x20, 0xe0 } },
+    { "priv", "rdmsr",         BENCH_ANY,  2, { 0x0f, 0x32 }, 0xc0000080 },
+    { "priv", "cpuid",         BENCH_ANY,  2, { 0x0f, 0xa2 } },
+};
+
+static bool bench_usable(enum bench_req req)
+{
+    switch ( req )
+    {
+    case BENCH_SSE2: return cpu_has_sse2;
+    case BENCH_AVX:  return cpu_has_avx;
+    default:         return true;
+    }
+}
+
+/*
+ * The benchmark's memory accesses model hvmemul_insn_fetch() copying out of
+ * the prefetched instruction buffer, rather than incurring the FPU state
+ * saving of the memcpy() wrapper.
+ */
+static void bench_copy(void *dst, const void *src, unsigned int bytes)
+{
+    asm volatile ( "rep movsb"
+                   : "+D" (dst), "+S" (src), "+c" (bytes) :: "memory" );
+}
+
+static int bench_read(
+    enum x86_segment seg,
+    unsigned long offset,
+    void *p_data,
+    unsigned int bytes,
+    struct x86_emulate_ctxt *ctxt)
+{
+    bench_copy(p_data, (void *)offset, bytes);
+    return X86EMUL_OKAY;
+}
+
+static int bench_write(
+    enum x86_segment seg,
+    unsigned long offset,
+    void *p_data,
+    unsigned int bytes,
+    struct x86_emulate_ctxt *ctxt)
+{
+    bench_copy((void *)offset, p_data, bytes);
+    return X86EMUL_OKAY;
+}
+
+/*
+ * Print @total / @reps with two decimals, sticking to integer arithmetic to
+ * not disturb FPU/SIMD state.
+ */
+static void print_per(const char *fmt, uint64_t total, unsigned int reps)
+{
+    printf(fmt, total / reps, (unsigned int)(total * 100 / reps % 100));
+}
+
+static void bench(struct x86_emulate_ctxt *ctxt, char *instr,
+                  unsigned int *res, bool csv, bool cached)
+{
+    static struct x86_emulate_decode_cache decode_cache;
+    struct x86_emulate_ops ops = emulops;
+    struct cpu_user_regs *regs = ctxt->regs;
+    const unsigned int reps = 1 << 18;
+    uint64_t class_tsc = 0, class_ns = 0;
+    unsigned int i, j, class_nr = 0;
+
+    ops.read = bench_read;
+    ops.insn_fetch = bench_read;
+    ops.write = bench_write;
+    if ( cached )
+        ctxt->decode_cache = &decode_cache;
+
+    if ( csv )
+        printf("class,instruction,reps,cycles_per_insn,ns_per_insn\n");
+    else
+        printf("%-8s %-16s %14s %12s\n",
+               "class", "instruction", "cycles/insn", "ns/insn");
+
+    for ( i = 0; i < ARRAY_SIZE(bench_insns); i++ )
+    {
+        const struct bench_insn *b = &bench_insns[i];
+        uint64_t tsc, ns;
+
+        if ( bench_usable(b->req) )
+        {
+            memcpy(instr, b->insn, b->len);
+
+            ns = now_ns();
+            tsc = rdtsc();
+            for ( j = 0; j < reps; j++ )
+            {
+                regs->eflags = X86_EFLAGS_IF | X86_EFLAGS_MBS;
+                regs->eip    = (unsigned long)instr;
+                regs->eax    = (unsigned long)res;
+                regs->ecx    = b->ecx ?: 1;
+                regs->esi    = (unsigned long)res;
+                regs->edi    = (unsigned long)(res + 16);
+                if ( x86_emulate(ctxt, &ops) != X86EMUL_OKAY ||
+                     regs->eip != (unsigned long)instr + b->len )
+                {
+                    printf("%s %s: emulation failed\n", b->class, b->name);
+                    exit(1);
+                }
+            }
+            tsc = rdtsc() - tsc;
+            ns = now_ns() - ns;
+
+            if ( csv )
+            {
+                printf("%s,%s,%u,", b->class, b->name, reps);
+                print_per("%"PRIu64".%02u,", tsc, reps);
+                print_per("%"PRIu64".%02u\n", ns, reps);
+            }
+            else
+            {
+                printf("%-8s %-16s", b->class, b->name);
+                print_per(" %11"PRIu64".%02u", tsc, reps);
+                print_per(" %9"PRIu64".%02u\n", ns, reps);
+            }
+
+            class_tsc += tsc;
+            class_ns += ns;
+            class_nr++;
+        }
+
+        /* Summarise each class once its last instruction was run. */
+        if ( class_nr && (i + 1 == ARRAY_SIZE(bench_insns) ||
+                          strcmp(b->class, bench_insns[i + 1].class)) )
+        {
+            if ( csv )
+            {
+                printf("%s,all,%u,", b->class, reps * class_nr);
+                print_per("%"PRIu64".%02u,", class_tsc, reps * class_nr);
+                print_per("%"PRIu64".%02u\n", class_ns, reps * class_nr);
+            }
+            else
+            {
+                printf("%-8s %-16s", b->class, "(all)");
+                print_per(" %11"PRIu64".%02u", class_tsc, reps * class_nr);
+                print_per(" %9"PRIu64".%02u\n", class_ns, reps * class_nr);
+            }
+
+            class_tsc = class_ns = 0;
+            class_nr = 0;
+        }
+    }
+}
+
 #define EFLAGS_ALWAYS_SET (X86_EFLAGS_IF | X86_EFLAGS_MBS)
 #define EFLAGS_MASK (X86_EFLAGS_ARITH_MASK | EFLAGS_ALWAYS_SET)
 
@@ -398,7 +745,8 @@ int main(int argc, char **argv)
     struct cpu_user_regs regs;
     char *instr;
     unsigned int *res, i, j;
-    bool stack_exec;
+    bool stack_exec, bench_mode = false, bench_csv = false;
+    bool bench_cached = false;
     int rc;
 #ifndef __x86_64__
     unsigned int bcdres_native, bcdres_emul;
@@ -407,8 +755,28 @@ int main(int argc, char **argv)
     /* Disable output buffering. */
     setbuf(stdout, NULL);
 
+    /*
+     * -b runs the benchmark instead of the tests, with -c producing CSV
+     * output for trend tracking, and -d using a decode cache.
+     */
+    for ( i = 1; i < argc; i++ )
+    {
+        if ( !strcmp(argv[i], "-b") )
+            bench_mode = true;
+        else if ( !strcmp(argv[i], "-c") )
+            bench_mode = bench_csv = true;
+        else if ( !strcmp(argv[i], "-d") )
+            bench_mode = bench_cached = true;
+        else
+        {
+            fprintf(stderr, "Usage: %s [-b [-c] [-d]]\n", argv[0]);
+            return 1;
+        }
+    }
+
     ctxt.regs = &regs;
     ctxt.force_writeback = 0;
+    ctxt.decode_cache = NULL;
     ctxt.vendor    = X86_VENDOR_UNKNOWN;
     ctxt.lma       = sizeof(void *) == 8;
     ctxt.addr_size = 8 * sizeof(void *);
@@ -428,6 +796,12 @@ int main(int argc, char **argv)
     if ( !stack_exec )
         printf("Warning: Stack could not be made executable (%d).\n", errno);
 
+    if ( bench_mode )
+    {
+        bench(&ctxt, instr, res, bench_csv, bench_cached);
+        return 0;
+    }
+
  rmw_restart:
     printf("%-40s", "Testing addl %ecx,(%eax)...");
     instr[0] = 0x01; instr[1] = 0x08;
@@ -834,6 +1208,11 @@ int main(int argc, char **argv)
 #endif
     printf("okay\n");
 
+    printf("%-40s", "Testing fast path for plain moves...");
+    if ( !test_simple(&ctxt, instr, res) )
+        goto fail;
+    printf("okay\n");
+
     printf("%-40s", "Testing dec %ax...");
 #ifndef __x86_64__
     instr[0] = 0x66; instr[1] = 0x48;
@@ -0,0 +1,8883 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b155c3,
+0xc031e589, 0x82e85657, 0x81000004, 0x0004d5c6,
+0xc77d8d00, 0x0008bb53, 0xec810000, 0x000000cc,
+0x98054c88, 0xca2811b2, 0xa8055488, 0xe283c289,
+0x01fa8301, 0xe280d219, 0x88cafe02, 0x8db80554,
+0xd0210150, 0x8301f883, 0xc1fe00db, 0x83171c88,
+0x047410fa, 0xc8ebd089, 0x5d6ff9c5, 0x7ff9c598,
+0xffff689d, 0x76d9c5ff, 0x6ff9c5e4, 0xffff6895,
+0x0260b8ff, 0xe9c50000, 0xe2c4cb74, 0x0fcc1779,
+0x0003fd83, 0xfce9c500, 0xf9c5984d, 0xff788d7f,
+0xf9c5ffff, 0xc598756f, 0xb8cefcc9, 0x00000266,
+0x8d74f1c5, 0xffffff78, 0x1779e2c4, 0xcf830fcc,
+0xc5000003, 0x789d6ff9, 0xc5ffffff, 0x984df8e1,
+0x4d7ff9c5, 0x026bb888, 0xe9c50000, 0xc4885574,
+0xd41779e2, 0x03a8830f, 0xf9c50000, 0xc5b84d6f,
+0x985d6ff9, 0xf960f1c5, 0xf168f1c5, 0xbd7ff9c5,
+0xffffff38, 0xb57ff9c5, 0xffffff28, 0xd360e1c5,
+0xcb68e1c5, 0x95d5e9c5, 0xffffff38, 0x8dd5f1c5,
+0xffffff28, 0xbe6ff9c5, 0xffffffc0, 0xedefd1c5,
+0xbd7ff9c5, 0xffffff58, 0xa368e88f, 0xf9c570d1,
+0xc5c87d6f, 0xc5cd64c1, 0xc5cadbf1, 0x884d7ff9,
+0x98f0e98f, 0xf9c5c875, 0xffd0be6f, 0xf9c5ffff,
+0xff48bd7f, 0xf9c5ffff, 0xc5c87d6f, 0x48bdf8c1,
+0xc5ffffff, 0xc87d7ff9, 0x98f0e98f, 0x2cb8c84d,
+0xc5000003, 0xc5f9fcf1, 0xc4fe74c1, 0xfc1779e2,
+0x02fc830f, 0xd1c50000, 0xb8c86df8, 0x00000331,
+0x9850e98f, 0x74f1c5c9, 0xe2c4884d, 0x0fcc1779,
+0x0002dd83, 0x6ff9c500, 0xf1c5a84d, 0xf1c5e960,
+0xd1c5f168, 0xff38add5, 0xf9c5ffff, 0xff68957f,
+0xc9c5ffff, 0xff28b5d5, 0xe88fffff, 0x58ada3d0,
+0x60ffffff, 0xad7ff9c5, 0xffffff78, 0x3c69e2c4,
+0xffff78ad, 0x69e2c4ff, 0xff789538, 0xf9c5ffff,
+0xff78957f, 0xd1c5ffff, 0xff7895fc, 0x48b8ffff,
+0xc5000003, 0xc5ea60e9, 0xc5d268e9, 0x38add5d1,
+0xc5ffffff, 0x2895d5e9, 0x8fffffff, 0xada3d0e8,
+0xffffff58, 0xfce1c520, 0x74d1c5d1, 0x79e2c4ea,
+0x830fec17, 0x0000024a, 0x00034fb8, 0x79e2c400,
+0xff68951c, 0xe1c5ffff, 0xe2c4da74, 0x0fdc1779,
+0x00022d83, 0x0354b800, 0xf9c50000, 0xc5b85d6f,
+0x48ad6ff9, 0xc4ffffff, 0xd30851e2, 0xd274e1c5,
+0x1779e2c4, 0x07830fd4, 0xc5000002, 0xc5d5f8f1,
+0x98756ff9, 0x000359b8, 0x49e2c400, 0xf1c5d200,
+0xe2c4d274, 0x0fd41779, 0x0001e583, 0xf8f1c500,
+0x6ff9c5d5, 0x5eb89875, 0x8f000003, 0xd6a348e8,
+0x6ff9c520, 0x74f1c5ec, 0x79e2c4d2, 0x830fd417,
+0x000001be, 0x5560f1c5, 0x68f1c598, 0xe9c59865,
+0xe1c5d4f8, 0xf9c5f368, 0xff38b57f, 0xe9c5ffff,
+0xe9c5e260, 0xe9c5d268, 0xff3895d5, 0xe1c5ffff,
+0xc1c5fb60, 0x70b8e4d5, 0x8f000003, 0xa5a3d8e8,
+0xffffff58, 0x74d9c520, 0xffffe0a6, 0x79e2c4ff,
+0x830fe517, 0x0000016a, 0x556ff9c5, 0x68e9c598,
+0xd5d9c5e2, 0xffff38a5, 0x60e9c5ff, 0xd5c9c5f2,
+0xefc1c5f7, 0xc8e88fff, 0xff58a5a3, 0x8f40ffff,
+0xffcc60e8, 0x7ff9c500, 0xffff68a5, 0x60d9c5ff,
+0x6ff9c5e7, 0xffff68b5, 0x79e2c4ff, 0x7ab8f620,
+0xc5000003, 0xc4e674d9, 0xe51779e2, 0x0110830f,
+0xc1c50000, 0xc9c5ff60, 0xf9c5f760, 0xff68a56f,
+0xe2c4ffff, 0xb8e42179, 0x00000382, 0xf474c9c5,
+0x1779e2c4, 0xe7830ff5, 0xc5000000, 0xc5ff60c1,
+0xc5ff60d9, 0x78bd7ff9, 0xc5ffffff, 0x68b56ff9,
+0xc4ffffff, 0xe62279e2, 0x657ff9c5, 0x038bb888,
+0xd9c50000, 0xe2c4f774, 0x0ff51779, 0x0000b183,
+0xa8c03100, 0x6ff9c501, 0xc50475e1, 0xc5e26ff9,
+0xd8657ff9, 0xd805548a, 0x78059488, 0x40ffffff,
+0x7510f883, 0xefd9c5de, 0x03c4b8e4, 0xe1c50000,
+0xe88fdc64, 0x30c9a268, 0xdb76e1c5, 0x8d74f1c5,
+0xffffff78, 0x1779e2c4, 0xc46773cb, 0xca0f69e3,
+0xdbe9c501, 0xfffff096, 0x03e4b8ff, 0xe9c50000,
+0xff4895fc, 0xf1c5ffff, 0xe2c4ca74, 0x73cb1779,
+0x0004b841, 0xe98f0000, 0xa855e178, 0xe178e98f,
+0xf1c5984d, 0xe9c5ca63, 0x8f48d2ef, 0xc9c178e9,
+0xca63f1c5, 0xc031f475, 0xd2efe9c5, 0xca74f1c5,
+0x1779e2c4, 0xc0920fcb, 0x1901f883, 0x040125c0,
+0xc4810000, 0x000000cc, 0x5d5f5e5b, 0x24348bc3,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0002374,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x57000000, 0xe856c031, 0x00000359,
+0x0390c681, 0x7d8d0000, 0xec8153c7, 0x0000008c,
+0x98055488, 0xd32811b3, 0xa8055c88, 0xe383c389,
+0x88cbfe01, 0x89b8055c, 0xc32140c3, 0x8301fb83,
+0xc2fe00d9, 0x83070c88, 0xd47510f8, 0x7d6ff9c5,
+0x7ff9c598, 0xffff68bd, 0x76f1c5ff, 0x6ff9c5c9,
+0xffff689d, 0x0260b8ff, 0xe1c50000, 0xe2c4d774,
+0x0fd11779, 0x0002e583, 0xfce1c500, 0xf9c59855,
+0xff78957f, 0xf9c5ffff, 0xc5987d6f, 0xb8d7fcc1,
+0x00000266, 0x9574e9c5, 0xffffff78, 0x1779e2c4,
+0xb7830fd1, 0xc5000002, 0x78bd6ff9, 0xc5ffffff,
+0x9855f8c1, 0x557ff9c5, 0x026bb888, 0xe1c50000,
+0xc4886574, 0xe11779e2, 0x0290830f, 0xe1c50000,
+0xc5a85deb, 0x689d7ff9, 0xc5ffffff, 0xa855dbe9,
+0x7d6ff9c5, 0xefc1c588, 0x77b8a865, 0xc5000002,
+0x6895dfe9, 0xc5ffffff, 0xc5db76e1, 0xc4d474e9,
+0xd11779e2, 0x0254830f, 0xd1c50000, 0xf9c5edef,
+0x8fc87d6f, 0xd5cc40e8, 0xdbe9c505, 0xe98f9855,
+0xc87d98e8, 0x65fce1c5, 0x7ff9c5c8, 0xe98fc865,
+0xc86598e8, 0x00032cb8, 0xfcd9c500, 0x74c9c5f4,
+0x79e2c4f7, 0x830ff117, 0x00000212, 0x6df8d1c5,
+0x0331b8c8, 0xe98f0000, 0xc5e49450, 0xc4d474e9,
+0xd11779e2, 0x01f4830f, 0xf9c50000, 0xc598656f,
+0xa855dad9, 0x6dded9c5, 0xfcd9c5a8, 0xe9c5a865,
+0x3fb8d5fc, 0xc5000003, 0xc4d474e9, 0xd11779e2,
+0x01c8830f, 0x54b80000, 0xc5000003, 0xb86d6ff9,
+0xa66ff9c5, 0xffffffd0, 0x0859e2c4, 0x74e9c5d5,
+0x79e2c4d5, 0x830fd117, 0x000001a2, 0x556ff9c5,
+0xfce9c5a8, 0x6ff9c5db, 0x59b89875, 0xc4000003,
+0xdb0049e2, 0xda74e1c5, 0x1779e2c4, 0x7b830fd9,
+0xc5000001, 0xc5dcf8e9, 0x987d6ff9, 0x00035eb8,
+0x40e88f00, 0xc530dfa3, 0xc4da74e1, 0xd91779e2,
+0x0158830f, 0xe9c50000, 0xc5987d60, 0x985d68e9,
+0xf676c9c5, 0xdbfcc9c5, 0x000370b8, 0xf8e1c500,
+0xefe1c5df, 0xefd1c5dd, 0xf8e1c5ee, 0x74e1c5dd,
+0xffffe09e, 0x79e2c4ff, 0x830fd917, 0x0000011e,
+0x3079e2c4, 0xe2c49875, 0xc5ee3079, 0x78b57ff9,
+0xc5ffffff, 0x886d7ff9, 0x7d6ff9c5, 0x79e2c498,
+0x9ab8df30, 0xc5000003, 0xc4de74e1, 0xd91779e2,
+0x00e8830f, 0xf9c50000, 0xc498756f, 0xde3179e2,
+0x0003a1b8, 0x74e1c500, 0x79e2c4dd, 0x830fd917,
+0x000000ca, 0x756ff9c5, 0x79e2c498, 0xf9c5de32,
+0xff689d7f, 0xa8b8ffff, 0xc4000003, 0xed3079e2,
+0xdd74e1c5, 0x1779e2c4, 0x9f830fd9, 0x31000000,
+0x6ff9c5c0, 0x01a8985d, 0xea6ff9c5, 0xf9c50475,
+0xf9c5eb6f, 0x8ad86d7f, 0x88d80554, 0xff780594,
+0x8340ffff, 0xde7510f8, 0xa2e0e88f, 0xb820b855,
+0x000003c4, 0x9574e9c5, 0xffffff78, 0x1779e2c4,
+0xc45b73d1, 0xd30f61e3, 0xdbe1c501, 0xfffff0ae,
+0xfcd1c5ff, 0x74e9c5e4, 0x03e4b8d4, 0xe2c40000,
+0x73d11779, 0x0004ba39, 0xf9c50000, 0xff689d7f,
+0xe9c5ffff, 0x8f4ad2ef, 0x8dd178e9, 0xffffff68,
+0xc967e9c5, 0x8d7ff9c5, 0xffffff68, 0xe3c4e875,
+0x0fc81479, 0xf8b8883c, 0x0f000003, 0xc481c244,
+0x0000008c, 0x5d5f5e5b, 0x24348bc3, 0x000000c3,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x00000000, 0x00000000, 0x00000000,
+0001674,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i2[] = {
+0x83e58955, 0x5be8f0e4, 0xc9000001, 0x01b855c3,
+0x89000000, 0x0009b9e5, 0xec830000, 0x44896648,
+0xca89c645, 0x4544c766, 0x290001e6, 0x548966c2,
+0x8340d645, 0xe57509f8, 0x5d6ff9c5, 0x6ff9c5e8,
+0xe9c5c855, 0xf9c5f3fd, 0xc5d84d6f, 0xb85d7ff9,
+0xf1d5c9c5, 0xdb76e1c5, 0x9570e88f, 0xb810c865,
+0x00000041, 0xe675d9c5, 0x1779e2c4, 0xf1830fe3,
+0xc5000000, 0xc5e4efd9, 0xc5e9f9d9, 0xc5f6f9d9,
+0xc87dd5d1, 0x000045b8, 0xf9c1c500, 0x75c1c5f9,
+0x79e2c4fe, 0x830ffb17, 0x000000c8, 0x55f9e9c5,
+0xd5e9c5b8, 0xd5f1c5d1, 0x49b8c875, 0xc5000000,
+0xc5f1f9c9, 0xc4f275c9, 0xf31779e2, 0x00a2830f,
+0xd9c50000, 0xe88fd2f9, 0xc86d9550, 0x004db810,
+0xd1c50000, 0xe2c4ea75, 0x0feb1779, 0x00008383,
+0x6ff9c500, 0xc9c5c875, 0xc9c5f9fd, 0xb8e86dd5,
+0x00000054, 0x55fdd1c5, 0x7ff9c5d8, 0xe9c5b86d,
+0xe2c4d775, 0x73d31779, 0xf9d9c55b, 0xf9d9c5d6,
+0xd5e9c5e7, 0x58b8e855, 0xc5000000, 0xd86df9e9,
+0xe575d9c5, 0x1779e2c4, 0xc53973e3, 0xb87d6ff9,
+0x6df9c1c5, 0xf9c9c5d8, 0x005cb8e1, 0xd1c50000,
+0xe2c4ec75, 0x73eb1779, 0xfde9c51b, 0xf1c5d855,
+0x60b8cef9, 0xc5000000, 0xc4d175e9, 0xd31779e2,
+0xc0310273, 0xd0e8c3c9, 0x81000005, 0x000625c2,
+0xe5895500, 0x10be5657, 0x53000000, 0xec81db31,
+0x000000ac, 0x8dc3b70f, 0xbf0f0148, 0x48bd89f9,
+0xbfffffff, 0x00000008, 0xd889c729, 0x0f01e083,
+0xf883ffbf, 0x01438d01, 0xe183c919, 0xd8854902,
+0x664e0175, 0xa6457c89, 0xff489d8b, 0xf883ffff,
+0x4c896608, 0x8966b645, 0x66c64574, 0x96455c89,
+0xc3890474, 0xf9c5aeeb, 0xc598756f, 0x68b57ff9,
+0xc5ffffff, 0xc5c976f1, 0x68956ff9, 0xb8ffffff,
+0x00000260, 0xde75e9c5, 0x1779e2c4, 0x2d830fd9,
+0xc5000005, 0x985dfde9, 0x9d7ff9c5, 0xffffff78,
+0x756ff9c5, 0x71e1c598, 0x66b801f6, 0xc5000002,
+0x789d75e1, 0xc4ffffff, 0xd91779e2, 0x04fe830f,
+0xf9c50000, 0xff78b56f, 0xc9c5ffff, 0xc5985df9,
+0x885d7ff9, 0x00026bb8, 0x75e9c500, 0xe2c4885d,
+0x0fd91779, 0x0004d783, 0x6ff9c500, 0xe9c5a875,
+0xc59855d5, 0xc5e6d5c9, 0x985d6ff9, 0xf6fde1c5,
+0x6df9e1c5, 0xf9e9c5a8, 0x0282b8d4, 0xd1c50000,
+0xe9c5eed5, 0xe2c4d575, 0x0fd11779, 0x00049f83,
+0xd5e1c500, 0xd3b8a855, 0xc5000002, 0xb09275e9,
+0xc4ffffff, 0xd11779e2, 0x0482830f, 0xe1c50000,
+0xc5b865e5, 0xc5d2efe9, 0xb86d6ff9, 0x0002dab8,
+0x50e88f00, 0xc500d2cd, 0xc4d475e9, 0xd11779e2,
+0x045a830f, 0xd1c50000, 0xf9c5d3d5, 0xc588557f,
+0x88756ff9, 0xf671d9c5, 0x7ff9c503, 0xffff68a5,
+0x6ff9c5ff, 0xe9c58875, 0xc502f671, 0x78957ff9,
+0xc5ffffff, 0xb8d2fde9, 0x000002f8, 0xd475e9c5,
+0x1779e2c4, 0x15830fd1, 0xc5000004, 0x68b56ff9,
+0xc5ffffff, 0x02e671e9, 0xd2fde9c5, 0x0002fdb8,
+0x75e9c500, 0xffff7895, 0x79e2c4ff, 0x830fd117,
+0x000003ec, 0xff6485c7, 0x0003ffff, 0xe1c50000,
+0x858be5d5, 0xffffff64, 0xff488589, 0xf8c1ffff,
+0x4c85891f, 0xc5ffffff, 0x48b57efa, 0xc5ffffff,
+0xc7d6f1d9, 0xffff6485, 0x000002ff, 0x64858b00,
+0x89ffffff, 0xffff4885, 0x1ff8c1ff, 0xff4c8589,
+0xfac5ffff, 0xff48b57e, 0xd9c5ffff, 0xf9c5e6f1,
+0xff78a57f, 0xd9c5ffff, 0x10b8e4fd, 0xc5000003,
+0xc4e275d9, 0xe11779e2, 0x0372830f, 0x858b0000,
+0xffffff64, 0xff488589, 0xf8c1ffff, 0x4c85891f,
+0xc5ffffff, 0x48b57efa, 0xc5ffffff, 0xc5d6e1e9,
+0xb8d2fde9, 0x00000314, 0x9575e9c5, 0xffffff78,
+0x1779e2c4, 0x35830fd1, 0xc5000003, 0xc5f5d5e1,
+0xc5e4efd9, 0xc87d6ff9, 0xd465c1c5, 0xd6dbe9c5,
+0x557ff9c5, 0xe8e98f88, 0xc5c87599, 0x48b57ff9,
+0xc5ffffff, 0xc87d6ff9, 0xb26ff9c5, 0xffffffc0,
+0xfef9c1c5, 0x7d7ff9c5, 0xe8e98fc8, 0xb8c85599,
+0x0000032c, 0xfafde9c5, 0xbd75c1c5, 0xffffff48,
+0x1779e2c4, 0xd5830ff9, 0xc5000002, 0xc87df9d9,
+0x000331b8, 0x40e98f00, 0xe9c5d299, 0xc4885575,
+0xd11779e2, 0x02b6830f, 0xd1c50000, 0xc5a855d5,
+0xc5fbd5d1, 0x78957ff9, 0xc5ffffff, 0x7895eec1,
+0xc5ffffff, 0x78bdeac1, 0xc5ffffff, 0x78bd7ff9,
+0xc5ffffff, 0x7895fde9, 0xb8ffffff, 0x00000348,
+0x7dfde1c5, 0xd5e9c5a8, 0x75e9c5d5, 0x79e2c4d7,
+0x830fd117, 0x00000268, 0xebd5d1c5, 0xad7ff9c5,
+0xffffff68, 0x00034fb8, 0x79e2c400, 0xff68951d,
+0xe1c5ffff, 0xe2c4da75, 0x0fd91779, 0x00023f83,
+0x0354b800, 0xf9c50000, 0xc4b8556f, 0xda0949e2,
+0xdb75e9c5, 0x1779e2c4, 0x21830fd9, 0xb8000002,
+0x00000359, 0x6d70fbc5, 0xf9c51b98, 0xc5a85d6f,
+0x1bed70fa, 0xed70f9c5, 0x75e1c54e, 0x79e2c4ed,
+0x830fe917, 0x000001f8, 0xf371d1c5, 0x035eb801,
+0xd1c50000, 0xd1c5fef9, 0xffd0aaf9, 0xe88fffff,
+0x08ffc178, 0xefebd1c5, 0x7d6ff9c5, 0x40e88f98,
+0xc550efa3, 0xc4eb75d1, 0xe91779e2, 0x01be830f,
+0xe1c50000, 0xc5986d61, 0x987d69e1, 0xeff9d1c5,
+0x000370b8, 0xd5d1c500, 0x75d1c5ea, 0xffffe0aa,
+0x79e2c4ff, 0x830fe917, 0x00000194, 0x6dd5e9c5,
+0x68e88f98, 0xc500e4cd, 0x68ad7ff9, 0xc5ffffff,
+0xc5fc61d1, 0x68ad6ff9, 0xc4ffffff, 0xed2379e2,
+0x00037ab8, 0x75c1c500, 0x79e2c4fd, 0x830ff917,
+0x0000015c, 0xe461d9c5, 0xec61d1c5, 0xad7ff9c5,
+0xffffff78, 0xbd6ff9c5, 0xffffff68, 0x2479e2c4,
+0x7ff9c5e7, 0x82b88865, 0xc5000003, 0xc4e575d9,
+0xe11779e2, 0x0126830f, 0xc0310000, 0x4d6ff9c5,
+0xc501a898, 0x75e36ff9, 0x6ff9c504, 0x7ff9c5e1,
+0x8b66d865, 0x66d8454c, 0x78458c89, 0x40ffffff,
+0x7508f883, 0xefd9c5dc, 0x03c4b8e4, 0xe9c50000,
+0xe88fd465, 0x20cba270, 0x9d6ff9c5, 0xffffff78,
+0x4d7ff9c5, 0x76e9c588, 0x75e1c5d2, 0x79e2c4c9,
+0x830fca17, 0x000000c8, 0x0003d4b8, 0x6ff9c500,
+0xe3c4984d, 0xa8650e71, 0x75e1c5aa, 0x79e2c4dc,
+0x830fda17, 0x000000a8, 0x0f71e3c4, 0xf1c502d9,
+0xfff0a2db, 0xd9c5ffff, 0xe1c5e6fd, 0xe4b8dc75,
+0xc5000003, 0x78a57ff9, 0xc4ffffff, 0xda1779e2,
+0x03b87e73, 0xc5000000, 0x688d7ff9, 0xc5ffffff,
+0x48dbefe1, 0xc678e98f, 0xffff688d, 0x6be1c5ff,
+0x7ff9c5c9, 0xffff688d, 0xc5e875ff, 0x07d1c5f9,
+0xb824fa83, 0x000003f8, 0x01b84675, 0x8f000004,
+0x65e278e9, 0x78e98fa8, 0xc5984de2, 0x8fcc6bf1,
+0xc9c678e9, 0xcb6bf1c5, 0xc678e98f, 0x6bf1c5c9,
+0x78e98fcb, 0xf1c5c9c6, 0xe1c5cb6b, 0xf1c5dbef,
+0xe2c4cb75, 0x73ca1779, 0xf8dfe807, 0xd8f7ffff,
+0x00acc481, 0x5e5b0000, 0x8bc35d5f, 0x00c32414,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00020002, 0x00020002, 0x00020002, 0x00020002,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0003634,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x04c1e8c3,
+0xc2810000, 0x0000051e, 0x8955c031, 0x535657e5,
+0x000010bb, 0xacec8100, 0x89000000, 0xffff4885,
+0xc8b70fff, 0x0f01718d, 0x08befeb7, 0x29000000,
+0x83c189ce, 0x494001e1, 0x85f6b70f, 0xffff4885,
+0xc9b70fff, 0x664b0175, 0x96457c89, 0x6608f883,
+0xa6457489, 0x454c8966, 0x5c8966b6, 0xbb75c645,
+0x756ff9c5, 0x7ff9c598, 0xffff68b5, 0x76f1c5ff,
+0x6ff9c5c9, 0xffff689d, 0x0260b8ff, 0xe1c50000,
+0xe2c4d675, 0x0fd11779, 0x00042b83, 0xfde1c500,
+0xf9c59855, 0xff78957f, 0xf9c5ffff, 0xc598756f,
+0x01f671e9, 0x000266b8, 0x75e9c500, 0xffff7895,
+0x79e2c4ff, 0x830fd117, 0x000003fc, 0xb56ff9c5,
+0xffffff78, 0x55f9c9c5, 0x7ff9c598, 0x6bb88855,
+0xc5000002, 0x886575e1, 0x1779e2c4, 0xd5830fe1,
+0xc5000003, 0xa85debe1, 0x9d7ff9c5, 0xffffff68,
+0x55dbe9c5, 0x6ff9c5a8, 0xc9c58875, 0xb8a85def,
+0x00000277, 0x95dfe9c5, 0xffffff68, 0xd375e9c5,
+0x1779e2c4, 0x9d830fd1, 0xc5000003, 0x98556ff9,
+0x5dd5e9c5, 0x02d3b8a8, 0xe1c50000, 0xffb09a75,
+0xe2c4ffff, 0x0fd91779, 0x00037b83, 0xe4e9c500,
+0xe9c5b865, 0xc5b85ddb, 0xb85dfde1, 0x0002dcb8,
+0x75e1c500, 0x79e2c4dc, 0x830fd917, 0x00000358,
+0x557ff9c5, 0x6ff9c588, 0xd9c5887d, 0xc503f771,
+0x68a57ff9, 0xc5ffffff, 0x88756ff9, 0xf671e1c5,
+0x7ff9c502, 0xffff789d, 0xfde1c5ff, 0x02f8b8db,
+0xe1c50000, 0xe2c4dc75, 0x0fd91779, 0x00031783,
+0x6ff9c500, 0xffff68bd, 0x71e1c5ff, 0xe1c502d7,
+0xfdb8dbfd, 0xc5000002, 0x789d75e1, 0xc4ffffff,
+0xd91779e2, 0x02ee830f, 0x85c70000, 0xffffff64,
+0x00000003, 0x9d6ef9c5, 0xffffff64, 0xdbf1e9c5,
+0xff6485c7, 0x0002ffff, 0xf9c50000, 0xff64a56e,
+0xe9c5ffff, 0xf9c5e4f1, 0xff78a57f, 0xd9c5ffff,
+0x10b8e4fd, 0xc5000003, 0xc4e375d9, 0xe11779e2,
+0x02a2830f, 0xf9c50000, 0xff64a56e, 0xe1c5ffff,
+0xe1c5dcd1, 0x14b8dbfd, 0xc5000003, 0x789d75e1,
+0xc4ffffff, 0xd91779e2, 0x027a830f, 0xd1c50000,
+0xf9c5edef, 0x8fc8756f, 0xddcd48e8, 0xdbe1c505,
+0xe0e98fda, 0xc5c87d99, 0x48bd7ff9, 0xc5ffffff,
+0xc5f676c9, 0xc865fdc9, 0x657ff9c5, 0xe0e98fc8,
+0xb8c86599, 0x0000032c, 0xfcfdd9c5, 0xbd75c1c5,
+0xffffff48, 0x1779e2c4, 0x29830ff9, 0xc5000002,
+0xc86df9d1, 0x000331b8, 0x50e98f00, 0xe1c5e495,
+0xe2c4dc75, 0x0fd91779, 0x00020b83, 0x69e2c400,
+0xc4a85d3a, 0x653e69e2, 0xfde9c5a8, 0xe1c5a855,
+0x3fb8dcfd, 0xc5000003, 0xc4d275e1, 0xd11779e2,
+0x01e2830f, 0x54b80000, 0xc5000003, 0xb86d6ff9,
+0xa26ff9c5, 0xffffffc0, 0x0959e2c4, 0x75e9c5d5,
+0x79e2c4d5, 0x830fd117, 0x000001bc, 0x000359b8,
+0x70fbc500, 0xc51b9855, 0xa85d6ff9, 0xd270fac5,
+0x70f9c51b, 0xe1c54ed2, 0xe2c4d275, 0x0fd11779,
+0x00019383, 0x71e9c500, 0x5eb801f3, 0xc5000003,
+0xc5fcf9e9, 0xd092fde9, 0x8fffffff, 0xffc178e8,
+0xebe9c508, 0x6ff9c5d7, 0xe88f987d, 0x20d7a340,
+0xd375e9c5, 0x1779e2c4, 0x59830fd1, 0xc5000001,
+0x987d61e1, 0x5569e1c5, 0xfdc9c598, 0x0370b8d2,
+0xe9c50000, 0xe9c5d7f9, 0xd1c5d5ef, 0xe9c5eeef,
+0xe9c5d5f9, 0xffe09275, 0xe2c4ffff, 0x0fd11779,
+0x00012383, 0x79e2c400, 0xc4986d33, 0xd53379e2,
+0xad7ff9c5, 0xffffff78, 0x557ff9c5, 0x6ff9c588,
+0xe2c49875, 0xb8d63379, 0x0000039a, 0xd575e9c5,
+0x1779e2c4, 0xed830fd1, 0xc5000000, 0x98756ff9,
+0x3479e2c4, 0x7ff9c5d6, 0xffff6895, 0x03a1b8ff,
+0xe9c50000, 0xc4885575, 0xd11779e2, 0x00c6830f,
+0xc0310000, 0x4d6ff9c5, 0xc501a898, 0x75d36ff9,
+0x6ff9c504, 0x7ff9c5d1, 0x8b66d855, 0x66d8454c,
+0x78458c89, 0x40ffffff, 0x7508f883, 0xf0e88fdc,
+0x30b84da2, 0x956ff9c5, 0xffffff78, 0xdb76e1c5,
+0xc975e9c5, 0x0003c4b8, 0x79e2c400, 0x7873cb17,
+0x0003d4b8, 0x6ff9c500, 0xe3c4984d, 0xa86d0e71,
+0x75e9c5aa, 0x79e2c4d5, 0x5c73d317, 0x0f71e3c4,
+0xf1c502d1, 0xfff0aadb, 0xd1c5ffff, 0xe9c5e4fd,
+0xe4b8d475, 0xc4000003, 0xd31779e2, 0x03ba3a73,
+0xc5000000, 0x688d7ff9, 0xc5ffffff, 0x4ad2efe9,
+0xd678e98f, 0xffff688d, 0x69e2c4ff, 0xf9c5c92b,
+0xff688d7f, 0xe775ffff, 0xc1c5f9c5, 0x24f88307,
+0x0003f8b8, 0xc2440f00, 0x00acc481, 0x5e5b0000,
+0x8bc35d5f, 0x00c32414, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0xfffefffe, 0xfffefffe, 0xfffefffe, 0xfffefffe,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00000000, 0x00000000, 0x00000000,
+0002474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i4[] = {
+0x83e58955, 0x7de8f0e4, 0xc9000001, 0x8ee855c3,
+0x81000006, 0x00071dc2, 0x83e58900, 0x45c738ec,
+0x000001d8, 0xe845c700, 0x00000004, 0x02dc45c7,
+0xc7000000, 0x0003ec45, 0x45c70000, 0x000003e0,
+0xf045c700, 0x00000002, 0x04e445c7, 0xc7000000,
+0x0001f445, 0xe1c50000, 0xf9c5db76, 0xb8e84d6f,
+0x00000041, 0x9e70e88f, 0xc510d855, 0x809276e9,
+0xc4ffffff, 0xd31779e2, 0x0108830f, 0xd1c50000,
+0xd1c5edef, 0x45b8d1fa, 0xc4000000, 0x654069e2,
+0xfad9c5d8, 0x76d9c5e1, 0xffff90a2, 0x79e2c4ff,
+0x830fe317, 0x000000de, 0x4071e2c4, 0x49b8d865,
+0xc5000000, 0xc5e1fad9, 0xa0a276d9, 0xc4ffffff,
+0xe31779e2, 0x00bc830f, 0x4db80000, 0x8f000000,
+0x559e68e8, 0xe9c510d8, 0xffb09276, 0xe2c4ffff,
+0x0fd31779, 0x00009d83, 0x0001b800, 0xe3c40000,
+0x00f82251, 0x2241e3c4, 0xe3c401f8, 0x02f82241,
+0x2241e3c4, 0xf9c503f8, 0xc5d8756f, 0xc5e1fec9,
+0xc8657ff9, 0x4041e2c4, 0x0054b8e6, 0xd9c50000,
+0xc5e855fe, 0xc85576e9, 0x1779e2c4, 0xc55773d3,
+0xb8d6fad1, 0x00000058, 0x6dfad1c5, 0x69e2c4c8,
+0xe9c5d740, 0xc5e87dfa, 0xc4fd76c1, 0xfb1779e2,
+0xd9c53473, 0xc5e865fa, 0xb8e9fac9, 0x0000005c,
+0xe576d9c5, 0x1779e2c4, 0xc51b73e3, 0xe855fee9,
+0xcefaf1c5, 0x000060b8, 0x76e9c500, 0x79e2c4d1,
+0x0273d317, 0xc3c9c031, 0x000518e8, 0xa3c18100,
+0x31000005, 0xe58955c0, 0x0005bf57, 0x53560000,
+0x000020bb, 0x9cec8100, 0x89000000, 0x40fa89c6,
+0x9589c229, 0xffffff60, 0xe283f289, 0x01fa8301,
+0xe283d219, 0xf0854a02, 0x894b0175, 0x8ba48544,
+0xffff60b5, 0x04f883ff, 0xc4855489, 0xd4855c89,
+0xb4857489, 0xf9c5c575, 0xc5a86d6f, 0x78ad7ff9,
+0xc5ffffff, 0xc5c976f1, 0x78956ff9, 0xb8ffffff,
+0x00000260, 0xdd76e9c5, 0x1779e2c4, 0x83830fd9,
+0xc5000004, 0xa85dfee9, 0x5d7ff9c5, 0x6ff9c588,
+0xe1c5a86d, 0xb801f572, 0x00000266, 0x5d76e1c5,
+0x79e2c488, 0x830fd917, 0x0000045a, 0x6d6ff9c5,
+0xfad1c588, 0xf9c5a85d, 0xb8985d7f, 0x0000026b,
+0x5d76e9c5, 0x79e2c498, 0x830fd917, 0x00000436,
+0x7d6ff9c5, 0x69e2c4b8, 0xc4a85d40, 0xe74041e2,
+0x556ff9c5, 0xfee9c5a8, 0xfae9c5f7, 0xe1c5b86d,
+0x82b8dcfa, 0xc4000002, 0xee4051e2, 0xdd76e1c5,
+0x1779e2c4, 0xfb830fd9, 0xc4000003, 0x5d4069e2,
+0x02d3b8b8, 0xe1c50000, 0xffc09976, 0xe2c4ffff,
+0x0fd91779, 0x0003dd83, 0xefe9c500, 0xf9c5c85d,
+0xf9c5d87e, 0xff789d7f, 0xe2c4ffff, 0xb85d2861,
+0x89b86df7, 0x458b9845, 0x9c5589c0, 0x89806df7,
+0xecb8a045, 0x89000002, 0xe1c5a455, 0xc4985d76,
+0xd91779e2, 0x039c830f, 0xe2c40000, 0xc8654069,
+0x657ff9c5, 0x6ff9c598, 0xd1c5986d, 0xc503f572,
+0x78ad7ff9, 0xc5ffffff, 0x987d6ff9, 0xf772e1c5,
+0x7ff9c502, 0xe1c5885d, 0xf8b8dbfe, 0xc5000002,
+0xc4dd76e1, 0xd91779e2, 0x0358830f, 0xf9c50000,
+0xff78ad6f, 0xe1c5ffff, 0xc502e572, 0xb8dbfee1,
+0x000002fd, 0x5d76e1c5, 0x79e2c488, 0x830fd917,
+0x00000332, 0xff7485c7, 0x0003ffff, 0x858b0000,
+0xffffff74, 0xff608589, 0xf8c1ffff, 0x6485891f,
+0xc5ffffff, 0x60bd7efa, 0xc5ffffff, 0xc7dff2d9,
+0xffff7485, 0x000002ff, 0x74858b00, 0x89ffffff,
+0xffff6085, 0x1ff8c1ff, 0xff648589, 0xfac5ffff,
+0xff60b57e, 0xd9c5ffff, 0xf9c5e6f2, 0xc588657f,
+0xb8e4fed9, 0x00000310, 0xe376d9c5, 0x1779e2c4,
+0xbf830fe1, 0x8b000002, 0xffff7485, 0x608589ff,
+0xc1ffffff, 0x85891ff8, 0xffffff64, 0xa57efac5,
+0xffffff60, 0xdce2e1c5, 0xdbfee1c5, 0x000314b8,
+0x76e1c500, 0xe2c4885d, 0x0fd91779, 0x00028583,
+0x69e2c400, 0xc5c86d40, 0xc5e4efd9, 0xd87d6ff9,
+0xdc66c1c5, 0xdddbe1c5, 0x5d7ff9c5, 0xe0e98f98,
+0xc5d8759a, 0xd87d6ff9, 0xa96ff9c5, 0xffffffd0,
+0xfdfac1c5, 0x7d7ff9c5, 0xe0e98fd8, 0xb8d85d9a,
+0x0000032c, 0xfbfee1c5, 0xf676c1c5, 0x1779e2c4,
+0x2f830ff1, 0xc5000002, 0xd875fad9, 0x000331b8,
+0x48e98f00, 0xe1c5db9a, 0xc4985d76, 0xd91779e2,
+0x0210830f, 0xf9c50000, 0xc4c8756f, 0x5d4049e2,
+0x49e2c4b8, 0xf9c5fa40, 0xc4885d7f, 0x5d3d41e2,
+0x41e2c488, 0xc5887d39, 0x887d7ff9, 0x5dfee1c5,
+0x0348b888, 0xe9c50000, 0xc4b87dfe, 0xde4061e2,
+0xdf76e1c5, 0x1779e2c4, 0xc7830fd9, 0xc4000001,
+0xf24049e2, 0xb57ff9c5, 0xffffff78, 0x00034fb8,
+0x79e2c400, 0xff789d1e, 0xe9c5ffff, 0xe2c4d376,
+0x0fd11779, 0x00019d83, 0x0354b800, 0xf9c50000,
+0xc4c85d6f, 0xd30a51e2, 0xd276e1c5, 0x1779e2c4,
+0x7f830fd1, 0xb8000001, 0x00000359, 0x5570f9c5,
+0xf9c51ba8, 0xc5b8756f, 0xc4d276c9, 0xd11779e2,
+0x0160830f, 0xc9c50000, 0xc5a85562, 0xa87d6ac9,
+0xd7fae9c5, 0x000370b8, 0x69e2c400, 0xe9c5d340,
+0xffe09176, 0xe2c4ffff, 0x0fd11779, 0x00013583,
+0x61e2c400, 0x8fa85540, 0xfcce60e8, 0x7ff9c500,
+0xffff7895, 0x62e9c5ff, 0x6ff9c5ff, 0xffff7895,
+0x79e2c4ff, 0x7ab8d225, 0xc5000003, 0xc4d776e9,
+0xd11779e2, 0x00fc830f, 0xf9c50000, 0xc5a8556f,
+0xc5dc66e1, 0x88557ef9, 0x1679e3c4, 0xc4029055,
+0x751679e3, 0xe88f018c, 0x30d6a268, 0x1679e3c4,
+0xc5039475, 0x98557ff9, 0x5d6ff9c5, 0x03c4b888,
+0xe1c50000, 0xe2c4d276, 0x0fd11779, 0x0000b583,
+0x03d4b800, 0xf9c50000, 0xc4a8556f, 0x650e69e3,
+0xe1c5ccb8, 0xe2c4dc76, 0x0fd91779, 0x00009583,
+0x69e3c400, 0xc504ca0f, 0xf099dbe9, 0xc5ffffff,
+0xc5ddfee1, 0xc5cb76f1, 0x885d7ff9, 0x0003e4b8,
+0x76e1c500, 0x79e2c4db, 0x6a73cb17, 0x957ff9c5,
+0xffffff78, 0xd2efe9c5, 0x0269e2c4, 0xffff788d,
+0x7ff9c5ff, 0xffff788d, 0x69e2c4ff, 0xff788d02,
+0xf8b8ffff, 0xc4000003, 0xca1679e3, 0x0afa8303,
+0x8d7ff9c5, 0xffffff78, 0xf9c52c75, 0xc4a8656f,
+0x4d0659e2, 0x0401b8b8, 0xe2c40000, 0xc4ca0271,
+0xca0271e2, 0xca76f1c5, 0x1779e2c4, 0xe80773cb,
+0xfffff979, 0xc481d8f7, 0x0000009c, 0x5d5f5e5b,
+0x24148bc3, 0x240c8bc3, 0x000000c3, 0x00000000,
+0x00000008, 0x00000009, 0x00000008, 0x00000005,
+0xfffffff8, 0xfffffff7, 0xfffffff8, 0xfffffffb,
+0x00000000, 0x00000003, 0x00000004, 0x00000003,
+0x00000000, 0xfffffffd, 0xfffffffc, 0xfffffffd,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0003474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x045ee8c3,
+0xc1810000, 0x000004ae, 0x000020ba, 0x55c03100,
+0xbf57e589, 0x00000005, 0xec815356, 0x0000009c,
+0xfb89c689, 0x89c32940, 0xffff589d, 0x83f389ff,
+0x854b01e3, 0x4a0175f0, 0xa4854489, 0xff58b58b,
+0xf883ffff, 0x855c8904, 0x855489c4, 0x857489d4,
+0xc5cd75b4, 0xa8756ff9, 0xb57ff9c5, 0xffffff78,
+0xc976f1c5, 0x9d6ff9c5, 0xffffff78, 0x000260b8,
+0x76e1c500, 0x79e2c4d6, 0x830fd117, 0x000003d5,
+0x55fee1c5, 0x7ff9c5a8, 0xf9c58855, 0xc5a8756f,
+0x01f672e9, 0x000266b8, 0x76e9c500, 0xe2c48855,
+0x0fd11779, 0x0003ac83, 0x6ff9c500, 0xc1c5887d,
+0xc5a855fa, 0x98557ff9, 0x00026bb8, 0x76e1c500,
+0xe2c49865, 0x0fe11779, 0x00038883, 0xebe1c500,
+0xf9c5b85d, 0xff789d7f, 0xe9c5ffff, 0xc5b855db,
+0x98756ff9, 0x5defc9c5, 0x0277b8b8, 0xe9c50000,
+0xff7895df, 0xe9c5ffff, 0xe2c4d376, 0x0fd11779,
+0x00035083, 0x6ff9c500, 0xe2c4a85d, 0xb8554061,
+0x0002d3b8, 0x76e9c500, 0xffffc091, 0x79e2c4ff,
+0x830fd117, 0x0000032d, 0x55efe1c5, 0x7ef9c5c8,
+0x7ff9c5d0, 0xffff7895, 0xf4e9c5ff, 0x65f7b855,
+0x984589b8, 0x89c0458b, 0x65f79c55, 0xa0458980,
+0x0002ecb8, 0xa4558900, 0x5576e9c5, 0x79e2c498,
+0x830fd117, 0x000002ed, 0x5d7ff9c5, 0x6ff9c598,
+0xd9c5987d, 0xc503f772, 0x78a57ff9, 0xc5ffffff,
+0x98756ff9, 0xf672e9c5, 0x7ff9c502, 0xe9c58855,
+0xf8b8d2fe, 0xc5000002, 0xc4d476e9, 0xd11779e2,
+0x02af830f, 0xf9c50000, 0xff78bd6f, 0xe9c5ffff,
+0xc502d772, 0xb8d2fee9, 0x000002fd, 0x5576e9c5,
+0x79e2c488, 0x830fd117, 0x00000289, 0xff7485c7,
+0x0003ffff, 0xf9c50000, 0xff74956e, 0xe1c5ffff,
+0x85c7d2f2, 0xffffff74, 0x00000002, 0xa56ef9c5,
+0xffffff74, 0xe4f2e1c5, 0x657ff9c5, 0xfed9c588,
+0x0310b8e4, 0xd9c50000, 0xe2c4e276, 0x0fe11779,
+0x00024083, 0x6ef9c500, 0xffff74a5, 0xd2e9c5ff,
+0xfee9c5d4, 0x0314b8d2, 0xe9c50000, 0xc4885576,
+0xd11779e2, 0x021b830f, 0xd1c50000, 0xf9c5edef,
+0x8fd8756f, 0xd5ce48e8, 0xdbe9c505, 0xe8e98fd3,
+0xc5d87d9a, 0x58bd7ff9, 0xc5ffffff, 0xc5f676c9,
+0xd865fec9, 0x657ff9c5, 0xe8e98fd8, 0xb8d8659a,
+0x0000032c, 0xfcfed9c5, 0xbd76c1c5, 0xffffff58,
+0x1779e2c4, 0xca830ff9, 0xc5000001, 0xd86dfad1,
+0x000331b8, 0x50e98f00, 0xe9c5e496, 0xe2c4d476,
+0x0fd11779, 0x0001ac83, 0x61e2c400, 0xc4b8553b,
+0x653f61e2, 0xfee1c5b8, 0xe9c5b85d, 0x3fb8d4fe,
+0xc5000003, 0xc4d376e9, 0xd11779e2, 0x0183830f,
+0x54b80000, 0xc5000003, 0xc86d6ff9, 0xa16ff9c5,
+0xffffffd0, 0x0a59e2c4, 0x76e9c5d5, 0x79e2c4d5,
+0x830fd117, 0x0000015d, 0x000359b8, 0x70f9c500,
+0xc51ba855, 0xb85d6ff9, 0xd276e1c5, 0x1779e2c4,
+0x3e830fd1, 0xc5000001, 0xa87d62e1, 0x556ae1c5,
+0xfec9c5a8, 0x0370b8d2, 0xe9c50000, 0xe9c5d7fa,
+0xd1c5d5ef, 0xe9c5eeef, 0xe9c5d5fa, 0xffe09176,
+0xe2c4ffff, 0x0fd11779, 0x00010883, 0x79e2c400,
+0xc5a86d35, 0xa8756ff9, 0x3579e2c4, 0x039ab8d6,
+0xe9c50000, 0xe2c4d576, 0x0fd11779, 0x0000e483,
+0x6ff9c500, 0xe3c4a855, 0x8c5d1679, 0x7ef9c501,
+0xe3c48855, 0x90551679, 0x79e3c402, 0x03945d16,
+0xa2e8e88f, 0xb830c855, 0x000003c4, 0x5d6ff9c5,
+0x76e1c588, 0x79e2c4d2, 0x830fd117, 0x000000a5,
+0x0003d4b8, 0x6ff9c500, 0xe3c4a855, 0xb86d0e69,
+0x76e1c5cc, 0x79e2c4dd, 0x830fd917, 0x00000085,
+0x0f69e3c4, 0xe9c504da, 0xfff0a9db, 0xd1c5ffff,
+0xe1c5e4fe, 0xe4b8dc76, 0xc4000003, 0xd91779e2,
+0xf9c56373, 0xff78957f, 0xe1c5ffff, 0xe2c4dbef,
+0x78950261, 0xc5ffffff, 0x78957ff9, 0xc4ffffff,
+0x950261e2, 0xffffff78, 0x0003f8b8, 0x79e3c400,
+0x8303d216, 0x2d750afa, 0x7d6ff9c5, 0x41e2c4a8,
+0x31b85506, 0x69e2c4c0, 0xe2c4d302, 0xc5d30269,
+0xc4d376e9, 0xd11779e2, 0x83c0920f, 0xc01901f8,
+0x00040125, 0x9cc48100, 0x5b000000, 0xc35d5f5e,
+0xc3240c8b, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000000, 0x00000000, 0x00000000,
+0002314,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x000421e8, 0x5bc28100, 0x89000004, 0x88ec81e5,
+0x89000000, 0xc031dc45, 0x4589c931, 0x89c031ec,
+0xc031d445, 0x31e44589, 0xc845c7c0, 0x00000001,
+0xc7cc4d89, 0x0002d845, 0x45c70000, 0x00003fe8,
+0xd045c700, 0x00000002, 0x01e045c7, 0xc7000000,
+0x003ef045, 0x45890000, 0x6ff9c5f4, 0xf9c5c86d,
+0xc5986d7f, 0xc5d276e9, 0x984d6ff9, 0x000260b8,
+0x71e2c400, 0xe2c4dd29, 0x0fda1779, 0x0003a383,
+0xd4f1c500, 0xf9c5c85d, 0xc5a85d7f, 0xc8756ff9,
+0xf673e1c5, 0x0266b801, 0xe2c40000, 0xa85d2961,
+0x1779e2c4, 0x79830fda, 0xc5000003, 0xa86d6ff9,
+0x5dfbd1c5, 0x7ff9c5c8, 0x6bb8b85d, 0xc4000002,
+0x5d2971e2, 0x79e2c4b8, 0x830fda17, 0x00000354,
+0xd970f9c5, 0x61e2c4b1, 0xc5c85d40, 0xc84df4f1,
+0xcb78e98f, 0x73e1c5db, 0xf1c520f3, 0xf9c5cbd4,
+0xc5d85d6f, 0xb1e370f9, 0x4059e2c4, 0xf4e1c5e3,
+0x78e98fdb, 0xd9c5e4cb, 0xc520f473, 0xc5dcd4e1,
+0xc86d6ff9, 0x7dd4d1c5, 0xfbd1c5d8, 0xf1c5d875,
+0x82b8cbfb, 0xc5000002, 0xb1e670f9, 0x4059e2c4,
+0xf4c9c5e7, 0x78e98ff7, 0xd9c5e4cb, 0xc520f473,
+0xc4f4d4c9, 0xce2971e2, 0x1779e2c4, 0xd1830fca,
+0xc5000002, 0xb1cd70f9, 0x4071e2c4, 0xe98fd85d,
+0xc5dbcb78, 0x20f373d9, 0x5df4d1c5, 0xd4e1c5d8,
+0x02d3b8dc, 0xe2c40000, 0xd09a2961, 0xc4ffffff,
+0xda1779e2, 0x029a830f, 0x45c70000, 0xffffff80,
+0xc7c031ff, 0xffff8445, 0x85c7ffff, 0xffffff78,
+0x00000001, 0xff7c8589, 0xfac5ffff, 0xff789d7e,
+0xe0c5ffff, 0xc4805d16, 0xcb4071e2, 0xf3f4d1c5,
+0xcb78e98f, 0x73f1c5c9, 0xc9c520f1, 0xf9c5c9d4,
+0xc5b84d7f, 0xb87d6ff9, 0xf773c1c5, 0x7ff9c503,
+0xf9c5987d, 0xc5b8656f, 0x02f473d9, 0x657ff9c5,
+0xd4d9c5a8, 0x02f8b8e4, 0xe2c40000, 0xc4e72959,
+0xe21779e2, 0x021a830f, 0xf9c50000, 0xffe0a26f,
+0xe98fffff, 0x98659b58, 0xe4d4d9c5, 0x0002fdb8,
+0x59e2c400, 0xc4a86529, 0xe21779e2, 0x01f2830f,
+0x45c70000, 0x00000394, 0x94458b00, 0xc1804589,
+0x45891ff8, 0x7efac584, 0xf1c5807d, 0x45c7e7f3,
+0x00000294, 0x94458b00, 0xc1804589, 0x45891ff8,
+0x7efac584, 0xf1c5807d, 0xf9c5cff3, 0xc5a84d7f,
+0xb8c9d4f1, 0x00000310, 0x2971e2c4, 0x79e2c4cc,
+0x830fca17, 0x0000019c, 0xc594458b, 0x89c9eff1,
+0xf8c18045, 0x8445891f, 0x7d12fbc5, 0xfbf1c580,
+0x40e98fff, 0xd9c5e49b, 0x14b8e4d4, 0xc4000003,
+0x652959e2, 0x79e2c4a8, 0x830fe217, 0x00000164,
+0xe370f9c5, 0x59e2c4b1, 0xf9c5e540, 0x8fe86d6f,
+0xe4cb78e9, 0xf473d9c5, 0x51e2c420, 0xc9c5c937,
+0xf1c5f4d4, 0xf9c5cedb, 0x8fb84d7f, 0x6d9bf0e9,
+0x6ff9c5e8, 0xf9c5e875, 0xfff0a26f, 0xc9c5ffff,
+0xf9c5f4fb, 0x8fe8757f, 0x4d9bf0e9, 0x032cb8e8,
+0xf9c50000, 0xc5a84d7f, 0xc4c9d4f1, 0xcd2971e2,
+0x1779e2c4, 0xf9830fca, 0xc5000000, 0xc5f6efc9,
+0xe84dfbc9, 0x000331b8, 0x70e98f00, 0xc4a84d9b,
+0x4d2971e2, 0x79e2c4b8, 0x830fca17, 0x000000d4,
+0x000359b8, 0x70f9c500, 0xc54ec84d, 0xd86d6ff9,
+0x2951e2c4, 0x79e2c4c9, 0x830fca17, 0x000000b4,
+0x4d6cd1c5, 0x6dd1c5c8, 0xf1c5c87d, 0x70b8cffb,
+0xc5000003, 0xb1f970f9, 0x4041e2c4, 0xf4f1c5fb,
+0x78e98fcb, 0xc1c5ffcb, 0xc520f773, 0xc4cfd4f1,
+0xcc2971e2, 0x1779e2c4, 0xc47973ca, 0xde3761e2,
+0x7d7efac5, 0x17f8c5c8, 0xf9c5b06d, 0xc5a87dd6,
+0xc8756ff9, 0x0003c4b8, 0x48e88f00, 0xc530cda2,
+0xa85d6ff9, 0x2961e2c4, 0x79e2c4c9, 0x4473ca17,
+0x0003d4b8, 0x6ff9c500, 0xe3c4c84d, 0xd86d0e71,
+0x61e2c4f0, 0xe2c4dd29, 0x73da1779, 0x71e3c427,
+0x3108d90f, 0xdbf1c5c0, 0xd4f1c5cc, 0x71e2c4cc,
+0xe2c4cb29, 0x0fca1779, 0xf883c092, 0x25c01901,
+0x000003e4, 0x148bc3c9, 0x0000c324, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002174,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x000355e8, 0x7bc28100, 0x89000003, 0x88ec81e5,
+0x89000000, 0xc031cc45, 0x4589c931, 0x89c031ec,
+0xc031d445, 0x31e44589, 0xc845c7c0, 0x00000001,
+0x02d845c7, 0x89000000, 0x45c7dc4d, 0x00003fe8,
+0xd045c700, 0x00000002, 0x01e045c7, 0xc7000000,
+0x003ef045, 0x45890000, 0x6ff9c5f4, 0xf9c5c875,
+0xc598757f, 0xc5c976f1, 0x985d6ff9, 0x000260b8,
+0x61e2c400, 0xe2c4d629, 0x0fd11779, 0x0002d783,
+0xd4e1c500, 0xf9c5c855, 0xc5a8557f, 0xc87d6ff9,
+0xf773e9c5, 0x0266b801, 0xe2c40000, 0xa8552969,
+0x1779e2c4, 0xad830fd1, 0xc5000002, 0xa8756ff9,
+0x55fbc9c5, 0x7ff9c5c8, 0x6bb8b855, 0xc4000002,
+0x652961e2, 0x79e2c4b8, 0x830fe117, 0x00000288,
+0x5debe1c5, 0x7ff9c5d8, 0xe9c5985d, 0xc5d855db,
+0xb87d6ff9, 0x5defc1c5, 0x0277b8d8, 0xe9c50000,
+0xe9c5d1ef, 0xc49855db, 0xd32969e2, 0x1779e2c4,
+0x51830fd1, 0xc5000002, 0xc8556ff9, 0xda70f9c5,
+0x61e2c4b1, 0x8fd85d40, 0xdbcb78e9, 0xf373d9c5,
+0xf4e9c520, 0xe1c5d85d, 0xd3b8dcd4, 0xc4000002,
+0x9a2961e2, 0xffffffe0, 0x1779e2c4, 0x15830fd9,
+0xc5000002, 0xb8557ff9, 0x756ff9c5, 0x73d9c5b8,
+0xf9c503f6, 0xc598657f, 0xb87d6ff9, 0xf773e1c5,
+0x7ff9c502, 0xe1c5a85d, 0xf8b8dbd4, 0xc4000002,
+0xdc2961e2, 0x1779e2c4, 0xd9830fd9, 0xc5000001,
+0x98756ff9, 0xd673e1c5, 0xd4e1c502, 0x02fdb8db,
+0xe2c40000, 0xa85d2961, 0x1779e2c4, 0xb5830fd9,
+0xc7000001, 0x00039445, 0xf9c50000, 0xc5945d6e,
+0xc7dbf3e9, 0x00029445, 0xf9c50000, 0xc594656e,
+0xc5d4f3e9, 0xa8557ff9, 0xd2d4e9c5, 0x000310b8,
+0x69e2c400, 0xe2c4d329, 0x0fd11779, 0x00017783,
+0x6ef9c500, 0xe1c59455, 0xe9c5d2d3, 0x14b8d2d4,
+0xc4000003, 0x552969e2, 0x79e2c4a8, 0x830fd117,
+0x00000154, 0x7d6ff9c5, 0xefe9c5e8, 0x40e88fd2,
+0xc505d2cf, 0xc855dbe9, 0x557ff9c5, 0xe8e98fb8,
+0xc5e85d9b, 0xe865d4f1, 0x657ff9c5, 0xe8e98fe8,
+0xb8e8559b, 0x0000032c, 0x557ff9c5, 0xd4e9c5a8,
+0x69e2c4d2, 0xe2c4d329, 0x0fd11779, 0x00010783,
+0xefe9c500, 0xfbe9c5d2, 0x31b8e855, 0x8f000003,
+0x559768e9, 0x69e2c4a8, 0xc4b85529, 0xd11779e2,
+0x00e2830f, 0x59b80000, 0xc5000003, 0xc85570f9,
+0x6ff9c54e, 0xe2c4d85d, 0xc4d22961, 0xd11779e2,
+0x00c2830f, 0x45c70000, 0xffffff80, 0x8445c7ff,
+0xffffffff, 0x657efac5, 0x7efac580, 0x6ce1c5e4,
+0xe1c5c86d, 0xc5c8556d, 0xb8d2d4f1, 0x00000370,
+0xd5fbe9c5, 0xe9efd9c5, 0xd4efe9c5, 0xd5fbe9c5,
+0xaa6ff9c5, 0xfffffff0, 0x2969e2c4, 0x79e2c4d5,
+0x7473d117, 0x757efac5, 0x17f8c5c8, 0xf9c5b05d,
+0xc5a875d6, 0xc87d6ff9, 0x0003c4b8, 0x40e88f00,
+0xc540d3a2, 0xa85d6ff9, 0x2961e2c4, 0x79e2c4d2,
+0x4473d117, 0x0003d4b8, 0x6ff9c500, 0xe3c4c855,
+0xd8650e69, 0x61e2c4f0, 0xe2c4dc29, 0x73d91779,
+0x69e3c427, 0x3108da0f, 0xdbe9c5c0, 0xd4e9c5d5,
+0x69e2c4d5, 0xe2c4d329, 0x0fd11779, 0xf883c092,
+0x25c01901, 0x000003e4, 0x148bc3c9, 0x0000c324,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0001634,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x0516e8c3,
+0xc2810000, 0x000005be, 0x8955e8d9, 0x88ec81e5,
+0xd9000000, 0x82d9c855, 0xffffff60, 0xd9d855d9,
+0xe855d9c9, 0xffc082d9, 0x55d9ffff, 0x6482d9cc,
+0xd9ffffff, 0xe8d9dc55, 0x55d9e0d9, 0xd9c9d9ec,
+0xc9d9d05d, 0xd9e05dd9, 0xf055d9c9, 0x5dd9cad9,
+0xd9c9d9d4, 0x5dd9e45d, 0x28f8c5f4, 0xf8c5c87d,
+0xc5987d29, 0x985528f8, 0xc976f1c5, 0x000260b8,
+0xc2e8c500, 0xe2c400df, 0x0fd90e79, 0x00049583,
+0x58e8c500, 0xf8c5c85d, 0xc5a85d29, 0xc87d28f8,
+0x000266b8, 0x58c0c500, 0xc2e0c5df, 0xc400a85d,
+0xd90e79e2, 0x046c830f, 0xf8c50000, 0xc5a87d28,
+0xc85d5cc0, 0x5d29f8c5, 0xc2e8c5b8, 0xb800b85d,
+0x0000026b, 0x0e79e2c4, 0x47830fd9, 0xc5000004,
+0xd87d28f8, 0x5559e8c5, 0x59c0c5c8, 0x28f8c5e7,
+0xe0c5c85d, 0xe0c5f758, 0xb8d86d5c, 0x00000282,
+0xd45ce8c5, 0xee59d0c5, 0xd5c2e8c5, 0x79e2c400,
+0x830fd10e, 0x0000040e, 0x5559e0c5, 0x29f8c5e8,
+0xe0c59855, 0xb8e85d5e, 0x0000028b, 0xd3c2e8c5,
+0x79e2c400, 0x830fd10e, 0x000003ea, 0x9a28f8c5,
+0xffffff70, 0x00028eb8, 0x28f8c500, 0xd0c5e86d,
+0xe8c5d357, 0xc5985559, 0xc85d57e0, 0xd3c2e8c5,
+0x79e2c400, 0x830fd10e, 0x000003ba, 0x5553f8c5,
+0x29f8c5c8, 0xf8c59855, 0xb8985553, 0x00000296,
+0x5d28f8c5, 0x5bf9c5c8, 0x5bf8c5d2, 0xc2e8c5d2,
+0xe2c400d3, 0x0fd10e79, 0x00038983, 0x59e0c500,
+0x29f8c5d3, 0xf8c59855, 0xc5985552, 0xa85529f8,
+0x5528f8c5, 0x029db8a8, 0xf8c50000, 0xf9c5e253,
+0xf8c5e45b, 0xe0c5e45b, 0xc400dcc2, 0xd90e79e2,
+0x0350830f, 0xf8c50000, 0xc5c86528, 0xb8d25bf9,
+0x0000029f, 0xd25bf8c5, 0xdc53f8c5, 0xdb5bf9c5,
+0xdb5bf8c5, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x00000322, 0xd459d8c5, 0x5529f8c5, 0x51f8c598,
+0xa7b89855, 0xc5000002, 0x00d4c2e8, 0x0e79e2c4,
+0xff830fd1, 0xc5000002, 0x809a28f8, 0xc5ffffff,
+0xc5e45ee0, 0x986529f8, 0x0879e3c4, 0xc50b9855,
+0x9092c2e8, 0x00ffffff, 0x0002afb8, 0x79e2c400,
+0x830fd10e, 0x000002ce, 0x8078e98f, 0xc8c5c855,
+0xb6b8f657, 0xc5000002, 0x00d6c2e8, 0x0e79e2c4,
+0xaf830fd1, 0xc5000002, 0xc85558e0, 0xd25ee0c5,
+0x5529f8c5, 0x78e98f98, 0xc5985580, 0x9855c2e8,
+0x02bcb800, 0xe2c40000, 0x0fd10e79, 0x00028583,
+0x28f8c500, 0xffffa092, 0x59e8c5ff, 0xf8c5c855,
+0xc4985529, 0x550879e3, 0xe98f0b98, 0x98658078,
+0xd458e8c5, 0x0002c6b8, 0xc2e8c500, 0xc4009855,
+0xd10e79e2, 0x024c830f, 0xd0c50000, 0xc5d85559,
+0xc86559d0, 0x5529f8c5, 0x5fd8c5a8, 0xd8c5a855,
+0xc5a8655d, 0xa86529f8, 0x5558e8c5, 0x0348b8a8,
+0xf8c50000, 0xc5c87d28, 0xc5d559e8, 0xd86558c0,
+0xd4c2e8c5, 0x79e2c400, 0x830fd10e, 0x00000206,
+0x0479e3c4, 0xb81bc855, 0x00000359, 0x55c2e8c5,
+0xe2c400d8, 0x0fd10e79, 0x0001e983, 0x28f8c500,
+0x5eb8d865, 0xc5000003, 0xc5d45bf9, 0xb092fee9,
+0xc4ffffff, 0x754849e3, 0xd8c520c8, 0xc400f6c2,
+0xf10e79e2, 0x01bc830f, 0xf8c50000, 0xb8c87d28,
+0x00000362, 0xd458c0c5, 0x1879e2c4, 0xffff68b2,
+0xc2e8c5ff, 0xe2c400d6, 0x0fd10e79, 0x00019583,
+0x14d8c500, 0xd8c5c855, 0xc5c87515, 0xb8d65ce8,
+0x00000370, 0xd559e8c5, 0x92c2e8c5, 0xffffffc0,
+0x79e2c400, 0x830fd10e, 0x0000016a, 0x5512fac5,
+0x28f8c5c8, 0xffffd0b2, 0x03b1b8ff, 0xc8c50000,
+0xf8c5f558, 0xffe0ba28, 0xc8c5ffff, 0xe8c5f759,
+0xc5c8555c, 0x00d6c2e8, 0x0e79e2c4, 0x33830fd1,
+0xc5000001, 0xc87516fa, 0xdb58d0c5, 0x0003b8b8,
+0x28f8c500, 0xe0c5c855, 0xc8c5df59, 0xc8c5f25c,
+0xc400f3c2, 0xf10e79e2, 0x0108830f, 0xfac50000,
+0xc5a85511, 0xc4db57e0, 0x551779e3, 0xe3c402b0,
+0xac651779, 0x79e3c401, 0x03b46517, 0x0003c4b8,
+0xc2e0c500, 0xe88f01ed, 0x50d4a268, 0x6528f8c5,
+0xc2d8c5a8, 0xe2c400d2, 0x0fd10e79, 0x0000c583,
+0x28f8c500, 0xd4b8c86d, 0xc4000003, 0x550c51e3,
+0xd8c50ad8, 0xc400e2c2, 0xe10e79e2, 0x00a4830f,
+0xf8c50000, 0xc5c86d28, 0xd855d0d3, 0x7d28f8c5,
+0x03ddb8c8, 0xc3c50000, 0xc5d865d0, 0x00d4c2e8,
+0x0e79e2c4, 0xc57f73d1, 0xc86528f8, 0x0003ecb8,
+0x59e3c400, 0xf1d85540, 0x92c2e8c5, 0xfffffff0,
+0x79e2c400, 0x5e73d10e, 0x6529f8c5, 0x7ce3c598,
+0xf8c59855, 0xc5985529, 0x98557ce3, 0xff6c82d9,
+0xe3c4ffff, 0x84551779, 0x8445d903, 0xd8dde9df,
+0x2d752f7a, 0x6d28f8c5, 0xc5c031c8, 0xd8557dd3,
+0xd37cebc5, 0xd37cebc5, 0xd3c2e8c5, 0x79e2c400,
+0x920fd10e, 0x01f883c0, 0x0125c019, 0xeb000004,
+0x03f8b805, 0xc3c90000, 0xc324148b, 0x00000000,
+0x40800000, 0x40400000, 0x40a00000, 0x41200000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x3e800000, 0x3e800000, 0x3e800000, 0x3e800000,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002734,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x04bfe8c3,
+0xc2810000, 0x0000055e, 0xc031e8d9, 0x81e58955,
+0x000088ec, 0xb855dd00, 0xc7e04589, 0x0000e445,
+0x82d9bff0, 0xffffff70, 0xd9c855dd, 0xd855ddc9,
+0x5dddc9d9, 0xd05dddc0, 0x7d28f9c5, 0x29f9c5b8,
+0xf1c5887d, 0xf9c5c976, 0xb8885528, 0x00000260,
+0xdfc2e9c5, 0x79e2c400, 0x830fd90f, 0x0000045f,
+0x5d58e9c5, 0x29f9c5b8, 0x66b8985d, 0xc5000002,
+0xb87d28f9, 0xdf58c1c5, 0x5dc2e1c5, 0xe2c40098,
+0x0fd90f79, 0x00043683, 0x28f9c500, 0xc1c5987d,
+0xc5b85d5c, 0xa85d29f9, 0x00026bb8, 0xc2e9c500,
+0xc400a85d, 0xd90f79e2, 0x0411830f, 0xf9c50000,
+0xc5c87d28, 0xb85559e9, 0xe759c1c5, 0x5d28f9c5,
+0x58e1c5b8, 0x0282b8f7, 0xe1c50000, 0xc5c86d5c,
+0xc5d45ce9, 0xc5ee59d1, 0x00d5c2e9, 0x0f79e2c4,
+0xd8830fd1, 0xc5000003, 0xd85559e1, 0x5529f9c5,
+0x028bb888, 0xe1c50000, 0xc5d85d5e, 0x00d3c2e9,
+0x0f79e2c4, 0xb4830fd1, 0xb8000003, 0x0000028e,
+0xa228f9c5, 0xffffff80, 0x5d28f9c5, 0x57e1c5d8,
+0x57d9c5d4, 0xe9c5b865, 0xc5885559, 0x00d4c2e9,
+0x0f79e2c4, 0x84830fd1, 0xc5000003, 0xb8555af9,
+0xd253f8c5, 0xd25af8c5, 0x5529f9c5, 0x5af9c588,
+0xf8c58855, 0xf9c5d253, 0xb8b86d28, 0x00000296,
+0xd25af8c5, 0xd2e6fbc5, 0xd2e6fac5, 0xd5c2e9c5,
+0x79e2c400, 0x830fd10f, 0x00000343, 0xd559d1c5,
+0x5529f9c5, 0x5af9c588, 0xf8c58855, 0xf8c5d252,
+0xf9c5d25a, 0xc5985529, 0x986528f9, 0xd45af9c5,
+0x00029db8, 0x53f8c500, 0x5af8c5d2, 0xe6fbc5d2,
+0xe6fac5d2, 0xc2d1c5d2, 0xe2c400ea, 0x0fe90f79,
+0x0002fa83, 0x28f9c500, 0xf9c5b86d, 0xfbc5d55a,
+0x9fb8e4e6, 0xc5000002, 0xc5e4e6fa, 0xc5d253f8,
+0xc5d25af8, 0xc5d2e6fb, 0xc5d2e6fa, 0x00e2c2d9,
+0x0f79e2c4, 0xc4830fe1, 0xc5000002, 0xc5d559d1,
+0x885529f9, 0x0002a7b8, 0x51f9c500, 0xe9c58855,
+0xc400d5c2, 0xd10f79e2, 0x02a1830f, 0xf9c50000,
+0xff90b228, 0xc9c5ffff, 0xf9c5ed5e, 0xb8886d29,
+0x000002af, 0x0979e3c4, 0xc50b8855, 0xa092c2e9,
+0x00ffffff, 0x0f79e2c4, 0x70830fd1, 0x8f000002,
+0x558178e9, 0x57d1c5b8, 0x02b6b8ed, 0xe9c50000,
+0xc400d5c2, 0xd10f79e2, 0x0251830f, 0xc9c50000,
+0xc5b85558, 0xc5d25ec9, 0x885529f9, 0x8178e98f,
+0xbcb88855, 0xc5000002, 0x8855c2e9, 0x79e2c400,
+0x830fd10f, 0x00000227, 0x9228f9c5, 0xffffffb0,
+0x5559e9c5, 0x29f9c5b8, 0xe3c48855, 0x88550979,
+0x78e98f0b, 0xb8886581, 0x000002c6, 0xd458e9c5,
+0x55c2e9c5, 0xe2c40088, 0x0fd10f79, 0x0001ee83,
+0x59e1c500, 0xe1c5c855, 0xc5b86559, 0x985529f9,
+0x555fd9c5, 0x5dd9c598, 0xf9c59865, 0xb8986529,
+0x00000348, 0x5558e9c5, 0x28f9c598, 0xe9c5b87d,
+0xc1c5d359, 0xc5c86558, 0x00d4c2e9, 0x0f79e2c4,
+0xa8830fd1, 0xb8000001, 0x00000359, 0x0579e3c4,
+0xc501b855, 0xc855c2e9, 0x79e2c400, 0x830fd10f,
+0x0000018b, 0x6528f9c5, 0xe6fbc5c8, 0xfee9c5d4,
+0xffffc092, 0x28f9c5ff, 0x5eb8b87d, 0xc4000003,
+0xd22579e2, 0xf273e9c5, 0x7ff9c501, 0xe3c4e855,
+0xe85549d1, 0xc2d9c570, 0xe2c400d2, 0x0fd10f79,
+0x00014a83, 0x16d9c500, 0xf9c5b855, 0xc5b87d28,
+0xb8ff15d9, 0x00000370, 0xd75ce9c5, 0xd359e9c5,
+0xd6c2e9c5, 0x79e2c400, 0x830fd10f, 0x0000011f,
+0x75120ff2, 0x03b1b8b8, 0xf9c50000, 0xc5b85528,
+0xd0ba58e1, 0xc5ffffff, 0xc5f25cc9, 0xe0ba59c1,
+0xc5ffffff, 0x00f7c2c9, 0x0f79e2c4, 0xec830ff1,
+0xc5000000, 0x985513f9, 0xebc2d1c5, 0x17f9c501,
+0xe88fa065, 0x50d4a268, 0x5d28f9c5, 0x03c4b898,
+0xe1c50000, 0xc400d2c2, 0xd10f79e2, 0x00bd830f,
+0xd4b80000, 0xc5000003, 0xb87528f9, 0x0d49e3c4,
+0xc502c84d, 0x00c9c2e1, 0xdb76e1c5, 0x0f79e2c4,
+0x98830fcb, 0xc5000000, 0xb87528f9, 0x4dd0c9c5,
+0x03ddb8c8, 0xf9c50000, 0xc5b87528, 0xc855d0c9,
+0xcac2f1c5, 0x79e2c400, 0x7373cb0f, 0x0003ecb8,
+0x28f9c500, 0xe3c4b855, 0xc84d4169, 0xc2f1c531,
+0xfffff08a, 0xe2c400ff, 0x73cb0f79, 0x29f9c552,
+0xe9c58855, 0xe9c5d257, 0xc5884d7c, 0x804d17f9,
+0xff7482d9, 0x45ddffff, 0xdde9df80, 0x752b7ad8,
+0xc5c03129, 0xb87528f9, 0x4d7dc9c5, 0x7cf1c5c8,
+0xc2f1c5ca, 0xe2c400ca, 0x0fcb0f79, 0xf883c092,
+0x25c01901, 0x00000401, 0xf8b805eb, 0xc9000003,
+0x24148bc3, 0x000000c3, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fd00000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0002574,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i1[] = {
+0x315526eb, 0x83e589c0, 0xec83e0e4, 0xc5e28920,
+0x24047ffd, 0xff103c80, 0x83400a75, 0xf47520f8,
+0x02eb01b0, 0xc3c9c031, 0x04244c8d, 0xffe0e483,
+0x01b2fc71, 0x57e58955, 0x002555e8, 0x83c78100,
+0x56000025, 0x5153f631, 0x000008b9, 0xa75d8d00,
+0x0248ec81, 0x94880000, 0xffff4835, 0x2821b0ff,
+0x358488d0, 0xffffff68, 0xe083f089, 0x01f88301,
+0x0224c019, 0x4488c8fe, 0x468d8835, 0x83c62101,
+0xd98301fe, 0x88c2fe00, 0xf883030c, 0x89047420,
+0xc5c3ebc6, 0x48bd6ffd, 0xc5ffffff, 0xe8bd7ffd,
+0x8afffffe, 0xfffee885, 0x48853aff, 0x88ffffff,
+0xfffec885, 0xc0940fff, 0x8588d8f6, 0xfffffe18,
+0xfee9858a, 0x853affff, 0xffffff49, 0xfea88588,
+0x940fffff, 0x88d8f6c0, 0xfffe0885, 0xea858aff,
+0x3afffffe, 0xffff4a85, 0x988588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe048588, 0x858affff, 0xfffffeeb,
+0xff4b853a, 0x8588ffff, 0xfffffe88, 0xf6c0940f,
+0x298588d8, 0x8afffffe, 0xfffeec85, 0x4c853aff,
+0x88ffffff, 0xfffe8485, 0xc0940fff, 0x8588d8f6,
+0xfffffe00, 0xfeed858a, 0x853affff, 0xffffff4d,
+0xfe838588, 0x940fffff, 0x88d8f6c0, 0xfffe2885,
+0xee858aff, 0x3afffffe, 0xffff4e85, 0x7c8588ff,
+0x0ffffffe, 0xd8f6c094, 0xfdfc8588, 0x858affff,
+0xfffffeef, 0xff4f853a, 0x8588ffff, 0xfffffe82,
+0xf6c0940f, 0xfb8588d8, 0x8afffffd, 0xfffef085,
+0x50853aff, 0x8affffff, 0xfffef89d, 0x788588ff,
+0x0ffffffe, 0xd8f6c094, 0xfdf48588, 0x858affff,
+0xfffffef1, 0xff51853a, 0x9d88ffff, 0xfffffe5c,
+0xfe748588, 0x940fffff, 0x88d8f6c0, 0xfffdfa85,
+0xf2858aff, 0x3afffffe, 0xffff5285, 0x708588ff,
+0x0ffffffe, 0xd8f6c094, 0xfdf08588, 0x858affff,
+0xfffffef3, 0xff53853a, 0x8588ffff, 0xfffffe6c,
+0x8ac1940f, 0xfffef485, 0x3ad9f6ff, 0xffff5485,
+0x688588ff, 0x0ffffffe, 0xd8f6c094, 0xfdec8588,
+0x858affff, 0xfffffef5, 0xff55853a, 0x8588ffff,
+0xfffffe64, 0x8ac2940f, 0xfffef685, 0x3adaf6ff,
+0xffff5685, 0x818588ff, 0x0ffffffe, 0xd8f6c094,
+0xfde88588, 0x858affff, 0xfffffef7, 0xff57853a,
+0x8588ffff, 0xfffffe60, 0xf6c0940f, 0x589d3ad8,
+0x0fffffff, 0xdbf6c394, 0xfde49d88, 0x9d8affff,
+0xfffffef9, 0xff599d3a, 0x9d88ffff, 0xfffffe58,
+0xf6c3940f, 0xf99d88db, 0x8afffffd, 0xfffefa9d,
+0x5a9d3aff, 0x88ffffff, 0xfffe549d, 0xc3940fff,
+0x9d88dbf6, 0xfffffde0, 0xfefb9d8a, 0x9d3affff,
+0xffffff5b, 0xfe509d88, 0x940fffff, 0x88dbf6c3,
+0xfffdf89d, 0xfc9d8aff, 0x3afffffe, 0xffff5c9d,
+0x4c9d88ff, 0x0ffffffe, 0xdbf6c394, 0xfddc9d88,
+0x9d8affff, 0xfffffefd, 0xff5d9d3a, 0x9d88ffff,
+0xfffffe48, 0xf6c3940f, 0xdb9d88db, 0x8afffffd,
+0xfffefe9d, 0x5e9d3aff, 0x88ffffff, 0xfffe449d,
+0xc3940fff, 0x9d88dbf6, 0xfffffdd4, 0xfeff9d8a,
+0x9d3affff, 0xffffff5f, 0xfe409d88, 0x940fffff,
+0x88dbf6c3, 0xfffdda9d, 0x009d8aff, 0x3affffff,
+0xffff609d, 0x3c9d88ff, 0x0ffffffe, 0xdbf6c394,
+0xfdd09d88, 0x9d8affff, 0xffffff01, 0xff619d3a,
+0xb58bffff, 0xfffffe18, 0xfe389d88, 0x940fffff,
+0x88dbf6c3, 0xfffdd99d, 0x029d8aff, 0xc5ffffff,
+0x3afe6ef9, 0xffff629d, 0x41e3c4ff, 0xfe08bd20,
+0x8b01ffff, 0xfffe04b5, 0x349d88ff, 0x0ffffffe,
+0xdbf6c394, 0xfdcc9d88, 0x9d8affff, 0xffffff03,
+0xce6ef9c5, 0xff639d3a, 0xe3c4ffff, 0x298d2071,
+0x01fffffe, 0xc961c1c5, 0xfe00b58b, 0x9d88ffff,
+0xfffffe30, 0xf6c3940f, 0xd89d88db, 0x8afffffd,
+0xffff049d, 0x6ef9c5ff, 0x649d3af6, 0x88ffffff,
+0xfffe809d, 0xc3940fff, 0x9d88dbf6, 0xfffffdc8,
+0xff059d8a, 0x9d3affff, 0xffffff65, 0xfe2c9d88,
+0x940fffff, 0x88dbf6c3, 0xfffdc79d, 0x069d8aff,
+0x3affffff, 0xffff669d, 0x2b9d88ff, 0x0ffffffe,
+0xdbf6c394, 0xfdc09d88, 0x9d8affff, 0xffffff07,
+0xff679d3a, 0x9d88ffff, 0xfffffe2a, 0x2049e3c4,
+0xfffe28b5, 0xb58b01ff, 0xfffffdfc, 0xf6c3940f,
+0x6ef9c5db, 0xf4b58be6, 0xc4fffffd, 0xa52059e3,
+0xfffffdfb, 0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc,
+0xf0b58bd6, 0xc4fffffd, 0x952069e3, 0xfffffdfa,
+0x6ef9c501, 0x61e3c4de, 0x8b01e920, 0xfffdec8d,
+0x7ff9c5ff, 0xfffe18ad, 0x61e9c5ff, 0xfffe1895,
+0x6ef9c5ff, 0x61e3c4d9, 0x8b01da20, 0xfffde895,
+0x6ef9c5ff, 0x51e3c4ea, 0x8b01e820, 0xfffde485,
+0x61e1c5ff, 0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca,
+0xe0858be8, 0xc4fffffd, 0xad2051e3, 0xfffffdf9,
+0x6ef9c501, 0xdc858bd0, 0xc4fffffd, 0x952069e3,
+0xfffffdf8, 0x61d1c501, 0x6ef9c5ea, 0xd4858bd8,
+0xc4fffffd, 0x9d2061e3, 0xfffffddb, 0x6ef9c501,
+0xd0858be0, 0xc4fffffd, 0xbd2059e3, 0xfffffdda,
+0x7ff9c501, 0xfffe18bd, 0x61e1c5ff, 0xfffe189d,
+0x62d1c5ff, 0x6ef9c5eb, 0xcc858bf0, 0xc4fffffd,
+0xb52049e3, 0xfffffdd9, 0x6ef9c501, 0xc8858be0,
+0xc4fffffd, 0xbd2059e3, 0xfffffdd8, 0x7ff9c501,
+0xfffe08bd, 0x61c9c5ff, 0xfffe08b5, 0x6ef9c5ff,
+0xc0858bf8, 0xc4fffffd, 0xbd2041e3, 0xfffffdc7,
+0x6ef9c501, 0x59e3c4e0, 0xc501e320, 0xc5fc61c1,
+0xc5f762c9, 0xc4ee6cd1, 0xc51875e3, 0xfa40e801,
+0x60baffff, 0x84000002, 0xb2840fc0, 0xc500001f,
+0xe8bd6ff9, 0xc5fffffe, 0x488dfcc1, 0xc5ffffff,
+0xf8bd6ff9, 0xc5fffffe, 0x5895fcc1, 0xc4ffffff,
+0xca1875e3, 0x7ffdc501, 0xffff088d, 0x6ff9c5ff,
+0xffff48bd, 0xfcc1c5ff, 0x6ff9c5d7, 0xffff58bd,
+0x79e3c4ff, 0x3800d014, 0xffff0885, 0xfcc1c5ff,
+0x79e3c4cf, 0x0f00cb14, 0xd8f6c094, 0xfe188588,
+0xe3c4ffff, 0x01d01479, 0xff098538, 0x940fffff,
+0x88d8f6c0, 0xfffe0885, 0x79e3c4ff, 0x3802d014,
+0xffff0a85, 0xc0940fff, 0x8588d8f6, 0xfffffe04,
+0x1479e3c4, 0x853803d0, 0xffffff0b, 0xf6c0940f,
+0x298588d8, 0xc4fffffe, 0xd01479e3, 0x0c853804,
+0x0fffffff, 0xd8f6c094, 0xfe008588, 0xe3c4ffff,
+0x05d01479, 0xff0d8538, 0x940fffff, 0x88d8f6c0,
+0xfffe2885, 0x79e3c4ff, 0x3806d014, 0xffff0e85,
+0xc0940fff, 0x8588d8f6, 0xfffffdfc, 0x1479e3c4,
+0x853807d0, 0xffffff0f, 0xf6c0940f, 0xfb8588d8,
+0xc4fffffd, 0xd01479e3, 0x10853808, 0x0fffffff,
+0xd8f6c094, 0xfdf48588, 0xe3c4ffff, 0x09d01479,
+0xff118538, 0x940fffff, 0x88d8f6c0, 0xfffdfa85,
+0x79e3c4ff, 0x380ad014, 0xffff1285, 0xc0940fff,
+0x8588d8f6, 0xfffffdf0, 0x1479e3c4, 0x85380bd0,
+0xffffff13, 0x1479e3c4, 0x940f0cd0, 0x38d9f6c1,
+0xffff1485, 0xc0940fff, 0x8588d8f6, 0xfffffdec,
+0x1479e3c4, 0x85380dd0, 0xffffff15, 0x1479e3c4,
+0x940f0ed0, 0x38daf6c2, 0xffff1685, 0xc0940fff,
+0x8588d8f6, 0xfffffde8, 0x1479e3c4, 0x85380fd0,
+0xffffff17, 0xf6c0940f, 0x189d38d8, 0x0fffffff,
+0xdbf6c394, 0xfde49d88, 0xe3c4ffff, 0x01cb1479,
+0xfe18b58b, 0x9d38ffff, 0xffffff19, 0xc5c3940f,
+0x8bfe6ef9, 0xfffe04b5, 0xc4dbf6ff, 0xbd2041e3,
+0xfffffe08, 0xf99d8801, 0xc4fffffd, 0xcb1479e3,
+0x1a9d3802, 0x0fffffff, 0xdbf6c394, 0xfde09d88,
+0xe3c4ffff, 0x03cb1479, 0xff1b9d38, 0x940fffff,
+0x88dbf6c3, 0xfffdf89d, 0x79e3c4ff, 0x3804cb14,
+0xffff1c9d, 0xc3940fff, 0x9d88dbf6, 0xfffffddc,
+0x1479e3c4, 0x9d3805cb, 0xffffff1d, 0xf6c3940f,
+0xdb9d88db, 0xc4fffffd, 0xcb1479e3, 0x1e9d3806,
+0x0fffffff, 0xdbf6c394, 0xfdd49d88, 0xe3c4ffff,
+0x07cb1479, 0xff1f9d38, 0x940fffff, 0x88dbf6c3,
+0xfffdda9d, 0x79e3c4ff, 0x3808cb14, 0xffff209d,
+0xc3940fff, 0x9d88dbf6, 0xfffffdd0, 0x1479e3c4,
+0x9d3809cb, 0xffffff21, 0xf6c3940f, 0xd99d88db,
+0xc4fffffd, 0xcb1479e3, 0x229d380a, 0x0fffffff,
+0xdbf6c394, 0xfdcc9d88, 0xe3c4ffff, 0x0bcb1479,
+0xff239d38, 0x940fffff, 0x88dbf6c3, 0xfffdd89d,
+0x79e3c4ff, 0x380ccb14, 0xffff249d, 0xc3940fff,
+0x9d88dbf6, 0xfffffdc8, 0x1479e3c4, 0x9d380dcb,
+0xffffff25, 0xf6c3940f, 0xc79d88db, 0xc4fffffd,
+0xcb1479e3, 0x269d380e, 0x0fffffff, 0xdbf6c394,
+0xfdc09d88, 0xe3c4ffff, 0x0fcb1479, 0xce6ef9c5,
+0xff279d38, 0xe3c4ffff, 0x298d2071, 0x01fffffe,
+0xc961c1c5, 0xfe00b58b, 0x940fffff, 0xc5dbf6c3,
+0x8bf66ef9, 0xfffdfcb5, 0x49e3c4ff, 0xfe28b520,
+0xc501ffff, 0x8be66ef9, 0xfffdf4b5, 0x59e3c4ff,
+0xfdfba520, 0xc501ffff, 0xc5e461c9, 0xc5cc62f1,
+0x8bd66ef9, 0xfffdf0b5, 0x69e3c4ff, 0xfdfa9520,
+0xc501ffff, 0xc4de6ef9, 0xe92061e3, 0xec8d8b01,
+0xc5fffffd, 0x18ad7ff9, 0xc5fffffe, 0x189561e9,
+0xc5fffffe, 0xc4d96ef9, 0xda2061e3, 0xe8958b01,
+0xc5fffffd, 0xc4ea6ef9, 0xe82051e3, 0xe4858b01,
+0xc5fffffd, 0xc5dd61e1, 0xc5d362e9, 0xc5ca6cf1,
+0x8be86ef9, 0xfffde085, 0x51e3c4ff, 0xfdf9ad20,
+0xc501ffff, 0x8bd06ef9, 0xfffddc85, 0x69e3c4ff,
+0xfdf89520, 0xc501ffff, 0xc5ea61d1, 0x8bd86ef9,
+0xfffdd485, 0x61e3c4ff, 0xfddb9d20, 0xc501ffff,
+0x8be06ef9, 0xfffdd085, 0x59e3c4ff, 0xfddabd20,
+0xc501ffff, 0x18bd7ff9, 0xc5fffffe, 0x189d61e1,
+0xc5fffffe, 0xc5eb62d1, 0x8bf06ef9, 0xfffdcc85,
+0x49e3c4ff, 0xfdd9b520, 0xc501ffff, 0x8be06ef9,
+0xfffdc885, 0x59e3c4ff, 0xfdd8bd20, 0xc501ffff,
+0x08bd7ff9, 0xc5fffffe, 0x08b561c9, 0xc5fffffe,
+0x8bf86ef9, 0xfffdc085, 0x41e3c4ff, 0xfdc7bd20,
+0xc501ffff, 0xc4e06ef9, 0xe32059e3, 0x61c1c501,
+0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee, 0xe801c518,
+0xfffff58e, 0x000266ba, 0x0fc08400, 0x001b0084,
+0x6ff9c500, 0xffff08b5, 0xf8c9c5ff, 0xffff488d,
+0x6ff9c5ff, 0xffff18b5, 0xf8c9c5ff, 0xffff5895,
+0x75e3c4ff, 0xc501ca18, 0x288d7ffd, 0x8affffff,
+0xfffec885, 0x28853aff, 0x0fffffff, 0xd8f6c094,
+0xfec88588, 0x858affff, 0xfffffea8, 0xff29853a,
+0x940fffff, 0x88d8f6c0, 0xfffea885, 0x98858aff,
+0x3afffffe, 0xffff2a85, 0xc0940fff, 0x8588d8f6,
+0xfffffe98, 0xfe88858a, 0x853affff, 0xffffff2b,
+0xf6c0940f, 0x888588d8, 0x8afffffe, 0xfffe8485,
+0x2c853aff, 0x0fffffff, 0xd8f6c094, 0xfe848588,
+0x858affff, 0xfffffe83, 0xff2d853a, 0x940fffff,
+0x88d8f6c0, 0xfffe8385, 0x7c858aff, 0x3afffffe,
+0xffff2e85, 0xc0940fff, 0x8588d8f6, 0xfffffe7c,
+0xfe82858a, 0x853affff, 0xffffff2f, 0xf6c0940f,
+0x828588d8, 0x8afffffe, 0xfffe7885, 0x30853aff,
+0x0fffffff, 0xd8f6c094, 0xfe788588, 0x858affff,
+0xfffffe74, 0xff31853a, 0x940fffff, 0x88d8f6c0,
+0xfffe7485, 0x70858aff, 0x3afffffe, 0xffff3285,
+0xc0940fff, 0x8588d8f6, 0xfffffe70, 0xfe6c858a,
+0x853affff, 0xffffff33, 0xfe68858a, 0x9d8affff,
+0xfffffe5c, 0xf6c1940f, 0x34853ad9, 0x0fffffff,
+0xd8f6c094, 0xfe6c8588, 0x858affff, 0xfffffe64,
+0xff35853a, 0x858affff, 0xfffffe81, 0xf6c2940f,
+0x36853ada, 0x0fffffff, 0xd8f6c094, 0xfe688588,
+0x858affff, 0xfffffe60, 0xff37853a, 0x940fffff,
+0x3ad8f6c0, 0xffff389d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe64, 0xfe589d8a, 0x9d3affff, 0xffffff39,
+0xf6c3940f, 0x819d88db, 0x8afffffe, 0xfffe549d,
+0x3a9d3aff, 0x0fffffff, 0xdbf6c394, 0xfe609d88,
+0x9d8affff, 0xfffffe50, 0xff3b9d3a, 0x940fffff,
+0x88dbf6c3, 0xfffe5c9d, 0x4c9d8aff, 0x3afffffe,
+0xffff3c9d, 0xc3940fff, 0x9d88dbf6, 0xfffffe58,
+0xfe489d8a, 0x9d3affff, 0xffffff3d, 0xf6c3940f,
+0x549d88db, 0x8afffffe, 0xfffe449d, 0x3e9d3aff,
+0x0fffffff, 0xdbf6c394, 0xfe509d88, 0x9d8affff,
+0xfffffe40, 0xff3f9d3a, 0xb58bffff, 0xfffffec8,
+0xf6c3940f, 0x4c9d88db, 0x8afffffe, 0xfffe3c9d,
+0x6ef9c5ff, 0x409d3afe, 0xc4ffffff, 0xbd2041e3,
+0xfffffea8, 0x98b58b01, 0x0ffffffe, 0xdbf6c394,
+0xfe489d88, 0x9d8affff, 0xfffffe38, 0xce6ef9c5,
+0xff419d3a, 0xe3c4ffff, 0x888d2071, 0x01fffffe,
+0xc961c1c5, 0xfe84b58b, 0x940fffff, 0x88dbf6c3,
+0xfffe449d, 0x349d8aff, 0xc5fffffe, 0x3af66ef9,
+0xffff429d, 0x49e3c4ff, 0xfe83b520, 0x0f01ffff,
+0xdbf6c394, 0xfe409d88, 0x9d8affff, 0xfffffe30,
+0xff439d3a, 0x940fffff, 0x88dbf6c3, 0xfffe3c9d,
+0x809d8aff, 0x3afffffe, 0xffff449d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe38, 0xfe2c9d8a, 0x9d3affff,
+0xffffff45, 0xf6c3940f, 0x349d88db, 0x8afffffe,
+0xfffe2b9d, 0x469d3aff, 0x0fffffff, 0xdbf6c394,
+0xfe309d88, 0x9d8affff, 0xfffffe2a, 0xff479d3a,
+0xb58bffff, 0xfffffe7c, 0xf6c3940f, 0x6ef9c5db,
+0x78b58be6, 0xc4fffffe, 0xa52059e3, 0xfffffe82,
+0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc, 0x70b58bd6,
+0xc4fffffe, 0x952069e3, 0xfffffe74, 0x6ef9c501,
+0x61e3c4de, 0x8b01e920, 0xfffe6c8d, 0x7ff9c5ff,
+0xfffec8ad, 0x61e9c5ff, 0xfffec895, 0x6ef9c5ff,
+0x61e3c4d9, 0x8b01da20, 0xfffe6895, 0x6ef9c5ff,
+0x51e3c4ea, 0x8b01e820, 0xfffe6485, 0x61e1c5ff,
+0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca, 0x60858be8,
+0xc4fffffe, 0xad2051e3, 0xfffffe81, 0x6ef9c501,
+0x58858bd0, 0xc4fffffe, 0x952069e3, 0xfffffe5c,
+0x61d1c501, 0x6ef9c5ea, 0x50858bd8, 0xc4fffffe,
+0x9d2061e3, 0xfffffe54, 0x6ef9c501, 0x48858be0,
+0xc4fffffe, 0xbd2059e3, 0xfffffe4c, 0x7ff9c501,
+0xfffec8bd, 0x61e1c5ff, 0xfffec89d, 0x62d1c5ff,
+0x6ef9c5eb, 0x40858bf0, 0xc4fffffe, 0xb52049e3,
+0xfffffe44, 0x6ef9c501, 0x38858be0, 0xc4fffffe,
+0xbd2059e3, 0xfffffe3c, 0x7ff9c501, 0xfffea8bd,
+0x61c9c5ff, 0xfffea8b5, 0x6ef9c5ff, 0x30858bf8,
+0xc4fffffe, 0xbd2041e3, 0xfffffe34, 0x6ef9c501,
+0x59e3c4e0, 0xc501e320, 0xc5fc61c1, 0xc5f762c9,
+0xc4ee6cd1, 0xc51875e3, 0xf0f4e801, 0x6bbaffff,
+0x84000002, 0x66840fc0, 0x80000016, 0xc500a87d,
+0x489d6ff9, 0xc5ffffff, 0x884d6ff9, 0xe360e1c5,
+0xd160f1c5, 0xdb68e1c5, 0xc968f1c5, 0x6d6ff9c5,
+0xc885c698, 0x00fffffe, 0xcbd5f1c5, 0xd4d5e9c5,
+0x9d6ff9c5, 0xffffff58, 0xa76ff9c5, 0xffffffe0,
+0xf360e1c5, 0xa368e88f, 0xe1c540d1, 0xd1c5db68,
+0xd1c5cd60, 0xf1c5ed68, 0xd1c5ced5, 0xe88febd5,
+0x40cda370, 0xe3c40a7e, 0xc8951479, 0x00fffffe,
+0x00a97d80, 0xfea885c6, 0x7e00ffff, 0x79e3c40a,
+0xfea89514, 0x8001ffff, 0xc600aa7d, 0xfffe9885,
+0x0a7e00ff, 0x1479e3c4, 0xfffe9895, 0x7d8002ff,
+0x85c600ab, 0xfffffe88, 0xc40a7e00, 0x951479e3,
+0xfffffe88, 0xac7d8003, 0x8485c600, 0x00fffffe,
+0xe3c40a7e, 0x84951479, 0x04fffffe, 0x00ad7d80,
+0xfe8385c6, 0x7e00ffff, 0x79e3c40a, 0xfe839514,
+0x8005ffff, 0xc600ae7d, 0xfffe7c85, 0x0a7e00ff,
+0x1479e3c4, 0xfffe7c95, 0x7d8006ff, 0x85c600af,
+0xfffffe82, 0xc40a7e00, 0x951479e3, 0xfffffe82,
+0xb07d8007, 0x7885c600, 0x00fffffe, 0xe3c40a7e,
+0x78951479, 0x08fffffe, 0x00b17d80, 0xfe7485c6,
+0x7e00ffff, 0x79e3c40a, 0xfe749514, 0x8009ffff,
+0xc600b27d, 0xfffe7085, 0x0a7e00ff, 0x1479e3c4,
+0xfffe7095, 0x7d800aff, 0x85c600b3, 0xfffffe6c,
+0xc40a7e00, 0x951479e3, 0xfffffe6c, 0xb47d800b,
+0x6885c600, 0x00fffffe, 0xe3c40a7e, 0x68951479,
+0x0cfffffe, 0x00b57d80, 0xfe6485c6, 0x7e00ffff,
+0x79e3c40a, 0xfe649514, 0x310dffff, 0xb67d80db,
+0xc4067e00, 0xd31479e3, 0xb77d800e, 0x8185c600,
+0x00fffffe, 0xe3c40a7e, 0x81951479, 0x0ffffffe,
+0x7d80c931, 0x067e00b8, 0x1479e3c4, 0x7d8000c9,
+0x85c600b9, 0xfffffe60, 0xc40a7e00, 0x8d1479e3,
+0xfffffe60, 0xba7d8001, 0x5c85c600, 0x00fffffe,
+0xe3c40a7e, 0x5c8d1479, 0x02fffffe, 0x00bb7d80,
+0xfe5885c6, 0x7e00ffff, 0x79e3c40a, 0xfe588d14,
+0x8003ffff, 0xc600bc7d, 0xfffe5485, 0x0a7e00ff,
+0x1479e3c4, 0xfffe548d, 0x7d8004ff, 0x85c600bd,
+0xfffffe50, 0xc40a7e00, 0x8d1479e3, 0xfffffe50,
+0xbe7d8005, 0x4c85c600, 0x00fffffe, 0xe3c40a7e,
+0x4c8d1479, 0x06fffffe, 0x00bf7d80, 0xfe4885c6,
+0x7e00ffff, 0x79e3c40a, 0xfe488d14, 0x8007ffff,
+0xc600c07d, 0xfffe4485, 0x0a7e00ff, 0x1479e3c4,
+0xfffe448d, 0x7d8008ff, 0x85c600c1, 0xfffffe40,
+0xc40a7e00, 0x8d1479e3, 0xfffffe40, 0xc27d8009,
+0x3c85c600, 0x00fffffe, 0xe3c40a7e, 0x3c8d1479,
+0x0afffffe, 0x00c37d80, 0xfe3885c6, 0x7e00ffff,
+0x79e3c40a, 0xfe388d14, 0x800bffff, 0xc600c47d,
+0xfffe3485, 0x0a7e00ff, 0x1479e3c4, 0xfffe348d,
+0x7d800cff, 0x85c600c5, 0xfffffe30, 0xc40a7e00,
+0x8d1479e3, 0xfffffe30, 0x80d2310d, 0x7e00c67d,
+0x79e3c406, 0x310eca14, 0xc77d80c0, 0xc4067e00,
+0xc81479e3, 0xc8b58b0f, 0xc5fffffe, 0x8bfe6ef9,
+0xfffe98b5, 0x41e3c4ff, 0xfea8bd20, 0xc501ffff,
+0x8bce6ef9, 0xfffe84b5, 0x71e3c4ff, 0xfe888d20,
+0xc501ffff, 0xc5c961c1, 0x8bf66ef9, 0xfffe7cb5,
+0x49e3c4ff, 0xfe83b520, 0xc501ffff, 0x8be66ef9,
+0xfffe78b5, 0x59e3c4ff, 0xfe82a520, 0xc501ffff,
+0xc5e461c9, 0xc5cc62f1, 0x8bd66ef9, 0xfffe70b5,
+0x69e3c4ff, 0xfe749520, 0xc501ffff, 0x8bde6ef9,
+0xfffe68b5, 0x61e3c4ff, 0xfe6cad20, 0xc501ffff,
+0xc8ad7ff9, 0xc5fffffe, 0xc4eb6ef9, 0xad2051e3,
+0xfffffe81, 0x61e9c501, 0xfffec895, 0x6ef9c5ff,
+0x61e3c4de, 0xfe649d20, 0xc501ffff, 0xc5dd61e1,
+0x8be96ef9, 0xfffe5c8d, 0x62e9c5ff, 0x6cf1c5d3,
+0x51e3c4ca, 0xfe60ad20, 0xc501ffff, 0x8be16ef9,
+0xfffe548d, 0x59e3c4ff, 0xfe58a520, 0xc501ffff,
+0xc5ec61d1, 0x8bd96ef9, 0xfffe4c8d, 0x61e3c4ff,
+0xfe509d20, 0xc501ffff, 0x8bd16ef9, 0xfffe448d,
+0x69e3c4ff, 0xfe48b520, 0xc501ffff, 0xc8b57ff9,
+0xc5fffffe, 0x8bf16ef9, 0xfffe3c8d, 0x49e3c4ff,
+0xfe40b520, 0xc501ffff, 0x8bd16ef9, 0xfffe348d,
+0x69e3c4ff, 0xfe38bd20, 0xc501ffff, 0xc5d26ef9,
+0xa8bd7ff9, 0xc4fffffe, 0xd02069e3, 0x6ef9c501,
+0x41e3c4f9, 0xfe30bd20, 0xc501ffff, 0xc89d61e1,
+0xc5fffffe, 0xc5fa61c1, 0xa8b561c9, 0xc5fffffe,
+0xc5eb62d1, 0xc5f762c9, 0xc4ee6cd1, 0xcd1875e3,
+0x6ff9c501, 0x7ffdc5d1, 0xffff288d, 0xf0e98fff,
+0xc5a85d98, 0xb8756ff9, 0x9848e98f, 0xffff388d,
+0x65e3c4ff, 0xc501f118, 0xc8b57ffd, 0xc5fffffe,
+0xc8bd6ffd, 0x8afffffe, 0xfffec895, 0x7ffdc5ff,
+0xfffee8bd, 0x6ff9c5ff, 0xfffff09f, 0x6ff9c5ff,
+0xf9c5a875, 0xc5b87d6f, 0xc5cbf8c9, 0xc4dbf8c1,
+0xcb1875e3, 0x7ffdc501, 0xe98fa84d, 0xa85598e8,
+0x756ff9c5, 0x48e98fb8, 0xff388d98, 0xe3c4ffff,
+0x01d9186d, 0xd2fce9c5, 0x9d7ffdc5, 0xffffff08,
+0x1479e3c4, 0xc23800d0, 0xc9fcf1c5, 0xf6c0940f,
+0xc88588d8, 0xc4fffffe, 0xd01479e3, 0xe9853801,
+0x0ffffffe, 0xd8f6c094, 0xfea88588, 0xe3c4ffff,
+0x02d01479, 0xfeea8538, 0x940fffff, 0x88d8f6c0,
+0xfffe9885, 0x79e3c4ff, 0x3803d014, 0xfffeeb85,
+0xc0940fff, 0x8588d8f6, 0xfffffe88, 0x1479e3c4,
+0x853804d0, 0xfffffeec, 0xf6c0940f, 0x848588d8,
+0xc4fffffe, 0xd01479e3, 0xed853805, 0x0ffffffe,
+0xd8f6c094, 0xfe838588, 0xe3c4ffff, 0x06d01479,
+0xfeee8538, 0x940fffff, 0x88d8f6c0, 0xfffe7c85,
+0x79e3c4ff, 0x3807d014, 0xfffeef85, 0xc0940fff,
+0x8588d8f6, 0xfffffe82, 0x1479e3c4, 0x853808d0,
+0xfffffef0, 0xf6c0940f, 0x788588d8, 0xc4fffffe,
+0xd01479e3, 0xf1853809, 0x0ffffffe, 0xd8f6c094,
+0xfe748588, 0xe3c4ffff, 0x0ad01479, 0xfef28538,
+0x940fffff, 0x88d8f6c0, 0xfffe7085, 0x79e3c4ff,
+0x380bd014, 0xfffef385, 0x79e3c4ff, 0x0f0cd014,
+0xdbf6c394, 0xfef48538, 0x940fffff, 0x88d8f6c0,
+0xfffe6c85, 0x79e3c4ff, 0x380dd014, 0xfffef585,
+0x79e3c4ff, 0x0f0ed014, 0xd9f6c194, 0xfef68538,
+0x940fffff, 0x88d8f6c0, 0xfffe6885, 0x79e3c4ff,
+0x380fd014, 0xfffef785, 0x79e3c4ff, 0x0f00c814,
+0xdaf6c294, 0xfef88538, 0x940fffff, 0x88d8f6c0,
+0xfffe6485, 0x79e3c4ff, 0x3801c814, 0xfffef985,
+0xc0940fff, 0x8588d8f6, 0xfffffe81, 0x1479e3c4,
+0x853802c8, 0xfffffefa, 0xf6c0940f, 0x608588d8,
+0xc4fffffe, 0xc81479e3, 0xfb853803, 0x0ffffffe,
+0xd8f6c094, 0xfe5c8588, 0xe3c4ffff, 0x04c81479,
+0xfefc8538, 0x940fffff, 0x88d8f6c0, 0xfffe5885,
+0x79e3c4ff, 0x3805c814, 0xfffefd85, 0xc0940fff,
+0x8588d8f6, 0xfffffe54, 0x1479e3c4, 0x853806c8,
+0xfffffefe, 0xf6c0940f, 0x508588d8, 0xc4fffffe,
+0xc81479e3, 0xff853807, 0x0ffffffe, 0xd8f6c094,
+0xfe4c8588, 0xe3c4ffff, 0x08c81479, 0xff008538,
+0x940fffff, 0x88d8f6c0, 0xfffe4885, 0x79e3c4ff,
+0x3809c814, 0xffff0185, 0xc0940fff, 0x8588d8f6,
+0xfffffe44, 0x1479e3c4, 0x85380ac8, 0xffffff02,
+0xf6c0940f, 0x408588d8, 0xc4fffffe, 0xc81479e3,
+0x0385380b, 0x0fffffff, 0xd8f6c094, 0xfe3c8588,
+0xe3c4ffff, 0x0cc81479, 0xff048538, 0x940fffff,
+0x88d8f6c0, 0xfffe3885, 0x79e3c4ff, 0x380dc814,
+0xffff0585, 0xc0940fff, 0x8588d8f6, 0xfffffe34,
+0x1479e3c4, 0x85380ec8, 0xffffff06, 0xf6c0940f,
+0x308588d8, 0x8bfffffe, 0xfffec8b5, 0x79e3c4ff,
+0x380fc814, 0xffff0785, 0x6ef9c5ff, 0x98b58bfe,
+0xc4fffffe, 0xbd2041e3, 0xfffffea8, 0xc0940f01,
+0xf9c5d8f6, 0xb58bce6e, 0xfffffe84, 0x2071e3c4,
+0xfffe888d, 0xc1c501ff, 0xf9c5c961, 0xb58bf66e,
+0xfffffe7c, 0x2049e3c4, 0xfffe83b5, 0xf9c501ff,
+0xb58be66e, 0xfffffe78, 0x2059e3c4, 0xfffe82a5,
+0xc9c501ff, 0xf1c5e461, 0xf9c5cc62, 0xb58bd66e,
+0xfffffe70, 0x2069e3c4, 0xfffe7495, 0xf9c501ff,
+0xe3c4de6e, 0x01eb2061, 0xfe6c9d8b, 0xf9c5ffff,
+0xfec8ad7f, 0xe9c5ffff, 0xfec89561, 0xf9c5ffff,
+0xe3c4db6e, 0x01d92061, 0xfe688d8b, 0xf9c5ffff,
+0xe3c4e96e, 0x01ea2051, 0xfe64958b, 0xe1c5ffff,
+0xe9c5dd61, 0xf1c5d362, 0xf9c5ca6c, 0x958bea6e,
+0xfffffe60, 0x2051e3c4, 0xfffe81ad, 0xf9c501ff,
+0x958bd26e, 0xfffffe58, 0x2069e3c4, 0xfffe5c95,
+0xd1c501ff, 0xf9c5ea61, 0x958bda6e, 0xfffffe50,
+0x2061e3c4, 0xfffe549d, 0xf9c501ff, 0x958be26e,
+0xfffffe48, 0x2059e3c4, 0xfffe4cbd, 0xf9c501ff,
+0xfec8bd7f, 0xf9c5ffff, 0x958bf26e, 0xfffffe40,
+0x2049e3c4, 0xfffe44b5, 0xf9c501ff, 0x958be26e,
+0xfffffe38, 0x2059e3c4, 0xfffe3cbd, 0xf9c501ff,
+0xfea8bd7f, 0xf9c5ffff, 0xe3c4fa6e, 0x34bd2041,
+0x01fffffe, 0xfe30958b, 0xe1c5ffff, 0xfec89d61,
+0xc9c5ffff, 0xfea8b561, 0xd1c5ffff, 0xf9c5eb62,
+0xe3c4e26e, 0x01e02059, 0xfc61c1c5, 0xf762c9c5,
+0xee6cd1c5, 0x1875e3c4, 0x53e801c5, 0xbaffffe7,
+0x0000032c, 0x840fc084, 0x00000cc5, 0xc9eff1c5,
+0x55f8f1c5, 0xf8f1c5a8, 0xe98fb84d, 0x08959868,
+0x8fffffff, 0x8d9870e9, 0xffffff18, 0x1479e3c4,
+0x853800d0, 0xffffff28, 0x186de3c4, 0xfdc501d9,
+0xfee89d7f, 0x940fffff, 0x88d8f6c0, 0xfffec885,
+0x79e3c4ff, 0x3801d014, 0xffff2985, 0xc0940fff,
+0x8588d8f6, 0xfffffea8, 0x1479e3c4, 0x853802d0,
+0xffffff2a, 0xf6c0940f, 0x988588d8, 0xc4fffffe,
+0xd01479e3, 0x2b853803, 0x0fffffff, 0xd8f6c094,
+0xfe888588, 0xe3c4ffff, 0x04d01479, 0xff2c8538,
+0x940fffff, 0x88d8f6c0, 0xfffe8485, 0x79e3c4ff,
+0x3805d014, 0xffff2d85, 0xc0940fff, 0x8588d8f6,
+0xfffffe83, 0x1479e3c4, 0x853806d0, 0xffffff2e,
+0xf6c0940f, 0x7c8588d8, 0xc4fffffe, 0xd01479e3,
+0x2f853807, 0x0fffffff, 0xd8f6c094, 0xfe828588,
+0xe3c4ffff, 0x08d01479, 0xff308538, 0x940fffff,
+0x88d8f6c0, 0xfffe7885, 0x79e3c4ff, 0x3809d014,
+0xffff3185, 0xc0940fff, 0x8588d8f6, 0xfffffe74,
+0x1479e3c4, 0x85380ad0, 0xffffff32, 0xf6c0940f,
+0x708588d8, 0xc4fffffe, 0xd01479e3, 0x3385380b,
+0xc4ffffff, 0xd01479e3, 0xc3940f0c, 0x8538dbf6,
+0xffffff34, 0xf6c0940f, 0x6c8588d8, 0xc4fffffe,
+0xd01479e3, 0x3585380d, 0xc4ffffff, 0xd01479e3,
+0xc1940f0e, 0x8538d9f6, 0xffffff36, 0xf6c0940f,
+0x688588d8, 0xc4fffffe, 0xd01479e3, 0x3785380f,
+0xc4ffffff, 0xc81479e3, 0xc2940f00, 0x8538daf6,
+0xffffff38, 0xf6c0940f, 0x648588d8, 0xc4fffffe,
+0xc81479e3, 0x39853801, 0x0fffffff, 0xd8f6c094,
+0xfe818588, 0xe3c4ffff, 0x02c81479, 0xff3a8538,
+0x940fffff, 0x88d8f6c0, 0xfffe6085, 0x79e3c4ff,
+0x3803c814, 0xffff3b85, 0xc0940fff, 0x8588d8f6,
+0xfffffe5c, 0x1479e3c4, 0x853804c8, 0xffffff3c,
+0xf6c0940f, 0x588588d8, 0xc4fffffe, 0xc81479e3,
+0x3d853805, 0x0fffffff, 0xd8f6c094, 0xfe548588,
+0xe3c4ffff, 0x06c81479, 0xff3e8538, 0x940fffff,
+0x88d8f6c0, 0xfffe5085, 0x79e3c4ff, 0x3807c814,
+0xffff3f85, 0xc0940fff, 0x8588d8f6, 0xfffffe4c,
+0x1479e3c4, 0x853808c8, 0xffffff40, 0xf6c0940f,
+0x488588d8, 0xc4fffffe, 0xc81479e3, 0x41853809,
+0x0fffffff, 0xd8f6c094, 0xfe448588, 0xe3c4ffff,
+0x0ac81479, 0xff428538, 0x940fffff, 0x88d8f6c0,
+0xfffe4085, 0x79e3c4ff, 0x380bc814, 0xffff4385,
+0xc0940fff, 0x8588d8f6, 0xfffffe3c, 0x1479e3c4,
+0x85380cc8, 0xffffff44, 0xf6c0940f, 0x388588d8,
+0xc4fffffe, 0xc81479e3, 0x4585380d, 0x0fffffff,
+0xd8f6c094, 0xfe348588, 0xe3c4ffff, 0x0ec81479,
+0xff468538, 0xb58bffff, 0xfffffec8, 0xf6c0940f,
+0x6ef9c5d8, 0x308588fe, 0x8bfffffe, 0xfffe98b5,
+0x79e3c4ff, 0xc40fc814, 0xbd2041e3, 0xfffffea8,
+0x47853801, 0xc5ffffff, 0x8bce6ef9, 0xfffe84b5,
+0x71e3c4ff, 0xfe888d20, 0xc501ffff, 0x0fc961c1,
+0xd8f6c094, 0xf66ef9c5, 0xfe7cb58b, 0xe3c4ffff,
+0x83b52049, 0x01fffffe, 0xe66ef9c5, 0xfe78b58b,
+0xe3c4ffff, 0x82a52059, 0x01fffffe, 0xe461c9c5,
+0xcc62f1c5, 0xd66ef9c5, 0xfe70b58b, 0xe3c4ffff,
+0x74952069, 0x01fffffe, 0xde6ef9c5, 0x2061e3c4,
+0x9d8b01eb, 0xfffffe6c, 0xad7ff9c5, 0xfffffec8,
+0x9561e9c5, 0xfffffec8, 0xdb6ef9c5, 0x2061e3c4,
+0x8d8b01d9, 0xfffffe68, 0xe96ef9c5, 0x2051e3c4,
+0x958b01ea, 0xfffffe64, 0xdd61e1c5, 0xd362e9c5,
+0xca6cf1c5, 0xea6ef9c5, 0xfe60958b, 0xe3c4ffff,
+0x81ad2051, 0x01fffffe, 0xd26ef9c5, 0xfe58958b,
+0xe3c4ffff, 0x5c952069, 0x01fffffe, 0xea61d1c5,
+0xda6ef9c5, 0xfe50958b, 0xe3c4ffff, 0x549d2061,
+0x01fffffe, 0xe26ef9c5, 0xfe48958b, 0xe3c4ffff,
+0x4cb52059, 0x01fffffe, 0xb57ff9c5, 0xfffffec8,
+0xf26ef9c5, 0xfe40958b, 0xe3c4ffff, 0x44b52049,
+0x01fffffe, 0xe26ef9c5, 0x2059e3c4, 0xfffe3cbd,
+0xf9c501ff, 0xfea8bd7f, 0x958bffff, 0xfffffe38,
+0x9d61e1c5, 0xfffffec8, 0xb561c9c5, 0xfffffea8,
+0xeb62d1c5, 0xfa6ef9c5, 0xfe30958b, 0xe3c4ffff,
+0x34bd2041, 0x01fffffe, 0xe26ef9c5, 0x2059e3c4,
+0xc1c501e0, 0xc9c5fc61, 0xd1c5f762, 0xe3c4ee6c,
+0x01c51875, 0xffe2b9e8, 0x0331baff, 0xc0840000,
+0x082b840f, 0xc0310000, 0xb56ffdc5, 0xffffff48,
+0xa56ffdc5, 0xffffff68, 0xb57ffdc5, 0xfffffec8,
+0xa57ffdc5, 0xfffffea8, 0xfdc501a8, 0xfea88d6f,
+0x0875ffff, 0x8d6ffdc5, 0xfffffec8, 0x4d7ffdc5,
+0x05548ac8, 0x059488c8, 0xffffff08, 0x20f88340,
+0x7d80d675, 0x9f0f0088, 0x80d8f6c0, 0x8800897d,
+0xfffe9885, 0xc19f0fff, 0x7d80d9f6, 0x9f0f008a,
+0x80d8f6c0, 0x88008b7d, 0xfffe8885, 0xc29f0fff,
+0x7d80daf6, 0x9f0f008c, 0x80d8f6c0, 0x88008d7d,
+0xfffe8485, 0xc09f0fff, 0x7d80d8f6, 0x8588008e,
+0xfffffe83, 0xf6c09f0f, 0x8f7d80d8, 0x7c858800,
+0x0ffffffe, 0xd8f6c09f, 0x00907d80, 0xfe828588,
+0x9f0fffff, 0x80d8f6c0, 0x8800917d, 0xfffe7885,
+0xc09f0fff, 0x7d80d8f6, 0x9f0f0092, 0x80dbf6c3,
+0x8800937d, 0xfffe749d, 0xc39f0fff, 0x7d80dbf6,
+0x9d880094, 0xfffffe70, 0xf6c39f0f, 0x957d80db,
+0x6c9d8800, 0x0ffffffe, 0xdbf6c39f, 0x00967d80,
+0xfe689d88, 0x9f0fffff, 0x80dbf6c3, 0x8800977d,
+0xfffe649d, 0xc39f0fff, 0x7d80dbf6, 0x9d880098,
+0xfffffe81, 0xf6c39f0f, 0x997d80db, 0x609d8800,
+0x0ffffffe, 0xdbf6c39f, 0xfe5c9d88, 0xb58bffff,
+0xfffffe98, 0x009a7d80, 0xc5c39f0f, 0xc4d66ef9,
+0xd12069e3, 0x8bdbf601, 0xfffe888d, 0x9b7d80ff,
+0x589d8800, 0x0ffffffe, 0xf9c5c39f, 0xe3c4f96e,
+0x01fa2041, 0x958bdbf6, 0xfffffe84, 0xd761e9c5,
+0x009c7d80, 0xfe549d88, 0x9f0fffff, 0x6ef9c5c3,
+0x7c958be2, 0xf6fffffe, 0x59e3c4db, 0xfe83a520,
+0x8001ffff, 0x88009d7d, 0xfffe509d, 0x6ef9c5ff,
+0xc39f0ff2, 0x7d80dbf6, 0x9d88009e, 0xfffffe4c,
+0xf6c39f0f, 0x9f7d80db, 0x489d8800, 0x0ffffffe,
+0xdbf6c39f, 0x00a07d80, 0xfe449d88, 0x9f0fffff,
+0x80dbf6c3, 0x8800a17d, 0xfffe409d, 0xc39f0fff,
+0x7d80dbf6, 0x9d8800a2, 0xfffffe3c, 0xf6c39f0f,
+0xa37d80db, 0x389d8800, 0x0ffffffe, 0xdbf6c39f,
+0x00a47d80, 0xfe349d88, 0x9f0fffff, 0x80dbf6c3,
+0x8800a57d, 0xfffe309d, 0xc39f0fff, 0x7d80dbf6,
+0x9d8800a6, 0xfffffe80, 0xf6c39f0f, 0x2c9d88db,
+0x80fffffe, 0xc400a77d, 0xb52049e3, 0xfffffe82,
+0x61d9c501, 0x78958be6, 0xc5fffffe, 0x0fd462e9,
+0xdbf6c39f, 0xca6ef9c5, 0x2071e3c4, 0x858b01c8,
+0xfffffe74, 0xd86ef9c5, 0xfe6c858b, 0xe3c4ffff,
+0x70ad2061, 0x01fffffe, 0xad7ff9c5, 0xfffffe98,
+0x8d61f1c5, 0xfffffe98, 0xd86ef9c5, 0xfe64858b,
+0xe3c4ffff, 0x689d2061, 0x01fffffe, 0xe86ef9c5,
+0xfe60858b, 0xe3c4ffff, 0x81ad2051, 0x01fffffe,
+0xdd61e1c5, 0xcb62f1c5, 0xf16ce9c5, 0xb57ff9c5,
+0xfffffe98, 0xc86ef9c5, 0xfe58858b, 0xe3c4ffff,
+0x5c8d2071, 0x01fffffe, 0xf86ef9c5, 0xfe50858b,
+0xe3c4ffff, 0x54bd2041, 0x01fffffe, 0xcf61f1c5,
+0xbd6ff9c5, 0xfffffe98, 0xe06ef9c5, 0xfe48858b,
+0xe3c4ffff, 0x4ca52059, 0x01fffffe, 0xd06ef9c5,
+0xfe40858b, 0xe3c4ffff, 0x44b52069, 0x01fffffe,
+0xb57ff9c5, 0xfffffe88, 0xa561d9c5, 0xfffffe88,
+0xcc62f1c5, 0xa56ffdc5, 0xfffffec8, 0xd06ef9c5,
+0xfe38858b, 0xe3c4ffff, 0x3c952069, 0x01fffffe,
+0xf06ef9c5, 0xfe30858b, 0xe3c4ffff, 0x34b52049,
+0x01fffffe, 0xd661e9c5, 0xe86ef9c5, 0xfe2c858b,
+0xe3c4ffff, 0x80ad2051, 0x01fffffe, 0xd86ef9c5,
+0x2061e3c4, 0xd1c501db, 0xe9c5db61, 0xf1c5d362,
+0xe3c4ca6c, 0x01c91845, 0xa25ce88f, 0xfffea88d,
+0xe3c410ff, 0x00c81479, 0xff088538, 0x940fffff,
+0x88d8f6c0, 0xfffec885, 0x79e3c4ff, 0x3801c814,
+0xffff0985, 0xc0940fff, 0x8588d8f6, 0xfffffea8,
+0x1479e3c4, 0x853802c8, 0xffffff0a, 0xf6c0940f,
+0x988588d8, 0xc4fffffe, 0xc81479e3, 0x0b853803,
+0x0fffffff, 0xd8f6c094, 0xfe888588, 0xe3c4ffff,
+0x04c81479, 0xff0c8538, 0x940fffff, 0x88d8f6c0,
+0xfffe8485, 0x79e3c4ff, 0x3805c814, 0xffff0d85,
+0xc0940fff, 0x8588d8f6, 0xfffffe83, 0x1479e3c4,
+0x853806c8, 0xffffff0e, 0xf6c0940f, 0x7c8588d8,
+0xc4fffffe, 0xc81479e3, 0x0f853807, 0x0fffffff,
+0xd8f6c094, 0xfe828588, 0xe3c4ffff, 0x08c81479,
+0xff108538, 0x940fffff, 0x88d8f6c0, 0xfffe7885,
+0x79e3c4ff, 0x3809c814, 0xffff1185, 0xc0940fff,
+0x8588d8f6, 0xfffffe74, 0x1479e3c4, 0x85380ac8,
+0xffffff12, 0xf6c0940f, 0x708588d8, 0xc4fffffe,
+0xc81479e3, 0x1385380b, 0xc4ffffff, 0xc81479e3,
+0xc3940f0c, 0x8538dbf6, 0xffffff14, 0xf6c0940f,
+0x6c8588d8, 0xc4fffffe, 0xc81479e3, 0x1585380d,
+0xc4ffffff, 0xc81479e3, 0xc1940f0e, 0x8538d9f6,
+0xffffff16, 0xf6c0940f, 0x688588d8, 0xc4fffffe,
+0xc81479e3, 0x7de3c40f, 0x3801c919, 0xffff1785,
+0x79e3c4ff, 0x0f00c814, 0xdaf6c294, 0xff188538,
+0x940fffff, 0x88d8f6c0, 0xfffe6485, 0x79e3c4ff,
+0x3801c814, 0xffff1985, 0xc0940fff, 0x8588d8f6,
+0xfffffe81, 0x1479e3c4, 0x853802c8, 0xffffff1a,
+0xf6c0940f, 0x608588d8, 0xc4fffffe, 0xc81479e3,
+0xc8b58b03, 0x38fffffe, 0xffff1b85, 0xc0940fff,
+0xfe6ef9c5, 0xfe98b58b, 0xd8f6ffff, 0x2041e3c4,
+0xfffea8bd, 0x858801ff, 0xfffffe5c, 0x1479e3c4,
+0x853804c8, 0xffffff1c, 0xf6c0940f, 0x588588d8,
+0xc4fffffe, 0xc81479e3, 0x1d853805, 0x0fffffff,
+0xd8f6c094, 0xfe548588, 0xe3c4ffff, 0x06c81479,
+0xff1e8538, 0x940fffff, 0x88d8f6c0, 0xfffe5085,
+0x79e3c4ff, 0x3807c814, 0xffff1f85, 0xc0940fff,
+0x8588d8f6, 0xfffffe4c, 0x1479e3c4, 0x853808c8,
+0xffffff20, 0xf6c0940f, 0x488588d8, 0xc4fffffe,
+0xc81479e3, 0x21853809, 0x0fffffff, 0xd8f6c094,
+0xfe448588, 0xe3c4ffff, 0x0ac81479, 0xff228538,
+0x940fffff, 0x88d8f6c0, 0xfffe4085, 0x79e3c4ff,
+0x380bc814, 0xffff2385, 0xc0940fff, 0x8588d8f6,
+0xfffffe3c, 0x1479e3c4, 0x85380cc8, 0xffffff24,
+0xf6c0940f, 0x388588d8, 0xc4fffffe, 0xc81479e3,
+0x2585380d, 0x0fffffff, 0xd8f6c094, 0xfe348588,
+0xe3c4ffff, 0x0ec81479, 0xff268538, 0x940fffff,
+0x88d8f6c0, 0xfffe3085, 0x79e3c4ff, 0xc50fc814,
+0x8bce6ef9, 0xfffe84b5, 0x71e3c4ff, 0xfe888d20,
+0xc501ffff, 0x38c961c1, 0xffff2785, 0x6ef9c5ff,
+0x7cb58bf6, 0xc4fffffe, 0xb52049e3, 0xfffffe83,
+0xc0940f01, 0xf9c5d8f6, 0xe3c4e66e, 0x82a52059,
+0x01fffffe, 0xfe78b58b, 0xc9c5ffff, 0xf1c5e461,
+0xf9c5cc62, 0xb58bd66e, 0xfffffe70, 0x2069e3c4,
+0xfffe7495, 0xf9c501ff, 0xe3c4de6e, 0x01eb2061,
+0xfe6c9d8b, 0xf9c5ffff, 0xfec8ad7f, 0xe9c5ffff,
+0xfec89561, 0xf9c5ffff, 0xe3c4db6e, 0x01d92061,
+0xfe688d8b, 0xf9c5ffff, 0xe3c4e96e, 0x01ea2051,
+0xfe64958b, 0xe1c5ffff, 0xe9c5dd61, 0xf1c5d362,
+0xf9c5ca6c, 0x958bea6e, 0xfffffe60, 0x2051e3c4,
+0xfffe81ad, 0xf9c501ff, 0x958bd26e, 0xfffffe58,
+0x2069e3c4, 0xfffe5c95, 0xd1c501ff, 0xf9c5ea61,
+0x958bda6e, 0xfffffe50, 0x2061e3c4, 0xfffe549d,
+0xf9c501ff, 0x958be26e, 0xfffffe48, 0x2059e3c4,
+0xfffe4cbd, 0xf9c501ff, 0xfec8bd7f, 0xe1c5ffff,
+0xfec89d61, 0xd1c5ffff, 0xf9c5eb62, 0x958bf26e,
+0xfffffe40, 0x2049e3c4, 0xfffe44b5, 0xf9c501ff,
+0x958be26e, 0xfffffe38, 0x2059e3c4, 0xfffe3ca5,
+0xf9c501ff, 0xfea8a57f, 0xc9c5ffff, 0xfea8b561,
+0xf9c5ffff, 0x958bfa6e, 0xfffffe30, 0x2041e3c4,
+0xfffe34bd, 0xf9c501ff, 0xe3c4e26e, 0x01e02059,
+0xfc61c1c5, 0xf762c9c5, 0xee6cd1c5, 0x1875e3c4,
+0x8be801c5, 0x3cffffda, 0x81d21901, 0x0003c4e2,
+0x48c48100, 0x89000002, 0x5e5b59d0, 0x618d5d5f,
+0x3c8bc3fc, 0x0000c324, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x00000000, 0x00000000, 0x00000000,
+0022714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u1[] = {
+0x315526eb, 0x83e589c0, 0xec83e0e4, 0xc5e28920,
+0x24047ffd, 0xff103c80, 0x83400a75, 0xf47520f8,
+0x02eb01b0, 0xc3c9c031, 0x04244c8d, 0xffe0e483,
+0x01b0fc71, 0x000008ba, 0xe5895500, 0xf6315657,
+0x5121b353, 0x81a77d8d, 0x000208ec, 0x35848800,
+0xffffff48, 0xc128d988, 0x68358c88, 0x89ffffff,
+0x01e183f1, 0x4c88c9fe, 0xf1898835, 0x83f12146,
+0xda8301f9, 0x88c0fe00, 0xfe833714, 0xc5ce7520,
+0x48bd6ffd, 0xc5ffffff, 0xe8bd7ffd, 0x8afffffe,
+0xfffee885, 0x48853aff, 0x88ffffff, 0xfffec885,
+0xc0940fff, 0x8588d8f6, 0xfffffe48, 0xfee9858a,
+0x853affff, 0xffffff49, 0xfeb88588, 0x940fffff,
+0x88d8f6c0, 0xfffe3885, 0xea858aff, 0x3afffffe,
+0xffff4a85, 0xb48588ff, 0x0ffffffe, 0xd8f6c094,
+0xfe348588, 0x858affff, 0xfffffeeb, 0xff4b853a,
+0x8588ffff, 0xfffffeb3, 0xf6c0940f, 0x698588d8,
+0x8afffffe, 0xfffeec85, 0x4c853aff, 0x88ffffff,
+0xfffeac85, 0xc0940fff, 0x8588d8f6, 0xfffffe30,
+0xfeed858a, 0x853affff, 0xffffff4d, 0xfeb28588,
+0x940fffff, 0x88d8f6c0, 0xfffe6885, 0xee858aff,
+0x3afffffe, 0xffff4e85, 0xa88588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe2c8588, 0x858affff, 0xfffffeef,
+0xff4f853a, 0x8588ffff, 0xfffffeb1, 0xf6c0940f,
+0x2b8588d8, 0x8afffffe, 0xfffef085, 0x50853aff,
+0x8affffff, 0xfffef89d, 0xa48588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe248588, 0x858affff, 0xfffffef1,
+0xff51853a, 0x9d88ffff, 0xfffffe8b, 0xfea08588,
+0x940fffff, 0x88d8f6c0, 0xfffe2a85, 0xf2858aff,
+0x3afffffe, 0xffff5285, 0x9c8588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe208588, 0x858affff, 0xfffffef3,
+0xff53853a, 0x8588ffff, 0xfffffe98, 0x8ac1940f,
+0xfffef485, 0x3ad9f6ff, 0xffff5485, 0x948588ff,
+0x0ffffffe, 0xd8f6c094, 0xfe1c8588, 0x858affff,
+0xfffffef5, 0xff55853a, 0x8588ffff, 0xfffffe90,
+0x8ac2940f, 0xfffef685, 0x3adaf6ff, 0xffff5685,
+0xb08588ff, 0x0ffffffe, 0xd8f6c094, 0xfe188588,
+0x858affff, 0xfffffef7, 0xff57853a, 0x8588ffff,
+0xfffffe8c, 0xf6c0940f, 0x589d3ad8, 0x0fffffff,
+0xdbf6c394, 0xfe149d88, 0x9d8affff, 0xfffffef9,
+0xff599d3a, 0x9d88ffff, 0xfffffe84, 0xf6c3940f,
+0x299d88db, 0x8afffffe, 0xfffefa9d, 0x5a9d3aff,
+0x88ffffff, 0xfffe8a9d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe10, 0xfefb9d8a, 0x9d3affff, 0xffffff5b,
+0xfe809d88, 0x940fffff, 0x88dbf6c3, 0xfffe289d,
+0xfc9d8aff, 0x3afffffe, 0xffff5c9d, 0x899d88ff,
+0x0ffffffe, 0xdbf6c394, 0xfe0c9d88, 0x9d8affff,
+0xfffffefd, 0xff5d9d3a, 0x9d88ffff, 0xfffffe7c,
+0xf6c3940f, 0x0b9d88db, 0x8afffffe, 0xfffefe9d,
+0x5e9d3aff, 0x88ffffff, 0xfffe889d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe04, 0xfeff9d8a, 0x9d3affff,
+0xffffff5f, 0xfe789d88, 0x940fffff, 0x88dbf6c3,
+0xfffe0a9d, 0x009d8aff, 0x3affffff, 0xffff609d,
+0x779d88ff, 0x0ffffffe, 0xdbf6c394, 0xfe009d88,
+0x9d8affff, 0xffffff01, 0xff619d3a, 0xb58bffff,
+0xfffffe48, 0xfe709d88, 0x940fffff, 0x88dbf6c3,
+0xfffe099d, 0x029d8aff, 0xc5ffffff, 0x3afe6ef9,
+0xffff629d, 0x41e3c4ff, 0xfe38bd20, 0x8b01ffff,
+0xfffe34b5, 0x769d88ff, 0x0ffffffe, 0xdbf6c394,
+0xfdfc9d88, 0x9d8affff, 0xffffff03, 0xce6ef9c5,
+0xff639d3a, 0xe3c4ffff, 0x698d2071, 0x01fffffe,
+0xc961c1c5, 0xfe30b58b, 0x9d88ffff, 0xfffffe6c,
+0xf6c3940f, 0x089d88db, 0x8afffffe, 0xffff049d,
+0x6ef9c5ff, 0x649d3af6, 0x88ffffff, 0xfffe759d,
+0xc3940fff, 0x9d88dbf6, 0xfffffdf8, 0xff059d8a,
+0x9d3affff, 0xffffff65, 0xfe749d88, 0x940fffff,
+0x88dbf6c3, 0xfffdf79d, 0x069d8aff, 0x3affffff,
+0xffff669d, 0x6b9d88ff, 0x0ffffffe, 0xdbf6c394,
+0xfdf09d88, 0x9d8affff, 0xffffff07, 0xff679d3a,
+0x9d88ffff, 0xfffffe6a, 0x2049e3c4, 0xfffe68b5,
+0xb58b01ff, 0xfffffe2c, 0xf6c3940f, 0x6ef9c5db,
+0x24b58be6, 0xc4fffffe, 0xa52059e3, 0xfffffe2b,
+0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc, 0x20b58bd6,
+0xc4fffffe, 0x952069e3, 0xfffffe2a, 0x6ef9c501,
+0x61e3c4de, 0x8b01e920, 0xfffe1c8d, 0x7ff9c5ff,
+0xfffe48ad, 0x61e9c5ff, 0xfffe4895, 0x6ef9c5ff,
+0x61e3c4d9, 0x8b01da20, 0xfffe1895, 0x6ef9c5ff,
+0x51e3c4ea, 0x8b01e820, 0xfffe1485, 0x61e1c5ff,
+0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca, 0x10858be8,
+0xc4fffffe, 0xad2051e3, 0xfffffe29, 0x6ef9c501,
+0x0c858bd0, 0xc4fffffe, 0x952069e3, 0xfffffe28,
+0x61d1c501, 0x6ef9c5ea, 0x04858bd8, 0xc4fffffe,
+0x9d2061e3, 0xfffffe0b, 0x6ef9c501, 0x00858be0,
+0xc4fffffe, 0xbd2059e3, 0xfffffe0a, 0x7ff9c501,
+0xfffe48bd, 0x61e1c5ff, 0xfffe489d, 0x62d1c5ff,
+0x6ef9c5eb, 0xfc858bf0, 0xc4fffffd, 0xb52049e3,
+0xfffffe09, 0x6ef9c501, 0xf8858be0, 0xc4fffffd,
+0xbd2059e3, 0xfffffe08, 0x7ff9c501, 0xfffe38bd,
+0x61c9c5ff, 0xfffe38b5, 0x6ef9c5ff, 0xf0858bf8,
+0xc4fffffd, 0xbd2041e3, 0xfffffdf7, 0x6ef9c501,
+0x59e3c4e0, 0xc501e320, 0xc5fc61c1, 0xc5f762c9,
+0xc4ee6cd1, 0xc51875e3, 0xfa54e801, 0xc288ffff,
+0x000260b8, 0x0fd28400, 0x001f7084, 0x6ff9c500,
+0xfffee8bd, 0xfcc1c5ff, 0xffff488d, 0x6ff9c5ff,
+0xfffef8bd, 0xfcc1c5ff, 0xffff5895, 0x75e3c4ff,
+0xc501ca18, 0x088d7ffd, 0xc5ffffff, 0x48bd6ff9,
+0xc5ffffff, 0xc5d7fcc1, 0x58bd6ff9, 0xc4ffffff,
+0xd01479e3, 0x08853800, 0xc5ffffff, 0xc4cffcc1,
+0xcb1479e3, 0xc0940f00, 0x8588d8f6, 0xfffffe48,
+0x1479e3c4, 0x853801d0, 0xffffff09, 0xf6c0940f,
+0x388588d8, 0xc4fffffe, 0xd01479e3, 0x0a853802,
+0x0fffffff, 0xd8f6c094, 0xfe348588, 0xe3c4ffff,
+0x03d01479, 0xff0b8538, 0x940fffff, 0x88d8f6c0,
+0xfffe6985, 0x79e3c4ff, 0x3804d014, 0xffff0c85,
+0xc0940fff, 0x8588d8f6, 0xfffffe30, 0x1479e3c4,
+0x853805d0, 0xffffff0d, 0xf6c0940f, 0x688588d8,
+0xc4fffffe, 0xd01479e3, 0x0e853806, 0x0fffffff,
+0xd8f6c094, 0xfe2c8588, 0xe3c4ffff, 0x07d01479,
+0xff0f8538, 0x940fffff, 0x88d8f6c0, 0xfffe2b85,
+0x79e3c4ff, 0x3808d014, 0xffff1085, 0xc0940fff,
+0x8588d8f6, 0xfffffe24, 0x1479e3c4, 0x853809d0,
+0xffffff11, 0xf6c0940f, 0x2a8588d8, 0xc4fffffe,
+0xd01479e3, 0x1285380a, 0x0fffffff, 0xd8f6c094,
+0xfe208588, 0xe3c4ffff, 0x0bd01479, 0xff138538,
+0xe3c4ffff, 0x0cd01479, 0xf6c1940f, 0x148538d9,
+0x0fffffff, 0xd8f6c094, 0xfe1c8588, 0xe3c4ffff,
+0x0dd01479, 0xff158538, 0xe3c4ffff, 0x0ed01479,
+0xf6c2940f, 0x168538da, 0x0fffffff, 0xd8f6c094,
+0xfe188588, 0xe3c4ffff, 0x0fd01479, 0xff178538,
+0x940fffff, 0x38d8f6c0, 0xffff189d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe14, 0x1479e3c4, 0xb58b01cb,
+0xfffffe48, 0xff199d38, 0x940fffff, 0x6ef9c5c3,
+0x34b58bfe, 0xf6fffffe, 0x41e3c4db, 0xfe38bd20,
+0x8801ffff, 0xfffe299d, 0x79e3c4ff, 0x3802cb14,
+0xffff1a9d, 0xc3940fff, 0x9d88dbf6, 0xfffffe10,
+0x1479e3c4, 0x9d3803cb, 0xffffff1b, 0xf6c3940f,
+0x289d88db, 0xc4fffffe, 0xcb1479e3, 0x1c9d3804,
+0x0fffffff, 0xdbf6c394, 0xfe0c9d88, 0xe3c4ffff,
+0x05cb1479, 0xff1d9d38, 0x940fffff, 0x88dbf6c3,
+0xfffe0b9d, 0x79e3c4ff, 0x3806cb14, 0xffff1e9d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe04, 0x1479e3c4,
+0x9d3807cb, 0xffffff1f, 0xf6c3940f, 0x0a9d88db,
+0xc4fffffe, 0xcb1479e3, 0x209d3808, 0x0fffffff,
+0xdbf6c394, 0xfe009d88, 0xe3c4ffff, 0x09cb1479,
+0xff219d38, 0x940fffff, 0x88dbf6c3, 0xfffe099d,
+0x79e3c4ff, 0x380acb14, 0xffff229d, 0xc3940fff,
+0x9d88dbf6, 0xfffffdfc, 0x1479e3c4, 0x9d380bcb,
+0xffffff23, 0xf6c3940f, 0x089d88db, 0xc4fffffe,
+0xcb1479e3, 0x249d380c, 0x0fffffff, 0xdbf6c394,
+0xfdf89d88, 0xe3c4ffff, 0x0dcb1479, 0xff259d38,
+0x940fffff, 0x88dbf6c3, 0xfffdf79d, 0x79e3c4ff,
+0x380ecb14, 0xffff269d, 0xc3940fff, 0x9d88dbf6,
+0xfffffdf0, 0x1479e3c4, 0xf9c50fcb, 0x9d38ce6e,
+0xffffff27, 0x2071e3c4, 0xfffe698d, 0xc1c501ff,
+0xb58bc961, 0xfffffe30, 0xf6c3940f, 0x6ef9c5db,
+0x2cb58bf6, 0xc4fffffe, 0xb52049e3, 0xfffffe68,
+0x6ef9c501, 0x24b58be6, 0xc4fffffe, 0xa52059e3,
+0xfffffe2b, 0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc,
+0x20b58bd6, 0xc4fffffe, 0x952069e3, 0xfffffe2a,
+0x6ef9c501, 0x61e3c4de, 0x8b01e920, 0xfffe1c8d,
+0x7ff9c5ff, 0xfffe48ad, 0x61e9c5ff, 0xfffe4895,
+0x6ef9c5ff, 0x61e3c4d9, 0x8b01da20, 0xfffe1895,
+0x6ef9c5ff, 0x51e3c4ea, 0x8b01e820, 0xfffe1485,
+0x61e1c5ff, 0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca,
+0x10858be8, 0xc4fffffe, 0xad2051e3, 0xfffffe29,
+0x6ef9c501, 0x0c858bd0, 0xc4fffffe, 0x952069e3,
+0xfffffe28, 0x61d1c501, 0x6ef9c5ea, 0x04858bd8,
+0xc4fffffe, 0x9d2061e3, 0xfffffe0b, 0x6ef9c501,
+0x00858be0, 0xc4fffffe, 0xbd2059e3, 0xfffffe0a,
+0x7ff9c501, 0xfffe48bd, 0x61e1c5ff, 0xfffe489d,
+0x62d1c5ff, 0x6ef9c5eb, 0xfc858bf0, 0xc4fffffd,
+0xb52049e3, 0xfffffe09, 0x6ef9c501, 0xf8858be0,
+0xc4fffffd, 0xbd2059e3, 0xfffffe08, 0x7ff9c501,
+0xfffe38bd, 0x61c9c5ff, 0xfffe38b5, 0x6ef9c5ff,
+0xf0858bf8, 0xc4fffffd, 0xbd2041e3, 0xfffffdf7,
+0x6ef9c501, 0x59e3c4e0, 0xc501e320, 0xc5fc61c1,
+0xc5f762c9, 0xc4ee6cd1, 0xc51875e3, 0xf5a0e801,
+0xc288ffff, 0x000266b8, 0x0fd28400, 0x001abc84,
+0x6ff9c500, 0xffff08b5, 0x6ff9c5ff, 0xffff18bd,
+0xf8c9c5ff, 0xffff4895, 0xf8c1c5ff, 0xffff588d,
+0x6de3c4ff, 0xc501f118, 0x48b57ffd, 0xc5fffffe,
+0x48bd6ffd, 0xc5fffffe, 0x28bd7ffd, 0x8affffff,
+0xfffec885, 0x28853aff, 0x0fffffff, 0xd8f6c094,
+0xfec88588, 0x858affff, 0xfffffeb8, 0xff29853a,
+0x940fffff, 0x88d8f6c0, 0xfffeb885, 0xb4858aff,
+0x3afffffe, 0xffff2a85, 0xc0940fff, 0x8588d8f6,
+0xfffffeb4, 0xfeb3858a, 0x853affff, 0xffffff2b,
+0xf6c0940f, 0xb38588d8, 0x8afffffe, 0xfffeac85,
+0x2c853aff, 0x0fffffff, 0xd8f6c094, 0xfeac8588,
+0x858affff, 0xfffffeb2, 0xff2d853a, 0x940fffff,
+0x88d8f6c0, 0xfffeb285, 0xa8858aff, 0x3afffffe,
+0xffff2e85, 0xc0940fff, 0x8588d8f6, 0xfffffea8,
+0xfeb1858a, 0x853affff, 0xffffff2f, 0xf6c0940f,
+0xb18588d8, 0x8afffffe, 0xfffea485, 0x30853aff,
+0x0fffffff, 0xd8f6c094, 0xfea48588, 0x858affff,
+0xfffffea0, 0xff31853a, 0x858affff, 0xfffffe9c,
+0xf6c1940f, 0x32853ad9, 0x0fffffff, 0xd8f6c094,
+0xfea08588, 0x858affff, 0xfffffe98, 0xff33853a,
+0x858affff, 0xfffffe94, 0xfeb09d8a, 0x940fffff,
+0x3adaf6c2, 0xffff3485, 0xc0940fff, 0x8588d8f6,
+0xfffffe9c, 0xfe90858a, 0x853affff, 0xffffff35,
+0xf6c0940f, 0x369d3ad8, 0x0fffffff, 0xdbf6c394,
+0xfe989d88, 0x9d8affff, 0xfffffe8c, 0xff379d3a,
+0x940fffff, 0x88dbf6c3, 0xfffe949d, 0x8b9d8aff,
+0x3afffffe, 0xffff389d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe90, 0xfe849d8a, 0x9d3affff, 0xffffff39,
+0xf6c3940f, 0xb09d88db, 0x8afffffe, 0xfffe8a9d,
+0x3a9d3aff, 0x0fffffff, 0xdbf6c394, 0xfe8c9d88,
+0x9d8affff, 0xfffffe80, 0xff3b9d3a, 0x940fffff,
+0x88dbf6c3, 0xfffe8b9d, 0x899d8aff, 0x3afffffe,
+0xffff3c9d, 0xc3940fff, 0x9d88dbf6, 0xfffffe84,
+0xfe7c9d8a, 0x9d3affff, 0xffffff3d, 0xf6c3940f,
+0x8a9d88db, 0x8afffffe, 0xfffe889d, 0x3e9d3aff,
+0x8bffffff, 0xfffec8b5, 0xc3940fff, 0x9d88dbf6,
+0xfffffe80, 0xfe789d8a, 0xf9c5ffff, 0x9d3ace6e,
+0xffffff3f, 0x2071e3c4, 0xfffeb88d, 0xb58b01ff,
+0xfffffeb4, 0xf6c3940f, 0x899d88db, 0x8afffffe,
+0xfffe779d, 0x6ef9c5ff, 0x409d3afe, 0xc4ffffff,
+0xbd2041e3, 0xfffffeb3, 0x61f1c501, 0xc3940fcf,
+0x9d88dbf6, 0xfffffe7c, 0xfe709d8a, 0x9d3affff,
+0xffffff41, 0xf6c3940f, 0x889d88db, 0x8afffffe,
+0xfffe769d, 0x429d3aff, 0x0fffffff, 0xdbf6c394,
+0xfe789d88, 0x9d8affff, 0xfffffe6c, 0xff439d3a,
+0x940fffff, 0x88dbf6c3, 0xfffe779d, 0x759d8aff,
+0x3afffffe, 0xffff449d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe70, 0xfe749d8a, 0x9d3affff, 0xffffff45,
+0xf6c3940f, 0x769d88db, 0x8afffffe, 0xfffe6b9d,
+0x469d3aff, 0x0fffffff, 0xdbf6c394, 0xfe6c9d88,
+0x9d8affff, 0xfffffe6a, 0xff479d3a, 0xb58bffff,
+0xfffffeac, 0xf6c3940f, 0x6ef9c5db, 0xa8b58bf6,
+0xc4fffffe, 0xb52049e3, 0xfffffeb2, 0x6ef9c501,
+0xa4b58be6, 0xc4fffffe, 0xa52059e3, 0xfffffeb1,
+0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc, 0x69e3c4d6,
+0x8b01d120, 0xfffea08d, 0x6ef9c5ff, 0x61e3c4d9,
+0x8b01ea20, 0xfffe9c95, 0x7ff9c5ff, 0xfffec8ad,
+0x61e9c5ff, 0xfffec895, 0x6ef9c5ff, 0x61e3c4da,
+0x8b01d820, 0xfffe9885, 0x6ef9c5ff, 0x90858be8,
+0xc4fffffe, 0xad2051e3, 0xfffffe94, 0x61e1c501,
+0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca, 0x8c858be8,
+0xc4fffffe, 0xad2051e3, 0xfffffeb0, 0x6ef9c501,
+0x84858be0, 0xc4fffffe, 0xa52059e3, 0xfffffe8b,
+0x61d1c501, 0x6ef9c5ec, 0x80858bd8, 0xc4fffffe,
+0x9d2061e3, 0xfffffe8a, 0x6ef9c501, 0x7c858bd0,
+0xc4fffffe, 0xb52069e3, 0xfffffe89, 0x7ff9c501,
+0xfffec8b5, 0x61e1c5ff, 0xfffec89d, 0x62d1c5ff,
+0x6ef9c5eb, 0x78858bf0, 0xc4fffffe, 0xb52049e3,
+0xfffffe88, 0x6ef9c501, 0x70858bd0, 0xc4fffffe,
+0xbd2069e3, 0xfffffe77, 0x7ff9c501, 0xfffeb8bd,
+0x61c9c5ff, 0xfffeb8b5, 0x6ef9c5ff, 0x6c858bf8,
+0xc4fffffe, 0xbd2041e3, 0xfffffe76, 0x6ef9c501,
+0x69e3c4d0, 0xc501d320, 0xc5fa61c1, 0xc5f762c9,
+0xc4ee6cd1, 0xc51875e3, 0xf0f4e801, 0xc288ffff,
+0x00026bb8, 0x0fd28400, 0x00161084, 0x6ffdc500,
+0xfffee8b5, 0x56ccc5ff, 0xffff688d, 0x7ffdc5ff,
+0xfffee88d, 0x6ffdc5ff, 0xfffe48bd, 0x54c4c5ff,
+0xffff688d, 0x6ffdc5ff, 0xffff28b5, 0x57ccc5ff,
+0xffff68a5, 0x7ffdc5ff, 0xffff28a5, 0x28958aff,
+0xc5ffffff, 0xe88d55f4, 0xc4fffffe, 0xc81479e3,
+0x0fc23800, 0xd8f6c094, 0xfec88588, 0xe3c4ffff,
+0x01c81479, 0xff298538, 0x940fffff, 0x88d8f6c0,
+0xfffeb885, 0x79e3c4ff, 0x3802c814, 0xffff2a85,
+0xc0940fff, 0x8588d8f6, 0xfffffeb4, 0x1479e3c4,
+0x853803c8, 0xffffff2b, 0xf6c0940f, 0xb38588d8,
+0xc4fffffe, 0xc81479e3, 0x2c853804, 0x0fffffff,
+0xd8f6c094, 0xfeac8588, 0xe3c4ffff, 0x05c81479,
+0xff2d8538, 0x940fffff, 0x88d8f6c0, 0xfffeb285,
+0x79e3c4ff, 0x3806c814, 0xffff2e85, 0xc0940fff,
+0x8588d8f6, 0xfffffea8, 0x1479e3c4, 0x853807c8,
+0xffffff2f, 0xf6c0940f, 0xb18588d8, 0xc4fffffe,
+0xc81479e3, 0x30853808, 0x0fffffff, 0xd8f6c094,
+0xfea48588, 0xe3c4ffff, 0x09c81479, 0xff318538,
+0x940fffff, 0x88d8f6c0, 0xfffea085, 0x79e3c4ff,
+0x380ac814, 0xffff3285, 0xc0940fff, 0x8588d8f6,
+0xfffffe9c, 0x1479e3c4, 0x85380bc8, 0xffffff33,
+0x1479e3c4, 0x940f0cc8, 0x38dbf6c3, 0xffff3485,
+0xc0940fff, 0x8588d8f6, 0xfffffe98, 0x1479e3c4,
+0x85380dc8, 0xffffff35, 0x1479e3c4, 0x940f0ec8,
+0x38d9f6c1, 0xffff3685, 0xc0940fff, 0x8588d8f6,
+0xfffffe94, 0x1479e3c4, 0xe3c40fc8, 0x01c9197d,
+0xff378538, 0xe3c4ffff, 0x00c81479, 0xf6c2940f,
+0x388538da, 0x0fffffff, 0xd8f6c094, 0xfe908588,
+0xe3c4ffff, 0x01c81479, 0xff398538, 0x940fffff,
+0x88d8f6c0, 0xfffeb085, 0x79e3c4ff, 0x8b02c814,
+0xfffec8b5, 0x3a8538ff, 0x0fffffff, 0xf9c5c094,
+0xb58bfe6e, 0xfffffeb4, 0xe3c4d8f6, 0xb8bd2041,
+0x01fffffe, 0xfe8c8588, 0xe3c4ffff, 0x03c81479,
+0xff3b8538, 0x940fffff, 0x88d8f6c0, 0xfffe8b85,
+0x79e3c4ff, 0x3804c814, 0xffff3c85, 0xc0940fff,
+0x8588d8f6, 0xfffffe84, 0x1479e3c4, 0x853805c8,
+0xffffff3d, 0xf6c0940f, 0x8a8588d8, 0xc4fffffe,
+0xc81479e3, 0x3e853806, 0x0fffffff, 0xd8f6c094,
+0xfe808588, 0xe3c4ffff, 0x07c81479, 0xff3f8538,
+0x940fffff, 0x88d8f6c0, 0xfffe8985, 0x79e3c4ff,
+0x3808c814, 0xffff4085, 0xc0940fff, 0x8588d8f6,
+0xfffffe7c, 0x1479e3c4, 0x853809c8, 0xffffff41,
+0xf6c0940f, 0x888588d8, 0xc4fffffe, 0xc81479e3,
+0x4285380a, 0x0fffffff, 0xd8f6c094, 0xfe788588,
+0xe3c4ffff, 0x0bc81479, 0xff438538, 0x940fffff,
+0x88d8f6c0, 0xfffe7785, 0x79e3c4ff, 0x380cc814,
+0xffff4485, 0xc0940fff, 0x8588d8f6, 0xfffffe70,
+0x1479e3c4, 0x85380dc8, 0xffffff45, 0xf6c0940f,
+0x768588d8, 0xc4fffffe, 0xc81479e3, 0x4685380e,
+0x0fffffff, 0xd8f6c094, 0xfe6c8588, 0xe3c4ffff,
+0x0fc81479, 0xce6ef9c5, 0xfeacb58b, 0xe3c4ffff,
+0xb38d2071, 0x01fffffe, 0xc961c1c5, 0xff478538,
+0xf9c5ffff, 0xe3c4f66e, 0xb2b52049, 0x01fffffe,
+0xfea8b58b, 0x940fffff, 0xc5d8f6c0, 0x8be66ef9,
+0xfffea4b5, 0x59e3c4ff, 0xfeb1a520, 0xc501ffff,
+0xc5e461c9, 0xc5cc62f1, 0x8bd66ef9, 0xfffe9cb5,
+0x69e3c4ff, 0xfea09520, 0xc501ffff, 0xc4de6ef9,
+0xeb2061e3, 0x989d8b01, 0xc5fffffe, 0xc8ad7ff9,
+0xc5fffffe, 0xc89561e9, 0xc5fffffe, 0xc4db6ef9,
+0xd92061e3, 0x948d8b01, 0xc5fffffe, 0xc4e96ef9,
+0xea2051e3, 0x90958b01, 0xc5fffffe, 0xc5dd61e1,
+0xc5d362e9, 0xc5ca6cf1, 0x8bea6ef9, 0xfffe8c95,
+0x51e3c4ff, 0xfeb0ad20, 0xc501ffff, 0x8bd26ef9,
+0xfffe8495, 0x69e3c4ff, 0xfe8b9520, 0xc501ffff,
+0xc5ea61d1, 0x8bda6ef9, 0xfffe8095, 0x61e3c4ff,
+0xfe8a9d20, 0xc501ffff, 0x8be26ef9, 0xfffe7c95,
+0x59e3c4ff, 0xfe89bd20, 0xc501ffff, 0xc8bd7ff9,
+0xc5fffffe, 0xc89d61e1, 0xc5fffffe, 0xc5eb62d1,
+0x8bf26ef9, 0xfffe7895, 0x49e3c4ff, 0xfe88b520,
+0xc501ffff, 0x8be26ef9, 0xfffe7095, 0x59e3c4ff,
+0xfe77a520, 0xc501ffff, 0xb8a57ff9, 0xc5fffffe,
+0xb8b561c9, 0xc5fffffe, 0x8bfa6ef9, 0xfffe6c95,
+0x41e3c4ff, 0xfe76bd20, 0xc501ffff, 0xc4e26ef9,
+0xe02059e3, 0x61c1c501, 0x62c9c5fc, 0x6cd1c5f7,
+0x75e3c4ee, 0xe801c518, 0xffffec36, 0x77b8c288,
+0x84000002, 0x52840fd2, 0x8a000011, 0xd8f6a845,
+0x8588c018, 0xfffffec8, 0xf6a9458a, 0x88c018d8,
+0xfffeb885, 0xaa458aff, 0x458ad8f6, 0xc5db18ab,
+0xf6cb6ef9, 0x88c018d8, 0xfffeb485, 0xac458aff,
+0x458ad8f6, 0xc5c918ad, 0xf6f16ef9, 0x88c018d8,
+0xfffeb385, 0xae458aff, 0xc018d8f6, 0xfeac8588,
+0x458affff, 0x18d8f6af, 0xb28588c0, 0x8afffffe,
+0xd8f6b045, 0x8588c018, 0xfffffea8, 0xf6b1458a,
+0x88c018d8, 0xfffeb185, 0xb2458aff, 0xc018d8f6,
+0xfea48588, 0x458affff, 0x18d8f6b3, 0xa08588c0,
+0x8afffffe, 0xd8f6b445, 0x18b5458a, 0x18d8f6d2,
+0x9c8588c0, 0x8afffffe, 0xd8f6b645, 0x8588c018,
+0xfffffe98, 0xf6b7458a, 0x88c018d8, 0xfffe9485,
+0xb8458aff, 0xc018d8f6, 0xfe908588, 0x458affff,
+0x18d8f6b9, 0xb08588c0, 0x8afffffe, 0xe3c4ba45,
+0xb3b52049, 0x01fffffe, 0xfeac8d8b, 0xe3c4ffff,
+0xb48d2071, 0x01fffffe, 0xfec8b58b, 0xd8f6ffff,
+0xf9c5c018, 0x8588e16e, 0xfffffe8c, 0xc5bb458a,
+0xc4fe6ef9, 0xbd2041e3, 0xfffffeb8, 0x61c1c501,
+0x18d8f6c9, 0x8b8588c0, 0x8afffffe, 0xd8f6bc45,
+0x8588c018, 0xfffffe84, 0xf6bd458a, 0x88c018d8,
+0xfffe8a85, 0xbe458aff, 0xc018d8f6, 0xfe808588,
+0x458affff, 0x18d8f6bf, 0x898588c0, 0x8afffffe,
+0xd8f6c045, 0x8588c018, 0xfffffe7c, 0xf6c1458a,
+0x88c018d8, 0xfffe8885, 0xc2458aff, 0xc018d8f6,
+0xfe788588, 0x458affff, 0x18d8f6c3, 0x778588c0,
+0x8afffffe, 0xd8f6c445, 0x8588c018, 0xfffffe70,
+0xf6c5458a, 0x88c018d8, 0xfffe7685, 0xc6458aff,
+0xc018d8f6, 0xfe6c8588, 0x458affff, 0x59e3c4c7,
+0xfeb2a520, 0x8b01ffff, 0xfffea88d, 0x61c9c5ff,
+0x62f1c5e4, 0xc5d8f6cc, 0x8bd16ef9, 0xfffea48d,
+0x69e3c4ff, 0xfeb19520, 0x1801ffff, 0x6ef9c5c0,
+0x61e3c4d9, 0xfea0ad20, 0xc501ffff, 0x8bda6ef9,
+0xfffe9895, 0x7ff9c5ff, 0xfffec8ad, 0x61e3c4ff,
+0xfe9c9d20, 0xc501ffff, 0xc89561e9, 0xc5fffffe,
+0x8bea6ef9, 0xfffe9095, 0x51e3c4ff, 0xfe94ad20,
+0xc501ffff, 0xc5dd61e1, 0xc5d362e9, 0xc5ca6cf1,
+0x8bea6ef9, 0xfffe8c95, 0x51e3c4ff, 0xfeb0ad20,
+0xc501ffff, 0x8bfa6ef9, 0xfffe8495, 0x41e3c4ff,
+0xfe8bbd20, 0xc501ffff, 0xc5ef61d1, 0x8bda6ef9,
+0xfffe8095, 0x61e3c4ff, 0xfe8a9d20, 0xc501ffff,
+0x8bd26ef9, 0xfffe7c95, 0x69e3c4ff, 0xfe89b520,
+0xc501ffff, 0xc8b57ff9, 0xc5fffffe, 0xc89d61e1,
+0xc5fffffe, 0xc5eb62d1, 0x8bf26ef9, 0xfffe7895,
+0x49e3c4ff, 0xfe88b520, 0xc501ffff, 0x8bd26ef9,
+0xfffe7095, 0x69e3c4ff, 0xfe77a520, 0xc501ffff,
+0xb8a57ff9, 0xc5fffffe, 0xb8b561c9, 0xc5fffffe,
+0x8bd26ef9, 0xfffe6c95, 0x69e3c4ff, 0xfe769520,
+0xc501ffff, 0xc4e26ef9, 0xe02059e3, 0x61e9c501,
+0x62c9c5d4, 0x6cd1c5f2, 0x75e3c4ee, 0xc501cd18,
+0x488d54f4, 0xc5ffffff, 0xc5d16ff9, 0x288d7ffd,
+0x8fffffff, 0x5d98f0e9, 0x6ff9c5a8, 0xe98fb87d,
+0x388d9840, 0xc4ffffff, 0xf11865e3, 0x7ffdc501,
+0xfffec8b5, 0x6ffdc5ff, 0xfffec8bd, 0xc8958aff,
+0xc5fffffe, 0xe8bd7ffd, 0xc5fffffe, 0xc5c976f1,
+0xa85dfcf1, 0x4dfcf1c5, 0x65e3c4b8, 0xc501c918,
+0xa84d7ffd, 0x98e8e98f, 0xf9c5a855, 0x8fb8656f,
+0x8d9858e9, 0xffffff38, 0x186de3c4, 0xe9c501d9,
+0xfdc5d2fc, 0xff089d7f, 0xe3c4ffff, 0x00d01479,
+0xf1c5c238, 0x940fc9fc, 0x88d8f6c0, 0xfffec885,
+0x79e3c4ff, 0x3801d014, 0xfffee985, 0xc0940fff,
+0x8588d8f6, 0xfffffeb8, 0x1479e3c4, 0x853802d0,
+0xfffffeea, 0xf6c0940f, 0xb48588d8, 0xc4fffffe,
+0xd01479e3, 0xeb853803, 0x0ffffffe, 0xd8f6c094,
+0xfeb38588, 0xe3c4ffff, 0x04d01479, 0xfeec8538,
+0x940fffff, 0x88d8f6c0, 0xfffeac85, 0x79e3c4ff,
+0x3805d014, 0xfffeed85, 0xc0940fff, 0x8588d8f6,
+0xfffffeb2, 0x1479e3c4, 0x853806d0, 0xfffffeee,
+0xf6c0940f, 0xa88588d8, 0xc4fffffe, 0xd01479e3,
+0xef853807, 0x0ffffffe, 0xd8f6c094, 0xfeb18588,
+0xe3c4ffff, 0x08d01479, 0xfef08538, 0x940fffff,
+0x88d8f6c0, 0xfffea485, 0x79e3c4ff, 0x3809d014,
+0xfffef185, 0xc0940fff, 0x8588d8f6, 0xfffffea0,
+0x1479e3c4, 0x85380ad0, 0xfffffef2, 0xf6c0940f,
+0x9c8588d8, 0xc4fffffe, 0xd01479e3, 0xf385380b,
+0xc4fffffe, 0xd01479e3, 0xc3940f0c, 0x8538dbf6,
+0xfffffef4, 0xf6c0940f, 0x988588d8, 0xc4fffffe,
+0xd01479e3, 0xf585380d, 0xc4fffffe, 0xd01479e3,
+0xc1940f0e, 0x8538d9f6, 0xfffffef6, 0xf6c0940f,
+0x948588d8, 0xc4fffffe, 0xd01479e3, 0xf785380f,
+0xc4fffffe, 0xc81479e3, 0xc2940f00, 0x8538daf6,
+0xfffffef8, 0xf6c0940f, 0x908588d8, 0xc4fffffe,
+0xc81479e3, 0xf9853801, 0x0ffffffe, 0xd8f6c094,
+0xfeb08588, 0xe3c4ffff, 0x02c81479, 0xfefa8538,
+0x940fffff, 0x88d8f6c0, 0xfffe8c85, 0x79e3c4ff,
+0x3803c814, 0xfffefb85, 0xc0940fff, 0x8588d8f6,
+0xfffffe8b, 0x1479e3c4, 0x853804c8, 0xfffffefc,
+0xf6c0940f, 0x848588d8, 0xc4fffffe, 0xc81479e3,
+0xfd853805, 0x0ffffffe, 0xd8f6c094, 0xfe8a8588,
+0xe3c4ffff, 0x06c81479, 0xfefe8538, 0x940fffff,
+0x88d8f6c0, 0xfffe8085, 0x79e3c4ff, 0x3807c814,
+0xfffeff85, 0xc0940fff, 0x8588d8f6, 0xfffffe89,
+0x1479e3c4, 0x853808c8, 0xffffff00, 0xf6c0940f,
+0x7c8588d8, 0xc4fffffe, 0xc81479e3, 0x01853809,
+0x0fffffff, 0xd8f6c094, 0xfe888588, 0xe3c4ffff,
+0x0ac81479, 0xff028538, 0x940fffff, 0x88d8f6c0,
+0xfffe7885, 0x79e3c4ff, 0x380bc814, 0xffff0385,
+0xc0940fff, 0x8588d8f6, 0xfffffe77, 0x1479e3c4,
+0x85380cc8, 0xffffff04, 0xf6c0940f, 0x708588d8,
+0xc4fffffe, 0xc81479e3, 0x0585380d, 0x0fffffff,
+0xd8f6c094, 0xfe768588, 0xe3c4ffff, 0x0ec81479,
+0xff068538, 0x940fffff, 0x88d8f6c0, 0xfffe6c85,
+0xc8b58bff, 0xc4fffffe, 0xc81479e3, 0x0785380f,
+0xc5ffffff, 0x8bfe6ef9, 0xfffeb4b5, 0x41e3c4ff,
+0xfeb8bd20, 0x0f01ffff, 0xd8f6c094, 0xce6ef9c5,
+0xfeacb58b, 0xe3c4ffff, 0xb38d2071, 0x01fffffe,
+0xc961c1c5, 0xf66ef9c5, 0xfea8b58b, 0xe3c4ffff,
+0xb2b52049, 0x01fffffe, 0xe66ef9c5, 0xfea4b58b,
+0xe3c4ffff, 0xb1a52059, 0x01fffffe, 0xe461c9c5,
+0xcc62f1c5, 0xd66ef9c5, 0xfe9cb58b, 0xe3c4ffff,
+0xa0952069, 0x01fffffe, 0xde6ef9c5, 0x2061e3c4,
+0x9d8b01eb, 0xfffffe98, 0xad7ff9c5, 0xfffffec8,
+0x9561e9c5, 0xfffffec8, 0xdb6ef9c5, 0x2061e3c4,
+0x8d8b01d9, 0xfffffe94, 0xe96ef9c5, 0x2051e3c4,
+0x958b01ea, 0xfffffe90, 0xdd61e1c5, 0xd362e9c5,
+0xca6cf1c5, 0xea6ef9c5, 0xfe8c958b, 0xe3c4ffff,
+0xb0ad2051, 0x01fffffe, 0xd26ef9c5, 0xfe84958b,
+0xe3c4ffff, 0x8b952069, 0x01fffffe, 0xea61d1c5,
+0xda6ef9c5, 0xfe80958b, 0xe3c4ffff, 0x8a9d2061,
+0x01fffffe, 0xe26ef9c5, 0xfe7c958b, 0xe3c4ffff,
+0x89b52059, 0x01fffffe, 0xb57ff9c5, 0xfffffec8,
+0xf26ef9c5, 0xfe78958b, 0xe3c4ffff, 0x88b52049,
+0x01fffffe, 0xe26ef9c5, 0xfe70958b, 0xe3c4ffff,
+0x77bd2059, 0x01fffffe, 0xbd7ff9c5, 0xfffffeb8,
+0xfa6ef9c5, 0x2041e3c4, 0xfffe76bd, 0x958b01ff,
+0xfffffe6c, 0x9d61e1c5, 0xfffffec8, 0xb561c9c5,
+0xfffffeb8, 0xeb62d1c5, 0xe26ef9c5, 0x2059e3c4,
+0xc1c501e0, 0xc9c5fc61, 0xd1c5f762, 0xe3c4ee6c,
+0x01c51875, 0xffe429e8, 0xb8c288ff, 0x0000032c,
+0x840fd284, 0x00000945, 0xc9eff1c5, 0x55f8f1c5,
+0xf8f1c5a8, 0xe98fb84d, 0x08959468, 0x8fffffff,
+0x8d9470e9, 0xffffff18, 0x1479e3c4, 0x853800d0,
+0xffffff28, 0x186de3c4, 0xfdc501d9, 0xfee89d7f,
+0x940fffff, 0x88d8f6c0, 0xfffec885, 0x79e3c4ff,
+0x3801d014, 0xffff2985, 0xc0940fff, 0x8588d8f6,
+0xfffffeb8, 0x1479e3c4, 0x853802d0, 0xffffff2a,
+0xf6c0940f, 0xb48588d8, 0xc4fffffe, 0xd01479e3,
+0x2b853803, 0x0fffffff, 0xd8f6c094, 0xfeb38588,
+0xe3c4ffff, 0x04d01479, 0xff2c8538, 0x940fffff,
+0x88d8f6c0, 0xfffeac85, 0x79e3c4ff, 0x3805d014,
+0xffff2d85, 0xc0940fff, 0x8588d8f6, 0xfffffeb2,
+0x1479e3c4, 0x853806d0, 0xffffff2e, 0xf6c0940f,
+0xa88588d8, 0xc4fffffe, 0xd01479e3, 0x2f853807,
+0x0fffffff, 0xd8f6c094, 0xfeb18588, 0xe3c4ffff,
+0x08d01479, 0xff308538, 0x940fffff, 0x88d8f6c0,
+0xfffea485, 0x79e3c4ff, 0x3809d014, 0xffff3185,
+0xc0940fff, 0x8588d8f6, 0xfffffea0, 0x1479e3c4,
+0x85380ad0, 0xffffff32, 0xf6c0940f, 0x9c8588d8,
+0xc4fffffe, 0xd01479e3, 0x3385380b, 0xc4ffffff,
+0xd01479e3, 0xc3940f0c, 0x8538dbf6, 0xffffff34,
+0xf6c0940f, 0x988588d8, 0xc4fffffe, 0xd01479e3,
+0x3585380d, 0xc4ffffff, 0xd01479e3, 0xc1940f0e,
+0x8538d9f6, 0xffffff36, 0xf6c0940f, 0x948588d8,
+0xc4fffffe, 0xd01479e3, 0x3785380f, 0xc4ffffff,
+0xc81479e3, 0xc2940f00, 0x8538daf6, 0xffffff38,
+0xf6c0940f, 0x908588d8, 0xc4fffffe, 0xc81479e3,
+0x39853801, 0x0fffffff, 0xd8f6c094, 0xfeb08588,
+0xe3c4ffff, 0x02c81479, 0xff3a8538, 0x940fffff,
+0x88d8f6c0, 0xfffe8c85, 0x79e3c4ff, 0x3803c814,
+0xffff3b85, 0xc0940fff, 0x8588d8f6, 0xfffffe8b,
+0x1479e3c4, 0x853804c8, 0xffffff3c, 0xf6c0940f,
+0x848588d8, 0xc4fffffe, 0xc81479e3, 0x3d853805,
+0x0fffffff, 0xd8f6c094, 0xfe8a8588, 0xe3c4ffff,
+0x06c81479, 0xff3e8538, 0x940fffff, 0x88d8f6c0,
+0xfffe8085, 0x79e3c4ff, 0x3807c814, 0xffff3f85,
+0xc0940fff, 0x8588d8f6, 0xfffffe89, 0x1479e3c4,
+0x853808c8, 0xffffff40, 0xf6c0940f, 0x7c8588d8,
+0xc4fffffe, 0xc81479e3, 0x41853809, 0x0fffffff,
+0xd8f6c094, 0xfe888588, 0xe3c4ffff, 0x0ac81479,
+0xff428538, 0x940fffff, 0x88d8f6c0, 0xfffe7885,
+0x79e3c4ff, 0x380bc814, 0xffff4385, 0xc0940fff,
+0x8588d8f6, 0xfffffe77, 0x1479e3c4, 0x85380cc8,
+0xffffff44, 0xf6c0940f, 0x708588d8, 0xc4fffffe,
+0xc81479e3, 0x4585380d, 0x0fffffff, 0xd8f6c094,
+0xfe768588, 0xe3c4ffff, 0x0ec81479, 0xff468538,
+0xb58bffff, 0xfffffec8, 0xf6c0940f, 0x6ef9c5d8,
+0x6c8588fe, 0x8bfffffe, 0xfffeb4b5, 0x79e3c4ff,
+0xc40fc814, 0xbd2041e3, 0xfffffeb8, 0x47853801,
+0xc5ffffff, 0x8bce6ef9, 0xfffeacb5, 0x71e3c4ff,
+0xfeb38d20, 0xc501ffff, 0x0fc961c1, 0xd8f6c094,
+0xf66ef9c5, 0xfea8b58b, 0xe3c4ffff, 0xb2b52049,
+0x01fffffe, 0xe66ef9c5, 0xfea4b58b, 0xe3c4ffff,
+0xb1a52059, 0x01fffffe, 0xe461c9c5, 0xcc62f1c5,
+0xd66ef9c5, 0xfe9cb58b, 0xe3c4ffff, 0xa0952069,
+0x01fffffe, 0xde6ef9c5, 0x2061e3c4, 0x9d8b01db,
+0xfffffe98, 0x9d7ff9c5, 0xfffffec8, 0x9561e9c5,
+0xfffffec8, 0xdb6ef9c5, 0x2061e3c4, 0x8d8b01d9,
+0xfffffe94, 0xe96ef9c5, 0x2051e3c4, 0x958b01ea,
+0xfffffe90, 0xdd61e1c5, 0xd362e9c5, 0xca6cf1c5,
+0xea6ef9c5, 0xfe8c958b, 0xe3c4ffff, 0xb0ad2051,
+0x01fffffe, 0xd26ef9c5, 0xfe84958b, 0xe3c4ffff,
+0x8b952069, 0x01fffffe, 0xea61d1c5, 0xda6ef9c5,
+0xfe80958b, 0xe3c4ffff, 0x8a9d2061, 0x01fffffe,
+0xe26ef9c5, 0xfe7c958b, 0xe3c4ffff, 0x89a52059,
+0x01fffffe, 0xa57ff9c5, 0xfffffec8, 0xf26ef9c5,
+0xfe78958b, 0xe3c4ffff, 0x88b52049, 0x01fffffe,
+0xe26ef9c5, 0x2059e3c4, 0xfffe77bd, 0xf9c501ff,
+0xfeb8bd7f, 0x958bffff, 0xfffffe70, 0x9d61e1c5,
+0xfffffec8, 0xb561c9c5, 0xfffffeb8, 0xeb62d1c5,
+0xfa6ef9c5, 0xfe6c958b, 0xe3c4ffff, 0x76bd2041,
+0x01fffffe, 0xe26ef9c5, 0x2059e3c4, 0xc1c501e0,
+0xc9c5fc61, 0xd1c5f762, 0xe3c4ee6c, 0x01c51875,
+0xffdf8de8, 0xb8c288ff, 0x00000331, 0x840fd284,
+0x000004a9, 0xfdc5c031, 0xff488d6f, 0xfdc5ffff,
+0xff68956f, 0x01a8ffff, 0xda6ffdc5, 0xfdc50475,
+0xfdc5d96f, 0x8ac85d7f, 0x88c80554, 0xff080594,
+0x8340ffff, 0xde7520f8, 0xa2f4e88f, 0xc420884d,
+0xc81479e3, 0x08853800, 0x0fffffff, 0xd8f6c094,
+0xfec88588, 0xe3c4ffff, 0x01c81479, 0xff098538,
+0x940fffff, 0x88d8f6c0, 0xfffeb885, 0x79e3c4ff,
+0x3802c814, 0xffff0a85, 0xc0940fff, 0x8588d8f6,
+0xfffffeb4, 0x1479e3c4, 0x853803c8, 0xffffff0b,
+0xf6c0940f, 0xb38588d8, 0xc4fffffe, 0xc81479e3,
+0x0c853804, 0x0fffffff, 0xd8f6c094, 0xfeac8588,
+0xe3c4ffff, 0x05c81479, 0xff0d8538, 0x940fffff,
+0x88d8f6c0, 0xfffeb285, 0x79e3c4ff, 0x3806c814,
+0xffff0e85, 0xc0940fff, 0x8588d8f6, 0xfffffea8,
+0x1479e3c4, 0x853807c8, 0xffffff0f, 0xf6c0940f,
+0xb18588d8, 0xc4fffffe, 0xc81479e3, 0x10853808,
+0x0fffffff, 0xd8f6c094, 0xfea48588, 0xe3c4ffff,
+0x09c81479, 0xff118538, 0x940fffff, 0x88d8f6c0,
+0xfffea085, 0x79e3c4ff, 0x380ac814, 0xffff1285,
+0xc0940fff, 0x8588d8f6, 0xfffffe9c, 0x1479e3c4,
+0x85380bc8, 0xffffff13, 0x1479e3c4, 0x940f0cc8,
+0x38dbf6c3, 0xffff1485, 0xc0940fff, 0x8588d8f6,
+0xfffffe98, 0x1479e3c4, 0x85380dc8, 0xffffff15,
+0x1479e3c4, 0x940f0ec8, 0x38d9f6c1, 0xffff1685,
+0xc0940fff, 0x8588d8f6, 0xfffffe94, 0x1479e3c4,
+0xe3c40fc8, 0x01c9197d, 0xff178538, 0xe3c4ffff,
+0x00c81479, 0xf6c2940f, 0x188538da, 0x0fffffff,
+0xd8f6c094, 0xfe908588, 0xe3c4ffff, 0x01c81479,
+0xff198538, 0xb58bffff, 0xfffffec8, 0xf6c0940f,
+0xb08588d8, 0xc4fffffe, 0xc81479e3, 0x6ef9c502,
+0x1a8538fe, 0xc4ffffff, 0xbd2041e3, 0xfffffeb8,
+0xb4b58b01, 0x0ffffffe, 0xd8f6c094, 0xfe8c8588,
+0xe3c4ffff, 0x03c81479, 0xff1b8538, 0x940fffff,
+0x88d8f6c0, 0xfffe8b85, 0x79e3c4ff, 0x3804c814,
+0xffff1c85, 0xc0940fff, 0x8588d8f6, 0xfffffe84,
+0x1479e3c4, 0x853805c8, 0xffffff1d, 0xf6c0940f,
+0x8a8588d8, 0xc4fffffe, 0xc81479e3, 0x1e853806,
+0x0fffffff, 0xd8f6c094, 0xfe808588, 0xe3c4ffff,
+0x07c81479, 0xff1f8538, 0x940fffff, 0x88d8f6c0,
+0xfffe8985, 0x79e3c4ff, 0x3808c814, 0xffff2085,
+0xc0940fff, 0x8588d8f6, 0xfffffe7c, 0x1479e3c4,
+0x853809c8, 0xffffff21, 0xf6c0940f, 0x888588d8,
+0xc4fffffe, 0xc81479e3, 0x2285380a, 0x0fffffff,
+0xd8f6c094, 0xfe788588, 0xe3c4ffff, 0x0bc81479,
+0xff238538, 0x940fffff, 0x88d8f6c0, 0xfffe7785,
+0x79e3c4ff, 0x380cc814, 0xffff2485, 0xc0940fff,
+0x8588d8f6, 0xfffffe70, 0x1479e3c4, 0x85380dc8,
+0xffffff25, 0xf6c0940f, 0x768588d8, 0xc4fffffe,
+0xc81479e3, 0x2685380e, 0x0fffffff, 0xd8f6c094,
+0xfe6c8588, 0xe3c4ffff, 0x0fc81479, 0xce6ef9c5,
+0xff278538, 0xe3c4ffff, 0xb38d2071, 0x01fffffe,
+0xc961c1c5, 0xfeacb58b, 0x940fffff, 0xc5d8f6c0,
+0x8bf66ef9, 0xfffea8b5, 0x49e3c4ff, 0xfeb2b520,
+0xc501ffff, 0x8be66ef9, 0xfffea4b5, 0x59e3c4ff,
+0xfeb1a520, 0xc501ffff, 0xc5e461c9, 0xc5cc62f1,
+0x8bd66ef9, 0xfffe9cb5, 0x69e3c4ff, 0xfea09520,
+0xc501ffff, 0xc4de6ef9, 0xeb2061e3, 0x989d8b01,
+0xc5fffffe, 0xc8ad7ff9, 0xc5fffffe, 0xc89561e9,
+0xc5fffffe, 0xc4db6ef9, 0xd92061e3, 0x948d8b01,
+0xc5fffffe, 0xc4e96ef9, 0xea2051e3, 0x90958b01,
+0xc5fffffe, 0xc5dd61e1, 0xc5d362e9, 0xc5ca6cf1,
+0x8bea6ef9, 0xfffe8c95, 0x51e3c4ff, 0xfeb0ad20,
+0xc501ffff, 0x8bd26ef9, 0xfffe8495, 0x69e3c4ff,
+0xfe8b9520, 0xc501ffff, 0xc5ea61d1, 0x8bda6ef9,
+0xfffe8095, 0x61e3c4ff, 0xfe8a9d20, 0xc501ffff,
+0x8be26ef9, 0xfffe7c95, 0x59e3c4ff, 0xfe89b520,
+0xc501ffff, 0xc8b57ff9, 0xc5fffffe, 0xc89d61e1,
+0xc5fffffe, 0xc5eb62d1, 0x8bf26ef9, 0xfffe7895,
+0x49e3c4ff, 0xfe88b520, 0xc501ffff, 0x8be26ef9,
+0xfffe7095, 0x59e3c4ff, 0xfe77a520, 0xc501ffff,
+0xb8a57ff9, 0xc5fffffe, 0xb8b561c9, 0xc5fffffe,
+0x8bfa6ef9, 0xfffe6c95, 0x41e3c4ff, 0xfe76bd20,
+0xc501ffff, 0xc4e26ef9, 0xe02059e3, 0x61c1c501,
+0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee, 0xe801c518,
+0xffffdade, 0xc019013c, 0x0003c425, 0x08c48100,
+0x59000002, 0x5d5f5e5b, 0xc3fc618d,
+0022474,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i2[] = {
+0x315526eb, 0x83e589c0, 0xec83e0e4, 0xc5e28920,
+0x24047ffd, 0xff103c80, 0x83400a75, 0xf47520f8,
+0x02eb01b0, 0xc3c9c031, 0x0024b3e8, 0x24d30500,
+0x4c8d0000, 0xe4830424, 0xfc71ffe0, 0x8955d231,
+0x535657e5, 0xb951db31, 0x00000010, 0x01a8ec81,
+0x85890000, 0xfffffe74, 0xfee485c7, 0x0010ffff,
+0xb70f0000, 0x0010bec2, 0x788d0000, 0x0fc62901,
+0xbf0fc6bf, 0xd48589ff, 0x8dfffffe, 0xd0890172,
+0xfea8b589, 0xe083ffff, 0x01f88301, 0xe083c019,
+0xd6854802, 0xb3490375, 0xa8b58b01, 0x66fffffe,
+0x4675bc89, 0x89ffffff, 0xd4b58bf7, 0x66fffffe,
+0x867d4489, 0x6610ff83, 0xa67d4c89, 0x7db48966,
+0xffffff66, 0x958b0874, 0xfffffea8, 0xdb8494eb,
+0x8d890674, 0xfffffee4, 0xbd6ffdc5, 0xffffff48,
+0xbd7ffdc5, 0xfffffee8, 0xe8bdbf0f, 0x0ffffffe,
+0xff4885bf, 0xbd89ffff, 0xfffffed4, 0xbf0ff839,
+0xfffeeebd, 0xc0940fff, 0xf7c0b60f, 0x708589d8,
+0x0ffffffe, 0xfeea85bf, 0xbd89ffff, 0xfffffec8,
+0xfed08589, 0xbf0fffff, 0xffff4a85, 0xd08539ff,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffe6c85,
+0x85bf0fff, 0xfffffeec, 0xfecc8589, 0xbf0fffff,
+0xffff4c85, 0xcc8539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffe6885, 0x85bf0fff, 0xffffff4e,
+0xbf0ff839, 0xfffef0bd, 0xc0940fff, 0xf7c0b60f,
+0x648589d8, 0x0ffffffe, 0xff5085bf, 0xbd89ffff,
+0xfffffea4, 0x940ff839, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe60, 0xf285bf0f, 0x89fffffe, 0xfffea085,
+0x85bf0fff, 0xffffff52, 0xfea08539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe5c, 0xf485bf0f,
+0x89fffffe, 0xfffe9c85, 0x85bf0fff, 0xffffff54,
+0xfe9c8539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe58, 0xf685bf0f, 0x0ffffffe, 0xff029dbf,
+0xbf0fffff, 0xffff6295, 0x988589ff, 0x0ffffffe,
+0xff5685bf, 0x9d89ffff, 0xfffffe80, 0xfe988539,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffe54,
+0xf885bf0f, 0x89fffffe, 0xfffe9485, 0x85bf0fff,
+0xffffff58, 0xfe948539, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe50, 0xfa85bf0f, 0x89fffffe,
+0xfffe9085, 0x85bf0fff, 0xffffff5a, 0xfe908539,
+0x940fffff, 0x0fc931c0, 0xd8f7c0b6, 0xfe4c8589,
+0xbf0fffff, 0xfffefc85, 0x8c8589ff, 0x0ffffffe,
+0xff5c85bf, 0x8539ffff, 0xfffffe8c, 0xfe85bf0f,
+0x0ffffffe, 0xd9f7c194, 0xfe888589, 0xbf0fffff,
+0xffff5e85, 0x6ef9c5ff, 0x888539e9, 0x0ffffffe,
+0xb60fc094, 0x85bf0ff8, 0xffffff00, 0xd1c5dff7,
+0x8901efc4, 0xfffe8485, 0x85bf0fff, 0xffffff60,
+0xfe848539, 0x940fffff, 0xc0b60fc0, 0xd339d8f7,
+0x049dbf0f, 0x0fffffff, 0xb60fc294, 0x89def7f2,
+0xfffe7c9d, 0x95bf0fff, 0xffffff64, 0x956ef9c5,
+0xfffffe70, 0xa56ef9c5, 0xfffffe68, 0x95c4e9c5,
+0xfffffe6c, 0xc4d9c501, 0xfffe64a5, 0xf9c501ff,
+0xfe608d6e, 0xe9c5ffff, 0xf1c5d462, 0xfe5c8dc4,
+0xc501ffff, 0x589d6ef9, 0xc5fffffe, 0x549dc4e1,
+0x01fffffe, 0xcb62f1c5, 0xbf0fd339, 0xffff069d,
+0x6ce9c5ff, 0xc2940fd1, 0xc86ef9c5, 0x9d6ef9c5,
+0xfffffe50, 0xc5d2b60f, 0x4c9dc4e1, 0x01fffffe,
+0xcec4f1c5, 0xc5daf701, 0x89dd62e1, 0xfffe789d,
+0x9dbf0fff, 0xffffff66, 0xe26ef9c5, 0xfe789d39,
+0x940fffff, 0xdbb60fc3, 0xd9c5dbf7, 0xc501e3c4,
+0xc5cc62f1, 0xc4c96ce1, 0xc1186de3, 0xfc40e801,
+0x60baffff, 0x84000002, 0x00840fc0, 0xc5000021,
+0xe8a56ff9, 0xc5fffffe, 0xf89d6ff9, 0xc5fffffe,
+0x488dfdd9, 0xc5ffffff, 0x5895fde1, 0xc4ffffff,
+0xca1875e3, 0x7ffdc501, 0xffff088d, 0x95bf0fff,
+0xffffff08, 0xbd6ff9c5, 0xffffff48, 0xf771e9c5,
+0xc5f9c501, 0xc59800c2, 0x58bd6ff9, 0xc5ffffff,
+0x01f771f1, 0x228dbf0f, 0x0fffffff, 0xff26bdbf,
+0xc239ffff, 0x0a95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe7085, 0xc5f9c5ff, 0x399801c2,
+0x95bf0fc2, 0xffffff0c, 0x0fc0940f, 0xd8f7c0b6,
+0xfe6c8589, 0xf9c5ffff, 0x9802c2c5, 0xbf0fc239,
+0xffff0e95, 0xc0940fff, 0xf7c0b60f, 0x688589d8,
+0xc5fffffe, 0x03c2c5f9, 0x0fc23998, 0xff1095bf,
+0xf9c5ffff, 0xfe68ad6e, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe64, 0xc2c5f9c5, 0xc2399804,
+0x1295bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffe6085, 0xc5f9c5ff, 0x399805c2, 0x95bf0fc2,
+0xffffff14, 0x0fc0940f, 0xd8f7c0b6, 0xfe5c8589,
+0xf9c5ffff, 0x9806c2c5, 0xbf0fc239, 0xffff1695,
+0xc0940fff, 0xf7c0b60f, 0x588589d8, 0xc5fffffe,
+0x07c2c5f9, 0x0fc23998, 0xff1895bf, 0xf9c5ffff,
+0xfe70956e, 0x940fffff, 0xc4e9c5c0, 0xfffe6c95,
+0xb60f01ff, 0x89d8f7c0, 0xfffe5485, 0xc5f9c5ff,
+0x399800c1, 0x95bf0fc2, 0xffffff1a, 0x0fc0940f,
+0xd8f7c0b6, 0xfe508589, 0xf9c5ffff, 0x9801c1c5,
+0xbf0fc239, 0xffff1c95, 0xc0940fff, 0xf7c0b60f,
+0x4c8589d8, 0xc5fffffe, 0x02c1c5f9, 0x0fc23998,
+0xff1e95bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe48, 0xc1c5f9c5, 0xc2399803, 0x2095bf0f,
+0x0fffffff, 0xb60fc094, 0xc5f9c5f0, 0xf79804c1,
+0xc5c239de, 0x05d1c5f9, 0x0fd2bf0f, 0xdb31c094,
+0xf7c0b60f, 0x0fd139d8, 0xff248dbf, 0x940fffff,
+0xc5f9c5c3, 0xbf0f06d1, 0xc5dbf7d2, 0x64adc4d1,
+0x01fffffe, 0xbd6ef9c5, 0xfffffe48, 0xd562e9c5,
+0xfec4c1c5, 0x6ef9c501, 0xc5d139e8, 0x07c9c5f9,
+0x0fc9bf0f, 0xf9c5c294, 0xfe608d6e, 0xd1c5ffff,
+0x0f01ebc4, 0xf1c5d2b6, 0xfe5cb5c4, 0xc501ffff,
+0x588d6ef9, 0xf7fffffe, 0xc5cf39da, 0x548dc4f1,
+0x01fffffe, 0xc5c1940f, 0xc5c962c9, 0x0ff26ef9,
+0xe9c5c9b6, 0xf9c5d16c, 0xfe508d6e, 0xd9f7ffff,
+0x8dc4f1c5, 0xfffffe4c, 0x62f1c501, 0xc4c9c5cf,
+0xd1c501f1, 0xf1c5ee62, 0xe3c4cd6c, 0x01c1186d,
+0xfff99de8, 0x0266baff, 0xc0840000, 0x1e5d840f,
+0xf9c50000, 0xff08bd6f, 0xc1c5ffff, 0xff488df9,
+0xf9c5ffff, 0xff18bd6f, 0xc1c5ffff, 0xff5895f9,
+0xe3c4ffff, 0x01ca1875, 0x8d7ffdc5, 0xffffff28,
+0x2885bf0f, 0x39ffffff, 0xfffed485, 0xc0940fff,
+0xf7c0b60f, 0xd48589d8, 0x0ffffffe, 0xff2a85bf,
+0x8539ffff, 0xfffffed0, 0x0fc0940f, 0xd8f7c0b6,
+0xfed08589, 0xbf0fffff, 0xffff2c85, 0xcc8539ff,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffecc85,
+0x85bf0fff, 0xffffff2e, 0xfec88539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffec8, 0x3085bf0f,
+0x39ffffff, 0xfffea485, 0xc0940fff, 0xf7c0b60f,
+0xa48589d8, 0x0ffffffe, 0xff3285bf, 0x8539ffff,
+0xfffffea0, 0x0fc0940f, 0xd8f7c0b6, 0xfea08589,
+0xbf0fffff, 0xffff3485, 0x9c8539ff, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffe9c85, 0x85bf0fff,
+0xffffff36, 0xfe988539, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe98, 0x3885bf0f, 0x39ffffff,
+0xfffe9485, 0xc0940fff, 0xf7c0b60f, 0x948589d8,
+0x0ffffffe, 0xff3a85bf, 0x8539ffff, 0xfffffe90,
+0x31c0940f, 0xc0b60fc9, 0x8589d8f7, 0xfffffe90,
+0x3c85bf0f, 0x39ffffff, 0xfffe8c85, 0x85bf0fff,
+0xffffff3e, 0x956ef9c5, 0xfffffea4, 0x8d6ef9c5,
+0xfffffed4, 0x4295bf0f, 0xc5ffffff, 0xa0b5c4e9,
+0x01fffffe, 0x8dc4f1c5, 0xfffffed0, 0xc1940f01,
+0x469dbf0f, 0xc5ffffff, 0xccad6ef9, 0xf7fffffe,
+0xc4d1c5d9, 0xfffec8ad, 0xf9c501ff, 0xfe9c956e,
+0x8539ffff, 0xfffffe88, 0xcd62f1c5, 0x95c4e9c5,
+0xfffffe98, 0x6ef9c501, 0x62c9c5f9, 0x6cf1c5d2,
+0x6ef9c5ca, 0xfffe9495, 0xc4e9c5ff, 0xfffe9095,
+0x940f01ff, 0xf8b60fc0, 0x4085bf0f, 0xf7ffffff,
+0xc4c1c5df, 0xe9c501ff, 0x8539d762, 0xfffffe84,
+0x0fc0940f, 0xd8f7c0b6, 0xfe809539, 0xf9c5ffff,
+0x940fe86e, 0xf2b60fc2, 0x4495bf0f, 0xf7ffffff,
+0xc4d1c5de, 0x953901ee, 0xfffffe7c, 0x0fc2940f,
+0xdaf7d2b6, 0xfe789d39, 0xf9c5ffff, 0x940ff26e,
+0xdbb60fc3, 0xc9c5dbf7, 0xc501f3c4, 0xc5ee62d1,
+0xc4d56ce9, 0xc21875e3, 0xf744e801, 0x6bbaffff,
+0x84000002, 0x04840fc0, 0xc500001c, 0x488dd5d9,
+0xc5ffffff, 0x68bd6ff9, 0xc5ffffff, 0x589dd5e1,
+0xc4ffffff, 0xcb1875e3, 0x6ff9c501, 0x7ffdc5f1,
+0xfffee88d, 0xd5c1c5ff, 0x6ff9c5cf, 0xffff78bd,
+0xd5c1c5ff, 0x75e3c4d7, 0xc501ca18, 0xc5e96ff9,
+0x088d7ffd, 0xc5ffffff, 0x48956ff9, 0xc5ffffff,
+0x689dfde9, 0xc5ffffff, 0x588d6ff9, 0xc5ffffff,
+0xc4e7fdf1, 0xdc1865e3, 0x7ffdc501, 0xffff289d,
+0xf9e9c5ff, 0xffff68a5, 0xf9c9c5ff, 0xc5f9c5f5,
+0xd9c500d6, 0xf9c5e3d5, 0xc500c4c5, 0x789df9f1,
+0x39ffffff, 0xc0940fc2, 0xd6c5f9c5, 0xd5e1c501,
+0xffff389d, 0xc0b60fff, 0x8589d8f7, 0xfffffed4,
+0xc4c5f9c5, 0x0fc23901, 0xf9c5c094, 0xc402d6c5,
+0xfb185de3, 0xc0b60f01, 0xbd7ffdc5, 0xffffff28,
+0xbd6ff9c5, 0xfffffef8, 0xadf9c1c5, 0xffffff18,
+0x8589d8f7, 0xfffffed0, 0xc4c5f9c5, 0x0fc23902,
+0xf9c5c094, 0x0f03d6c5, 0xf9c5c0b6, 0xc505cdc5,
+0x07fdc5f9, 0x8589d8f7, 0xfffffecc, 0xc4c5f9c5,
+0x0fc23903, 0xf9c5c094, 0x0f04d6c5, 0xd8f7c0b6,
+0xfec88589, 0xf9c5ffff, 0x3904c4c5, 0xc0940fc2,
+0xd6c5f9c5, 0xc0b60f05, 0x8589d8f7, 0xfffffea4,
+0xc4c5f9c5, 0x0fc23905, 0xf9c5c094, 0x0f06d6c5,
+0xd8f7c0b6, 0xfea08589, 0xf9c5ffff, 0x3906c4c5,
+0xc0940fc2, 0xd6c5f9c5, 0xc0b60f07, 0x8589d8f7,
+0xfffffe9c, 0xc4c5f9c5, 0x0fc23907, 0xf9c5c094,
+0xc500d5c5, 0xd4a56ef9, 0x0ffffffe, 0xd9c5c0b6,
+0xfed0a5c4, 0xf701ffff, 0x988589d8, 0xc5fffffe,
+0x00c3c5f9, 0x940fc239, 0xc5f9c5c0, 0xb60f01d5,
+0x89d8f7c0, 0xfffe9485, 0xc5f9c5ff, 0xc23901c3,
+0xc5c0940f, 0x02d5c5f9, 0xf7c0b60f, 0x908589d8,
+0xc5fffffe, 0x02c3c5f9, 0x940fc239, 0xc5f9c5c0,
+0xb60f03d5, 0x89d8f7c0, 0xfffe8c85, 0xc5f9c5ff,
+0xc23903c3, 0xc5c0940f, 0x04d5c5f9, 0xbd6ef9c5,
+0xfffffe8c, 0xc5f0b60f, 0x04c3c5f9, 0xc239def7,
+0xd3c5f9c5, 0xc0940f05, 0xc1c5db31, 0x0f01fec4,
+0xd8f7c0b6, 0xf9c5d139, 0x0f06d3c5, 0xf9c5c394,
+0xc506cdc5, 0xccad6ef9, 0xf7fffffe, 0xc5d139db,
+0x07cbc5f9, 0xc5c2940f, 0xc8adc4d1, 0x01fffffe,
+0x9d6ef9c5, 0xfffffea4, 0xc5d2b60f, 0xa0b5c4e1,
+0x01fffffe, 0xe562d9c5, 0xcf39daf7, 0xe86ef9c5,
+0xc5c1940f, 0x9c9d6ef9, 0xc5fffffe, 0x01ebc4d1,
+0xc5c9b60f, 0x989dc4e1, 0x01fffffe, 0xdb62c9c5,
+0xf9c5d9f7, 0xd9c5f26e, 0xc9c5e36c, 0xc501f1c4,
+0x949d6ef9, 0xc5fffffe, 0xc5ee62d1, 0x909dc4e1,
+0x01fffffe, 0xdf62e1c5, 0xdd6ce1c5, 0x185de3c4,
+0x6be801c3, 0xbafffff4, 0x00000282, 0x840fc084,
+0x0000192b, 0x9dd5e9c5, 0xffffff68, 0xa5d5f1c5,
+0xffffff78, 0x1865e3c4, 0xfdc501dc, 0xfee89d7f,
+0xc766ffff, 0xffff0885, 0x8d0010ff, 0xffff0885,
+0x85c766ff, 0xffffff26, 0x8d8d0010, 0xffffff16,
+0xfea8ad83, 0x8302ffff, 0x958b02c0, 0xfffffea8,
+0xfe500366, 0xfea8bd8b, 0xbf0fffff, 0x108966d2,
+0x39148966, 0x7502ff83, 0xe8858bd7, 0x66fffffe,
+0xff088539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffea8, 0xea858b66, 0x66fffffe, 0xff0a8539,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffed4,
+0xfeec858b, 0x3966ffff, 0xffff0c85, 0xc0940fff,
+0xf7c0b60f, 0xd08589d8, 0x66fffffe, 0xfeee858b,
+0x3966ffff, 0xffff0e85, 0xc0940fff, 0xf7c0b60f,
+0xcc8589d8, 0x8bfffffe, 0xfffef085, 0x853966ff,
+0xffffff10, 0x0fc0940f, 0xd8f7c0b6, 0xfec88589,
+0x8b66ffff, 0xfffef285, 0x853966ff, 0xffffff12,
+0x0fc0940f, 0xd8f7c0b6, 0xfea48589, 0x858bffff,
+0xfffffef4, 0x14853966, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffea085, 0x858b66ff, 0xfffffef6,
+0x16853966, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffe9c85, 0x85bf0fff, 0xfffffef8, 0x940fd039,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe98, 0xfa858b66,
+0x66fffffe, 0xff1a8539, 0x940fffff, 0x0fc931c0,
+0xd8f7c0b6, 0xfe948589, 0x858bffff, 0xfffffefc,
+0x1c853966, 0x66ffffff, 0xfefe858b, 0x940fffff,
+0x66d9f7c1, 0xff1e8539, 0xf9c5ffff, 0xf9c5f96e,
+0xfec89d6e, 0x8b66ffff, 0xffff02b5, 0xc4e1c5ff,
+0xfffea4b5, 0xf9c501ff, 0xfea8a56e, 0x9d8bffff,
+0xffffff04, 0xa5c4d9c5, 0xfffffed4, 0x6ef9c501,
+0xfffed0ad, 0xc0940fff, 0xadc4d1c5, 0xfffffecc,
+0x6ef9c501, 0xfffea09d, 0xf8b60fff, 0xff00858b,
+0xd9c5ffff, 0xdff7e562, 0x9dc4e1c5, 0xfffffe9c,
+0x62c9c501, 0x853966db, 0xffffff20, 0xe36cd9c5,
+0xffc4c1c5, 0x6ef9c501, 0xfffe989d, 0xc4e1c5ff,
+0xfffe949d, 0xe1c501ff, 0x940fdf62, 0xc0b60fc0,
+0x3966d8f7, 0xffff22b5, 0x6ef9c5ff, 0xc2940fe8,
+0x31f2b60f, 0x66def7d2, 0xff249d39, 0xd1c5ffff,
+0x6601eec4, 0xff069d8b, 0x940fffff, 0x66daf7c2,
+0xff269d39, 0xf9c5ffff, 0x940ff26e, 0xdbb60fc3,
+0xc9c5dbf7, 0xc501f3c4, 0xc5ee62d1, 0xc4dd6ce1,
+0xc3185de3, 0xf1d8e801, 0xd3baffff, 0x84000002,
+0x98840fc0, 0xc5000016, 0x8855d5e9, 0x4dd5f1c5,
+0x6de3c498, 0xc501f918, 0x28bd7ffd, 0xc5ffffff,
+0x28b56ff9, 0xc5ffffff, 0x03f671d9, 0xb56ff9c5,
+0xffffff38, 0xf671e1c5, 0x5de3c403, 0xc501f318,
+0xa8b57ffd, 0xc5fffffe, 0xa8b56ffd, 0x0ffffffe,
+0xfea895bf, 0xfdc5ffff, 0xfee8b57f, 0xf9c5ffff,
+0xff28b56f, 0xe1c5ffff, 0xc502f671, 0x38b56ff9,
+0xc5ffffff, 0x02f671d9, 0x1865e3c4, 0xfdc501dc,
+0xff089d7f, 0xf9c5ffff, 0xff08b56f, 0xc9c5ffff,
+0xf9c5e6fd, 0xff18b56f, 0xf9c5ffff, 0x9800c4c5,
+0xdefdc9c5, 0xbf0fc239, 0xfffeea95, 0xc0940fff,
+0x028dbf0f, 0x0fffffff, 0xbf0fc0b6, 0xffff06bd,
+0x89d8f7ff, 0xfffea885, 0xc5f9c5ff, 0x399801c4,
+0x95bf0fc2, 0xfffffeec, 0xad6ef9c5, 0xfffffea8,
+0x0fc0940f, 0xd8f7c0b6, 0xfed48589, 0xf9c5ffff,
+0x9802c4c5, 0xbf0fc239, 0xfffeee95, 0xc4d1c5ff,
+0xfffed4ad, 0x940f01ff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffed0, 0xc4c5f9c5, 0xc2399803, 0xf095bf0f,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffecc85,
+0xc5f9c5ff, 0x399804c4, 0x95bf0fc2, 0xfffffef2,
+0x0fc0940f, 0xd8f7c0b6, 0xfec88589, 0xf9c5ffff,
+0x9805c4c5, 0xbf0fc239, 0xfffef495, 0xc0940fff,
+0xf7c0b60f, 0xa48589d8, 0xc5fffffe, 0x06c4c5f9,
+0x0fc23998, 0xfef695bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffea0, 0xc4c5f9c5, 0xc2399807,
+0xf895bf0f, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffe9c85, 0xc5f9c5ff, 0x399800c3, 0x95bf0fc2,
+0xfffffefa, 0x0fc0940f, 0xd8f7c0b6, 0xfe988589,
+0xf9c5ffff, 0x9801c3c5, 0xbf0fc239, 0xfffefc95,
+0xc0940fff, 0xf7c0b60f, 0x948589d8, 0xc5fffffe,
+0x02c3c5f9, 0x0fc23998, 0xfefe95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe90, 0xc3c5f9c5,
+0xc2399803, 0x0095bf0f, 0x0fffffff, 0xb60fc094,
+0xc5f9c5f0, 0xf79804c3, 0xc5c239de, 0x05d3c5f9,
+0x0fd2bf0f, 0xdb31c094, 0xf7c0b60f, 0x0fd139d8,
+0xff048dbf, 0x940fffff, 0xc5f9c5c3, 0xbf0f06d3,
+0x39dbf7d2, 0xc5f9c5d1, 0xbf0f07d3, 0xc1940fd2,
+0x9d6ef9c5, 0xfffffed0, 0x9dc4e1c5, 0xfffffecc,
+0xc9b60f01, 0xa56ef9c5, 0xfffffec8, 0xeb62d1c5,
+0xd739d9f7, 0xa5c4d9c5, 0xfffffea4, 0xc2940f01,
+0xb56ef9c5, 0xfffffea0, 0xb5c4c9c5, 0xfffffe9c,
+0xd2b60f01, 0xde62d9c5, 0xa56ef9c5, 0xfffffe98,
+0xd1c5daf7, 0xd9c5eb6c, 0xfe94a5c4, 0xc501ffff,
+0x909d6ef9, 0xc5fffffe, 0x01f6c4e1, 0xd86ef9c5,
+0xb57ff9c5, 0xfffffea8, 0xdbc4e1c5, 0x6ef9c501,
+0x62d9c5f1, 0xfffea8a5, 0xc4c9c5ff, 0xe1c501f2,
+0xd9c5de62, 0xe3c4e36c, 0x01c41855, 0xffeee1e8,
+0x02f8baff, 0xc0840000, 0x13a1840f, 0xf9c50000,
+0xfee8b56f, 0xe1c5ffff, 0xc502e671, 0xf8b56ff9,
+0xc5fffffe, 0x02e671d9, 0x1865e3c4, 0xfdc501dc,
+0xff289d7f, 0xbf0fffff, 0xffff0895, 0x6ff9c5ff,
+0xffff28b5, 0xfdc9c5ff, 0xc5f9c5e6, 0xc59800c4,
+0x38b56ff9, 0xc5ffffff, 0x0fdefdc9, 0xff228dbf,
+0xbf0fffff, 0xffff26bd, 0x0fc239ff, 0xff0a95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffea8,
+0xc4c5f9c5, 0xc2399801, 0x0c95bf0f, 0xc5ffffff,
+0xa8ad6ef9, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffed485, 0xc5f9c5ff, 0x399802c4, 0x95bf0fc2,
+0xffffff0e, 0xadc4d1c5, 0xfffffed4, 0xc0940f01,
+0xf7c0b60f, 0xd08589d8, 0xc5fffffe, 0x03c4c5f9,
+0x0fc23998, 0xff1095bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffecc, 0xc4c5f9c5, 0xc2399804,
+0x1295bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffec885, 0xc5f9c5ff, 0x399805c4, 0x95bf0fc2,
+0xffffff14, 0x0fc0940f, 0xd8f7c0b6, 0xfea48589,
+0xf9c5ffff, 0x9806c4c5, 0xbf0fc239, 0xffff1695,
+0xc0940fff, 0xf7c0b60f, 0xa08589d8, 0xc5fffffe,
+0x07c4c5f9, 0x0fc23998, 0xff1895bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe9c, 0xc3c5f9c5,
+0xc2399800, 0x1a95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe9885, 0xc5f9c5ff, 0x399801c3,
+0x95bf0fc2, 0xffffff1c, 0x0fc0940f, 0xd8f7c0b6,
+0xfe948589, 0xf9c5ffff, 0x9802c3c5, 0xbf0fc239,
+0xffff1e95, 0xc0940fff, 0xf7c0b60f, 0x908589d8,
+0xc5fffffe, 0x03c3c5f9, 0x0fc23998, 0xff2095bf,
+0x940fffff, 0xf0b60fc0, 0xc3c5f9c5, 0xdef79804,
+0xf9c5c239, 0x0f05d3c5, 0x940fd2bf, 0x0fdb31c0,
+0xd8f7c0b6, 0xbf0fd139, 0xffff248d, 0xc3940fff,
+0xd3c5f9c5, 0xd2bf0f06, 0xd139dbf7, 0xd3c5f9c5,
+0xd2bf0f07, 0xc5c1940f, 0xd09d6ef9, 0xc5fffffe,
+0xcc9dc4e1, 0x01fffffe, 0xc5c9b60f, 0xc5eb62d1,
+0xc8a56ef9, 0xf7fffffe, 0xc5d739d9, 0xa4a5c4d9,
+0x01fffffe, 0xc5c2940f, 0xa0b56ef9, 0xc5fffffe,
+0x9cb5c4c9, 0x01fffffe, 0xc5d2b60f, 0xc5de62d9,
+0x98a56ef9, 0xf7fffffe, 0x6cd1c5da, 0xc4d9c5eb,
+0xfffe94a5, 0xf9c501ff, 0xfe909d6e, 0xe1c5ffff,
+0xc501f6c4, 0xc5d86ef9, 0xa8b57ff9, 0xc5fffffe,
+0x01dbc4e1, 0xf16ef9c5, 0xa562d9c5, 0xfffffea8,
+0xf2c4c9c5, 0x62e1c501, 0x6cd9c5de, 0x55e3c4e3,
+0xe801c418, 0xffffec3a, 0x0002fdba, 0x0fc08400,
+0x0010fa84, 0xe485c700, 0x03fffffe, 0xc5000000,
+0xc5df6ff9, 0x28bd7ffd, 0x8bffffff, 0xfffee4b5,
+0xc5f789ff, 0xc1e66ef9, 0xe3c41fff, 0x01e72259,
+0xecf1c1c5, 0xbd6ff9c5, 0xffffff38, 0xe4f1c1c5,
+0x1855e3c4, 0xfdc501fc, 0xfea8bd7f, 0xfdc5ffff,
+0xfea8bd6f, 0xbf0fffff, 0xfffea895, 0x7ffdc5ff,
+0xfffee8bd, 0xe485c7ff, 0x02fffffe, 0x8b000000,
+0xfffee4b5, 0x6ff9c5ff, 0xffff38bd, 0xc5f789ff,
+0xc1e66ef9, 0xe3c41fff, 0x01e72259, 0xdcf1e1c5,
+0xe4f1c1c5, 0x1865e3c4, 0xfdc501dc, 0xff089d7f,
+0xf9c5ffff, 0xff08bd6f, 0xc1c5ffff, 0xf9c5e7fd,
+0xff18bd6f, 0xf9c5ffff, 0x9800c4c5, 0xdffdc1c5,
+0xbf0fc239, 0xfffeea95, 0xc0940fff, 0x028dbf0f,
+0x0fffffff, 0xbf0fc0b6, 0xffff06bd, 0x89d8f7ff,
+0xfffea885, 0xc5f9c5ff, 0x399801c4, 0x95bf0fc2,
+0xfffffeec, 0x0fc0940f, 0xd8f7c0b6, 0xfed48589,
+0xf9c5ffff, 0x9802c4c5, 0xbf0fc239, 0xfffeee95,
+0xc0940fff, 0xf7c0b60f, 0xd08589d8, 0xc5fffffe,
+0x03c4c5f9, 0x0fc23998, 0xfef095bf, 0xf9c5ffff,
+0xfed0ad6e, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffecc, 0xc4c5f9c5, 0xc2399804, 0xf295bf0f,
+0xc5fffffe, 0xccadc4d1, 0x01fffffe, 0x0fc0940f,
+0xd8f7c0b6, 0xfec88589, 0xf9c5ffff, 0x9805c4c5,
+0xbf0fc239, 0xfffef495, 0xc0940fff, 0xf7c0b60f,
+0xa48589d8, 0xc5fffffe, 0x06c4c5f9, 0x0fc23998,
+0xfef695bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffea0, 0xc4c5f9c5, 0xc2399807, 0xf895bf0f,
+0xc5fffffe, 0xa8a56ef9, 0x0ffffffe, 0xd9c5c094,
+0xfed4a5c4, 0xc501ffff, 0x0fe562d9, 0xd8f7c0b6,
+0xfe9c8589, 0xf9c5ffff, 0x9800c3c5, 0xbf0fc239,
+0xfffefa95, 0xc0940fff, 0xf7c0b60f, 0x988589d8,
+0xc5fffffe, 0x01c3c5f9, 0x0fc23998, 0xfefc95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffe94,
+0xc3c5f9c5, 0xc2399802, 0xfe95bf0f, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffe9085, 0xc5f9c5ff,
+0x399803c3, 0x95bf0fc2, 0xffffff00, 0x0fc0940f,
+0xf9c5f0b6, 0x9804c3c5, 0xc239def7, 0xd3c5f9c5,
+0xd2bf0f05, 0x31c0940f, 0xc0b60fdb, 0xd139d8f7,
+0x048dbf0f, 0x0fffffff, 0xf9c5c394, 0x0f06d3c5,
+0xdbf7d2bf, 0xe86ef9c5, 0xebc4d1c5, 0xc5d13901,
+0x07cbc5f9, 0x0fc9bf0f, 0xf9c5c294, 0xfec89d6e,
+0xf9c5ffff, 0xfe90bd6e, 0xb60fffff, 0xc4e1c5d2,
+0xfffea4b5, 0xc1c501ff, 0xf701fec4, 0xc5cf39da,
+0xa09d6ef9, 0x0ffffffe, 0xe1c5c194, 0xfe9c9dc4,
+0xc501ffff, 0x0fdb62c9, 0xf9c5c9b6, 0xd9c5f26e,
+0xd9f7e36c, 0x9d6ef9c5, 0xfffffe98, 0x9dc4e1c5,
+0xfffffe94, 0xc4c9c501, 0xe1c501f1, 0xd1c5df62,
+0xe1c5ee62, 0xe3c4dd6c, 0x01c3185d, 0xffe931e8,
+0x0310baff, 0xc0840000, 0x0df1840f, 0xb58b0000,
+0xfffffee4, 0xbd6ff9c5, 0xfffffee8, 0xf9c5f789,
+0xffc1e66e, 0x59e3c41f, 0xc501e722, 0xc5dce1c1,
+0xf8bd6ff9, 0xc5fffffe, 0xc4e4e1c1, 0xdc1865e3,
+0x7ffdc501, 0xffff289d, 0x95bf0fff, 0xffffff08,
+0xbd6ff9c5, 0xffffff28, 0xe7fdc1c5, 0xc4c5f9c5,
+0xf9c59800, 0xff38bd6f, 0xc1c5ffff, 0xbf0fdffd,
+0xffff228d, 0xbdbf0fff, 0xffffff26, 0xbf0fc239,
+0xffff0a95, 0xc0940fff, 0xf7c0b60f, 0xa88589d8,
+0xc5fffffe, 0x01c4c5f9, 0x0fc23998, 0xff0c95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffed4,
+0xc4c5f9c5, 0xc2399802, 0x0e95bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffed085, 0xc5f9c5ff,
+0x399803c4, 0x95bf0fc2, 0xffffff10, 0xad6ef9c5,
+0xfffffed0, 0x0fc0940f, 0xd8f7c0b6, 0xfecc8589,
+0xf9c5ffff, 0x9804c4c5, 0xbf0fc239, 0xffff1295,
+0xc0940fff, 0xf7c0b60f, 0xc88589d8, 0xc5fffffe,
+0x05c4c5f9, 0x0fc23998, 0xff1495bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffea4, 0xc4c5f9c5,
+0xc2399806, 0x1695bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffea085, 0xc5f9c5ff, 0x399807c4,
+0x95bf0fc2, 0xffffff18, 0xa56ef9c5, 0xfffffea8,
+0xc5c0940f, 0xd4a5c4d9, 0x01fffffe, 0xf7c0b60f,
+0x9c8589d8, 0xc5fffffe, 0x00c3c5f9, 0x0fc23998,
+0xff1a95bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe98, 0xc3c5f9c5, 0xc2399801, 0x1c95bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffe9485,
+0xc5f9c5ff, 0x399802c3, 0x95bf0fc2, 0xffffff1e,
+0x0fc0940f, 0xd8f7c0b6, 0xfe908589, 0xf9c5ffff,
+0x9803c3c5, 0xbf0fc239, 0xffff2095, 0xc0940fff,
+0xc5f0b60f, 0x04c3c5f9, 0x39def798, 0xc5f9c5c2,
+0xbf0f05d3, 0xc0940fd2, 0xb60fdb31, 0x39d8f7c0,
+0x8dbf0fd1, 0xffffff24, 0xc5c3940f, 0x06d3c5f9,
+0xf7d2bf0f, 0xc4d1c5db, 0xfffeccad, 0xf9c501ff,
+0xfe90bd6e, 0xd9c5ffff, 0xc1c5e562, 0xc501fec4,
+0x39e86ef9, 0xc5f9c5d1, 0xbf0f07cb, 0xc2940fc9,
+0x9d6ef9c5, 0xfffffec8, 0xebc4d1c5, 0xd2b60f01,
+0xb5c4e1c5, 0xfffffea4, 0x6ef9c501, 0xfffea09d,
+0x39daf7ff, 0xc4e1c5cf, 0xfffe9c9d, 0x940f01ff,
+0x62c9c5c1, 0x6ef9c5db, 0xc9b60ff2, 0xe36cd9c5,
+0x9d6ef9c5, 0xfffffe98, 0xe1c5d9f7, 0xfe949dc4,
+0xc501ffff, 0xc5df62e1, 0x01f1c4c9, 0xee62d1c5,
+0xdd6ce1c5, 0x185de3c4, 0x83e801c3, 0xbaffffe6,
+0x00000314, 0x840fc084, 0x00000b43, 0xf9c5c031,
+0xc500d2c5, 0x03f9c5f9, 0xa87d8366, 0xc5f9c500,
+0xf9c505f1, 0xc506c9c5, 0x07d9c5f9, 0x66d04e0f,
+0x00aa7d83, 0xfea89589, 0xf9c5ffff, 0x0f01d2c5,
+0x8366d04e, 0x8900ac7d, 0xfffed495, 0xc5f9c5ff,
+0x4e0f02d2, 0x7d8366d0, 0x958900ae, 0xfffffed0,
+0xd2c5f9c5, 0x6ef9c503, 0xfffed0a5, 0xd04e0fff,
+0xb07d8366, 0xcc958900, 0xc5fffffe, 0x04d2c5f9,
+0xa5c4d9c5, 0xfffffecc, 0xd04e0f01, 0xb27d8366,
+0xc8958900, 0xc5fffffe, 0x05d2c5f9, 0x66d04e0f,
+0x00b47d83, 0xfea49589, 0xf9c5ffff, 0x0f06d2c5,
+0x8366d04e, 0x8900b67d, 0xfffea095, 0xc5f9c5ff,
+0xf9c507d2, 0xfec8956e, 0x4e0fffff, 0x7d8366d0,
+0x958900b8, 0xfffffe9c, 0xd1c5f9c5, 0xd04e0f00,
+0xba7d8366, 0x98958900, 0xc5fffffe, 0x01d1c5f9,
+0x66d04e0f, 0x00bc7d83, 0xfe949589, 0xf9c5ffff,
+0x0f02d1c5, 0x8366d04e, 0x8900be7d, 0xfffe9095,
+0xc5f9c5ff, 0xf9c504d1, 0xfea88d6e, 0xf1c5ffff,
+0xfed48dc4, 0xc501ffff, 0x0fcc62f1, 0x8366f84e,
+0x0f00c07d, 0x8366d04e, 0x0f00c27d, 0x8366f04e,
+0x0f00c47d, 0x8366c84e, 0xc500c67d, 0xc5e16ef9,
+0xa495c4e9, 0x01fffffe, 0x9d6ef9c5, 0xfffffea0,
+0xad6ef9c5, 0xfffffe90, 0x9dc4e1c5, 0xfffffe9c,
+0xc4d1c501, 0xe9c501ef, 0xf9c5d362, 0xfe989d6e,
+0x4e0fffff, 0x6cf1c5d8, 0xc4e1c5ca, 0xfffe949d,
+0xf9c501ff, 0xd9c5d26e, 0xc501e3c4, 0x01d6c4e9,
+0xdd62e1c5, 0xd462e9c5, 0xd26ce1c5, 0x1875e3c4,
+0xf9c501ca, 0xfdc5d16f, 0xff288d7f, 0xe98fffff,
+0xa85d99f0, 0x7d6ff9c5, 0x40e98fb8, 0xff388d99,
+0xe3c4ffff, 0x01f91865, 0xbd7ffdc5, 0xfffffea8,
+0xbd6ffdc5, 0xfffffea8, 0xa895bf0f, 0xc5fffffe,
+0xe8bd7ffd, 0x8bfffffe, 0xfffe7485, 0x6ff9c5ff,
+0xf9c5a87d, 0xfff0986f, 0xc1c5ffff, 0xf9c5cbf9,
+0xc5b87d6f, 0xc4dbf9c1, 0xcb1875e3, 0x7ffdc501,
+0xe98fa84d, 0xa85599e8, 0x7d6ff9c5, 0x40e98fb8,
+0xff388d99, 0xbf0fffff, 0xffff028d, 0x6de3c4ff,
+0xc501d918, 0xc5d2fde9, 0xc5c9fdf1, 0x00c2c5f9,
+0x7ffdc598, 0xffff089d, 0x0fc239ff, 0xfeea95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffea8,
+0xc2c5f9c5, 0xc2399801, 0xec95bf0f, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffed485, 0xc5f9c5ff,
+0x399802c2, 0x95bf0fc2, 0xfffffeee, 0x0fc0940f,
+0xd8f7c0b6, 0xfed08589, 0xf9c5ffff, 0x9803c2c5,
+0xbf0fc239, 0xfffef095, 0xc0940fff, 0xf7c0b60f,
+0xcc8589d8, 0xc5fffffe, 0x04c2c5f9, 0x0fc23998,
+0xfef295bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffec8, 0xc2c5f9c5, 0xc2399805, 0xf495bf0f,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffea485,
+0xc5f9c5ff, 0x399806c2, 0x95bf0fc2, 0xfffffef6,
+0x0fc0940f, 0xd8f7c0b6, 0xfea08589, 0xf9c5ffff,
+0x9807c2c5, 0xbf0fc239, 0xfffef895, 0xc0940fff,
+0xf7c0b60f, 0x9c8589d8, 0xc5fffffe, 0x00c1c5f9,
+0x0fc23998, 0xfefa95bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe98, 0xc1c5f9c5, 0xc2399801,
+0xfc95bf0f, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffe9485, 0xc5f9c5ff, 0x399802c1, 0x95bf0fc2,
+0xfffffefe, 0x0fc0940f, 0xd8f7c0b6, 0xfe908589,
+0xf9c5ffff, 0x9803c1c5, 0xbf0fc239, 0xffff0095,
+0xc0940fff, 0xc5f0b60f, 0x04c1c5f9, 0x39def798,
+0xc5f9c5c2, 0xbf0f05d1, 0xc0940fd2, 0xb60fdb31,
+0x39d8f7c0, 0x8dbf0fd1, 0xffffff04, 0x0fc3940f,
+0xff06bdbf, 0xf9c5ffff, 0x0f06d1c5, 0xdbf7d2bf,
+0x956ef9c5, 0xfffffea8, 0xa56ef9c5, 0xfffffed0,
+0x95c4e9c5, 0xfffffed4, 0xc4d9c501, 0xfffecca5,
+0xd13901ff, 0xc9c5f9c5, 0xc9bf0f07, 0xc5c2940f,
+0xc5d462e9, 0xc88d6ef9, 0x0ffffffe, 0xf1c5d2b6,
+0xfea48dc4, 0xc501ffff, 0xa09d6ef9, 0xf7fffffe,
+0xc5cf39da, 0x9c9dc4e1, 0x01fffffe, 0xc5c1940f,
+0xc5cb62f1, 0x0fe26ef9, 0xe9c5c9b6, 0xf9c5d16c,
+0xfe989d6e, 0xd9f7ffff, 0xc86ef9c5, 0x9dc4e1c5,
+0xfffffe94, 0x6ef9c501, 0xfffe90ad, 0xc4f1c5ff,
+0xd1c501cb, 0xc501eec4, 0x01e1c4d9, 0xdd62e1c5,
+0xcc62f1c5, 0xc96ce1c5, 0x186de3c4, 0xefe801c1,
+0xbaffffe1, 0x0000032c, 0x840fc084, 0x000006af,
+0xc9eff1c5, 0x55f9f1c5, 0x95bf0fa8, 0xffffff28,
+0x9968e98f, 0xffff0895, 0xf9f1c5ff, 0xbf0fb84d,
+0xffff428d, 0xc5f9c5ff, 0xe98f00c2, 0x188d9970,
+0x98ffffff, 0xbf0fc239, 0xffff2a95, 0xc0940fff,
+0xc4c0b60f, 0xd9186de3, 0x7ffdc501, 0xfffee89d,
+0x89d8f7ff, 0xfffea885, 0xc5f9c5ff, 0x399801c2,
+0x95bf0fc2, 0xffffff2c, 0x0fc0940f, 0xd8f7c0b6,
+0xfed48589, 0xf9c5ffff, 0x9802c2c5, 0xbf0fc239,
+0xffff2e95, 0xc0940fff, 0xf7c0b60f, 0xd08589d8,
+0xc5fffffe, 0x03c2c5f9, 0x0fc23998, 0xff3095bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffecc,
+0xc2c5f9c5, 0xc2399804, 0x3295bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffec885, 0xc5f9c5ff,
+0x399805c2, 0x95bf0fc2, 0xffffff34, 0x0fc0940f,
+0xd8f7c0b6, 0xfea48589, 0xf9c5ffff, 0x9806c2c5,
+0xbf0fc239, 0xffff3695, 0xc0940fff, 0xf7c0b60f,
+0xa08589d8, 0xc5fffffe, 0x07c2c5f9, 0x0fc23998,
+0xff3895bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe9c, 0xc1c5f9c5, 0xc2399800, 0x3a95bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffe9885,
+0xc5f9c5ff, 0x399801c1, 0x95bf0fc2, 0xffffff3c,
+0x0fc0940f, 0xd8f7c0b6, 0xfe948589, 0xf9c5ffff,
+0x9802c1c5, 0xbf0fc239, 0xffff3e95, 0xc0940fff,
+0xf7c0b60f, 0x908589d8, 0xc5fffffe, 0x03c1c5f9,
+0x0fc23998, 0xff4095bf, 0x940fffff, 0xf0b60fc0,
+0xc1c5f9c5, 0xdef79804, 0xf9c5c239, 0x0f05d1c5,
+0x940fd2bf, 0x0fdb31c0, 0xd8f7c0b6, 0xbf0fd139,
+0xffff448d, 0xc3940fff, 0xd1c5f9c5, 0xbdbf0f06,
+0xffffff46, 0xf7d2bf0f, 0x6ef9c5db, 0xfffea895,
+0x6ef9c5ff, 0xfffed0a5, 0xc4e9c5ff, 0xfffed495,
+0xd9c501ff, 0xfecca5c4, 0x3901ffff, 0xc5f9c5d1,
+0xbf0f07c9, 0xc2940fc9, 0xd462e9c5, 0x8d6ef9c5,
+0xfffffec8, 0xc5d2b60f, 0xa48dc4f1, 0x01fffffe,
+0x9d6ef9c5, 0xfffffea0, 0xcf39daf7, 0x9dc4e1c5,
+0xfffffe9c, 0xc1940f01, 0xcb62f1c5, 0xe26ef9c5,
+0xc5c9b60f, 0xc5d16ce9, 0x989d6ef9, 0xf7fffffe,
+0x6ef9c5d9, 0xc4e1c5c8, 0xfffe949d, 0xf9c501ff,
+0xfe90ad6e, 0xf1c5ffff, 0xc501cbc4, 0x01eec4d1,
+0xe1c4d9c5, 0x62e1c501, 0x62f1c5dd, 0x6ce1c5cc,
+0x6de3c4c9, 0xe801c118, 0xffffdf66, 0x000331ba,
+0x0fc08400, 0x00042684, 0xc5c03100, 0x488d6ffd,
+0xc5ffffff, 0x68a56ffd, 0xa8ffffff, 0x6ffdc501,
+0xc50475d4, 0xc5d16ffd, 0xc8557ffd, 0x45548b66,
+0x948966c8, 0xffff0845, 0xf88340ff, 0x31dc7510,
+0x7d8366c0, 0x9f0f0088, 0x89d8f7c0, 0xfffea885,
+0x66c031ff, 0x008a7d83, 0x956ef9c5, 0xfffffea8,
+0xf7c09f0f, 0xd48589d8, 0x31fffffe, 0x7d8366c0,
+0xe9c5008c, 0xfed495c4, 0x0f01ffff, 0xd8f7c09f,
+0xfed08589, 0xc031ffff, 0x8e7d8366, 0x6ef9c500,
+0xfffed0ad, 0xc09f0fff, 0x8589d8f7, 0xfffffecc,
+0x8366c031, 0xc500907d, 0xccadc4d1, 0x01fffffe,
+0xd562e9c5, 0xf7c09f0f, 0xc88589d8, 0x31fffffe,
+0x7d8366c0, 0xf9c50092, 0xfec89d6e, 0x9f0fffff,
+0x89d8f7c0, 0xfffea485, 0x66c031ff, 0x00947d83,
+0xb5c4e1c5, 0xfffffea4, 0xc09f0f01, 0x8589d8f7,
+0xfffffea0, 0x8366c031, 0x0f00967d, 0xd8f7c09f,
+0xfe9c8589, 0xc031ffff, 0x987d8366, 0xc09f0f00,
+0x8589d8f7, 0xfffffe98, 0x8366c031, 0x0f009a7d,
+0xc931c09f, 0x8366d8f7, 0x89009c7d, 0xfffe9485,
+0xc19f0fff, 0x8366d9f7, 0xc5009e7d, 0x0ff96ef9,
+0xb60fc09f, 0xf7c031f8, 0x7d8366df, 0xc1c500a0,
+0x0f01ffc4, 0xd8f7c09f, 0xa27d8366, 0x6ef9c500,
+0xc29f0fe8, 0x31f2b60f, 0x66def7d2, 0x00a47d83,
+0xeec4d1c5, 0xc29f0f01, 0xdaf7db31, 0xa67d8366,
+0x6ef9c500, 0xfffea09d, 0xc4e1c5ff, 0xfffe9c9d,
+0xc9c501ff, 0xf9c5db62, 0xbf0ff26e, 0xffff0895,
+0x6ce9c5ff, 0x6ef9c5d3, 0xfffe989d, 0xc4e1c5ff,
+0xfffe949d, 0x9f0f01ff, 0x62e1c5c3, 0x8dbf0fdf,
+0xffffff22, 0xbf0fdbf7, 0xffff26bd, 0xc4c9c5ff,
+0xd1c501f3, 0xe1c5ee62, 0xe3c4dd6c, 0x01d3186d,
+0xa274e88f, 0xf9c520cc, 0x9800c1c5, 0xbf0fc239,
+0xffff0a95, 0xc0940fff, 0xf7c0b60f, 0xa88589d8,
+0xc5fffffe, 0x01c1c5f9, 0x0fc23998, 0xff0c95bf,
+0xf9c5ffff, 0xfea8956e, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffed4, 0xc1c5f9c5, 0xc2399802,
+0x0e95bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffed085, 0xc5f9c5ff, 0x399803c1, 0x95bf0fc2,
+0xffffff10, 0x0fc0940f, 0xd8f7c0b6, 0xfecc8589,
+0xf9c5ffff, 0x9804c1c5, 0xbf0fc239, 0xffff1295,
+0xc0940fff, 0xf7c0b60f, 0xc88589d8, 0xc5fffffe,
+0x05c1c5f9, 0x0fc23998, 0xff1495bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffea4, 0xc1c5f9c5,
+0xc2399806, 0x1695bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffea085, 0xc5f9c5ff, 0x399807c1,
+0x95bf0fc2, 0xffffff18, 0x197de3c4, 0x940f01c9,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe9c, 0xc1c5f9c5,
+0xc2399800, 0x1a95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe9885, 0xc5f9c5ff, 0x399801c1,
+0x95bf0fc2, 0xffffff1c, 0x0fc0940f, 0xd8f7c0b6,
+0xfe948589, 0xf9c5ffff, 0x9802c1c5, 0xbf0fc239,
+0xffff1e95, 0xc0940fff, 0xf7c0b60f, 0x908589d8,
+0xc5fffffe, 0x03c1c5f9, 0x0fc23998, 0xff2095bf,
+0x940fffff, 0xf0b60fc0, 0xc1c5f9c5, 0xdef79804,
+0xf9c5c239, 0x0f05d1c5, 0x940fd2bf, 0x0fdb31c0,
+0xd8f7c0b6, 0xbf0fd139, 0xffff248d, 0xc3940fff,
+0xd1c5f9c5, 0xd2bf0f06, 0xe9c5dbf7, 0xfed495c4,
+0xc501ffff, 0xd0a56ef9, 0xc5fffffe, 0xa09d6ef9,
+0xc5fffffe, 0xcca5c4d9, 0x01fffffe, 0x9dc4e1c5,
+0xfffffe9c, 0xc5d13901, 0x07c9c5f9, 0x0fc9bf0f,
+0xe9c5c294, 0xf9c5d462, 0xfec88d6e, 0xb60fffff,
+0xc4f1c5d2, 0xfffea48d, 0xf9c501ff, 0xfe90ad6e,
+0xdaf7ffff, 0xf1c5cf39, 0x940fcb62, 0x6ef9c5c1,
+0x6ce9c5e2, 0xc9b60fd1, 0xc86ef9c5, 0x9d6ef9c5,
+0xfffffe98, 0xe1c5d9f7, 0xfe949dc4, 0xc501ffff,
+0x01eec4d1, 0xcbc4f1c5, 0xc4d9c501, 0xe1c501e1,
+0xf1c5dd62, 0xe1c5cc62, 0xe3c4c96c, 0x01c1186d,
+0xffdb3de8, 0x19013cff, 0xc4e281d2, 0x81000003,
+0x0001a8c4, 0x59d08900, 0x5d5f5e5b, 0xc3fc618d,
+0xc324048b, 0x00000000, 0x00000000, 0x00000000,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00000000, 0x00000000, 0x00000000,
+0022414,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u2[] = {
+0x315526eb, 0x83e589c0, 0xec83e0e4, 0xc5e28920,
+0x24047ffd, 0xff103c80, 0x83400a75, 0xf47520f8,
+0x02eb01b0, 0xc3c9c031, 0x04244c8d, 0xffe0e483,
+0xc031fc71, 0x000010ba, 0xe5895500, 0x31535657,
+0xec8151db, 0x000001a8, 0xfee485c7, 0x0010ffff,
+0x85890000, 0xfffffea8, 0xa885b70f, 0xb9fffffe,
+0x00000010, 0xfea8bd8b, 0x708dffff, 0x8bc12901,
+0xfffea885, 0xa885ffff, 0x0ffffffe, 0xb70ff6b7,
+0x01e083c9, 0xa8bd8548, 0x0ffffffe, 0x0375c0b7,
+0x8b01b34a, 0xfffea8bd, 0xb48966ff, 0xffff467d,
+0x10ff83ff, 0x7d8c8966, 0xffffff66, 0x7d448966,
+0x54896686, 0xa075a67d, 0x0674db84, 0xfee49589,
+0xfdc5ffff, 0xff48bd6f, 0xfdc5ffff, 0xfee8bd7f,
+0xb70fffff, 0xfffee8bd, 0x85b70fff, 0xffffff48,
+0xfed4bd89, 0xf839ffff, 0x0fc0940f, 0xd8f7c0b6,
+0xfe748589, 0xb70fffff, 0xfffeea85, 0xd08589ff,
+0x0ffffffe, 0xff4a85b7, 0x8539ffff, 0xfffffed0,
+0x0fc0940f, 0xd8f7c0b6, 0xfe708589, 0xb70fffff,
+0xfffeec85, 0xcc8589ff, 0x0ffffffe, 0xff4c85b7,
+0x8539ffff, 0xfffffecc, 0x0fc0940f, 0xd8f7c0b6,
+0xfe6c8589, 0xb70fffff, 0xfffeee85, 0xc88589ff,
+0x0ffffffe, 0xff4e85b7, 0x8539ffff, 0xfffffec8,
+0x0fc0940f, 0xd8f7c0b6, 0xfe688589, 0xb70fffff,
+0xfffef085, 0xa48589ff, 0x0ffffffe, 0xff5085b7,
+0x8539ffff, 0xfffffea4, 0x0fc0940f, 0xd8f7c0b6,
+0xfe648589, 0xb70fffff, 0xfffef285, 0xa08589ff,
+0x0ffffffe, 0xff5285b7, 0x8539ffff, 0xfffffea0,
+0x0fc0940f, 0xd8f7c0b6, 0xfe608589, 0xb70fffff,
+0xfffef485, 0x9c8589ff, 0x0ffffffe, 0xff5485b7,
+0x8539ffff, 0xfffffe9c, 0x02b5b70f, 0x0fffffff,
+0xff6295b7, 0x940fffff, 0xc0b60fc0, 0xfe80b589,
+0xd8f7ffff, 0xfe5c8589, 0xb70fffff, 0xfffef685,
+0x988589ff, 0x0ffffffe, 0xff5685b7, 0x8539ffff,
+0xfffffe98, 0x0fc0940f, 0xd8f7c0b6, 0xfe588589,
+0xb70fffff, 0xfffef885, 0x948589ff, 0x0ffffffe,
+0xff5885b7, 0x8539ffff, 0xfffffe94, 0x0fc0940f,
+0xd8f7c0b6, 0xfe548589, 0xb70fffff, 0xfffefa85,
+0x908589ff, 0x0ffffffe, 0xff5a85b7, 0x8539ffff,
+0xfffffe90, 0x31c0940f, 0xc0b60fc9, 0x8589d8f7,
+0xfffffe50, 0xfc85b70f, 0x89fffffe, 0xfffe8c85,
+0x85b70fff, 0xffffff5c, 0xfe8c8539, 0xb70fffff,
+0xfffefe85, 0xc1940fff, 0x8589d9f7, 0xfffffe88,
+0x5e85b70f, 0xc5ffffff, 0x39e96ef9, 0xfffe8885,
+0xc0940fff, 0x0ff8b60f, 0xff0085b7, 0xdff7ffff,
+0xefc4d1c5, 0x84858901, 0x0ffffffe, 0xff6085b7,
+0x8539ffff, 0xfffffe84, 0x049db70f, 0xc5ffffff,
+0x74956ef9, 0xc5fffffe, 0x6ca56ef9, 0xc5fffffe,
+0x7095c4e9, 0x01fffffe, 0xa5c4d9c5, 0xfffffe68,
+0x6ef9c501, 0xfffe648d, 0xc0940fff, 0xd462e9c5,
+0x8dc4f1c5, 0xfffffe60, 0xc0b60f01, 0x9d6ef9c5,
+0xfffffe5c, 0x9dc4e1c5, 0xfffffe58, 0x7c9d8901,
+0xf7fffffe, 0x0fd639d8, 0xf1c5c294, 0xf9c5cb62,
+0xfe549d6e, 0xb60fffff, 0x95b70ff2, 0xffffff64,
+0xd16ce9c5, 0xf9c5def7, 0xe1c5c86e, 0xfe509dc4,
+0xc501ffff, 0x01cec4f1, 0xdd62e1c5, 0xb70fd339,
+0xffff069d, 0xc2940fff, 0xf7d2b60f, 0x789d89da,
+0x0ffffffe, 0xff669db7, 0xf9c5ffff, 0x9d39e26e,
+0xfffffe78, 0x0fc3940f, 0xdbf7dbb6, 0xe3c4d9c5,
+0x62f1c501, 0x6ce1c5cc, 0x6de3c4c9, 0xe801c118,
+0xfffffc4e, 0x000260ba, 0x0fc08400, 0x001c6884,
+0x6ff9c500, 0xfffee8bd, 0xfdc1c5ff, 0xffff488d,
+0x6ff9c5ff, 0xfffef8bd, 0xfdc1c5ff, 0xffff5895,
+0x75e3c4ff, 0xc501ca18, 0x088d7ffd, 0xc5ffffff,
+0x48bd6ff9, 0xc5ffffff, 0x01f771e9, 0xbd6ff9c5,
+0xffffff58, 0xc2c5f9c5, 0x853b6600, 0xffffff08,
+0xf771f1c5, 0xc5f9c501, 0xf9c505d1, 0x0f07d9c5,
+0xb60fc094, 0x89d8f7c0, 0xfffe7485, 0xc5f9c5ff,
+0x3b6601c2, 0xffff0a85, 0xc0940fff, 0xf7c0b60f,
+0x708589d8, 0xc5fffffe, 0x02c2c5f9, 0x0c853b66,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffe6c85,
+0xc5f9c5ff, 0x3b6603c2, 0xffff0e85, 0x6ef9c5ff,
+0xfffe6ca5, 0xc0940fff, 0xf7c0b60f, 0x688589d8,
+0xc5fffffe, 0x04c2c5f9, 0x10853b66, 0xc5ffffff,
+0x68a5c4d9, 0x01fffffe, 0x0fc0940f, 0xd8f7c0b6,
+0xfe648589, 0xf9c5ffff, 0x6605c2c5, 0xff12853b,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffe60,
+0xc2c5f9c5, 0x853b6606, 0xffffff14, 0x0fc0940f,
+0xd8f7c0b6, 0xfe5c8589, 0xf9c5ffff, 0xc507c2c5,
+0x74956ef9, 0x66fffffe, 0xff16853b, 0xe9c5ffff,
+0xfe7095c4, 0xc501ffff, 0x0fd462e9, 0xb60fc094,
+0x89d8f7c0, 0xfffe5885, 0xc5f9c5ff, 0x3b6600c1,
+0xffff1885, 0xc0940fff, 0xf7c0b60f, 0x548589d8,
+0xc5fffffe, 0x01c1c5f9, 0x1a853b66, 0x0fffffff,
+0xc931c094, 0xf7c0b60f, 0x508589d8, 0xc5fffffe,
+0x02c1c5f9, 0x1c853b66, 0xc5ffffff, 0x03c1c5f9,
+0xf7c1940f, 0x853b66d9, 0xffffff1e, 0xe96ef9c5,
+0x0fc0940f, 0xf9c5f8b6, 0xf704c1c5, 0x853b66df,
+0xffffff20, 0xefc4d1c5, 0xc0940f01, 0xf7c0b60f,
+0x953b66d8, 0xffffff22, 0x0fc2940f, 0xf9c5f2b6,
+0xf706d1c5, 0x953b66de, 0xffffff24, 0x0fc2940f,
+0xdaf7d2b6, 0x269d3b66, 0xc5ffffff, 0xc5e26ef9,
+0x648d6ef9, 0xc5fffffe, 0x5c9d6ef9, 0xc5fffffe,
+0x608dc4f1, 0x01fffffe, 0x9dc4e1c5, 0xfffffe58,
+0x62f1c501, 0x6ef9c5cb, 0xfffe549d, 0x6ce9c5ff,
+0xc3940fd1, 0xc86ef9c5, 0x9dc4e1c5, 0xfffffe50,
+0xdbb60f01, 0xcec4f1c5, 0x62e1c501, 0xc5dbf7dd,
+0x01e3c4d9, 0xcc62f1c5, 0xc96ce1c5, 0x186de3c4,
+0xebe801c1, 0xbafffff9, 0x00000266, 0x840fc084,
+0x00001a05, 0xbd6ff9c5, 0xffffff08, 0x8df9c1c5,
+0xffffff48, 0xbd6ff9c5, 0xffffff18, 0x95f9c1c5,
+0xffffff58, 0x1875e3c4, 0xfdc501ca, 0xff288d7f,
+0xb70fffff, 0xffff2885, 0xd48539ff, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffed485, 0x85b70fff,
+0xffffff2a, 0xfed08539, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffed0, 0x2c85b70f, 0x39ffffff,
+0xfffecc85, 0xc0940fff, 0xf7c0b60f, 0xcc8589d8,
+0x0ffffffe, 0xff2e85b7, 0x8539ffff, 0xfffffec8,
+0x0fc0940f, 0xd8f7c0b6, 0xfec88589, 0xb70fffff,
+0xffff3085, 0xa48539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffea485, 0x85b70fff, 0xffffff32,
+0xfea08539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffea0, 0x3485b70f, 0x39ffffff, 0xfffe9c85,
+0xc0940fff, 0xf7c0b60f, 0x9c8589d8, 0x0ffffffe,
+0xff3685b7, 0x8539ffff, 0xfffffe98, 0x0fc0940f,
+0xd8f7c0b6, 0xfe988589, 0xb70fffff, 0xffff3885,
+0x948539ff, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffe9485, 0x85b70fff, 0xffffff3a, 0xfe908539,
+0x940fffff, 0x0fc931c0, 0xd8f7c0b6, 0xfe908589,
+0xb70fffff, 0xffff3c85, 0x8c8539ff, 0x0ffffffe,
+0xff3e85b7, 0xf9c5ffff, 0xfed49d6e, 0xf9c5ffff,
+0xfeccad6e, 0xb70fffff, 0xffff4295, 0xc4d1c5ff,
+0xfffec8ad, 0xe1c501ff, 0xfed09dc4, 0x0f01ffff,
+0xb70fc194, 0xffff469d, 0x62e1c5ff, 0xc5d9f7dd,
+0xa4956ef9, 0xc5fffffe, 0x9ca56ef9, 0x39fffffe,
+0xfffe8885, 0xc4d9c5ff, 0xfffe98a5, 0xe9c501ff,
+0xfea095c4, 0xc501ffff, 0xc5f16ef9, 0xc5d462e9,
+0xc5da6ce1, 0x94956ef9, 0xc5fffffe, 0x9095c4e9,
+0x01fffffe, 0x0fc0940f, 0xb70ff8b6, 0xffff4085,
+0xc5dff7ff, 0x01f7c4c9, 0xd662e9c5, 0xfe848539,
+0x940fffff, 0xc0b60fc0, 0x9539d8f7, 0xfffffe80,
+0xe06ef9c5, 0x0fc2940f, 0xb70ff2b6, 0xffff4495,
+0xc5def7ff, 0x01e6c4d9, 0xfe7c9539, 0x940fffff,
+0xd2b60fc2, 0x9d39daf7, 0xfffffe78, 0xea6ef9c5,
+0x0fc3940f, 0xdbf7dbb6, 0xebc4d1c5, 0x62d9c501,
+0x6ce9c5e5, 0x65e3c4d4, 0xe801c218, 0xfffff792,
+0x00026bba, 0x0fc08400, 0x0017ac84, 0x6ffdc500,
+0xfffee8bd, 0x56c4c5ff, 0xffff6895, 0x7ffdc5ff,
+0xfffee895, 0x54f4c5ff, 0xffff688d, 0x7ffdc5ff,
+0xffff088d, 0x6ffdc5ff, 0xffff28bd, 0x57c4c5ff,
+0xffff68bd, 0x7ffdc5ff, 0xffff28bd, 0x28858bff,
+0xc5ffffff, 0xe88d55f4, 0xc5fffffe, 0x00d1c5f9,
+0x0fc23966, 0xb60fc094, 0x89d8f7c0, 0xfffed485,
+0xc5f9c5ff, 0x3b6601c1, 0xffff2a85, 0x6ef9c5ff,
+0xfffed495, 0xc0940fff, 0xf7c0b60f, 0xd08589d8,
+0xc5fffffe, 0x02c1c5f9, 0x2c853b66, 0xc5ffffff,
+0xd095c4e9, 0x01fffffe, 0x0fc0940f, 0xd8f7c0b6,
+0xfecc8589, 0xf9c5ffff, 0x6603c1c5, 0xff2e853b,
+0xf9c5ffff, 0xfecca56e, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffec8, 0xc1c5f9c5, 0x853b6604,
+0xffffff30, 0xa5c4d9c5, 0xfffffec8, 0x62e9c501,
+0xc0940fd4, 0xf7c0b60f, 0xa48589d8, 0xc5fffffe,
+0x05c1c5f9, 0x32853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffea085, 0xc5f9c5ff, 0x3b6606c1,
+0xffff3485, 0xc0940fff, 0xf7c0b60f, 0x9c8589d8,
+0xc5fffffe, 0x07c1c5f9, 0x197de3c4, 0x3b6601c9,
+0xffff3685, 0xc5f9c5ff, 0xf9c505d1, 0x0f07d9c5,
+0xb60fc094, 0x89d8f7c0, 0xfffe9885, 0xc5f9c5ff,
+0x3b6600c1, 0xffff3885, 0xc0940fff, 0xf7c0b60f,
+0x948589d8, 0xc5fffffe, 0x01c1c5f9, 0x3a853b66,
+0x0fffffff, 0xc931c094, 0xf7c0b60f, 0x908589d8,
+0xc5fffffe, 0x02c1c5f9, 0x3c853b66, 0xc5ffffff,
+0x03c1c5f9, 0xf7c1940f, 0x853b66d9, 0xffffff3e,
+0xe96ef9c5, 0x0fc0940f, 0xf9c5f8b6, 0xf704c1c5,
+0x853b66df, 0xffffff40, 0xefc4d1c5, 0xc0940f01,
+0xf7c0b60f, 0x953b66d8, 0xffffff42, 0x0fc2940f,
+0xf9c5f2b6, 0xc506d1c5, 0xa48d6ef9, 0xf7fffffe,
+0xc4f1c5de, 0xfffea08d, 0x3b6601ff, 0xffff4495,
+0xc2940fff, 0xf7d2b60f, 0x9d3b66da, 0xffffff46,
+0xe26ef9c5, 0x9d6ef9c5, 0xfffffe9c, 0x9dc4e1c5,
+0xfffffe98, 0x62f1c501, 0x6ef9c5cb, 0xfffe949d,
+0x6ce9c5ff, 0xc4e1c5d1, 0xfffe909d, 0xf9c501ff,
+0x940fc86e, 0xc4f1c5c3, 0xe1c501ce, 0xb60fdd62,
+0xc5dbf7db, 0x01e3c4d9, 0xcc62f1c5, 0xc96ce1c5,
+0x186de3c4, 0x27e801c1, 0xbafffff5, 0x00000277,
+0x840fc084, 0x00001541, 0xbd6ff9c5, 0xffffff48,
+0x8dd5c1c5, 0xffffff68, 0xbd6ff9c5, 0xffffff58,
+0x95d5c1c5, 0xffffff78, 0x1875e3c4, 0xfdc501ca,
+0xfee88d7f, 0xc766ffff, 0xffff0885, 0x8d0010ff,
+0xffff0885, 0x85c766ff, 0xffffff26, 0x8d8d0010,
+0xffffff16, 0xfea8ad83, 0x8302ffff, 0x958b02c0,
+0xfffffea8, 0xfe500366, 0xfea8bd8b, 0xb70fffff,
+0x108966d2, 0x39148966, 0x7502ff83, 0xe8858bd7,
+0x66fffffe, 0xff088539, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffea8, 0xea858b66, 0x66fffffe,
+0xff0a8539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffed4, 0xfeec858b, 0x3966ffff, 0xffff0c85,
+0xc0940fff, 0xf7c0b60f, 0xd08589d8, 0x66fffffe,
+0xfeee858b, 0x3966ffff, 0xffff0e85, 0xc0940fff,
+0xf7c0b60f, 0xcc8589d8, 0x8bfffffe, 0xfffef085,
+0x853966ff, 0xffffff10, 0x0fc0940f, 0xd8f7c0b6,
+0xfec88589, 0x8b66ffff, 0xfffef285, 0x853966ff,
+0xffffff12, 0x0fc0940f, 0xd8f7c0b6, 0xfea48589,
+0x858bffff, 0xfffffef4, 0x14853966, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffea085, 0x858b66ff,
+0xfffffef6, 0x16853966, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe9c85, 0x85b70fff, 0xfffffef8,
+0x940fd039, 0xc0b60fc0, 0x8589d8f7, 0xfffffe98,
+0xfa858b66, 0x66fffffe, 0xff1a8539, 0x940fffff,
+0x0fc931c0, 0xd8f7c0b6, 0xfe948589, 0x858bffff,
+0xfffffefc, 0x1c853966, 0x66ffffff, 0xfefe858b,
+0x940fffff, 0x66d9f7c1, 0xff1e8539, 0xf9c5ffff,
+0xf9c5e96e, 0xfea8956e, 0x8b66ffff, 0xffff02b5,
+0xc4e9c5ff, 0xfffed495, 0xf9c501ff, 0xfed0a56e,
+0x9d8bffff, 0xffffff04, 0xa5c4d9c5, 0xfffffecc,
+0x6ef9c501, 0xfffec88d, 0xc0940fff, 0xd462e9c5,
+0x8dc4f1c5, 0xfffffea4, 0xf8b60f01, 0xff00858b,
+0xf9c5ffff, 0xfea09d6e, 0xdff7ffff, 0x9dc4e1c5,
+0xfffffe9c, 0x62f1c501, 0x853966cb, 0xffffff20,
+0xd16ce9c5, 0x9d6ef9c5, 0xfffffe98, 0xefc4d1c5,
+0xc4e1c501, 0xfffe949d, 0xe1c501ff, 0x940fdd62,
+0xc0b60fc0, 0x3966d8f7, 0xffff22b5, 0x6ef9c5ff,
+0xc2940fc8, 0x31f2b60f, 0x66def7d2, 0xff249d39,
+0xf1c5ffff, 0x6601cec4, 0xff069d8b, 0x940fffff,
+0x66daf7c2, 0xff269d39, 0xf9c5ffff, 0x940fe26e,
+0xdbb60fc3, 0xd9c5dbf7, 0xc501e3c4, 0xc5cc62f1,
+0xc4c96ce1, 0xc1186de3, 0xf284e801, 0xd3baffff,
+0x84000002, 0x9e840fc0, 0xc5000012, 0x488d6ffd,
+0xc5ffffff, 0x288d7ffd, 0xc5ffffff, 0x28bd6ff9,
+0xc5ffffff, 0x03f771e1, 0xbd6ff9c5, 0xffffff38,
+0xf771e9c5, 0x65e3c403, 0xc501fa18, 0xa8bd7ffd,
+0xc5fffffe, 0xa8bd6ffd, 0x8bfffffe, 0xfffea885,
+0x7ffdc5ff, 0xfffee8bd, 0x6ff9c5ff, 0xffff28b5,
+0x6ff9c5ff, 0xffff38bd, 0x71e9c5ff, 0xe1c502f6,
+0xc402f771, 0xd3186de3, 0x7ffdc501, 0xffff0895,
+0x6ff9c5ff, 0xffff08b5, 0xfdc9c5ff, 0x6ff9c5de,
+0xffff18bd, 0xc5f9c5ff, 0x396600d3, 0xfdc1c5c2,
+0xc0940fd7, 0xd2c5f9c5, 0xc5f9c505, 0xb60f07da,
+0x89d8f7c0, 0xfffea885, 0xc5f9c5ff, 0x3b6601c3,
+0xfffeea85, 0xc0940fff, 0xf7c0b60f, 0xd48589d8,
+0xc5fffffe, 0x02c3c5f9, 0xec853b66, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffed085, 0xc5f9c5ff,
+0x3b6603c3, 0xfffeee85, 0x6ef9c5ff, 0xfffed0ad,
+0xc0940fff, 0xf7c0b60f, 0xcc8589d8, 0xc5fffffe,
+0x04c3c5f9, 0xf0853b66, 0xc5fffffe, 0xccadc4d1,
+0x01fffffe, 0x0fc0940f, 0xd8f7c0b6, 0xfec88589,
+0xf9c5ffff, 0x6605c3c5, 0xfef2853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffea4, 0xc3c5f9c5,
+0x853b6606, 0xfffffef4, 0x0fc0940f, 0xd8f7c0b6,
+0xfea08589, 0xf9c5ffff, 0xc507c3c5, 0xa89d6ef9,
+0x66fffffe, 0xfef6853b, 0xe1c5ffff, 0xfed49dc4,
+0xc501ffff, 0x0fdd62e1, 0xb60fc094, 0x89d8f7c0,
+0xfffe9c85, 0xc5f9c5ff, 0x3b6600c2, 0xfffef885,
+0xc0940fff, 0xf7c0b60f, 0x988589d8, 0xc5fffffe,
+0x01c2c5f9, 0xfa853b66, 0x0ffffffe, 0xc931c094,
+0xf7c0b60f, 0x948589d8, 0xc5fffffe, 0x02c2c5f9,
+0xfc853b66, 0xc5fffffe, 0x03c2c5f9, 0xf7c1940f,
+0x853b66d9, 0xfffffefe, 0xf16ef9c5, 0x0fc0940f,
+0xf9c5f8b6, 0xf704c2c5, 0x853b66df, 0xffffff00,
+0xf7c4c9c5, 0xc0940f01, 0xf7c0b60f, 0x953b66d8,
+0xffffff02, 0xe86ef9c5, 0x0fc2940f, 0xf9c5f2b6,
+0xc506d2c5, 0xc8956ef9, 0xf7fffffe, 0x953b66de,
+0xffffff04, 0xeec4d1c5, 0xc2940f01, 0xf7d2b60f,
+0x9d3b66da, 0xffffff06, 0x95c4e9c5, 0xfffffea4,
+0x6ef9c501, 0xfffea0a5, 0xc4d9c5ff, 0xfffe9ca5,
+0xe9c501ff, 0xf9c5d462, 0xe1c5e26e, 0xf9c5da6c,
+0xfe98956e, 0xe9c5ffff, 0xfe9495c4, 0x0f01ffff,
+0xe9c5c394, 0xb60fd662, 0xc5dbf7db, 0x01e3c4d9,
+0xec62d1c5, 0xd56ce9c5, 0x1865e3c4, 0xdfe801c2,
+0xbaffffef, 0x000002f8, 0x840fc084, 0x00000ff9,
+0xb56ff9c5, 0xfffffee8, 0xbd6ff9c5, 0xfffffef8,
+0xd671e9c5, 0x71e1c502, 0xe3c402d7, 0x01d3186d,
+0x957ffdc5, 0xffffff28, 0xb56ff9c5, 0xffffff28,
+0xdefdc9c5, 0xbd6ff9c5, 0xffffff38, 0xc3c5f9c5,
+0x853b6600, 0xffffff08, 0xd7fdc1c5, 0xd2c5f9c5,
+0xc5f9c505, 0x940f07da, 0xc0b60fc0, 0x8589d8f7,
+0xfffffea8, 0xc3c5f9c5, 0x853b6601, 0xffffff0a,
+0x0fc0940f, 0xd8f7c0b6, 0xfed48589, 0xf9c5ffff,
+0x6602c3c5, 0xff0c853b, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffed0, 0xc3c5f9c5, 0x853b6603,
+0xffffff0e, 0xad6ef9c5, 0xfffffed0, 0x0fc0940f,
+0xd8f7c0b6, 0xfecc8589, 0xf9c5ffff, 0x6604c3c5,
+0xff10853b, 0xd1c5ffff, 0xfeccadc4, 0x0f01ffff,
+0xb60fc094, 0x89d8f7c0, 0xfffec885, 0xc5f9c5ff,
+0x3b6605c3, 0xffff1285, 0xc0940fff, 0xf7c0b60f,
+0xa48589d8, 0xc5fffffe, 0x06c3c5f9, 0x14853b66,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffea085,
+0xc5f9c5ff, 0xf9c507c3, 0xfea89d6e, 0x3b66ffff,
+0xffff1685, 0xc4e1c5ff, 0xfffed49d, 0xe1c501ff,
+0x940fdd62, 0xc0b60fc0, 0x8589d8f7, 0xfffffe9c,
+0xc2c5f9c5, 0x853b6600, 0xffffff18, 0x0fc0940f,
+0xd8f7c0b6, 0xfe988589, 0xf9c5ffff, 0x6601c2c5,
+0xff1a853b, 0x940fffff, 0x0fc931c0, 0xd8f7c0b6,
+0xfe948589, 0xf9c5ffff, 0x6602c2c5, 0xff1c853b,
+0xf9c5ffff, 0x0f03c2c5, 0xd9f7c194, 0x1e853b66,
+0xc5ffffff, 0x0ff16ef9, 0xb60fc094, 0xc5f9c5f8,
+0xdff704c2, 0x20853b66, 0xc5ffffff, 0x01f7c4c9,
+0x0fc0940f, 0xd8f7c0b6, 0x22953b66, 0xc5ffffff,
+0x0fe86ef9, 0xb60fc294, 0xc5f9c5f2, 0xdef706d2,
+0x24953b66, 0xc5ffffff, 0x01eec4d1, 0x0fc2940f,
+0xdaf7d2b6, 0x269d3b66, 0xc5ffffff, 0xc8956ef9,
+0xc5fffffe, 0xa0a56ef9, 0xc5fffffe, 0xa495c4e9,
+0x01fffffe, 0xa5c4d9c5, 0xfffffe9c, 0x62e9c501,
+0x6ef9c5d4, 0x6ce1c5e2, 0x6ef9c5da, 0xfffe9895,
+0xc3940fff, 0x95c4e9c5, 0xfffffe94, 0x62e9c501,
+0xdbb60fd6, 0xd9c5dbf7, 0xc501e3c4, 0xc5ec62d1,
+0xc4d56ce9, 0xc21865e3, 0xed84e801, 0xfdbaffff,
+0x84000002, 0x9e840fc0, 0xc700000d, 0xfffee485,
+0x000003ff, 0x7ffdc500, 0xffff288d, 0x6ef9c5ff,
+0xfffee49d, 0x6ff9c5ff, 0xffff38b5, 0xf1f1c5ff,
+0xf1c9c5e3, 0x5de3c4db, 0xc501fb18, 0xa8bd7ffd,
+0xc5fffffe, 0xa8b56ffd, 0x8bfffffe, 0xfffea885,
+0x7ffdc5ff, 0xfffee8b5, 0xe485c7ff, 0x02fffffe,
+0xc5000000, 0xe49d6ef9, 0xc5fffffe, 0x38bd6ff9,
+0xc5ffffff, 0xc5d3f1f1, 0xc4dbf1c1, 0xd3186de3,
+0x7ffdc501, 0xffff0895, 0x6ff9c5ff, 0xffff08b5,
+0xfdc9c5ff, 0x6ff9c5de, 0xffff18bd, 0xc5f9c5ff,
+0x396600d3, 0xfdc1c5c2, 0xc0940fd7, 0xd2c5f9c5,
+0xc5f9c505, 0xb60f07da, 0x89d8f7c0, 0xfffea885,
+0xc5f9c5ff, 0x3b6601c3, 0xfffeea85, 0xc0940fff,
+0xf7c0b60f, 0xd48589d8, 0xc5fffffe, 0x02c3c5f9,
+0xec853b66, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffed085, 0xc5f9c5ff, 0x3b6603c3, 0xfffeee85,
+0x6ef9c5ff, 0xfffed0ad, 0xc0940fff, 0xf7c0b60f,
+0xcc8589d8, 0xc5fffffe, 0x04c3c5f9, 0xf0853b66,
+0xc5fffffe, 0xccadc4d1, 0x01fffffe, 0x0fc0940f,
+0xd8f7c0b6, 0xfec88589, 0xf9c5ffff, 0x6605c3c5,
+0xfef2853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffea4, 0xc3c5f9c5, 0x853b6606, 0xfffffef4,
+0x0fc0940f, 0xd8f7c0b6, 0xfea08589, 0xf9c5ffff,
+0xc507c3c5, 0xa89d6ef9, 0x66fffffe, 0xfef6853b,
+0xe1c5ffff, 0xfed49dc4, 0xc501ffff, 0x0fdd62e1,
+0xb60fc094, 0x89d8f7c0, 0xfffe9c85, 0xc5f9c5ff,
+0x3b6600c2, 0xfffef885, 0xc0940fff, 0xf7c0b60f,
+0x988589d8, 0xc5fffffe, 0x01c2c5f9, 0xfa853b66,
+0x0ffffffe, 0xc931c094, 0xf7c0b60f, 0x948589d8,
+0xc5fffffe, 0x02c2c5f9, 0xfc853b66, 0xc5fffffe,
+0x03c2c5f9, 0xf7c1940f, 0x853b66d9, 0xfffffefe,
+0xf16ef9c5, 0x0fc0940f, 0xf9c5f8b6, 0xf704c2c5,
+0x853b66df, 0xffffff00, 0xf7c4c9c5, 0xc0940f01,
+0xf7c0b60f, 0x953b66d8, 0xffffff02, 0xe86ef9c5,
+0x0fc2940f, 0xf9c5f2b6, 0xc506d2c5, 0xc8956ef9,
+0xf7fffffe, 0x953b66de, 0xffffff04, 0xeec4d1c5,
+0xc2940f01, 0xf7d2b60f, 0x9d3b66da, 0xffffff06,
+0x95c4e9c5, 0xfffffea4, 0x6ef9c501, 0xfffea0a5,
+0xc4d9c5ff, 0xfffe9ca5, 0xe9c501ff, 0xf9c5d462,
+0xe1c5e26e, 0xf9c5da6c, 0xfe98956e, 0xe9c5ffff,
+0xfe9495c4, 0x0f01ffff, 0xe9c5c394, 0xb60fd662,
+0xc5dbf7db, 0x01e3c4d9, 0xec62d1c5, 0xd56ce9c5,
+0x1865e3c4, 0xd7e801c2, 0xbaffffea, 0x00000310,
+0x840fc084, 0x00000af1, 0x9d6ef9c5, 0xfffffee4,
+0xb56ff9c5, 0xfffffee8, 0xbd6ff9c5, 0xfffffef8,
+0xd3d1c9c5, 0xdbd1c1c5, 0x186de3c4, 0xfdc501d3,
+0xff28957f, 0xf9c5ffff, 0xff28b56f, 0xc9c5ffff,
+0xf9c5defd, 0xff38bd6f, 0xf9c5ffff, 0x6600c3c5,
+0xff08853b, 0xc1c5ffff, 0xf9c5d7fd, 0xc505d2c5,
+0x07dac5f9, 0x0fc0940f, 0xd8f7c0b6, 0xfea88589,
+0xf9c5ffff, 0x6601c3c5, 0xff0a853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffed4, 0xc3c5f9c5,
+0x853b6602, 0xffffff0c, 0x0fc0940f, 0xd8f7c0b6,
+0xfed08589, 0xf9c5ffff, 0x6603c3c5, 0xff0e853b,
+0xf9c5ffff, 0xfed0ad6e, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffecc, 0xc3c5f9c5, 0x853b6604,
+0xffffff10, 0xadc4d1c5, 0xfffffecc, 0xc0940f01,
+0xf7c0b60f, 0xc88589d8, 0xc5fffffe, 0x05c3c5f9,
+0x12853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffea485, 0xc5f9c5ff, 0x3b6606c3, 0xffff1485,
+0xc0940fff, 0xf7c0b60f, 0xa08589d8, 0xc5fffffe,
+0x07c3c5f9, 0x9d6ef9c5, 0xfffffea8, 0x16853b66,
+0xc5ffffff, 0xd49dc4e1, 0x01fffffe, 0xdd62e1c5,
+0x0fc0940f, 0xd8f7c0b6, 0xfe9c8589, 0xf9c5ffff,
+0x6600c2c5, 0xff18853b, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe98, 0xc2c5f9c5, 0x853b6601,
+0xffffff1a, 0x31c0940f, 0xc0b60fc9, 0x8589d8f7,
+0xfffffe94, 0xc2c5f9c5, 0x853b6602, 0xffffff1c,
+0xc2c5f9c5, 0xc1940f03, 0x3b66d9f7, 0xffff1e85,
+0x6ef9c5ff, 0xc0940ff1, 0xc5f8b60f, 0x04c2c5f9,
+0x3b66dff7, 0xffff2085, 0xc4c9c5ff, 0x940f01f7,
+0xc0b60fc0, 0x3b66d8f7, 0xffff2295, 0x6ef9c5ff,
+0xc2940fe8, 0xc5f2b60f, 0x06d2c5f9, 0x3b66def7,
+0xffff2495, 0xc4d1c5ff, 0x940f01ee, 0xd2b60fc2,
+0x3b66daf7, 0xffff269d, 0x6ef9c5ff, 0xfffec895,
+0x6ef9c5ff, 0xfffea0a5, 0xc4e9c5ff, 0xfffea495,
+0xd9c501ff, 0xfe9ca5c4, 0xc501ffff, 0xc5d462e9,
+0xc5e26ef9, 0xc5da6ce1, 0x98956ef9, 0x0ffffffe,
+0xe9c5c394, 0xfe9495c4, 0xc501ffff, 0x0fd662e9,
+0xdbf7dbb6, 0xe3c4d9c5, 0x62d1c501, 0x6ce9c5ec,
+0x65e3c4d5, 0xe801c218, 0xffffe876, 0x000314ba,
+0x0fc08400, 0x00089084, 0xa8458b00, 0xaa4d8b66,
+0xae758b66, 0xc65d8b66, 0x19d8f766, 0xd9f766c0,
+0x19ac4d8b, 0x6ef9c5ff, 0xc4e1c5d8, 0xf76601df,
+0x66c919d9, 0x758bdef7, 0xa88d89b0, 0x19fffffe,
+0xd48d89c9, 0xc5fffffe, 0xa8ad6ef9, 0xc5fffffe,
+0xd4adc4d1, 0x01fffffe, 0xdd62e1c5, 0x66def766,
+0x19b2758b, 0xd08d89c9, 0xc5fffffe, 0xd0956ef9,
+0x66fffffe, 0x758bdef7, 0x89c919b4, 0xfffecc8d,
+0xc4e9c5ff, 0xfffecc95, 0xf76601ff, 0x758b66de,
+0x89c919b6, 0xfffec88d, 0x6ef9c5ff, 0xfffec8a5,
+0xdef766ff, 0x19b8758b, 0xa48d89c9, 0xc5fffffe,
+0xa4a5c4d9, 0x01fffffe, 0xd462e9c5, 0xd26ce1c5,
+0x66def766, 0x19ba758b, 0xa08d89c9, 0x66fffffe,
+0x758bdef7, 0x89c919bc, 0xfffe9c8d, 0xdef766ff,
+0xbe758b66, 0x8d89c919, 0xfffffe98, 0x8bdef766,
+0xc919c075, 0xfe948d89, 0x8b66ffff, 0xf766c24d,
+0x66d219de, 0x4d8bd9f7, 0x6ef9c5c4, 0xc5f619ea,
+0xa09d6ef9, 0xc5fffffe, 0x98b56ef9, 0xc5fffffe,
+0x9c9dc4e1, 0x01fffffe, 0xb5c4c9c5, 0xfffffe94,
+0xc4d1c501, 0xe1c501ee, 0xf766de62, 0x66c919d9,
+0xdb19dbf7, 0xe16ef9c5, 0xe3c4d9c5, 0x62d1c501,
+0x6ce1c5ec, 0x6de3c4dd, 0xc501d318, 0xc5d154ec,
+0xc5da6ff9, 0x28957ffd, 0x8fffffff, 0x6599e8e9,
+0x6ff9c5a8, 0xe98fb875, 0x38959948, 0xc4ffffff,
+0xfa185de3, 0x7ffdc501, 0xfffea8bd, 0x6ffdc5ff,
+0xfffea8b5, 0xa8858bff, 0xc5fffffe, 0xe8b57ffd,
+0xc5fffffe, 0xc5d276e9, 0xa865fde9, 0x55fde9c5,
+0x5de3c4b8, 0xc501d218, 0xa8557ffd, 0x99e0e98f,
+0xf9c5a85d, 0x8fb87d6f, 0x959940e9, 0xffffff38,
+0x1865e3c4, 0xe1c501e2, 0xe9c5dbfd, 0xf9c5d2fd,
+0x6600d3c5, 0xf9c5c239, 0x0f05d2c5, 0xf9c5c094,
+0xc507dac5, 0x08a57ffd, 0x0fffffff, 0xd8f7c0b6,
+0xfea88589, 0xf9c5ffff, 0x6601c3c5, 0xfeea853b,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffed4,
+0xc3c5f9c5, 0x853b6602, 0xfffffeec, 0x0fc0940f,
+0xd8f7c0b6, 0xfed08589, 0xf9c5ffff, 0x6603c3c5,
+0xfeee853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffecc, 0xc3c5f9c5, 0x853b6604, 0xfffffef0,
+0x0fc0940f, 0xd8f7c0b6, 0xfec88589, 0xf9c5ffff,
+0x6605c3c5, 0xfef2853b, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffea4, 0xc3c5f9c5, 0x853b6606,
+0xfffffef4, 0x0fc0940f, 0xd8f7c0b6, 0xfea08589,
+0xf9c5ffff, 0x6607c3c5, 0xfef6853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe9c, 0xc2c5f9c5,
+0x853b6600, 0xfffffef8, 0x0fc0940f, 0xd8f7c0b6,
+0xfe988589, 0xf9c5ffff, 0x6601c2c5, 0xfefa853b,
+0x940fffff, 0x0fc931c0, 0xd8f7c0b6, 0xfe948589,
+0xf9c5ffff, 0x6602c2c5, 0xfefc853b, 0xf9c5ffff,
+0x0f03c2c5, 0xd9f7c194, 0xfe853b66, 0xc5fffffe,
+0x0ff16ef9, 0xb60fc094, 0xc5f9c5f8, 0xdff704c2,
+0x00853b66, 0xc5ffffff, 0x01f7c4c9, 0x0fc0940f,
+0xd8f7c0b6, 0x02953b66, 0x0fffffff, 0xb60fc294,
+0xc5f9c5f2, 0xdef706d2, 0x04953b66, 0x0fffffff,
+0xb60fc294, 0x66daf7d2, 0xff069d3b, 0xf9c5ffff,
+0xfea89d6e, 0xf9c5ffff, 0xfed0ad6e, 0xe1c5ffff,
+0xfed49dc4, 0xc501ffff, 0xccadc4d1, 0x01fffffe,
+0x956ef9c5, 0xfffffec8, 0xdd62e1c5, 0x95c4e9c5,
+0xfffffea4, 0x6ef9c501, 0xc3940fe8, 0xa56ef9c5,
+0xfffffea0, 0xeec4d1c5, 0xdbb60f01, 0xa5c4d9c5,
+0xfffffe9c, 0x62e9c501, 0xc5dbf7d4, 0xc5e26ef9,
+0xc5da6ce1, 0x01e3c4d9, 0x956ef9c5, 0xfffffe98,
+0xec62d1c5, 0x95c4e9c5, 0xfffffe94, 0x62e9c501,
+0x6ce9c5d6, 0x65e3c4d5, 0xe801c218, 0xffffe482,
+0x00032cba, 0x0fc08400, 0x00049c84, 0xefe9c500,
+0xf9e9c5d2, 0xe9c5a85d, 0x8fb855f9, 0x9d9560e9,
+0xffffff08, 0x9568e98f, 0xffff1895, 0xc5f9c5ff,
+0x3b6600c3, 0xffff2885, 0xc5f9c5ff, 0xe3c405d2,
+0x01e21865, 0xdac5f9c5, 0x7ffdc507, 0xfffee8a5,
+0xc0940fff, 0xf7c0b60f, 0xa88589d8, 0xc5fffffe,
+0x01c3c5f9, 0x2a853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffed485, 0xc5f9c5ff, 0x3b6602c3,
+0xffff2c85, 0xc0940fff, 0xf7c0b60f, 0xd08589d8,
+0xc5fffffe, 0x03c3c5f9, 0x2e853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffecc85, 0xc5f9c5ff,
+0x3b6604c3, 0xffff3085, 0xc0940fff, 0xf7c0b60f,
+0xc88589d8, 0xc5fffffe, 0x05c3c5f9, 0x32853b66,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffea485,
+0xc5f9c5ff, 0x3b6606c3, 0xffff3485, 0xc0940fff,
+0xf7c0b60f, 0xa08589d8, 0xc5fffffe, 0x07c3c5f9,
+0x36853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffe9c85, 0xc5f9c5ff, 0x3b6600c2, 0xffff3885,
+0xc0940fff, 0xf7c0b60f, 0x988589d8, 0xc5fffffe,
+0x01c2c5f9, 0x3a853b66, 0x0fffffff, 0xc931c094,
+0xf7c0b60f, 0x948589d8, 0xc5fffffe, 0x02c2c5f9,
+0x3c853b66, 0xc5ffffff, 0x03c2c5f9, 0xf7c1940f,
+0x853b66d9, 0xffffff3e, 0xf16ef9c5, 0x0fc0940f,
+0xf9c5f8b6, 0xf704c2c5, 0x853b66df, 0xffffff40,
+0xf7c4c9c5, 0xc0940f01, 0xf7c0b60f, 0x953b66d8,
+0xffffff42, 0x0fc2940f, 0xf9c5f2b6, 0xf706d2c5,
+0x953b66de, 0xffffff44, 0x0fc2940f, 0xdaf7d2b6,
+0x469d3b66, 0xc5ffffff, 0xa89d6ef9, 0xc5fffffe,
+0xd0ad6ef9, 0xc5fffffe, 0xd49dc4e1, 0x01fffffe,
+0xadc4d1c5, 0xfffffecc, 0x6ef9c501, 0xfffec895,
+0x62e1c5ff, 0xc4e9c5dd, 0xfffea495, 0xf9c501ff,
+0x940fe86e, 0x6ef9c5c3, 0xfffea0a5, 0xc4d1c5ff,
+0xb60f01ee, 0xc4d9c5db, 0xfffe9ca5, 0xe9c501ff,
+0xdbf7d462, 0xe26ef9c5, 0xda6ce1c5, 0xe3c4d9c5,
+0x6ef9c501, 0xfffe9895, 0x62d1c5ff, 0xc4e9c5ec,
+0xfffe9495, 0xe9c501ff, 0xe9c5d662, 0xe3c4d56c,
+0x01c21865, 0xffe239e8, 0x0331baff, 0xc0840000,
+0x0253840f, 0xc0310000, 0x956ffdc5, 0xffffff68,
+0xfdc501a8, 0x0475da6f, 0xd96ffdc5, 0x5d7ffdc5,
+0x548b66c8, 0x8966c845, 0xff084594, 0x8340ffff,
+0xdc7510f8, 0xa2f4e88f, 0xc520884d, 0x00c1c5f9,
+0x08853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffea885, 0xc5f9c5ff, 0x3b6601c1, 0xffff0a85,
+0x6ef9c5ff, 0xfffea895, 0xc0940fff, 0xf7c0b60f,
+0xd48589d8, 0xc5fffffe, 0x02c1c5f9, 0x0c853b66,
+0xc5ffffff, 0xd495c4e9, 0x01fffffe, 0x0fc0940f,
+0xd8f7c0b6, 0xfed08589, 0xf9c5ffff, 0x6603c1c5,
+0xff0e853b, 0xf9c5ffff, 0xfed0a56e, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffecc, 0xc1c5f9c5,
+0x853b6604, 0xffffff10, 0xa5c4d9c5, 0xfffffecc,
+0x62e9c501, 0xc0940fd4, 0xf7c0b60f, 0xc88589d8,
+0xc5fffffe, 0x05c1c5f9, 0x12853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffea485, 0xc5f9c5ff,
+0x3b6606c1, 0xffff1485, 0xc0940fff, 0xf7c0b60f,
+0xa08589d8, 0xc5fffffe, 0x07c1c5f9, 0x197de3c4,
+0x3b6601c9, 0xffff1685, 0xc5f9c5ff, 0xf9c505d1,
+0x0f07d9c5, 0xb60fc094, 0x89d8f7c0, 0xfffe9c85,
+0xc5f9c5ff, 0x3b6600c1, 0xffff1885, 0xc0940fff,
+0xf7c0b60f, 0x988589d8, 0xc5fffffe, 0x01c1c5f9,
+0x1a853b66, 0x0fffffff, 0xc931c094, 0xf7c0b60f,
+0x948589d8, 0xc5fffffe, 0x02c1c5f9, 0x1c853b66,
+0xc5ffffff, 0x03c1c5f9, 0xf7c1940f, 0x853b66d9,
+0xffffff1e, 0xe96ef9c5, 0x0fc0940f, 0xf9c5f8b6,
+0xf704c1c5, 0x853b66df, 0xffffff20, 0xefc4d1c5,
+0xc0940f01, 0xf7c0b60f, 0x953b66d8, 0xffffff22,
+0x0fc2940f, 0xf9c5f2b6, 0xc506d1c5, 0xc88d6ef9,
+0xf7fffffe, 0x953b66de, 0xffffff24, 0x0fc2940f,
+0xdaf7d2b6, 0x269d3b66, 0xc5ffffff, 0xc5e26ef9,
+0xa48dc4f1, 0x01fffffe, 0x9d6ef9c5, 0xfffffea0,
+0x9dc4e1c5, 0xfffffe9c, 0x62f1c501, 0x6ef9c5cb,
+0xfffe989d, 0x6ce9c5ff, 0xc4e1c5d1, 0xfffe949d,
+0x940f01ff, 0x6ef9c5c3, 0x62e1c5c8, 0xdbb60fdd,
+0xcec4f1c5, 0xc5dbf701, 0x01e3c4d9, 0xcc62f1c5,
+0xc96ce1c5, 0x186de3c4, 0xe3e801c1, 0x3cffffdf,
+0x81d21901, 0x0003c4e2, 0xa8c48100, 0x89000001,
+0x5e5b59d0, 0x618d5d5f, 0x0000c3fc,
+0020072,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i4[] = {
+0xb95500eb, 0x00000020, 0x00102ee8, 0x10430500,
+0xe5890000, 0x0009bf57, 0x53560000, 0x81e0e483,
+0x000140ec, 0x24448900, 0x89c03114, 0x89fe89c3,
+0xe28340da, 0x83c62901, 0xd21901fa, 0x4a02e283,
+0x0175d885, 0x84848949, 0x0000009c, 0x8908f883,
+0x00bc84b4, 0x94890000, 0x0000dc84, 0x848c8900,
+0x000000fc, 0xfdc5c575, 0xa024bc6f, 0xc5000000,
+0x247c7ffd, 0x24448b40, 0x24843940, 0x000000a0,
+0x44245c8b, 0x31c0940f, 0xc0b60fc9, 0x9c3bd8f7,
+0x0000a424, 0x6ef9c500, 0x24448bc8, 0xc1940f48,
+0x843bd9f7, 0x0000a824, 0x71e3c400, 0x8901c922,
+0x0f2c2444, 0xb60fc094, 0xc5d8f7c0, 0x8bd86ef9,
+0x3b4c2444, 0x00ac2484, 0x44890000, 0x940f2824,
+0xf0b60fc0, 0x5024448b, 0x843bdef7, 0x0000b024,
+0x61e3c400, 0xc501de22, 0x89cb6cf1, 0x0f242444,
+0xb60fc094, 0xc5d8f7c0, 0x8bd06ef9, 0x3b542444,
+0x00b42484, 0x44890000, 0x940f2024, 0x24448bc2,
+0xfab60f58, 0xdff7d231, 0xb824843b, 0xc4000000,
+0xd72269e3, 0x24448901, 0x24448b1c, 0xc2940f5c,
+0x843bdaf7, 0x0000bc24, 0x6ef9c500, 0x244489fa,
+0xc0940f18, 0xf7c0b60f, 0x41e3c4d8, 0xc501e022,
+0xc4d46ce9, 0xca1875e3, 0x50fcc501, 0xfffa81d1,
+0xb8000000, 0x00000260, 0x0ec5850f, 0xf9c50000,
+0x40244c6f, 0x646ff9c5, 0xf1c55024, 0xa02494fe,
+0xc5000000, 0x249cfed9, 0x000000b0, 0x186de3c4,
+0xfdc501d3, 0x6024547f, 0xbc6ff9c5, 0x0000a024,
+0x72e1c500, 0xf9c501f7, 0xb024b46f, 0xc5000000,
+0x39d87ef9, 0xc4602444, 0xda1679e3, 0x72d1c501,
+0xe3c401f6, 0x01ef1679, 0x31c0940f, 0xc0b60fc9,
+0x5439d8f7, 0xe3c46424, 0x02da1679, 0xd06ef9c5,
+0xf7c1940f, 0x245439d9, 0x69e3c468, 0x0f01d122,
+0xb60fc094, 0xc5daf7d0, 0xc4f26ef9, 0xda1679e3,
+0x24543903, 0xc2940f6c, 0xc5f2b60f, 0xf7ea7ef9,
+0x245439de, 0x49e3c470, 0xc501f622, 0x0fd66ce9,
+0xb60fc094, 0x79e3c4d0, 0xf703e816, 0x247c39da,
+0x6ef9c574, 0xc2940fda, 0xc4fab60f, 0xea1679e3,
+0x39dff702, 0xc4782454, 0xdf2261e3, 0xc2940f01,
+0xf7d2b60f, 0x244439da, 0x6ef9c57c, 0xc0940ffa,
+0xf7c0b60f, 0x41e3c4d8, 0xc501e822, 0xc4dd6ce1,
+0xd3186de3, 0x50fcc501, 0xfffa81d2, 0xb8000000,
+0x00000266, 0x0da9850f, 0xf9c50000, 0x6024746f,
+0x7c6ff9c5, 0xc9c57024, 0xa02494fa, 0xc5000000,
+0x249cfac1, 0x000000b0, 0x186de3c4, 0xfdc501d3,
+0x8024947f, 0x8b000000, 0x00802484, 0x44390000,
+0x940f4024, 0x0fc931c0, 0xd8f7c0b6, 0x84249c3b,
+0xc5000000, 0x8bd06ef9, 0x0f2c2444, 0xd231c194,
+0x843bd9f7, 0x00008824, 0x69e3c400, 0x8b01d122,
+0x0f282444, 0xdb31c294, 0x843bdaf7, 0x00008c24,
+0x6ef9c500, 0x24448bf2, 0xc3940f24, 0x843bdbf7,
+0x00009024, 0x49e3c400, 0xc501f322, 0x8bd66ce9,
+0x0f202444, 0xb60fc294, 0x3bdef7f2, 0x00942484,
+0xf9c50000, 0x940ffe6e, 0xf8b60fc0, 0x1c24448b,
+0x843bdff7, 0x00009824, 0x41e3c400, 0x0f01df22,
+0xb60fc094, 0xc5d8f7c0, 0x8be86ef9, 0x3b182444,
+0x009c2484, 0x940f0000, 0xc0b60fc0, 0xe3c4d8f7,
+0x01e82251, 0xdd6ce1c5, 0x186de3c4, 0xfcc501d3,
+0xfa81d250, 0x000000ff, 0x00026bb8, 0xa0850f00,
+0xc400000c, 0xa44059e2, 0x0000b024, 0x6ff9c500,
+0x00c024b4, 0xe2c40000, 0x248c4071, 0x000000a0,
+0x1875e3c4, 0xf9c501cc, 0xfdc5d96f, 0x40244c7f,
+0x4049e2c4, 0x6ff9c5ce, 0x00d024b4, 0xe2c40000,
+0xc4d64049, 0xca1875e3, 0x6ff9c501, 0x7ffdc5e1,
+0xc560244c, 0x24946ff9, 0x000000a0, 0xacfee9c5,
+0x0000c024, 0x6ff9c500, 0x00b0248c, 0xf1c50000,
+0xe3c4f6fe, 0x01ee1855, 0xac7ffdc5, 0x00008024,
+0xfae9c500, 0x00c024bc, 0xe1c50000, 0xf9c5dcfa,
+0xf1c5d87e, 0xd024b4fa, 0xc4000000, 0xb44049e2,
+0x00009024, 0x41e2c400, 0xf9c5fd40, 0x50246c6f,
+0xfa7ef9c5, 0x6cfad1c5, 0xc2397024, 0xc4c0940f,
+0xfa1679e3, 0x0fc93101, 0xe3c4c0b6, 0x01f61679,
+0x1679e3c4, 0xd8f702f7, 0x2c244489, 0x1679e3c4,
+0xc23901d8, 0xc4c1940f, 0xfa1679e3, 0x79e3c402,
+0xf702d816, 0xc4c239d9, 0xfa1679e3, 0xc0940f03,
+0xb60fdb31, 0xc5d8f7c0, 0xc4e06ef9, 0xd81679e3,
+0x0fc23903, 0xf9c5c394, 0xf9c5f27e, 0xdbf7e87e,
+0xe3c4c239, 0x01ea1679, 0xc4c0940f, 0xe32259e3,
+0xc0b60f01, 0xd639d8f7, 0xc5c2940f, 0xb8f86ef9,
+0x00000282, 0xc4f2b60f, 0xea1679e3, 0x39def702,
+0x79e3c4d7, 0x0f03ef16, 0xe3c4c294, 0x01ee2241,
+0xf7d2b60f, 0x6ef9c5da, 0x79e3c4da, 0x3903f216,
+0xc2940ffa, 0x746ef9c5, 0xb60f2c24, 0xc4dff7fa,
+0xdf2261e3, 0x6cd1c501, 0x49e3c4eb, 0xc501d922,
+0xc4dc6ce1, 0xdd1865e3, 0x50fcc501, 0xfffa81d3,
+0x0f000000, 0x000afa85, 0x69e2c400, 0xc0249c40,
+0xc4000000, 0xa44071e2, 0x0000d024, 0x65e3c400,
+0xc501dc18, 0xc5d87ef9, 0x245c7ffd, 0x08f88340,
+0x31c0940f, 0xc0b60fc9, 0x7c83d8f7, 0xc50e4424,
+0x0fd86ef9, 0xc031c194, 0x7c83d9f7, 0xc4124824,
+0xd92261e3, 0xc0940f01, 0xd8f7db31, 0x4c247c83,
+0x6ef9c514, 0xc3940fe8, 0xdbf7c031, 0x50247c83,
+0x51e3c414, 0xc501eb22, 0x0fdd6ce1, 0xd8f7c094,
+0x54247c83, 0x6ef9c512, 0xc2940fe0, 0x31f2b60f,
+0x83def7d2, 0x0e58247c, 0x2259e3c4, 0x940f01e6,
+0x83daf7c2, 0x085c247c, 0xfa6ef9c5, 0x0fc0940f,
+0xd3b8f8b6, 0xf7000002, 0x41e3c4df, 0xc501f722,
+0xc4e66cd9, 0xdc1865e3, 0x50fcc501, 0xfffa81d3,
+0x0f000000, 0x000a2a85, 0x69e2c400, 0xe0249440,
+0xc4000000, 0x8c4071e2, 0x0000f024, 0x6de3c400,
+0xc501f118, 0x24b47ffd, 0x00000080, 0xbc6ff9c5,
+0x00008024, 0x72e1c500, 0xf9c503f7, 0x9024bc6f,
+0xc5000000, 0x03f772d9, 0x1865e3c4, 0xf9c501dc,
+0xfdc5d87e, 0x40245c7f, 0xbc6ff9c5, 0x00008024,
+0x72e1c500, 0xf9c502f7, 0x9024bc6f, 0xc5000000,
+0x02f772d9, 0x1865e3c4, 0xfdc501dc, 0x60245c7f,
+0x7c6ff9c5, 0xc1c56024, 0xf9c5e7fe, 0x70247c6f,
+0xe27ef9c5, 0xc1c5d039, 0x940feffe, 0xc4c931c0,
+0xea1679e3, 0xc0b60f01, 0x1679e3c4, 0xd8f703ef,
+0xf86ef9c5, 0x1679e3c4, 0x443901e0, 0xe3c44424,
+0x02e01679, 0xf7c1940f, 0x244439d9, 0x41e3c448,
+0x0f01f922, 0xdb31c094, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d8, 0x3903e016, 0xc54c2444, 0x0fe87ef9,
+0xdbf7c394, 0x50244439, 0x2261e3c4, 0xc1c501db,
+0x940ffb6c, 0xc0b60fc0, 0x5439d8f7, 0x940f5424,
+0xf2b60fc2, 0x1679e3c4, 0xf9c502ea, 0xdef7e86e,
+0x0002f8b8, 0x24543900, 0x51e3c458, 0x0f01ee22,
+0xb60fc294, 0x39daf7d2, 0xc55c247c, 0x0fe26ef9,
+0xb60fc294, 0xc4dff7fa, 0xe72259e3, 0x6cd1c501,
+0x45e3c4e4, 0xc501fc18, 0x81d750fc, 0x0000fffa,
+0xcc850f00, 0xc5000008, 0x247c6ff9, 0x72e1c540,
+0xf9c502e7, 0x50247c6f, 0xe772d9c5, 0x65e3c402,
+0xc501dc18, 0x249c7ffd, 0x00000080, 0xbc6ff9c5,
+0x00008024, 0xfec1c500, 0x6ff9c5e7, 0x009024bc,
+0xf9c50000, 0x4439e07e, 0xc1c56024, 0xe3c4effe,
+0x01ea1679, 0x1679e3c4, 0x940f03ef, 0x0fc931c0,
+0xd8f7c0b6, 0xf86ef9c5, 0x1679e3c4, 0x443901e0,
+0xe3c46424, 0x02e01679, 0xf7c1940f, 0x244439d9,
+0x41e3c468, 0x0f01f922, 0xdb31c094, 0xf7c0b60f,
+0x6ef9c5d8, 0x79e3c4d8, 0x3903e016, 0xc56c2444,
+0x0fe87ef9, 0xdbf7c394, 0x70244439, 0x2261e3c4,
+0xc1c501db, 0x940ffb6c, 0xc0b60fc0, 0x5439d8f7,
+0x940f7424, 0xf2b60fc2, 0x1679e3c4, 0xf9c502ea,
+0xdef7e86e, 0x0002fdb8, 0x24543900, 0x51e3c478,
+0x0f01ee22, 0xb60fc294, 0x39daf7d2, 0xc57c247c,
+0x0fe26ef9, 0xb60fc294, 0xc4dff7fa, 0xe72259e3,
+0x6cd1c501, 0x45e3c4e4, 0xc501fc18, 0x81d750fc,
+0x0000fffa, 0xb8850f00, 0xc7000007, 0x033c2444,
+0xc5000000, 0xc5de6ff9, 0x24b47ffd, 0x00000080,
+0x3c24748b, 0xf9c5f789, 0xffc1e66e, 0x59e3c41f,
+0xc501e722, 0xc5ecf2c9, 0x24b46ff9, 0x00000090,
+0xe4f2c9c5, 0x1855e3c4, 0xf9c501e4, 0xfdc5e27e,
+0x4024647f, 0x3c2444c7, 0x00000002, 0x3c24748b,
+0xf9c5f789, 0xffc1e66e, 0x59e3c41f, 0xc501e722,
+0xc5dcf2e1, 0xc4e4f2c9, 0xdc1865e3, 0x7ffdc501,
+0xc560245c, 0x24746ff9, 0xfec9c560, 0x6ff9c5de,
+0xc5702474, 0x39d87ef9, 0xfec9c5c2, 0xc0940fee,
+0xb60fc931, 0x79e3c4f8, 0xf701d816, 0x244439df,
+0x79e3c444, 0x0f02d816, 0xd9f7c194, 0x48244439,
+0x31c0940f, 0xc0b60fdb, 0xf9c5d8f7, 0xe3c4e06e,
+0x03d81679, 0x4c244439, 0xe87ef9c5, 0xf7c3940f,
+0x244439db, 0x59e3c450, 0x0f01e322, 0xb60fc094,
+0xc5d8f7c0, 0xc4d86ef9, 0xe81679e3, 0x24443901,
+0x79e3c454, 0x0f03e816, 0xb60fc294, 0x79e3c4f2,
+0xf702ea16, 0x245439de, 0x61e3c458, 0x0f01de22,
+0xb60fc294, 0x39daf7d2, 0xc55c2444, 0x0ff26ef9,
+0xb60fc094, 0xc4d8f7c0, 0xe82249e3, 0x6ef9c501,
+0x6ce1c5f7, 0x49e3c4ed, 0xc501d922, 0xc4dc6ce1,
+0xdd1865e3, 0x50fcc501, 0xfffa81d3, 0xb8000000,
+0x00000310, 0x0659850f, 0x748b0000, 0xf9c53c24,
+0x4024746f, 0xf9c5f789, 0xffc1e66e, 0x59e3c41f,
+0xc501e722, 0xc5dce2c9, 0x24746ff9, 0xe2c9c550,
+0x65e3c4e4, 0xc501dc18, 0x249c7ffd, 0x00000080,
+0xb46ff9c5, 0x00008024, 0xfec9c500, 0x6ff9c5de,
+0x009024b4, 0xf9c50000, 0x4439d87e, 0xc9c56024,
+0x940feefe, 0x0fc931c0, 0xe3c4f8b6, 0x01d81679,
+0x4439dff7, 0xe3c46424, 0x02d81679, 0xff6ef9c5,
+0xf7c1940f, 0x244439d9, 0xc0940f68, 0xb60fdb31,
+0xc5d8f7c0, 0xc4e06ef9, 0xd81679e3, 0x24443903,
+0x7ef9c56c, 0xc3940fe8, 0x4439dbf7, 0xe3c47024,
+0x01e32259, 0x0fc0940f, 0xd8f7c0b6, 0xd86ef9c5,
+0x1679e3c4, 0x443901e8, 0xe3c47424, 0x03e81679,
+0x0fc2940f, 0xe3c4f2b6, 0x02ea1679, 0x5439def7,
+0xe3c47824, 0x01de2261, 0x0fc2940f, 0xdaf7d2b6,
+0x7c244439, 0xf26ef9c5, 0x0fc0940f, 0xd8f7c0b6,
+0x2249e3c4, 0xe1c501e8, 0xe3c4ed6c, 0x01d92241,
+0xdc6ce1c5, 0x1865e3c4, 0xfcc501dd, 0xfa81d350,
+0x000000ff, 0x000314b8, 0x34850f00, 0x31000005,
+0x7ef9c5db, 0x79e3c4d1, 0x8301d216, 0x010024bc,
+0xc4000000, 0xd01679e3, 0x79e3c402, 0x2c245416,
+0x7ef9c503, 0x79e3c4ce, 0x0f01cf16, 0xbc83cb4e,
+0x00010424, 0x4e0f0000, 0x24bc83d3, 0x00000108,
+0xc34e0f00, 0x28244489, 0x2c24448b, 0x0c24bc83,
+0x00000001, 0x83c34e0f, 0x011024bc, 0x89000000,
+0xc42c2444, 0xc81679e3, 0xf34e0f02, 0x1424bc83,
+0x00000001, 0xfe6ef9c5, 0x83fb4e0f, 0x011824bc,
+0x0f000000, 0xbc83c34e, 0x00011c24, 0x44890000,
+0xe3c42424, 0x03c81679, 0x2241e3c4, 0xf9c501cf,
+0x2424746e, 0xf96ef9c5, 0xc4d84f0f, 0xd32249e3,
+0x6ef9c501, 0xc5282474, 0xc4ca6cf1, 0x5c2249e3,
+0xc4012c24, 0xd22241e3, 0x6ce9c501, 0x6de3c4d3,
+0xc501d118, 0xc5ca6ff9, 0x24947ffd, 0x00000080,
+0x9ae8e98f, 0x01002494, 0xf9c50000, 0x1024b46f,
+0x8f000001, 0x9c9a48e9, 0x00009024, 0x6de3c400,
+0xc501d318, 0xc5d07ef9, 0x24547ffd, 0x24748b40,
+0x6ff9c514, 0x010024bc, 0xf9c50000, 0x1024b46f,
+0xc5000001, 0xf09e6ff9, 0xc5ffffff, 0xc5d3fac1,
+0xc4dbfac9, 0xd3186de3, 0x7ffdc501, 0x01002494,
+0xe98f0000, 0x248c9af0, 0x00000100, 0xbc6ff9c5,
+0x00011024, 0x40e98f00, 0x9024949a, 0xc4000000,
+0xda1875e3, 0xfef1c501, 0x7ffdc5c9, 0xc560245c,
+0x39ca7ef9, 0xfee9c5d0, 0xc0940fd2, 0xb60fc931,
+0x79e3c4f8, 0xf701c816, 0x244439df, 0x79e3c444,
+0xc502c816, 0x0ff76ef9, 0xd9f7c194, 0x48244439,
+0x31c0940f, 0xc0b60fdb, 0xf9c5d8f7, 0xe3c4d86e,
+0x03c81679, 0x4c244439, 0xd07ef9c5, 0xf7c3940f,
+0x244439db, 0x61e3c450, 0x0f01db22, 0xb60fc094,
+0xc5d8f7c0, 0xc4c86ef9, 0xd01679e3, 0x24443901,
+0xc0940f54, 0xb60fd231, 0x79e3c4f0, 0xf702d016,
+0x244439de, 0x79e3c458, 0xc403d016, 0xce2271e3,
+0xc2940f01, 0x4439daf7, 0xf9c55c24, 0x940fe26e,
+0xc2b60fc2, 0xe3c4d8f7, 0x01d02259, 0xca6cf1c5,
+0x2249e3c4, 0xe9c501d1, 0xe3c4d36c, 0x01c9186d,
+0xd150fcc5, 0x00fffa81, 0x2cb80000, 0x0f000003,
+0x0002ee85, 0xefe9c500, 0xfae9c5d2, 0x0100248c,
+0xe9c50000, 0x102494fa, 0x8f000001, 0x4c9a70e9,
+0xe98f6024, 0x24549a68, 0x7ef9c570, 0x248439c8,
+0x00000080, 0x1875e3c4, 0xfdc501da, 0x40245c7f,
+0x1679e3c4, 0x940f01d2, 0x0fc931c0, 0xe3c4f8b6,
+0x01c81679, 0x8439dff7, 0x00008424, 0x79e3c400,
+0xc502c816, 0x0ff76ef9, 0xd9f7c194, 0x88248439,
+0x0f000000, 0xdb31c094, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d8, 0x3903c816, 0x008c2484, 0xf9c50000,
+0x940fd07e, 0x39dbf7c3, 0x00902484, 0xe3c40000,
+0x01db2261, 0x0fc0940f, 0xd8f7c0b6, 0x94249439,
+0xc5000000, 0xb8f86ef9, 0x00000331, 0x0fc2940f,
+0xe3c4f2b6, 0x02d21679, 0x9439def7, 0x00009824,
+0xc2940f00, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4ca,
+0x3903d216, 0x009c2494, 0x940f0000, 0xd2b60fc2,
+0xe3c4daf7, 0x01d22271, 0x2241e3c4, 0xf1c501ce,
+0xe3c4ca6c, 0x01d12249, 0xd36ce9c5, 0x186de3c4,
+0xfcc501c9, 0xfa81d150, 0x000000ff, 0x01d1850f,
+0xc0310000, 0x8c6ffdc5, 0x0000a024, 0x6ffdc500,
+0x00c024a4, 0x01a80000, 0xd46ffdc5, 0xfdc50475,
+0xfdc5d16f, 0x2024947f, 0x8b000001, 0x01208494,
+0x54890000, 0x83406084, 0xda7508f8, 0xbc83c031,
+0x0000e024, 0x9f0f0000, 0xf7c931c0, 0x24bc83d8,
+0x000000e4, 0x6ef9c500, 0xc19f0fd0, 0xd9f7c031,
+0xe824bc83, 0x00000000, 0x2269e3c4, 0x9f0f01d1,
+0xf7db31c0, 0x24bc83d8, 0x000000ec, 0x6ef9c500,
+0xc39f0fe8, 0xdbf7c031, 0xf024bc83, 0x00000000,
+0x2251e3c4, 0xe9c501eb, 0x9f0fd56c, 0x83d8f7c0,
+0x00f424bc, 0x0f000000, 0xb60fc29f, 0xf7d231f2,
+0x24bc83de, 0x000000f8, 0xc29f0f00, 0xbc83daf7,
+0x0000fc24, 0xf9c50000, 0x9f0ffa6e, 0x0f2c2444,
+0x2c247cb6, 0xe3c4dff7, 0x01f72241, 0xf86ef9c5,
+0x2241e3c4, 0xe1c501de, 0xe3c4de6c, 0x01d3186d,
+0xa274e88f, 0xf9c520cc, 0x4439c87e, 0x940f6024,
+0x0fc931c0, 0xd8f7c0b6, 0xd06ef9c5, 0x1679e3c4,
+0x443901c8, 0xe3c46424, 0x02c81679, 0xf7c1940f,
+0x244439d9, 0x69e3c468, 0x0f01d122, 0xdb31c094,
+0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4d8, 0x3903c816,
+0xc46c2444, 0xc9197de3, 0x7ef9c501, 0xc3940fc8,
+0x4439dbf7, 0xe3c47024, 0x01db2261, 0xd36ce9c5,
+0x0fc0940f, 0xd8f7c0b6, 0xe3c4c789, 0x01c81679,
+0x74244439, 0xf76ef9c5, 0x31c0940f, 0xf0b60fd2,
+0x1679e3c4, 0xdef702c8, 0x78244439, 0x1679e3c4,
+0xe3c403c8, 0x01ce2249, 0xf7c2940f, 0x244439da,
+0x6ef9c57c, 0xc2940fe2, 0xbac2b60f, 0x00000000,
+0xe3c4d8f7, 0x01e02259, 0xcc6cf1c5, 0x186de3c4,
+0xfcc501c9, 0xff3dc150, 0xb8000000, 0x000003c4,
+0x8dc2440f, 0x5e5bf465, 0x8bc35d5f, 0x00c32404,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x00000000, 0x00000000,
+0010134,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u4[] = {
+0xba5500eb, 0x00000020, 0xc031e589, 0x0009bf57,
+0x53560000, 0x81e0e483, 0x000140ec, 0x89c38900,
+0x40d989fe, 0x2901e183, 0xd88549c6, 0x894a0175,
+0x009c8484, 0xf8830000, 0x84b48908, 0x000000bc,
+0xdc848c89, 0x89000000, 0x00fc8494, 0xcd750000,
+0xb46ffdc5, 0x0000a024, 0x7ffdc500, 0x8b402474,
+0x39402444, 0x00a02484, 0x5c8b0000, 0x940f4424,
+0x0fc931c0, 0xd8f7c0b6, 0xa4249c3b, 0xc5000000,
+0x8bc86ef9, 0x0f482444, 0xd9f7c194, 0xa824843b,
+0xc4000000, 0xc92271e3, 0x24448901, 0xc0940f2c,
+0xf7c0b60f, 0x6ef9c5d8, 0x24448bd8, 0x24843b4c,
+0x000000ac, 0x28244489, 0x0fc0940f, 0x448bf0b6,
+0xdef75024, 0xb024843b, 0xc4000000, 0xde2261e3,
+0x6cf1c501, 0x244489cb, 0xc0940f24, 0xf7c0b60f,
+0x6ef9c5d8, 0x24448bd0, 0x24843b54, 0x000000b4,
+0x20244489, 0x8bc2940f, 0x0f582444, 0xd231fab6,
+0x843bdff7, 0x0000b824, 0x69e3c400, 0x8901d722,
+0x8b1c2444, 0x0f5c2444, 0xdaf7c294, 0xbc24843b,
+0xc5000000, 0x89fa6ef9, 0x0f182444, 0xb60fc094,
+0xc4d8f7c0, 0xe02241e3, 0x6ce9c501, 0x75e3c4d4,
+0xc501ca18, 0x81d150fc, 0x0000fffa, 0x0260b800,
+0x850f0000, 0x00000d31, 0x746ff9c5, 0xf9c54024,
+0x50247c6f, 0x8cfec9c5, 0x0000a024, 0xfec1c500,
+0x00b02494, 0xe3c40000, 0x01ca1875, 0x4c7ffdc5,
+0xf9c56024, 0xa024b46f, 0xc5000000, 0x01f672e9,
+0xbc6ff9c5, 0x0000b024, 0x7ef9c500, 0x244439d0,
+0x79e3c460, 0xc501d216, 0x01f772e1, 0x1679e3c4,
+0x940f01df, 0x0fc931c0, 0xd8f7c0b6, 0x64245439,
+0x1679e3c4, 0xf9c502d2, 0x940fc86e, 0x39d9f7c1,
+0xc4682454, 0xc92271e3, 0xc0940f01, 0xf7d0b60f,
+0x6ef9c5da, 0x79e3c4e2, 0x3903d216, 0x0f6c2454,
+0xb60fc294, 0x7ef9c5f2, 0x39def7da, 0xc4702454,
+0xe62259e3, 0x6cf1c501, 0xc0940fcc, 0xc4d0b60f,
+0xd81679e3, 0x39daf703, 0xc574247c, 0x0fd26ef9,
+0xb60fc294, 0x79e3c4fa, 0xf702da16, 0x245439df,
+0x69e3c478, 0x0f01d722, 0xb60fc294, 0x39daf7d2,
+0xc57c2444, 0x0ff26ef9, 0xb60fc094, 0xc4d8f7c0,
+0xd82249e3, 0x6ce9c501, 0x75e3c4d3, 0xc501ca18,
+0x81d150fc, 0x0000fffa, 0x0266b800, 0x850f0000,
+0x00000c15, 0x7c6ff9c5, 0xf9c56024, 0x7024746f,
+0x8cfac1c5, 0x0000a024, 0xfac9c500, 0x00b02494,
+0xe3c40000, 0x01ca1875, 0x8c7ffdc5, 0x00008024,
+0x24848b00, 0x00000080, 0x40244439, 0x2c24748b,
+0x24247c8b, 0x31c0940f, 0xc0b60fd2, 0x9c3bd8f7,
+0x00008424, 0x6ef9c500, 0x026bb8f0, 0x940f0000,
+0xf7c931c2, 0x24b43bda, 0x00000088, 0x2824748b,
+0xf7c1940f, 0x24b43bd9, 0x0000008c, 0xe16ef9c5,
+0x0fc3940f, 0xdb31f3b6, 0xbc3bdef7, 0x00009024,
+0x59e3c400, 0x8b01e622, 0x0f20247c, 0xdbf7c394,
+0x9424bc3b, 0xc5000000, 0x8bdb6ef9, 0x0f1c245c,
+0xb60fc194, 0x244c8bf9, 0x3bdff718, 0x0098249c,
+0xe3c40000, 0x01df2261, 0x0fc3940f, 0xdbf7dbb6,
+0x9c248c3b, 0xc5000000, 0x0ffb6ef9, 0xb60fc194,
+0xc4d9f7c9, 0xd12241e3, 0x6ce1c501, 0x49e3c4da,
+0xc501d222, 0xc4d46ce9, 0xd3186de3, 0x50fcc501,
+0xfffa81d2, 0x0f000000, 0x000b0c85, 0x6ffdc500,
+0xc540247c, 0x249456c4, 0x000000c0, 0x547ffdc5,
+0xf4c54024, 0xc0248c54, 0xc5000000, 0x24b46ffd,
+0x00000080, 0x9457ccc5, 0x0000c024, 0x7ef9c500,
+0x7ffdc5d0, 0x00802494, 0xf4c50000, 0x40244c55,
+0xca7ef9c5, 0x940fd039, 0x0fc931c0, 0xd8f7c0b6,
+0xd06ef9c5, 0x1679e3c4, 0x843901c8, 0x00008424,
+0x79e3c400, 0x0f02c816, 0xd9f7c194, 0x88248439,
+0xc4000000, 0xd12269e3, 0xc0940f01, 0xb60fdb31,
+0xc5d8f7c0, 0xc4d86ef9, 0xc81679e3, 0x24843903,
+0x0000008c, 0x197de3c4, 0xf9c501c9, 0x940fc87e,
+0x39dbf7c3, 0x00902484, 0xe3c40000, 0x01db2261,
+0xd36ce9c5, 0x0fc0940f, 0xd8f7c0b6, 0xe3c4c789,
+0x01c81679, 0x94248439, 0xc5000000, 0x0fff6ef9,
+0xd231c094, 0xc4f0b60f, 0xc81679e3, 0x39def702,
+0x00982484, 0xe3c40000, 0x03c81679, 0x2241e3c4,
+0x940f01ce, 0x39daf7c2, 0x009c2484, 0xf9c50000,
+0x940fe26e, 0xc2b60fc2, 0xe3c4d8f7, 0x01e02259,
+0xcc6cf1c5, 0x186de3c4, 0xfcc501c9, 0xfa81d150,
+0x000000ff, 0x000277b8, 0xda850f00, 0xc5000009,
+0x24b46ff9, 0x000000a0, 0xbc6ff9c5, 0x0000b024,
+0x49e2c400, 0xc0248c40, 0xc4000000, 0x944041e2,
+0x0000d024, 0x75e3c400, 0xc501ca18, 0xc5c87ef9,
+0x244c7ffd, 0x08f88340, 0x31c0940f, 0xc0b60fc9,
+0x7c83d8f7, 0xc50e4424, 0x0fd06ef9, 0xc031c194,
+0x7c83d9f7, 0xc4124824, 0xd12269e3, 0xc0940f01,
+0xd8f7db31, 0x4c247c83, 0x6ef9c514, 0xc3940fd8,
+0xdbf7c031, 0x50247c83, 0x61e3c414, 0xc501db22,
+0x0fd36ce9, 0xd8f7c094, 0x54247c83, 0x6ef9c512,
+0x02d3b8f8, 0x940f0000, 0xf2b60fc2, 0xdef7d231,
+0x58247c83, 0x41e3c40e, 0x0f01ce22, 0xdaf7c294,
+0x5c247c83, 0x6ef9c508, 0x44940ff2, 0xb60f2c24,
+0xf72c247c, 0x49e3c4df, 0xc501e722, 0xc4cc6cf1,
+0xc9186de3, 0x50fcc501, 0xfffa81d1, 0x0f000000,
+0x0008f485, 0x6ffdc500, 0x00a0249c, 0xfdc50000,
+0x80249c7f, 0xc5000000, 0x24b46ff9, 0x00000080,
+0xbc6ff9c5, 0x00009024, 0x72f1c500, 0xe9c503f6,
+0xc403f772, 0xca1875e3, 0x7ef9c501, 0x7ffdc5c8,
+0xc540244c, 0x24b46ff9, 0x00000080, 0xbc6ff9c5,
+0x00009024, 0x72f1c500, 0xe9c502f6, 0xc402f772,
+0xca1875e3, 0x7ffdc501, 0xc560244c, 0x24746ff9,
+0xfec9c560, 0x6ff9c5ce, 0xc570247c, 0x39ca7ef9,
+0xfec1c5d0, 0xc0940fef, 0xe3c4c931, 0x01ea1679,
+0xc4c0b60f, 0xef1679e3, 0xc5d8f703, 0xc4d06ef9,
+0xc81679e3, 0x24443901, 0x79e3c444, 0x0f02c816,
+0xd9f7c194, 0x48244439, 0x2269e3c4, 0x940f01d1,
+0x0fdb31c0, 0xd8f7c0b6, 0xe06ef9c5, 0x1679e3c4,
+0x443903c8, 0xf9c54c24, 0x940fe87e, 0x39dbf7c3,
+0xc4502444, 0xe32259e3, 0x6ce9c501, 0xc0940fd4,
+0xf7c0b60f, 0x245439d8, 0x6ef9c554, 0x02f8b8f8,
+0x940f0000, 0xf2b60fc2, 0x1679e3c4, 0xdef702ea,
+0x58245439, 0x2241e3c4, 0x940f01ce, 0xd2b60fc2,
+0x7c39daf7, 0xf9c55c24, 0x940ff26e, 0x0f2c2444,
+0x2c247cb6, 0xe3c4dff7, 0x01ef2249, 0xcd6cf1c5,
+0x186de3c4, 0xfcc501c9, 0xfa81d150, 0x000000ff,
+0x07a3850f, 0xf9c50000, 0x4024746f, 0x7c6ff9c5,
+0xf1c55024, 0xc502d672, 0x02d772e9, 0x1875e3c4,
+0xfdc501ca, 0x80248c7f, 0xc5000000, 0x24b46ff9,
+0x00000080, 0xcefec9c5, 0xbc6ff9c5, 0x00009024,
+0x7ef9c500, 0x244439c8, 0xfec1c560, 0x79e3c4ef,
+0xc401ea16, 0xef1679e3, 0xc0940f03, 0xb60fc931,
+0xc5d8f7c0, 0xc4d06ef9, 0xc81679e3, 0x24443901,
+0x79e3c464, 0x0f02c816, 0xd9f7c194, 0x68244439,
+0x2269e3c4, 0x940f01d1, 0x0fdb31c0, 0xd8f7c0b6,
+0xe06ef9c5, 0x1679e3c4, 0x443903c8, 0xf9c56c24,
+0x940fe87e, 0x39dbf7c3, 0xc4702444, 0xe32259e3,
+0x6ce9c501, 0xc0940fd4, 0xf7c0b60f, 0x245439d8,
+0x6ef9c574, 0x02fdb8f8, 0x940f0000, 0xf2b60fc2,
+0x1679e3c4, 0xdef702ea, 0x78245439, 0x2241e3c4,
+0x940f01ce, 0xd2b60fc2, 0x7c39daf7, 0xf9c57c24,
+0x940ff26e, 0x0f2c2444, 0x2c247cb6, 0xe3c4dff7,
+0x01ef2249, 0xcd6cf1c5, 0x186de3c4, 0xfcc501c9,
+0xfa81d150, 0x000000ff, 0x068b850f, 0x44c70000,
+0x00033c24, 0xfdc50000, 0x80249c7f, 0xc5000000,
+0x24646ef9, 0x6ff9c53c, 0x009024b4, 0xe1c50000,
+0xc9c5d4f2, 0xe3c4e4f2, 0x01d4186d, 0xd07ef9c5,
+0x547ffdc5, 0x44c74024, 0x00023c24, 0xf9c50000,
+0x3c24546e, 0xcaf2e1c5, 0xd2f2c9c5, 0x1875e3c4,
+0xfdc501ca, 0x60244c7f, 0x6c6ff9c5, 0xd1c56024,
+0xf9c5cdfe, 0x7024746f, 0xca7ef9c5, 0xc9c5d039,
+0x940feefe, 0xc4c931c0, 0xea1679e3, 0xc0b60f01,
+0x1679e3c4, 0xd8f703ef, 0xd06ef9c5, 0x1679e3c4,
+0x443901c8, 0xe3c44424, 0x02c81679, 0xf7c1940f,
+0x244439d9, 0x69e3c448, 0x0f01d122, 0xdb31c094,
+0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4e0, 0x3903c816,
+0xc54c2444, 0x0fe87ef9, 0xdbf7c394, 0x50244439,
+0x2259e3c4, 0xe9c501e3, 0x940fd46c, 0xc0b60fc0,
+0x5439d8f7, 0xf9c55424, 0x10b8f06e, 0x0f000003,
+0xb60fc294, 0x79e3c4f2, 0xf702ea16, 0x245439de,
+0x49e3c458, 0x0f01ce22, 0xb60fc294, 0x39daf7d2,
+0xc55c247c, 0x0ffa6ef9, 0x2c244494, 0x247cb60f,
+0xc4dff72c, 0xef2241e3, 0x6cf1c501, 0x6de3c4cd,
+0xc501c918, 0x81d150fc, 0x0000fffa, 0x46850f00,
+0xc5000005, 0x24546ef9, 0x6ff9c53c, 0xc540246c,
+0x247c6ff9, 0xd2d1c550, 0xd2c1c5ca, 0x75e3c4d2,
+0xc501ca18, 0x248c7ffd, 0x00000080, 0xac6ff9c5,
+0x00008024, 0xfed1c500, 0x6ff9c5cd, 0x009024b4,
+0xf9c50000, 0x4439c87e, 0xc9c56024, 0xe3c4eefe,
+0x01ea1679, 0x1679e3c4, 0x940f03ef, 0x0fc931c0,
+0xd8f7c0b6, 0xd06ef9c5, 0x1679e3c4, 0x443901c8,
+0xe3c46424, 0x02c81679, 0xf7c1940f, 0x244439d9,
+0x69e3c468, 0x0f01d122, 0xdb31c094, 0xf7c0b60f,
+0x6ef9c5d8, 0x79e3c4e0, 0x3903c816, 0xc56c2444,
+0x0fe87ef9, 0xdbf7c394, 0x70244439, 0x2259e3c4,
+0xe9c501e3, 0x940fd46c, 0xc0b60fc0, 0x5439d8f7,
+0xf9c57424, 0x14b8f06e, 0x0f000003, 0xb60fc294,
+0x79e3c4f2, 0xf702ea16, 0x245439de, 0x49e3c478,
+0x0f01ce22, 0xb60fc294, 0x39daf7d2, 0xc57c247c,
+0x0ffa6ef9, 0x2c244494, 0x247cb60f, 0xc4dff72c,
+0xef2241e3, 0x6cf1c501, 0x6de3c4cd, 0xc501c918,
+0x81d150fc, 0x0000fffa, 0x2a850f00, 0x8b000004,
+0x01002484, 0xb48b0000, 0x00010824, 0x24bc8b00,
+0x00000110, 0xc019d8f7, 0xd06ef9c5, 0x0424848b,
+0xf7000001, 0xf7c019d8, 0xc4f619de, 0xd02269e3,
+0x6ef9c501, 0x24b48be6, 0x0000010c, 0xd219def7,
+0xbc8bdff7, 0x00011424, 0xc4f61900, 0xe22259e3,
+0x6ce9c501, 0x6ef9c5d4, 0x24b48bce, 0x00000118,
+0xc919dff7, 0xb48bdef7, 0x00011c24, 0x71e3c400,
+0x1901c922, 0x6ef9c5ff, 0x19def7ef, 0x51e3c4db,
+0xc501eb22, 0xc4cd6cf1, 0xd1186de3, 0x54ecc501,
+0x6ff9c5d3, 0x7ffdc5ca, 0x00802494, 0xe98f0000,
+0x24949ae8, 0x00000100, 0xac6ff9c5, 0x00011024,
+0x50e98f00, 0x9024a49a, 0xc4000000, 0xd4186de3,
+0x7ef9c501, 0x7ffdc5d0, 0xc5402454, 0xc5d276e9,
+0x24a4fee9, 0x00000100, 0x94fee9c5, 0x00011024,
+0x5de3c400, 0xc501d218, 0x24947ffd, 0x00000100,
+0x9af0e98f, 0x0100248c, 0xf9c50000, 0x1024bc6f,
+0x8f000001, 0x949a40e9, 0x00009024, 0x75e3c400,
+0xc501e218, 0xc5c9fef1, 0xc5d2fee9, 0x39ca7ef9,
+0x7ffdc5d0, 0x0f602464, 0xd231c094, 0xc4f0b60f,
+0xc81679e3, 0x39def701, 0xc4442444, 0xc81679e3,
+0x6ef9c502, 0xc2940ff6, 0x4439daf7, 0x940f4824,
+0x0fc931c0, 0xe3c4f8b6, 0x03c81679, 0x4439dff7,
+0xf9c54c24, 0xf9c5d07e, 0x940fef6e, 0x39d9f7c1,
+0x0f502444, 0xdb31c094, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4c8, 0x3901d016, 0xc4542444, 0xd01679e3,
+0xc3940f02, 0x4439dbf7, 0xe3c45824, 0x01cb2271,
+0x0fc0940f, 0xd8f7c0b6, 0xe06ef9c5, 0x1679e3c4,
+0x443903d0, 0x940f5c24, 0xc0b60fc0, 0xe3c4d8f7,
+0x01d02259, 0x2251e3c4, 0xf1c501e1, 0xe3c4ca6c,
+0x01d22249, 0xd46ce9c5, 0x186de3c4, 0xfcc501c9,
+0xfa81d150, 0x000000ff, 0x00032cb8, 0x36850f00,
+0xc5000002, 0xc5d2efe9, 0x248cfae9, 0x00000100,
+0x94fae9c5, 0x00011024, 0x70e98f00, 0x60244c96,
+0x9668e98f, 0xc5702464, 0x39c87ef9, 0x00802484,
+0xe3c40000, 0x01ca1679, 0x1875e3c4, 0xfdc501d4,
+0x4024547f, 0x1679e3c4, 0x940f03e7, 0x0fc931c0,
+0xd8f7c0b6, 0x84249439, 0xc4000000, 0xca1679e3,
+0x6ef9c502, 0x0331b8f8, 0x940f0000, 0x39d9f7c1,
+0x00882494, 0x940f0000, 0x0fdb31c2, 0xdaf7d2b6,
+0xd26ef9c5, 0x1679e3c4, 0x943903ca, 0x00008c24,
+0x7ef9c500, 0xc3940fe2, 0x9439dbf7, 0x00009024,
+0xc2940f00, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4ca,
+0x3901e216, 0x00942494, 0x940f0000, 0xf2b60fc2,
+0x1679e3c4, 0xdef702e2, 0x98249439, 0xc4000000,
+0xce2271e3, 0xc2940f01, 0xf7d2b60f, 0x24bc39da,
+0x0000009c, 0xea6ef9c5, 0x0fc2940f, 0xdff7fab6,
+0x2251e3c4, 0xf1c501e7, 0xe3c4cc6c, 0x01e32269,
+0x2241e3c4, 0xe9c501d1, 0xe3c4d46c, 0x01d1186d,
+0xd250fcc5, 0x00fffa81, 0x850f0000, 0x00000119,
+0xfdc5c031, 0xc0248c6f, 0xa8000000, 0x6ffdc501,
+0xc50475d1, 0xc5d36ffd, 0x24947ffd, 0x00000120,
+0x2084948b, 0x89000001, 0x40608454, 0x7508f883,
+0xe4e88fda, 0xe0248ca2, 0x10000000, 0xc87ef9c5,
+0x60244439, 0x31c0940f, 0xc0b60fc9, 0xf9c5d8f7,
+0xe3c4d06e, 0x01c81679, 0x64244439, 0x1679e3c4,
+0x940f02c8, 0x39d9f7c1, 0xc4682444, 0xd12269e3,
+0xc0940f01, 0xb60fdb31, 0xc5d8f7c0, 0xc4d86ef9,
+0xc81679e3, 0x24443903, 0x7de3c46c, 0xc501c919,
+0x0fc87ef9, 0xdbf7c394, 0x70244439, 0x2261e3c4,
+0xe9c501db, 0x940fd36c, 0xc0b60fc0, 0xc789d8f7,
+0x1679e3c4, 0x443901c8, 0xf9c57424, 0x940fef6e,
+0x0fd231c0, 0xe3c4f0b6, 0x02c81679, 0x4439def7,
+0xe3c47824, 0x03c81679, 0x2251e3c4, 0x940f01ce,
+0x39daf7c2, 0xc57c2444, 0x0fe26ef9, 0xb60fc294,
+0x0000bac2, 0xd8f70000, 0x2259e3c4, 0xf1c501e0,
+0xe3c4cc6c, 0x01c9186d, 0xc150fcc5, 0x0000ff3d,
+0x03c4b800, 0x440f0000, 0xf4658dc2, 0x5d5f5e5b,
+0x000000c3,
+0007221,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0x61e85657,
+0x81000014, 0x0014adc6, 0xe4835300, 0x60ec81e0,
+0xc7000001, 0x40302444, 0x89000000, 0xb9402444,
+0x00000005, 0x788ddb31, 0x89c129ff, 0x1928244c,
+0xffc983d3, 0x2c245c89, 0xcb8901a8, 0x01b90774,
+0x31000000, 0x247c85db, 0xff047540, 0x8b30244c,
+0xc540247c, 0x247c7efa, 0xfc848928, 0x000000b8,
+0xbcd6f9c5, 0x0000d8fc, 0x6ef9c500, 0xfc9489f9,
+0x000000bc, 0xe3c4c931, 0x01fb2241, 0x8901c083,
+0xd6f9c5fb, 0x00f8fcbc, 0x8c890000, 0x00011cdc,
+0x247c8b00, 0x83c18930, 0xf18300d2, 0x89d10905,
+0x0118dcbc, 0x850f0000, 0xffffff6f, 0xbc6ffdc5,
+0x0000c024, 0x7ffdc500, 0x3160247c, 0x7efac5c0,
+0xc5602454, 0x248c7efa, 0x000000c0, 0xcaeff1c5,
+0xc96cf1c5, 0x1779e2c4, 0xc0940fc9, 0xfac5d231,
+0x6824547e, 0xfac5d8f7, 0xc8248c7e, 0xc5000000,
+0x89caeff1, 0x83282444, 0xc03100d2, 0xf1c5daf7,
+0xe2c4c96c, 0xc5c91779, 0x244c7efa, 0x7ff9c570,
+0xc530244c, 0x248c7efa, 0x000000d0, 0x4ceff1c5,
+0xf1c53024, 0x5489c96c, 0x940f2c24, 0xc5db31c0,
+0x24547ff9, 0xf7c18940, 0x00d383d9, 0xdbf7c031,
+0x1779e2c4, 0xc0940fc9, 0xd8f7d231, 0x4c7efac5,
+0x44897824, 0xd2832024, 0xf7c03100, 0x6ff9c5da,
+0x7efac5f9, 0x00d8248c, 0xc1c50000, 0xf1c5c9ef,
+0xe2c4c96c, 0x89c91779, 0x0f242454, 0xd231c094,
+0xfac5d8f7, 0x2024747e, 0x20244489, 0xb800d283,
+0x00000260, 0x5489daf7, 0xc8c52424, 0x20245c16,
+0x747efac5, 0x4c892824, 0x5c892824, 0xc8c52c24,
+0x28244c16, 0x1875e3c4, 0xfdc501cb, 0xfa83d150,
+0x95850f0f, 0xc5000012, 0x244c6ff9, 0x6ff9c560,
+0xc5702464, 0x249cd4f1, 0x000000c0, 0xacd4d9c5,
+0x0000d024, 0x65e3c400, 0xc501dd18, 0x249c7ffd,
+0x00000080, 0xb46ff9c5, 0x0000c024, 0x73c9c500,
+0xfac501f6, 0x8024947e, 0xc5000000, 0xc5f07ef9,
+0x31d86ef9, 0x79e3c4c0, 0xc401f216, 0xda2261e3,
+0xefe1c501, 0x6ce1c5da, 0x79e2c4db, 0x940fdb17,
+0xf7d231c0, 0x17f8c5d8, 0x89282474, 0x83202444,
+0xc03100d2, 0x5c6ef9c5, 0xdaf72824, 0x2261e3c4,
+0x012c245c, 0xb47efac5, 0x00008824, 0xefe1c500,
+0x6ce1c5de, 0x79e2c4db, 0xf9c5db17, 0xd024ac6f,
+0x89000000, 0x0f242454, 0xd1c5c094, 0xc501f573,
+0x24b47efa, 0x00000090, 0xdb31c189, 0xe87ef9c5,
+0xf9c5d9f7, 0xe3c4d86e, 0x01ea1679, 0x3100d383,
+0x61e3c4c0, 0xf701da22, 0xefe1c5db, 0x6ce1c5de,
+0x79e2c4db, 0x940fdb17, 0xf7d231c0, 0x17f8c5d8,
+0xc528246c, 0x24ac7efa, 0x00000098, 0x18244489,
+0x3100d283, 0xc5daf7c0, 0x245c6ef9, 0x61e3c428,
+0x2c245c22, 0xefe1c501, 0x6ce1c5dd, 0x79e2c4db,
+0x5489db17, 0x940f1c24, 0xf7d231c0, 0x7efac5d8,
+0x89182474, 0x83282444, 0x66b800d2, 0xf7000002,
+0x245489da, 0x16c8c52c, 0x8928246c, 0xc528244c,
+0x24747efa, 0x245c8920, 0x16c8c52c, 0xc428245c,
+0xdd1865e3, 0x50fdc501, 0x0ffa83d3, 0x111a850f,
+0xf9c50000, 0x8024b46f, 0xc5000000, 0x249cfbc9,
+0x000000c0, 0xb46ff9c5, 0x00009024, 0xfbc9c500,
+0x00d024ac, 0xe3c40000, 0x01dd1865, 0x9c7ffdc5,
+0x0000a024, 0xc5c03100, 0x245c7efa, 0x7efac560,
+0x00a024ac, 0xe1c50000, 0xe1c5ddef, 0xe2c4db6c,
+0x0fdb1779, 0xd231c094, 0x9c7efac5, 0x0000a824,
+0xc5d8f700, 0x2454efe1, 0x6ce9c540, 0x244489d2,
+0x00d28328, 0xdaf7c031, 0x1779e2c4, 0xc0940fd2,
+0x947efac5, 0x0000b024, 0xefe9c500, 0xc5302454,
+0x89d26ce9, 0x892c2454, 0xf7db31c1, 0x00d383d9,
+0xdbf7c031, 0x1779e2c4, 0xc0940fd2, 0xd8f7d231,
+0x947efac5, 0x0000b824, 0x24448900, 0x00d28340,
+0xdaf7c031, 0xd2efc1c5, 0xd26ce9c5, 0x1779e2c4,
+0x245489d2, 0xc0940f44, 0xd8f7d231, 0x7c7efac5,
+0x44894024, 0xd2834024, 0x026bb800, 0xdaf70000,
+0x44245489, 0x5c16c0c5, 0x4c894024, 0xfac54024,
+0x28247c7e, 0x44245c89, 0x5416c0c5, 0xe3c44024,
+0x01d3186d, 0xd250fdc5, 0x0f0ffa83, 0x000ffb85,
+0x70f9c500, 0xe2c4b1d1, 0x24944069, 0x000000c0,
+0x8cf4f1c5, 0x0000c024, 0x78e98f00, 0xe9c5d2cb,
+0xc520f273, 0xc5cad4f1, 0xb1d470f9, 0x4069e2c4,
+0x00d02494, 0xd9c50000, 0xd024a4f4, 0x8f000000,
+0xd2cb78e9, 0xf273e9c5, 0xd4d9c520, 0x6ff9c5e2,
+0x00f02494, 0xe3c40000, 0x01cc1875, 0xd96ff9c5,
+0x4c7ffdc5, 0xf9c56024, 0xe0248c6f, 0xc5000000,
+0xb1e170f9, 0x4059e2c4, 0x78e98fe1, 0xf1c5e4cb,
+0xd9c5c9f4, 0xc520f473, 0xc5ccd4f1, 0xb1e270f9,
+0x4059e2c4, 0x78e98fe2, 0xe9c5e4cb, 0xd9c5d2f4,
+0xc520f473, 0xc4d4d4e9, 0xca1875e3, 0x6ff9c501,
+0x7ffdc5f9, 0x0080248c, 0xf9c50000, 0xc024946f,
+0xc5000000, 0x248c6ff9, 0x000000d0, 0xa4d4e9c5,
+0x0000e024, 0xd4f1c500, 0x00f024ac, 0xe3c40000,
+0x01e5185d, 0xec6ff9c5, 0xa47ffdc5, 0x0000a024,
+0xfbe9c500, 0x00e024b4, 0xe1c50000, 0xf9c5dffb,
+0x70247c6f, 0xd97ef9c5, 0x1679e3c4, 0xf9c501db,
+0xc4b1e670, 0xe54059e2, 0xf5f4c9c5, 0xcb78e98f,
+0xfbf1c5e4, 0x00f024ac, 0xd9c50000, 0xc520f473,
+0xc5f4d4c9, 0xc4f07ef9, 0xf21679e3, 0x31c83101,
+0x17f8c5da, 0xc5302474, 0xb1e570f9, 0x4059e2c4,
+0x00b024a4, 0xd0090000, 0xacf4d1c5, 0x0000b024,
+0xc0940f00, 0x31c0b60f, 0x8fd8f7d2, 0xe4cb78e9,
+0xf473d9c5, 0x24448920, 0x00d28340, 0x3024448b,
+0xd1c5daf7, 0x5489ecd4, 0x548b4424, 0xf8c53424,
+0x30245c17, 0x30244433, 0x6c17f8c5, 0x54332024,
+0xc1c53424, 0x9024a4fb, 0x09000000, 0xc0940fd0,
+0xf9c5d231, 0xb60fe17e, 0x79e3c4c0, 0xf701e316,
+0x244489d8, 0x00d28330, 0xe87ef9c5, 0xc831daf7,
+0x34245489, 0x1679e3c4, 0xda3101ea, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x28244489, 0x8b00d283,
+0xf7202444, 0x245489da, 0x24548b2c, 0x17f8c524,
+0x33202464, 0xc5202444, 0x247c7efa, 0x24543328,
+0x0fd00924, 0xd231c094, 0xf7c0b60f, 0x244489d8,
+0x00d28328, 0x000282b8, 0x89daf700, 0xc52c2454,
+0x246416c0, 0x7efac528, 0xc540247c, 0x245c16c0,
+0x65e3c430, 0xc501dc18, 0x83d350fd, 0x850f0ffa,
+0x00000da8, 0xe270f9c5, 0x59e2c4b1, 0xe0249c40,
+0xc5000000, 0x24acf4e9, 0x000000e0, 0xcb78e98f,
+0x73e1c5db, 0xd1c520f3, 0xf9c5ebd4, 0xc4b1d970,
+0xb44061e2, 0x0000f024, 0x78e98f00, 0xc1c5f6cb,
+0xc520f673, 0x24b4f4f1, 0x000000f0, 0xf7d4c9c5,
+0x1855e3c4, 0xf9c501ee, 0xe3c4e87e, 0x01ea1679,
+0x6c7ffdc5, 0xf0836024, 0x6ff9c504, 0xffffe0b6,
+0x7efac5ff, 0x0968246c, 0xefd1c5d0, 0x6cd1c5ee,
+0xc0940fed, 0xb60fd231, 0x89d8f7c0, 0x83402444,
+0xc03100d2, 0xe2c4daf7, 0x0fed1779, 0xfac5c094,
+0x70246c7e, 0xeeefd1c5, 0xed6cd1c5, 0x44245489,
+0xdb31c189, 0xf9c5d9f7, 0xfff0b66f, 0xd383ffff,
+0xf7c03100, 0x79e2c4db, 0x940fed17, 0xf7d231c0,
+0x7efac5d8, 0x8978246c, 0x83302444, 0xc03100d2,
+0xd1c5daf7, 0xd1c5eeef, 0xe2c4ed6c, 0x89ed1779,
+0x0f342454, 0xd231c094, 0xfac5d8f7, 0x30247c7e,
+0x30244489, 0xb800d283, 0x000002d3, 0x5489daf7,
+0xc0c53424, 0x30247416, 0x7c7efac5, 0x4c894024,
+0x5c894024, 0xc0c54424, 0x40246c16, 0x1855e3c4,
+0xfdc501ee, 0xfa83d550, 0x6d850f0f, 0xc400000c,
+0xa44059e2, 0x00010024, 0x61e2c400, 0x10249c40,
+0xc5000001, 0x2494f4e9, 0x00000100, 0x8cf4f1c5,
+0x00011024, 0x78e98f00, 0xd9c5e4cb, 0x8f20f473,
+0xdbcb78e9, 0xf373e1c5, 0xd4e9c520, 0xd4f1c5d4,
+0x6de3c4cb, 0xc501e118, 0x24a47ffd, 0x000000a0,
+0xbc6ff9c5, 0x0000a024, 0x73e1c500, 0xf9c503f7,
+0xb024bc6f, 0xc5000000, 0x03f773d1, 0x1865e3c4,
+0xf9c501dd, 0xe3c4d87e, 0x01da1679, 0x5c7ffdc5,
+0xf9c56024, 0xa024bc6f, 0xc5000000, 0x02f773e1,
+0xbc6ff9c5, 0x0000b024, 0x73d1c500, 0xe3c402f7,
+0x01dd1865, 0x9c7ffdc5, 0x00008024, 0x6ff9c500,
+0x008024bc, 0xc1c50000, 0xfac5dfd4, 0x6824747e,
+0xd97ef9c5, 0x1679e3c4, 0xc13101db, 0xc031d331,
+0x5c17f8c5, 0xd9094024, 0x5c6ef9c5, 0xe3c44024,
+0x245c2261, 0x940f0144, 0xc5d231c0, 0xf7deefe1,
+0x6ce1c5d8, 0x6ff9c5db, 0x009024bc, 0x44890000,
+0xd2833024, 0xf7c03100, 0x79e2c4da, 0x940fdb17,
+0xc5c189c0, 0xc5efd4c1, 0x24747efa, 0x7ef9c570,
+0x6ef9c5e8, 0x245489d8, 0xf7db3134, 0x79e3c4d9,
+0x8301ea16, 0xc03100d3, 0x2261e3c4, 0xdbf701da,
+0xdeefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0xc0940fdb,
+0xd8f7d231, 0x6c17f8c5, 0xfac54024, 0x78246c7e,
+0x28244489, 0x3100d283, 0xc5daf7c0, 0x245c6ef9,
+0x61e3c440, 0x44245c22, 0xefe1c501, 0x6ce1c5dd,
+0x79e2c4db, 0x5489db17, 0x940f2c24, 0xf7d231c0,
+0x7efac5d8, 0x8928247c, 0x83402444, 0xf8b800d2,
+0xf7000002, 0x245489da, 0x16c0c544, 0x8940246c,
+0xc540244c, 0x247c7efa, 0x245c8930, 0x16c0c544,
+0xc440245c, 0xdd1865e3, 0x50fdc501, 0x0ffa83d3,
+0x0a96850f, 0xf9c50000, 0xffc0ae6f, 0xe98fffff,
+0x245c9b50, 0x50e98f60, 0x70246c9b, 0x1865e3c4,
+0xfdc501dd, 0xa0249c7f, 0xc5000000, 0x24bc6ff9,
+0x000000a0, 0xf7d4c1c5, 0xbc6ff9c5, 0x0000b024,
+0x7ef9c500, 0x6ef9c5f0, 0xc5c031d8, 0xc4efd4c1,
+0xf21679e3, 0x7efac501, 0x008024bc, 0xe3c40000,
+0x01da2261, 0xdfefe1c5, 0xdb6ce1c5, 0x1779e2c4,
+0xc0940fdb, 0xd8f7d231, 0x7417f8c5, 0xfac54024,
+0x8824b47e, 0x89000000, 0x83302444, 0xc03100d2,
+0x5c6ef9c5, 0xdaf74024, 0x2261e3c4, 0x0144245c,
+0xdeefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0x245489db,
+0xc0940f34, 0xc189db31, 0xe87ef9c5, 0xd86ef9c5,
+0xe3c4d9f7, 0x01ea1679, 0xb47efac5, 0x00009024,
+0x00d38300, 0xe3c4c031, 0x01da2261, 0xe1c5dbf7,
+0xe1c5deef, 0xe2c4db6c, 0x0fdb1779, 0xd231c094,
+0xf8c5d8f7, 0x40246c17, 0xac7efac5, 0x00009824,
+0x24448900, 0x00d28328, 0xdaf7c031, 0x5c6ef9c5,
+0xe3c44024, 0x245c2261, 0xe1c50144, 0xe1c5ddef,
+0xe2c4db6c, 0x89db1779, 0x0f2c2454, 0xd231c094,
+0xfac5d8f7, 0x28247c7e, 0x40244489, 0xb800d283,
+0x000002fd, 0x5489daf7, 0xc0c54424, 0x40246c16,
+0x40244c89, 0x7c7efac5, 0x5c893024, 0xc0c54424,
+0x40245c16, 0x1865e3c4, 0xfdc501dd, 0xfa83d350,
+0x25850f0f, 0xc7000009, 0x035c2444, 0xc5000000,
+0xc5dc6ff9, 0x24a47ffd, 0x000000a0, 0x5c24548b,
+0xbc6ff9c5, 0x0000b024, 0xc5d18900, 0xc1e26ef9,
+0xe3c41ff9, 0x01e12259, 0xecf3e1c5, 0xe4f3c1c5,
+0x1855e3c4, 0xf9c501e4, 0x402464d6, 0x647ffdc5,
+0x44c76024, 0x00025c24, 0x448b0000, 0xc5995c24,
+0xc4e06ef9, 0xe22259e3, 0xf3e1c501, 0xf3c1c5dc,
+0x65e3c4e4, 0xc501dc18, 0x249c7ffd, 0x00000080,
+0xb46ff9c5, 0x00008024, 0xd4c9c500, 0xc5c031de,
+0xc4d97ef9, 0xdb1679e3, 0x244c3301, 0x245c3340,
+0x7efac544, 0xc568246c, 0x245c17f8, 0x6ef9c540,
+0xc440245c, 0x5c2261e3, 0xc5014424, 0xc5ddefe1,
+0xc5db6ce1, 0x24bc6ff9, 0x00000090, 0xe7d4c1c5,
+0xfac5d909, 0x70246c7e, 0x6417f8c5, 0x940f4024,
+0xf7d231c0, 0x244489d8, 0x00d28330, 0xdaf7c031,
+0x1779e2c4, 0xc0940fdb, 0x34245489, 0xdb31c189,
+0xf9c5d9f7, 0xf9c5e07e, 0xd383d86e, 0xc4c03100,
+0xe21679e3, 0xc4dbf701, 0xda2261e3, 0xefe1c501,
+0x6ce1c5dd, 0x79e2c4db, 0x940fdb17, 0xf7d231c0,
+0x6ef9c5d8, 0x8940245c, 0x83282444, 0xc03100d2,
+0xe3c4daf7, 0x245c2261, 0xfac50144, 0x7824647e,
+0xdcefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0x245489db,
+0xc0940f2c, 0xd8f7d231, 0x747efac5, 0xfac52824,
+0x30247c7e, 0x40244489, 0xb800d283, 0x00000310,
+0x5489daf7, 0xc8c54424, 0x40246416, 0x40244c89,
+0x44245c89, 0x5c16c0c5, 0xe3c44024, 0x01dc1865,
+0xd350fdc5, 0x0f0ffa83, 0x00077f85, 0x24448b00,
+0xefd9c55c, 0x244489e4, 0x1ff8c140, 0x44244489,
+0x5c12fbc5, 0xd9c54024, 0xe98fdbfb, 0x24649b60,
+0x60e98f60, 0x70245c9b, 0x185de3c4, 0xfdc501db,
+0xa0249c7f, 0xc5000000, 0x24bc6ff9, 0x000000a0,
+0xefd4c1c5, 0xb46ff9c5, 0x0000b024, 0x7ef9c500,
+0x6ef9c5e8, 0xc5c031d8, 0xc4e6d4c9, 0xea1679e3,
+0x7efac501, 0x008024b4, 0xe3c40000, 0x01da2261,
+0xdeefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0xc0940fdb,
+0xd8f7d231, 0x6c17f8c5, 0xfac54024, 0x8824ac7e,
+0x89000000, 0x83302444, 0xc03100d2, 0x5c6ef9c5,
+0xdaf74024, 0x2261e3c4, 0x0144245c, 0xddefe1c5,
+0xdb6ce1c5, 0x1779e2c4, 0x245489db, 0xc0940f34,
+0xc189db31, 0xe07ef9c5, 0xd86ef9c5, 0xe3c4d9f7,
+0x01e21679, 0xac7efac5, 0x00009024, 0x00d38300,
+0xe3c4c031, 0x01da2261, 0xe1c5dbf7, 0xe1c5ddef,
+0xe2c4db6c, 0x0fdb1779, 0xd231c094, 0xf8c5d8f7,
+0x40246417, 0xa47efac5, 0x00009824, 0x24448900,
+0x00d28328, 0xdaf7c031, 0x5c6ef9c5, 0xe3c44024,
+0x245c2261, 0xe1c50144, 0xe1c5dcef, 0xe2c4db6c,
+0x89db1779, 0x0f2c2454, 0xd231c094, 0xfac5d8f7,
+0x28247c7e, 0x747efac5, 0x44893024, 0xd2834024,
+0x0314b800, 0xdaf70000, 0x44245489, 0x6416c0c5,
+0x4c894024, 0x5c894024, 0xc8c54424, 0x40245c16,
+0x1865e3c4, 0xfdc501dc, 0xfa83d350, 0xf9850f0f,
+0x31000005, 0xefe1c5c0, 0x24843bdb, 0x00000120,
+0x2424841b, 0x7d000001, 0x6ff9c504, 0xc5c031da,
+0x3be4efd9, 0x01282484, 0x841b0000, 0x00012c24,
+0xc5057d00, 0x08da73d9, 0xe9c5c031, 0x843bd2ef,
+0x00013024, 0x24841b00, 0x00000134, 0xf9c5047d,
+0xc031d16f, 0xedefd1c5, 0x3824843b, 0x1b000001,
+0x013c2484, 0x057d0000, 0xd973d1c5, 0x6ce9c508,
+0x6ce1c5cd, 0x6de3c4d4, 0xc501d118, 0xc5ca6ff9,
+0x24947ffd, 0x000000a0, 0x9be8e98f, 0x01202494,
+0xf9c50000, 0x3024bc6f, 0x8f000001, 0x9c9b40e9,
+0x0000b024, 0x6de3c400, 0xc501d318, 0xc4d07ef9,
+0xd21679e3, 0x7ffdc501, 0xc5602454, 0xd09e6ff9,
+0xc5ffffff, 0x24b46ff9, 0x00000120, 0xbc6ff9c5,
+0x00013024, 0xfbc9c500, 0xfbc1c5d3, 0x6de3c4db,
+0xc501d318, 0x24947ffd, 0x00000120, 0x9bf0e98f,
+0x0120248c, 0xf9c50000, 0x3024b46f, 0x8f000001,
+0x949b48e9, 0x0000b024, 0x75e3c400, 0xc501da18,
+0xc5c9d4f1, 0x249c7ffd, 0x00000080, 0xc97ef9c5,
+0x1679e3c4, 0xc13101cb, 0xc031d331, 0x4c17f8c5,
+0xd9094024, 0x4c6ef9c5, 0xfac54024, 0x68245c7e,
+0x31c0940f, 0x71e3c4d2, 0x44244c22, 0xc5d8f701,
+0xc5cbeff1, 0x89c96cf1, 0x83302444, 0xc03100d2,
+0xe2c4daf7, 0x0fc91779, 0xc189c094, 0xd2d4e9c5,
+0x5c7efac5, 0xf9c57024, 0xf9c5d07e, 0x5489c86e,
+0xdb313424, 0xe3c4d9f7, 0x01d21679, 0x3100d383,
+0x71e3c4c0, 0xf701ca22, 0xeff1c5db, 0x6cf1c5cb,
+0x79e2c4c9, 0x940fc917, 0xf7d231c0, 0x17f8c5d8,
+0xc5402454, 0x24547efa, 0x24448978, 0x00d28328,
+0xdaf7c031, 0x4c6ef9c5, 0xe3c44024, 0x244c2271,
+0xf1c50144, 0xf1c5caef, 0xe2c4c96c, 0x89c91779,
+0x0f2c2454, 0xd231c094, 0xfac5d8f7, 0x28247c7e,
+0x747efac5, 0x44893024, 0xd2834024, 0x032cb800,
+0xdaf70000, 0x44245489, 0x5416c0c5, 0x4c894024,
+0x5c894024, 0xc8c54424, 0x40244c16, 0x1875e3c4,
+0xfdc501ca, 0xfa83d150, 0xcd850f0f, 0xc5000003,
+0xc5c9eff1, 0x2494fbf1, 0x00000120, 0xa47efac5,
+0x0000a024, 0xfbf1c500, 0x0130248c, 0xe98f0000,
+0x249c9b68, 0x00000080, 0x9b70e98f, 0x00902494,
+0xf9c50000, 0xe3c4d87e, 0x01da1679, 0x5c17f8c5,
+0xe3c44024, 0x01ca1865, 0x4c7ffdc5, 0xf9c56024,
+0xc031c86e, 0x2271e3c4, 0xf1c501ca, 0xf1c5ccef,
+0xe2c4c96c, 0x0fc91779, 0xd231c094, 0xf9c5d8f7,
+0x40244c6e, 0x30244489, 0x3100d283, 0x71e3c4c0,
+0x44244c22, 0xc5daf701, 0x249c7efa, 0x000000a8,
+0xcbeff1c5, 0xc96cf1c5, 0x1779e2c4, 0x245489c9,
+0xc0940f34, 0xc189db31, 0xd07ef9c5, 0xc86ef9c5,
+0xe3c4d9f7, 0x01d21679, 0x9c7efac5, 0x0000b024,
+0x00d38300, 0xe3c4c031, 0x01ca2271, 0xf1c5dbf7,
+0xf1c5cbef, 0xe2c4c96c, 0x0fc91779, 0xd231c094,
+0xf8c5d8f7, 0x40245417, 0x947efac5, 0x0000b824,
+0x24448900, 0x00d28328, 0xdaf7c031, 0x4c6ef9c5,
+0xe3c44024, 0x244c2271, 0xf1c50144, 0xf1c5caef,
+0xe2c4c96c, 0x89c91779, 0x0f2c2454, 0xd231c094,
+0xfac5d8f7, 0x28247c7e, 0x747efac5, 0x44893024,
+0xd2834024, 0x0331b800, 0xdaf70000, 0x44245489,
+0x5416c0c5, 0x4c894024, 0x5c894024, 0xc8c54424,
+0x40244c16, 0x1875e3c4, 0xfdc501ca, 0xfa83d150,
+0x65850f0f, 0x31000002, 0x6ffdc5c0, 0x00c024a4,
+0xfdc50000, 0xe0249c6f, 0xa8000000, 0x6ffdc501,
+0xc50475cb, 0xc5cc6ffd, 0x248c7ffd, 0x00000140,
+0x8c7efac5, 0x000140c4, 0xd6f9c500, 0x0080c48c,
+0x83400000, 0xd37504f8, 0x0424bc8b, 0xc1000001,
+0xbc3b1fff, 0x00010024, 0x8bfa8900, 0x010c24bc,
+0x941b0000, 0x00010424, 0x89db3100, 0x1fe8c1d0,
+0xd9f7c189, 0x40244c89, 0xc100d383, 0xdbf71fff,
+0x0824bc3b, 0x89000001, 0x245c89fa, 0x24941b44,
+0x0000010c, 0xfac5ff31, 0x4024747e, 0xe8c1d089,
+0x8bc6891f, 0x01142484, 0xdef70000, 0x40247489,
+0xf700d783, 0x247c89df, 0x1ff8c144, 0x1024843b,
+0x89000001, 0x16c8c5c3, 0x1b402454, 0x0114249c,
+0xd2310000, 0x891febc1, 0x249c8bd8, 0x0000011c,
+0x4489d8f7, 0xd2833024, 0x89daf700, 0xc1342454,
+0x9c3b1ffb, 0x00011824, 0xc5da8900, 0x247c7efa,
+0x24941b30, 0x0000011c, 0xd089db31, 0x891fe8c1,
+0x89d9f7c1, 0x8330244c, 0xdbf700d3, 0x34245c89,
+0x4c16c0c5, 0xe3c43024, 0x01d1186d, 0xa25ce88f,
+0xf9c520d3, 0xf9c5d07e, 0xc031c86e, 0x1679e3c4,
+0xfac501d2, 0x8024a47e, 0xc4000000, 0xca2271e3,
+0xeff1c501, 0x6cf1c5cc, 0x79e2c4c9, 0x940fc917,
+0xc5d231c0, 0x245417f8, 0xc5d8f740, 0x249c7efa,
+0x00000088, 0x4c6ef9c5, 0x44894024, 0xd2833024,
+0xf7c03100, 0x71e3c4da, 0x44244c22, 0xeff1c501,
+0x6cf1c5cb, 0x79e2c4c9, 0xe3c4c917, 0x01d2197d,
+0x34245489, 0x31c0940f, 0xc5c189db, 0xc5d07ef9,
+0xf7c86ef9, 0x79e3c4d9, 0xc501d216, 0x249c7efa,
+0x00000090, 0x3100d383, 0x71e3c4c0, 0xf701ca22,
+0xeff1c5db, 0x6cf1c5cb, 0x79e2c4c9, 0x940fc917,
+0xf7d231c0, 0x244489d8, 0x00d28328, 0xf8c5c031,
+0x40245417, 0xf9c5daf7, 0x40244c6e, 0x947efac5,
+0x00009824, 0x71e3c400, 0x44244c22, 0xeff1c501,
+0x6cf1c5ca, 0x79e2c4c9, 0x5489c917, 0x940f2c24,
+0xc5d231c0, 0x247c7efa, 0xc5d8f728, 0x24747efa,
+0x24448930, 0x00d28340, 0x5489daf7, 0x00ba4424,
+0xc5000000, 0x245416c0, 0x244c8940, 0x245c8940,
+0x16c8c544, 0xc440244c, 0xca1875e3, 0x50fdc501,
+0x0ff883c1, 0x0003c4b8, 0xc2440f00, 0x5bf4658d,
+0xc35d5f5e, 0xc324348b, 0x00000000, 0x00000000,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000006, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0012314,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u8[] = {
+0xba5500eb, 0x00000040, 0x0011fde8, 0x12230500,
+0xe5890000, 0x56ff3157, 0x000001be, 0xe4835300,
+0x40ec81e0, 0x89000001, 0x8d282444, 0x05b9ff5e,
+0x89000000, 0x3120245c, 0x89f129db, 0x8b18244c,
+0x1920244c, 0x245c89fb, 0x83f0891c, 0x894901e1,
+0x1ffbc1cb, 0x20247485, 0x894a0175, 0x0098c4b4,
+0xfac50000, 0x18247c7e, 0xbcd6f9c5, 0x0000b8c4,
+0xc48c8900, 0x000000d8, 0xc683c931, 0xc4bc8901,
+0x0000009c, 0x8900d783, 0x00dcc49c, 0x94890000,
+0x0000f8c4, 0xc48c8900, 0x000000fc, 0xf083f089,
+0x75f80905, 0x6ffdc586, 0x00a024bc, 0xfdc50000,
+0x40247c7f, 0xfac5c031, 0x4024547e, 0x8c7efac5,
+0x0000a024, 0xeff1c500, 0x6cf1c5ca, 0x79e2c4c9,
+0x940fc917, 0xc5d231c0, 0x24647efa, 0xc5d8f748,
+0x248c7efa, 0x000000a8, 0xc9efd9c5, 0x20244489,
+0x3100d283, 0xc5daf7c0, 0xc4c96cf1, 0xc91779e2,
+0x5c7efac5, 0xfac55024, 0xb0248c7e, 0xc5000000,
+0xc5c9efe1, 0x89c96cf1, 0x0f242454, 0xc189c094,
+0xfac5db31, 0x5824547e, 0xd383d9f7, 0xf7c03100,
+0x79e2c4db, 0x940fc917, 0xf7d231c0, 0x7efac5d8,
+0x00b8248c, 0x44890000, 0xd2831824, 0xf7c03100,
+0xefe9c5da, 0x6cf1c5c9, 0x79e2c4c9, 0x5489c917,
+0x940f1c24, 0xf7d231c0, 0x7efac5d8, 0x8918247c,
+0x83182444, 0x60b800d2, 0xf7000002, 0x245489da,
+0x16c0c51c, 0xc518246c, 0x247c7efa, 0x244c8920,
+0x245c8920, 0x16c0c524, 0xc420244c, 0xcd1875e3,
+0x50fdc501, 0x0ffa83d1, 0x1054850f, 0xf9c50000,
+0x4024746f, 0x7c6ff9c5, 0xc9c55024, 0xa0248cd4,
+0xc5000000, 0x24acd4c1, 0x000000b0, 0x1875e3c4,
+0xfdc501cd, 0x60244c7f, 0xb46ff9c5, 0x0000a024,
+0x73c9c500, 0xf9c501f6, 0xb024bc6f, 0xc5000000,
+0xc5f07ef9, 0x31c86ef9, 0x73d1c5c0, 0xe3c401f7,
+0x01f21679, 0x7c7efac5, 0xe3c46024, 0x01ca2271,
+0xcfeff1c5, 0xc96cf1c5, 0x1779e2c4, 0xc0940fc9,
+0xd8f7d231, 0x7417f8c5, 0xfac52024, 0x6824747e,
+0x18244489, 0x3100d283, 0x6ef9c5c0, 0xf720244c,
+0x71e3c4da, 0x24244c22, 0xeff1c501, 0x6cf1c5ce,
+0x79e2c4c9, 0x5489c917, 0x940f1c24, 0x89db31c0,
+0x7ef9c5c1, 0x6ef9c5e8, 0xc4d9f7c8, 0xea1679e3,
+0x7efac501, 0x83702474, 0xc03100d3, 0x2271e3c4,
+0xdbf701ca, 0xceeff1c5, 0xc96cf1c5, 0x1779e2c4,
+0xc0940fc9, 0xd8f7d231, 0x6c17f8c5, 0xfac52024,
+0x78246c7e, 0x10244489, 0x3100d283, 0xc5daf7c0,
+0x244c6ef9, 0x71e3c420, 0x24244c22, 0xeff1c501,
+0x6cf1c5cd, 0x79e2c4c9, 0x5489c917, 0x940f1424,
+0xf7d231c0, 0x7efac5d8, 0xc5102474, 0x247c7efa,
+0x24448918, 0x00d28320, 0x000266b8, 0x89daf700,
+0xc5242454, 0x246c16c8, 0x244c8920, 0x245c8920,
+0x16c0c524, 0xc420244c, 0xcd1875e3, 0x50fdc501,
+0x0ffa83d1, 0x0ee8850f, 0xf9c50000, 0x6024746f,
+0x7c6ff9c5, 0xc9c57024, 0xa0248cfb, 0xc5000000,
+0x24acfbc1, 0x000000b0, 0x1875e3c4, 0xfdc501cd,
+0x80248c7f, 0x31000000, 0x7efac5c0, 0x008024b4,
+0xfac50000, 0x40246c7e, 0xeeefd1c5, 0xed6cd1c5,
+0x1779e2c4, 0xc0940fed, 0xfac5d231, 0x8824ac7e,
+0xf7000000, 0xefd9c5d8, 0x6cd9c5e5, 0x244489e4,
+0x00d28320, 0xdaf7c031, 0x1779e2c4, 0xc0940fe4,
+0xa47efac5, 0x00009024, 0xefe1c500, 0x6ce1c5dc,
+0x245489db, 0x31c18924, 0xc5d9f7db, 0x247c7efa,
+0x244c8920, 0x00d38320, 0xdbf7c031, 0x1779e2c4,
+0xc0940fdb, 0x9c7efac5, 0x00009824, 0xefe9c500,
+0x6ce9c5d3, 0x245c89d2, 0xf7d23124, 0x244489d8,
+0x00d28318, 0xdaf7c031, 0x1779e2c4, 0xc0940fd2,
+0x1c245489, 0xd8f7d231, 0xc500d283, 0x24747efa,
+0x16c0c518, 0x89202454, 0xf7182444, 0x026bb8da,
+0x54890000, 0xc8c51c24, 0x18245c16, 0x186de3c4,
+0xfdc501d3, 0xfa83d250, 0xd3850f0f, 0xc500000d,
+0x24746ffd, 0x56ccc540, 0x00c02494, 0xfdc50000,
+0x4024547f, 0x8c54f4c5, 0x0000c024, 0x6ffdc500,
+0x008024bc, 0xc4c50000, 0xc0249457, 0xc5000000,
+0xc4d07ef9, 0xd21679e3, 0x7ffdc501, 0x00802494,
+0xf4c50000, 0x40244c55, 0xc97ef9c5, 0x1679e3c4,
+0xc13101cb, 0xf8c5d331, 0x20244c17, 0xd909c031,
+0x546ef9c5, 0x940f2024, 0xc4d231c0, 0x542269e3,
+0xf7012424, 0x7efac5d8, 0x0088249c, 0xe9c50000,
+0x4489d3ef, 0xd2831824, 0xf7c03100, 0x6ce9c5da,
+0x79e2c4d2, 0xe3c4d217, 0x01c9197d, 0x1c245489,
+0x89c0940f, 0xc5db31c1, 0xf7c87ef9, 0x6ef9c5d9,
+0x79e3c4d0, 0x8301ca16, 0xc03100d3, 0x2269e3c4,
+0xdbf701d2, 0x9c7efac5, 0x00009024, 0xefe9c500,
+0x6ce9c5d3, 0x79e2c4d2, 0x940fd217, 0xf7d231c0,
+0x17f8c5d8, 0x8920244c, 0x83102444, 0xc03100d2,
+0xf9c5daf7, 0x20244c6e, 0x947efac5, 0x00009824,
+0x71e3c400, 0x24244c22, 0xeff1c501, 0x6cf1c5ca,
+0x79e2c4c9, 0x5489c917, 0x940f1424, 0xf7d231c0,
+0x7efac5d8, 0x89102474, 0x83202444, 0xfac500d2,
+0x18247c7e, 0x77b8daf7, 0x89000002, 0xc5242454,
+0x245416c8, 0x244c8920, 0x245c8920, 0x16c0c524,
+0xc420244c, 0xca1875e3, 0x50fdc501, 0x0ffa83d1,
+0x0c6c850f, 0xf9c50000, 0xa0248c70, 0xb1000000,
+0x4071e2c4, 0x00c0248c, 0xf9c50000, 0xa024b46f,
+0xc5000000, 0x24bc6ff9, 0x000000b0, 0x9cf4c1c5,
+0x0000d024, 0x78e98f00, 0xe9c5c9cb, 0xc520f173,
+0x248cf4c9, 0x000000c0, 0xcad4f1c5, 0x9470f9c5,
+0x0000b024, 0xe2c4b100, 0x24944069, 0x000000d0,
+0xcb78e98f, 0x73e9c5d2, 0xe1c520f2, 0xe3c4d2d4,
+0x01ca1875, 0xc87ef9c5, 0x1679e3c4, 0xfdc501ca,
+0x40244c7f, 0xc504f083, 0x244c7efa, 0x0fd00948,
+0xd231c094, 0xf7c0b60f, 0x244489d8, 0x24448b20,
+0x00d28328, 0x5489daf7, 0xfac52424, 0x20247c7e,
+0x906ff9c5, 0xffffffe0, 0xf1c5c031, 0xf1c5caef,
+0xe2c4c96c, 0x0fc91779, 0xc189c094, 0xfac5db31,
+0x50244c7e, 0xf1c5d9f7, 0xf1c5caef, 0xd383c96c,
+0xf7c03100, 0x79e2c4db, 0x940fc917, 0xf7d231c0,
+0x7efac5d8, 0x8958244c, 0x8b182444, 0x83282444,
+0xdaf700d2, 0x1c245489, 0x747efac5, 0xf9c51824,
+0xfff0906f, 0xc031ffff, 0xcaeff1c5, 0xc96cf1c5,
+0x1779e2c4, 0xc0940fc9, 0xd8f7d231, 0x28244489,
+0xb800d283, 0x000002d3, 0x5489daf7, 0xc8c52c24,
+0x28245416, 0x28244c89, 0x2c245c89, 0x4c16c0c5,
+0xe3c42824, 0x01ca1875, 0xd150fdc5, 0x0f0ffa83,
+0x000b0d85, 0x6ffdc500, 0x00a0249c, 0xfdc50000,
+0x80249c7f, 0xc5000000, 0x24b46ff9, 0x00000080,
+0xac6ff9c5, 0x00009024, 0x73f1c500, 0xe9c503f6,
+0xc403f573, 0xca1875e3, 0x7ef9c501, 0x79e3c4c8,
+0xc501ca16, 0x244c7ffd, 0x6ff9c540, 0x008024bc,
+0xf9c50000, 0x9024b46f, 0xc5000000, 0x02f773f1,
+0xf673e9c5, 0x75e3c402, 0xc501ca18, 0x244c7ffd,
+0x6ff9c560, 0xc560246c, 0xc5cdd4d1, 0x24647efa,
+0x7ef9c548, 0x79e3c4c9, 0x3101cb16, 0x31d331c1,
+0x17f8c5c0, 0x0928244c, 0x6ef9c5d9, 0xc428244c,
+0x4c2271e3, 0x0f012c24, 0xd231c094, 0xcceff1c5,
+0xf1c5d8f7, 0xf9c5c96c, 0x70247c6f, 0x20244489,
+0x3100d283, 0xc4daf7c0, 0xc91779e2, 0x89c0940f,
+0xd4c1c5c1, 0x7efac5d7, 0xc5502464, 0xc5d07ef9,
+0x89c86ef9, 0x31242454, 0xc4d9f7db, 0xd21679e3,
+0x00d38301, 0xe3c4c031, 0x01ca2271, 0xf1c5dbf7,
+0xf1c5ccef, 0xe2c4c96c, 0x0fc91779, 0xd231c094,
+0xf8c5d8f7, 0x28245417, 0x547efac5, 0x44895824,
+0xd2831824, 0xf7c03100, 0x6ef9c5da, 0xc428244c,
+0x4c2271e3, 0xc5012c24, 0xc5caeff1, 0xc4c96cf1,
+0xc91779e2, 0x1c245489, 0x31c0940f, 0xc5d8f7d2,
+0x24747efa, 0x7efac518, 0x8920246c, 0x83282444,
+0xf8b800d2, 0xf7000002, 0x245489da, 0x16c8c52c,
+0x89282454, 0x8928244c, 0xc52c245c, 0x244c16d0,
+0x75e3c428, 0xc501ca18, 0x83d150fd, 0x850f0ffa,
+0x0000097e, 0x7c6ff9c5, 0xf9c54024, 0x5024746f,
+0xd773f1c5, 0x73e9c502, 0xe3c402d6, 0x01ca1875,
+0x8c7ffdc5, 0x00008024, 0x6ff9c500, 0x008024ac,
+0xd1c50000, 0xfac5e5d4, 0x60246c7e, 0xe07ef9c5,
+0xc86ef9c5, 0xe3c4c031, 0x01e21679, 0x2271e3c4,
+0xf1c501ca, 0xf1c5cdef, 0xe2c4c96c, 0x0fc91779,
+0xd231c094, 0xf8c5d8f7, 0x28246417, 0x20244489,
+0x3100d283, 0x6ef9c5c0, 0xf728244c, 0x71e3c4da,
+0x2c244c22, 0x7efac501, 0xc5682464, 0xc5cceff1,
+0xc4c96cf1, 0xc91779e2, 0xbc6ff9c5, 0x00009024,
+0x24548900, 0xc0940f24, 0xd7d4c1c5, 0x647efac5,
+0xc1897024, 0xf9c5db31, 0xd9f7d07e, 0xc86ef9c5,
+0x1679e3c4, 0xd38301d2, 0xc4c03100, 0xca2271e3,
+0xc5dbf701, 0xc5cceff1, 0xc4c96cf1, 0xc91779e2,
+0x31c0940f, 0xc5d8f7d2, 0x245417f8, 0x7efac528,
+0x89782454, 0x83182444, 0xc03100d2, 0xf9c5daf7,
+0x28244c6e, 0x2271e3c4, 0x012c244c, 0xcaeff1c5,
+0xc96cf1c5, 0x1779e2c4, 0x245489c9, 0xc0940f1c,
+0xd8f7d231, 0x747efac5, 0xfac51824, 0x20246c7e,
+0x28244489, 0xb800d283, 0x000002fd, 0x5489daf7,
+0xc8c52c24, 0x28245416, 0x28244c89, 0x2c245c89,
+0x4c16d0c5, 0xe3c42824, 0x01ca1875, 0xd150fdc5,
+0x0f0ffa83, 0x00081985, 0x2444c700, 0x0000033c,
+0x7ffdc500, 0x0080249c, 0xf9c50000, 0x3c24646e,
+0xbc6ff9c5, 0x00009024, 0xf3e1c500, 0xf3c1c5d4,
+0x6de3c4e4, 0xc501d418, 0xc4d07ef9, 0xd21679e3,
+0x7ffdc501, 0xc7402454, 0x023c2444, 0xc5000000,
+0x24546ef9, 0xf3e1c53c, 0xf3c1c5ca, 0x75e3c4d2,
+0xc501ca18, 0x244c7ffd, 0x6ff9c560, 0xc560246c,
+0xc5cdd4d1, 0x24647efa, 0x7ef9c548, 0x79e3c4c9,
+0x3101cb16, 0x31d331c1, 0x17f8c5c0, 0x0928244c,
+0x6ef9c5d9, 0xc428244c, 0x4c2271e3, 0x0f012c24,
+0xd231c094, 0xcceff1c5, 0xf1c5d8f7, 0xf9c5c96c,
+0x70247c6f, 0x20244489, 0x3100d283, 0xc4daf7c0,
+0xc91779e2, 0x89c0940f, 0xd4c1c5c1, 0x7efac5d7,
+0xc5502464, 0xc5d07ef9, 0x89c86ef9, 0x31242454,
+0xc4d9f7db, 0xd21679e3, 0x00d38301, 0xe3c4c031,
+0x01ca2271, 0xf1c5dbf7, 0xf1c5ccef, 0xe2c4c96c,
+0x0fc91779, 0xd231c094, 0xf8c5d8f7, 0x28245417,
+0x547efac5, 0x44895824, 0xd2831824, 0xf7c03100,
+0x6ef9c5da, 0xc428244c, 0x4c2271e3, 0xc5012c24,
+0xc5caeff1, 0xc4c96cf1, 0xc91779e2, 0x1c245489,
+0x31c0940f, 0xc5d8f7d2, 0x24747efa, 0x7efac518,
+0x8920246c, 0x83282444, 0x10b800d2, 0xf7000003,
+0x245489da, 0x16c8c52c, 0x89282454, 0x8928244c,
+0xc52c245c, 0x244c16d0, 0x75e3c428, 0xc501ca18,
+0x83d150fd, 0x850f0ffa, 0x00000696, 0x546ef9c5,
+0xf9c53c24, 0x40247c6f, 0x746ff9c5, 0xc1c55024,
+0xc9c5cad3, 0xe3c4d2d3, 0x01ca1875, 0x8c7ffdc5,
+0x00008024, 0x6ff9c500, 0x008024ac, 0xd1c50000,
+0xfac5e5d4, 0x60246c7e, 0xe07ef9c5, 0xc86ef9c5,
+0xe3c4c031, 0x01e21679, 0x2271e3c4, 0xf1c501ca,
+0xf1c5cdef, 0xe2c4c96c, 0x0fc91779, 0xd231c094,
+0xf8c5d8f7, 0x28246417, 0x20244489, 0x3100d283,
+0x6ef9c5c0, 0xf728244c, 0x71e3c4da, 0x2c244c22,
+0x7efac501, 0xc5682464, 0xc5cceff1, 0xc4c96cf1,
+0xc91779e2, 0xbc6ff9c5, 0x00009024, 0x24548900,
+0xc0940f24, 0xd7d4c1c5, 0x647efac5, 0xc1897024,
+0xf9c5db31, 0xd9f7d07e, 0xc86ef9c5, 0x1679e3c4,
+0xd38301d2, 0xc4c03100, 0xca2271e3, 0xc5dbf701,
+0xc5cceff1, 0xc4c96cf1, 0xc91779e2, 0x31c0940f,
+0xc5d8f7d2, 0x245417f8, 0x7efac528, 0x89782454,
+0x83182444, 0xc03100d2, 0xf9c5daf7, 0x28244c6e,
+0x2271e3c4, 0x012c244c, 0xcaeff1c5, 0xc96cf1c5,
+0x1779e2c4, 0x245489c9, 0xc0940f1c, 0xd8f7d231,
+0x747efac5, 0xfac51824, 0x20246c7e, 0x28244489,
+0xb800d283, 0x00000314, 0x5489daf7, 0xc8c52c24,
+0x28245416, 0x28244c89, 0x2c245c89, 0x4c16d0c5,
+0xe3c42824, 0x01ca1875, 0xd150fdc5, 0x0f0ffa83,
+0x00052d85, 0x24848b00, 0x00000100, 0x0424840b,
+0x0f000001, 0xd231c095, 0xf7c0b60f, 0x244489d8,
+0x00d28328, 0x0824848b, 0xf7000001, 0x24840bda,
+0x0000010c, 0x2c245489, 0x747efac5, 0x950f2824,
+0x0fdb31c0, 0xc189c0b6, 0x1024848b, 0xf7000001,
+0x244c89d9, 0x00d38328, 0x840bdbf7, 0x00011424,
+0x245c8900, 0x16c8c52c, 0x0f282454, 0xd231c095,
+0xf7c0b60f, 0x244489d8, 0x00d28320, 0x1824848b,
+0xf7000001, 0x24840bda, 0x0000011c, 0x24245489,
+0x7c7efac5, 0x950f2024, 0x0fd231c0, 0xd8f7c0b6,
+0x20244489, 0xf700d283, 0x245489da, 0x16c0c524,
+0xc420244c, 0xd1186de3, 0x54ecc501, 0x6ff9c5d3,
+0x7ffdc5ca, 0x00802494, 0xe98f0000, 0x24949be8,
+0x00000100, 0xac6ff9c5, 0x00011024, 0x50e98f00,
+0x9024a49b, 0xc4000000, 0xd4186de3, 0x7ef9c501,
+0x79e3c4d0, 0xc501d216, 0x24547ffd, 0x76e9c540,
+0xd4e9c5d2, 0x010024a4, 0xe9c50000, 0x102494d4,
+0xc4000001, 0xd2185de3, 0x7ffdc501, 0x01002494,
+0xe98f0000, 0x248c9bf0, 0x00000100, 0xbc6ff9c5,
+0x00011024, 0x40e98f00, 0x9024949b, 0xc4000000,
+0xe21875e3, 0xd4f1c501, 0x7ffdc5c9, 0xc5602464,
+0xc4c97ef9, 0xcb1679e3, 0x31c13101, 0xc5c031d3,
+0x244c17f8, 0xc5d90928, 0x244c6ef9, 0x7efac528,
+0x0f482464, 0xd231c094, 0x2271e3c4, 0x012c244c,
+0xf1c5d8f7, 0xf1c5ccef, 0x4489c96c, 0xd2832024,
+0xf7c03100, 0x79e2c4da, 0x940fc917, 0xc5c189c0,
+0xc5d2d4e9, 0x24647efa, 0x7ef9c550, 0x6ef9c5d0,
+0x245489c8, 0xf7db3124, 0x79e3c4d9, 0x8301d216,
+0xc03100d3, 0x2271e3c4, 0xdbf701ca, 0xcceff1c5,
+0xc96cf1c5, 0x1779e2c4, 0xc0940fc9, 0xd8f7d231,
+0x5417f8c5, 0xfac52824, 0x5824547e, 0x18244489,
+0x3100d283, 0xc5daf7c0, 0x244c6ef9, 0x71e3c428,
+0x2c244c22, 0xeff1c501, 0x6cf1c5ca, 0x79e2c4c9,
+0x5489c917, 0x940f1c24, 0xf7d231c0, 0x7efac5d8,
+0xc5182474, 0x246c7efa, 0x24448920, 0x00d28328,
+0x00032cb8, 0x89daf700, 0xc52c2454, 0x245416c8,
+0x244c8928, 0x245c8928, 0x16d0c52c, 0xc428244c,
+0xca1875e3, 0x50fdc501, 0x0ffa83d1, 0x02d0850f,
+0xf1c50000, 0xf1c5c9ef, 0x002494fb, 0xc5000001,
+0x24ac7efa, 0x00000080, 0x8cfbf1c5, 0x00011024,
+0x68e98f00, 0x60246497, 0x9770e98f, 0xc570244c,
+0xc4e07ef9, 0xe21679e3, 0x17f8c501, 0xc4282464,
+0xd1185de3, 0x7ffdc501, 0xc5402454, 0x31d06ef9,
+0x69e3c4c0, 0xc501d222, 0xc5d5efe9, 0xc4d26ce9,
+0xd21779e2, 0x31c0940f, 0xc5d8f7d2, 0x24546ef9,
+0x24448928, 0x00d28320, 0xe3c4c031, 0x24542269,
+0xdaf7012c, 0xa47efac5, 0x00008824, 0xefe9c500,
+0x6ce9c5d4, 0x79e2c4d2, 0x5489d217, 0x940f2424,
+0x89db31c0, 0x7ef9c5c1, 0x6ef9c5c8, 0xc4d9f7d0,
+0xca1679e3, 0x7efac501, 0x009024a4, 0xd3830000,
+0xc4c03100, 0xd22269e3, 0xc5dbf701, 0xc5d4efe9,
+0xc4d26ce9, 0xd21779e2, 0x31c0940f, 0xc5d8f7d2,
+0x244c17f8, 0x7efac528, 0x00982494, 0x44890000,
+0xd2831824, 0xf7c03100, 0x6ef9c5da, 0xc428244c,
+0x4c2271e3, 0xc5012c24, 0xc5caeff1, 0xc4c96cf1,
+0xc91779e2, 0x1c245489, 0x31c0940f, 0xc5d8f7d2,
+0x247c7efa, 0x7efac518, 0x89202474, 0x83282444,
+0x31b800d2, 0xf7000003, 0x245489da, 0x16c0c52c,
+0x89282454, 0x8928244c, 0xc52c245c, 0x244c16c8,
+0x75e3c428, 0xc501ca18, 0x83d150fd, 0x850f0ffa,
+0x0000016e, 0xfdc5c031, 0xc024946f, 0xa8000000,
+0x6ffdc501, 0xc50475ca, 0xc5cb6ffd, 0x248c7ffd,
+0x00000120, 0x8c7efac5, 0x000120c4, 0xd6f9c500,
+0x4060c44c, 0x7504f883, 0xe4e88fd6, 0xe02494a2,
+0x20000000, 0xd07ef9c5, 0xc86ef9c5, 0xe3c4c031,
+0x01d21679, 0x647efac5, 0xe3c46024, 0x01ca2271,
+0xcceff1c5, 0xc96cf1c5, 0x1779e2c4, 0xc0940fc9,
+0xd8f7d231, 0x5417f8c5, 0xfac52824, 0x68245c7e,
+0x20244489, 0x3100d283, 0x6ef9c5c0, 0xf728244c,
+0x71e3c4da, 0x2c244c22, 0xeff1c501, 0x6cf1c5cb,
+0x79e2c4c9, 0xe3c4c917, 0x01d2197d, 0x24245489,
+0x89c0940f, 0xc5db31c1, 0xf7d07ef9, 0x6ef9c5d9,
+0x79e3c4c8, 0x8301d216, 0xc03100d3, 0x2271e3c4,
+0xdbf701ca, 0x5c7efac5, 0xf1c57024, 0xf1c5cbef,
+0xe2c4c96c, 0x0fc91779, 0xd231c094, 0xf8c5d8f7,
+0x28245417, 0x18244489, 0x3100d283, 0xc5daf7c0,
+0x244c6ef9, 0x7efac528, 0xc4782454, 0x4c2271e3,
+0xc5012c24, 0xc5caeff1, 0xc4c96cf1, 0xc91779e2,
+0x1c245489, 0x31c0940f, 0xc5d8f7d2, 0x245c7efa,
+0x24448918, 0x00d28328, 0x5489daf7, 0x00ba2c24,
+0xc5000000, 0x245416e0, 0x244c8928, 0x7efac528,
+0x8920245c, 0xc52c245c, 0x244c16e0, 0x75e3c428,
+0xc501ca18, 0x83c150fd, 0xc4b80ff8, 0x0f000003,
+0x658dc244, 0x5f5e5bf4, 0x048bc35d, 0x0000c324,
+0x00000006, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0011074,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32f4[] = {
+0x6be800eb, 0x81000007, 0x000891c1, 0x55c03100,
+0x5356e589, 0x000009bb, 0xe0e48300, 0x0100ec81,
+0xc2890000, 0x24448940, 0xdbde891c, 0x291c2444,
+0x01c2f6c6, 0x1c247489, 0x7c845cd9, 0x1c2444db,
+0x9c849cd9, 0xd9000000, 0xd9e0d9e8, 0xddc9dbe8,
+0x08f883d9, 0xbc849cd9, 0x75000000, 0x28fcc5c5,
+0x008024bc, 0xfcc50000, 0x20247c29, 0x4c28fcc5,
+0xf4c52024, 0xc500d7c2, 0x81d250fc, 0x0000fffa,
+0x0260b800, 0x850f0000, 0x000006df, 0x9458f4c5,
+0x00008024, 0x29fcc500, 0xc5402454, 0x24bc28fc,
+0x00000080, 0xd758c4c5, 0x54c2ecc5, 0xc5004024,
+0x81d250fc, 0x0000fffa, 0x0266b800, 0x850f0000,
+0x000006a7, 0x7c28fcc5, 0xc4c54024, 0x8024945c,
+0xc5000000, 0x245429fc, 0xc2f4c560, 0x00602454,
+0xd250fcc5, 0x00fffa81, 0x6bb80000, 0x0f000002,
+0x00067685, 0x28fcc500, 0x00a024b4, 0xf4c50000,
+0x80248c59, 0xc5000000, 0xc5de59cc, 0x249428fc,
+0x00000080, 0xee58ecc5, 0xa45cecc5, 0x0000a024,
+0x5cf4c500, 0x59dcc5cb, 0xc2f4c5e5, 0xfcc500cc,
+0xfa81d150, 0x000000ff, 0x000282b8, 0x28850f00,
+0xc5000006, 0x248c59ec, 0x000000c0, 0x4c29fcc5,
+0xecc52024, 0xc024945e, 0xc5000000, 0x00cac2f4,
+0xd150fcc5, 0x00fffa81, 0x8bb80000, 0x0f000002,
+0x0005f685, 0x28fcc500, 0xfffee891, 0x28fcc5ff,
+0x00c024ac, 0xd4c50000, 0xecc5ca57, 0x80249457,
+0xc5000000, 0x244c59f4, 0xc2f4c520, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x00028eb8, 0xb8850f00,
+0xc5000005, 0x248c53fc, 0x00000080, 0x4c29fcc5,
+0xfcc52024, 0x20244c53, 0x9428fcc5, 0x00008024,
+0x5bfdc500, 0x5bfcc5c9, 0xc2f4c5c9, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x000296b8, 0x78850f00,
+0xc5000005, 0xc5ca59ec, 0x244c29fc, 0x52fcc520,
+0xc520244c, 0x244c29fc, 0x28fcc540, 0xc540244c,
+0xc5d953fc, 0xc5db5bfd, 0xc5db5bfc, 0x00d3c2ec,
+0xd250fcc5, 0x00fffa81, 0x9db80000, 0x0f000002,
+0x00053685, 0x5bfdc500, 0x28fcc5c9, 0x0080249c,
+0xfcc50000, 0xfcc5c95b, 0xfdc5d353, 0xfcc5d25b,
+0xf4c5d25b, 0xc500cac2, 0x81d150fc, 0x0000fffa,
+0x029fb800, 0x850f0000, 0x000004ff, 0xcb59e4c5,
+0x4c29fcc5, 0xfcc52024, 0x20244c51, 0xcbc2f4c5,
+0x50fcc500, 0xfffa81d1, 0xb8000000, 0x000002a7,
+0x04d5850f, 0xfcc50000, 0xff089128, 0xecc5ffff,
+0xfcc5db5e, 0x20245c29, 0x087de3c4, 0x0b20244c,
+0x89c2f4c5, 0xffffff28, 0x50fcc500, 0xfffa81d1,
+0xb8000000, 0x000002af, 0x049d850f, 0xe98f0000,
+0x248c807c, 0x00000080, 0xdb57e0c5, 0xcbc2f4c5,
+0x50fcc500, 0xfffa81d1, 0xb8000000, 0x000002b6,
+0x0475850f, 0xecc50000, 0x80248c58, 0xc5000000,
+0xc5c95eec, 0x244c29fc, 0x7ce98f20, 0x20244c80,
+0x4cc2f4c5, 0xc5002024, 0x81d150fc, 0x0000fffa,
+0x02bcb800, 0x850f0000, 0x0000043f, 0x8928fcc5,
+0xffffff48, 0x8c59f4c5, 0x00008024, 0x29fcc500,
+0xc420244c, 0x4c087de3, 0x8f0b2024, 0x5c807ce9,
+0xf4c52024, 0xf4c5cb58, 0x20244cc2, 0x50fcc500,
+0xfffa81d1, 0xb8000000, 0x000002c6, 0x03f9850f,
+0xd4c50000, 0xa0248c59, 0xc5000000, 0x249c59d4,
+0x00000080, 0x4c29fcc5, 0xe4c54024, 0x40244c5f,
+0x4c29fcc5, 0xe4c56024, 0x40245c5d, 0x5c29fcc5,
+0xf4c54024, 0x40244c58, 0xbc28fcc5, 0x00008024,
+0x59f4c500, 0x58c4c5cd, 0x00a0249c, 0xf4c50000,
+0xc500cbc2, 0x81d150fc, 0x0000fffa, 0x0348b800,
+0x850f0000, 0x00000393, 0x047de3c4, 0x0080248c,
+0xc51b0000, 0x249c28fc, 0x000000a0, 0x0675e3c4,
+0xe4c501c9, 0xc500c9c2, 0x81d150fc, 0x0000fffa,
+0x0359b800, 0x850f0000, 0x0000035f, 0xe35bfdc5,
+0xb16ff9c5, 0xffffffe8, 0xcefad9c5, 0x197de3c4,
+0xd9c501e4, 0x5eb8e6fa, 0xc4000003, 0xcc1875e3,
+0x28fcc501, 0x008024a4, 0xe2c40000, 0xc4c90c5d,
+0xc90675e3, 0xc2e4c501, 0xfcc500c9, 0xfa81d150,
+0x000000ff, 0x0311850f, 0xdcc50000, 0xe2c4e358,
+0xf889187d, 0xc5ffffff, 0x00e1c2dc, 0xd450fcc5,
+0x00fffa81, 0x62b80000, 0x0f000003, 0x0002ea85,
+0x12fec500, 0x0080248c, 0xf4c50000, 0x80248c5c,
+0xc5000000, 0x68a128fc, 0xc5ffffff, 0x88b128fc,
+0xc5ffffff, 0xc5e558dc, 0xc5e659dc, 0x00ccc2f4,
+0xd150fcc5, 0x00fffa81, 0xb1b80000, 0x0f000003,
+0x0002a685, 0x16fec500, 0x008024a4, 0xfcc50000,
+0x20246429, 0x8c28fcc5, 0x00008024, 0x58d4c500,
+0x5cdcc5d2, 0x59ecc5e1, 0xc2dcc5d6, 0xfcc500e2,
+0xfa81d450, 0x000000ff, 0x0003b8b8, 0x68850f00,
+0x31000002, 0xc501a8c0, 0x75d328fc, 0x28fcc504,
+0x29fcc5d1, 0x00e02494, 0x84d90000, 0x0000e084,
+0x845cd900, 0xf8834040, 0xc5da7508, 0xc5e457d8,
+0x245428fc, 0xc2dcc540, 0xe88f01e5, 0x40cba274,
+0xc9c2ecc5, 0x50fcc500, 0xfffa81d1, 0xb8000000,
+0x000003c4, 0x0211850f, 0xe2c40000, 0x248c2c5d,
+0x00000080, 0x4c29fcc5, 0xf1c56024, 0xe88fc9ef,
+0xa889a274, 0x40ffffff, 0x2e75e2c4, 0xc560245c,
+0x246c28fc, 0xc2d4c560, 0xfcc500ca, 0xfa81d150,
+0x000000ff, 0x0003cdb8, 0xcc850f00, 0xc5000001,
+0x24b428fc, 0x00000080, 0x0c4de3c4, 0x00a0248c,
+0xc5aa0000, 0x00d1c2ec, 0xd250fcc5, 0x00fffa81,
+0xd4b80000, 0x0f000003, 0x00019e85, 0x28fcc500,
+0x008024bc, 0xc7c50000, 0xa0248cd0, 0xc5000000,
+0x24ac28fc, 0x00000080, 0x94d0d7c5, 0x0000a024,
+0xc2f4c500, 0xfcc500ca, 0xfa81d150, 0x000000ff,
+0x0003ddb8, 0x60850f00, 0xc5000001, 0x249c28fc,
+0x00000080, 0x4065e3c4, 0x00a02494, 0xc5f10000,
+0x245411fa, 0x7de3c41c, 0xb801d219, 0x000003ec,
+0x1c2444d9, 0x5411fac5, 0x44d91c24, 0xc1de1c24,
+0x1c245cd9, 0x4c10fac5, 0xf4c51c24, 0xffc889c2,
+0xc500ffff, 0x81d150fc, 0x0000fffa, 0x08850f00,
+0xba000001, 0x00000003, 0x5c29fcc5, 0xf0c52024,
+0xf7c5c957, 0x2024547c, 0xe212d8c5, 0x197de3c4,
+0xd8c501d3, 0xc4e4e3c6, 0x5c1779e3, 0xc5031c24,
+0x4ad316e8, 0x186de3c4, 0xfcc501d4, 0x20245429,
+0x81d9d075, 0xfffffffc, 0x1c2444d9, 0xd8dde9df,
+0x00b08a0f, 0x850f0000, 0x000000aa, 0xb428fcc5,
+0x00008024, 0x7dcfc500, 0x00a0249c, 0xf8c50000,
+0xd8c5d328, 0xe3c4e212, 0x01db197d, 0xe3c6d8c5,
+0x16e8c5e4, 0x6de3c4d3, 0xc501d418, 0xc5d97cef,
+0xc5d328f8, 0xc4e212d8, 0xdb197de3, 0xc6d8c501,
+0xe8c5e4e3, 0xe3c4d316, 0x01d4186d, 0xd97cefc5,
+0xd328f8c5, 0xe212d8c5, 0x197de3c4, 0xd8c501db,
+0xc5e4e3c6, 0xc4d316e8, 0xd4186de3, 0x7cefc501,
+0x28f8c5d1, 0x12d8c5da, 0x7de3c4e3, 0xc501d219,
+0xe4e2c6d8, 0xda16e0c5, 0x1865e3c4, 0xe4c501dc,
+0xc500d9c2, 0x3dc350fc, 0x000000ff, 0x000401b8,
+0xc2440f00, 0xf8b805eb, 0x8d000003, 0x5e5bf865,
+0x0c8bc35d, 0x0000c324, 0x00000000, 0x00000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x80000000, 0x80000000, 0x80000000, 0x80000000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3e800000, 0x3e800000, 0x3e800000, 0x3e800000,
+0x3e800000, 0x3e800000, 0x3e800000, 0x3e800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x41100000, 0x42100000, 0x00000000, 0x00000000,
+0x00000000,
+0004244,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32f8[] = {
+0x99e800eb, 0x81000006, 0x0007b9c2, 0x55e8d900,
+0xe483e589, 0x00ec81e0, 0xdd000001, 0x00802494,
+0x82d90000, 0xffffff00, 0xa02494dd, 0xd9000000,
+0x2494ddc9, 0x000000c0, 0xff0482d9, 0x94ddffff,
+0x00008824, 0x0882d900, 0xddffffff, 0x00a82494,
+0xe8d90000, 0x94dde0d9, 0x0000c824, 0xddc9d900,
+0x0090249c, 0xc9d90000, 0xb0249cdd, 0xd9000000,
+0x2494ddc9, 0x000000d0, 0x9cddcad9, 0x00009824,
+0xddc9d900, 0x00b8249c, 0x9cdd0000, 0x0000d824,
+0x28fdc500, 0x008024b4, 0xfdc50000, 0x20247429,
+0x4c28fdc5, 0xf5c52024, 0xc500d6c2, 0x83ca50fd,
+0x60b80ff9, 0x0f000002, 0x0005e185, 0x58f5c500,
+0x00802494, 0xfdc50000, 0x40245429, 0xbc28fdc5,
+0x00008024, 0x58c5c500, 0xc2edc5d7, 0x00402454,
+0xca50fdc5, 0xb80ff983, 0x00000266, 0x05ac850f,
+0xfdc50000, 0x40247428, 0x945ccdc5, 0x00008024,
+0x29fdc500, 0xc5602454, 0x2454c2f5, 0xfdc50060,
+0xf983ca50, 0x026bb80f, 0x850f0000, 0x0000057e,
+0xbc28fdc5, 0x0000a024, 0x59f5c500, 0x0080248c,
+0xc5c50000, 0xfdc5df59, 0x80249428, 0xc5000000,
+0xc5ef58ed, 0x24a45ced, 0x000000a0, 0xcb5cf5c5,
+0xe559ddc5, 0xccc2f5c5, 0x50fdc500, 0x0ff983c9,
+0x000282b8, 0x33850f00, 0xc5000005, 0x248c59ed,
+0x000000c0, 0x4c29fdc5, 0xedc52024, 0xc024945e,
+0xc5000000, 0x00cac2f5, 0xc950fdc5, 0xb80ff983,
+0x0000028b, 0x0504850f, 0xfdc50000, 0xff209a28,
+0xfdc5ffff, 0xc0249428, 0xc5000000, 0xc5cb57ed,
+0x249c57e5, 0x00000080, 0x4c59f5c5, 0xf5c52024,
+0xc500cbc2, 0x83c950fd, 0x8eb80ff9, 0x0f000002,
+0x0004c985, 0x5afdc500, 0x0080248c, 0xe3c40000,
+0x01c91875, 0xc953fcc5, 0xc95afcc5, 0x4c29fdc5,
+0xfdc52024, 0x20244c5a, 0xa428fdc5, 0x00008024,
+0x29f8c500, 0x00e0248c, 0xe3c40000, 0x01c91875,
+0xc953fcc5, 0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5,
+0xccc2f5c5, 0x50fdc500, 0x0ff983c9, 0x000296b8,
+0x67850f00, 0xc5000004, 0xc5cc59dd, 0x244c29fd,
+0x5afdc520, 0xc420244c, 0xc91875e3, 0x52fcc501,
+0x5afcc5c9, 0x29fdc5c9, 0xc540244c, 0x245c28fd,
+0x5afdc540, 0x029db8cb, 0xf8c50000, 0xe0248c29,
+0xc4000000, 0xc91875e3, 0x53fcc501, 0x5afcc5c9,
+0xe6ffc5c9, 0xe6fec5c9, 0xc2ddc5c9, 0xfdc500e1,
+0xf983cc50, 0x03850f0f, 0xc5000004, 0x24a428fd,
+0x00000080, 0xcc5afdc5, 0xdbe6ffc5, 0xdbe6fec5,
+0x00029fb8, 0x29f8c500, 0x00e0248c, 0xe3c40000,
+0x01c91875, 0xc953fcc5, 0xc95afcc5, 0xc9e6ffc5,
+0xc9e6fec5, 0xd9c2e5c5, 0x50fdc500, 0x0ff983cb,
+0x03b8850f, 0xddc50000, 0xfdc5cc59, 0x20244c29,
+0x4c51fdc5, 0xf5c52024, 0xc500ccc2, 0x83c950fd,
+0xa7b80ff9, 0x0f000002, 0x00039185, 0x28fdc500,
+0xffff408a, 0x5ef5c5ff, 0x29fdc5e4, 0xc4202464,
+0x5c097de3, 0xc50b2024, 0x609ac2e5, 0x00ffffff,
+0xcb50fdc5, 0xb80ff983, 0x000002af, 0x035c850f,
+0xe98f0000, 0x249c817c, 0x00000080, 0xe457d9c5,
+0xdcc2e5c5, 0x50fdc500, 0x0ff983cb, 0x0002b6b8,
+0x37850f00, 0xc5000003, 0x249c58f5, 0x00000080,
+0xcb5ef5c5, 0x4c29fdc5, 0xe98f2024, 0x244c817c,
+0xc2f5c520, 0x0020244c, 0xc950fdc5, 0xb80ff983,
+0x000002bc, 0x0304850f, 0xfdc50000, 0xff808a28,
+0xf5c5ffff, 0x80248c59, 0xc5000000, 0x244c29fd,
+0x7de3c420, 0x20244c09, 0x7ce98f0b, 0x20245c81,
+0xcb58f5c5, 0x4cc2f5c5, 0xc5002024, 0x83c950fd,
+0xc6b80ff9, 0x0f000002, 0x0002c185, 0x59edc500,
+0x00a0248c, 0xedc50000, 0x80249c59, 0xc5000000,
+0x244c29fd, 0x5fe5c540, 0xc540244c, 0x244c29fd,
+0x5de5c560, 0xc540245c, 0x245c29fd, 0x58f5c540,
+0xc540244c, 0x24b428fd, 0x00000080, 0xca59f5c5,
+0x9c58cdc5, 0x0000a024, 0xc2f5c500, 0xfdc500cb,
+0xf983c950, 0x0348b80f, 0x850f0000, 0x0000025e,
+0x8c28fdc5, 0x00008024, 0x28fdc500, 0x00a024a4,
+0xe3c40000, 0x05d9057d, 0x0665e3c4, 0xddc501db,
+0xc500dbc2, 0x83cb50fd, 0x59b80ff9, 0x0f000003,
+0x00022985, 0x0c82d900, 0xc5ffffff, 0xb8cc58f5,
+0x00000362, 0xe0249cdd, 0xc4000000, 0x9c197de2,
+0x0000e024, 0xc2f5c500, 0xfdc500cb, 0xf983c950,
+0xf7850f0f, 0xc5000001, 0x248c12ff, 0x00000080,
+0x4c29fdc5, 0xfdc52024, 0x80249c28, 0xc5000000,
+0xa0aa58ed, 0xc5ffffff, 0xc5cb5cf5, 0xc0aa59d5,
+0xc5ffffff, 0x00cdc2f5, 0xc950fdc5, 0xb80ff983,
+0x000003b1, 0x01b4850f, 0xc0310000, 0xfdc501a8,
+0x0475cc28, 0xcb28fdc5, 0x8c29fdc5, 0x0000e024,
+0x10fbc500, 0x00e0c4bc, 0xfbc50000, 0x40c47c11,
+0x04f88340, 0xf1c5d675, 0xfdc5c957, 0x40246c28,
+0xd2c2f5c5, 0x64e88f01, 0xc520dca2, 0x00dbc2d5,
+0xcb50fdc5, 0xb80ff983, 0x000003c4, 0x015c850f,
+0xe2c40000, 0x249c2d6d, 0x00000080, 0x5c29fdc5,
+0xe1c56024, 0xe88fdbef, 0xe092a264, 0x20ffffff,
+0x2f6de2c4, 0xc5602464, 0x247428fd, 0xc2cdc560,
+0xfdc500d5, 0xf983ca50, 0x03cdb80f, 0x850f0000,
+0x0000011a, 0xbc28fdc5, 0x00008024, 0x45e3c400,
+0xa024940d, 0x0a000000, 0xeac2d5c5, 0x50fdc500,
+0x0ff983cd, 0x0003d4b8, 0xef850f00, 0xc5000000,
+0x24b428fd, 0x00000080, 0x94d0cdc5, 0x0000a024,
+0x28fdc500, 0x0080249c, 0xe5c50000, 0xa024a4d0,
+0xc5000000, 0x00d4c2ed, 0xca50fdc5, 0xb80ff983,
+0x000003dd, 0x00b4850f, 0xfdc50000, 0x20245c29,
+0x547cf5c5, 0xe3c42024, 0x01da186d, 0x066de3c4,
+0xe5c531d2, 0xc50cd2c6, 0x245429fd, 0x7cf5c520,
+0xc4202454, 0xd2197de3, 0x17f9c501, 0xd9182454,
+0xffff1082, 0x2444ddff, 0xdde9df18, 0x756a7ad8,
+0x0000ba68, 0xfdc50000, 0x8024bc28, 0xc5000000,
+0x24947dc5, 0x000000a0, 0x186de3c4, 0xe3c401da,
+0x31d2066d, 0xdac6e5c5, 0x7ce5c50c, 0x65e3c4d9,
+0xc401d318, 0xdb0665e3, 0xc6edc531, 0xedc50cd3,
+0xe3c4d17c, 0x01da186d, 0x066de3c4, 0xe5c531d2,
+0xc50cd2c6, 0x00c9c2ed, 0xc150fdc5, 0xb80ff883,
+0x00000401, 0xebc2440f, 0x03f8b805, 0xc3c90000,
+0xc324148b, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3ff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fd00000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fd00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0xbff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x3fe00000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0x00000000, 0x00000000, 0x00000000,
+0003714,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xdce853e5, 0x81000005,
+0x000601c3, 0xec815100, 0x00000120, 0x8b10fac5,
+0xffffffe0, 0x8d11fac5, 0xffffff14, 0x8d11fac5,
+0xffffff18, 0x8d11fac5, 0xffffff1c, 0xff14858b,
+0x8589ffff, 0xffffff08, 0x9510fac5, 0xffffff08,
+0x00bac031, 0xc5000000, 0x14952ef8, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0x73e82404, 0x83ffffff,
+0xc18810c4, 0x000260b8, 0x0fc98400, 0x00056084,
+0x10fac500, 0xffff0895, 0x58eac5ff, 0xffff1495,
+0x11fac5ff, 0xffff0c95, 0x10fac5ff, 0xffff1495,
+0x10ec83ff, 0xeac5c031, 0xf8c5d258, 0xff0c952e,
+0x9b0fffff, 0xc2450fc0, 0x0489d8f7, 0xff20e824,
+0xc483ffff, 0xb8c18810, 0x00000266, 0x840fc984,
+0x0000050d, 0x9510fac5, 0xffffff0c, 0x955ceac5,
+0xffffff14, 0x9511fac5, 0xfffffee8, 0xfee8858b,
+0x8589ffff, 0xffffff44, 0xff0c8589, 0x8589ffff,
+0xffffff10, 0x9510fac5, 0xffffff08, 0x3110ec83,
+0x2ef8c5c0, 0xffff1095, 0xc09b0fff, 0xf7c2450f,
+0x240489d8, 0xfffeb9e8, 0x10c483ff, 0x6bb8c188,
+0x84000002, 0xa6840fc9, 0xc5000004, 0x089510fa,
+0xc5ffffff, 0x149559ea, 0xc5ffffff, 0x089511fa,
+0xc5ffffff, 0x189510fa, 0xc5ffffff, 0xc5d259ea,
+0x0c9511fa, 0xc5ffffff, 0x149510fa, 0xc5ffffff,
+0x189558ea, 0xc5ffffff, 0x109511fa, 0xc5ffffff,
+0x149510fa, 0x83ffffff, 0xfac510ec, 0xff08a510,
+0xc031ffff, 0x9d5ceac5, 0xffffff18, 0xa55cdac5,
+0xffffff0c, 0x9d59e2c5, 0xffffff10, 0x9d11fac5,
+0xffffff10, 0xe32ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffe1a, 0x8810c483, 0x0282b8c1,
+0xc9840000, 0x0407840f, 0xeac50000, 0xff1c9559,
+0xfac5ffff, 0xff089511, 0xfac5ffff, 0xff149510,
+0xec83ffff, 0xc5c03110, 0x1c955eea, 0xc5ffffff,
+0x08952ef8, 0xc5ffffff, 0x0c9511fa, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0xc3e82404, 0x83fffffd,
+0xc18810c4, 0x00028bb8, 0x0fc98400, 0x0003b084,
+0x10fac500, 0xfffff0a3, 0x10ec83ff, 0x9510fac5,
+0xffffff1c, 0xfac5c031, 0xff149d10, 0xe8c5ffff,
+0xeac5d457, 0xff089559, 0xe0c5ffff, 0xf8c5dc57,
+0x9b0fd32e, 0xc2450fc0, 0x0489d8f7, 0xfd70e824,
+0xc483ffff, 0xb8c18810, 0x0000028e, 0x840fc984,
+0x0000035d, 0x95530ff3, 0xffffff14, 0x9511fac5,
+0xffffff08, 0x9d530ff3, 0xffffff08, 0xc32cfac5,
+0xc510ec83, 0x149510fa, 0xc5ffffff, 0x31d82ae2,
+0x2ef8c5c0, 0xc09b0fda, 0xf7c2450f, 0x240489d8,
+0xfffd1de8, 0x10c483ff, 0x96b8c188, 0x84000002,
+0x0a840fc9, 0xc5000003, 0xc5d259ea, 0x089511fa,
+0xf3ffffff, 0x0895520f, 0xc5ffffff, 0x0c9511fa,
+0xf3ffffff, 0x0c95530f, 0xc5ffffff, 0x83c22cfa,
+0xeac510ec, 0xc031d02a, 0x952ef8c5, 0xffffff14,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffcc2,
+0x8810c483, 0x029db8c1, 0xc9840000, 0x02af840f,
+0xfac50000, 0xff0c852c, 0xec83ffff, 0x530ff310,
+0xffff1495, 0x2ae2c5ff, 0x2cfac5d8, 0x2aeac5c2,
+0xc5c031d0, 0x0fda2ef8, 0x450fc09b, 0x89d8f7c2,
+0x7be82404, 0x83fffffc, 0xc18810c4, 0x00029fb8,
+0x0fc98400, 0x00026884, 0x10fac500, 0xffff1495,
+0x59eac5ff, 0x11fac5d2, 0xffff0895, 0x10fac5ff,
+0xffff1495, 0x10ec83ff, 0x0ff3c031, 0xff089d51,
+0xf8c5ffff, 0x9b0fda2e, 0xc2450fc0, 0x0489d8f7,
+0xfc2ce824, 0xc483ffff, 0xb8c28810, 0x000002a7,
+0x840fd284, 0x00000219, 0xd25ef2c5, 0x8d11fac5,
+0xffffff0c, 0x9511fac5, 0xffffff08, 0xec83c031,
+0x3a0f6610, 0xff08950a, 0xc50bffff, 0x0c952ef8,
+0xb9ffffff, 0x00000000, 0x9511fac5, 0xffffff10,
+0x0fc09b0f, 0xd8f7c145, 0xe8240489, 0xfffffbd2,
+0x8810c483, 0x02afb8c2, 0xd2840000, 0x01bf840f,
+0xe98f0000, 0x14958278, 0xc5ffffff, 0x089511fa,
+0xc5ffffff, 0x83d257e8, 0xc03110ec, 0x952ef8c5,
+0xffffff08, 0x0fc09b0f, 0xd8f7c145, 0xe8240489,
+0xfffffb8e, 0x8810c483, 0x02b6b8c2, 0xd2840000,
+0x017b840f, 0xf2c50000, 0xff149558, 0xf2c5ffff,
+0xfac5ca5e, 0xff088d11, 0xe98fffff, 0x088d8278,
+0xc5ffffff, 0x0c8d11fa, 0xc5ffffff, 0x088d10fa,
+0x83ffffff, 0xc03110ec, 0x8d2ef8c5, 0xffffff0c,
+0x0fc09b0f, 0xd8f7c145, 0xe8240489, 0xfffffb32,
+0x8810c483, 0x02bcb8c2, 0xd2840000, 0x011f840f,
+0xfac50000, 0xffe48b10, 0xf2c5ffff, 0xff148d59,
+0xfac5ffff, 0xff088d11, 0x0f66ffff, 0x088d0a3a,
+0x0bffffff, 0x8d11fac5, 0xffffff0c, 0x8278e98f,
+0xffff088d, 0x11fac5ff, 0xffff108d, 0x10fac5ff,
+0xffff0c8d, 0x10ec83ff, 0xf2c5c031, 0xff108d58,
+0xf8c5ffff, 0xff088d2e, 0x9b0fffff, 0xc1450fc0,
+0x0489d8f7, 0xfab8e824, 0xc483ffff, 0xb8c28810,
+0x000002c6, 0x840fd284, 0x000000a5, 0x8d10fac5,
+0xffffff1c, 0x9559f2c5, 0xffffff14, 0x8d59f2c5,
+0xffffff18, 0x9511fac5, 0xffffff08, 0x8d11fac5,
+0xffffff0c, 0x8d10fac5, 0xffffff08, 0x8d5ff2c5,
+0xffffff0c, 0x8d11fac5, 0xffffff10, 0x8d10fac5,
+0xffffff08, 0x8d5df2c5, 0xffffff0c, 0x8d11fac5,
+0xffffff0c, 0x8d10fac5, 0xffffff0c, 0xc510ec83,
+0x149510fa, 0x31ffffff, 0x58f2c5c0, 0xffff108d,
+0x58eac5ff, 0xffff1895, 0x59f2c5ff, 0xffff1c8d,
+0x2ef8c5ff, 0xc09b0fca, 0xf7c1450f, 0x240489d8,
+0xfffa0de8, 0x10c483ff, 0xc019013c, 0x00034825,
+0xf8658d00, 0x8d5d5b59, 0x8bc3fc61, 0x00c3241c,
+0x3f800000, 0x3e800000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003074,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_f8[] = {
+0x43e800eb, 0x81000006, 0x000669c1, 0xe5895500,
+0x81e0e483, 0x000200ec, 0x10fbc500, 0xffffe089,
+0x11fbc5ff, 0xc558244c, 0x244c11fb, 0x11fbc560,
+0x8b68244c, 0x89582444, 0x8b402444, 0x895c2444,
+0xc5442444, 0x246c10fb, 0x2ef9c540, 0x7a58246c,
+0x0001b80c, 0x00ba0000, 0x74000000, 0x31c03104,
+0x89d8f7d2, 0x83182444, 0x60b800d2, 0xf7000002,
+0x245489da, 0x446f0f1c, 0xd70f1824, 0xfffa81d0,
+0x0f000000, 0x0005bf85, 0x10fbc500, 0xc5402474,
+0x245458cb, 0x11fbc558, 0x31482454, 0x10fbc5d2,
+0xb8582454, 0x00000001, 0xd258ebc5, 0x542ef9c5,
+0x027a4824, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000266, 0x5489daf7, 0x6f0f1c24,
+0x0f18244c, 0xfa81d1d7, 0x000000ff, 0x0566850f,
+0xfbc50000, 0x48247c10, 0x545cc3c5, 0xfbc55824,
+0x20245411, 0x2024548b, 0x2424448b, 0xb8249489,
+0x89000000, 0x00bc2484, 0x54890000, 0x44894824,
+0x54894c24, 0x44895024, 0xd2315424, 0x6410fbc5,
+0x01b84024, 0xc5000000, 0x24642ef9, 0x74027a50,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x6bb800d2,
+0xf7000002, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x0004eb85, 0x10fbc500,
+0xc540246c, 0x245459d3, 0x11fbc558, 0xc5402454,
+0x245410fb, 0x59ebc560, 0x11fbc5d2, 0xc5482454,
+0x247410fb, 0x58cbc558, 0xc5602454, 0x245411fb,
+0xc5d23150, 0x245410fb, 0x10fbc558, 0xc540247c,
+0x245c5ceb, 0x5cc3c560, 0xc5482464, 0x245c59e3,
+0x0001b850, 0xfbc50000, 0x50245c11, 0xe32ef9c5,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0282b800, 0xdaf70000, 0x1c245489, 0x245c6f0f,
+0xd3d70f18, 0x00fffa81, 0x850f0000, 0x00000458,
+0x5459ebc5, 0xfbc56824, 0x40245411, 0xfbc5d231,
+0x58246410, 0x000001b8, 0x5edbc500, 0xc5682454,
+0x245411fb, 0x2ef9c548, 0x7a402454, 0x31047402,
+0xf7d231c0, 0x244489d8, 0x00d28318, 0x00028bb8,
+0x89daf700, 0x0f1c2454, 0x1824646f, 0x81d4d70f,
+0x0000fffa, 0xfd850f00, 0x31000003, 0x7efac5d2,
+0xfffff099, 0x10fbc5ff, 0xc568246c, 0x247410fb,
+0x57d1c558, 0x0001b8d3, 0xebc50000, 0x40245459,
+0xdb57c9c5, 0xd32ef9c5, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x028eb800, 0xdaf70000,
+0x1c245489, 0x246c6f0f, 0xd5d70f18, 0x00fffa81,
+0x850f0000, 0x000003a0, 0x545a0ff2, 0x0ff35824,
+0x0ff3d253, 0xf9c5d25a, 0x40245413, 0x5c5a0ff2,
+0x0ff34024, 0x0ff3db53, 0xfbc5db5a, 0xd231c32c,
+0x5410fbc5, 0xe3c55824, 0x01b8d82a, 0xc5000000,
+0x7ada2ef9, 0x31047402, 0xf7d231c0, 0x244489d8,
+0x00d28318, 0x000296b8, 0x89daf700, 0x0f1c2454,
+0x1824746f, 0x81d6d70f, 0x0000fffa, 0x35850f00,
+0xc5000003, 0xc5d259eb, 0x245411fb, 0x5a0ff240,
+0xf3402454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff248, 0xf3482454, 0xf3d2530f, 0xc5d25a0f,
+0x31c22cfb, 0x2aebc5d2, 0x0001b8d0, 0xf9c50000,
+0x5824542e, 0x0474027a, 0xd231c031, 0x4489d8f7,
+0xd2831824, 0x029db800, 0xdaf70000, 0x1c245489,
+0x247c6f0f, 0xd7d70f18, 0x00fffa81, 0x850f0000,
+0x000002c4, 0x545a0ff2, 0x0ff35824, 0x0ff3d253,
+0xfbc5d25a, 0xfbc5c22c, 0x4824542c, 0x940fc239,
+0x0fd231c0, 0xd8f7c0b6, 0x18244489, 0xb800d283,
+0x0000029f, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x027a850f, 0xfbc50000,
+0x58245410, 0xd259ebc5, 0x5411fbc5, 0xd2314024,
+0x5410fbc5, 0x01b85824, 0xf2000000, 0x245c510f,
+0x2ef9c540, 0x74027ada, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0xa7b800d2, 0xf7000002, 0x245489da,
+0x4c6f0f1c, 0xd70f1824, 0xfffa81d1, 0x0f000000,
+0x00022385, 0x5ef3c500, 0x11fbc5d2, 0xc548244c,
+0x245411fb, 0xb8d23140, 0x00000001, 0x0b3a0f66,
+0x0b402454, 0x5411fbc5, 0xf9c55024, 0x4824542e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x02afb800, 0xdaf70000, 0x1c245489, 0x24546f0f,
+0xd2d70f18, 0x00fffa81, 0x850f0000, 0x000001c8,
+0x8378e98f, 0xc5582454, 0x245413f9, 0xc5d23140,
+0xb8d257e9, 0x00000001, 0x542ef9c5, 0x027a4024,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x000002b6, 0x5489daf7, 0x6f0f1c24, 0x0f18245c,
+0xfa81d3d7, 0x000000ff, 0x017a850f, 0xf3c50000,
+0x58245458, 0xca5ef3c5, 0x4c11fbc5, 0xe98f4024,
+0x244c8378, 0x13f9c540, 0x3148244c, 0x10fbc5d2,
+0xb840247c, 0x00000001, 0x7c2ef9c5, 0x027a4824,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x000002bc, 0x5489daf7, 0x6f0f1c24, 0x0f182464,
+0xfa81d4d7, 0x000000ff, 0x011a850f, 0xfbc50000,
+0xffe8a110, 0xdbc5ffff, 0x58244c59, 0x6411fbc5,
+0xfbc51824, 0x40244c11, 0x0b3a0f66, 0x0b40244c,
+0x4c13f9c5, 0xe98f4824, 0x244c8378, 0x13f9c540,
+0x3150244c, 0x10fbc5d2, 0xb8482474, 0x00000001,
+0x4c58cbc5, 0xf9c55024, 0x40244c2e, 0x0474027a,
+0xd231c031, 0x4489d8f7, 0xd2831824, 0x02c6b800,
+0xdaf70000, 0x1c245489, 0x246c6f0f, 0xd5d70f18,
+0x00fffa81, 0x850f0000, 0x0000009c, 0x4c10fbc5,
+0xf3c56824, 0x58245459, 0x4c59f3c5, 0xfbc56024,
+0x40245411, 0x4c11fbc5, 0xfbc54824, 0x40247c10,
+0x4c5fc3c5, 0xfbc54824, 0x50244c11, 0x6410fbc5,
+0xdbc54024, 0x48244c5d, 0x4c11fbc5, 0xd2314824,
+0x6c10fbc5, 0xfbc54824, 0x58247410, 0x4c58d3c5,
+0xcbc55024, 0x60245458, 0x4c59f3c5, 0x01b86824,
+0xc5000000, 0x7aca2ef9, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x5489daf7, 0x48ba1c24,
+0x0f000003, 0x1824746f, 0x3dc6d70f, 0x000000ff,
+0x000000b8, 0xc2450f00, 0x0c8bc3c9, 0x0000c324,
+0x00000000, 0x3ff00000, 0x00000000, 0x3fd00000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000,
+0003174,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b24100,
+0x48e58948, 0x4c08ec83, 0x4caf5d8d, 0x4cbf4d8d,
+0x48cf458d, 0x44df7d8d, 0x488dd289, 0x048841ff,
+0x41c22903, 0x89011488, 0x01e283ca, 0x1901fa83,
+0x83c121d2, 0xcaff02e2, 0x8301f983, 0x884100de,
+0x88400014, 0xff480734, 0xf88348c0, 0xc5c87511,
+0xb06d6ff9, 0x6d7ff9c5, 0x6ff9c580, 0xe9c5805d,
+0x60b8d276, 0xc5000002, 0xc4cd74e1, 0xca1779e2,
+0x0366830f, 0xe1c50000, 0xc5b04dfc, 0x904d7ff9,
+0x4d6ff9c5, 0x0266b8b0, 0xf1c50000, 0xf1c5c9fc,
+0xc4904d74, 0xca1779e2, 0x033e830f, 0xf9c50000,
+0xc5906d6f, 0xb04df8d1, 0x4d7ff9c5, 0x74e1c5a0,
+0x6bb8a05d, 0xc4000002, 0xda1779e2, 0x031a830f,
+0xf9c50000, 0xc5b0756f, 0xd07d6ff9, 0xdbefe1c5,
+0x256ff9c5, 0x00000308, 0x6d6ff9c5, 0x6041c5e0,
+0x6049c5c7, 0x68c1c5ce, 0x68c9c5ff, 0x3941c4ce,
+0xc1c5c9d5, 0x688fc9d5, 0x40c9a330, 0xcb64d1c5,
+0xdb71c1c4, 0x7ff9c5c9, 0x698fa04d, 0xe05d98f0,
+0x2d6ff9c5, 0x000002d8, 0x656f79c5, 0xf819c5e0,
+0x7f79c5d5, 0xe98fe055, 0xe04d98f0, 0x00032cb8,
+0xfc71c500, 0x2941c4d1, 0x62c4d374, 0x0fd21779,
+0x00029783, 0xf8e1c500, 0x31b8e05d, 0x8f000003,
+0xc99860e9, 0x4d74f1c5, 0x79e2c4a0, 0x830fca17,
+0x00000278, 0x4d6ff9c5, 0x7f79c5c0, 0xf1c5804d,
+0x71c5d960, 0xc1c4d168, 0xc5d8d561, 0x8fd7d529,
+0xdaa360c8, 0x7ff9c540, 0xe2c4905d, 0x905d3c31,
+0x383162c4, 0x79c5904d, 0xc5904d7f, 0x905dfce1,
+0x000348b8, 0x6061c500, 0x68e1c5cb, 0xd5e1c5db,
+0x3141c4df, 0xc9c5c0d5, 0xe88ff9fc, 0x40dba338,
+0xdf74e1c5, 0x1779e2c4, 0x0d830fda, 0xc4000002,
+0x5d1c79e2, 0x74c9c580, 0x034fb8f3, 0xe2c40000,
+0x0ff21779, 0x0001f383, 0x6ff9c500, 0x54b8d075,
+0xc4000003, 0xde0851e2, 0xdb74c9c5, 0x1779e2c4,
+0xd5830fda, 0xc5000001, 0xb07d6ff9, 0xddf8f1c5,
+0x000359b8, 0x41e2c400, 0xf1c5db00, 0xe2c4db74,
+0x0fda1779, 0x0001b383, 0x6ff9c500, 0xf1c5b05d,
+0x5eb8fdf8, 0x8f000003, 0xdba360e8, 0x74f1c570,
+0x79e2c4db, 0x830fda17, 0x00000190, 0x5d60f1c5,
+0x68f1c5b0, 0xe1c5b07d, 0x49c5dff8, 0x49c5ce60,
+0x70b8c668, 0xc5000003, 0xc5fb60e1, 0xc5db68e1,
+0xc5ffd5b1, 0x8fdbd5b9, 0xdba340e8, 0x74e1c540,
+0x00017b1d, 0x79e2c400, 0x830fda17, 0x0000014c,
+0x5d6ff9c5, 0x60e1c5b0, 0x6861c5fb, 0x41c1c4d3,
+0x41c4f9d5, 0x8fc0d529, 0xf8a340c8, 0xefd9c540,
+0x7ff9c5e4, 0xe88f807d, 0x00e4cc48, 0xfc60c1c5,
+0x6d6f79c5, 0x7942c480, 0xc1c4c520, 0xb8f87441,
+0x0000037a, 0x1779e2c4, 0xfd830ffa, 0xc5000000,
+0xc5e460d9, 0xc5c46039, 0x807d6ff9, 0x2179e2c4,
+0x7439c5ff, 0x0382b8c7, 0x62c40000, 0x0fc21779,
+0x0000d783, 0x60d9c500, 0x60c1c5e4, 0x7ff9c5e4,
+0xf9c59065, 0xc4807d6f, 0xff2279e2, 0x7d7ff9c5,
+0x74c1c5a0, 0x038bb8e4, 0xe2c40000, 0x0fe21779,
+0x0000a783, 0xc5c03100, 0xa8e16ff9, 0xc5047501,
+0xc5e36ff9, 0xf0657ff9, 0xf005548a, 0x90055488,
+0x48c0ff48, 0x7510f883, 0xefd9c5de, 0x03c4b8e4,
+0xc9c50000, 0xe88ff464, 0x60c9a260, 0x4d74f1c5,
+0x79e2c490, 0x6473ca17, 0x0f61e3c4, 0xe1c501cb,
+0x008a1ddb, 0xe4b80000, 0xc5000003, 0xc5ddfce1,
+0xc4cb74f1, 0xca1779e2, 0x04b84273, 0x8f000000,
+0x5de178e9, 0x78e98fc0, 0xc5b04de1, 0xc5cb63f1,
+0x8fdbefe1, 0xc9c178e9, 0xcb63f1c5, 0xf375c8ff,
+0xdbefe1c5, 0xf1c5c031, 0xe2c4cb74, 0x0fca1779,
+0xf883c092, 0x25c01901, 0x00000401, 0x0000c3c9,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0002060,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b24100,
+0x48e58948, 0x4c08ec83, 0x4caf5d8d, 0x4cbf4d8d,
+0x48cf458d, 0x44df7d8d, 0x508dd689, 0x048841ff,
+0x41c62903, 0x89013488, 0x83c221d6, 0xceff01e6,
+0x8301fa83, 0x884100d9, 0x0c880034, 0xc0ff4807,
+0x11f88348, 0xf9c5d175, 0xc5b07d6f, 0x807d7ff9,
+0x5d6ff9c5, 0x76f1c580, 0x0260b8c9, 0xe1c50000,
+0xe2c4d774, 0x0fd11779, 0x0002c183, 0xfce1c500,
+0xf9c5b055, 0xc590557f, 0xb0556ff9, 0x000266b8,
+0xfce9c500, 0x74e9c5d2, 0xe2c49055, 0x0fd11779,
+0x00029983, 0x6ff9c500, 0xc9c59075, 0xc5b055f8,
+0xa0557ff9, 0x6574e1c5, 0x026bb8a0, 0xe2c40000,
+0x0fe11779, 0x00027583, 0xebe1c500, 0xf9c5c05d,
+0xc5805d7f, 0xc055dbe9, 0x7d6ff9c5, 0xefc1c5a0,
+0xe9c5c05d, 0xc58055df, 0xb8ed76d1, 0x00000277,
+0xd374e9c5, 0x1779e2c4, 0x3f830fd1, 0xc5000002,
+0xe0756ff9, 0xe4efd9c5, 0xcc48e88f, 0xe9c505d4,
+0x8fb055db, 0x7d98e8e9, 0xfcd1c5e0, 0xf9c5e05d,
+0x8fe05d7f, 0x5d98e8e9, 0x032cb8e0, 0xe1c50000,
+0xc9c5f3fc, 0xe2c4f774, 0x0ff11779, 0x0001fd83,
+0xf8d9c500, 0x31b8e065, 0x8f000003, 0xdb9458e9,
+0xd374e9c5, 0x1779e2c4, 0xdf830fd1, 0xc5000001,
+0xb05d6ff9, 0x55dae1c5, 0xdee1c5c0, 0xe1c5c065,
+0xc5c05dfc, 0xb8d4fce9, 0x0000033f, 0xd374e9c5,
+0x1779e2c4, 0xb3830fd1, 0xc5000001, 0xad356ff9,
+0xc5000001, 0xd0656ff9, 0x000354b8, 0x49e2c400,
+0xe9c5d408, 0xe2c4d474, 0x0fd11779, 0x00018d83,
+0x6ff9c500, 0xf9c5c055, 0xb8b07d6f, 0x00000359,
+0xddfce9c5, 0x0041e2c4, 0x74e1c5db, 0x79e2c4da,
+0x830fd917, 0x00000166, 0x5d6ff9c5, 0xf8e9c5b0,
+0x035eb8fe, 0xe88f0000, 0x70dba360, 0xda74e1c5,
+0x1779e2c4, 0x43830fd9, 0xc5000001, 0xb07d60e9,
+0x5d68e9c5, 0xfcd1c5b0, 0x0370b8db, 0xe1c50000,
+0xe1c5dff8, 0xd9c5dcef, 0xe1c5e5ef, 0xe1c5dcf8,
+0x012a1d74, 0xe2c40000, 0x0fd91779, 0x00010d83,
+0x79e2c400, 0xc4b06d30, 0xe53079e2, 0x6d7ff9c5,
+0x7ff9c590, 0xf9c5a065, 0xc4b07d6f, 0xdf3079e2,
+0xdd74e1c5, 0x00039ab8, 0x79e2c400, 0x830fd917,
+0x000000da, 0x6d6ff9c5, 0x79e2c4b0, 0xe1c5dd31,
+0xa1b8dc74, 0xc4000003, 0xd91779e2, 0x00bc830f,
+0xf9c50000, 0xc4b06d6f, 0xdd3279e2, 0x5d7ff9c5,
+0x79e2c480, 0xa8b8e430, 0xc5000003, 0xc4dc74e1,
+0xd91779e2, 0x0094830f, 0xf9c50000, 0x31b05d6f,
+0x6ff9c5c0, 0x7501a8e2, 0x6ff9c504, 0x7ff9c5e3,
+0x548af065, 0x5488f005, 0xff489005, 0xf88348c0,
+0x8fde7510, 0x55a2e0e8, 0xe9c520d0, 0xb8905574,
+0x000003c4, 0x1779e2c4, 0xc55373d1, 0x6d25dbe1,
+0xc4000000, 0xd30f61e3, 0x03e4b801, 0xd9c50000,
+0xe9c5e6fc, 0xe2c4d474, 0x73d11779, 0x7ff9c531,
+0xe9c5805d, 0x04bad2ef, 0x8f000000, 0x4dd178e9,
+0x67e9c580, 0x7ff9c5c9, 0xcaff804d, 0xe3c4ed75,
+0x0fc81479, 0xf8b8883c, 0x0f000003, 0xc3c9c244,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0001560,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i2[] = {
+0x00014ae9, 0x01b85500, 0xb9000000, 0x00000009,
+0x89e58948, 0x448966ca, 0xc229ce45, 0x4544c766,
+0x660001ee, 0xde455489, 0x48c0ff48, 0x7509f883,
+0x6ff9c5e2, 0x79c5d055, 0xc5f0456f, 0xe04d6ff9,
+0xfd69c1c4, 0xd5c9c5f0, 0x70e88ff1, 0x10d06595,
+0xdb76e1c5, 0x000041b8, 0x75d9c500, 0x79e2c4e6,
+0x830fe317, 0x000000e5, 0xe4efd9c5, 0x000045b8,
+0xf9d9c500, 0xf9d9c5e9, 0xd5d1c5f6, 0xc1c5d07d,
+0xc1c5f9f9, 0xe2c4f675, 0x0ff31779, 0x0000bc83,
+0x69c1c400, 0xe9c5d0f9, 0xf1c5d1d5, 0xc5d075d5,
+0xb8f1f9c9, 0x00000049, 0xf275c9c5, 0x1779e2c4,
+0x96830ff3, 0x8f000000, 0x6d9550e8, 0xd9c510d0,
+0x4db8d2f9, 0xc5000000, 0xc4ea75d1, 0xeb1779e2,
+0xf9c57b73, 0xc5d0756f, 0xc5c1fd49, 0xf06dd5c9,
+0x55fdd1c5, 0x0054b8e0, 0xc1c40000, 0xc4d07569,
+0xd31779e2, 0xd9c55773, 0xe9c5d6f9, 0xc5f055d5,
+0xe07df9e9, 0x000058b8, 0x59c1c400, 0xc1c5e0f9,
+0xe2c4e475, 0x73e31779, 0xf9d1c534, 0xc9c5e06d,
+0x5cb8e1f9, 0xc5000000, 0xc4ec75d1, 0xeb1779e2,
+0xe9c51b73, 0xc5e055fd, 0xb8cef9f1, 0x00000060,
+0xd175e9c5, 0x1779e2c4, 0x310273d3, 0x55c35dc0,
+0x000001b8, 0x0010b900, 0xb9410000, 0x00000009,
+0x48e58948, 0x0090ec81, 0x708d0000, 0xcf8944ff,
+0x45448966, 0x29f289ae, 0x01e283c7, 0x457c8966,
+0x01fa83be, 0xe283d219, 0x85caff02, 0x940f40c6,
+0x548966c6, 0x0f40ce45, 0xf129f6b6, 0x454c8966,
+0xc0ff48de, 0x09f88348, 0xf9c5c075, 0xc5b0756f,
+0x80757ff9, 0x556ff9c5, 0x76f1c580, 0x0260b8c9,
+0xe9c50000, 0xe2c4de75, 0x0fd91779, 0x0004a483,
+0xfde9c500, 0xf9c5b05d, 0xc5905d7f, 0xb0756ff9,
+0x000266b8, 0x71e1c500, 0xe1c501f6, 0xc4905d75,
+0xd91779e2, 0x047b830f, 0xf9c50000, 0xc590756f,
+0xb05df9c9, 0x5d7ff9c5, 0x75e9c5a0, 0x6bb8a05d,
+0xc4000002, 0xd91779e2, 0x0457830f, 0xf9c50000,
+0xc5c05d6f, 0xb055d5e9, 0xe3d5e1c5, 0x5d6ff9c5,
+0xfde1c5b0, 0xe1c5c075, 0xc5c06df9, 0xb8d4f9e9,
+0x00000282, 0xeed5d1c5, 0xd575e9c5, 0x1779e2c4,
+0x1e830fd1, 0xc5000004, 0xc055d5e1, 0x1575e9c5,
+0x0000041c, 0x0002d3b8, 0x79e2c400, 0x830fd117,
+0x00000401, 0x65e5e1c5, 0x6ff9c5d0, 0xe9c5d06d,
+0xdab8d2ef, 0x8f000002, 0xd2cd50e8, 0x75e9c500,
+0x79e2c4d4, 0x830fd117, 0x000003d9, 0xd3d5d1c5,
+0x557ff9c5, 0x6ff9c5a0, 0xd9c5a075, 0xc503f671,
+0x80657ff9, 0x756ff9c5, 0x71e9c5a0, 0xf9c502f6,
+0xc590557f, 0xb8d2fde9, 0x000002f8, 0xd475e9c5,
+0x1779e2c4, 0x9a830fd1, 0xc5000003, 0x80756ff9,
+0xe671e9c5, 0xfde9c502, 0x02fdb8d2, 0xe9c50000,
+0xc4905575, 0xd11779e2, 0x0377830f, 0x85c70000,
+0xffffff7c, 0x00000003, 0xe5d5e1c5, 0x7c856348,
+0xc4ffffff, 0xd06ef9e1, 0xd2f1d9c5, 0xff7c85c7,
+0x0002ffff, 0x63480000, 0xffff7c85, 0xf9e1c4ff,
+0xd9c5f06e, 0xf9c5e6f1, 0xc590657f, 0xb8e4fdd9,
+0x00000310, 0xe275d9c5, 0x1779e2c4, 0x22830fe1,
+0x48000003, 0xff7c8563, 0xe1c4ffff, 0xc5f06ef9,
+0xc5d6e1e9, 0xb8d2fde9, 0x00000314, 0x5575e9c5,
+0x79e2c490, 0x830fd117, 0x000002f9, 0xf5d5e1c5,
+0x7d6ff9c5, 0xefd9c5e0, 0x65c1c5e4, 0xdbe9c5d4,
+0x7ff9c5d6, 0x698fa055, 0xe04599e8, 0x356ff9c5,
+0x000002ec, 0x7d6ff9c5, 0xf9c1c5e0, 0x7ff9c5fe,
+0xe98fe07d, 0xe05599e8, 0x00032cb8, 0xfde9c500,
+0x41c1c4fa, 0xe2c4f875, 0x0ff91779, 0x0002a483,
+0xf9d9c500, 0x31b8e07d, 0x8f000003, 0xd29940e9,
+0x5575e9c5, 0x79e2c4a0, 0x830fd117, 0x00000285,
+0x55d5d1c5, 0xd5d1c5c0, 0x7ff9c5fb, 0xc1c59055,
+0xc59055ee, 0x907deac1, 0x7d7ff9c5, 0xfde9c590,
+0xe1c59055, 0xb8c07dfd, 0x00000348, 0xd5d5e9c5,
+0xd775e9c5, 0x1779e2c4, 0x46830fd1, 0xc5000002,
+0xc5ebd5d1, 0x806d7ff9, 0x1d79e2c4, 0xe1c58055,
+0x4fb8da75, 0xc4000003, 0xd91779e2, 0x0223830f,
+0xf9c50000, 0xb8d05d6f, 0x00000354, 0x0949e2c4,
+0x75e1c5d3, 0x79e2c4d2, 0x830fd117, 0x00000205,
+0x5570fbc5, 0xf9c51bb0, 0xb8c06d6f, 0x00000359,
+0xd270fac5, 0x70f9c51b, 0xd1c54ed2, 0xe2c4d275,
+0x0fd11779, 0x0001dc83, 0x71c1c500, 0xf9c501f5,
+0xb8b0556f, 0x0000035e, 0xc6f941c5, 0x3df9c1c5,
+0x000001ec, 0xc178488f, 0xc1c408c0, 0x8ff8eb41,
+0xd2a368e8, 0x75e9c570, 0x79e2c4d5, 0x830fd117,
+0x000001a1, 0x5561d1c5, 0x69d1c5b0, 0xe9c5b07d,
+0x70b8d7f9, 0xc5000003, 0xc5d3d5e9, 0xbd1575e9,
+0xc4000001, 0xd11779e2, 0x0177830f, 0xe1c50000,
+0x8fb07dd5, 0xd4cd60e8, 0x7ff9c500, 0xc1c5807d,
+0xf9c5fa61, 0xc480656f, 0xe42379e2, 0xfc75c1c5,
+0x00037ab8, 0x79e2c400, 0x830ff917, 0x00000145,
+0xd261e9c5, 0xd261d9c5, 0x557ff9c5, 0x6ff9c590,
+0xe2c4807d, 0xc5e72479, 0xa0657ff9, 0xd275d9c5,
+0x000382b8, 0x79e2c400, 0x830fd117, 0x00000115,
+0x556ff9c5, 0xc5c031b0, 0xa8e56ff9, 0xc5047501,
+0xc5e26ff9, 0xf0657ff9, 0x45548b66, 0x548966f0,
+0xff489045, 0xf88348c0, 0xc5dc7508, 0xb8e4efd9,
+0x000003c4, 0xdc65e1c5, 0xa268e88f, 0xf9c530d5,
+0xc5905d6f, 0xa0557ff9, 0xd275e1c5, 0x1779e2c4,
+0xbe830fd1, 0xc5000000, 0xb0556ff9, 0x0003d4b8,
+0x69e3c400, 0xaac0650e, 0xdc75e1c5, 0x1779e2c4,
+0x9e830fd9, 0xc5000000, 0xe125dbe9, 0xc4000000,
+0xda0f69e3, 0x03e4b802, 0xd9c50000, 0xe1c5e6fd,
+0xf9c5dc75, 0xc490657f, 0xd91779e2, 0xf9c57773,
+0xc580557f, 0xb8dbefe1, 0x00000003, 0xc678e98f,
+0xe1c58055, 0xf9c5d26b, 0xff80557f, 0xc5ed75c8,
+0x07d2c5f9, 0x0003f8b8, 0xfa836600, 0x8f467524,
+0x65e278e9, 0x78e98fc0, 0xc5b055e2, 0xb8d46be9,
+0x00000401, 0xc678e98f, 0x6be9c5d2, 0x78e98fd3,
+0xe9c5d2c6, 0xe98fd36b, 0xc5d2c678, 0xc5d36be9,
+0xc5dbefe1, 0xc4d375e9, 0xd11779e2, 0x92e80773,
+0xf7fffff9, 0x00c3c9d8, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00020002, 0x00020002, 0x00020002, 0x00020002,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003320,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x8348e589, 0x708d18ec, 0xcf8944ff,
+0x45448966, 0x29f189ae, 0x01e183c7, 0x457c8966,
+0x85c9ffbe, 0x940f40c6, 0x4c8966c6, 0x0f40ce45,
+0xf229f6b6, 0x45548966, 0xc0ff48de, 0x09f88348,
+0xf9c5c875, 0xc5b07d6f, 0x807d7ff9, 0x5d6ff9c5,
+0x76f1c580, 0x0260b8c9, 0xe1c50000, 0xe2c4d775,
+0x0fd11779, 0x0003ef83, 0xfde1c500, 0xf9c5b055,
+0xc590557f, 0xb0756ff9, 0x000266b8, 0x71e9c500,
+0xe9c501f6, 0xc4905575, 0xd11779e2, 0x03c6830f,
+0xf9c50000, 0xc5907d6f, 0xb055f9c1, 0x557ff9c5,
+0x75e1c5a0, 0x6bb8a065, 0xc4000002, 0xe11779e2,
+0x03a2830f, 0xe1c50000, 0xc5c05deb, 0x805d7ff9,
+0x55dbe9c5, 0x6ff9c5c0, 0xc9c5a075, 0xc5c05def,
+0x8055dfe9, 0xe476d9c5, 0x000277b8, 0x75e9c500,
+0x79e2c4d3, 0x830fd117, 0x0000036c, 0x556ff9c5,
+0xd5e9c5b0, 0xe1c5c05d, 0x03621d75, 0xd3b80000,
+0xc4000002, 0xd91779e2, 0x034a830f, 0xe9c50000,
+0xc5d075e4, 0xd06d6ff9, 0x0002dcb8, 0xdbe9c500,
+0xfde1c5dd, 0x75e1c5dd, 0x79e2c4de, 0x830fd917,
+0x00000324, 0x557ff9c5, 0x6ff9c5a0, 0xd1c5a07d,
+0xc503f771, 0x806d7ff9, 0x756ff9c5, 0x71e1c5a0,
+0xf9c502f6, 0xc5905d7f, 0xb8dbfde1, 0x000002f8,
+0xdd75e1c5, 0x1779e2c4, 0xe9830fd9, 0xc5000002,
+0x807d6ff9, 0xd771e1c5, 0xfde1c502, 0x02fdb8db,
+0xe1c50000, 0xc4905d75, 0xd91779e2, 0x02c6830f,
+0x85c70000, 0xffffff7c, 0x00000003, 0x9d6ef9c5,
+0xffffff7c, 0xdbf1e9c5, 0xff7c85c7, 0x0002ffff,
+0xf9c50000, 0xff7cad6e, 0xe9c5ffff, 0xf9c5edf1,
+0xc5906d7f, 0xb8edfdd1, 0x00000310, 0xeb75d1c5,
+0x1779e2c4, 0x7d830fe9, 0xc5000002, 0x7cad6ef9,
+0xc5ffffff, 0xc5ddd1e1, 0xb8dbfde1, 0x00000314,
+0x5d75e1c5, 0x79e2c490, 0x830fd917, 0x00000258,
+0x7d6ff9c5, 0xefc9c5e0, 0x40e88ff6, 0xc505decd,
+0x8fdadbe1, 0x4599e069, 0xfdd9c5e0, 0xf9c5e06d,
+0x8fe06d7f, 0x6d99e0e9, 0x032cb8e0, 0xd1c50000,
+0xc1c4fdfd, 0xc4f87541, 0xf91779e2, 0x0216830f,
+0xc9c50000, 0xb8e075f9, 0x00000331, 0x9548e98f,
+0x75e1c5ed, 0x79e2c4dd, 0x830fd917, 0x000001f8,
+0x3a69e2c4, 0xe2c4c05d, 0xc06d3e69, 0x55fde9c5,
+0xfde1c5c0, 0x033fb8dd, 0xe1c50000, 0xe2c4d275,
+0x0fd11779, 0x0001cf83, 0x6ff9c500, 0x0001df2d,
+0x6ff9c500, 0x54b8d075, 0xc4000003, 0xd60951e2,
+0xd675e9c5, 0x1779e2c4, 0xa9830fd1, 0xc5000001,
+0xb05570fb, 0x6ff9c51b, 0x59b8c05d, 0xc5000003,
+0x1bd270fa, 0xd270f9c5, 0x75e1c54e, 0x79e2c4d2,
+0x830fd117, 0x00000180, 0xf371c1c5, 0x6ff9c501,
+0x5eb8b055, 0xc5000003, 0xc5c5f941, 0x8d3dfdc1,
+0x8f000001, 0xc0c17848, 0x41c1c408, 0xe88ff8eb,
+0x70d2a368, 0xd375e9c5, 0x1779e2c4, 0x45830fd1,
+0xc5000001, 0xb07d61e1, 0x5569e1c5, 0xfdd9c5b0,
+0x0370b8d2, 0xe9c50000, 0xe9c5d7f9, 0xc9c5d6ef,
+0xe9c5f4ef, 0xe9c5d6f9, 0x01521575, 0xe2c40000,
+0x0fd11779, 0x00010f83, 0x79e2c400, 0xc4b06533,
+0xd43379e2, 0x657ff9c5, 0x7ff9c590, 0xf9c5a055,
+0xc4b0756f, 0xd63379e2, 0xd475e9c5, 0x00039ab8,
+0x79e2c400, 0x830fd117, 0x000000dc, 0x656ff9c5,
+0x79e2c4b0, 0xf9c5d434, 0xc580557f, 0xa05575e9,
+0x0003a1b8, 0x79e2c400, 0x830fd117, 0x000000b8,
+0x556ff9c5, 0xc5c031b0, 0xa8e36ff9, 0xc5047501,
+0xc5e26ff9, 0xf0657ff9, 0x45548b66, 0x548966f0,
+0xff489045, 0xf88348c0, 0x8fdc7508, 0x55a2e8e8,
+0xf9c530d0, 0xb8905d6f, 0x000003c4, 0xd275e1c5,
+0x1779e2c4, 0xc57173d1, 0xb0556ff9, 0x0003d4b8,
+0x69e3c400, 0xaac0650e, 0xdc75e1c5, 0x1779e2c4,
+0xc55573d9, 0x9525dbe9, 0xc4000000, 0xda0f69e3,
+0x03e4b802, 0xd9c50000, 0xe1c5e5fd, 0xe2c4dc75,
+0x73d91779, 0x7ff9c533, 0x03ba8055, 0xc5000000,
+0x8fd2efe9, 0x4dd678e9, 0x69e2c480, 0xf9c5c92b,
+0xff804d7f, 0xc5ec75ca, 0x07c1c5f9, 0x24f88366,
+0x0003f8b8, 0xc2440f00, 0x0000c3c9, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0xfffefffe, 0xfffefffe, 0xfffefffe, 0xfffefffe,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002300,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i4[] = {
+0x000151e9, 0x01b84800, 0x02000000, 0x55000000,
+0x48e58948, 0x48e04589, 0x000003b8, 0x00000400,
+0x45894800, 0x0001b8e8, 0xc148c000, 0x894802e0,
+0x01b8f045, 0x48800000, 0x8948c001, 0xf9c5f845,
+0x8ff04d6f, 0x559e70e8, 0xe1c510e0, 0x41b8db76,
+0xc5000000, 0xc51576e9, 0xc4000005, 0xd31779e2,
+0x00ee830f, 0xd1c50000, 0x45b8edef, 0xc5000000,
+0xc4d1fad1, 0x654069e2, 0xfad9c5e0, 0x76d9c5e1,
+0x0005ab25, 0x79e2c400, 0x830fe317, 0x000000c4,
+0x4071e2c4, 0xd9c5e065, 0x49b8e1fa, 0xc5000000,
+0x992576d9, 0xc4000005, 0xe31779e2, 0x00a2830f,
+0xe88f0000, 0xe0559e68, 0x004db810, 0xe9c50000,
+0x058a1576, 0xe2c40000, 0x0fd31779, 0x00008383,
+0x6ff9c500, 0x0005873d, 0x6ff9c500, 0x49c5e075,
+0xe2c4c1fe, 0xb8e64041, 0x00000054, 0x55fed9c5,
+0x69c1c4f0, 0xe2c4d076, 0x73d31779, 0xfad1c557,
+0x51c1c4d6, 0x58b8e8fa, 0xc4000000, 0xd74069e2,
+0x7dfae9c5, 0x76c1c5f0, 0x79e2c4ed, 0x3473eb17,
+0x65fad9c5, 0xfac9c5f0, 0x005cb8e9, 0xd9c50000,
+0xe2c4e576, 0x73e31779, 0xfee9c51b, 0xf1c5f055,
+0x60b8cefa, 0xc5000000, 0xc4d176e9, 0xd31779e2,
+0xc0310273, 0xb855c35d, 0x00000001, 0x000020b9,
+0x05b94100, 0x48000000, 0x8348e589, 0x788d80c4,
+0xc88945ff, 0xbc854489, 0x2941fa89, 0x01e283c0,
+0x85448944, 0x01fa83cc, 0xe283d219, 0x85caff02,
+0x940f40f8, 0x855489c7, 0xb60f40dc, 0x89f929ff,
+0x48ec854c, 0x8348c0ff, 0xc27505f8, 0x7d6ff9c5,
+0x7ff9c5c0, 0xf9c5907d, 0xc590556f, 0xb8c976f1,
+0x00000260, 0xdf76e9c5, 0x1779e2c4, 0x4b830fd9,
+0xc5000004, 0xc05dfee9, 0x5d7ff9c5, 0x6ff9c5a0,
+0x66b8c07d, 0xc5000002, 0x01f772e1, 0x5d76e1c5,
+0x79e2c4a0, 0x830fd917, 0x00000422, 0x6d6ff9c5,
+0xfad1c5a0, 0xf9c5c05d, 0xc5b05d7f, 0xb05d76e9,
+0x00026bb8, 0x79e2c400, 0x830fd917, 0x000003fe,
+0x5d6ff9c5, 0x69e2c4d0, 0xc4c05540, 0xe34061e2,
+0x5d6ff9c5, 0xfee1c5c0, 0xe1c5d075, 0xc5d06dfa,
+0xb8d4fae9, 0x00000282, 0x4051e2c4, 0x76e9c5ee,
+0x79e2c4d5, 0x830fd117, 0x000003c2, 0x4061e2c4,
+0xe9c5d055, 0x04061576, 0xd3b80000, 0xc4000002,
+0xd11779e2, 0x03a4830f, 0xe1c50000, 0xc5e055ef,
+0xc5d07ef9, 0x90557ff9, 0x2869e2c4, 0x6348d055,
+0x9848d055, 0xc2af0f48, 0xd8556348, 0xb0458948,
+0x98456348, 0xc2af0f48, 0xb8458948, 0x0002ecb8,
+0x76e9c500, 0xe2c4b055, 0x0fd11779, 0x00035d83,
+0x61e2c400, 0xc5e06540, 0xb0657ff9, 0x7d6ff9c5,
+0x72d1c5b0, 0xf9c503f7, 0xc5906d7f, 0xb07d6ff9,
+0xf772e9c5, 0x7ff9c502, 0xe9c5a055, 0xf8b8d2fe,
+0xc5000002, 0xc4d576e9, 0xd11779e2, 0x031c830f,
+0xf9c50000, 0xc5906d6f, 0x02e572e9, 0xd2fee9c5,
+0x0002fdb8, 0x76e9c500, 0xe2c4a055, 0x0fd11779,
+0x0002f983, 0x8c45c700, 0x00000003, 0x8c456348,
+0x6ef9e1c4, 0xf2d9c5d0, 0x8c45c7d2, 0x00000002,
+0x8c456348, 0x6ef9e1c4, 0xf2d9c5e8, 0x7ff9c5e5,
+0xd9c5a065, 0x10b8e4fe, 0xc5000003, 0xc4e276d9,
+0xe11779e2, 0x02b4830f, 0x63480000, 0xe1c48c45,
+0xc5f86ef9, 0xc5d7e2e9, 0xb8d2fee9, 0x00000314,
+0x5576e9c5, 0x79e2c4a0, 0x830fd117, 0x0000028e,
+0x7d6ff9c5, 0xefd1c5f0, 0x61e2c4ed, 0xc5e06540,
+0xc5d566c1, 0xc5d4dbe9, 0xb0557ff9, 0x9ae8e98f,
+0x01b8f075, 0xc5000000, 0xc5f86ef9, 0x00e770f9,
+0x7d6ff9c5, 0xfac1c5f0, 0x7ff9c5fc, 0xe98ff07d,
+0xf0559ae8, 0x00032cb8, 0xfee9c500, 0x76c1c5fa,
+0x79e2c4f6, 0x830ff117, 0x00000232, 0x75fad1c5,
+0x0331b8f0, 0xe98f0000, 0xc5d29a48, 0xb05576e9,
+0x1779e2c4, 0x13830fd1, 0xc5000002, 0xe0756ff9,
+0x4049e2c4, 0xf9c5d055, 0xc4a0557f, 0xfb4049e2,
+0x3d41e2c4, 0xe2c4a055, 0xa07d3941, 0x7d7ff9c5,
+0xfee9c5a0, 0xe1c5a055, 0xb8d07dfe, 0x00000348,
+0x4069e2c4, 0x76e9c5d6, 0x79e2c4d7, 0x830fd117,
+0x000001ca, 0x4049e2c4, 0x7ff9c5f3, 0xe2c49075,
+0x90551e79, 0xda76e1c5, 0x00034fb8, 0x79e2c400,
+0x830fd917, 0x000001a6, 0x5d6ff9c5, 0x0354b8e0,
+0xe2c40000, 0xc5e30a59, 0xc4e476e1, 0xe11779e2,
+0x0188830f, 0xf9c50000, 0xc5d0656f, 0xc05570f9,
+0x0359b81b, 0xd9c50000, 0xe2c4d276, 0x0fd11779,
+0x00016983, 0x62d9c500, 0xd9c5c055, 0xc5c0756a,
+0xb8d6fae9, 0x00000002, 0x4069e2c4, 0x6ef9c5d3,
+0x0370b8f0, 0xf9c50000, 0xc500f670, 0xc4d676e9,
+0xd11779e2, 0x0134830f, 0xe2c40000, 0xc0554061,
+0xce60e88f, 0xf9c500f5, 0xc590557f, 0xc5f662e9,
+0x907d6ff9, 0x2579e2c4, 0x76e9c5d7, 0x037ab8d6,
+0xe2c40000, 0x0fd11779, 0x00010183, 0x66e1c500,
+0x6ff9c5dd, 0xe3c4c055, 0xa4651679, 0x79e3c401,
+0x03ac6516, 0x0003c4b8, 0x7ef9c500, 0xe3c4a055,
+0xa8551679, 0x68e88f02, 0xc530d4a2, 0xa0656ff9,
+0x557ff9c5, 0x76d9c5b0, 0x79e2c4d2, 0x830fd117,
+0x000000ba, 0x5d6ff9c5, 0x03d4b8c0, 0xe3c40000,
+0xd0550e61, 0x76d9c5cc, 0x79e2c4e2, 0x830fe117,
+0x0000009a, 0x000003b8, 0x61e3c400, 0xc504e30f,
+0xb8e86ef9, 0x00000001, 0xd570f9c5, 0x6ef9c500,
+0x03e4b8e8, 0xe1c50000, 0xf9c5d2db, 0xc500ed70,
+0xc5d5fee9, 0xa0557ff9, 0xd276d9c5, 0x1779e2c4,
+0xc55b73d1, 0x905d7ff9, 0xdbefe1c5, 0x0261e2c4,
+0xf9c59055, 0xc490557f, 0x550261e2, 0x03f8b890,
+0xe3c40000, 0x03d21679, 0x557ff9c5, 0x0afa8390,
+0xf9c52c75, 0xc4c06d6f, 0x550651e2, 0x0401b8d0,
+0xe2c40000, 0xc4d30269, 0xd30269e2, 0xd376e9c5,
+0x1779e2c4, 0xe80773d1, 0xfffff9e9, 0xc3c9d8f7,
+0x00000008, 0x00000009, 0x00000008, 0x00000005,
+0xfffffff8, 0xfffffff7, 0xfffffff8, 0xfffffffb,
+0x00000000, 0x00000003, 0x00000004, 0x00000003,
+0x00000000, 0xfffffffd, 0xfffffffc, 0xfffffffd,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0003200,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0xc5cc7504, 0xc07d6ff9,
+0x7d7ff9c5, 0x6ff9c590, 0xf1c5905d, 0x60b8c976,
+0xc5000002, 0xc4d776e1, 0xd11779e2, 0x03bd830f,
+0xe1c50000, 0xc5c055fe, 0xa0557ff9, 0x7d6ff9c5,
+0x0266b8c0, 0xe9c50000, 0xc501f772, 0xa05576e9,
+0x1779e2c4, 0x94830fd1, 0xc5000003, 0xa07d6ff9,
+0x55fac1c5, 0x7ff9c5c0, 0xe1c5b055, 0xb8b06576,
+0x0000026b, 0x1779e2c4, 0x70830fe1, 0xc5000003,
+0xd05debe1, 0x5d7ff9c5, 0xdbe9c590, 0xf9c5d055,
+0xc5b0756f, 0xd05defc9, 0x55dfe9c5, 0x76d9c590,
+0x0277b8e4, 0xe9c50000, 0xe2c4d376, 0x0fd11779,
+0x00033a83, 0x6ff9c500, 0xe2c4c05d, 0xd0554061,
+0x1576e9c5, 0x00000338, 0x0002d3b8, 0x79e2c400,
+0x830fd117, 0x00000317, 0x55efe1c5, 0x7ef9c5e0,
+0x7ff9c5d0, 0xe9c59055, 0x8bd055f4, 0x0f48d055,
+0x558bc2af, 0x458948d8, 0x98458bb0, 0xc2af0f48,
+0xb8458948, 0x0002ecb8, 0x76e9c500, 0xe2c4b055,
+0x0fd11779, 0x0002d683, 0x7ff9c500, 0xf9c5b05d,
+0xc5b07d6f, 0x03f772d1, 0x6d7ff9c5, 0x6ff9c590,
+0xe9c5b075, 0xc502f672, 0xa0557ff9, 0xd2fee9c5,
+0x0002f8b8, 0x76e9c500, 0x79e2c4d5, 0x830fd117,
+0x0000029b, 0x7d6ff9c5, 0x72e9c590, 0xe9c502d7,
+0xfdb8d2fe, 0xc5000002, 0xa05576e9, 0x1779e2c4,
+0x78830fd1, 0xc7000002, 0x00038c45, 0xf9c50000,
+0xc58c556e, 0xc7d2f2e1, 0x00028c45, 0xf9c50000,
+0xc58c6d6e, 0xc5edf2e1, 0xa06d7ff9, 0xedfed1c5,
+0x000310b8, 0x76d1c500, 0x79e2c4ea, 0x830fe917,
+0x0000023b, 0x6d6ef9c5, 0xd2e9c58c, 0xfee9c5d5,
+0x0314b8d2, 0xe9c50000, 0xc4a05576, 0xd11779e2,
+0x0219830f, 0xf9c50000, 0xc5f07d6f, 0x8ff6efc9,
+0xd6ce40e8, 0xdbe9c505, 0xe8e98fd3, 0xc5f07d9a,
+0xf06dfed9, 0x6d7ff9c5, 0xe8e98ff0, 0xb8f06d9a,
+0x0000032c, 0xc5fe51c5, 0xff76b9c5, 0x1779e2c4,
+0xd8830ff9, 0xc5000001, 0xf075fac9, 0x000331b8,
+0x48e98f00, 0xe9c5ed96, 0xe2c4d576, 0x0fd11779,
+0x0001ba83, 0x61e2c400, 0xc4d0553b, 0x6d3f61e2,
+0xfee1c5d0, 0xe9c5d05d, 0x3fb8d5fe, 0xc5000003,
+0xc4d376e9, 0xd11779e2, 0x0191830f, 0x01b80000,
+0xc5000000, 0xe0756ff9, 0xf86ef9c5, 0x000354b8,
+0x70f9c500, 0xe2c400ef, 0xc5d60a51, 0xc4d676e9,
+0xd11779e2, 0x0165830f, 0xf9c50000, 0xc5d05d6f,
+0xc05570f9, 0x0359b81b, 0xe1c50000, 0xe2c4d276,
+0x0fd11779, 0x00014683, 0x62e1c500, 0xe1c5c07d,
+0xc5c0556a, 0xb8d2fed9, 0x00000002, 0xd7fae9c5,
+0xd6efe9c5, 0xf4efc9c5, 0xd6fae9c5, 0xf06ef9c5,
+0x000370b8, 0x70f9c500, 0xe9c500e6, 0xe2c4d476,
+0x0fd11779, 0x00010683, 0x79e2c400, 0xc5c06535,
+0xc0756ff9, 0x3579e2c4, 0x76e9c5d6, 0x039ab8d4,
+0xe2c40000, 0x0fd11779, 0x0000e283, 0x6ff9c500,
+0xe3c4c055, 0xa45d1679, 0x03c4b801, 0xe3c40000,
+0xac5d1679, 0x7ef9c503, 0xe3c4a055, 0xa8551679,
+0x6ff9c502, 0xe88fa065, 0xe055a2e8, 0x76d9c530,
+0x79e2c4d2, 0x830fd117, 0x000000a3, 0x5d6ff9c5,
+0x03d4b8c0, 0xe3c40000, 0xd0550e61, 0x76d9c5cc,
+0x79e2c4e2, 0x830fe117, 0x00000083, 0x000003b8,
+0x61e3c400, 0xc504e30f, 0xb8f06ef9, 0x000003e4,
+0xd670f9c5, 0xdbe1c500, 0xfee9c5d2, 0x76d9c5d5,
+0x79e2c4d2, 0x5773d117, 0x5d7ff9c5, 0xefe1c590,
+0x61e2c4db, 0xc5905502, 0x90557ff9, 0x0261e2c4,
+0xf8b89055, 0xc4000003, 0xd21679e3, 0x0afa8303,
+0xf9c52d75, 0xc4c0656f, 0x550659e2, 0xc4c031d0,
+0xd30269e2, 0x0269e2c4, 0x76e9c5d3, 0x79e2c4d3,
+0x920fd117, 0x01f883c0, 0x0125c019, 0xc9000004,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002120,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d07d6f, 0xa07d7ff9,
+0x556ff9c5, 0x76e1c5a0, 0x0260b8db, 0xe2c40000,
+0xc4cf2969, 0xcb1779e2, 0x0385830f, 0xe9c50000,
+0xc5d04dd4, 0xb04d7ff9, 0x7d6ff9c5, 0x0266b8d0,
+0xf1c50000, 0xc401f773, 0x4d2971e2, 0x79e2c4b0,
+0x830fcb17, 0x0000035b, 0x7d6ff9c5, 0xfbc1c5b0,
+0xf9c5d04d, 0xc4c04d7f, 0x4d2969e2, 0x026bb8c0,
+0xe2c40000, 0x0fcb1779, 0x00033683, 0x6ff9c500,
+0xf9c5d065, 0xc4b1ca70, 0xcc4071e2, 0xd4f4e9c5,
+0xcb78e98f, 0x73f1c5c9, 0xe9c520f1, 0xf9c5e1d4,
+0xc5e04d6f, 0xb1d170f9, 0x4069e2c4, 0xf4f1c5d1,
+0x78e98fc9, 0xe9c5d2cb, 0xc520f273, 0xc5cad4f1,
+0xd06d6ff9, 0x7dd4d1c5, 0xfbd1c5e0, 0xd9c5e075,
+0x82b8e1fb, 0xc5000002, 0xb1d670f9, 0xf7f4c9c5,
+0x4069e2c4, 0x78e98fd7, 0xe9c5d2cb, 0xc520f273,
+0xc4f2d4c9, 0xe62959e2, 0x1779e2c4, 0xb0830fe3,
+0xc5000002, 0xe04d6ff9, 0xd570f9c5, 0x69e2c4b1,
+0xd1c5e140, 0xe98fc9f4, 0xc5e4cb78, 0x20f473d9,
+0xccd4f1c5, 0x000002b8, 0xf9e1c400, 0xd3b8e06e,
+0xc5000002, 0xc4e46cd9, 0xcc2971e2, 0x1779e2c4,
+0x6c830fcb, 0xb8000002, 0x00000001, 0x6ef9e1c4,
+0xc88348f8, 0xc1e3c4ff, 0xc401e022, 0xd44069e2,
+0xf4f4d1c5, 0xcb78e98f, 0x73e9c5d2, 0xc9c520f2,
+0xf9c5d2d4, 0xc5c0557f, 0xc04d6ff9, 0xf173b9c5,
+0x7f79c503, 0xf9c5a045, 0xc5c04d6f, 0x02f173f1,
+0x4d7ff9c5, 0xd4f1c5b0, 0x02f8b8c9, 0xc2c40000,
+0xc4c82971, 0xcb1779e2, 0x0205830f, 0xc7480000,
+0xfffffec0, 0xf9e1c4ff, 0xf1c5c86e, 0xe98fc96c,
+0xa04d9b70, 0xc9d4f1c5, 0x0002fdb8, 0x71e2c400,
+0xc4b04d29, 0xcb1779e2, 0x01d5830f, 0x45c70000,
+0x0000039c, 0x45634800, 0xf9e1c49c, 0xe9c5c86e,
+0x45c7c9f3, 0x0000029c, 0x45634800, 0xf961c49c,
+0xc1c4c86e, 0xc5d1f369, 0xb0557ff9, 0xd2d4e9c5,
+0x000310b8, 0x69e2c400, 0xe2c4d129, 0x0fd31779,
+0x00018e83, 0x45634800, 0x3941c49c, 0xe1c4c0ef,
+0xc5d06ef9, 0xc5d26ce9, 0x8fd2fbb9, 0xc99b68e9,
+0xc9d4f1c5, 0x000314b8, 0x71e2c400, 0xc4b04d29,
+0xcb1779e2, 0x0159830f, 0xf9c50000, 0xc4b1cc70,
+0xcd4071e2, 0x6d6ff9c5, 0x78e98ff0, 0xf1c5c9cb,
+0xc520f173, 0xc4f1d4c9, 0xc83751c2, 0xcedbf1c5,
+0x4d7ff9c5, 0xf0e98fc0, 0xc5f0559b, 0xf06d6ff9,
+0xff6cc1c5, 0xeffbd1c5, 0x6d7ff9c5, 0xf0e98ff0,
+0xb8f04d9b, 0x0000032c, 0x4d7ff9c5, 0xd4f1c5b0,
+0x71e2c4c9, 0xe2c4ca29, 0x0fcb1779, 0x0000f283,
+0xfbb9c500, 0xe98ff04d, 0xb04d9b70, 0x000331b8,
+0x71e2c400, 0xc4c04d29, 0xcb1779e2, 0x00d1830f,
+0xf9c50000, 0xc5e0756f, 0xd04d70f9, 0x0359b84e,
+0xe2c40000, 0xc4c92949, 0xcb1779e2, 0x00b1830f,
+0xc9c50000, 0xc5d04d6c, 0xd0556dc9, 0xcafbf1c5,
+0x000370b8, 0x70f9c500, 0xf1c5b1d1, 0xe2c4ccf4,
+0x8fd44069, 0xd2cb78e9, 0xf273e9c5, 0xd4f1c520,
+0x71e2c4ca, 0xe2c4cf29, 0x73cb1779, 0x59c2c476,
+0xf9c5e037, 0xb8d04d6f, 0x000003c4, 0x16f9e3c4,
+0xc501b875, 0xb04dd6f9, 0xa270e88f, 0xf9c540ce,
+0xc4b0656f, 0xc92959e2, 0x1779e2c4, 0xc54473cb,
+0xd04d6ff9, 0x0003d4b8, 0x71e3c400, 0xf0e06d0e,
+0x2959e2c4, 0x79e2c4e5, 0x2773e317, 0x0f71e3c4,
+0xf1c508e1, 0xc031cfdb, 0xcfd4f1c5, 0x2971e2c4,
+0x79e2c4cc, 0x920fcb17, 0x01f883c0, 0xe425c019,
+0x5d000003, 0x000000c3,
+0001745,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d0756f, 0xa0757ff9,
+0x5d6ff9c5, 0x76f1c5a0, 0x0260b8c9, 0xe2c40000,
+0xc4d62961, 0xd11779e2, 0x02d9830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x0266b8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x000002af, 0x756ff9c5, 0xfbc9c5b0,
+0xf9c5d055, 0xc4c0557f, 0x652961e2, 0x026bb8c0,
+0xe2c40000, 0x0fe11779, 0x00028a83, 0xebe1c500,
+0xf9c5e05d, 0xc5a05d7f, 0xe055dbe9, 0x7d6ff9c5,
+0xefc1c5c0, 0xe9c5e05d, 0xe9c5d1ef, 0xb8a055db,
+0x00000277, 0x2969e2c4, 0x79e2c4d3, 0x830fd117,
+0x00000253, 0x556ff9c5, 0x6ff9c5d0, 0xf9c5e05d,
+0xc4b1e270, 0xe34059e2, 0xdbf4e9c5, 0xcb78e98f,
+0x73d9c5e4, 0xe1c520f4, 0x02b8dcd4, 0xc4000000,
+0xe06ef9e1, 0x0002d3b8, 0x6cd9c500, 0x61e2c4e4,
+0xe2c4dc29, 0x0fd91779, 0x00020a83, 0x7ff9c500,
+0xf9c5c055, 0xc5c0756f, 0x03f673d9, 0x657ff9c5,
+0x6ff9c5a0, 0xe1c5c07d, 0xc502f773, 0xb05d7ff9,
+0xdbd4e1c5, 0x0002f8b8, 0x61e2c400, 0xe2c4dc29,
+0x0fd91779, 0x0001ce83, 0x6ff9c500, 0xe1c5a06d,
+0xc502d573, 0xb8dbd4e1, 0x000002fd, 0x2961e2c4,
+0xe2c4b05d, 0x0fd91779, 0x0001aa83, 0x9c45c700,
+0x00000003, 0x5d6ef9c5, 0xf3e9c59c, 0x9c45c7db,
+0x00000002, 0x656ef9c5, 0xf3e9c59c, 0x7ff9c5d4,
+0xe9c5b055, 0x10b8d2d4, 0xc4000003, 0xd32969e2,
+0x1779e2c4, 0x6c830fd1, 0xc5000001, 0x9c556ef9,
+0xd2d3e1c5, 0xd2d4e9c5, 0x000314b8, 0x69e2c400,
+0xc4b05529, 0xd11779e2, 0x0149830f, 0xf9c50000,
+0xc5f0756f, 0x8fd2efe9, 0xd2cf48e8, 0xdbe9c505,
+0xf9c5d055, 0x8fc0557f, 0x5d9be8e9, 0xd4f1c5f0,
+0xf9c5f065, 0x8ff0657f, 0x559be8e9, 0x032cb8f0,
+0xf9c50000, 0xc5b0557f, 0xc4d2d4e9, 0xd32969e2,
+0x1779e2c4, 0xfc830fd1, 0xc5000000, 0xc5d2efe9,
+0xf055fbe9, 0x000331b8, 0x68e98f00, 0xc4b05597,
+0x552969e2, 0x79e2c4c0, 0x830fd117, 0x000000d7,
+0x656ff9c5, 0x70f9c5e0, 0xb84ed055, 0x00000359,
+0x2959e2c4, 0x79e2c4d2, 0x830fd117, 0x000000b7,
+0xffc88348, 0x6ef9e1c4, 0x6cd9c5e8, 0xd9c5d05d,
+0xc5d0556d, 0xb8d2d4f1, 0x00000001, 0xd3fbe9c5,
+0xd9efd1c5, 0xd5efe9c5, 0xd3fbe9c5, 0x6ef9e1c4,
+0x0370b8d8, 0xe1c50000, 0xe2c4db6c, 0xc4d32969,
+0xd11779e2, 0xf9c57173, 0xc4d0556f, 0x6516f9e3,
+0xc4b801b8, 0xc5000003, 0xb055d6f9, 0xa268e88f,
+0xf9c550d4, 0xc4b0656f, 0xd22959e2, 0x1779e2c4,
+0xc54473d1, 0xd0556ff9, 0x0003d4b8, 0x69e3c400,
+0xf0e06d0e, 0x2959e2c4, 0x79e2c4e5, 0x2773e117,
+0x0f69e3c4, 0xe9c508e2, 0xc031d3db, 0xd3d4e9c5,
+0x2969e2c4, 0x79e2c4d4, 0x920fd117, 0x01f883c0,
+0xe425c019, 0x5d000003, 0x000000c3,
+0001471,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x60b8c976, 0xc5000002, 0x00dfc2e8, 0x0e79e2c4,
+0x9e830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x66b8d05d, 0xc5000002, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x00000475,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x026bb800, 0xe2c40000, 0x0fd90e79,
+0x00045083, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x82b8d45c, 0xc5000002, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x16830fd1, 0xc5000004,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x0000028b, 0x0e79e2c4, 0xf2830fd1,
+0xc4000003, 0x1d1879e2, 0x000003f4, 0x6d28f8c5,
+0x028eb8f0, 0xd0c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x000003c1, 0x5553f8c5, 0x29f8c5d0, 0xf8c5a055,
+0xc5a05553, 0xd05d28f8, 0x000296b8, 0x5bf9c500,
+0x5bf8c5d2, 0xc2e8c5d2, 0xe2c400d3, 0x0fd10e79,
+0x00039083, 0x59e0c500, 0x29f8c5d3, 0xf8c5a055,
+0xc5a05552, 0xb05529f8, 0x5528f8c5, 0x029db8b0,
+0xf8c50000, 0xf9c5e253, 0xf8c5e45b, 0xe0c5e45b,
+0xc400dcc2, 0xd90e79e2, 0x0357830f, 0xf8c50000,
+0xc5d06528, 0xc5d25bf9, 0xb8d25bf8, 0x0000029f,
+0xdc53f8c5, 0xdb5bf9c5, 0xdb5bf8c5, 0xd3c2e8c5,
+0x79e2c400, 0x830fd10e, 0x00000329, 0xd459d8c5,
+0x5529f8c5, 0x51f8c5a0, 0xa7b8a055, 0xc5000002,
+0x00d4c2e8, 0x0e79e2c4, 0x06830fd1, 0xc4000003,
+0x1d1879e2, 0x00000328, 0xe45ee0c5, 0x6529f8c5,
+0x79e3c4a0, 0x0ba05508, 0x0002afb8, 0xc2e8c500,
+0x00030a15, 0xe2c40000, 0x0fd10e79, 0x0002d483,
+0x78e98f00, 0xc5d05580, 0xb8f657c8, 0x000002b6,
+0xd6c2e8c5, 0x79e2c400, 0x830fd10e, 0x000002b5,
+0x5558e0c5, 0x5ee0c5d0, 0x29f8c5d2, 0xe98fa055,
+0xa0558078, 0x55c2e8c5, 0xbcb800a0, 0xc4000002,
+0xd10e79e2, 0x028b830f, 0xe2c40000, 0x91151879,
+0xc5000002, 0xd05559e8, 0x5529f8c5, 0x79e3c4a0,
+0x0ba05508, 0x8078e98f, 0xe8c5a065, 0xc6b8d458,
+0xc5000002, 0xa055c2e8, 0x79e2c400, 0x830fd10e,
+0x00000251, 0x5559d0c5, 0x59d0c5e0, 0xf8c5d065,
+0xc5b05529, 0xb0555fd8, 0x655dd8c5, 0x29f8c5b0,
+0xe8c5b065, 0xc5b05558, 0xd07d28f8, 0x000348b8,
+0x58c0c500, 0xe8c5e065, 0xe8c5d559, 0xc400d4c2,
+0xd10e79e2, 0x020b830f, 0xe3c40000, 0xd0550479,
+0x0359b81b, 0xe8c50000, 0x00e055c2, 0x0e79e2c4,
+0xee830fd1, 0xb8000001, 0x00000003, 0x6528f8c5,
+0x6ef9c5e0, 0x035eb8f8, 0xf9c50000, 0xc500ff70,
+0xc5d45bf9, 0xc4d7fee9, 0x754849e3, 0xd8c520d0,
+0xc400f6c2, 0xf10e79e2, 0x01b7830f, 0xf8c50000,
+0xb8d07d28, 0x00000362, 0xd458c0c5, 0x15c2e8c5,
+0x000001eb, 0x79e2c400, 0x830fd10e, 0x00000195,
+0x5514d8c5, 0x15d8c5d0, 0xe8c5d075, 0x70b8d65c,
+0xc4000003, 0x351879e2, 0x0000018c, 0xd559e8c5,
+0xd6c2e8c5, 0x79e2c400, 0x830fd10e, 0x00000165,
+0x5512fac5, 0x79e2c4d0, 0x016e3518, 0xe8c50000,
+0xb8d0555c, 0x000003b1, 0x1879e2c4, 0x00015f3d,
+0x58c8c500, 0x59c8c5f5, 0xc2e8c5f7, 0xe2c400d6,
+0x0fd10e79, 0x00012c83, 0x16fac500, 0xd0c5d075,
+0xf8c5db58, 0xb8d05528, 0x000003b8, 0xf25cc8c5,
+0xdf59e0c5, 0xdbc2c8c5, 0x79e2c400, 0x830fd90e,
+0x00000101, 0xdb57e0c5, 0x5511fac5, 0x79e3c4b0,
+0x02b85517, 0x1779e3c4, 0xc501b465, 0x01edc2e0,
+0x1779e3c4, 0xb803bc65, 0x000003c4, 0xa268e88f,
+0xf8c550d4, 0xc5b06528, 0x00d2c2d8, 0x0e79e2c4,
+0xbe830fd1, 0xc5000000, 0xd06d28f8, 0x0003d4b8,
+0x51e3c400, 0x0ae0550c, 0xe2c2d8c5, 0x79e2c400,
+0x830fe10e, 0x0000009d, 0x6d28f8c5, 0xd0d3c5d0,
+0xf8c5e055, 0xc5d07d28, 0xe065d0c3, 0x0003ddb8,
+0xc2e8c500, 0xe2c400d4, 0x73d10e79, 0x28f8c578,
+0xe3c4d065, 0xe0554059, 0x03ecb8f1, 0xe8c50000,
+0x009915c2, 0xc4000000, 0xd10e79e2, 0xf8c55773,
+0xc5a06529, 0xa0557ce3, 0x5529f8c5, 0x7ce3c5a0,
+0xe8c5a055, 0xc5ffd2c6, 0x55152ef8, 0x7a000000,
+0xc52d752f, 0xd06d28f8, 0x557dd3c5, 0xc5c031e0,
+0xc5d37ceb, 0xc5d37ceb, 0x00d3c2e8, 0x0e79e2c4,
+0xc0920fd1, 0x1901f883, 0x040125c0, 0x05eb0000,
+0x0003f8b8, 0x00c35d00, 0x00000000, 0x00000000,
+0x80000000, 0x3e800000, 0x40000000, 0xbf800000,
+0x3f000000, 0x41200000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0002560,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x04f20d10, 0xfbc50000,
+0x04ba1510, 0x8b480000, 0x0004bb05, 0x11fbc500,
+0x8948c04d, 0xfbc5e845, 0xc5d05511, 0xe04d11fb,
+0x5511fbc5, 0x11fbc5c8, 0xf9c5d84d, 0xc5c07d28,
+0x907d29f9, 0x5528f9c5, 0x76f1c590, 0x0260b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x0469830f,
+0xe9c50000, 0xc5c05d58, 0xa05d29f9, 0x5d28f9c5,
+0x0266b8c0, 0xe1c50000, 0xe1c5db58, 0x00a05dc2,
+0x0f79e2c4, 0x40830fd9, 0xc5000004, 0xa07d28f9,
+0x5d5cc1c5, 0x29f9c5c0, 0xe9c5b05d, 0x00b05dc2,
+0x00026bb8, 0x79e2c400, 0x830fd90f, 0x0000041b,
+0x5d28f9c5, 0x59e9c5d0, 0xe1c5c055, 0xf9c5e359,
+0xc5c05d28, 0xd07558e1, 0x6d5ce1c5, 0x5ce9c5d0,
+0x0282b8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x03e1830f, 0xe1c50000, 0xc5e05559,
+0x905529f9, 0x5d5ee1c5, 0xc2e9c5e0, 0x8bb800d3,
+0xc4000002, 0xd10f79e2, 0x03bd830f, 0xf9c50000,
+0xc5e05d28, 0xc52512fb, 0xb8000003, 0x0000028e,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5c0, 0xe9c59055,
+0xc400d4c2, 0xd10f79e2, 0x038d830f, 0xf9c50000,
+0xc5c0555a, 0xc5d253f8, 0xc5d25af8, 0x905529f9,
+0x555af9c5, 0x53f8c590, 0x28f9c5d2, 0x96b8c06d,
+0xc5000002, 0xc5d25af8, 0xc5d2e6fb, 0xc5d2e6fa,
+0x00d5c2e9, 0x0f79e2c4, 0x4c830fd1, 0xc5000003,
+0xc5d559d1, 0x905529f9, 0x555af9c5, 0x52f8c590,
+0x5af8c5d2, 0x29f9c5d2, 0xf9c5a055, 0xb8a06528,
+0x0000029d, 0xd45af9c5, 0xd253f8c5, 0xd25af8c5,
+0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5, 0x79e2c400,
+0x830fe90f, 0x00000303, 0x7528f9c5, 0xe6fbc5c0,
+0xe6fac5e4, 0x029fb8e4, 0xf9c50000, 0xf8c5d65a,
+0xf8c5d253, 0xfbc5d25a, 0xfac5d2e6, 0xd9c5d2e6,
+0xc400e2c2, 0xe10f79e2, 0x02cd830f, 0xc9c50000,
+0xf9c5d659, 0xc5905529, 0x905551f9, 0xd6c2e9c5,
+0x02a7b800, 0xe2c40000, 0x0fd10f79, 0x0002aa83,
+0x12fbc500, 0x0002d72d, 0x5ed1c500, 0x29f9c5f6,
+0xe3c49075, 0x90550979, 0x02afb80b, 0xe9c50000,
+0x02b915c2, 0xc4000000, 0xd10f79e2, 0x0279830f,
+0xe98f0000, 0xc0558178, 0xe457d9c5, 0x0002b6b8,
+0xc2e9c500, 0xe2c400d4, 0x0fd10f79, 0x00025a83,
+0x58d1c500, 0xd1c5c055, 0xf9c5d25e, 0x8f905529,
+0x558178e9, 0xc2e9c590, 0xb8009055, 0x000002bc,
+0x0f79e2c4, 0x30830fd1, 0xc5000002, 0x451512fb,
+0xc5000002, 0xc05559e9, 0x5529f9c5, 0x79e3c490,
+0x0b905509, 0x8178e98f, 0xe9c59075, 0xc6b8d658,
+0xc5000002, 0x9055c2e9, 0x79e2c400, 0x830fd10f,
+0x000001f7, 0x5559e1c5, 0x59e1c5d0, 0xf9c5c075,
+0xc5a05529, 0xa0555fc9, 0x755dc9c5, 0x29f9c5a0,
+0xe9c5a075, 0xc5a05558, 0xc07d28f9, 0x000348b8,
+0x58c1c500, 0xe9c5d075, 0xe9c5d359, 0xc400d6c2,
+0xd10f79e2, 0x01b1830f, 0xe3c40000, 0xc0550579,
+0x0359b801, 0xe9c50000, 0x00d055c2, 0x0f79e2c4,
+0x94830fd1, 0xb8000001, 0x00000001, 0x7528f9c5,
+0x6ef9c5d0, 0x035eb8f8, 0xf9c50000, 0xc500ff70,
+0xc5d6e6fb, 0xc5d7fee9, 0xc07d28f9, 0x2579e2c4,
+0x73e9c5d2, 0xf9c501f2, 0xc4f0557f, 0x5549d9e3,
+0xc9c570f0, 0xc400d2c2, 0xd10f79e2, 0x0149830f,
+0xc9c50000, 0xc5c05516, 0xc07d28f9, 0xff15c9c5,
+0xd75ce9c5, 0x000370b8, 0x59e9c500, 0xc2e9c5d3,
+0xe2c400d5, 0x0fd10f79, 0x00011e83, 0x120ff200,
+0xfbc5c06d, 0x011e3d12, 0xe1c50000, 0xf9c5ff58,
+0xc5c05528, 0x2505127b, 0xb8000001, 0x000003b1,
+0xea5cd1c5, 0x5941c1c4, 0xc2d1c5f8, 0xe2c400ef,
+0x0fe90f79, 0x0000e283, 0xc2d9c500, 0xf9c501e3,
+0xb8a05513, 0x000003c4, 0x7517f9c5, 0x28f9c5a8,
+0xe88fa05d, 0x40d6a268, 0xd2c2e1c5, 0x79e2c400,
+0x830fd10f, 0x000000b3, 0x6d28f9c5, 0x03d4b8c0,
+0xe3c40000, 0xd0550d51, 0xc2e1c502, 0xe2c400da,
+0x0fd90f79, 0x00009283, 0x28f9c500, 0xd9c5c065,
+0xc5d055d0, 0xc07d28f9, 0x5dd0c1c5, 0x03ddb8d0,
+0xe9c50000, 0xc400d3c2, 0xd10f79e2, 0xf9c56d73,
+0xc4c05d28, 0x554161e3, 0xecb831d0, 0xc5000003,
+0x9815c2e9, 0x00000000, 0x0f79e2c4, 0xc54c73d1,
+0x905d29f9, 0xdb57e1c5, 0x557ce1c5, 0x15e9c590,
+0x2ef9c5d2, 0x00005f15, 0x752b7a00, 0x28f9c529,
+0xd1c5c06d, 0x31d0557d, 0x7ce9c5c0, 0xc2e9c5d3,
+0xe2c400d3, 0x0fd10f79, 0xf883c092, 0x25c01901,
+0x00000401, 0xf8b805eb, 0x5d000003, 0x000000c3,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fd00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x40080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002440,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i1[] = {
+0x31552ceb, 0xe58948c0, 0xe0e48348, 0x447ffdc5,
+0x8d48e024, 0x80e02454, 0x75ff103c, 0xc0ff480d,
+0x20f88348, 0x01b0f175, 0xc03102eb, 0x8d4cc3c9,
+0x48082454, 0xb8e0e483, 0x00000001, 0x000008be,
+0x72ff4100, 0x894855f8, 0x415741e5, 0x9d8d4c56,
+0xffffff2f, 0x8f7d8d48, 0x8d4c5541, 0xffff4f8d,
+0x858d4cff, 0xffffff6f, 0x52415441, 0x5321b241,
+0xc0ec8148, 0x44000001, 0x488dd289, 0x048841ff,
+0x41c22903, 0x89011488, 0x01e283ca, 0x1901fa83,
+0x83c121d2, 0xcaff02e2, 0x8301f983, 0x884100de,
+0x88400014, 0xff480734, 0xf88348c0, 0xc5c87521,
+0x30bd6ffd, 0xc5ffffff, 0xd0bd7ffd, 0x8afffffe,
+0xfffed085, 0x30853aff, 0x88ffffff, 0xfffeb085,
+0xc0940fff, 0x8588d8f7, 0xfffffe54, 0xfed1858a,
+0x853affff, 0xffffff31, 0xfeac8588, 0x940fffff,
+0x88d8f7c0, 0xfffe5a85, 0xd2858aff, 0x3afffffe,
+0xffff3285, 0xa88588ff, 0x0ffffffe, 0xd8f7c094,
+0xfe508588, 0x858affff, 0xfffffed3, 0xff33853a,
+0x8588ffff, 0xfffffea4, 0xf7c0940f, 0x598588d8,
+0x8afffffe, 0xfffed485, 0x34853aff, 0x88ffffff,
+0xfffea085, 0xc0940fff, 0x8588d8f7, 0xfffffe4c,
+0xfed5858a, 0x853affff, 0xffffff35, 0xfe9c8588,
+0x940fffff, 0x88d8f7c0, 0xfffe5885, 0xd6858aff,
+0x3afffffe, 0xffff3685, 0x988588ff, 0x0ffffffe,
+0xd8f7c094, 0xfe488588, 0x858affff, 0xfffffed7,
+0xff37853a, 0x8588ffff, 0xfffffe94, 0xf7c0940f,
+0x478588d8, 0x8afffffe, 0xfffed885, 0x38853aff,
+0x88ffffff, 0xfffe9085, 0xc0940fff, 0x8588d8f7,
+0xfffffe40, 0xfed9858a, 0x853affff, 0xffffff39,
+0xfe8c8588, 0x940fffff, 0x88d8f7c0, 0xfffe4685,
+0xda858aff, 0x3afffffe, 0xffff3a85, 0x888588ff,
+0x0ffffffe, 0xd8f7c094, 0xfe3c8588, 0x858affff,
+0xfffffedb, 0xff3b853a, 0x8588ffff, 0xfffffe84,
+0xf7c0940f, 0x458588d8, 0x8afffffe, 0xfffedc85,
+0x3c853aff, 0x88ffffff, 0xfffe8085, 0xc0940fff,
+0x8588d8f7, 0xfffffe38, 0xfedd858a, 0x853affff,
+0xffffff3d, 0xfe7c8588, 0x940fffff, 0x88d8f7c0,
+0xfffe4485, 0xde858aff, 0x3afffffe, 0xffff3e85,
+0x788588ff, 0x0ffffffe, 0xd8f7c094, 0xfe348588,
+0x858affff, 0xfffffedf, 0xff3f853a, 0x8588ffff,
+0xfffffe74, 0xf7c0940f, 0x338588d8, 0x8afffffe,
+0xfffee085, 0x40853aff, 0x40ffffff, 0xfee9b58a,
+0x8588ffff, 0xfffffe70, 0xf7c0940f, 0xb58840d8,
+0xfffffe61, 0xfe2c8588, 0x858affff, 0xfffffee1,
+0xff41853a, 0x8588ffff, 0xfffffe6c, 0xf7c0940f,
+0x328588d8, 0x8afffffe, 0xfffee285, 0x42853aff,
+0x88ffffff, 0xfffe6885, 0x940f41ff, 0xe3858ac1,
+0x41fffffe, 0x853ad9f7, 0xffffff43, 0xfe678588,
+0x0f41ffff, 0x858ac794, 0xfffffee4, 0x6e7941c4,
+0xdff741c9, 0xff44853a, 0x8588ffff, 0xfffffe66,
+0x8ac1940f, 0xfffee585, 0x3143c4ff, 0xf701cf20,
+0x45853ad9, 0x88ffffff, 0xfffe6585, 0x940f41ff,
+0xe6858ac6, 0x41fffffe, 0x853adef7, 0xffffff46,
+0xfe648588, 0x0f41ffff, 0x858ac094, 0xfffffee7,
+0x3ad8f741, 0xffff4785, 0x638588ff, 0x41fffffe,
+0x8ac5940f, 0xfffee885, 0xddf741ff, 0xff48853a,
+0x8588ffff, 0xfffffe62, 0xf7c0940f, 0xb53a40d8,
+0xffffff49, 0xeab58a40, 0xc5fffffe, 0x54956ef9,
+0x41fffffe, 0x44c4940f, 0xfeef958a, 0xe3c4ffff,
+0x5a952069, 0x01fffffe, 0x856e79c5, 0xfffffe50,
+0x40dcf741, 0xff4ab53a, 0x8840ffff, 0xfffe60b5,
+0x6ef9c5ff, 0xfffe4ca5, 0xb58a40ff, 0xfffffeeb,
+0xc7940f40, 0x203963c4, 0xfffe5985, 0x884401ff,
+0xfffe5b95, 0x40dff7ff, 0xff4bb53a, 0xe3c4ffff,
+0x58a52059, 0x01fffffe, 0x5fb58840, 0x0ffffffe,
+0x8a40c394, 0xfffeecb5, 0x6ef9c5ff, 0xfffe48bd,
+0x40dbf7ff, 0xff4cb53a, 0xe3c4ffff, 0x47bd2041,
+0x01fffffe, 0x5eb58840, 0x0ffffffe, 0x8a40c294,
+0xfffeedb5, 0x6ef9c5ff, 0xfffe408d, 0xc5daf7ff,
+0x40e761d9, 0xff4db53a, 0x8840ffff, 0xfffe5db5,
+0x940f41ff, 0xb58a40c3, 0xfffffeee, 0xb56ef9c5,
+0xfffffe3c, 0xc4dbf741, 0xd06169c1, 0x4eb53a40,
+0x40ffffff, 0xfe5cb588, 0x0f40ffff, 0xe9c5c694,
+0xe3c4d462, 0x45b52049, 0x01fffffe, 0xe26ef9c5,
+0x6e7941c4, 0x6ef9c5c0, 0xc4def7ff, 0x8d2071e3,
+0xfffffe46, 0x953a4401, 0xffffff4f, 0x9d6ef9c5,
+0xfffffe38, 0xc2940f41, 0x203943c4, 0xe3c401c5,
+0x449d2061, 0x01fffffe, 0xad6ef9c5, 0xfffffe34,
+0xce61f1c5, 0xc5daf741, 0xc4f66ef9, 0xfb2041e3,
+0x51e3c401, 0xfe33ad20, 0xc401ffff, 0xe32059c3,
+0x49c3c401, 0xc501f220, 0xc5dd61e1, 0xc5e96ef9,
+0xc5e661d9, 0xc5cb62f1, 0x2c9d6ef9, 0xc4fffffe,
+0xee2051c3, 0x6ce9c501, 0x6ef9c5d1, 0x51c1c4c8,
+0xe3c4e861, 0x329d2061, 0x01fffffe, 0x2071c3c4,
+0xf1c501cc, 0xc1c4cf61, 0xc5d96161, 0xc5cc62f1,
+0xc5dd62e1, 0xc4c96ce1, 0xc1186de3, 0xfaa0e801,
+0xc289ffff, 0x000260b8, 0x0fd28400, 0x001ba984,
+0x6ff9c500, 0xfffed0bd, 0xfcc1c5ff, 0xffff308d,
+0x6ff9c5ff, 0xfffee0bd, 0xfcc1c5ff, 0xffff4095,
+0x75e3c4ff, 0xc501ca18, 0xf08d7ffd, 0xc5fffffe,
+0x30956ff9, 0xc5ffffff, 0x408d6ff9, 0xc5ffffff,
+0xc5d2fce9, 0xc4c9fcf1, 0xd01479e3, 0xf0853800,
+0xc4fffffe, 0xca1479e3, 0xc0940f09, 0x1479e3c4,
+0xc3c40dce, 0x0fca1479, 0x8588d8f7, 0xfffffe54,
+0x1479e3c4, 0x853801d0, 0xfffffef1, 0xf7c0940f,
+0x5a8588d8, 0xc4fffffe, 0xd01479e3, 0xf2853802,
+0x0ffffffe, 0xd8f7c094, 0xfe508588, 0xe3c4ffff,
+0x03d01479, 0xfef38538, 0x940fffff, 0x88d8f7c0,
+0xfffe5985, 0x79e3c4ff, 0x3804d014, 0xfffef485,
+0xc0940fff, 0x8588d8f7, 0xfffffe4c, 0x1479e3c4,
+0x853805d0, 0xfffffef5, 0xf7c0940f, 0x588588d8,
+0xc4fffffe, 0xd01479e3, 0xf6853806, 0x0ffffffe,
+0xd8f7c094, 0xfe488588, 0xe3c4ffff, 0x07d01479,
+0xfef78538, 0x940fffff, 0x88d8f7c0, 0xfffe4785,
+0x79e3c4ff, 0x3808d014, 0xfffef885, 0xc0940fff,
+0x8588d8f7, 0xfffffe40, 0x1479e3c4, 0x853809d0,
+0xfffffef9, 0xf7c0940f, 0x468588d8, 0xc4fffffe,
+0xd01479e3, 0xfa85380a, 0x0ffffffe, 0xd8f7c094,
+0xfe3c8588, 0xe3c4ffff, 0x0bd01479, 0xfefb8538,
+0x940fffff, 0x88d8f7c0, 0xfffe4585, 0x79e3c4ff,
+0x380cd014, 0xfffefc85, 0xc0940fff, 0x8588d8f7,
+0xfffffe38, 0x1479e3c4, 0x85380dd0, 0xfffffefd,
+0xf7c0940f, 0x448588d8, 0xc4fffffe, 0xd01479e3,
+0xfe85380e, 0x0ffffffe, 0xd8f7c094, 0xfe348588,
+0xe3c4ffff, 0x0fd01479, 0xfeff8538, 0xf9c5ffff,
+0xfe54956e, 0x940fffff, 0x6e79c5c0, 0xfffe5085,
+0x69e3c4ff, 0xfe5a9520, 0xf701ffff, 0x6ef9c5d8,
+0xfffe4ca5, 0x3963c4ff, 0xfe598520, 0x8801ffff,
+0xfffe3385, 0x79e3c4ff, 0x3800c814, 0xffff0085,
+0x6ef9c5ff, 0xfffe48bd, 0xc0940fff, 0x6169c1c4,
+0x41e3c4d0, 0xfe47bd20, 0xf701ffff, 0x6ef9c5d8,
+0xfffe3cb5, 0x59e3c4ff, 0xfe58a520, 0xc401ffff,
+0xb52049e3, 0xfffffe45, 0x2c858801, 0xc4fffffe,
+0xc81479e3, 0x01853801, 0xc5ffffff, 0x0fe761d9,
+0xe9c5c094, 0xd8f7d462, 0xfe328588, 0xe3c4ffff,
+0x02c81479, 0xff028538, 0xe3c4ffff, 0x03c81479,
+0xc1940f41, 0x38d9f741, 0xffff0385, 0x79e3c4ff,
+0x4104c814, 0xc4c7940f, 0xc96e7941, 0x38dff741,
+0xffff0485, 0x79e3c4ff, 0x0f05c814, 0x43c4c194,
+0x01cf2031, 0x8538d9f7, 0xffffff05, 0x1479e3c4,
+0x0f4106c8, 0xf741c694, 0x068538de, 0xc4ffffff,
+0xc81479e3, 0x940f4107, 0xd8f741c0, 0xff078538,
+0xe3c4ffff, 0x08c81479, 0xc5940f41, 0x6e7941c4,
+0xddf741c0, 0xff088538, 0x940fffff, 0x3943c4c0,
+0xf701c520, 0x099538d8, 0xc4ffffff, 0xca1479e3,
+0x940f410a, 0xdcf741c4, 0xff0a9538, 0xe3c4ffff,
+0x0bca1479, 0xc7940f40, 0x9538dff7, 0xffffff0b,
+0x1479e3c4, 0x940f0cca, 0x6ef9c5c3, 0x38dbf7ff,
+0xffff0c95, 0xc2940fff, 0x2041e3c4, 0xdaf701fb,
+0x0db53840, 0xc4ffffff, 0xce1479e3, 0x940f410e,
+0x6ef9c5c3, 0xfffe408d, 0x6ef9c5ff, 0x71e3c4e2,
+0xfe468d20, 0x4101ffff, 0x3840dbf7, 0xffff0eb5,
+0x940f40ff, 0x59c3c4c6, 0xf701e320, 0x953844de,
+0xffffff0f, 0xce61f1c5, 0x9d6ef9c5, 0xfffffe38,
+0xc2940f41, 0xf66ef9c5, 0x2061e3c4, 0xfffe449d,
+0xf9c501ff, 0xfe34ad6e, 0xf741ffff, 0x51e3c4da,
+0xfe33ad20, 0xc401ffff, 0xf22049c3, 0x61d9c501,
+0x61e1c5e6, 0x6ef9c5dd, 0x62f1c5e9, 0x6ef9c5cb,
+0xfffe2c9d, 0x51c3c4ff, 0xc501ee20, 0xc5d16ce9,
+0xc4c86ef9, 0xe86151c1, 0x2061e3c4, 0xfffe329d,
+0xc3c401ff, 0x01cc2071, 0xcf61f1c5, 0x6161c1c4,
+0x62f1c5d9, 0x62e1c5cc, 0x6ce1c5dd, 0x6de3c4c9,
+0xe801c118, 0xfffff67a, 0x66b8c289, 0x84000002,
+0x83840fd2, 0xc5000017, 0xf0b56ff9, 0xc5fffffe,
+0x00bd6ff9, 0xc5ffffff, 0x308df8c9, 0xc5ffffff,
+0x4095f8c1, 0xc4ffffff, 0xca1875e3, 0x7ffdc501,
+0xffff108d, 0xb0858aff, 0x3afffffe, 0xffff1085,
+0xc0940fff, 0x8588d8f7, 0xfffffeb0, 0xfeac858a,
+0x853affff, 0xffffff11, 0xf7c0940f, 0xac8588d8,
+0x8afffffe, 0xfffea885, 0x12853aff, 0x0fffffff,
+0xd8f7c094, 0xfea88588, 0x858affff, 0xfffffea4,
+0xff13853a, 0x940fffff, 0x88d8f7c0, 0xfffea485,
+0xa0858aff, 0x3afffffe, 0xffff1485, 0xc0940fff,
+0x8588d8f7, 0xfffffea0, 0xfe9c858a, 0x853affff,
+0xffffff15, 0xf7c0940f, 0x9c8588d8, 0x8afffffe,
+0xfffe9885, 0x16853aff, 0x0fffffff, 0xd8f7c094,
+0xfe988588, 0x858affff, 0xfffffe94, 0xff17853a,
+0x940fffff, 0x88d8f7c0, 0xfffe9485, 0x90858aff,
+0x3afffffe, 0xffff1885, 0xc0940fff, 0x8588d8f7,
+0xfffffe90, 0xfe8c858a, 0x853affff, 0xffffff19,
+0xf7c0940f, 0x8c8588d8, 0x8afffffe, 0xfffe8885,
+0x1a853aff, 0x0fffffff, 0xd8f7c094, 0xfe888588,
+0x858affff, 0xfffffe84, 0xff1b853a, 0x940fffff,
+0x88d8f7c0, 0xfffe8485, 0x80858aff, 0x3afffffe,
+0xffff1c85, 0xc0940fff, 0x8588d8f7, 0xfffffe80,
+0xfe7c858a, 0x853affff, 0xffffff1d, 0xf7c0940f,
+0x7c8588d8, 0x8afffffe, 0xfffe7885, 0x1e853aff,
+0x0fffffff, 0xd8f7c094, 0xfe788588, 0x858affff,
+0xfffffe74, 0xff1f853a, 0x858affff, 0xfffffe70,
+0xc7940f41, 0x3adff741, 0xffff2085, 0xc0940fff,
+0x8588d8f7, 0xfffffe74, 0xfe6c858a, 0x853affff,
+0xffffff21, 0xf7c0940f, 0x708588d8, 0x8afffffe,
+0xfffe6885, 0x22853aff, 0x0fffffff, 0xd8f7c094,
+0xfe6c8588, 0x858affff, 0xfffffe67, 0xff23853a,
+0x858affff, 0xfffffe66, 0xc6940f41, 0x3adef741,
+0xffff2485, 0x65858aff, 0x0ffffffe, 0xd9f7c194,
+0xff25853a, 0x858affff, 0xfffffe64, 0xc5940f41,
+0x3addf741, 0xffff2685, 0x63858aff, 0x41fffffe,
+0x41c0940f, 0x853ad8f7, 0xffffff27, 0xfe62858a,
+0xf9c5ffff, 0xfeb0956e, 0x0f41ffff, 0x8a40c494,
+0xfffe61bd, 0xb58a40ff, 0xfffffe5f, 0x856e79c5,
+0xfffffea8, 0x3adcf741, 0xffff2885, 0x3963c4ff,
+0xfea48520, 0x0f01ffff, 0xf9c5c094, 0xfea0a56e,
+0xe3c4ffff, 0xac952069, 0x01fffffe, 0x5b8d8a44,
+0xf7fffffe, 0xbd3a40d8, 0xffffff29, 0x60bd8a40,
+0xc5fffffe, 0x98bd6ef9, 0x0ffffffe, 0xf9c5c394,
+0xfe908d6e, 0xe3c4ffff, 0x94bd2041, 0x01fffffe,
+0x3a40dbf7, 0xffff2abd, 0x59e3c4ff, 0xfe9ca520,
+0x4001ffff, 0xc5c7940f, 0x88b56ef9, 0xc4fffffe,
+0xd06169c1, 0xd9c5dff7, 0x41c4e761, 0x40c06e79,
+0xff2bb53a, 0x0f41ffff, 0xe9c5c394, 0x8a40d462,
+0xfffe5eb5, 0x49e3c4ff, 0xfe84b520, 0x4101ffff,
+0x3a40dbf7, 0xffff2cb5, 0x6ef9c5ff, 0xb58a40ff,
+0xfffffe5d, 0xc5c2940f, 0x809d6ef9, 0xc4fffffe,
+0x8d2071e3, 0xfffffe8c, 0x40daf701, 0xff2db53a,
+0xe3c4ffff, 0x7c9d2061, 0x01fffffe, 0xc2940f41,
+0x5cb58a40, 0xc5fffffe, 0xc5ce61f1, 0x41e26ef9,
+0xf9c5daf7, 0xfe78ad6e, 0x3a40ffff, 0xffff2eb5,
+0x940f40ff, 0x51c3c4c6, 0xc401ef20, 0xc4203943,
+0x61e1c501, 0xc5def7dd, 0x44e96ef9, 0xff2f8d3a,
+0xf1c5ffff, 0x0f41cb62, 0xf9c5c194, 0xf9c5f66e,
+0xfe749d6e, 0xe9c5ffff, 0xf741d16c, 0x6ef9c5d9,
+0x6e79c5c8, 0xfffe6c8d, 0x61e3c4ff, 0xfe709d20,
+0xc401ffff, 0xce203143, 0x51c3c401, 0xc401ed20,
+0xcb2071e3, 0x41c3c401, 0xc401fb20, 0xe22059c3,
+0x49c3c401, 0xc401f120, 0xd96161c1, 0x6151c1c4,
+0x61f1c5e8, 0x61d9c5cf, 0x62e1c5e6, 0x62f1c5dd,
+0x6ce1c5cc, 0x6de3c4c9, 0xe801c118, 0xfffff262,
+0x6bb8c289, 0x84000002, 0x6b840fd2, 0xc5000013,
+0x309d6ff9, 0xc5ffffff, 0x708d6ff9, 0x31ffffff,
+0x6ff9c5c0, 0x0013772d, 0x907d8000, 0x60e1c500,
+0x60f1c5e3, 0x68e1c5d1, 0x68f1c5db, 0xd5e9c5c9,
+0x6ff9c5d4, 0xffff40a5, 0xd5f1c5ff, 0x6ff9c5cb,
+0xd9c5805d, 0xd9c5f460, 0xe88fe468, 0x50d1a368,
+0x1479e3c4, 0xe3c400d2, 0x02d11479, 0x1479c3c4,
+0x4e0f01d7, 0x917d80d0, 0x60e1c500, 0xc4cb89cb,
+0xd11479e3, 0x68e1c503, 0x4e0f44db, 0xd5e1c5f8,
+0x927d80dc, 0xd84e0f00, 0xced5f1c5, 0x00937d80,
+0xfeb09d88, 0xcb89ffff, 0x1479e3c4, 0x4e0f04d1,
+0x947d80d8, 0xac9d8800, 0x89fffffe, 0x79e3c4cb,
+0x8f05d114, 0xcba370e8, 0xd84e0f50, 0x7d80ce89,
+0xe3c40095, 0x06d11479, 0x1479c3c4, 0x4e0f05ce,
+0xa89d88f0, 0x80fffffe, 0x8900967d, 0x79e3c4cb,
+0x0f07d114, 0x7d80d84e, 0x88400097, 0xfffea4b5,
+0x79c3c4ff, 0xc406c914, 0xcd1479c3, 0x0fce8907,
+0xe3c4f04e, 0x08d11479, 0x00987d80, 0xfea09d88,
+0xc3c4ffff, 0x09cc1479, 0x1479c3c4, 0xcb890ac8,
+0x1479e3c4, 0x4e0f09d1, 0x997d80d8, 0xb5884000,
+0xfffffe9c, 0x1479c3c4, 0xc3c40dcb, 0x0fca1479,
+0xe3c4ce89, 0x0ad11479, 0x80f04e0f, 0x88009a7d,
+0xfffe989d, 0xc4cf89ff, 0xd11479e3, 0xf84e0f0b,
+0x7d80cb89, 0x8840009b, 0xfffe94b5, 0x79e3c4ff,
+0x0f0cd114, 0x7d80d84e, 0xce89009c, 0x1479e3c4,
+0x88400dd1, 0xfffe90bd, 0xf04e0fff, 0x7d80cf89,
+0x9d88009d, 0xfffffe8c, 0x1479e3c4, 0x4e0f0ed1,
+0x9e7d80f8, 0xc4cb8900, 0xd11479e3, 0xb588400f,
+0xfffffe88, 0x40d84e0f, 0xfe84bd88, 0xce89ffff,
+0x1479e3c4, 0xcf8900c9, 0x1479e3c4, 0x9d8801c9,
+0xfffffe80, 0x009f7d80, 0xe3c4cb89, 0x02c91479,
+0x80f04e0f, 0xc500a07d, 0xb0856e79, 0x0ffffffe,
+0x7d80f84e, 0x4e0f00a1, 0xb58840d8, 0xfffffe7c,
+0x00a27d80, 0xe3c4ce89, 0x03c91479, 0x40f04e0f,
+0xfe78bd88, 0x7d80ffff, 0xcf8900a3, 0x1479e3c4,
+0x9d8804c9, 0xfffffe74, 0x89f84e0f, 0xa47d80cb,
+0xb5884000, 0xfffffe70, 0x1479e3c4, 0x4e0f08c9,
+0xa57d80d8, 0x4e0f4400, 0xa67d80f0, 0xbd884000,
+0xfffffe6c, 0xc84e0f44, 0x00a77d80, 0xfe689d88,
+0xe3c4ffff, 0x0bcb1479, 0x1479e3c4, 0x0f440cce,
+0x7d80e84e, 0xe3c400a8, 0x0ecf1479, 0x80c84e0f,
+0xc400a97d, 0x85203963, 0xfffffeac, 0x6ef9c501,
+0xfffea8a5, 0x6ef9c5ff, 0x4e0f44ca, 0xaa7d80e0,
+0x6ef9c500, 0xfffea0bd, 0x4e0f44ff, 0xab7d80c0,
+0x41e3c400, 0xfe9cbd20, 0x0f01ffff, 0x7d80d84e,
+0x4e0f00ac, 0xad7d80f0, 0x4e0f4400, 0xae7d80d8,
+0xf84e0f00, 0x956ef9c5, 0xfffffe98, 0x00af7d80,
+0x2059e3c4, 0xfffea4a5, 0xc3c401ff, 0x01cf2071,
+0xd04e0f44, 0x2069e3c4, 0xfffe9495, 0xf9c501ff,
+0xfe90b56e, 0xe3c4ffff, 0x8cb52049, 0x01fffffe,
+0x9d6ef9c5, 0xfffffe88, 0xad6ef9c5, 0xfffffe80,
+0xe761d9c5, 0x6171c1c4, 0x6e79c5c8, 0xfffe708d,
+0x61e9c5ff, 0x62f1c5d6, 0x7941c4cc, 0xc1c4c16e,
+0xc5f86e79, 0xc5e66ef9, 0xc4f76ef9, 0xad2051e3,
+0xfffffe7c, 0x3943c401, 0xc401c520, 0x9d2061e3,
+0xfffffe84, 0x3163c401, 0xfe6c8d20, 0xc401ffff,
+0xfb2041e3, 0x59c3c401, 0xc501e320, 0xc5dd61e1,
+0x68ad6ef9, 0xc4fffffe, 0xf22049c3, 0x62e9c501,
+0x6ef9c5d3, 0xfffe789d, 0x51c3c4ff, 0xc501ee20,
+0xc5ca6cf1, 0xc4d16ef9, 0xe86151c1, 0x2061e3c4,
+0xfffe749d, 0xc3c401ff, 0x01d42069, 0xe661d9c5,
+0xd761e9c5, 0x6161c1c4, 0x62e9c5d9, 0x62e1c5d4,
+0x6ce1c5dd, 0x75e3c4d2, 0xc501d218, 0xc5ca6ff9,
+0x10957ffd, 0x8fffffff, 0x6598e8e9, 0x6ff9c590,
+0xffff2095, 0xe8e98fff, 0xc4a05d98, 0xf3185de3,
+0x7ffdc501, 0xfffeb0b5, 0x6ffdc5ff, 0xfffeb0bd,
+0xb0958aff, 0xc5fffffe, 0xd0bd7ffd, 0xc5fffffe,
+0x79256ff9, 0xc500000f, 0x90756ff9, 0x7d6ff9c5,
+0xf8c9c5a0, 0xf8c1c5dc, 0x65e3c4e4, 0xc501dc18,
+0x905d7ffd, 0x98f0e98f, 0xe98f904d, 0xa05598e8,
+0x1875e3c4, 0xf1c501da, 0xe9c5c9fc, 0xe3c4d2fc,
+0x00c81479, 0x9d7ffdc5, 0xfffffef0, 0x1479e3c4,
+0xe3c409d1, 0x0dd71479, 0xe3c4c238, 0x01ca1479,
+0x1479c3c4, 0x940f0fd2, 0x38d8f7c0, 0xfffed195,
+0x79e3c4ff, 0x4102ca14, 0x41c7940f, 0x9538dff7,
+0xfffffed2, 0xf7c2940f, 0xb09588da, 0xc4fffffe,
+0xca1479e3, 0xd3953803, 0x0ffffffe, 0xdaf7c294,
+0xfeac9588, 0xe3c4ffff, 0x04ca1479, 0xfed49538,
+0x940fffff, 0x88daf7c2, 0xfffea895, 0x79e3c4ff,
+0x3805ca14, 0xfffed595, 0xc2940fff, 0x9588daf7,
+0xfffffea4, 0x1479e3c4, 0x953806ca, 0xfffffed6,
+0xf7c2940f, 0xa09588da, 0xc4fffffe, 0xca1479e3,
+0xd7953807, 0x0ffffffe, 0xdaf7c294, 0xfe9c9588,
+0xe3c4ffff, 0x08ca1479, 0xfed89538, 0x940fffff,
+0x88daf7c2, 0xfffe9895, 0x79e3c4ff, 0x3809ca14,
+0xfffed995, 0xc2940fff, 0x9588daf7, 0xfffffe94,
+0x1479e3c4, 0x95380aca, 0xfffffeda, 0xf7c2940f,
+0x909588da, 0xc4fffffe, 0xca1479e3, 0xdb95380b,
+0x0ffffffe, 0xdaf7c294, 0xfe8c9588, 0xe3c4ffff,
+0x0cca1479, 0xfedc9538, 0x940fffff, 0x88daf7c2,
+0xfffe8895, 0x79e3c4ff, 0x380dca14, 0xfffedd95,
+0xc2940fff, 0x9588daf7, 0xfffffe84, 0x1479e3c4,
+0x95380eca, 0xfffffede, 0x856e79c5, 0xfffffeb0,
+0xc4c2940f, 0x85203963, 0xfffffeac, 0x6ef9c501,
+0xfffea8a5, 0xc4daf7ff, 0xa52059e3, 0xfffffea4,
+0x6ef9c501, 0xfffea0bd, 0x41e3c4ff, 0xfe9cbd20,
+0x8801ffff, 0xfffe8095, 0x79e3c4ff, 0xc50fca14,
+0x988d6ef9, 0xc4fffffe, 0x8d2071e3, 0xfffffe94,
+0xdf953801, 0x0ffffffe, 0xd9c5c294, 0xdaf7e761,
+0xfe7c9588, 0xe3c4ffff, 0x00d21479, 0xfee09538,
+0x940fffff, 0x88daf7c2, 0xfffe7895, 0x79e3c4ff,
+0x3801d214, 0xfffee195, 0xc2940fff, 0x9588daf7,
+0xfffffe74, 0x1479e3c4, 0x953802d2, 0xfffffee2,
+0xf7c2940f, 0x709588da, 0xc4fffffe, 0xd21479e3,
+0xe3953803, 0x0ffffffe, 0xdaf7c294, 0xfe6c9588,
+0xe3c4ffff, 0x04d21479, 0xfee49538, 0xe3c4ffff,
+0x05d21479, 0xc6940f40, 0x9538def7, 0xfffffee5,
+0x1479e3c4, 0x0f4106d2, 0xf741c694, 0xe69538de,
+0xc4fffffe, 0xd21479e3, 0x940f4107, 0xd9f741c1,
+0xfee79538, 0xe3c4ffff, 0x08d21479, 0xc5940f41,
+0x38ddf741, 0xfffee895, 0xc2940fff, 0x8d38daf7,
+0xfffffee9, 0x1479e3c4, 0x0f410ad1, 0xf741c494,
+0xea8d38dc, 0xc4fffffe, 0xd11479e3, 0x940f410b,
+0xd8f741c0, 0xfeeb8d38, 0xe3c4ffff, 0x0cd11479,
+0xc4c3940f, 0xf86e79c1, 0x8d38dbf7, 0xfffffeec,
+0xc4c1940f, 0xfb2041e3, 0x40d9f701, 0xfeedbd38,
+0xe3c4ffff, 0x0ed71479, 0xc3940f41, 0xd06ef9c5,
+0x40dbf741, 0xfeeebd38, 0xc3c4ffff, 0x01d72069,
+0xc7940f40, 0x6169c1c4, 0x7941c4d0, 0xdff7c16e,
+0xef953844, 0xc5fffffe, 0x90b56ef9, 0xc5fffffe,
+0x889d6ef9, 0xc5fffffe, 0x80ad6ef9, 0x41fffffe,
+0xc5c2940f, 0x41d462e9, 0xf9c5daf7, 0xe3c4e16e,
+0x8cb52049, 0x01fffffe, 0x8d6e79c5, 0xfffffe70,
+0x2051e3c4, 0xfffe7cad, 0xe3c401ff, 0x849d2061,
+0x01fffffe, 0x203943c4, 0x63c401c5, 0x6c8d2031,
+0x01fffffe, 0xce61f1c5, 0xf76ef9c5, 0x2059c3c4,
+0xe1c501e3, 0xf9c5dd61, 0xc3c4ee6e, 0x01f22049,
+0xcb62f1c5, 0x9d6ef9c5, 0xfffffe78, 0x2051c3c4,
+0xe9c501ee, 0xf9c5d16c, 0xc1c4ca6e, 0xc4e86151,
+0x9d2061e3, 0xfffffe74, 0x71c3c401, 0xc501cc20,
+0xc5e661d9, 0xc4cf61f1, 0xd96161c1, 0xcc62f1c5,
+0xdd62e1c5, 0xc96ce1c5, 0x186de3c4, 0x1fe801c1,
+0x89ffffea, 0x032cb8c2, 0xd2840000, 0x0b28840f,
+0xf1c50000, 0xf1c5c9ef, 0xc59055f8, 0xa04df8f1,
+0x9868e98f, 0xfffef095, 0x70e98fff, 0xff008d98,
+0xe3c4ffff, 0x00d01479, 0xff108538, 0xe3c4ffff,
+0x01d21479, 0xc4c0940f, 0xd9186de3, 0x79e3c401,
+0xf709c914, 0x119538d8, 0xc4ffffff, 0xd21479e3,
+0x7ffdc502, 0xfffed09d, 0x940f41ff, 0x79e3c4c7,
+0xc40dcf14, 0xca1479c3, 0xdff7410f, 0xff129538,
+0x940fffff, 0x88daf7c2, 0xfffeb095, 0x79e3c4ff,
+0x3803d214, 0xffff1395, 0xc2940fff, 0x9588daf7,
+0xfffffeac, 0x1479e3c4, 0x953804d2, 0xffffff14,
+0xf7c2940f, 0xa89588da, 0xc4fffffe, 0xd21479e3,
+0x15953805, 0x0fffffff, 0xdaf7c294, 0xfea49588,
+0xe3c4ffff, 0x06d21479, 0xff169538, 0x940fffff,
+0x88daf7c2, 0xfffea095, 0x79e3c4ff, 0x3807d214,
+0xffff1795, 0xc2940fff, 0x9588daf7, 0xfffffe9c,
+0x1479e3c4, 0x953808d2, 0xffffff18, 0xf7c2940f,
+0x989588da, 0xc4fffffe, 0xd21479e3, 0x19953809,
+0x0fffffff, 0xdaf7c294, 0xfe949588, 0xe3c4ffff,
+0x0ad21479, 0xff1a9538, 0x940fffff, 0x88daf7c2,
+0xfffe9095, 0x79e3c4ff, 0x380bd214, 0xffff1b95,
+0xc2940fff, 0x9588daf7, 0xfffffe8c, 0x1479e3c4,
+0x95380cd2, 0xffffff1c, 0xf7c2940f, 0x889588da,
+0xc4fffffe, 0xd21479e3, 0x1d95380d, 0x0fffffff,
+0xdaf7c294, 0xfe849588, 0xe3c4ffff, 0x0ed21479,
+0xff1e9538, 0x79c5ffff, 0xfeb0856e, 0x940fffff,
+0x3963c4c2, 0xfeac8520, 0xc501ffff, 0xa8a56ef9,
+0xf7fffffe, 0x59e3c4da, 0xfea4a520, 0xc501ffff,
+0xa0bd6ef9, 0xc4fffffe, 0xbd2041e3, 0xfffffe9c,
+0x80958801, 0xc4fffffe, 0xd21479e3, 0x6ef9c50f,
+0x1f9538d0, 0xc4ffffff, 0xd72069c3, 0xc2940f01,
+0xe761d9c5, 0x6169c1c4, 0xc5daf7d0, 0x88d462e9,
+0xfffe7c95, 0x79e3c4ff, 0x3800ca14, 0xffff2095,
+0xc2940fff, 0x9588daf7, 0xfffffe78, 0x1479e3c4,
+0x953801ca, 0xffffff21, 0xf7c2940f, 0x749588da,
+0xc4fffffe, 0xca1479e3, 0x22953802, 0x0fffffff,
+0xdaf7c294, 0xfe709588, 0xe3c4ffff, 0x03ca1479,
+0xff239538, 0x940fffff, 0x88daf7c2, 0xfffe6c95,
+0x79e3c4ff, 0x3804ca14, 0xffff2495, 0x79e3c4ff,
+0x4005ca14, 0xf7c6940f, 0x259538de, 0xc4ffffff,
+0xca1479e3, 0x940f4106, 0xdef741c6, 0xff269538,
+0xe3c4ffff, 0x07ca1479, 0xc1940f41, 0x38d9f741,
+0xffff2795, 0x79e3c4ff, 0x4108ca14, 0xc4c5940f,
+0xc16e7941, 0x38ddf741, 0xffff2895, 0xc2940fff,
+0x203943c4, 0xdaf701c5, 0xff298d38, 0xe3c4ffff,
+0x0ac91479, 0xc4940f41, 0x38dcf741, 0xffff2a8d,
+0x79e3c4ff, 0x410bc914, 0x41c0940f, 0x8d38d8f7,
+0xffffff2b, 0x1479e3c4, 0x940f0cc9, 0x79c1c4c3,
+0xdbf7f86e, 0xff2c8d38, 0x940fffff, 0x41e3c4c1,
+0xf701fb20, 0xbd3840d9, 0xffffff2d, 0x1479e3c4,
+0x0f410ecf, 0xf9c5c394, 0xfe988d6e, 0xf9c5ffff,
+0xe3c4e16e, 0x948d2071, 0x01fffffe, 0x40dbf741,
+0xff2ebd38, 0x0f40ffff, 0xc3c4c794, 0x01e32059,
+0x3844dff7, 0xffff2f95, 0x6ef9c5ff, 0xfffe90b5,
+0x6ef9c5ff, 0xfffe889d, 0x6ef9c5ff, 0xfffe80ad,
+0x940f41ff, 0x49e3c4c2, 0xfe8cb520, 0x4101ffff,
+0x79c5daf7, 0xfe708d6e, 0xe3c4ffff, 0x7cad2051,
+0x01fffffe, 0x2061e3c4, 0xfffe849d, 0x63c401ff,
+0x6c8d2031, 0x01fffffe, 0xce61f1c5, 0xf76ef9c5,
+0xdd61e1c5, 0xee6ef9c5, 0x2049c3c4, 0xf1c501f2,
+0xf9c5cb62, 0xfe789d6e, 0xc3c4ffff, 0x01ee2051,
+0xd16ce9c5, 0xca6ef9c5, 0x6151c1c4, 0x61e3c4e8,
+0xfe749d20, 0xc401ffff, 0xcc2071c3, 0x61d9c501,
+0x61f1c5e6, 0x61c1c4cf, 0xf1c5d961, 0xe1c5cc62,
+0xe1c5dd62, 0xe3c4c96c, 0x01c1186d, 0xffe611e8,
+0xb8c289ff, 0x00000331, 0x840fd284, 0x0000071a,
+0x8d6ffdc5, 0xffffff30, 0xad6ffdc5, 0xffffff50,
+0xfdc5c031, 0x01a8d56f, 0xfdc50475, 0xfdc5d16f,
+0x8ab0557f, 0x88b00554, 0xfef00594, 0xff48ffff,
+0xf88348c0, 0x80db7520, 0xffff70bd, 0x9f0f00ff,
+0x80d8f7c0, 0xffff71bd, 0x0f4100ff, 0xf9c5c79f,
+0xf741e06e, 0x72bd80df, 0x00ffffff, 0xc19f0f41,
+0x2059c3c4, 0xf74101e7, 0x73bd80d9, 0x00ffffff,
+0xc4c29f0f, 0xd16e7941, 0xbd80daf7, 0xffffff74,
+0xb0958800, 0x0ffffffe, 0xdaf7c29f, 0xff75bd80,
+0x8800ffff, 0xfffeac95, 0xc29f0fff, 0xbd80daf7,
+0xffffff76, 0xa8958800, 0x0ffffffe, 0xdaf7c29f,
+0xff77bd80, 0x8800ffff, 0xfffea495, 0xc29f0fff,
+0xbd80daf7, 0xffffff78, 0xa0958800, 0x0ffffffe,
+0xdaf7c29f, 0xff79bd80, 0x8800ffff, 0xfffe9c95,
+0xc29f0fff, 0xbd80daf7, 0xffffff7a, 0x98958800,
+0x0ffffffe, 0xdaf7c29f, 0xff7bbd80, 0x8800ffff,
+0xfffe9495, 0xc29f0fff, 0xbd80daf7, 0xffffff7c,
+0x90958800, 0x0ffffffe, 0xdaf7c29f, 0xff7dbd80,
+0x8800ffff, 0xfffe8c95, 0xc29f0fff, 0xbd80daf7,
+0xffffff7e, 0x88958800, 0x0ffffffe, 0xdaf7c29f,
+0xff7fbd80, 0x8800ffff, 0xfffe8495, 0xc29f0fff,
+0x7d80daf7, 0x95880080, 0xfffffe80, 0xf7c29f0f,
+0x817d80da, 0x7c958800, 0x0ffffffe, 0xdaf7c29f,
+0xfe789588, 0x7d80ffff, 0xf9c50082, 0xfeacb56e,
+0x79c5ffff, 0xfea48d6e, 0x9f0fffff, 0x6ef9c5c2,
+0xfffe9c95, 0x3163c4ff, 0xfea08d20, 0xf701ffff,
+0x837d80da, 0x2963c400, 0xfeb09520, 0x8801ffff,
+0xfffe7495, 0xc29f0fff, 0x2049e3c4, 0xfffea8b5,
+0x79c501ff, 0xfe94856e, 0xdaf7ffff, 0x00847d80,
+0x6159c1c4, 0x709588e2, 0x0ffffffe, 0xc1c4c29f,
+0xc4f16149, 0x85203963, 0xfffffe90, 0x80daf701,
+0xc500857d, 0x41e662d9, 0x88c69f0f, 0xfffe6c95,
+0x69e3c4ff, 0xfe989520, 0xc501ffff, 0x8c9d6ef9,
+0x41fffffe, 0x7d80def7, 0xe3c40086, 0x889d2061,
+0x01fffffe, 0xc09f0f41, 0xbd6ef9c5, 0xfffffe84,
+0x6169c1c4, 0x41e3c4d0, 0xfe80bd20, 0x4101ffff,
+0x7d80d8f7, 0x0f410087, 0xf741c59f, 0x887d80dd,
+0x61e1c500, 0xc29f0fdf, 0xd362e9c5, 0x9d6ef9c5,
+0xfffffe7c, 0x2061e3c4, 0xfffe789d, 0xdaf701ff,
+0x00897d80, 0xc49f0f41, 0xd26cd9c5, 0xf26ef9c5,
+0x80dcf741, 0x40008a7d, 0xc4c79f0f, 0xf42049c3,
+0x80dff701, 0x0f008b7d, 0x79c5c39f, 0xdbf7c76e,
+0x008c7d80, 0xc4c19f0f, 0xc3203963, 0x80d9f701,
+0xc4008d7d, 0xf06149c1, 0xc39f0f41, 0xe16ef9c5,
+0x80dbf741, 0x40008e7d, 0xc4c69f0f, 0xe32059c3,
+0x80def701, 0xc5008f7d, 0x74956e79, 0x41fffffe,
+0xc5c29f0f, 0xc5fe6ef9, 0x6c8d6e79, 0x41fffffe,
+0x43c4daf7, 0x01de2031, 0x202963c4, 0xfffe7095,
+0x41c401ff, 0xc4c86e79, 0xfa2041c3, 0x3143c401,
+0xc501cd20, 0xc4e761d9, 0xda6161c1, 0x612141c4,
+0x62c9c5c9, 0x61c1c4e4, 0xe1c5d962, 0xe3c4dc6c,
+0x01d3186d, 0xa274e88f, 0xe3c420cd, 0x00c81479,
+0xfef08538, 0xe3c4ffff, 0x01ca1479, 0xf7c0940f,
+0xf19538d8, 0xc4fffffe, 0xca1479e3, 0x940f4102,
+0x6ef9c5c7, 0xdff741d0, 0xfef29538, 0x940fffff,
+0x69c3c4c2, 0xf701d720, 0xb09588da, 0xc4fffffe,
+0xca1479e3, 0xf3953803, 0x0ffffffe, 0xdaf7c294,
+0xfeac9588, 0xe3c4ffff, 0x04ca1479, 0xfef49538,
+0x940fffff, 0x88daf7c2, 0xfffea895, 0x79e3c4ff,
+0x3805ca14, 0xfffef595, 0xc2940fff, 0x9588daf7,
+0xfffffea4, 0x1479e3c4, 0x953806ca, 0xfffffef6,
+0xf7c2940f, 0xa09588da, 0xc4fffffe, 0xca1479e3,
+0xf7953807, 0x0ffffffe, 0xdaf7c294, 0xfe9c9588,
+0xe3c4ffff, 0x08ca1479, 0xfef89538, 0x940fffff,
+0x88daf7c2, 0xfffe9895, 0x79e3c4ff, 0x3809ca14,
+0xfffef995, 0xc2940fff, 0x9588daf7, 0xfffffe94,
+0x1479e3c4, 0x95380aca, 0xfffffefa, 0xf7c2940f,
+0x909588da, 0xc4fffffe, 0xca1479e3, 0xfb95380b,
+0x0ffffffe, 0xdaf7c294, 0xfe8c9588, 0xe3c4ffff,
+0x0cca1479, 0xfefc9538, 0x940fffff, 0x88daf7c2,
+0xfffe8895, 0x79e3c4ff, 0x380dca14, 0xfffefd95,
+0xc2940fff, 0x9588daf7, 0xfffffe84, 0x1479e3c4,
+0x95380eca, 0xfffffefe, 0xf7c2940f, 0x809588da,
+0xc4fffffe, 0xca1479e3, 0xff95380f, 0xc4fffffe,
+0xc9197de3, 0xc2940f01, 0x1479e3c4, 0xe3c409c9,
+0x0dcf1479, 0xc3c4daf7, 0x0fca1479, 0xfe7c9588,
+0xe3c4ffff, 0x00ca1479, 0xff009538, 0x79c5ffff,
+0xfeb0856e, 0x940fffff, 0x6ef9c5c2, 0xfffea8a5,
+0x3963c4ff, 0xfeac8520, 0xf701ffff, 0x6ef9c5da,
+0xfffea0bd, 0x59e3c4ff, 0xfea4a520, 0x8801ffff,
+0xfffe7895, 0x79e3c4ff, 0xc401ca14, 0xd06169c1,
+0xff019538, 0x940fffff, 0x6ef9c5c2, 0xfffe90b5,
+0x41e3c4ff, 0xfe9cbd20, 0xf701ffff, 0x6ef9c5da,
+0xfffe889d, 0x49e3c4ff, 0xfe8cb520, 0x8801ffff,
+0xfffe7495, 0x79e3c4ff, 0x3802ca14, 0xffff0295,
+0x61d9c5ff, 0xc2940fe7, 0xd462e9c5, 0x2061e3c4,
+0xfffe849d, 0xdaf701ff, 0xfe709588, 0xe3c4ffff,
+0x03ca1479, 0xff039538, 0x940fffff, 0x88daf7c2,
+0xfffe6c95, 0x79e3c4ff, 0x3804ca14, 0xffff0495,
+0x79e3c4ff, 0x4005ca14, 0xf7c6940f, 0x059538de,
+0xc4ffffff, 0xca1479e3, 0x940f4106, 0xdef741c6,
+0xff069538, 0xe3c4ffff, 0x07ca1479, 0xc1940f41,
+0x38d9f741, 0xffff0795, 0x79e3c4ff, 0x4108ca14,
+0xc4c5940f, 0xc16e7941, 0x38ddf741, 0xffff0895,
+0xc2940fff, 0x203943c4, 0xdaf701c5, 0xff098d38,
+0xe3c4ffff, 0x0ac91479, 0xc4940f41, 0x38dcf741,
+0xffff0a8d, 0x79e3c4ff, 0x410bc914, 0x41c0940f,
+0x8d38d8f7, 0xffffff0b, 0x1479e3c4, 0x940f0cc9,
+0x79c1c4c3, 0xdbf7f86e, 0xff0c8d38, 0x940fffff,
+0x41e3c4c1, 0xf701fb20, 0xbd3840d9, 0xffffff0d,
+0x1479e3c4, 0x0f410ecf, 0xf9c5c394, 0xfe988d6e,
+0xf9c5ffff, 0xe3c4e16e, 0x948d2071, 0x01fffffe,
+0x40dbf741, 0xff0ebd38, 0x0f40ffff, 0xc3c4c794,
+0x01e32059, 0x3844dff7, 0xffff0f95, 0x61f1c5ff,
+0x6ef9c5ce, 0xfffe80ad, 0x940f41ff, 0x51e3c4c2,
+0xfe7cad20, 0x4101ffff, 0x79c5daf7, 0xfe708d6e,
+0xf9c5ffff, 0xe1c5f76e, 0xf9c5dd61, 0xc3c4ee6e,
+0x01f22049, 0xcb62f1c5, 0x9d6ef9c5, 0xfffffe78,
+0x2051c3c4, 0xe9c501ee, 0xf9c5d16c, 0xc1c4ca6e,
+0xc4e86151, 0x9d2061e3, 0xfffffe74, 0x71c3c401,
+0xc501cc20, 0xc4e661d9, 0x8d203163, 0xfffffe6c,
+0x61f1c501, 0x62f1c5cf, 0x61c1c4cc, 0xe1c5d961,
+0xe1c5dd62, 0xe3c4c96c, 0x01c1186d, 0xffdef1e8,
+0x19013cff, 0x03c425c0, 0x81480000, 0x0001c0c4,
+0x5a415b00, 0x5d415c41, 0x5f415e41, 0x628d495d,
+0x0000c3f8, 0x00000000, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0020540,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u1[] = {
+0x31552ceb, 0xe58948c0, 0xe0e48348, 0x447ffdc5,
+0x8d48e024, 0x80e02454, 0x75ff103c, 0xc0ff480d,
+0x20f88348, 0x01b0f175, 0xc03102eb, 0x8d4cc3c9,
+0x48082454, 0xb8e0e483, 0x00000001, 0x000008b9,
+0x72ff4100, 0x894855f8, 0x415741e5, 0x9d8d4c56,
+0xffffff2f, 0x8f7d8d48, 0x8d4c5541, 0xffff4f8d,
+0x858d4cff, 0xffffff6f, 0x52415441, 0x5321b241,
+0xa0ec8148, 0x44000001, 0x508dd689, 0x048841ff,
+0x41c62903, 0x89013488, 0x83c221d6, 0xceff01e6,
+0x8301fa83, 0x884100d9, 0x0c880034, 0xc0ff4807,
+0x21f88348, 0xfdc5d175, 0xff30bd6f, 0xfdc5ffff,
+0xfed0bd7f, 0x858affff, 0xfffffed0, 0xff30853a,
+0x8588ffff, 0xfffffeb0, 0xf7c0940f, 0x6c8588d8,
+0x8afffffe, 0xfffed185, 0x31853aff, 0x88ffffff,
+0xfffeaf85, 0xc0940fff, 0x8588d8f7, 0xfffffe72,
+0xfed2858a, 0x853affff, 0xffffff32, 0xfea88588,
+0x940fffff, 0x88d8f7c0, 0xfffe6885, 0xd3858aff,
+0x3afffffe, 0xffff3385, 0xae8588ff, 0x0ffffffe,
+0xd8f7c094, 0xfe718588, 0x858affff, 0xfffffed4,
+0xff34853a, 0x8588ffff, 0xfffffea4, 0xf7c0940f,
+0x648588d8, 0x8afffffe, 0xfffed585, 0x35853aff,
+0x88ffffff, 0xfffead85, 0xc0940fff, 0x8588d8f7,
+0xfffffe70, 0xfed6858a, 0x853affff, 0xffffff36,
+0xfea08588, 0x940fffff, 0x88d8f7c0, 0xfffe6085,
+0xd7858aff, 0x3afffffe, 0xffff3785, 0xac8588ff,
+0x0ffffffe, 0xd8f7c094, 0xfe5f8588, 0x858affff,
+0xfffffed8, 0xff38853a, 0x8588ffff, 0xfffffe9c,
+0xf7c0940f, 0x588588d8, 0x8afffffe, 0xfffed985,
+0x39853aff, 0x88ffffff, 0xfffe9b85, 0xc0940fff,
+0x8588d8f7, 0xfffffe5e, 0xfeda858a, 0x853affff,
+0xffffff3a, 0xfe948588, 0x940fffff, 0x88d8f7c0,
+0xfffe5485, 0xdb858aff, 0x3afffffe, 0xffff3b85,
+0x9a8588ff, 0x0ffffffe, 0xd8f7c094, 0xfe5d8588,
+0x858affff, 0xfffffedc, 0xff3c853a, 0x8588ffff,
+0xfffffe90, 0xf7c0940f, 0x508588d8, 0x8afffffe,
+0xfffedd85, 0x3d853aff, 0x88ffffff, 0xfffe9985,
+0xc0940fff, 0x8588d8f7, 0xfffffe5c, 0xfede858a,
+0x853affff, 0xffffff3e, 0xfe8c8588, 0x940fffff,
+0x88d8f7c0, 0xfffe4c85, 0xdf858aff, 0x3afffffe,
+0xffff3f85, 0x888588ff, 0x0ffffffe, 0xd8f7c094,
+0xfe4b8588, 0x858affff, 0xfffffee0, 0xff40853a,
+0x9d8affff, 0xfffffee9, 0xfe848588, 0x940fffff,
+0x88d8f7c0, 0xfffe799d, 0x448588ff, 0x8afffffe,
+0xfffee185, 0x41853aff, 0x88ffffff, 0xfffe8085,
+0xc0940fff, 0x8588d8f7, 0xfffffe4a, 0xfee2858a,
+0x853affff, 0xffffff42, 0xfe988588, 0x0f41ffff,
+0x858ac194, 0xfffffee3, 0x3ad9f741, 0xffff4385,
+0x7f8588ff, 0x41fffffe, 0x8ac7940f, 0xfffee485,
+0x7941c4ff, 0xf741c96e, 0x44853adf, 0x88ffffff,
+0xfffe7e85, 0xc1940fff, 0xfee5858a, 0x43c4ffff,
+0x01cf2031, 0x853ad9f7, 0xffffff45, 0xfe7d8588,
+0x0f41ffff, 0x858ac694, 0xfffffee6, 0x3adef741,
+0xffff4685, 0x7c8588ff, 0x41fffffe, 0x8ac0940f,
+0xfffee785, 0xd8f741ff, 0xff47853a, 0x8588ffff,
+0xfffffe7b, 0xc5940f41, 0xfee8858a, 0xf741ffff,
+0x48853add, 0x88ffffff, 0xfffe7a85, 0xc0940fff,
+0x9d3ad8f7, 0xffffff49, 0xfeea9d8a, 0xf9c5ffff,
+0xfe6c956e, 0x0f41ffff, 0x8a40c494, 0xfffeecb5,
+0x958a44ff, 0xfffffeef, 0x856e79c5, 0xfffffe68,
+0x3adcf741, 0xffff4a9d, 0x789d88ff, 0xc5fffffe,
+0x64a56ef9, 0x8afffffe, 0xfffeeb9d, 0x940f40ff,
+0xb58840c7, 0xfffffe76, 0xbd6ef9c5, 0xfffffe60,
+0x9d3adff7, 0xffffff4b, 0x203963c4, 0xfffe7185,
+0x884401ff, 0xfffe7395, 0x779d88ff, 0x0ffffffe,
+0xe3c4c394, 0x5fbd2041, 0x01fffffe, 0x8d6ef9c5,
+0xfffffe58, 0x3a40dbf7, 0xffff4cb5, 0xb58a40ff,
+0xfffffeed, 0xb56ef9c5, 0xfffffe54, 0xc4c2940f,
+0xb52049e3, 0xfffffe5d, 0x69e3c401, 0xfe729520,
+0xf701ffff, 0xb53a40da, 0xffffff4d, 0x75b58840,
+0xc5fffffe, 0x509d6ef9, 0x40fffffe, 0xfeeeb58a,
+0x0f41ffff, 0xe3c4c394, 0x70a52059, 0x01fffffe,
+0x6169c1c4, 0xdbf741d0, 0x4eb53a40, 0xc4ffffff,
+0xc06e7941, 0x74b58840, 0x40fffffe, 0xc5c6940f,
+0xc4e761d9, 0x8d2071e3, 0xfffffe5e, 0x62e9c501,
+0x6ef9c5d4, 0x6ef9c5ff, 0xc5def7e2, 0xc5ce61f1,
+0x44f66ef9, 0xff4f953a, 0x0f41ffff, 0x43c4c294,
+0x01c52039, 0x2061e3c4, 0xfffe5c9d, 0xf74101ff,
+0x6ef9c5da, 0xfffe4cad, 0x51e3c4ff, 0xfe4bad20,
+0xc401ffff, 0xfb2041e3, 0x59c3c401, 0xc401e320,
+0xf22049c3, 0x61e1c501, 0x6ef9c5dd, 0x61d9c5e9,
+0x62f1c5e6, 0x6ef9c5cb, 0xfffe449d, 0x51c3c4ff,
+0xc501ee20, 0xc5d16ce9, 0xc4c86ef9, 0xe86151c1,
+0x2061e3c4, 0xfffe4a9d, 0xc3c401ff, 0x01cc2071,
+0xcf61f1c5, 0x6161c1c4, 0x62f1c5d9, 0x62e1c5cc,
+0x6ce1c5dd, 0x6de3c4c9, 0xe801c118, 0xfffffab2,
+0x60b8c289, 0x84000002, 0xa1840fd2, 0xc500001b,
+0xd0b56ff9, 0xc5fffffe, 0xe0bd6ff9, 0xc5fffffe,
+0x308dfcc9, 0xc5ffffff, 0x4095fcc1, 0xc4ffffff,
+0xca1875e3, 0x7ffdc501, 0xfffef08d, 0x6ff9c5ff,
+0xffff3095, 0x6ff9c5ff, 0xffff408d, 0xfce9c5ff,
+0xfcf1c5d2, 0x79e3c4c9, 0x3800d014, 0xfffef085,
+0x79e3c4ff, 0x0f09ca14, 0xe3c4c094, 0x0dce1479,
+0x1479c3c4, 0xd8f70fca, 0xfe6c8588, 0xe3c4ffff,
+0x01d01479, 0xfef18538, 0x940fffff, 0x88d8f7c0,
+0xfffe7285, 0x79e3c4ff, 0x3802d014, 0xfffef285,
+0xc0940fff, 0x8588d8f7, 0xfffffe68, 0x1479e3c4,
+0x853803d0, 0xfffffef3, 0xf7c0940f, 0x718588d8,
+0xc4fffffe, 0xd01479e3, 0xf4853804, 0x0ffffffe,
+0xd8f7c094, 0xfe648588, 0xe3c4ffff, 0x05d01479,
+0xfef58538, 0x940fffff, 0x88d8f7c0, 0xfffe7085,
+0x79e3c4ff, 0x3806d014, 0xfffef685, 0xc0940fff,
+0x8588d8f7, 0xfffffe60, 0x1479e3c4, 0x853807d0,
+0xfffffef7, 0xf7c0940f, 0x5f8588d8, 0xc4fffffe,
+0xd01479e3, 0xf8853808, 0x0ffffffe, 0xd8f7c094,
+0xfe588588, 0xe3c4ffff, 0x09d01479, 0xfef98538,
+0x940fffff, 0x88d8f7c0, 0xfffe5e85, 0x79e3c4ff,
+0x380ad014, 0xfffefa85, 0xc0940fff, 0x8588d8f7,
+0xfffffe54, 0x1479e3c4, 0x85380bd0, 0xfffffefb,
+0xf7c0940f, 0x5d8588d8, 0xc4fffffe, 0xd01479e3,
+0xfc85380c, 0x0ffffffe, 0xd8f7c094, 0xfe508588,
+0xe3c4ffff, 0x0dd01479, 0xfefd8538, 0x940fffff,
+0x88d8f7c0, 0xfffe5c85, 0x79e3c4ff, 0x380ed014,
+0xfffefe85, 0xc0940fff, 0x8588d8f7, 0xfffffe4c,
+0x1479e3c4, 0x85380fd0, 0xfffffeff, 0x956ef9c5,
+0xfffffe6c, 0xc5c0940f, 0x68856e79, 0xc4fffffe,
+0x952069e3, 0xfffffe72, 0xc5d8f701, 0x64a56ef9,
+0xc4fffffe, 0x85203963, 0xfffffe71, 0x4b858801,
+0xc4fffffe, 0xc81479e3, 0x00853800, 0xc5ffffff,
+0x60bd6ef9, 0x0ffffffe, 0xc1c4c094, 0xc4d06169,
+0xbd2041e3, 0xfffffe5f, 0xc5d8f701, 0x54b56ef9,
+0xc4fffffe, 0xa52059e3, 0xfffffe70, 0x49e3c401,
+0xfe5db520, 0x8801ffff, 0xfffe4485, 0x79e3c4ff,
+0x3801c814, 0xffff0185, 0x61d9c5ff, 0xc0940fe7,
+0xd462e9c5, 0x8588d8f7, 0xfffffe4a, 0x1479e3c4,
+0x853802c8, 0xffffff02, 0x1479e3c4, 0x0f4103c8,
+0xf741c194, 0x038538d9, 0xc4ffffff, 0xc81479e3,
+0x940f4104, 0x7941c4c7, 0xf741c96e, 0x048538df,
+0xc4ffffff, 0xc81479e3, 0xc1940f05, 0x203143c4,
+0xd9f701cf, 0xff058538, 0xe3c4ffff, 0x06c81479,
+0xc6940f41, 0x38def741, 0xffff0685, 0x79e3c4ff,
+0x4107c814, 0x41c0940f, 0x8538d8f7, 0xffffff07,
+0x1479e3c4, 0x0f4108c8, 0x41c4c594, 0x41c06e79,
+0x8538ddf7, 0xffffff08, 0xc4c0940f, 0xc5203943,
+0x38d8f701, 0xffff0995, 0x79e3c4ff, 0x410aca14,
+0x41c4940f, 0x9538dcf7, 0xffffff0a, 0x1479e3c4,
+0x0f400bca, 0xdff7c794, 0xff0b9538, 0xe3c4ffff,
+0x0cca1479, 0xc5c3940f, 0xf7ff6ef9, 0x0c9538db,
+0x0fffffff, 0xe3c4c294, 0x01fb2041, 0x3840daf7,
+0xffff0db5, 0x79e3c4ff, 0x410ece14, 0xc5c3940f,
+0x588d6ef9, 0xc5fffffe, 0xc4e26ef9, 0x8d2071e3,
+0xfffffe5e, 0xdbf74101, 0x0eb53840, 0x40ffffff,
+0xc4c6940f, 0xe32059c3, 0x44def701, 0xff0f9538,
+0xf1c5ffff, 0xf9c5ce61, 0xfe509d6e, 0x0f41ffff,
+0xf9c5c294, 0xe3c4f66e, 0x5c9d2061, 0x01fffffe,
+0xad6ef9c5, 0xfffffe4c, 0xc4daf741, 0xad2051e3,
+0xfffffe4b, 0x49c3c401, 0xc501f220, 0xc5e661d9,
+0xc5dd61e1, 0xc5e96ef9, 0xc5cb62f1, 0x449d6ef9,
+0xc4fffffe, 0xee2051c3, 0x6ce9c501, 0x6ef9c5d1,
+0x51c1c4c8, 0xe3c4e861, 0x4a9d2061, 0x01fffffe,
+0x2071c3c4, 0xf1c501cc, 0xc1c4cf61, 0xc5d96161,
+0xc5cc62f1, 0xc5dd62e1, 0xc4c96ce1, 0xc1186de3,
+0xf68ce801, 0xc289ffff, 0x000266b8, 0x0fd28400,
+0x00177b84, 0x6ff9c500, 0xfffef0b5, 0x6ff9c5ff,
+0xffff00bd, 0xf8c9c5ff, 0xffff308d, 0xf8c1c5ff,
+0xffff4095, 0x75e3c4ff, 0xc501ca18, 0x108d7ffd,
+0x8affffff, 0xfffeb085, 0x10853aff, 0x0fffffff,
+0xd8f7c094, 0xfeb08588, 0x858affff, 0xfffffeaf,
+0xff11853a, 0x940fffff, 0x88d8f7c0, 0xfffeaf85,
+0xa8858aff, 0x3afffffe, 0xffff1285, 0xc0940fff,
+0x8588d8f7, 0xfffffea8, 0xfeae858a, 0x853affff,
+0xffffff13, 0xf7c0940f, 0xae8588d8, 0x8afffffe,
+0xfffea485, 0x14853aff, 0x0fffffff, 0xd8f7c094,
+0xfea48588, 0x858affff, 0xfffffead, 0xff15853a,
+0x940fffff, 0x88d8f7c0, 0xfffead85, 0xa0858aff,
+0x3afffffe, 0xffff1685, 0xc0940fff, 0x8588d8f7,
+0xfffffea0, 0xfeac858a, 0x853affff, 0xffffff17,
+0xf7c0940f, 0xac8588d8, 0x8afffffe, 0xfffe9c85,
+0x18853aff, 0x0fffffff, 0xd8f7c094, 0xfe9c8588,
+0x858affff, 0xfffffe9b, 0xff19853a, 0x940fffff,
+0x88d8f7c0, 0xfffe9b85, 0x94858aff, 0x3afffffe,
+0xffff1a85, 0xc0940fff, 0x8588d8f7, 0xfffffe94,
+0xfe9a858a, 0x853affff, 0xffffff1b, 0xf7c0940f,
+0x9a8588d8, 0x8afffffe, 0xfffe9085, 0x1c853aff,
+0x0fffffff, 0xd8f7c094, 0xfe908588, 0x858affff,
+0xfffffe99, 0xff1d853a, 0x940fffff, 0x88d8f7c0,
+0xfffe9985, 0x8c858aff, 0x3afffffe, 0xffff1e85,
+0xc0940fff, 0x8588d8f7, 0xfffffe8c, 0xfe88858a,
+0x853affff, 0xffffff1f, 0xfe84858a, 0x0f41ffff,
+0xf741c794, 0x20853adf, 0x0fffffff, 0xd8f7c094,
+0xfe888588, 0x858affff, 0xfffffe80, 0xff21853a,
+0x940fffff, 0x88d8f7c0, 0xfffe8485, 0x98858aff,
+0x3afffffe, 0xffff2285, 0xc0940fff, 0x8588d8f7,
+0xfffffe80, 0xfe7f858a, 0x853affff, 0xffffff23,
+0xfe7e858a, 0x0f41ffff, 0xf741c694, 0x24853ade,
+0x8affffff, 0xfffe7d85, 0xc1940fff, 0x853ad9f7,
+0xffffff25, 0xfe7c858a, 0x0f41ffff, 0xf741c594,
+0x26853add, 0x8affffff, 0xfffe7b85, 0x940f41ff,
+0xd8f741c0, 0xff27853a, 0x858affff, 0xfffffe7a,
+0xa56ef9c5, 0xfffffeb0, 0xc4940f41, 0xfe799d8a,
+0x8a40ffff, 0xfffe78bd, 0x6e79c5ff, 0xfffea88d,
+0xdcf741ff, 0xff28853a, 0x8a40ffff, 0xfffe77b5,
+0x6ef9c5ff, 0xfffea4ad, 0xc0940fff, 0x856e79c5,
+0xfffffea0, 0x203163c4, 0xfffeae8d, 0x8a4401ff,
+0xfffe738d, 0x3ad8f7ff, 0xffff299d, 0x3963c4ff,
+0xfeac8520, 0x0f01ffff, 0xf9c5c394, 0xfe9c956e,
+0xe3c4ffff, 0xafa52059, 0x01fffffe, 0x3a40dbf7,
+0xffff2abd, 0x51e3c4ff, 0xfeadad20, 0x4001ffff,
+0xc5c7940f, 0x94bd6ef9, 0xc4fffffe, 0xe16159c1,
+0xc1c4dff7, 0xc4e86151, 0xc86e7941, 0x2bb53a40,
+0x41ffffff, 0xc5c3940f, 0x40e562d9, 0xfe76b58a,
+0xe3c4ffff, 0x9abd2041, 0x01fffffe, 0x40dbf741,
+0xff2cb53a, 0x79c5ffff, 0x8a40c76e, 0xfffe75b5,
+0xc2940fff, 0x9d6ef9c5, 0xfffffe90, 0x2069e3c4,
+0xfffe9b95, 0xdaf701ff, 0x2db53a40, 0xc4ffffff,
+0x9d2061e3, 0xfffffe99, 0x940f4101, 0xb58a40c2,
+0xfffffe74, 0xd761e9c5, 0xea6ef9c5, 0xc5daf741,
+0x8cb56ef9, 0x40fffffe, 0xff2eb53a, 0x0f40ffff,
+0xc3c4c694, 0x01f72049, 0x203143c4, 0xe1c501cc,
+0xdef7de61, 0xf16ef9c5, 0x2f8d3a44, 0xc5ffffff,
+0x41d362e9, 0xc5c1940f, 0xc5fe6ef9, 0x889d6ef9,
+0xc5fffffe, 0x41e26cd9, 0xf9c5d9f7, 0x79c5d06e,
+0xfe80956e, 0xe3c4ffff, 0x849d2061, 0x01fffffe,
+0x202943c4, 0xc3c401d6, 0x01f52049, 0x2069e3c4,
+0x43c401d3, 0x01c32039, 0x2051c3c4, 0xc3c401ea,
+0x01f92041, 0x6161c1c4, 0x49c1c4da, 0xc1c4f161,
+0xc5d06169, 0xc5ef61d1, 0xc5de62e1, 0xc5d562e9,
+0xc4d26ce1, 0xc2185de3, 0xf274e801, 0xc289ffff,
+0x00026bb8, 0x0fd28400, 0x00136384, 0x6ffdc500,
+0xfffed0b5, 0x56ccc5ff, 0xffff5095, 0x7ffdc5ff,
+0xfffed095, 0x54f4c5ff, 0xffff508d, 0x6ffdc5ff,
+0xffff10b5, 0x57ccc5ff, 0xffff50bd, 0x7ffdc5ff,
+0xffff10bd, 0x10958aff, 0xc5ffffff, 0xd08d55f4,
+0xc4fffffe, 0xc81479e3, 0xc4c23800, 0xca1479e3,
+0xc0940f01, 0x9538d8f7, 0xffffff11, 0x1479e3c4,
+0x0f4102ca, 0xf9c5c794, 0xf741d06e, 0x129538df,
+0x0fffffff, 0xc3c4c294, 0x01d72069, 0x9588daf7,
+0xfffffeb0, 0x1479e3c4, 0x953803ca, 0xffffff13,
+0xf7c2940f, 0xaf9588da, 0xc4fffffe, 0xca1479e3,
+0x14953804, 0x0fffffff, 0xdaf7c294, 0xfea89588,
+0xe3c4ffff, 0x05ca1479, 0xff159538, 0x940fffff,
+0x88daf7c2, 0xfffeae95, 0x79e3c4ff, 0x3806ca14,
+0xffff1695, 0xc2940fff, 0x9588daf7, 0xfffffea4,
+0x1479e3c4, 0x953807ca, 0xffffff17, 0xf7c2940f,
+0xad9588da, 0xc4fffffe, 0xca1479e3, 0x18953808,
+0x0fffffff, 0xdaf7c294, 0xfea09588, 0xe3c4ffff,
+0x09ca1479, 0xff199538, 0x940fffff, 0x88daf7c2,
+0xfffeac95, 0x79e3c4ff, 0x380aca14, 0xffff1a95,
+0xc2940fff, 0x9588daf7, 0xfffffe9c, 0x1479e3c4,
+0x95380bca, 0xffffff1b, 0xf7c2940f, 0x9b9588da,
+0xc4fffffe, 0xca1479e3, 0x1c95380c, 0x0fffffff,
+0xdaf7c294, 0xfe949588, 0xe3c4ffff, 0x0dca1479,
+0xff1d9538, 0x940fffff, 0x88daf7c2, 0xfffe9a95,
+0x79e3c4ff, 0x380eca14, 0xffff1e95, 0xc2940fff,
+0x9588daf7, 0xfffffe90, 0x1479e3c4, 0x95380fca,
+0xffffff1f, 0x197de3c4, 0x940f01c9, 0x79e3c4c2,
+0xc409c914, 0xcf1479e3, 0xc4daf70d, 0xca1479c3,
+0x9995880f, 0xc4fffffe, 0xca1479e3, 0x20953800,
+0x0fffffff, 0xdaf7c294, 0xfe8c9588, 0xe3c4ffff,
+0x01ca1479, 0xff219538, 0x79c5ffff, 0xfeb0856e,
+0x940fffff, 0x6ef9c5c2, 0xfffea8a5, 0x3963c4ff,
+0xfeaf8520, 0xf701ffff, 0x6ef9c5da, 0xfffea4bd,
+0x59e3c4ff, 0xfeaea520, 0x8801ffff, 0xfffe8895,
+0x79e3c4ff, 0x3802ca14, 0xffff2295, 0x6ef9c5ff,
+0xfffe9cb5, 0xc2940fff, 0x9d6ef9c5, 0xfffffe94,
+0x6169c1c4, 0xc4daf7d0, 0xbd2041e3, 0xfffffead,
+0x49e3c401, 0xfe9bb520, 0x8801ffff, 0xfffe8495,
+0x79e3c4ff, 0x3803ca14, 0xffff2395, 0x6ef9c5ff,
+0xfffe90ad, 0xc2940fff, 0xe761d9c5, 0x2051e3c4,
+0xfffe99ad, 0xe3c401ff, 0x9a9d2061, 0x01fffffe,
+0xe9c5daf7, 0x9588d462, 0xfffffe80, 0x1479e3c4,
+0x953804ca, 0xffffff24, 0x1479e3c4, 0x0f4005ca,
+0xe1c5c694, 0xdef7dd61, 0xff259538, 0xe3c4ffff,
+0x06ca1479, 0xc6940f41, 0xee6ef9c5, 0x38def741,
+0xffff2695, 0x79e3c4ff, 0x4107ca14, 0xc4c1940f,
+0xee2051c3, 0xd9f74101, 0xff279538, 0xe3c4ffff,
+0x08ca1479, 0xc5940f41, 0x6e7941c4, 0xddf741c1,
+0xff289538, 0x940fffff, 0x3943c4c2, 0xf701c520,
+0x298d38da, 0xc4ffffff, 0xc91479e3, 0x940f410a,
+0x51c1c4c4, 0xf741e861, 0x2a8d38dc, 0xc4ffffff,
+0xc91479e3, 0x940f410b, 0xd8f741c0, 0xff2b8d38,
+0xe3c4ffff, 0x0cc91479, 0xc4c3940f, 0xf86e79c1,
+0x8d38dbf7, 0xffffff2c, 0xc4c1940f, 0xfb2041e3,
+0x40d9f701, 0xff2dbd38, 0xe3c4ffff, 0x0ecf1479,
+0xc3940f41, 0x8d6ef9c5, 0xfffffea0, 0xe16ef9c5,
+0x2071e3c4, 0xfffeac8d, 0xf74101ff, 0xbd3840db,
+0xffffff2e, 0xc7940f40, 0x2059c3c4, 0xdff701e3,
+0xce61f1c5, 0x2f953844, 0xc5ffffff, 0x41cb62f1,
+0xc5c2940f, 0xc5f76ef9, 0x8c9d6ef9, 0xc5fffffe,
+0xc4d16ce9, 0x9d2061e3, 0xfffffe88, 0xdaf74101,
+0xca6ef9c5, 0x8d6e79c5, 0xfffffe84, 0x203163c4,
+0xfffe808d, 0xc3c401ff, 0x01cc2071, 0x2049c3c4,
+0xc1c401f2, 0xc5d96161, 0xc5cf61f1, 0xc5e661d9,
+0xc5dd62e1, 0xc5cc62f1, 0xc4c96ce1, 0xc1186de3,
+0xee4ce801, 0xc289ffff, 0x000277b8, 0x0fd28400,
+0x000f3b84, 0x90458a00, 0x40915d8a, 0x8a947d8a,
+0xd8f69d4d, 0xdbf6c018, 0x45925d8a, 0xf9c5ff18,
+0xdbf6d06e, 0xc4935d8a, 0xd72069c3, 0xc9184501,
+0x5d8adbf6, 0x7941c495, 0x1845c16e, 0xdff640f6,
+0x967d8a40, 0xf6f61840, 0x3943c4db, 0x4501c620,
+0xf9c5ed18, 0xc1c4e66e, 0x40d06169, 0x8a40dff6,
+0xdb18977d, 0x2059c3c4, 0x9d8801e5, 0xfffffeb0,
+0x40dff640, 0x18987d8a, 0xdff640db, 0x997d8a40,
+0xfeaf9d88, 0xdb18ffff, 0x40dff640, 0x889a7d8a,
+0xfffea89d, 0x40db18ff, 0x8a40dff6, 0x9d889b7d,
+0xfffffeae, 0xf640db18, 0x7d8a40df, 0xa49d889c,
+0x18fffffe, 0xdff640db, 0xfead9d88, 0xdb18ffff,
+0x9d88d9f6, 0xfffffea0, 0x409e5d8a, 0x8840ff18,
+0xfffeacbd, 0x7d8a40ff, 0x18dbf69f, 0xdff640c9,
+0xfe9c8d88, 0x4d8affff, 0x88db18a0, 0xfffe9b9d,
+0xa15d8aff, 0x1840d9f6, 0x40dbf6ff, 0xfe94bd88,
+0x8a40ffff, 0xc918a27d, 0xfe9a8d88, 0xf640ffff,
+0x88db18df, 0xfffe909d, 0xa34d8aff, 0xbd6ef9c5,
+0xfffffeb0, 0x8d6ef9c5, 0xfffffea8, 0xc5a45d8a,
+0xa4b56ef9, 0x44fffffe, 0xc5af558a, 0xa09d6ef9,
+0xf6fffffe, 0x41e3c4d9, 0xfeafbd20, 0xc401ffff,
+0xb52049e3, 0xfffffead, 0xff184001, 0xe3c4dbf6,
+0xae8d2071, 0x01fffffe, 0x99bd8840, 0x40fffffe,
+0x18a57d8a, 0x6ef9c5c9, 0xfffe9cad, 0x8c8d88ff,
+0x8afffffe, 0xd9c5a64d, 0xf1c5e761, 0xf640ce61,
+0x62e9c5df, 0x6e79c5d4, 0xfffe908d, 0x61e3c4ff,
+0xfeac9d20, 0x1801ffff, 0x88d9f6db, 0xfffe889d,
+0xa75d8aff, 0x40ff1840, 0xfe84bd88, 0x8a40ffff,
+0xe3c4a87d, 0x9bad2051, 0x01fffffe, 0x5d8adbf6,
+0x3163c4a9, 0xfe998d20, 0x1801ffff, 0xdff640c9,
+0xab7d8a40, 0xfe808d88, 0x4d8affff, 0xf6d218aa,
+0xe41845db, 0xdd61e1c5, 0x4d8ad9f6, 0x62f1c5ac,
+0x6ef9c5cb, 0xfffe949d, 0xc01845ff, 0x40dff640,
+0xc4ad7d8a, 0x9d2061e3, 0xfffffe9a, 0xc5db1801,
+0xc4d16ce9, 0xf86e79c1, 0xf9c5d9f6, 0xe3c4ca6e,
+0x01fb2041, 0x6161c1c4, 0x40c918d9, 0x8a40dff6,
+0xf9c5ae7d, 0xf9c5e16e, 0xfe8cad6e, 0x1845ffff,
+0x6e79c5db, 0xfffe8485, 0x51e3c4ff, 0xfe88ad20,
+0x4001ffff, 0xc3c4dff6, 0x01cc2071, 0x203963c4,
+0xfffe8085, 0x184001ff, 0x59c3c4ff, 0xc501e320,
+0x41cf61f1, 0x1845daf6, 0x6ef9c5d2, 0x51c1c4f7,
+0xc3c4e861, 0x01f22049, 0xdd62e1c5, 0xe661d9c5,
+0xcc62f1c5, 0xc96ce1c5, 0x186de3c4, 0xecc501d1,
+0xff309554, 0xf9c5ffff, 0xfdc5ca6f, 0xff10957f,
+0xe98fffff, 0x906598e8, 0x956ff9c5, 0xffffff20,
+0x98e8e98f, 0xe3c4a05d, 0x01fb185d, 0xbd7ffdc5,
+0xfffffeb0, 0xb56ffdc5, 0xfffffeb0, 0xfeb0958a,
+0xfdc5ffff, 0xfed0b57f, 0xe1c5ffff, 0xe1c5db76,
+0xc59065fc, 0xa05dfce1, 0x185de3c4, 0xfdc501db,
+0x8f905d7f, 0x4d98f0e9, 0xe8e98f90, 0xc4a05598,
+0xda1875e3, 0xfcf1c501, 0xfce9c5c9, 0x79e3c4d2,
+0xc500c814, 0xf09d7ffd, 0xc4fffffe, 0xd11479e3,
+0x79e3c409, 0x380dd714, 0x79e3c4c2, 0xc401ca14,
+0xd21479c3, 0xc0940f0f, 0x9538d8f7, 0xfffffed1,
+0x1479e3c4, 0x0f4102ca, 0xf741c794, 0xd29538df,
+0x0ffffffe, 0xdaf7c294, 0xfeb09588, 0xe3c4ffff,
+0x03ca1479, 0xfed39538, 0x940fffff, 0x88daf7c2,
+0xfffeaf95, 0x79e3c4ff, 0x3804ca14, 0xfffed495,
+0xc2940fff, 0x9588daf7, 0xfffffea8, 0x1479e3c4,
+0x953805ca, 0xfffffed5, 0xf7c2940f, 0xae9588da,
+0xc4fffffe, 0xca1479e3, 0xd6953806, 0x0ffffffe,
+0xdaf7c294, 0xfea49588, 0xe3c4ffff, 0x07ca1479,
+0xfed79538, 0x940fffff, 0x88daf7c2, 0xfffead95,
+0x79e3c4ff, 0x3808ca14, 0xfffed895, 0xc2940fff,
+0x9588daf7, 0xfffffea0, 0x1479e3c4, 0x953809ca,
+0xfffffed9, 0xf7c2940f, 0xac9588da, 0xc4fffffe,
+0xca1479e3, 0xda95380a, 0x0ffffffe, 0xdaf7c294,
+0xfe9c9588, 0xe3c4ffff, 0x0bca1479, 0xfedb9538,
+0x940fffff, 0x88daf7c2, 0xfffe9b95, 0x79e3c4ff,
+0x380cca14, 0xfffedc95, 0xc2940fff, 0x9588daf7,
+0xfffffe94, 0x1479e3c4, 0x95380dca, 0xfffffedd,
+0xf7c2940f, 0x9a9588da, 0xc4fffffe, 0xca1479e3,
+0xde95380e, 0xc5fffffe, 0xb0856e79, 0x0ffffffe,
+0x63c4c294, 0xaf852039, 0x01fffffe, 0xa56ef9c5,
+0xfffffea8, 0xe3c4daf7, 0xaea52059, 0x01fffffe,
+0xbd6ef9c5, 0xfffffea4, 0x2041e3c4, 0xfffeadbd,
+0x958801ff, 0xfffffe90, 0x1479e3c4, 0xf9c50fca,
+0xfea08d6e, 0xe3c4ffff, 0xac8d2071, 0x01fffffe,
+0xfedf9538, 0x940fffff, 0x61d9c5c2, 0x88daf7e7,
+0xfffe9995, 0x79e3c4ff, 0x3800d214, 0xfffee095,
+0xc2940fff, 0x9588daf7, 0xfffffe8c, 0x1479e3c4,
+0x953801d2, 0xfffffee1, 0xf7c2940f, 0x889588da,
+0xc4fffffe, 0xd21479e3, 0xe2953802, 0x0ffffffe,
+0xdaf7c294, 0xfe849588, 0xe3c4ffff, 0x03d21479,
+0xfee39538, 0x940fffff, 0x88daf7c2, 0xfffe8095,
+0x79e3c4ff, 0x3804d214, 0xfffee495, 0x79e3c4ff,
+0x4005d214, 0xf7c6940f, 0xe59538de, 0xc4fffffe,
+0xd21479e3, 0x940f4106, 0xdef741c6, 0xfee69538,
+0xe3c4ffff, 0x07d21479, 0xc1940f41, 0x38d9f741,
+0xfffee795, 0x79e3c4ff, 0x4108d214, 0x41c5940f,
+0x9538ddf7, 0xfffffee8, 0xf7c2940f, 0xe98d38da,
+0xc4fffffe, 0xd11479e3, 0x940f410a, 0xdcf741c4,
+0xfeea8d38, 0xe3c4ffff, 0x0bd11479, 0xc0940f41,
+0x38d8f741, 0xfffeeb8d, 0x79e3c4ff, 0x0f0cd114,
+0xc1c4c394, 0xf7f86e79, 0xec8d38db, 0x0ffffffe,
+0xe3c4c194, 0x01fb2041, 0x3840d9f7, 0xfffeedbd,
+0x79e3c4ff, 0x410ed714, 0xc5c3940f, 0x41d06ef9,
+0x3840dbf7, 0xfffeeebd, 0x69c3c4ff, 0x4001d720,
+0xc4c7940f, 0xd06169c1, 0x6e7941c4, 0x44dff7c1,
+0xfeef9538, 0xf9c5ffff, 0xfe9cb56e, 0xf9c5ffff,
+0xfe949d6e, 0xf9c5ffff, 0xfe90ad6e, 0x0f41ffff,
+0xe9c5c294, 0xf741d462, 0x6ef9c5da, 0x49e3c4e1,
+0xfe9bb520, 0xc501ffff, 0x848d6e79, 0xc4fffffe,
+0xad2051e3, 0xfffffe99, 0x61e3c401, 0xfe9a9d20,
+0xc401ffff, 0xc5203943, 0x3163c401, 0xfe808d20,
+0xc501ffff, 0xc5ce61f1, 0xc4f76ef9, 0xe32059c3,
+0x61e1c501, 0x6ef9c5dd, 0x49c3c4ee, 0xc501f220,
+0xc5cb62f1, 0x8c9d6ef9, 0xc4fffffe, 0xee2051c3,
+0x6ce9c501, 0x6ef9c5d1, 0x51c1c4ca, 0xe3c4e861,
+0x889d2061, 0x01fffffe, 0x2071c3c4, 0xd9c501cc,
+0xf1c5e661, 0xc1c4cf61, 0xc5d96161, 0xc5cc62f1,
+0xc5dd62e1, 0xc4c96ce1, 0xc1186de3, 0xe740e801,
+0xc289ffff, 0x00032cb8, 0x0fd28400, 0x00082f84,
+0xeff1c500, 0xf8f1c5c9, 0xf1c59055, 0x8fa04df8,
+0x959468e9, 0xfffffef0, 0x9470e98f, 0xffff008d,
+0x79e3c4ff, 0x3800d014, 0xffff1085, 0x79e3c4ff,
+0x0f01d214, 0xe3c4c094, 0x01d9186d, 0x1479e3c4,
+0xd8f709c9, 0xff119538, 0xe3c4ffff, 0x02d21479,
+0x9d7ffdc5, 0xfffffed0, 0xc7940f41, 0x1479e3c4,
+0xc3c40dcf, 0x0fca1479, 0x38dff741, 0xffff1295,
+0xc2940fff, 0x9588daf7, 0xfffffeb0, 0x1479e3c4,
+0x953803d2, 0xffffff13, 0xf7c2940f, 0xaf9588da,
+0xc4fffffe, 0xd21479e3, 0x14953804, 0x0fffffff,
+0xdaf7c294, 0xfea89588, 0xe3c4ffff, 0x05d21479,
+0xff159538, 0x940fffff, 0x88daf7c2, 0xfffeae95,
+0x79e3c4ff, 0x3806d214, 0xffff1695, 0xc2940fff,
+0x9588daf7, 0xfffffea4, 0x1479e3c4, 0x953807d2,
+0xffffff17, 0xf7c2940f, 0xad9588da, 0xc4fffffe,
+0xd21479e3, 0x18953808, 0x0fffffff, 0xdaf7c294,
+0xfea09588, 0xe3c4ffff, 0x09d21479, 0xff199538,
+0x940fffff, 0x88daf7c2, 0xfffeac95, 0x79e3c4ff,
+0x380ad214, 0xffff1a95, 0xc2940fff, 0x9588daf7,
+0xfffffe9c, 0x1479e3c4, 0x95380bd2, 0xffffff1b,
+0xf7c2940f, 0x9b9588da, 0xc4fffffe, 0xd21479e3,
+0x1c95380c, 0x0fffffff, 0xdaf7c294, 0xfe949588,
+0xe3c4ffff, 0x0dd21479, 0xff1d9538, 0x940fffff,
+0x88daf7c2, 0xfffe9a95, 0x79e3c4ff, 0x380ed214,
+0xffff1e95, 0x6e79c5ff, 0xfffeb085, 0xc2940fff,
+0x203963c4, 0xfffeaf85, 0xf9c501ff, 0xfea8a56e,
+0xdaf7ffff, 0x2059e3c4, 0xfffeaea5, 0xf9c501ff,
+0xfea4bd6e, 0xe3c4ffff, 0xadbd2041, 0x01fffffe,
+0xfe909588, 0xe3c4ffff, 0x0fd21479, 0xd06ef9c5,
+0xff1f9538, 0xc3c4ffff, 0x01d72069, 0xc5c2940f,
+0xc4e761d9, 0xd06169c1, 0xe9c5daf7, 0x9588d462,
+0xfffffe99, 0x1479e3c4, 0x953800ca, 0xffffff20,
+0xf7c2940f, 0x8c9588da, 0xc4fffffe, 0xca1479e3,
+0x21953801, 0x0fffffff, 0xdaf7c294, 0xfe889588,
+0xe3c4ffff, 0x02ca1479, 0xff229538, 0x940fffff,
+0x88daf7c2, 0xfffe8495, 0x79e3c4ff, 0x3803ca14,
+0xffff2395, 0xc2940fff, 0x9588daf7, 0xfffffe80,
+0x1479e3c4, 0x953804ca, 0xffffff24, 0x1479e3c4,
+0x0f4005ca, 0xdef7c694, 0xff259538, 0xe3c4ffff,
+0x06ca1479, 0xc6940f41, 0x38def741, 0xffff2695,
+0x79e3c4ff, 0x4107ca14, 0x41c1940f, 0x9538d9f7,
+0xffffff27, 0x1479e3c4, 0x0f4108ca, 0x41c4c594,
+0x41c16e79, 0x9538ddf7, 0xffffff28, 0xc4c2940f,
+0xc5203943, 0x38daf701, 0xffff298d, 0x79e3c4ff,
+0x410ac914, 0x41c4940f, 0x8d38dcf7, 0xffffff2a,
+0x1479e3c4, 0x0f410bc9, 0xf741c094, 0x2b8d38d8,
+0xc4ffffff, 0xc91479e3, 0xc3940f0c, 0x6e79c1c4,
+0x38dbf7f8, 0xffff2c8d, 0xc1940fff, 0x2041e3c4,
+0xd9f701fb, 0x2dbd3840, 0xc4ffffff, 0xcf1479e3,
+0x940f410e, 0x6ef9c5c3, 0xfffea08d, 0x6ef9c5ff,
+0x71e3c4e1, 0xfeac8d20, 0x4101ffff, 0x3840dbf7,
+0xffff2ebd, 0x940f40ff, 0x59c3c4c7, 0xf701e320,
+0x953844df, 0xffffff2f, 0xb56ef9c5, 0xfffffe9c,
+0x9d6ef9c5, 0xfffffe94, 0xad6ef9c5, 0xfffffe90,
+0xc2940f41, 0x2049e3c4, 0xfffe9bb5, 0xf74101ff,
+0x6e79c5da, 0xfffe848d, 0x51e3c4ff, 0xfe99ad20,
+0xc401ffff, 0x9d2061e3, 0xfffffe9a, 0x3163c401,
+0xfe808d20, 0xc501ffff, 0xc5ce61f1, 0xc5f76ef9,
+0xc5dd61e1, 0xc4ee6ef9, 0xf22049c3, 0x62f1c501,
+0x6ef9c5cb, 0xfffe8c9d, 0x51c3c4ff, 0xc501ee20,
+0xc5d16ce9, 0xc4ca6ef9, 0xe86151c1, 0x2061e3c4,
+0xfffe889d, 0xc3c401ff, 0x01cc2071, 0xe661d9c5,
+0xcf61f1c5, 0x6161c1c4, 0x62f1c5d9, 0x62e1c5cc,
+0x6ce1c5dd, 0x6de3c4c9, 0xe801c118, 0xffffe332,
+0x31b8c289, 0x84000003, 0x21840fd2, 0xc5000004,
+0x308d6ffd, 0xc5ffffff, 0x50956ffd, 0x31ffffff,
+0x6ffdc5c0, 0x7501a8da, 0x6ffdc504, 0x7ffdc5d9,
+0x548ab05d, 0x9488b005, 0xfffef005, 0xc0ff48ff,
+0x20f88348, 0xe88fdb75, 0x708da2f4, 0x20ffffff,
+0x1479e3c4, 0x853800c8, 0xfffffef0, 0x1479e3c4,
+0x940f01ca, 0x38d8f7c0, 0xfffef195, 0x79e3c4ff,
+0x4102ca14, 0xc5c7940f, 0x41d06ef9, 0x9538dff7,
+0xfffffef2, 0xc4c2940f, 0xd72069c3, 0x88daf701,
+0xfffeb095, 0x79e3c4ff, 0x3803ca14, 0xfffef395,
+0xc2940fff, 0x9588daf7, 0xfffffeaf, 0x1479e3c4,
+0x953804ca, 0xfffffef4, 0xf7c2940f, 0xa89588da,
+0xc4fffffe, 0xca1479e3, 0xf5953805, 0x0ffffffe,
+0xdaf7c294, 0xfeae9588, 0xe3c4ffff, 0x06ca1479,
+0xfef69538, 0x940fffff, 0x88daf7c2, 0xfffea495,
+0x79e3c4ff, 0x3807ca14, 0xfffef795, 0xc2940fff,
+0x9588daf7, 0xfffffead, 0x1479e3c4, 0x953808ca,
+0xfffffef8, 0xf7c2940f, 0xa09588da, 0xc4fffffe,
+0xca1479e3, 0xf9953809, 0x0ffffffe, 0xdaf7c294,
+0xfeac9588, 0xe3c4ffff, 0x0aca1479, 0xfefa9538,
+0x940fffff, 0x88daf7c2, 0xfffe9c95, 0x79e3c4ff,
+0x380bca14, 0xfffefb95, 0xc2940fff, 0x9588daf7,
+0xfffffe9b, 0x1479e3c4, 0x95380cca, 0xfffffefc,
+0xf7c2940f, 0x949588da, 0xc4fffffe, 0xca1479e3,
+0xfd95380d, 0x0ffffffe, 0xdaf7c294, 0xfe9a9588,
+0xe3c4ffff, 0x0eca1479, 0xfefe9538, 0x940fffff,
+0x88daf7c2, 0xfffe9095, 0x79e3c4ff, 0x380fca14,
+0xfffeff95, 0x7de3c4ff, 0x0f01c919, 0xe3c4c294,
+0x09c91479, 0x1479e3c4, 0xdaf70dcf, 0x1479c3c4,
+0x95880fca, 0xfffffe99, 0x1479e3c4, 0x953800ca,
+0xffffff00, 0xf7c2940f, 0x8c9588da, 0xc4fffffe,
+0xca1479e3, 0x01953801, 0xc5ffffff, 0xb0856e79,
+0x0ffffffe, 0xf9c5c294, 0xfea8a56e, 0x63c4ffff,
+0xaf852039, 0x01fffffe, 0xf9c5daf7, 0xfea4bd6e,
+0xe3c4ffff, 0xaea52059, 0x01fffffe, 0xfe889588,
+0xe3c4ffff, 0x02ca1479, 0xff029538, 0xf9c5ffff,
+0xfe9cb56e, 0x940fffff, 0x6ef9c5c2, 0xfffe949d,
+0x69c1c4ff, 0xdaf7d061, 0x2041e3c4, 0xfffeadbd,
+0xe3c401ff, 0x9bb52049, 0x01fffffe, 0xfe849588,
+0xe3c4ffff, 0x03ca1479, 0xff039538, 0xf9c5ffff,
+0xfe90ad6e, 0x940fffff, 0x61d9c5c2, 0x51e3c4e7,
+0xfe99ad20, 0xc401ffff, 0x9d2061e3, 0xfffffe9a,
+0xc5daf701, 0x88d462e9, 0xfffe8095, 0x79e3c4ff,
+0x3804ca14, 0xffff0495, 0x79e3c4ff, 0x4005ca14,
+0xc5c6940f, 0xf7dd61e1, 0x059538de, 0xc4ffffff,
+0xca1479e3, 0x940f4106, 0x6ef9c5c6, 0xdef741ee,
+0xff069538, 0xe3c4ffff, 0x07ca1479, 0xc1940f41,
+0x2051c3c4, 0xf74101ee, 0x079538d9, 0xc4ffffff,
+0xca1479e3, 0x940f4108, 0x7941c4c5, 0xf741c16e,
+0x089538dd, 0x0fffffff, 0x43c4c294, 0x01c52039,
+0x8d38daf7, 0xffffff09, 0x1479e3c4, 0x0f410ac9,
+0xc1c4c494, 0x41e86151, 0x8d38dcf7, 0xffffff0a,
+0x1479e3c4, 0x0f410bc9, 0xf741c094, 0x0b8d38d8,
+0xc4ffffff, 0xc91479e3, 0xc3940f0c, 0x6e79c1c4,
+0x38dbf7f8, 0xffff0c8d, 0xc1940fff, 0x2041e3c4,
+0xd9f701fb, 0x0dbd3840, 0xc4ffffff, 0xcf1479e3,
+0x940f410e, 0x6ef9c5c3, 0xfffea08d, 0x6ef9c5ff,
+0x71e3c4e1, 0xfeac8d20, 0x4101ffff, 0x3840dbf7,
+0xffff0ebd, 0x940f40ff, 0x59c3c4c7, 0xf701e320,
+0x61f1c5df, 0x953844ce, 0xffffff0f, 0xc2940f41,
+0xcb62f1c5, 0xf76ef9c5, 0x9d6ef9c5, 0xfffffe8c,
+0xc5daf741, 0xc4d16ce9, 0x9d2061e3, 0xfffffe88,
+0x6ef9c501, 0x6e79c5ca, 0xfffe848d, 0x3163c4ff,
+0xfe808d20, 0xc401ffff, 0xcc2071c3, 0x49c3c401,
+0xc501f220, 0xc5cf61f1, 0xc4e661d9, 0xd96161c1,
+0xcc62f1c5, 0xdd62e1c5, 0xc96ce1c5, 0x186de3c4,
+0x0be801c1, 0x3cffffdf, 0x25c01901, 0x000003c4,
+0xa0c48148, 0x5b000001, 0x5c415a41, 0x5e415d41,
+0x495d5f41, 0xc3f8628d,
+0020430,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i2[] = {
+0x31552ceb, 0xe58948c0, 0xe0e48348, 0x447ffdc5,
+0x8d48e024, 0x80e02454, 0x75ff103c, 0xc0ff480d,
+0x20f88348, 0x01b0f175, 0xc03102eb, 0x8d4cc3c9,
+0x48082454, 0xb8e0e483, 0x00000001, 0xff41f631,
+0x10b9f872, 0x55000000, 0x41e58948, 0x41564157,
+0x41544155, 0x11ba4152, 0x53000000, 0x60ec8148,
+0xc7000001, 0xfffecc85, 0x000010ff, 0xff788d00,
+0x41d08945, 0xfa89c189, 0x83c02941, 0xfa8301e2,
+0x83d21901, 0xcaff02e2, 0x0575c785, 0xb640c9ff,
+0x89446601, 0xff2e458c, 0x4466ffff, 0x4e458489,
+0x66ffffff, 0x6e459489, 0x66ffffff, 0x8e454c89,
+0x48c0ff48, 0x7511f883, 0xf68440b4, 0x8d890674,
+0xfffffecc, 0xbd6ffdc5, 0xffffff30, 0xbd7ffdc5,
+0xfffffed0, 0xfed0858b, 0x3966ffff, 0xffff3085,
+0xc0940fff, 0xd29d8b66, 0x45fffffe, 0xb60fff31,
+0x66d8f7c0, 0xff329d39, 0x9d8bffff, 0xfffffed4,
+0xc7940f41, 0xc5c93145, 0x41d06ef9, 0x3b66dff7,
+0xffff349d, 0x9d8966ff, 0xfffffe90, 0xc1940f41,
+0xd69d8b66, 0x45fffffe, 0xc1c4f631, 0x01d7c469,
+0x66d9f741, 0xff369d3b, 0x0f41ffff, 0x8966c694,
+0xfffebe9d, 0xd89d8bff, 0x31fffffe, 0xdef741c9,
+0x389d3b66, 0xc4ffffff, 0xe16e79c1, 0x66c1940f,
+0xfeb89d89, 0x8b66ffff, 0xfffeda9d, 0xed3145ff,
+0x3b66d9f7, 0xffff3a9d, 0x59c1c4ff, 0x4101e6c4,
+0xc5c5940f, 0xc5c96ef9, 0x45d462e9, 0x8966c031,
+0xfffebc9d, 0xdc9d8bff, 0x41fffffe, 0x3b66ddf7,
+0xffff3c9d, 0x71c1c4ff, 0x4101cdc4, 0x66c0940f,
+0xfeb69d89, 0xd231ffff, 0xde9d8b66, 0x41fffffe,
+0x3b66d8f7, 0xffff3e9d, 0xc2940fff, 0xb49d8966,
+0x8bfffffe, 0xfffee09d, 0x79c1c4ff, 0xdaf7d86e,
+0x80958966, 0x31fffffe, 0x9d3b66d2, 0xffffff40,
+0xb29d8966, 0x66fffffe, 0xfee29d8b, 0x940fffff,
+0xe43145c2, 0x3b66daf7, 0xffff429d, 0x9d8966ff,
+0xfffffeb0, 0xfee49d8b, 0x0f41ffff, 0x8966c494,
+0xfffe7c95, 0xdcf741ff, 0x8e9d8966, 0x66fffffe,
+0xff449d3b, 0x0f40ffff, 0x8b66c794, 0xfffee69d,
+0xe8958bff, 0x40fffffe, 0x66ffb60f, 0xfeeab58b,
+0x4466ffff, 0xfeee958b, 0xdff7ffff, 0x469d3b66,
+0x66ffffff, 0xfe8c9d89, 0x940fffff, 0x6ef9c5c3,
+0x958966ef, 0xfffffe8a, 0x9dc4e1c5, 0xfffffe80,
+0xdbb60f01, 0x88b58966, 0xf7fffffe, 0x953b66db,
+0xffffff48, 0x95894466, 0xfffffe84, 0xcb62f1c5,
+0xc5c2940f, 0xc5d16ce9, 0x01ebc4d1, 0x0fdb3145,
+0xf9c5d2b6, 0xfe7c8d6e, 0xdaf7ffff, 0x4ab53b66,
+0x8bffffff, 0xfffeecb5, 0x71c1c4ff, 0x4101ccc4,
+0xc5c3940f, 0xc5da6ef9, 0x41cd62f1, 0x3b66dbf7,
+0xffff4cb5, 0xb58966ff, 0xfffffe86, 0xc6940f40,
+0xc461c1c4, 0x0f4001db, 0xdef7f6b6, 0x953b4466,
+0xffffff4e, 0xc2940f41, 0xe66ef9c5, 0xd2b60f45,
+0xc4daf741, 0xe2c459c1, 0x62e1c501, 0x6cf1c5dc,
+0x6de3c4cb, 0xe801c118, 0xfffffcd6, 0x60b8c289,
+0x84000002, 0xa2840fd2, 0xc500001c, 0xd09d6ff9,
+0xc5fffffe, 0xe0a56ff9, 0xc5fffffe, 0x308dfde1,
+0xc5ffffff, 0x4095fdd9, 0xc4ffffff, 0xca1875e3,
+0x7ffdc501, 0xfffef08d, 0x6ff9c5ff, 0xffff30bd,
+0x71e9c5ff, 0xf9c501f7, 0xff40bd6f, 0xf9c5ffff,
+0x6600c2c5, 0xfef08539, 0x940fffff, 0x71f1c5c0,
+0xb60f01f7, 0xc5f9c5c0, 0xf9c501d1, 0xf705f1c5,
+0xc579c5d8, 0x896607d1, 0xfffe8085, 0xc5f9c5ff,
+0x396601c2, 0xfffef285, 0xc0940fff, 0x0fc93145,
+0xd8f7c0b6, 0x7c858966, 0xc5fffffe, 0x02c2c5f9,
+0xf4853966, 0xc5fffffe, 0x03c2c5f9, 0xc1940f41,
+0x41ff3145, 0x3966d9f7, 0xfffef685, 0xc5f9c5ff,
+0x0f4104c2, 0xc931c794, 0x6e79c1c4, 0xdff741f1,
+0xf8853966, 0xc5fffffe, 0x05c2c5f9, 0x45c1940f,
+0xc1c4f631, 0x01f7c449, 0x3966d9f7, 0xfffefa85,
+0xc5f9c5ff, 0x0f4106c2, 0x3145c694, 0xdef741c0,
+0xfc853966, 0xc5fffffe, 0x07c2c5f9, 0xc0940f41,
+0xc5ed3145, 0x80956ef9, 0xc5fffffe, 0x7c95c4e9,
+0x01fffffe, 0x66d8f741, 0xfefe8539, 0x0f41ffff,
+0xf9c5c594, 0xc400c1c5, 0xe86e79c1, 0x66ddf741,
+0xff008539, 0xe9c5ffff, 0x940fd662, 0xe43145c0,
+0xc451c1c4, 0xb60f01ed, 0x66d8f7c0, 0xff029539,
+0xf9c5ffff, 0x4102d1c5, 0x31c4940f, 0xdcf741ff,
+0x04953966, 0xc5ffffff, 0x03d1c5f9, 0xc7940f40,
+0xdff7db31, 0x06953966, 0xc5ffffff, 0x04d1c5f9,
+0xc5c3940f, 0xf7ff6ef9, 0x953966db, 0xffffff08,
+0x45c2940f, 0xc1c5db31, 0x0f01fbc4, 0xdaf7d2b6,
+0x0ab53966, 0xc5ffffff, 0x06f1c5f9, 0xc3940f41,
+0xc96ef9c5, 0x66dbf741, 0xff0cb539, 0xc1c4ffff,
+0x01cec471, 0xc6940f40, 0xcd62f1c5, 0xea6ef9c5,
+0xf6b60f40, 0xd16ce9c5, 0xc86ef9c5, 0x4466def7,
+0xff0e9539, 0xc1c4ffff, 0x01ccc471, 0xc2940f41,
+0xf66ef9c5, 0xc451c1c4, 0x0f4501eb, 0xf1c5d2b6,
+0xf741cf62, 0x49c1c4da, 0xc501f2c4, 0xc5ee62d1,
+0xc4cd6cf1, 0xc1186de3, 0xfaa4e801, 0xc289ffff,
+0x000266b8, 0x0fd28400, 0x001a7084, 0x6ff9c500,
+0xfffef0bd, 0xf9c1c5ff, 0xffff308d, 0x6ff9c5ff,
+0xffff00bd, 0xf9c1c5ff, 0xffff4095, 0x75e3c4ff,
+0xc501ca18, 0x108d7ffd, 0x8bffffff, 0xffff1085,
+0x853966ff, 0xfffffed0, 0x8bc0940f, 0xfffeb0bd,
+0x8c9d8bff, 0x0ffffffe, 0x8b66c0b6, 0xfffe8a95,
+0x88b58bff, 0xf7fffffe, 0x858966d8, 0xfffffe80,
+0x12858b66, 0x66ffffff, 0xfed28539, 0x940fffff,
+0xc93145c0, 0xf7c0b60f, 0x858966d8, 0xfffffe7c,
+0xfe90858b, 0x3b66ffff, 0xffff1485, 0x858b66ff,
+0xfffffebe, 0xc1940f41, 0x41ff3145, 0x3b66d9f7,
+0xffff1685, 0xb8858bff, 0x41fffffe, 0x31c7940f,
+0x79c1c4c9, 0xf741f16e, 0x853b66df, 0xffffff18,
+0xfebc858b, 0x940fffff, 0xf63145c1, 0xc449c1c4,
+0xd9f701f7, 0x1a853b66, 0x66ffffff, 0xfeb6858b,
+0x0f41ffff, 0x3145c694, 0x6ef9c5c0, 0xdef741c9,
+0x1c853b66, 0x8bffffff, 0xfffeb485, 0x940f41ff,
+0xed3145c0, 0xc471c1c4, 0xf74101ce, 0x853b66d8,
+0xffffff1e, 0xb2858b66, 0x41fffffe, 0xc4c5940f,
+0xe86e79c1, 0x66ddf741, 0xff20853b, 0x940fffff,
+0xe43145c0, 0xc451c1c4, 0xb60f01ed, 0x62f1c5c0,
+0x66d8f7cd, 0xff22bd3b, 0x8b66ffff, 0xfffe8ebd,
+0x940f41ff, 0xdcf741c4, 0x24bd3b66, 0x40ffffff,
+0x40c7940f, 0xf7ffb60f, 0x9d3b66df, 0xffffff26,
+0xc5c3940f, 0x0fff6ef9, 0xdbf7dbb6, 0x28953b66,
+0x0fffffff, 0x3145c294, 0xc4c1c5db, 0xb60f01fb,
+0x66daf7d2, 0xff2ab53b, 0x8b66ffff, 0xfffe86b5,
+0x940f41ff, 0x6ef9c5c3, 0xdbf741ea, 0x2cb53b66,
+0x44ffffff, 0xfe84958b, 0xf9c5ffff, 0xfe80956e,
+0x0f40ffff, 0xc1c4c694, 0x01ebc451, 0x95c4e9c5,
+0xfffffe7c, 0xb60f4001, 0x66def7f6, 0x2e953b44,
+0xc5ffffff, 0x41d662e9, 0xc5c2940f, 0xc5d16ce9,
+0x45f66ef9, 0xc5d2b60f, 0x41c86ef9, 0xc1c4daf7,
+0x01ccc471, 0xc449c1c4, 0xf1c501f2, 0xd1c5cf62,
+0xf1c5ee62, 0xe3c4cd6c, 0x01c1186d, 0xfff871e8,
+0xb8c289ff, 0x0000026b, 0x840fd284, 0x0000183d,
+0x956ff9c5, 0xffffff60, 0x8d6ff9c5, 0xffffff50,
+0x9dd5e1c5, 0xffffff30, 0xa5d5d9c5, 0xffffff40,
+0x1865e3c4, 0xe9c501dc, 0xf1c5d2d5, 0xf9c5c9d5,
+0xfdc5f36f, 0xfed09d7f, 0xe3c4ffff, 0x01ca1875,
+0xe96ff9c5, 0x8d7ffdc5, 0xfffffef0, 0x956ff9c5,
+0xffffff30, 0x8d6ff9c5, 0xffffff40, 0x9dfde9c5,
+0xffffff50, 0xa5fdf1c5, 0xffffff60, 0x1865e3c4,
+0xfdc501dc, 0xff109d7f, 0xe9c5ffff, 0xff50a5f9,
+0xc9c5ffff, 0xf9c5f5f9, 0xc500c6c5, 0xc5e3d5d9,
+0x609df9f1, 0xc5ffffff, 0x209dd5e1, 0xc5ffffff,
+0x01cbc579, 0xf3c579c5, 0xc579c506, 0xf9c507fb,
+0xc500d4c5, 0x01ccc5f9, 0xf4c5f9c5, 0xc2396605,
+0xc6c5f9c5, 0x5de3c401, 0x0f01fb18, 0x3145c294,
+0x7ffdc5ed, 0xffff10bd, 0x6ff9c5ff, 0xfffee0bd,
+0xd2b60fff, 0xadf9c1c5, 0xffffff00, 0x3966daf7,
+0xc5f9c5c1, 0x0f4102cc, 0xf9c5c594, 0x4502c6c5,
+0xf741c031, 0xc13966dd, 0xccc5f9c5, 0x940f4103,
+0xc5f9c5c0, 0x314503c6, 0xd8f741e4, 0xc5c13966,
+0x04ccc5f9, 0xc6c5f9c5, 0x940f4104, 0xdcf741c4,
+0xc5c13966, 0x05c6c5f9, 0x31c1940f, 0xc9b60fdb,
+0x3966d9f7, 0xc5f9c5c6, 0x940f06f4, 0xc5f9c5c3,
+0xff3106c6, 0x3966dbf7, 0xc5f9c5c6, 0x0f4007f4,
+0xf9c5c794, 0xc507c6c5, 0x45e26ef9, 0xdff7db31,
+0x6e79c1c4, 0x59c1c4f0, 0x6601e5c4, 0x0f41c639,
+0xf9c5c394, 0xc500f3c5, 0x00c5c5f9, 0x66dbf741,
+0xf9c5c639, 0x0f01f5c5, 0x3145c094, 0x49c1c4d2,
+0x0f01f4c4, 0xd9c5c0b6, 0xd8f7e662, 0xf1394166,
+0xcbc579c5, 0xc5f9c502, 0x0f4102f5, 0xf741c294,
+0x394166da, 0xc579c5f1, 0x0f4003cb, 0x0f40c694,
+0xdef7f6b6, 0x90b58966, 0xc5fffffe, 0x03f5c5f9,
+0xf1394166, 0xcbc579c5, 0x940f4004, 0xb60f40c6,
+0x6ef9c5f6, 0xfffe90bd, 0x66def7ff, 0xfebeb589,
+0xf9c5ffff, 0xc504f5c5, 0xbebdc4c1, 0x01fffffe,
+0xf1394166, 0xcbc579c5, 0x6ef9c505, 0x940f40d9,
+0xc4e1c5c6, 0x0f4001db, 0xdef7f6b6, 0xb8b58966,
+0xc5fffffe, 0x05f5c5f9, 0xf1394166, 0xf5c5f9c5,
+0x940f4106, 0xb60f45c1, 0xd9f741c9, 0xf6394166,
+0xf5c579c5, 0x940f4007, 0x6ef9c5c6, 0xb60f40ef,
+0x51c1c4f6, 0xf701ebc4, 0x394566de, 0x62e1c5f7,
+0x940f41dd, 0x6cd9c5c6, 0x6ef9c5e3, 0xb60f45f6,
+0x6ef9c5f6, 0x6ef9c5d8, 0xfffeb8ad, 0xdef741ff,
+0xc461c1c4, 0xc1c401da, 0x01e9c451, 0xc449c1c4,
+0xe1c501f6, 0xd1c5df62, 0xe1c5ee62, 0xe3c4dd6c,
+0x01c3185d, 0xfff5a9e8, 0xb8c289ff, 0x00000282,
+0x840fd284, 0x00001575, 0x9dd5e9c5, 0xffffff50,
+0xa5d5f1c5, 0xffffff60, 0x1865e3c4, 0xfdc501dc,
+0xfed09d7f, 0xc031ffff, 0x000eb841, 0xc7660000,
+0xfffef085, 0x480010ff, 0xfef2bd8d, 0xc766ffff,
+0xffff0e85, 0x480010ff, 0xff0c8d8d, 0x8944ffff,
+0xca8948c6, 0x0366c629, 0xfef005b4, 0x2948ffff,
+0x348966c2, 0xc0834807, 0x32896602, 0x0ef88348,
+0x858bdc75, 0xfffffef0, 0x3966d231, 0xfffed085,
+0xc2940fff, 0xf2858b66, 0x45fffffe, 0x8b66ff31,
+0xffff02bd, 0x66daf7ff, 0xfed28539, 0x858bffff,
+0xfffffef4, 0xc7940f41, 0xc5c93145, 0x66e26ef9,
+0x0e958b44, 0x41ffffff, 0x3966dff7, 0xfffed485,
+0x858b66ff, 0xfffffef6, 0xc1940f41, 0xc4f63145,
+0xe7c459c1, 0xd9f74101, 0xd6853966, 0x8bfffffe,
+0xfffef885, 0x940f41ff, 0xc4c931c6, 0xf16e79c1,
+0x66def741, 0xfed88539, 0x8b66ffff, 0xfffefa85,
+0xc1940fff, 0xc4ed3145, 0xf6c449c1, 0x66d9f701,
+0xfeda8539, 0x858bffff, 0xfffffefc, 0xe662d9c5,
+0xc5940f41, 0xc5c03145, 0x41d96ef9, 0x3966ddf7,
+0xfffedc85, 0x858b66ff, 0xfffffefe, 0xc0940f41,
+0xc4e43145, 0xddc461c1, 0xd8f74101, 0xde853966,
+0x41fffffe, 0x31c4940f, 0x79c1c4c0, 0xf741e86e,
+0xb53966dc, 0xfffffee0, 0x06b58b66, 0x0fffffff,
+0xdb31c094, 0xc451c1c4, 0xd8f701ec, 0xe2bd3966,
+0x8bfffffe, 0xffff04bd, 0x62e1c5ff, 0xc3940fdd,
+0xe36cd9c5, 0xd86ef9c5, 0x3966dbf7, 0xfffee4bd,
+0x940f40ff, 0xdb3145c7, 0xdbc4e1c5, 0xb60f4001,
+0x66dff7ff, 0xfee6b539, 0xb58bffff, 0xffffff08,
+0xc3940f41, 0xff6ef9c5, 0x66dbf741, 0xfee8b539,
+0x0f40ffff, 0xc1c4c694, 0x01fbc441, 0xf6b60f40,
+0xdf62e1c5, 0x8966def7, 0xfffe90b5, 0xb58b66ff,
+0xffffff0a, 0xeab53966, 0x40fffffe, 0x40c6940f,
+0xf7f6b60f, 0xb58966de, 0xfffffebe, 0xff0cb58b,
+0x3966ffff, 0xfffeecb5, 0x940f40ff, 0xb60f40c6,
+0x66def7f6, 0xee953944, 0xc5fffffe, 0x90ad6ef9,
+0x41fffffe, 0xc5c2940f, 0xc5f66ef9, 0xbeadc4d1,
+0x01fffffe, 0xd2b60f45, 0xc4daf741, 0xf2c449c1,
+0x62d1c501, 0x6ce1c5ee, 0x5de3c4dd, 0xe801c318,
+0xfffff33e, 0xd3b8c289, 0x84000002, 0x0a840fd2,
+0xc5000013, 0x7095d5e9, 0xc5ffffff, 0x804dd5f1,
+0x186de3c4, 0xfdc501e9, 0xff10ad7f, 0xf9c5ffff,
+0xff10bd6f, 0xd9c5ffff, 0xc503f771, 0x20bd6ff9,
+0xc5ffffff, 0x03f771e1, 0x185de3c4, 0xfdc501fb,
+0xfe90bd7f, 0xfdc5ffff, 0xfe90bd6f, 0x958bffff,
+0xfffffe90, 0xbd7ffdc5, 0xfffffed0, 0xbd6ff9c5,
+0xffffff10, 0xf771e1c5, 0x6ff9c502, 0xffff20bd,
+0x71d9c5ff, 0xe3c402f7, 0x01dc1865, 0x9d7ffdc5,
+0xfffffef0, 0xa56ff9c5, 0xfffffef0, 0x9d6ff9c5,
+0xffffff00, 0xe4fdd9c5, 0xdbfde1c5, 0xc4c5f9c5,
+0xc5f9c500, 0x79c501f3, 0x6607d3c5, 0xf9c5c239,
+0x0f01c4c5, 0x3145c294, 0xd2b60fff, 0x3966daf7,
+0xfffed285, 0xc5f9c5ff, 0x0f4102c4, 0x3145c794,
+0xdff741c9, 0xd4853966, 0xc5fffffe, 0x03c4c5f9,
+0xc1940f41, 0x41f63145, 0x3966d9f7, 0xfffed685,
+0xc5f9c5ff, 0x0f4104c4, 0xc931c694, 0x6e79c1c4,
+0xdef741f9, 0xd8853966, 0xc5fffffe, 0x05c4c5f9,
+0x45c1940f, 0xc1c4ed31, 0x01fec441, 0x3966d9f7,
+0xfffeda85, 0xc5f9c5ff, 0x0f4106c4, 0x3145c594,
+0xddf741c0, 0xdc853966, 0xc5fffffe, 0x07c4c5f9,
+0xc0940f41, 0xc5e43145, 0x41e26ef9, 0x3966d8f7,
+0xfffede85, 0xc5f9c5ff, 0x0f4100c3, 0xc1c4c494,
+0xc4f06e79, 0xe7c459c1, 0xdcf74101, 0xe0853966,
+0xc5fffffe, 0x0fe762d9, 0xdb31c094, 0xc449c1c4,
+0xb60f01f4, 0x66d8f7c0, 0xfee2b539, 0xf9c5ffff,
+0x0f02f3c5, 0xff31c394, 0x3966dbf7, 0xfffee4b5,
+0xc5f9c5ff, 0x0f4003f3, 0x3145c794, 0x66dff7db,
+0xfee6b539, 0xf9c5ffff, 0x4104f3c5, 0xc5c3940f,
+0x41c76e79, 0x3966dbf7, 0xfffee8b5, 0x940f40ff,
+0x3941c4c6, 0x4001c3c4, 0xf7f6b60f, 0xb58966de,
+0xfffffe90, 0xf3c5f9c5, 0xb5396605, 0xfffffeea,
+0xc6940f40, 0xf6b60f40, 0x8966def7, 0xfffebeb5,
+0xc5f9c5ff, 0xf9c506f3, 0x3966d96e, 0xfffeecb5,
+0x940f40ff, 0x61c1c4c6, 0x4001ddc4, 0xc5f6b60f,
+0xc5de62e1, 0x90b56ef9, 0xc5fffffe, 0xbeb5c4c9,
+0x01fffffe, 0xd9c5def7, 0x4466e36c, 0xfeee9539,
+0x0f41ffff, 0xf9c5c294, 0xf9c5d86e, 0x0f45fe6e,
+0xe1c5d2b6, 0x4101dbc4, 0xc1c4daf7, 0xc4d86261,
+0xfac441c1, 0x62c9c501, 0x6ce1c5f7, 0x5de3c4de,
+0xe801c318, 0xfffff0ba, 0xf8b8c289, 0x84000002,
+0x86840fd2, 0xc5000010, 0xd0bd6ff9, 0xc5fffffe,
+0x02e771e1, 0xbd6ff9c5, 0xfffffee0, 0xe771d9c5,
+0x65e3c402, 0xc501dc18, 0x109d7ffd, 0xc5ffffff,
+0x10a56ff9, 0x31ffffff, 0x6ff9c5d2, 0xffff209d,
+0xfdd9c5ff, 0xfde1c5e4, 0xc5f9c5db, 0xf9c500c4,
+0xc501f3c5, 0x07d3c579, 0xf0853966, 0x0ffffffe,
+0xf9c5c294, 0x4501c4c5, 0xdaf7ff31, 0xf2853966,
+0xc5fffffe, 0x02c4c5f9, 0xc7940f41, 0x41c93145,
+0x3966dff7, 0xfffef485, 0xc5f9c5ff, 0x0f4103c4,
+0x3145c194, 0xd9f741f6, 0xf6853966, 0xc5fffffe,
+0x04c4c5f9, 0xc6940f41, 0xc1c4c931, 0x41f96e79,
+0x3966def7, 0xfffef885, 0xc5f9c5ff, 0x940f05c4,
+0xed3145c1, 0xc441c1c4, 0xd9f701fe, 0xfa853966,
+0xc5fffffe, 0x06c4c5f9, 0xc5940f41, 0x41c03145,
+0x3966ddf7, 0xfffefc85, 0xc5f9c5ff, 0x0f4107c4,
+0x3145c094, 0x6ef9c5e4, 0xd8f741e2, 0xfe853966,
+0xc5fffffe, 0x00c3c5f9, 0xc4940f41, 0x6e79c1c4,
+0x59c1c4f0, 0x4101e7c4, 0x3966dcf7, 0xffff0085,
+0x62d9c5ff, 0xc0940fe7, 0xc1c4db31, 0x01f4c449,
+0xf7c0b60f, 0xb53966d8, 0xffffff02, 0xf3c5f9c5,
+0xc3940f02, 0xdbf7ff31, 0x04b53966, 0xc5ffffff,
+0x03f3c5f9, 0xc7940f40, 0xf7db3145, 0xb53966df,
+0xffffff06, 0xf3c5f9c5, 0x940f4104, 0x6e79c5c3,
+0xdbf741c7, 0x08b53966, 0x40ffffff, 0xc4c6940f,
+0xc3c43941, 0xb60f4001, 0x66def7f6, 0xfe90b589,
+0xf9c5ffff, 0x6605f3c5, 0xff0ab539, 0x0f40ffff,
+0x0f40c694, 0xdef7f6b6, 0xbeb58966, 0xc5fffffe,
+0x06f3c5f9, 0xd96ef9c5, 0x0cb53966, 0x40ffffff,
+0xc4c6940f, 0xddc461c1, 0xb60f4001, 0x62e1c5f6,
+0x6ef9c5de, 0xfffe90b5, 0xc4c9c5ff, 0xfffebeb5,
+0xdef701ff, 0xe36cd9c5, 0x95394466, 0xffffff0e,
+0xc2940f41, 0xd86ef9c5, 0xfe6ef9c5, 0xd2b60f45,
+0xdbc4e1c5, 0xdaf74101, 0x6261c1c4, 0x41c1c4d8,
+0xc501fac4, 0xc5f762c9, 0xc4de6ce1, 0xc3185de3,
+0xee8ce801, 0xc289ffff, 0x0002fdb8, 0x0fd28400,
+0x000e5884, 0xcc85c700, 0x03fffffe, 0xc5000000,
+0xc5dd6ff9, 0x10ad7ffd, 0x48ffffff, 0xfecc8563,
+0xf9c5ffff, 0xff20a56f, 0xe1c4ffff, 0xc5e86ef9,
+0xc5f5f1e1, 0xc4edf1d9, 0xfd184de3, 0x7ffdc501,
+0xfffe90bd, 0x6ffdc5ff, 0xfffe90bd, 0x90958bff,
+0xc5fffffe, 0xd0bd7ffd, 0xc7fffffe, 0xfffecc85,
+0x000002ff, 0x85634800, 0xfffffecc, 0x6ef9e1c4,
+0xf1e1c5e8, 0xf1d9c5dd, 0x65e3c4e5, 0xc501dc18,
+0xf09d7ffd, 0xc5fffffe, 0xf0a56ff9, 0xc5fffffe,
+0x009d6ff9, 0xc5ffffff, 0xc5e4fdd9, 0xc5dbfde1,
+0x00c4c5f9, 0xf3c5f9c5, 0xc579c501, 0x396607d3,
+0xc5f9c5c2, 0x940f01c4, 0xff3145c2, 0xf7d2b60f,
+0x853966da, 0xfffffed2, 0xc4c5f9c5, 0x940f4102,
+0xc93145c7, 0x66dff741, 0xfed48539, 0xf9c5ffff,
+0x4103c4c5, 0x45c1940f, 0xf741f631, 0x853966d9,
+0xfffffed6, 0xc4c5f9c5, 0x940f4104, 0xc4c931c6,
+0xf16e79c1, 0x66def741, 0xfed88539, 0xf9c5ffff,
+0x0f05c4c5, 0x3145c194, 0x49c1c4ed, 0xf701f6c4,
+0x853966d9, 0xfffffeda, 0xc4c5f9c5, 0x940f4106,
+0xc03145c5, 0x66ddf741, 0xfedc8539, 0xf9c5ffff,
+0x4107c4c5, 0x45c0940f, 0xf9c5e431, 0xf741e26e,
+0x853966d8, 0xfffffede, 0xc3c5f9c5, 0x940f4100,
+0x79c1c4c4, 0xc1c4e86e, 0x01e7c459, 0x66dcf741,
+0xfee08539, 0xd9c5ffff, 0x940fe662, 0xc4db31c0,
+0xecc451c1, 0xc0b60f01, 0x3966d8f7, 0xfffee2b5,
+0xc5f9c5ff, 0x940f02f3, 0xf7ff31c3, 0xb53966db,
+0xfffffee4, 0xf3c5f9c5, 0x940f4003, 0xdb3145c7,
+0x3966dff7, 0xfffee6b5, 0xc5f9c5ff, 0x0f4104f3,
+0xf9c5c394, 0xf741ff6e, 0xb53966db, 0xfffffee8,
+0xc6940f40, 0xc441c1c4, 0x0f4001fb, 0xdef7f6b6,
+0x90b58966, 0xc5fffffe, 0x05f3c5f9, 0xeab53966,
+0x40fffffe, 0x40c6940f, 0xf7f6b60f, 0xb58966de,
+0xfffffebe, 0xf3c5f9c5, 0x6ef9c506, 0xb53966d9,
+0xfffffeec, 0xc6940f40, 0xc461c1c4, 0x0f4001dd,
+0xe1c5f6b6, 0xf9c5dd62, 0xfe90ad6e, 0xd1c5ffff,
+0xfebeadc4, 0xf701ffff, 0x6cd9c5de, 0x394466e3,
+0xfffeee95, 0x940f41ff, 0x6ef9c5c2, 0x6ef9c5d8,
+0xb60f45f6, 0xc4e1c5d2, 0xf74101db, 0x62e1c5da,
+0x49c1c4df, 0xc501f2c4, 0xc5ee62d1, 0xc4dd6ce1,
+0xc3185de3, 0xec08e801, 0xc289ffff, 0x000310b8,
+0x0fd28400, 0x000bd484, 0x85634800, 0xfffffecc,
+0xbd6ff9c5, 0xfffffed0, 0x6ef9e1c4, 0xe1c1c5e0,
+0x6ff9c5dc, 0xfffee0bd, 0xe1c1c5ff, 0x65e3c4e4,
+0xc501dc18, 0x109d7ffd, 0xc5ffffff, 0x10a56ff9,
+0x31ffffff, 0x6ff9c5d2, 0xffff209d, 0xfdd9c5ff,
+0xfde1c5e4, 0xc5f9c5db, 0xf9c500c4, 0xc501f3c5,
+0x07d3c579, 0xf0853966, 0x0ffffffe, 0xf9c5c294,
+0x4501c4c5, 0xdaf7ff31, 0xf2853966, 0xc5fffffe,
+0x02c4c5f9, 0xc7940f41, 0x41c93145, 0x3966dff7,
+0xfffef485, 0xc5f9c5ff, 0x0f4103c4, 0x3145c194,
+0xd9f741f6, 0xf6853966, 0xc5fffffe, 0x04c4c5f9,
+0xc6940f41, 0xc1c4c931, 0x41f16e79, 0x3966def7,
+0xfffef885, 0xc5f9c5ff, 0x940f05c4, 0xed3145c1,
+0xc449c1c4, 0xd9f701f6, 0xfa853966, 0xc5fffffe,
+0x06c4c5f9, 0xc5940f41, 0x41c03145, 0x3966ddf7,
+0xfffefc85, 0xc5f9c5ff, 0x0f4107c4, 0x3145c094,
+0x6ef9c5e4, 0xd8f741e2, 0xfe853966, 0xc5fffffe,
+0x00c3c5f9, 0xc4940f41, 0x6e79c1c4, 0x59c1c4e8,
+0x4101e7c4, 0x3966dcf7, 0xffff0085, 0x62d9c5ff,
+0xc0940fe6, 0xc1c4db31, 0x01ecc451, 0xf7c0b60f,
+0xb53966d8, 0xffffff02, 0xf3c5f9c5, 0xc3940f02,
+0xdbf7ff31, 0x04b53966, 0xc5ffffff, 0x03f3c5f9,
+0xc7940f40, 0xf7db3145, 0xb53966df, 0xffffff06,
+0xf3c5f9c5, 0x940f4104, 0x6ef9c5c3, 0xdbf741ff,
+0x08b53966, 0x40ffffff, 0xc4c6940f, 0xfbc441c1,
+0xb60f4001, 0x66def7f6, 0xfe90b589, 0xf9c5ffff,
+0x6605f3c5, 0xff0ab539, 0x0f40ffff, 0x0f40c694,
+0xdef7f6b6, 0xbeb58966, 0xc5fffffe, 0x06f3c5f9,
+0xd96ef9c5, 0x0cb53966, 0x40ffffff, 0xc4c6940f,
+0xddc461c1, 0xb60f4001, 0x62e1c5f6, 0x6ef9c5dd,
+0xfffe90ad, 0xc4d1c5ff, 0xfffebead, 0xdef701ff,
+0xe36cd9c5, 0x95394466, 0xffffff0e, 0xc2940f41,
+0xd86ef9c5, 0xf66ef9c5, 0xd2b60f45, 0xdbc4e1c5,
+0xdaf74101, 0xdf62e1c5, 0xc449c1c4, 0xd1c501f2,
+0xe1c5ee62, 0xe3c4dd6c, 0x01c3185d, 0xffe9d1e8,
+0xb8c289ff, 0x00000314, 0x840fd284, 0x0000099d,
+0xf9c5c031, 0x6600d2c5, 0x00907d83, 0xc5d04e0f,
+0x01fac579, 0x927d8366, 0xc579c500, 0x79c502ca,
+0x4403f2c5, 0xc5f84e0f, 0x04f2c5f9, 0xeac579c5,
+0x7d836605, 0x0f440094, 0x8366c84e, 0xc500967d,
+0x06c2c579, 0xe2c579c5, 0xc5f9c507, 0x0f4400c9,
+0xf9c5f04e, 0xc501d9c5, 0x02f9c5f9, 0x987d8366,
+0xc579c500, 0xf9c505d9, 0xc1c4d26e, 0x0fe16e79,
+0x79c5f04e, 0x6607d1c5, 0x009a7d83, 0xe84e0f44,
+0x9c7d8366, 0x59c1c400, 0x4401e6c4, 0xc4c04e0f,
+0xd7c469c1, 0x7d836601, 0x0f44009e, 0xe9c5e04e,
+0x8366d462, 0x0f00a07d, 0xc1c4c84e, 0x66d86e79,
+0x00a27d83, 0xc4d84e0f, 0xdcc461c1, 0x7d836601,
+0x4e0f00a4, 0x7d8366f8, 0x896600a6, 0xfffe90bd,
+0xc5f9c5ff, 0x4e0f03f9, 0x7d8366f8, 0x896600a8,
+0xfffebebd, 0xc5f9c5ff, 0xf9c504f9, 0xfe90ad6e,
+0xd1c5ffff, 0xfebeadc4, 0x0f01ffff, 0x8366f84e,
+0x4400aa7d, 0x66d84e0f, 0x00ac7d83, 0xb8bd8966,
+0xc5fffffe, 0x06f9c5f9, 0xce6ef9c5, 0xc4f84e0f,
+0xcdc471c1, 0x7d836601, 0xf1c500ae, 0x0f44cb62,
+0xe9c5d04e, 0xf9c5d16c, 0xfeb89d6e, 0xf9c5ffff,
+0xf9c5c96e, 0xc1c4e76e, 0x01dbc461, 0xcbc4f1c5,
+0x59c1c401, 0xc501e2c4, 0xc5cd62f1, 0xc5dc62e1,
+0xc4cb6cf1, 0xd1186de3, 0x6ff9c501, 0x7ffdc5ca,
+0xffff1095, 0xe8e98fff, 0xc5906599, 0x20956ff9,
+0x8fffffff, 0x5d99e8e9, 0x5de3c4a0, 0xc501fb18,
+0x90bd7ffd, 0xc5fffffe, 0x90bd6ffd, 0x8bfffffe,
+0xfffe9095, 0x7ffdc5ff, 0xfffed0bd, 0x6ff9c5ff,
+0x00080b25, 0x6ff9c500, 0xf9c5907d, 0xc5a0756f,
+0xc5dcf9c1, 0xc4e4f9c9, 0xdc1865e3, 0x7ffdc501,
+0xe98f905d, 0x904d99f0, 0x99e8e98f, 0xe3c4a055,
+0x01da1875, 0xc9fdf1c5, 0xd2fde9c5, 0xc1c5f9c5,
+0xc5f9c500, 0x79c501f2, 0xc507d2c5, 0xf09d7ffd,
+0x66fffffe, 0xf9c5c239, 0x0f01c1c5, 0x3145c294,
+0xd2b60fff, 0x3966daf7, 0xfffed285, 0xc5f9c5ff,
+0x0f4102c1, 0x3145c794, 0xdff741c9, 0xd4853966,
+0xc5fffffe, 0x03c1c5f9, 0xc1940f41, 0x41f63145,
+0x3966d9f7, 0xfffed685, 0xc5f9c5ff, 0x0f4104c1,
+0xc931c694, 0x6e79c1c4, 0xdef741e1, 0xd8853966,
+0xc5fffffe, 0x05c1c5f9, 0x45c1940f, 0xc1c4ed31,
+0x01e6c459, 0x3966d9f7, 0xfffeda85, 0xc5f9c5ff,
+0x0f4106c1, 0x3145c594, 0xddf741c0, 0xdc853966,
+0xc5fffffe, 0x07c1c5f9, 0xc0940f41, 0xc5e43145,
+0x41c96ef9, 0x3966d8f7, 0xfffede85, 0xc5f9c5ff,
+0x0f4100c2, 0xc1c4c494, 0xc4d86e79, 0xcdc471c1,
+0xdcf74101, 0xe0853966, 0x0ffffffe, 0xdb31c094,
+0xc461c1c4, 0xb60f01dc, 0x62f1c5c0, 0x66d8f7cb,
+0xfee2b539, 0xf9c5ffff, 0x0f02f2c5, 0xff31c394,
+0x3966dbf7, 0xfffee4b5, 0xc5f9c5ff, 0x0f4003f2,
+0x3145c794, 0x66dff7db, 0xfee6b539, 0xf9c5ffff,
+0x4104f2c5, 0xc5c3940f, 0x41ef6ef9, 0x3966dbf7,
+0xfffee8b5, 0x940f40ff, 0x51c1c4c6, 0x4001ebc4,
+0xf7f6b60f, 0xb58966de, 0xfffffe90, 0xf2c5f9c5,
+0xb5396605, 0xfffffeea, 0xc6940f40, 0xf6b60f40,
+0xf9c5def7, 0xfe909d6e, 0x8966ffff, 0xfffebeb5,
+0xc5f9c5ff, 0xf9c506f2, 0x3966d26e, 0xfffeecb5,
+0x940f40ff, 0x69c1c4c6, 0xc501d7c4, 0xbe9dc4e1,
+0x01fffffe, 0xf6b60f40, 0xd462e9c5, 0x4466def7,
+0xfeee9539, 0xe9c5ffff, 0x0f41d16c, 0xf9c5c294,
+0xf9c5c86e, 0x0f45e66e, 0xf1c5d2b6, 0x4101cbc4,
+0xf1c5daf7, 0xc1c4cd62, 0x01e2c459, 0xdc62e1c5,
+0xcb6cf1c5, 0x186de3c4, 0xf3e801c1, 0x89ffffe5,
+0x032cb8c2, 0xd2840000, 0x05bf840f, 0xf1c50000,
+0xf1c5c9ef, 0xc59055f9, 0xa04df9f1, 0xe98fd231,
+0xf0959968, 0x8ffffffe, 0x8d9970e9, 0xffffff00,
+0xc2c5f9c5, 0xc5f9c500, 0xe3c401f1, 0x01d9186d,
+0x10853966, 0x0fffffff, 0xf9c5c294, 0x4501c2c5,
+0xfdc5ff31, 0xfed09d7f, 0xdaf7ffff, 0x12853966,
+0xc5ffffff, 0x02c2c5f9, 0xc7940f41, 0xc5c93145,
+0x07d1c579, 0x66dff741, 0xff148539, 0xf9c5ffff,
+0x4103c2c5, 0x45c1940f, 0xf741f631, 0x853966d9,
+0xffffff16, 0xc2c5f9c5, 0x940f4104, 0xc4c931c6,
+0xe16e79c1, 0x66def741, 0xff188539, 0xf9c5ffff,
+0x0f05c2c5, 0x3145c194, 0x59c1c4ed, 0xf701e6c4,
+0x853966d9, 0xffffff1a, 0xc2c5f9c5, 0x940f4106,
+0xc03145c5, 0x66ddf741, 0xff1c8539, 0xf9c5ffff,
+0x4107c2c5, 0x45c0940f, 0xf9c5e431, 0xf741d26e,
+0x853966d8, 0xffffff1e, 0xc1c5f9c5, 0x940f4100,
+0x79c1c4c4, 0xc1c4d86e, 0x01d7c469, 0x66dcf741,
+0xff208539, 0xe9c5ffff, 0x940fd462, 0xc4db31c0,
+0xdcc461c1, 0xc0b60f01, 0x3966d8f7, 0xffff22b5,
+0xc5f9c5ff, 0x940f02f1, 0xf7ff31c3, 0xb53966db,
+0xffffff24, 0xf1c5f9c5, 0x940f4003, 0xdb3145c7,
+0x3966dff7, 0xffff26b5, 0xc5f9c5ff, 0x0f4104f1,
+0xf9c5c394, 0xf741ef6e, 0xb53966db, 0xffffff28,
+0xc6940f40, 0xc451c1c4, 0x0f4001eb, 0xdef7f6b6,
+0x90b58966, 0xc5fffffe, 0x05f1c5f9, 0x2ab53966,
+0x40ffffff, 0x40c6940f, 0xf7f6b60f, 0xb58966de,
+0xfffffebe, 0xf1c5f9c5, 0x6ef9c506, 0xb53966c9,
+0xffffff2c, 0xc6940f40, 0xc471c1c4, 0x0f4001cd,
+0xf1c5f6b6, 0xf9c5cb62, 0xfe909d6e, 0xe1c5ffff,
+0xfebe9dc4, 0xf701ffff, 0x6ce9c5de, 0x394466d1,
+0xffff2e95, 0x940f41ff, 0x6ef9c5c2, 0x6ef9c5c8,
+0xb60f45e6, 0xc4f1c5d2, 0xf74101cb, 0x62f1c5da,
+0x59c1c4cd, 0xc501e2c4, 0xc5dc62e1, 0xc4cb6cf1,
+0xc1186de3, 0xe3d8e801, 0xc289ffff, 0x000331b8,
+0x0fd28400, 0x0003a484, 0x6ffdc500, 0xffff308d,
+0x6ffdc5ff, 0xffff50ad, 0xc5c031ff, 0xa8d56ffd,
+0xc5047501, 0xc5d16ffd, 0xb0557ffd, 0x45548b66,
+0x948966b0, 0xfffef045, 0xc0ff48ff, 0x10f88348,
+0xc031d975, 0x70bd8366, 0x00ffffff, 0x45c09f0f,
+0xd8f7ff31, 0x72bd8366, 0x00ffffff, 0xc79f0f41,
+0xc5c93145, 0x41d06ef9, 0x8366dff7, 0xffff74bd,
+0x0f4100ff, 0x3145c19f, 0x69c1c4f6, 0x4101d7c4,
+0x8366d9f7, 0xffff76bd, 0x0f4100ff, 0xc931c69f,
+0x6e79c1c4, 0xdef741f1, 0x78bd8366, 0x00ffffff,
+0x45c19f0f, 0xc1c4ed31, 0x01f6c449, 0x8366d9f7,
+0xffff7abd, 0xe9c500ff, 0x0f41d662, 0x3145c59f,
+0x6ef9c5c0, 0xddf741d9, 0x7cbd8366, 0x00ffffff,
+0xc09f0f41, 0xc4e43145, 0xddc461c1, 0xd8f74101,
+0x7ebd8366, 0x00ffffff, 0xc49f0f41, 0xc1c4d231,
+0x41e06e79, 0x8366dcf7, 0x0f00807d, 0xdb31c29f,
+0xc459c1c4, 0xdaf701e4, 0x827d8366, 0x62e1c500,
+0xc39f0fdc, 0xe9c5ff31, 0xdbf7d36c, 0x847d8366,
+0x6ef9c500, 0x9f0f40da, 0xdb3145c7, 0xdbc4e1c5,
+0x66dff701, 0x00867d83, 0xc39f0f41, 0xf9c5f631,
+0xf741ff6e, 0x7d8366db, 0x0f400088, 0xc1c4c69f,
+0x01fbc441, 0xe1c5def7, 0x8966df62, 0xfffe90b5,
+0x66f631ff, 0x008a7d83, 0xc69f0f40, 0x8966def7,
+0xfffebeb5, 0x66f631ff, 0x008c7d83, 0xa56ef9c5,
+0xfffffe90, 0xa5c4d9c5, 0xfffffebe, 0x9f0f4001,
+0xd23145c6, 0x8366def7, 0x41008e7d, 0xc5c29f0f,
+0x31f66ef9, 0xdaf741d2, 0xc449c1c4, 0xd9c501f2,
+0xe1c5e662, 0xe3c4dc6c, 0x01d3186d, 0xa274e88f,
+0xf9c520cd, 0x6600c1c5, 0xfef08539, 0xf9c5ffff,
+0x0f01c1c5, 0x3145c294, 0x66daf7ff, 0xfef28539,
+0xf9c5ffff, 0x4102c1c5, 0x45c7940f, 0xf9c5c931,
+0xf741d26e, 0x853966df, 0xfffffef4, 0xc1c5f9c5,
+0x940f4103, 0xf63145c1, 0xc469c1c4, 0xf74101d7,
+0x853966d9, 0xfffffef6, 0xc1c5f9c5, 0x940f4104,
+0xc4c931c6, 0xe16e79c1, 0x66def741, 0xfef88539,
+0xf9c5ffff, 0x0f05c1c5, 0x3145c194, 0x59c1c4ed,
+0xf701e6c4, 0x853966d9, 0xfffffefa, 0xc1c5f9c5,
+0x940f4106, 0xc03145c5, 0xd462e9c5, 0x66ddf741,
+0xfefc8539, 0xf9c5ffff, 0x4107c1c5, 0x45c0940f,
+0xe3c4e431, 0x01c9197d, 0x66d8f741, 0xfefe8539,
+0xf9c5ffff, 0x4100c1c5, 0xc5c4940f, 0x01f1c5f9,
+0xd1c579c5, 0xdcf74107, 0x00853966, 0xc4ffffff,
+0xd86e79c1, 0x31c0940f, 0x61c1c4db, 0x0f01dcc4,
+0xd8f7c0b6, 0x02b53966, 0xc5ffffff, 0x02f1c5f9,
+0x31c3940f, 0x66dbf7ff, 0xff04b539, 0xf9c5ffff,
+0x4003f1c5, 0x45c7940f, 0xdff7db31, 0x06b53966,
+0xc5ffffff, 0x04f1c5f9, 0xc3940f41, 0xef6ef9c5,
+0x66dbf741, 0xff08b539, 0x0f40ffff, 0xc1c4c694,
+0x01ebc451, 0xf6b60f40, 0x8966def7, 0xfffe90b5,
+0xc5f9c5ff, 0x396605f1, 0xffff0ab5, 0x940f40ff,
+0xb60f40c6, 0x66def7f6, 0xfebeb589, 0xf9c5ffff,
+0xc506f1c5, 0x66c96ef9, 0xff0cb539, 0x0f40ffff,
+0xc1c4c694, 0x01cdc471, 0xf6b60f40, 0xcb62f1c5,
+0x9d6ef9c5, 0xfffffe90, 0x9dc4e1c5, 0xfffffebe,
+0xc5def701, 0x66d16ce9, 0x0e953944, 0x41ffffff,
+0xc5c2940f, 0xc5c86ef9, 0x45e66ef9, 0xc5d2b60f,
+0x01cbc4f1, 0xc5daf741, 0xc4cd62f1, 0xe2c459c1,
+0x62e1c501, 0x6cf1c5dc, 0x6de3c4cb, 0xe801c118,
+0xffffe02e, 0xc019013c, 0x0003c425, 0xc4814800,
+0x00000160, 0x415a415b, 0x415d415c, 0x5d5f415e,
+0xf8628d49, 0x000000c3, 0x00000000, 0x00000000,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0020020,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u2[] = {
+0x31552ceb, 0xe58948c0, 0xe0e48348, 0x447ffdc5,
+0x8d48e024, 0x80e02454, 0x75ff103c, 0xc0ff480d,
+0x20f88348, 0x01b0f175, 0xc03102eb, 0x8d4cc3c9,
+0x48082454, 0xb8e0e483, 0x00000001, 0xff41f631,
+0x10baf872, 0x55000000, 0x41e58948, 0x41564157,
+0x41544155, 0x11ba4152, 0x53000000, 0x60ec8148,
+0xc7000001, 0xfffecc85, 0x000010ff, 0xff788d00,
+0x41d08945, 0xf989c189, 0x83c02941, 0xc9ff01e1,
+0x0575c785, 0xb640caff, 0x89446601, 0xff2e458c,
+0x4466ffff, 0x4e458489, 0x66ffffff, 0x6e458c89,
+0x66ffffff, 0x8e455489, 0x48c0ff48, 0x7511f883,
+0xf68440bc, 0x95890674, 0xfffffecc, 0xbd6ffdc5,
+0xffffff30, 0xbd7ffdc5, 0xfffffed0, 0xfed0858b,
+0x3966ffff, 0xffff3085, 0xc0940fff, 0xd29d8b66,
+0x45fffffe, 0x8b66ff31, 0xfffed6bd, 0xc0b60fff,
+0x3966d8f7, 0xffff329d, 0xd49d8bff, 0x66fffffe,
+0xfebebd89, 0x0f41ffff, 0x3145c794, 0x6ef9c5c9,
+0xdff741d0, 0x349d3b66, 0x66ffffff, 0xfe909d89,
+0x0f41ffff, 0x3145c194, 0x69c1c4f6, 0x4101d7c4,
+0x3b66d9f7, 0xffff36bd, 0xd8bd8bff, 0x41fffffe,
+0x31c6940f, 0x79c1c4c9, 0xf741e16e, 0xbd3b66de,
+0xffffff38, 0xbcbd8966, 0x0ffffffe, 0x8b66c194,
+0xfffedabd, 0xed3145ff, 0xc459c1c4, 0xd9f701e6,
+0x3abd3b66, 0xc5ffffff, 0x41d462e9, 0x66c5940f,
+0xfebabd89, 0x3145ffff, 0x6ef9c5c0, 0xdcbd8bc9,
+0x41fffffe, 0x3b66ddf7, 0xffff3cbd, 0x940f41ff,
+0xc4d231c0, 0xcdc471c1, 0xbd896601, 0xfffffeb8,
+0xdebd8b66, 0x41fffffe, 0x3b66d8f7, 0xffff3ebd,
+0x79c1c4ff, 0x940fd86e, 0xbd8966c2, 0xfffffeb6,
+0xfee0bd8b, 0xdaf7ffff, 0x80958966, 0x31fffffe,
+0xbd3b66d2, 0xffffff40, 0xb4bd8966, 0x66fffffe,
+0xfee2bd8b, 0x940fffff, 0xe43145c2, 0x3b66daf7,
+0xffff42bd, 0xbd8966ff, 0xfffffeb2, 0xfee4bd8b,
+0x0f41ffff, 0x8966c494, 0xfffe7c95, 0xdcf741ff,
+0x8966fb89, 0xfffeb0bd, 0x66ff31ff, 0xff449d3b,
+0x0f40ffff, 0x8b66c794, 0xfffee69d, 0xe8958bff,
+0xf7fffffe, 0x9d3b66df, 0xffffff46, 0xeab58b66,
+0x66fffffe, 0xfe8e9d89, 0x940fffff, 0x8b4466c3,
+0xfffeee95, 0x6ef9c5ff, 0xdbb60fef, 0x8c958966,
+0xc5fffffe, 0x809dc4e1, 0x01fffffe, 0x3b66dbf7,
+0xffff4895, 0xb58966ff, 0xfffffe8a, 0x45c2940f,
+0xf1c5db31, 0x4466cb62, 0xfe869589, 0xb60fffff,
+0x6ce9c5d2, 0x6ef9c5d1, 0xfffe7c8d, 0x66daf7ff,
+0xff4ab53b, 0xb58bffff, 0xfffffeec, 0xc471c1c4,
+0x0f4101cc, 0xf9c5c394, 0xd1c5da6e, 0x4101ebc4,
+0x3b66dbf7, 0xffff4cb5, 0xb58966ff, 0xfffffe88,
+0xcd62f1c5, 0xc6940f40, 0xc461c1c4, 0x0f4001db,
+0xdef7f6b6, 0x953b4466, 0xffffff4e, 0xc2940f41,
+0xe66ef9c5, 0xd2b60f45, 0xc4daf741, 0xe2c459c1,
+0x62e1c501, 0x6cf1c5dc, 0x6de3c4cb, 0xe801c118,
+0xfffffcde, 0x60b8c289, 0x84000002, 0x45840fd2,
+0xc500001a, 0xd0bd6ff9, 0xc5fffffe, 0x308dfdc1,
+0xc5ffffff, 0xe0bd6ff9, 0xc5fffffe, 0x4095fdc1,
+0xc4ffffff, 0xca1875e3, 0x7ffdc501, 0xfffef08d,
+0x6ff9c5ff, 0xffff30bd, 0x71e9c5ff, 0xf9c501f7,
+0xff40bd6f, 0xf9c5ffff, 0x6600c2c5, 0xfef08539,
+0x940fffff, 0x71f1c5c0, 0xb60f01f7, 0xc5f9c5c0,
+0xf9c501d1, 0xf705f1c5, 0xc579c5d8, 0x896607d1,
+0xfffe8085, 0xc5f9c5ff, 0x396601c2, 0xfffef285,
+0xc0940fff, 0x0fc93145, 0xd8f7c0b6, 0x7c858966,
+0xc5fffffe, 0x02c2c5f9, 0xf4853966, 0xc5fffffe,
+0x03c2c5f9, 0xc1940f41, 0x41ff3145, 0x3966d9f7,
+0xfffef685, 0xc5f9c5ff, 0x0f4104c2, 0xc931c794,
+0x6e79c1c4, 0xdff741e1, 0xf8853966, 0xc5fffffe,
+0x05c2c5f9, 0x45c1940f, 0xc1c4f631, 0x01e7c459,
+0x3966d9f7, 0xfffefa85, 0xc5f9c5ff, 0x0f4106c2,
+0x3145c694, 0xdef741c0, 0xfc853966, 0xc5fffffe,
+0x07c2c5f9, 0xc0940f41, 0xc5ed3145, 0x80956ef9,
+0xc5fffffe, 0x7c95c4e9, 0x01fffffe, 0x66d8f741,
+0xfefe8539, 0x0f41ffff, 0xf9c5c594, 0xc400c1c5,
+0xd86e79c1, 0x66ddf741, 0xff008539, 0xe9c5ffff,
+0x940fd462, 0xe43145c0, 0xc461c1c4, 0xb60f01dd,
+0x66d8f7c0, 0xff029539, 0xf9c5ffff, 0x4102d1c5,
+0x31c4940f, 0xdcf741ff, 0x04953966, 0xc5ffffff,
+0x03d1c5f9, 0xc7940f40, 0xdff7db31, 0x06953966,
+0xc5ffffff, 0x04d1c5f9, 0xc5c3940f, 0xf7ef6ef9,
+0x953966db, 0xffffff08, 0x45c2940f, 0xd1c5db31,
+0x0f01ebc4, 0xdaf7d2b6, 0x0ab53966, 0xc5ffffff,
+0x06f1c5f9, 0xc3940f41, 0xc96ef9c5, 0x66dbf741,
+0xff0cb539, 0xc1c4ffff, 0x01cec471, 0xc6940f40,
+0xcb62f1c5, 0xda6ef9c5, 0xf6b60f40, 0xd16ce9c5,
+0xc86ef9c5, 0x4466def7, 0xff0e9539, 0xc1c4ffff,
+0x01ccc471, 0xc2940f41, 0xe66ef9c5, 0xc461c1c4,
+0x0f4501db, 0xf1c5d2b6, 0xf741cd62, 0x59c1c4da,
+0xc501e2c4, 0xc5dc62e1, 0xc4cb6cf1, 0xc1186de3,
+0xfaace801, 0xc289ffff, 0x000266b8, 0x0fd28400,
+0x00181384, 0x6ff9c500, 0xfffef0bd, 0xf9c1c5ff,
+0xffff308d, 0x6ff9c5ff, 0xffff00bd, 0xf9c1c5ff,
+0xffff4095, 0x75e3c4ff, 0xc501ca18, 0x108d7ffd,
+0x8bffffff, 0xffff1085, 0x853966ff, 0xfffffed0,
+0x66c0940f, 0xfeb2bd8b, 0x8b66ffff, 0xfffe8e9d,
+0xc0b60fff, 0xfe8c958b, 0x8b66ffff, 0xfffe8ab5,
+0x66d8f7ff, 0xfe808589, 0x8b66ffff, 0xffff1285,
+0x853966ff, 0xfffffed2, 0x45c0940f, 0xb60fc931,
+0x66d8f7c0, 0xfe7c8589, 0x858bffff, 0xfffffe90,
+0x14853b66, 0x66ffffff, 0xfebe858b, 0x0f41ffff,
+0x3145c194, 0xd9f741ff, 0x16853b66, 0x8bffffff,
+0xfffebc85, 0x940f41ff, 0xc4c931c7, 0xe96e79c1,
+0x66dff741, 0xff18853b, 0x8b66ffff, 0xfffeba85,
+0xc1940fff, 0xc4f63145, 0xefc451c1, 0x66d9f701,
+0xff1a853b, 0x858bffff, 0xfffffeb8, 0xc6940f41,
+0xc5c03145, 0x41d16ef9, 0x3b66def7, 0xffff1c85,
+0x858b66ff, 0xfffffeb6, 0xc0940f41, 0xc4ed3145,
+0xd6c469c1, 0xd8f74101, 0x1e853b66, 0x8bffffff,
+0xfffeb485, 0x940f41ff, 0x79c1c4c5, 0xf741e06e,
+0x853b66dd, 0xffffff20, 0x45c0940f, 0xc1c4e431,
+0x01e5c459, 0xc5c0b60f, 0xf7d462e9, 0xbd3b66d8,
+0xffffff22, 0xfeb0bd8b, 0x0f41ffff, 0xf741c494,
+0xbd3b66dc, 0xffffff24, 0xc7940f40, 0xffb60f40,
+0x3b66dff7, 0xffff269d, 0xc3940fff, 0xf76ef9c5,
+0xf7dbb60f, 0x953b66db, 0xffffff28, 0x45c2940f,
+0xc9c5db31, 0x0f01f3c4, 0xdaf7d2b6, 0x2ab53b66,
+0x8bffffff, 0xfffe88b5, 0x940f41ff, 0x6ef9c5c3,
+0xdbf741e2, 0x2cb53b66, 0x66ffffff, 0x86958b44,
+0xc5fffffe, 0x809d6ef9, 0x40fffffe, 0xc4c6940f,
+0xe3c459c1, 0xc4e1c501, 0xfffe7c9d, 0x0f4001ff,
+0xdef7f6b6, 0x953b4466, 0xffffff2e, 0xdd62e1c5,
+0xc2940f41, 0xda6ce1c5, 0xee6ef9c5, 0xd2b60f45,
+0xd06ef9c5, 0xc4daf741, 0xd4c469c1, 0x51c1c401,
+0xc501eac4, 0xc5d662e9, 0xc5e562d9, 0xc4d46ce9,
+0xc21865e3, 0xf878e801, 0xc289ffff, 0x00026bb8,
+0x0fd28400, 0x0015df84, 0x6ffdc500, 0xfffed0bd,
+0x56c4c5ff, 0xffff5095, 0x7ffdc5ff, 0xfffed095,
+0x54f4c5ff, 0xffff508d, 0x7ffdc5ff, 0xfffef08d,
+0x6ffdc5ff, 0xffff10bd, 0x57c4c5ff, 0xffff50bd,
+0x7ffdc5ff, 0xffff10bd, 0x10958bff, 0xc5ffffff,
+0xd08d55f4, 0xc5fffffe, 0x00c1c5f9, 0xc5c23966,
+0x01c1c5f9, 0x45c2940f, 0xb60fff31, 0x66daf7d2,
+0xff128539, 0xf9c5ffff, 0x4102c1c5, 0x45c7940f,
+0xf9c5c931, 0xf741d26e, 0x853966df, 0xffffff14,
+0xc1c5f9c5, 0x940f4103, 0xf63145c1, 0xc469c1c4,
+0xf74101d7, 0x853966d9, 0xffffff16, 0xc1c5f9c5,
+0x940f4104, 0xc4c931c6, 0xe16e79c1, 0x66def741,
+0xff188539, 0xf9c5ffff, 0x0f05c1c5, 0x3145c194,
+0x59c1c4ed, 0xf701e6c4, 0x853966d9, 0xffffff1a,
+0xc1c5f9c5, 0x940f4106, 0xc03145c5, 0xd462e9c5,
+0x66ddf741, 0xff1c8539, 0xf9c5ffff, 0x4107c1c5,
+0x45c0940f, 0xe3c4e431, 0x01c9197d, 0x66d8f741,
+0xff1e8539, 0xf9c5ffff, 0x4100c1c5, 0xc5c4940f,
+0x01f1c5f9, 0xd1c579c5, 0xdcf74107, 0x20853966,
+0xc4ffffff, 0xd86e79c1, 0x31c0940f, 0x61c1c4db,
+0x0f01dcc4, 0xd8f7c0b6, 0x22b53966, 0xc5ffffff,
+0x02f1c5f9, 0x31c3940f, 0x66dbf7ff, 0xff24b539,
+0xf9c5ffff, 0x4003f1c5, 0x45c7940f, 0xdff7db31,
+0x26b53966, 0xc5ffffff, 0x04f1c5f9, 0xc3940f41,
+0xef6ef9c5, 0x66dbf741, 0xff28b539, 0x0f40ffff,
+0xc1c4c694, 0x01ebc451, 0xf6b60f40, 0x8966def7,
+0xfffe90b5, 0xc5f9c5ff, 0x396605f1, 0xffff2ab5,
+0x940f40ff, 0xb60f40c6, 0x66def7f6, 0xfebeb589,
+0xf9c5ffff, 0xc506f1c5, 0x66c96ef9, 0xff2cb539,
+0x0f40ffff, 0xc1c4c694, 0x01cdc471, 0xf6b60f40,
+0xcb62f1c5, 0x9d6ef9c5, 0xfffffe90, 0x9dc4e1c5,
+0xfffffebe, 0xc5def701, 0x66d16ce9, 0x2e953944,
+0x41ffffff, 0xc5c2940f, 0xc5c86ef9, 0x45e66ef9,
+0xc5d2b60f, 0x01cbc4f1, 0xc5daf741, 0xc4cd62f1,
+0xe2c459c1, 0x62e1c501, 0x6cf1c5dc, 0x6de3c4cb,
+0xe801c118, 0xfffff63a, 0x77b8c289, 0x84000002,
+0xa1840fd2, 0xc5000013, 0x30bd6ff9, 0xc5ffffff,
+0x508dd5c1, 0xc5ffffff, 0x40bd6ff9, 0xc5ffffff,
+0x6095d5c1, 0xc4ffffff, 0xca1875e3, 0x7ffdc501,
+0xfffed08d, 0x41c031ff, 0x00000eb8, 0x85c76600,
+0xfffffef0, 0x8d480010, 0xfffef2bd, 0x85c766ff,
+0xffffff0e, 0x8d480010, 0xffff0c8d, 0xc68944ff,
+0x29ca8948, 0xb40366c6, 0xfffef005, 0xc22948ff,
+0x07348966, 0x02c08348, 0x48328966, 0x750ef883,
+0xf0858bdc, 0x31fffffe, 0x853966d2, 0xfffffed0,
+0x66c2940f, 0xfef2858b, 0x3145ffff, 0xbd8b66ff,
+0xffffff02, 0x3966daf7, 0xfffed285, 0xf4858bff,
+0x41fffffe, 0x45c7940f, 0xf9c5c931, 0x4466d26e,
+0xff0e958b, 0xf741ffff, 0x853966df, 0xfffffed4,
+0xf6858b66, 0x41fffffe, 0x45c1940f, 0xc1c4f631,
+0x01d7c469, 0x66d9f741, 0xfed68539, 0x858bffff,
+0xfffffef8, 0xc6940f41, 0xc1c4c931, 0x41e16e79,
+0x3966def7, 0xfffed885, 0x858b66ff, 0xfffffefa,
+0x45c1940f, 0xc1c4ed31, 0x01e6c459, 0x3966d9f7,
+0xfffeda85, 0xfc858bff, 0xc5fffffe, 0x41d462e9,
+0x45c5940f, 0xf9c5c031, 0xf741c96e, 0x853966dd,
+0xfffffedc, 0xfe858b66, 0x41fffffe, 0x45c0940f,
+0xc1c4e431, 0x01cdc471, 0x66d8f741, 0xfede8539,
+0x0f41ffff, 0xc031c494, 0x6e79c1c4, 0xdcf741d8,
+0xe0b53966, 0x66fffffe, 0xff06b58b, 0x940fffff,
+0xc4db31c0, 0xdcc461c1, 0x66d8f701, 0xfee2bd39,
+0xbd8bffff, 0xffffff04, 0xcb62f1c5, 0xc5c3940f,
+0xc5d16ce9, 0xf7c86ef9, 0xbd3966db, 0xfffffee4,
+0xc7940f40, 0xc5db3145, 0x01cbc4f1, 0xffb60f40,
+0x3966dff7, 0xfffee6b5, 0x08b58bff, 0x41ffffff,
+0xc5c3940f, 0x41ef6ef9, 0x3966dbf7, 0xfffee8b5,
+0x940f40ff, 0x51c1c4c6, 0x4001ebc4, 0xc5f6b60f,
+0xf7cd62f1, 0xb58966de, 0xfffffe90, 0x0ab58b66,
+0x66ffffff, 0xfeeab539, 0x0f40ffff, 0x0f40c694,
+0xdef7f6b6, 0xbeb58966, 0x8bfffffe, 0xffff0cb5,
+0xb53966ff, 0xfffffeec, 0xc6940f40, 0xf6b60f40,
+0x4466def7, 0xfeee9539, 0xf9c5ffff, 0xfe909d6e,
+0x0f41ffff, 0xf9c5c294, 0xe1c5e66e, 0xfebe9dc4,
+0x4501ffff, 0x41d2b60f, 0xc1c4daf7, 0x01e2c459,
+0xdc62e1c5, 0xcb6cf1c5, 0x186de3c4, 0xbfe801c1,
+0x89fffff3, 0x02d3b8c2, 0xd2840000, 0x1126840f,
+0xfdc50000, 0xff309d6f, 0xfdc5ffff, 0xff109d7f,
+0xf9c5ffff, 0xff10bd6f, 0xe9c5ffff, 0xc503f771,
+0x20bd6ff9, 0xc5ffffff, 0x03f771f1, 0x186de3c4,
+0xfdc501f9, 0xfe90bd7f, 0xfdc5ffff, 0xfe90bd6f,
+0x958bffff, 0xfffffe90, 0xbd7ffdc5, 0xfffffed0,
+0xb56ff9c5, 0xffffff10, 0xbd6ff9c5, 0xffffff20,
+0xf671f1c5, 0x71e9c502, 0xe3c402f7, 0x01ca1875,
+0x8d7ffdc5, 0xfffffef0, 0x956ff9c5, 0xfffffef0,
+0x8d6ff9c5, 0xffffff00, 0xd2fde9c5, 0xc9fdf1c5,
+0xc2c5f9c5, 0xc5f9c500, 0x79c501f1, 0x6607d1c5,
+0xf9c5c239, 0x0f01c2c5, 0x3145c294, 0xd2b60fff,
+0x3966daf7, 0xfffed285, 0xc5f9c5ff, 0x0f4102c2,
+0x3145c794, 0xdff741c9, 0xd4853966, 0xc5fffffe,
+0x03c2c5f9, 0xc1940f41, 0x41f63145, 0x3966d9f7,
+0xfffed685, 0xc5f9c5ff, 0x0f4104c2, 0xc931c694,
+0x6e79c1c4, 0xdef741e9, 0xd8853966, 0xc5fffffe,
+0x05c2c5f9, 0x45c1940f, 0xc1c4ed31, 0x01eec451,
+0x3966d9f7, 0xfffeda85, 0xc5f9c5ff, 0x0f4106c2,
+0x3145c594, 0xddf741c0, 0xdc853966, 0xc5fffffe,
+0x07c2c5f9, 0xc0940f41, 0xc5e43145, 0x41d26ef9,
+0x3966d8f7, 0xfffede85, 0xc5f9c5ff, 0x0f4100c1,
+0xc1c4c494, 0xc4e06e79, 0xd7c469c1, 0xdcf74101,
+0xe0853966, 0xc5fffffe, 0x0fd562e9, 0xdb31c094,
+0xc459c1c4, 0xb60f01e4, 0x66d8f7c0, 0xfee2b539,
+0xf9c5ffff, 0x0f02f1c5, 0xff31c394, 0x3966dbf7,
+0xfffee4b5, 0xc5f9c5ff, 0x0f4003f1, 0x3145c794,
+0x66dff7db, 0xfee6b539, 0xf9c5ffff, 0x4104f1c5,
+0xc5c3940f, 0x41f76ef9, 0x3966dbf7, 0xfffee8b5,
+0x940f40ff, 0x49c1c4c6, 0x4001f3c4, 0xf7f6b60f,
+0xb58966de, 0xfffffe90, 0xf1c5f9c5, 0xb5396605,
+0xfffffeea, 0xc6940f40, 0xf6b60f40, 0x8966def7,
+0xfffebeb5, 0xc5f9c5ff, 0xf9c506f1, 0x3966c96e,
+0xfffeecb5, 0x940f40ff, 0x71c1c4c6, 0x4001cdc4,
+0xc5f6b60f, 0xc5cc62f1, 0x90a56ef9, 0xc5fffffe,
+0xbea5c4d9, 0x01fffffe, 0xe9c5def7, 0x4466d16c,
+0xfeee9539, 0x0f41ffff, 0xf9c5c294, 0xf9c5c86e,
+0x0f45ee6e, 0xf1c5d2b6, 0x4101cbc4, 0xf1c5daf7,
+0xc1c4ce62, 0x01eac451, 0xe562d9c5, 0xcc6cf1c5,
+0x186de3c4, 0x47e801c1, 0x89fffff1, 0x02f8b8c2,
+0xd2840000, 0x0eae840f, 0xf9c50000, 0xfed0b56f,
+0xf9c5ffff, 0xfee0bd6f, 0xf1c5ffff, 0xc502d671,
+0x02d771e9, 0x1875e3c4, 0xfdc501ca, 0xff108d7f,
+0xf9c5ffff, 0xff10956f, 0xd231ffff, 0x8d6ff9c5,
+0xffffff20, 0xd2fde9c5, 0xc9fdf1c5, 0xc2c5f9c5,
+0xc5f9c500, 0x79c501f1, 0x6607d1c5, 0xfef08539,
+0x940fffff, 0xc5f9c5c2, 0x314501c2, 0x66daf7ff,
+0xfef28539, 0xf9c5ffff, 0x4102c2c5, 0x45c7940f,
+0xf741c931, 0x853966df, 0xfffffef4, 0xc2c5f9c5,
+0x940f4103, 0xf63145c1, 0x66d9f741, 0xfef68539,
+0xf9c5ffff, 0x4104c2c5, 0x31c6940f, 0x79c1c4c9,
+0xf741e96e, 0x853966de, 0xfffffef8, 0xc2c5f9c5,
+0xc1940f05, 0xc4ed3145, 0xeec451c1, 0x66d9f701,
+0xfefa8539, 0xf9c5ffff, 0x4106c2c5, 0x45c5940f,
+0xf741c031, 0x853966dd, 0xfffffefc, 0xc2c5f9c5,
+0x940f4107, 0xe43145c0, 0xd26ef9c5, 0x66d8f741,
+0xfefe8539, 0xf9c5ffff, 0x4100c1c5, 0xc4c4940f,
+0xe06e79c1, 0xc469c1c4, 0xf74101d7, 0x853966dc,
+0xffffff00, 0xd562e9c5, 0x31c0940f, 0x59c1c4db,
+0x0f01e4c4, 0xd8f7c0b6, 0x02b53966, 0xc5ffffff,
+0x02f1c5f9, 0x31c3940f, 0x66dbf7ff, 0xff04b539,
+0xf9c5ffff, 0x4003f1c5, 0x45c7940f, 0xdff7db31,
+0x06b53966, 0xc5ffffff, 0x04f1c5f9, 0xc3940f41,
+0xf76ef9c5, 0x66dbf741, 0xff08b539, 0x0f40ffff,
+0xc1c4c694, 0x01f3c449, 0xf6b60f40, 0x8966def7,
+0xfffe90b5, 0xc5f9c5ff, 0x396605f1, 0xffff0ab5,
+0x940f40ff, 0xb60f40c6, 0x66def7f6, 0xfebeb589,
+0xf9c5ffff, 0xc506f1c5, 0x66c96ef9, 0xff0cb539,
+0x0f40ffff, 0xc1c4c694, 0x01cdc471, 0xf6b60f40,
+0xcc62f1c5, 0xa56ef9c5, 0xfffffe90, 0xa5c4d9c5,
+0xfffffebe, 0xc5def701, 0x66d16ce9, 0x0e953944,
+0x41ffffff, 0xc5c2940f, 0xc5c86ef9, 0x45ee6ef9,
+0xc5d2b60f, 0x01cbc4f1, 0xc5daf741, 0xc4ce62f1,
+0xeac451c1, 0x62d9c501, 0x6cf1c5e5, 0x6de3c4cc,
+0xe801c118, 0xffffef1a, 0xfdb8c289, 0x84000002,
+0x81840fd2, 0xc700000c, 0xfffecc85, 0x000003ff,
+0x7ffdc500, 0xffff109d, 0x6ef9c5ff, 0xfffecca5,
+0x6ff9c5ff, 0xffff2095, 0xf1e1c5ff, 0xf1e9c5ec,
+0x55e3c4e4, 0xc501f418, 0x90b57ffd, 0xc5fffffe,
+0x90bd6ffd, 0x8bfffffe, 0xfffe9095, 0x7ffdc5ff,
+0xfffed0bd, 0xcc85c7ff, 0x02fffffe, 0xc5000000,
+0xcca56ef9, 0xc5fffffe, 0xc5ccf1e1, 0xc4d4f1e9,
+0xca1875e3, 0x7ffdc501, 0xfffef08d, 0x6ff9c5ff,
+0xfffef095, 0x6ff9c5ff, 0xffff008d, 0xfde9c5ff,
+0xfdf1c5d2, 0xc5f9c5c9, 0xf9c500c2, 0xc501f1c5,
+0x07d1c579, 0xc5c23966, 0x01c2c5f9, 0x45c2940f,
+0xb60fff31, 0x66daf7d2, 0xfed28539, 0xf9c5ffff,
+0x4102c2c5, 0x45c7940f, 0xf741c931, 0x853966df,
+0xfffffed4, 0xc2c5f9c5, 0x940f4103, 0xf63145c1,
+0x66d9f741, 0xfed68539, 0xf9c5ffff, 0x4104c2c5,
+0x31c6940f, 0x79c1c4c9, 0xf741e96e, 0x853966de,
+0xfffffed8, 0xc2c5f9c5, 0xc1940f05, 0xc4ed3145,
+0xeec451c1, 0x66d9f701, 0xfeda8539, 0xf9c5ffff,
+0x4106c2c5, 0x45c5940f, 0xf741c031, 0x853966dd,
+0xfffffedc, 0xc2c5f9c5, 0x940f4107, 0xe43145c0,
+0xd26ef9c5, 0x66d8f741, 0xfede8539, 0xf9c5ffff,
+0x4100c1c5, 0xc4c4940f, 0xe06e79c1, 0xc469c1c4,
+0xf74101d7, 0x853966dc, 0xfffffee0, 0xd562e9c5,
+0x31c0940f, 0x59c1c4db, 0x0f01e4c4, 0xd8f7c0b6,
+0xe2b53966, 0xc5fffffe, 0x02f1c5f9, 0x31c3940f,
+0x66dbf7ff, 0xfee4b539, 0xf9c5ffff, 0x4003f1c5,
+0x45c7940f, 0xdff7db31, 0xe6b53966, 0xc5fffffe,
+0x04f1c5f9, 0xc3940f41, 0xf76ef9c5, 0x66dbf741,
+0xfee8b539, 0x0f40ffff, 0xc1c4c694, 0x01f3c449,
+0xf6b60f40, 0x8966def7, 0xfffe90b5, 0xc5f9c5ff,
+0x396605f1, 0xfffeeab5, 0x940f40ff, 0xb60f40c6,
+0x66def7f6, 0xfebeb589, 0xf9c5ffff, 0xc506f1c5,
+0x66c96ef9, 0xfeecb539, 0x0f40ffff, 0xc1c4c694,
+0x01cdc471, 0xf6b60f40, 0xcc62f1c5, 0xa56ef9c5,
+0xfffffe90, 0xa5c4d9c5, 0xfffffebe, 0xc5def701,
+0x66d16ce9, 0xee953944, 0x41fffffe, 0xc5c2940f,
+0xc5c86ef9, 0x45ee6ef9, 0xc5d2b60f, 0x01cbc4f1,
+0xc5daf741, 0xc4ce62f1, 0xeac451c1, 0x62d9c501,
+0x6cf1c5e5, 0x6de3c4cc, 0xe801c118, 0xffffeca2,
+0x10b8c289, 0x84000003, 0x09840fd2, 0xc500000a,
+0xcc956ef9, 0xc5fffffe, 0xd0b56ff9, 0xc5fffffe,
+0xe0bd6ff9, 0xc5fffffe, 0xc5cad1c9, 0xc4d2d1c1,
+0xca1875e3, 0x7ffdc501, 0xffff108d, 0x6ff9c5ff,
+0xffff1095, 0xc5d231ff, 0x208d6ff9, 0xc5ffffff,
+0xc5d2fde9, 0xc5c9fdf1, 0x00c2c5f9, 0xf1c5f9c5,
+0xc579c501, 0x396607d1, 0xfffef085, 0xc2940fff,
+0xc2c5f9c5, 0xff314501, 0x3966daf7, 0xfffef285,
+0xc5f9c5ff, 0x0f4102c2, 0x3145c794, 0xdff741c9,
+0xf4853966, 0xc5fffffe, 0x03c2c5f9, 0xc1940f41,
+0x41f63145, 0x3966d9f7, 0xfffef685, 0xc5f9c5ff,
+0x0f4104c2, 0xc931c694, 0x6e79c1c4, 0xdef741e9,
+0xf8853966, 0xc5fffffe, 0x05c2c5f9, 0x45c1940f,
+0xc1c4ed31, 0x01eec451, 0x3966d9f7, 0xfffefa85,
+0xc5f9c5ff, 0x0f4106c2, 0x3145c594, 0xddf741c0,
+0xfc853966, 0xc5fffffe, 0x07c2c5f9, 0xc0940f41,
+0xc5e43145, 0x41d26ef9, 0x3966d8f7, 0xfffefe85,
+0xc5f9c5ff, 0x0f4100c1, 0xc1c4c494, 0xc4e06e79,
+0xd7c469c1, 0xdcf74101, 0x00853966, 0xc5ffffff,
+0x0fd562e9, 0xdb31c094, 0xc459c1c4, 0xb60f01e4,
+0x66d8f7c0, 0xff02b539, 0xf9c5ffff, 0x0f02f1c5,
+0xff31c394, 0x3966dbf7, 0xffff04b5, 0xc5f9c5ff,
+0x0f4003f1, 0x3145c794, 0x66dff7db, 0xff06b539,
+0xf9c5ffff, 0x4104f1c5, 0xc5c3940f, 0x41f76ef9,
+0x3966dbf7, 0xffff08b5, 0x940f40ff, 0x49c1c4c6,
+0x4001f3c4, 0xf7f6b60f, 0xb58966de, 0xfffffe90,
+0xf1c5f9c5, 0xb5396605, 0xffffff0a, 0xc6940f40,
+0xf6b60f40, 0x8966def7, 0xfffebeb5, 0xc5f9c5ff,
+0xf9c506f1, 0x3966c96e, 0xffff0cb5, 0x940f40ff,
+0x71c1c4c6, 0x4001cdc4, 0xc5f6b60f, 0xc5cc62f1,
+0x90a56ef9, 0xc5fffffe, 0xbea5c4d9, 0x01fffffe,
+0xe9c5def7, 0x4466d16c, 0xff0e9539, 0x0f41ffff,
+0xf9c5c294, 0xf9c5c86e, 0x0f45ee6e, 0xf1c5d2b6,
+0x4101cbc4, 0xf1c5daf7, 0xc1c4ce62, 0x01eac451,
+0xe562d9c5, 0xcc6cf1c5, 0x186de3c4, 0x6fe801c1,
+0x89ffffea, 0x0314b8c2, 0xd2840000, 0x07d6840f,
+0x458b0000, 0x4d8b6690, 0x5d8b6692, 0x9c7d8b9a,
+0x66d8f766, 0x66a6758b, 0xae558b44, 0x66c01966,
+0x4d8bd9f7, 0x19456694, 0x6ef9c5ff, 0xd9f766d0,
+0x964d8b66, 0xc469c1c4, 0x456601d7, 0xf766c919,
+0x984d8bd9, 0x6e79c1c4, 0x194566e9, 0xd9f766f6,
+0xc451c1c4, 0x196601ee, 0xdbf766c9, 0x9e5d8b66,
+0xd562e9c5, 0xed194566, 0x8bdff766, 0xf9c5a07d,
+0x4566c96e, 0xf766c019, 0x5d8b66db, 0x71c1c4a2,
+0x6601cdc4, 0x66e41945, 0x7d8bdff7, 0x79c1c4a4,
+0x1966e06e, 0xdbf766d2, 0xc459c1c4, 0x196601e4,
+0xdff766db, 0xcc62f1c5, 0x66ff1966, 0x758bdef7,
+0x6ce9c5a8, 0x194566d1, 0x6ef9c5db, 0x6ef9c5ca,
+0xdef766f7, 0xcbc4f1c5, 0x49c1c401, 0x6601f3c4,
+0xf1c5f619, 0x8966ce62, 0xfffe90b5, 0x758b66ff,
+0xdef766aa, 0xc5f61966, 0x90a56ef9, 0x66fffffe,
+0xfebeb589, 0x758bffff, 0xc4d9c5ac, 0xfffebea5,
+0xf76601ff, 0xf61966de, 0xdaf74166, 0xd2194566,
+0xee6ef9c5, 0xc451c1c4, 0xd9c501ea, 0xf1c5e562,
+0xe3c4cc6c, 0x01d1186d, 0xd354ecc5, 0xca6ff9c5,
+0x957ffdc5, 0xffffff10, 0x99e8e98f, 0xf9c5906d,
+0xff20956f, 0xe98fffff, 0xa06599e8, 0x1855e3c4,
+0xfdc501f4, 0xfe90b57f, 0xfdc5ffff, 0xfe90bd6f,
+0x958bffff, 0xfffffe90, 0xbd7ffdc5, 0xfffffed0,
+0xe476d9c5, 0x6dfdd9c5, 0xfdd9c590, 0xe3c4a065,
+0x01e41855, 0x657ffdc5, 0xf0e98f90, 0x8f904d99,
+0x5599e8e9, 0x75e3c4a0, 0xc501e218, 0xc5c9fdf1,
+0xc5d2fde9, 0x00c1c5f9, 0xf2c5f9c5, 0xc579c501,
+0xfdc507d2, 0xfef0a57f, 0x3966ffff, 0xc5f9c5c2,
+0x940f01c1, 0xff3145c2, 0xf7d2b60f, 0x853966da,
+0xfffffed2, 0xc1c5f9c5, 0x940f4102, 0xc93145c7,
+0x66dff741, 0xfed48539, 0xf9c5ffff, 0x4103c1c5,
+0x45c1940f, 0xf741f631, 0x853966d9, 0xfffffed6,
+0xc1c5f9c5, 0x940f4104, 0xc4c931c6, 0xe96e79c1,
+0x66def741, 0xfed88539, 0xf9c5ffff, 0x0f05c1c5,
+0x3145c194, 0x51c1c4ed, 0xf701eec4, 0x853966d9,
+0xfffffeda, 0xc1c5f9c5, 0x940f4106, 0xc03145c5,
+0x66ddf741, 0xfedc8539, 0xf9c5ffff, 0x4107c1c5,
+0x45c0940f, 0xf9c5e431, 0xf741c96e, 0x853966d8,
+0xfffffede, 0xc2c5f9c5, 0x940f4100, 0x79c1c4c4,
+0xc1c4e06e, 0x01cdc471, 0x66dcf741, 0xfee08539,
+0x940fffff, 0xc4db31c0, 0xe4c459c1, 0xc0b60f01,
+0xcc62f1c5, 0x3966d8f7, 0xfffee2b5, 0xc5f9c5ff,
+0x940f02f2, 0xf7ff31c3, 0xb53966db, 0xfffffee4,
+0xf2c5f9c5, 0x940f4003, 0xdb3145c7, 0x3966dff7,
+0xfffee6b5, 0xc5f9c5ff, 0x0f4104f2, 0xf9c5c394,
+0xf741f76e, 0xb53966db, 0xfffffee8, 0xc6940f40,
+0xc449c1c4, 0x0f4001f3, 0xdef7f6b6, 0x90b58966,
+0xc5fffffe, 0x05f2c5f9, 0xeab53966, 0x40fffffe,
+0x40c6940f, 0xf7f6b60f, 0x6ef9c5de, 0xfffe90a5,
+0xb58966ff, 0xfffffebe, 0xf2c5f9c5, 0x6ef9c506,
+0xb53966d2, 0xfffffeec, 0xc6940f40, 0xc469c1c4,
+0xd9c501d7, 0xfebea5c4, 0x4001ffff, 0xc5f6b60f,
+0xf7d562e9, 0x394466de, 0xfffeee95, 0x6ce9c5ff,
+0x940f41d1, 0x6ef9c5c2, 0x6ef9c5c8, 0xb60f45ee,
+0xc4f1c5d2, 0xf74101cb, 0x62f1c5da, 0x51c1c4ce,
+0xc501eac4, 0xc5e562d9, 0xc4cc6cf1, 0xc1186de3,
+0xe6dce801, 0xc289ffff, 0x00032cb8, 0x0fd28400,
+0x00044384, 0xeff1c500, 0xf9f1c5c9, 0xf1c59055,
+0x31a04df9, 0x68e98fd2, 0xfef09595, 0xe98fffff,
+0x008d9570, 0xc5ffffff, 0x00c2c5f9, 0xf1c5f9c5,
+0x6de3c401, 0x6601e118, 0xff108539, 0x940fffff,
+0xc5f9c5c2, 0x314501c2, 0x7ffdc5ff, 0xfffed0a5,
+0x66daf7ff, 0xff128539, 0xf9c5ffff, 0x4102c2c5,
+0x45c7940f, 0x79c5c931, 0x4107d1c5, 0x3966dff7,
+0xffff1485, 0xc5f9c5ff, 0x0f4103c2, 0x3145c194,
+0xd9f741f6, 0x16853966, 0xc5ffffff, 0x04c2c5f9,
+0xc6940f41, 0xc1c4c931, 0x41e96e79, 0x3966def7,
+0xffff1885, 0xc5f9c5ff, 0x940f05c2, 0xed3145c1,
+0xc451c1c4, 0xd9f701ee, 0x1a853966, 0xc5ffffff,
+0x06c2c5f9, 0xc5940f41, 0x41c03145, 0x3966ddf7,
+0xffff1c85, 0xc5f9c5ff, 0x0f4107c2, 0x3145c094,
+0x6ef9c5e4, 0xd8f741d2, 0x1e853966, 0xc5ffffff,
+0x00c1c5f9, 0xc4940f41, 0x6e79c1c4, 0x69c1c4e0,
+0x4101d7c4, 0x3966dcf7, 0xffff2085, 0x62e9c5ff,
+0xc0940fd5, 0xc1c4db31, 0x01e4c459, 0xf7c0b60f,
+0xb53966d8, 0xffffff22, 0xf1c5f9c5, 0xc3940f02,
+0xdbf7ff31, 0x24b53966, 0xc5ffffff, 0x03f1c5f9,
+0xc7940f40, 0xf7db3145, 0xb53966df, 0xffffff26,
+0xf1c5f9c5, 0x940f4104, 0x6ef9c5c3, 0xdbf741f7,
+0x28b53966, 0x40ffffff, 0xc4c6940f, 0xf3c449c1,
+0xb60f4001, 0x66def7f6, 0xfe90b589, 0xf9c5ffff,
+0x6605f1c5, 0xff2ab539, 0x0f40ffff, 0x0f40c694,
+0xdef7f6b6, 0xbeb58966, 0xc5fffffe, 0x06f1c5f9,
+0xc96ef9c5, 0x2cb53966, 0x40ffffff, 0xc4c6940f,
+0xcdc471c1, 0xb60f4001, 0x62f1c5f6, 0x6ef9c5cc,
+0xfffe90a5, 0xc4d9c5ff, 0xfffebea5, 0xdef701ff,
+0xd16ce9c5, 0x95394466, 0xffffff2e, 0xc2940f41,
+0xc86ef9c5, 0xee6ef9c5, 0xd2b60f45, 0xcbc4f1c5,
+0xdaf74101, 0xce62f1c5, 0xc451c1c4, 0xd9c501ea,
+0xf1c5e562, 0xe3c4cc6c, 0x01c1186d, 0xffe4c1e8,
+0xb8c289ff, 0x00000331, 0x840fd284, 0x00000228,
+0x8d6ffdc5, 0xffffff50, 0xfdc5c031, 0x01a8d16f,
+0xfdc50475, 0xfdc5d36f, 0x66b0557f, 0xb045548b,
+0x45948966, 0xfffffef0, 0x48c0ff48, 0x7510f883,
+0xe4e88fd9, 0xff708da2, 0x3110ffff, 0xc5f9c5d2,
+0x396600c1, 0xfffef085, 0xc2940fff, 0xc1c5f9c5,
+0xff314501, 0x3966daf7, 0xfffef285, 0xc5f9c5ff,
+0x0f4102c1, 0x3145c794, 0x6ef9c5c9, 0xdff741d2,
+0xf4853966, 0xc5fffffe, 0x03c1c5f9, 0xc1940f41,
+0xc4f63145, 0xd7c469c1, 0xd9f74101, 0xf6853966,
+0xc5fffffe, 0x04c1c5f9, 0xc6940f41, 0xc1c4c931,
+0x41e16e79, 0x3966def7, 0xfffef885, 0xc5f9c5ff,
+0x940f05c1, 0xed3145c1, 0xc459c1c4, 0xd9f701e6,
+0xfa853966, 0xc5fffffe, 0x06c1c5f9, 0xc5940f41,
+0xc5c03145, 0x41d462e9, 0x3966ddf7, 0xfffefc85,
+0xc5f9c5ff, 0x0f4107c1, 0x3145c094, 0x7de3c4e4,
+0x4101c919, 0x3966d8f7, 0xfffefe85, 0xc5f9c5ff,
+0x0f4100c1, 0xf9c5c494, 0xc501f1c5, 0x07d1c579,
+0x66dcf741, 0xff008539, 0xc1c4ffff, 0x0fd86e79,
+0xdb31c094, 0xc461c1c4, 0xb60f01dc, 0x66d8f7c0,
+0xff02b539, 0xf9c5ffff, 0x0f02f1c5, 0xff31c394,
+0x3966dbf7, 0xffff04b5, 0xc5f9c5ff, 0x0f4003f1,
+0x3145c794, 0x66dff7db, 0xff06b539, 0xf9c5ffff,
+0x4104f1c5, 0xc5c3940f, 0x41ef6ef9, 0x3966dbf7,
+0xffff08b5, 0x940f40ff, 0x51c1c4c6, 0x4001ebc4,
+0xf7f6b60f, 0xb58966de, 0xfffffe90, 0xf1c5f9c5,
+0xb5396605, 0xffffff0a, 0xc6940f40, 0xf6b60f40,
+0x8966def7, 0xfffebeb5, 0xc5f9c5ff, 0xf9c506f1,
+0x3966c96e, 0xffff0cb5, 0x940f40ff, 0x71c1c4c6,
+0x4001cdc4, 0xc5f6b60f, 0xc5cb62f1, 0x909d6ef9,
+0xc5fffffe, 0xbe9dc4e1, 0x01fffffe, 0xe9c5def7,
+0x4466d16c, 0xff0e9539, 0x0f41ffff, 0xf9c5c294,
+0xf9c5c86e, 0x0f45e66e, 0xf1c5d2b6, 0x4101cbc4,
+0xf1c5daf7, 0xc1c4cd62, 0x01e2c459, 0xdc62e1c5,
+0xcb6cf1c5, 0x186de3c4, 0x93e801c1, 0x3cffffe2,
+0x25c01901, 0x000003c4, 0x60c48148, 0x5b000001,
+0x5c415a41, 0x5e415d41, 0x495d5f41, 0xc3f8628d,
+0016620,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x09b94100,
+0x48000000, 0x5441e589, 0xe4834853, 0xec8148e0,
+0x000000a8, 0x45ff788d, 0x4489c889, 0xfa890484,
+0x83c02941, 0x894401e2, 0x83248444, 0xd21901fa,
+0xff02e283, 0x40c785ca, 0x89c7940f, 0x40448454,
+0x29ffb60f, 0x844c89f9, 0xc0ff4864, 0x09f88348,
+0xfdc5c275, 0x08247c6f, 0x7c7ffdc5, 0x448ba824,
+0x4439a824, 0x940f0824, 0x245c8bc0, 0xd23145ac,
+0xb8247c8b, 0x44c0b60f, 0xb0244c8b, 0x24448b44,
+0x39d8f7b4, 0x8b0c245c, 0x41bc2474, 0x31c2940f,
+0x244c8bd2, 0x6ef9c5c0, 0xdaf741f8, 0x244c3b44,
+0x0260b810, 0x940f0000, 0xdb3145c2, 0x3b44daf7,
+0x41142444, 0xc5c3940f, 0x31da6ef9, 0xdbf741d2,
+0x18247c3b, 0x31c2940f, 0x61c3c4db, 0xf701db22,
+0x24743bda, 0xc3940f1c, 0xd26ef9c5, 0xdbf7d231,
+0x20244c3b, 0x45c2940f, 0xe3c4e431, 0x01d32269,
+0xf9c5daf7, 0x548bca6e, 0x543bc424, 0x0f412424,
+0xf741c494, 0x71c3c4dc, 0xc501cc22, 0xc4d16ce9,
+0xca2241c3, 0x6cf1c501, 0x75e3c4cb, 0xc501ca18,
+0x41d1507c, 0x00fffa81, 0x850f0000, 0x00000e06,
+0x5c6ff9c5, 0xf9c5a824, 0xb824646f, 0x4cfee1c5,
+0xd9c50824, 0x182454fe, 0x1875e3c4, 0xfdc501ca,
+0xc8244c7f, 0x7c6ff9c5, 0xe9c50824, 0xc501f772,
+0x247c6ff9, 0x7ef9c518, 0x244439d0, 0x79c3c4c8,
+0x0f01d216, 0xf1c5c094, 0x4501f772, 0xb60fdb31,
+0x44d8f7c0, 0xcc245439, 0x1679c3c4, 0x0f4102d2,
+0xf9c5c394, 0x66b8f86e, 0x41000002, 0x3944dbf7,
+0x41d02454, 0x31c2940f, 0xb60f45db, 0xdaf741d2,
+0x6e79c1c4, 0x79c3c4ea, 0x4403d216, 0xd4245439,
+0xc4c3940f, 0xca7e79c1, 0x3944dbf7, 0x41d82454,
+0x45c2940f, 0xe3c4e431, 0x01eb2251, 0xd2b60f45,
+0xc4daf741, 0xd26e79c1, 0x1679c3c4, 0x394401ca,
+0x41dc2454, 0xc4c4940f, 0xca1679c3, 0xdcf74102,
+0x24543944, 0x940f41e0, 0x69c3c4c2, 0x4501d422,
+0x41d2b60f, 0xc1c4daf7, 0xc4f26e79, 0xca1679c3,
+0x54394403, 0x0f41e424, 0xc3c4c294, 0x01cb2241,
+0xd2b60f45, 0xcd6cf1c5, 0xc4daf741, 0xf22249c3,
+0x6ce9c501, 0x75e3c4d6, 0xc501ca18, 0x41d1507c,
+0x00fffa81, 0x850f0000, 0x00000cda, 0x7c6ff9c5,
+0xc1c5c824, 0x08244cfa, 0x7c6ff9c5, 0xc1c5d824,
+0x182454fa, 0x1875e3c4, 0xfdc501ca, 0xe8244c7f,
+0xe824448b, 0xa8244439, 0x8bc0940f, 0x45ec245c,
+0xb60fd231, 0x39d8f7c0, 0x41ac245c, 0x41c2940f,
+0x3b44daf7, 0x41f0244c, 0x45c1940f, 0x41c9b60f,
+0x3b44d9f7, 0x41f42444, 0x45c0940f, 0x41c0b60f,
+0x7c3bd8f7, 0x0f40f824, 0x0f40c794, 0xdff7ffb6,
+0xfc24743b, 0xc6940f40, 0xf6b60f40, 0x0c3bdef7,
+0xc1940f24, 0xf7c9b60f, 0x24543bd9, 0xc2940f04,
+0xf96ef9c5, 0xf7d2b60f, 0x41e3c4da, 0xc501ca22,
+0xc4ff6ef9, 0xd62241e3, 0x79c1c401, 0xc3c4f96e,
+0x01e82241, 0xf86ef9c5, 0xd16ce9c5, 0x00026bb8,
+0x41c3c400, 0xc501ca22, 0xc4cd6cf1, 0xca1875e3,
+0x50fcc501, 0xfffa81d1, 0x0f000000, 0x000bf585,
+0x61e2c400, 0x08244c40, 0x4059e2c4, 0xc4182464,
+0xcc1875e3, 0x6ff9c501, 0xc5382454, 0xc5e96ff9,
+0x244c7ffd, 0x6ff9c5a8, 0xc428244c, 0xd24069e2,
+0x4071e2c4, 0x75e3c4c9, 0xc501ca18, 0xc5f96ff9,
+0x244c7ffd, 0x6ff9c5c8, 0xc508244c, 0x24546ff9,
+0xfef1c518, 0xc528245c, 0x2464fee9, 0x65e3c438,
+0xc501dc18, 0x245c7ffd, 0xfaf1c5e8, 0xc5282474,
+0xc5effad1, 0x247c6ff9, 0x7ef9c5b8, 0xfae9c5e8,
+0xc4382464, 0x644059e2, 0xe2c4f824, 0xc5f34049,
+0x245cfac1, 0x7ef9c5d8, 0x79e3c4f2, 0x3901f116,
+0x79e3c4c2, 0x0f01ea16, 0x3145c094, 0xc0b60fc0,
+0xd139d8f7, 0x1679e3c4, 0xe3c402f1, 0x02ea1679,
+0xc0940f41, 0x39d8f741, 0x79e3c4d1, 0x0f03f116,
+0x3145c294, 0xd2b60fd2, 0xe3c4d789, 0x03ea1679,
+0xd139dff7, 0xe17ef9c5, 0xda7ef9c5, 0xc2940f41,
+0xff6ef9c5, 0x39daf741, 0x79e3c4d1, 0x0f01e116,
+0x3145c294, 0x41c3c4db, 0x0f01ea22, 0xd689d2b6,
+0x1679e3c4, 0xdef701da, 0xe3c4d139, 0x02e11679,
+0x1679e3c4, 0x0f4102da, 0xf741c394, 0xc4d139db,
+0xe11679e3, 0xc2940f03, 0xf7d2b60f, 0xd18941da,
+0x1679e3c4, 0xd13903da, 0x6e79c1c4, 0xc2940ff1,
+0xf7d2b60f, 0x49e3c4da, 0xc501da22, 0xc4f66ef9,
+0xe32249c3, 0x6ef9c501, 0x0282b8f0, 0xd9c50000,
+0xc3c4e36c, 0x01d82249, 0xdd6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x0a64850f,
+0xe2c40000, 0x245c4071, 0x69e2c428, 0x38246440,
+0x1865e3c4, 0xf9c501dc, 0xfdc5d87e, 0xa8245c7f,
+0x0f08f883, 0xf631c094, 0xf7c0b60f, 0x247c83d8,
+0x0f400eac, 0xd231c694, 0x7c83def7, 0x0f12b024,
+0xff31c294, 0x7c83daf7, 0x4014b424, 0xc5c7940f,
+0x31ea6ef9, 0x83dff7d2, 0x14b8247c, 0x45c2940f,
+0xe3c4c031, 0x01ef2251, 0x7c83daf7, 0x4112bc24,
+0x31c0940f, 0x6ef9c5c9, 0xd8f741f2, 0xc0247c83,
+0xc1940f0e, 0xc4c93145, 0xe02249c3, 0x83d9f701,
+0x08c4247c, 0xc1940f41, 0xf96ef9c5, 0xc4d9f741,
+0xd92241c3, 0x6ef9c501, 0x02d3b8f8, 0xd9c50000,
+0xe3c4e36c, 0x01de2241, 0xdd6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x0994850f,
+0xe2c40000, 0x244c4071, 0x69e2c448, 0x58245440,
+0x1875e3c4, 0xfdc501ea, 0xe8246c7f, 0x746ff9c5,
+0xf9c5e824, 0xf8247c6f, 0xf672e1c5, 0x72d9c503,
+0xe3c403f7, 0x01dc1865, 0xd87ef9c5, 0x5c7ffdc5,
+0xf9c5a824, 0xe824746f, 0x7c6ff9c5, 0xe1c5f824,
+0xc502f672, 0x02f772d9, 0x1865e3c4, 0xfdc501dc,
+0xc8245c7f, 0x646ff9c5, 0xf9c5c824, 0xd8245c6f,
+0xe4fed9c5, 0xdbfee1c5, 0xe27ef9c5, 0xe3c4d039,
+0x01e21679, 0x31c0940f, 0xc0b60ff6, 0x5439d8f7,
+0xe3c4ac24, 0x02e21679, 0xc6940f40, 0x5439def7,
+0x940fb024, 0x0fff31c2, 0xdaf7d2b6, 0xf26ef9c5,
+0x1679e3c4, 0x543903e2, 0x0f40b424, 0xf9c5c794,
+0xdff7da7e, 0xb8245439, 0x45c2940f, 0xe3c4c031,
+0x01f72249, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4e2,
+0x3901da16, 0x41bc2454, 0xc4c0940f, 0xda1679e3,
+0xd8f74102, 0xc0245439, 0xc4c2940f, 0xe02259c3,
+0xd2b60f01, 0xe3c4d189, 0x03da1679, 0x5439d9f7,
+0x940fc424, 0x6ef9c5c2, 0xd2b60ff9, 0xe3c4daf7,
+0x01da2241, 0xf86ef9c5, 0x0002f8b8, 0x6cd9c500,
+0x41e3c4e3, 0xc501de22, 0xc4de6ce1, 0xdc1865e3,
+0x50fcc501, 0xfffa81d3, 0x0f000000, 0x00084585,
+0x6ff9c500, 0xc5a82474, 0x02e672e1, 0x746ff9c5,
+0xd9c5b824, 0xc402e672, 0xdc1865e3, 0x7ffdc501,
+0xc5e8245c, 0x24646ff9, 0x6ff9c5e8, 0xc5f8245c,
+0xc5e4fed9, 0xc5dbfee1, 0x39e07ef9, 0xc4c82444,
+0xe21679e3, 0xc0940f01, 0xb60ff631, 0x39d8f7c0,
+0xc4cc2454, 0xe21679e3, 0x940f4002, 0x39def7c6,
+0x0fd02454, 0xff31c294, 0xf7d2b60f, 0x6ef9c5da,
+0x79e3c4f2, 0x3903e216, 0x40d42454, 0xc5c7940f,
+0xf7da7ef9, 0x245439df, 0xc2940fd8, 0xc4c03145,
+0xf72249e3, 0xd2b60f01, 0xf9c5daf7, 0xe3c4e26e,
+0x01da1679, 0xdc245439, 0xc0940f41, 0x1679e3c4,
+0xf74102da, 0x245439d8, 0xc2940fe0, 0x2259c3c4,
+0xb60f01e0, 0xc4d189d2, 0xda1679e3, 0x39d9f703,
+0x0fe42454, 0xf9c5c294, 0xb60ff96e, 0xc4daf7d2,
+0xda2241e3, 0x6ef9c501, 0x02fdb8f8, 0xd9c50000,
+0xe3c4e36c, 0x01de2241, 0xde6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x0734850f,
+0x44c70000, 0x0003a424, 0xf9c50000, 0xfdc5dd6f,
+0xe8246c7f, 0x24446348, 0x6ff9c5a4, 0xc4f82464,
+0xf06ef9e1, 0xeef2d1c5, 0xf6f2d9c5, 0x1855e3c4,
+0xf9c501ee, 0xfdc5e87e, 0xa8246c7f, 0xa42444c7,
+0x00000002, 0x245c6348, 0xf9e1c4a4, 0xe1c5eb6e,
+0xd9c5ddf2, 0xe3c4e5f2, 0x01dc1865, 0x5c7ffdc5,
+0xf9c5c824, 0xc824646f, 0x5c6ff9c5, 0xd9c5d824,
+0xe1c5e4fe, 0xf9c5dbfe, 0xd039e27e, 0x1679e3c4,
+0x940f01e2, 0x0ff631c0, 0xd8f7c0b6, 0xac245439,
+0x1679e3c4, 0x0f4002e2, 0xdef7c694, 0xb0245439,
+0x31c2940f, 0xd2b60fff, 0xf9c5daf7, 0xe3c4ea6e,
+0x03e21679, 0xb4245439, 0xc7940f40, 0xda7ef9c5,
+0x5439dff7, 0x940fb824, 0xc03145c2, 0x2251e3c4,
+0xb60f01ef, 0xc5daf7d2, 0xc4e26ef9, 0xda1679e3,
+0x24543901, 0x940f41bc, 0x79e3c4c0, 0x4102da16,
+0x5439d8f7, 0x940fc024, 0x59c3c4c2, 0x0f01e022,
+0xd189d2b6, 0x1679e3c4, 0xd9f703da, 0xc4245439,
+0xc5c2940f, 0x0ff16ef9, 0xdaf7d2b6, 0x2249e3c4,
+0xf9c501da, 0x10b8f06e, 0xc5000003, 0xc4e36cd9,
+0xde2249e3, 0x6ce1c501, 0x65e3c4dd, 0xc501dc18,
+0x81d350fc, 0x0000fffa, 0xe7850f00, 0x48000005,
+0xa4244463, 0x6c6ff9c5, 0xe1c4a824, 0xc5e06ef9,
+0xc5dce2d1, 0x246c6ff9, 0xe2d1c5b8, 0x65e3c4e4,
+0xc501dc18, 0x245c7ffd, 0x6ff9c5e8, 0xc5e82464,
+0x245c6ff9, 0xfed9c5f8, 0xfee1c5e4, 0x7ef9c5db,
+0x244439e0, 0x79e3c4c8, 0x0f01e216, 0xf631c094,
+0xf7c0b60f, 0x245439d8, 0x79e3c4cc, 0x4002e216,
+0xc5c6940f, 0xb8f86ef9, 0x00000314, 0x5439def7,
+0x940fd024, 0x0fff31c2, 0xdaf7d2b6, 0xea6ef9c5,
+0x1679e3c4, 0x543903e2, 0x0f40d424, 0xf9c5c794,
+0xdff7da7e, 0xd8245439, 0x45c2940f, 0xe3c4c031,
+0x01ef2251, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4e2,
+0x3901da16, 0x41dc2454, 0xc4c0940f, 0xda1679e3,
+0xd8f74102, 0xe0245439, 0xc4c2940f, 0xe02259c3,
+0xd2b60f01, 0xe3c4d189, 0x03da1679, 0x5439d9f7,
+0x940fe424, 0x6ef9c5c2, 0xd2b60ff1, 0xe3c4daf7,
+0x01da2249, 0xe36cd9c5, 0x2241e3c4, 0xe1c501de,
+0xe3c4dd6c, 0x01dc1865, 0xd350fcc5, 0x00fffa81,
+0x850f0000, 0x000004ce, 0xc87ef9c5, 0x1679c3c4,
+0xf9c501ca, 0xf631d77e, 0x68247c83, 0x79c3c400,
+0xc402c816, 0xca1679e3, 0xc64e0f03, 0x6c247c83,
+0x79c3c400, 0xc401d316, 0xd11679c3, 0x79e3c402,
+0x4403d116, 0x83d64e0f, 0x0070247c, 0xc64e0f44,
+0x74247c83, 0xd64e0f00, 0x78247c83, 0xfe4e0f00,
+0x6e79c1c4, 0x247c83f8, 0x0f44007c, 0xbc83de4e,
+0x00008024, 0xf9c50000, 0xe3c4f76e, 0x01da2241,
+0xce4e0f44, 0x8424bc83, 0x00000000, 0x2249c3c4,
+0x4e0f01cb, 0x79c1c4ce, 0xe3c4e96e, 0x01d12251,
+0xe86ef9c5, 0xca6cf1c5, 0x2251c3c4, 0xe9c501d2,
+0xe3c4d36c, 0x01d1186d, 0xca6ff9c5, 0x547ffdc5,
+0xe98fe824, 0x245c9ae8, 0x6ff9c568, 0x8ff82454,
+0x649ae8e9, 0xe3c47824, 0x01dc1865, 0xda7ef9c5,
+0x5c7ffdc5, 0x01b8a824, 0xc5000000, 0x247c6ff9,
+0x6ff9c568, 0xc578246c, 0xc5f06ef9, 0x00e670f9,
+0xdcfac1c5, 0xe4fad1c5, 0x1865e3c4, 0xfdc501dc,
+0x68245c7f, 0x9af0e98f, 0x8f68244c, 0x549ae8e9,
+0xe3c47824, 0x01da1875, 0xc9fef1c5, 0xd2fee9c5,
+0xc87ef9c5, 0x5c7ffdc5, 0xc239c824, 0x31c0940f,
+0xc0b60ff6, 0xc289d8f7, 0x1679e3c4, 0x443901c8,
+0x0f40ac24, 0xe3c4c694, 0x02c81679, 0xfa6ef9c5,
+0x4439def7, 0x940fb024, 0x0fff31c0, 0xd8f7c0b6,
+0xd86ef9c5, 0x1679e3c4, 0x443903c8, 0x0f40b424,
+0xf9c5c794, 0xdff7d07e, 0xb8244439, 0x45c0940f,
+0xe3c4c031, 0x01df2261, 0xf7c0b60f, 0xc4c189d8,
+0xd01679e3, 0x24443901, 0x940f41bc, 0x79e3c4c0,
+0xc502d016, 0x41f16ef9, 0x4439d8f7, 0x940fc024,
+0xc0b60fc0, 0xf9c5d8f7, 0xe3c4c86e, 0x03d01679,
+0xc4244439, 0xc4c0940f, 0xd02249c3, 0xc0b60f01,
+0xe3c4d8f7, 0x01c82271, 0x00032cb8, 0x6ce9c500,
+0x41e3c4d1, 0xc501ce22, 0xc4cb6cf1, 0xca1875e3,
+0x50fcc501, 0xfffa81d1, 0x0f000000, 0x0002c585,
+0xeff1c500, 0xfaf1c5c9, 0xc5682454, 0x244cfaf1,
+0x68e98f78, 0xc824549a, 0x9a70e98f, 0xc5d8244c,
+0x39d07ef9, 0xc4e82444, 0xd9186de3, 0xc0940f01,
+0xfdc5f631, 0xa8245c7f, 0xf7c0b60f, 0xc4c289d8,
+0xd01679e3, 0x24443901, 0x940f40ec, 0x79e3c4c6,
+0xc502d016, 0xf7f26ef9, 0x244439de, 0xc0940ff0,
+0xb60fff31, 0xc5d8f7c0, 0xc4d86ef9, 0xd01679e3,
+0x24443903, 0x940f40f4, 0x7ef9c5c7, 0x39dff7c8,
+0x0ff82444, 0x3145c094, 0x61e3c4c0, 0x0f01df22,
+0xd8f7c0b6, 0xd06ef9c5, 0x1679e3c4, 0x443901c8,
+0x0f41fc24, 0xe3c4c094, 0x02c81679, 0x39d8f741,
+0x940f2404, 0x69c3c4c0, 0x0f01d022, 0xd8f7c0b6,
+0xe3c4c189, 0x03c81679, 0x04244439, 0xc5c0940f,
+0x0fe96ef9, 0xd8f7c0b6, 0x2251e3c4, 0x31b801c8,
+0xc5000003, 0xc4d16ce9, 0xce2249e3, 0x6cf1c501,
+0x75e3c4cb, 0xc501ca18, 0x81d150fc, 0x0000fffa,
+0xbf850f00, 0xc5000001, 0x244c6ffd, 0x6ffdc508,
+0x3128246c, 0x6ffdc5c0, 0x7501a8d5, 0x6ffdc504,
+0x7ffdc5d1, 0x00882494, 0x948b0000, 0x00008884,
+0x84548900, 0xc0ff48c8, 0x08f88348, 0xc031d775,
+0x48247c83, 0xc09f0f00, 0xd8f7f631, 0x4c247c83,
+0x9f0f4000, 0xf7d231c6, 0x247c83de, 0x9f0f0050,
+0xf7ff31c2, 0x247c83da, 0x0f400054, 0xf9c5c79f,
+0xd231e26e, 0x7c83dff7, 0x0f005824, 0x3145c29f,
+0x59e3c4c0, 0xf701e722, 0x247c83da, 0x0f41005c,
+0xc931c09f, 0xf26ef9c5, 0x83d8f741, 0x0060247c,
+0x45c19f0f, 0xc3c4c931, 0x01d82249, 0x7c83d9f7,
+0x41006424, 0xc5c19f0f, 0x41f96ef9, 0xc3c4d9f7,
+0x01d12241, 0xf86ef9c5, 0xda6ce1c5, 0x2241e3c4,
+0xe9c501d6, 0xe3c4d46c, 0x01d3186d, 0xa274e88f,
+0xf9c520cd, 0x4439c87e, 0x940fc824, 0x0ff631c0,
+0xd8f7c0b6, 0xe3c4c289, 0x01c81679, 0xcc244439,
+0xc6940f40, 0x1679e3c4, 0xdef702c8, 0xd0244439,
+0x31c0940f, 0xc0b60fff, 0xf9c5d8f7, 0xe3c4d86e,
+0x03c81679, 0xd4244439, 0x197de3c4, 0x0f4001c9,
+0xf9c5c794, 0xdff7c87e, 0xd8244439, 0x45c0940f,
+0xe3c4c031, 0x01df2261, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d0, 0x3901c816, 0x41dc2444, 0xc4c0940f,
+0xc81679e3, 0xd8f74102, 0xe0244439, 0xc4c0940f,
+0xd02269c3, 0xc0b60f01, 0xc189d8f7, 0x1679e3c4,
+0x443903c8, 0x940fe424, 0x6ef9c5c0, 0xc0b60fe9,
+0xe3c4d8f7, 0x01c82251, 0xea6ef9c5, 0x000000ba,
+0x6ce9c500, 0x51e3c4d1, 0xc501ce22, 0xc4cb6cf1,
+0xca1875e3, 0x50fcc501, 0x00ff3dc1, 0xc4b80000,
+0x0f000003, 0x8d48c244, 0x415bf065, 0x00c35d5c,
+0007517,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000008,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0xa8ec8148, 0x89000000, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xff088474, 0x89c685c9,
+0x4128847c, 0x89c0940f, 0x4448844c, 0x5489c229,
+0xff486884, 0xf88348c0, 0xc5cc7508, 0x24746ffd,
+0x7ffdc508, 0x8ba82474, 0x39a82444, 0x0f082444,
+0x3145c094, 0x247c8bdb, 0x24748bb8, 0xc0b60fbc,
+0x24548b44, 0x4c8b44ac, 0xd8f7b024, 0x24543b44,
+0x448b440c, 0x0f41b424, 0xd231c394, 0xc0244c8b,
+0xf86ef9c5, 0x44dbf741, 0x10244c3b, 0x000260b8,
+0xc2940f00, 0xdaf7db31, 0x24443b44, 0xc3940f14,
+0xda6ef9c5, 0xdbf7d231, 0x18247c3b, 0x45c2940f,
+0xe3c4e431, 0x01db2261, 0x743bdaf7, 0x0f411c24,
+0xf9c5c494, 0xd231d26e, 0x3bdcf741, 0x0f20244c,
+0x3145c294, 0x69c3c4ed, 0xf701d422, 0x6ef9c5da,
+0x24548bca, 0x24543bc4, 0x940f4124, 0xddf741c5,
+0x2271c3c4, 0xe9c501cd, 0xc3c4d16c, 0x01cb2241,
+0xcb6cf1c5, 0x1875e3c4, 0x7cc501ca, 0x8141d950,
+0x0000fffb, 0x8c850f00, 0xc500000c, 0x24746ff9,
+0x6ff9c5a8, 0xc5b8247c, 0x244cfec9, 0xfec1c508,
+0xc4182454, 0xca1875e3, 0x7ffdc501, 0xc5c8244c,
+0x24746ff9, 0x6ff9c508, 0xc518247c, 0x01f672f1,
+0xf772e9c5, 0x7ef9c501, 0x244439c8, 0x79c3c4c8,
+0x0f01cb16, 0x3145c094, 0x79e3c4e4, 0x0f01d316,
+0xd8f7c0b6, 0x245c3944, 0x79c3c4cc, 0x4102cb16,
+0xc5c4940f, 0xb8f86ef9, 0x00000266, 0x44dcf741,
+0xd0245c39, 0xc3940f41, 0x45ed3145, 0x41dbb60f,
+0xc1c4dbf7, 0xc4db6e79, 0xcb1679c3, 0x5c394403,
+0x0f41d424, 0xc1c4c594, 0x41d37e79, 0x3944ddf7,
+0x41d8245c, 0x45c3940f, 0xc3c4f631, 0x01dd2261,
+0xdbb60f45, 0x39dbf741, 0xc4dc245c, 0xd31679e3,
+0x940f4102, 0x79c1c4c6, 0xf741f36e, 0x245c39de,
+0xc3940fe0, 0x0fff3145, 0xdbf7dbb6, 0xcb6ef9c5,
+0x1679e3c4, 0x5c3903d3, 0x0f41e424, 0xc3c4c794,
+0x01d62249, 0xc4dff741, 0xcf2271c3, 0x6ce9c501,
+0x41c3c4d1, 0xc501cc22, 0xc4cb6cf1, 0xca1875e3,
+0x507cc501, 0xfb8141d9, 0x000000ff, 0x0b65850f,
+0xf9c50000, 0xc824746f, 0x7c6ff9c5, 0xc9c5d824,
+0x08244cfa, 0x54fac1c5, 0xe3c41824, 0x01ca1875,
+0x4c7ffdc5, 0x448be824, 0x4439e824, 0x940fa824,
+0xc0b60fc0, 0x3b44d8f7, 0x41ec2454, 0x45c2940f,
+0x41d2b60f, 0x3b44daf7, 0x41f0244c, 0x45c1940f,
+0x41c9b60f, 0x3b44d9f7, 0x41f42444, 0x45c0940f,
+0x41c0b60f, 0x7c3bd8f7, 0x0f40f824, 0x0f40c794,
+0xdff7ffb6, 0xfc24743b, 0xc6940f40, 0xff6ef9c5,
+0xf6b60f40, 0x0c3bdef7, 0xc1940f24, 0x2241e3c4,
+0xf9c501de, 0x6bb8f86e, 0x0f000002, 0xd9f7c9b6,
+0x0424543b, 0xc5c2940f, 0x0ff16ef9, 0xdaf7d2b6,
+0x2249e3c4, 0xc1c401d2, 0xc5f16e79, 0xc4da6ce1,
+0xe02249c3, 0x41c3c401, 0xc501d222, 0xc4d46ce9,
+0xd3186de3, 0x50fcc501, 0xfffa81d2, 0x0f000000,
+0x000a8285, 0x6ffdc500, 0xc5a82474, 0x245456cc,
+0x7ffdc528, 0xc5a82454, 0x244c54f4, 0x6ffdc528,
+0xc5e8247c, 0x245457c4, 0x7ef9c528, 0x7ffdc5d0,
+0xc5e82454, 0x244c55f4, 0x7ef9c5a8, 0x0fd039ca,
+0xf631c094, 0xf7c0b60f, 0xc4c289d8, 0xc81679e3,
+0x24443901, 0x940f40ec, 0x79e3c4c6, 0xc502c816,
+0xf7fa6ef9, 0x244439de, 0xc0940ff0, 0xb60fff31,
+0xc5d8f7c0, 0xc4d86ef9, 0xc81679e3, 0x24443903,
+0x7de3c4f4, 0x4001c919, 0xc5c7940f, 0xf7c87ef9,
+0x244439df, 0xc0940ff8, 0xc4c03145, 0xdf2261e3,
+0xc0b60f01, 0xf9c5d8f7, 0xe3c4d06e, 0x01c81679,
+0xfc244439, 0xc0940f41, 0x1679e3c4, 0xf74102c8,
+0x240439d8, 0xc4c0940f, 0xd02269c3, 0xc0b60f01,
+0xc189d8f7, 0x1679e3c4, 0x443903c8, 0x940f0424,
+0x6ef9c5c0, 0xc0b60ff1, 0xe3c4d8f7, 0x01c82249,
+0x000277b8, 0x6ce9c500, 0x41e3c4d1, 0xc501ce22,
+0xc4cb6cf1, 0xca1875e3, 0x50fcc501, 0xfffa81d1,
+0x0f000000, 0x00096e85, 0x6ff9c500, 0xc508246c,
+0x24746ff9, 0x51e2c418, 0x28244c40, 0x4049e2c4,
+0xc4382454, 0xca1875e3, 0x7ef9c501, 0x7ffdc5c8,
+0x83a8244c, 0x940f08f8, 0x0ff631c0, 0xd8f7c0b6,
+0xac247c83, 0x940f400e, 0xc5d231c6, 0xb8f06ef9,
+0x000002d3, 0x7c83def7, 0x0f12b024, 0xff31c294,
+0x7c83daf7, 0x4014b424, 0xc5c7940f, 0x31da6ef9,
+0x83dff7d2, 0x14b8247c, 0x45c2940f, 0xe3c4c031,
+0x01df2261, 0x7c83daf7, 0x4112bc24, 0x31c0940f,
+0x6ef9c5c9, 0xd8f741ea, 0xc0247c83, 0xc1940f0e,
+0xc4c93145, 0xd02251c3, 0x83d9f701, 0x08c4247c,
+0xc1940f41, 0xf96ef9c5, 0xc4d9f741, 0xc92241c3,
+0x6ce9c501, 0x49e3c4d1, 0xc501ce22, 0xc4cb6cf1,
+0xca1875e3, 0x50fcc501, 0xfffa81d1, 0x0f000000,
+0x00089285, 0x6ffdc500, 0xc5082454, 0x24547ffd,
+0x6ff9c5e8, 0xc5e8247c, 0x246c6ff9, 0x72f1c5f8,
+0xe1c503f7, 0xc403f572, 0xcb1875e3, 0x7ef9c501,
+0x7ffdc5c8, 0xc5a8244c, 0x24746ff9, 0x6ff9c5e8,
+0xc5f8247c, 0x02f672f1, 0xf772e1c5, 0x75e3c402,
+0xc501cb18, 0x244c7ffd, 0x6ff9c5c8, 0xc5c8245c,
+0x244c6ff9, 0xfee1c5d8, 0xfef1c5db, 0x7ef9c5c9,
+0xc4d039da, 0xda1679e3, 0xc0940f01, 0xb60ff631,
+0x39d8f7c0, 0xc4ac2454, 0xda1679e3, 0x940f4002,
+0x6ef9c5c6, 0x02f8b8f0, 0xdef70000, 0xb0245439,
+0x31c2940f, 0xd2b60fff, 0xf9c5daf7, 0xe3c4e26e,
+0x03da1679, 0xb4245439, 0xc7940f40, 0xca7ef9c5,
+0x5439dff7, 0x940fb824, 0xc03145c2, 0x2259e3c4,
+0xb60f01e7, 0xc5daf7d2, 0xc4da6ef9, 0xca1679e3,
+0x24543901, 0x940f41bc, 0x79e3c4c0, 0x4102ca16,
+0x5439d8f7, 0x940fc024, 0x61c3c4c2, 0x0f01d822,
+0xd189d2b6, 0x1679e3c4, 0xd9f703ca, 0xc4245439,
+0xc5c2940f, 0x0fe96ef9, 0xdaf7d2b6, 0x2251e3c4,
+0xe1c501ca, 0xe3c4d96c, 0x01ce2249, 0xcc6cf1c5,
+0x1875e3c4, 0xfcc501cb, 0xfa81d150, 0x000000ff,
+0x0751850f, 0xf9c50000, 0xa8247c6f, 0x6c6ff9c5,
+0xf1c5b824, 0xc502d772, 0x02d572e1, 0x1875e3c4,
+0xfdc501cb, 0xe8244c7f, 0x5c6ff9c5, 0xf9c5e824,
+0xf8244c6f, 0xdbfee1c5, 0xc9fef1c5, 0xd87ef9c5,
+0xc8244439, 0x1679e3c4, 0x940f01da, 0x0ff631c0,
+0xd8f7c0b6, 0xcc245439, 0x1679e3c4, 0x0f4002da,
+0xf9c5c694, 0xfdb8f86e, 0xf7000002, 0x245439de,
+0xc2940fd0, 0xb60fff31, 0xc5daf7d2, 0xc4e26ef9,
+0xda1679e3, 0x24543903, 0x940f40d4, 0x7ef9c5c7,
+0x39dff7ca, 0x0fd82454, 0x3145c294, 0x59e3c4c0,
+0x0f01e722, 0xdaf7d2b6, 0xda6ef9c5, 0x1679e3c4,
+0x543901ca, 0x0f41dc24, 0xe3c4c094, 0x02ca1679,
+0x39d8f741, 0x0fe02454, 0xc3c4c294, 0x01d82261,
+0x89d2b60f, 0x79e3c4d1, 0xf703ca16, 0x245439d9,
+0xc2940fe4, 0xf16ef9c5, 0xf7d2b60f, 0x49e3c4da,
+0xc501ca22, 0xc4d96ce1, 0xce2241e3, 0x6cf1c501,
+0x75e3c4cc, 0xc501cb18, 0x81d150fc, 0x0000fffa,
+0x40850f00, 0xc7000006, 0x03a42444, 0xc5000000,
+0x24547ffd, 0x6ef9c5e8, 0xc5a4246c, 0x245c6ff9,
+0xf2e9c5f8, 0xf2e1c5e5, 0x5de3c4ed, 0xc501e518,
+0xc5e07ef9, 0x24647ffd, 0x2444c7a8, 0x000002a4,
+0x6ef9c500, 0xc5a42464, 0xc5ccf2e9, 0xc4dcf2e1,
+0xcb1875e3, 0x7ffdc501, 0xc5c8244c, 0x245c6ff9,
+0x6ff9c5c8, 0xc5d8244c, 0xc5dbfee1, 0xc5c9fef1,
+0x39da7ef9, 0x79e3c4d0, 0x0f01da16, 0xf631c094,
+0xf7c0b60f, 0x245439d8, 0x79e3c4ac, 0x4002da16,
+0xc5c6940f, 0xb8f06ef9, 0x00000310, 0x5439def7,
+0x940fb024, 0x0fff31c2, 0xdaf7d2b6, 0xe26ef9c5,
+0x1679e3c4, 0x543903da, 0x0f40b424, 0xf9c5c794,
+0xdff7ca7e, 0xb8245439, 0x45c2940f, 0xe3c4c031,
+0x01e72259, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4da,
+0x3901ca16, 0x41bc2454, 0xc4c0940f, 0xca1679e3,
+0xd8f74102, 0xc0245439, 0xc4c2940f, 0xd82261c3,
+0xd2b60f01, 0xe3c4d189, 0x03ca1679, 0x5439d9f7,
+0x940fc424, 0x6ef9c5c2, 0xd2b60fe9, 0xe3c4daf7,
+0x01ca2251, 0xd96ce1c5, 0x2249e3c4, 0xf1c501ce,
+0xe3c4cc6c, 0x01cb1875, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x000004ff, 0x5c6ef9c5, 0xf9c5a424,
+0xa8247c6f, 0x6c6ff9c5, 0xc1c5b824, 0xd1c5cbd2,
+0xe3c4dbd2, 0x01cb1875, 0x4c7ffdc5, 0xf9c5e824,
+0xe8245c6f, 0x4c6ff9c5, 0xe1c5f824, 0xf1c5dbfe,
+0xf9c5c9fe, 0x4439d87e, 0xe3c4c824, 0x01da1679,
+0x31c0940f, 0xc0b60ff6, 0x5439d8f7, 0xe3c4cc24,
+0x02da1679, 0xc6940f40, 0xf86ef9c5, 0x000314b8,
+0x39def700, 0x0fd02454, 0xff31c294, 0xf7d2b60f,
+0x6ef9c5da, 0x79e3c4e2, 0x3903da16, 0x40d42454,
+0xc5c7940f, 0xf7ca7ef9, 0x245439df, 0xc2940fd8,
+0xc4c03145, 0xe72259e3, 0xd2b60f01, 0xf9c5daf7,
+0xe3c4da6e, 0x01ca1679, 0xdc245439, 0xc0940f41,
+0x1679e3c4, 0xf74102ca, 0x245439d8, 0xc2940fe0,
+0x2261c3c4, 0xb60f01d8, 0xc4d189d2, 0xca1679e3,
+0x39d9f703, 0x0fe42454, 0xf9c5c294, 0xb60ff16e,
+0xc4daf7d2, 0xca2249e3, 0x6ce1c501, 0x41e3c4d9,
+0xc501ce22, 0xc4cc6cf1, 0xcb1875e3, 0x50fcc501,
+0xfffa81d1, 0x0f000000, 0x0003ea85, 0x24448b00,
+0x245c8b68, 0x19d8f770, 0x6ef9c5c0, 0x24448bd8,
+0x19d8f76c, 0x19dbf7c0, 0x61e3c4db, 0xc501d822,
+0x8be36ef9, 0xf774245c, 0x245c8bdb, 0xf7d21978,
+0x59e3c4db, 0x1901e222, 0x6ce1c5db, 0x6ef9c5dc,
+0x245c8bcb, 0x8bdbf77c, 0x0080249c, 0xc9190000,
+0xe3c4dbf7, 0x01c92271, 0xf9c5db19, 0x9c8beb6e,
+0x00008424, 0x19dbf700, 0x51e3c4f6, 0xc501ee22,
+0xc4cd6cf1, 0xd91865e3, 0x54e4c501, 0x6ff9c5da,
+0x7ffdc5cb, 0x8fe8245c, 0x649ae0e9, 0xf9c56824,
+0xf8245c6f, 0x9ae0e98f, 0xc478246c, 0xe5185de3,
+0x7ef9c501, 0x7ffdc5e0, 0xc5a82464, 0xc5e476d9,
+0x246cfed9, 0xfed9c568, 0xc4782464, 0xe41855e3,
+0x7ffdc501, 0x8f682464, 0x4c9af0e9, 0xe98f6824,
+0x245c9ae0, 0x75e3c478, 0xc501e318, 0xc5c9fef1,
+0xc5dbfee1, 0xc5ca7ef9, 0x24647ffd, 0x0fd039c8,
+0xf631c094, 0xf7c0b60f, 0xc4c289d8, 0xc81679e3,
+0x24443901, 0x940f40ac, 0x79e3c4c6, 0xc502c816,
+0xf7f26ef9, 0x244439de, 0xc0940fb0, 0xb60fff31,
+0xc5d8f7c0, 0xc4e06ef9, 0xc81679e3, 0x24443903,
+0x940f40b4, 0x7ef9c5c7, 0x39dff7d8, 0x0fb82444,
+0x3145c094, 0x59e3c4c0, 0x0f01e722, 0xd8f7c0b6,
+0xe3c4c189, 0x01d81679, 0xbc244439, 0xc0940f41,
+0x1679e3c4, 0xf9c502d8, 0xf741e96e, 0x244439d8,
+0xc0940fc0, 0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4c8,
+0x3903d816, 0x0fc42444, 0xc3c4c094, 0x01d82251,
+0xf7c0b60f, 0x71e3c4d8, 0xb801c822, 0x0000032c,
+0xd96ce1c5, 0x2249e3c4, 0xf1c501ce, 0xe3c4cc6c,
+0x01cb1875, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x00000223, 0xc9eff1c5, 0x5cfaf1c5, 0xf1c56824,
+0x78244cfa, 0x9660e98f, 0x8fc8245c, 0x4c9670e9,
+0xf9c5d824, 0x4439d87e, 0xe3c4e824, 0x01e11865,
+0x31c0940f, 0x7ffdc5f6, 0x0fa82464, 0xd8f7c0b6,
+0xe3c4c289, 0x01d81679, 0xec244439, 0xc6940f40,
+0x1679e3c4, 0xf9c502d8, 0xdef7ea6e, 0xf0244439,
+0x31c0940f, 0xc0b60fff, 0xf9c5d8f7, 0xe3c4e06e,
+0x03d81679, 0xf4244439, 0xc7940f40, 0xc87ef9c5,
+0x4439dff7, 0x940ff824, 0xc03145c0, 0x2259e3c4,
+0xb60f01e7, 0xc5d8f7c0, 0xc4d86ef9, 0xc81679e3,
+0x24443901, 0x940f41fc, 0x79e3c4c0, 0x4102c816,
+0x0439d8f7, 0xc0940f24, 0x2261c3c4, 0xb60f01d8,
+0x89d8f7c0, 0x79e3c4c1, 0x3903c816, 0x0f042444,
+0xf9c5c094, 0xb60ff96e, 0xc4d8f7c0, 0xc82241e3,
+0x0331b801, 0xe1c50000, 0xe3c4d96c, 0x01ce2251,
+0xcc6cf1c5, 0x1875e3c4, 0xfcc501cb, 0xfa81d150,
+0x000000ff, 0x011d850f, 0xfdc50000, 0x28244c6f,
+0xfdc5c031, 0x01a8d96f, 0xfdc50475, 0xfdc5da6f,
+0x88249c7f, 0x8b000000, 0x00888494, 0x54890000,
+0xff48c884, 0xf88348c0, 0x8fd77508, 0x54a2ece8,
+0xc5104824, 0x39d07ef9, 0x0fc82444, 0xf631c094,
+0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4c8, 0x3901d016,
+0x40cc2444, 0xc4c6940f, 0xd01679e3, 0x39def702,
+0x0fd02444, 0xff31c094, 0x2271e3c4, 0xb60f01ce,
+0x89d8f7c0, 0x79e3c4c1, 0x3903d016, 0xc4d42444,
+0xd2197de3, 0x940f4001, 0x6ef9c5c7, 0x7ef9c5f9,
+0x39dff7d0, 0x0fd82444, 0x3145c094, 0xc0b60fc0,
+0xc289d8f7, 0x1679e3c4, 0x443901d0, 0x0f41dc24,
+0xe3c4c094, 0x02d01679, 0xf26ef9c5, 0x000000ba,
+0xd8f74100, 0xe0244439, 0x0fc0940f, 0xd8f7c0b6,
+0xd86ef9c5, 0x1679e3c4, 0x443903d0, 0x940fe424,
+0x49c3c4c0, 0x0f01d022, 0xd8f7c0b6, 0x2261e3c4,
+0xe9c501d8, 0xe3c4d36c, 0x01df2241, 0xcb6cf1c5,
+0x1875e3c4, 0xfcc501ca, 0xff3dc150, 0xb8000000,
+0x000003c4, 0x48c2440f, 0x5bd8658d, 0x5d415c41,
+0x5f415e41, 0x0000c35d,
+0006726,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0x4801fa83, 0xe283d219,
+0xcaff4802, 0x0f40c685, 0x8948c694, 0x4040c454,
+0x29f6b60f, 0x48cf89f1, 0x60c47c89, 0x48c0ff48,
+0x7505f883, 0x6ffdc5bc, 0xc508247c, 0x247c7ffd,
+0x448b48a8, 0x3948a824, 0x0f082444, 0x8b48c094,
+0x31b02474, 0x4c8b48ff, 0xb60fc024, 0xd8f748c0,
+0x24743948, 0x748b4810, 0x0f40b824, 0xd231c794,
+0x48dff748, 0x1824743b, 0x45c2940f, 0xf748c031,
+0x4c3b48da, 0x0f412024, 0xe1c4c094, 0x49fa6ef9,
+0xc3c4d8f7, 0x01d022c1, 0x6ef9e1c4, 0x0260b8f8,
+0xe3c40000, 0x01cf22c1, 0x1875e3c4, 0xfdc501ca,
+0xfa83d150, 0x46850f0f, 0xc500000a, 0x244c6ff9,
+0x6ff9c5a8, 0xc5b8245c, 0x2454d4f1, 0xd4e1c508,
+0xc4182464, 0xd4186de3, 0x7ffdc501, 0xc5c82454,
+0x247c6ff9, 0x73d9c508, 0xf9c501f7, 0x18247c6f,
+0x7ef9e1c4, 0x443948e0, 0xe3c4c824, 0x01e216f9,
+0xc5c0940f, 0x01f773e9, 0xb60fff31, 0xd8f748c0,
+0x24543948, 0xf9e1c4d0, 0x0f40d27e, 0xe1c4c794,
+0xb8f86ef9, 0x00000266, 0x48dff748, 0xd8245439,
+0x0fc2940f, 0xf748d2b6, 0xf9e1c4da, 0xe3c4e26e,
+0x01d216f9, 0x24543948, 0xc2940fe0, 0x22c1e3c4,
+0xb60f01d7, 0xdaf748d2, 0x22d9e3c4, 0xe3c401e2,
+0x01d4186d, 0xd250fdc5, 0x0f0ffa83, 0x00099085,
+0x6ff9c500, 0xc5c8247c, 0x2454fbc1, 0x6ff9c508,
+0xc5d8247c, 0x2464fbc1, 0x6de3c418, 0xc501d418,
+0x24547ffd, 0x448b48e8, 0x3948e824, 0x0fa82444,
+0x8b48c094, 0x0ff0247c, 0xf748c0b6, 0x7c3948d8,
+0x0f40b024, 0xd231c794, 0xffb60f40, 0x48dff748,
+0xf824743b, 0x48c2940f, 0x3b48daf7, 0x940f240c,
+0xf9e1c4c1, 0xb60ffa6e, 0xd9f748c9, 0x22c1e3c4,
+0xe1c401e1, 0xb8f86ef9, 0x0000026b, 0x22c1e3c4,
+0xe3c401d7, 0x01d4186d, 0xd250fdc5, 0x0f0ffa83,
+0x0008fc85, 0x6ff9c500, 0xc5082464, 0xb1d170f9,
+0x4069e2c4, 0xf4f1c5d4, 0x6ff9c5cc, 0x8f182464,
+0xd2cb78e9, 0xf273e9c5, 0xd4f1c520, 0x70f9c5ca,
+0xe2c4b1d3, 0xc5d44069, 0x8fdcf4e1, 0xd2cb78e9,
+0xf273e9c5, 0xd4e1c520, 0x6ff9c5da, 0xc4382454,
+0xcb1875e3, 0x6ff9c501, 0x7ffdc5e9, 0xc5a8244c,
+0x244c6ff9, 0x70f9c528, 0xe2c4b1d9, 0xc5d94061,
+0x8fc9f4f1, 0xdbcb78e9, 0xf373e1c5, 0xd4f1c520,
+0x70f9c5cb, 0xe2c4b1da, 0xc5da4061, 0x8fd2f4e9,
+0xdbcb78e9, 0xf373e1c5, 0xd4e9c520, 0x75e3c4d3,
+0xc501ca18, 0xc5f96ff9, 0x244c7ffd, 0x6ff9c5c8,
+0xc508244c, 0x24546ff9, 0xd4f1c518, 0xc528245c,
+0x2464d4e9, 0x65e3c438, 0xc501dc18, 0xc5f36ff9,
+0x245c7ffd, 0xfbf1c5e8, 0xc5282464, 0x24446f79,
+0xfbd1c5f8, 0xf9e1c4ef, 0xf9c5e87e, 0xb8247c6f,
+0xdc70f9c5, 0xf4d9c5b1, 0x61e2c4e6, 0xe98fde40,
+0xc5dbcb78, 0x20f373e1, 0xe3d4d9c5, 0x5cfbe9c5,
+0xe1c43824, 0xc4e27ef9, 0xe116f9e3, 0x70f9c501,
+0xc1c4b1f3, 0x48d8f461, 0xc2c4c239, 0x0ff04049,
+0xf631c094, 0x48c0b60f, 0x8948d8f7, 0xf9e3c4c2,
+0x4801e816, 0xe98fc139, 0xc5f6cb78, 0x20f673c9,
+0xc6940f40, 0xded4e1c5, 0x74fbc1c5, 0xf748d824,
+0xf9e1c4de, 0xe1c4d97e, 0xc4fa6ef9, 0xf07ef9e1,
+0xc4c13948, 0xf116f9e3, 0xc0940f01, 0x48c0b60f,
+0xe1c4d8f7, 0xc4e06ef9, 0xd816f9e3, 0xc1e3c401,
+0x4801de22, 0x940fc839, 0xc0b60fc0, 0xc4d8f748,
+0xe022d9e3, 0x0282b801, 0xe3c40000, 0x01dc1865,
+0xd350fdc5, 0x0f0ffa83, 0x00074485, 0x6ff9c500,
+0xc528246c, 0xb1e170f9, 0x746ff9c5, 0xe2c43824,
+0xc5dd4059, 0x8fedf4f1, 0xdbcb78e9, 0xf373e1c5,
+0xd4d1c520, 0x70f9c5eb, 0xe2c4b1da, 0xc5fe4061,
+0x8ff6f4e9, 0xffcb78e9, 0xf773c1c5, 0xd4c9c520,
+0x55e3c4f7, 0xc401ee18, 0xe87ef9e1, 0x6c7ffdc5,
+0x8348a824, 0x940f04f8, 0x0fc931c0, 0xf748c0b6,
+0x7c8348d8, 0x0f06b024, 0xd231c194, 0x6ef9e1c4,
+0x02d3b8f8, 0xf7480000, 0x7c8348d9, 0x0f06b824,
+0xf631c294, 0x22c1e3c4, 0xf74801e9, 0x7c8348da,
+0x4004c024, 0xc4c6940f, 0xf26ef9e1, 0xc4def748,
+0xf622c9e3, 0x55e3c401, 0xc501ee18, 0x83d550fd,
+0x850f0ffa, 0x00000689, 0x6c6ff9c5, 0xe2c44824,
+0xc5e54059, 0x8fcdf4f1, 0xe4cb78e9, 0xf473d9c5,
+0xd4f1c520, 0x6ff9c5cc, 0xc4582464, 0xdc4061e2,
+0xd4f4e9c5, 0xcb78e98f, 0x73e1c5db, 0xe9c520f3,
+0xe3c4d3d4, 0x01ea1875, 0x6c7ffdc5, 0xf9c5e824,
+0xe824746f, 0x7c6ff9c5, 0xe1c5f824, 0xc503f673,
+0x03f773d9, 0x1865e3c4, 0xe1c401dc, 0xc5d87ef9,
+0x245c7ffd, 0x6ff9c5a8, 0xc5e82474, 0x247c6ff9,
+0x73e1c5f8, 0xd9c502f6, 0xc402f773, 0xdc1865e3,
+0x7ffdc501, 0xc5c8245c, 0x24646ff9, 0x6ff9c5c8,
+0xc5d8245c, 0xc5e4d4d9, 0xc4dbd4e1, 0xe27ef9e1,
+0xc4d03948, 0xe216f9e3, 0xc0940f01, 0xb60fc931,
+0xd8f748c0, 0x24543948, 0xf9e1c4b0, 0x940fda7e,
+0xf9e1c4c1, 0xf8b8f06e, 0x48000002, 0x3948d9f7,
+0x0fb82454, 0xb60fc294, 0xdaf748d2, 0x6ef9e1c4,
+0xf9e3c4e2, 0x4801da16, 0xc0245439, 0xc4c2940f,
+0xd922c9e3, 0xd2b60f01, 0xc4daf748, 0xe222d9e3,
+0x65e3c401, 0xc501dc18, 0x83d350fd, 0x850f0ffa,
+0x0000056d, 0xfec0c748, 0xc4ffffff, 0xd86ef9e1,
+0xdb6ce1c5, 0x9b60e98f, 0x8fa82464, 0x5c9b60e9,
+0xe3c4b824, 0x01db185d, 0x5c7ffdc5, 0xf9c5e824,
+0xe824646f, 0x5c6ff9c5, 0xd9c5f824, 0xe1c5e4d4,
+0xe1c4dbd4, 0x48e07ef9, 0xc8244439, 0x16f9e3c4,
+0x940f01e2, 0x0fc931c0, 0xf748c0b6, 0x543948d8,
+0xe1c4d024, 0x0fda7ef9, 0xe1c4c194, 0xb8f86ef9,
+0x000002fd, 0x48d9f748, 0xd8245439, 0x0fc2940f,
+0xf748d2b6, 0xf9e1c4da, 0xe3c4e26e, 0x01da16f9,
+0x24543948, 0xc2940fe0, 0x22c1e3c4, 0xb60f01d9,
+0xdaf748d2, 0x22d9e3c4, 0xe3c401e2, 0x01dc1865,
+0xd350fdc5, 0x0f0ffa83, 0x0004b485, 0x2444c700,
+0x000003a4, 0x6ff9c500, 0x7ffdc5dd, 0x48e8246c,
+0xa4244463, 0x646ff9c5, 0xe1c4f824, 0xc5f06ef9,
+0xc5eef3d1, 0xc4f6f3d9, 0xee1855e3, 0xf9e1c401,
+0xfdc5e87e, 0xa8246c7f, 0xa42444c7, 0x00000002,
+0x24746348, 0xf9e1c4a4, 0xe1c5ee6e, 0xd9c5ddf3,
+0xe3c4e5f3, 0x01dc1865, 0x5c7ffdc5, 0xf9c5c824,
+0xc824646f, 0x5c6ff9c5, 0xd9c5d824, 0xe1c5e4d4,
+0xe1c4dbd4, 0x48e27ef9, 0xe3c4d039, 0x01e216f9,
+0x31c0940f, 0xc0b60fc9, 0x48d8f748, 0xb0245439,
+0x7ef9e1c4, 0xc1940fda, 0x6ef9e1c4, 0x0310b8e8,
+0xf7480000, 0x543948d9, 0x940fb824, 0xd2b60fc2,
+0xc4daf748, 0xe26ef9e1, 0x16f9e3c4, 0x394801da,
+0x0fc02454, 0xe3c4c294, 0x01d922d1, 0x48d2b60f,
+0xe3c4daf7, 0x01e222d9, 0x1865e3c4, 0xfdc501dc,
+0xfa83d350, 0xc6850f0f, 0x48000003, 0xa4244463,
+0xe4efd9c5, 0x6ef9e1c4, 0x6ce1c5d8, 0xfbd9c5db,
+0x60e98fdb, 0xa824649b, 0x9b60e98f, 0xc4b8245c,
+0xdb185de3, 0x7ffdc501, 0xc5e8245c, 0x24646ff9,
+0x6ff9c5e8, 0xc5f8245c, 0xc5e4d4d9, 0xc4dbd4e1,
+0xe07ef9e1, 0x24443948, 0xf9e3c4c8, 0x0f01e216,
+0xc931c094, 0x48c0b60f, 0x3948d8f7, 0xc4d02454,
+0xda7ef9e1, 0xc4c1940f, 0xe86ef9e1, 0x000314b8,
+0xd9f74800, 0x24543948, 0xc2940fd8, 0x48d2b60f,
+0xe1c4daf7, 0xc4e26ef9, 0xda16f9e3, 0x54394801,
+0x940fe024, 0xd1e3c4c2, 0x0f01d922, 0xf748d2b6,
+0xd9e3c4da, 0xc401e222, 0xdc1865e3, 0x50fdc501,
+0x0ffa83d3, 0x0307850f, 0xff310000, 0x7ef9e1c4,
+0x7c8348c8, 0x48006824, 0xc4c74e0f, 0xca16f9e3,
+0x7c834801, 0xc4007024, 0xd67ef9e1, 0x16f9e3c4,
+0x0f4801d1, 0x8348d74e, 0x0078247c, 0xf74e0f48,
+0x24bc8348, 0x00000080, 0x4e0f4800, 0xf9e1c4cf,
+0xe3c4ee6e, 0x01c922d1, 0x6ef9e1c4, 0xd1e3c4e8,
+0xc401d222, 0xd1186de3, 0x6ff9c501, 0x7ffdc5ca,
+0x8fe82454, 0x5c9be8e9, 0xf9c56824, 0xf824546f,
+0x9be8e98f, 0xc4782464, 0xdc1865e3, 0xf9e1c401,
+0xfdc5d87e, 0xa8245c7f, 0x000001bf, 0x6ff9c500,
+0xc5682474, 0x247c6ff9, 0xf9e1c478, 0xd9c5e76e,
+0xc9c5e46c, 0xc1c5dcfb, 0xe3c4e4fb, 0x01dc1865,
+0x5c7ffdc5, 0xe98f6824, 0x244c9bf0, 0xe8e98f68,
+0x7824549b, 0x1875e3c4, 0xf1c501da, 0xe9c5c9d4,
+0xe1c4d2d4, 0xc5ca7ef9, 0x245c7ffd, 0xd03948c8,
+0x31c0940f, 0xc0b60ff6, 0x48d8f748, 0xe3c4c289,
+0x01c816f9, 0x24443948, 0x940f40b0, 0xf9e1c4c6,
+0xe1c4d07e, 0x48f26ef9, 0x3948def7, 0x0fb82444,
+0xe3c4c094, 0x01ce22c9, 0x48c0b60f, 0x8948d8f7,
+0xf9e3c4c1, 0x4801d016, 0xc0244439, 0xc4c0940f,
+0xe96ef9e1, 0x48c0b60f, 0xe3c4d8f7, 0x01d022d1,
+0x00032cb8, 0x75e3c400, 0xc501ca18, 0x83d150fd,
+0x850f0ffa, 0x000001a9, 0xc9eff1c5, 0x54fbf1c5,
+0xf1c56824, 0x78244cfb, 0x9b68e98f, 0x8fc82454,
+0x4c9b70e9, 0xe1c4d824, 0x48d07ef9, 0xe8244439,
+0x16f9e3c4, 0x940f01d2, 0x0fc931c0, 0xf748c0b6,
+0x543948d8, 0xe1c4f024, 0x0fca7ef9, 0xe1c4c194,
+0xb8f86ef9, 0x00000331, 0x48d9f748, 0xf8245439,
+0x0fc2940f, 0xf748d2b6, 0xf9e1c4da, 0xe3c4d26e,
+0x01ca16f9, 0x24143948, 0xc4c2940f, 0xc922c1e3,
+0xd2b60f01, 0xc4daf748, 0xd222e9e3, 0x75e3c401,
+0xc501ca18, 0x83d150fd, 0x850f0ffa, 0x00000111,
+0x8348c031, 0x0048247c, 0x4c6ffdc5, 0x9f0f0824,
+0xc93145c0, 0x546ff9c5, 0xfdc52824, 0x28246c6f,
+0x48d8f748, 0x50247c83, 0xf9c1c400, 0x0f41c87e,
+0xd231c19f, 0x16f9e3c4, 0xf74901d1, 0x7c8348d9,
+0xc4005824, 0xca197de3, 0xc29f0f01, 0x7ef9e1c4,
+0xf9e1c4d7, 0x3145f86e, 0xdaf748d2, 0x247c8348,
+0xe3c40060, 0x01ea197d, 0xc29f0f41, 0x6ef9e1c4,
+0xf9e3c4f2, 0x4901d616, 0xc3c4daf7, 0x01d122c1,
+0x22c9c3c4, 0xe3c401da, 0x01d3186d, 0xa274e88f,
+0xe1c420cd, 0x49c87ef9, 0x940fc039, 0xc0b60fc0,
+0x48d8f748, 0xe3c4c289, 0x01c816f9, 0x197de3c4,
+0x394801c9, 0xf9e1c4c1, 0xe1c4c87e, 0xbaea6ef9,
+0x00000000, 0x0fc1940f, 0xf748c9b6, 0xc73948d9,
+0x0fc0940f, 0xf748c0b6, 0xf9e1c4d8, 0xe3c4d06e,
+0x01c816f9, 0x22d1e3c4, 0x394801c9, 0xc0940fc6,
+0x48c0b60f, 0xe3c4d8f7, 0x01d022e9, 0x1875e3c4,
+0xfdc501ca, 0xf883c150, 0x03c4b80f, 0x440f0000,
+0x00c3c9c2,
+0005463,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0xc685caff, 0xc6940f40,
+0x40d26348, 0x48f6b60f, 0x40c45489, 0xcf89f129,
+0xc47c8948, 0xc0ff4860, 0x05f88348, 0xfdc5c375,
+0x0824746f, 0x747ffdc5, 0x8b48a824, 0x48a82444,
+0x08244439, 0x48c0940f, 0xb0247c8b, 0x48c03145,
+0xb824748b, 0x48c0b60f, 0xc0244c8b, 0x48d8f748,
+0x10247c3b, 0xc0940f41, 0xe1c4d231, 0xb8f06ef9,
+0x00000260, 0x48d8f749, 0x1824743b, 0x45c2940f,
+0xc3c4c931, 0x01c822c9, 0x48daf748, 0x20244c3b,
+0xc1940f41, 0x6ef9e1c4, 0xd9f749fa, 0x22c1c3c4,
+0xe3c401d1, 0x01ca1875, 0xd150fdc5, 0x0f0ffa83,
+0x00087085, 0x6ff9c500, 0xc5a8247c, 0x24746ff9,
+0xd4c1c5b8, 0xc508244c, 0x2454d4c9, 0x75e3c418,
+0xc501ca18, 0x244c7ffd, 0x6ff9c5c8, 0xc508247c,
+0x24746ff9, 0x73e9c518, 0xf1c501f7, 0xc401f673,
+0xd07ef9e1, 0x24443948, 0xf9e3c4c8, 0x0f01d216,
+0x3145c094, 0xc0b60fc0, 0x48d8f748, 0xd0245439,
+0x7ef9e1c4, 0x940f41ca, 0xf9e1c4c0, 0x66b8f86e,
+0x49000002, 0x3948d8f7, 0x0fd82454, 0xb60fc294,
+0xdaf748d2, 0x6ef9e1c4, 0xf9e3c4d2, 0x4801ca16,
+0xe0245439, 0xc4c2940f, 0xc822c1c3, 0xd2b60f01,
+0xc4daf748, 0xd222e9e3, 0x75e3c401, 0xc501ca18,
+0x83d150fd, 0x850f0ffa, 0x000007b9, 0x746ff9c5,
+0xf9c5c824, 0xd8247c6f, 0x4cfbc9c5, 0xc1c50824,
+0x182454fb, 0x1875e3c4, 0xfdc501ca, 0xe8244c7f,
+0x24448b48, 0x443948e8, 0x940fa824, 0xc0b60fc0,
+0x48d8f748, 0xf0247c3b, 0xc7940f40, 0xe1c4d231,
+0xb8f86ef9, 0x0000026b, 0xffb60f40, 0x48dff748,
+0xf824743b, 0xc4c2940f, 0xd722c1e3, 0xdaf74801,
+0x240c3b48, 0xc4c1940f, 0xf26ef9e1, 0x48c9b60f,
+0xe3c4d9f7, 0x01d922c9, 0x186de3c4, 0xfdc501d3,
+0xfa83d250, 0x2a850f0f, 0xc5000007, 0x24746ffd,
+0x56ccc5a8, 0xc5282454, 0x24547ffd, 0x54f4c5a8,
+0xc528244c, 0x247c6ffd, 0x57c4c5e8, 0xc4282454,
+0xd07ef9e1, 0x547ffdc5, 0xf4c5e824, 0xa8244c55,
+0x7ef9e1c4, 0xd03948ca, 0x31c0940f, 0xc0b60fc9,
+0x48d8f748, 0xe3c4c289, 0x01c816f9, 0x24443948,
+0x7de3c4f0, 0x0f01c919, 0xe1c4c194, 0xc4ea6ef9,
+0xc87ef9e1, 0x48d9f748, 0xf8244439, 0x0fc0940f,
+0xf748c0b6, 0xf9e1c4d8, 0xe3c4d06e, 0x01c816f9,
+0x24043948, 0xc4c0940f, 0xc922d1e3, 0xc0b60f01,
+0xc4d8f748, 0xd022e9e3, 0x0277b801, 0xe3c40000,
+0x01ca1875, 0xd150fdc5, 0x0f0ffa83, 0x00067485,
+0x6ff9c500, 0xc508244c, 0x245c6ff9, 0x6ff9c528,
+0xc5382464, 0xb1d170f9, 0xcbf4f1c5, 0x4069e2c4,
+0x6ff9c5d3, 0x8f18245c, 0xd2cb78e9, 0xf273e9c5,
+0xd4f1c520, 0x70f9c5ca, 0xe2c4b1d3, 0xc5d44069,
+0x8fdcf4e1, 0xd2cb78e9, 0xf273e9c5, 0xd4e1c520,
+0x75e3c4da, 0xc401cb18, 0xc87ef9e1, 0x4c7ffdc5,
+0x8348a824, 0x940f04f8, 0x0fc931c0, 0xf748c0b6,
+0x7c8348d8, 0x0f06b024, 0xd231c194, 0x6ef9e1c4,
+0x02d3b8f8, 0xf7480000, 0x7c8348d9, 0x0f06b824,
+0xf631c294, 0x22c1e3c4, 0xf74801c9, 0x7c8348da,
+0x4004c024, 0xc4c6940f, 0xf26ef9e1, 0xc4def748,
+0xd622c9e3, 0x75e3c401, 0xc501ca18, 0x83d150fd,
+0x850f0ffa, 0x000005ad, 0x546ffdc5, 0xfdc50824,
+0xe824547f, 0x6c6ff9c5, 0xf9c5e824, 0xf824746f,
+0xf573f1c5, 0x73e1c503, 0xe3c403f6, 0x01cb1875,
+0x7ef9e1c4, 0x7ffdc5c8, 0xc5a8244c, 0x247c6ff9,
+0x6ff9c5e8, 0xc5f8246c, 0x02f773f1, 0xf573e1c5,
+0x75e3c402, 0xc501cb18, 0x244c7ffd, 0x6ff9c5c8,
+0xc5c8245c, 0x244c6ff9, 0xd4e1c5d8, 0xd4f1c5db,
+0xf9e1c4c9, 0x3948da7e, 0xf9e3c4d0, 0x0f01da16,
+0xc931c094, 0x48c0b60f, 0x3948d8f7, 0xc4b02454,
+0xca7ef9e1, 0xc4c1940f, 0xf06ef9e1, 0x0002f8b8,
+0xd9f74800, 0x24543948, 0xc2940fb8, 0x48d2b60f,
+0xe1c4daf7, 0xc4da6ef9, 0xca16f9e3, 0x54394801,
+0x940fc024, 0xc9e3c4c2, 0x0f01c922, 0xf748d2b6,
+0xe1e3c4da, 0xc401da22, 0xcb1875e3, 0x50fdc501,
+0x0ffa83d1, 0x04cb850f, 0xf9c50000, 0xa8247c6f,
+0x6c6ff9c5, 0xf1c5b824, 0xc502d773, 0x02d573e1,
+0x1875e3c4, 0xfdc501cb, 0xe8244c7f, 0x5c6ff9c5,
+0xf9c5e824, 0xf8244c6f, 0xdbd4e1c5, 0xc9d4f1c5,
+0x7ef9e1c4, 0x443948d8, 0xe3c4c824, 0x01da16f9,
+0x31c0940f, 0xc0b60fc9, 0x48d8f748, 0xd0245439,
+0x7ef9e1c4, 0xc1940fca, 0x6ef9e1c4, 0x02fdb8f0,
+0xf7480000, 0x543948d9, 0x940fd824, 0xd2b60fc2,
+0xc4daf748, 0xda6ef9e1, 0x16f9e3c4, 0x394801ca,
+0x0fe02454, 0xe3c4c294, 0x01c922c9, 0x48d2b60f,
+0xe3c4daf7, 0x01da22e1, 0x1875e3c4, 0xfdc501cb,
+0xfa83d150, 0x1a850f0f, 0xc7000004, 0x03a42444,
+0xc5000000, 0x24547ffd, 0x6ef9c5e8, 0xc5a4246c,
+0x245c6ff9, 0xf3e9c5f8, 0xf3e1c5e5, 0x5de3c4ed,
+0xc401e518, 0xe07ef9e1, 0x647ffdc5, 0x44c7a824,
+0x0002a424, 0xf9c50000, 0xa424646e, 0xccf3e9c5,
+0xdcf3e1c5, 0x1875e3c4, 0xfdc501cb, 0xc8244c7f,
+0x5c6ff9c5, 0xf9c5c824, 0xd8244c6f, 0xdbd4e1c5,
+0xc9d4f1c5, 0x7ef9e1c4, 0xd03948da, 0x16f9e3c4,
+0x940f01da, 0x0fc931c0, 0xf748c0b6, 0x543948d8,
+0xe1c4b024, 0x0fca7ef9, 0xe1c4c194, 0xb8f86ef9,
+0x00000310, 0x48d9f748, 0xb8245439, 0x0fc2940f,
+0xf748d2b6, 0xf9e1c4da, 0xe3c4da6e, 0x01ca16f9,
+0x24543948, 0xc2940fc0, 0x22c1e3c4, 0xb60f01c9,
+0xdaf748d2, 0x22e1e3c4, 0xe3c401da, 0x01cb1875,
+0xd150fdc5, 0x0f0ffa83, 0x00033885, 0x6ef9c500,
+0xc5a4245c, 0x246c6ff9, 0x6ff9c5a8, 0xc5b82474,
+0xc5cbd3d1, 0xc4dbd3c9, 0xcb1875e3, 0x7ffdc501,
+0xc5e8244c, 0x245c6ff9, 0x6ff9c5e8, 0xc5f8244c,
+0xc5dbd4e1, 0xc4c9d4f1, 0xd87ef9e1, 0x24443948,
+0xf9e3c4c8, 0x0f01da16, 0xc931c094, 0x48c0b60f,
+0x3948d8f7, 0xc4d02454, 0xca7ef9e1, 0xc4c1940f,
+0xf86ef9e1, 0x000314b8, 0xd9f74800, 0x24543948,
+0xc2940fd8, 0x48d2b60f, 0xe1c4daf7, 0xc4da6ef9,
+0xca16f9e3, 0x54394801, 0x940fe024, 0xc1e3c4c2,
+0x0f01c922, 0xf748d2b6, 0xe1e3c4da, 0xc401da22,
+0xcb1875e3, 0x50fdc501, 0x0ffa83d1, 0x0283850f,
+0x8b480000, 0x48682444, 0x78247c8b, 0x48d8f748,
+0xe1c4c019, 0x48d86ef9, 0x7024448b, 0x48d8f748,
+0xf748c019, 0xbc8b48df, 0x00008024, 0xf6194800,
+0x22e1e3c4, 0xf74801d8, 0xf9e1c4df, 0x1948ce6e,
+0xf1e3c4d2, 0xc401ca22, 0xd91865e3, 0x54e4c501,
+0x6ff9c5da, 0x7ffdc5cb, 0x8fe8245c, 0x649be0e9,
+0xf9c56824, 0xf8245c6f, 0x9be0e98f, 0xc478246c,
+0xe5185de3, 0xf9e1c401, 0xfdc5e07e, 0xa824647f,
+0xe476d9c5, 0x6cd4d9c5, 0xd9c56824, 0x782464d4,
+0x1855e3c4, 0xfdc501e4, 0x6824647f, 0x9bf0e98f,
+0x8f68244c, 0x5c9be0e9, 0xe3c47824, 0x01e31875,
+0xc9d4f1c5, 0xdbd4e1c5, 0x7ef9e1c4, 0x7ffdc5ca,
+0x48c82464, 0x940fd039, 0x0ff631c0, 0xf748c0b6,
+0xc28948d8, 0x16f9e3c4, 0x394801c8, 0x40b02444,
+0xc4c6940f, 0xd87ef9e1, 0x6ef9e1c4, 0xdef748f2,
+0x24443948, 0xc0940fb8, 0x22c9e3c4, 0xb60f01ce,
+0xd8f748c0, 0xc4c18948, 0xd816f9e3, 0x44394801,
+0x940fc024, 0xf9e1c4c0, 0xb60fe96e, 0xd8f748c0,
+0x22d1e3c4, 0x2cb801d8, 0xc4000003, 0xcb1875e3,
+0x50fdc501, 0x0ffa83d1, 0x0147850f, 0xf1c50000,
+0xf1c5c9ef, 0x68245cfb, 0x4cfbf1c5, 0xe98f7824,
+0x245c9760, 0x70e98fc8, 0xd8244c97, 0x7ef9e1c4,
+0x443948d8, 0xe3c4e824, 0x01da16f9, 0x31c0940f,
+0xc0b60fc9, 0x48d8f748, 0xf0245439, 0x7ef9e1c4,
+0xc1940fca, 0x6ef9e1c4, 0x0331b8f8, 0xf7480000,
+0x543948d9, 0x940ff824, 0xd2b60fc2, 0xc4daf748,
+0xda6ef9e1, 0x16f9e3c4, 0x394801ca, 0x940f2414,
+0xc1e3c4c2, 0x0f01c922, 0xf748d2b6, 0xe1e3c4da,
+0xc401da22, 0xcb1875e3, 0x50fdc501, 0x0ffa83d1,
+0x00af850f, 0xfdc50000, 0x28245c6f, 0x7ef9e1c4,
+0x7de3c4d0, 0x8f01d119, 0x54a2ece8, 0xc4304824,
+0xd77ef9e1, 0x7ef9e1c4, 0xf83948ca, 0x197de3c4,
+0xe3c401d9, 0x01d916f9, 0xc4c0940f, 0xce16f9e3,
+0xc0b60f01, 0xc4d8f748, 0xc86ef9e1, 0x16f9e3c4,
+0xe3c401d0, 0x01d2197d, 0xc4c13948, 0xd07ef9e1,
+0x0fc1940f, 0xf748c9b6, 0xc23948d9, 0xc4c0940f,
+0xc922f1e3, 0xc0b60f01, 0x48d8f748, 0xe3c4c289,
+0x01d016f9, 0xc4c63948, 0xe26ef9e1, 0x000000ba,
+0xc0940f00, 0x48c0b60f, 0xe3c4d8f7, 0x01d022d9,
+0x1875e3c4, 0xfdc501ca, 0xf883c150, 0x03c4b80f,
+0x440f0000, 0x00c3c9c2,
+0004527,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8148e0, 0x00000088, 0xc501488d, 0x89c92af2,
+0xc5c129d1, 0x844c11fa, 0x2af2c508, 0x11fac5c9,
+0xc528844c, 0xc50d10fa, 0xa8000006, 0xc5087501,
+0xd90d10fa, 0xc5000006, 0x844c11fa, 0xc0ff4848,
+0x08f88348, 0xfcc5c275, 0x08247c28, 0x7c29fcc5,
+0xfcc5a824, 0xa8244c28, 0x000260b8, 0xc2f4c500,
+0xfcc500d7, 0xfa81d250, 0x000000ff, 0x0666850f,
+0xf4c50000, 0x08245458, 0x5429fcc5, 0xfcc5c824,
+0x08247c28, 0x000266b8, 0x58c4c500, 0xc2ecc5d7,
+0x00c82454, 0xd250fcc5, 0x00fffa81, 0x850f0000,
+0x00000634, 0x7c28fcc5, 0xc4c5c824, 0x0824545c,
+0x5429fcc5, 0xf4c5e824, 0xe82454c2, 0x026bb800,
+0xfcc50000, 0xfa81d250, 0x000000ff, 0x0606850f,
+0xfcc50000, 0x28247428, 0x4c59f4c5, 0xccc50824,
+0xfcc5de59, 0x08245428, 0xee58ecc5, 0x645cecc5,
+0xf4c52824, 0x82b8cb5c, 0xc5000002, 0xc5e559dc,
+0x00ccc2f4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x000005c4, 0x4c59ecc5, 0xfcc54824, 0xa8244c29,
+0x545eecc5, 0xf4c54824, 0xb800cac2, 0x0000028b,
+0xd150fcc5, 0x00fffa81, 0x850f0000, 0x00000598,
+0x187de2c4, 0x0005ab15, 0x28fcc500, 0xb848245c,
+0x0000028e, 0xca57e4c5, 0x5457ecc5, 0xf4c50824,
+0xa8244c59, 0xcac2f4c5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x00055f85, 0x53fcc500, 0xc508244c,
+0x244c29fc, 0x53fcc5a8, 0xc5a8244c, 0x245428fc,
+0x0296b808, 0xfdc50000, 0xfcc5c95b, 0xf4c5c95b,
+0xc500cac2, 0x81d150fc, 0x0000fffa, 0x25850f00,
+0xc5000005, 0xc5ca59ec, 0x244c29fc, 0x52fcc5a8,
+0xc5a8244c, 0x244c29fc, 0x28fcc5c8, 0xb8c8244c,
+0x0000029d, 0xe153fcc5, 0xe45bfdc5, 0xe45bfcc5,
+0xd4c2ecc5, 0x50fcc500, 0xfffa81d2, 0x0f000000,
+0x0004e385, 0x28fcc500, 0xc5082464, 0xc5c95bfd,
+0xb8c95bfc, 0x0000029f, 0xd453fcc5, 0xd25bfdc5,
+0xd25bfcc5, 0xcac2f4c5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x0004af85, 0x59dcc500, 0x29fcc5cc,
+0xc5a8244c, 0x244c51fc, 0x02a7b8a8, 0xf4c50000,
+0xc500ccc2, 0x81d150fc, 0x0000fffa, 0x85850f00,
+0xc4000004, 0x15187de2, 0x000004b4, 0xe45eecc5,
+0x6429fcc5, 0xe3c4a824, 0x244c087d, 0xafb80ba8,
+0xc5000002, 0x940dc2f4, 0x00000004, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x0000044c, 0x807ce98f,
+0xc508244c, 0xb8e457d8, 0x000002b6, 0xccc2f4c5,
+0x50fcc500, 0xfffa81d1, 0x0f000000, 0x00042785,
+0x58ecc500, 0xc508244c, 0xc5c95eec, 0x244c29fc,
+0x7ce98fa8, 0xa8244c80, 0x4cc2f4c5, 0xb800a824,
+0x000002bc, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x000003f4, 0x187de2c4, 0x00040b0d, 0x59f4c500,
+0xc508244c, 0x244c29fc, 0x7de3c4a8, 0xa8244c08,
+0x7ce98f0b, 0xa8246480, 0xcc58f4c5, 0x0002c6b8,
+0xc2f4c500, 0x00a8244c, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x000003b0, 0x4c59e4c5, 0xe4c52824,
+0x08246459, 0x4c29fcc5, 0xdcc5c824, 0xc8244c5f,
+0x4c29fcc5, 0xdcc5e824, 0xc824645d, 0x6429fcc5,
+0xf4c5c824, 0xc8244c58, 0x7c28fcc5, 0x48b80824,
+0xc5000003, 0x246458c4, 0x59f4c528, 0xc2f4c5cb,
+0xfcc500cc, 0xfa81d150, 0x000000ff, 0x0356850f,
+0xe3c40000, 0x244c047d, 0xfcc51b08, 0x28246428,
+0x000359b8, 0x75e3c400, 0xc501c906, 0x00c9c2dc,
+0xd150fcc5, 0x00fffa81, 0x850f0000, 0x00000328,
+0x000001b8, 0x5bfdc500, 0x6ef9c5ec, 0x035eb8f0,
+0xf9c50000, 0xc500f670, 0xc4cefad1, 0xed197de3,
+0xfad1c501, 0x75e3c4ee, 0xc501cd18, 0x246c28fc,
+0x55e2c408, 0xe3c4c90c, 0x01c90675, 0xc9c2dcc5,
+0x50fcc500, 0xfffa81d1, 0x0f000000, 0x0002d785,
+0x58d4c500, 0x0362b8ec, 0xe2c40000, 0xe90d187d,
+0xc5000002, 0x00e9c2d4, 0xd550fcc5, 0x00fffa81,
+0x850f0000, 0x000002b0, 0x4c12fec5, 0xe2c40824,
+0xb92d187d, 0xc5000002, 0x244c5cf4, 0x03b1b808,
+0xe2c40000, 0xb535187d, 0xc5000002, 0xc5eb58d4,
+0xc5ee59d4, 0x00cdc2f4, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x00000270, 0x6c16fec5, 0xfcc50824,
+0xa8246c29, 0xd258e4c5, 0x4c28fcc5, 0xb8b80824,
+0xc5000003, 0xc5e95cd4, 0xc5d659ec, 0x00eac2d4,
+0xd550fcc5, 0x00fffa81, 0x850f0000, 0x00000238,
+0xfcc5c031, 0x01a8d428, 0xfcc50475, 0xfcc5d128,
+0x68245429, 0x5410fac5, 0xfac56884, 0xc8845411,
+0x48c0ff48, 0x7508f883, 0x57e8c5d9, 0x03c4b8d2,
+0xecc50000, 0xc501d3c2, 0x245c28fc, 0x74e88fc8,
+0xc520cca2, 0x00c9c2e4, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x000001e0, 0xc4ffc883, 0x4c2c6de2,
+0xfcc50824, 0xe8244c29, 0xc9eff1c5, 0xa4244489,
+0x187de2c4, 0xb8a4246c, 0x000003cd, 0xa274e88f,
+0xe2c420cd, 0x24642e75, 0x28fcc5e8, 0xc5e8247c,
+0x00cbc2c4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x00000194, 0x7428fcc5, 0xd4b80824, 0xc4000003,
+0x4c0c4de3, 0xc5aa2824, 0x00d9c2e4, 0xd350fcc5,
+0x00fffa81, 0x850f0000, 0x0000016c, 0x7c28fcc5,
+0xc7c50824, 0x28244cd0, 0x7428fcc5, 0xcfc50824,
+0x282454d0, 0x0003ddb8, 0xc2f4c500, 0xfcc500ca,
+0xfa81d150, 0x000000ff, 0x013a850f, 0xfcc50000,
+0x08245c28, 0x4065e3c4, 0xf1282454, 0x0003ecb8,
+0x28f8c500, 0x7de3c4ca, 0xc501d219, 0xc4ca58f2,
+0xc92171e3, 0xc2f4c50e, 0x0001620d, 0xfcc50000,
+0xfa81d150, 0x000000ff, 0x00fa850f, 0xfcc50000,
+0xa8245c29, 0x000003ba, 0x57f0c500, 0x7cf7c5c9,
+0xc4a82454, 0xd3197de3, 0x12d8c501, 0x16e8c5e2,
+0xc6d8c5d3, 0xe0c5e4e3, 0xc4ffebc6, 0xd4186de3,
+0x29fcc501, 0xffa82454, 0xc5d275ca, 0xe12d2ef8,
+0x0f000000, 0x0000aa8a, 0xa4850f00, 0xc5000000,
+0x247c28fc, 0x7dc7c508, 0xc528245c, 0xc4d328f8,
+0xdb197de3, 0x12d8c501, 0x16e8c5e2, 0xc6d8c5d3,
+0xe3c4e4e3, 0x01d4186d, 0xd97cefc5, 0xd328f8c5,
+0x197de3c4, 0xd8c501db, 0xe8c5e212, 0xd8c5d316,
+0xc4e4e3c6, 0xd4186de3, 0x7cefc501, 0x28f8c5d9,
+0x7de3c4d3, 0xc501db19, 0xc5e212d8, 0xc5d316e8,
+0xe4e3c6d8, 0x186de3c4, 0xefc501d4, 0xf8c5d17c,
+0xe3c4da28, 0x01d2197d, 0xe312d8c5, 0xda16e0c5,
+0xe2c6d8c5, 0x65e3c4e4, 0xc501dc18, 0x00d9c2e4,
+0xc350fcc5, 0x0000ff3d, 0x0401b800, 0x440f0000,
+0xb805ebc2, 0x000003f8, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x3e800000, 0x41100000,
+0x3f000000, 0x42100000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003540,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x066a0d10, 0xfbc50000, 0x06021d10, 0xfbc50000,
+0x06022510, 0xfbc50000, 0x06022d10, 0xfbc50000,
+0x06021510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0x000260b8, 0xc2f5c500, 0xfdc500d7, 0xfa83d250,
+0x61850f0f, 0xc5000005, 0x245458f5, 0x29fdc508,
+0xc5c82454, 0x247c28fd, 0x0266b808, 0xc5c50000,
+0xedc5d758, 0xc82454c2, 0x50fdc500, 0x0ffa83d2,
+0x0532850f, 0xfdc50000, 0xc8247428, 0x545ccdc5,
+0xfdc50824, 0xe8245429, 0x54c2f5c5, 0xb800e824,
+0x0000026b, 0xd250fdc5, 0x0f0ffa83, 0x00050785,
+0x28fdc500, 0xc528247c, 0x244c59f5, 0x59c5c508,
+0x28fdc5df, 0xc5082454, 0xc5ef58ed, 0x24645ced,
+0x5cf5c528, 0x0282b8cb, 0xddc50000, 0xf5c5e559,
+0xc500ccc2, 0x83d150fd, 0x850f0ffa, 0x000004c8,
+0x4c59edc5, 0xfdc54824, 0xa8244c29, 0x545eedc5,
+0xf5c54824, 0xb800cac2, 0x0000028b, 0xd150fdc5,
+0x0f0ffa83, 0x00049f85, 0x7de2c400, 0x04ce1d19,
+0xfdc50000, 0x48245428, 0x00028eb8, 0x57edc500,
+0x57e5c5cb, 0xc508245c, 0x244c59f5, 0xc2f5c5a8,
+0xfdc500cb, 0xfa83d150, 0x69850f0f, 0xc5000004,
+0x244c5afd, 0x75e3c408, 0xc501c918, 0xc5c953fc,
+0xc5c95afc, 0x244c29fd, 0x5afdc5a8, 0xc5a8244c,
+0x244c29f8, 0x75e3c498, 0xc501c918, 0x246428fd,
+0x53fcc508, 0x0296b8c9, 0xfcc50000, 0xffc5c95a,
+0xfec5c9e6, 0xf5c5c9e6, 0xc500ccc2, 0x83d150fd,
+0x850f0ffa, 0x00000410, 0xcc59ddc5, 0x4c29fdc5,
+0xfdc5a824, 0xa8244c5a, 0x1875e3c4, 0xfcc501c9,
+0xfcc5c952, 0xfdc5c95a, 0xc8244c29, 0x5c28fdc5,
+0x9db8c824, 0xc5000002, 0xc5cb5afd, 0x244c29f8,
+0x75e3c498, 0xc501c918, 0xc5c953fc, 0xc5c95afc,
+0xc5c9e6ff, 0xc5c9e6fe, 0x00e1c2dd, 0xd450fdc5,
+0x0f0ffa83, 0x0003af85, 0x28fdc500, 0xc5082464,
+0xc5dbe6ff, 0xb8dbe6fe, 0x0000029f, 0xcc5afdc5,
+0x4c29f8c5, 0xe3c49824, 0x01c91875, 0xc953fcc5,
+0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5, 0xd9c2e5c5,
+0x50fdc500, 0x0ffa83d3, 0x036a850f, 0xddc50000,
+0xfdc5cc59, 0xa8244c29, 0x4c51fdc5, 0xa7b8a824,
+0xc5000002, 0x00ccc2f5, 0xd150fdc5, 0x0f0ffa83,
+0x00034385, 0x7de2c400, 0x03b20d19, 0xf5c50000,
+0xfdc5e45e, 0xa8246429, 0x097de3c4, 0x0ba8245c,
+0x0002afb8, 0xc2e5c500, 0x0003921d, 0xfdc50000,
+0xfa83d350, 0x0d850f0f, 0x8f000003, 0x64817ce9,
+0xe1c50824, 0xb6b8db57, 0xc5000002, 0x00e3c2dd,
+0xd450fdc5, 0x0f0ffa83, 0x0002eb85, 0x58f5c500,
+0xc5082464, 0xc5cc5ef5, 0x244c29fd, 0x7ce98fa8,
+0xa8244c81, 0x4cc2f5c5, 0xb800a824, 0x000002bc,
+0xd150fdc5, 0x0f0ffa83, 0x0002bb85, 0x7de2c400,
+0x02f20d19, 0xf5c50000, 0x08244c59, 0x4c29fdc5,
+0xe3c4a824, 0x244c097d, 0xe98f0ba8, 0x2464817c,
+0x58f5c5a8, 0x02c6b8cc, 0xf5c50000, 0xa8244cc2,
+0x50fdc500, 0x0ffa83d1, 0x027a850f, 0xedc50000,
+0x28244c59, 0x6459edc5, 0xfdc50824, 0xc8244c29,
+0x4c5fddc5, 0xddc5c824, 0xc824645d, 0x6429fdc5,
+0xf5c5c824, 0xc8244c58, 0x7428fdc5, 0x48b80824,
+0xc5000003, 0x246458cd, 0x59f5c528, 0xc2f5c5ca,
+0xfdc500cc, 0xfa83d150, 0x29850f0f, 0xc5000002,
+0x244c28fd, 0x28fdc508, 0xb828246c, 0x00000359,
+0x057de3c4, 0xe3c405e1, 0x01e4065d, 0xe4c2d5c5,
+0x50fdc500, 0x0ffa83d4, 0x01fa850f, 0xf5c50000,
+0x62b8cd58, 0xc4000003, 0x25197de2, 0x00000230,
+0xccc2f5c5, 0x50fdc500, 0x0ffa83d1, 0x01d6850f,
+0xffc50000, 0x08246412, 0x197de2c4, 0x0001f735,
+0x28fdc500, 0xb808244c, 0x000003b1, 0x197de2c4,
+0x0002033d, 0x58edc500, 0x5cddc5f6, 0x59cdc5e1,
+0xc2ddc5f7, 0xfdc500e6, 0xfa83d450, 0x95850f0f,
+0xc4000001, 0xcc197de3, 0xc2e5c501, 0xc4b801d2,
+0xc5000003, 0x244c13f9, 0x13f9c5c8, 0xc4d82464,
+0xec197de3, 0x17f9c501, 0xc5d0246c, 0x246417f9,
+0x28fdc5e0, 0x8fc8245c, 0xcda274e8, 0xc2e5c520,
+0xfdc500c9, 0xfa83d150, 0x49850f0f, 0x48000001,
+0xc4ffc883, 0x4c2d6de2, 0xfdc50824, 0xe8244c29,
+0xc9eff1c5, 0x24448948, 0x7de2c490, 0x90246419,
+0x0003cdb8, 0x74e88f00, 0xc420cca2, 0x6c2f75e2,
+0xfdc5e824, 0xe8247c28, 0xcbc2c5c5, 0x50fdc500,
+0x0ffa83d1, 0x00fe850f, 0xfdc50000, 0x08247428,
+0x0003d4b8, 0x4de3c400, 0x28244c0d, 0xc2e5c50a,
+0xfdc500d9, 0xfa83d350, 0xd9850f0f, 0xc5000000,
+0x247c28fd, 0xd0c5c508, 0xc528244c, 0x245428fd,
+0xd0edc508, 0xb828245c, 0x000003dd, 0xcbc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x00aa850f, 0xfdc50000,
+0xa8245429, 0xc957f1c5, 0x547cf5c5, 0xe3c4a824,
+0x01da186d, 0x066de3c4, 0xe5c531d2, 0xc50cd2c6,
+0x245429fd, 0x7cf5c5a8, 0xc4a82454, 0xd2197de3,
+0x15e9c501, 0x2ef9c5d2, 0x0000c315, 0x75647a00,
+0x28fdc562, 0xc508246c, 0x24547dd5, 0x0000ba28,
+0xe3c40000, 0x01da186d, 0x066de3c4, 0xe5c531d2,
+0xc50cdac6, 0xc4d97ce5, 0xd31865e3, 0x65e3c401,
+0xc531db06, 0x0cd3c6ed, 0xd17cedc5, 0x186de3c4,
+0xe3c401da, 0x31d2066d, 0xd2c6e5c5, 0xc2edc50c,
+0xfdc500c9, 0xf883c150, 0x0401b80f, 0x440f0000,
+0xb805ebc2, 0x000003f8, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fd00000,
+0x00000000, 0x40140000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40240000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003240,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_f4[] = {
+0x315524eb, 0xe58948c0, 0x48fc7d89, 0x80fc558d,
+0x75ff103c, 0xc0ff480d, 0x04f88348, 0x01b0f175,
+0xc03102eb, 0x4855c35d, 0x8348e589, 0x8148e0e4,
+0x000100ec, 0x10fac500, 0x0004830d, 0x11fac500,
+0xc52c244c, 0x244c11fa, 0x11fac530, 0x8b34244c,
+0x892c2444, 0x31202444, 0x10fac5ff, 0xc5202454,
+0x24542ef8, 0x0000b92c, 0x0f400000, 0x450fc79b,
+0xe8dff7f9, 0xffffff8a, 0x60b8c289, 0x84000002,
+0x2f840fd2, 0xc5000004, 0x245410fa, 0x58eac520,
+0xc52c2454, 0x245411fa, 0x10fac524, 0x312c2454,
+0x58eac5ff, 0x2ef8c5d2, 0x40242454, 0x0fc79b0f,
+0xdff7f945, 0xffff49e8, 0xb8c289ff, 0x00000266,
+0x840fd284, 0x000003ee, 0x5410fac5, 0xeac52424,
+0x2c24545c, 0x1411fac5, 0x24048b24, 0x5c244489,
+0x24244489, 0x28244489, 0xfac5ff31, 0x20245410,
+0x542ef8c5, 0x0f402824, 0x450fc79b, 0xe8dff7f9,
+0xfffffefe, 0x6bb8c289, 0x84000002, 0xa3840fd2,
+0xc5000003, 0x245410fa, 0x59eac520, 0xc52c2454,
+0x245411fa, 0x10fac520, 0xc5302454, 0xc5d259ea,
+0x245411fa, 0x10fac524, 0xc52c2454, 0x245458ea,
+0x11fac530, 0xc5282454, 0x245410fa, 0x5ceac52c,
+0x3130245c, 0x59e2c5ff, 0xc528245c, 0x246410fa,
+0x5cdac520, 0xc5242464, 0xc5e32ef8, 0x245c11fa,
+0x9b0f4028, 0xf9450fc7, 0x83e8dff7, 0x89fffffe,
+0x0282b8c2, 0xd2840000, 0x0328840f, 0xeac50000,
+0x34245459, 0x5411fac5, 0xff312024, 0x5410fac5,
+0xeac52c24, 0x3424545e, 0x542ef8c5, 0xfac52024,
+0x24245411, 0xc79b0f40, 0xf7f9450f, 0xfe40e8df,
+0xc289ffff, 0x00028bb8, 0x0fd28400, 0x0002e584,
+0x10fac500, 0xc5342454, 0xf12510fa, 0xc5000002,
+0x245c10fa, 0xc5ff312c, 0xc5d457e8, 0xc5dc57e0,
+0x245459ea, 0x2ef8c520, 0x9b0f40d3, 0xf9450fc7,
+0xfbe8dff7, 0x89fffffd, 0x028eb8c2, 0xd2840000,
+0x02a0840f, 0x0ff30000, 0x2c245453, 0x5411fac5,
+0x0ff32024, 0x20245c53, 0xc32cfac5, 0x5410fac5,
+0xff312c24, 0xd82ae2c5, 0xda2ef8c5, 0xc79b0f40,
+0xf7f9450f, 0xfdb8e8df, 0xc289ffff, 0x000296b8,
+0x0fd28400, 0x00025d84, 0x59eac500, 0x11fac5d2,
+0xf3202454, 0x2454520f, 0x11fac520, 0xf3242454,
+0x2454530f, 0x2cfac524, 0xc5ff31c2, 0xc5d02aea,
+0x24542ef8, 0x9b0f402c, 0xf9450fc7, 0x6fe8dff7,
+0x89fffffd, 0x029db8c2, 0xd2840000, 0x0214840f,
+0xfac50000, 0x2424442c, 0x0ff3ff31, 0x2c245453,
+0xd82ae2c5, 0xc22cfac5, 0xd02aeac5, 0xda2ef8c5,
+0xc79b0f40, 0xf7f9450f, 0xfd34e8df, 0xc289ffff,
+0x00029fb8, 0x0fd28400, 0x0001d984, 0x10fac500,
+0xc52c2454, 0xc5d259ea, 0x245411fa, 0x10fac520,
+0x312c2454, 0x510ff3ff, 0xc520245c, 0x40da2ef8,
+0x0fc79b0f, 0xdff7f945, 0xfffcf5e8, 0xb8c289ff,
+0x000002a7, 0x840fd284, 0x0000019a, 0xd25ef2c5,
+0x4c11fac5, 0xfac52424, 0x20245411, 0x0f66ff31,
+0x24540a3a, 0xf8c50b20, 0x2424542e, 0x5411fac5,
+0x0f402824, 0x450fc79b, 0xe8dff7f9, 0xfffffcb2,
+0xafb8c289, 0x84000002, 0x57840fd2, 0x8f000001,
+0x548278e9, 0xfac52c24, 0x20245411, 0xe8c5ff31,
+0xf8c5d257, 0x2024542e, 0xc79b0f40, 0xf7f9450f,
+0xfc7ce8df, 0xc289ffff, 0x0002b6b8, 0x0fd28400,
+0x00012184, 0x58f2c500, 0xc52c2454, 0xc5ca5ef2,
+0x244c11fa, 0x78e98f20, 0x20244c82, 0x4c11fac5,
+0xff312424, 0x4c10fac5, 0xf8c52024, 0x24244c2e,
+0xc79b0f40, 0xf7f9450f, 0xfc34e8df, 0xc289ffff,
+0x0002bcb8, 0x0fd28400, 0x0000d984, 0x10fac500,
+0x0000df0d, 0x59f2c500, 0xc52c244c, 0x244c11fa,
+0x3a0f6620, 0x20244c0a, 0x11fac50b, 0x8f24244c,
+0x4c8278e9, 0xfac52024, 0x28244c11, 0xfac5ff31,
+0x24244c10, 0x4c58f2c5, 0xf8c52824, 0x20244c2e,
+0xc79b0f40, 0xf7f9450f, 0xfbd4e8df, 0xc289ffff,
+0x0002c6b8, 0x74d28400, 0x10fac57d, 0xc534244c,
+0x245459f2, 0x59f2c52c, 0xc530244c, 0x245411fa,
+0x11fac520, 0xc524244c, 0x244c10fa, 0x5ff2c520,
+0xc524244c, 0x244c11fa, 0x10fac528, 0xc520244c,
+0x244c5df2, 0x11fac524, 0xc524244c, 0x244c10fa,
+0x58f2c524, 0x3128244c, 0x59f2c5ff, 0xc534244c,
+0x245410fa, 0x58eac52c, 0xc5302454, 0x40ca2ef8,
+0x0fc79b0f, 0xdff7f945, 0xfffb55e8, 0x19013cff,
+0x034825c0, 0xc3c90000, 0x00000000, 0x00000000,
+0x3f800000, 0x3e800000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002340,
+};
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000168ec,
+0x10fbc500, 0x0005470d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5a8,
+0xbac02454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000260, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0xec850f00, 0xc5000004,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x66b8f06e, 0xc5000002, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x04a1850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482024, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x026bb8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x00044685, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x82b8e86e, 0xc5000002, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x03c1850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x0000028b, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x74850f00, 0xc5000003, 0x81257efa, 0xc5000003,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x8eb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0325850f, 0x0ff20000, 0xc024545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff2a824, 0xa8245c5a,
+0xdb530ff3, 0xdb5a0ff3, 0xc32cfbc5, 0x5410fbc5,
+0xe3c5c024, 0xc031d82a, 0xda2ef9c5, 0x48c09b0f,
+0x48c2450f, 0xe1c4d8f7, 0xb8e86ef9, 0x00000296,
+0xcdd7f9c5, 0x81c9b60f, 0x0000fff9, 0xc8850f00,
+0xc5000002, 0xc5d259eb, 0x245411fb, 0x5a0ff2a8,
+0xf3a82454, 0xf3d2520f, 0xc5d25a0f, 0x245413f9,
+0x5a0ff2b0, 0xf3b02454, 0xf3d2530f, 0xc5d25a0f,
+0xc5c22cfb, 0x31d02aeb, 0x2ef9c5c0, 0x0fc02454,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x9db8f06e,
+0xc5000002, 0x0fced7f9, 0xf981c9b6, 0x000000ff,
+0x0265850f, 0xfbc50000, 0xb0244c2c, 0x545a0ff2,
+0x0ff3c024, 0x0ff3d253, 0xfbc5d25a, 0xc139c22c,
+0x0fc0940f, 0xf748c0b6, 0xf9e1c4d8, 0x9fb8f86e,
+0xc5000002, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x0225850f, 0xfbc50000, 0xc0245410, 0xd259ebc5,
+0x5411fbc5, 0xfbc5a824, 0xc0245410, 0x0ff2c031,
+0xa8245c51, 0xda2ef9c5, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x000002a7, 0xd5d7f9c5,
+0x81d2b60f, 0x0000fffa, 0xdc850f00, 0xc5000001,
+0xc5d25ef3, 0x244c11fb, 0x11fbc5b0, 0x31a82454,
+0x0000bac0, 0x0f660000, 0x24540b3a, 0xf9c50ba8,
+0xb024542e, 0x5411fbc5, 0x9b0fb824, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x02afb8f0, 0xf9c50000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x00018a85,
+0x78e98f00, 0xc0245483, 0x5413f9c5, 0xc031a824,
+0xd257e9c5, 0x542ef9c5, 0x9b0fa824, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x02b6b8f8, 0xf9c50000,
+0xb60fcfd7, 0xfff981c9, 0x0f000000, 0x00014a85,
+0x58f3c500, 0xc5c02454, 0xc5ca5ef3, 0x244c11fb,
+0x78e98fa8, 0xa8244c83, 0x4c13f9c5, 0xc031b024,
+0x4c10fbc5, 0xf9c5a824, 0xb0244c2e, 0x48c09b0f,
+0x48c2450f, 0xe1c4d8f7, 0xb8e06ef9, 0x000002bc,
+0xccd7f9c5, 0x81c9b60f, 0x0000fff9, 0xf8850f00,
+0xc5000000, 0xfd0d10fb, 0xc5000000, 0x244c59f3,
+0x11fbc5c0, 0x66a8244c, 0x4c0b3a0f, 0xc50ba824,
+0x244c13f9, 0x78e98fb0, 0xa8244c83, 0x4c13f9c5,
+0xc031b824, 0x4c10fbc5, 0xf3c5b024, 0xb8244c58,
+0x4c2ef9c5, 0x9b0fa824, 0x450f48c0, 0xd8f748c2,
+0x6ef9e1c4, 0x02c6b8e8, 0xf9c50000, 0xb60fcdd7,
+0xfff981c9, 0x0f000000, 0x00008e85, 0x10fbc500,
+0xc5d0244c, 0x245459f3, 0x59f3c5c0, 0xc5c8244c,
+0x245411fb, 0x11fbc5a8, 0xc5b0244c, 0x244c10fb,
+0x5ff3c5a8, 0xc5b0244c, 0x244c11fb, 0x10fbc5b8,
+0xc5a8244c, 0x244c5df3, 0x11fbc5b0, 0xc5b0244c,
+0x244c10fb, 0x58f3c5b0, 0x31b8244c, 0x59f3c5c0,
+0xc5d0244c, 0x245410fb, 0x58ebc5c0, 0xc5c82454,
+0x0fca2ef9, 0x0f48c09b, 0x48bac245, 0x48000003,
+0xe1c4d8f7, 0xc5f06ef9, 0x0fc6d7f9, 0xff3dc0b6,
+0xb8000000, 0x00000000, 0xc9c2450f, 0x000000c3,
+0x00000000, 0x3ff00000, 0x00000000, 0x3fd00000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002600,
+};
@@ -0,0 +1,484 @@
+/*
+ * xenpaging-replay.c
+ *
+ * Compare xenpaging's policies by replaying a trace of guest page accesses
+ * against them, counting the page faults each of them causes while keeping
+ * the number of resident pages at a target.
+ *
+ * The trace holds one gfn (in hex) per line, '#' starting comments; it can
+ * e.g. be derived from a xentrace of a guest running under xenpaging.
+ * Alternatively, access patterns get generated:
+ *
+ *   hotcold  90% of the accesses go to 10% of the pages
+ *   loop     the pages get accessed in order, over and over
+ *   mix      hotcold, with every tenth access part of a loop
+ *
+ * Xen's working set estimation gets simulated by "scanning" accessed bits
+ * every -s accesses, with 0 not providing any working set data at all.
+ * Page-ins read ahead up to -R pages past the faulting one, growing the
+ * window on sequential faults the way xenpaging's --readahead does.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "policy.h"
+
+struct sim {
+    struct xenpaging paging;
+    unsigned long target;        /* resident pages */
+    unsigned long resident;
+    unsigned long scan_interval; /* accesses */
+    unsigned int readahead;      /* pages */
+    uint64_t scans;
+    uint8_t *present;
+    uint8_t *accessed;
+    uint8_t *ages;
+    /* Results */
+    uint64_t faults, read_ahead, evictions, bad_victims, no_victim, choose_ns;
+};
+
+static struct sim sim;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Stand-ins for what the pager gets from Xen. */
+int policy_wss_enable(struct xenpaging *paging, unsigned int interval_ms)
+{
+    return sim.scan_interval ? 0 : -1;
+}
+
+int64_t policy_wss_get(struct xenpaging *paging, unsigned long gfn,
+                       unsigned long nr, uint8_t *ages)
+{
+    if ( nr )
+        memcpy(ages, sim.ages + gfn, nr);
+
+    return sim.scans;
+}
+
+static void scan(void)
+{
+    unsigned long gfn;
+
+    for ( gfn = 0; gfn < sim.paging.max_pages; gfn++ )
+    {
+        uint8_t *age = &sim.ages[gfn];
+
+        if ( !sim.present[gfn] )
+            *age = XEN_DOMCTL_WSS_AGE_UNMAPPED;
+        else if ( sim.accessed[gfn] || *age == XEN_DOMCTL_WSS_AGE_UNMAPPED )
+            *age = 0;
+        else if ( *age < XEN_DOMCTL_WSS_AGE_MAX )
+            ++*age;
+
+        sim.accessed[gfn] = 0;
+    }
+
+    sim.scans++;
+}
+
+/* Evict pages until back at the target, the way xenpaging does. */
+static void evict(void)
+{
+    while ( sim.resident > sim.target )
+    {
+        uint64_t t = now_ns();
+        unsigned long gfn = policy_choose_victim(&sim.paging);
+
+        sim.choose_ns += now_ns() - t;
+
+        if ( gfn == INVALID_MFN )
+        {
+            sim.no_victim++;
+            return;
+        }
+
+        if ( gfn >= sim.paging.max_pages || !sim.present[gfn] )
+        {
+            sim.bad_victims++;
+            continue;
+        }
+
+        sim.present[gfn] = 0;
+        sim.resident--;
+        sim.evictions++;
+        sim.paging.num_paged_out++;
+        policy_notify_paged_out(gfn);
+    }
+}
+
+/* Page in the pages following a faulting one, as xenpaging does. */
+static void read_ahead(unsigned long gfn)
+{
+    static unsigned int window;
+    static unsigned long next_gfn;
+    unsigned int i;
+
+    if ( gfn == next_gfn )
+        window = window ? window * 2 : 1;
+    else
+        window = 1;
+    if ( window > sim.readahead )
+        window = sim.readahead;
+    next_gfn = gfn + window + 1;
+
+    for ( i = 1; i <= window && gfn + i < sim.paging.max_pages; i++ )
+    {
+        if ( sim.present[gfn + i] )
+            continue;
+
+        sim.read_ahead++;
+        sim.present[gfn + i] = 1;
+        sim.resident++;
+        policy_notify_paged_in_nomru(gfn + i);
+        sim.paging.num_paged_out--;
+    }
+}
+
+static void access_gfn(unsigned long gfn)
+{
+    static unsigned long since_scan;
+
+    sim.accessed[gfn] = 1;
+
+    if ( !sim.present[gfn] )
+    {
+        sim.faults++;
+        read_ahead(gfn);
+        sim.present[gfn] = 1;
+        sim.resident++;
+
+        if ( sim.paging.num_paged_out > sim.paging.policy_mru_size )
+            policy_notify_paged_in(gfn);
+        else
+            policy_notify_paged_in_nomru(gfn);
+        sim.paging.num_paged_out--;
+
+        evict();
+    }
+
+    if ( sim.scan_interval && ++since_scan == sim.scan_interval )
+    {
+        scan();
+        since_scan = 0;
+    }
+}
+
+static int run(const char *name, const unsigned long *trace, size_t nr)
+{
+    size_t i;
+
+    if ( policy_select(name) )
+    {
+        fprintf(stderr, "Unknown policy '%s'\n", name);
+        return 1;
+    }
+
+    if ( policy_init(&sim.paging) )
+    {
+        fprintf(stderr, "Failed to initialise policy '%s'\n", name);
+        return 1;
+    }
+
+    /* Start out with all pages resident, like a guest does. */
+    memset(sim.present, 1, sim.paging.max_pages);
+    sim.resident = sim.paging.max_pages;
+    evict();
+
+    sim.faults = sim.read_ahead = sim.evictions = sim.choose_ns = 0;
+
+    for ( i = 0; i < nr; i++ )
+        access_gfn(trace[i]);
+
+    printf("%-10s %10zu %10"PRIu64" %7.3f%% %10"PRIu64" %10"PRIu64" %8.0f"
+           " %6"PRIu64" %6"PRIu64"\n",
+           name, nr, sim.faults, sim.faults * 100.0 / nr, sim.read_ahead,
+           sim.evictions,
+           sim.evictions ? (double)sim.choose_ns / sim.evictions : 0,
+           sim.bad_victims, sim.no_victim);
+
+    return sim.bad_victims ? 1 : 0;
+}
+
+static unsigned long *generate(const char *kind, unsigned long pages,
+                               size_t nr)
+{
+    unsigned long *trace = malloc(nr * sizeof(*trace));
+    unsigned long hot = pages / 10 ?: 1, next = 0;
+    size_t i;
+
+    if ( !trace )
+        return NULL;
+
+    srand(1);
+
+    for ( i = 0; i < nr; i++ )
+    {
+        int in_loop;
+
+        if ( !strcmp(kind, "loop") )
+            in_loop = 1;
+        else if ( !strcmp(kind, "hotcold") )
+            in_loop = 0;
+        else if ( !strcmp(kind, "mix") )
+            in_loop = !(i % 10);
+        else
+        {
+            free(trace);
+            return NULL;
+        }
+
+        if ( in_loop )
+        {
+            trace[i] = next;
+            next = (next + 1) % pages;
+        }
+        else if ( rand() % 10 )
+            trace[i] = rand() % hot;
+        else
+            trace[i] = hot + rand() % (pages - hot ?: 1);
+
+        trace[i] %= pages;
+    }
+
+    return trace;
+}
+
+static unsigned long *load(const char *path, size_t *nr)
+{
+    FILE *f = strcmp(path, "-") ? fopen(path, "r") : stdin;
+    unsigned long *trace = NULL;
+    size_t size = 0;
+    char line[80];
+
+    if ( !f )
+        return NULL;
+
+    *nr = 0;
+    while ( fgets(line, sizeof(line), f) )
+    {
+        char *end;
+        unsigned long gfn = strtoul(line, &end, 16);
+
+        if ( end == line || line[0] == '#' )
+            continue;
+
+        if ( *nr == size )
+        {
+            unsigned long *t;
+
+            size = size ? size * 2 : 4096;
+            t = realloc(trace, size * sizeof(*trace));
+            if ( !t )
+            {
+                free(trace);
+                trace = NULL;
+                break;
+            }
+            trace = t;
+        }
+
+        trace[(*nr)++] = gfn;
+    }
+
+    if ( f != stdin )
+        fclose(f);
+
+    return trace;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options] <trace>|-\n"
+            "       %s [options] -g <hotcold|loop|mix> -n <pages>"
+            " -a <accesses>\n"
+            "\n"
+            "  -p  policy to replay against, repeatable (default: all)\n"
+            "  -m  resident pages to keep (default: half)\n"
+            "  -n  pages of the guest (default: from the trace)\n"
+            "  -s  accesses between working set scans, 0 for none"
+            " (default 10000)\n"
+            "  -r  xenpaging's --mru_size\n"
+            "  -R  pages to read ahead, as xenpaging's --readahead"
+            " (default 0)\n"
+            "  -v  verbose policy output\n"
+            "\n"
+            "policies:\n",
+            prog, prog);
+    policy_list(stderr);
+}
+
+int main(int argc, char *argv[])
+{
+    static const char *const all[] = { "default", "clockpro" };
+    const char *policies[16], *kind = NULL;
+    unsigned int nr_policies = 0, i;
+    unsigned long pages = 0, *trace;
+    size_t nr = 0;
+    struct xc_interface_core xch = { 0 };
+    int c, verbose = 0, rc = 0;
+
+    sim.scan_interval = 10000;
+
+    while ( (c = getopt(argc, argv, "p:m:n:s:r:R:g:a:v")) != -1 )
+    {
+        switch ( c )
+        {
+        case 'p':
+            if ( nr_policies < sizeof(policies) / sizeof(policies[0]) )
+                policies[nr_policies++] = optarg;
+            break;
+
+        case 'm':
+            sim.target = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'n':
+            pages = strtoul(optarg, NULL, 0);
+            break;
+
+        case 's':
+            sim.scan_interval = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            sim.paging.policy_mru_size = atoi(optarg);
+            break;
+
+        case 'R':
+            sim.readahead = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'g':
+            kind = optarg;
+            break;
+
+        case 'a':
+            nr = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'v':
+            verbose = 1;
+            break;
+
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ( kind ? optind != argc || !pages || !nr : optind != argc - 1 )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    trace = kind ? generate(kind, pages, nr) : load(argv[optind], &nr);
+    if ( !trace || !nr )
+    {
+        fprintf(stderr, "No trace to replay\n");
+        return 1;
+    }
+
+    for ( i = 0; i < nr; i++ )
+    {
+        if ( !kind && trace[i] >= pages )
+            pages = trace[i] + 1;
+        if ( trace[i] >= pages )
+        {
+            fprintf(stderr, "gfn %lx beyond the guest's %lu pages\n",
+                    trace[i], pages);
+            return 1;
+        }
+    }
+
+    if ( !sim.target )
+        sim.target = pages / 2;
+
+    if ( !nr_policies )
+        for ( ; nr_policies < sizeof(all) / sizeof(all[0]); nr_policies++ )
+            policies[nr_policies] = all[nr_policies];
+
+    /* The policies report through libxc's logging. */
+    xch.error_handler = (xentoollog_logger *)
+        xtl_createlogger_stdiostream(stderr, verbose ? XTL_DEBUG : XTL_ERROR,
+                                     0);
+    sim.paging.xc_handle = &xch;
+    sim.paging.max_pages = pages;
+
+    sim.present = malloc(pages);
+    sim.accessed = calloc(pages, 1);
+    sim.ages = malloc(pages);
+    if ( !xch.error_handler || !sim.present || !sim.accessed || !sim.ages )
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    memset(sim.ages, XEN_DOMCTL_WSS_AGE_UNMAPPED, pages);
+
+    printf("%lu pages, %lu resident, %zu accesses, scan every %lu, read "
+           "ahead %u\n\n", pages, sim.target, nr, sim.scan_interval,
+           sim.readahead);
+    printf("%-10s %10s %10s %8s %10s %10s %8s %6s %6s\n", "policy",
+           "accesses", "faults", "rate", "read ahead", "evictions", "ns/pick",
+           "bad", "none");
+
+    /* Policies keep their state in globals: give each a process of its own. */
+    for ( i = 0; i < nr_policies; i++ )
+    {
+        pid_t pid;
+        int status;
+
+        fflush(stdout);
+        pid = fork();
+        if ( pid < 0 )
+        {
+            perror("fork");
+            return 1;
+        }
+        if ( !pid )
+            exit(run(policies[i], trace, nr));
+
+        if ( waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) ||
+             WEXITSTATUS(status) )
+            rc = 1;
+    }
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
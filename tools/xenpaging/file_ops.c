@@ -19,23 +19,20 @@
  */
 
 
+#include <fcntl.h>
 #include <unistd.h>
 #include <xc_private.h>
 
 static int file_op(int fd, void *page, int i,
-                   ssize_t (*fn)(int, void *, size_t))
+                   ssize_t (*fn)(int, void *, size_t, off_t))
 {
-    off_t offset = i;
+    off_t offset = (off_t)i << PAGE_SHIFT;
     int total = 0;
     int bytes;
 
-    offset = lseek(fd, offset << PAGE_SHIFT, SEEK_SET);
-    if ( offset == (off_t)-1 )
-        return -1;
-
     while ( total < PAGE_SIZE )
     {
-        bytes = fn(fd, page + total, PAGE_SIZE - total);
+        bytes = fn(fd, page + total, PAGE_SIZE - total, offset + total);
         if ( bytes <= 0 )
             return -1;
 
@@ -45,21 +42,40 @@ static int file_op(int fd, void *page, int i,
     return 0;
 }
 
-static ssize_t my_write(int fd, void *buf, size_t count)
+static ssize_t my_pwrite(int fd, void *buf, size_t count, off_t offset)
 {
-    return write(fd, buf, count);
+    return pwrite(fd, buf, count, offset);
 }
 
 int read_page(int fd, void *page, int i)
 {
-    return file_op(fd, page, i, &read);
+    return file_op(fd, page, i, &pread);
 }
 
 int write_page(int fd, void *page, int i)
 {
-    return file_op(fd, page, i, &my_write);
+    return file_op(fd, page, i, &my_pwrite);
 }
 
+/*
+ * Start reading the given slots in the background, for the read_page()s
+ * following to (mostly) find them cached.  Adjacent slots get merged.
+ */
+void prefetch_pages(int fd, const int *slots, int nr)
+{
+    int i, first = 0;
+
+    for ( i = 1; i <= nr; i++ )
+    {
+        if ( i < nr && slots[i] == slots[i - 1] + 1 )
+            continue;
+
+        posix_fadvise(fd, (off_t)slots[first] << PAGE_SHIFT,
+                      (off_t)(slots[i - 1] - slots[first] + 1) << PAGE_SHIFT,
+                      POSIX_FADV_WILLNEED);
+        first = i;
+    }
+}
 
 /*
  * Local variables:
@@ -26,6 +26,7 @@
 
 int read_page(int fd, void *page, int i);
 int write_page(int fd, void *page, int i);
+void prefetch_pages(int fd, const int *slots, int nr);
 
 
 #endif
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * tools/xenpaging/policy.c
+ *
+ * Selection of the paging policy.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "policy.h"
+
+
+static const struct xenpaging_policy *const policies[] = {
+    &policy_default,
+    &policy_clockpro,
+};
+
+static const struct xenpaging_policy *policy = &policy_default;
+
+
+int policy_select(const char *name)
+{
+    unsigned int i;
+
+    for ( i = 0; i < sizeof(policies) / sizeof(policies[0]); i++ )
+    {
+        if ( strcmp(policies[i]->name, name) == 0 )
+        {
+            policy = policies[i];
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+void policy_list(FILE *f)
+{
+    unsigned int i;
+
+    for ( i = 0; i < sizeof(policies) / sizeof(policies[0]); i++ )
+        fprintf(f, "  %-10s %s\n", policies[i]->name, policies[i]->desc);
+}
+
+int policy_init(struct xenpaging *paging)
+{
+    return policy->init(paging);
+}
+
+unsigned long policy_choose_victim(struct xenpaging *paging)
+{
+    return policy->choose_victim(paging);
+}
+
+void policy_notify_paged_out(unsigned long gfn)
+{
+    policy->notify_paged_out(gfn);
+}
+
+void policy_notify_paged_in(unsigned long gfn)
+{
+    policy->notify_paged_in(gfn);
+}
+
+void policy_notify_paged_in_nomru(unsigned long gfn)
+{
+    policy->notify_paged_in_nomru(gfn);
+}
+
+void policy_notify_dropped(unsigned long gfn)
+{
+    policy->notify_dropped(gfn);
+}
+
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -27,6 +27,24 @@
 #include "xenpaging.h"
 
 
+struct xenpaging_policy {
+    const char *name;
+    const char *desc;
+    int (*init)(struct xenpaging *paging);
+    unsigned long (*choose_victim)(struct xenpaging *paging);
+    void (*notify_paged_out)(unsigned long gfn);
+    void (*notify_paged_in)(unsigned long gfn);
+    void (*notify_paged_in_nomru)(unsigned long gfn);
+    void (*notify_dropped)(unsigned long gfn);
+};
+
+extern const struct xenpaging_policy policy_default;
+extern const struct xenpaging_policy policy_clockpro;
+
+/* Select the policy used by the calls below, by name. */
+int policy_select(const char *name);
+void policy_list(FILE *f);
+
 int policy_init(struct xenpaging *paging);
 unsigned long policy_choose_victim(struct xenpaging *paging);
 void policy_notify_paged_out(unsigned long gfn);
@@ -34,6 +52,17 @@ void policy_notify_paged_in(unsigned long gfn);
 void policy_notify_paged_in_nomru(unsigned long gfn);
 void policy_notify_dropped(unsigned long gfn);
 
+/*
+ * Working set data of the guest, as estimated by Xen from the accessed bits
+ * of its p2m, for policies to use; see xc_domain_wss_get().  Provided by the
+ * pager (or the policy replay benchmark).  policy_wss_get() fills ages[] for
+ * nr gfns starting at gfn, and returns the number of completed scans, or a
+ * negative value if no data is available.
+ */
+int policy_wss_enable(struct xenpaging *paging, unsigned int interval_ms);
+int64_t policy_wss_get(struct xenpaging *paging, unsigned long gfn,
+                       unsigned long nr, uint8_t *ages);
+
 #endif // __XEN_PAGING_POLICY_H__
 
 
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *
+ * Xen domain paging policy along the lines of CLOCK-Pro.
+ *
+ * Resident gfns are either hot or cold, and only cold ones get evicted.  A
+ * cold gfn found referenced by the clock hand starts a test period, and gets
+ * promoted to hot if referenced again before the test period ends, that is
+ * within one revolution of the hand, as with LRU-2.  Gfns evicted during their
+ * test period keep it: getting paged in again while it lasts means they got
+ * evicted too early, so they get promoted to hot right away, and the age cold
+ * gfns need to reach for eviction grows.  Running out of victims lowers that
+ * age again.  Hot gfns not referenced for a while get demoted to cold.
+ *
+ * Whether and how long ago gfns got referenced comes from Xen's working set
+ * estimation (the accessed bits of EPT entries, see xc_domain_wss_get()).
+ * Where that isn't available, only page-ins count as references.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "policy.h"
+
+
+/* Interval of Xen's accessed bit scans. */
+#define WSS_INTERVAL_MS  1000
+/* Ages get fetched from Xen in chunks of this many gfns. */
+#define WSS_CHUNK        (1UL << 20)
+
+/* Scans a cold gfn must not have been referenced for, initially and max. */
+#define COLD_AGE_INIT    2
+#define COLD_AGE_MAX     4
+/* Hot gfns get demoted when older than this many times the cold age. */
+#define HOT_AGE_FACTOR   2
+
+#define CP_HOT           0x01
+#define CP_TEST          0x02   /* in its test period */
+#define CP_OUT           0x04   /* paged out */
+#define CP_TRIED         0x08   /* chosen before, but not paged out */
+#define CP_PINNED        0x10   /* never to be paged out */
+#define CP_FRESH         0x20   /* paged in since the last scan */
+
+#define AGE_UNKNOWN      XEN_DOMCTL_WSS_AGE_UNMAPPED
+
+
+static uint8_t *flags;
+static uint8_t *ages;
+static unsigned long max_pages;
+static unsigned long hand;
+static unsigned int cold_age = COLD_AGE_INIT;
+static unsigned int nr_exhausted;
+static int have_wss;
+static int64_t wss_scans = -1;
+
+
+static void refresh_ages(struct xenpaging *paging)
+{
+    unsigned long gfn;
+    int64_t scans;
+
+    if ( !have_wss )
+        return;
+
+    /* Fetch ages only once per completed scan */
+    scans = policy_wss_get(paging, 0, 0, NULL);
+    if ( scans <= wss_scans )
+        return;
+
+    for ( gfn = 0; gfn < max_pages; gfn += WSS_CHUNK )
+    {
+        unsigned long nr = max_pages - gfn < WSS_CHUNK ? max_pages - gfn
+                                                      : WSS_CHUNK;
+
+        if ( policy_wss_get(paging, gfn, nr, ages + gfn) < 0 )
+            return;
+    }
+
+    /*
+     * The first scan after a page-in finds the gfn referenced (or still
+     * unmapped), if only by the access which faulted it in, which the
+     * page-in accounted for already.
+     */
+    for ( gfn = 0; gfn < max_pages; gfn++ )
+    {
+        if ( !(flags[gfn] & CP_FRESH) )
+            continue;
+        flags[gfn] &= ~CP_FRESH;
+        if ( !(flags[gfn] & CP_OUT) &&
+             (ages[gfn] == 0 || ages[gfn] == AGE_UNKNOWN) )
+            ages[gfn] = 1;
+    }
+
+    wss_scans = scans;
+}
+
+static int clockpro_init(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+
+    max_pages = paging->max_pages;
+
+    flags = calloc(max_pages, sizeof(*flags));
+    ages = malloc(max_pages * sizeof(*ages));
+    if ( !flags || !ages )
+        return -ENOMEM;
+
+    memset(ages, AGE_UNKNOWN, max_pages * sizeof(*ages));
+
+    have_wss = !policy_wss_enable(paging, WSS_INTERVAL_MS);
+    if ( !have_wss )
+        DPRINTF("no working set data, relying on page-ins only\n");
+
+    /* Don't page out page 0 */
+    flags[0] |= CP_PINNED;
+
+    /* Start in the middle to avoid paging during BIOS startup */
+    hand = max_pages / 2;
+
+    return 0;
+}
+
+static int referenced(unsigned long gfn)
+{
+    return ages[gfn] == 0;
+}
+
+static int old(unsigned long gfn, unsigned int age)
+{
+    return ages[gfn] == AGE_UNKNOWN || ages[gfn] >= age;
+}
+
+/*
+ * Advance the hand by one gfn, updating its state.  Returns whether it is
+ * a suitable victim, for the given minimum age.
+ */
+static int clock_step(unsigned long gfn, unsigned int age)
+{
+    uint8_t *f = &flags[gfn];
+
+    if ( *f & CP_OUT )
+    {
+        /* One revolution ends the test period of non-resident gfns. */
+        *f &= ~CP_TEST;
+        return 0;
+    }
+
+    if ( *f & (CP_PINNED | CP_TRIED) )
+        return 0;
+
+    if ( *f & CP_HOT )
+    {
+        if ( old(gfn, age * HOT_AGE_FACTOR) )
+            *f &= ~CP_HOT;
+        return 0;
+    }
+
+    if ( referenced(gfn) )
+    {
+        /*
+         * Count a reference only once, until the next scan brings news (or
+         * until the next page-in, without working set data).
+         */
+        ages[gfn] = have_wss ? 1 : AGE_UNKNOWN;
+
+        /* Referenced twice within a revolution: promote. */
+        if ( *f & CP_TEST )
+            *f = (*f & ~CP_TEST) | CP_HOT;
+        else
+            *f |= CP_TEST;
+        return 0;
+    }
+
+    return old(gfn, age);
+}
+
+static unsigned long clockpro_choose_victim(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+    unsigned long i;
+    unsigned int age;
+
+    refresh_ages(paging);
+
+    /*
+     * Up to one revolution per age threshold, halving it whenever a
+     * revolution doesn't turn up a victim.
+     */
+    for ( age = cold_age; ; age /= 2 )
+    {
+        for ( i = 0; i < max_pages; i++ )
+        {
+            unsigned long gfn = hand;
+
+            if ( ++hand >= max_pages )
+                hand = 0;
+
+            if ( clock_step(gfn, age) )
+            {
+                cold_age = age;
+                flags[gfn] |= CP_TRIED;
+                return gfn;
+            }
+        }
+
+        if ( !age )
+            break;
+    }
+
+    /* Could not nominate any gfn: no more pages, wait in poll */
+    paging->use_poll_timeout = 1;
+
+    /* Force retry of gfns which could not be paged out every few seconds */
+    if ( ++nr_exhausted > 123 )
+    {
+        for ( i = 0; i < max_pages; i++ )
+            flags[i] &= ~CP_TRIED;
+        nr_exhausted = 0;
+        DPRINTF("clearing tried gfns, hand %lx", hand);
+    }
+
+    return INVALID_MFN;
+}
+
+static void clockpro_notify_paged_out(unsigned long gfn)
+{
+    flags[gfn] = (flags[gfn] & ~(CP_TRIED | CP_HOT)) | CP_OUT;
+}
+
+static void clockpro_notify_paged_in(unsigned long gfn)
+{
+    uint8_t *f = &flags[gfn];
+
+    /* Faulted back in within its test period: evicted too early. */
+    if ( *f & CP_TEST )
+    {
+        *f = (*f & ~CP_TEST) | CP_HOT;
+        if ( cold_age < COLD_AGE_MAX )
+            cold_age++;
+    }
+    else
+        *f |= CP_TEST;
+
+    *f = (*f & ~CP_OUT) | CP_FRESH;
+
+    /*
+     * Accessed just now, whatever Xen's last scan found.  Young enough not
+     * to get evicted right away, but not counting as another reference.
+     */
+    ages[gfn] = have_wss ? 1 : AGE_UNKNOWN;
+}
+
+static void clockpro_notify_paged_in_nomru(unsigned long gfn)
+{
+    flags[gfn] = (flags[gfn] & ~(CP_OUT | CP_TEST | CP_HOT)) | CP_FRESH;
+
+    /*
+     * Not referenced (yet), e.g. read ahead, but given the same grace as
+     * pages faulted in, rather than being the next victim.
+     */
+    ages[gfn] = have_wss ? 1 : AGE_UNKNOWN;
+}
+
+static void clockpro_notify_dropped(unsigned long gfn)
+{
+    flags[gfn] &= ~(CP_OUT | CP_TEST | CP_HOT);
+}
+
+const struct xenpaging_policy policy_clockpro = {
+    .name                  = "clockpro",
+    .desc                  = "CLOCK-Pro/LRU-2, using EPT accessed bits",
+    .init                  = clockpro_init,
+    .choose_victim         = clockpro_choose_victim,
+    .notify_paged_out      = clockpro_notify_paged_out,
+    .notify_paged_in       = clockpro_notify_paged_in,
+    .notify_paged_in_nomru = clockpro_notify_paged_in_nomru,
+    .notify_dropped        = clockpro_notify_dropped,
+};
+
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
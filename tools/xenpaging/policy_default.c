@@ -36,7 +36,7 @@ static unsigned long current_gfn;
 static unsigned long max_pages;
 
 
-int policy_init(struct xenpaging *paging)
+static int default_init(struct xenpaging *paging)
 {
     int i;
     int rc = -ENOMEM;
@@ -76,7 +76,7 @@ int policy_init(struct xenpaging *paging)
     return rc;
 }
 
-unsigned long policy_choose_victim(struct xenpaging *paging)
+static unsigned long default_choose_victim(struct xenpaging *paging)
 {
     xc_interface *xch = paging->xc_handle;
     unsigned long i;
@@ -136,7 +136,7 @@ unsigned long policy_choose_victim(struct xenpaging *paging)
     return current_gfn;
 }
 
-void policy_notify_paged_out(unsigned long gfn)
+static void default_notify_paged_out(unsigned long gfn)
 {
     set_bit(gfn, bitmap);
     clear_bit(gfn, unconsumed);
@@ -159,21 +159,32 @@ static void policy_handle_paged_in(unsigned long gfn, int do_mru)
     i_mru++;
 }
 
-void policy_notify_paged_in(unsigned long gfn)
+static void default_notify_paged_in(unsigned long gfn)
 {
     policy_handle_paged_in(gfn, 1);
 }
 
-void policy_notify_paged_in_nomru(unsigned long gfn)
+static void default_notify_paged_in_nomru(unsigned long gfn)
 {
     policy_handle_paged_in(gfn, 0);
 }
 
-void policy_notify_dropped(unsigned long gfn)
+static void default_notify_dropped(unsigned long gfn)
 {
     clear_bit(gfn, bitmap);
 }
 
+const struct xenpaging_policy policy_default = {
+    .name                  = "default",
+    .desc                  = "clock over gfns, sparing recently paged-in ones",
+    .init                  = default_init,
+    .choose_victim         = default_choose_victim,
+    .notify_paged_out      = default_notify_paged_out,
+    .notify_paged_in       = default_notify_paged_in,
+    .notify_paged_in_nomru = default_notify_paged_in_nomru,
+    .notify_dropped        = default_notify_dropped,
+};
+
 
 /*
  * Local variables:
@@ -35,6 +35,9 @@
 #include "policy.h"
 #include "xenpaging.h"
 
+/* Neighbouring gfns paged in along with a faulting one, at most */
+#define DEFAULT_READAHEAD 8
+
 /* Defines number of mfns a guest should use at a time, in KiB */
 #define WATCH_TARGETPAGES "memory/target-tot_pages"
 static char *watch_target_tot_pages;
@@ -208,20 +211,27 @@ static void usage(void)
     printf(" -f <file>      --pagefile=<file>        pagefile to use. This option is required.\n");
     printf(" -m <max_memkb> --max_memkb=<max_memkb>  maximum amount of memory to handle.\n");
     printf(" -r <num>       --mru_size=<num>         number of paged-in pages to keep in memory.\n");
+    printf(" -p <name>      --policy=<name>          paging policy (default: default).\n");
+    printf(" -a <num>       --readahead=<num>        max. gfns to page in along with a faulting one (default %d, max %d).\n",
+           DEFAULT_READAHEAD, XENPAGING_READAHEAD_MAX);
     printf(" -v             --verbose                enable debug output.\n");
     printf(" -h             --help                   this output.\n");
+    printf("\npolicies:\n");
+    policy_list(stdout);
 }
 
 static int xenpaging_getopts(struct xenpaging *paging, int argc, char *argv[])
 {
     int ch;
-    static const char sopts[] = "hvd:f:m:r:";
+    static const char sopts[] = "hvd:f:m:r:p:a:";
     static const struct option lopts[] = {
         {"help", 0, NULL, 'h'},
         {"verbose", 0, NULL, 'v'},
         {"domain", 1, NULL, 'd'},
         {"pagefile", 1, NULL, 'f'},
         {"mru_size", 1, NULL, 'm'},
+        {"policy", 1, NULL, 'p'},
+        {"readahead", 1, NULL, 'a'},
         { }
     };
 
@@ -242,6 +252,24 @@ static int xenpaging_getopts(struct xenpaging *paging, int argc, char *argv[])
         case 'r':
             paging->policy_mru_size = atoi(optarg);
             break;
+        case 'p':
+            if ( policy_select(optarg) )
+            {
+                printf("Unknown policy '%s'!\n", optarg);
+                usage();
+                return 1;
+            }
+            break;
+        case 'a':
+            paging->readahead = atoi(optarg);
+            if ( paging->readahead < 0 ||
+                 paging->readahead > XENPAGING_READAHEAD_MAX )
+            {
+                printf("Invalid readahead %s!\n", optarg);
+                usage();
+                return 1;
+            }
+            break;
         case 'v':
             paging->debug = 1;
             break;
@@ -287,6 +315,8 @@ static struct xenpaging *xenpaging_init(int argc, char *argv[])
     if ( !paging )
         goto err;
 
+    paging->readahead = DEFAULT_READAHEAD;
+
     /* Get cmdline options and domain_id */
     if ( xenpaging_getopts(paging, argc, argv) )
         goto err;
@@ -522,6 +552,11 @@ static void xenpaging_teardown(struct xenpaging *paging)
     xs_unwatch(paging->xs_handle, "@releaseDomain", watch_token);
 
     paging->xc_handle = NULL;
+
+    /* Stop the working set estimation the policy may have started */
+    if ( paging->wss_enabled )
+        xc_domain_wss_disable(xch, paging->vm_event.domain_id);
+
     /* Tear down domain paging in Xen */
     munmap(paging->vm_event.ring_page, PAGE_SIZE);
     rc = xc_mem_paging_disable(xch, paging->vm_event.domain_id);
@@ -553,6 +588,39 @@ static void xenpaging_teardown(struct xenpaging *paging)
     xc_interface_close(xch);
 }
 
+int policy_wss_enable(struct xenpaging *paging, unsigned int interval_ms)
+{
+    xc_interface *xch = paging->xc_handle;
+
+    if ( xc_domain_wss_enable(xch, paging->vm_event.domain_id,
+                              interval_ms, 0) == 0 )
+    {
+        paging->wss_enabled = 1;
+        return 0;
+    }
+
+    /* Already enabled by someone else is fine, too */
+    return errno == EBUSY ? 0 : -1;
+}
+
+int64_t policy_wss_get(struct xenpaging *paging, unsigned long gfn,
+                       unsigned long nr, uint8_t *ages)
+{
+    xc_interface *xch = paging->xc_handle;
+    xc_wss_info_t info;
+    uint64_t done = nr;
+
+    if ( xc_domain_wss_get(xch, paging->vm_event.domain_id, &info, gfn,
+                           &done, nr ? ages : NULL) )
+        return -1;
+
+    /* Gfns beyond those tracked */
+    if ( nr && done < nr )
+        memset(ages + done, XEN_DOMCTL_WSS_AGE_UNMAPPED, nr - done);
+
+    return info.scans;
+}
+
 static void get_request(struct vm_event *vm_event, vm_event_request_t *req)
 {
     vm_event_back_ring_t *back_ring;
@@ -666,7 +734,8 @@ static int xenpaging_evict_page(struct xenpaging *paging, unsigned long gfn, int
     return ret;
 }
 
-static int xenpaging_resume_page(struct xenpaging *paging, vm_event_response_t *rsp, int notify_policy)
+/* Put a response on the ring, leaving notifying Xen to the caller */
+static void xenpaging_resume_page(struct xenpaging *paging, vm_event_response_t *rsp, int notify_policy)
 {
     /* Put the page info on the ring */
     put_response(&paging->vm_event, rsp);
@@ -686,9 +755,6 @@ static int xenpaging_resume_page(struct xenpaging *paging, vm_event_response_t *
        /* Record number of resumed pages */
        paging->num_paged_out--;
     }
-
-    /* Tell Xen page is ready */
-    return xenevtchn_notify(paging->vm_event.xce_handle, paging->vm_event.port);
 }
 
 static int xenpaging_populate_page(struct xenpaging *paging, unsigned long gfn, int i)
@@ -732,6 +798,188 @@ static int xenpaging_populate_page(struct xenpaging *paging, unsigned long gfn,
     return ret;
 }
 
+/* Release a pagefile slot once its gfn got paged in (or dropped) */
+static void release_slot(struct xenpaging *paging, int slot)
+{
+    /* Clear this pagefile slot */
+    paging->slot_to_gfn[slot] = 0;
+
+    /* Record this free slot */
+    paging->free_slot_stack[paging->stack_count++] = slot;
+}
+
+/* Claim a paged out gfn for page-in, returning its pagefile slot */
+static int claim_gfn(struct xenpaging *paging, unsigned long gfn)
+{
+    xc_interface *xch = paging->xc_handle;
+    int slot;
+
+    if ( !test_and_clear_bit(gfn, paging->bitmap) )
+        return -1;
+
+    /* Find where in the paging file to read from */
+    slot = paging->gfn_to_slot[gfn];
+
+    /* Sanity check */
+    if ( paging->slot_to_gfn[slot] != gfn )
+    {
+        ERROR("Expected gfn %lx in slot %d, but found gfn %lx\n",
+              gfn, slot, paging->slot_to_gfn[slot]);
+        return -2;
+    }
+
+    return slot;
+}
+
+/*
+ * Handle a batch of page-in requests: gfns faulted on get paged in along
+ * with the following ones still paged out, more of them while faults are
+ * sequential, all of them get read from the pagefile at once, and Xen only
+ * gets notified once all responses are on the ring.
+ * Returns < 0 on fatal error, or the number of requests handled.
+ */
+static int handle_requests(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+    static vm_event_request_t reqs[XENPAGING_PAGEIN_BATCH];
+    static int paged[XENPAGING_PAGEIN_BATCH];
+    static unsigned long gfns[XENPAGING_PAGEIN_BATCH *
+                              (1 + XENPAGING_READAHEAD_MAX)];
+    static int slots[ARRAY_SIZE(gfns)];
+    static int ahead[ARRAY_SIZE(gfns)];
+    /* Readahead window, and where the next sequential fault would be */
+    static int window;
+    static unsigned long next_gfn;
+    vm_event_response_t rsp;
+    int i, j, slot, num = 0, nr_loads = 0, responses = 0;
+
+    while ( num < XENPAGING_PAGEIN_BATCH &&
+            RING_HAS_UNCONSUMED_REQUESTS(&paging->vm_event.back_ring) )
+    {
+        vm_event_request_t *req = &reqs[num++];
+        unsigned long gfn;
+
+        get_request(&paging->vm_event, req);
+        gfn = req->u.mem_paging.gfn;
+
+        if ( gfn > paging->max_pages )
+        {
+            ERROR("Requested gfn %lx higher than max_pages %x\n",
+                  gfn, paging->max_pages);
+            return -1;
+        }
+
+        /* Check if the page has already been paged in */
+        slot = claim_gfn(paging, gfn);
+        if ( slot < -1 )
+            return -1;
+        paged[num - 1] = slot >= 0;
+        if ( slot < 0 )
+            continue;
+
+        if ( req->u.mem_paging.flags & MEM_PAGING_DROP_PAGE )
+        {
+            DPRINTF("drop_page ^ gfn %lx pageslot %d\n", gfn, slot);
+            /* Notify policy of page being dropped */
+            policy_notify_dropped(gfn);
+            release_slot(paging, slot);
+            continue;
+        }
+
+        gfns[nr_loads] = gfn;
+        slots[nr_loads] = slot;
+        ahead[nr_loads++] = 0;
+
+        /* Grow the window while faults are sequential */
+        if ( gfn == next_gfn )
+            window = window ? window * 2 : 1;
+        else
+            window = 1;
+        if ( window > paging->readahead )
+            window = paging->readahead;
+        next_gfn = gfn + window + 1;
+
+        for ( j = 1; j <= window && gfn + j < paging->max_pages; j++ )
+        {
+            slot = claim_gfn(paging, gfn + j);
+            if ( slot < -1 )
+                return -1;
+            if ( slot < 0 )
+                continue;
+
+            gfns[nr_loads] = gfn + j;
+            slots[nr_loads] = slot;
+            ahead[nr_loads++] = 1;
+        }
+    }
+
+    /* Have the pagefile reads all in flight at once */
+    prefetch_pages(paging->fd, slots, nr_loads);
+
+    for ( i = 0; i < nr_loads; i++ )
+    {
+        /* Populate the page */
+        if ( xenpaging_populate_page(paging, gfns[i], slots[i]) < 0 )
+        {
+            ERROR("Error populating page %lx", gfns[i]);
+            return -1;
+        }
+
+        release_slot(paging, slots[i]);
+
+        /* Pages faulted on get accounted for with their responses */
+        if ( ahead[i] )
+        {
+            DPRINTF("readahead < gfn %lx pageslot %d\n", gfns[i], slots[i]);
+            policy_notify_paged_in_nomru(gfns[i]);
+            paging->num_paged_out--;
+        }
+    }
+
+    for ( i = 0; i < num; i++ )
+    {
+        vm_event_request_t *req = &reqs[i];
+
+        /* Prepare the response */
+        rsp.u.mem_paging.gfn = req->u.mem_paging.gfn;
+        rsp.vcpu_id = req->vcpu_id;
+        rsp.flags = req->flags;
+
+        if ( paged[i] )
+        {
+            xenpaging_resume_page(paging, &rsp, 1);
+            responses++;
+            continue;
+        }
+
+        DPRINTF("page %s populated (domain = %d; vcpu = %d;"
+                " gfn = %"PRIx64"; paused = %d; evict_fail = %d)\n",
+                req->u.mem_paging.flags & MEM_PAGING_EVICT_FAIL ? "not" : "already",
+                paging->vm_event.domain_id, req->vcpu_id, req->u.mem_paging.gfn,
+                !!(req->flags & VM_EVENT_FLAG_VCPU_PAUSED) ,
+                !!(req->u.mem_paging.flags & MEM_PAGING_EVICT_FAIL) );
+
+        /* Tell Xen to resume the vcpu */
+        if (( req->flags & VM_EVENT_FLAG_VCPU_PAUSED ) ||
+            ( req->u.mem_paging.flags & MEM_PAGING_EVICT_FAIL ))
+        {
+            xenpaging_resume_page(paging, &rsp, 0);
+            responses++;
+        }
+    }
+
+    /* Tell Xen pages are ready */
+    if ( responses &&
+         xenevtchn_notify(paging->vm_event.xce_handle,
+                          paging->vm_event.port) < 0 )
+    {
+        PERROR("Error resuming pages");
+        return -1;
+    }
+
+    return num;
+}
+
 /* Trigger a page-in for a batch of pages */
 static void resume_pages(struct xenpaging *paging, int num_pages)
 {
@@ -852,10 +1100,7 @@ int main(int argc, char *argv[])
 {
     struct sigaction act;
     struct xenpaging *paging;
-    vm_event_request_t req;
-    vm_event_response_t rsp;
     int num, prev_num = 0;
-    int slot;
     int tot_pages;
     int rc;
     xc_interface *xch;
@@ -904,88 +1149,8 @@ int main(int argc, char *argv[])
             /* Indicate possible error */
             rc = 1;
 
-            get_request(&paging->vm_event, &req);
-
-            if ( req.u.mem_paging.gfn > paging->max_pages )
-            {
-                ERROR("Requested gfn %"PRIx64" higher than max_pages %x\n",
-                      req.u.mem_paging.gfn, paging->max_pages);
+            if ( handle_requests(paging) < 0 )
                 goto out;
-            }
-
-            /* Check if the page has already been paged in */
-            if ( test_and_clear_bit(req.u.mem_paging.gfn, paging->bitmap) )
-            {
-                /* Find where in the paging file to read from */
-                slot = paging->gfn_to_slot[req.u.mem_paging.gfn];
-
-                /* Sanity check */
-                if ( paging->slot_to_gfn[slot] != req.u.mem_paging.gfn )
-                {
-                    ERROR("Expected gfn %"PRIx64" in slot %d, but found gfn %lx\n",
-                          req.u.mem_paging.gfn, slot, paging->slot_to_gfn[slot]);
-                    goto out;
-                }
-
-                if ( req.u.mem_paging.flags & MEM_PAGING_DROP_PAGE )
-                {
-                    DPRINTF("drop_page ^ gfn %"PRIx64" pageslot %d\n",
-                            req.u.mem_paging.gfn, slot);
-                    /* Notify policy of page being dropped */
-                    policy_notify_dropped(req.u.mem_paging.gfn);
-                }
-                else
-                {
-                    /* Populate the page */
-                    if ( xenpaging_populate_page(paging, req.u.mem_paging.gfn, slot) < 0 )
-                    {
-                        ERROR("Error populating page %"PRIx64"", req.u.mem_paging.gfn);
-                        goto out;
-                    }
-                }
-
-                /* Prepare the response */
-                rsp.u.mem_paging.gfn = req.u.mem_paging.gfn;
-                rsp.vcpu_id = req.vcpu_id;
-                rsp.flags = req.flags;
-
-                if ( xenpaging_resume_page(paging, &rsp, 1) < 0 )
-                {
-                    PERROR("Error resuming page %"PRIx64"", req.u.mem_paging.gfn);
-                    goto out;
-                }
-
-                /* Clear this pagefile slot */
-                paging->slot_to_gfn[slot] = 0;
-
-                /* Record this free slot */
-                paging->free_slot_stack[paging->stack_count++] = slot;
-            }
-            else
-            {
-                DPRINTF("page %s populated (domain = %d; vcpu = %d;"
-                        " gfn = %"PRIx64"; paused = %d; evict_fail = %d)\n",
-                        req.u.mem_paging.flags & MEM_PAGING_EVICT_FAIL ? "not" : "already",
-                        paging->vm_event.domain_id, req.vcpu_id, req.u.mem_paging.gfn,
-                        !!(req.flags & VM_EVENT_FLAG_VCPU_PAUSED) ,
-                        !!(req.u.mem_paging.flags & MEM_PAGING_EVICT_FAIL) );
-
-                /* Tell Xen to resume the vcpu */
-                if (( req.flags & VM_EVENT_FLAG_VCPU_PAUSED ) ||
-                    ( req.u.mem_paging.flags & MEM_PAGING_EVICT_FAIL ))
-                {
-                    /* Prepare the response */
-                    rsp.u.mem_paging.gfn = req.u.mem_paging.gfn;
-                    rsp.vcpu_id = req.vcpu_id;
-                    rsp.flags = req.flags;
-
-                    if ( xenpaging_resume_page(paging, &rsp, 0) < 0 )
-                    {
-                        PERROR("Error resuming page %"PRIx64"", req.u.mem_paging.gfn);
-                        goto out;
-                    }
-                }
-            }
         }
 
         /* If interrupted, write all pages back into the guest */
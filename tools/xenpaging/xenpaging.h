@@ -32,6 +32,9 @@
 #include <xen/vm_event.h>
 
 #define XENPAGING_PAGEIN_QUEUE_SIZE 64
+/* Page-in requests handled at a time, and gfns read ahead per request. */
+#define XENPAGING_PAGEIN_BATCH      64
+#define XENPAGING_READAHEAD_MAX     32
 
 struct vm_event {
     domid_t domain_id;
@@ -60,6 +63,8 @@ struct xenpaging {
     int num_paged_out;
     int target_tot_pages;
     int policy_mru_size;
+    int readahead;
+    int wss_enabled;
     int use_poll_timeout;
     int debug;
     int stack_count;
@@ -282,6 +282,14 @@ struct cmd_spec cmd_table[] = {
       "-b BUDGET, --budget=BUDGET     Budget (us)\n"
       "-e Extratime, --extratime=Extratime Extratime (1=yes, 0=no)\n"
     },
+    { "sched-stats",
+      &main_sched_stats, 0, 1,
+      "Show or control per-CPU scheduler overhead accounting",
+      "[-e|-d] [-r]",
+      "-e, --enable                   Enable accounting\n"
+      "-d, --disable                  Disable accounting\n"
+      "-r, --reset                    Reset all counters"
+    },
     { "domid",
       &main_domid, 0, 0,
       "Convert a domain name to domain id",
@@ -923,6 +923,93 @@ out:
     return r;
 }
 
+static uint64_t sched_stats_avg(uint64_t time, uint64_t count)
+{
+    return count ? time / count : 0;
+}
+
+int main_sched_stats(int argc, char **argv)
+{
+    libxl_sched_stats *stats;
+    int opt, i, nr;
+    bool enabled;
+    bool opt_e = false, opt_d = false, opt_r = false;
+    static struct option opts[] = {
+        {"enable", 0, 0, 'e'},
+        {"disable", 0, 0, 'd'},
+        {"reset", 0, 0, 'r'},
+        COMMON_LONG_OPTS
+    };
+
+    SWITCH_FOREACH_OPT(opt, "edr", opts, "sched-stats", 0) {
+    case 'e':
+        opt_e = true;
+        break;
+    case 'd':
+        opt_d = true;
+        break;
+    case 'r':
+        opt_r = true;
+        break;
+    }
+
+    if (opt_e && opt_d) {
+        fprintf(stderr, "Cannot both enable and disable accounting.\n");
+        return EXIT_FAILURE;
+    }
+
+    if ((opt_e || opt_d) && libxl_sched_stats_enable(ctx, opt_e)) {
+        fprintf(stderr, "Failed to %s scheduler accounting.\n",
+                opt_e ? "enable" : "disable");
+        return EXIT_FAILURE;
+    }
+
+    if (opt_r && libxl_sched_stats_reset(ctx)) {
+        fprintf(stderr, "Failed to reset scheduler accounting.\n");
+        return EXIT_FAILURE;
+    }
+
+    if (opt_e || opt_d || opt_r)
+        return EXIT_SUCCESS;
+
+    stats = libxl_get_sched_stats(ctx, &nr, &enabled);
+    if (stats == NULL) {
+        fprintf(stderr, "libxl_get_sched_stats failed.\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Scheduler accounting: %s (average times in ns)\n",
+           enabled ? "enabled" : "disabled");
+    printf("%4s %4s %10s %8s %10s %8s %10s %8s %10s %10s %8s %10s %8s\n",
+           "CPU", "Pool", "sched", "avg", "ctxsw", "avg",
+           "lock", "avg", "max", "wake", "avg", "sleep", "avg");
+    for (i = 0; i < nr; i++) {
+        if (stats[i].cpupool == LIBXL_SCHED_STATS_NO_CPUPOOL)
+            printf("%4d %4s", i, "-");
+        else
+            printf("%4d %4u", i, stats[i].cpupool);
+
+        printf(" %10"PRIu64" %8"PRIu64" %10"PRIu64" %8"PRIu64
+               " %10"PRIu64" %8"PRIu64" %10"PRIu64
+               " %10"PRIu64" %8"PRIu64" %10"PRIu64" %8"PRIu64"\n",
+               stats[i].schedule_count,
+               sched_stats_avg(stats[i].schedule_time,
+                               stats[i].schedule_count),
+               stats[i].ctxsw_count,
+               sched_stats_avg(stats[i].ctxsw_time, stats[i].ctxsw_count),
+               stats[i].lock_count,
+               sched_stats_avg(stats[i].lock_wait_time, stats[i].lock_count),
+               stats[i].lock_wait_max,
+               stats[i].wake_count,
+               sched_stats_avg(stats[i].wake_time, stats[i].wake_count),
+               stats[i].sleep_count,
+               sched_stats_avg(stats[i].sleep_time, stats[i].sleep_count));
+    }
+
+    libxl_sched_stats_list_free(stats, nr);
+    return EXIT_SUCCESS;
+}
+
 /*
  * Local variables:
  * mode: C
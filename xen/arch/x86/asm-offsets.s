@@ -0,0 +1,2259 @@
+	.file	"asm-offsets.c"
+	.text
+.Ltext0:
+	.cfi_sections	.debug_frame
+	.file 0 "/root/repo/xen/arch/x86" "x86_64/asm-offsets.c"
+#APP
+	.equ X86_FEATURE_FPU, 0*32+ 0
+	.equ X86_FEATURE_VME, 0*32+ 1
+	.equ X86_FEATURE_DE, 0*32+ 2
+	.equ X86_FEATURE_PSE, 0*32+ 3
+	.equ X86_FEATURE_TSC, 0*32+ 4
+	.equ X86_FEATURE_MSR, 0*32+ 5
+	.equ X86_FEATURE_PAE, 0*32+ 6
+	.equ X86_FEATURE_MCE, 0*32+ 7
+	.equ X86_FEATURE_CX8, 0*32+ 8
+	.equ X86_FEATURE_APIC, 0*32+ 9
+	.equ X86_FEATURE_SEP, 0*32+11
+	.equ X86_FEATURE_MTRR, 0*32+12
+	.equ X86_FEATURE_PGE, 0*32+13
+	.equ X86_FEATURE_MCA, 0*32+14
+	.equ X86_FEATURE_CMOV, 0*32+15
+	.equ X86_FEATURE_PAT, 0*32+16
+	.equ X86_FEATURE_PSE36, 0*32+17
+	.equ X86_FEATURE_CLFLUSH, 0*32+19
+	.equ X86_FEATURE_DS, 0*32+21
+	.equ X86_FEATURE_ACPI, 0*32+22
+	.equ X86_FEATURE_MMX, 0*32+23
+	.equ X86_FEATURE_FXSR, 0*32+24
+	.equ X86_FEATURE_SSE, 0*32+25
+	.equ X86_FEATURE_SSE2, 0*32+26
+	.equ X86_FEATURE_SS, 0*32+27
+	.equ X86_FEATURE_HTT, 0*32+28
+	.equ X86_FEATURE_TM1, 0*32+29
+	.equ X86_FEATURE_PBE, 0*32+31
+	.equ X86_FEATURE_SSE3, 1*32+ 0
+	.equ X86_FEATURE_PCLMULQDQ, 1*32+ 1
+	.equ X86_FEATURE_DTES64, 1*32+ 2
+	.equ X86_FEATURE_MONITOR, 1*32+ 3
+	.equ X86_FEATURE_DSCPL, 1*32+ 4
+	.equ X86_FEATURE_VMX, 1*32+ 5
+	.equ X86_FEATURE_SMX, 1*32+ 6
+	.equ X86_FEATURE_EIST, 1*32+ 7
+	.equ X86_FEATURE_TM2, 1*32+ 8
+	.equ X86_FEATURE_SSSE3, 1*32+ 9
+	.equ X86_FEATURE_FMA, 1*32+12
+	.equ X86_FEATURE_CX16, 1*32+13
+	.equ X86_FEATURE_XTPR, 1*32+14
+	.equ X86_FEATURE_PDCM, 1*32+15
+	.equ X86_FEATURE_PCID, 1*32+17
+	.equ X86_FEATURE_DCA, 1*32+18
+	.equ X86_FEATURE_SSE4_1, 1*32+19
+	.equ X86_FEATURE_SSE4_2, 1*32+20
+	.equ X86_FEATURE_X2APIC, 1*32+21
+	.equ X86_FEATURE_MOVBE, 1*32+22
+	.equ X86_FEATURE_POPCNT, 1*32+23
+	.equ X86_FEATURE_TSC_DEADLINE, 1*32+24
+	.equ X86_FEATURE_AESNI, 1*32+25
+	.equ X86_FEATURE_XSAVE, 1*32+26
+	.equ X86_FEATURE_OSXSAVE, 1*32+27
+	.equ X86_FEATURE_AVX, 1*32+28
+	.equ X86_FEATURE_F16C, 1*32+29
+	.equ X86_FEATURE_RDRAND, 1*32+30
+	.equ X86_FEATURE_HYPERVISOR, 1*32+31
+	.equ X86_FEATURE_SYSCALL, 2*32+11
+	.equ X86_FEATURE_NX, 2*32+20
+	.equ X86_FEATURE_MMXEXT, 2*32+22
+	.equ X86_FEATURE_FFXSR, 2*32+25
+	.equ X86_FEATURE_PAGE1GB, 2*32+26
+	.equ X86_FEATURE_RDTSCP, 2*32+27
+	.equ X86_FEATURE_LM, 2*32+29
+	.equ X86_FEATURE_3DNOWEXT, 2*32+30
+	.equ X86_FEATURE_3DNOW, 2*32+31
+	.equ X86_FEATURE_LAHF_LM, 3*32+ 0
+	.equ X86_FEATURE_CMP_LEGACY, 3*32+ 1
+	.equ X86_FEATURE_SVM, 3*32+ 2
+	.equ X86_FEATURE_EXTAPIC, 3*32+ 3
+	.equ X86_FEATURE_CR8_LEGACY, 3*32+ 4
+	.equ X86_FEATURE_ABM, 3*32+ 5
+	.equ X86_FEATURE_SSE4A, 3*32+ 6
+	.equ X86_FEATURE_MISALIGNSSE, 3*32+ 7
+	.equ X86_FEATURE_3DNOWPREFETCH, 3*32+ 8
+	.equ X86_FEATURE_OSVW, 3*32+ 9
+	.equ X86_FEATURE_IBS, 3*32+10
+	.equ X86_FEATURE_XOP, 3*32+11
+	.equ X86_FEATURE_SKINIT, 3*32+12
+	.equ X86_FEATURE_WDT, 3*32+13
+	.equ X86_FEATURE_LWP, 3*32+15
+	.equ X86_FEATURE_FMA4, 3*32+16
+	.equ X86_FEATURE_NODEID_MSR, 3*32+19
+	.equ X86_FEATURE_TBM, 3*32+21
+	.equ X86_FEATURE_TOPOEXT, 3*32+22
+	.equ X86_FEATURE_DBEXT, 3*32+26
+	.equ X86_FEATURE_MONITORX, 3*32+29
+	.equ X86_FEATURE_XSAVEOPT, 4*32+ 0
+	.equ X86_FEATURE_XSAVEC, 4*32+ 1
+	.equ X86_FEATURE_XGETBV1, 4*32+ 2
+	.equ X86_FEATURE_XSAVES, 4*32+ 3
+	.equ X86_FEATURE_FSGSBASE, 5*32+ 0
+	.equ X86_FEATURE_TSC_ADJUST, 5*32+ 1
+	.equ X86_FEATURE_SGX, 5*32+ 2
+	.equ X86_FEATURE_BMI1, 5*32+ 3
+	.equ X86_FEATURE_HLE, 5*32+ 4
+	.equ X86_FEATURE_AVX2, 5*32+ 5
+	.equ X86_FEATURE_FDP_EXCP_ONLY, 5*32+ 6
+	.equ X86_FEATURE_SMEP, 5*32+ 7
+	.equ X86_FEATURE_BMI2, 5*32+ 8
+	.equ X86_FEATURE_ERMS, 5*32+ 9
+	.equ X86_FEATURE_INVPCID, 5*32+10
+	.equ X86_FEATURE_RTM, 5*32+11
+	.equ X86_FEATURE_PQM, 5*32+12
+	.equ X86_FEATURE_NO_FPU_SEL, 5*32+13
+	.equ X86_FEATURE_MPX, 5*32+14
+	.equ X86_FEATURE_PQE, 5*32+15
+	.equ X86_FEATURE_AVX512F, 5*32+16
+	.equ X86_FEATURE_AVX512DQ, 5*32+17
+	.equ X86_FEATURE_RDSEED, 5*32+18
+	.equ X86_FEATURE_ADX, 5*32+19
+	.equ X86_FEATURE_SMAP, 5*32+20
+	.equ X86_FEATURE_AVX512IFMA, 5*32+21
+	.equ X86_FEATURE_CLFLUSHOPT, 5*32+23
+	.equ X86_FEATURE_CLWB, 5*32+24
+	.equ X86_FEATURE_AVX512PF, 5*32+26
+	.equ X86_FEATURE_AVX512ER, 5*32+27
+	.equ X86_FEATURE_AVX512CD, 5*32+28
+	.equ X86_FEATURE_SHA, 5*32+29
+	.equ X86_FEATURE_AVX512BW, 5*32+30
+	.equ X86_FEATURE_AVX512VL, 5*32+31
+	.equ X86_FEATURE_PREFETCHWT1, 6*32+ 0
+	.equ X86_FEATURE_AVX512VBMI, 6*32+ 1
+	.equ X86_FEATURE_UMIP, 6*32+ 2
+	.equ X86_FEATURE_PKU, 6*32+ 3
+	.equ X86_FEATURE_OSPKE, 6*32+ 4
+	.equ X86_FEATURE_AVX512_VPOPCNTDQ, 6*32+14
+	.equ X86_FEATURE_RDPID, 6*32+22
+	.equ X86_FEATURE_ITSC, 7*32+ 8
+	.equ X86_FEATURE_EFRO, 7*32+10
+	.equ X86_FEATURE_CLZERO, 8*32+ 0
+	.equ X86_FEATURE_IBPB, 8*32+12
+	.equ X86_FEATURE_AVX512_4VNNIW, 9*32+ 2
+	.equ X86_FEATURE_AVX512_4FMAPS, 9*32+ 3
+	.equ X86_FEATURE_IBRSB, 9*32+26
+	.equ X86_FEATURE_STIBP, 9*32+27
+	.equ X86_FEATURE_ARCH_CAPS, 9*32+29
+	.equ X86_FEATURE_SSBD, 9*32+31
+	.equ X86_FEATURE_CONSTANT_TSC, (10+0)*32+ 0
+	.equ X86_FEATURE_NONSTOP_TSC, (10+0)*32+ 1
+	.equ X86_FEATURE_ARAT, (10+0)*32+ 2
+	.equ X86_FEATURE_ARCH_PERFMON, (10+0)*32+ 3
+	.equ X86_FEATURE_TSC_RELIABLE, (10+0)*32+ 4
+	.equ X86_FEATURE_XTOPOLOGY, (10+0)*32+ 5
+	.equ X86_FEATURE_CPUID_FAULTING, (10+0)*32+ 6
+	.equ X86_FEATURE_CLFLUSH_MONITOR, (10+0)*32+ 7
+	.equ X86_FEATURE_APERFMPERF, (10+0)*32+ 8
+	.equ X86_FEATURE_MFENCE_RDTSC, (10+0)*32+ 9
+	.equ X86_FEATURE_XEN_SMEP, (10+0)*32+10
+	.equ X86_FEATURE_XEN_SMAP, (10+0)*32+11
+	.equ X86_FEATURE_LFENCE_DISPATCH, (10+0)*32+12
+	.equ X86_FEATURE_IND_THUNK_LFENCE, (10+0)*32+13
+	.equ X86_FEATURE_IND_THUNK_JMP, (10+0)*32+14
+	.equ X86_FEATURE_XEN_IBPB, (10+0)*32+15
+	.equ X86_FEATURE_SC_MSR_PV, (10+0)*32+16
+	.equ X86_FEATURE_SC_MSR_HVM, (10+0)*32+17
+	.equ X86_FEATURE_SC_RSB_PV, (10+0)*32+18
+	.equ X86_FEATURE_SC_RSB_HVM, (10+0)*32+19
+	.equ X86_FEATURE_NO_XPTI, (10+0)*32+20
+	.equ X86_FEATURE_SC_MSR_IDLE, (10+0)*32+21
+	.equ CONFIG_INDIRECT_THUNK, 1
+	.include "asm/indirect_thunk_asm.h"
+#NO_APP
+	.globl	__dummy__
+	.hidden	__dummy__
+	.type	__dummy__, @function
+__dummy__:
+.LFB558:
+	.file 1 "x86_64/asm-offsets.c"
+	.loc 1 26 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU1
+#APP
+# 27 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r15 $0 /* offsetof(struct cpu_user_regs, r15) */<=="
+# 0 "" 2
+	.loc 1 27 49 view .LVU2
+	.loc 1 28 5 view .LVU3
+# 28 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r14 $8 /* offsetof(struct cpu_user_regs, r14) */<=="
+# 0 "" 2
+	.loc 1 28 49 view .LVU4
+	.loc 1 29 5 view .LVU5
+# 29 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r13 $16 /* offsetof(struct cpu_user_regs, r13) */<=="
+# 0 "" 2
+	.loc 1 29 49 view .LVU6
+	.loc 1 30 5 view .LVU7
+# 30 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r12 $24 /* offsetof(struct cpu_user_regs, r12) */<=="
+# 0 "" 2
+	.loc 1 30 49 view .LVU8
+	.loc 1 31 5 view .LVU9
+# 31 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rbp $32 /* offsetof(struct cpu_user_regs, rbp) */<=="
+# 0 "" 2
+	.loc 1 31 49 view .LVU10
+	.loc 1 32 5 view .LVU11
+# 32 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rbx $40 /* offsetof(struct cpu_user_regs, rbx) */<=="
+# 0 "" 2
+	.loc 1 32 49 view .LVU12
+	.loc 1 33 5 view .LVU13
+# 33 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r11 $48 /* offsetof(struct cpu_user_regs, r11) */<=="
+# 0 "" 2
+	.loc 1 33 49 view .LVU14
+	.loc 1 34 5 view .LVU15
+# 34 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r10 $56 /* offsetof(struct cpu_user_regs, r10) */<=="
+# 0 "" 2
+	.loc 1 34 49 view .LVU16
+	.loc 1 35 5 view .LVU17
+# 35 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r9 $64 /* offsetof(struct cpu_user_regs, r9) */<=="
+# 0 "" 2
+	.loc 1 35 47 view .LVU18
+	.loc 1 36 5 view .LVU19
+# 36 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r8 $72 /* offsetof(struct cpu_user_regs, r8) */<=="
+# 0 "" 2
+	.loc 1 36 47 view .LVU20
+	.loc 1 37 5 view .LVU21
+# 37 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rax $80 /* offsetof(struct cpu_user_regs, rax) */<=="
+# 0 "" 2
+	.loc 1 37 49 view .LVU22
+	.loc 1 38 5 view .LVU23
+# 38 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rcx $88 /* offsetof(struct cpu_user_regs, rcx) */<=="
+# 0 "" 2
+	.loc 1 38 49 view .LVU24
+	.loc 1 39 5 view .LVU25
+# 39 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rdx $96 /* offsetof(struct cpu_user_regs, rdx) */<=="
+# 0 "" 2
+	.loc 1 39 49 view .LVU26
+	.loc 1 40 5 view .LVU27
+# 40 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rsi $104 /* offsetof(struct cpu_user_regs, rsi) */<=="
+# 0 "" 2
+	.loc 1 40 49 view .LVU28
+	.loc 1 41 5 view .LVU29
+# 41 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rdi $112 /* offsetof(struct cpu_user_regs, rdi) */<=="
+# 0 "" 2
+	.loc 1 41 49 view .LVU30
+	.loc 1 42 5 view .LVU31
+# 42 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_error_code $120 /* offsetof(struct cpu_user_regs, error_code) */<=="
+# 0 "" 2
+	.loc 1 42 63 view .LVU32
+	.loc 1 43 5 view .LVU33
+# 43 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_entry_vector $124 /* offsetof(struct cpu_user_regs, entry_vector) */<=="
+# 0 "" 2
+	.loc 1 43 67 view .LVU34
+	.loc 1 44 5 view .LVU35
+# 44 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_saved_upcall_mask $140 /* offsetof(struct cpu_user_regs, saved_upcall_mask) */<=="
+# 0 "" 2
+	.loc 1 44 77 view .LVU36
+	.loc 1 45 5 view .LVU37
+# 45 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rip $128 /* offsetof(struct cpu_user_regs, rip) */<=="
+# 0 "" 2
+	.loc 1 45 49 view .LVU38
+	.loc 1 46 5 view .LVU39
+# 46 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_cs $136 /* offsetof(struct cpu_user_regs, cs) */<=="
+# 0 "" 2
+	.loc 1 46 47 view .LVU40
+	.loc 1 47 5 view .LVU41
+# 47 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_eflags $144 /* offsetof(struct cpu_user_regs, rflags) */<=="
+# 0 "" 2
+	.loc 1 47 55 view .LVU42
+	.loc 1 48 5 view .LVU43
+# 48 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rsp $152 /* offsetof(struct cpu_user_regs, rsp) */<=="
+# 0 "" 2
+	.loc 1 48 49 view .LVU44
+	.loc 1 49 5 view .LVU45
+# 49 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_ss $160 /* offsetof(struct cpu_user_regs, ss) */<=="
+# 0 "" 2
+	.loc 1 49 47 view .LVU46
+	.loc 1 50 5 view .LVU47
+# 50 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_ds $176 /* offsetof(struct cpu_user_regs, ds) */<=="
+# 0 "" 2
+	.loc 1 50 47 view .LVU48
+	.loc 1 51 5 view .LVU49
+# 51 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_es $168 /* offsetof(struct cpu_user_regs, es) */<=="
+# 0 "" 2
+	.loc 1 51 47 view .LVU50
+	.loc 1 52 5 view .LVU51
+# 52 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_fs $184 /* offsetof(struct cpu_user_regs, fs) */<=="
+# 0 "" 2
+	.loc 1 52 47 view .LVU52
+	.loc 1 53 5 view .LVU53
+# 53 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_gs $192 /* offsetof(struct cpu_user_regs, gs) */<=="
+# 0 "" 2
+	.loc 1 53 47 view .LVU54
+	.loc 1 54 5 view .LVU55
+# 54 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_kernel_sizeof $168 /* offsetof(struct cpu_user_regs, es) */<=="
+# 0 "" 2
+	.loc 1 54 58 view .LVU56
+	.loc 1 55 5 view .LVU57
+# 55 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_user_sizeof $200 /* sizeof(struct cpu_user_regs) */<=="
+# 0 "" 2
+	.loc 1 56 5 view .LVU58
+# 56 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 58 5 view .LVU59
+# 58 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define irq_caps_offset $424 /* offsetof(struct domain, irq_caps) */<=="
+# 0 "" 2
+	.loc 1 58 53 view .LVU60
+	.loc 1 59 5 view .LVU61
+# 59 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define next_in_list_offset $112 /* offsetof(struct domain, next_in_list) */<=="
+# 0 "" 2
+	.loc 1 59 61 view .LVU62
+	.loc 1 60 5 view .LVU63
+# 60 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_processor $4 /* offsetof(struct vcpu, processor) */<=="
+# 0 "" 2
+	.loc 1 60 51 view .LVU64
+	.loc 1 61 5 view .LVU65
+# 61 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_domain $16 /* offsetof(struct vcpu, domain) */<=="
+# 0 "" 2
+	.loc 1 61 45 view .LVU66
+	.loc 1 62 5 view .LVU67
+# 62 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vcpu_info $8 /* offsetof(struct vcpu, vcpu_info) */<=="
+# 0 "" 2
+	.loc 1 62 51 view .LVU68
+	.loc 1 63 5 view .LVU69
+# 63 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_trap_bounce $1448 /* offsetof(struct vcpu, arch.pv_vcpu.trap_bounce) */<=="
+# 0 "" 2
+	.loc 1 63 68 view .LVU70
+	.loc 1 64 5 view .LVU71
+# 64 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_thread_flags $920 /* offsetof(struct vcpu, arch.flags) */<=="
+# 0 "" 2
+	.loc 1 64 55 view .LVU72
+	.loc 1 65 5 view .LVU73
+# 65 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_event_addr $1376 /* offsetof(struct vcpu, arch.pv_vcpu.event_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 65 74 view .LVU74
+	.loc 1 66 5 view .LVU75
+# 66 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_event_sel $1392 /* offsetof(struct vcpu, arch.pv_vcpu.event_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 66 72 view .LVU76
+	.loc 1 67 5 view .LVU77
+# 67 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_failsafe_addr $1384 /* offsetof(struct vcpu, arch.pv_vcpu.failsafe_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 68 47 view .LVU78
+	.loc 1 69 5 view .LVU79
+# 69 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_failsafe_sel $1396 /* offsetof(struct vcpu, arch.pv_vcpu.failsafe_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 70 46 view .LVU80
+	.loc 1 71 5 view .LVU81
+# 71 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall_addr $1392 /* offsetof(struct vcpu, arch.pv_vcpu.syscall_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 72 46 view .LVU82
+	.loc 1 73 5 view .LVU83
+# 73 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_addr $1400 /* offsetof(struct vcpu, arch.pv_vcpu.syscall32_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 74 48 view .LVU84
+	.loc 1 75 5 view .LVU85
+# 75 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_sel $1416 /* offsetof(struct vcpu, arch.pv_vcpu.syscall32_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 76 47 view .LVU86
+	.loc 1 77 5 view .LVU87
+# 77 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_disables_events $1420 /* offsetof(struct vcpu, arch.pv_vcpu.syscall32_disables_events) */<=="
+# 0 "" 2
+	.loc 1 78 51 view .LVU88
+	.loc 1 79 5 view .LVU89
+# 79 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_addr $1408 /* offsetof(struct vcpu, arch.pv_vcpu.sysenter_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 80 47 view .LVU90
+	.loc 1 81 5 view .LVU91
+# 81 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_sel $1418 /* offsetof(struct vcpu, arch.pv_vcpu.sysenter_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 82 46 view .LVU92
+	.loc 1 83 5 view .LVU93
+# 83 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_disables_events $1421 /* offsetof(struct vcpu, arch.pv_vcpu.sysenter_disables_events) */<=="
+# 0 "" 2
+	.loc 1 84 50 view .LVU94
+	.loc 1 85 5 view .LVU95
+# 85 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_trap_ctxt $1160 /* offsetof(struct vcpu, arch.pv_vcpu.trap_ctxt) */<=="
+# 0 "" 2
+	.loc 1 85 64 view .LVU96
+	.loc 1 86 5 view .LVU97
+# 86 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_kernel_sp $1304 /* offsetof(struct vcpu, arch.pv_vcpu.kernel_sp) */<=="
+# 0 "" 2
+	.loc 1 86 64 view .LVU98
+	.loc 1 87 5 view .LVU99
+# 87 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_kernel_ss $1296 /* offsetof(struct vcpu, arch.pv_vcpu.kernel_ss) */<=="
+# 0 "" 2
+	.loc 1 87 64 view .LVU100
+	.loc 1 88 5 view .LVU101
+# 88 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_iopl $1476 /* offsetof(struct vcpu, arch.pv_vcpu.iopl) */<=="
+# 0 "" 2
+	.loc 1 88 54 view .LVU102
+	.loc 1 89 5 view .LVU103
+# 89 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_guest_context_flags $648 /* offsetof(struct vcpu, arch.vgc_flags) */<=="
+# 0 "" 2
+	.loc 1 89 66 view .LVU104
+	.loc 1 90 5 view .LVU105
+# 90 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_cr3 $3208 /* offsetof(struct vcpu, arch.cr3) */<=="
+# 0 "" 2
+	.loc 1 90 44 view .LVU106
+	.loc 1 91 5 view .LVU107
+# 91 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_arch_msr $4024 /* offsetof(struct vcpu, arch.msr) */<=="
+# 0 "" 2
+	.loc 1 91 49 view .LVU108
+	.loc 1 92 5 view .LVU109
+# 92 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nmi_pending $269 /* offsetof(struct vcpu, async_exception_state[(1)-1].pending) */<=="
+# 0 "" 2
+	.loc 1 92 55 view .LVU110
+	.loc 1 93 5 view .LVU111
+# 93 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_mce_pending $271 /* offsetof(struct vcpu, async_exception_state[(2)-1].pending) */<=="
+# 0 "" 2
+	.loc 1 93 55 view .LVU112
+	.loc 1 94 5 view .LVU113
+# 94 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nmi_old_mask $270 /* offsetof(struct vcpu, async_exception_state[(1)-1].old_mask) */<=="
+# 0 "" 2
+	.loc 1 94 63 view .LVU114
+	.loc 1 95 5 view .LVU115
+# 95 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_mce_old_mask $272 /* offsetof(struct vcpu, async_exception_state[(2)-1].old_mask) */<=="
+# 0 "" 2
+	.loc 1 95 63 view .LVU116
+	.loc 1 96 5 view .LVU117
+# 96 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_async_exception_mask $273 /* offsetof(struct vcpu, async_exception_mask) */<=="
+# 0 "" 2
+	.loc 1 96 73 view .LVU118
+	.loc 1 97 5 view .LVU119
+# 97 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_TRAP_NMI $1 /* VCPU_TRAP_NMI */<=="
+# 0 "" 2
+	.loc 1 98 5 view .LVU120
+# 98 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_TRAP_MCE $2 /* VCPU_TRAP_MCE */<=="
+# 0 "" 2
+	.loc 1 99 5 view .LVU121
+# 99 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define _VGCF_failsafe_disables_events $3 /* _VGCF_failsafe_disables_events */<=="
+# 0 "" 2
+	.loc 1 100 5 view .LVU122
+# 100 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define _VGCF_syscall_disables_events $4 /* _VGCF_syscall_disables_events */<=="
+# 0 "" 2
+	.loc 1 101 5 view .LVU123
+# 101 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 103 5 view .LVU124
+# 103 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_svm_vmcb_pa $1544 /* offsetof(struct vcpu, arch.hvm_vcpu.u.svm.vmcb_pa) */<=="
+# 0 "" 2
+	.loc 1 103 64 view .LVU125
+	.loc 1 104 5 view .LVU126
+# 104 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_svm_vmcb $1536 /* offsetof(struct vcpu, arch.hvm_vcpu.u.svm.vmcb) */<=="
+# 0 "" 2
+	.loc 1 104 58 view .LVU127
+	.loc 1 105 5 view .LVU128
+# 105 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 107 5 view .LVU129
+# 107 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_launched $1580 /* offsetof(struct vcpu, arch.hvm_vcpu.u.vmx.launched) */<=="
+# 0 "" 2
+	.loc 1 107 66 view .LVU130
+	.loc 1 108 5 view .LVU131
+# 108 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_realmode $1801 /* offsetof(struct vcpu, arch.hvm_vcpu.u.vmx.vmx_realmode) */<=="
+# 0 "" 2
+	.loc 1 108 70 view .LVU132
+	.loc 1 109 5 view .LVU133
+# 109 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_emulate $1802 /* offsetof(struct vcpu, arch.hvm_vcpu.u.vmx.vmx_emulate) */<=="
+# 0 "" 2
+	.loc 1 109 68 view .LVU134
+	.loc 1 110 5 view .LVU135
+# 110 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vm86_seg_mask $1804 /* offsetof(struct vcpu, arch.hvm_vcpu.u.vmx.vm86_segment_mask) */<=="
+# 0 "" 2
+	.loc 1 110 76 view .LVU136
+	.loc 1 111 5 view .LVU137
+# 111 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_hvm_guest_cr2 $1040 /* offsetof(struct vcpu, arch.hvm_vcpu.guest_cr[2]) */<=="
+# 0 "" 2
+	.loc 1 111 71 view .LVU138
+	.loc 1 112 5 view .LVU139
+# 112 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 114 5 view .LVU140
+# 114 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nhvm_guestmode $2024 /* offsetof(struct vcpu, arch.hvm_vcpu.nvcpu.nv_guestmode) */<=="
+# 0 "" 2
+	.loc 1 114 79 view .LVU141
+	.loc 1 115 5 view .LVU142
+# 115 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nhvm_p2m $2256 /* offsetof(struct vcpu, arch.hvm_vcpu.nvcpu.nv_p2m) */<=="
+# 0 "" 2
+	.loc 1 115 67 view .LVU143
+	.loc 1 116 5 view .LVU144
+# 116 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nsvm_hap_enabled $2212 /* offsetof(struct vcpu, arch.hvm_vcpu.nvcpu.u.nsvm.ns_hap_enabled) */<=="
+# 0 "" 2
+	.loc 1 116 90 view .LVU145
+	.loc 1 117 5 view .LVU146
+# 117 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 119 5 view .LVU147
+# 119 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define DOMAIN_is_32bit_pv $2240 /* offsetof(struct domain, arch.is_32bit_pv) */<=="
+# 0 "" 2
+	.loc 1 119 64 view .LVU148
+	.loc 1 120 5 view .LVU149
+# 120 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 122 5 view .LVU150
+# 122 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUINFO_upcall_pending $0 /* offsetof(struct vcpu_info, evtchn_upcall_pending) */<=="
+# 0 "" 2
+	.loc 1 122 77 view .LVU151
+	.loc 1 123 5 view .LVU152
+# 123 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUINFO_upcall_mask $1 /* offsetof(struct vcpu_info, evtchn_upcall_mask) */<=="
+# 0 "" 2
+	.loc 1 123 71 view .LVU153
+	.loc 1 124 5 view .LVU154
+# 124 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 126 5 view .LVU155
+# 126 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define COMPAT_VCPUINFO_upcall_pending $0 /* offsetof(struct compat_vcpu_info, evtchn_upcall_pending) */<=="
+# 0 "" 2
+	.loc 1 126 91 view .LVU156
+	.loc 1 127 5 view .LVU157
+# 127 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define COMPAT_VCPUINFO_upcall_mask $1 /* offsetof(struct compat_vcpu_info, evtchn_upcall_mask) */<=="
+# 0 "" 2
+	.loc 1 127 85 view .LVU158
+	.loc 1 128 5 view .LVU159
+# 128 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 130 5 view .LVU160
+# 130 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_guest_cpu_user_regs $0 /* offsetof(struct cpu_info, guest_cpu_user_regs) */<=="
+# 0 "" 2
+	.loc 1 130 78 view .LVU161
+	.loc 1 131 5 view .LVU162
+# 131 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_processor_id $200 /* offsetof(struct cpu_info, processor_id) */<=="
+# 0 "" 2
+	.loc 1 131 64 view .LVU163
+	.loc 1 132 5 view .LVU164
+# 132 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_current_vcpu $208 /* offsetof(struct cpu_info, current_vcpu) */<=="
+# 0 "" 2
+	.loc 1 132 64 view .LVU165
+	.loc 1 133 5 view .LVU166
+# 133 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_cr4 $224 /* offsetof(struct cpu_info, cr4) */<=="
+# 0 "" 2
+	.loc 1 133 46 view .LVU167
+	.loc 1 134 5 view .LVU168
+# 134 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_xen_cr3 $232 /* offsetof(struct cpu_info, xen_cr3) */<=="
+# 0 "" 2
+	.loc 1 134 54 view .LVU169
+	.loc 1 135 5 view .LVU170
+# 135 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_pv_cr3 $240 /* offsetof(struct cpu_info, pv_cr3) */<=="
+# 0 "" 2
+	.loc 1 135 52 view .LVU171
+	.loc 1 136 5 view .LVU172
+# 136 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_shadow_spec_ctrl $248 /* offsetof(struct cpu_info, shadow_spec_ctrl) */<=="
+# 0 "" 2
+	.loc 1 136 72 view .LVU173
+	.loc 1 137 5 view .LVU174
+# 137 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_xen_spec_ctrl $252 /* offsetof(struct cpu_info, xen_spec_ctrl) */<=="
+# 0 "" 2
+	.loc 1 137 66 view .LVU175
+	.loc 1 138 5 view .LVU176
+# 138 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_spec_ctrl_flags $253 /* offsetof(struct cpu_info, spec_ctrl_flags) */<=="
+# 0 "" 2
+	.loc 1 138 70 view .LVU177
+	.loc 1 139 5 view .LVU178
+# 139 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_root_pgt_changed $254 /* offsetof(struct cpu_info, root_pgt_changed) */<=="
+# 0 "" 2
+	.loc 1 139 72 view .LVU179
+	.loc 1 140 5 view .LVU180
+# 140 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_use_pv_cr3 $255 /* offsetof(struct cpu_info, use_pv_cr3) */<=="
+# 0 "" 2
+	.loc 1 140 60 view .LVU181
+	.loc 1 141 5 view .LVU182
+# 141 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_sizeof $264 /* sizeof(struct cpu_info) */<=="
+# 0 "" 2
+	.loc 1 142 5 view .LVU183
+# 142 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 144 5 view .LVU184
+# 144 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_eip $8 /* offsetof(struct trap_info, address) */<=="
+# 0 "" 2
+	.loc 1 144 52 view .LVU185
+	.loc 1 145 5 view .LVU186
+# 145 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_cs $2 /* offsetof(struct trap_info, cs) */<=="
+# 0 "" 2
+	.loc 1 145 46 view .LVU187
+	.loc 1 146 5 view .LVU188
+# 146 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_flags $1 /* offsetof(struct trap_info, flags) */<=="
+# 0 "" 2
+	.loc 1 146 52 view .LVU189
+	.loc 1 147 5 view .LVU190
+# 147 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_sizeof $16 /* sizeof(struct trap_info) */<=="
+# 0 "" 2
+	.loc 1 148 5 view .LVU191
+# 148 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 150 5 view .LVU192
+# 150 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_error_code $0 /* offsetof(struct trap_bounce, error_code) */<=="
+# 0 "" 2
+	.loc 1 150 66 view .LVU193
+	.loc 1 151 5 view .LVU194
+# 151 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_flags $4 /* offsetof(struct trap_bounce, flags) */<=="
+# 0 "" 2
+	.loc 1 151 56 view .LVU195
+	.loc 1 152 5 view .LVU196
+# 152 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_cs $6 /* offsetof(struct trap_bounce, cs) */<=="
+# 0 "" 2
+	.loc 1 152 50 view .LVU197
+	.loc 1 153 5 view .LVU198
+# 153 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_eip $8 /* offsetof(struct trap_bounce, eip) */<=="
+# 0 "" 2
+	.loc 1 153 52 view .LVU199
+	.loc 1 154 5 view .LVU200
+# 154 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 156 5 view .LVU201
+# 156 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUMSR_spec_ctrl_raw $0 /* offsetof(struct msr_vcpu_policy, spec_ctrl.raw) */<=="
+# 0 "" 2
+	.loc 1 156 73 view .LVU202
+	.loc 1 157 5 view .LVU203
+# 157 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 160 5 view .LVU204
+# 160 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define ASM_PERFC_exceptions $0 /* PERFC_exceptions */<=="
+# 0 "" 2
+	.loc 1 161 5 view .LVU205
+# 161 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 164 5 view .LVU206
+# 164 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define IRQSTAT_shift $7 /* ilog2(sizeof(irq_cpustat_t)) */<=="
+# 0 "" 2
+	.loc 1 165 5 view .LVU207
+# 165 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define IRQSTAT_softirq_pending $0 /* offsetof(irq_cpustat_t, __softirq_pending) */<=="
+# 0 "" 2
+	.loc 1 165 70 view .LVU208
+	.loc 1 166 5 view .LVU209
+# 166 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 168 5 view .LVU210
+# 168 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_features $12 /* offsetof(struct cpuinfo_x86, x86_capability) */<=="
+# 0 "" 2
+	.loc 1 168 65 view .LVU211
+	.loc 1 169 5 view .LVU212
+# 169 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 171 5 view .LVU213
+# 171 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_flags $0 /* offsetof(multiboot_info_t, flags) */<=="
+# 0 "" 2
+	.loc 1 171 46 view .LVU214
+	.loc 1 172 5 view .LVU215
+# 172 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_cmdline $16 /* offsetof(multiboot_info_t, cmdline) */<=="
+# 0 "" 2
+	.loc 1 172 50 view .LVU216
+	.loc 1 173 5 view .LVU217
+# 173 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_mem_lower $4 /* offsetof(multiboot_info_t, mem_lower) */<=="
+# 0 "" 2
+	.loc 1 173 54 view .LVU218
+	.loc 1 174 5 view .LVU219
+# 174 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 176 5 view .LVU220
+# 176 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_fixed_sizeof $8 /* sizeof(multiboot2_fixed_t) */<=="
+# 0 "" 2
+	.loc 1 177 5 view .LVU221
+# 177 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_fixed_total_size $0 /* offsetof(multiboot2_fixed_t, total_size) */<=="
+# 0 "" 2
+	.loc 1 177 65 view .LVU222
+	.loc 1 178 5 view .LVU223
+# 178 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_tag_type $0 /* offsetof(multiboot2_tag_t, type) */<=="
+# 0 "" 2
+	.loc 1 178 49 view .LVU224
+	.loc 1 179 5 view .LVU225
+# 179 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_tag_size $4 /* offsetof(multiboot2_tag_t, size) */<=="
+# 0 "" 2
+	.loc 1 179 49 view .LVU226
+	.loc 1 180 5 view .LVU227
+# 180 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_load_base_addr $8 /* offsetof(multiboot2_tag_load_base_addr_t, load_base_addr) */<=="
+# 0 "" 2
+	.loc 1 180 80 view .LVU228
+	.loc 1 181 5 view .LVU229
+# 181 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_mem_lower $8 /* offsetof(multiboot2_tag_basic_meminfo_t, mem_lower) */<=="
+# 0 "" 2
+	.loc 1 181 69 view .LVU230
+	.loc 1 182 5 view .LVU231
+# 182 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_efi64_st $8 /* offsetof(multiboot2_tag_efi64_t, pointer) */<=="
+# 0 "" 2
+	.loc 1 182 58 view .LVU232
+	.loc 1 183 5 view .LVU233
+# 183 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_efi64_ih $8 /* offsetof(multiboot2_tag_efi64_ih_t, pointer) */<=="
+# 0 "" 2
+	.loc 1 183 61 view .LVU234
+	.loc 1 184 5 view .LVU235
+# 184 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 186 5 view .LVU236
+# 186 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define l2_identmap_sizeof $16384 /* sizeof(l2_identmap) */<=="
+# 0 "" 2
+	.loc 1 187 5 view .LVU237
+# 187 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 189 5 view .LVU238
+# 189 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define DOMAIN_vm_assist $464 /* offsetof(struct domain, vm_assist) */<=="
+# 0 "" 2
+	.loc 1 189 55 view .LVU239
+	.loc 1 190 1 is_stmt 0 view .LVU240
+#NO_APP
+	ret
+	.cfi_endproc
+.LFE558:
+	.size	__dummy__, .-__dummy__
+.Letext0:
+	.file 2 "/root/repo/xen/include/xen/perfc.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x66a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x4
+	.long	.LASF224
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF10
+	.uleb128 0x6
+	.long	.LASF225
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x6
+	.long	0x645
+	.uleb128 0x3
+	.long	.LASF11
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x1f
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x57
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x77
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF18
+	.value	0x105
+	.uleb128 0x1
+	.long	.LASF19
+	.value	0x106
+	.uleb128 0x1
+	.long	.LASF20
+	.value	0x107
+	.uleb128 0x1
+	.long	.LASF21
+	.value	0x108
+	.uleb128 0x1
+	.long	.LASF22
+	.value	0x109
+	.uleb128 0x1
+	.long	.LASF23
+	.value	0x10a
+	.uleb128 0x1
+	.long	.LASF24
+	.value	0x10b
+	.uleb128 0x1
+	.long	.LASF25
+	.value	0x10c
+	.uleb128 0x1
+	.long	.LASF26
+	.value	0x10d
+	.uleb128 0x1
+	.long	.LASF27
+	.value	0x10e
+	.uleb128 0x1
+	.long	.LASF28
+	.value	0x10f
+	.uleb128 0x1
+	.long	.LASF29
+	.value	0x110
+	.uleb128 0x1
+	.long	.LASF30
+	.value	0x111
+	.uleb128 0x1
+	.long	.LASF31
+	.value	0x112
+	.uleb128 0x1
+	.long	.LASF32
+	.value	0x113
+	.uleb128 0x1
+	.long	.LASF33
+	.value	0x114
+	.uleb128 0x1
+	.long	.LASF34
+	.value	0x115
+	.uleb128 0x1
+	.long	.LASF35
+	.value	0x116
+	.uleb128 0x1
+	.long	.LASF36
+	.value	0x117
+	.uleb128 0x1
+	.long	.LASF37
+	.value	0x118
+	.uleb128 0x1
+	.long	.LASF38
+	.value	0x119
+	.uleb128 0x1
+	.long	.LASF39
+	.value	0x11a
+	.uleb128 0x1
+	.long	.LASF40
+	.value	0x11b
+	.uleb128 0x1
+	.long	.LASF41
+	.value	0x11c
+	.uleb128 0x1
+	.long	.LASF42
+	.value	0x11d
+	.uleb128 0x1
+	.long	.LASF43
+	.value	0x11e
+	.uleb128 0x1
+	.long	.LASF44
+	.value	0x11f
+	.uleb128 0x1
+	.long	.LASF45
+	.value	0x120
+	.uleb128 0x1
+	.long	.LASF46
+	.value	0x121
+	.uleb128 0x1
+	.long	.LASF47
+	.value	0x122
+	.uleb128 0x1
+	.long	.LASF48
+	.value	0x123
+	.uleb128 0x1
+	.long	.LASF49
+	.value	0x124
+	.uleb128 0x1
+	.long	.LASF50
+	.value	0x125
+	.uleb128 0x1
+	.long	.LASF51
+	.value	0x126
+	.uleb128 0x1
+	.long	.LASF52
+	.value	0x127
+	.uleb128 0x1
+	.long	.LASF53
+	.value	0x128
+	.uleb128 0x1
+	.long	.LASF54
+	.value	0x129
+	.uleb128 0x1
+	.long	.LASF55
+	.value	0x12a
+	.uleb128 0x1
+	.long	.LASF56
+	.value	0x12b
+	.uleb128 0x1
+	.long	.LASF57
+	.value	0x12c
+	.uleb128 0x1
+	.long	.LASF58
+	.value	0x12d
+	.uleb128 0x1
+	.long	.LASF59
+	.value	0x12e
+	.uleb128 0x1
+	.long	.LASF60
+	.value	0x12f
+	.uleb128 0x1
+	.long	.LASF61
+	.value	0x130
+	.uleb128 0x1
+	.long	.LASF62
+	.value	0x131
+	.uleb128 0x1
+	.long	.LASF63
+	.value	0x132
+	.uleb128 0x1
+	.long	.LASF64
+	.value	0x133
+	.uleb128 0x1
+	.long	.LASF65
+	.value	0x134
+	.uleb128 0x1
+	.long	.LASF66
+	.value	0x135
+	.uleb128 0x1
+	.long	.LASF67
+	.value	0x136
+	.uleb128 0x1
+	.long	.LASF68
+	.value	0x137
+	.uleb128 0x1
+	.long	.LASF69
+	.value	0x138
+	.uleb128 0x1
+	.long	.LASF70
+	.value	0x139
+	.uleb128 0x1
+	.long	.LASF71
+	.value	0x13a
+	.uleb128 0x1
+	.long	.LASF72
+	.value	0x13b
+	.uleb128 0x1
+	.long	.LASF73
+	.value	0x13c
+	.uleb128 0x1
+	.long	.LASF74
+	.value	0x13d
+	.uleb128 0x1
+	.long	.LASF75
+	.value	0x13e
+	.uleb128 0x1
+	.long	.LASF76
+	.value	0x13f
+	.uleb128 0x1
+	.long	.LASF77
+	.value	0x140
+	.uleb128 0x1
+	.long	.LASF78
+	.value	0x141
+	.uleb128 0x1
+	.long	.LASF79
+	.value	0x142
+	.uleb128 0x1
+	.long	.LASF80
+	.value	0x143
+	.uleb128 0x1
+	.long	.LASF81
+	.value	0x144
+	.uleb128 0x1
+	.long	.LASF82
+	.value	0x145
+	.uleb128 0x1
+	.long	.LASF83
+	.value	0x146
+	.uleb128 0x1
+	.long	.LASF84
+	.value	0x147
+	.uleb128 0x1
+	.long	.LASF85
+	.value	0x148
+	.uleb128 0x1
+	.long	.LASF86
+	.value	0x149
+	.uleb128 0x1
+	.long	.LASF87
+	.value	0x14a
+	.uleb128 0x1
+	.long	.LASF88
+	.value	0x14b
+	.uleb128 0x1
+	.long	.LASF89
+	.value	0x14c
+	.uleb128 0x1
+	.long	.LASF90
+	.value	0x14d
+	.uleb128 0x1
+	.long	.LASF91
+	.value	0x14e
+	.uleb128 0x1
+	.long	.LASF92
+	.value	0x14f
+	.uleb128 0x1
+	.long	.LASF93
+	.value	0x150
+	.uleb128 0x1
+	.long	.LASF94
+	.value	0x151
+	.uleb128 0x1
+	.long	.LASF95
+	.value	0x152
+	.uleb128 0x1
+	.long	.LASF96
+	.value	0x153
+	.uleb128 0x1
+	.long	.LASF97
+	.value	0x154
+	.uleb128 0x1
+	.long	.LASF98
+	.value	0x155
+	.uleb128 0x1
+	.long	.LASF99
+	.value	0x156
+	.uleb128 0x1
+	.long	.LASF100
+	.value	0x157
+	.uleb128 0x1
+	.long	.LASF101
+	.value	0x158
+	.uleb128 0x1
+	.long	.LASF102
+	.value	0x159
+	.uleb128 0x1
+	.long	.LASF103
+	.value	0x15a
+	.uleb128 0x1
+	.long	.LASF104
+	.value	0x15b
+	.uleb128 0x1
+	.long	.LASF105
+	.value	0x15c
+	.uleb128 0x1
+	.long	.LASF106
+	.value	0x15d
+	.uleb128 0x1
+	.long	.LASF107
+	.value	0x15e
+	.uleb128 0x1
+	.long	.LASF108
+	.value	0x15f
+	.uleb128 0x1
+	.long	.LASF109
+	.value	0x160
+	.uleb128 0x1
+	.long	.LASF110
+	.value	0x161
+	.uleb128 0x1
+	.long	.LASF111
+	.value	0x162
+	.uleb128 0x1
+	.long	.LASF112
+	.value	0x163
+	.uleb128 0x1
+	.long	.LASF113
+	.value	0x164
+	.uleb128 0x1
+	.long	.LASF114
+	.value	0x165
+	.uleb128 0x1
+	.long	.LASF115
+	.value	0x166
+	.uleb128 0x1
+	.long	.LASF116
+	.value	0x167
+	.uleb128 0x1
+	.long	.LASF117
+	.value	0x168
+	.uleb128 0x1
+	.long	.LASF118
+	.value	0x169
+	.uleb128 0x1
+	.long	.LASF119
+	.value	0x16a
+	.uleb128 0x1
+	.long	.LASF120
+	.value	0x16b
+	.uleb128 0x1
+	.long	.LASF121
+	.value	0x16c
+	.uleb128 0x1
+	.long	.LASF122
+	.value	0x16d
+	.uleb128 0x1
+	.long	.LASF123
+	.value	0x16e
+	.uleb128 0x1
+	.long	.LASF124
+	.value	0x16f
+	.uleb128 0x1
+	.long	.LASF125
+	.value	0x170
+	.uleb128 0x1
+	.long	.LASF126
+	.value	0x171
+	.uleb128 0x1
+	.long	.LASF127
+	.value	0x172
+	.uleb128 0x1
+	.long	.LASF128
+	.value	0x173
+	.uleb128 0x1
+	.long	.LASF129
+	.value	0x174
+	.uleb128 0x1
+	.long	.LASF130
+	.value	0x175
+	.uleb128 0x1
+	.long	.LASF131
+	.value	0x176
+	.uleb128 0x1
+	.long	.LASF132
+	.value	0x177
+	.uleb128 0x1
+	.long	.LASF133
+	.value	0x178
+	.uleb128 0x1
+	.long	.LASF134
+	.value	0x179
+	.uleb128 0x1
+	.long	.LASF135
+	.value	0x17a
+	.uleb128 0x1
+	.long	.LASF136
+	.value	0x17b
+	.uleb128 0x1
+	.long	.LASF137
+	.value	0x17c
+	.uleb128 0x1
+	.long	.LASF138
+	.value	0x17d
+	.uleb128 0x1
+	.long	.LASF139
+	.value	0x17e
+	.uleb128 0x1
+	.long	.LASF140
+	.value	0x17f
+	.uleb128 0x1
+	.long	.LASF141
+	.value	0x180
+	.uleb128 0x1
+	.long	.LASF142
+	.value	0x181
+	.uleb128 0x1
+	.long	.LASF143
+	.value	0x182
+	.uleb128 0x1
+	.long	.LASF144
+	.value	0x183
+	.uleb128 0x1
+	.long	.LASF145
+	.value	0x184
+	.uleb128 0x1
+	.long	.LASF146
+	.value	0x185
+	.uleb128 0x1
+	.long	.LASF147
+	.value	0x186
+	.uleb128 0x1
+	.long	.LASF148
+	.value	0x187
+	.uleb128 0x1
+	.long	.LASF149
+	.value	0x188
+	.uleb128 0x1
+	.long	.LASF150
+	.value	0x189
+	.uleb128 0x1
+	.long	.LASF151
+	.value	0x1c8
+	.uleb128 0x1
+	.long	.LASF152
+	.value	0x1c9
+	.uleb128 0x1
+	.long	.LASF153
+	.value	0x1ca
+	.uleb128 0x1
+	.long	.LASF154
+	.value	0x1cb
+	.uleb128 0x1
+	.long	.LASF155
+	.value	0x1cc
+	.uleb128 0x1
+	.long	.LASF156
+	.value	0x1cd
+	.uleb128 0x1
+	.long	.LASF157
+	.value	0x1ce
+	.uleb128 0x1
+	.long	.LASF158
+	.value	0x1cf
+	.uleb128 0x1
+	.long	.LASF159
+	.value	0x1d0
+	.uleb128 0x1
+	.long	.LASF160
+	.value	0x1d1
+	.uleb128 0x1
+	.long	.LASF161
+	.value	0x1d2
+	.uleb128 0x1
+	.long	.LASF162
+	.value	0x1d3
+	.uleb128 0x1
+	.long	.LASF163
+	.value	0x1d4
+	.uleb128 0x1
+	.long	.LASF164
+	.value	0x1d5
+	.uleb128 0x1
+	.long	.LASF165
+	.value	0x1d6
+	.uleb128 0x1
+	.long	.LASF166
+	.value	0x1d7
+	.uleb128 0x1
+	.long	.LASF167
+	.value	0x1d8
+	.uleb128 0x1
+	.long	.LASF168
+	.value	0x1d9
+	.uleb128 0x1
+	.long	.LASF169
+	.value	0x1da
+	.uleb128 0x1
+	.long	.LASF170
+	.value	0x1db
+	.uleb128 0x1
+	.long	.LASF171
+	.value	0x1dc
+	.uleb128 0x1
+	.long	.LASF172
+	.value	0x1dd
+	.uleb128 0x1
+	.long	.LASF173
+	.value	0x1de
+	.uleb128 0x1
+	.long	.LASF174
+	.value	0x1df
+	.uleb128 0x1
+	.long	.LASF175
+	.value	0x1e0
+	.uleb128 0x1
+	.long	.LASF176
+	.value	0x1e1
+	.uleb128 0x1
+	.long	.LASF177
+	.value	0x1e2
+	.uleb128 0x1
+	.long	.LASF178
+	.value	0x1e3
+	.uleb128 0x1
+	.long	.LASF179
+	.value	0x1e4
+	.uleb128 0x1
+	.long	.LASF180
+	.value	0x1e5
+	.uleb128 0x1
+	.long	.LASF181
+	.value	0x1e6
+	.uleb128 0x1
+	.long	.LASF182
+	.value	0x1e7
+	.uleb128 0x1
+	.long	.LASF183
+	.value	0x1e8
+	.uleb128 0x1
+	.long	.LASF184
+	.value	0x1e9
+	.uleb128 0x1
+	.long	.LASF185
+	.value	0x1ea
+	.uleb128 0x1
+	.long	.LASF186
+	.value	0x1eb
+	.uleb128 0x1
+	.long	.LASF187
+	.value	0x1ec
+	.uleb128 0x1
+	.long	.LASF188
+	.value	0x1ed
+	.uleb128 0x1
+	.long	.LASF189
+	.value	0x1ee
+	.uleb128 0x1
+	.long	.LASF190
+	.value	0x1ef
+	.uleb128 0x1
+	.long	.LASF191
+	.value	0x1f0
+	.uleb128 0x1
+	.long	.LASF192
+	.value	0x1f1
+	.uleb128 0x1
+	.long	.LASF193
+	.value	0x1f2
+	.uleb128 0x1
+	.long	.LASF194
+	.value	0x1f3
+	.uleb128 0x1
+	.long	.LASF195
+	.value	0x1f4
+	.uleb128 0x1
+	.long	.LASF196
+	.value	0x1f5
+	.uleb128 0x1
+	.long	.LASF197
+	.value	0x1f6
+	.uleb128 0x1
+	.long	.LASF198
+	.value	0x1f7
+	.uleb128 0x1
+	.long	.LASF199
+	.value	0x1f8
+	.uleb128 0x1
+	.long	.LASF200
+	.value	0x1f9
+	.uleb128 0x1
+	.long	.LASF201
+	.value	0x1fa
+	.uleb128 0x1
+	.long	.LASF202
+	.value	0x1fb
+	.uleb128 0x1
+	.long	.LASF203
+	.value	0x1fc
+	.uleb128 0x1
+	.long	.LASF204
+	.value	0x1fd
+	.uleb128 0x1
+	.long	.LASF205
+	.value	0x1fe
+	.uleb128 0x1
+	.long	.LASF206
+	.value	0x1ff
+	.uleb128 0x1
+	.long	.LASF207
+	.value	0x200
+	.uleb128 0x1
+	.long	.LASF208
+	.value	0x201
+	.uleb128 0x1
+	.long	.LASF209
+	.value	0x202
+	.uleb128 0x1
+	.long	.LASF210
+	.value	0x203
+	.uleb128 0x1
+	.long	.LASF211
+	.value	0x204
+	.uleb128 0x1
+	.long	.LASF212
+	.value	0x205
+	.uleb128 0x1
+	.long	.LASF213
+	.value	0x206
+	.uleb128 0x1
+	.long	.LASF214
+	.value	0x207
+	.uleb128 0x1
+	.long	.LASF215
+	.value	0x208
+	.uleb128 0x1
+	.long	.LASF216
+	.value	0x209
+	.uleb128 0x1
+	.long	.LASF217
+	.value	0x20a
+	.uleb128 0x1
+	.long	.LASF218
+	.value	0x20b
+	.uleb128 0x1
+	.long	.LASF219
+	.value	0x20c
+	.uleb128 0x1
+	.long	.LASF220
+	.value	0x20d
+	.uleb128 0x1
+	.long	.LASF221
+	.value	0x20e
+	.byte	0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF222
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF223
+	.uleb128 0x7
+	.long	.LASF226
+	.byte	0x1
+	.byte	0x19
+	.byte	0x6
+	.quad	.LFB558
+	.quad	.LFE558-.LFB558
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF46:
+	.string	"PERFC_shadow_fault_fast_mmio"
+.LASF25:
+	.string	"PERFC_num_page_updates"
+.LASF152:
+	.string	"PERFC_calls_to_multicall"
+.LASF145:
+	.string	"PERFC_insn_cache_flushes"
+.LASF57:
+	.string	"PERFC_shadow_fault_mmio"
+.LASF60:
+	.string	"PERFC_shadow_validate_gl1e_calls"
+.LASF208:
+	.string	"PERFC_migrate_on_runq"
+.LASF170:
+	.string	"PERFC_vcpu_wake_runnable"
+.LASF139:
+	.string	"PERFC_ioreq_index_rebuilds"
+.LASF82:
+	.string	"PERFC_shadow_mappings_bf"
+.LASF192:
+	.string	"PERFC_steal_trylock_failed"
+.LASF200:
+	.string	"PERFC_migrate_running"
+.LASF183:
+	.string	"PERFC_acct_vcpu_active"
+.LASF215:
+	.string	"PERFC_migrate_resisted"
+.LASF11:
+	.string	"PERFC_exceptions"
+.LASF113:
+	.string	"PERFC_mshv_rdmsr_tpr"
+.LASF51:
+	.string	"PERFC_shadow_fault_emulate_write"
+.LASF222:
+	.string	"long long unsigned int"
+.LASF197:
+	.string	"PERFC_steal_success_llc"
+.LASF128:
+	.string	"PERFC_mshv_rdmsr_stimer"
+.LASF216:
+	.string	"PERFC_credit_reset"
+.LASF22:
+	.string	"PERFC_calls_to_mmuext_op"
+.LASF129:
+	.string	"PERFC_mshv_wrmsr_stimer"
+.LASF179:
+	.string	"PERFC_acct_no_work"
+.LASF168:
+	.string	"PERFC_vcpu_wake_running"
+.LASF71:
+	.string	"PERFC_shadow_writeable_h_1"
+.LASF72:
+	.string	"PERFC_shadow_writeable_h_2"
+.LASF73:
+	.string	"PERFC_shadow_writeable_h_3"
+.LASF44:
+	.string	"PERFC_shadow_fault"
+.LASF75:
+	.string	"PERFC_shadow_writeable_h_5"
+.LASF76:
+	.string	"PERFC_shadow_writeable_h_6"
+.LASF77:
+	.string	"PERFC_shadow_writeable_h_7"
+.LASF78:
+	.string	"PERFC_shadow_writeable_h_8"
+.LASF34:
+	.string	"PERFC_guest_walk"
+.LASF174:
+	.string	"PERFC_tickled_idle_cpu_excl"
+.LASF213:
+	.string	"PERFC_need_fallback_cpu"
+.LASF7:
+	.string	"signed char"
+.LASF124:
+	.string	"PERFC_mshv_wrmsr_apic_msr"
+.LASF64:
+	.string	"PERFC_shadow_hash_lookups"
+.LASF32:
+	.string	"PERFC_mmio_ro_emulations"
+.LASF104:
+	.string	"PERFC_mshv_call_long_wait"
+.LASF116:
+	.string	"PERFC_mshv_rdmsr_tsc_msr"
+.LASF19:
+	.string	"PERFC_seg_fixups"
+.LASF110:
+	.string	"PERFC_mshv_rdmsr_apic_frequency"
+.LASF153:
+	.string	"PERFC_calls_from_multicall"
+.LASF177:
+	.string	"PERFC_delay_ms"
+.LASF28:
+	.string	"PERFC_page_faults"
+.LASF30:
+	.string	"PERFC_map_domain_page_count"
+.LASF9:
+	.string	"long int"
+.LASF121:
+	.string	"PERFC_mshv_wrmsr_tpr"
+.LASF211:
+	.string	"PERFC_runtime_max_timer"
+.LASF162:
+	.string	"PERFC_dom_destroy"
+.LASF125:
+	.string	"PERFC_mshv_wrmsr_tsc_msr"
+.LASF189:
+	.string	"PERFC_load_balance_over"
+.LASF223:
+	.string	"long long int"
+.LASF50:
+	.string	"PERFC_shadow_fault_emulate_read"
+.LASF112:
+	.string	"PERFC_mshv_rdmsr_icr"
+.LASF58:
+	.string	"PERFC_shadow_fault_fixed"
+.LASF157:
+	.string	"PERFC_sched_irq"
+.LASF115:
+	.string	"PERFC_mshv_rdmsr_apic_msr"
+.LASF140:
+	.string	"PERFC_bufioreq_posted"
+.LASF136:
+	.string	"PERFC_ioreq_index_probes"
+.LASF23:
+	.string	"PERFC_num_mmuext_ops"
+.LASF16:
+	.string	"PERFC_LAST_cause_vector"
+.LASF13:
+	.string	"PERFC_vmexits"
+.LASF111:
+	.string	"PERFC_mshv_rdmsr_time_ref_count"
+.LASF35:
+	.string	"PERFC_shadow_alloc"
+.LASF52:
+	.string	"PERFC_shadow_fault_emulate_failed"
+.LASF108:
+	.string	"PERFC_mshv_rdmsr_vp_index"
+.LASF119:
+	.string	"PERFC_mshv_wrmsr_vp_index"
+.LASF194:
+	.string	"PERFC_steal_peek_skipped"
+.LASF42:
+	.string	"PERFC_shadow_a_update"
+.LASF85:
+	.string	"PERFC_shadow_up_pointer"
+.LASF39:
+	.string	"PERFC_shadow_prealloc_1"
+.LASF40:
+	.string	"PERFC_shadow_prealloc_2"
+.LASF191:
+	.string	"PERFC_steal_trylock"
+.LASF141:
+	.string	"PERFC_bufioreq_overflows"
+.LASF190:
+	.string	"PERFC_load_balance_other"
+.LASF4:
+	.string	"unsigned int"
+.LASF135:
+	.string	"PERFC_ioreq_index_misses"
+.LASF89:
+	.string	"PERFC_shadow_inconsistent_gwalk"
+.LASF21:
+	.string	"PERFC_domain_page_tlb_flush"
+.LASF225:
+	.string	"perfcounter"
+.LASF2:
+	.string	"long unsigned int"
+.LASF212:
+	.string	"PERFC_pick_cpu"
+.LASF165:
+	.string	"PERFC_vcpu_remove"
+.LASF146:
+	.string	"PERFC_emul_simple_hits"
+.LASF187:
+	.string	"PERFC_vcpu_unpark"
+.LASF143:
+	.string	"PERFC_insn_cache_hits"
+.LASF12:
+	.string	"PERFC_LAST_exceptions"
+.LASF6:
+	.string	"short unsigned int"
+.LASF218:
+	.string	"PERFC_tickled_cpu_overwritten"
+.LASF101:
+	.string	"PERFC_mshv_call_sw_addr_space"
+.LASF147:
+	.string	"PERFC_emul_simple_fallbacks"
+.LASF54:
+	.string	"PERFC_shadow_fault_emulate_wp"
+.LASF100:
+	.string	"PERFC_shadow_resync"
+.LASF69:
+	.string	"PERFC_shadow_hash_deletes"
+.LASF63:
+	.string	"PERFC_shadow_validate_gl4e_calls"
+.LASF169:
+	.string	"PERFC_vcpu_wake_onrunq"
+.LASF56:
+	.string	"PERFC_shadow_fault_fast_emulate_fail"
+.LASF65:
+	.string	"PERFC_shadow_hash_lookup_head"
+.LASF173:
+	.string	"PERFC_tickled_idle_cpu"
+.LASF142:
+	.string	"PERFC_bufioreq_notifies"
+.LASF160:
+	.string	"PERFC_schedule"
+.LASF220:
+	.string	"PERFC_need_flush_tlb_flush"
+.LASF196:
+	.string	"PERFC_steal_success_smt"
+.LASF118:
+	.string	"PERFC_mshv_wrmsr_hc_page"
+.LASF176:
+	.string	"PERFC_vcpu_check"
+.LASF74:
+	.string	"PERFC_shadow_writeable_h_4"
+.LASF61:
+	.string	"PERFC_shadow_validate_gl2e_calls"
+.LASF130:
+	.string	"PERFC_mshv_stimer_expired"
+.LASF120:
+	.string	"PERFC_mshv_wrmsr_icr"
+.LASF106:
+	.string	"PERFC_mshv_rdmsr_osid"
+.LASF102:
+	.string	"PERFC_mshv_call_flush_tlb_list"
+.LASF68:
+	.string	"PERFC_shadow_hash_inserts"
+.LASF180:
+	.string	"PERFC_acct_balance"
+.LASF198:
+	.string	"PERFC_steal_success_remote"
+.LASF99:
+	.string	"PERFC_shadow_unsync_evict"
+.LASF92:
+	.string	"PERFC_shadow_invlpg_fault"
+.LASF144:
+	.string	"PERFC_insn_cache_misses"
+.LASF81:
+	.string	"PERFC_shadow_mappings"
+.LASF79:
+	.string	"PERFC_shadow_writeable_bf"
+.LASF123:
+	.string	"PERFC_mshv_wrmsr_apic_assist"
+.LASF126:
+	.string	"PERFC_mshv_rdmsr_synic"
+.LASF204:
+	.string	"PERFC_acct_load_balance"
+.LASF105:
+	.string	"PERFC_mshv_call_flush"
+.LASF93:
+	.string	"PERFC_shadow_em_ex_pt"
+.LASF66:
+	.string	"PERFC_shadow_hash_lookup_miss"
+.LASF195:
+	.string	"PERFC_steal_success"
+.LASF27:
+	.string	"PERFC_calls_to_update_va"
+.LASF53:
+	.string	"PERFC_shadow_fault_emulate_stack"
+.LASF134:
+	.string	"PERFC_ioreq_index_hits"
+.LASF217:
+	.string	"PERFC_deferred_to_tickled_cpu"
+.LASF201:
+	.string	"PERFC_migrate_kicked_away"
+.LASF154:
+	.string	"PERFC_irqs"
+.LASF117:
+	.string	"PERFC_mshv_wrmsr_osid"
+.LASF137:
+	.string	"PERFC_ioreq_index_fallbacks"
+.LASF94:
+	.string	"PERFC_shadow_em_ex_non_pt"
+.LASF188:
+	.string	"PERFC_load_balance_idle"
+.LASF184:
+	.string	"PERFC_acct_vcpu_idle"
+.LASF150:
+	.string	"PERFC_hypercalls"
+.LASF175:
+	.string	"PERFC_tickled_busy_cpu"
+.LASF148:
+	.string	"PERFC_walk_cache_hits"
+.LASF203:
+	.string	"PERFC_burn_credits_t2c"
+.LASF210:
+	.string	"PERFC_runtime_min_timer"
+.LASF164:
+	.string	"PERFC_vcpu_insert"
+.LASF5:
+	.string	"unsigned char"
+.LASF49:
+	.string	"PERFC_shadow_fault_bail_real_fault"
+.LASF206:
+	.string	"PERFC_upd_max_weight_full"
+.LASF91:
+	.string	"PERFC_shadow_invlpg"
+.LASF18:
+	.string	"PERFC_LAST_svmexits"
+.LASF8:
+	.string	"short int"
+.LASF182:
+	.string	"PERFC_acct_min_credit"
+.LASF207:
+	.string	"PERFC_migrate_requested"
+.LASF95:
+	.string	"PERFC_shadow_em_ex_fail"
+.LASF214:
+	.string	"PERFC_migrated"
+.LASF167:
+	.string	"PERFC_vcpu_yield"
+.LASF186:
+	.string	"PERFC_vcpu_park"
+.LASF103:
+	.string	"PERFC_mshv_call_flush_tlb_all"
+.LASF38:
+	.string	"PERFC_shadow_free"
+.LASF131:
+	.string	"PERFC_realmode_emulations"
+.LASF62:
+	.string	"PERFC_shadow_validate_gl3e_calls"
+.LASF185:
+	.string	"PERFC_vcpu_boost"
+.LASF224:
+	.ascii	"GNU C99 12.2.0 -m64 -msoft-float -mno-red-zone -mno-sse -msk"
+	.ascii	"ip-rax"
+	.string	"-setup -mindirect-branch=thunk-extern -mindirect-branch-register -mtune=generic -march=x86-64 -g -O1 -std=gnu99 -fno-strict-aliasing -fno-omit-frame-pointer -fno-builtin -fno-common -fno-stack-protector -fno-exceptions -fpic -fno-asynchronous-unwind-tables"
+.LASF163:
+	.string	"PERFC_vcpu_alloc"
+.LASF55:
+	.string	"PERFC_shadow_fault_fast_emulate"
+.LASF37:
+	.string	"PERFC_shadow_alloc_count"
+.LASF107:
+	.string	"PERFC_mshv_rdmsr_hc_page"
+.LASF98:
+	.string	"PERFC_shadow_unsync"
+.LASF219:
+	.string	"PERFC_tickled_cpu_overridden"
+.LASF14:
+	.string	"PERFC_LAST_vmexits"
+.LASF31:
+	.string	"PERFC_ptwr_emulations"
+.LASF10:
+	.string	"_Bool"
+.LASF3:
+	.string	"char"
+.LASF199:
+	.string	"PERFC_migrate_queued"
+.LASF122:
+	.string	"PERFC_mshv_wrmsr_eoi"
+.LASF159:
+	.string	"PERFC_sched_ctx"
+.LASF87:
+	.string	"PERFC_shadow_get_page_fail"
+.LASF29:
+	.string	"PERFC_copy_user_faults"
+.LASF84:
+	.string	"PERFC_shadow_unshadow"
+.LASF17:
+	.string	"PERFC_svmexits"
+.LASF181:
+	.string	"PERFC_acct_reorder"
+.LASF70:
+	.string	"PERFC_shadow_writeable"
+.LASF178:
+	.string	"PERFC_acct_run"
+.LASF156:
+	.string	"PERFC_rcu_idle_timer"
+.LASF202:
+	.string	"PERFC_vcpu_hot"
+.LASF138:
+	.string	"PERFC_ioreq_index_scans"
+.LASF193:
+	.string	"PERFC_steal_peer_idle"
+.LASF114:
+	.string	"PERFC_mshv_rdmsr_apic_assist"
+.LASF221:
+	.string	"NUM_PERFCOUNTERS"
+.LASF127:
+	.string	"PERFC_mshv_wrmsr_synic"
+.LASF67:
+	.string	"PERFC_shadow_get_shadow_status"
+.LASF80:
+	.string	"PERFC_shadow_writeable_bf_1"
+.LASF209:
+	.string	"PERFC_migrate_no_runq"
+.LASF24:
+	.string	"PERFC_calls_to_mmu_update"
+.LASF149:
+	.string	"PERFC_walk_cache_misses"
+.LASF15:
+	.string	"PERFC_cause_vector"
+.LASF172:
+	.string	"PERFC_tickled_no_cpu"
+.LASF133:
+	.string	"PERFC_pauseloop_exits"
+.LASF161:
+	.string	"PERFC_dom_init"
+.LASF109:
+	.string	"PERFC_mshv_rdmsr_tsc_frequency"
+.LASF33:
+	.string	"PERFC_exception_fixed"
+.LASF155:
+	.string	"PERFC_ipis"
+.LASF88:
+	.string	"PERFC_shadow_check_gwalk"
+.LASF36:
+	.string	"PERFC_shadow_alloc_tlbflush"
+.LASF86:
+	.string	"PERFC_shadow_unshadow_bf"
+.LASF90:
+	.string	"PERFC_shadow_rm_write_flush_tlb"
+.LASF20:
+	.string	"PERFC_apic_timer"
+.LASF132:
+	.string	"PERFC_realmode_exits"
+.LASF43:
+	.string	"PERFC_shadow_ad_update"
+.LASF59:
+	.string	"PERFC_shadow_ptwr_emulate"
+.LASF151:
+	.string	"PERFC_LAST_hypercalls"
+.LASF96:
+	.string	"PERFC_shadow_oos_fixup_add"
+.LASF48:
+	.string	"PERFC_shadow_fault_bail_bad_gfn"
+.LASF205:
+	.string	"PERFC_upd_max_weight_quick"
+.LASF45:
+	.string	"PERFC_shadow_fault_fast_gnp"
+.LASF171:
+	.string	"PERFC_vcpu_wake_not_runnable"
+.LASF226:
+	.string	"__dummy__"
+.LASF41:
+	.string	"PERFC_shadow_linear_map_failed"
+.LASF166:
+	.string	"PERFC_vcpu_sleep"
+.LASF83:
+	.string	"PERFC_shadow_early_unshadow"
+.LASF26:
+	.string	"PERFC_writable_mmu_updates"
+.LASF97:
+	.string	"PERFC_shadow_oos_fixup_evict"
+.LASF47:
+	.string	"PERFC_shadow_fault_fast_fail"
+.LASF158:
+	.string	"PERFC_sched_run"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"x86_64/asm-offsets.c"
+.LASF1:
+	.string	"/root/repo/xen/arch/x86"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
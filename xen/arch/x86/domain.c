@@ -202,7 +202,10 @@ void dump_pageframe_info(struct domain *d)
     }
 
     if ( is_hvm_domain(d) )
+    {
         p2m_pod_dump_data(d);
+        p2m_coalesce_dump_data(d);
+    }
 
     spin_lock(&d->page_alloc_lock);
     page_list_for_each ( page, &d->xenpage_list )
@@ -1517,6 +1517,22 @@ long arch_do_domctl(
         recalculate_cpuid_policy(d);
         break;
 
+    case XEN_DOMCTL_wss_op:
+        ret = p2m_wss_domctl(d, &domctl->u.wss_op);
+        if ( !ret )
+            copyback = true;
+        break;
+
+    case XEN_DOMCTL_get_pod_stats:
+        ret = -EINVAL;
+        if ( !is_hvm_domain(d) )
+            break;
+
+        p2m_pod_get_stats(d, &domctl->u.pod_stats);
+        ret = 0;
+        copyback = true;
+        break;
+
     default:
         ret = iommu_do_domctl(domctl, d, u_domctl);
         break;
@@ -0,0 +1 @@
+../../../common/efi/runtime.c
\ No newline at end of file
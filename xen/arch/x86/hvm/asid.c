@@ -22,6 +22,8 @@
 #include <xen/smp.h>
 #include <xen/percpu.h>
 #include <asm/hvm/asid.h>
+#include <asm/hvm/emulate.h>
+#include <asm/paging.h>
 
 /* Xen command-line option to enable ASIDs */
 static int opt_asid_enabled = 1;
@@ -89,6 +91,16 @@ void hvm_asid_flush_vcpu(struct vcpu *v)
 {
     hvm_asid_flush_vcpu_asid(&v->arch.hvm_vcpu.n1asid);
     hvm_asid_flush_vcpu_asid(&vcpu_nestedhvm(v).nv_n2asid);
+    hvm_emulate_insn_cache_flush(v);
+    paging_walk_cache_flush(v);
+}
+
+bool hvm_asid_is_live(const struct hvm_vcpu_asid *asid)
+{
+    const struct hvm_asid_data *data = &this_cpu(hvm_asid_data);
+
+    return !data->disabled && asid->asid &&
+           asid->generation == data->core_asid_generation;
 }
 
 void hvm_asid_flush_core(void)
@@ -359,6 +359,8 @@ static int dm_op(const struct dmop_args *op_args)
         [XEN_DMOP_remote_shutdown]                  = sizeof(struct xen_dm_op_remote_shutdown),
         [XEN_DMOP_relocate_memory]                  = sizeof(struct xen_dm_op_relocate_memory),
         [XEN_DMOP_pin_memory_cacheattr]             = sizeof(struct xen_dm_op_pin_memory_cacheattr),
+        [XEN_DMOP_set_ioreq_server_batch]           = sizeof(struct xen_dm_op_set_ioreq_server_batch),
+        [XEN_DMOP_set_ioreq_server_bufioreq]        = sizeof(struct xen_dm_op_set_ioreq_server_bufioreq),
     };
 
     rc = rcu_lock_remote_domain_by_id(op_args->domid, &d);
@@ -528,6 +530,34 @@ static int dm_op(const struct dmop_args *op_args)
         break;
     }
 
+    case XEN_DMOP_set_ioreq_server_batch:
+    {
+        const struct xen_dm_op_set_ioreq_server_batch *data =
+            &op.u.set_ioreq_server_batch;
+
+        rc = -EINVAL;
+        if ( !data->nr_pages ||
+             data->nr_pages > XEN_DMOP_IOREQ_BATCH_MAX_PAGES )
+            break;
+
+        rc = hvm_set_ioreq_server_batch(d, data->id, data->nr_pages);
+        break;
+    }
+
+    case XEN_DMOP_set_ioreq_server_bufioreq:
+    {
+        const struct xen_dm_op_set_ioreq_server_bufioreq *data =
+            &op.u.set_ioreq_server_bufioreq;
+
+        rc = -EINVAL;
+        if ( !data->nr_pages ||
+             data->nr_pages > XEN_DMOP_BUFIOREQ_MAX_PAGES )
+            break;
+
+        rc = hvm_set_ioreq_server_bufioreq(d, data->id, data->nr_pages);
+        break;
+    }
+
     case XEN_DMOP_destroy_ioreq_server:
     {
         const struct xen_dm_op_destroy_ioreq_server *data =
@@ -726,6 +756,8 @@ CHECK_dm_op_inject_msi;
 CHECK_dm_op_remote_shutdown;
 CHECK_dm_op_relocate_memory;
 CHECK_dm_op_pin_memory_cacheattr;
+CHECK_dm_op_set_ioreq_server_batch;
+CHECK_dm_op_set_ioreq_server_bufioreq;
 
 int compat_dm_op(domid_t domid,
                  unsigned int nr_bufs,
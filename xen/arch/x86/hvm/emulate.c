@@ -22,10 +22,12 @@
 #include <asm/hvm/hvm.h>
 #include <asm/hvm/ioreq.h>
 #include <asm/hvm/monitor.h>
+#include <asm/hvm/nestedhvm.h>
 #include <asm/hvm/trace.h>
 #include <asm/hvm/support.h>
 #include <asm/hvm/svm/svm.h>
 #include <asm/vm_event.h>
+#include <public/hvm/dm_op.h>
 
 static void hvmtrace_io_assist(const ioreq_t *p)
 {
@@ -117,6 +119,23 @@ static const struct hvm_io_handler ioreq_server_handler = {
     .ops = &ioreq_server_ops
 };
 
+/*
+ * Number of (at most <reps>) repetitions of <size> bytes, starting at <gpa>
+ * and moving in the direction given by <df>, which stay within <nr_pages>
+ * guest pages.
+ */
+static unsigned long hvmemul_reps_in_pages(
+    paddr_t gpa, unsigned int size, bool_t df, unsigned long reps,
+    unsigned int nr_pages)
+{
+    unsigned long bytes = (nr_pages - 1) * PAGE_SIZE;
+    unsigned int page_off = gpa & ~PAGE_MASK;
+
+    bytes += df ? (page_off + size - 1) & ~PAGE_MASK : PAGE_SIZE - page_off;
+
+    return min(reps, bytes / size);
+}
+
 static int hvmemul_do_io(
     bool_t is_mmio, paddr_t addr, unsigned long *reps, unsigned int size,
     uint8_t dir, bool_t df, bool_t data_is_addr, uintptr_t data)
@@ -268,8 +287,33 @@ static int hvmemul_do_io(
             }
         }
 
-        if ( !s )
-            s = hvm_select_ioreq_server(currd, &p);
+        /*
+         * Multi-page buffers may have been set up because some server of
+         * the domain accepts them; don't hand them to others.  The range
+         * an MMIO access covers depends on its count, so the server needs
+         * choosing again whenever clipping the count to its limit changed
+         * it.  The count only ever shrinks, so this terminates.
+         */
+        for ( ; ; )
+        {
+            unsigned long count = p.count;
+            bool by_range = !s;
+
+            if ( by_range )
+                s = hvm_select_ioreq_server(currd, &p);
+
+            if ( s && data_is_addr && count > 1 )
+                count = hvmemul_reps_in_pages(p.data, size, df, count,
+                                              s->batch_pages) ?: 1;
+
+            if ( count == p.count )
+                break;
+
+            p.count = count;
+            if ( by_range )
+                s = NULL;
+        }
+        *reps = vio->io_req.count = p.count;
 
         /* If there is no suitable backing DM, just ignore accesses */
         if ( !s )
@@ -379,42 +423,47 @@ static int hvmemul_do_io_addr(
     unsigned int size, uint8_t dir, bool_t df, paddr_t ram_gpa)
 {
     struct vcpu *v = current;
-    unsigned long ram_gmfn = paddr_to_pfn(ram_gpa);
-    unsigned int page_off = ram_gpa & (PAGE_SIZE - 1);
-    struct page_info *ram_page[2];
+    struct page_info *ram_page[max(2, XEN_DMOP_IOREQ_BATCH_MAX_PAGES)];
     unsigned int nr_pages = 0;
-    unsigned long count;
+    unsigned long count, gmfn, last_gmfn;
     int rc;
 
-    rc = hvmemul_acquire_page(ram_gmfn, &ram_page[nr_pages]);
-    if ( rc != X86EMUL_OKAY )
-        goto out;
+    /*
+     * Determine how many reps will fit within the number of pages ioreq
+     * servers of the domain are prepared to deal with in one go.
+     */
+    count = hvmemul_reps_in_pages(
+        ram_gpa, size, df, *reps,
+        read_atomic(&v->domain->arch.hvm_domain.ioreq_server.batch_pages));
+
+    /*
+     * If none do, the access must span two pages, so do a single rep.
+     * It is safe to assume multiple pages are physically contiguous at
+     * this point as hvmemul_linear_to_phys() will ensure this is the case.
+     */
+    if ( count == 0 )
+        count = 1;
 
-    nr_pages++;
+    if ( df )
+    {
+        gmfn = paddr_to_pfn(ram_gpa - (count - 1) * size);
+        last_gmfn = paddr_to_pfn(ram_gpa + size - 1);
+    }
+    else
+    {
+        gmfn = paddr_to_pfn(ram_gpa);
+        last_gmfn = paddr_to_pfn(ram_gpa + count * size - 1);
+    }
 
-    /* Detemine how many reps will fit within this page */
-    count = min_t(unsigned long,
-                  *reps,
-                  df ?
-                  ((page_off + size - 1) & ~PAGE_MASK) / size :
-                  (PAGE_SIZE - page_off) / size);
+    ASSERT(last_gmfn - gmfn < ARRAY_SIZE(ram_page));
 
-    if ( count == 0 )
+    for ( ; gmfn <= last_gmfn; gmfn++ )
     {
-        /*
-         * This access must span two pages, so grab a reference to
-         * the next page and do a single rep.
-         * It is safe to assume multiple pages are physically
-         * contiguous at this point as hvmemul_linear_to_phys() will
-         * ensure this is the case.
-         */
-        rc = hvmemul_acquire_page(df ? ram_gmfn - 1 : ram_gmfn + 1,
-                                  &ram_page[nr_pages]);
+        rc = hvmemul_acquire_page(gmfn, &ram_page[nr_pages]);
         if ( rc != X86EMUL_OKAY )
             goto out;
 
         nr_pages++;
-        count = 1;
     }
 
     rc = hvmemul_do_io(is_mmio, addr, &count, size, dir, df, 1,
@@ -2266,7 +2315,23 @@ static int _hvm_emulate_one(struct hvm_emulate_ctxt *hvmemul_ctxt,
 
     vio->mmio_retry = 0;
 
-    rc = x86_emulate(&hvmemul_ctxt->ctxt, ops);
+    /*
+     * Try the fast path for plain moves first, unless the caller wants
+     * anything beyond the (trivially satisfied for them) memory access check.
+     */
+    rc = X86EMUL_UNIMPLEMENTED;
+    if ( ops == &hvm_emulate_ops &&
+         (!hvmemul_ctxt->validate ||
+          hvmemul_ctxt->validate == x86_insn_is_mem_access) )
+    {
+        rc = x86_emulate_simple(&hvmemul_ctxt->ctxt, ops);
+        if ( rc == X86EMUL_UNIMPLEMENTED )
+            perfc_incr(emul_simple_fallbacks);
+        else
+            perfc_incr(emul_simple_hits);
+    }
+    if ( rc == X86EMUL_UNIMPLEMENTED )
+        rc = x86_emulate(&hvmemul_ctxt->ctxt, ops);
     if ( rc == X86EMUL_OKAY && vio->mmio_retry )
         rc = X86EMUL_RETRY;
 
@@ -2451,6 +2516,131 @@ void hvm_emulate_init_once(
     hvmemul_ctxt->ctxt.regs = regs;
     hvmemul_ctxt->ctxt.vendor = curr->domain->arch.cpuid->x86_vendor;
     hvmemul_ctxt->ctxt.force_writeback = true;
+    hvmemul_ctxt->ctxt.decode_cache = curr->arch.hvm_vcpu.hvm_io.decode_cache;
+}
+
+/*
+ * Guests polling a device register emulate the same instruction over and
+ * over, each time walking the guest page tables to fetch it.  Remember which
+ * guest frame(s) the instruction bytes were found in, keyed by the linear
+ * address (i.e. CS base and RIP) and all state the translation depends upon
+ * (CR3 including PCID, paging mode, access rights).  The bytes themselves
+ * are re-read on every use, so modifications of the code are always seen.
+ * Like TLB entries, the translations are dropped on guest TLB flushes and
+ * INVLPG; changes of the p2m are observed through the per-use lookup.
+ *
+ * This relies on Xen seeing INVLPG and CR3 writes, i.e. on shadow paging.
+ * HAP guests flush their TLBs without exiting, so their translations must
+ * not outlive a VM exit, which the walk cache behind paging_gva_to_gfn()
+ * already takes care of.
+ */
+void hvm_emulate_insn_cache_flush(struct vcpu *v)
+{
+    struct hvm_vcpu_io *vio = &v->arch.hvm_vcpu.hvm_io;
+    unsigned int i;
+
+    for ( i = 0; i < ARRAY_SIZE(vio->insn_cache); i++ )
+        vio->insn_cache[i].valid = false;
+
+    perfc_incr(insn_cache_flushes);
+}
+
+static bool hvmemul_insn_cache_match(
+    const struct hvm_insn_cache *entry, const struct vcpu *v,
+    unsigned long linear, uint32_t pfec)
+{
+    return entry->valid && entry->linear == linear && entry->pfec == pfec &&
+           entry->cr3 == v->arch.hvm_vcpu.guest_cr[3] &&
+           entry->cr0 == v->arch.hvm_vcpu.guest_cr[0] &&
+           entry->cr4 == v->arch.hvm_vcpu.guest_cr[4] &&
+           entry->efer == v->arch.hvm_vcpu.guest_efer;
+}
+
+/* Read the instruction bytes at @linear through the given frames. */
+static bool hvmemul_insn_cache_read(void *buf, unsigned int bytes,
+                                    unsigned long linear, const gfn_t *gfn)
+{
+    unsigned int i, count;
+
+    for ( i = 0; bytes; i++, linear += count, buf += count, bytes -= count )
+    {
+        count = min(bytes, (unsigned int)(PAGE_SIZE - (linear & ~PAGE_MASK)));
+
+        if ( hvm_copy_from_guest_phys(buf, gfn_to_gaddr(gfn[i]) +
+                                           (linear & ~PAGE_MASK),
+                                      count) != HVMTRANS_okay )
+            return false;
+    }
+
+    return true;
+}
+
+static enum hvm_translation_result hvmemul_fetch_insn(
+    void *buf, unsigned int bytes, unsigned long linear, uint32_t pfec)
+{
+    struct vcpu *curr = current;
+    struct hvm_vcpu_io *vio = &curr->arch.hvm_vcpu.hvm_io;
+    struct hvm_insn_cache *entry;
+    gfn_t gfn[ARRAY_SIZE(entry->gfn)];
+    unsigned long addr = linear;
+    unsigned int i;
+
+    /* Translations of HAP and L2 guests aren't tracked here, see above. */
+    if ( hap_enabled(curr->domain) || nestedhvm_vcpu_in_guestmode(curr) )
+        return hvm_fetch_from_guest_linear(buf, linear, bytes, pfec, NULL);
+
+    for ( i = 0; i < ARRAY_SIZE(vio->insn_cache); i++ )
+    {
+        entry = &vio->insn_cache[i];
+        if ( !hvmemul_insn_cache_match(entry, curr, linear, pfec) )
+            continue;
+
+        if ( hvmemul_insn_cache_read(buf, bytes, linear, entry->gfn) )
+        {
+            perfc_incr(insn_cache_hits);
+            return HVMTRANS_okay;
+        }
+
+        entry->valid = false;
+        break;
+    }
+
+    perfc_incr(insn_cache_misses);
+
+    for ( i = 0; i < ARRAY_SIZE(gfn); i++ )
+    {
+        uint32_t walk_pfec = PFEC_page_present | PFEC_insn_fetch | pfec;
+
+        gfn[i] = INVALID_GFN;
+        if ( i && !((linear ^ (linear + bytes - 1)) & PAGE_MASK) )
+            continue;
+
+        gfn[i] = _gfn(paging_gva_to_gfn(curr, addr, &walk_pfec));
+        if ( gfn_eq(gfn[i], INVALID_GFN) )
+            break;
+        addr = (addr | ~PAGE_MASK) + 1;
+    }
+
+    /*
+     * Leave all faults, paged out or shared frames etc to the generic
+     * path, which knows how to report them.
+     */
+    if ( i < ARRAY_SIZE(gfn) ||
+         !hvmemul_insn_cache_read(buf, bytes, linear, gfn) )
+        return hvm_fetch_from_guest_linear(buf, linear, bytes, pfec, NULL);
+
+    entry = &vio->insn_cache[vio->insn_cache_next++ %
+                             ARRAY_SIZE(vio->insn_cache)];
+    entry->linear = linear;
+    entry->pfec = pfec;
+    entry->cr0 = curr->arch.hvm_vcpu.guest_cr[0];
+    entry->cr3 = curr->arch.hvm_vcpu.guest_cr[3];
+    entry->cr4 = curr->arch.hvm_vcpu.guest_cr[4];
+    entry->efer = curr->arch.hvm_vcpu.guest_efer;
+    memcpy(entry->gfn, gfn, sizeof(entry->gfn));
+    entry->valid = true;
+
+    return HVMTRANS_okay;
 }
 
 void hvm_emulate_init_per_insn(
@@ -2490,9 +2680,9 @@ void hvm_emulate_init_per_insn(
                                         hvm_access_insn_fetch,
                                         &hvmemul_ctxt->seg_reg[x86_seg_cs],
                                         &addr) &&
-             hvm_fetch_from_guest_linear(hvmemul_ctxt->insn_buf, addr,
-                                         sizeof(hvmemul_ctxt->insn_buf),
-                                         pfec, NULL) == HVMTRANS_okay) ?
+             hvmemul_fetch_insn(hvmemul_ctxt->insn_buf,
+                                sizeof(hvmemul_ctxt->insn_buf),
+                                addr, pfec) == HVMTRANS_okay) ?
             sizeof(hvmemul_ctxt->insn_buf) : 0;
     }
     else
@@ -462,6 +462,7 @@ void hvm_migrate_timers(struct vcpu *v)
 {
     rtc_migrate_timers(v);
     pt_migrate(v);
+    viridian_synic_migrate_timers(v);
 }
 
 static int hvm_migrate_pirq(struct domain *d, struct hvm_pirq_dpci *pirq_dpci,
@@ -1527,6 +1528,12 @@ int hvm_vcpu_initialise(struct vcpu *v)
     spin_lock_init(&v->arch.hvm_vcpu.tm_lock);
     INIT_LIST_HEAD(&v->arch.hvm_vcpu.tm_list);
 
+    spin_lock_init(&v->arch.hvm_vcpu.tlb_flush.lock);
+
+    /* Optional, emulation works without it. */
+    v->arch.hvm_vcpu.hvm_io.decode_cache =
+        xzalloc(struct x86_emulate_decode_cache);
+
     rc = hvm_vcpu_cacheattr_init(v); /* teardown: vcpu_cacheattr_destroy */
     if ( rc != 0 )
         goto fail1;
@@ -1558,6 +1565,10 @@ int hvm_vcpu_initialise(struct vcpu *v)
     if ( rc != 0 )
         goto fail6;
 
+    rc = viridian_vcpu_init(v); /* teardown: viridian_vcpu_deinit */
+    if ( rc != 0 )
+        goto fail7;
+
     if ( v->vcpu_id == 0 )
     {
         /* NB. All these really belong in hvm_domain_initialise(). */
@@ -1570,6 +1581,8 @@ int hvm_vcpu_initialise(struct vcpu *v)
 
     return 0;
 
+ fail7:
+    hvm_all_ioreq_servers_remove_vcpu(d, v);
  fail6:
     nestedhvm_vcpu_destroy(v);
  fail5:
@@ -1581,6 +1594,8 @@ int hvm_vcpu_initialise(struct vcpu *v)
  fail2:
     hvm_vcpu_cacheattr_destroy(v);
  fail1:
+    xfree(v->arch.hvm_vcpu.hvm_io.decode_cache);
+    v->arch.hvm_vcpu.hvm_io.decode_cache = NULL;
     return rc;
 }
 
@@ -1603,6 +1618,9 @@ void hvm_vcpu_destroy(struct vcpu *v)
     vlapic_destroy(v);
 
     hvm_vcpu_cacheattr_destroy(v);
+
+    xfree(v->arch.hvm_vcpu.hvm_io.decode_cache);
+    v->arch.hvm_vcpu.hvm_io.decode_cache = NULL;
 }
 
 void hvm_vcpu_down(struct vcpu *v)
@@ -4059,6 +4077,163 @@ static int hvmop_flush_tlb_all(void)
     return 0;
 }
 
+/* Queue a flush for @v, to be carried out by @v itself ahead of VM entry. */
+static void hvm_queue_tlb_flush(struct vcpu *v, const unsigned long *va,
+                                unsigned int nr)
+{
+    struct hvm_tlb_flush *f = &v->arch.hvm_vcpu.tlb_flush;
+    unsigned long flags;
+    unsigned int i;
+
+    spin_lock_irqsave(&f->lock, flags);
+
+    if ( nr == HVM_TLB_FLUSH_ALL || f->nr == HVM_TLB_FLUSH_ALL ||
+         f->nr + nr > ARRAY_SIZE(f->va) )
+        f->nr = HVM_TLB_FLUSH_ALL;
+    else
+        for ( i = 0; i < nr; i++ )
+            f->va[f->nr++] = va[i];
+
+    spin_unlock_irqrestore(&f->lock, flags);
+}
+
+void hvm_do_tlb_flush(struct vcpu *v)
+{
+    struct hvm_tlb_flush *f = &v->arch.hvm_vcpu.tlb_flush;
+    unsigned long flags;
+    unsigned int i;
+
+    ASSERT(v == current);
+
+    spin_lock_irqsave(&f->lock, flags);
+
+    if ( f->nr == HVM_TLB_FLUSH_ALL )
+        hvm_asid_flush_vcpu(v);
+    else if ( f->nr )
+    {
+        for ( i = 0; i < f->nr; i++ )
+            hvm_funcs.invlpg(v, f->va[i]);
+        hvm_emulate_insn_cache_flush(v);
+        paging_walk_cache_flush(v);
+    }
+    f->nr = 0;
+
+    spin_unlock_irqrestore(&f->lock, flags);
+}
+
+static bool hvm_flush_selects(const struct xen_hvm_flush_tlbs *op,
+                              const struct vcpu *v)
+{
+    return (op->flags & HVMOP_FLUSH_TLBS_ALL_VCPUS) ||
+           (v->vcpu_id < ARRAY_SIZE(op->vcpu_mask) * 64 &&
+            (op->vcpu_mask[v->vcpu_id / 64] & (1ULL << (v->vcpu_id % 64))));
+}
+
+/*
+ * Unlike hvmop_flush_tlb_all(), don't pause anyone: VCPUs not currently
+ * running pick up the flush before they next enter the guest, and running
+ * ones are kicked out of guest context and waited for.
+ */
+static int hvmop_flush_tlb(XEN_GUEST_HANDLE_PARAM(xen_hvm_flush_tlbs_t) uop)
+{
+    struct vcpu *curr = current, *v;
+    struct domain *d = curr->domain;
+    struct xen_hvm_flush_tlbs op;
+    unsigned long va[HVM_TLB_FLUSH_VAS];
+    cpumask_t *mask = this_cpu(scratch_cpumask);
+    unsigned int i, nr = 0, pages = 0;
+
+    if ( !is_hvm_domain(d) )
+        return -EINVAL;
+
+    if ( copy_from_guest(&op, uop, 1) )
+        return -EFAULT;
+
+    if ( (op.flags & ~HVMOP_FLUSH_TLBS_ALL_VCPUS) ||
+         op.nr_ranges > ARRAY_SIZE(op.range) )
+        return -EINVAL;
+
+    /* Out-of-sync shadows are dealt with by full flushes only. */
+    if ( !hap_enabled(d) )
+        return hvmop_flush_tlb_all();
+
+    /* Too many pages, or nested p2ms to deal with, make for a full flush. */
+    if ( !op.nr_ranges || nestedhvm_enabled(d) )
+        nr = HVM_TLB_FLUSH_ALL;
+
+    for ( i = 0; i < op.nr_ranges && nr != HVM_TLB_FLUSH_ALL; i++ )
+    {
+        unsigned long addr = op.range[i].va & PAGE_MASK;
+        uint64_t n;
+
+        /*
+         * Count non-canonical pages too, so the guest can't keep us looping
+         * over the address space hole.
+         */
+        if ( op.range[i].nr_pages > ARRAY_SIZE(va) - pages )
+        {
+            nr = HVM_TLB_FLUSH_ALL;
+            break;
+        }
+        pages += op.range[i].nr_pages;
+
+        for ( n = 0; n < op.range[i].nr_pages; n++, addr += PAGE_SIZE )
+            if ( is_canonical_address(addr) )
+                va[nr++] = addr;
+    }
+
+    if ( !nr )
+        return 0;
+
+    cpumask_clear(mask);
+
+    for_each_vcpu ( d, v )
+    {
+        if ( !hvm_flush_selects(&op, v) )
+            continue;
+
+        if ( v == curr )
+        {
+            if ( nr == HVM_TLB_FLUSH_ALL )
+                hvm_asid_flush_vcpu(v);
+            else
+                for ( i = 0; i < nr; i++ )
+                    paging_invlpg(v, va[i]);
+            continue;
+        }
+
+        hvm_queue_tlb_flush(v, va, nr);
+        if ( v->is_running )
+            __cpumask_set_cpu(v->processor, mask);
+    }
+
+    if ( !cpumask_empty(mask) )
+        smp_send_event_check_mask(mask);
+
+    /*
+     * Wait for running VCPUs to have done the flush, carrying out flushes
+     * queued for ourselves meanwhile, so that VCPUs flushing one another
+     * can't deadlock.  Anyone trying to pause us (hvmop_flush_tlb_all())
+     * gets to do so by way of restarting the hypercall.
+     */
+    for_each_vcpu ( d, v )
+    {
+        if ( v == curr || !hvm_flush_selects(&op, v) )
+            continue;
+
+        while ( ACCESS_ONCE(v->arch.hvm_vcpu.tlb_flush.nr) && v->is_running )
+        {
+            if ( ACCESS_ONCE(curr->arch.hvm_vcpu.tlb_flush.nr) )
+                hvm_do_tlb_flush(curr);
+            if ( softirq_pending(smp_processor_id()) )
+                return -ERESTART;
+            cpu_relax();
+        }
+    }
+
+    return 0;
+}
+
 static int hvmop_set_evtchn_upcall_vector(
     XEN_GUEST_HANDLE_PARAM(xen_hvm_evtchn_upcall_vector_t) uop)
 {
@@ -4872,7 +5047,9 @@ long do_hvm_op(unsigned long op, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
 
     case HVMOP_flush_tlbs:
-        rc = guest_handle_is_null(arg) ? hvmop_flush_tlb_all() : -EINVAL;
+        rc = guest_handle_is_null(arg)
+             ? hvmop_flush_tlb_all()
+             : hvmop_flush_tlb(guest_handle_cast(arg, xen_hvm_flush_tlbs_t));
         break;
 
     case HVMOP_get_mem_type:
@@ -23,6 +23,8 @@
 #include <xen/sched.h>
 #include <xen/irq.h>
 #include <xen/softirq.h>
+#include <xen/sort.h>
+#include <xen/vmap.h>
 #include <xen/domain.h>
 #include <xen/event.h>
 #include <xen/paging.h>
@@ -305,6 +307,10 @@ static int hvm_map_ioreq_gfn(struct hvm_ioreq_server *s, bool buf)
     if ( d->is_dying )
         return -EINVAL;
 
+    /* Multi-page rings can only be mapped as a resource. */
+    if ( buf && s->bufioreq_pages )
+        return -EOPNOTSUPP;
+
     if ( IS_DEFAULT(s) )
         iorp->gfn = _gfn(buf ?
                          d->arch.hvm_domain.params[HVM_PARAM_BUFIOREQ_PFN] :
@@ -324,6 +330,66 @@ static int hvm_map_ioreq_gfn(struct hvm_ioreq_server *s, bool buf)
     return rc;
 }
 
+static int hvm_alloc_bufioreq_ring(struct hvm_ioreq_server *s)
+{
+    struct hvm_ioreq_page *iorp = &s->bufioreq;
+    mfn_t mfn[ARRAY_SIZE(s->bufioreq_ring)];
+    unsigned int i;
+
+    for ( i = 0; i < s->bufioreq_pages; i++ )
+    {
+        /* See hvm_alloc_ioreq_mfn() as to the owner of the pages. */
+        struct page_info *page = alloc_domheap_page(s->emulator,
+                                                    MEMF_no_refcount);
+
+        if ( !page )
+            goto fail;
+
+        if ( !get_page_type(page, PGT_writable_page) )
+        {
+            put_page(page);
+            goto fail;
+        }
+
+        s->bufioreq_ring[i] = page;
+        mfn[i] = page_to_mfn(page);
+    }
+
+    iorp->va = vmap(mfn, s->bufioreq_pages);
+    if ( !iorp->va )
+        goto fail;
+
+    memset(iorp->va, 0, s->bufioreq_pages * PAGE_SIZE);
+    iorp->page = s->bufioreq_ring[0];
+
+    return 0;
+
+ fail:
+    while ( i-- )
+    {
+        put_page_and_type(s->bufioreq_ring[i]);
+        s->bufioreq_ring[i] = NULL;
+    }
+
+    return -ENOMEM;
+}
+
+static void hvm_free_bufioreq_ring(struct hvm_ioreq_server *s)
+{
+    struct hvm_ioreq_page *iorp = &s->bufioreq;
+    unsigned int i;
+
+    vunmap(iorp->va);
+    iorp->va = NULL;
+    iorp->page = NULL;
+
+    for ( i = 0; i < s->bufioreq_pages; i++ )
+    {
+        put_page_and_type(s->bufioreq_ring[i]);
+        s->bufioreq_ring[i] = NULL;
+    }
+}
+
 static int hvm_alloc_ioreq_mfn(struct hvm_ioreq_server *s, bool buf)
 {
     struct hvm_ioreq_page *iorp = buf ? &s->bufioreq : &s->ioreq;
@@ -341,6 +407,9 @@ static int hvm_alloc_ioreq_mfn(struct hvm_ioreq_server *s, bool buf)
         return 0;
     }
 
+    if ( buf && s->bufioreq_pages )
+        return hvm_alloc_bufioreq_ring(s);
+
     /*
      * Allocated IOREQ server pages are assigned to the emulating
      * domain, not the target domain. This is safe because the emulating
@@ -381,6 +450,12 @@ static void hvm_free_ioreq_mfn(struct hvm_ioreq_server *s, bool buf)
     if ( !iorp->page )
         return;
 
+    if ( buf && s->bufioreq_pages )
+    {
+        hvm_free_bufioreq_ring(s);
+        return;
+    }
+
     unmap_domain_page_global(iorp->va);
     iorp->va = NULL;
 
@@ -398,11 +473,16 @@ bool is_ioreq_server_page(struct domain *d, const struct page_info *page)
 
     FOR_EACH_IOREQ_SERVER(d, id, s)
     {
+        unsigned int i;
+
         if ( (s->ioreq.page == page) || (s->bufioreq.page == page) )
-        {
             found = true;
+
+        for ( i = 0; !found && i < s->bufioreq_pages; i++ )
+            found = s->bufioreq_ring[i] == page;
+
+        if ( found )
             break;
-        }
     }
 
     spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
@@ -732,6 +812,7 @@ static int hvm_ioreq_server_init(struct hvm_ioreq_server *s,
         return rc;
 
     s->bufioreq_handling = bufioreq_handling;
+    s->batch_pages = 1;
 
     if ( id == DEFAULT_IOSERVID )
     {
@@ -854,6 +935,232 @@ int hvm_create_ioreq_server(struct domain *d, bool is_default,
     return rc;
 }
 
+/*
+ * The index is rebuilt from the servers' rangesets whenever a range is
+ * mapped or unmapped, or a server changes state, so that the hot path in
+ * hvm_select_ioreq_server() can do a single binary search rather than
+ * walk every server's rangeset.
+ *
+ * Rebuilding is a sweep over the start and (exclusive) end points of all
+ * ranges, tracking the set of servers covering the current position. As
+ * servers are looked up newest first, each resulting interval is owned
+ * by the highest id in that set.
+ */
+struct ioreq_index_event {
+    uint64_t pos;
+    unsigned int id;
+    bool start;
+};
+
+struct ioreq_index_ctxt {
+    struct ioreq_index_event *ev;
+    unsigned int nr;
+    unsigned int id;
+};
+
+static int ioreq_index_count(unsigned long s, unsigned long e, void *arg)
+{
+    struct ioreq_index_ctxt *ctxt = arg;
+
+    ctxt->nr += 2;
+
+    return 0;
+}
+
+static int ioreq_index_add(unsigned long s, unsigned long e, void *arg)
+{
+    struct ioreq_index_ctxt *ctxt = arg;
+
+    ctxt->ev[ctxt->nr++] = (struct ioreq_index_event){
+        .pos = s, .id = ctxt->id, .start = true };
+    if ( e != ~0UL )
+        ctxt->ev[ctxt->nr++] = (struct ioreq_index_event){
+            .pos = e + 1, .id = ctxt->id };
+
+    return 0;
+}
+
+static int ioreq_index_cmp(const void *a, const void *b)
+{
+    const struct ioreq_index_event *l = a, *r = b;
+
+    return l->pos < r->pos ? -1 : l->pos > r->pos;
+}
+
+static void ioreq_index_swap(void *a, void *b, int size)
+{
+    struct ioreq_index_event t = *(struct ioreq_index_event *)a;
+
+    *(struct ioreq_index_event *)a = *(struct ioreq_index_event *)b;
+    *(struct ioreq_index_event *)b = t;
+}
+
+static struct hvm_ioreq_index *hvm_ioreq_index_build(struct domain *d,
+                                                     unsigned int type)
+{
+    struct ioreq_index_ctxt ctxt = { .nr = 0 };
+    struct hvm_ioreq_index *idx;
+    struct hvm_ioreq_server *s;
+    unsigned int id, i, mask = 0;
+
+    BUILD_BUG_ON(MAX_NR_IOREQ_SERVERS > sizeof(mask) * 8);
+
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+        if ( !IS_DEFAULT(s) && s->enabled )
+            rangeset_report_ranges(s->range[type], 0, ~0UL,
+                                   ioreq_index_count, &ctxt);
+
+    idx = _xzalloc(offsetof(struct hvm_ioreq_index, entry[ctxt.nr]),
+                   __alignof(*idx));
+    if ( !idx )
+        return NULL;
+    if ( !ctxt.nr )
+        return idx;
+
+    ctxt.ev = xmalloc_array(struct ioreq_index_event, ctxt.nr);
+    if ( !ctxt.ev )
+    {
+        xfree(idx);
+        return NULL;
+    }
+
+    ctxt.nr = 0;
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+        if ( !IS_DEFAULT(s) && s->enabled )
+        {
+            ctxt.id = id;
+            rangeset_report_ranges(s->range[type], 0, ~0UL,
+                                   ioreq_index_add, &ctxt);
+        }
+
+    sort(ctxt.ev, ctxt.nr, sizeof(*ctxt.ev), ioreq_index_cmp,
+         ioreq_index_swap);
+
+    for ( i = 0; i < ctxt.nr; )
+    {
+        uint64_t pos = ctxt.ev[i].pos, end;
+        struct hvm_ioreq_index_entry *prev = idx->nr ? &idx->entry[idx->nr - 1]
+                                                     : NULL;
+
+        for ( ; i < ctxt.nr && ctxt.ev[i].pos == pos; i++ )
+        {
+            if ( ctxt.ev[i].start )
+                mask |= 1u << ctxt.ev[i].id;
+            else
+                mask &= ~(1u << ctxt.ev[i].id);
+        }
+
+        if ( !mask )
+            continue;
+
+        s = GET_IOREQ_SERVER(d, fls(mask) - 1);
+        end = i < ctxt.nr ? ctxt.ev[i].pos - 1 : ~0ULL;
+
+        if ( prev && prev->s == s && prev->end + 1 == pos )
+            prev->end = end;
+        else
+            idx->entry[idx->nr++] = (struct hvm_ioreq_index_entry){
+                .start = pos, .end = end, .s = s };
+    }
+
+    xfree(ctxt.ev);
+
+    return idx;
+}
+
+/*
+ * Must be called with the ioreq_server lock held. Should the allocation
+ * fail the index for the type is dropped, which makes lookups fall back
+ * to walking the servers.
+ */
+static void hvm_ioreq_index_update(struct domain *d, unsigned int type)
+{
+    struct hvm_ioreq_index *idx = hvm_ioreq_index_build(d, type), *old;
+
+    perfc_incr(ioreq_index_rebuilds);
+
+    write_lock(&d->arch.hvm_domain.ioreq_server.index_lock);
+    old = d->arch.hvm_domain.ioreq_server.index[type];
+    d->arch.hvm_domain.ioreq_server.index[type] = idx;
+    write_unlock(&d->arch.hvm_domain.ioreq_server.index_lock);
+
+    xfree(old);
+}
+
+static void hvm_ioreq_index_update_all(struct domain *d)
+{
+    unsigned int type;
+
+    for ( type = 0; type < NR_IO_RANGE_TYPES; type++ )
+        hvm_ioreq_index_update(d, type);
+}
+
+/*
+ * Returns true if the index could resolve [start, end], in which case
+ * *srv is the owning server, or NULL if no server claims the range.
+ * Accesses straddling intervals owned by different servers, where one
+ * of them may still cover the whole range, are left to the caller.
+ */
+static bool hvm_ioreq_index_lookup(struct domain *d, unsigned int type,
+                                   uint64_t start, uint64_t end,
+                                   struct hvm_ioreq_server **srv)
+{
+    const struct hvm_ioreq_index *idx;
+    const struct hvm_ioreq_index_entry *e = NULL;
+    unsigned int lo = 0, hi;
+    bool found = false;
+
+    read_lock(&d->arch.hvm_domain.ioreq_server.index_lock);
+
+    idx = d->arch.hvm_domain.ioreq_server.index[type];
+    if ( !idx )
+        goto out;
+
+    /* Find the last interval starting at or below start. */
+    hi = idx->nr;
+    while ( lo < hi )
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+
+        perfc_incr(ioreq_index_probes);
+        if ( idx->entry[mid].start <= start )
+        {
+            e = &idx->entry[mid];
+            lo = mid + 1;
+        }
+        else
+            hi = mid;
+    }
+
+    if ( !e || e->end < start )
+    {
+        *srv = NULL;
+        found = true;
+    }
+    else if ( end <= e->end )
+    {
+        *srv = e->s;
+        found = true;
+    }
+
+ out:
+    read_unlock(&d->arch.hvm_domain.ioreq_server.index_lock);
+
+    return found;
+}
+
+/* Must be called with the ioreq_server lock held. */
+static void hvm_ioreq_update_batch_pages(struct domain *d)
+{
+    const struct hvm_ioreq_server *s;
+    unsigned int id, nr = 1;
+
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+        nr = max_t(unsigned int, nr, s->batch_pages);
+
+    write_atomic(&d->arch.hvm_domain.ioreq_server.batch_pages, nr);
+}
+
 int hvm_destroy_ioreq_server(struct domain *d, ioservid_t id)
 {
     struct hvm_ioreq_server *s;
@@ -890,6 +1197,8 @@ int hvm_destroy_ioreq_server(struct domain *d, ioservid_t id)
      */
     hvm_ioreq_server_deinit(s);
     set_ioreq_server(d, id, NULL);
+    hvm_ioreq_index_update_all(d);
+    hvm_ioreq_update_batch_pages(d);
 
     domain_unpause(d);
 
@@ -1001,6 +1310,18 @@ int hvm_get_ioreq_server_frame(struct domain *d, ioservid_t id,
         rc = 0;
         break;
 
+    case XENMEM_resource_ioreq_server_frame_bufioreq_ring(0) ...
+         XENMEM_resource_ioreq_server_frame_bufioreq_ring(
+             XEN_DMOP_BUFIOREQ_MAX_PAGES - 1):
+        idx -= XENMEM_resource_ioreq_server_frame_bufioreq_ring(0);
+        rc = -EINVAL;
+        if ( idx >= s->bufioreq_pages )
+            goto out;
+
+        *mfn = page_to_mfn(s->bufioreq_ring[idx]);
+        rc = 0;
+        break;
+
     default:
         rc = -EINVAL;
         break;
@@ -1062,6 +1383,8 @@ int hvm_map_io_range_to_ioreq_server(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_add_range(r, start, end);
+    if ( !rc )
+        hvm_ioreq_index_update(d, type);
 
  out:
     spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
@@ -1119,6 +1442,8 @@ int hvm_unmap_io_range_from_ioreq_server(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_remove_range(r, start, end);
+    if ( !rc )
+        hvm_ioreq_index_update(d, type);
 
  out:
     spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
@@ -1209,6 +1534,8 @@ int hvm_set_ioreq_server_state(struct domain *d, ioservid_t id,
     else
         hvm_ioreq_server_disable(s);
 
+    hvm_ioreq_index_update_all(d);
+
     domain_unpause(d);
 
     rc = 0;
@@ -1218,6 +1545,79 @@ int hvm_set_ioreq_server_state(struct domain *d, ioservid_t id,
     return rc;
 }
 
+int hvm_set_ioreq_server_batch(struct domain *d, ioservid_t id,
+                               unsigned int nr_pages)
+{
+    struct hvm_ioreq_server *s;
+    int rc;
+
+    if ( id == DEFAULT_IOSERVID )
+        return -EOPNOTSUPP;
+
+    spin_lock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
+
+    s = get_ioreq_server(d, id);
+
+    rc = -ENOENT;
+    if ( !s )
+        goto out;
+
+    ASSERT(!IS_DEFAULT(s));
+
+    rc = -EPERM;
+    if ( s->emulator != current->domain )
+        goto out;
+
+    s->batch_pages = nr_pages;
+    hvm_ioreq_update_batch_pages(d);
+
+    rc = 0;
+
+ out:
+    spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
+    return rc;
+}
+
+int hvm_set_ioreq_server_bufioreq(struct domain *d, ioservid_t id,
+                                  unsigned int nr_pages)
+{
+    struct hvm_ioreq_server *s;
+    int rc;
+
+    if ( id == DEFAULT_IOSERVID )
+        return -EOPNOTSUPP;
+
+    spin_lock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
+
+    s = get_ioreq_server(d, id);
+
+    rc = -ENOENT;
+    if ( !s )
+        goto out;
+
+    ASSERT(!IS_DEFAULT(s));
+
+    rc = -EPERM;
+    if ( s->emulator != current->domain )
+        goto out;
+
+    rc = -EINVAL;
+    if ( !HANDLE_BUFIOREQ(s) )
+        goto out;
+
+    /* The layout can't change under the feet of a consumer. */
+    rc = -EBUSY;
+    if ( s->enabled || s->bufioreq.page )
+        goto out;
+
+    s->bufioreq_pages = nr_pages;
+    rc = 0;
+
+ out:
+    spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
+    return rc;
+}
+
 int hvm_all_ioreq_servers_add_vcpu(struct domain *d, struct vcpu *v)
 {
     struct hvm_ioreq_server *s;
@@ -1291,6 +1691,12 @@ void hvm_destroy_all_ioreq_servers(struct domain *d)
         xfree(s);
     }
 
+    for ( id = 0; id < NR_IO_RANGE_TYPES; id++ )
+    {
+        xfree(d->arch.hvm_domain.ioreq_server.index[id]);
+        d->arch.hvm_domain.ioreq_server.index[id] = NULL;
+    }
+
     spin_unlock_recursive(&d->arch.hvm_domain.ioreq_server.lock);
 }
 
@@ -1300,7 +1706,7 @@ struct hvm_ioreq_server *hvm_select_ioreq_server(struct domain *d,
     struct hvm_ioreq_server *s;
     uint32_t cf8;
     uint8_t type;
-    uint64_t addr;
+    uint64_t addr, start, end;
     unsigned int id;
 
     if ( p->type != IOREQ_TYPE_COPY && p->type != IOREQ_TYPE_PIO )
@@ -1342,41 +1748,51 @@ struct hvm_ioreq_server *hvm_select_ioreq_server(struct domain *d,
         addr = p->addr;
     }
 
-    FOR_EACH_IOREQ_SERVER(d, id, s)
+    if ( type == XEN_DMOP_IO_RANGE_PCI )
+        start = end = addr >> 32;
+    else
     {
-        struct rangeset *r;
-
-        if ( IS_DEFAULT(s) || !s->enabled )
-            continue;
+        start = addr;
+        end = addr + p->size * (type == XEN_DMOP_IO_RANGE_PORT ? 1 : p->count)
+              - 1;
+    }
 
-        r = s->range[type];
+    if ( hvm_ioreq_index_lookup(d, type, start, end, &s) )
+    {
+        if ( !s )
+        {
+            perfc_incr(ioreq_index_misses);
+            return GET_IOREQ_SERVER(d, DEFAULT_IOSERVID);
+        }
 
-        switch ( type )
+        perfc_incr(ioreq_index_hits);
+        if ( type == XEN_DMOP_IO_RANGE_PCI )
         {
-            unsigned long end;
+            p->type = IOREQ_TYPE_PCI_CONFIG;
+            p->addr = addr;
+        }
 
-        case XEN_DMOP_IO_RANGE_PORT:
-            end = addr + p->size - 1;
-            if ( rangeset_contains_range(r, addr, end) )
-                return s;
+        return s;
+    }
 
-            break;
-        case XEN_DMOP_IO_RANGE_MEMORY:
-            end = addr + (p->size * p->count) - 1;
-            if ( rangeset_contains_range(r, addr, end) )
-                return s;
+    perfc_incr(ioreq_index_fallbacks);
 
-            break;
-        case XEN_DMOP_IO_RANGE_PCI:
-            if ( rangeset_contains_singleton(r, addr >> 32) )
-            {
-                p->type = IOREQ_TYPE_PCI_CONFIG;
-                p->addr = addr;
-                return s;
-            }
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+    {
+        if ( IS_DEFAULT(s) || !s->enabled )
+            continue;
 
-            break;
+        perfc_incr(ioreq_index_scans);
+        if ( !rangeset_contains_range(s->range[type], start, end) )
+            continue;
+
+        if ( type == XEN_DMOP_IO_RANGE_PCI )
+        {
+            p->type = IOREQ_TYPE_PCI_CONFIG;
+            p->addr = addr;
         }
+
+        return s;
     }
 
     return GET_IOREQ_SERVER(d, DEFAULT_IOSERVID);
@@ -1386,7 +1802,10 @@ static int hvm_send_buffered_ioreq(struct hvm_ioreq_server *s, ioreq_t *p)
 {
     struct domain *d = current->domain;
     struct hvm_ioreq_page *iorp;
-    buffered_iopage_t *pg;
+    buffered_ioring_t *ring = NULL;
+    union bufioreq_pointers *ptrs;
+    buf_ioreq_t *slot;
+    unsigned int nr_slots;
     buf_ioreq_t bp = { .data = p->data,
                        .addr = p->addr,
                        .type = p->type,
@@ -1396,13 +1815,30 @@ static int hvm_send_buffered_ioreq(struct hvm_ioreq_server *s, ioreq_t *p)
 
     /* Ensure buffered_iopage fits in a page */
     BUILD_BUG_ON(sizeof(buffered_iopage_t) > PAGE_SIZE);
+    BUILD_BUG_ON(offsetof(buffered_ioring_t, buf_ioreq) !=
+                 PAGE_SIZE - IOREQ_BUFFER_RING_SLOTS(1) * sizeof(bp));
 
     iorp = &s->bufioreq;
-    pg = iorp->va;
 
-    if ( !pg )
+    if ( !iorp->va )
         return X86EMUL_UNHANDLEABLE;
 
+    if ( s->bufioreq_pages )
+    {
+        ring = iorp->va;
+        ptrs = &ring->ptrs;
+        slot = ring->buf_ioreq;
+        nr_slots = IOREQ_BUFFER_RING_SLOTS(s->bufioreq_pages);
+    }
+    else
+    {
+        buffered_iopage_t *pg = iorp->va;
+
+        ptrs = &pg->ptrs;
+        slot = pg->buf_ioreq;
+        nr_slots = IOREQ_BUFFER_SLOT_NUM;
+    }
+
     /*
      * Return 0 for the cases we can't deal with:
      *  - 'addr' is only a 20-bit field, so we cannot address beyond 1MB
@@ -1436,40 +1872,54 @@ static int hvm_send_buffered_ioreq(struct hvm_ioreq_server *s, ioreq_t *p)
 
     spin_lock(&s->bufioreq_lock);
 
-    if ( (pg->ptrs.write_pointer - pg->ptrs.read_pointer) >=
-         (IOREQ_BUFFER_SLOT_NUM - qw) )
+    if ( (ptrs->write_pointer - ptrs->read_pointer) >= (nr_slots - qw) )
     {
         /* The queue is full: send the iopacket through the normal path. */
+        perfc_incr(bufioreq_overflows);
+        if ( ring )
+            ring->overflows++;
         spin_unlock(&s->bufioreq_lock);
         return X86EMUL_UNHANDLEABLE;
     }
 
-    pg->buf_ioreq[pg->ptrs.write_pointer % IOREQ_BUFFER_SLOT_NUM] = bp;
+    slot[ptrs->write_pointer % nr_slots] = bp;
 
     if ( qw )
     {
         bp.data = p->data >> 32;
-        pg->buf_ioreq[(pg->ptrs.write_pointer+1) % IOREQ_BUFFER_SLOT_NUM] = bp;
+        slot[(ptrs->write_pointer + 1) % nr_slots] = bp;
     }
 
     /* Make the ioreq_t visible /before/ write_pointer. */
     smp_wmb();
-    pg->ptrs.write_pointer += qw ? 2 : 1;
+    ptrs->write_pointer += qw ? 2 : 1;
+    perfc_incr(bufioreq_posted);
 
     /* Canonicalize read/write pointers to prevent their overflow. */
     while ( (s->bufioreq_handling == HVM_IOREQSRV_BUFIOREQ_ATOMIC) &&
-            qw++ < IOREQ_BUFFER_SLOT_NUM &&
-            pg->ptrs.read_pointer >= IOREQ_BUFFER_SLOT_NUM )
+            qw++ < nr_slots &&
+            ptrs->read_pointer >= nr_slots )
     {
-        union bufioreq_pointers old = pg->ptrs, new;
-        unsigned int n = old.read_pointer / IOREQ_BUFFER_SLOT_NUM;
+        union bufioreq_pointers old = *ptrs, new;
+        unsigned int n = old.read_pointer / nr_slots;
+
+        new.read_pointer = old.read_pointer - n * nr_slots;
+        new.write_pointer = old.write_pointer - n * nr_slots;
+        cmpxchg(&ptrs->full, old.full, new.full);
+    }
 
-        new.read_pointer = old.read_pointer - n * IOREQ_BUFFER_SLOT_NUM;
-        new.write_pointer = old.write_pointer - n * IOREQ_BUFFER_SLOT_NUM;
-        cmpxchg(&pg->ptrs.full, old.full, new.full);
+    /*
+     * Only signal a ring consumer which said it is waiting, the write
+     * pointer update being visible before its flag is looked at.
+     */
+    if ( ring )
+        smp_mb();
+    if ( !ring || (read_atomic(&ring->notify) && xchg(&ring->notify, 0)) )
+    {
+        perfc_incr(bufioreq_notifies);
+        notify_via_xen_event_channel(d, s->bufioreq_evtchn);
     }
 
-    notify_via_xen_event_channel(d, s->bufioreq_evtchn);
     spin_unlock(&s->bufioreq_lock);
 
     return X86EMUL_OKAY;
@@ -1568,6 +2018,8 @@ static int hvm_access_cf8(
 void hvm_ioreq_init(struct domain *d)
 {
     spin_lock_init(&d->arch.hvm_domain.ioreq_server.lock);
+    rwlock_init(&d->arch.hvm_domain.ioreq_server.index_lock);
+    d->arch.hvm_domain.ioreq_server.batch_pages = 1;
 
     register_portio_handler(d, 0xcf8, 4, hvm_access_cf8);
 }
@@ -1178,7 +1178,11 @@ void svm_vmenter_helper(const struct cpu_user_regs *regs)
     struct vcpu *curr = current;
     struct vmcb_struct *vmcb = curr->arch.hvm_svm.vmcb;
 
+    if ( unlikely(curr->arch.hvm_vcpu.tlb_flush.nr) )
+        hvm_do_tlb_flush(curr);
+
     svm_asid_handle_vmrun();
+    paging_walk_cache_flush(curr);
 
     if ( unlikely(tb_init_done) )
         HVMTRACE_ND(VMENTRY,
@@ -18,6 +18,7 @@
 #include <asm/paging.h>
 #include <asm/p2m.h>
 #include <asm/apic.h>
+#include <asm/event.h>
 #include <asm/hvm/support.h>
 #include <public/sched.h>
 #include <public/hvm/hvm_op.h>
@@ -165,12 +166,46 @@ typedef union _HV_CRASH_CTL_REG_CONTENTS
 } HV_CRASH_CTL_REG_CONTENTS;
 
 /* Viridian CPUID leaf 3, Hypervisor Feature Indication */
-#define CPUID3D_CRASH_MSRS (1 << 10)
+#define CPUID3D_CRASH_MSRS    (1 << 10)
+#define CPUID3D_DIRECT_STIMER (1 << 19)
 
 /* Viridian CPUID leaf 4: Implementation Recommendations. */
 #define CPUID4A_HCALL_REMOTE_TLB_FLUSH (1 << 2)
 #define CPUID4A_MSR_BASED_APIC         (1 << 3)
 #define CPUID4A_RELAX_TIMER_INT        (1 << 5)
+#define CPUID4A_DEPRECATE_AUTOEOI      (1 << 9)
+
+/* SynIC control MSR. */
+#define HV_SCONTROL_ENABLE 1
+
+/* Version reported through HV_X64_MSR_SVERSION. */
+#define HV_SYNIC_VERSION 1
+
+/*
+ * SynIC message slot layout, as in Microsoft Hypervisor Top-Level Functional
+ * Specification v5.0b, section 11.10. The message page holds one slot per
+ * SINT.
+ */
+#define HvMessageTypeNone     0x00000000
+#define HvMessageTimerExpired 0x80000010
+
+#define HV_MESSAGE_FLAG_PENDING 1
+
+typedef struct {
+    uint32_t MessageType;
+    uint8_t  PayloadSize;
+    uint8_t  MessageFlags;
+    uint16_t Reserved;
+    uint64_t OriginatorId;
+    uint64_t Payload[30];
+} HV_MESSAGE;
+
+typedef struct {
+    uint32_t TimerIndex;
+    uint32_t Reserved;
+    uint64_t ExpirationTime;
+    uint64_t DeliveryTime;
+} HV_TIMER_MESSAGE_PAYLOAD;
 
 /* Viridian CPUID leaf 6: Implementation HW features detected and in use. */
 #define CPUID6A_APIC_OVERLAY    (1 << 0)
@@ -254,6 +289,10 @@ void cpuid_viridian_leaves(const struct vcpu *v, uint32_t leaf,
             mask.AccessPartitionReferenceCounter = 1;
         if ( viridian_feature_mask(d) & HVMPV_reference_tsc )
             mask.AccessPartitionReferenceTsc = 1;
+        if ( viridian_feature_mask(d) & HVMPV_synic )
+            mask.AccessSynicRegs = 1;
+        if ( viridian_feature_mask(d) & HVMPV_stimer )
+            mask.AccessSyntheticTimerRegs = 1;
 
         u.mask = mask;
 
@@ -261,7 +300,9 @@ void cpuid_viridian_leaves(const struct vcpu *v, uint32_t leaf,
         res->b = u.hi;
 
         if ( viridian_feature_mask(d) & HVMPV_crash_ctl )
-            res->d = CPUID3D_CRASH_MSRS;
+            res->d |= CPUID3D_CRASH_MSRS;
+        if ( viridian_feature_mask(d) & HVMPV_stimer )
+            res->d |= CPUID3D_DIRECT_STIMER;
 
         break;
     }
@@ -276,6 +317,13 @@ void cpuid_viridian_leaves(const struct vcpu *v, uint32_t leaf,
             res->a |= CPUID4A_HCALL_REMOTE_TLB_FLUSH;
         if ( !cpu_has_vmx_apic_reg_virt )
             res->a |= CPUID4A_MSR_BASED_APIC;
+        /*
+         * Auto-EOI of SINTs can't be honoured when the hardware acknowledges
+         * interrupts on our behalf.
+         */
+        if ( (viridian_feature_mask(d) & HVMPV_synic) &&
+             vlapic_virtual_intr_delivery_enabled() )
+            res->a |= CPUID4A_DEPRECATE_AUTOEOI;
 
         /*
          * This value is the recommended number of attempts to try to
@@ -377,20 +425,12 @@ static void enable_hypercall_page(struct domain *d)
     put_page_and_type(page);
 }
 
-static void initialize_vp_assist(struct vcpu *v)
+/* Map a guest page overlaid by an enlightenment, for as long as it's used. */
+static void *map_overlay_page(struct domain *d, unsigned long gmfn)
 {
-    struct domain *d = v->domain;
-    unsigned long gmfn = v->arch.hvm_vcpu.viridian.vp_assist.msr.fields.pfn;
     struct page_info *page = get_page_from_gfn(d, gmfn, NULL, P2M_ALLOC);
     void *va;
 
-    ASSERT(!v->arch.hvm_vcpu.viridian.vp_assist.va);
-
-    /*
-     * See section 7.8.7 of the specification for details of this
-     * enlightenment.
-     */
-
     if ( !page )
         goto fail;
 
@@ -407,30 +447,53 @@ static void initialize_vp_assist(struct vcpu *v)
         goto fail;
     }
 
-    clear_page(va);
-
-    v->arch.hvm_vcpu.viridian.vp_assist.va = va;
-    return;
+    return va;
 
  fail:
     gdprintk(XENLOG_WARNING, "Bad GMFN %#"PRI_gfn" (MFN %#"PRI_mfn")\n", gmfn,
              mfn_x(page ? page_to_mfn(page) : INVALID_MFN));
+    return NULL;
+}
+
+static void unmap_overlay_page(void *va)
+{
+    struct page_info *page = mfn_to_page(domain_page_map_to_mfn(va));
+
+    unmap_domain_page_global(va);
+    put_page_and_type(page);
+}
+
+static void initialize_vp_assist(struct vcpu *v)
+{
+    void *va;
+
+    ASSERT(!v->arch.hvm_vcpu.viridian.vp_assist.va);
+
+    /*
+     * See section 7.8.7 of the specification for details of this
+     * enlightenment.
+     */
+
+    va = map_overlay_page(v->domain,
+                          v->arch.hvm_vcpu.viridian.vp_assist.msr.fields.pfn);
+    if ( !va )
+        return;
+
+    clear_page(va);
+
+    v->arch.hvm_vcpu.viridian.vp_assist.va = va;
 }
 
 static void teardown_vp_assist(struct vcpu *v)
 {
     void *va = v->arch.hvm_vcpu.viridian.vp_assist.va;
-    struct page_info *page;
 
     if ( !va )
         return;
 
     v->arch.hvm_vcpu.viridian.vp_assist.va = NULL;
 
-    page = mfn_to_page(domain_page_map_to_mfn(va));
-
-    unmap_domain_page_global(va);
-    put_page_and_type(page);
+    unmap_overlay_page(va);
 }
 
 void viridian_apic_assist_set(struct vcpu *v)
@@ -554,6 +617,424 @@ static void update_reference_tsc(struct domain *d, bool_t initialize)
     put_page_and_type(page);
 }
 
+static int64_t raw_trc_val(struct domain *d)
+{
+    uint64_t tsc;
+    struct time_scale tsc_to_ns;
+
+    tsc = hvm_get_guest_tsc(pt_global_vcpu_target(d));
+
+    /* convert tsc to count of 100ns periods */
+    set_time_scale(&tsc_to_ns, d->arch.tsc_khz * 1000ul);
+    return scale_delta(tsc, &tsc_to_ns) / 100ul;
+}
+
+/* Partition reference time, as seen by the guest, in 100ns units. */
+static uint64_t time_ref_count(struct domain *d)
+{
+    return raw_trc_val(d) + d->arch.hvm_domain.viridian.time_ref_count.off;
+}
+
+/*
+ * Synthetic interrupt controller. See chapter 11 of the specification.
+ *
+ * Only the message page is used by Xen itself, to post synthetic timer
+ * expiries. There are no event sources, so the event flags page is merely
+ * cleared when enabled.
+ */
+static void initialize_simp(struct vcpu *v, bool clear)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    void *va;
+
+    ASSERT(!vs->simp_va);
+
+    va = map_overlay_page(v->domain, vs->simp.fields.pfn);
+    if ( !va )
+        return;
+
+    if ( clear )
+        clear_page(va);
+
+    vs->simp_va = va;
+}
+
+static void teardown_simp(struct vcpu *v)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    void *va = vs ? vs->simp_va : NULL;
+
+    if ( !va )
+        return;
+
+    vs->simp_va = NULL;
+
+    unmap_overlay_page(va);
+}
+
+static void clear_siefp(struct vcpu *v)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    void *va = map_overlay_page(v->domain, vs->siefp.fields.pfn);
+
+    if ( !va )
+        return;
+
+    clear_page(va);
+    unmap_overlay_page(va);
+}
+
+static void synic_assert_sint(struct vcpu *v, unsigned int sintx)
+{
+    const union viridian_sint_msr *sint =
+        &v->arch.hvm_vcpu.viridian.synic->sint[sintx];
+
+    if ( sint->fields.mask || sint->fields.polling )
+        return;
+
+    vlapic_set_irq(vcpu_vlapic(v), sint->fields.vector, 0);
+}
+
+/*
+ * Post a timer expiry message into the slot of @sintx. Returns false if the
+ * slot is still occupied by an earlier message, in which case the guest is
+ * asked to signal end-of-message once it has consumed that one.
+ */
+static bool synic_post_timer_message(struct vcpu *v, unsigned int sintx,
+                                     unsigned int index, uint64_t expiration,
+                                     uint64_t delivery)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    const HV_TIMER_MESSAGE_PAYLOAD payload = {
+        .TimerIndex = index,
+        .ExpirationTime = expiration,
+        .DeliveryTime = delivery,
+    };
+    HV_MESSAGE *msg;
+
+    BUILD_BUG_ON(sizeof(*msg) * VIRIDIAN_SINT_COUNT != PAGE_SIZE);
+    BUILD_BUG_ON(sizeof(payload) > sizeof(msg->Payload));
+
+    /* Expiries can't be delivered without a message page, so drop them. */
+    if ( !(vs->scontrol & HV_SCONTROL_ENABLE) || !vs->simp_va )
+        return true;
+
+    msg = (HV_MESSAGE *)vs->simp_va + sintx;
+
+    if ( ACCESS_ONCE(msg->MessageType) != HvMessageTypeNone )
+    {
+        msg->MessageFlags |= HV_MESSAGE_FLAG_PENDING;
+        return false;
+    }
+
+    msg->PayloadSize = sizeof(payload);
+    msg->MessageFlags = 0;
+    msg->OriginatorId = 0;
+    memcpy(msg->Payload, &payload, sizeof(payload));
+
+    /* The message type must become visible last. */
+    smp_wmb();
+    msg->MessageType = HvMessageTimerExpired;
+
+    synic_assert_sint(v, sintx);
+
+    return true;
+}
+
+bool viridian_synic_is_auto_eoi_sint(const struct vcpu *v, unsigned int vector)
+{
+    const struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int i;
+
+    if ( !vs || !(vs->scontrol & HV_SCONTROL_ENABLE) )
+        return false;
+
+    for ( i = 0; i < ARRAY_SIZE(vs->sint); i++ )
+    {
+        const union viridian_sint_msr *sint = &vs->sint[i];
+
+        if ( !sint->fields.mask && sint->fields.auto_eoi &&
+             sint->fields.vector == vector )
+            return true;
+    }
+
+    return false;
+}
+
+/*
+ * Synthetic timers. See chapter 12 of the specification.
+ *
+ * Expiration times are in partition reference time. The Xen timers backing
+ * them merely prompt re-evaluation in the context of the vCPU, where
+ * expiries are delivered either as SynIC messages or, in direct mode, as
+ * plain APIC interrupts.
+ */
+
+/* Cap on how far ahead a Xen timer is armed (in 100ns units). */
+#define STIMER_MAX_DELTA (1ull << 40)
+
+static void stimer_expire(void *data)
+{
+    struct viridian_stimer *vst = data;
+    struct vcpu *v = vst->v;
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+
+    set_bit(vst - vs->stimer, &vs->stimer_pending);
+    vcpu_kick(v);
+}
+
+static void stimer_arm(struct viridian_stimer *vst, uint64_t now)
+{
+    uint64_t delta = vst->expiration > now ? vst->expiration - now : 0;
+
+    set_timer(&vst->timer,
+              NOW() + min_t(uint64_t, delta, STIMER_MAX_DELTA) * 100);
+}
+
+static void stimer_stop(struct viridian_synic *vs, unsigned int index)
+{
+    stop_timer(&vs->stimer[index].timer);
+    clear_bit(index, &vs->stimer_pending);
+}
+
+/* (Re-)start timer @index according to its configuration and count. */
+static void stimer_reset(struct vcpu *v, unsigned int index)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    struct viridian_stimer *vst = &vs->stimer[index];
+    uint64_t now;
+
+    stimer_stop(vs, index);
+
+    if ( !vst->config.fields.enabled )
+        return;
+
+    /* A timer with a count of zero can't be enabled. */
+    if ( !vst->count )
+    {
+        vst->config.fields.enabled = 0;
+        return;
+    }
+
+    now = time_ref_count(v->domain);
+
+    /* The count is a period for periodic timers, an absolute time else. */
+    vst->expiration = vst->config.fields.periodic ? now + vst->count
+                                                  : vst->count;
+
+    stimer_arm(vst, now);
+}
+
+static void stimer_poll(struct vcpu *v, unsigned int index)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    struct viridian_stimer *vst = &vs->stimer[index];
+    uint64_t now = time_ref_count(v->domain);
+
+    if ( !vst->config.fields.enabled )
+        return;
+
+    /* Reference time doesn't advance while the domain is paused. */
+    if ( now < vst->expiration )
+    {
+        stimer_arm(vst, now);
+        return;
+    }
+
+    if ( vst->config.fields.direct_mode )
+        vlapic_set_irq(vcpu_vlapic(v), vst->config.fields.vector, 0);
+    else if ( !synic_post_timer_message(v, vst->config.fields.sintx, index,
+                                        vst->expiration, now) )
+    {
+        /* Try again on the next way into the guest. */
+        set_bit(index, &vs->stimer_pending);
+        return;
+    }
+
+    perfc_incr(mshv_stimer_expired);
+
+    if ( !vst->config.fields.periodic )
+    {
+        vst->config.fields.enabled = 0;
+        return;
+    }
+
+    /*
+     * Missed periods are not made up for, irrespective of the timer being
+     * lazy or not: the guest can tell from the reference time anyway.
+     */
+    vst->expiration += vst->count;
+    if ( vst->expiration <= now )
+        vst->expiration = now + vst->count;
+
+    stimer_arm(vst, now);
+}
+
+/* Deliver expired synthetic timers. Called ahead of interrupt injection. */
+void viridian_synic_poll(struct vcpu *v)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int i;
+
+    if ( !vs || !vs->stimer_pending || v != current )
+        return;
+
+    for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+        if ( test_and_clear_bit(i, &vs->stimer_pending) )
+            stimer_poll(v, i);
+}
+
+void viridian_synic_migrate_timers(struct vcpu *v)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int i;
+
+    if ( !vs )
+        return;
+
+    for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+        migrate_timer(&vs->stimer[i].timer, v->processor);
+}
+
+static int wrmsr_synic(struct vcpu *v, uint32_t idx, uint64_t val)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+
+    perfc_incr(mshv_wrmsr_synic);
+
+    switch ( idx )
+    {
+    case HV_X64_MSR_SCONTROL:
+        vs->scontrol = val;
+        break;
+
+    case HV_X64_MSR_SIEFP:
+        vs->siefp.raw = val;
+        if ( vs->siefp.fields.enabled )
+            clear_siefp(v);
+        break;
+
+    case HV_X64_MSR_SIMP:
+        teardown_simp(v); /* release any previous mapping */
+        vs->simp.raw = val;
+        if ( vs->simp.fields.enabled )
+            initialize_simp(v, true);
+        break;
+
+    case HV_X64_MSR_EOM:
+        /*
+         * Expiries which found their slot occupied remain pending, and are
+         * re-tried ahead of the next interrupt injection anyway.
+         */
+        break;
+
+    case HV_X64_MSR_SINT0 ... HV_X64_MSR_SINT15:
+    {
+        union viridian_sint_msr sint = { .raw = val };
+
+        if ( !sint.fields.mask && sint.fields.vector < 0x10 )
+            return 0;
+
+        vs->sint[idx - HV_X64_MSR_SINT0] = sint;
+        break;
+    }
+
+    default:
+        return 0;
+    }
+
+    return 1;
+}
+
+static int rdmsr_synic(const struct vcpu *v, uint32_t idx, uint64_t *val)
+{
+    const struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+
+    perfc_incr(mshv_rdmsr_synic);
+
+    switch ( idx )
+    {
+    case HV_X64_MSR_SCONTROL:
+        *val = vs->scontrol;
+        break;
+
+    case HV_X64_MSR_SVERSION:
+        *val = HV_SYNIC_VERSION;
+        break;
+
+    case HV_X64_MSR_SIEFP:
+        *val = vs->siefp.raw;
+        break;
+
+    case HV_X64_MSR_SIMP:
+        *val = vs->simp.raw;
+        break;
+
+    case HV_X64_MSR_EOM:
+        *val = 0;
+        break;
+
+    case HV_X64_MSR_SINT0 ... HV_X64_MSR_SINT15:
+        *val = vs->sint[idx - HV_X64_MSR_SINT0].raw;
+        break;
+
+    default:
+        return 0;
+    }
+
+    return 1;
+}
+
+static int wrmsr_stimer(struct vcpu *v, uint32_t idx, uint64_t val)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int index = (idx - HV_X64_MSR_STIMER0_CONFIG) / 2;
+    struct viridian_stimer *vst = &vs->stimer[index];
+
+    perfc_incr(mshv_wrmsr_stimer);
+
+    if ( !((idx - HV_X64_MSR_STIMER0_CONFIG) & 1) )
+    {
+        union viridian_stimer_config_msr config = { .raw = val };
+
+        if ( config.fields.enabled && config.fields.direct_mode &&
+             config.fields.vector < 0x10 )
+            return 0;
+
+        config.fields.reserved_zero1 = 0;
+        config.fields.reserved_zero2 = 0;
+        vst->config = config;
+    }
+    else
+    {
+        vst->count = val;
+
+        if ( !vst->count )
+            vst->config.fields.enabled = 0;
+        else if ( vst->config.fields.auto_enable )
+            vst->config.fields.enabled = 1;
+    }
+
+    stimer_reset(v, index);
+
+    return 1;
+}
+
+static int rdmsr_stimer(const struct vcpu *v, uint32_t idx, uint64_t *val)
+{
+    const struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int index = (idx - HV_X64_MSR_STIMER0_CONFIG) / 2;
+
+    perfc_incr(mshv_rdmsr_stimer);
+
+    if ( !((idx - HV_X64_MSR_STIMER0_CONFIG) & 1) )
+        *val = vs->stimer[index].config.raw;
+    else
+        *val = vs->stimer[index].count;
+
+    return 1;
+}
+
 int wrmsr_viridian_regs(uint32_t idx, uint64_t val)
 {
     struct vcpu *v = current;
@@ -654,6 +1135,23 @@ int wrmsr_viridian_regs(uint32_t idx, uint64_t val)
         break;
     }
 
+    case HV_X64_MSR_SCONTROL:
+    case HV_X64_MSR_SVERSION:
+    case HV_X64_MSR_SIEFP:
+    case HV_X64_MSR_SIMP:
+    case HV_X64_MSR_EOM:
+    case HV_X64_MSR_SINT0 ... HV_X64_MSR_SINT15:
+        if ( !(viridian_feature_mask(d) & HVMPV_synic) )
+            return 0;
+
+        return wrmsr_synic(v, idx, val);
+
+    case HV_X64_MSR_STIMER0_CONFIG ... HV_X64_MSR_STIMER3_COUNT:
+        if ( !(viridian_feature_mask(d) & HVMPV_stimer) )
+            return 0;
+
+        return wrmsr_stimer(v, idx, val);
+
     default:
         if ( idx >= VIRIDIAN_MSR_MIN && idx <= VIRIDIAN_MSR_MAX )
             gprintk(XENLOG_WARNING, "write to unimplemented MSR %#x\n",
@@ -665,18 +1163,6 @@ int wrmsr_viridian_regs(uint32_t idx, uint64_t val)
     return 1;
 }
 
-static int64_t raw_trc_val(struct domain *d)
-{
-    uint64_t tsc;
-    struct time_scale tsc_to_ns;
-
-    tsc = hvm_get_guest_tsc(pt_global_vcpu_target(d));
-
-    /* convert tsc to count of 100ns periods */
-    set_time_scale(&tsc_to_ns, d->arch.tsc_khz * 1000ul);
-    return scale_delta(tsc, &tsc_to_ns) / 100ul;
-}
-
 void viridian_time_ref_count_freeze(struct domain *d)
 {
     struct viridian_time_ref_count *trc;
@@ -803,6 +1289,23 @@ int rdmsr_viridian_regs(uint32_t idx, uint64_t *val)
         break;
     }
 
+    case HV_X64_MSR_SCONTROL:
+    case HV_X64_MSR_SVERSION:
+    case HV_X64_MSR_SIEFP:
+    case HV_X64_MSR_SIMP:
+    case HV_X64_MSR_EOM:
+    case HV_X64_MSR_SINT0 ... HV_X64_MSR_SINT15:
+        if ( !(viridian_feature_mask(d) & HVMPV_synic) )
+            return 0;
+
+        return rdmsr_synic(v, idx, val);
+
+    case HV_X64_MSR_STIMER0_CONFIG ... HV_X64_MSR_STIMER3_COUNT:
+        if ( !(viridian_feature_mask(d) & HVMPV_stimer) )
+            return 0;
+
+        return rdmsr_stimer(v, idx, val);
+
     default:
         if ( idx >= VIRIDIAN_MSR_MIN && idx <= VIRIDIAN_MSR_MAX )
             gprintk(XENLOG_WARNING, "read from unimplemented MSR %#x\n",
@@ -814,9 +1317,47 @@ int rdmsr_viridian_regs(uint32_t idx, uint64_t *val)
     return 1;
 }
 
+int viridian_vcpu_init(struct vcpu *v)
+{
+    struct viridian_synic *vs = xzalloc(struct viridian_synic);
+    unsigned int i;
+
+    if ( !vs )
+        return -ENOMEM;
+
+    for ( i = 0; i < ARRAY_SIZE(vs->sint); i++ )
+        vs->sint[i].fields.mask = 1;
+
+    for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+    {
+        struct viridian_stimer *vst = &vs->stimer[i];
+
+        vst->v = v;
+        init_timer(&vst->timer, stimer_expire, vst, v->processor);
+    }
+
+    v->arch.hvm_vcpu.viridian.synic = vs;
+
+    return 0;
+}
+
 void viridian_vcpu_deinit(struct vcpu *v)
 {
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int i;
+
     teardown_vp_assist(v);
+
+    if ( !vs )
+        return;
+
+    teardown_simp(v);
+
+    for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+        kill_timer(&vs->stimer[i].timer);
+
+    v->arch.hvm_vcpu.viridian.synic = NULL;
+    xfree(vs);
 }
 
 void viridian_domain_deinit(struct domain *d)
@@ -824,7 +1365,10 @@ void viridian_domain_deinit(struct domain *d)
     struct vcpu *v;
 
     for_each_vcpu ( d, v )
+    {
         teardown_vp_assist(v);
+        teardown_simp(v);
+    }
 }
 
 static DEFINE_PER_CPU(cpumask_t, ipi_cpumask);
@@ -1034,10 +1578,31 @@ static int viridian_save_vcpu_ctxt(struct domain *d, hvm_domain_context_t *h)
         return 0;
 
     for_each_vcpu( d, v ) {
+        const struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
         struct hvm_viridian_vcpu_context ctxt = {
             .vp_assist_msr = v->arch.hvm_vcpu.viridian.vp_assist.msr.raw,
             .vp_assist_pending = v->arch.hvm_vcpu.viridian.vp_assist.pending,
         };
+        unsigned int i;
+
+        if ( vs )
+        {
+            ctxt.scontrol_msr = vs->scontrol;
+            ctxt.siefp_msr = vs->siefp.raw;
+            ctxt.simp_msr = vs->simp.raw;
+
+            BUILD_BUG_ON(ARRAY_SIZE(ctxt.sint_msr) != ARRAY_SIZE(vs->sint));
+            for ( i = 0; i < ARRAY_SIZE(vs->sint); i++ )
+                ctxt.sint_msr[i] = vs->sint[i].raw;
+
+            BUILD_BUG_ON(ARRAY_SIZE(ctxt.stimer_config_msr) !=
+                         ARRAY_SIZE(vs->stimer));
+            for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+            {
+                ctxt.stimer_config_msr[i] = vs->stimer[i].config.raw;
+                ctxt.stimer_count_msr[i] = vs->stimer[i].count;
+            }
+        }
 
         if ( hvm_save_entry(VIRIDIAN_VCPU, v->vcpu_id, h, &ctxt) != 0 )
             return 1;
@@ -1046,6 +1611,54 @@ static int viridian_save_vcpu_ctxt(struct domain *d, hvm_domain_context_t *h)
     return 0;
 }
 
+static void load_synic_ctxt(struct vcpu *v,
+                            const struct hvm_viridian_vcpu_context *ctxt)
+{
+    struct viridian_synic *vs = v->arch.hvm_vcpu.viridian.synic;
+    unsigned int i;
+
+    vs->scontrol = ctxt->scontrol_msr;
+    vs->siefp.raw = ctxt->siefp_msr;
+
+    teardown_simp(v);
+    vs->simp.raw = ctxt->simp_msr;
+    if ( vs->simp.fields.enabled )
+        initialize_simp(v, false);
+
+    /* Records lacking SynIC state leave all SINTs unmasked at vector 0. */
+    for ( i = 0; i < ARRAY_SIZE(vs->sint); i++ )
+    {
+        vs->sint[i].raw = ctxt->sint_msr[i];
+        if ( vs->sint[i].fields.vector < 0x10 )
+            vs->sint[i].fields.mask = 1;
+    }
+
+    /*
+     * Reference time isn't valid until the domain gets unpaused, so leave
+     * it to the first poll to re-arm running timers. The phase of periodic
+     * timers isn't saved; they are deemed to have expired.
+     */
+    for ( i = 0; i < ARRAY_SIZE(vs->stimer); i++ )
+    {
+        struct viridian_stimer *vst = &vs->stimer[i];
+
+        stimer_stop(vs, i);
+
+        vst->config.raw = ctxt->stimer_config_msr[i];
+        vst->count = ctxt->stimer_count_msr[i];
+
+        if ( vst->config.fields.direct_mode &&
+             vst->config.fields.vector < 0x10 )
+            vst->config.fields.enabled = 0;
+
+        if ( !vst->config.fields.enabled )
+            continue;
+
+        vst->expiration = vst->config.fields.periodic ? 0 : vst->count;
+        set_bit(i, &vs->stimer_pending);
+    }
+}
+
 static int viridian_load_vcpu_ctxt(struct domain *d, hvm_domain_context_t *h)
 {
     int vcpuid;
@@ -1073,6 +1686,8 @@ static int viridian_load_vcpu_ctxt(struct domain *d, hvm_domain_context_t *h)
 
     v->arch.hvm_vcpu.viridian.vp_assist.pending = !!ctxt.vp_assist_pending;
 
+    load_synic_ctxt(v, &ctxt);
+
     return 0;
 }
 
@@ -1271,6 +1271,8 @@ int vlapic_has_pending_irq(struct vcpu *v)
     struct vlapic *vlapic = vcpu_vlapic(v);
     int irr, isr;
 
+    viridian_synic_poll(v);
+
     if ( !vlapic_enabled(vlapic) )
         return -1;
 
@@ -1319,6 +1321,14 @@ int vlapic_ack_pending_irq(struct vcpu *v, int vector, bool_t force_ack)
          vlapic_virtual_intr_delivery_enabled() )
         return 1;
 
+    /* Auto-EOI SINT vectors never enter the ISR. */
+    if ( has_viridian_synic(v->domain) &&
+         viridian_synic_is_auto_eoi_sint(v, vector) )
+    {
+        vlapic_clear_irr(vector, vlapic);
+        return 1;
+    }
+
     /* If there's no chance of using APIC assist then bail now. */
     if ( !has_viridian_apic_assist(v->domain) ||
          vlapic_test_vector(vector, &vlapic->regs->data[APIC_TMR]) )
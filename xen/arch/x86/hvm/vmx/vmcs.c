@@ -1510,7 +1510,7 @@ void vmx_vcpu_flush_pml_buffer(struct vcpu *v)
         p2m_change_type_one(v->domain, gfn, p2m_ram_logdirty, p2m_ram_rw);
 
         /* HVM guest: pfn == gfn */
-        paging_mark_pfn_dirty(v->domain, _pfn(gfn));
+        paging_mark_pfn_dirty_vcpu(v, _pfn(gfn));
     }
 
     unmap_domain_page(pml_buf);
@@ -4232,6 +4232,9 @@ bool vmx_vmenter_helper(const struct cpu_user_regs *regs)
     if ( curr->domain->arch.hvm_domain.pi_ops.do_resume )
         curr->domain->arch.hvm_domain.pi_ops.do_resume(curr);
 
+    if ( unlikely(curr->arch.hvm_vcpu.tlb_flush.nr) )
+        hvm_do_tlb_flush(curr);
+
     if ( !cpu_has_vmx_vpid )
         goto out;
     if ( nestedhvm_vcpu_in_guestmode(curr) )
@@ -4281,6 +4284,8 @@ bool vmx_vmenter_helper(const struct cpu_user_regs *regs)
     }
 
  out:
+    paging_walk_cache_flush(curr);
+
     if ( unlikely(curr->arch.hvm_vmx.lbr_fixup_enabled) )
         lbr_fixup();
 
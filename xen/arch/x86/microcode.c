@@ -30,7 +30,9 @@
 #include <xen/smp.h>
 #include <xen/softirq.h>
 #include <xen/spinlock.h>
+#include <xen/stop_machine.h>
 #include <xen/tasklet.h>
+#include <xen/time.h>
 #include <xen/guest_access.h>
 #include <xen/earlycpio.h>
 
@@ -186,18 +188,56 @@ static DEFINE_SPINLOCK(microcode_mutex);
 
 DEFINE_PER_CPU(struct ucode_cpu_info, ucode_cpu_info);
 
+/*
+ * Late updates are staged by each CPU in turn, in normal context, and then
+ * loaded by one thread of each core, on all cores at once, under
+ * stop_machine_run().  In dry-run mode nothing is loaded: the rendezvous is
+ * timed, and the expected stall reported.
+ */
+static bool_t __read_mostly opt_ucode_dry_run;
+boolean_runtime_only_param("ucode_dry_run", opt_ucode_dry_run);
+
+static bool_t update_in_progress;
+
+/* Slowest core load of the last late update, for dry-run estimates. */
+static s_time_t last_core_load;
+
+/*
+ * Staged patch of each CPU; once loaded, the patch it replaced.  Not kept
+ * in per-CPU data, which goes away with CPUs going offline meanwhile.
+ */
+static void *staged_patch[NR_CPUS];
+
+struct ucode_late {
+    int result;     /* 0 while loading, 1 once loaded, or -errno. */
+    bool loaded;    /* Loaded by this CPU, rather than by a sibling. */
+    s_time_t time;  /* Time taken to load. */
+};
+static DEFINE_PER_CPU(struct ucode_late, ucode_late);
+
 struct microcode_info {
     unsigned int cpu;
     uint32_t buffer_size;
     int error;
+    bool dry_run;
+    s_time_t start;
+    cpumask_t staged;
     char buffer[1];
 };
 
+static void free_patch(void *mc)
+{
+    if ( microcode_ops->free_patch )
+        microcode_ops->free_patch(mc);
+    else
+        xfree(mc);
+}
+
 static void __microcode_fini_cpu(unsigned int cpu)
 {
     struct ucode_cpu_info *uci = &per_cpu(ucode_cpu_info, cpu);
 
-    xfree(uci->mc.mc_valid);
+    free_patch(uci->mc.mc_valid);
     memset(uci, 0, sizeof(*uci));
 }
 
@@ -262,6 +302,7 @@ int microcode_resume_cpu(unsigned int cpu)
     return err;
 }
 
+/* Early loading: stage and load on the current CPU. */
 static int microcode_update_cpu(const void *buf, size_t size)
 {
     int err;
@@ -272,7 +313,13 @@ static int microcode_update_cpu(const void *buf, size_t size)
 
     err = microcode_ops->collect_cpu_info(cpu, &uci->cpu_sig);
     if ( likely(!err) )
+    {
         err = microcode_ops->cpu_request_microcode(cpu, buf, size);
+        if ( err > 0 )
+            err = microcode_ops->apply_microcode(cpu);
+        if ( microcode_ops->end_update_percpu )
+            microcode_ops->end_update_percpu();
+    }
     else
         __microcode_fini_cpu(cpu);
 
@@ -281,6 +328,205 @@ static int microcode_update_cpu(const void *buf, size_t size)
     return err;
 }
 
+/*
+ * Late loading: stage a patch for the current CPU in staged_patch[], leaving
+ * the one in use in ucode_cpu_info.  Returns 1 if a patch was staged.
+ */
+static int microcode_stage_cpu(const void *buf, size_t size)
+{
+    int err;
+    unsigned int cpu = smp_processor_id();
+    struct ucode_cpu_info *uci = &per_cpu(ucode_cpu_info, cpu);
+    void *cur;
+
+    spin_lock(&microcode_mutex);
+
+    err = microcode_ops->collect_cpu_info(cpu, &uci->cpu_sig);
+    if ( unlikely(err) )
+    {
+        __microcode_fini_cpu(cpu);
+        spin_unlock(&microcode_mutex);
+        return err;
+    }
+
+    cur = uci->mc.mc_valid;
+    uci->mc.mc_valid = NULL;
+    err = microcode_ops->cpu_request_microcode(cpu, buf, size);
+    staged_patch[cpu] = uci->mc.mc_valid;
+    uci->mc.mc_valid = cur;
+
+    if ( err <= 0 )
+    {
+        free_patch(staged_patch[cpu]);
+        staged_patch[cpu] = NULL;
+        if ( microcode_ops->end_update_percpu )
+            microcode_ops->end_update_percpu();
+    }
+
+    spin_unlock(&microcode_mutex);
+
+    return err;
+}
+
+/* Runs on all CPUs at once, under stop_machine_run(). */
+static int microcode_apply(void *data)
+{
+    const struct microcode_info *info = data;
+    unsigned int cpu = smp_processor_id(), first;
+    struct ucode_cpu_info *uci = &per_cpu(ucode_cpu_info, cpu);
+    struct ucode_late *late = &this_cpu(ucode_late);
+    void *cur = uci->mc.mc_valid;
+    s_time_t start;
+    int err = 0;
+
+    if ( !cpumask_test_cpu(cpu, &info->staged) )
+        return 0;
+
+    /* Only the first staged thread of each core loads the patch... */
+    for_each_cpu ( first, per_cpu(cpu_sibling_mask, cpu) )
+        if ( cpumask_test_cpu(first, &info->staged) )
+            break;
+
+    /* ... and its siblings check whether that updated them too. */
+    if ( first != cpu )
+    {
+        while ( !(err = read_atomic(&per_cpu(ucode_late, first).result)) )
+            cpu_relax();
+        smp_rmb();
+
+        microcode_ops->collect_cpu_info(cpu, &uci->cpu_sig);
+        if ( err > 0 &&
+             uci->cpu_sig.rev == per_cpu(ucode_cpu_info, first).cpu_sig.rev )
+        {
+            uci->mc.mc_valid = staged_patch[cpu];
+            staged_patch[cpu] = cur;
+            err = 0;
+            goto out;
+        }
+    }
+
+    start = NOW();
+    uci->mc.mc_valid = staged_patch[cpu];
+    err = microcode_ops->apply_microcode(cpu);
+    late->time = NOW() - start;
+    late->loaded = true;
+
+    if ( err )
+        uci->mc.mc_valid = cur;
+    else
+        staged_patch[cpu] = cur;
+
+ out:
+    if ( microcode_ops->end_update_percpu )
+        microcode_ops->end_update_percpu();
+
+    smp_wmb();
+    write_atomic(&late->result, err ?: 1);
+
+    return err;
+}
+
+/* Free what microcode_apply() left behind, or patches not loaded at all. */
+static void microcode_drop_staged(void)
+{
+    unsigned int cpu;
+
+    for ( cpu = 0; cpu < nr_cpu_ids; cpu++ )
+    {
+        free_patch(staged_patch[cpu]);
+        staged_patch[cpu] = NULL;
+    }
+}
+
+/* Used in dry-run mode, to time the rendezvous alone. */
+static int microcode_nop(void *data)
+{
+    return 0;
+}
+
+static int microcode_late_load(struct microcode_info *info)
+{
+    unsigned int cpu, first, nr_cpus = 0, nr_cores = 0;
+    unsigned int nr_updated = 0, nr_loads = 0;
+    s_time_t stage = NOW() - info->start, stall, max_load = 0;
+    int rc;
+
+    /* CPUs must neither come nor go between here and the end of the load. */
+    if ( !get_cpu_maps() )
+    {
+        microcode_drop_staged();
+        return -EBUSY;
+    }
+
+    cpumask_and(&info->staged, &info->staged, &cpu_online_map);
+
+    for_each_cpu ( cpu, &info->staged )
+    {
+        struct ucode_late *late = &per_cpu(ucode_late, cpu);
+
+        late->result = 0;
+        late->loaded = false;
+        late->time = 0;
+
+        nr_cpus++;
+        for_each_cpu ( first, per_cpu(cpu_sibling_mask, cpu) )
+            if ( cpumask_test_cpu(first, &info->staged) )
+                break;
+        if ( first == cpu )
+            nr_cores++;
+    }
+
+    stall = NOW();
+    rc = stop_machine_run(info->dry_run ? microcode_nop : microcode_apply,
+                          info, NR_CPUS);
+    stall = NOW() - stall;
+
+    for_each_cpu ( cpu, &info->staged )
+    {
+        const struct ucode_late *late = &per_cpu(ucode_late, cpu);
+
+        if ( late->result > 0 )
+            nr_updated++;
+        if ( late->loaded )
+        {
+            nr_loads++;
+            max_load = max(max_load, late->time);
+        }
+    }
+
+    microcode_drop_staged();
+    put_cpu_maps();
+
+    if ( info->dry_run )
+    {
+        printk(XENLOG_INFO "microcode: dry run: %u CPUs on %u cores to "
+               "update, staged in %"PRI_stime"ms, rendezvous %"PRI_stime
+               "us\n", nr_cpus, nr_cores, stage / MILLISECS(1),
+               stall / MICROSECS(1));
+        if ( last_core_load )
+            printk(XENLOG_INFO "microcode: expected stall %"PRI_stime
+                   "us (last slowest core load %"PRI_stime"us)\n",
+                   (stall + last_core_load) / MICROSECS(1),
+                   last_core_load / MICROSECS(1));
+        else
+            printk(XENLOG_INFO "microcode: expected stall %"PRI_stime
+                   "us plus one core load, not timed yet\n",
+                   stall / MICROSECS(1));
+        return rc;
+    }
+
+    if ( nr_loads )
+        last_core_load = max_load;
+
+    printk(XENLOG_INFO "microcode: updated %u of %u CPUs with %u loads on %u "
+           "cores, staged in %"PRI_stime"ms, stalled %"PRI_stime"us, slowest "
+           "load %"PRI_stime"us\n", nr_updated, nr_cpus, nr_loads, nr_cores,
+           stage / MILLISECS(1), stall / MICROSECS(1),
+           max_load / MICROSECS(1));
+
+    return rc;
+}
+
 static long do_microcode_update(void *_info)
 {
     struct microcode_info *info = _info;
@@ -288,16 +534,31 @@ static long do_microcode_update(void *_info)
 
     BUG_ON(info->cpu != smp_processor_id());
 
-    error = microcode_update_cpu(info->buffer, info->buffer_size);
-    if ( error )
+    error = microcode_stage_cpu(info->buffer, info->buffer_size);
+    if ( error < 0 )
         info->error = error;
+    else if ( error > 0 )
+        cpumask_set_cpu(info->cpu, &info->staged);
 
     info->cpu = cpumask_next(info->cpu, &cpu_online_map);
     if ( info->cpu < nr_cpu_ids )
-        return continue_hypercall_on_cpu(info->cpu, do_microcode_update, info);
+    {
+        error = continue_hypercall_on_cpu(info->cpu, do_microcode_update, info);
+        if ( !error )
+            return 0;
+        info->error = error;
+        microcode_drop_staged();
+    }
+    else if ( !cpumask_empty(&info->staged) )
+    {
+        error = microcode_late_load(info);
+        if ( error && !info->error )
+            info->error = error;
+    }
 
     error = info->error;
     xfree(info);
+    update_in_progress = 0;
     return error;
 }
 
@@ -312,32 +573,42 @@ int microcode_update(XEN_GUEST_HANDLE_PARAM(const_void) buf, unsigned long len)
     if ( microcode_ops == NULL )
         return -EINVAL;
 
+    if ( test_and_set_bool(update_in_progress) )
+        return -EBUSY;
+
     info = xmalloc_bytes(sizeof(*info) + len);
     if ( info == NULL )
-        return -ENOMEM;
+    {
+        ret = -ENOMEM;
+        goto out;
+    }
 
     ret = copy_from_guest(info->buffer, buf, len);
     if ( ret != 0 )
-    {
-        xfree(info);
-        return ret;
-    }
+        goto out;
 
     info->buffer_size = len;
     info->error = 0;
+    info->dry_run = opt_ucode_dry_run;
+    info->start = NOW();
+    cpumask_clear(&info->staged);
     info->cpu = cpumask_first(&cpu_online_map);
 
-    if ( microcode_ops->start_update )
+    if ( microcode_ops->start_update && !info->dry_run )
     {
         ret = microcode_ops->start_update();
         if ( ret != 0 )
-        {
-            xfree(info);
-            return ret;
-        }
+            goto out;
     }
 
-    return continue_hypercall_on_cpu(info->cpu, do_microcode_update, info);
+    ret = continue_hypercall_on_cpu(info->cpu, do_microcode_update, info);
+    if ( ret == 0 )
+        return 0;
+
+ out:
+    xfree(info);
+    update_in_progress = 0;
+    return ret;
 }
 
 static int __init microcode_init(void)
@@ -74,9 +74,6 @@ struct mpbhdr {
     uint8_t data[];
 };
 
-/* serialize access to the physical write */
-static DEFINE_SPINLOCK(microcode_update_lock);
-
 /* See comment in start_update() for cases when this routine fails */
 static int collect_cpu_info(unsigned int cpu, struct cpu_signature *csig)
 {
@@ -192,7 +189,6 @@ static bool_t microcode_fits(const struct microcode_amd *mc_amd,
 
 static int apply_microcode(unsigned int cpu)
 {
-    unsigned long flags;
     struct ucode_cpu_info *uci = &per_cpu(ucode_cpu_info, cpu);
     uint32_t rev;
     struct microcode_amd *mc_amd = uci->mc.mc_amd;
@@ -209,15 +205,12 @@ static int apply_microcode(unsigned int cpu)
     if ( hdr == NULL )
         return -EINVAL;
 
-    spin_lock_irqsave(&microcode_update_lock, flags);
-
+    /* Late updates run this on all cores at once: see microcode_apply(). */
     hw_err = wrmsr_safe(MSR_AMD_PATCHLOADER, (unsigned long)hdr);
 
     /* get patch id after patching */
     rdmsrl(MSR_AMD_PATCHLEVEL, rev);
 
-    spin_unlock_irqrestore(&microcode_update_lock, flags);
-
     /* check current patch id and patch's id for match */
     if ( hw_err || (rev != hdr->patch_id) )
     {
@@ -306,6 +299,8 @@ static int install_equiv_cpu_table(
         return -EINVAL;
     }
 
+    /* Replace the table of a previous, non-matching container. */
+    xfree(mc_amd->equiv_cpu_table);
     mc_amd->equiv_cpu_table = xmalloc_bytes(mpbuf->len);
     if ( !mc_amd->equiv_cpu_table )
     {
@@ -388,12 +383,25 @@ static bool_t check_final_patch_levels(unsigned int cpu)
     return 0;
 }
 
+static void free_patch(void *mc)
+{
+    struct microcode_amd *mc_amd = mc;
+
+    if ( mc_amd )
+    {
+        xfree(mc_amd->equiv_cpu_table);
+        xfree(mc_amd->mpb);
+        xfree(mc_amd);
+    }
+}
+
 static int cpu_request_microcode(unsigned int cpu, const void *buf,
                                  size_t bufsize)
 {
     struct microcode_amd *mc_amd, *mc_old;
     size_t offset = 0;
-    size_t last_offset, applied_offset = 0;
+    size_t last_offset, staged_offset = 0;
+    uint32_t staged_id = 0;
     int error = 0, save_error = 1;
     struct ucode_cpu_info *uci = &per_cpu(ucode_cpu_info, cpu);
     unsigned int current_cpu_id;
@@ -419,7 +427,7 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
         goto out;
     }
 
-    mc_amd = xmalloc(struct microcode_amd);
+    mc_amd = xzalloc(struct microcode_amd);
     if ( !mc_amd )
     {
         printk(KERN_ERR "microcode: Cannot allocate memory for microcode patch\n");
@@ -473,7 +481,7 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
 
     if ( error )
     {
-        xfree(mc_amd);
+        free_patch(mc_amd);
         goto out;
     }
 
@@ -491,12 +499,12 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
     while ( (error = get_ucode_from_buffer_amd(mc_amd, buf, bufsize,
                                                &offset)) == 0 )
     {
-        if ( microcode_fits(mc_amd, cpu) )
+        const struct microcode_header_amd *hdr = mc_amd->mpb;
+
+        if ( microcode_fits(mc_amd, cpu) && hdr->patch_id > staged_id )
         {
-            error = apply_microcode(cpu);
-            if ( error )
-                break;
-            applied_offset = last_offset;
+            staged_offset = last_offset;
+            staged_id = hdr->patch_id;
         }
 
         last_offset = offset;
@@ -512,8 +520,7 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
          *    file and we break)
          * 3. Proceed to while ( (error = get_ucode_from_buffer_amd(mc_amd,
          *                                  buf, bufsize,&offset)) == 0 )
-         * 4. Find correct patch using microcode_fits() and apply the patch
-         *    (Assume: apply_microcode() is successful)
+         * 4. Find correct patch using microcode_fits() and stage the patch
          * 5. The while() loop from (3) continues to parse the binary as
          *    there is a subsequent container file, but...
          * 6. ...a correct patch can only be on one container and not on any
@@ -529,13 +536,11 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
             break;
     }
 
-    /* On success keep the microcode patch for
-     * re-apply on resume.
-     */
-    if ( applied_offset )
+    /* Keep the newest fitting patch, for loading and re-apply on resume. */
+    if ( staged_offset )
     {
         save_error = get_ucode_from_buffer_amd(
-            mc_amd, buf, bufsize, &applied_offset);
+            mc_amd, buf, bufsize, &staged_offset);
 
         if ( save_error )
             error = save_error;
@@ -543,21 +548,16 @@ static int cpu_request_microcode(unsigned int cpu, const void *buf,
 
     if ( save_error )
     {
-        xfree(mc_amd);
+        free_patch(mc_amd);
         uci->mc.mc_amd = mc_old;
     }
     else
-        xfree(mc_old);
+    {
+        free_patch(mc_old);
+        error = 1;
+    }
 
   out:
-    svm_host_osvw_init();
-
-    /*
-     * In some cases we may return an error even if processor's microcode has
-     * been updated. For example, the first patch in a container file is loaded
-     * successfully but subsequent container file processing encounters a
-     * failure.
-     */
     return error;
 }
 
@@ -572,23 +572,18 @@ static int microcode_resume_match(unsigned int cpu, const void *mc)
 
     if ( src != mc_amd )
     {
-        if ( mc_amd )
-        {
-            xfree(mc_amd->equiv_cpu_table);
-            xfree(mc_amd->mpb);
-            xfree(mc_amd);
-        }
+        free_patch(mc_amd);
 
-        mc_amd = xmalloc(struct microcode_amd);
+        mc_amd = xzalloc(struct microcode_amd);
         uci->mc.mc_amd = mc_amd;
         if ( !mc_amd )
             return -ENOMEM;
         mc_amd->equiv_cpu_table = xmalloc_bytes(src->equiv_cpu_table_size);
         if ( !mc_amd->equiv_cpu_table )
-            goto err1;
+            goto err;
         mc_amd->mpb = xmalloc_bytes(src->mpb_size);
         if ( !mc_amd->mpb )
-            goto err2;
+            goto err;
 
         mc_amd->equiv_cpu_table_size = src->equiv_cpu_table_size;
         mc_amd->mpb_size = src->mpb_size;
@@ -599,10 +594,8 @@ static int microcode_resume_match(unsigned int cpu, const void *mc)
 
     return 1;
 
-err2:
-    xfree(mc_amd->equiv_cpu_table);
-err1:
-    xfree(mc_amd);
+err:
+    free_patch(mc_amd);
     uci->mc.mc_amd = NULL;
     return -ENOMEM;
 }
@@ -611,10 +604,10 @@ static int start_update(void)
 {
     /*
      * We assume here that svm_host_osvw_init() will be called on each cpu (from
-     * cpu_request_microcode()).
+     * end_update_percpu()).
      *
      * Note that if collect_cpu_info() returns an error then
-     * cpu_request_microcode() will not invoked thus leaving OSVW bits not
+     * end_update_percpu() will not invoked thus leaving OSVW bits not
      * updated. Currently though collect_cpu_info() will not fail on processors
      * supporting OSVW so we will not deal with this possibility.
      */
@@ -623,12 +616,19 @@ static int start_update(void)
     return 0;
 }
 
+static void end_update_percpu(void)
+{
+    svm_host_osvw_init();
+}
+
 static const struct microcode_ops microcode_amd_ops = {
     .microcode_resume_match           = microcode_resume_match,
     .cpu_request_microcode            = cpu_request_microcode,
     .collect_cpu_info                 = collect_cpu_info,
     .apply_microcode                  = apply_microcode,
     .start_update                     = start_update,
+    .end_update_percpu                = end_update_percpu,
+    .free_patch                       = free_patch,
 };
 
 int __init microcode_init_amd(void)
@@ -123,6 +123,7 @@
 #include <asm/io_apic.h>
 #include <asm/pci.h>
 #include <asm/guest.h>
+#include <asm/hvm/emulate.h>
 #include <asm/hvm/ioreq.h>
 
 #include <asm/hvm/grant_table.h>
@@ -4343,6 +4344,51 @@ int arch_acquire_resource(struct domain *d, unsigned int type,
         break;
     }
 
+    case XENMEM_resource_dirty_ring:
+    {
+        unsigned int i;
+
+        rc = 0;
+        for ( i = 0; i < nr_frames; i++ )
+        {
+            mfn_t mfn;
+
+            rc = paging_get_dirty_ring_frame(d, id, frame + i, &mfn);
+            if ( rc )
+                break;
+
+            mfn_list[i] = mfn_x(mfn);
+        }
+
+        /* As for ioreq servers, the frames belong to the caller. */
+        *flags |= XENMEM_rsrc_acq_caller_owned;
+        break;
+    }
+
+    case XENMEM_resource_log_dirty_bitmap:
+    {
+        unsigned int i;
+
+        rc = -EINVAL;
+        if ( id )
+            break;
+
+        rc = 0;
+        for ( i = 0; i < nr_frames; i++ )
+        {
+            mfn_t mfn;
+
+            rc = paging_get_log_dirty_frame(d, frame + i, &mfn);
+            if ( rc )
+                break;
+
+            mfn_list[i] = mfn_x(mfn);
+        }
+
+        *flags |= XENMEM_rsrc_acq_caller_owned;
+        break;
+    }
+
     default:
         rc = -EOPNOTSUPP;
         break;
@@ -5731,6 +5777,12 @@ void paging_invlpg(struct vcpu *v, unsigned long va)
     if ( !is_canonical_address(va) )
         return;
 
+    if ( is_hvm_vcpu(v) )
+    {
+        hvm_emulate_insn_cache_flush(v);
+        paging_walk_cache_flush(v);
+    }
+
     if ( paging_mode_enabled(v->domain) &&
          !paging_get_hostmode(v)->invlpg(v, va) )
         return;
@@ -36,6 +36,8 @@
 #include <asm/altp2m.h>
 #include <asm/atomic.h>
 #include <asm/event.h>
+#include <asm/hvm/save.h>
+#include <asm/time.h>
 #include <xsm/xsm.h>
 
 #include "mm-locks.h"
@@ -1002,21 +1004,18 @@ err_out:
     return ret;
 }
 
-int mem_sharing_add_to_physmap(struct domain *sd, unsigned long sgfn, shr_handle_t sh,
-                            struct domain *cd, unsigned long cgfn) 
+/*
+ * Map the shared page at sgfn of sd at the hole at cgfn of cd.  Both gfns
+ * need to be locked by the caller, which passes in what it found there.
+ */
+static int add_to_physmap(mfn_t smfn, p2m_type_t smfn_type, shr_handle_t sh,
+                          struct domain *cd, unsigned long cgfn, mfn_t cmfn,
+                          p2m_type_t cmfn_type, p2m_access_t a)
 {
     struct page_info *spage;
-    int ret = -EINVAL;
-    mfn_t smfn, cmfn;
-    p2m_type_t smfn_type, cmfn_type;
+    int ret;
     struct gfn_info *gfn_info;
     struct p2m_domain *p2m = p2m_get_hostp2m(cd);
-    p2m_access_t a;
-    struct two_gfns tg;
-
-    get_two_gfns(sd, sgfn, &smfn_type, NULL, &smfn,
-                 cd, cgfn, &cmfn_type, &a, &cmfn,
-                 0, &tg);
 
     /* Get the source shared page, check and lock */
     ret = XENMEM_SHARING_OP_S_HANDLE_INVALID;
@@ -1076,7 +1075,26 @@ int mem_sharing_add_to_physmap(struct domain *sd, unsigned long sgfn, shr_handle
 err_unlock:
     mem_sharing_page_unlock(spage);
 err_out:
+    return ret;
+}
+
+int mem_sharing_add_to_physmap(struct domain *sd, unsigned long sgfn, shr_handle_t sh,
+                            struct domain *cd, unsigned long cgfn)
+{
+    mfn_t smfn, cmfn;
+    p2m_type_t smfn_type, cmfn_type;
+    p2m_access_t a;
+    struct two_gfns tg;
+    int ret;
+
+    get_two_gfns(sd, sgfn, &smfn_type, NULL, &smfn,
+                 cd, cgfn, &cmfn_type, &a, &cmfn,
+                 0, &tg);
+
+    ret = add_to_physmap(smfn, smfn_type, sh, cd, cgfn, cmfn, cmfn_type, a);
+
     put_two_gfns(&tg);
+
     return ret;
 }
 
@@ -1256,6 +1274,15 @@ int relinquish_shared_pages(struct domain *d)
     }
 
     p2m_unlock(p2m);
+
+    /* A fork no longer needs its parent once its memory is gone. */
+    if ( !rc && d->arch.hvm_domain.fork_parent )
+    {
+        domain_unpause(d->arch.hvm_domain.fork_parent);
+        put_domain(d->arch.hvm_domain.fork_parent);
+        d->arch.hvm_domain.fork_parent = NULL;
+    }
+
     return rc;
 }
 
@@ -1310,6 +1337,343 @@ static int range_share(struct domain *d, struct domain *cd,
     return rc;
 }
 
+/*
+ * Find the closest ancestor of fork d mapping RAM at gfn, without locking
+ * the gfn.  NULL if there's none.
+ */
+static struct domain *fork_ancestor(struct domain *d, gfn_t gfn, mfn_t *mfn,
+                                    p2m_type_t *p2mt)
+{
+    struct domain *parent;
+
+    for ( parent = d->arch.hvm_domain.fork_parent; parent;
+          parent = parent->arch.hvm_domain.fork_parent )
+    {
+        /*
+         * The p2m of an ancestor being destroyed may still map frames which
+         * relinquish_memory() already freed.
+         */
+        if ( parent->is_dying )
+            return NULL;
+
+        *mfn = get_gfn_query_unlocked(parent, gfn_x(gfn), p2mt);
+        if ( mfn_valid(*mfn) && p2m_is_ram(*p2mt) )
+            break;
+    }
+
+    return parent;
+}
+
+/*
+ * Populate a gfn of a fork from its parent, or with nested forks from the
+ * closest ancestor mapping it.  Reads share the ancestor's page, while writes,
+ * and pages which can't be shared, get a private copy.  The fork's gfn must
+ * be locked (once) by the caller; it gets dropped and re-taken meanwhile.
+ */
+int mem_sharing_fork_page(struct domain *d, gfn_t gfn, bool unsharing)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d), *pp2m;
+    struct domain *parent;
+    struct page_info *page, *ppage;
+    struct two_gfns tg;
+    shr_handle_t handle;
+    p2m_type_t p2mt, cp2mt;
+    p2m_access_t a, pa;
+    mfn_t mfn, cmfn;
+    int rc;
+
+    ASSERT(gfn_locked_by_me(p2m, gfn_x(gfn)));
+
+    /*
+     * Taking the ancestor's gfn lock while holding ours would deadlock
+     * against get_two_gfns() on the two, e.g. from sharing ops, which takes
+     * them the other way around.  So ours needs dropping first, which isn't
+     * possible if the caller took it more than once.
+     */
+    if ( p2m->lock.recurse_count != 1 )
+        return -EBUSY;
+
+    parent = fork_ancestor(d, gfn, &mfn, &p2mt);
+    if ( !parent )
+        return -ENOENT;
+
+    pp2m = p2m_get_hostp2m(parent);
+
+    put_gfn(d, gfn_x(gfn));
+    get_two_gfns(parent, gfn_x(gfn), &p2mt, NULL, &mfn,
+                 d, gfn_x(gfn), &cp2mt, &a, &cmfn, 0, &tg);
+
+    /* Another vCPU may have populated the gfn while it wasn't locked. */
+    rc = 0;
+    if ( !p2m_is_hole(cp2mt) )
+        goto out;
+
+    rc = -ENOENT;
+    if ( !mfn_valid(mfn) || !p2m_is_ram(p2mt) )
+        goto out;
+
+    if ( !unsharing && !nominate_page(parent, gfn, 0, &handle) )
+    {
+        /* The ancestor's entry now is a shared one. */
+        mfn = pp2m->get_entry(pp2m, gfn, &p2mt, &pa, 0, NULL, NULL);
+        rc = add_to_physmap(mfn, p2mt, handle, d, gfn_x(gfn), cmfn, cp2mt, a);
+        if ( !rc )
+            goto out;
+    }
+
+    /*
+     * Xen heap pages (shared info, grant table frames) can't be copied.  Hold
+     * a reference to the page copied, for the ancestor to not free it under
+     * our feet.
+     */
+    rc = -ENOENT;
+    if ( !mfn_valid(mfn) || !p2m_is_ram(p2mt) || is_xen_heap_mfn(mfn_x(mfn)) )
+        goto out;
+    ppage = mfn_to_page(mfn);
+    if ( !get_page(ppage, p2m_is_shared(p2mt) ? dom_cow : parent) )
+        goto out;
+
+    rc = -ENOMEM;
+    page = alloc_domheap_page(d, 0);
+    if ( !page )
+    {
+        put_page(ppage);
+        goto out;
+    }
+
+    copy_domain_page(page_to_mfn(page), mfn);
+    put_page(ppage);
+
+    rc = p2m->set_entry(p2m, gfn, page_to_mfn(page), PAGE_ORDER_4K,
+                        p2m_ram_rw, p2m->default_access, -1);
+    if ( rc )
+    {
+        if ( test_and_clear_bit(_PGC_allocated, &page->count_info) )
+            put_page(page);
+        goto out;
+    }
+
+    set_gpfn_from_mfn(mfn_x(page_to_mfn(page)), gfn_x(gfn));
+
+ out:
+    put_two_gfns(&tg);
+    gfn_lock(p2m, gfn_x(gfn), 0);
+
+    return rc;
+}
+
+/* Give the fork a copy of the parent's shared info, at the same gfn. */
+static int fork_shared_info(struct domain *cd, struct domain *d)
+{
+    mfn_t mfn = _mfn(virt_to_mfn(cd->shared_info));
+    unsigned long gfn = get_gpfn_from_mfn(virt_to_mfn(d->shared_info));
+    p2m_type_t t;
+
+    copy_domain_page(mfn, _mfn(virt_to_mfn(d->shared_info)));
+
+    if ( !VALID_M2P(gfn) ||
+         mfn_eq(get_gfn_query_unlocked(cd, gfn, &t), mfn) )
+        return 0;
+
+    return guest_physmap_add_page(cd, _gfn(gfn), mfn, PAGE_ORDER_4K);
+}
+
+/*
+ * Give the fork's vCPUs the parent's vcpu_info and runstate areas.  Pages
+ * holding vcpu_info get populated privately and up front, as Xen needs them
+ * writable.
+ */
+static int fork_vcpu_info(struct domain *cd, struct domain *d)
+{
+    unsigned int i;
+
+    for ( i = 0; i < d->max_vcpus; i++ )
+    {
+        const struct vcpu *v = d->vcpu[i];
+        struct vcpu *cv = cd->vcpu[i];
+
+        cv->runstate_guest = v->runstate_guest;
+
+        if ( mfn_eq(v->vcpu_info_mfn, INVALID_MFN) )
+            continue;
+
+        if ( mfn_eq(cv->vcpu_info_mfn, INVALID_MFN) )
+        {
+            unsigned long gfn = get_gpfn_from_mfn(mfn_x(v->vcpu_info_mfn));
+            struct page_info *page = get_page_from_gfn(cd, gfn, NULL,
+                                                       P2M_UNSHARE);
+            int rc;
+
+            if ( !page )
+                return -ENOMEM;
+            put_page(page);
+
+            rc = map_vcpu_info(cv, gfn, (unsigned long)v->vcpu_info &
+                                        ~PAGE_MASK);
+            if ( rc )
+                return rc;
+        }
+
+        memcpy(cv->vcpu_info, v->vcpu_info, sizeof(*cv->vcpu_info));
+    }
+
+    return 0;
+}
+
+static int fork_hvm_context(struct domain *cd, struct domain *d)
+{
+    struct hvm_domain_context c = { .size = hvm_save_size(d) };
+    uint32_t tsc_mode, gtsc_khz, incarnation;
+    uint64_t elapsed_nsec;
+    int rc;
+
+    tsc_get_info(d, &tsc_mode, &elapsed_nsec, &gtsc_khz, &incarnation);
+    tsc_set_info(cd, tsc_mode, elapsed_nsec, gtsc_khz, incarnation);
+
+    if ( (c.data = xmalloc_bytes(c.size)) == NULL )
+        return -ENOMEM;
+
+    rc = hvm_save(d, &c);
+    if ( !rc )
+    {
+        c.size = c.cur;
+        c.cur = 0;
+        rc = hvm_load(cd, &c);
+    }
+
+    xfree(c.data);
+
+    return rc;
+}
+
+static int fork_state(struct domain *cd, struct domain *d)
+{
+    return fork_shared_info(cd, d) ?: fork_vcpu_info(cd, d) ?:
+           fork_hvm_context(cd, d);
+}
+
+/*
+ * Turn cd, a freshly created and paused domain with the same number of vCPUs,
+ * into a fork of d: d's memory gets populated into it lazily, while the
+ * state of its vCPUs and devices gets copied right away.  d stays paused for
+ * as long as the fork exists.
+ */
+static int mem_sharing_fork(struct domain *d, struct domain *cd)
+{
+    unsigned int i;
+    int rc;
+
+    if ( d == cd || !atomic_read(&cd->pause_count) || cd->tot_pages ||
+         cd->arch.hvm_domain.fork_parent || d->max_vcpus != cd->max_vcpus )
+        return -EINVAL;
+
+    for ( i = 0; i < d->max_vcpus; i++ )
+        if ( !d->vcpu[i] || !cd->vcpu[i] )
+            return -EINVAL;
+
+    if ( !get_domain(d) )
+        return -EINVAL;
+
+    domain_pause(d);
+    cd->arch.hvm_domain.fork_parent = d;
+
+    rc = fork_state(cd, d);
+    if ( rc )
+    {
+        cd->arch.hvm_domain.fork_parent = NULL;
+        domain_unpause(d);
+        put_domain(d);
+    }
+
+    return rc;
+}
+
+/*
+ * Copy the closest ancestor's contents of gfn into the fork's page at mfn,
+ * for pages the fork can't simply drop.
+ */
+static int fork_restore_page(struct domain *cd, gfn_t gfn, mfn_t mfn)
+{
+    struct domain *parent;
+    struct page_info *ppage;
+    p2m_type_t p2mt;
+    mfn_t pmfn;
+
+    parent = fork_ancestor(cd, gfn, &pmfn, &p2mt);
+    if ( !parent || is_xen_heap_mfn(mfn_x(pmfn)) )
+        return -EBUSY;
+
+    ppage = mfn_to_page(pmfn);
+    if ( !get_page(ppage, p2m_is_shared(p2mt) ? dom_cow : parent) )
+        return -EBUSY;
+
+    copy_domain_page(mfn, pmfn);
+    put_page(ppage);
+
+    return 0;
+}
+
+/*
+ * Reset a (paused) fork to its parent's state, dropping the pages it got
+ * populated privately.  Pages referenced from elsewhere (vcpu_info pages, or
+ * mappings by a device model) get their contents copied from the parent
+ * instead, failing the reset with -EBUSY if the parent has nothing there.
+ * Pages shared with the parent stay as they are.
+ *
+ * Pages done with move to relmem_list, for a preempted reset to pick up
+ * where it left off, and get moved back once done.
+ */
+static int mem_sharing_fork_reset(struct domain *cd)
+{
+    struct domain *d = cd->arch.hvm_domain.fork_parent;
+    struct p2m_domain *p2m = p2m_get_hostp2m(cd);
+    struct page_info *page;
+    int rc = atomic_read(&cd->pause_count) ? 0 : -EINVAL;
+
+    p2m_lock(p2m);
+    spin_lock_recursive(&cd->page_alloc_lock);
+
+    while ( !rc && (page = page_list_remove_head(&cd->page_list)) )
+    {
+        mfn_t mfn = page_to_mfn(page);
+        unsigned long gfn = get_gpfn_from_mfn(mfn_x(mfn));
+        p2m_access_t a;
+        p2m_type_t t;
+
+        /* Put the page on the list and /then/ potentially free it. */
+        page_list_add_tail(page, &cd->arch.relmem_list);
+
+        if ( !VALID_M2P(gfn) ||
+             !mfn_eq(p2m->get_entry(p2m, _gfn(gfn), &t, &a, 0, NULL, NULL),
+                     mfn) || !p2m_is_ram(t) )
+            /* Not (or no longer) mapped by the fork. */;
+        else if ( (page->count_info & PGC_count_mask) != 1 ||
+                  (page->u.inuse.type_info & PGT_count_mask) )
+            rc = fork_restore_page(cd, _gfn(gfn), mfn);
+        else if ( !p2m->set_entry(p2m, _gfn(gfn), INVALID_MFN, PAGE_ORDER_4K,
+                                  p2m_invalid, p2m_access_rwx, -1) )
+        {
+            set_gpfn_from_mfn(mfn_x(mfn), INVALID_M2P_ENTRY);
+            if ( test_and_clear_bit(_PGC_allocated, &page->count_info) )
+                put_page(page);
+        }
+
+        if ( !rc && hypercall_preempt_check() )
+            rc = -ERESTART;
+    }
+
+    if ( rc != -ERESTART )
+    {
+        page_list_splice(&cd->arch.relmem_list, &cd->page_list);
+        INIT_PAGE_LIST_HEAD(&cd->arch.relmem_list);
+    }
+
+    spin_unlock_recursive(&cd->page_alloc_lock);
+    p2m_unlock(p2m);
+
+    return rc ?: fork_state(cd, d);
+}
+
 int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg)
 {
     int rc;
@@ -1480,7 +1844,7 @@ int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg)
             sh      = mso.u.share.source_handle;
             cgfn    = mso.u.share.client_gfn;
 
-            rc = mem_sharing_add_to_physmap(d, sgfn, sh, cd, cgfn); 
+            rc = mem_sharing_add_to_physmap(d, sgfn, sh, cd, cgfn);
 
             rcu_unlock_domain(cd);
         }
@@ -1576,6 +1940,43 @@ int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg)
         }
         break;
 
+        case XENMEM_sharing_op_fork:
+        {
+            struct domain *pd;
+
+            rc = -EINVAL;
+            if ( mso.u.fork._pad[0] || mso.u.fork._pad[1] ||
+                 mso.u.fork._pad[2] )
+                goto out;
+
+            rc = rcu_lock_live_remote_domain_by_id(mso.u.fork.parent_domain,
+                                                   &pd);
+            if ( rc )
+                goto out;
+
+            rc = xsm_mem_sharing_op(XSM_DM_PRIV, pd, d, mso.op);
+            if ( !rc && (!hap_enabled(pd) || !mem_sharing_enabled(pd) ||
+                         !mem_sharing_enabled(d)) )
+                rc = -EINVAL;
+            if ( !rc )
+                rc = mem_sharing_fork(pd, d);
+
+            rcu_unlock_domain(pd);
+        }
+        break;
+
+        case XENMEM_sharing_op_fork_reset:
+            rc = -EINVAL;
+            if ( !mem_sharing_is_fork(d) )
+                goto out;
+
+            rc = mem_sharing_fork_reset(d);
+            if ( rc == -ERESTART )
+                rc = hypercall_create_continuation(__HYPERVISOR_memory_op,
+                                                   "lh", XENMEM_sharing_op,
+                                                   arg);
+            break;
+
         case XENMEM_sharing_op_debug_gfn:
             rc = debug_gfn(d, _gfn(mso.u.debug.u.gfn));
             break;
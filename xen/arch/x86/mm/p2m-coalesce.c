@@ -0,0 +1,284 @@
+/******************************************************************************
+ * arch/x86/mm/p2m-coalesce.c
+ *
+ * Background re-coalescing of shattered p2m superpages.
+ *
+ * Changing the type or access of a single page mapped by a 2M or 1G p2m
+ * entry splits that entry, and nothing ever rebuilds it: log-dirty mode
+ * during migration, ballooning, grant mappings or mem_access leave guests
+ * with 4k mappings (and the TLB pressure coming with them) for good.  Once a
+ * split happened, the host p2m gets swept in the background, and ranges
+ * which are again mapped by contiguous, suitably aligned entries of the same
+ * type and access get replaced by a single superpage entry.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <xen/init.h>
+#include <xen/sched.h>
+#include <asm/altp2m.h>
+#include <asm/mtrr.h>
+#include <asm/p2m.h>
+#include <asm/hvm/hvm.h>
+
+#include "mm-locks.h"
+
+static bool __read_mostly opt_p2m_coalesce = true;
+boolean_param("p2m-coalesce", opt_p2m_coalesce);
+
+/* Delay from a superpage getting split to the next sweep. */
+#define COALESCE_DELAY   SECONDS(5)
+/* Delay between batches of a sweep, for the sweep not to hog a CPU. */
+#define COALESCE_PACE    MILLISECS(1)
+/* p2m lookups per batch. */
+#define COALESCE_BATCH   4096
+
+static bool coalesce_allowed(const struct domain *d)
+{
+    /*
+     * Pages are about to get split again while log-dirty mode is enabled,
+     * and altp2m views would need to be updated alongside.
+     */
+    return !d->is_dying && !paging_mode_log_dirty(d) && !altp2m_active(d);
+}
+
+/*
+ * Check whether the range of the given order at gfn is made up of entries of
+ * the next lower order, all plain RAM mapping contiguous and suitably aligned
+ * memory with identical access, and if so replace them by a single entry.
+ * If non-NULL, *leaves gets the number of valid entries found added.
+ */
+static bool coalesce_range(struct p2m_domain *p2m, unsigned long gfn,
+                           unsigned int order, unsigned int *lookups,
+                           unsigned long *leaves)
+{
+    struct domain *d = p2m->domain;
+    unsigned int i, sub = order - PAGETABLE_ORDER;
+    mfn_t mfn0 = INVALID_MFN;
+    p2m_access_t a0 = p2m_access_n;
+    bool_t sve0 = 1;
+    bool ok = order == PAGE_ORDER_1G ? hap_has_1gb : hap_has_2mb;
+    uint8_t ipat;
+
+    ASSERT(p2m_locked_by_me(p2m));
+
+    for ( i = 0; i < (1u << PAGETABLE_ORDER); i++ )
+    {
+        p2m_type_t t;
+        p2m_access_t a;
+        unsigned int cur = 0;
+        bool_t sve = 1;
+        mfn_t mfn = p2m->get_entry(p2m, _gfn(gfn + (i << sub)), &t, &a, 0,
+                                   &cur, &sve);
+
+        ++*lookups;
+
+        if ( cur == sub && leaves && !mfn_eq(mfn, INVALID_MFN) )
+            ++*leaves;
+
+        if ( !ok )
+        {
+            /* Keep counting. */
+            if ( leaves )
+                continue;
+            break;
+        }
+
+        if ( cur != sub || t != p2m_ram_rw )
+            ok = false;
+        else if ( !i )
+        {
+            mfn0 = mfn;
+            a0 = a;
+            sve0 = sve;
+            ok = !(mfn_x(mfn) & ((1UL << order) - 1));
+        }
+        else
+            ok = mfn_eq(mfn, mfn_add(mfn0, i << sub)) && a == a0 &&
+                 sve == sve0;
+    }
+
+    if ( !ok )
+        return false;
+
+    /* Memory types differing within the range would have EPT split it. */
+    if ( hap_enabled(d) && cpu_has_vmx &&
+         epte_get_entry_emt(d, gfn, mfn0, order, &ipat, 0) < 0 )
+        return false;
+
+    return !p2m->set_entry(p2m, _gfn(gfn), mfn0, order, p2m_ram_rw, a0, sve0);
+}
+
+static void coalesce_sweep(unsigned long data)
+{
+    struct p2m_domain *p2m = (struct p2m_domain *)data;
+    struct domain *d = p2m->domain;
+    unsigned int lookups = 0;
+    unsigned long gfn;
+    bool done = false;
+
+    p2m_lock(p2m);
+
+    gfn = p2m->coalesce.next_gfn;
+    if ( !gfn )
+    {
+        p2m->coalesce.pending = false;
+        p2m->coalesce.all_2m = true;
+        memset(p2m->coalesce.seen, 0, sizeof(p2m->coalesce.seen));
+    }
+
+    while ( lookups < COALESCE_BATCH )
+    {
+        p2m_type_t t;
+        p2m_access_t a;
+        unsigned int order = 0;
+        mfn_t mfn;
+
+        if ( !coalesce_allowed(d) )
+        {
+            /* Start over once things have settled. */
+            p2m->coalesce.pending = true;
+            gfn = 0;
+            break;
+        }
+
+        if ( gfn > p2m->max_mapped_pfn )
+        {
+            done = true;
+            break;
+        }
+
+        mfn = p2m->get_entry(p2m, _gfn(gfn), &t, &a, 0, &order, NULL);
+        ++lookups;
+
+        if ( order >= PAGE_ORDER_2M )
+        {
+            /* A superpage, or a hole. */
+            if ( !mfn_eq(mfn, INVALID_MFN) && order <= PAGE_ORDER_1G )
+                p2m->coalesce.seen[order / PAGETABLE_ORDER]++;
+            if ( order != PAGE_ORDER_2M || t != p2m_ram_rw )
+                p2m->coalesce.all_2m = false;
+            gfn = (gfn | ((1UL << order) - 1)) + 1;
+        }
+        else
+        {
+            if ( coalesce_range(p2m, gfn, PAGE_ORDER_2M, &lookups,
+                                &p2m->coalesce.seen[0]) )
+            {
+                p2m->coalesce.seen[0] -= 1u << PAGETABLE_ORDER;
+                p2m->coalesce.seen[1]++;
+                p2m->stats.coalesced[0]++;
+            }
+            else
+                p2m->coalesce.all_2m = false;
+            gfn += 1UL << PAGE_ORDER_2M;
+        }
+
+        if ( !(gfn & ((1UL << PAGE_ORDER_1G) - 1)) )
+        {
+            if ( p2m->coalesce.all_2m &&
+                 coalesce_range(p2m, gfn - (1UL << PAGE_ORDER_1G),
+                                PAGE_ORDER_1G, &lookups, NULL) )
+            {
+                p2m->coalesce.seen[1] -= 1u << PAGETABLE_ORDER;
+                p2m->coalesce.seen[2]++;
+                p2m->stats.coalesced[1]++;
+            }
+            p2m->coalesce.all_2m = true;
+        }
+
+        /* Don't hold up the guest's own p2m updates for too long. */
+        p2m_unlock(p2m);
+        p2m_lock(p2m);
+    }
+
+    if ( done )
+    {
+        memcpy(p2m->stats.entries, p2m->coalesce.seen,
+               sizeof(p2m->stats.entries));
+        gfn = 0;
+    }
+
+    p2m->coalesce.next_gfn = gfn;
+
+    if ( gfn )
+        set_timer(&p2m->coalesce.timer, NOW() + COALESCE_PACE);
+    else if ( p2m->coalesce.pending && !d->is_dying )
+        set_timer(&p2m->coalesce.timer, NOW() + COALESCE_DELAY);
+    else
+        p2m->coalesce.active = false;
+
+    p2m_unlock(p2m);
+}
+
+static void coalesce_timer_fn(void *data)
+{
+    struct p2m_domain *p2m = data;
+
+    tasklet_schedule(&p2m->coalesce.tasklet);
+}
+
+void p2m_coalesce_init(struct p2m_domain *p2m)
+{
+    init_timer(&p2m->coalesce.timer, coalesce_timer_fn, p2m,
+               smp_processor_id());
+    tasklet_init(&p2m->coalesce.tasklet, coalesce_sweep, (unsigned long)p2m);
+}
+
+/* Must not be called with the p2m lock held. */
+void p2m_coalesce_kill(struct p2m_domain *p2m)
+{
+    kill_timer(&p2m->coalesce.timer);
+    tasklet_kill(&p2m->coalesce.tasklet);
+}
+
+void p2m_coalesce_split(struct p2m_domain *p2m, unsigned int level)
+{
+    ASSERT(level == 1 || level == 2);
+
+    if ( !p2m_is_hostp2m(p2m) )
+        return;
+
+    p2m->stats.split[level - 1]++;
+
+    if ( !opt_p2m_coalesce || !hap_enabled(p2m->domain) )
+        return;
+
+    p2m->coalesce.pending = true;
+    if ( !p2m->coalesce.active )
+    {
+        p2m->coalesce.active = true;
+        set_timer(&p2m->coalesce.timer, NOW() + COALESCE_DELAY);
+    }
+}
+
+void p2m_coalesce_dump_data(struct domain *d)
+{
+    const struct p2m_domain *p2m = p2m_get_hostp2m(d);
+
+    printk("    p2m leaves 4k=%lu 2M=%lu 1G=%lu"
+           " split 2M=%lu 1G=%lu rebuilt 2M=%lu 1G=%lu\n",
+           p2m->stats.entries[0], p2m->stats.entries[1],
+           p2m->stats.entries[2], p2m->stats.split[0], p2m->stats.split[1],
+           p2m->stats.coalesced[0], p2m->stats.coalesced[1]);
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -291,6 +291,8 @@ static bool_t ept_split_super_page(struct p2m_domain *p2m,
     if ( !ept_set_middle_entry(p2m, &new_ept) )
         return 0;
 
+    p2m_coalesce_split(p2m, level);
+
     table = map_domain_page(_mfn(new_ept.mfn));
     trunk = 1UL << ((level - 1) * EPT_TABLE_ORDER);
 
@@ -1232,11 +1234,72 @@ static void ept_disable_pml(struct p2m_domain *p2m)
 
     vmx_domain_disable_pml(p2m->domain);
 
+    /* Working set estimation still needs the A bits. */
+    if ( p2m->wss )
+        return;
+
     /* Disable EPT A/D bit */
     p2m->ept.ad = 0;
     vmx_domain_update_eptp(p2m->domain);
 }
 
+/*
+ * Enable or disable the hardware setting of accessed bits, for working set
+ * estimation.  Entries get created with the accessed bit set, so nothing
+ * changes for them until the bit gets cleared.
+ */
+void ept_track_accessed(struct p2m_domain *p2m, bool enable)
+{
+    struct domain *d = p2m->domain;
+
+    /* Domain must have been paused */
+    ASSERT(atomic_read(&d->pause_count));
+
+    /* PML needs the A/D bits as well. */
+    if ( !enable && vmx_domain_pml_enabled(d) )
+        return;
+
+    p2m->ept.ad = enable;
+    vmx_domain_update_eptp(d);
+}
+
+/*
+ * Test and clear the accessed bit of the RAM leaf entry covering gfn.
+ * Returns -ENOENT if there's no such entry.  *page_order gets set to the
+ * order of the entry (or hole) found.  Stale translations may keep accesses
+ * from setting the bit again until the next ept_sync_domain().
+ */
+int ept_test_and_clear_accessed(struct p2m_domain *p2m, unsigned long gfn,
+                                unsigned int *page_order)
+{
+    ept_entry_t *table =
+        map_domain_page(pagetable_get_mfn(p2m_get_pagetable(p2m)));
+    unsigned long gfn_remainder = gfn;
+    ept_entry_t *ept_entry;
+    int i, ret = GUEST_TABLE_NORMAL_PAGE, rc = -ENOENT;
+
+    ASSERT(p2m_locked_by_me(p2m));
+
+    for ( i = p2m->ept.wl; i > 0; i-- )
+    {
+        ret = ept_next_level(p2m, 1, &table, &gfn_remainder, i);
+        if ( ret != GUEST_TABLE_NORMAL_PAGE )
+            break;
+    }
+
+    ept_entry = table + (gfn_remainder >> (i * EPT_TABLE_ORDER));
+
+    if ( (ret == GUEST_TABLE_NORMAL_PAGE || ret == GUEST_TABLE_SUPER_PAGE) &&
+         is_epte_present(ept_entry) && p2m_is_ram(ept_entry->sa_p2mt) )
+        rc = test_and_clear_bit(EPTE_A_SHIFT, &ept_entry->epte);
+
+    *page_order = i * EPT_TABLE_ORDER;
+
+    unmap_domain_page(table);
+
+    return rc;
+}
+
 static void ept_flush_pml_buffers(struct p2m_domain *p2m)
 {
     /* Domain must have been paused */
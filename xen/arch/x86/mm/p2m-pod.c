@@ -26,6 +26,7 @@
 #include <asm/page.h>
 #include <asm/paging.h>
 #include <asm/p2m.h>
+#include <public/domctl.h>
 
 #include "mm-locks.h"
 
@@ -681,8 +682,46 @@ void p2m_pod_dump_data(struct domain *d)
 
     printk("    PoD entries=%ld cachesize=%ld\n",
            p2m->pod.entry_count, p2m->pod.count);
+    printk("    PoD sweeps=%lu reclaimed=%lu sweep time=%"PRI_stime"us\n",
+           p2m->pod.sweeps, p2m->pod.reclaimed,
+           p2m->pod.sweep_time / MICROSECS(1));
 }
 
+void p2m_pod_get_stats(struct domain *d, struct xen_domctl_pod_stats *stats)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+
+    pod_lock(p2m);
+    stats->entries = p2m->pod.entry_count;
+    stats->cache_pages = p2m->pod.count;
+    stats->sweeps = p2m->pod.sweeps;
+    stats->sweep_ns = p2m->pod.sweep_time;
+    stats->reclaimed = p2m->pod.reclaimed;
+    pod_unlock(p2m);
+}
+
+/*
+ * Check whether the first 'bytes' of a page are all zero.  Vector registers
+ * hold guest state while in Xen, so rather than using SSE/AVX compares, OR
+ * together a cache line worth of words at a time, and bail at the first
+ * line found non-zero.
+ */
+static bool pod_range_is_zero(const unsigned long *p, unsigned int bytes)
+{
+    const unsigned long *end = p + bytes / sizeof(*p);
+
+    ASSERT(!(bytes % (8 * sizeof(*p))));
+
+    for ( ; p < end; p += 8 )
+        if ( p[0] | p[1] | p[2] | p[3] | p[4] | p[5] | p[6] | p[7] )
+            return false;
+
+    return true;
+}
+
+/* Pages failing this check can't be zero, without a full check needed. */
+#define POD_QUICK_CHECK_BYTES (16 * sizeof(unsigned long))
+
 
 /*
  * Search for all-zero superpages to be reclaimed as superpages for the
@@ -697,7 +736,6 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
     unsigned long * map = NULL;
     int ret=0, reset = 0;
     unsigned long i, n;
-    unsigned int j;
     int max_ref = 1;
     struct domain *d = p2m->domain;
 
@@ -767,15 +805,13 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
     for ( i = 0; i < SUPERPAGE_PAGES; i++ )
     {
         /* Quick zero-check */
-        map = map_domain_page(mfn_add(mfn0, i));
-
-        for ( j = 0; j < 16; j++ )
-            if ( *(map + j) != 0 )
-                break;
+        bool zero;
 
+        map = map_domain_page(mfn_add(mfn0, i));
+        zero = pod_range_is_zero(map, POD_QUICK_CHECK_BYTES);
         unmap_domain_page(map);
 
-        if ( j < 16 )
+        if ( !zero )
             goto out;
 
     }
@@ -806,14 +842,7 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
     for ( i = 0; i < SUPERPAGE_PAGES; i++ )
     {
         map = map_domain_page(mfn_add(mfn0, i));
-
-        for ( j = 0; j < (PAGE_SIZE / sizeof(*map)); j++ )
-            if ( *(map+j) != 0 )
-            {
-                reset = 1;
-                break;
-            }
-
+        reset = !pod_range_is_zero(map, PAGE_SIZE);
         unmap_domain_page(map);
 
         if ( reset )
@@ -841,6 +870,7 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
      */
     p2m_pod_cache_add(p2m, mfn_to_page(mfn0), PAGE_ORDER_2M);
     p2m->pod.entry_count += SUPERPAGE_PAGES;
+    p2m->pod.reclaimed += SUPERPAGE_PAGES;
 
     ret = SUPERPAGE_PAGES;
 
@@ -862,6 +892,9 @@ out:
     return ret;
 }
 
+/* Pages zero-checked (and their p2m entries flushed) as a batch. */
+#define POD_SWEEP_STRIDE  16
+
 static void
 p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
 {
@@ -870,7 +903,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
     unsigned long *map[count];
     struct domain *d = p2m->domain;
 
-    int i, j;
+    int i;
     int max_ref = 1;
 
     /* Allow an extra refcount for one shadow pt mapping in shadowed domains */
@@ -909,11 +942,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
             continue;
 
         /* Quick zero-check */
-        for ( j = 0; j < 16; j++ )
-            if ( *(map[i] + j) != 0 )
-                break;
-
-        if ( j < 16 )
+        if ( !pod_range_is_zero(map[i], POD_QUICK_CHECK_BYTES) )
         {
             unmap_domain_page(map[i]);
             map[i] = NULL;
@@ -951,17 +980,18 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
         }
     }
 
+    /* A single flush for the whole batch of pages unmapped above. */
     p2m_tlb_flush_sync(p2m);
 
     /* Now check each page for real */
     for ( i = 0; i < count; i++ )
     {
+        bool zero;
+
         if ( !map[i] )
             continue;
 
-        for ( j = 0; j < (PAGE_SIZE / sizeof(*map[i])); j++ )
-            if ( *(map[i] + j) != 0 )
-                break;
+        zero = pod_range_is_zero(map[i], PAGE_SIZE);
 
         unmap_domain_page(map[i]);
 
@@ -971,7 +1001,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
          * See comment in p2m_pod_zero_check_superpage() re gnttab
          * check timing.
          */
-        if ( j < (PAGE_SIZE / sizeof(*map[i])) )
+        if ( !zero )
         {
             /*
              * If the previous p2m_set_entry call succeeded, this one shouldn't
@@ -1005,6 +1035,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, int count)
             /* Add to cache, and account for the new p2m PoD entry */
             p2m_pod_cache_add(p2m, mfn_to_page(mfns[i]), PAGE_ORDER_4K);
             p2m->pod.entry_count++;
+            p2m->pod.reclaimed++;
         }
     }
 
@@ -1021,14 +1052,13 @@ out_unmap:
 }
 
 #define POD_SWEEP_LIMIT 1024
-#define POD_SWEEP_STRIDE  16
 static void
 p2m_pod_emergency_sweep(struct p2m_domain *p2m)
 {
     gfn_t gfns[POD_SWEEP_STRIDE];
     unsigned long i, j = 0, start, limit;
     p2m_type_t t;
-
+    s_time_t now = NOW();
 
     if ( gfn_eq(p2m->pod.reclaim_single, _gfn(0)) )
         p2m->pod.reclaim_single = p2m->pod.max_guest;
@@ -1075,12 +1105,15 @@ p2m_pod_emergency_sweep(struct p2m_domain *p2m)
     p2m_unlock(p2m);
     p2m->pod.reclaim_single = _gfn(i ? i - 1 : i);
 
+    p2m->pod.sweeps++;
+    p2m->pod.sweep_time += NOW() - now;
 }
 
 static void pod_eager_reclaim(struct p2m_domain *p2m)
 {
     struct pod_mrp_list *mrp = &p2m->pod.mrp;
     unsigned int i = 0;
+    s_time_t start = NOW();
 
     /*
      * Always check one page for reclaimation.
@@ -1101,10 +1134,19 @@ static void pod_eager_reclaim(struct p2m_domain *p2m)
 
                 if ( p2m_pod_zero_check_superpage(p2m, gfn) == 0 )
                 {
+                    gfn_t gfns[POD_SWEEP_STRIDE];
                     unsigned int x;
 
+                    /*
+                     * Check the constituent pages in batches, for them not
+                     * to need a TLB flush each.
+                     */
                     for ( x = 0; x < SUPERPAGE_PAGES; ++x, gfn = gfn_add(gfn, 1) )
-                        p2m_pod_zero_check(p2m, &gfn, 1);
+                    {
+                        gfns[x % POD_SWEEP_STRIDE] = gfn;
+                        if ( x % POD_SWEEP_STRIDE == POD_SWEEP_STRIDE - 1 )
+                            p2m_pod_zero_check(p2m, gfns, POD_SWEEP_STRIDE);
+                    }
                 }
             }
             else
@@ -1114,6 +1156,9 @@ static void pod_eager_reclaim(struct p2m_domain *p2m)
         }
 
     } while ( (p2m->pod.count == 0) && (i < ARRAY_SIZE(mrp->list)) );
+
+    p2m->pod.sweeps++;
+    p2m->pod.sweep_time += NOW() - start;
 }
 
 static void pod_eager_record(struct p2m_domain *p2m, gfn_t gfn,
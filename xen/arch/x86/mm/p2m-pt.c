@@ -236,6 +236,8 @@ p2m_next_level(struct p2m_domain *p2m, void **table,
         if ( mfn_eq(mfn, INVALID_MFN) )
             return -ENOMEM;
 
+        p2m_coalesce_split(p2m, level);
+
         l1_entry = map_domain_page(mfn);
 
         /* Inherit original IOMMU permissions, but update Next Level. */
@@ -0,0 +1,318 @@
+/******************************************************************************
+ * arch/x86/mm/p2m-wss.c
+ *
+ * Working set estimation from the accessed bits of EPT entries.
+ *
+ * The p2m entries of the tracked gfns get scanned periodically, harvesting
+ * and clearing their accessed bits.  Every gfn has an age, counting the scans
+ * it was last found accessed before, from which a histogram gets built for
+ * each completed scan.  The toolstack (a balloon controller, or xenpaging's
+ * page selection) can retrieve both, to find out how much memory a guest
+ * actually uses, and which of its memory is cold.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <xen/guest_access.h>
+#include <xen/sched.h>
+#include <xen/vmap.h>
+#include <asm/altp2m.h>
+#include <asm/p2m.h>
+#include <asm/hvm/vmx/vmx.h>
+#include <public/domctl.h>
+
+#include "mm-locks.h"
+
+/* Delay between batches of a scan, for the scan not to hog a CPU. */
+#define WSS_PACE         MILLISECS(1)
+/* p2m entries looked at per batch, and without dropping the p2m lock. */
+#define WSS_BATCH        4096
+#define WSS_LOCK_BATCH   512
+
+struct p2m_wss {
+    struct p2m_domain *p2m;
+    struct timer       timer;
+    struct tasklet     tasklet;
+    s_time_t           interval;
+    s_time_t           start;         /* of the current scan */
+    unsigned long      nr_gfns;       /* gfns tracked: [0, nr_gfns) */
+    unsigned long      next_gfn;      /* resume point of the current scan */
+    uint8_t           *age;           /* per gfn, in scans */
+    uint64_t           scans;         /* completed */
+    bool               resync;        /* only clear accessed bits this scan */
+    uint64_t           hist[XEN_DOMCTL_WSS_BUCKETS]; /* of the last scan */
+    uint64_t           cur[XEN_DOMCTL_WSS_BUCKETS];  /* of the current one */
+};
+
+static unsigned int wss_bucket(unsigned int age)
+{
+    return age ? min_t(unsigned int, fls(age), XEN_DOMCTL_WSS_BUCKETS - 1)
+               : 0;
+}
+
+/*
+ * While altp2m is active, the guest runs on views whose entries don't track
+ * accesses, leaving the accessed bits of the host p2m clear.
+ */
+static bool wss_allowed(const struct domain *d)
+{
+    return !d->is_dying && !altp2m_active(d);
+}
+
+static void wss_scan(unsigned long data)
+{
+    struct p2m_wss *wss = (struct p2m_wss *)data;
+    struct p2m_domain *p2m = wss->p2m;
+    unsigned long gfn;
+    unsigned int n;
+
+    p2m_lock(p2m);
+
+    if ( p2m->domain->is_dying )
+    {
+        p2m_unlock(p2m);
+        return;
+    }
+
+    gfn = wss->next_gfn;
+    if ( !gfn )
+        wss->start = NOW();
+
+    for ( n = 1; gfn < wss->nr_gfns && n <= WSS_BATCH; n++ )
+    {
+        unsigned int order = 0;
+        int rc;
+        unsigned long end;
+
+        if ( !wss_allowed(p2m->domain) )
+        {
+            /*
+             * Try again later, with a scan not aging anything, as accessed
+             * bits are missing for the time altp2m was active.
+             */
+            memset(wss->cur, 0, sizeof(wss->cur));
+            wss->resync = true;
+            wss->next_gfn = 0;
+            if ( !p2m->domain->is_dying )
+                set_timer(&wss->timer, NOW() + wss->interval);
+            p2m_unlock(p2m);
+            return;
+        }
+
+        rc = ept_test_and_clear_accessed(p2m, gfn, &order);
+        end = min((gfn | ((1UL << order) - 1)) + 1, wss->nr_gfns);
+
+        for ( ; gfn < end; gfn++ )
+        {
+            uint8_t *age = &wss->age[gfn];
+
+            if ( rc < 0 )
+            {
+                *age = XEN_DOMCTL_WSS_AGE_UNMAPPED;
+                continue;
+            }
+
+            if ( wss->resync )
+                continue;
+
+            if ( rc || *age == XEN_DOMCTL_WSS_AGE_UNMAPPED )
+                *age = 0;
+            else if ( *age < XEN_DOMCTL_WSS_AGE_MAX )
+                ++*age;
+
+            wss->cur[wss_bucket(*age)]++;
+        }
+
+        if ( !(n % WSS_LOCK_BATCH) )
+        {
+            p2m_unlock(p2m);
+            p2m_lock(p2m);
+        }
+    }
+
+    if ( gfn < wss->nr_gfns )
+    {
+        wss->next_gfn = gfn;
+        set_timer(&wss->timer, NOW() + WSS_PACE);
+    }
+    else
+    {
+        /*
+         * Translations cached from entries whose accessed bit got cleared
+         * keep accesses from setting the bit again.  Rather than paying for
+         * a flush with every entry, take the inaccuracy and flush once per
+         * scan (on dropping the p2m lock).
+         */
+        ept_sync_domain(p2m);
+
+        if ( !wss->resync )
+        {
+            memcpy(wss->hist, wss->cur, sizeof(wss->hist));
+            wss->scans++;
+        }
+        memset(wss->cur, 0, sizeof(wss->cur));
+        wss->resync = false;
+        wss->next_gfn = 0;
+        set_timer(&wss->timer, wss->start + wss->interval);
+    }
+
+    p2m_unlock(p2m);
+}
+
+static void wss_timer_fn(void *data)
+{
+    struct p2m_wss *wss = data;
+
+    tasklet_schedule(&wss->tasklet);
+}
+
+static int wss_enable(struct domain *d, struct xen_domctl_wss_op *op)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    struct p2m_wss *wss;
+    unsigned long nr = op->nr ?: p2m->max_mapped_pfn + 1;
+
+    if ( !hap_enabled(d) || !cpu_has_vmx || !cpu_has_vmx_ept_ad )
+        return -EOPNOTSUPP;
+
+    if ( altp2m_active(d) )
+        return -EBUSY;
+
+    if ( d == current->domain || !op->interval_ms ||
+         nr > (1UL << (PADDR_BITS - PAGE_SHIFT)) )
+        return -EINVAL;
+
+    if ( p2m->wss )
+        return -EBUSY;
+
+    wss = xzalloc(struct p2m_wss);
+    if ( !wss )
+        return -ENOMEM;
+
+    wss->age = vzalloc(nr);
+    if ( !wss->age )
+    {
+        xfree(wss);
+        return -ENOMEM;
+    }
+
+    wss->p2m = p2m;
+    wss->nr_gfns = nr;
+    wss->interval = MILLISECS(op->interval_ms);
+    init_timer(&wss->timer, wss_timer_fn, wss, smp_processor_id());
+    tasklet_init(&wss->tasklet, wss_scan, (unsigned long)wss);
+
+    domain_pause(d);
+
+    p2m_lock(p2m);
+    p2m->wss = wss;
+    p2m_unlock(p2m);
+
+    ept_track_accessed(p2m, true);
+
+    domain_unpause(d);
+
+    set_timer(&wss->timer, NOW());
+
+    return 0;
+}
+
+static void wss_free(struct p2m_domain *p2m)
+{
+    struct p2m_wss *wss = p2m->wss;
+
+    kill_timer(&wss->timer);
+    tasklet_kill(&wss->tasklet);
+
+    p2m_lock(p2m);
+    p2m->wss = NULL;
+    p2m_unlock(p2m);
+
+    vfree(wss->age);
+    xfree(wss);
+}
+
+/* For domain teardown, leaving the hardware setup alone. */
+void p2m_wss_disable(struct p2m_domain *p2m)
+{
+    if ( p2m->wss )
+        wss_free(p2m);
+}
+
+static int wss_get(struct domain *d, struct xen_domctl_wss_op *op)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    const struct p2m_wss *wss = p2m->wss;
+
+    if ( !wss )
+        return -ENOENT;
+
+    p2m_lock(p2m);
+    op->nr_gfns = wss->nr_gfns;
+    op->scans = wss->scans;
+    memcpy(op->hist, wss->hist, sizeof(op->hist));
+    p2m_unlock(p2m);
+
+    if ( guest_handle_is_null(op->ages) )
+        return 0;
+
+    /*
+     * Ages may get updated while being copied, without harm.  The domctl
+     * lock keeps them from getting freed.
+     */
+    op->nr = op->gfn < wss->nr_gfns ? min(op->nr, wss->nr_gfns - op->gfn)
+                                    : 0;
+    if ( op->nr && copy_to_guest(op->ages, wss->age + op->gfn, op->nr) )
+        return -EFAULT;
+
+    return 0;
+}
+
+int p2m_wss_domctl(struct domain *d, struct xen_domctl_wss_op *op)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+
+    switch ( op->op )
+    {
+    case XEN_DOMCTL_WSS_OP_ENABLE:
+        return wss_enable(d, op);
+
+    case XEN_DOMCTL_WSS_OP_DISABLE:
+        if ( !p2m->wss )
+            return -ENOENT;
+        if ( d == current->domain )
+            return -EINVAL;
+
+        domain_pause(d);
+        wss_free(p2m);
+        ept_track_accessed(p2m, false);
+        domain_unpause(d);
+
+        return 0;
+
+    case XEN_DOMCTL_WSS_OP_GET:
+        return wss_get(d, op);
+    }
+
+    return -EOPNOTSUPP;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -121,6 +121,7 @@ static int p2m_init_hostp2m(struct domain *d)
                                             RANGESETF_prettyprint_hex);
         if ( p2m->logdirty_ranges )
         {
+            p2m_coalesce_init(p2m);
             d->arch.p2m = p2m;
             return 0;
         }
@@ -136,6 +137,8 @@ static void p2m_teardown_hostp2m(struct domain *d)
 
     if ( p2m )
     {
+        p2m_coalesce_kill(p2m);
+        p2m_wss_disable(p2m);
         rangeset_destroy(p2m->logdirty_ranges);
         p2m_free_one(p2m);
         d->arch.p2m = NULL;
@@ -435,6 +438,17 @@ mfn_t __get_gfn_type_access(struct p2m_domain *p2m, unsigned long gfn_l,
 
     mfn = p2m->get_entry(p2m, gfn, t, a, q, page_order, NULL);
 
+    /*
+     * Holes of forks get populated from their parent.  The gfn lock gets
+     * dropped meanwhile, so look again even if that failed.
+     */
+    if ( locked && (q & P2M_ALLOC) && p2m_is_hole(*t) &&
+         p2m_is_hostp2m(p2m) && mem_sharing_is_fork(p2m->domain) )
+    {
+        mem_sharing_fork_page(p2m->domain, gfn, q & P2M_UNSHARE);
+        mfn = p2m->get_entry(p2m, gfn, t, a, q, page_order, NULL);
+    }
+
     if ( (q & P2M_UNSHARE) && p2m_is_shared(*t) )
     {
         ASSERT(p2m_is_hostp2m(p2m));
@@ -508,8 +522,9 @@ struct page_info *p2m_get_page_from_gfn(
         if ( page )
             return page;
 
-        /* Error path: not a suitable GFN at all */
-        if ( !p2m_is_ram(*t) && !p2m_is_paging(*t) && !p2m_is_pod(*t) )
+        /* Error path: not a suitable GFN at all, nor one forks populate */
+        if ( !p2m_is_ram(*t) && !p2m_is_paging(*t) && !p2m_is_pod(*t) &&
+             !(p2m_is_hole(*t) && mem_sharing_is_fork(p2m->domain)) )
             return NULL;
     }
 
@@ -675,6 +690,12 @@ void p2m_teardown(struct p2m_domain *p2m)
 
     d = p2m->domain;
 
+    if ( p2m_is_hostp2m(p2m) )
+    {
+        p2m_coalesce_kill(p2m);
+        p2m_wss_disable(p2m);
+    }
+
     p2m_lock(p2m);
     ASSERT(atomic_read(&d->shr_pages) == 0);
     p2m->phys_table = pagetable_null();
@@ -1968,6 +1989,78 @@ void np2m_schedule(int dir)
     }
 }
 
+/*
+ * Copying hypercall arguments and emulating string instructions translate
+ * the same few linear pages over and over.  Under HAP, remember successful
+ * walks done on behalf of the current vCPU, keyed by page, access type and
+ * all control state the walk depends upon.  Only the gfn is kept, so p2m
+ * changes are observed by the callers' lookups.
+ *
+ * The guest may modify or flush its page tables without Xen noticing (INVLPG
+ * and CR3 writes aren't intercepted with HAP), so the cache only lives until
+ * the next VM entry.  While the vCPU sits in Xen, other vCPUs' page table
+ * updates become visible no later than through the TLB shootdown they
+ * require, which again can only happen after the vCPU re-entered the guest.
+ * Translations of an L2 guest are dealt with before getting here.
+ */
+static bool walk_cache_usable(const struct vcpu *v)
+{
+    return v == current && is_hvm_vcpu(v) && paging_mode_hap(v->domain);
+}
+
+static bool walk_cache_state_matches(const struct paging_walk_cache *wc,
+                                     const struct vcpu *v)
+{
+    return wc->cr3 == v->arch.hvm_vcpu.guest_cr[3] &&
+           wc->cr0 == v->arch.hvm_vcpu.guest_cr[0] &&
+           wc->cr4 == v->arch.hvm_vcpu.guest_cr[4] &&
+           wc->efer == v->arch.hvm_vcpu.guest_efer;
+}
+
+static unsigned long walk_cache_lookup(const struct vcpu *v,
+                                       unsigned long va, uint32_t pfec)
+{
+    const struct paging_walk_cache *wc = &v->arch.paging.walk_cache;
+    unsigned long page_number = va >> PAGE_SHIFT;
+    const struct paging_walk_cache_entry *e =
+        &wc->entry[page_number % PAGING_WALK_CACHE_ENTRIES];
+
+    if ( e->gen == wc->gen && e->page_number == page_number &&
+         e->pfec == pfec && walk_cache_state_matches(wc, v) )
+    {
+        perfc_incr(walk_cache_hits);
+        return e->gfn;
+    }
+
+    perfc_incr(walk_cache_misses);
+
+    return gfn_x(INVALID_GFN);
+}
+
+static void walk_cache_insert(struct vcpu *v, unsigned long va,
+                              uint32_t pfec, unsigned long gfn)
+{
+    struct paging_walk_cache *wc = &v->arch.paging.walk_cache;
+    unsigned long page_number = va >> PAGE_SHIFT;
+    struct paging_walk_cache_entry *e =
+        &wc->entry[page_number % PAGING_WALK_CACHE_ENTRIES];
+
+    /* Translations done in another paging context are of no use anymore. */
+    if ( !walk_cache_state_matches(wc, v) )
+    {
+        paging_walk_cache_flush(v);
+        wc->cr0 = v->arch.hvm_vcpu.guest_cr[0];
+        wc->cr3 = v->arch.hvm_vcpu.guest_cr[3];
+        wc->cr4 = v->arch.hvm_vcpu.guest_cr[4];
+        wc->efer = v->arch.hvm_vcpu.guest_efer;
+    }
+
+    e->page_number = page_number;
+    e->gfn = gfn;
+    e->pfec = pfec;
+    e->gen = wc->gen;
+}
+
 unsigned long paging_gva_to_gfn(struct vcpu *v,
                                 unsigned long va,
                                 uint32_t *pfec)
@@ -2011,6 +2104,21 @@ unsigned long paging_gva_to_gfn(struct vcpu *v,
         return l1_gfn;
     }
 
+    if ( walk_cache_usable(v) )
+    {
+        uint32_t walk_pfec = *pfec;
+        unsigned long gfn = walk_cache_lookup(v, va, walk_pfec);
+
+        if ( gfn != gfn_x(INVALID_GFN) )
+            return gfn;
+
+        gfn = hostmode->gva_to_gfn(v, hostp2m, va, pfec);
+        if ( gfn != gfn_x(INVALID_GFN) )
+            walk_cache_insert(v, va, walk_pfec, gfn);
+
+        return gfn;
+    }
+
     return hostmode->gva_to_gfn(v, hostp2m, va, pfec);
 }
 
@@ -2065,13 +2173,14 @@ static unsigned int mmio_order(const struct domain *d,
                                unsigned long start_fn, unsigned long nr)
 {
     /*
-     * Note that the !iommu_use_hap_pt() here has three effects:
-     * - cover iommu_{,un}map_page() not having an "order" input yet,
+     * Note that the checks below have three effects:
+     * - cover iommu_{,un}map_page() not having an "order" input yet (which
+     *   doesn't matter when the IOMMU isn't used for the domain at all),
      * - exclude shadow mode (which doesn't support large MMIO mappings),
      * - exclude PV guests, should execution reach this code for such.
      * So be careful when altering this.
      */
-    if ( !need_iommu(d) || !iommu_use_hap_pt(d) ||
+    if ( !hap_enabled(d) || (need_iommu(d) && !iommu_use_hap_pt(d)) ||
          (start_fn & ((1UL << PAGE_ORDER_2M) - 1)) || !(nr >> PAGE_ORDER_2M) )
         return PAGE_ORDER_4K;
 
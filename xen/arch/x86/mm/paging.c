@@ -28,6 +28,7 @@
 #include <asm/event.h>
 #include <asm/hvm/nestedhvm.h>
 #include <xen/numa.h>
+#include <xen/vmap.h>
 #include <xsm/xsm.h>
 #include <public/sched.h> /* SHUTDOWN_suspend */
 
@@ -101,10 +102,48 @@ static mfn_t *paging_map_log_dirty_bitmap(struct domain *d)
     return NULL;
 }
 
+/* get the leaf of the log-dirty bitmap trie covering pfn, if any */
+static mfn_t paging_log_dirty_leaf(struct domain *d, pfn_t pfn)
+{
+    mfn_t mfn = d->arch.paging.log_dirty.top, *node;
+
+    ASSERT(paging_locked_by_me(d));
+
+    if ( !mfn_valid(mfn) )
+        return INVALID_MFN;
+
+    node = map_domain_page(mfn);
+    mfn = node[L4_LOGDIRTY_IDX(pfn)];
+    unmap_domain_page(node);
+    if ( !mfn_valid(mfn) )
+        return INVALID_MFN;
+
+    node = map_domain_page(mfn);
+    mfn = node[L3_LOGDIRTY_IDX(pfn)];
+    unmap_domain_page(node);
+    if ( !mfn_valid(mfn) )
+        return INVALID_MFN;
+
+    node = map_domain_page(mfn);
+    mfn = node[L2_LOGDIRTY_IDX(pfn)];
+    unmap_domain_page(node);
+
+    return mfn;
+}
+
 static void paging_free_log_dirty_page(struct domain *d, mfn_t mfn)
 {
+    struct page_info *page = mfn_to_page(mfn);
+
+    /* Shared leaves belong to their consumer, not to the paging pool. */
+    if ( page_get_owner(page) )
+    {
+        put_page_and_type(page);
+        return;
+    }
+
     d->arch.paging.log_dirty.allocs--;
-    d->arch.paging.free_page(d, mfn_to_page(mfn));
+    d->arch.paging.free_page(d, page);
 }
 
 static int paging_free_log_dirty_bitmap(struct domain *d, int rc)
@@ -195,6 +234,13 @@ static int paging_free_log_dirty_bitmap(struct domain *d, int rc)
         ASSERT(d->arch.paging.log_dirty.allocs == 0);
         d->arch.paging.log_dirty.failed_allocs = 0;
 
+        if ( d->arch.paging.log_dirty.shared_owner )
+        {
+            put_domain(d->arch.paging.log_dirty.shared_owner);
+            d->arch.paging.log_dirty.shared_owner = NULL;
+            d->arch.paging.log_dirty.shared_pfns = 0;
+        }
+
         rc = -d->arch.paging.preempt.log_dirty.done;
         d->arch.paging.preempt.dom = NULL;
     }
@@ -209,6 +255,199 @@ static int paging_free_log_dirty_bitmap(struct domain *d, int rc)
     return rc;
 }
 
+/*
+ * Dirty rings: pages getting set in the log-dirty bitmap also have their GFN
+ * appended to a ring of the vCPU dirtying them, which the toolstack consumes
+ * without having to scan the bitmap.  Slots are only reused once consumed
+ * and reset (see paging_reset_dirty_rings()).  Xen keeps its own copies of
+ * the indexes, and only reads back the consumer index and consumed GFNs from
+ * the shared pages.  The rings are protected by the paging lock.
+ */
+struct paging_dirty_ring {
+    struct xen_dirty_ring *ring;
+    struct page_info *pages[XEN_DIRTY_RING_MAX_FRAMES];
+    unsigned int nr;        /* Entries in ring->gfn[] */
+    unsigned int prod;      /* Next entry to fill */
+    unsigned int reset;     /* Next entry to reset once consumed */
+};
+
+static unsigned int dirty_ring_next(const struct paging_dirty_ring *r,
+                                    unsigned int idx)
+{
+    return idx + 1 < r->nr ? idx + 1 : 0;
+}
+
+static void dirty_ring_push(struct paging_dirty_ring *r, unsigned long gfn)
+{
+    unsigned int next = dirty_ring_next(r, r->prod);
+
+    if ( next == r->reset )
+    {
+        /* The page remains recorded in the bitmap only. */
+        r->ring->overflow = 1;
+        return;
+    }
+
+    r->ring->gfn[r->prod] = gfn;
+    smp_wmb();
+    write_atomic(&r->ring->prod, next);
+    r->prod = next;
+}
+
+static void dirty_rings_free(struct paging_dirty_ring *rings, unsigned int nr,
+                             struct domain *owner)
+{
+    unsigned int i, j;
+
+    for ( i = 0; i < nr; i++ )
+    {
+        if ( rings[i].ring )
+            vunmap(rings[i].ring);
+        for ( j = 0; j < ARRAY_SIZE(rings[i].pages) && rings[i].pages[j];
+              j++ )
+            put_page_and_type(rings[i].pages[j]);
+    }
+
+    xfree(rings);
+    put_domain(owner);
+}
+
+static int dirty_ring_alloc(struct paging_dirty_ring *r, struct domain *owner,
+                            unsigned int frames)
+{
+    mfn_t mfn[ARRAY_SIZE(r->pages)];
+    unsigned int i;
+
+    for ( i = 0; i < frames; i++ )
+    {
+        /*
+         * Like ioreq server pages (see hvm_alloc_ioreq_mfn()), these get
+         * assigned to the consuming domain, which we hold a reference of.
+         */
+        struct page_info *page = alloc_domheap_page(owner, MEMF_no_refcount);
+
+        if ( !page )
+            return -ENOMEM;
+
+        if ( !get_page_type(page, PGT_writable_page) )
+        {
+            put_page(page);
+            return -ENOMEM;
+        }
+
+        r->pages[i] = page;
+        mfn[i] = page_to_mfn(page);
+    }
+
+    r->ring = vmap(mfn, frames);
+    if ( !r->ring )
+        return -ENOMEM;
+
+    memset(r->ring, 0, frames * PAGE_SIZE);
+    r->nr = (frames * PAGE_SIZE - offsetof(struct xen_dirty_ring, gfn)) /
+            sizeof(r->ring->gfn[0]);
+    r->ring->nr_entries = r->nr;
+
+    return 0;
+}
+
+static int paging_enable_dirty_rings(struct domain *d, unsigned long frames)
+{
+    struct domain *owner = current->domain;
+    struct paging_dirty_ring *rings;
+    unsigned int i;
+    int rc = 0;
+
+    /* Re-arming logging of individual pages is implemented for HAP only. */
+    if ( !hap_enabled(d) )
+        return -EOPNOTSUPP;
+
+    if ( !paging_mode_log_dirty(d) || !frames ||
+         frames > XEN_DIRTY_RING_MAX_FRAMES )
+        return -EINVAL;
+
+    if ( d->arch.paging.log_dirty.rings )
+        return -EEXIST;
+
+    /* Entries are only added for pages not yet set in the bitmap. */
+    if ( d->arch.paging.log_dirty.shared_owner )
+        return -EBUSY;
+
+    rings = xzalloc_array(struct paging_dirty_ring, d->max_vcpus);
+    if ( !rings )
+        return -ENOMEM;
+
+    get_knownalive_domain(owner);
+
+    for ( i = 0; !rc && i < d->max_vcpus; i++ )
+        rc = dirty_ring_alloc(&rings[i], owner, frames);
+
+    if ( rc )
+    {
+        dirty_rings_free(rings, d->max_vcpus, owner);
+        return rc;
+    }
+
+    paging_lock(d);
+
+    /* Pages dirtied so far are recorded in the bitmap only. */
+    if ( d->arch.paging.log_dirty.dirty_count )
+        for ( i = 0; i < d->max_vcpus; i++ )
+            rings[i].ring->overflow = 1;
+
+    d->arch.paging.log_dirty.rings = rings;
+    d->arch.paging.log_dirty.ring_owner = owner;
+
+    paging_unlock(d);
+
+    return 0;
+}
+
+static void paging_disable_dirty_rings(struct domain *d)
+{
+    struct paging_dirty_ring *rings;
+    struct domain *owner;
+
+    paging_lock(d);
+    rings = d->arch.paging.log_dirty.rings;
+    owner = d->arch.paging.log_dirty.ring_owner;
+    d->arch.paging.log_dirty.rings = NULL;
+    d->arch.paging.log_dirty.ring_owner = NULL;
+    paging_unlock(d);
+
+    if ( rings )
+        dirty_rings_free(rings, d->max_vcpus, owner);
+}
+
+int paging_get_dirty_ring_frame(struct domain *d, unsigned int id,
+                                unsigned long frame, mfn_t *mfn)
+{
+    const struct paging_dirty_ring *r;
+    int rc = -ENOENT;
+
+    paging_lock(d);
+
+    if ( !d->arch.paging.log_dirty.rings || id >= d->max_vcpus )
+        goto out;
+
+    rc = -EPERM;
+    if ( d->arch.paging.log_dirty.ring_owner != current->domain )
+        goto out;
+
+    r = &d->arch.paging.log_dirty.rings[id];
+    rc = -EINVAL;
+    if ( frame >= ARRAY_SIZE(r->pages) || !r->pages[frame] )
+        goto out;
+
+    *mfn = page_to_mfn(r->pages[frame]);
+    rc = 0;
+
+ out:
+    paging_unlock(d);
+
+    return rc;
+}
+
 int paging_log_dirty_enable(struct domain *d, bool_t log_global)
 {
     int ret;
@@ -245,6 +484,7 @@ static int paging_log_dirty_disable(struct domain *d, bool_t resuming)
             ret = d->arch.paging.log_dirty.ops->disable(d);
             ASSERT(ret <= 0);
         }
+        paging_disable_dirty_rings(d);
     }
 
     ret = paging_free_log_dirty_bitmap(d, ret);
@@ -256,8 +496,11 @@ static int paging_log_dirty_disable(struct domain *d, bool_t resuming)
     return ret;
 }
 
-/* Mark a page as dirty, with taking guest pfn as parameter */
-void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn)
+/*
+ * Mark a page as dirty, with taking guest pfn as parameter, recording it in
+ * the dirty ring of vCPU vcpu_id.
+ */
+static void mark_pfn_dirty(struct domain *d, unsigned int vcpu_id, pfn_t pfn)
 {
     bool changed;
     mfn_t mfn, *l4, *l3, *l2;
@@ -318,7 +561,11 @@ void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn)
         goto out;
 
     l1 = map_domain_page(mfn);
-    changed = !__test_and_set_bit(i1, l1);
+    /* A consumer of a shared bitmap clears bits behind our back. */
+    if ( d->arch.paging.log_dirty.shared_owner )
+        changed = !test_and_set_bit(i1, l1);
+    else
+        changed = !__test_and_set_bit(i1, l1);
     unmap_domain_page(l1);
     if ( changed )
     {
@@ -326,6 +573,9 @@ void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn)
                      "d%d: marked mfn %" PRI_mfn " (pfn %" PRI_pfn ")\n",
                      d->domain_id, mfn_x(mfn), pfn_x(pfn));
         d->arch.paging.log_dirty.dirty_count++;
+        if ( d->arch.paging.log_dirty.rings )
+            dirty_ring_push(&d->arch.paging.log_dirty.rings[vcpu_id],
+                            pfn_x(pfn));
     }
 
 out:
@@ -334,6 +584,20 @@ out:
     return;
 }
 
+/* Mark a page as dirty, with taking guest pfn as parameter */
+void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn)
+{
+    const struct vcpu *curr = current;
+
+    /* Pages dirtied from outside the domain go to vCPU 0's ring. */
+    mark_pfn_dirty(d, curr->domain == d ? curr->vcpu_id : 0, pfn);
+}
+
+void paging_mark_pfn_dirty_vcpu(struct vcpu *v, pfn_t pfn)
+{
+    mark_pfn_dirty(v->domain, v->vcpu_id, pfn);
+}
+
 /* Mark a page as dirty */
 void paging_mark_dirty(struct domain *d, mfn_t gmfn)
 {
@@ -540,6 +804,9 @@ static int paging_log_dirty_op(struct domain *d,
         {
             d->arch.paging.log_dirty.fault_count = 0;
             d->arch.paging.log_dirty.dirty_count = 0;
+            if ( d->arch.paging.log_dirty.rings )
+                for ( i4 = 0; i4 < d->max_vcpus; i4++ )
+                    d->arch.paging.log_dirty.rings[i4].ring->overflow = 0;
         }
     }
     else
@@ -586,6 +853,314 @@ static int paging_log_dirty_op(struct domain *d,
     return rv;
 }
 
+/*
+ * Shared bitmap: the leaves covering pfns [0, shared_pfns) are pages of the
+ * consuming domain, which maps them through XENMEM_acquire_resource and reads
+ * and clears bits itself, using atomic accesses.  CLEAN then only needs to
+ * re-arm dirty logging (see paging_log_dirty_rearm()).
+ */
+static int paging_share_log_dirty_leaf(struct domain *d, unsigned long leaf,
+                                       struct domain *owner)
+{
+    pfn_t pfn = _pfn(leaf << (PAGE_SHIFT + 3));
+    mfn_t mfn, *l4, *l3, *l2;
+    struct page_info *page;
+
+    ASSERT(paging_locked_by_me(d));
+
+    if ( !mfn_valid(d->arch.paging.log_dirty.top) )
+    {
+        d->arch.paging.log_dirty.top = paging_new_log_dirty_node(d);
+        if ( !mfn_valid(d->arch.paging.log_dirty.top) )
+            return -ENOMEM;
+    }
+
+    l4 = paging_map_log_dirty_bitmap(d);
+    mfn = l4[L4_LOGDIRTY_IDX(pfn)];
+    if ( !mfn_valid(mfn) )
+        l4[L4_LOGDIRTY_IDX(pfn)] = mfn = paging_new_log_dirty_node(d);
+    unmap_domain_page(l4);
+    if ( !mfn_valid(mfn) )
+        return -ENOMEM;
+
+    l3 = map_domain_page(mfn);
+    mfn = l3[L3_LOGDIRTY_IDX(pfn)];
+    if ( !mfn_valid(mfn) )
+        l3[L3_LOGDIRTY_IDX(pfn)] = mfn = paging_new_log_dirty_node(d);
+    unmap_domain_page(l3);
+    if ( !mfn_valid(mfn) )
+        return -ENOMEM;
+
+    l2 = map_domain_page(mfn);
+    mfn = l2[L2_LOGDIRTY_IDX(pfn)];
+
+    /* Already shared, when resuming. */
+    if ( mfn_valid(mfn) && page_get_owner(mfn_to_page(mfn)) )
+    {
+        unmap_domain_page(l2);
+        return 0;
+    }
+
+    /* See hvm_alloc_ioreq_mfn() as to the owner of the pages. */
+    page = alloc_domheap_page(owner, MEMF_no_refcount);
+    if ( !page || !get_page_type(page, PGT_writable_page) )
+    {
+        if ( page )
+            put_page(page);
+        unmap_domain_page(l2);
+        return -ENOMEM;
+    }
+
+    /* Take over what has been logged so far. */
+    if ( mfn_valid(mfn) )
+    {
+        copy_domain_page(page_to_mfn(page), mfn);
+        paging_free_log_dirty_page(d, mfn);
+    }
+    else
+        clear_domain_page(page_to_mfn(page));
+
+    l2[L2_LOGDIRTY_IDX(pfn)] = page_to_mfn(page);
+    unmap_domain_page(l2);
+
+    return 0;
+}
+
+static int paging_share_log_dirty_bitmap(struct domain *d, unsigned long pfns,
+                                         bool resuming)
+{
+    struct domain *owner = current->domain;
+    unsigned long leaf;
+    int rc = 0;
+
+    if ( !resuming )
+    {
+        if ( !paging_mode_log_dirty(d) || !pfns ||
+             pfns > (1UL << (PADDR_BITS - PAGE_SHIFT)) )
+            return -EINVAL;
+
+        if ( d->arch.paging.log_dirty.shared_owner ||
+             d->arch.paging.log_dirty.rings )
+            return -EBUSY;
+    }
+
+    paging_lock(d);
+
+    if ( !resuming )
+    {
+        get_knownalive_domain(owner);
+        d->arch.paging.log_dirty.shared_owner = owner;
+        d->arch.paging.log_dirty.shared_pfns = pfns;
+    }
+    else if ( d->arch.paging.log_dirty.shared_owner != owner )
+        rc = -EINVAL;
+
+    for ( leaf = 0;
+          !rc && leaf < DIV_ROUND_UP(pfns, PAGE_SIZE * 8);
+          leaf++ )
+    {
+        rc = paging_share_log_dirty_leaf(d, leaf, owner);
+
+        if ( !rc && !(~leaf & 0x3f) && hypercall_preempt_check() )
+            rc = -ERESTART;
+    }
+
+    if ( rc == -ERESTART )
+    {
+        /* Progress is tracked by the leaves' ownership. */
+        d->arch.paging.preempt.dom = current->domain;
+        d->arch.paging.preempt.op = XEN_DOMCTL_SHADOW_OP_SHARE_BITMAP;
+    }
+    else
+        d->arch.paging.preempt.dom = NULL;
+
+    paging_unlock(d);
+
+    return rc;
+}
+
+int paging_get_log_dirty_frame(struct domain *d, unsigned long frame,
+                               mfn_t *mfn)
+{
+    int rc = -EPERM;
+
+    paging_lock(d);
+
+    if ( !d->arch.paging.log_dirty.shared_owner ||
+         d->arch.paging.log_dirty.shared_owner != current->domain )
+        goto out;
+
+    rc = -EINVAL;
+    if ( frame >= DIV_ROUND_UP(d->arch.paging.log_dirty.shared_pfns,
+                               PAGE_SIZE * 8) )
+        goto out;
+
+    /* Sharing may still be in progress. */
+    rc = -EBUSY;
+    *mfn = paging_log_dirty_leaf(d, _pfn(frame << (PAGE_SHIFT + 3)));
+    if ( !mfn_valid(*mfn) || !page_get_owner(mfn_to_page(*mfn)) )
+        goto out;
+
+    rc = 0;
+
+ out:
+    paging_unlock(d);
+
+    return rc;
+}
+
+/*
+ * CLEAN of a shared bitmap, which the consumer reads and clears itself: the
+ * consumer is to do so before asking for dirty logging to be re-armed, and
+ * only then send the pages found dirty.  GFNs cached by hardware are flushed
+ * into the bitmap before re-arming, so they show up in the next round.
+ */
+static int paging_log_dirty_rearm(struct domain *d,
+                                  struct xen_domctl_shadow_op *sc)
+{
+    int rc = 0;
+
+    if ( !guest_handle_is_null(sc->dirty_bitmap) )
+        return -EINVAL;
+
+    if ( is_hvm_domain(d) && (sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL) )
+        hvm_mapped_guest_frames_mark_dirty(d);
+
+    domain_pause(d);
+
+    p2m_flush_hardware_cached_dirty(d);
+
+    paging_lock(d);
+
+    sc->stats.fault_count = d->arch.paging.log_dirty.fault_count;
+    sc->stats.dirty_count = d->arch.paging.log_dirty.dirty_count;
+    d->arch.paging.log_dirty.fault_count = 0;
+    d->arch.paging.log_dirty.dirty_count = 0;
+
+    if ( unlikely(d->arch.paging.log_dirty.failed_allocs) )
+        rc = -ENOMEM;
+
+    paging_unlock(d);
+
+    if ( !rc )
+        d->arch.paging.log_dirty.ops->clean(d);
+
+    domain_unpause(d);
+
+    sc->pages = 0;
+
+    return rc;
+}
+
+/* Clear a page from the log-dirty bitmap. */
+static void paging_clear_pfn_dirty(struct domain *d, pfn_t pfn)
+{
+    mfn_t mfn;
+    unsigned long *l1;
+
+    if ( !VALID_M2P(pfn_x(pfn)) )
+        return;
+
+    mfn = paging_log_dirty_leaf(d, pfn);
+    if ( !mfn_valid(mfn) )
+        return;
+
+    l1 = map_domain_page(mfn);
+    __clear_bit(L1_LOGDIRTY_IDX(pfn), l1);
+    unmap_domain_page(l1);
+}
+
+/*
+ * Re-arm dirty logging for the pages of consumed dirty ring entries.  Each
+ * page is cleared from the bitmap before being made to log writes again, so
+ * that any write from then on records it afresh.  The consumer must only
+ * (re-)send the pages once this has completed.
+ */
+static int paging_reset_dirty_rings(struct domain *d,
+                                    struct xen_domctl_shadow_op *sc)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    struct paging_dirty_ring *rings = d->arch.paging.log_dirty.rings;
+    unsigned int i, done = 0;
+    int rc = 0;
+
+    if ( !rings )
+        return -EINVAL;
+
+    if ( sc->mode & ~XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL )
+        return -EINVAL;
+
+    if ( unlikely(d->arch.paging.log_dirty.failed_allocs) )
+        return -ENOMEM;
+
+    /* Deferring the p2m flushes until the unlock. */
+    p2m_lock(p2m);
+
+    for ( i = 0; !rc && i < d->max_vcpus; i++ )
+    {
+        struct paging_dirty_ring *r = &rings[i];
+        unsigned int cons = read_atomic(&r->ring->cons), prod;
+
+        /*
+         * The consumer can't get ahead of the producer.  The shared index
+         * gets published ahead of r->prod, so read the latter under the
+         * lock taken for pushing.
+         */
+        paging_lock(d);
+        prod = r->prod;
+        paging_unlock(d);
+
+        if ( cons >= r->nr ||
+             (cons + r->nr - r->reset) % r->nr >
+             (prod + r->nr - r->reset) % r->nr )
+        {
+            rc = -EINVAL;
+            break;
+        }
+
+        while ( r->reset != cons )
+        {
+            unsigned long gfn = read_atomic(&r->ring->gfn[r->reset]);
+
+            paging_lock(d);
+            paging_clear_pfn_dirty(d, _pfn(gfn));
+            r->reset = dirty_ring_next(r, r->reset);
+            paging_unlock(d);
+
+            p2m_change_type_one(d, gfn, p2m_ram_rw, p2m_ram_logdirty);
+
+            if ( !(++done & 0xff) && hypercall_preempt_check() )
+            {
+                rc = -ERESTART;
+                break;
+            }
+        }
+    }
+
+    p2m_unlock(p2m);
+
+    if ( rc == -ERESTART )
+    {
+        /* Progress is tracked by the rings themselves. */
+        d->arch.paging.preempt.dom = current->domain;
+        d->arch.paging.preempt.op = sc->op;
+        return rc;
+    }
+
+    d->arch.paging.preempt.dom = NULL;
+    if ( rc )
+        return rc;
+
+    if ( is_hvm_domain(d) && (sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL) )
+        hvm_mapped_guest_frames_mark_dirty(d);
+
+    domain_pause(d);
+    p2m_flush_hardware_cached_dirty(d);
+    domain_unpause(d);
+
+    return 0;
+}
+
 void paging_log_dirty_range(struct domain *d,
                            unsigned long begin_pfn,
                            unsigned long nr,
@@ -661,6 +1236,9 @@ int paging_domain_init(struct domain *d, unsigned int domcr_flags)
 /* vcpu paging struct initialization goes here */
 void paging_vcpu_init(struct vcpu *v)
 {
+    /* Entries start out with generation 0, i.e. invalid. */
+    v->arch.paging.walk_cache.gen = 1;
+
     if ( hap_enabled(v->domain) )
         hap_vcpu_init(v);
     else
@@ -738,7 +1316,19 @@ int paging_domctl(struct domain *d, struct xen_domctl_shadow_op *sc,
     case XEN_DOMCTL_SHADOW_OP_PEEK:
         if ( sc->mode & ~XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL )
             return -EINVAL;
+        if ( sc->op == XEN_DOMCTL_SHADOW_OP_CLEAN &&
+             d->arch.paging.log_dirty.shared_owner )
+            return paging_log_dirty_rearm(d, sc);
         return paging_log_dirty_op(d, sc, resuming);
+
+    case XEN_DOMCTL_SHADOW_OP_ENABLE_DIRTY_RINGS:
+        return paging_enable_dirty_rings(d, sc->pages);
+
+    case XEN_DOMCTL_SHADOW_OP_RESET_DIRTY_RINGS:
+        return paging_reset_dirty_rings(d, sc);
+
+    case XEN_DOMCTL_SHADOW_OP_SHARE_BITMAP:
+        return paging_share_log_dirty_bitmap(d, sc->pages, resuming);
     }
 
     /* Here, dispatch domctl to the appropriate paging code */
@@ -804,6 +1394,7 @@ int paging_teardown(struct domain *d)
         return -ERESTART;
 
     /* clean up log dirty resources. */
+    paging_disable_dirty_rings(d);
     rc = paging_free_log_dirty_bitmap(d, 0);
     if ( rc == -ERESTART )
         return rc;
@@ -62,6 +62,10 @@ boolean_param("nosmp", opt_nosmp);
 static unsigned int __initdata max_cpus;
 integer_param("maxcpus", max_cpus);
 
+/* smpboot_batch: Number of APs to bring up concurrently at boot. */
+static unsigned int __initdata opt_smpboot_batch = 1;
+integer_param("smpboot_batch", opt_smpboot_batch);
+
 /* opt_invpcid: If false, don't use INVPCID instruction even if available. */
 static bool __initdata opt_invpcid = true;
 boolean_param("invpcid", opt_invpcid);
@@ -1610,6 +1614,11 @@ void __init noreturn __start_xen(unsigned long mbi_p)
      */
     if ( !pv_shim )
     {
+        static cpumask_t __initdata batch;
+        struct cpu_up_times times = {};
+        unsigned int batched = 0;
+        s_time_t start = NOW();
+
         for_each_present_cpu ( i )
         {
             /* Set up cpu_to_node[]. */
@@ -1617,13 +1626,29 @@ void __init noreturn __start_xen(unsigned long mbi_p)
             /* Set up node_to_cpumask based on cpu_to_node[]. */
             numa_add_cpu(i);
 
-            if ( (num_online_cpus() < max_cpus) && !cpu_online(i) )
+            if ( (num_online_cpus() + batched < max_cpus) && !cpu_online(i) )
             {
-                int ret = cpu_up(i);
-                if ( ret != 0 )
-                    printk("Failed to bring up CPU %u (error %d)\n", i, ret);
+                __cpumask_set_cpu(i, &batch);
+                batched++;
+            }
+
+            if ( batched && batched >= opt_smpboot_batch )
+            {
+                cpu_up_batch(&batch, &times);
+                cpumask_clear(&batch);
+                batched = 0;
             }
         }
+
+        if ( batched )
+            cpu_up_batch(&batch, &times);
+
+        printk("AP bringup took %"PRI_stime"ms: prepare %"PRI_stime
+               "ms, kick %"PRI_stime"ms, init+sync %"PRI_stime
+               "ms, online %"PRI_stime"ms\n",
+               (NOW() - start) / MILLISECS(1),
+               times.prepare / MILLISECS(1), times.start / MILLISECS(1),
+               times.finish / MILLISECS(1), times.online / MILLISECS(1));
     }
 
     printk("Brought up %ld CPUs\n", (long)num_online_cpus());
@@ -65,23 +65,31 @@ EXPORT_SYMBOL(cpu_online_map);
 
 unsigned int __read_mostly nr_sockets;
 cpumask_t **__read_mostly socket_cpumask;
-static cpumask_t *secondary_socket_cpumask;
+static DEFINE_PER_CPU(cpumask_t *, socket_cpumask_spare);
+static DEFINE_SPINLOCK(socket_cpumask_lock);
 
 struct cpuinfo_x86 cpu_data[NR_CPUS];
 
 u32 x86_cpu_to_apicid[NR_CPUS] __read_mostly =
 	{ [0 ... NR_CPUS-1] = BAD_APICID };
 
-static int cpu_error;
-static enum cpu_state {
+/*
+ * Bringup state is tracked per CPU, so that several APs can be between
+ * INIT and ONLINE at the same time (see __cpu_up_start()).
+ */
+static DEFINE_PER_CPU(int, cpu_error);
+enum cpu_state {
     CPU_STATE_DYING,    /* slave -> master: I am dying */
     CPU_STATE_DEAD,     /* slave -> master: I am completely dead */
     CPU_STATE_INIT,     /* master -> slave: Early bringup phase 1 */
     CPU_STATE_CALLOUT,  /* master -> slave: Early bringup phase 2 */
     CPU_STATE_CALLIN,   /* slave -> master: Completed phase 2 */
+    CPU_STATE_TSC_SYNC, /* master -> slave: Synchronise TSC with me now. */
     CPU_STATE_ONLINE    /* master -> slave: Go fully online now. */
-} cpu_state;
-#define set_cpu_state(state) do { smp_mb(); cpu_state = (state); } while (0)
+};
+static DEFINE_PER_CPU(enum cpu_state, cpu_state);
+#define set_cpu_state(cpu, state) \
+    do { smp_mb(); per_cpu(cpu_state, cpu) = (state); } while (0)
 
 void *stack_base[NR_CPUS];
 
@@ -99,12 +107,18 @@ static bool smp_store_cpu_info(unsigned int id)
     else if ( !recheck_cpu_features(id) )
         return false;
 
+    /*
+     * Other APs may be coming up at the same time, so each one brings its
+     * own spare mask for the case it is the first CPU seen on its socket.
+     */
     socket = cpu_to_socket(id);
+    spin_lock(&socket_cpumask_lock);
     if ( !socket_cpumask[socket] )
     {
-        socket_cpumask[socket] = secondary_socket_cpumask;
-        secondary_socket_cpumask = NULL;
+        socket_cpumask[socket] = this_cpu(socket_cpumask_spare);
+        this_cpu(socket_cpumask_spare) = NULL;
     }
+    spin_unlock(&socket_cpumask_lock);
 
     return true;
 }
@@ -176,7 +190,7 @@ static void smp_callin(void)
 
     /* Wait 2s total for startup. */
     Dprintk("Waiting for CALLOUT.\n");
-    for ( i = 0; cpu_state != CPU_STATE_CALLOUT; i++ )
+    for ( i = 0; this_cpu(cpu_state) != CPU_STATE_CALLOUT; i++ )
     {
         BUG_ON(i >= 200);
         cpu_relax();
@@ -196,14 +210,14 @@ static void smp_callin(void)
     {
         printk("CPU%u: Failed to validate features - not coming back online\n",
                cpu);
-        cpu_error = -ENXIO;
+        this_cpu(cpu_error) = -ENXIO;
         goto halt;
     }
 
     if ( (rc = hvm_cpu_up()) != 0 )
     {
         printk("CPU%d: Failed to initialise HVM. Not coming online.\n", cpu);
-        cpu_error = rc;
+        this_cpu(cpu_error) = rc;
     halt:
         clear_local_APIC();
         spin_debug_enable();
@@ -212,16 +226,21 @@ static void smp_callin(void)
     }
 
     /* Allow the master to continue. */
-    set_cpu_state(CPU_STATE_CALLIN);
+    set_cpu_state(cpu, CPU_STATE_CALLIN);
+
+    /* The master synchronises TSCs with one AP at a time. */
+    while ( this_cpu(cpu_state) == CPU_STATE_CALLIN )
+        cpu_relax();
 
     synchronize_tsc_slave(cpu);
 
     /* And wait for our final Ack. */
-    while ( cpu_state != CPU_STATE_ONLINE )
+    while ( this_cpu(cpu_state) != CPU_STATE_ONLINE )
         cpu_relax();
 }
 
-static int booting_cpu;
+/* Handed to the AP in the trampoline, cleared once it has taken it. */
+static unsigned int booting_cpu = NR_CPUS;
 
 /* CPUs for which sibling maps can be computed. */
 static cpumask_t cpu_sibling_setup_map;
@@ -313,6 +332,13 @@ void start_secondary(void *unused)
     /* Critical region without IDT or TSS.  Any fault is deadly! */
 
     set_processor_id(cpu);
+
+    /*
+     * We are on our own stack and know who we are: the master may now
+     * start the next AP through the trampoline.
+     */
+    smp_mb();
+    booting_cpu = NR_CPUS;
     set_current(idle_vcpu[cpu]);
     this_cpu(curr_vcpu) = idle_vcpu[cpu];
     rdmsrl(MSR_EFER, this_cpu(efer));
@@ -524,6 +550,12 @@ int alloc_cpu_id(void)
     return (cpu < nr_cpu_ids) ? cpu : -ENODEV;
 }
 
+/*
+ * Kick @cpu through the trampoline.  Returns as soon as the AP has picked up
+ * its stack and CPU number, leaving it to carry on with its own early
+ * initialisation while the caller starts further APs or waits for it in
+ * do_boot_cpu_callin().
+ */
 static int do_boot_cpu(int apicid, int cpu)
 {
     int timeout, boot_error = 0, rc = 0;
@@ -549,7 +581,7 @@ static int do_boot_cpu(int apicid, int cpu)
 
     /* This grunge runs the startup process for the targeted processor. */
 
-    set_cpu_state(CPU_STATE_INIT);
+    set_cpu_state(cpu, CPU_STATE_INIT);
 
     Dprintk("Setting warm reset code and vector.\n");
 
@@ -562,31 +594,18 @@ static int do_boot_cpu(int apicid, int cpu)
     if ( !boot_error )
     {
         /* Allow AP to start initializing. */
-        set_cpu_state(CPU_STATE_CALLOUT);
+        set_cpu_state(cpu, CPU_STATE_CALLOUT);
         Dprintk("After Callout %d.\n", cpu);
 
-        /* Wait 5s total for a response. */
+        /* Wait 5s total for the AP to leave the trampoline. */
         for ( timeout = 0; timeout < 50000; timeout++ )
         {
-            if ( cpu_state != CPU_STATE_CALLOUT )
+            if ( booting_cpu != cpu )
                 break;
             udelay(100);
         }
 
-        if ( cpu_state == CPU_STATE_CALLIN )
-        {
-            /* number CPUs logically, starting from 1 (BSP is 0) */
-            Dprintk("OK.\n");
-            print_cpu_info(cpu);
-            synchronize_tsc_master(cpu);
-            Dprintk("CPU has booted.\n");
-        }
-        else if ( cpu_state == CPU_STATE_DEAD )
-        {
-            smp_rmb();
-            rc = cpu_error;
-        }
-        else
+        if ( booting_cpu == cpu )
         {
             boot_error = 1;
             smp_mb();
@@ -605,6 +624,8 @@ static int do_boot_cpu(int apicid, int cpu)
         rc = -EIO;
     }
 
+    booting_cpu = NR_CPUS;
+
     /* mark "stuck" area as not stuck */
     bootsym(trampoline_cpu_started) = 0;
     smp_mb();
@@ -614,6 +635,42 @@ static int do_boot_cpu(int apicid, int cpu)
     return rc;
 }
 
+/* Wait for an AP kicked by do_boot_cpu() to check in, and sync its TSC. */
+static int do_boot_cpu_callin(unsigned int cpu)
+{
+    int timeout;
+
+    /* Wait 5s total for a response. */
+    for ( timeout = 0; timeout < 50000; timeout++ )
+    {
+        if ( per_cpu(cpu_state, cpu) != CPU_STATE_CALLOUT )
+            break;
+        udelay(100);
+    }
+
+    if ( per_cpu(cpu_state, cpu) == CPU_STATE_CALLIN )
+    {
+        /* number CPUs logically, starting from 1 (BSP is 0) */
+        Dprintk("OK.\n");
+        print_cpu_info(cpu);
+        set_cpu_state(cpu, CPU_STATE_TSC_SYNC);
+        synchronize_tsc_master(cpu);
+        Dprintk("CPU has booted.\n");
+        return 0;
+    }
+
+    if ( per_cpu(cpu_state, cpu) == CPU_STATE_DEAD )
+    {
+        smp_rmb();
+        return per_cpu(cpu_error, cpu);
+    }
+
+    printk("CPU%u: Stuck ??\n", cpu);
+    cpu_exit_clear(cpu);
+
+    return -EIO;
+}
+
 #define STUB_BUF_CPU_OFFS(cpu) (((cpu) & (STUBS_PER_PAGE - 1)) * STUB_BUF_SIZE)
 
 unsigned long alloc_stub_page(unsigned int cpu, unsigned long *mfn)
@@ -654,7 +711,7 @@ unsigned long alloc_stub_page(unsigned int cpu, unsigned long *mfn)
 void cpu_exit_clear(unsigned int cpu)
 {
     cpu_uninit(cpu);
-    set_cpu_state(CPU_STATE_DEAD);
+    set_cpu_state(cpu, CPU_STATE_DEAD);
 }
 
 static int clone_mapping(const void *ptr, root_pgentry_t *rpt)
@@ -903,6 +960,9 @@ static void cpu_smpboot_free(unsigned int cpu)
     c[cpu].compute_unit_id = INVALID_CUID;
     cpumask_clear_cpu(cpu, &cpu_sibling_setup_map);
 
+    xfree(per_cpu(socket_cpumask_spare, cpu));
+    per_cpu(socket_cpumask_spare, cpu) = NULL;
+
     free_cpumask_var(per_cpu(cpu_sibling_mask, cpu));
     free_cpumask_var(per_cpu(cpu_core_mask, cpu));
     if ( per_cpu(scratch_cpumask, cpu) != &scratch_cpu0mask )
@@ -999,8 +1059,8 @@ static int cpu_smpboot_alloc(unsigned int cpu)
         goto out;
     rc = -ENOMEM;
 
-    if ( secondary_socket_cpumask == NULL &&
-         (secondary_socket_cpumask = xzalloc(cpumask_t)) == NULL )
+    if ( per_cpu(socket_cpumask_spare, cpu) == NULL &&
+         (per_cpu(socket_cpumask_spare, cpu) = xzalloc(cpumask_t)) == NULL )
         goto out;
 
     if ( !(zalloc_cpumask_var(&per_cpu(cpu_sibling_mask, cpu)) &&
@@ -1028,6 +1088,11 @@ static int cpu_smpboot_callback(
     case CPU_UP_PREPARE:
         rc = cpu_smpboot_alloc(cpu);
         break;
+    case CPU_ONLINE:
+        /* Only needed while coming up, see smp_store_cpu_info(). */
+        xfree(per_cpu(socket_cpumask_spare, cpu));
+        per_cpu(socket_cpumask_spare, cpu) = NULL;
+        break;
     case CPU_UP_CANCELED:
     case CPU_DEAD:
         cpu_smpboot_free(cpu);
@@ -1174,7 +1239,7 @@ void __cpu_disable(void)
 {
     int cpu = smp_processor_id();
 
-    set_cpu_state(CPU_STATE_DYING);
+    set_cpu_state(cpu, CPU_STATE_DYING);
 
     local_irq_disable();
     clear_local_APIC();
@@ -1202,7 +1267,7 @@ void __cpu_die(unsigned int cpu)
     unsigned int i = 0;
     enum cpu_state seen_state;
 
-    while ( (seen_state = cpu_state) != CPU_STATE_DEAD )
+    while ( (seen_state = per_cpu(cpu_state, cpu)) != CPU_STATE_DEAD )
     {
         BUG_ON(seen_state != CPU_STATE_DYING);
         mdelay(100);
@@ -1287,19 +1352,26 @@ int cpu_add(uint32_t apic_id, uint32_t acpi_id, uint32_t pxm)
 }
 
 
-int __cpu_up(unsigned int cpu)
+int __cpu_up_start(unsigned int cpu)
 {
-    int apicid, ret;
+    int apicid;
 
     if ( (apicid = x86_cpu_to_apicid[cpu]) == BAD_APICID )
         return -ENODEV;
 
-    if ( (ret = do_boot_cpu(apicid, cpu)) != 0 )
+    return do_boot_cpu(apicid, cpu);
+}
+
+int __cpu_up_finish(unsigned int cpu)
+{
+    int ret;
+
+    if ( (ret = do_boot_cpu_callin(cpu)) != 0 )
         return ret;
 
     time_latch_stamps();
 
-    set_cpu_state(CPU_STATE_ONLINE);
+    set_cpu_state(cpu, CPU_STATE_ONLINE);
     while ( !cpu_online(cpu) )
     {
         cpu_relax();
@@ -1309,6 +1381,13 @@ int __cpu_up(unsigned int cpu)
     return 0;
 }
 
+int __cpu_up(unsigned int cpu)
+{
+    int ret = __cpu_up_start(cpu);
+
+    return ret ?: __cpu_up_finish(cpu);
+}
+
 
 void __init smp_cpus_done(void)
 {
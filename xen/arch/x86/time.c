@@ -23,6 +23,7 @@
 #include <xen/cpuidle.h>
 #include <xen/symbols.h>
 #include <xen/keyhandler.h>
+#include <xen/sort.h>
 #include <xen/guest_access.h>
 #include <asm/io.h>
 #include <asm/msr.h>
@@ -42,6 +43,15 @@
 static char __initdata opt_clocksource[10];
 string_param("clocksource", opt_clocksource);
 
+/* opt_time_rendezvous: Flavour of the periodic time calibration rendezvous. */
+enum time_rendezvous {
+    TIME_RENDEZVOUS_FLAT,
+    TIME_RENDEZVOUS_SOCKET,
+    TIME_RENDEZVOUS_SKIP,
+};
+static enum time_rendezvous __initdata opt_time_rendezvous =
+    TIME_RENDEZVOUS_SOCKET;
+
 unsigned long __read_mostly cpu_khz;  /* CPU clock frequency in kHz. */
 DEFINE_SPINLOCK(rtc_lock);
 unsigned long pit0_ticks;
@@ -73,6 +83,12 @@ static DEFINE_PER_CPU(struct cpu_time, cpu_time);
 #define EPOCH MILLISECS(1000)
 static struct timer calibration_timer;
 
+/* Durations (in ns) of the most recent calibration rendezvous. */
+#define RENDEZVOUS_SAMPLES 512
+static uint32_t rendezvous_ns[RENDEZVOUS_SAMPLES];
+static uint32_t rendezvous_max_ns;
+static unsigned long rendezvous_count;
+
 /*
  * We simulate a 32-bit platform timer from the 16-bit PIT ch2 counter.
  * Otherwise overflow happens too quickly (~50ms) for us to guarantee that
@@ -1449,8 +1465,20 @@ struct calibration_rendezvous {
     atomic_t semaphore;
     s_time_t master_stime;
     u64 master_tsc_stamp;
+    unsigned int generation;
+    unsigned int nr_leaders;
 };
 
+/*
+ * Per-socket state of the hierarchical rendezvous, living in the per-CPU
+ * area of the socket's leader.
+ */
+struct calibration_socket {
+    atomic_t arrived;
+    unsigned int release;
+};
+static DEFINE_PER_CPU(struct calibration_socket, calibration_socket);
+
 static void
 time_calibration_rendezvous_tail(const struct calibration_rendezvous *r)
 {
@@ -1538,6 +1566,72 @@ static void time_calibration_std_rendezvous(void *_r)
     time_calibration_rendezvous_tail(r);
 }
 
+/*
+ * The leader of a socket is its lowest numbered CPU taking part in the
+ * rendezvous (hence CPU 0 always leads its socket).  Also returns the number
+ * of participating CPUs in the socket.
+ */
+static unsigned int calibration_leader(const struct calibration_rendezvous *r,
+                                       unsigned int cpu, unsigned int *nr)
+{
+    unsigned int i, leader = cpu;
+
+    *nr = 0;
+    for_each_cpu ( i, socket_cpumask[cpu_to_socket(cpu)] )
+        if ( cpumask_test_cpu(i, &r->cpu_calibration_map) && !(*nr)++ )
+            leader = i;
+
+    return leader;
+}
+
+/*
+ * Two level variant of the ordinary rendezvous: CPUs only ever spin on a
+ * cache line shared within their socket, and only socket leaders rendezvous
+ * with the master.
+ */
+static void time_calibration_socket_rendezvous(void *_r)
+{
+    struct calibration_rendezvous *r = _r;
+    unsigned int cpu = smp_processor_id(), nr;
+    unsigned int leader = calibration_leader(r, cpu, &nr);
+    struct calibration_socket *s = &per_cpu(calibration_socket, leader);
+
+    if ( cpu != leader )
+    {
+        atomic_inc(&s->arrived);
+        while ( read_atomic(&s->release) != r->generation )
+            cpu_relax();
+        smp_rmb(); /* receive signal /then/ read r->master_stime */
+        time_calibration_rendezvous_tail(r);
+        return;
+    }
+
+    while ( atomic_read(&s->arrived) != (nr - 1) )
+        cpu_relax();
+    atomic_set(&s->arrived, 0);
+
+    if ( cpu == 0 )
+    {
+        while ( atomic_read(&r->semaphore) != (r->nr_leaders - 1) )
+            cpu_relax();
+        r->master_stime = read_platform_stime(NULL);
+        smp_wmb(); /* write r->master_stime /then/ signal */
+        atomic_inc(&r->semaphore);
+    }
+    else
+    {
+        atomic_inc(&r->semaphore);
+        while ( atomic_read(&r->semaphore) != r->nr_leaders )
+            cpu_relax();
+        smp_rmb(); /* receive signal /then/ read r->master_stime */
+    }
+
+    /* Pass the master's signal on to the rest of the socket. */
+    write_atomic(&s->release, r->generation);
+
+    time_calibration_rendezvous_tail(r);
+}
+
 /*
  * Rendezvous function used when clocksource is TSC and
  * no CPU hotplug will be performed.
@@ -1554,16 +1648,37 @@ static void time_calibration_nop_rendezvous(void *rv)
     raise_softirq(TIME_CALIBRATE_SOFTIRQ);
 }
 
+/*
+ * Rendezvous function used when TSCs are invariant and known to be in sync:
+ * the master's TSC stamp is valid on every CPU, so nobody needs to wait for
+ * anybody else.
+ */
+static void time_calibration_skip_rendezvous(void *rv)
+{
+    const struct calibration_rendezvous *r = rv;
+    struct cpu_time_stamp *c = &this_cpu(cpu_calibration);
+
+    c->local_tsc    = r->master_tsc_stamp;
+    c->local_stime  = get_s_time_fixed(r->master_tsc_stamp);
+    c->master_stime = r->master_stime;
+
+    raise_softirq(TIME_CALIBRATE_SOFTIRQ);
+}
+
 static void (*time_calibration_rendezvous_fn)(void *) =
     time_calibration_std_rendezvous;
 
 static void time_calibration(void *unused)
 {
+    static unsigned int generation;
     struct calibration_rendezvous r = {
-        .semaphore = ATOMIC_INIT(0)
+        .semaphore = ATOMIC_INIT(0),
+        .generation = ++generation,
     };
+    s_time_t start, elapsed;
 
-    if ( clocksource_is_tsc() )
+    if ( clocksource_is_tsc() ||
+         time_calibration_rendezvous_fn == time_calibration_skip_rendezvous )
     {
         local_irq_disable();
         r.master_stime = read_platform_stime(&r.master_tsc_stamp);
@@ -1572,10 +1687,29 @@ static void time_calibration(void *unused)
 
     cpumask_copy(&r.cpu_calibration_map, &cpu_online_map);
 
+    if ( time_calibration_rendezvous_fn == time_calibration_socket_rendezvous )
+    {
+        unsigned int i;
+
+        for ( i = 0; i < nr_sockets; i++ )
+            if ( socket_cpumask[i] &&
+                 cpumask_intersects(socket_cpumask[i],
+                                    &r.cpu_calibration_map) )
+                r.nr_leaders++;
+    }
+
+    start = NOW();
+
     /* @wait=1 because we must wait for all cpus before freeing @r. */
     on_selected_cpus(&r.cpu_calibration_map,
                      time_calibration_rendezvous_fn,
                      &r, 1);
+
+    elapsed = NOW() - start;
+    rendezvous_ns[rendezvous_count++ % RENDEZVOUS_SAMPLES] =
+        min_t(s_time_t, elapsed, UINT32_MAX);
+    if ( elapsed > rendezvous_max_ns )
+        rendezvous_max_ns = min_t(s_time_t, elapsed, UINT32_MAX);
 }
 
 static struct cpu_time_stamp ap_bringup_ref;
@@ -1770,6 +1904,19 @@ static int __init verify_tsc_reliability(void)
     if ( boot_cpu_has(X86_FEATURE_CONSTANT_TSC) &&
          !boot_cpu_has(X86_FEATURE_TSC_RELIABLE) )
         time_calibration_rendezvous_fn = time_calibration_tsc_rendezvous;
+    /* Invariant TSCs which passed the warp test need no lockstep at all. */
+    else if ( opt_time_rendezvous == TIME_RENDEZVOUS_SKIP &&
+              boot_cpu_has(X86_FEATURE_CONSTANT_TSC) &&
+              boot_cpu_has(X86_FEATURE_NONSTOP_TSC) &&
+              boot_cpu_has(X86_FEATURE_TSC_RELIABLE) )
+        time_calibration_rendezvous_fn = time_calibration_skip_rendezvous;
+    else if ( opt_time_rendezvous != TIME_RENDEZVOUS_FLAT )
+    {
+        if ( opt_time_rendezvous == TIME_RENDEZVOUS_SKIP )
+            printk(XENLOG_WARNING
+                   "TSC not invariant and reliable, can't skip rendezvous\n");
+        time_calibration_rendezvous_fn = time_calibration_socket_rendezvous;
+    }
 
     return 0;
 }
@@ -2002,6 +2149,26 @@ static int __init tsc_parse(const char *s)
 }
 custom_param("tsc", tsc_parse);
 
+/*
+ * time_rendezvous=flat: All CPUs rendezvous with the master directly.
+ * time_rendezvous=socket: CPUs gather per socket, socket leaders with master.
+ * time_rendezvous=skip: No rendezvous at all if TSC is invariant and reliable.
+ */
+static int __init parse_time_rendezvous(const char *s)
+{
+    if ( !strcmp(s, "flat") )
+        opt_time_rendezvous = TIME_RENDEZVOUS_FLAT;
+    else if ( !strcmp(s, "socket") )
+        opt_time_rendezvous = TIME_RENDEZVOUS_SOCKET;
+    else if ( !strcmp(s, "skip") )
+        opt_time_rendezvous = TIME_RENDEZVOUS_SKIP;
+    else
+        return -EINVAL;
+
+    return 0;
+}
+custom_param("time_rendezvous", parse_time_rendezvous);
+
 u64 gtime_to_gtsc(struct domain *d, u64 time)
 {
     if ( !is_hvm_domain(d) )
@@ -2207,12 +2374,52 @@ void tsc_set_info(struct domain *d,
     recalculate_cpuid_policy(d);
 }
 
+static int cmp_rendezvous_ns(const void *a, const void *b)
+{
+    uint32_t l = *(const uint32_t *)a, r = *(const uint32_t *)b;
+
+    return l < r ? -1 : l > r;
+}
+
+static void dump_rendezvous_stats(void)
+{
+    static uint32_t sorted[RENDEZVOUS_SAMPLES];
+    unsigned int nr = min_t(unsigned long, rendezvous_count,
+                            RENDEZVOUS_SAMPLES);
+    const char *name = "std";
+
+    if ( time_calibration_rendezvous_fn == time_calibration_tsc_rendezvous )
+        name = "tsc";
+    else if ( time_calibration_rendezvous_fn ==
+              time_calibration_socket_rendezvous )
+        name = "socket";
+    else if ( time_calibration_rendezvous_fn ==
+              time_calibration_skip_rendezvous )
+        name = "skip";
+    else if ( time_calibration_rendezvous_fn ==
+              time_calibration_nop_rendezvous )
+        name = "nop";
+
+    printk("Time calibration rendezvous: %s, %lu runs, max %uns\n",
+           name, rendezvous_count, rendezvous_max_ns);
+    if ( !nr )
+        return;
+
+    memcpy(sorted, rendezvous_ns, nr * sizeof(*sorted));
+    sort(sorted, nr, sizeof(*sorted), cmp_rendezvous_ns, NULL);
+    printk("  last %u: p50 %uns p90 %uns p99 %uns max %uns\n", nr,
+           sorted[nr / 2], sorted[nr * 9 / 10], sorted[nr * 99 / 100],
+           sorted[nr - 1]);
+}
+
 /* vtsc may incur measurable performance degradation, diagnose with this */
 static void dump_softtsc(unsigned char key)
 {
     struct domain *d;
     int domcnt = 0;
 
+    dump_rendezvous_stats();
+
     tsc_check_reliability();
     if ( boot_cpu_has(X86_FEATURE_TSC_RELIABLE) )
         printk("TSC marked as reliable, "
@@ -2255,7 +2462,8 @@ static void dump_softtsc(unsigned char key)
 
 static int __init setup_dump_softtsc(void)
 {
-    register_keyhandler('s', dump_softtsc, "dump softtsc stats", 1);
+    register_keyhandler('s', dump_softtsc,
+                        "dump softtsc and time calibration stats", 1);
     return 0;
 }
 __initcall(setup_dump_softtsc);
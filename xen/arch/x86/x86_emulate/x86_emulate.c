@@ -698,7 +698,7 @@ struct x86_emulate_state {
         rmw_xor,
     } rmw;
     uint8_t modrm, modrm_mod, modrm_reg, modrm_rm;
-    uint8_t sib_index, sib_scale;
+    uint8_t sib_index, sib_scale, sib_base;
     uint8_t rex_prefix;
     bool lock_prefix;
     bool not_64bit; /* Instruction not available in 64bit. */
@@ -2934,6 +2934,7 @@ x86_decode(
                 uint8_t sib = insn_fetch_type(uint8_t);
                 uint8_t sib_base = (sib & 7) | ((rex_prefix << 3) & 8);
 
+                state->sib_base = sib_base;
                 state->sib_index = ((sib >> 3) & 7) | ((rex_prefix << 2) & 8);
                 state->sib_scale = (sib >> 6) & 3;
                 if ( state->sib_index != 4 && !(d & vSIB) )
@@ -3149,6 +3150,152 @@ x86_decode(
     return rc;
 }
 
+/*
+ * The register contents x86_decode() folded into the offset of a (ModRM)
+ * memory operand.
+ */
+static unsigned long
+decode_ea_regs(
+    const struct x86_emulate_state *state,
+    struct cpu_user_regs *regs)
+{
+    unsigned long off = 0;
+
+    if ( ea.type != OP_MEM || modrm_mod > 2 )
+        return 0;
+
+    if ( ad_bytes == 2 )
+    {
+        switch ( modrm_rm )
+        {
+        case 0: return regs->bx + regs->si;
+        case 1: return regs->bx + regs->di;
+        case 2: return regs->bp + regs->si;
+        case 3: return regs->bp + regs->di;
+        case 4: return regs->si;
+        case 5: return regs->di;
+        case 6: return modrm_mod ? regs->bp : 0;
+        default: return regs->bx;
+        }
+    }
+
+    if ( modrm_rm != 4 )
+        return modrm_mod || (modrm_rm & 7) != 5 ? *decode_gpr(regs, modrm_rm)
+                                                : 0;
+
+    if ( state->sib_index != 4 )
+        off = *decode_gpr(regs, state->sib_index) << state->sib_scale;
+
+    if ( modrm_mod == 0 && (state->sib_base & 7) == 5 )
+        return off;
+    if ( state->sib_base == 4 )
+        return off + regs->r(sp);
+    if ( state->sib_base == 5 )
+        return off + regs->r(bp);
+
+    return off + *decode_gpr(regs, state->sib_base);
+}
+
+/*
+ * Whether C4, C5, 62 and 8F introduce VEX, EVEX or XOP encodings depends on
+ * more than the address size, and vSIB operands aren't accounted for by
+ * decode_ea_regs().  Don't cache any of these.
+ */
+static bool
+decode_cacheable(
+    const struct x86_emulate_state *state,
+    const struct x86_emulate_ctxt *ctxt)
+{
+    if ( vex.opcx )
+        return false;
+
+    switch ( ctxt->opcode & ~X86EMUL_OPC_PFX_MASK )
+    {
+    case 0x62: case 0x8f: case 0xc4: case 0xc5:
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * x86_decode() through ctxt->decode_cache, if any.  Other than the
+ * instruction bytes and the address size, only register contents (folded
+ * into memory operand offsets) and the CPUID policy affect decoding; the
+ * former get re-applied, while the latter isn't expected to change.
+ */
+static int
+x86_decode_cached(
+    struct x86_emulate_state *state,
+    struct x86_emulate_ctxt *ctxt,
+    const struct x86_emulate_ops *ops)
+{
+    struct x86_emulate_decode_cache *cache = ctxt->decode_cache;
+    struct x86_decode_cache_entry *ent;
+    unsigned long ip = ctxt->regs->r(ip);
+    uint8_t insn[MAX_INST_LEN];
+    unsigned int i, j;
+    int rc;
+
+    BUILD_BUG_ON(sizeof(*state) > sizeof(ent->state));
+
+    if ( !cache )
+        return x86_decode(state, ctxt, ops);
+
+    for ( i = 0; i < ARRAY_SIZE(cache->ent); i++ )
+    {
+        ent = &cache->ent[i];
+        if ( !ent->len || ent->ip != ip || ent->addr_size != ctxt->addr_size )
+            continue;
+
+        if ( ops->insn_fetch(x86_seg_cs, ip, insn, ent->len,
+                             ctxt) != X86EMUL_OKAY )
+            break;
+
+        for ( j = 0; j < ent->len && insn[j] == ent->insn[j]; j++ )
+            continue;
+        if ( j < ent->len )
+        {
+            ent->len = 0;
+            break;
+        }
+
+        *state = *(const struct x86_emulate_state *)ent->state;
+        state->regs = ctxt->regs;
+        if ( ea.type == OP_MEM )
+            ea.mem.off = truncate_ea(ent->ea_disp +
+                                     decode_ea_regs(state, ctxt->regs));
+
+        ctxt->opcode = ent->opcode;
+        ctxt->retire.raw = 0;
+        x86_emul_reset_event(ctxt);
+
+        return X86EMUL_OKAY;
+    }
+
+    rc = x86_decode(state, ctxt, ops);
+    if ( rc != X86EMUL_OKAY || !decode_cacheable(state, ctxt) )
+        return rc;
+
+    ent = &cache->ent[cache->next++ % ARRAY_SIZE(cache->ent)];
+    ent->len = state->ip - ip;
+    if ( ops->insn_fetch(x86_seg_cs, ip, ent->insn, ent->len,
+                         ctxt) != X86EMUL_OKAY )
+    {
+        ent->len = 0;
+        x86_emul_reset_event(ctxt);
+        return rc;
+    }
+
+    ent->ip = ip;
+    ent->addr_size = ctxt->addr_size;
+    ent->opcode = ctxt->opcode;
+    ent->ea_disp = ea.mem.off - decode_ea_regs(state, ctxt->regs);
+    *(struct x86_emulate_state *)ent->state = *state;
+
+    return rc;
+}
+
 /* No insn fetching past this point. */
 #undef insn_fetch_bytes
 #undef insn_fetch_type
@@ -3185,7 +3332,7 @@ x86_emulate(
 
     ASSERT(ops->read);
 
-    rc = x86_decode(&state, ctxt, ops);
+    rc = x86_decode_cached(&state, ctxt, ops);
     if ( rc != X86EMUL_OKAY )
         return rc;
 
@@ -8938,6 +9085,259 @@ int x86_emulate_wrapper(
 }
 #endif
 
+/* Fetch the next part of an instruction handled by x86_emulate_simple(). */
+#define simple_fetch(type) ({                                           \
+    type x_ = 0;                                                        \
+    if ( (uint8_t)(ip + sizeof(type) - ctxt->regs->r(ip)) > MAX_INST_LEN ) \
+        return X86EMUL_UNIMPLEMENTED; /* Let x86_emulate() raise #GP. */ \
+    rc = ops->insn_fetch(x86_seg_cs, ip, &x_, sizeof(type), ctxt);      \
+    if ( rc != X86EMUL_OKAY )                                           \
+        return rc;                                                      \
+    ip += sizeof(type);                                                 \
+    x_;                                                                 \
+})
+
+static void simple_write_gpr(void *reg, unsigned long val, unsigned int bytes)
+{
+    /* The 4-byte case *is* correct: in 64-bit mode we zero-extend. */
+    switch ( bytes )
+    {
+    case 1: *(uint8_t  *)reg = val; break;
+    case 2: *(uint16_t *)reg = val; break;
+    case 4: *(unsigned long *)reg = (uint32_t)val; break;
+    case 8: *(unsigned long *)reg = val; break;
+    }
+}
+
+/*
+ * Fast path for the plain moves making up the vast majority of MMIO
+ * accesses: MOV between memory and a GPR, MOV of an immediate to memory,
+ * MOVZX, MOVSX, MOVNTI, and (non-REP) STOS, all with 32- or 64-bit
+ * addressing.  For anything else, including any prefix other than operand
+ * size, segment override, and REX, X86EMUL_UNIMPLEMENTED gets returned
+ * with no state changed, for the caller to use x86_emulate() instead.
+ * Neither ops->validate nor single stepping are dealt with here.
+ */
+int
+x86_emulate_simple(
+    struct x86_emulate_ctxt *ctxt,
+    const struct x86_emulate_ops *ops)
+{
+    struct cpu_user_regs *regs = ctxt->regs;
+    unsigned long ip = regs->r(ip), off = 0, val = 0;
+    enum x86_segment seg = x86_seg_ds, override_seg = x86_seg_none;
+    unsigned int ad_bytes = ctxt->addr_size / 8, def_op_bytes, op_bytes;
+    unsigned int opcode, modrm, modrm_mod, modrm_reg, modrm_rm, bytes;
+    uint8_t b, rex_prefix = 0;
+    bool pc_rel = false;
+    int rc;
+
+    if ( ad_bytes == 2 || (regs->eflags & X86_EFLAGS_TF) ||
+         !ops->read || !ops->write )
+        return X86EMUL_UNIMPLEMENTED;
+#ifndef __x86_64__
+    if ( ad_bytes == 8 )
+        return X86EMUL_UNHANDLEABLE;
+#endif
+
+    ctxt->retire.raw = 0;
+    x86_emul_reset_event(ctxt);
+
+    op_bytes = def_op_bytes = ad_bytes == 8 ? 4 : ad_bytes;
+
+    /* Prefix bytes. */
+    for ( ; ; )
+    {
+        switch ( b = simple_fetch(uint8_t) )
+        {
+        case 0x66: /* operand-size override */
+            op_bytes = def_op_bytes ^ 6;
+            break;
+        case 0x26: case 0x2e: case 0x36: case 0x3e: /* ES/CS/SS/DS */
+            override_seg = (b >> 3) & 3;
+            break;
+        case 0x64: case 0x65: /* FS/GS override */
+            override_seg = x86_seg_fs + (b & 1);
+            break;
+        case 0x40 ... 0x4f: /* REX */
+            if ( !mode_64bit() )
+                goto done_prefixes;
+            rex_prefix = b;
+            continue;
+        default:
+            goto done_prefixes;
+        }
+
+        /* Leave legacy prefixes following a REX one to x86_emulate(). */
+        if ( rex_prefix )
+            return X86EMUL_UNIMPLEMENTED;
+    }
+ done_prefixes:
+
+    /* %{e,c,s,d}s overrides are ignored in 64bit mode. */
+    if ( mode_64bit() && override_seg < x86_seg_fs )
+        override_seg = x86_seg_none;
+
+    if ( rex_prefix & REX_W )
+        op_bytes = 8;
+
+    opcode = b;
+    if ( b == 0x0f )
+        opcode = X86EMUL_OPC(0x0f, simple_fetch(uint8_t));
+
+    switch ( opcode )
+    {
+    case 0xaa ... 0xab: /* stos */
+        bytes = (b & 1) ? op_bytes : 1;
+        val = regs->r(ax);
+        rc = ops->write(x86_seg_es, truncate_word(regs->r(di), ad_bytes),
+                        &val, bytes, ctxt);
+        if ( rc != X86EMUL_OKAY )
+            return rc;
+        _register_address_increment(regs->r(di),
+                                    regs->eflags & X86_EFLAGS_DF ? -bytes
+                                                                 : bytes,
+                                    ad_bytes);
+        goto complete;
+
+    case 0x88 ... 0x8b: /* mov */
+    case 0xc6 ... 0xc7: /* mov $imm,r/m */
+    case X86EMUL_OPC(0x0f, 0xb6): /* movzx rm8,r{16,32,64} */
+    case X86EMUL_OPC(0x0f, 0xb7): /* movzx rm16,r{16,32,64} */
+    case X86EMUL_OPC(0x0f, 0xbe): /* movsx rm8,r{16,32,64} */
+    case X86EMUL_OPC(0x0f, 0xbf): /* movsx rm16,r{16,32,64} */
+        break;
+
+    case X86EMUL_OPC(0x0f, 0xc3): /* movnti */
+        if ( op_bytes == 2 || !vcpu_has_sse2() )
+            return X86EMUL_UNIMPLEMENTED;
+        break;
+
+    default:
+        return X86EMUL_UNIMPLEMENTED;
+    }
+
+    /* ModRM and SIB bytes, with only memory operands handled. */
+    modrm = simple_fetch(uint8_t);
+    modrm_mod = modrm >> 6;
+    modrm_reg = ((rex_prefix & 4) << 1) | ((modrm & 0x38) >> 3);
+    modrm_rm = modrm & 7;
+
+    if ( modrm_mod == 3 || ((opcode & ~1) == 0xc6 && (modrm_reg & 7)) )
+        return X86EMUL_UNIMPLEMENTED;
+
+    if ( modrm_rm == 4 )
+    {
+        uint8_t sib = simple_fetch(uint8_t);
+        unsigned int sib_index = ((sib >> 3) & 7) | ((rex_prefix << 2) & 8);
+        unsigned int sib_base = (sib & 7) | ((rex_prefix << 3) & 8);
+
+        if ( sib_index != 4 )
+            off = *decode_gpr(regs, sib_index) << ((sib >> 6) & 3);
+        if ( modrm_mod == 0 && (sib_base & 7) == 5 )
+            off += simple_fetch(int32_t);
+        else if ( sib_base == 4 || sib_base == 5 )
+        {
+            seg = x86_seg_ss;
+            off += sib_base == 4 ? regs->r(sp) : regs->r(bp);
+        }
+        else
+            off += *decode_gpr(regs, sib_base);
+    }
+    else
+    {
+        modrm_rm |= (rex_prefix & 1) << 3;
+        off = *decode_gpr(regs, modrm_rm);
+        if ( modrm_rm == 5 && modrm_mod != 0 )
+            seg = x86_seg_ss;
+    }
+
+    switch ( modrm_mod )
+    {
+    case 0:
+        if ( modrm_rm != 4 && (modrm_rm & 7) == 5 )
+        {
+            off = simple_fetch(int32_t);
+            pc_rel = mode_64bit();
+        }
+        break;
+    case 1:
+        off += simple_fetch(int8_t);
+        break;
+    case 2:
+        off += simple_fetch(int32_t);
+        break;
+    }
+
+    if ( override_seg != x86_seg_none )
+        seg = override_seg;
+
+    bytes = (opcode & 1) ? op_bytes : 1;
+
+    /* Immediate operand, which precedes the end of a RIP-relative EA. */
+    if ( (opcode & ~1) == 0xc6 )
+    {
+        switch ( bytes )
+        {
+        case 1: val = simple_fetch(int8_t); break;
+        case 2: val = simple_fetch(int16_t); break;
+        default: val = simple_fetch(int32_t); break;
+        }
+    }
+
+    if ( pc_rel )
+        off += ip;
+    off = truncate_word(off, ad_bytes);
+
+    switch ( opcode )
+    {
+    case 0x88: /* mov r8,r/m8 */
+        val = *(uint8_t *)_decode_gpr(regs, modrm_reg, !rex_prefix);
+        /* fall through */
+    case 0xc6 ... 0xc7:
+        rc = ops->write(seg, off, &val, bytes, ctxt);
+        break;
+
+    case 0x89: /* mov r,r/m */
+    case X86EMUL_OPC(0x0f, 0xc3): /* movnti */
+        val = *decode_gpr(regs, modrm_reg);
+        rc = ops->write(seg, off, &val, op_bytes, ctxt);
+        /* Ignore the non-temporal hint, as x86_emulate() does. */
+        if ( rc == X86EMUL_OKAY && opcode != 0x89 )
+            asm volatile ( "sfence" ::: "memory" );
+        break;
+
+    case 0x8a: /* mov r/m8,r8 */
+        rc = ops->read(seg, off, &val, 1, ctxt);
+        if ( rc == X86EMUL_OKAY )
+            *(uint8_t *)_decode_gpr(regs, modrm_reg, !rex_prefix) = val;
+        break;
+
+    default: /* mov r/m,r, movzx, movsx */
+        bytes = opcode == 0x8b ? op_bytes : 1 + (opcode & 1);
+        rc = ops->read(seg, off, &val, bytes, ctxt);
+        if ( rc != X86EMUL_OKAY )
+            break;
+        if ( opcode == X86EMUL_OPC(0x0f, 0xbe) )
+            val = (int8_t)val;
+        else if ( opcode == X86EMUL_OPC(0x0f, 0xbf) )
+            val = (int16_t)val;
+        simple_write_gpr(decode_gpr(regs, modrm_reg), val, op_bytes);
+        break;
+    }
+
+    if ( rc != X86EMUL_OKAY )
+        return rc;
+
+ complete:
+    ctxt->opcode = opcode;
+    regs->r(ip) = mode_64bit() ? ip : (uint32_t)ip;
+    regs->eflags &= ~X86_EFLAGS_RF;
+
+    return X86EMUL_OKAY;
+}
+#undef simple_fetch
+
 #ifdef __XEN__
 
 #include <xen/err.h>
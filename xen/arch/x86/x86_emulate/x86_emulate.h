@@ -497,6 +497,32 @@ struct x86_emulate_ops
 
 struct cpu_user_regs;
 
+/*
+ * Instructions decoded before, for callers emulating the same instructions
+ * over and over (e.g. for a guest polling an emulated device register).  An
+ * entry gets used only if the instruction bytes at rIP, which still get
+ * fetched through ->insn_fetch(), and the address size match what it was
+ * decoded from, so it never needs invalidating.
+ */
+#define X86_DECODE_CACHE_ENTRIES 4
+#define X86_EMULATE_STATE_SIZE   160
+
+struct x86_decode_cache_entry {
+    unsigned long ip;
+    unsigned long ea_disp;      /* Memory operand offset less registers. */
+    unsigned int opcode;
+    uint8_t addr_size;
+    uint8_t len;                /* Zero if unused. */
+    uint8_t insn[MAX_INST_LEN];
+    /* struct x86_emulate_state, opaque to callers. */
+    unsigned long state[X86_EMULATE_STATE_SIZE / sizeof(unsigned long)];
+};
+
+struct x86_emulate_decode_cache {
+    struct x86_decode_cache_entry ent[X86_DECODE_CACHE_ENTRIES];
+    unsigned int next;
+};
+
 struct x86_emulate_ctxt
 {
     /*
@@ -512,6 +538,9 @@ struct x86_emulate_ctxt
     /* Caller data that can be used by x86_emulate_ops' routines. */
     void *data;
 
+    /* Optional cache of decoded instructions. */
+    struct x86_emulate_decode_cache *decode_cache;
+
     /*
      * Input/output state:
      */
@@ -643,6 +672,16 @@ int x86_emulate_wrapper(
 #define x86_emulate x86_emulate_wrapper
 #endif
 
+/*
+ * x86_emulate_simple: Emulate the most common plain memory moves without
+ * going through x86_emulate().  Returns X86EMUL_UNIMPLEMENTED, with no state
+ * modified, for anything else.
+ */
+int
+x86_emulate_simple(
+    struct x86_emulate_ctxt *ctxt,
+    const struct x86_emulate_ops *ops);
+
 /* Map GPRs by ModRM encoding to their offset within struct cpu_user_regs. */
 extern const uint8_t cpu_user_regs_gpr_offsets[X86_NR_GPRS];
 
@@ -159,6 +159,93 @@ int cpu_up(unsigned int cpu)
     return err;
 }
 
+#ifdef CONFIG_HAS_PARALLEL_CPU_UP
+/*
+ * Each CPU is prepared and kicked in turn, __cpu_up_start() returning as soon
+ * as the next one can be kicked.  Only then are they waited for, again in
+ * turn, by __cpu_up_finish(): by that time most of them should have done
+ * their own early initialisation concurrently.
+ */
+unsigned int __init cpu_up_batch(const cpumask_t *cpus,
+                                 struct cpu_up_times *times)
+{
+    static cpumask_t __initdata started;
+    unsigned int cpu, nr = 0;
+    int notifier_rc, err;
+    s_time_t t;
+
+    if ( !cpu_hotplug_begin() )
+        return 0;
+
+    cpumask_clear(&started);
+
+    for_each_cpu ( cpu, cpus )
+    {
+        void *hcpu = (void *)(long)cpu;
+        struct notifier_block *nb = NULL;
+
+        if ( (cpu >= nr_cpu_ids) || cpu_online(cpu) || !cpu_present(cpu) )
+        {
+            printk("Failed to bring up CPU %u (error %d)\n", cpu, -EINVAL);
+            continue;
+        }
+
+        t = NOW();
+        notifier_rc = notifier_call_chain(&cpu_chain, CPU_UP_PREPARE, hcpu,
+                                          &nb);
+        times->prepare += NOW() - t;
+        if ( notifier_rc != NOTIFY_DONE )
+            err = notifier_to_errno(notifier_rc);
+        else
+        {
+            t = NOW();
+            err = __cpu_up_start(cpu);
+            times->start += NOW() - t;
+        }
+
+        if ( err )
+        {
+            notifier_rc = notifier_call_chain(&cpu_chain, CPU_UP_CANCELED,
+                                              hcpu, &nb);
+            BUG_ON(notifier_rc != NOTIFY_DONE);
+            printk("Failed to bring up CPU %u (error %d)\n", cpu, err);
+            continue;
+        }
+
+        __cpumask_set_cpu(cpu, &started);
+    }
+
+    for_each_cpu ( cpu, &started )
+    {
+        void *hcpu = (void *)(long)cpu;
+
+        t = NOW();
+        err = __cpu_up_finish(cpu);
+        times->finish += NOW() - t;
+
+        if ( err )
+        {
+            notifier_rc = notifier_call_chain(&cpu_chain, CPU_UP_CANCELED,
+                                              hcpu, NULL);
+            BUG_ON(notifier_rc != NOTIFY_DONE);
+            printk("Failed to bring up CPU %u (error %d)\n", cpu, err);
+            continue;
+        }
+
+        t = NOW();
+        notifier_rc = notifier_call_chain(&cpu_chain, CPU_ONLINE, hcpu, NULL);
+        BUG_ON(notifier_rc != NOTIFY_DONE);
+        times->online += NOW() - t;
+
+        send_global_virq(VIRQ_PCPU_STATE);
+        nr++;
+    }
+
+    cpu_hotplug_done();
+    return nr;
+}
+#endif
+
 void notify_cpu_starting(unsigned int cpu)
 {
     void *hcpu = (void *)(long)cpu;
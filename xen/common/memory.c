@@ -992,7 +992,7 @@ static int acquire_resource(
      * moment since they are small, but if they need to grow in future
      * use-cases then per-CPU arrays or heap allocations may be required.
      */
-    xen_pfn_t mfn_list[2];
+    xen_pfn_t mfn_list[8];
     int rc;
 
     if ( copy_from_guest(&xmar, arg, 1) )
@@ -152,6 +152,13 @@ struct csched_pcpu {
 
     unsigned int idle_bias;
     unsigned int nr_runnable;
+    /*
+     * Priority of the vCPU at the head of runq. It is updated with the
+     * runq lock held, but is read locklessly (together with nr_runnable)
+     * by other pCPUs, to decide whether it is worth trying to steal work
+     * from us at all.
+     */
+    int runq_best_pri;
 
     unsigned int tick;
     struct timer ticker;
@@ -270,6 +277,22 @@ dec_nr_runnable(unsigned int cpu)
     CSCHED_PCPU(cpu)->nr_runnable--;
 }
 
+/*
+ * Publish the priority of the head of cpu's runq, for the benefit of
+ * csched_load_balance() running on other pCPUs.
+ */
+static inline void
+runq_publish(unsigned int cpu)
+{
+    const struct list_head * const runq = RUNQ(cpu);
+
+    ASSERT(spin_is_locked(per_cpu(schedule_data, cpu).schedule_lock));
+
+    write_atomic(&CSCHED_PCPU(cpu)->runq_best_pri,
+                 list_empty(runq) ? CSCHED_PRI_IDLE
+                                  : __runq_elem(runq->next)->pri);
+}
+
 static inline void
 __runq_insert(struct csched_vcpu *svc)
 {
@@ -299,6 +322,7 @@ __runq_insert(struct csched_vcpu *svc)
     }
 
     list_add_tail(&svc->runq_elem, iter);
+    runq_publish(cpu);
 }
 
 static inline void
@@ -313,6 +337,7 @@ __runq_remove(struct csched_vcpu *svc)
 {
     BUG_ON( !__vcpu_on_runq(svc) );
     list_del_init(&svc->runq_elem);
+    runq_publish(svc->vcpu->processor);
 }
 
 static inline void
@@ -608,6 +633,7 @@ init_pdata(struct csched_private *prv, struct csched_pcpu *spc, int cpu)
     BUG_ON(!is_idle_vcpu(curr_on_cpu(cpu)));
     cpumask_set_cpu(cpu, prv->idlers);
     spc->nr_runnable = 0;
+    spc->runq_best_pri = CSCHED_PRI_IDLE;
 }
 
 static void
@@ -1368,6 +1394,12 @@ csched_runq_sort(struct csched_private *prv, unsigned int cpu)
         elem = next;
     }
 
+    /*
+     * Accounting may have changed the priorities of the vCPUs in runq
+     * without holding its lock, so re-publish the (possibly new) head.
+     */
+    runq_publish(cpu);
+
     pcpu_schedule_unlock_irqrestore(lock, flags, cpu);
 }
 
@@ -1680,6 +1712,28 @@ csched_runq_steal(int peer_cpu, int cpu, int pri, int balance_step)
     return NULL;
 }
 
+/*
+ * Victim selection order for work stealing, within our own node: first our
+ * SMT siblings, then the pCPUs in our same socket (which share, at least on
+ * x86, the last level cache with us), and only then all the others.
+ */
+enum {
+    STEAL_SMT,
+    STEAL_LLC,
+    STEAL_NODE,
+    STEAL_LEVELS
+};
+
+static inline unsigned int
+steal_level(unsigned int cpu, unsigned int peer_cpu)
+{
+    if ( cpumask_test_cpu(peer_cpu, per_cpu(cpu_sibling_mask, cpu)) )
+        return STEAL_SMT;
+    if ( cpumask_test_cpu(peer_cpu, per_cpu(cpu_core_mask, cpu)) )
+        return STEAL_LLC;
+    return STEAL_NODE;
+}
+
 static struct csched_vcpu *
 csched_load_balance(struct csched_private *prv, int cpu,
     struct csched_vcpu *snext, bool_t *stolen)
@@ -1690,6 +1744,7 @@ csched_load_balance(struct csched_private *prv, int cpu,
     cpumask_t *online;
     int peer_cpu, first_cpu, peer_node, bstep;
     int node = cpu_to_node(cpu);
+    unsigned int lvl;
 
     BUG_ON( cpu != snext->vcpu->processor );
     online = cpupool_online_cpumask(c);
@@ -1735,83 +1790,122 @@ csched_load_balance(struct csched_private *prv, int cpu,
             first_cpu = cpumask_cycle(prv->balance_bias[peer_node], &workers);
             if ( first_cpu >= nr_cpu_ids )
                 goto next_node;
-            peer_cpu = first_cpu;
-            do
-            {
-                spinlock_t *lock;
-
-                /*
-                 * If there is only one runnable vCPU on peer_cpu, it means
-                 * there's no one to be stolen in its runqueue, so skip it.
-                 *
-                 * Checking this without holding the lock is racy... But that's
-                 * the whole point of this optimization!
-                 *
-                 * In more details:
-                 * - if we race with dec_nr_runnable(), we may try to take the
-                 *   lock and call csched_runq_steal() for no reason. This is
-                 *   not a functional issue, and should be infrequent enough.
-                 *   And we can avoid that by re-checking nr_runnable after
-                 *   having grabbed the lock, if we want;
-                 * - if we race with inc_nr_runnable(), we skip a pCPU that may
-                 *   have runnable vCPUs in its runqueue, but that's not a
-                 *   problem because:
-                 *   + if racing with csched_vcpu_insert() or csched_vcpu_wake(),
-                 *     __runq_tickle() will be called afterwords, so the vCPU
-                 *     won't get stuck in the runqueue for too long;
-                 *   + if racing with csched_runq_steal(), it may be that a
-                 *     vCPU that we could have picked up, stays in a runqueue
-                 *     until someone else tries to steal it again. But this is
-                 *     no worse than what can happen already (without this
-                 *     optimization), it the pCPU would schedule right after we
-                 *     have taken the lock, and hence block on it.
-                 */
-                if ( CSCHED_PCPU(peer_cpu)->nr_runnable <= 1 )
-                {
-                    TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu, /* skipp'n */ 0);
-                    goto next_cpu;
-                }
 
-                /*
-                 * Get ahold of the scheduler lock for this peer CPU.
-                 *
-                 * Note: We don't spin on this lock but simply try it. Spinning
-                 * could cause a deadlock if the peer CPU is also load
-                 * balancing and trying to lock this CPU.
-                 */
-                lock = pcpu_schedule_trylock(peer_cpu);
-                SCHED_STAT_CRANK(steal_trylock);
-                if ( !lock )
+            /*
+             * On our own node, go through the candidates once per topology
+             * level (see steal_level()), closest first. All the pCPUs of a
+             * remote node are equally far from us, so one pass is enough.
+             */
+            for ( lvl = peer_node == node ? STEAL_SMT : STEAL_NODE;
+                  lvl < STEAL_LEVELS; lvl++ )
+            {
+                peer_cpu = first_cpu;
+                do
                 {
-                    SCHED_STAT_CRANK(steal_trylock_failed);
-                    TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu, /* skip */ 0);
-                    goto next_cpu;
-                }
+                    const struct csched_pcpu *peer_pcpu = CSCHED_PCPU(peer_cpu);
+                    spinlock_t *lock;
 
-                TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu, /* checked */ 1);
+                    if ( peer_node == node &&
+                         steal_level(cpu, peer_cpu) != lvl )
+                        goto next_cpu;
 
-                /* Any work over there to steal? */
-                speer = cpumask_test_cpu(peer_cpu, online) ?
-                    csched_runq_steal(peer_cpu, cpu, snext->pri, bstep) : NULL;
-                pcpu_schedule_unlock(lock, peer_cpu);
+                    /*
+                     * If there is only one runnable vCPU on peer_cpu, or if
+                     * the vCPU at the head of its runqueue does not have
+                     * strictly higher priority than snext, there is nothing
+                     * we want to steal over there, so skip it.
+                     *
+                     * Checking this without holding the lock is racy... But
+                     * that's the whole point of this optimization! Taking (or
+                     * even just trying) a lock which is being used by a busy
+                     * pCPU is costly, and can delay that pCPU's own
+                     * scheduling decisions.
+                     *
+                     * In more details:
+                     * - if we race with dec_nr_runnable() or runq_publish(),
+                     *   we may try to take the lock and call
+                     *   csched_runq_steal() for no reason. This is not a
+                     *   functional issue, and should be infrequent enough;
+                     * - if we race with inc_nr_runnable() or runq_publish(),
+                     *   we skip a pCPU that may have runnable vCPUs in its
+                     *   runqueue, but that's not a problem because:
+                     *   + if racing with csched_vcpu_insert() or
+                     *     csched_vcpu_wake(), __runq_tickle() will be called
+                     *     afterwords, so the vCPU won't get stuck in the
+                     *     runqueue for too long;
+                     *   + if racing with csched_runq_steal(), it may be that a
+                     *     vCPU that we could have picked up, stays in a
+                     *     runqueue until someone else tries to steal it again.
+                     *     But this is no worse than what can happen already
+                     *     (without this optimization), it the pCPU would
+                     *     schedule right after we have taken the lock, and
+                     *     hence block on it;
+                     *   + if csched_acct() raised the priority of the head of
+                     *     the runqueue, runq_publish() will be called by the
+                     *     next csched_runq_sort() on peer_cpu, i.e., within a
+                     *     tick.
+                     */
+                    if ( peer_pcpu->nr_runnable <= 1 ||
+                         read_atomic(&peer_pcpu->runq_best_pri) <= snext->pri )
+                    {
+                        SCHED_STAT_CRANK(steal_peek_skipped);
+                        TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu,
+                                 /* skipp'n */ 0);
+                        goto next_cpu;
+                    }
 
-                /* As soon as one vcpu is found, balancing ends */
-                if ( speer != NULL )
-                {
-                    *stolen = 1;
                     /*
-                     * Next time we'll look for work to steal on this node, we
-                     * will start from the next pCPU, with respect to this one,
-                     * so we don't risk stealing always from the same ones.
+                     * Get ahold of the scheduler lock for this peer CPU.
+                     *
+                     * Note: We don't spin on this lock but simply try it.
+                     * Spinning could cause a deadlock if the peer CPU is also
+                     * load balancing and trying to lock this CPU.
                      */
-                    prv->balance_bias[peer_node] = peer_cpu;
-                    return speer;
-                }
+                    lock = pcpu_schedule_trylock(peer_cpu);
+                    SCHED_STAT_CRANK(steal_trylock);
+                    if ( !lock )
+                    {
+                        SCHED_STAT_CRANK(steal_trylock_failed);
+                        TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu,
+                                 /* skip */ 0);
+                        goto next_cpu;
+                    }
+
+                    TRACE_2D(TRC_CSCHED_STEAL_CHECK, peer_cpu, /* checked */ 1);
+
+                    /* Any work over there to steal? */
+                    speer = cpumask_test_cpu(peer_cpu, online) ?
+                        csched_runq_steal(peer_cpu, cpu, snext->pri, bstep) :
+                        NULL;
+                    pcpu_schedule_unlock(lock, peer_cpu);
+
+                    /* As soon as one vcpu is found, balancing ends */
+                    if ( speer != NULL )
+                    {
+                        SCHED_STAT_CRANK(steal_success);
+                        if ( peer_node != node )
+                            SCHED_STAT_CRANK(steal_success_remote);
+                        else if ( lvl == STEAL_SMT )
+                            SCHED_STAT_CRANK(steal_success_smt);
+                        else if ( lvl == STEAL_LLC )
+                            SCHED_STAT_CRANK(steal_success_llc);
+
+                        *stolen = 1;
+                        /*
+                         * Next time we'll look for work to steal on this node,
+                         * we will start from the next pCPU, with respect to
+                         * this one, so we don't risk stealing always from the
+                         * same ones.
+                         */
+                        prv->balance_bias[peer_node] = peer_cpu;
+                        return speer;
+                    }
 
  next_cpu:
-                peer_cpu = cpumask_cycle(peer_cpu, &workers);
+                    peer_cpu = cpumask_cycle(peer_cpu, &workers);
 
-            } while( peer_cpu != first_cpu );
+                } while( peer_cpu != first_cpu );
+            }
 
  next_node:
             peer_node = cycle_node(peer_node, node_online_map);
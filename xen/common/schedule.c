@@ -54,6 +54,12 @@ boolean_param("sched_smt_power_savings", sched_smt_power_savings);
  * */
 int sched_ratelimit_us = SCHED_DEFAULT_RATELIMIT_US;
 integer_param("sched_ratelimit_us", sched_ratelimit_us);
+
+/* Scheduler overhead accounting, see XEN_SYSCTL_sched_stats_op. */
+bool __read_mostly sched_stats_enabled;
+boolean_param("sched_stats", sched_stats_enabled);
+DEFINE_PER_CPU(struct sched_stats, sched_stats);
+
 /* Various timer handlers. */
 static void s_timer_fn(void *unused);
 static void vcpu_periodic_timer_fn(void *data);
@@ -472,6 +478,7 @@ void vcpu_sleep_nosync(struct vcpu *v)
 {
     unsigned long flags;
     spinlock_t *lock;
+    s_time_t start = sched_stats_start();
 
     TRACE_2D(TRC_SCHED_SLEEP, v->domain->domain_id, v->vcpu_id);
 
@@ -479,6 +486,8 @@ void vcpu_sleep_nosync(struct vcpu *v)
 
     vcpu_sleep_nosync_locked(v);
 
+    sched_stats_account(start, sleep);
+
     vcpu_schedule_unlock_irqrestore(lock, flags, v);
 }
 
@@ -496,6 +505,7 @@ void vcpu_wake(struct vcpu *v)
 {
     unsigned long flags;
     spinlock_t *lock;
+    s_time_t start = sched_stats_start();
 
     TRACE_2D(TRC_SCHED_WAKE, v->domain->domain_id, v->vcpu_id);
 
@@ -513,6 +523,8 @@ void vcpu_wake(struct vcpu *v)
             vcpu_runstate_change(v, RUNSTATE_offline, NOW());
     }
 
+    sched_stats_account(start, wake);
+
     vcpu_schedule_unlock_irqrestore(lock, flags, v);
 }
 
@@ -1442,6 +1454,84 @@ long sched_adjust_global(struct xen_sysctl_scheduler_op *op)
     return rc;
 }
 
+int sched_stats_op(struct xen_sysctl_sched_stats_op *op)
+{
+    unsigned int cpu, num_cpus;
+    int rc = 0;
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_SCHED_STATS_query:
+        num_cpus = cpumask_last(&cpu_online_map) + 1;
+        if ( !guest_handle_is_null(op->stats) )
+        {
+            if ( num_cpus > op->num_cpus )
+                num_cpus = op->num_cpus;
+            for ( cpu = 0; cpu < num_cpus; cpu++ )
+            {
+                struct xen_sysctl_sched_stats stats = { .cpupool = ~0U };
+
+                /* Offline pCPUs may not even have their per-CPU area. */
+                if ( cpu_online(cpu) )
+                {
+                    const struct sched_stats *ss = &per_cpu(sched_stats, cpu);
+                    const struct cpupool *c = per_cpu(cpupool, cpu);
+
+                    if ( c )
+                        stats.cpupool = c->cpupool_id;
+                    stats.schedule_count = ss->schedule_count;
+                    stats.schedule_time = ss->schedule_time;
+                    stats.ctxsw_count = ss->ctxsw_count;
+                    stats.ctxsw_time = ss->ctxsw_time;
+                    stats.lock_count = ss->lock_count;
+                    stats.lock_wait_time = ss->lock_wait_time;
+                    stats.lock_wait_max = ss->lock_wait_max;
+                    stats.wake_count = ss->wake_count;
+                    stats.wake_time = ss->wake_time;
+                    stats.sleep_count = ss->sleep_count;
+                    stats.sleep_time = ss->sleep_time;
+                }
+
+                if ( copy_to_guest_offset(op->stats, cpu, &stats, 1) )
+                    return -EFAULT;
+            }
+        }
+        op->num_cpus = num_cpus;
+        break;
+
+    case XEN_SYSCTL_SCHED_STATS_reset:
+        /*
+         * This races with the pCPUs updating their own statistics, so a few
+         * samples may survive the reset. That's fine for what we need.
+         */
+        for_each_online_cpu ( cpu )
+        {
+            struct sched_stats *ss = &per_cpu(sched_stats, cpu);
+            s_time_t ctxsw_start = ss->ctxsw_start;
+
+            memset(ss, 0, sizeof(*ss));
+            ss->ctxsw_start = ctxsw_start;
+        }
+        break;
+
+    case XEN_SYSCTL_SCHED_STATS_enable:
+        sched_stats_enabled = true;
+        break;
+
+    case XEN_SYSCTL_SCHED_STATS_disable:
+        sched_stats_enabled = false;
+        break;
+
+    default:
+        rc = -EOPNOTSUPP;
+        break;
+    }
+
+    op->enabled = sched_stats_enabled;
+
+    return rc;
+}
+
 static void vcpu_periodic_timer_work(struct vcpu *v)
 {
     s_time_t now = NOW();
@@ -1479,6 +1569,7 @@ static void schedule(void)
     spinlock_t           *lock;
     struct task_slice     next_slice;
     int cpu = smp_processor_id();
+    s_time_t              start = sched_stats_start();
 
     ASSERT_NOT_IN_ATOMIC();
 
@@ -1524,6 +1615,7 @@ static void schedule(void)
     if ( unlikely(prev == next) )
     {
         pcpu_schedule_unlock_irq(lock, cpu);
+        sched_stats_account(start, schedule);
         TRACE_4D(TRC_SCHED_SWITCH_INFCONT,
                  next->domain->domain_id, next->vcpu_id,
                  now - prev->runstate.state_entry_time,
@@ -1576,11 +1668,27 @@ static void schedule(void)
 
     vcpu_periodic_timer_work(next);
 
+    sched_stats_account(start, schedule);
+    if ( unlikely(start) )
+        this_cpu(sched_stats).ctxsw_start = NOW();
+
     context_switch(prev, next);
 }
 
 void context_saved(struct vcpu *prev)
 {
+    struct sched_stats *ss = &this_cpu(sched_stats);
+
+    /*
+     * context_switch() does not (necessarily) return, so this is where
+     * we take note of how long it took.
+     */
+    if ( unlikely(ss->ctxsw_start) )
+    {
+        sched_stats_account(ss->ctxsw_start, ctxsw);
+        ss->ctxsw_start = 0;
+    }
+
     /* Clear running flag /after/ writing context to memory. */
     smp_wmb();
 
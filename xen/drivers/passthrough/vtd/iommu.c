@@ -1844,6 +1844,10 @@ int iommu_pte_flush(struct domain *d, u64 gfn, u64 *pte,
 
     iommu_flush_cache_entry(pte, sizeof(struct dma_pte));
 
+    /* The caller will flush the IOTLB itself. */
+    if ( this_cpu(iommu_dont_flush_iotlb) )
+        return 0;
+
     for_each_drhd_unit ( drhd )
     {
         iommu = drhd->iommu;
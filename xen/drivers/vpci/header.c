@@ -17,6 +17,7 @@
  * License along with this program; If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <xen/iommu.h>
 #include <xen/p2m-common.h>
 #include <xen/sched.h>
 #include <xen/softirq.h>
@@ -31,12 +32,13 @@
 struct map_data {
     struct domain *d;
     bool map;
+    unsigned long pages;
 };
 
 static int map_range(unsigned long s, unsigned long e, void *data,
                      unsigned long *c)
 {
-    const struct map_data *map = data;
+    struct map_data *map = data;
     int rc;
 
     for ( ; ; )
@@ -57,6 +59,7 @@ static int map_range(unsigned long s, unsigned long e, void *data,
         if ( rc == 0 )
         {
             *c += size;
+            map->pages += size;
             break;
         }
         if ( rc < 0 )
@@ -68,6 +71,7 @@ static int map_range(unsigned long s, unsigned long e, void *data,
         }
         ASSERT(rc < size);
         *c += rc;
+        map->pages += rc;
         s += rc;
         if ( general_preempt_check() )
                 return -ERESTART;
@@ -76,6 +80,51 @@ static int map_range(unsigned long s, unsigned long e, void *data,
     return rc;
 }
 
+/*
+ * {Un}map the ranges in mem. IOTLB flushes are suppressed while doing so,
+ * and the domain's IOTLB is flushed once after the last range has been
+ * processed, rather than after every single p2m update.
+ */
+static int consume_ranges(struct rangeset *mem, struct map_data *data)
+{
+    int rc;
+
+#ifdef CONFIG_HAS_PASSTHROUGH
+    if ( need_iommu(data->d) )
+        this_cpu(iommu_dont_flush_iotlb) = 1;
+#endif
+
+    rc = rangeset_consume_ranges(mem, map_range, data);
+
+#ifdef CONFIG_HAS_PASSTHROUGH
+    if ( need_iommu(data->d) )
+    {
+        this_cpu(iommu_dont_flush_iotlb) = 0;
+
+        if ( rc != -ERESTART )
+        {
+            int ret = iommu_iotlb_flush_all(data->d);
+
+            if ( !rc )
+                rc = ret;
+        }
+    }
+#endif
+
+    return rc;
+}
+
+static void report_map(const struct pci_dev *pdev, bool map, int rc)
+{
+    const struct vpci_header *header = &pdev->vpci->header;
+
+    printk(XENLOG_G_DEBUG
+           "d%d %04x:%02x:%02x.%u: %smapped %lu pages in %"PRI_stime"us: %d\n",
+           pdev->domain->domain_id, pdev->seg, pdev->bus,
+           PCI_SLOT(pdev->devfn), PCI_FUNC(pdev->devfn), map ? "" : "un",
+           header->map_pages, (NOW() - header->map_start) / MICROSECS(1), rc);
+}
+
 /*
  * The rom_only parameter is used to signal the map/unmap helpers that the ROM
  * BAR's enable bit has changed with the memory decoding bit already enabled.
@@ -126,11 +175,14 @@ bool vpci_process_pending(struct vcpu *v)
             .d = v->domain,
             .map = v->vpci.map,
         };
-        int rc = rangeset_consume_ranges(v->vpci.mem, map_range, &data);
+        int rc = consume_ranges(v->vpci.mem, &data);
 
+        v->vpci.pdev->vpci->header.map_pages += data.pages;
         if ( rc == -ERESTART )
             return true;
 
+        report_map(v->vpci.pdev, v->vpci.map, rc);
+
         spin_lock(&v->vpci.pdev->vpci->lock);
         /* Disable memory decoding unconditionally on failure. */
         modify_decoding(v->vpci.pdev, !rc && v->vpci.map,
@@ -159,9 +211,11 @@ static int __init apply_map(struct domain *d, const struct pci_dev *pdev,
     struct map_data data = { .d = d, .map = true };
     int rc;
 
-    while ( (rc = rangeset_consume_ranges(mem, map_range, &data)) == -ERESTART )
+    while ( (rc = consume_ranges(mem, &data)) == -ERESTART )
         process_pending_softirqs();
     rangeset_destroy(mem);
+    pdev->vpci->header.map_pages = data.pages;
+    report_map(pdev, true, rc);
     if ( !rc )
         modify_decoding(pdev, true, false);
 
@@ -295,6 +349,9 @@ static int modify_bars(const struct pci_dev *pdev, bool map, bool rom_only)
 
     ASSERT(dev);
 
+    header->map_start = NOW();
+    header->map_pages = 0;
+
     if ( system_state < SYS_STATE_active )
     {
         /*
@@ -111,6 +111,50 @@ static void vpci_ignored_write(const struct pci_dev *pdev, unsigned int reg,
 {
 }
 
+/*
+ * Rebuild the per-dword index of the handler list. Must be called with the
+ * vpci lock held after every modification of the list.
+ */
+static void vpci_build_index(struct vpci *vpci)
+{
+    struct list_head *pos = vpci->handlers.next;
+    unsigned int i;
+
+    for ( i = 0; i < VPCI_INDEX_SIZE; i++ )
+    {
+        const struct vpci_register *r;
+
+        for ( ; pos != &vpci->handlers; pos = pos->next )
+        {
+            r = list_entry(pos, const struct vpci_register, node);
+            if ( r->offset + r->size > i * 4 )
+                break;
+        }
+
+        vpci->index[i] = pos != &vpci->handlers
+                         ? list_entry(pos, struct vpci_register, node)
+                         : NULL;
+    }
+}
+
+/* Return the first handler ending past reg, or NULL if there's none. */
+static const struct vpci_register *vpci_find_register(const struct vpci *vpci,
+                                                      unsigned int reg)
+{
+    const struct vpci_register *r =
+        vpci->index[min(reg / 4, VPCI_INDEX_SIZE - 1u)];
+
+    if ( !r )
+        return NULL;
+
+    /* Skip handlers ending within the dword (or extended space) before reg. */
+    list_for_each_entry_from ( r, &vpci->handlers, node )
+        if ( r->offset + r->size > reg )
+            return r;
+
+    return NULL;
+}
+
 uint32_t vpci_hw_read16(const struct pci_dev *pdev, unsigned int reg,
                         void *data)
 {
@@ -168,6 +212,7 @@ int vpci_add_register(struct vpci *vpci, vpci_read_t *read_handler,
     }
 
     list_add_tail(&r->node, prev);
+    vpci_build_index(vpci);
     spin_unlock(&vpci->lock);
 
     return 0;
@@ -191,6 +236,7 @@ int vpci_remove_register(struct vpci *vpci, unsigned int offset,
         if ( !cmp && rm->offset == offset && rm->size == size )
         {
             list_del(&rm->node);
+            vpci_build_index(vpci);
             spin_unlock(&vpci->lock);
             xfree(rm);
             return 0;
@@ -333,8 +379,16 @@ uint32_t vpci_read(pci_sbdf_t sbdf, unsigned int reg, unsigned int size)
 
     spin_lock(&pdev->vpci->lock);
 
+    /* Fast path: nothing trapped, read straight from the hardware. */
+    r = vpci_find_register(pdev->vpci, reg);
+    if ( !r || r->offset >= reg + size )
+    {
+        spin_unlock(&pdev->vpci->lock);
+        return vpci_read_hw(sbdf, reg, size);
+    }
+
     /* Read from the hardware or the emulated register handlers. */
-    list_for_each_entry ( r, &pdev->vpci->handlers, node )
+    list_for_each_entry_from ( r, &pdev->vpci->handlers, node )
     {
         const struct vpci_register emu = {
             .offset = reg + data_offset,
@@ -441,8 +495,17 @@ void vpci_write(pci_sbdf_t sbdf, unsigned int reg, unsigned int size,
 
     spin_lock(&pdev->vpci->lock);
 
+    /* Fast path: nothing trapped, write straight to the hardware. */
+    r = vpci_find_register(pdev->vpci, reg);
+    if ( !r || r->offset >= reg + size )
+    {
+        spin_unlock(&pdev->vpci->lock);
+        vpci_write_hw(sbdf, reg, size, data);
+        return;
+    }
+
     /* Write the value to the hardware or emulated registers. */
-    list_for_each_entry ( r, &pdev->vpci->handlers, node )
+    list_for_each_entry_from ( r, &pdev->vpci->handlers, node )
     {
         const struct vpci_register emu = {
             .offset = reg + data_offset,
@@ -177,6 +177,14 @@ struct log_dirty_domain {
     unsigned int   fault_count;
     unsigned int   dirty_count;
 
+    /* per-vCPU dirty rings, and the domain consuming them */
+    struct paging_dirty_ring *rings;
+    struct domain *ring_owner;
+
+    /* bitmap leaves for pfns below shared_pfns belong to shared_owner */
+    unsigned long  shared_pfns;
+    struct domain *shared_owner;
+
     /* functions which are paging mode specific */
     const struct log_dirty_ops {
         int        (*enable  )(struct domain *d, bool log_global);
@@ -219,6 +227,27 @@ struct paging_domain {
     void (*free_page)(struct domain *d, struct page_info *pg);
 };
 
+/*
+ * HAP guest: recently walked linear pages of the current VM exit.  An entry
+ * is valid only while its generation matches the cache's one.  All entries
+ * were obtained with the control register state recorded here.
+ */
+#define PAGING_WALK_CACHE_ENTRIES 8
+
+struct paging_walk_cache_entry {
+    unsigned long gen;
+    unsigned long page_number;  /* Guest linear address >> PAGE_SHIFT */
+    unsigned long gfn;
+    uint32_t pfec;              /* PF error code of the walk */
+};
+
+struct paging_walk_cache {
+    unsigned long gen;
+    unsigned long cr0, cr3, cr4;
+    uint64_t efer;
+    struct paging_walk_cache_entry entry[PAGING_WALK_CACHE_ENTRIES];
+};
+
 struct paging_vcpu {
     /* Pointers to mode-specific entry points. */
     const struct paging_mode *mode;
@@ -231,6 +260,8 @@ struct paging_vcpu {
     /* Translated guest: virtual TLB */
     struct shadow_vtlb *vtlb;
     spinlock_t          vtlb_lock;
+    /* HAP guest: guest page walk cache */
+    struct paging_walk_cache walk_cache;
 
     /* paging support extension */
     struct shadow_vcpu shadow;
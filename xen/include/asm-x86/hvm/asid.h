@@ -32,6 +32,9 @@ void hvm_asid_flush_vcpu_asid(struct hvm_vcpu_asid *asid);
 /* Invalidate all ASID allocations for specified VCPU: forces re-allocation. */
 void hvm_asid_flush_vcpu(struct vcpu *v);
 
+/* Is the ASID allocation valid on this processor core? */
+bool hvm_asid_is_live(const struct hvm_vcpu_asid *asid);
+
 /* Flush all ASIDs on this processor core. */
 void hvm_asid_flush_core(void);
 
@@ -64,9 +64,27 @@ struct hvm_ioreq_server {
     /* Lock to serialize access to buffered ioreq ring */
     spinlock_t             bufioreq_lock;
     evtchn_port_t          bufioreq_evtchn;
+    /* Pages of a buffered_ioring, if selected (mapped at bufioreq.va) */
+    unsigned int           bufioreq_pages;
+    struct page_info       *bufioreq_ring[XEN_DMOP_BUFIOREQ_MAX_PAGES];
     struct rangeset        *range[NR_IO_RANGE_TYPES];
     bool                   enabled;
     uint8_t                bufioreq_handling;
+    /* Guest pages a single data_is_ptr ioreq may reference */
+    uint8_t                batch_pages;
+};
+
+/*
+ * Merged view of the I/O ranges claimed by all enabled non-default ioreq
+ * servers: sorted, non-overlapping intervals, each mapped to the server
+ * that hvm_select_ioreq_server() would pick for an access within it.
+ */
+struct hvm_ioreq_index {
+    unsigned int nr;
+    struct hvm_ioreq_index_entry {
+        uint64_t start, end;
+        struct hvm_ioreq_server *s;
+    } entry[];
 };
 
 /*
@@ -110,6 +128,11 @@ struct hvm_domain {
     struct {
         spinlock_t              lock;
         struct hvm_ioreq_server *server[MAX_NR_IOREQ_SERVERS];
+        /* Guards the index only, which is looked up without the above */
+        rwlock_t                index_lock;
+        struct hvm_ioreq_index  *index[NR_IO_RANGE_TYPES];
+        /* Largest batch_pages of all servers, read without the lock */
+        unsigned int            batch_pages;
     } ioreq_server;
 
     /* Cached CF8 for guest PCI config cycles */
@@ -165,6 +188,7 @@ struct hvm_domain {
 
     bool_t                 hap_enabled;
     bool_t                 mem_sharing_enabled;
+    struct domain         *fork_parent;  /* of a fork, see mem_sharing.c */
     bool_t                 qemu_mapcache_invalidate;
     bool_t                 is_s3_suspended;
 
@@ -82,6 +82,7 @@ struct segment_register *hvmemul_get_seg_reg(
     enum x86_segment seg,
     struct hvm_emulate_ctxt *hvmemul_ctxt);
 int hvm_emulate_one_mmio(unsigned long mfn, unsigned long gla);
+void hvm_emulate_insn_cache_flush(struct vcpu *v);
 
 static inline bool handle_mmio(void)
 {
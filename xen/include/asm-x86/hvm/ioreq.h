@@ -42,6 +42,10 @@ int hvm_map_mem_type_to_ioreq_server(struct domain *d, ioservid_t id,
                                      uint32_t type, uint32_t flags);
 int hvm_set_ioreq_server_state(struct domain *d, ioservid_t id,
                                bool enabled);
+int hvm_set_ioreq_server_batch(struct domain *d, ioservid_t id,
+                               unsigned int nr_pages);
+int hvm_set_ioreq_server_bufioreq(struct domain *d, ioservid_t id,
+                                  unsigned int nr_pages);
 
 int hvm_all_ioreq_servers_add_vcpu(struct domain *d, struct vcpu *v);
 void hvm_all_ioreq_servers_remove_vcpu(struct domain *d, struct vcpu *v);
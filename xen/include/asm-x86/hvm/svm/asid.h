@@ -20,6 +20,8 @@
 
 #include <xen/types.h>
 #include <asm/hvm/asid.h>
+#include <asm/hvm/nestedhvm.h>
+#include <asm/hvm/svm/svm.h>
 #include <asm/processor.h>
 
 void svm_asid_init(const struct cpuinfo_x86 *c);
@@ -27,10 +29,16 @@ void svm_asid_handle_vmrun(void);
 
 static inline void svm_asid_g_invlpg(struct vcpu *v, unsigned long g_vaddr)
 {
-#if 0
-    /* Optimization? */
-    svm_invlpga(g_vaddr, v->arch.hvm_svm.vmcb->guest_asid);
-#endif
+    /*
+     * INVLPGA only affects the local TLB, so is of use only while the VCPU's
+     * ASID is still live on this CPU.
+     */
+    if ( v == current && !nestedhvm_vcpu_in_guestmode(v) &&
+         hvm_asid_is_live(&v->arch.hvm_vcpu.n1asid) )
+    {
+        svm_invlpga(g_vaddr, v->arch.hvm_vcpu.n1asid.asid);
+        return;
+    }
 
     /* Safe fallback. Take a new ASID. */
     hvm_asid_flush_vcpu(v);
@@ -53,6 +53,21 @@ struct hvm_mmio_cache {
     uint8_t buffer[32];
 };
 
+/*
+ * Guest frame(s) an instruction was last fetched from for emulation, along
+ * with everything the linear address translation depends upon.
+ */
+struct hvm_insn_cache {
+    unsigned long linear;
+    unsigned long cr0, cr3, cr4;
+    uint64_t efer;
+    uint32_t pfec;
+    bool valid;
+    gfn_t gfn[2];
+};
+
+#define HVM_INSN_CACHE_ENTRIES 4
+
 struct hvm_vcpu_io {
     /* I/O request in flight to device model. */
     enum hvm_io_completion io_completion;
@@ -78,6 +93,14 @@ struct hvm_vcpu_io {
     /* For retries we shouldn't re-fetch the instruction. */
     unsigned int mmio_insn_bytes;
     unsigned char mmio_insn[16];
+
+    /* Instruction fetch translations, see hvmemul_fetch_insn(). */
+    struct hvm_insn_cache insn_cache[HVM_INSN_CACHE_ENTRIES];
+    unsigned int insn_cache_next;
+
+    /* Instructions decoded, see x86_emulate().  May be NULL. */
+    struct x86_emulate_decode_cache *decode_cache;
+
     /*
      * For string instruction emulation we need to be able to signal a
      * necessary retry through other than function return codes.
@@ -145,6 +168,16 @@ struct altp2mvcpu {
 
 #define vcpu_altp2m(v) ((v)->arch.hvm_vcpu.avcpu)
 
+/* TLB flushes requested by other vCPUs, carried out ahead of VM entry. */
+#define HVM_TLB_FLUSH_VAS   8
+#define HVM_TLB_FLUSH_ALL   (~0u)
+
+struct hvm_tlb_flush {
+    spinlock_t          lock;
+    unsigned int        nr;     /* Entries in va[], or HVM_TLB_FLUSH_ALL. */
+    unsigned long       va[HVM_TLB_FLUSH_VAS];
+};
+
 struct hvm_vcpu {
     /* Guest control-register and EFER values, just as the guest sees them. */
     unsigned long       guest_cr[5];
@@ -171,6 +204,7 @@ struct hvm_vcpu {
     bool                single_step;
 
     struct hvm_vcpu_asid n1asid;
+    struct hvm_tlb_flush tlb_flush;
 
     u32                 msr_tsc_aux;
     u64                 msr_tsc_adjust;
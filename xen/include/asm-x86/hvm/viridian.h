@@ -9,6 +9,8 @@
 #ifndef __ASM_X86_HVM_VIRIDIAN_H__
 #define __ASM_X86_HVM_VIRIDIAN_H__
 
+#include <xen/timer.h>
+
 union viridian_vp_assist
 {   uint64_t raw;
     struct
@@ -19,6 +21,72 @@ union viridian_vp_assist
     } fields;
 };
 
+union viridian_page_msr
+{
+    uint64_t raw;
+    struct
+    {
+        uint64_t enabled:1;
+        uint64_t reserved_preserved:11;
+        uint64_t pfn:48;
+    } fields;
+};
+
+union viridian_sint_msr
+{
+    uint64_t raw;
+    struct
+    {
+        uint64_t vector:8;
+        uint64_t reserved_preserved1:8;
+        uint64_t mask:1;
+        uint64_t auto_eoi:1;
+        uint64_t polling:1;
+        uint64_t reserved_preserved2:45;
+    } fields;
+};
+
+union viridian_stimer_config_msr
+{
+    uint64_t raw;
+    struct
+    {
+        uint64_t enabled:1;
+        uint64_t periodic:1;
+        uint64_t lazy:1;
+        uint64_t auto_enable:1;
+        uint64_t vector:8;
+        uint64_t direct_mode:1;
+        uint64_t reserved_zero1:3;
+        uint64_t sintx:4;
+        uint64_t reserved_zero2:44;
+    } fields;
+};
+
+#define VIRIDIAN_SINT_COUNT 16
+#define VIRIDIAN_STIMER_COUNT 4
+
+struct viridian_stimer
+{
+    struct vcpu *v;
+    struct timer timer;
+    union viridian_stimer_config_msr config;
+    uint64_t count;
+    uint64_t expiration; /* Partition reference time (100ns units) */
+};
+
+/* Synthetic interrupt controller and synthetic timers of a vCPU. */
+struct viridian_synic
+{
+    uint64_t scontrol;
+    union viridian_page_msr siefp;
+    union viridian_page_msr simp;
+    void *simp_va;
+    union viridian_sint_msr sint[VIRIDIAN_SINT_COUNT];
+    struct viridian_stimer stimer[VIRIDIAN_STIMER_COUNT];
+    unsigned long stimer_pending;
+};
+
 struct viridian_vcpu
 {
     struct {
@@ -27,6 +95,7 @@ struct viridian_vcpu
         bool pending;
     } vp_assist;
     uint64_t crash_param[5];
+    struct viridian_synic *synic;
 };
 
 union viridian_guest_os_id
@@ -117,6 +186,7 @@ viridian_hypercall(struct cpu_user_regs *regs);
 void viridian_time_ref_count_freeze(struct domain *d);
 void viridian_time_ref_count_thaw(struct domain *d);
 
+int viridian_vcpu_init(struct vcpu *v);
 void viridian_vcpu_deinit(struct vcpu *v);
 void viridian_domain_deinit(struct domain *d);
 
@@ -124,6 +194,10 @@ void viridian_apic_assist_set(struct vcpu *v);
 bool viridian_apic_assist_completed(struct vcpu *v);
 void viridian_apic_assist_clear(struct vcpu *v);
 
+void viridian_synic_poll(struct vcpu *v);
+bool viridian_synic_is_auto_eoi_sint(const struct vcpu *v, unsigned int vector);
+void viridian_synic_migrate_timers(struct vcpu *v);
+
 #endif /* __ASM_X86_HVM_VIRIDIAN_H__ */
 
 /*
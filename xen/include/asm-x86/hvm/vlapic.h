@@ -115,6 +115,7 @@ void vlapic_set_irq(struct vlapic *vlapic, uint8_t vec, uint8_t trig);
 
 int vlapic_has_pending_irq(struct vcpu *v);
 int vlapic_ack_pending_irq(struct vcpu *v, int vector, bool_t force_ack);
+int vlapic_virtual_intr_delivery_enabled(void);
 
 int  vlapic_init(struct vcpu *v);
 void vlapic_destroy(struct vcpu *v);
@@ -74,6 +74,7 @@ typedef enum {
 #define EPTE_EMT_MASK           0x38
 #define EPTE_IGMT_MASK          0x40
 #define EPTE_AVAIL1_SHIFT       8
+#define EPTE_A_SHIFT            8
 #define EPTE_EMT_SHIFT          3
 #define EPTE_IGMT_SHIFT         6
 #define EPTE_RWX_MASK           0x7
@@ -596,6 +597,9 @@ int ept_p2m_init(struct p2m_domain *p2m);
 void ept_p2m_uninit(struct p2m_domain *p2m);
 
 void ept_walk_table(struct domain *d, unsigned long gfn);
+void ept_track_accessed(struct p2m_domain *p2m, bool enable);
+int ept_test_and_clear_accessed(struct p2m_domain *p2m, unsigned long gfn,
+                                unsigned int *page_order);
 bool_t ept_handle_misconfig(uint64_t gpa);
 void setup_ept_dump(void);
 void p2m_init_altp2m_ept(struct domain *d, unsigned int i);
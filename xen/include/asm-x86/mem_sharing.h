@@ -54,6 +54,9 @@ struct page_sharing_info
 #define sharing_supported(_d) \
     (is_hvm_domain(_d) && paging_mode_hap(_d)) 
 
+#define mem_sharing_is_fork(_d) \
+    (is_hvm_domain(_d) && (_d)->arch.hvm_domain.fork_parent)
+
 unsigned int mem_sharing_get_nr_saved_mfns(void);
 unsigned int mem_sharing_get_nr_shared_mfns(void);
 
@@ -86,6 +89,11 @@ static inline int mem_sharing_unshare_page(struct domain *d,
 int mem_sharing_notify_enomem(struct domain *d, unsigned long gfn,
                                 bool_t allow_sleep);
 int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg);
+/*
+ * Populate a hole of a fork from its parent, with the fork's gfn locked once.
+ * -ENOENT if there's nothing.
+ */
+int mem_sharing_fork_page(struct domain *d, gfn_t gfn, bool unsharing);
 int mem_sharing_domctl(struct domain *d, 
                        struct xen_domctl_mem_sharing_op *mec);
 void mem_sharing_init(void);
@@ -8,11 +8,18 @@ struct ucode_cpu_info;
 
 struct microcode_ops {
     int (*microcode_resume_match)(unsigned int cpu, const void *mc);
+    /*
+     * Stage the newest patch in @buf which fits @cpu in its ucode_cpu_info,
+     * without loading it.  Returns 1 if a patch was staged, 0 if none fits.
+     */
     int (*cpu_request_microcode)(unsigned int cpu, const void *buf,
                                  size_t size);
     int (*collect_cpu_info)(unsigned int cpu, struct cpu_signature *csig);
     int (*apply_microcode)(unsigned int cpu);
     int (*start_update)(void);
+    /* Run on each CPU once it is done with an update, loaded or not. */
+    void (*end_update_percpu)(void);
+    void (*free_patch)(void *mc);
 };
 
 struct cpu_signature {
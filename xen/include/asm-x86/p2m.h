@@ -27,6 +27,8 @@
 #define _XEN_ASM_X86_P2M_H
 
 #include <xen/paging.h>
+#include <xen/tasklet.h>
+#include <xen/timer.h>
 #include <xen/p2m-common.h>
 #include <xen/mem_access.h>
 #include <asm/mem_sharing.h>
@@ -320,6 +322,9 @@ struct p2m_domain {
                          entry_count;  /* # of pages in p2m marked pod      */
         gfn_t            reclaim_single; /* Last gfn of a scan */
         gfn_t            max_guest;    /* gfn of max guest demand-populate */
+        unsigned long    sweeps,       /* # of sweeps for zeroed pages      */
+                         reclaimed;    /* # of pages they reclaimed         */
+        s_time_t         sweep_time;   /* Time spent sweeping               */
 
         /*
          * Tracking of the most recently populated PoD pages, for eager
@@ -356,6 +361,30 @@ struct p2m_domain {
          unsigned int flags;
          unsigned long entry_count;
      } ioreq;
+
+    /*
+     * Host p2m: background re-coalescing of superpages shattered by
+     * changes to single pages.  Protected by the p2m lock.
+     */
+    struct {
+        struct timer     timer;
+        struct tasklet   tasklet;
+        unsigned long    next_gfn;     /* resume point of the current sweep */
+        bool             active;       /* sweep in progress or timer set    */
+        bool             pending;      /* superpages split since sweep start */
+        bool             all_2m;       /* current 1G range is all 2M leaves */
+        unsigned long    seen[3];      /* leaves counted in current sweep   */
+    } coalesce;
+
+    /* Host p2m: working set estimation state, if enabled. */
+    struct p2m_wss    *wss;
+
+    /* Statistics, for the host p2m only. */
+    struct {
+        unsigned long    entries[3];   /* 4k/2M/1G leaves as of last sweep  */
+        unsigned long    split[2];     /* 2M/1G leaves shattered            */
+        unsigned long    coalesced[2]; /* 2M/1G leaves rebuilt              */
+    } stats;
 };
 
 /* get host p2m table */
@@ -639,6 +668,27 @@ int clear_identity_p2m_entry(struct domain *d, unsigned long gfn);
 int p2m_add_foreign(struct domain *tdom, unsigned long fgfn,
                     unsigned long gpfn, domid_t foreign_domid);
 
+/*
+ * Superpage re-coalescing
+ */
+
+void p2m_coalesce_init(struct p2m_domain *p2m);
+void p2m_coalesce_kill(struct p2m_domain *p2m);
+
+/* Note a superpage of the given level (1: 2M, 2: 1G) getting split */
+void p2m_coalesce_split(struct p2m_domain *p2m, unsigned int level);
+
+/* Dump superpage information about the domain */
+void p2m_coalesce_dump_data(struct domain *d);
+
+/*
+ * Working set estimation
+ */
+
+struct xen_domctl_wss_op;
+int p2m_wss_domctl(struct domain *d, struct xen_domctl_wss_op *op);
+void p2m_wss_disable(struct p2m_domain *p2m);
+
 /* 
  * Populate-on-demand
  */
@@ -646,6 +696,10 @@ int p2m_add_foreign(struct domain *tdom, unsigned long fgfn,
 /* Dump PoD information about the domain */
 void p2m_pod_dump_data(struct domain *d);
 
+/* Fill in the PoD statistics of a domain */
+struct xen_domctl_pod_stats;
+void p2m_pod_get_stats(struct domain *d, struct xen_domctl_pod_stats *stats);
+
 /* Move all pages from the populate-on-demand cache to the domain page_list
  * (usually in preparation for domain destruction) */
 int p2m_pod_empty_cache(struct domain *d);
@@ -148,6 +148,16 @@ void paging_log_dirty_init(struct domain *d, const struct log_dirty_ops *ops);
 void paging_mark_dirty(struct domain *d, mfn_t gmfn);
 /* mark a page as dirty with taking guest pfn as parameter */
 void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn);
+/* as above, recording the page in the dirty ring of vCPU v */
+void paging_mark_pfn_dirty_vcpu(struct vcpu *v, pfn_t pfn);
+
+/* get a frame of vCPU id's dirty ring, for mapping by its consumer */
+int paging_get_dirty_ring_frame(struct domain *d, unsigned int id,
+                                unsigned long frame, mfn_t *mfn);
+
+/* get a frame of a shared log-dirty bitmap, for mapping by its consumer */
+int paging_get_log_dirty_frame(struct domain *d, unsigned long frame,
+                               mfn_t *mfn);
 
 /* is this guest page dirty? 
  * This is called from inside paging code, with the paging lock held. */
@@ -235,6 +245,15 @@ paging_fault(unsigned long va, struct cpu_user_regs *regs)
 /* Handle invlpg requests on vcpus. */
 void paging_invlpg(struct vcpu *v, unsigned long va);
 
+/*
+ * Drop all translations remembered by paging_gva_to_gfn().  Needs calling
+ * whenever the guest may have changed or flushed its translations.
+ */
+static inline void paging_walk_cache_flush(struct vcpu *v)
+{
+    v->arch.paging.walk_cache.gen++;
+}
+
 /*
  * Translate a guest virtual address to the frame number that the
  * *guest* pagetables would map it to.  Returns INVALID_GFN if the guest
@@ -137,10 +137,34 @@ PERFCOUNTER(mshv_wrmsr_eoi,             "MS Hv wrmsr eoi")
 PERFCOUNTER(mshv_wrmsr_apic_assist,     "MS Hv wrmsr APIC assist")
 PERFCOUNTER(mshv_wrmsr_apic_msr,        "MS Hv wrmsr APIC msr")
 PERFCOUNTER(mshv_wrmsr_tsc_msr,         "MS Hv wrmsr TSC msr")
+PERFCOUNTER(mshv_rdmsr_synic,           "MS Hv rdmsr SynIC")
+PERFCOUNTER(mshv_wrmsr_synic,           "MS Hv wrmsr SynIC")
+PERFCOUNTER(mshv_rdmsr_stimer,          "MS Hv rdmsr synthetic timer")
+PERFCOUNTER(mshv_wrmsr_stimer,          "MS Hv wrmsr synthetic timer")
+PERFCOUNTER(mshv_stimer_expired,        "MS Hv synthetic timer expired")
 
 PERFCOUNTER(realmode_emulations, "realmode instructions emulated")
 PERFCOUNTER(realmode_exits,      "vmexits from realmode")
 
 PERFCOUNTER(pauseloop_exits, "vmexits from Pause-Loop Detection")
 
+PERFCOUNTER(ioreq_index_hits,      "ioreq index hits")
+PERFCOUNTER(ioreq_index_misses,    "ioreq index misses")
+PERFCOUNTER(ioreq_index_probes,    "ioreq index search probes")
+PERFCOUNTER(ioreq_index_fallbacks, "ioreq index fallbacks")
+PERFCOUNTER(ioreq_index_scans,     "ioreq fallback rangeset scans")
+PERFCOUNTER(ioreq_index_rebuilds,  "ioreq index rebuilds")
+
+PERFCOUNTER(bufioreq_posted,       "buffered ioreqs posted")
+PERFCOUNTER(bufioreq_overflows,    "buffered ioreq ring full")
+PERFCOUNTER(bufioreq_notifies,     "buffered ioreq notifications")
+
+PERFCOUNTER(insn_cache_hits,       "emulator insn fetch cache hits")
+PERFCOUNTER(insn_cache_misses,     "emulator insn fetch cache misses")
+PERFCOUNTER(insn_cache_flushes,    "emulator insn fetch cache flushes")
+PERFCOUNTER(emul_simple_hits,      "emulator fast path hits")
+PERFCOUNTER(emul_simple_fallbacks, "emulator fast path fallbacks")
+PERFCOUNTER(walk_cache_hits,       "guest walk cache hits")
+PERFCOUNTER(walk_cache_misses,     "guest walk cache misses")
+
 /*#endif*/ /* __XEN_PERFC_DEFN_H__ */
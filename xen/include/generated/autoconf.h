@@ -0,0 +1,61 @@
+/*
+ *
+ * Automatically generated file; DO NOT EDIT.
+ * Xen/x86 4.11-rc Configuration
+ *
+ */
+#define CONFIG_ARCH_SUPPORTS_INT128 1
+#define CONFIG_HAS_ALTERNATIVE 1
+#define CONFIG_COMPAT 1
+#define CONFIG_HVM_FEP 1
+#define CONFIG_SCRUB_DEBUG 1
+#define CONFIG_FAST_SYMBOL_LOOKUP 1
+#define CONFIG_HAS_MEM_ACCESS 1
+#define CONFIG_HAS_VPCI 1
+#define CONFIG_SCHED_RTDS 1
+#define CONFIG_X86 1
+#define CONFIG_HAS_PDX 1
+#define CONFIG_ACPI 1
+#define CONFIG_HAS_PARALLEL_CPU_UP 1
+#define CONFIG_XENOPROF 1
+#define CONFIG_PV 1
+#define CONFIG_CORE_PARKING 1
+#define CONFIG_HAS_MEM_PAGING 1
+#define CONFIG_ARCH_DEFCONFIG "arch/x86/configs/x86_64_defconfig"
+#define CONFIG_HAS_GDBSX 1
+#define CONFIG_DEFCONFIG_LIST "$ARCH_DEFCONFIG"
+#define CONFIG_PERF_COUNTERS 1
+#define CONFIG_TBOOT 1
+#define CONFIG_SCHED_NULL 1
+#define CONFIG_HAS_PCI 1
+#define CONFIG_VIDEO 1
+#define CONFIG_HAS_EHCI 1
+#define CONFIG_PERF_ARRAYS 1
+#define CONFIG_HAS_IOPORTS 1
+#define CONFIG_SCHED_CREDIT2 1
+#define CONFIG_SCHED_CREDIT 1
+#define CONFIG_KEXEC 1
+#define CONFIG_FRAME_POINTER 1
+#define CONFIG_TMEM 1
+#define CONFIG_NUMA 1
+#define CONFIG_SCHED_DEFAULT "credit"
+#define CONFIG_HVM 1
+#define CONFIG_SCHED_ARINC653 1
+#define CONFIG_VERBOSE_DEBUG 1
+#define CONFIG_CRYPTO 1
+#define CONFIG_CMDLINE ""
+#define CONFIG_LIVEPATCH 1
+#define CONFIG_X86_64 1
+#define CONFIG_SHADOW_PAGING 1
+#define CONFIG_HAS_CPUFREQ 1
+#define CONFIG_NR_CPUS 256
+#define CONFIG_HAS_MEM_SHARING 1
+#define CONFIG_HAS_KEXEC 1
+#define CONFIG_HAS_PASSTHROUGH 1
+#define CONFIG_HAS_EX_TABLE 1
+#define CONFIG_VGA 1
+#define CONFIG_HAS_UBSAN 1
+#define CONFIG_HAS_NS16550 1
+#define CONFIG_DEBUG 1
+#define CONFIG_PV_LINEAR_PT 1
+#define CONFIG_ACPI_LEGACY_TABLES_LOOKUP 1
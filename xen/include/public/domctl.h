@@ -167,6 +167,38 @@ struct xen_domctl_getpageframeinfo3 {
 #define XEN_DOMCTL_SHADOW_OP_GET_ALLOCATION   30
 #define XEN_DOMCTL_SHADOW_OP_SET_ALLOCATION   31
 
+/*
+ * Dirty ring operations (HAP only).
+ *
+ * ENABLE_DIRTY_RINGS: with log-dirty mode enabled, additionally record pages
+ * as they get set in the bitmap in per-vCPU rings of 'pages' frames each,
+ * laid out as struct xen_dirty_ring.  The caller maps them through
+ * XENMEM_acquire_resource (XENMEM_resource_dirty_ring, id = vCPU ID).  The
+ * rings are torn down together with log-dirty mode.
+ *
+ * RESET_DIRTY_RINGS: clear from the bitmap, and re-arm dirty logging for, the
+ * pages of all entries consumed since the previous reset, then flush GFNs
+ * cached by hardware into the rings.  Accepts XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL.
+ */
+#define XEN_DOMCTL_SHADOW_OP_ENABLE_DIRTY_RINGS 40
+#define XEN_DOMCTL_SHADOW_OP_RESET_DIRTY_RINGS  41
+
+/*
+ * Shared log-dirty bitmap.
+ *
+ * SHARE_BITMAP: with log-dirty mode enabled, move the bitmap covering the
+ * first 'pages' pfns into frames the caller maps through
+ * XENMEM_acquire_resource (XENMEM_resource_log_dirty_bitmap, id 0), frame n
+ * holding the bits for pfns [n * 32768, (n + 1) * 32768).  Xen sets bits
+ * with atomic read-modify-write operations, so the caller may read and clear
+ * them, a word at a time, with atomic exchanges.  CLEAN then must be passed a
+ * NULL bitmap, and only re-arms dirty logging: in each round, the caller first
+ * collects and clears the dirty bits, then issues CLEAN, and only then sends
+ * the pages found dirty.  The frames are released with log-dirty mode.
+ * Mutually exclusive with dirty rings.
+ */
+#define XEN_DOMCTL_SHADOW_OP_SHARE_BITMAP       42
+
 /* Legacy enable operations. */
  /* Equiv. to ENABLE with no mode flags. */
 #define XEN_DOMCTL_SHADOW_OP_ENABLE_TEST       1
@@ -199,13 +231,31 @@ struct xen_domctl_getpageframeinfo3 {
   */
 #define XEN_DOMCTL_SHADOW_ENABLE_EXTERNAL  (1 << 4)
 
-/* Mode flags for XEN_DOMCTL_SHADOW_OP_{CLEAN,PEEK}. */
+/* Mode flags for XEN_DOMCTL_SHADOW_OP_{CLEAN,PEEK,RESET_DIRTY_RINGS}. */
  /*
   * This is the final iteration: Requesting to include pages mapped
   * writably by the hypervisor in the dirty bitmap.
   */
 #define XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL   (1 << 0)
 
+/* Layout of a dirty ring (see XEN_DOMCTL_SHADOW_OP_ENABLE_DIRTY_RINGS). */
+#define XEN_DIRTY_RING_MAX_FRAMES 8
+
+struct xen_dirty_ring {
+    uint32_t prod;          /* Next entry Xen fills in. */
+    uint32_t cons;          /* Next entry to consume, written by the caller. */
+    /*
+     * Set by Xen when a page couldn't be recorded because the ring was full,
+     * or had become dirty before the rings were enabled.  The bitmap then
+     * needs retrieving through XEN_DOMCTL_SHADOW_OP_CLEAN, which also clears
+     * this flag.
+     */
+    uint32_t overflow;
+    uint32_t nr_entries;    /* Size of gfn[], prod and cons wrap to 0 there. */
+    uint64_t pad[6];
+    uint64_t gfn[];
+};
+
 struct xen_domctl_shadow_op_stats {
     uint32_t fault_count;
     uint32_t dirty_count;
@@ -1093,6 +1143,55 @@ struct xen_domctl_vuart_op {
                                  */
 };
 
+/*
+ * XEN_DOMCTL_wss_op: working set estimation of HAP guests, from the accessed
+ * bits of their p2m entries (EPT only, needing A/D bit support).
+ *
+ * ENABLE: scan the p2m entries of the first 'nr' gfns (0: all gfns mapped so
+ * far) every 'interval_ms', harvesting and clearing their accessed bits.
+ * Each gfn has an age, which is the number of scans it was last found
+ * accessed before, saturating at XEN_DOMCTL_WSS_AGE_MAX.  Gfns not mapping
+ * RAM have an age of XEN_DOMCTL_WSS_AGE_UNMAPPED.  Pages mapped by
+ * superpages are aged as a whole.  Fails with -EBUSY while altp2m is
+ * active; scans pause while it gets activated later, leaving ages as they
+ * were, and the first scan after it gets deactivated doesn't age anything.
+ * DISABLE: stop scanning.
+ * GET: retrieve the number of completed scans, and a histogram of the ages
+ * of the tracked gfns as of the last completed scan: bucket 0 holds the gfns
+ * of age 0, bucket n > 0 those with ages [2^(n-1), 2^n), and the last bucket
+ * also all older ones.  If 'ages' isn't NULL, additionally copy the ages of
+ * the 'nr' gfns starting at 'gfn', updating 'nr' to the number copied.
+ */
+#define XEN_DOMCTL_WSS_OP_ENABLE      0
+#define XEN_DOMCTL_WSS_OP_DISABLE     1
+#define XEN_DOMCTL_WSS_OP_GET         2
+#define XEN_DOMCTL_WSS_BUCKETS        8
+#define XEN_DOMCTL_WSS_AGE_MAX        0xfe
+#define XEN_DOMCTL_WSS_AGE_UNMAPPED   0xff
+struct xen_domctl_wss_op {
+    uint32_t op;                /* IN: XEN_DOMCTL_WSS_OP_* */
+    uint32_t interval_ms;       /* IN: ENABLE */
+    uint64_aligned_t gfn;       /* IN: GET */
+    uint64_aligned_t nr;        /* IN: ENABLE, GET; OUT: GET */
+    uint64_aligned_t nr_gfns;   /* OUT: GET - number of gfns tracked */
+    uint64_aligned_t scans;     /* OUT: GET */
+    uint64_aligned_t hist[XEN_DOMCTL_WSS_BUCKETS]; /* OUT: GET */
+    XEN_GUEST_HANDLE_64(uint8) ages; /* OUT: GET */
+};
+
+/*
+ * XEN_DOMCTL_get_pod_stats: populate-on-demand statistics of an HVM guest,
+ * including how often, and for how long, its memory got swept for zeroed
+ * pages to reclaim into the PoD cache, and how many pages that yielded.
+ */
+struct xen_domctl_pod_stats {
+    uint64_aligned_t entries;     /* OUT: PoD entries in the p2m */
+    uint64_aligned_t cache_pages; /* OUT: pages in the PoD cache */
+    uint64_aligned_t sweeps;      /* OUT */
+    uint64_aligned_t sweep_ns;    /* OUT: total time spent sweeping */
+    uint64_aligned_t reclaimed;   /* OUT: pages reclaimed by sweeping */
+};
+
 struct xen_domctl {
     uint32_t cmd;
 #define XEN_DOMCTL_createdomain                   1
@@ -1172,6 +1271,8 @@ struct xen_domctl {
 #define XEN_DOMCTL_soft_reset                    79
 #define XEN_DOMCTL_set_gnttab_limits             80
 #define XEN_DOMCTL_vuart_op                      81
+#define XEN_DOMCTL_wss_op                        82
+#define XEN_DOMCTL_get_pod_stats                 83
 #define XEN_DOMCTL_gdbsx_guestmemio            1000
 #define XEN_DOMCTL_gdbsx_pausevcpu             1001
 #define XEN_DOMCTL_gdbsx_unpausevcpu           1002
@@ -1234,6 +1335,8 @@ struct xen_domctl {
         struct xen_domctl_psr_alloc         psr_alloc;
         struct xen_domctl_set_gnttab_limits set_gnttab_limits;
         struct xen_domctl_vuart_op          vuart_op;
+        struct xen_domctl_wss_op            wss_op;
+        struct xen_domctl_pod_stats         pod_stats;
         uint8_t                             pad[128];
     } u;
 };
@@ -417,6 +417,56 @@ struct xen_dm_op_pin_memory_cacheattr {
     uint32_t pad;
 };
 
+/*
+ * XEN_DMOP_set_ioreq_server_batch: Allow repeated string I/O forwarded to
+ *                                  the IOREQ Server <id> to be batched.
+ *
+ * By default an ioreq with data_is_ptr set never references more than one
+ * page of guest RAM, so e.g. a 16k rep ins/outs is delivered as four
+ * separate requests, each costing a full round trip to the emulator.
+ * With <nr_pages> greater than 1 Xen may instead post a single ioreq
+ * whose data buffer (<count> * <size> bytes at <data>, growing downwards
+ * if <df> is set) spans up to <nr_pages> contiguous pages of guest RAM.
+ * All <count> repetitions must be completed before the response is
+ * signalled. Setting <nr_pages> back to 1 restores the default.
+ */
+#define XEN_DMOP_set_ioreq_server_batch 19
+
+struct xen_dm_op_set_ioreq_server_batch {
+    /* IN - server id */
+    ioservid_t id;
+    /* IN - maximum number of guest pages referenced by a single ioreq */
+    uint16_t nr_pages;
+#define XEN_DMOP_IOREQ_BATCH_MAX_PAGES 16
+};
+
+/*
+ * XEN_DMOP_set_ioreq_server_bufioreq: Use a buffered ioreq ring of
+ *                                     <nr_pages> pages for IOREQ Server
+ *                                     <id>.
+ *
+ * A single page buffered ring easily fills up under heavy guest activity
+ * (e.g. VGA), at which point further posted writes are sent as
+ * synchronous ioreqs. This op selects the buffered_ioring layout (see
+ * hvm/ioreq.h) instead, which may span multiple pages and batches
+ * notifications. The ring can only be mapped through
+ * XENMEM_acquire_resource, using
+ * XENMEM_resource_ioreq_server_frame_bufioreq_ring(0 ... <nr_pages> - 1).
+ *
+ * The server must have been created with buffered ioreq handling enabled,
+ * and this op has to be issued before its pages are first mapped and
+ * before it is enabled.
+ */
+#define XEN_DMOP_set_ioreq_server_bufioreq 20
+
+struct xen_dm_op_set_ioreq_server_bufioreq {
+    /* IN - server id */
+    ioservid_t id;
+    /* IN - number of pages of the ring */
+    uint16_t nr_pages;
+#define XEN_DMOP_BUFIOREQ_MAX_PAGES 8
+};
+
 struct xen_dm_op {
     uint32_t op;
     uint32_t pad;
@@ -440,6 +490,8 @@ struct xen_dm_op {
         struct xen_dm_op_remote_shutdown remote_shutdown;
         struct xen_dm_op_relocate_memory relocate_memory;
         struct xen_dm_op_pin_memory_cacheattr pin_memory_cacheattr;
+        struct xen_dm_op_set_ioreq_server_batch set_ioreq_server_batch;
+        struct xen_dm_op_set_ioreq_server_bufioreq set_ioreq_server_bufioreq;
     } u;
 };
 
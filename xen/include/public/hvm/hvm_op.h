@@ -80,9 +80,32 @@ DEFINE_XEN_GUEST_HANDLE(xen_hvm_set_pci_link_route_t);
 
 #endif /* __XEN_INTERFACE_VERSION__ < 0x00040900 */
 
-/* Flushes all VCPU TLBs: @arg must be NULL. */
+/*
+ * Flushes VCPU TLBs: all TLBs of all VCPUs if @arg is NULL, or else those
+ * selected by the xen_hvm_flush_tlbs_t @arg points to.
+ */
 #define HVMOP_flush_tlbs          5
 
+#define HVMOP_FLUSH_TLBS_MAX_RANGES 8
+
+struct xen_hvm_flush_tlbs {
+    /* IN: HVMOP_FLUSH_TLBS_* */
+    uint32_t flags;
+/* Flush all VCPUs, ignoring vcpu_mask. */
+#define HVMOP_FLUSH_TLBS_ALL_VCPUS (1u << 0)
+    /* IN: number of valid entries in range[]; 0 flushes entire TLBs. */
+    uint32_t nr_ranges;
+    /* IN: VCPUs to flush, bit N % 64 of vcpu_mask[N / 64] for VCPU N. */
+    uint64_t vcpu_mask[2];
+    /* IN: linear address ranges to flush. */
+    struct {
+        uint64_t va;          /* Address within the first page. */
+        uint64_t nr_pages;
+    } range[HVMOP_FLUSH_TLBS_MAX_RANGES];
+};
+typedef struct xen_hvm_flush_tlbs xen_hvm_flush_tlbs_t;
+DEFINE_XEN_GUEST_HANDLE(xen_hvm_flush_tlbs_t);
+
 /*
  * hvmmem_type_t should not be defined when generating the corresponding
  * compat header. This will ensure that the improperly named HVMMEM_(*)
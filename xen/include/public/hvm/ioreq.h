@@ -98,6 +98,38 @@ struct buffered_iopage {
 }; /* NB. Size of this structure must be no greater than one page. */
 typedef struct buffered_iopage buffered_iopage_t;
 
+/*
+ * Buffered ioreq ring spanning one or more pages, used instead of
+ * buffered_iopage by servers which selected it through
+ * XEN_DMOP_set_ioreq_server_bufioreq.
+ *
+ * Slots hold buf_ioreq_t entries as in buffered_iopage, each a single
+ * naturally aligned qword written in one go (an 8-byte access takes two
+ * consecutive slots). read_pointer and write_pointer also work the same
+ * way, with IOREQ_BUFFER_RING_SLOTS() in place of IOREQ_BUFFER_SLOT_NUM.
+ *
+ * Notifications are batched: Xen signals the buffered ioreq event channel
+ * only if notify is non-zero, clearing it at the same time. A consumer
+ * about to wait for further entries must set notify and then check the
+ * ring once more.
+ * overflows counts entries Xen could not post because the ring was full,
+ * which were delivered as synchronous ioreqs instead.
+ */
+struct buffered_ioring {
+#ifdef __XEN__
+    union bufioreq_pointers ptrs;
+#else
+    uint32_t read_pointer;
+    uint32_t write_pointer;
+#endif
+    uint32_t notify;
+    uint32_t overflows;
+    buf_ioreq_t buf_ioreq[1]; /* IOREQ_BUFFER_RING_SLOTS(pages) entries */
+};
+typedef struct buffered_ioring buffered_ioring_t;
+
+#define IOREQ_BUFFER_RING_SLOTS(pages) (((pages) * 4096 - 16) / 8)
+
 /*
  * ACPI Control/Event register locations. Location is controlled by a 
  * version number in HVM_PARAM_ACPI_IOPORTS_LOCATION.
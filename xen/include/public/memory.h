@@ -482,6 +482,8 @@ DEFINE_XEN_GUEST_HANDLE(xen_mem_access_op_t);
 #define XENMEM_sharing_op_add_physmap       6
 #define XENMEM_sharing_op_audit             7
 #define XENMEM_sharing_op_range_share       8
+#define XENMEM_sharing_op_fork              9
+#define XENMEM_sharing_op_fork_reset        10
 
 #define XENMEM_SHARING_OP_S_HANDLE_INVALID  (-10)
 #define XENMEM_SHARING_OP_C_HANDLE_INVALID  (-9)
@@ -525,6 +527,22 @@ struct xen_mem_sharing_op {
             domid_t client_domain;           /* IN: the client domain id */
             uint16_t _pad[3];                /* Must be set to 0 */
         } range;
+        /*
+         * OP_FORK: turn 'domain', a freshly created and paused HVM domain
+         * with as many vCPUs as the (HAP) parent, into a copy-on-write
+         * clone of the parent.  The parent's memory gets populated into the
+         * fork on access, shared while only read, while its vCPU and device
+         * state gets copied right away.  The parent stays paused until the
+         * fork gets destroyed.  Both need sharing enabled.
+         * OP_FORK_RESET: reset a paused fork to its parent's state, dropping
+         * the memory it got populated privately.  Pages mapped elsewhere,
+         * e.g. by a device model, get the parent's contents copied back
+         * instead; -EBUSY if the parent has no memory there.
+         */
+        struct mem_sharing_op_fork {      /* OP_FORK */
+            domid_t parent_domain;        /* IN: the parent's domain id */
+            uint16_t _pad[3];             /* Must be set to 0 */
+        } fork;
         struct mem_sharing_op_debug {     /* OP_DEBUG_xxx */
             union {
                 uint64_aligned_t gfn;      /* IN: gfn to debug          */
@@ -611,12 +629,15 @@ struct xen_mem_acquire_resource {
     uint16_t type;
 
 #define XENMEM_resource_ioreq_server 0
+#define XENMEM_resource_dirty_ring 1
+#define XENMEM_resource_log_dirty_bitmap 2
 
     /*
      * IN - a type-specific resource identifier, which must be zero
      *      unless stated otherwise.
      *
      * type == XENMEM_resource_ioreq_server -> id == ioreq server id
+     * type == XENMEM_resource_dirty_ring -> id == vCPU ID
      */
     uint32_t id;
     /*
@@ -644,6 +665,12 @@ struct xen_mem_acquire_resource {
 
 #define XENMEM_resource_ioreq_server_frame_bufioreq 0
 #define XENMEM_resource_ioreq_server_frame_ioreq(n) (1 + (n))
+/*
+ * Page <n> of a buffered ioreq ring selected through
+ * XEN_DMOP_set_ioreq_server_bufioreq, so that the whole ring can be mapped
+ * contiguously. Page 0 is also XENMEM_resource_ioreq_server_frame_bufioreq.
+ */
+#define XENMEM_resource_ioreq_server_frame_bufioreq_ring(n) (0x100 + (n))
 
     /*
      * IN/OUT - If the tools domain is PV then, upon return, frame_list
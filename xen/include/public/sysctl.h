@@ -36,7 +36,7 @@
 #include "physdev.h"
 #include "tmem.h"
 
-#define XEN_SYSCTL_INTERFACE_VERSION 0x00000011
+#define XEN_SYSCTL_INTERFACE_VERSION 0x00000012
 
 /*
  * Read console content from Xen buffer ring.
@@ -628,6 +628,48 @@ struct xen_sysctl_scheduler_op {
     } u;
 };
 
+/* XEN_SYSCTL_sched_stats_op */
+/* Sub-operations: */
+#define XEN_SYSCTL_SCHED_STATS_query   0 /* Get per-pCPU statistics. */
+#define XEN_SYSCTL_SCHED_STATS_reset   1 /* Reset all statistics to zero. */
+#define XEN_SYSCTL_SCHED_STATS_enable  2 /* Start accounting. */
+#define XEN_SYSCTL_SCHED_STATS_disable 3 /* Stop accounting. */
+/*
+ * Scheduler overhead of one pCPU. Times are in nanoseconds, and the
+ * matching *_count fields say how many samples they are made of.
+ */
+struct xen_sysctl_sched_stats {
+    uint32_t cpupool;                 /* cpupool id, or ~0U if in none */
+    uint32_t pad;
+    uint64_aligned_t schedule_count;  /* schedule() invocations */
+    uint64_aligned_t schedule_time;   /*   time spent deciding */
+    uint64_aligned_t ctxsw_count;     /* context switches */
+    uint64_aligned_t ctxsw_time;      /*   time spent switching */
+    uint64_aligned_t lock_count;      /* schedule lock acquisitions */
+    uint64_aligned_t lock_wait_time;  /*   time spent waiting for them */
+    uint64_aligned_t lock_wait_max;   /*   longest single wait */
+    uint64_aligned_t wake_count;      /* vcpu_wake() invocations */
+    uint64_aligned_t wake_time;
+    uint64_aligned_t sleep_count;     /* vcpu_sleep_nosync() invocations */
+    uint64_aligned_t sleep_time;
+};
+typedef struct xen_sysctl_sched_stats xen_sysctl_sched_stats_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_sched_stats_t);
+struct xen_sysctl_sched_stats_op {
+    /* IN variables. */
+    uint32_t cmd;                     /* XEN_SYSCTL_SCHED_STATS_* */
+    /*
+     * IN/OUT (query only): size of the stats array (indexed by pCPU id) on
+     * input, number of valid entries on output. If stats is NULL, only the
+     * number of entries needed is returned.
+     */
+    uint32_t num_cpus;
+    /* OUT variables. */
+    uint32_t enabled;                 /* accounting is active */
+    uint32_t pad;
+    XEN_GUEST_HANDLE_64(xen_sysctl_sched_stats_t) stats;
+};
+
 /*
  * Output format of gcov data:
  *
@@ -1092,6 +1134,7 @@ struct xen_sysctl {
 #define XEN_SYSCTL_get_cpu_featureset            26
 #define XEN_SYSCTL_livepatch_op                  27
 #define XEN_SYSCTL_set_parameter                 28
+#define XEN_SYSCTL_sched_stats_op                29
     uint32_t interface_version; /* XEN_SYSCTL_INTERFACE_VERSION */
     union {
         struct xen_sysctl_readconsole       readconsole;
@@ -1121,6 +1164,7 @@ struct xen_sysctl {
         struct xen_sysctl_cpu_featureset    cpu_featureset;
         struct xen_sysctl_livepatch_op      livepatch;
         struct xen_sysctl_set_parameter     set_parameter;
+        struct xen_sysctl_sched_stats_op    sched_stats_op;
         uint8_t                             pad[128];
     } u;
 };
@@ -0,0 +1,14 @@
+#define XEN_COMPILE_DATE	"Fri Oct 16 16:10:50 UTC 2026"
+#define XEN_COMPILE_TIME	"16:10:50"
+#define XEN_COMPILE_BY		""
+#define XEN_COMPILE_DOMAIN	""
+#define XEN_COMPILE_HOST	"vm"
+#define XEN_COMPILER		"gcc (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+#define XEN_VERSION		4
+#define XEN_SUBVERSION		11
+#define XEN_EXTRAVERSION	"-rc"
+
+#define XEN_CHANGESET		"Fri Oct 16 16:10:30 2026 +0000 git:3991554"
+#define XEN_BANNER		\
+"\040\130\145\156\040\064\056\061\061\055\162\143\012"
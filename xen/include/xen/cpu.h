@@ -4,6 +4,7 @@
 #include <xen/types.h>
 #include <xen/spinlock.h>
 #include <xen/notifier.h>
+#include <xen/time.h>
 
 /* Safely access cpu_online_map, cpu_present_map, etc. */
 bool_t get_cpu_maps(void);
@@ -52,6 +53,22 @@ void register_cpu_notifier(struct notifier_block *nb);
 int cpu_down(unsigned int cpu);
 int cpu_up(unsigned int cpu);
 
+#ifdef CONFIG_HAS_PARALLEL_CPU_UP
+/* Time, in ns, spent in each phase of cpu_up_batch(). */
+struct cpu_up_times {
+    s_time_t prepare;   /* CPU_UP_PREPARE notifiers */
+    s_time_t start;     /* __cpu_up_start() */
+    s_time_t finish;    /* __cpu_up_finish() */
+    s_time_t online;    /* CPU_ONLINE notifiers */
+};
+
+/*
+ * Bring up a set of CPUs, overlapping their early initialisation.  Failures
+ * are reported on the console.  Returns the number of CPUs brought online.
+ */
+unsigned int cpu_up_batch(const cpumask_t *cpus, struct cpu_up_times *times);
+#endif
+
 /* From arch code, send CPU_STARTING notification. */
 void notify_cpu_starting(unsigned int cpu);
 
@@ -61,6 +78,15 @@ void enable_nonboot_cpus(void);
 
 /* Private arch-dependent helpers for CPU hotplug. */
 int __cpu_up(unsigned int cpunum);
+#ifdef CONFIG_HAS_PARALLEL_CPU_UP
+/*
+ * __cpu_up() split in two: __cpu_up_start() returns once the CPU no longer
+ * needs any state shared between booting CPUs, __cpu_up_finish() waits for
+ * it to come online.
+ */
+int __cpu_up_start(unsigned int cpunum);
+int __cpu_up_finish(unsigned int cpunum);
+#endif
 void __cpu_disable(void);
 void __cpu_die(unsigned int cpu);
 
@@ -54,6 +54,11 @@ PERFCOUNTER(load_balance_other,     "csched: load_balance_other")
 PERFCOUNTER(steal_trylock,          "csched: steal_trylock")
 PERFCOUNTER(steal_trylock_failed,   "csched: steal_trylock_failed")
 PERFCOUNTER(steal_peer_idle,        "csched: steal_peer_idle")
+PERFCOUNTER(steal_peek_skipped,     "csched: steal_peek_skipped")
+PERFCOUNTER(steal_success,          "csched: steal_success")
+PERFCOUNTER(steal_success_smt,      "csched: steal_success_smt")
+PERFCOUNTER(steal_success_llc,      "csched: steal_success_llc")
+PERFCOUNTER(steal_success_remote,   "csched: steal_success_remote")
 PERFCOUNTER(migrate_queued,         "csched: migrate_queued")
 PERFCOUNTER(migrate_running,        "csched: migrate_running")
 PERFCOUNTER(migrate_kicked_away,    "csched: migrate_kicked_away")
@@ -10,6 +10,7 @@
 
 #include <xen/percpu.h>
 #include <xen/err.h>
+#include <xen/time.h>
 
 /* A global pointer to the initial cpupool (POOL0). */
 extern struct cpupool *cpupool0;
@@ -59,12 +60,61 @@ DECLARE_PER_CPU(cpumask_t, cpumask_scratch);
 #define cpumask_scratch        (&this_cpu(cpumask_scratch))
 #define cpumask_scratch_cpu(c) (&per_cpu(cpumask_scratch, c))
 
+/*
+ * Per-pCPU scheduler overhead accounting, reported via
+ * XEN_SYSCTL_sched_stats_op. Each pCPU only ever updates its own entry.
+ */
+struct sched_stats {
+    uint64_t schedule_count, schedule_time;
+    uint64_t ctxsw_count, ctxsw_time;
+    uint64_t lock_count, lock_wait_time, lock_wait_max;
+    uint64_t wake_count, wake_time;
+    uint64_t sleep_count, sleep_time;
+    s_time_t ctxsw_start;  /* Context switch in progress since. */
+};
+
+DECLARE_PER_CPU(struct sched_stats, sched_stats);
+extern bool sched_stats_enabled;
+
+/* Timestamp for starting a measurement, or 0 if accounting is disabled. */
+static inline s_time_t sched_stats_start(void)
+{
+    return unlikely(sched_stats_enabled) ? NOW() : 0;
+}
+
+#define sched_stats_account(start, what) do {              \
+    s_time_t start_ = (start);                              \
+    if ( unlikely(start_) )                                 \
+    {                                                       \
+        struct sched_stats *ss_ = &this_cpu(sched_stats);   \
+        ss_->what ## _count++;                              \
+        ss_->what ## _time += NOW() - start_;               \
+    }                                                       \
+} while ( 0 )
+
+static inline void sched_stats_lock_acquired(s_time_t start)
+{
+    struct sched_stats *ss;
+    s_time_t wait;
+
+    if ( likely(!start) )
+        return;
+
+    wait = NOW() - start;
+    ss = &this_cpu(sched_stats);
+    ss->lock_count++;
+    ss->lock_wait_time += wait;
+    if ( wait > ss->lock_wait_max )
+        ss->lock_wait_max = wait;
+}
+
 #define sched_lock(kind, param, cpu, irq, arg...) \
 static inline spinlock_t *kind##_schedule_lock##irq(param EXTRA_TYPE(arg)) \
 { \
     for ( ; ; ) \
     { \
         spinlock_t *lock = per_cpu(schedule_data, cpu).schedule_lock; \
+        s_time_t start = sched_stats_start(); \
         /* \
          * v->processor may change when grabbing the lock; but \
          * per_cpu(v->processor) may also change, if changing cpu pool \
@@ -74,6 +124,7 @@ static inline spinlock_t *kind##_schedule_lock##irq(param EXTRA_TYPE(arg)) \
          * lock may be the same; this will succeed in that case. \
          */ \
         spin_lock##irq(lock, ## arg); \
+        sched_stats_lock_acquired(start); \
         if ( likely(lock == per_cpu(schedule_data, cpu).schedule_lock) ) \
             return lock; \
         spin_unlock##irq(lock, ## arg); \
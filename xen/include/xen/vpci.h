@@ -55,10 +55,21 @@ uint32_t vpci_hw_read32(const struct pci_dev *pdev, unsigned int reg,
  */
 bool __must_check vpci_process_pending(struct vcpu *v);
 
+/*
+ * Number of entries in the handler index: one per dword of the legacy
+ * configuration space, plus a last one covering the extended space.
+ */
+#define VPCI_INDEX_SIZE (PCI_CFG_SPACE_SIZE / 4 + 1)
+
 struct vpci {
     /* List of vPCI handlers for a device. */
     struct list_head handlers;
     spinlock_t lock;
+    /*
+     * First handler (in list order) ending past the start of each dword,
+     * NULL if there's none. Protected by the lock above.
+     */
+    struct vpci_register *index[VPCI_INDEX_SIZE];
 
 #ifdef __XEN__
     /* Hide the rest of the vpci struct from the user-space test harness. */
@@ -88,6 +99,9 @@ struct vpci {
          * is mapped into guest p2m) if there's a ROM BAR on the device.
          */
         bool rom_enabled      : 1;
+        /* Start time and size of the last {un}mapping of the BARs. */
+        s_time_t map_start;
+        unsigned long map_pages;
         /* FIXME: currently there's no support for SR-IOV. */
     } header;
 
@@ -748,6 +748,12 @@ static int flask_domctl(struct domain *d, int cmd)
     case XEN_DOMCTL_set_gnttab_limits:
         return current_has_perm(d, SECCLASS_DOMAIN2, DOMAIN2__SET_GNTTAB_LIMITS);
 
+    case XEN_DOMCTL_wss_op:
+        return current_has_perm(d, SECCLASS_DOMAIN2, DOMAIN2__WSS_OP);
+
+    case XEN_DOMCTL_get_pod_stats:
+        return current_has_perm(d, SECCLASS_DOMAIN, DOMAIN__GETPODTARGET);
+
     default:
         return avc_unknown_permission("domctl", cmd);
     }
@@ -830,6 +836,9 @@ static int flask_sysctl(int cmd)
     case XEN_SYSCTL_set_parameter:
         return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
                                     XEN2__SET_PARAMETER, NULL);
+    case XEN_SYSCTL_sched_stats_op:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__SCHED_STATS_OP, NULL);
 
     default:
         return avc_unknown_permission("sysctl", cmd);